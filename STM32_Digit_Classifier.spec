@@ -0,0 +1,43 @@
+# PyInstaller build of the GUI: pyinstaller STM32_Digit_Classifier.spec
+#
+# One directory (dist/STM32_Digit_Classifier/), not one file: a --onefile
+# exe unpacks its whole bundle into a temporary folder on every start
+# before Python runs at all, the largest part of its cold start. This one
+# starts in place, and main.py imports numpy only once the drawing screen
+# is first shown. main.py logs the time to the first window either way.
+import os
+
+block_cipher = None
+here = os.path.abspath(SPECPATH)
+
+a = Analysis(
+    [os.path.join(here, 'main.py')],
+    pathex=[here],
+    datas=[(os.path.join(here, 'emnist_digits_int8.tflite'), '.')],
+    # reference.load_interpreter() imports the first one installed by name
+    hiddenimports=['ai_edge_litert.interpreter', 'tflite_runtime.interpreter'],
+    # Notebook and training packages an environment may have, never imported by the GUI
+    excludes=['matplotlib', 'IPython', 'jupyter', 'notebook', 'pandas', 'scipy'],
+    cipher=block_cipher,
+    noarchive=False,
+)
+pyz = PYZ(a.pure, a.zipped_data, cipher=block_cipher)
+
+exe = EXE(
+    pyz,
+    a.scripts,
+    [],
+    exclude_binaries=True,
+    name='STM32_Digit_Classifier',
+    icon=os.path.join(here, 'icon.ico'),
+    console=False,
+    upx=False,  # decompressing DLLs on every start costs more than their size saves
+)
+coll = COLLECT(
+    exe,
+    a.binaries,
+    a.zipfiles,
+    a.datas,
+    name='STM32_Digit_Classifier',
+    upx=False,
+)
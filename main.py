@@ -1,36 +1,65 @@
 import tkinter as tk
-from tkinter import ttk, messagebox
-from PIL import Image, ImageDraw, ImageTk
-import numpy as np
-import serial
-import time
+from tkinter import ttk, messagebox, filedialog
+import math
+import os
+import sys
 import threading
+import time
+import logging
+from concurrent.futures import Future
 from dataclasses import dataclass
 from typing import Optional
 
+from stm32dc import protocol, timers, tracing
+from stm32dc.adapter import tune
+from stm32dc.boards import discover, expand
+from stm32dc.cache import ResultCache
+from stm32dc.capture import CaptureWriter
+from stm32dc.link import ClassifierLink, DeviceError, DEFAULT_BAUD
+from stm32dc.pacer import FramePacer
+from stm32dc.worker import LinkWorker, BULK, LINK_DOWN, LINK_UP
+# numpy and the modules built on it (stm32dc.preprocess, stm32dc.segment)
+# are imported where first used: the connection screen needs none of them
+
+log = logging.getLogger(__name__)
+
 @dataclass
 class PredictionResult:
     """Container for prediction results"""
     digit: Optional[int] = None
     error: Optional[str] = None
+    profile: Optional[protocol.Profile] = None
+    blank: bool = False  # the device saw too little ink for a digit
+    number: Optional[str] = None  # number mode: the digits left to right, '?' where one failed
 
 class DrawingCanvas:
     """Canvas for drawing digits"""
+    # Brush for the model per canvas pixel of height, 24 px on the 320 px canvas
+    BRUSH = 24 / 320
+    # Motion events are recorded as they come and drawn once per frame
+    FRAME_MS = 16
+    
     def __init__(self, parent, size=320):
         self.size = size
+        self.width = self.height = size
         self.canvas = tk.Canvas(parent, width=size, height=size, bg='white', 
                                 cursor='crosshair', highlightthickness=2, 
                                 highlightbackground='#e5e7eb', relief='flat')
         self.canvas.pack(pady=15)
         
-        # Create PIL image for drawing
-        self.image = Image.new('L', (size, size), 'white')
-        self.draw = ImageDraw.Draw(self.image)
+        # Stroke points for the model, rasterised on predict (24 px brush)
+        from stm32dc.preprocess import StrokeRecorder
+        self.strokes = StrokeRecorder(brush=24)
         
         # Drawing state
         self.last_x = None
         self.last_y = None
         self.is_drawing = False
+        self.segment_items = []  # Tk segments of the stroke in progress
+        self.pending = []        # points recorded since the last segment was drawn
+        self.flush_id = None     # after() drawing them
+        self.version = 0         # bumped whenever the model image changes
+        self.on_stroke_end = None  # called once a stroke is finished
         
         # Bind mouse events
         self.canvas.bind('<Button-1>', self.start_draw)
@@ -42,59 +71,162 @@ class DrawingCanvas:
         self.is_drawing = True
         self.last_x = event.x
         self.last_y = event.y
+        self.strokes.begin(event.x, event.y)
+        self.version += 1
     
     def draw_line(self, event):
-        """Draw line on canvas"""
+        """Record a point of the stroke; the canvas catches up once per frame"""
         if self.is_drawing:
             x, y = event.x, event.y
             
-            # Draw on canvas
-            self.canvas.create_line(
-                self.last_x, self.last_y, x, y,
-                width=8, fill='#1e293b', capstyle=tk.ROUND, smooth=True
-            )
-            
-            # Draw on PIL image
-            self.draw.line(
-                [self.last_x, self.last_y, x, y],
-                fill='black', width=24
-            )
+            # Record the point, jitter below a pixel or two is dropped
+            if not self.strokes.add(x, y):
+                return
+            self.version += 1
             
-            self.last_x = x
-            self.last_y = y
+            self.pending += (x, y)
+            if self.flush_id is None:
+                self.flush_id = self.canvas.after(self.FRAME_MS, self.flush)
+    
+    def flush(self):
+        """Draw the points since the last frame as one segment"""
+        self.flush_id = None
+        if not self.pending:
+            return
+        self.segment_items.append(self.canvas.create_line(
+            self.last_x, self.last_y, *self.pending,
+            width=8, fill='#1e293b', capstyle=tk.ROUND, joinstyle=tk.ROUND
+        ))
+        self.last_x, self.last_y = self.pending[-2:]
+        self.pending = []
+    
+    def cancel_flush(self):
+        if self.flush_id is not None:
+            self.canvas.after_cancel(self.flush_id)
+            self.flush_id = None
+        self.pending = []
     
     def stop_draw(self, event):
         """Stop drawing"""
         self.is_drawing = False
         self.last_x = None
         self.last_y = None
-    
+        self.cancel_flush()
+        
+        # Replace the stroke's segments with a single polyline item
+        points = self.strokes.current()
+        if self.segment_items:
+            self.canvas.delete(*self.segment_items)
+            self.segment_items = []
+        if len(points) >= 4:
+            self.canvas.create_line(
+                *points, width=8, fill='#1e293b',
+                capstyle=tk.ROUND, joinstyle=tk.ROUND, smooth=True
+            )
+        elif len(points) == 2:
+            x, y = points
+            self.canvas.create_oval(x - 4, y - 4, x + 4, y + 4, fill='#1e293b', outline='')
+        if self.on_stroke_end is not None and points:
+            self.on_stroke_end()
+
     def clear(self):
         """Clear the canvas"""
+        self.cancel_flush()
         self.canvas.delete('all')
-        self.image = Image.new('L', (self.size, self.size), 'white')
-        self.draw = ImageDraw.Draw(self.image)
+        self.segment_items = []
+        self.strokes.clear()
+        self.version += 1
     
-    def get_image_array(self):
-        """Get preprocessed image as numpy array"""
-        # Resize to 28x28 (MNIST size)
-        img_resized = self.image.resize((28, 28), Image.Resampling.LANCZOS)
-        
-        # Invert colors (white digit on black background)
-        img_array = np.array(img_resized, dtype=np.uint8)
-        img_array = 255 - img_array
-        
-        return img_array.flatten()
+    def resize(self, width, height):
+        """Clear and reshape the canvas, the brush follows its height"""
+        self.clear()
+        self.width, self.height = width, height
+        self.strokes.radius = self.BRUSH * height / 2
+        self.canvas.config(width=width, height=height)
+    
+    def get_ink(self, scale=0.5):
+        """The canvas as drawn, white on black, for segment()"""
+        return self.strokes.ink(self.width, self.height, scale)
+    
+    def has_ink(self):
+        """True once anything has been drawn since the last clear"""
+        return bool(self.strokes.strokes)
+    
+    def get_image_array(self, small=False):
+        """Get preprocessed image as numpy array, 14x14 for CLASSIFY_SMALL when small"""
+        # EMNIST framed strokes: white digit on black, 28x28, flattened
+        image = self.strokes.to_model()
+        if small:
+            from stm32dc.preprocess import downsample
+            return downsample(image)
+        return image
+    
+    def get_strokes(self):
+        """STROKES body of the drawing, None when the pixels would be shorter"""
+        body = self.strokes.packed(self.width, self.height)
+        return body if body is not None and len(body) < protocol.IMAGE_PIXELS else None
+
+def photo_array(photo):
+    """uint8 [h, w, 3] pixels of a Tk PhotoImage"""
+    import numpy as np
+    # 'data' lists each row as {#rrggbb #rrggbb ...}
+    data = photo.tk.call(photo, 'data')
+    if not isinstance(data, str):
+        data = ' '.join(' '.join(row) if isinstance(row, tuple) else str(row) for row in data)
+    hexes = data.replace('{', ' ').replace('}', ' ').replace('#', '').split()
+    return np.frombuffer(bytes.fromhex(''.join(hexes)), np.uint8).reshape(photo.height(), photo.width(), 3)
+
+def process_age():
+    """Seconds since this process started, or since the exe that unpacked it did (--onefile)"""
+    pid = os.getpid()
+    base = getattr(sys, '_MEIPASS', None)
+    if base and os.path.basename(base).startswith('_MEI'):
+        pid = os.getppid()  # the --onefile bootloader, which unpacks the bundle then starts us
+    try:
+        if sys.platform == 'win32':
+            import ctypes
+            kernel32 = ctypes.windll.kernel32
+            kernel32.OpenProcess.restype = ctypes.c_void_p
+            handle = kernel32.OpenProcess(0x1000, False, pid)  # PROCESS_QUERY_LIMITED_INFORMATION
+            created, now, unused = ctypes.c_ulonglong(), ctypes.c_ulonglong(), ctypes.c_ulonglong()
+            ok = kernel32.GetProcessTimes(ctypes.c_void_p(handle), ctypes.byref(created), ctypes.byref(unused),
+                                          ctypes.byref(unused), ctypes.byref(unused))
+            kernel32.CloseHandle(ctypes.c_void_p(handle))
+            kernel32.GetSystemTimePreciseAsFileTime(ctypes.byref(now))
+            return (now.value - created.value) / 1e7 if ok else None
+        with open(f'/proc/{pid}/stat') as f:
+            started = int(f.read().rsplit(')', 1)[1].split()[19]) / os.sysconf('SC_CLK_TCK')
+        with open('/proc/uptime') as f:
+            return float(f.read().split()[0]) - started
+    except (OSError, AttributeError, ValueError, IndexError):
+        return None
 
 class LoadingSpinner:
     """Animated loading spinner"""
+    DOTS = 8
+    STEP = 10           # degrees a frame
+    FRAME_MS = 50
+    
     def __init__(self, parent, size=40):
         self.canvas = tk.Canvas(parent, width=size, height=size, 
                                bg='white', highlightthickness=0)
         self.size = size
-        self.angle = 0
+        self.frame = 0
         self.is_running = False
         self.animation_id = None
+        # Dot boxes of every frame, worked out once; a frame only moves the dots
+        center = size // 2
+        radius = size // 3
+        self.frames = []
+        for start in range(0, 360, self.STEP):
+            boxes = []
+            for i in range(self.DOTS):
+                angle = math.radians(start + i * 360 / self.DOTS)
+                x = center + radius * math.cos(angle)
+                y = center + radius * math.sin(angle)
+                boxes.append((x - 3, y - 3, x + 3, y + 3))
+            self.frames.append(boxes)
+        self.dots = []
         
     def pack(self, **kwargs):
         self.canvas.pack(**kwargs)
@@ -106,6 +238,9 @@ class LoadingSpinner:
     def start(self):
         """Start spinner animation"""
         self.is_running = True
+        if not self.dots:
+            self.dots = [self.canvas.create_oval(*box, fill='#3b82f6', outline='')
+                         for box in self.frames[self.frame]]
         self.animate()
         
     def stop(self):
@@ -115,35 +250,63 @@ class LoadingSpinner:
             self.canvas.after_cancel(self.animation_id)
             self.animation_id = None
         self.canvas.delete('all')
+        self.dots = []
         
     def animate(self):
-        """Animate the spinner"""
+        """Move the dots on a frame"""
         if not self.is_running:
             return
-            
-        self.canvas.delete('all')
-        center = self.size // 2
-        radius = self.size // 3
-        
-        # Draw arc
-        for i in range(8):
-            angle = (self.angle + i * 45) % 360
-            opacity = int(255 * (i / 8))
-            color = f'#{opacity:02x}{opacity:02x}{opacity:02x}'
-            
-            x = center + radius * np.cos(np.radians(angle))
-            y = center + radius * np.sin(np.radians(angle))
-            
-            self.canvas.create_oval(x-3, y-3, x+3, y+3, 
-                                   fill='#3b82f6', outline='')
         
-        self.angle = (self.angle + 10) % 360
-        self.animation_id = self.canvas.after(50, self.animate)
+        for dot, box in zip(self.dots, self.frames[self.frame]):
+            self.canvas.coords(dot, *box)
+        
+        self.frame = (self.frame + 1) % len(self.frames)
+        self.animation_id = self.canvas.after(self.FRAME_MS, self.animate)
+
+class PerfPanel:
+    """Performance figures of the session (stm32dc.perfmon), one line per kind"""
+    def __init__(self, parent):
+        self.frame = tk.Frame(parent, bg='#f1f5f9')
+        tk.Label(
+            self.frame, text="Performance", anchor='w',
+            font=('Segoe UI', 9, 'bold'), fg='#475569', bg='#f1f5f9'
+        ).pack(fill=tk.X, padx=10, pady=(6, 0))
+        self.text = tk.Label(
+            self.frame, text="", justify=tk.LEFT, anchor='w',
+            font=('Consolas', 8), fg='#334155', bg='#f1f5f9'
+        )
+        self.text.pack(fill=tk.X, padx=10, pady=(0, 6))
+    
+    def pack(self, **kwargs):
+        self.frame.pack(**kwargs)
+    
+    def pack_forget(self):
+        self.frame.pack_forget()
+    
+    def visible(self):
+        return bool(self.frame.winfo_ismapped())
+    
+    def show(self, text):
+        # Configuring a label redraws it, unchanged figures leave it be
+        if self.text.cget('text') != text:
+            self.text.config(text=text)
 
 class STM32DigitClassifier:
     """Main application window"""
     
-    def __init__(self, root):
+    # Live mode: how often the canvas is checked for changes to send, on
+    # the host model; a board sets its own pace (live_pacer)
+    LIVE_INTERVAL_MS = 50
+    PERF_REFRESH_MS = 500
+    # Soak: a synthetic pen point every SOAK_POINT_MS, SOAK_POINTS a stroke,
+    # the canvas cleared every SOAK_STROKES strokes
+    SOAK_POINT_MS = 16
+    SOAK_POINTS = 40
+    SOAK_STROKES = 4
+    # Number mode canvas, a few digits side by side
+    NUMBER_CANVAS = (560, 200)
+    
+    def __init__(self, root, capture=None, trace=None, soak=None):
         self.root = root
         self.root.title("STM32 Digit Classifier")
         self.root.geometry("750x700")
@@ -153,7 +316,58 @@ class STM32DigitClassifier:
         
         # Serial connection
         self.serial_conn = None
+        self.link = None
+        self.worker = None
+        # Every request and reply of the session goes here (stm32dc.capture)
+        self.capture = capture
+        # Chrome trace of the session's spans, written on close (stm32dc.tracing)
+        self.trace = trace
+        self.link_baud = None
+        self.link_profiled = True
         self.is_connected = False
+        # TFLite model standing in for the board (stm32dc.reference)
+        self.reference = None
+        
+        # Live mode: as many frames in flight as the board keeps busy, and
+        # one waiting that newer drawings replace (stm32dc.pacer); frames go
+        # out compressed, mostly as deltas of the previous one
+        self.live_var = tk.BooleanVar(value=False)
+        self.live_pacer = None
+        self.live_future = None
+        # Performance panels of the drawing and result screens, fed every
+        # PERF_REFRESH_MS while one is shown (stm32dc.perfmon)
+        self.perf = None
+        self.perf_panels = []
+        self.perf_var = tk.BooleanVar(value=False)
+        self.perf_after = None
+        self.live_version = None
+        self.live_image = None      # the frame last sent, for the delta gate
+        self.live_after = None
+        # Live digits by image content, an unchanged or redrawn canvas skips the round trip
+        self.live_cache = ResultCache()
+        # Speculation: every stroke end classifies the canvas at BULK
+        # priority into live_cache, so Predict usually finds its answer there
+        self.spec_future = None
+        self.spec_key = None
+        
+        # Soak (main.py --soak MINUTES): once connected, live mode on a
+        # canvas scribbled on by soak_tick, sampled by stm32dc.soak
+        self.soak = soak
+        self.soak_after = None
+        self.soak_step = 0
+        self.soak_items = 0         # canvas items before each clear, read by the sampling thread
+        self.soak_stop = threading.Event()
+        
+        # Number mode: a wide canvas cut into digits, all sent as one BATCH
+        self.number_var = tk.BooleanVar(value=False)
+        
+        # Stroke upload: the pen's polylines instead of pixels, tens of bytes
+        # a digit; the device rasterises them (CLASSIFY_PACKED STROKES)
+        self.strokes_var = tk.BooleanVar(value=False)
+        
+        # Fast mode: 14x14 images, a quarter of the bytes, for the board's
+        # small model (CLASSIFY_SMALL); the board keeps its selected model
+        self.small_var = tk.BooleanVar(value=False)
         
         # Screens
         self.screens = {}
@@ -249,10 +463,13 @@ class STM32DigitClassifier:
         )
         subtitle_label.pack()
         
-        self.setup_connection_screen()
-        self.setup_drawing_screen()
-        self.setup_result_screen()
-        
+        # Built the first time each is shown: the window appears with the
+        # connection screen alone, numpy loads with the drawing screen
+        self.screen_builders = {
+            'connection': self.setup_connection_screen,
+            'drawing': self.setup_drawing_screen,
+            'result': self.setup_result_screen,
+        }
         self.show_screen('connection')
         
     def setup_connection_screen(self):
@@ -306,6 +523,10 @@ class STM32DigitClassifier:
                               width=25, font=('Segoe UI', 10))
         port_entry.pack(side=tk.LEFT, padx=10, fill=tk.X, expand=True)
         
+        # PING every serial port at once; `auto` or `uid:PREFIX` also work as a port
+        self.find_btn = ttk.Button(port_container, text="🔍 Find", command=self.find_boards)
+        self.find_btn.pack(side=tk.LEFT)
+        
         # Baud rate
         baud_container = tk.Frame(config_frame, bg='#f8fafc')
         baud_container.pack(fill=tk.X, pady=8)
@@ -315,11 +536,17 @@ class STM32DigitClassifier:
             font=('Segoe UI', 10, 'bold'), bg='#f8fafc', fg='#475569'
         ).pack(side=tk.LEFT)
         
-        self.baud_var = tk.StringVar(value='115200')
+        self.baud_var = tk.StringVar(value='921600')
         baud_entry = ttk.Entry(baud_container, textvariable=self.baud_var, 
                               width=25, font=('Segoe UI', 10))
         baud_entry.pack(side=tk.LEFT, padx=10, fill=tk.X, expand=True)
         
+        # Handshake lines, firmware built with APP_UART_FLOW on an adapter wired to PA0/PA1
+        self.rtscts_var = tk.BooleanVar(value=False)
+        ttk.Checkbutton(
+            config_frame, text="RTS/CTS flow control", variable=self.rtscts_var
+        ).pack(anchor='w', pady=4)
+        
         # Loading spinner (hidden initially)
         self.connection_spinner = LoadingSpinner(content_frame, size=40)
         
@@ -330,6 +557,12 @@ class STM32DigitClassifier:
         )
         self.connect_btn.pack(pady=15)
         
+        # No board attached: classify with the .tflite on this PC
+        self.host_btn = ttk.Button(
+            content_frame, text="💻 Run on this PC", command=self.use_host_model
+        )
+        self.host_btn.pack()
+        
         # Status indicator
         status_container = tk.Frame(content_frame, bg='#f1f5f9', bd=0, 
                                    relief='flat')
@@ -378,16 +611,18 @@ class STM32DigitClassifier:
         header_frame.pack(fill=tk.X, padx=20, pady=(20, 0))
         header_frame.pack_propagate(False)
         
-        tk.Label(
+        self.drawing_title = tk.Label(
             header_frame, text="Draw a Digit (0-9)",
             font=('Segoe UI', 16, 'bold'), fg='#1e293b', bg='#f8fafc'
-        ).pack(pady=15)
+        )
+        self.drawing_title.pack(pady=15)
         
         # Content
         content_frame = tk.Frame(draw_frame, bg='white')
         content_frame.pack(fill=tk.BOTH, padx=30, pady=20)
         
         self.canvas = DrawingCanvas(content_frame)
+        self.canvas.on_stroke_end = self.speculate
         
         # Button frame
         btn_frame = tk.Frame(content_frame, bg='white')
@@ -423,6 +658,51 @@ class STM32DigitClassifier:
             font=('Segoe UI', 9), fg='#64748b', bg='white'
         )
         
+        # Live prediction
+        live_container = tk.Frame(content_frame, bg='white')
+        live_container.pack()
+        
+        ttk.Checkbutton(
+            live_container, text="Live prediction while drawing",
+            variable=self.live_var, command=self.toggle_live
+        ).pack(side=tk.LEFT, padx=5)
+        
+        self.live_label = tk.Label(
+            live_container, text="", width=16, anchor='w',
+            font=('Segoe UI', 11, 'bold'), fg='#10b981', bg='white'
+        )
+        self.live_label.pack(side=tk.LEFT, padx=5)
+        
+        # Whole numbers: drawn on a wide canvas or read from an image file
+        number_container = tk.Frame(content_frame, bg='white')
+        number_container.pack(pady=(5, 0))
+        
+        ttk.Checkbutton(
+            number_container, text="Whole number (wide canvas)",
+            variable=self.number_var, command=self.toggle_number
+        ).pack(side=tk.LEFT, padx=5)
+        
+        ttk.Button(
+            number_container, text="📂 Import Image", command=self.import_image
+        ).pack(side=tk.LEFT, padx=5)
+        
+        ttk.Checkbutton(
+            content_frame, text="Send strokes, rasterised on the device",
+            variable=self.strokes_var
+        ).pack(pady=(5, 0))
+        
+        ttk.Checkbutton(
+            content_frame, text="Fast mode: 14×14 images",
+            variable=self.small_var, command=self.toggle_small
+        ).pack(pady=(5, 0))
+        
+        ttk.Checkbutton(
+            content_frame, text="Show performance",
+            variable=self.perf_var, command=self.toggle_perf
+        ).pack(pady=(5, 0))
+        self.drawing_perf = PerfPanel(content_frame)
+        self.perf_panels.append(self.drawing_perf)
+        
         self.screens['drawing'] = self.drawing_screen
     
     def setup_result_screen(self):
@@ -468,6 +748,17 @@ class STM32DigitClassifier:
             font=('Segoe UI', 16), fg='#64748b', bg='#f8fafc'
         )
         self.result_text.pack(pady=15)
+
+        # On-target stage timings (CLASSIFY_PROF)
+        self.profile_text = tk.Label(
+            self.result_container, text="",
+            font=('Segoe UI', 9), fg='#64748b', bg='#f8fafc'
+        )
+        self.profile_text.pack()
+        
+        result_perf = PerfPanel(content_frame)
+        result_perf.pack(fill=tk.X)
+        self.perf_panels.append(result_perf)
         
         # Button frame
         btn_frame = tk.Frame(content_frame, bg='white')
@@ -485,12 +776,18 @@ class STM32DigitClassifier:
         
         self.screens['result'] = self.result_screen
     
+    def screen(self, screen_name):
+        """The screen's frame, built on first use"""
+        if screen_name not in self.screens:
+            self.screen_builders[screen_name]()
+        return self.screens[screen_name]
+    
     def show_screen(self, screen_name):
         """Switch to specified screen"""
+        screen = self.screen(screen_name)
         if self.current_screen:
             self.current_screen.pack_forget()
         
-        screen = self.screens[screen_name]
         screen.pack(fill=tk.BOTH, expand=True)
         self.current_screen = screen
     
@@ -507,27 +804,92 @@ class STM32DigitClassifier:
         thread.daemon = True
         thread.start()
     
+    def find_boards(self):
+        """Fill in the port of the first board that answers on any serial port"""
+        self.find_btn.config(state='disabled')
+        self.status_label.config(text="● Searching serial ports...", fg='#f59e0b')
+        
+        def search():
+            try:
+                baud = int(self.baud_var.get())
+            except ValueError:
+                baud = DEFAULT_BAUD
+            boards = discover(baud=baud)
+            self.root.after(0, lambda: self.on_boards_found(boards))
+        
+        threading.Thread(target=search, daemon=True).start()
+    
+    def on_boards_found(self, boards):
+        """Show what discovery found, the first board's port in the entry"""
+        self.find_btn.config(state='normal')
+        for board in boards:
+            log.info("found %s", board.describe())
+        if not boards:
+            self.status_label.config(text="● No board on any serial port", fg='#dc2626')
+            return
+        board = boards[0]
+        self.port_var.set(board.port)
+        identity = f"ID {board.uid[:8]}, firmware {board.caps.firmware()}" if board.uid else "no ID"
+        others = f", {len(boards) - 1} more" if len(boards) > 1 else ""
+        self.status_label.config(text=f"● Found {board.port} ({identity}){others}", fg='#475569')
+    
+    def open_link(self, port, baud, rtscts):
+        """Open port and reach the board at baud, (conn, link, rate); raises on failure"""
+        # The firmware boots at DEFAULT_BAUD unless a rate was saved
+        # (CONFIG), connect() tries the requested one first
+        import serial
+        conn = serial.Serial(
+            port=port,
+            baudrate=DEFAULT_BAUD,
+            timeout=5,
+            write_timeout=5,
+            rtscts=rtscts
+        )
+        try:
+            # USB adapter latency timer and driver buffers, where the host allows
+            adapter = tune(conn)
+            log.info("%s: %s", port, adapter.describe())
+            # Clear buffers
+            conn.reset_input_buffer()
+            conn.reset_output_buffer()
+            
+            # PING until the firmware answers; the boot banner is skipped
+            # as noise by the frame reader
+            link = ClassifierLink(conn)
+            rate = link.connect(baud)
+            self.check_capabilities(link.caps)
+            # Reply timeouts from the board's own frame times
+            link.calibrate()
+        except Exception:
+            conn.close()
+            raise
+        return conn, link, rate
+    
     def connect_thread(self):
         """Connection thread"""
-        port = self.port_var.get()
         baud = int(self.baud_var.get())
+        rtscts = self.rtscts_var.get()
         
         try:
-            self.serial_conn = serial.Serial(
-                port=port,
-                baudrate=baud,
-                timeout=5,
-                write_timeout=5
-            )
-            time.sleep(2)  # Wait for connection
-            
-            # Clear buffers
-            self.serial_conn.reset_input_buffer()
-            self.serial_conn.reset_output_buffer()
+            port = expand([self.port_var.get()], baud)[0]
+            self.serial_conn, self.link, self.link_baud = self.open_link(port, baud, rtscts)
+            caps = self.link.caps
+            self.link_profiled = caps is None or bool(caps.flags & protocol.CAP_PROFILE)
             
-            # Read banner
-            self.read_banner()
+            # After a USB glitch the worker opens the port again by itself
+            # and resends what was in flight
+            def reopen():
+                self.serial_conn, self.link, _ = self.open_link(port, baud, rtscts)
+                return self.link
             
+            # From here on all port I/O goes through the worker threads
+            self.worker = LinkWorker(
+                self.link, capture=self.capture, reopen=reopen,
+                on_state=lambda state: self.root.after(0, lambda: self.on_link_state(state))
+            ).start()
+            self.live_pacer = FramePacer(self.worker)
+            from stm32dc.perfmon import PerfMonitor
+            self.perf = PerfMonitor(self.worker, self.live_cache)
             self.is_connected = True
             
             # Update UI in main thread
@@ -541,9 +903,136 @@ class STM32DigitClassifier:
         """Handle successful connection"""
         self.connection_spinner.stop()
         self.connection_spinner.pack_forget()
-        self.status_label.config(text="✓ Connected Successfully", fg='#10b981')
+        self.status_label.config(
+            text=f"✓ Connected Successfully ({self.link_baud} baud)", fg='#10b981')
         self.connect_btn.config(text="🔌 Connect to Device")
         self.next_btn.config(state='normal')
+        self.toggle_live()
+        self.refresh_perf()
+        if self.soak:
+            self.start_soak()
+    
+    def start_soak(self):
+        """Draw and classify live for self.soak minutes, sampled and checked by stm32dc.soak"""
+        from stm32dc import soak
+        
+        self.show_screen('drawing')
+        self.live_var.set(True)
+        self.toggle_live()
+        self.soak_step = 0
+        self.soak_stop.clear()
+        self.soak_tick()
+        minutes = self.soak
+        worker = self.worker
+        port = self.port_var.get()
+        
+        def run():
+            monitor = soak.SoakMonitor({port: worker}, {'tk_items': lambda: self.soak_items})
+            interval = min(soak.SAMPLE, minutes * 6)  # ten samples at least
+            end = time.monotonic() + minutes * 60
+            while time.monotonic() < end and not self.soak_stop.wait(interval):
+                sample, found = monitor.sample()
+                log.info("soak %s", sample.line())
+                for _, kind, detail in found:
+                    log.warning("soak %s: %s", kind, detail)
+            monitor.close()
+            log.info("soak finished: %s", monitor.report())
+            self.root.after(0, self.stop_soak)
+        
+        threading.Thread(target=run, name='soak', daemon=True).start()
+    
+    def soak_tick(self):
+        """One pen point of a synthetic stroke, a new figure every stroke"""
+        self.soak_after = None
+        canvas = self.canvas
+        stroke, point = divmod(self.soak_step, self.SOAK_POINTS + 1)
+        if point == 0 and stroke % self.SOAK_STROKES == 0:
+            self.soak_items = len(canvas.canvas.find_all())
+            self.clear_canvas()
+        if point < self.SOAK_POINTS:
+            t = 2 * math.pi * point / self.SOAK_POINTS
+            size = canvas.size
+            event = tk.Event()
+            event.x = int(size * (0.5 + 0.3 * math.sin((stroke % 3 + 1) * t + stroke)))
+            event.y = int(size * (0.5 + 0.3 * math.cos(2 * t)))
+            (canvas.start_draw if point == 0 else canvas.draw_line)(event)
+        else:
+            canvas.stop_draw(None)
+        self.soak_step += 1
+        self.soak_after = self.root.after(self.SOAK_POINT_MS, self.soak_tick)
+    
+    def stop_soak(self):
+        self.soak_stop.set()
+        if self.soak_after is not None:
+            self.root.after_cancel(self.soak_after)
+            self.soak_after = None
+    
+    def toggle_perf(self):
+        if self.perf_var.get():
+            self.drawing_perf.pack(fill=tk.X, pady=(5, 0))
+            self.refresh_perf()
+        else:
+            self.drawing_perf.pack_forget()
+    
+    def refresh_perf(self):
+        """Update the shown performance panels, and again in PERF_REFRESH_MS"""
+        if self.perf_after is not None:
+            self.root.after_cancel(self.perf_after)
+        self.perf_after = None
+        shown = [p for p in self.perf_panels if p.visible()]
+        if shown:
+            if self.perf is not None:
+                text = '\n'.join(self.perf.snapshot().lines())
+            elif self.reference is not None:
+                text = "host model (TFLite): no board figures"
+            else:
+                text = "not connected"
+            for panel in shown:
+                panel.show(text)
+        if self.is_connected:
+            self.perf_after = self.root.after(self.PERF_REFRESH_MS, self.refresh_perf)
+    
+    def on_link_state(self, state):
+        """The worker lost the port, got it back, or gave up on it"""
+        worker = self.worker
+        if worker is None:
+            return
+        if state == LINK_DOWN:
+            log.warning("port lost, reconnecting")
+            self.root.title("STM32 Digit Classifier (reconnecting...)")
+        elif state == LINK_UP:
+            log.info("reconnected after %.0f ms", worker.outage * 1e3)
+            self.root.title("STM32 Digit Classifier")
+        else:
+            self.root.title("STM32 Digit Classifier")
+            self.disconnect_and_back()
+            messagebox.showerror("Connection Lost",
+                                 f"The board did not come back within {worker.RECONNECT_WINDOW:.0f} s.")
+    
+    def use_host_model(self):
+        """Classify with the TFLite model instead of a board"""
+        from stm32dc.reference import ReferenceModel, DEFAULT_MODEL
+        base = getattr(sys, '_MEIPASS', os.path.dirname(os.path.abspath(__file__)))
+        try:
+            self.reference = ReferenceModel(os.path.join(base, DEFAULT_MODEL))
+        except (Exception, SystemExit) as e:
+            messagebox.showerror("Host Model", f"Cannot load the TFLite model:\n\n{e}")
+            return
+        self.link_profiled = False
+        self.is_connected = True
+        self.status_label.config(text="✓ Host model (TFLite), no board", fg='#10b981')
+        self.next_btn.config(state='normal')
+        self.toggle_live()
+        self.refresh_perf()
+    
+    def host_future(self, img_data):
+        """A resolved future of the host model's digit, like the worker's"""
+        future = Future()
+        try:
+            future.set_result(self.reference.classify(img_data))
+        except Exception as e:
+            future.set_exception(e)
+        return future
     
     def on_connect_error(self, error_msg):
         """Handle connection error"""
@@ -555,11 +1044,25 @@ class STM32DigitClassifier:
     
     def disconnect(self):
         """Disconnect from STM32"""
+        self.stop_soak()
+        self.stop_live()
+        if self.worker:
+            self.worker.close()
+            self.worker = None
+        self.live_pacer = None
+        self.perf = None
+        if self.perf_after is not None:
+            self.root.after_cancel(self.perf_after)
+            self.perf_after = None
         if self.serial_conn and self.serial_conn.is_open:
             self.serial_conn.close()
         
         self.is_connected = False
         self.serial_conn = None
+        self.link = None
+        self.reference = None
+        # Another board may run another model
+        self.live_cache.clear()
     
     def disconnect_and_back(self):
         """Disconnect and return to connection screen"""
@@ -569,119 +1072,366 @@ class STM32DigitClassifier:
         self.next_btn.config(state='disabled')
         self.show_screen('connection')
     
-    def read_banner(self):
-        """Read initialization banner"""
-        start = time.time()
-        while time.time() - start < 2:
-            if self.serial_conn.in_waiting:
-                self.serial_conn.readline()
+    def check_capabilities(self, caps):
+        """Refuse firmware speaking another protocol or expecting other images"""
+        if caps is None:
+            log.info("firmware predates PING, capabilities unknown")
+            return
+        log.info("protocol v%d, input %s, %d classes, model %s",
+                 caps.version, 'x'.join(map(str, caps.input_shape)), caps.num_classes,
+                 caps.model_hash)
+        if caps.version != protocol.PROTOCOL_VERSION:
+            raise ConnectionError(
+                f"Firmware speaks protocol v{caps.version}, expected v{protocol.PROTOCOL_VERSION}")
+        if caps.input_shape != (28, 28, 1):
+            raise ConnectionError(f"Model expects {caps.input_shape} input, not 28x28x1")
     
     def clear_canvas(self):
         """Clear the drawing canvas"""
         self.canvas.clear()
+        if self.spec_future is not None and not self.spec_future.done() and self.worker is not None:
+            self.worker.cancel(self.spec_future)
+        self.spec_future = None
+        self.spec_key = None
+        self.live_label.config(text="")
+    
+    def toggle_number(self):
+        """Switch the canvas between one digit and a whole number"""
+        if self.number_var.get():
+            self.canvas.resize(*self.NUMBER_CANVAS)
+            self.drawing_title.config(text="Write a Number")
+            self.send_btn.config(text="🚀 Read Number")
+        else:
+            self.canvas.resize(self.canvas.size, self.canvas.size)
+            self.drawing_title.config(text="Draw a Digit (0-9)")
+            self.send_btn.config(text="🚀 Predict Digit")
+        self.live_label.config(text="")
+    
+    def toggle_live(self):
+        """Start or stop streaming the canvas while drawing"""
+        if self.live_var.get() and self.is_connected:
+            self.live_version = None
+            self.live_image = None
+            if self.live_after is None:
+                self.live_tick()
+        else:
+            self.stop_live()
+    
+    def toggle_small(self):
+        """Frames change size: the next live frame is sent whatever it looks like"""
+        self.live_version = None
+        self.live_image = None
+    
+    def small(self):
+        """Whether pixels go out as 14x14 CLASSIFY_SMALL images, never to the host model"""
+        return self.small_var.get() and not self.reference
+    
+    def stop_live(self):
+        if self.live_after is not None:
+            self.root.after_cancel(self.live_after)
+            self.live_after = None
+        if self.live_future is not None:
+            self.live_future.cancel()
+            self.live_future = None
+        if 'drawing' in self.screens:
+            self.live_label.config(text="")
+    
+    def live_tick(self):
+        """Send the canvas if it changed, at the pace the board answers"""
+        self.live_after = None
+        if not self.live_var.get() or not self.is_connected:
+            return
+        if self.number_var.get():
+            # The wide canvas is read on demand only
+            self.live_after = self.root.after(self.LIVE_INTERVAL_MS, self.live_tick)
+            return
+        
+        version = self.canvas.version
+        if version != self.live_version and self.canvas.has_ink():
+            image = self.canvas.get_image_array(self.small())
+            pending = self.live_future
+            from stm32dc.preprocess import DELTA_GATE, delta_energy
+            if self.live_image is not None and delta_energy(image, self.live_image) < DELTA_GATE:
+                # Barely changed since the frame last sent: its answer stands
+                self.live_version = version
+            # The frame in flight is stale: withdraw it, even from the device
+            # mid-run, so the answer tracks the latest stroke
+            elif pending is not None and not pending.done() and self.live_pacer is not None and \
+                    self.live_pacer.cancel(pending):
+                pending = None
+            # A board's pacer holds what it cannot send yet
+            if self.live_version != version and \
+                    (pending is None or pending.done() or self.live_pacer is not None):
+                self.live_version = version
+                self.live_image = image
+                img_data = image.tobytes()
+                strokes = self.canvas.get_strokes() if self.strokes_var.get() else None
+                if self.reference:
+                    future = self.host_future(img_data)
+                elif strokes is not None:
+                    # Cached by the strokes: the device's rasterisation is its own
+                    future = self.live_cache.classify(
+                        strokes, lambda body: self.live_pacer.send(self.worker.classify_strokes, body))
+                elif self.small():
+                    # Keyed by the 14x14 bytes: never a full size answer
+                    future = self.live_cache.classify(
+                        img_data, lambda img: self.live_pacer.send(self.worker.classify_small, img))
+                else:
+                    future = self.live_cache.classify(
+                        img_data, lambda img: self.live_pacer.send(self.worker.classify_packed, img))
+                self.live_future = future
+                future.add_done_callback(
+                    lambda f: self.later(lambda: self.on_live_result(f)))
+        
+        interval = self.live_pacer.interval_ms() if self.live_pacer else self.LIVE_INTERVAL_MS
+        self.live_after = self.root.after(interval, self.live_tick)
+    
+    def on_live_result(self, future):
+        """Show a live prediction unless a newer frame has been sent since"""
+        if future is not self.live_future or future.cancelled():
+            return
+        try:
+            digit = future.result()
+            self.live_label.config(text="Live: no digit" if digit is None else f"Live: {digit}",
+                                   fg='#10b981')
+        except DeviceError as e:
+            self.live_image = None  # the next frame may not reuse a failed one
+            if e.code == protocol.ERR_PARAM and self.strokes_var.get():
+                # Firmware without the STROKES encoding: back to pixels
+                self.strokes_var.set(False)
+                self.live_version = None
+            self.live_label.config(text=str(e), fg='#dc2626')
+        except TimeoutError:
+            self.live_image = None
+            self.live_label.config(text="Live: timeout", fg='#dc2626')
+        except Exception as e:
+            self.live_image = None
+            self.live_label.config(text="Live: link error", fg='#dc2626')
+            log.warning("live prediction failed: %s", e)
     
     def draw_another(self):
         """Clear canvas and return to drawing screen"""
         self.clear_canvas()
         self.show_screen('drawing')
     
+    def speculation(self):
+        """Cache key and BULK submit of the canvas as Predict would send it, None when it would not"""
+        if not self.is_connected or self.reference or self.worker is None or \
+                self.number_var.get() or not self.canvas.has_ink():
+            return None, None
+        worker = self.worker
+        strokes = self.canvas.get_strokes() if self.strokes_var.get() else None
+        if strokes is not None:
+            return strokes, lambda body: worker.classify_strokes(body, priority=BULK)
+        if self.small():
+            return (self.canvas.get_image_array(True).tobytes(),
+                    lambda image: worker.classify_small(image, priority=BULK))
+        return (self.canvas.get_image_array().tobytes(),
+                lambda image: worker.classify_packed(image, priority=BULK))
+
+    def speculate(self):
+        """Stroke end: classify the canvas ahead of Predict, withdrawing the stale guess"""
+        key, submit = self.speculation()
+        # Live prediction already sends every change
+        if key is None or key == self.spec_key or self.live_var.get():
+            return
+        pending = self.spec_future
+        if pending is not None and not pending.done() and self.worker is not None:
+            self.worker.cancel(pending)
+        self.spec_key = key
+        self.spec_future = self.live_cache.classify(key, submit)
+
     def classify_digit(self):
         """Classify the drawn digit"""
         if not self.is_connected:
             messagebox.showwarning("Not Connected", "Please connect to STM32 first")
             return
         
-        # Disable send button and show progress
+        self.show_progress()
+        key, _ = self.speculation()
+        digit = self.live_cache.get(key) if key is not None else None
+        if digit is not None:
+            # Guessed at the last stroke end, or live prediction's
+            self.display_result(PredictionResult(digit=digit))
+        elif key is not None and key == self.spec_key and not self.spec_future.cancelled():
+            # Guessed at the last stroke end, not answered yet
+            future = self.spec_future
+            future.add_done_callback(
+                lambda f: self.later(lambda: self.on_speculation(f, key)))
+        elif self.number_var.get():
+            self.predict_number(self.canvas.get_ink())
+        elif self.strokes_var.get() and not self.reference and self.canvas.get_strokes() is not None:
+            self.predict_strokes(self.canvas.get_strokes())
+        else:
+            with tracing.span('preprocess'):
+                img_data = self.canvas.get_image_array().tobytes()
+            self.predict(img_data)
+
+    def on_speculation(self, future, key):
+        """Show a speculative result, or ask again if the guess failed"""
+        if future.cancelled() or future.exception() is not None:
+            self.spec_key = None
+            if self.strokes_var.get() and self.canvas.get_strokes() == key:
+                self.predict_strokes(key)
+            else:
+                self.predict(self.canvas.get_image_array().tobytes())
+            return
+        result = future.result()
+        self.display_result(PredictionResult(digit=result, blank=result is None))
+    
+    def show_progress(self):
+        """Disable send button and show progress"""
         self.send_btn.config(state='disabled')
         self.progress.pack()
         self.progress.start(10)
         self.progress_label.pack(pady=(10, 0))
-        
-        # Run classification in separate thread
-        thread = threading.Thread(target=self.classify_thread)
-        thread.daemon = True
-        thread.start()
     
-    def classify_thread(self):
-        """Classification thread"""
+    def import_image(self):
+        """Read the number in an image file"""
+        if not self.is_connected:
+            messagebox.showwarning("Not Connected", "Please connect to STM32 first")
+            return
+        path = filedialog.askopenfilename(
+            title="Image of a number",
+            filetypes=[("Images", "*.png *.gif *.pgm *.ppm"), ("NumPy array", "*.npy"), ("All files", "*")])
+        if not path:
+            return
         try:
-            # Get image data
-            img_data = self.canvas.get_image_array()
-            
-            # Send to STM32
-            result = self.send_and_receive(img_data)
-            
-            # Update UI in main thread
-            self.root.after(0, lambda: self.display_result(result))
-            
+            if path.lower().endswith('.npy'):
+                import numpy as np
+                image = np.load(path)
+            else:
+                image = photo_array(tk.PhotoImage(file=path))
         except Exception as e:
-            error_result = PredictionResult(error=str(e))
-            self.root.after(0, lambda: self.display_result(error_result))
+            messagebox.showerror("Import Image", f"Cannot read {os.path.basename(path)}:\n\n{e}")
+            return
+        self.show_progress()
+        self.predict_number(image)
+    
+    def predict_number(self, image):
+        """Cut image into digits off the Tk thread, then classify them all in one BATCH"""
+        from stm32dc.segment import segment
+
+        def run():
+            try:
+                with tracing.span('segment'):
+                    crops, _ = segment(image)
+            except Exception as e:
+                self.root.after(0, lambda: self.display_result(PredictionResult(error=f"Segmentation failed: {e}")))
+                return
+            if len(crops) == 0:
+                self.root.after(0, lambda: self.display_result(PredictionResult(blank=True)))
+                return
+            if self.reference:
+                future = Future()
+                try:
+                    future.set_result([self.reference.classify(c.tobytes()) for c in crops])
+                except Exception as e:
+                    future.set_exception(e)
+            else:
+                future = self.worker.classify_batch([c.tobytes() for c in crops])
+            future.add_done_callback(lambda f: self.later(lambda: self.on_number(f)))
+        threading.Thread(target=run, daemon=True).start()
     
-    def send_and_receive(self, img_data):
-        """Send image and receive prediction"""
+    def on_number(self, future):
+        """Turn a resolved batch future into a PredictionResult"""
         result = PredictionResult()
-        
         try:
-            # Clear buffers
-            self.serial_conn.reset_input_buffer()
-            self.serial_conn.reset_output_buffer()
-            
-            # Send START command
-            self.serial_conn.write(b"START")
-            self.serial_conn.flush()
-            time.sleep(0.05)
-            
-            # Send image data in chunks
-            CHUNK = 64
-            for i in range(0, len(img_data), CHUNK):
-                chunk = img_data[i:i + CHUNK]
-                self.serial_conn.write(chunk.tobytes())
-                self.serial_conn.flush()
-                time.sleep(0.005)
-            
-            # Read response
-            start = time.time()
-            timeout = 10
-            all_lines = []
-            
-            while time.time() - start < timeout:
-                if self.serial_conn.in_waiting:
-                    line = self.serial_conn.readline().decode(errors='ignore').strip()
-                    
-                    if not line:
-                        continue
-                    
-                    all_lines.append(line)
-                    
-                    # Check for error
-                    if "ERROR" in line.upper():
-                        result.error = line
-                        return result
-                    
-                    # Parse digit
-                    try:
-                        digit = int(line)
-                        result.digit = digit
-                        return result
-                    except ValueError:
-                        pass
-                
-                time.sleep(0.01)
-            
-            # Timeout
-            if all_lines:
-                result.error = f"No digit found. Received: {', '.join(all_lines[:5])}"
+            result.number = ''.join('?' if d is None else str(d) for d in future.result())
+        except DeviceError as e:
+            result.error = str(e)
+        except TimeoutError:
+            result.error = "Timeout: No response from STM32"
+        except Exception as e:
+            result.error = f"Communication error: {str(e)}"
+        self.display_result(result)
+
+    def predict(self, img_data):
+        """Queue img_data on the link worker, the result is shown when it resolves"""
+        if self.reference:
+            future = self.host_future(img_data)
+            self.root.after(0, lambda: self.on_prediction(future, img_data))
+            return
+        worker = self.worker
+        if self.small():
+            from stm32dc.preprocess import downsample
+            with tracing.span('preprocess', small=True):
+                small = downsample(img_data).tobytes()
+            with tracing.span('submit'):
+                future = worker.classify_small(small)
+            future.add_done_callback(
+                lambda f: self.later(lambda: self.on_prediction(f, img_data, small=True)))
+            return
+        with tracing.span('submit'):
+            future = worker.classify_profiled(img_data) if self.link_profiled else worker.classify(img_data)
+        # Runs on the worker's reader thread: hand over to the Tk thread
+        future.add_done_callback(
+            lambda f: self.later(lambda: self.on_prediction(f, img_data)))
+
+    def later(self, callback):
+        """Run callback on the Tk thread, from a future's done callback
+
+        Traced as the wait for the Tk thread and the UI update it does.
+        """
+        tracer = tracing.active()
+        if tracer is None:
+            self.root.after(0, callback)
+            return
+        handed = time.perf_counter()
+
+        def run():
+            tracer.steps('ui wait', [('after(0)', handed, time.perf_counter())], cat='ui')
+            with tracer.span('ui update'):
+                callback()
+        self.root.after(0, run)
+
+    def predict_strokes(self, body):
+        """Queue the drawing's strokes, the device rasterises them"""
+        future = self.worker.classify_strokes(body)
+        future.add_done_callback(
+            lambda f: self.later(lambda: self.on_prediction(f, None)))
+
+    def on_prediction(self, future, img_data, small=False):
+        """Turn a resolved classify future into a PredictionResult, img_data None for strokes"""
+        result = PredictionResult()
+        profiled = self.link_profiled and img_data is not None and not small
+
+        try:
+            if profiled:
+                result.digit, result.profile = future.result()
+                log.info("digit=%s pre=%.1fus run=%.1fus argmax=%.1fus tx=%.1fus",
+                         result.digit, *result.profile)
             else:
-                result.error = "Timeout: No response from STM32"
-            
+                result.digit = future.result()
+            result.blank = result.digit is None
+        except DeviceError as e:
+            if small and e.code == protocol.ERR_TYPE and self.worker:
+                # Firmware without CLASSIFY_SMALL: full size images
+                self.small_var.set(False)
+                self.toggle_small()
+                self.predict(img_data)
+                return
+            if profiled and e.code == protocol.ERR_TYPE and self.worker:
+                # Firmware built without APP_PROFILE
+                self.link_profiled = False
+                self.predict(img_data)
+                return
+            if img_data is None and e.code == protocol.ERR_PARAM and self.worker:
+                # Firmware without the STROKES encoding: send the pixels
+                self.strokes_var.set(False)
+                self.predict(self.canvas.get_image_array().tobytes())
+                return
+            result.error = str(e)
+        except TimeoutError:
+            result.error = "Timeout: No response from STM32"
         except Exception as e:
             result.error = f"Communication error: {str(e)}"
-        
-        return result
-    
+
+        self.display_result(result)
+
     def display_result(self, result: PredictionResult):
         """Display classification result"""
+        self.screen('result')
         self.progress.stop()
         self.progress.pack_forget()
         self.progress_label.pack_forget()
@@ -689,12 +1439,22 @@ class STM32DigitClassifier:
         
         if result.error:
             self.result_container.config(bg='#fef2f2')
+            self.profile_text.config(text="", bg='#fef2f2')
             self.result_text.config(
                 text=f"❌ Error\n\n{result.error}",
                 fg='#dc2626',
                 font=('Segoe UI', 12),
                 bg='#fef2f2'
             )
+        elif result.number is not None:
+            self.result_container.config(bg='#f0fdf4')
+            self.profile_text.config(text=f"{len(result.number)} digits in one batch", bg='#f0fdf4')
+            self.result_text.config(
+                text=f"🔢 Predicted Number\n\n{result.number}",
+                fg='#10b981',
+                font=('Segoe UI', 36, 'bold'),
+                bg='#f0fdf4'
+            )
         elif result.digit is not None:
             self.result_container.config(bg='#f0fdf4')
             result_str = f"🎯 Predicted Digit\n\n{result.digit}"
@@ -705,9 +1465,28 @@ class STM32DigitClassifier:
                 font=('Segoe UI', 42, 'bold'),
                 bg='#f0fdf4'
             )
+            if result.profile:
+                p = result.profile
+                self.profile_text.config(
+                    text=f"pre {p.pre:.0f} µs · inference {p.run:.0f} µs · "
+                         f"argmax {p.argmax:.0f} µs · last TX {p.tx:.0f} µs",
+                    bg='#f0fdf4'
+                )
+            else:
+                self.profile_text.config(text="", bg='#f0fdf4')
             self.root.update_idletasks()
+        elif result.blank:
+            self.result_container.config(bg='#f8fafc')
+            self.profile_text.config(text="", bg='#f8fafc')
+            self.result_text.config(
+                text="✏️ No digit\n\nThe canvas is (almost) empty",
+                fg='#475569',
+                font=('Segoe UI', 12),
+                bg='#f8fafc'
+            )
         else:
             self.result_container.config(bg='#fef2f2')
+            self.profile_text.config(text="", bg='#fef2f2')
             self.result_text.config(
                 text="❌ No prediction received",
                 fg='#dc2626',
@@ -722,12 +1501,59 @@ class STM32DigitClassifier:
         """Handle window closing"""
         if self.is_connected:
             self.disconnect()
+        if self.capture:
+            self.capture.close()
+        if self.trace:
+            tracing.save(self.trace)
+            logging.info("Trace written to %s", self.trace)
         self.root.destroy()
 
 def main():
+    # Headless mode: python main.py --bench --port COM9 [...]
+    if len(sys.argv) > 1 and sys.argv[1] == '--bench':
+        from stm32dc import bench
+        sys.exit(bench.main(sys.argv[2:]))
+    # Host model, and its parity with the board: python main.py --reference [--port COM9]
+    if len(sys.argv) > 1 and sys.argv[1] == '--reference':
+        from stm32dc import reference
+        sys.exit(reference.main(sys.argv[2:]))
+    # On-device accuracy of every model: python main.py --evaluate --ports COM9 [...]
+    if len(sys.argv) > 1 and sys.argv[1] == '--evaluate':
+        from stm32dc import evaluate
+        sys.exit(evaluate.main(sys.argv[2:]))
+    # HTTP service for other processes: python main.py --serve --ports COM9 [...]
+    if len(sys.argv) > 1 and sys.argv[1] == '--serve':
+        from stm32dc import service
+        sys.exit(service.main(sys.argv[2:]))
+
+    # Record the session for replay: python main.py --capture session.cap
+    # Trace its spans for Perfetto: python main.py --trace trace.json
+    # Soak the GUI, live, once connected: python main.py --soak 120
+    capture = None
+    trace = None
+    soak = None
+    args = sys.argv[1:]
+    while len(args) > 1 and args[0] in ('--capture', '--trace', '--soak'):
+        if args[0] == '--capture':
+            capture = CaptureWriter(args[1])
+        elif args[0] == '--soak':
+            soak = float(args[1])
+        else:
+            trace = args[1]
+            tracing.enable()
+        args = args[2:]
+
+    logging.basicConfig(level=logging.INFO, format='%(asctime)s %(message)s')
+    # Timed waits (port reads, pacing) on a 1 ms tick rather than 15.6 ms on Windows
+    timers.hold_resolution()
     root = tk.Tk()
-    app = STM32DigitClassifier(root)
+    app = STM32DigitClassifier(root, capture, trace, soak)
     root.protocol("WM_DELETE_WINDOW", app.on_closing)
+    # Cold start as the user sees it, for comparing builds
+    root.wait_visibility()
+    age = process_age()
+    if age is not None:
+        log.info("first window %.0f ms after start", age * 1e3)
     root.mainloop()
 
 if __name__ == "__main__":
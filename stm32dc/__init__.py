@@ -0,0 +1 @@
+"""Host-side support code for the STM32 digit classifier."""
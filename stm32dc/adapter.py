@@ -0,0 +1,192 @@
+"""USB serial adapters: which one a port is, and its latency settings tuned.
+
+    conn.adapter = tune(conn)          # open_device and the GUI, on every port they open
+    print(conn.adapter.report())
+
+    python -m stm32dc.adapter                          # every port: adapter and latency timer
+    python -m stm32dc.adapter --port COM9 --baud 921600  # and its round trips untuned, then tuned
+
+A USB serial adapter does not pass bytes on as they arrive. An FTDI chip
+holds a short read in its buffer until its latency timer runs out (16 ms
+unless set lower), so every reply shorter than a USB packet waits that
+long. tune() lowers it where the host allows: the ASYNC_LOW_LATENCY flag
+on Linux, which makes ftdi_sio use 1 ms. On Windows the timer is a
+registry setting (FTDIBUS ... Device Parameters\\LatencyTimer, Device
+Manager's Advanced port settings) that needs an administrator, so it is
+read and reported. The ST-LINK's virtual COM port, CP210x, CH34x and
+PL2303 have no timer to set. On Windows tune() also grows the driver's
+buffers (set_buffer_size), so a BATCH reply of many frames is not held up
+waiting for the reader.
+
+Writes are not the adapter's business: every frame leaves in one write, a
+BATCH's image frames in the same one (protocol.FrameEncoder), and nothing
+calls flush() per frame, so no frame pays the latency more than once.
+"""
+import argparse
+import os
+import statistics
+import sys
+import time
+from typing import NamedTuple, Optional
+
+from . import protocol
+
+# USB vendor id -> adapter kind; ST's own are the ST-LINK's virtual COM port
+VENDORS = {0x0483: 'st-link', 0x0403: 'ftdi', 0x10C4: 'cp210x', 0x1A86: 'ch34x', 0x067B: 'pl2303'}
+# Kinds with a latency timer
+LATENCY_TIMERS = ('ftdi',)
+# Driver buffers asked for on Windows, and pyserial's default
+RX_BUFFER = 65536
+TX_BUFFER = 16384
+DEFAULT_BUFFER = 4096
+ROUNDS = 200
+
+
+class Adapter(NamedTuple):
+    port: str
+    kind: str                   # a VENDORS kind, 'usb' for another, 'serial' or 'bridge'
+    description: str
+    latency_ms: Optional[int]   # the latency timer, None without one or unknown
+    tuned: tuple = ()           # what tune() changed
+
+    def describe(self):
+        timer = "" if self.latency_ms is None else f", latency timer {self.latency_ms} ms"
+        tuned = f", {', '.join(self.tuned)}" if self.tuned else ""
+        return f"{self.kind} ({self.description}){timer}{tuned}"
+
+    def report(self):
+        return f"adapter       {self.describe()}"
+
+
+def _latency_sysfs(port):
+    return f"/sys/bus/usb-serial/devices/{os.path.basename(port)}/latency_timer"
+
+
+def latency_timer(port, kind):
+    """ms an adapter's latency timer is set to, None if it has none or it cannot be read"""
+    if kind not in LATENCY_TIMERS:
+        return None
+    if sys.platform == 'win32':
+        return _latency_registry(port)
+    try:
+        with open(_latency_sysfs(port)) as f:
+            return int(f.read())
+    except (OSError, ValueError):
+        return None
+
+
+def _latency_registry(port):
+    """LatencyTimer of the FTDI device whose PortName is port"""
+    import winreg
+
+    def subkeys(key):
+        for i in range(winreg.QueryInfoKey(key)[0]):
+            yield winreg.EnumKey(key, i)
+
+    try:
+        with winreg.OpenKey(winreg.HKEY_LOCAL_MACHINE, r"SYSTEM\CurrentControlSet\Enum\FTDIBUS") as bus:
+            for device in subkeys(bus):
+                with winreg.OpenKey(bus, device) as instances:
+                    for instance in subkeys(instances):
+                        try:
+                            with winreg.OpenKey(instances, instance + r"\Device Parameters") as params:
+                                if winreg.QueryValueEx(params, 'PortName')[0] == port:
+                                    return winreg.QueryValueEx(params, 'LatencyTimer')[0]
+                        except OSError:
+                            continue
+    except OSError:
+        pass
+    return None
+
+
+def identify(port):
+    """Adapter of a port name, untuned"""
+    from .bridge import is_bridge
+
+    if is_bridge(port):
+        return Adapter(port, 'bridge', 'TCP serial bridge', None)
+    try:
+        from serial.tools import list_ports
+        info = next((p for p in list_ports.comports() if p.device == port), None)
+    except ImportError:
+        info = None
+    if info is None or info.vid is None:
+        return Adapter(port, 'serial', info.description if info else 'not USB', None)
+    kind = VENDORS.get(info.vid, 'usb')
+    return Adapter(port, kind, f"{info.vid:04X}:{info.pid:04X} {info.description}",
+                   latency_timer(port, kind))
+
+
+def tune(conn, on=True):
+    """Lower conn's adapter latency and grow its buffers where the host allows; its Adapter
+
+    on=False puts the driver's defaults back, which is what a port is
+    measured against.
+    """
+    adapter = identify(conn.port)
+    tuned = []
+    if adapter.kind == 'bridge':
+        return adapter
+    if hasattr(conn, 'set_low_latency_mode'):
+        # TIOCSSERIAL: ftdi_sio takes it as a 1 ms latency timer
+        try:
+            conn.set_low_latency_mode(on)
+            tuned.append('low latency' if on else 'default latency')
+        except (ValueError, OSError):
+            pass
+    if hasattr(conn, 'set_buffer_size'):
+        rx, tx = (RX_BUFFER, TX_BUFFER) if on else (DEFAULT_BUFFER, DEFAULT_BUFFER)
+        conn.set_buffer_size(rx_size=rx, tx_size=tx)
+        tuned.append(f"buffers {rx // 1024}/{tx // 1024} KiB")
+    return adapter._replace(latency_ms=latency_timer(conn.port, adapter.kind), tuned=tuple(tuned))
+
+
+def round_trips(link, rounds=ROUNDS):
+    """(PING, CLASSIFY) mean round trips in ms over rounds requests each"""
+    image = bytes(protocol.IMAGE_PIXELS)
+    times = ([], [])
+    for _ in range(rounds):
+        start = time.perf_counter()
+        link.request(protocol.CMD_PING)
+        times[0].append(time.perf_counter() - start)
+        start = time.perf_counter()
+        link.classify(image)
+        times[1].append(time.perf_counter() - start)
+    return tuple(statistics.fmean(t) * 1e3 for t in times)
+
+
+def main(argv=None):
+    from .bench import open_device
+    from .link import DEFAULT_BAUD
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--port', help="measure this port's round trips untuned and tuned")
+    parser.add_argument('--baud', type=int, default=DEFAULT_BAUD)
+    parser.add_argument('--rtscts', action='store_true')
+    parser.add_argument('--rounds', type=int, default=ROUNDS)
+    args = parser.parse_args(argv)
+
+    if not args.port:
+        from serial.tools import list_ports
+        for info in sorted(list_ports.comports(), key=lambda p: p.device):
+            print(f"{info.device:14}{identify(info.device).describe()}")
+        return 0
+
+    conn, link, baud = open_device(args.port, args.baud, args.rtscts, tune_port=False)
+    try:
+        print(f"{args.port} @ {baud} baud, {args.rounds} rounds")
+        results = []
+        for on in (False, True):
+            adapter = tune(conn, on)
+            ping, classify = round_trips(link, args.rounds)
+            results.append((ping, classify))
+            print(f"{adapter.report()}\n  PING {ping:7.3f} ms   CLASSIFY {classify:7.3f} ms")
+        (ping0, classify0), (ping1, classify1) = results
+        print(f"tuning saves {ping0 - ping1:.3f} ms a PING, {classify0 - classify1:.3f} ms a CLASSIFY")
+    finally:
+        conn.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
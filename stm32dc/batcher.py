@@ -0,0 +1,264 @@
+"""Form BATCH frames from single-image requests.
+
+    batcher = DynamicBatcher.open(['COM9', 'COM10'], baud=921600, max_batch=32, max_wait=0.005)
+    digit = batcher.classify(image).result()
+    batcher.close()
+
+Requests wait in one queue shared by every board. A board's thread takes
+the oldest request and keeps collecting until it has max_batch images or
+max_wait has passed since that request arrived. It then sends them as a
+single BATCH (one reply for all of them, see ClassifierLink.classify_batch)
+and resolves each caller's future. A lone image goes out as a plain
+CLASSIFY.
+
+The two knobs trade latency for throughput. max_wait bounds the extra
+latency a request can pick up while waiting for company. max_wait = 0
+sends whatever is already queued right away, which suits interactive use.
+A few ms under load fills batches of max_batch, which suits scoring jobs.
+A board that times out MAX_FAILURES times in a row stops taking requests
+and its batch is queued again once for the others.
+"""
+import queue
+import threading
+import time
+from concurrent.futures import Future
+from typing import NamedTuple
+
+from . import protocol
+from .boards import expand
+from .link import DeviceError
+from .pool import TRANSPORT_ERRORS
+
+DEFAULT_MAX_BATCH = 32
+DEFAULT_MAX_WAIT = 0.005
+
+
+class BatcherHealth(NamedTuple):
+    port: str
+    healthy: bool
+    batches: int         # device round trips, BATCH or CLASSIFY
+    completed: int       # images answered, None (blank, or lost in a BATCH) included
+    errors: int          # images the device failed or refused
+    failures: int        # round trips lost to timeouts or link errors
+    mean_batch: float    # images per round trip
+    mean_wait: float     # seconds from classify() to the batch being sent
+    throughput: float    # images per second since open or reset_stats
+    last_error: str
+
+
+class _Item:
+    __slots__ = ('image', 'future', 'queued', 'attempts')
+
+    def __init__(self, image):
+        self.image = image
+        self.future = Future()
+        self.queued = time.perf_counter()
+        self.attempts = 0
+
+
+class _Board:
+    def __init__(self, port, conn, link):
+        self.port = port
+        self.conn = conn
+        self.link = link
+        self.thread = None
+        self.healthy = True
+        self.streak = 0
+        self.batches = 0
+        self.completed = 0
+        self.errors = 0
+        self.failures = 0
+        self.images = 0
+        self.wait = 0.0
+        self.last_error = ''
+
+
+class DynamicBatcher:
+    """One thread per board turning queued classify() calls into BATCH frames"""
+
+    MAX_FAILURES = 3
+    MAX_ATTEMPTS = 2
+
+    def __init__(self, boards, max_batch=DEFAULT_MAX_BATCH, max_wait=DEFAULT_MAX_WAIT):
+        if not boards:
+            raise ValueError("a batcher needs at least one board")
+        self.boards = boards
+        self.max_batch = max(1, min(max_batch, protocol.MAX_BATCH))
+        self.max_wait = max(0.0, max_wait)
+        self.requests = queue.Queue()
+        self.lock = threading.Lock()
+        self.closed = threading.Event()
+        self.started = time.perf_counter()
+        for board in boards:
+            board.thread = threading.Thread(target=self._loop, args=(board,),
+                                            name=f'batch-{board.port}', daemon=True)
+            board.thread.start()
+
+    @classmethod
+    def open(cls, ports, baud, max_batch=DEFAULT_MAX_BATCH, max_wait=DEFAULT_MAX_WAIT, rtscts=False):
+        from .bench import open_device
+
+        ports = expand(ports, baud)
+        boards = []
+        try:
+            for port in ports:
+                conn, link, _ = open_device(port, baud, rtscts)
+                boards.append(_Board(port, conn, link))
+        except Exception:
+            for b in boards:
+                b.conn.close()
+            raise
+        return cls(boards, max_batch, max_wait)
+
+    def close(self):
+        """Stop the board threads and fail whatever is still queued"""
+        with self.lock:
+            self.closed.set()
+        for _ in self.boards:
+            self.requests.put(None)
+        for b in self.boards:
+            b.thread.join()
+            if b.conn is not None:
+                b.conn.close()
+        self._fail_queued(ConnectionError("Batcher closed"))
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def __len__(self):
+        return len(self.boards)
+
+    def classify(self, image, priority=None) -> Future:
+        # One lane: BATCH frames go out in arrival order, priority is only
+        # accepted as DevicePool.classify takes it
+        item = _Item(bytes(image))
+        error = None
+        # Under the lock the last board to go down drains the queue with:
+        # queued before that, or refused here
+        with self.lock:
+            if self.closed.is_set():
+                error = ConnectionError("Batcher closed")
+            elif not any(b.healthy for b in self.boards):
+                error = ConnectionError("No healthy board in the batcher")
+            else:
+                item.future.set_running_or_notify_cancel()
+                self.requests.put(item)
+        if error is not None:
+            item.future.set_exception(error)
+        return item.future
+
+    def _collect(self):
+        """Oldest request plus what joins it within max_wait, None once closed"""
+        first = self.requests.get()
+        if first is None:
+            return None
+        batch = [first]
+        deadline = first.queued + self.max_wait
+        while len(batch) < self.max_batch:
+            try:
+                item = self.requests.get(timeout=max(0.0, deadline - time.perf_counter())) \
+                    if self.max_wait else self.requests.get_nowait()
+            except queue.Empty:
+                break
+            if item is None:
+                # Closing: send what we have, let the next get() see the end
+                self.requests.put(None)
+                break
+            batch.append(item)
+        return batch
+
+    def _loop(self, board):
+        while board.healthy:
+            batch = self._collect()
+            if batch is None:
+                return
+            self._send(board, batch)
+        # Down: the remaining boards serve the queue, fail it if none is left
+        with self.lock:
+            orphans = [] if any(b.healthy for b in self.boards) else self._drain()
+        for item in orphans:
+            item.future.set_exception(ConnectionError("No healthy board in the batcher"))
+
+    def _send(self, board, batch):
+        sent = time.perf_counter()
+        for item in batch:
+            item.attempts += 1
+        try:
+            if len(batch) == 1:
+                digits = [board.link.classify(batch[0].image)]
+            else:
+                digits = board.link.classify_batch([item.image for item in batch])
+        except TRANSPORT_ERRORS as e:
+            self._failed(board, batch, e)
+            return
+        except DeviceError as e:
+            digits = [e] * len(batch)
+        # A short reply fails the images it left out
+        digits = list(digits) + [DeviceError(protocol.ERR_LENGTH)] * (len(batch) - len(digits))
+
+        with self.lock:
+            board.streak = 0
+            board.batches += 1
+            board.images += len(batch)
+            board.wait += sum(sent - item.queued for item in batch)
+        for item, digit in zip(batch, digits):
+            if isinstance(digit, Exception):
+                with self.lock:
+                    board.errors += 1
+                item.future.set_exception(digit)
+            else:
+                with self.lock:
+                    board.completed += 1
+                item.future.set_result(digit)
+
+    def _failed(self, board, batch, error):
+        with self.lock:
+            board.failures += 1
+            board.streak += 1
+            board.last_error = str(error)
+            if board.streak >= self.MAX_FAILURES:
+                board.healthy = False
+            others = any(b.healthy and b is not board for b in self.boards) or board.healthy
+            # Queued again under the lock, as classify() queues
+            failed = []
+            for item in batch:
+                if item.attempts < self.MAX_ATTEMPTS and others and not self.closed.is_set():
+                    self.requests.put(item)
+                else:
+                    failed.append(item)
+        for item in failed:
+            item.future.set_exception(error)
+
+    def _drain(self):
+        """Every request still queued, taken off the queue"""
+        items = []
+        while True:
+            try:
+                item = self.requests.get_nowait()
+            except queue.Empty:
+                return items
+            if item is not None:
+                items.append(item)
+
+    def _fail_queued(self, error):
+        for item in self._drain():
+            item.future.set_exception(error)
+
+    def reset_stats(self):
+        with self.lock:
+            for b in self.boards:
+                b.batches = b.completed = b.errors = b.failures = b.images = 0
+                b.wait = 0.0
+            self.started = time.perf_counter()
+
+    def health(self):
+        elapsed = time.perf_counter() - self.started
+        with self.lock:
+            return [BatcherHealth(b.port, b.healthy, b.batches, b.completed, b.errors, b.failures,
+                                  b.images / b.batches if b.batches else 0.0,
+                                  b.wait / b.images if b.images else 0.0,
+                                  b.completed / elapsed if elapsed else 0.0, b.last_error)
+                    for b in self.boards]
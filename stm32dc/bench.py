@@ -0,0 +1,1039 @@
+"""Headless throughput/latency benchmark of the classifier link.
+
+    python -m stm32dc.bench --port COM9 --baud 921600 --count 1000
+    python -m stm32dc.bench --port COM9 --images emnist-digits-test-images-idx3-ubyte \
+        --labels emnist-digits-test-labels-idx1-ubyte --batch 64
+    python -m stm32dc.bench --ports COM9 COM10 COM11 --count 5000
+    python -m stm32dc.bench --ports COM9 COM10 --rate 300 --count 6000
+    python -m stm32dc.bench --ports COM9 COM10 --concurrency 2 --count 6000
+    python -m stm32dc.bench --port COM9 --wcet 4096 --wcet-load
+    python -m stm32dc.bench --port COM9 --wcet-compare 1024 --wcet-load
+    python -m stm32dc.bench --port COM9 --irq-latency 2000000
+    python -m stm32dc.bench --port COM9 --clock balanced --energy
+    python -m stm32dc.bench --port COM9 --breakdown --pipeline --count 1000
+    python -m stm32dc.bench --port COM9 --pipeline --trace bench.json
+
+Images come from an IDX file (EMNIST/MNIST distribution format), a .npy
+array of 28x28 uint8 images, or are generated when no dataset is given.
+Files are memory-mapped (stm32dc.dataset), so the full 40k image EMNIST
+test split opens at once and streams into the boards as they take it.
+"""
+import argparse
+import atexit
+import random
+import sys
+import threading
+import time
+
+from . import protocol, timers, tracing
+from .adapter import identify, tune
+from .dataset import Dataset, load_labels
+from .link import ClassifierLink, DeviceError, DEFAULT_BAUD, IMAGE_SIZE
+from .batcher import DynamicBatcher
+from .boards import expand
+from .bridge import TcpSerial, is_bridge
+from .cache import ResultCache
+from .pool import DevicePool, POLICIES, LEAST_OUTSTANDING
+from .worker import BULK, LinkWorker
+
+
+def load_idx(path):
+    """Labels (idx1) as ints, or images (idx3) as stored, from an uncompressed IDX file"""
+    with open(path, 'rb') as f:
+        ndim = f.read(4)[3:]
+    if ndim == b'\x01':
+        return load_labels(path)
+    return Dataset(path, transposed=False)
+
+
+def load_images(path):
+    """.npy arrays are taken as drawn; EMNIST IDX images are stored transposed
+
+    Upright from the preprocessing cache after the first run (stm32dc.prepcache).
+    """
+    from .prepcache import cached_dataset
+
+    return cached_dataset(path)
+
+
+def synthetic_images(count, seed=0):
+    rng = random.Random(seed)
+    return [bytes(rng.getrandbits(8) for _ in range(IMAGE_SIZE)) for _ in range(count)]
+
+
+def percentile(sorted_values, pct):
+    if not sorted_values:
+        return float('nan')
+    k = (len(sorted_values) - 1) * pct / 100.0
+    lo = int(k)
+    hi = min(lo + 1, len(sorted_values) - 1)
+    return sorted_values[lo] + (sorted_values[hi] - sorted_values[lo]) * (k - lo)
+
+
+class BenchResult:
+    def __init__(self):
+        self.latencies = []      # seconds per request
+        self.predictions = []    # digit or None per image
+        self.errors = 0
+        self.timeouts = 0
+        self.elapsed = 0.0
+        self.payload_bytes = []  # request payload sizes, CLASSIFY_PACKED only
+
+    def report(self, labels=None, per_request='image'):
+        lat = sorted(self.latencies)
+        done = sum(p is not None for p in self.predictions)
+        lines = [
+            f"images        {len(self.predictions)} ({done} classified)",
+            f"elapsed       {self.elapsed:.2f} s",
+            f"throughput    {done / self.elapsed if self.elapsed else 0:.1f} images/s",
+            f"latency/{per_request:<6}p50 {percentile(lat, 50) * 1e3:.2f} ms  "
+            f"p95 {percentile(lat, 95) * 1e3:.2f} ms  p99 {percentile(lat, 99) * 1e3:.2f} ms",
+            f"errors        {self.errors}",
+            f"timeouts      {self.timeouts}",
+        ]
+        if self.payload_bytes:
+            lines.append(f"payload       {sum(self.payload_bytes) / len(self.payload_bytes):.0f} B/image "
+                         f"(raw {IMAGE_SIZE} B)")
+        if labels:
+            correct = sum(p == l for p, l in zip(self.predictions, labels))
+            lines.append(f"accuracy      {correct / len(self.predictions) * 100:.2f} %")
+        return '\n'.join(lines)
+
+
+def run_single(link, images):
+    """One CLASSIFY round trip per image"""
+    result = BenchResult()
+    start = time.perf_counter()
+    for img in images:
+        t0 = time.perf_counter()
+        try:
+            digit = link.classify(img)
+        except DeviceError:
+            result.errors += 1
+            digit = None
+        except TimeoutError:
+            result.timeouts += 1
+            digit = None
+        result.latencies.append(time.perf_counter() - t0)
+        result.predictions.append(digit)
+    result.elapsed = time.perf_counter() - start
+    return result
+
+
+def run_packed(link, images, bits=8):
+    """CLASSIFY_PACKED round trips, pixels quantized to bits per pixel"""
+    result = BenchResult()
+    link.packer = protocol.ImagePacker(bits)
+    pack = link.packer.pack
+
+    def counting_pack(image, full=False):
+        payload = pack(image, full)
+        result.payload_bytes.append(len(payload))
+        return payload
+
+    link.packer.pack = counting_pack
+    start = time.perf_counter()
+    for img in images:
+        t0 = time.perf_counter()
+        try:
+            digit = link.classify_packed(img)
+        except DeviceError:
+            result.errors += 1
+            digit = None
+        except TimeoutError:
+            result.timeouts += 1
+            digit = None
+        result.latencies.append(time.perf_counter() - t0)
+        result.predictions.append(digit)
+    result.elapsed = time.perf_counter() - start
+    link.packer = protocol.ImagePacker()
+    return result
+
+
+def run_batch(link, images, batch):
+    """BATCH requests of up to batch images, latency is per batch reply"""
+    result = BenchResult()
+    start = time.perf_counter()
+    for i in range(0, len(images), batch):
+        chunk = images[i:i + batch]
+        t0 = time.perf_counter()
+        try:
+            digits = link.classify_batch(chunk)
+            result.errors += sum(d is None for d in digits)
+        except DeviceError:
+            result.errors += len(chunk)
+            digits = [None] * len(chunk)
+        except TimeoutError:
+            result.timeouts += 1
+            digits = [None] * len(chunk)
+        result.latencies.append(time.perf_counter() - t0)
+        result.predictions.extend(digits)
+    result.elapsed = time.perf_counter() - start
+    return result
+
+
+def run_pipelined(link, images):
+    """CLASSIFY through a LinkWorker, as many requests outstanding as the device has credits"""
+    result = BenchResult()
+    start = time.perf_counter()
+    with LinkWorker(link) as worker:
+        sent = []
+        for img in images:
+            future = worker.classify(img)
+            future.sent = time.perf_counter()
+            future.add_done_callback(lambda f: setattr(f, 'done_at', time.perf_counter()))
+            sent.append(future)
+        for future in sent:
+            try:
+                digit = future.result()
+            except DeviceError:
+                result.errors += 1
+                digit = None
+            except TimeoutError:
+                result.timeouts += 1
+                digit = None
+            # Includes time queued behind earlier requests
+            result.latencies.append(future.done_at - future.sent)
+            result.predictions.append(digit)
+    result.elapsed = time.perf_counter() - start
+    return result
+
+
+def run_timed(link, images, pipelined=False):
+    """CLASSIFY through a LinkWorker with stamped replies: (BenchResult, Timings, uncertainty)
+
+    Needs APP_TIMESTAMPS. One request at a time unless pipelined. The
+    clock is fitted before the run, and refitted after it for the
+    uncertainty reported: the fit then spans the run and includes drift.
+    """
+    from .clocksync import ClockSync
+
+    clock = ClockSync()
+    clock.sync(link)
+    result = BenchResult()
+    start = time.perf_counter()
+    with LinkWorker(link, clock=clock) as worker:
+        futures = [worker.classify(img) for img in images] if pipelined else []
+        for i, img in enumerate(images):
+            future = futures[i] if pipelined else worker.classify(img)
+            try:
+                digit = future.result()
+            except DeviceError:
+                result.errors += 1
+                digit = None
+            except TimeoutError:
+                result.timeouts += 1
+                digit = None
+            result.predictions.append(digit)
+        result.elapsed = time.perf_counter() - start
+        uncertainty = worker.clock_sync().result()
+        # Stop stamping, later replies are parsed as before either way
+        worker.clock_sync(1, flags=0).result()
+        timings = list(worker.timings)
+    result.latencies = [t.total for t in timings]
+    return result, timings, uncertainty
+
+
+def run_pool(pool, images, cache=None):
+    """Every image queued at once on a DevicePool or DynamicBatcher, latency includes the queue
+
+    A throughput run, so BULK: nothing in it is hedged.
+    """
+    result = BenchResult()
+    start = time.perf_counter()
+    sent = []
+
+    def classify(img):
+        return pool.classify(img, priority=BULK)
+
+    for img in images:
+        future = cache.classify(img, classify) if cache else classify(img)
+        future.sent = time.perf_counter()
+        future.add_done_callback(lambda f: setattr(f, 'done_at', time.perf_counter()))
+        sent.append(future)
+    for future in sent:
+        try:
+            digit = future.result()
+        except DeviceError:
+            result.errors += 1
+            digit = None
+        except (TimeoutError, ConnectionError):
+            result.timeouts += 1
+            digit = None
+        result.latencies.append(future.done_at - future.sent)
+        result.predictions.append(digit)
+    result.elapsed = time.perf_counter() - start
+    return result
+
+
+def _drive(worker, images, rate, concurrency, result, method='classify'):
+    """Load one board: images at rate per second (open loop) or concurrency outstanding"""
+    slots = threading.Semaphore(concurrency) if concurrency else None
+    futures = []
+    start = time.perf_counter()
+    for n, img in enumerate(images):
+        if rate:
+            # Latency counts from when the request was due, so a board that
+            # falls behind shows its backlog rather than slowing the load
+            sent = start + n / rate
+            timers.sleep_until(sent)
+        else:
+            slots.acquire()
+            sent = time.perf_counter()
+        future = getattr(worker, method)(img)
+        future.sent = sent
+        future.add_done_callback(lambda f: setattr(f, 'done_at', time.perf_counter()))
+        if slots:
+            future.add_done_callback(lambda f: slots.release())
+        futures.append(future)
+    for future in futures:
+        try:
+            digit = future.result()
+        except DeviceError:
+            result.errors += 1
+            digit = None
+        except (TimeoutError, ConnectionError):
+            result.timeouts += 1
+            digit = None
+        result.latencies.append(future.done_at - future.sent)
+        result.predictions.append(digit)
+    result.elapsed = time.perf_counter() - start
+
+
+def run_load(pool, images, rate=None, concurrency=None):
+    """Every board of a DevicePool driven on its own, images dealt out in turn.
+
+    Returns the BenchResult of each board, by port, and one over all of
+    them whose predictions are in image order again.
+    """
+    members = pool.members
+    results = {m.port: BenchResult() for m in members}
+    threads = [threading.Thread(target=_drive, daemon=True,
+                                args=(m.worker, images[i::len(members)], rate, concurrency,
+                                      results[m.port]))
+               for i, m in enumerate(members)]
+    start = time.perf_counter()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    total = BenchResult()
+    total.elapsed = time.perf_counter() - start
+    total.predictions = [None] * len(images)
+    for i, m in enumerate(members):
+        r = results[m.port]
+        total.latencies += r.latencies
+        total.predictions[i::len(members)] = r.predictions
+        total.errors += r.errors
+        total.timeouts += r.timeouts
+    return results, total
+
+
+def load_report(results):
+    lines = [f"{'port':<14}{'done':>7}{'errors':>8}{'timeout':>8}{'img/s':>8}"
+             f"{'p50 ms':>9}{'p95 ms':>9}{'p99 ms':>9}"]
+    for port, r in results.items():
+        lat = sorted(r.latencies)
+        done = sum(p is not None for p in r.predictions)
+        lines.append(f"{port:<14}{done:>7}{r.errors:>8}{r.timeouts:>8}"
+                     f"{done / r.elapsed if r.elapsed else 0:>8.1f}"
+                     f"{percentile(lat, 50) * 1e3:>9.2f}{percentile(lat, 95) * 1e3:>9.2f}"
+                     f"{percentile(lat, 99) * 1e3:>9.2f}")
+    return "\n".join(lines)
+
+
+def pool_report(members):
+    lines = [f"{'port':<14}{'state':<7}{'done':>7}{'errors':>8}{'failed':>8}{'ms':>8}{'img/s':>8}"]
+    for m in members:
+        lines.append(f"{m.port:<14}{'up' if m.healthy else 'down':<7}{m.completed:>7}{m.errors:>8}"
+                     f"{m.failures:>8}{m.mean_latency * 1e3:>8.2f}{m.throughput:>8.1f}")
+        if not m.healthy:
+            lines.append(f"{'':<14}{m.last_error}")
+    return "\n".join(lines)
+
+
+def batcher_report(boards):
+    lines = [f"{'port':<14}{'state':<7}{'done':>7}{'errors':>8}{'failed':>8}{'batch':>7}"
+             f"{'wait ms':>9}{'img/s':>8}"]
+    for b in boards:
+        lines.append(f"{b.port:<14}{'up' if b.healthy else 'down':<7}{b.completed:>7}{b.errors:>8}"
+                     f"{b.failures:>8}{b.mean_batch:>7.1f}{b.mean_wait * 1e3:>9.2f}"
+                     f"{b.throughput:>8.1f}")
+        if not b.healthy:
+            lines.append(f"{'':<14}{b.last_error}")
+    return "\n".join(lines)
+
+
+def run_cascade(link, images, first, full, min_margin):
+    """CLASSIFY_CASCADE round trips, counts which stage answered"""
+    result = BenchResult()
+    stages = [0, 0]
+    cycles = []
+    start = time.perf_counter()
+    for img in images:
+        t0 = time.perf_counter()
+        try:
+            answer = link.classify_cascade(img, first, full, min_margin)
+            digit = answer.digit
+            stages[answer.stage] += 1
+            cycles.append(answer.cycles)
+        except DeviceError:
+            result.errors += 1
+            digit = None
+        except TimeoutError:
+            result.timeouts += 1
+            digit = None
+        result.latencies.append(time.perf_counter() - t0)
+        result.predictions.append(digit)
+    result.elapsed = time.perf_counter() - start
+    return result, stages, cycles
+
+
+def run_tta(link, images, min_margin, variants):
+    """CLASSIFY_TTA round trips: how many voted, and how many votes changed the digit"""
+    result = BenchResult()
+    voted = changed = 0
+    cycles = []
+    start = time.perf_counter()
+    for img in images:
+        t0 = time.perf_counter()
+        try:
+            answer = link.classify_tta(img, min_margin, variants)
+            digit = answer.digit
+            voted += answer.variants > 0
+            changed += answer.digit != answer.own
+            cycles.append(answer.cycles)
+        except DeviceError:
+            result.errors += 1
+            digit = None
+        except TimeoutError:
+            result.timeouts += 1
+            digit = None
+        result.latencies.append(time.perf_counter() - t0)
+        result.predictions.append(digit)
+    result.elapsed = time.perf_counter() - start
+    return result, voted, changed, cycles
+
+
+def compare_models(link, images, warmup):
+    """CLASSIFY_PROF on every registered model: device run time and footprint
+
+    With APP_PROFILE_LAYERS also the c-nodes and the dispatch overhead: run
+    time not spent inside a node, the runtime walking its graph and the
+    observer's own calls. A lite graph model is one node and keeps only the
+    call into it.
+    """
+    start = link.select_model()
+    lines = [f"{'model':<6}{'run us':>10}{'cycles':>10}{'arena B':>10}{'weights B':>11}"
+             f"{'nodes':>7}{'dispatch us':>13}"]
+    try:
+        for index in range(start.count):
+            sel = link.select_model(index)
+            for img in images[:warmup]:
+                link.classify(img)
+            runs, nodes_us, nodes = [], 0.0, None
+            for img in images:
+                runs.append(link.classify_profiled(img)[1])
+                try:
+                    layers = link.layer_profile()
+                except DeviceError as e:
+                    if e.code != protocol.ERR_TYPE:
+                        raise
+                    continue
+                nodes = len(layers)
+                nodes_us += sum(us for _, us in layers)
+            run_us = sum(p.run for p in runs) / len(runs)
+            cycles = run_us * runs[-1].cpu_hz / 1e6
+            dispatch = f"{run_us - nodes_us / len(runs):>13.1f}" if nodes is not None else f"{'-':>13}"
+            lines.append(f"{index:<6}{run_us:>10.1f}{cycles:>10.0f}{sel.activations_size:>10}"
+                         f"{sel.weights_size:>11}{nodes if nodes is not None else '-':>7}{dispatch}")
+    finally:
+        link.select_model(start.active)
+    return "\n".join(lines)
+
+
+def isr_report(link, images, baud):
+    """CLASSIFY_PROF over the images: USART2 interrupt cost per received byte"""
+    runs = [link.classify_profiled(img)[1] for img in images]
+    # The first reply covers whatever arrived since the last profiled request
+    runs = runs[1:] or runs
+    cycles = sum(p.isr * p.cpu_hz / 1e6 for p in runs)
+    received = sum(p.isr_bytes for p in runs)
+    if not received:
+        return "usart2 isr    no bytes accounted (firmware without APP_PROFILE or too old)"
+    per_byte = cycles / received
+    # 10 bit times per byte on the wire, at a continuously busy line
+    load = per_byte * baud / 10 / runs[-1].cpu_hz
+    return "\n".join([
+        f"usart2 isr    {per_byte:.2f} cycles/byte, {cycles / len(runs):.0f} cycles/frame",
+        f"cpu load      {100.0 * load:.2f} % at {baud} baud line rate",
+    ])
+
+
+def irq_latency_report(r):
+    """IRQ_LATENCY: latency histogram and the fastest safe line per reception mode"""
+    us = lambda cycles: cycles * 1e6 / r.cpu_hz
+    lines = [
+        f"rx latency    {r.samples} arrivals at {r.baud} baud over {r.runs} runs, {r.cpu_hz / 1e6:.0f} MHz",
+        f"latency       min {r.lat_min}, mean {r.lat_mean}, max {r.lat_max} cycles "
+        f"({us(r.lat_max):.2f} us), handler {r.handler_max}",
+        f"overruns      {r.overruns} ({100.0 * r.overruns / max(r.samples, 1):.3f} %) a byte time late",
+    ]
+    top = max(r.buckets) or 1
+    for i, count in enumerate(r.buckets):
+        if not count:
+            continue
+        edge = f">= {1 << i}" if i == len(r.buckets) - 1 else f"{1 << i}-{(2 << i) - 1}"
+        lines.append(f"  {edge:>11} {count:>9} {'#' * max(1, 40 * count // top)}")
+    lines += [
+        f"longest run   {r.gap_max} cycles ({us(r.gap_max) / 1000:.2f} ms) without the ring drained",
+        f"max baud      interrupt {r.it_max_baud()}, DMA {r.dma_max_baud()} "
+        f"(USART limit {r.usart_max_baud}, {r.rx_ring} B ring)",
+    ]
+    return "\n".join(lines)
+
+
+def kernel_report(link, images, kernel=protocol.KERNEL_CONV):
+    """KERNEL_BENCH over the images: layer time and agreement"""
+    layer, size = protocol.KERNELS[kernel]
+    runs = [link.kernel_bench(img, kernel) for img in images]
+    lib = sum(r.lib_us for r in runs) / len(runs)
+    kern_us = sum(r.kernel_us for r in runs) / len(runs)
+    lines = [
+        f"{layer:<13} library {lib:.1f} us, kernel {kern_us:.1f} us ({lib / kern_us:.2f}x)",
+        f"outputs       {sum(r.mismatches for r in runs)} of {size * len(runs)} differ, "
+        f"max {max(r.max_diff for r in runs)} LSB",
+        f"classes       {sum(r.lib_digit != r.kernel_digit for r in runs)} of {len(runs)} differ",
+    ]
+    active = [r.active for r in runs if r.active]
+    if kernel == protocol.KERNEL_DENSE and active:
+        # Words at the zero point are skipped along with their weights
+        words = sorted(active)
+        mean = sum(words) / len(words)
+        lines.append(f"sparsity      {100.0 * (1 - mean / protocol.DENSE_INPUT_WORDS):.1f} % of input words "
+                     f"skipped, {words[0]}-{words[-1]} of {protocol.DENSE_INPUT_WORDS} read "
+                     f"(median {words[len(words) // 2]})")
+    elif kernel == protocol.KERNEL_CONV0 and active:
+        # Tiles over background only take the bias constant
+        tiles = sorted(active)
+        mean = sum(tiles) / len(tiles)
+        lines.append(f"tiles         {100.0 * (1 - mean / protocol.CONV0_TILES):.1f} % blank, "
+                     f"{tiles[0]}-{tiles[-1]} of {protocol.CONV0_TILES} computed "
+                     f"(median {tiles[len(tiles) // 2]})")
+    return "\n".join(lines)
+
+
+def nn_report(link, images, names=()):
+    """NN_BENCH over the images: each layer on the library and on CMSIS-NN"""
+    runs = [link.nn_bench(img) for img in images]
+    lines = []
+    for i, layer in enumerate(runs[0].layers):
+        name = names[layer.node] if layer.node < len(names) else f'c-node {layer.node}'
+        lib = sum(r.layers[i].lib_us for r in runs) / len(runs)
+        nn = sum(r.layers[i].nn_us for r in runs) / len(runs)
+        lines.append(f"{name:<13} {layer.kind:<7} library {lib:.1f} us, cmsis-nn {nn:.1f} us "
+                     f"({lib / nn:.2f}x), {sum(r.layers[i].mismatches for r in runs)} outputs differ, "
+                     f"max {max(r.layers[i].max_diff for r in runs)} LSB")
+    if not lines:
+        lines.append("no layer maps to CMSIS-NN")
+    lines.append(f"classes       {sum(r.lib_class != r.nn_class for r in runs)} of {len(runs)} differ")
+    return "\n".join(lines)
+
+
+def flash_sweep(link, images, warmup):
+    """Per-layer cycles for each ART accelerator setting, averaged over the images"""
+    start = link.flash()
+    rows = []
+    try:
+        for flags in range(8):
+            cfg = link.flash(flags)
+            for img in images[:warmup]:
+                link.classify(img)
+            totals = {}
+            for img in images:
+                link.classify(img)
+                for name, us in link.layer_profile():
+                    totals[name] = totals.get(name, 0.0) + us * cfg.cpu_hz / 1e6
+            rows.append((protocol.flash_name(flags), {n: c / len(images) for n, c in totals.items()}))
+    finally:
+        link.flash(start.flags)
+
+    names = list(rows[0][1])
+    lines = [f"{start.latency} wait states, {start.ram_code} B of NetworkRuntime code in sram",
+             f"{'art':<22}" + "".join(f"{n:>10}" for n in names) + f"{'total':>10}"]
+    for label, layers in rows:
+        lines.append(f"{label:<22}" + "".join(f"{layers[n]:>10.0f}" for n in names)
+                     + f"{sum(layers.values()):>10.0f}")
+    return "\n".join(lines)
+
+
+def selftest_report(t):
+    lines = [
+        f"selftest      {t.correct} of {t.count} correct ({100.0 * t.accuracy:.2f} %), "
+        f"{t.failed} failed runs",
+        f"cycles        min {t.cycles_min}, mean {t.cycles_mean}, max {t.cycles_max} "
+        f"({t.cycles_mean * 1e6 / t.cpu_hz:.0f} us at {t.cpu_hz / 1e6:.0f} MHz)",
+        f"throughput    {t.macc} MACs per run, {t.macc_per_cycle:.3f} MACs/cycle",
+    ]
+    if t.first_wrong != protocol.SELFTEST_NONE_WRONG:
+        lines.append(f"first wrong   image {t.first_wrong}")
+    return "\n".join(lines)
+
+
+def wcet_report(w, names=(), margin=0.2):
+    """Worst stages of a WCET sweep and the bound they give, plus margin for what it did not hit"""
+    us = lambda cycles: cycles * 1e6 / w.cpu_hz
+    bound = w.stage_bound * (1.0 + margin)
+    lines = [
+        f"wcet          {w.runs} runs, {'cold' if w.flags & protocol.WCET_COLD else 'warm'} ART, "
+        f"{w.rx_bytes} B received meanwhile, {w.cpu_hz / 1e6:.0f} MHz",
+        f"mode          interrupts {'held off' if w.flags & protocol.WCET_QUIET else 'on'}, "
+        f"code from {'SRAM' if w.flags & protocol.WCET_RAM_CODE else 'flash'}",
+        f"load          max {w.load_max} cycles ({us(w.load_max):.1f} us)",
+        f"run           min {w.run_min}, max {w.run_max} cycles ({us(w.run_max):.1f} us), "
+        f"jitter {w.jitter} cycles ({us(w.jitter):.1f} us, {100.0 * w.jitter / max(w.run_min, 1):.1f} %)",
+        f"argmax        max {w.argmax_max} cycles ({us(w.argmax_max):.1f} us)",
+    ]
+    for i, cycles in enumerate(w.node_max):
+        name = names[i] if i < len(names) else f'c-node {i}'
+        lines.append(f"  {name:<11} max {cycles} cycles ({us(cycles):.1f} us)")
+    lines += [
+        f"observed      {w.total_max} cycles ({us(w.total_max):.1f} us) in one run",
+        f"bound         {bound:.0f} cycles ({us(bound):.1f} us): worst stages + {100.0 * margin:.0f} %",
+    ]
+    return "\n".join(lines)
+
+
+def wcet_compare(link, runs, cold=True, load=False):
+    """The same WCET sweep with interrupts on, then held off (APP_DETERMINISTIC)"""
+    us = lambda w, cycles: cycles * 1e6 / w.cpu_hz
+    open_ = link.wcet(runs, cold=cold, load=load, open=True)
+    quiet = link.wcet(runs, cold=cold, load=load)
+    lines = [f"{'':<14}{'run min':>10}{'run max':>10}{'jitter':>10}{'us':>9}"]
+    for label, w in (('open', open_), ('deterministic', quiet)):
+        lines.append(f"{label:<14}{w.run_min:>10}{w.run_max:>10}{w.jitter:>10}{us(w, w.jitter):>9.1f}")
+    if open_.jitter:
+        lines.append(f"jitter        {100.0 * (1.0 - quiet.jitter / open_.jitter):.0f} % lower, "
+                     f"code from {'SRAM' if quiet.flags & protocol.WCET_RAM_CODE else 'flash'}")
+    return "\n".join(lines)
+
+
+def selftest_gate(t, min_accuracy, max_cycles=None):
+    """Reasons the SELFTEST result fails the regression gate, empty if it passes"""
+    failures = []
+    if t.count == 0:
+        failures.append("no test vectors in the firmware")
+    if t.failed:
+        failures.append(f"{t.failed} runs failed")
+    if t.accuracy < min_accuracy:
+        failures.append(f"accuracy {100.0 * t.accuracy:.2f} % below {100.0 * min_accuracy:.2f} %")
+    if max_cycles is not None and t.cycles_mean > max_cycles:
+        failures.append(f"{t.cycles_mean} cycles per run above {max_cycles}")
+    return failures
+
+
+def open_device(port, baud, rtscts=False, tune_port=True):
+    """Open the port, wait for a PING reply at baud or else negotiate it (ClassifierLink.connect)
+
+    rtscts needs firmware built with APP_UART_FLOW and an adapter wiring the
+    handshake lines to PA0/PA1; the ST-LINK port has none. A tcp://HOST:PORT
+    port is a serial bridge whose line already runs at baud (stm32dc.bridge);
+    `auto` is the first board found and `uid:PREFIX` a board by its chip ID
+    (stm32dc.boards). The USB adapter's latency is tuned first unless tune_port is False, its
+    stm32dc.adapter.Adapter in conn.adapter. The link's reply timeouts are
+    calibrated from the device's STATS (ClassifierLink.calibrate).
+    """
+    import serial
+
+    port = expand([port], baud)[0]
+    if is_bridge(port):
+        conn = TcpSerial(port, baud, timeout=5, write_timeout=5)
+        conn.adapter = identify(port)
+        conn.reset_input_buffer()
+        link = ClassifierLink(conn)
+        link.probe(timeout=ClassifierLink.RESPONSE_TIMEOUT)
+        link.calibrate()
+        return conn, link, baud
+    conn = serial.Serial(port=port, baudrate=DEFAULT_BAUD, timeout=5, write_timeout=5, rtscts=rtscts)
+    conn.adapter = tune(conn) if tune_port else identify(port)
+    conn.reset_input_buffer()
+    link = ClassifierLink(conn)
+    rate = link.connect(baud)
+    link.calibrate()
+    return conn, link, rate
+
+
+def reopener(port, baud, rtscts=False):
+    """LinkWorker(reopen=...) for a board on port: opens it again, the link of open_device"""
+    def reopen():
+        conn, link, _ = open_device(port, baud, rtscts)
+        return link
+    return reopen
+
+
+def config_report(c):
+    if not c.saved:
+        return "config        none saved, boots at 115200 on model 0"
+    clock = next((name for name, v in protocol.CLOCK_PROFILES.items() if v == c.clock), 'boot')
+    return (f"config        {c.baud} baud, model {c.model}, clock {clock}, "
+            f"flash {protocol.flash_name(c.flash)}{', applied at boot' if c.flags & protocol.CONFIG_APPLIED else ''}")
+
+
+def energy_report(e):
+    """Per-profile lines of an ENERGY reply, the profiles that ran"""
+    names = {v: k for k, v in protocol.CLOCK_PROFILES.items()}
+    lines = [f"energy        {e.window_ms / 1000:.1f} s at {e.mv} mV (current model), "
+             f"idle {'STOP allowed' if e.flags & protocol.ENERGY_STOP else 'WFI'}"]
+    for i, s in enumerate(e.slots):
+        if not s.hz:
+            continue
+        name = names.get(i, 'boot')
+        lines.append(f"  {name:<11} {s.hz / 1e6:.0f} MHz, {s.inferences} inferences, "
+                     f"awake {s.awake_us / 1e3:.1f} ms, asleep {s.asleep_us / 1e3:.1f} ms, "
+                     f"{s.energy_uj} uJ" +
+                     (f", {s.uj_per_inference:.1f} uJ/inference" if s.inferences else ""))
+    return "\n".join(lines)
+
+
+def memstat_report(m):
+    return "\n".join([
+        f"sram          {m.static_size} B static ({m.activations_size} B activations) "
+        f"of {m.ram_size} B",
+        f"heap          {m.heap_used} B, ends at {m.heap_end:#010x}",
+        f"stack peak    {m.stack_peak} B of {m.stack_reserved} B reserved",
+        f"sram free     {m.free} B never touched",
+        f"weight cache  {m.weight_cache} B of weights in sram",
+    ])
+
+
+def _name(names, index):
+    return names[index] if index < len(names) else str(index)
+
+
+def stats_report(s):
+    lines = [
+        f"uptime        {s.uptime_ms / 1000:.1f} s, {s.frames} frames, {s.inferences} inferences",
+        f"errors        crc {s.err_crc}, dropped {s.err_dropped}, inference {s.err_inference}, "
+        f"lost {s.events_lost}",
+        f"uart          overrun {s.uart_overrun}, framing {s.uart_framing}, noise {s.uart_noise}",
+        f"boots         {s.boots}, {s.warm_boots} warm, this one {_name(protocol.RESET_CAUSES, s.reset_cause)}, "
+        f"last fault {_name(protocol.FAULTS, s.last_fault)}",
+        f"boot          {s.boot_cycles} cycles to ready, {s.boot_us / 1000:.2f} ms",
+    ]
+    for name, hist in (('run', s.run_hist), ('frame', s.frame_hist)):
+        if sum(hist):
+            lines.append(f"{name:<13} p50 < {s.percentile(hist, 0.5):.0f} us, "
+                         f"p99 < {s.percentile(hist, 0.99):.0f} us")
+    load = s.utilization()
+    if load:
+        lines.append(f"cpu           {100 - load['idle']:.1f} % busy over {s.load_ms / 1000:.1f} s: "
+                     + ", ".join(f"{name} {pct:.1f} %" for name, pct in load.items()))
+    return "\n".join(lines)
+
+
+def record_bench(args, link, result, labels, mode, baud):
+    """Store a single board run in the --db history (stm32dc.perfdb)"""
+    from . import perfdb
+
+    metrics, samples = perfdb.bench_metrics(result, labels)
+    if args.layers and not args.counters:
+        metrics.update({f'layer.{name}': us for name, us in link.layer_profile()})
+    config = f"{mode} @{baud}"
+    if args.model is not None:
+        config += f" model {args.model}"
+    if args.clock:
+        config += f" {args.clock}"
+    model_hash, board = perfdb.link_identity(link)
+    run = perfdb.record(args.db, 'bench', metrics, config, samples, model_hash, board, args.note)
+    print(f"recorded      run {run} in {args.db} ({config})")
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--port')
+    parser.add_argument('--ports', nargs='+', metavar='PORT',
+                        help="spread CLASSIFY over several boards (DevicePool) instead of --port")
+    parser.add_argument('--policy', choices=POLICIES, default=LEAST_OUTSTANDING,
+                        help="how --ports picks the board for each request")
+    parser.add_argument('--no-hedge', action='store_true',
+                        help="with --ports, never send a slow request to a second board")
+    parser.add_argument('--max-wait-ms', type=float, default=5.0,
+                        help="with --ports and --batch, longest a request waits for a batch to fill")
+    parser.add_argument('--cache', type=int, default=0, metavar='ENTRIES',
+                        help="with --ports, answer repeated images from an LRU result cache")
+    parser.add_argument('--baud', type=int, default=921600)
+    parser.add_argument('--rtscts', action='store_true',
+                        help="RTS/CTS flow control (firmware built with APP_UART_FLOW)")
+    parser.add_argument('--auto-baud', type=int, metavar='MAX_BAUD',
+                        help="step the rate along the baud ladder from the error rate, up to MAX_BAUD")
+    parser.add_argument('--images', help="IDX or .npy file of 28x28 uint8 images")
+    parser.add_argument('--labels', help="IDX label file, enables the accuracy line")
+    parser.add_argument('--count', type=int, default=500,
+                        help="images to send (synthetic or first N of the dataset)")
+    parser.add_argument('--batch', type=int, default=0,
+                        help="send BATCH requests of this many images instead of CLASSIFY")
+    parser.add_argument('--pipeline', action='store_true',
+                        help="keep several CLASSIFY requests in flight (LinkWorker)")
+    parser.add_argument('--bits', type=int, choices=(8, 4, 1),
+                        help="send CLASSIFY_PACKED with pixels quantized to this depth")
+    parser.add_argument('--compare-bits', action='store_true',
+                        help="run CLASSIFY_PACKED at 8, 4 and 1 bit and report each")
+    parser.add_argument('--model', type=int,
+                        help="select this registered device model before measuring")
+    parser.add_argument('--cascade', nargs=2, type=int, metavar=('FIRST', 'FULL'),
+                        help="send CLASSIFY_CASCADE: model FIRST, then FULL when unsure")
+    parser.add_argument('--margin', type=int, default=protocol.CASCADE_MARGIN_DEFAULT,
+                        help="cascade exit margin in output LSBs (1/256 probability)")
+    parser.add_argument('--tta', type=int, metavar='MARGIN',
+                        help="send CLASSIFY_TTA: vote over device-made variants below this margin (APP_TTA)")
+    parser.add_argument('--tta-variants', type=int, default=protocol.TTA_VARIANTS,
+                        help="variants per unsure image with --tta (default %(default)s)")
+    parser.add_argument('--compare-models', action='store_true',
+                        help="run every registered model with CLASSIFY_PROF and report run time, "
+                             "cycles and footprint (APP_PROFILE)")
+    parser.add_argument('--kernel-bench', nargs='?', const='conv2d_2', metavar='LAYER',
+                        choices=[name for name, _ in protocol.KERNELS.values()],
+                        help="compare the library and custom kernel of conv2d_2 (APP_KERNEL_CONV, "
+                             "the default), gemm_5 (APP_KERNEL_DENSE), nl_7 (APP_SOFTMAX_BYPASS) "
+                             "or conv2d_0 (APP_KERNEL_INCREMENTAL)")
+    parser.add_argument('--cmsis-nn', action='store_true',
+                        help="time every layer on the library and on CMSIS-NN (APP_CMSIS_NN, APP_PROFILE)")
+    parser.add_argument('--isr', action='store_true',
+                        help="USART2 interrupt cycles per received byte, HAL or APP_UART_LL (APP_PROFILE)")
+    parser.add_argument('--flash-sweep', action='store_true',
+                        help="per-layer cycles for every ART accelerator setting (APP_FLASH_BENCH)")
+    parser.add_argument('--selftest', nargs='?', type=float, const=0.0, metavar='MIN_ACCURACY',
+                        help="run the firmware's embedded test vectors (APP_SELFTEST) "
+                             "and exit 1 below this accuracy (0..1)")
+    parser.add_argument('--max-cycles', type=int,
+                        help="with --selftest, also fail above this mean cycles per run")
+    parser.add_argument('--layers', action='store_true',
+                        help="report per-layer device time of the last inference (APP_PROFILE_LAYERS)")
+    parser.add_argument('--counters', action='store_true',
+                        help="with --layers, DWT event counts modulo 256 per layer (APP_PROFILE_COUNTERS)")
+    parser.add_argument('--wcet', nargs='?', type=int, const=0, metavar='RUNS',
+                        help="worst-case cycles over RUNS adversarial runs (APP_WCET), default 256")
+    parser.add_argument('--wcet-load', action='store_true',
+                        help="with --wcet, keep the line busy so receive interrupts hit the runs")
+    parser.add_argument('--wcet-warm', action='store_true',
+                        help="with --wcet, leave the ART caches warm between runs")
+    parser.add_argument('--wcet-compare', nargs='?', type=int, const=0, metavar='RUNS',
+                        help="WCET sweep with interrupts on, then held off, and the jitter of each "
+                             "(APP_DETERMINISTIC)")
+    parser.add_argument('--wcet-margin', type=float, default=0.2,
+                        help="added to the worst stages for the bound (default %(default)s)")
+    parser.add_argument('--irq-latency', nargs='?', type=int, const=0, metavar='BAUD',
+                        help="RX interrupt latency at BAUD byte rate over back-to-back runs and "
+                             "the safe baud per reception mode (APP_IRQ_LATENCY), default 921600")
+    parser.add_argument('--irq-runs', type=int, default=0,
+                        help="with --irq-latency, network runs (default 256)")
+    parser.add_argument('--memstat', action='store_true',
+                        help="report device SRAM use and peak stack after the run")
+    parser.add_argument('--stats', action='store_true',
+                        help="zero the device counters before the run and report them after (APP_STATS)")
+    parser.add_argument('--energy', action='store_true',
+                        help="zero the energy counters before the run and report uJ/inference "
+                             "per clock profile after (APP_ENERGY)")
+    load = parser.add_mutually_exclusive_group()
+    load.add_argument('--rate', type=float, metavar='IMAGES_PER_S',
+                      help="with --ports: drive every board open loop at this rate")
+    load.add_argument('--concurrency', type=int, metavar='N',
+                      help="with --ports: keep N requests outstanding on every board (closed loop)")
+    parser.add_argument('--breakdown', action='store_true',
+                        help="split each CLASSIFY's latency into host queue, uplink, device queue, "
+                             "inference, device, downlink and host parse (APP_TIMESTAMPS)")
+    parser.add_argument('--trace', metavar='PATH',
+                        help="write every request's spans as Chrome trace JSON for Perfetto (stm32dc.tracing)")
+    parser.add_argument('--warmup', type=int, default=10)
+    parser.add_argument('--clock', choices=sorted(protocol.CLOCK_PROFILES),
+                        help="switch the device clock profile before measuring")
+    parser.add_argument('--db', metavar='PATH',
+                        help="record the run in this stm32dc.perfdb history (single board, "
+                             "CLASSIFY, BATCH or PACKED modes)")
+    parser.add_argument('--note', default='', help="with --db, a note stored with the run")
+    config = parser.add_mutually_exclusive_group()
+    config.add_argument('--save-config', action='store_true',
+                        help="have the device boot at this baud rate, model and clock from now on (APP_CONFIG)")
+    config.add_argument('--clear-config', action='store_true',
+                        help="have the device boot on its defaults again")
+    args = parser.parse_args(argv)
+    timers.hold_resolution()
+    if args.trace:
+        tracing.enable()
+        atexit.register(tracing.save, args.trace)
+
+    if args.images:
+        images = load_images(args.images)[:args.count]
+    else:
+        images = synthetic_images(args.count)
+    labels = load_idx(args.labels)[:len(images)] if args.labels else None
+
+    if (args.rate or args.concurrency) and (not args.ports or args.batch or args.cache):
+        parser.error("--rate and --concurrency drive the boards of --ports, without --batch or --cache")
+    if args.ports:
+        if args.batch:
+            pool = DynamicBatcher.open(args.ports, args.baud, args.batch, args.max_wait_ms / 1e3,
+                                       rtscts=args.rtscts)
+            mode, report = f"batches of <= {pool.max_batch}, {args.max_wait_ms:g} ms wait", batcher_report
+        else:
+            pool = DevicePool.open(args.ports, args.baud, args.policy, rtscts=args.rtscts,
+                                   hedge=not args.no_hedge)
+            mode, report = args.policy, pool_report
+        with pool:
+            print(f"{len(pool)} boards @ {args.baud} baud, {mode}, {len(images)} images")
+            for f in [pool.classify(img) for img in images[:args.warmup * len(pool)]]:
+                try:
+                    f.result()
+                except (DeviceError, TimeoutError, ConnectionError):
+                    pass
+            pool.reset_stats()
+            if args.rate or args.concurrency:
+                print(f"load          {args.rate:g} images/s per board, open loop" if args.rate
+                      else f"load          {args.concurrency} outstanding per board, closed loop")
+                results, result = run_load(pool, images, args.rate, args.concurrency)
+                print(result.report(labels))
+                print(load_report(results))
+                return 0
+            cache = ResultCache(args.cache) if args.cache else None
+            result = run_pool(pool, images, cache)
+            print(result.report(labels))
+            print(report(pool.health()))
+            if getattr(pool, 'hedges', 0):
+                print(f"hedged        {pool.hedges} after {pool.hedge_delay * 1e3:.2f} ms (p95), "
+                      f"{pool.hedge_wins} answered by the second board first")
+            if cache:
+                print(cache.report())
+        return 0
+    if not args.port:
+        parser.error("give --port, or --ports for several boards")
+
+    status = 0
+    result, mode = None, None
+    conn, link, baud = open_device(args.port, args.baud, args.rtscts)
+    try:
+        print(f"{args.port} @ {baud} baud, {len(images)} images")
+        print(conn.adapter.report())
+        if args.auto_baud:
+            from .linkq import BaudGovernor
+            link.governor = BaudGovernor(link, args.auto_baud)
+        if args.clock:
+            print(f"clock         {args.clock}, HCLK {link.set_clock(args.clock) / 1e6:.0f} MHz")
+        if args.model is not None:
+            sel = link.select_model(args.model)
+            print(f"model         {sel.active} of {sel.count}, {sel.activations_size} B arena, "
+                  f"{sel.weights_size} B weights")
+        if args.save_config or args.clear_config:
+            print(config_report(link.config(protocol.CONFIG_SAVE if args.save_config
+                                            else protocol.CONFIG_CLEAR)))
+        for img in images[:args.warmup]:
+            try:
+                link.classify(img)
+            except (DeviceError, TimeoutError):
+                pass
+        if args.stats:
+            link.stats(reset=True)
+        if args.energy:
+            link.energy(reset=True)
+
+        if args.selftest is not None:
+            result = link.selftest()
+            print(selftest_report(result))
+            failures = selftest_gate(result, args.selftest, args.max_cycles)
+            for failure in failures:
+                print(f"FAIL          {failure}")
+            status = 1 if failures else 0
+        elif args.wcet is not None:
+            w = link.wcet(args.wcet, cold=not args.wcet_warm, load=args.wcet_load)
+            names = [name for name, _ in link.layer_profile()] if w.node_max else []
+            print(wcet_report(w, names, args.wcet_margin))
+        elif args.wcet_compare is not None:
+            print(wcet_compare(link, args.wcet_compare, cold=not args.wcet_warm, load=args.wcet_load))
+        elif args.irq_latency is not None:
+            print(irq_latency_report(link.irq_latency(args.irq_latency, args.irq_runs)))
+        elif args.compare_models:
+            print(compare_models(link, images, args.warmup))
+        elif args.flash_sweep:
+            print(flash_sweep(link, images, args.warmup))
+        elif args.isr:
+            print(isr_report(link, images, baud))
+        elif args.kernel_bench:
+            kernel = next(k for k, (name, _) in protocol.KERNELS.items() if name == args.kernel_bench)
+            print(kernel_report(link, images, kernel))
+        elif args.cmsis_nn:
+            print(nn_report(link, images, [name for name, _ in link.layer_profile()]))
+        elif args.batch:
+            result = run_batch(link, images, min(args.batch, protocol.MAX_BATCH))
+            mode = f"batch {min(args.batch, protocol.MAX_BATCH)}"
+            print(result.report(labels, per_request='batch'))
+        elif args.compare_bits:
+            for bits in (8, 4, 1):
+                print(f"--- {bits} bit pixels")
+                print(run_packed(link, images, bits).report(labels))
+        elif args.bits:
+            result = run_packed(link, images, args.bits)
+            mode = f"packed {args.bits}"
+            print(result.report(labels))
+        elif args.cascade:
+            result, stages, cycles = run_cascade(link, images, *args.cascade, args.margin)
+            mode = f"cascade {args.cascade[0]} {args.cascade[1]}"
+            print(result.report(labels))
+            answered = sum(stages)
+            if answered:
+                print(f"first stage   {stages[0]} of {answered} "
+                      f"({100.0 * stages[0] / answered:.1f} %), margin {args.margin}")
+                print(f"device        {sum(cycles) / answered:.0f} cycles/image")
+        elif args.tta is not None:
+            result, voted, changed, cycles = run_tta(link, images, args.tta, args.tta_variants)
+            mode = f"tta {args.tta}"
+            print(result.report(labels))
+            if cycles:
+                print(f"voted         {voted} of {len(cycles)} ({100.0 * voted / len(cycles):.1f} %), "
+                      f"margin {args.tta}, {changed} changed by the vote")
+                print(f"device        {sum(cycles) / len(cycles):.0f} cycles/image")
+        elif args.breakdown:
+            from .clocksync import breakdown_report
+
+            result, timings, uncertainty = run_timed(link, images, args.pipeline)
+            print(result.report(labels))
+            print(breakdown_report(timings, uncertainty))
+        elif args.pipeline:
+            result = run_pipelined(link, images)
+            mode = "pipeline"
+            print(result.report(labels))
+        else:
+            result = run_single(link, images)
+            mode = "classify"
+            print(result.report(labels))
+        print(f"crc errors    {link.reader.crc_errors} (host side)")
+        if link.governor and link.governor.steps:
+            steps = ' -> '.join(str(after) for _, after, _ in link.governor.steps)
+            print(f"auto baud     {baud} -> {steps}, now {conn.baudrate}")
+        if link.memo_hits:
+            print(f"memo hits     {link.memo_hits} answered without inference (APP_MEMO)")
+        if link.gate_hits:
+            print(f"gate hits     {link.gate_hits} answered as the image before (APP_DELTA_GATE)")
+        if args.layers and args.counters:
+            print(f"{'layer':<13} {'us':>9} " + ' '.join(f"{e:>5}" for e in protocol.EVENT_NAMES)
+                  + "  (mod 256)")
+            for layer in link.layer_counters():
+                print(f"{layer.name:<13} {layer.us:>9.1f} "
+                      + ' '.join(f"{layer.events[e]:>5}" for e in protocol.EVENT_NAMES))
+        elif args.layers:
+            for name, us in link.layer_profile():
+                print(f"{name:<13} {us:.1f} us")
+        if args.memstat:
+            print(memstat_report(link.memory_stats()))
+        if args.stats:
+            print(stats_report(link.stats()))
+        if args.energy:
+            print(energy_report(link.energy()))
+        if args.db and mode:
+            record_bench(args, link, result, labels, mode, baud)
+    finally:
+        conn.close()
+    return status
+
+
+if __name__ == '__main__':
+    sys.exit(main())
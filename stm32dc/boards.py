@@ -0,0 +1,159 @@
+"""The boards on this host's serial ports, all probed at once, and known again by their chip ID.
+
+    python -m stm32dc.boards                              # port, unique ID, firmware, models of each
+    python -m stm32dc.bench --ports auto --count 5000
+    python -m stm32dc.service --ports uid:0039001f uid:00470036 --baud 921600
+
+    for board in discover():
+        print(board.port, board.caps.uid)
+
+Every serial port (serial.tools.list_ports, plus any tcp:// bridge named)
+is opened on a thread of its own and PINGed every 20 ms for PROBE_TIMEOUT,
+first at the rate asked for, where a board with a saved CONFIG boots, then
+at DEFAULT_BAUD. A port that answers nothing, or opens too slowly to matter
+(Bluetooth serial ports do), is given up at the deadline without holding
+the rest back, so a pool of boards is found in well under a second rather
+than a typed guess at a time, each wrong one a 5 s open timeout.
+
+The PING reply carries the chip's 96-bit unique ID (UID_BASE), the
+firmware version and the model registry, so a board is the same board
+whichever COM number it gets after a replug or a reboot. In a port list,
+`auto` stands for every board found, in ID order, and `uid:PREFIX` for
+the one whose ID starts with PREFIX (expand()). open_device, DevicePool
+and DynamicBatcher take both. Firmware from before the identity reports
+no ID: such a board is found, but only reachable by its port.
+"""
+import argparse
+import sys
+import threading
+import time
+from typing import NamedTuple, Optional
+
+from . import protocol
+from .bridge import TcpSerial, is_bridge
+from .link import ClassifierLink, DeviceError, DEFAULT_BAUD
+
+# Seconds a port is PINGed at each rate
+PROBE_TIMEOUT = 0.3
+# Added to the probes for opening a port, then discovery stops waiting
+OPEN_GRACE = 0.3
+AUTO = 'auto'
+UID_PREFIX = 'uid:'
+
+
+class Board(NamedTuple):
+    port: str
+    baud: int                                  # the rate it answered at
+    caps: Optional[protocol.Capabilities]      # None: firmware from before PING
+    elapsed: float                             # seconds to open the port and get the answer
+
+    @property
+    def uid(self):
+        return self.caps.uid if self.caps is not None else ''
+
+    def describe(self):
+        if self.caps is None:
+            return f"{self.port:14} {'?':24}  firmware without PING, {self.baud} baud"
+        c = self.caps
+        return (f"{self.port:14} {c.uid or '(no ID)':24}  firmware {c.firmware()}, protocol v{c.version}, "
+                f"model {c.model_active} of {c.model_count or '?'} ({c.model_hash[:8]}), {self.baud} baud, "
+                f"{self.elapsed * 1e3:.0f} ms")
+
+
+def candidates():
+    """Device names of the host's serial ports, sorted"""
+    try:
+        from serial.tools import list_ports
+    except ImportError:
+        return []
+    return sorted(p.device for p in list_ports.comports())
+
+
+def probe(port, baud=DEFAULT_BAUD, timeout=PROBE_TIMEOUT):
+    """The Board on port, None if nothing there answers PING"""
+    start = time.perf_counter()
+    try:
+        if is_bridge(port):
+            conn, rates = TcpSerial(port, baud, timeout=timeout, write_timeout=timeout), (baud,)
+        else:
+            import serial
+            conn = serial.Serial(port=port, baudrate=baud, timeout=timeout, write_timeout=timeout)
+            rates = dict.fromkeys((baud, DEFAULT_BAUD))
+    except (OSError, ValueError):
+        return None
+    try:
+        link = ClassifierLink(conn)
+        for rate in rates:
+            try:
+                conn.baudrate = rate
+                conn.reset_input_buffer()
+                caps = link.probe(timeout=timeout)
+            except (TimeoutError, DeviceError, OSError):
+                continue
+            return Board(port, rate, caps, time.perf_counter() - start)
+        return None
+    finally:
+        conn.close()
+
+
+def discover(ports=None, baud=DEFAULT_BAUD, timeout=PROBE_TIMEOUT):
+    """Boards on ports, default every serial port, probed in parallel; in unique ID order"""
+    ports = candidates() if ports is None else list(ports)
+    found = [None] * len(ports)
+
+    def run(index, port):
+        found[index] = probe(port, baud, timeout)
+
+    threads = [threading.Thread(target=run, args=(i, port), name=f'probe {port}', daemon=True)
+               for i, port in enumerate(ports)]
+    for t in threads:
+        t.start()
+    # Two rates of probing plus opening; a port still busy then is left to finish alone
+    deadline = time.monotonic() + 2 * timeout + OPEN_GRACE
+    for t in threads:
+        t.join(max(0.0, deadline - time.monotonic()))
+    boards = [b for b in list(found) if b is not None]
+    return sorted(boards, key=lambda b: (not b.uid, b.uid, b.port))
+
+
+def expand(ports, baud=DEFAULT_BAUD):
+    """ports with `auto` replaced by every board found and `uid:PREFIX` by that board's port"""
+    if not any(p == AUTO or p.startswith(UID_PREFIX) for p in ports):
+        return list(ports)
+    boards = discover(baud=baud)
+    expanded = []
+    for port in ports:
+        if port == AUTO:
+            if not boards:
+                raise ConnectionError("no board answers on any serial port")
+            expanded += [b.port for b in boards if b.port not in expanded]
+        elif port.startswith(UID_PREFIX):
+            prefix = port[len(UID_PREFIX):].lower()
+            match = [b.port for b in boards if b.uid and b.uid.startswith(prefix)]
+            if len(match) != 1:
+                raise ConnectionError(f"{len(match) or 'no'} boards with unique ID {prefix}...")
+            expanded.append(match[0])
+        else:
+            expanded.append(port)
+    return expanded
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--ports', nargs='+', metavar='PORT', help="only these (default: every serial port)")
+    parser.add_argument('--baud', type=int, default=DEFAULT_BAUD,
+                        help="rate tried before the boot rate, a board's saved CONFIG rate")
+    parser.add_argument('--timeout', type=float, default=PROBE_TIMEOUT, help="seconds of PINGs per rate")
+    args = parser.parse_args(argv)
+
+    start = time.perf_counter()
+    ports = args.ports or candidates()
+    boards = discover(ports, args.baud, args.timeout)
+    for board in boards:
+        print(board.describe())
+    print(f"{len(boards)} boards on {len(ports)} ports in {(time.perf_counter() - start) * 1e3:.0f} ms")
+    return 0 if boards else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
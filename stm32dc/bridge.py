@@ -0,0 +1,209 @@
+"""Boards behind TCP serial bridges (ser2net raw mode and alike) as ports.
+
+    python -m stm32dc.service --ports COM9 tcp://gw1:4001 tcp://gw2:4001 --baud 921600
+    python -m stm32dc.bench --port tcp://gw1:4001 --baud 921600 --pipeline
+
+    conn = TcpSerial('tcp://gw1:4001', baudrate=921600)
+    link = ClassifierLink(conn)
+
+A tcp://HOST:PORT port name anywhere a port is taken (open_device, so the
+pool, batcher, service and tools) opens TcpSerial, the part of
+serial.Serial the link uses over a socket. TCP_NODELAY is set, so a frame
+goes out as soon as it is written rather than when Nagle's algorithm has
+heard back about the last one: the workers already write a request as one
+call, its BATCH images included, and pipeline as many as the board's
+credits allow, which covers what coalescing small writes would have bought.
+Writes send the caller's buffer as it is and readinto() receives into the
+FrameReader's, so a frame is not copied on its way through.
+
+The bridge's serial line runs at whatever rate it was configured with:
+--baud must match it, and nothing is negotiated (SET_BAUD would change
+the board's rate and not the gateway's). A dropped connection is
+reopened in the background, RECONNECT_BACKOFF doubling up to
+RECONNECT_MAX between attempts; reads return nothing while it is down, so
+a LinkWorker's requests time out and are retried instead of its reader
+failing, and writes raise ConnectionError, which the pool treats as a
+transport failure and sends elsewhere.
+"""
+import select
+import socket
+import threading
+import time
+
+SCHEME = 'tcp://'
+CONNECT_TIMEOUT = 5.0
+RECONNECT_BACKOFF = 0.1
+RECONNECT_MAX = 5.0
+RECV_SIZE = 65536
+
+
+def is_bridge(port):
+    return isinstance(port, str) and port.startswith(SCHEME)
+
+
+def parse(url):
+    """(host, port) of tcp://HOST:PORT"""
+    host, sep, port = url[len(SCHEME):].rpartition(':')
+    if not sep or not port.isdigit():
+        raise ValueError(f"expected tcp://HOST:PORT, not {url}")
+    return host.strip('[]'), int(port)
+
+
+class TcpSerial:
+    """serial.Serial's read/write/timeout over a socket to a serial bridge"""
+
+    def __init__(self, url, baudrate, timeout=None, write_timeout=None):
+        self.port = url
+        self.address = parse(url)
+        self.baudrate = baudrate     # the bridge's line rate, recorded only
+        self.timeout = timeout
+        self.write_timeout = write_timeout
+        self.buffer = bytearray()
+        self.peek = bytearray(RECV_SIZE)
+        self.lock = threading.Lock()  # sock and the reconnect state
+        self.sock = None
+        self.retry_at = 0.0
+        self.backoff = RECONNECT_BACKOFF
+        self.reconnects = 0
+        self.is_open = True
+        self.sock = self._connect()
+
+    def _connect(self):
+        sock = socket.create_connection(self.address, CONNECT_TIMEOUT)
+        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_KEEPALIVE, 1)
+        sock.setblocking(False)
+        return sock
+
+    def _lost(self):
+        """Drop the connection, the next _socket() reopens it (holds self.lock)"""
+        if self.sock is not None:
+            self.sock.close()
+            self.sock = None
+            self.retry_at = time.monotonic()
+            self.backoff = RECONNECT_BACKOFF
+
+    def _socket(self):
+        """The connection, reopened when due; None while the bridge is unreachable"""
+        with self.lock:
+            if self.sock is None and self.is_open and time.monotonic() >= self.retry_at:
+                try:
+                    self.sock = self._connect()
+                    self.reconnects += 1
+                    self.buffer.clear()  # bytes of a frame cut short by the drop
+                except OSError:
+                    self.retry_at = time.monotonic() + self.backoff
+                    self.backoff = min(self.backoff * 2, RECONNECT_MAX)
+            return self.sock
+
+    def _fill(self, sock, wait, into=None):
+        """Receive what is there after waiting up to wait seconds, into the buffer or straight
+        into a writable view; the byte count, None on a dropped connection"""
+        try:
+            if wait is None or wait > 0:
+                readable, _, _ = select.select([sock], [], [], wait)
+                if not readable:
+                    return 0
+            if into is not None:
+                got = sock.recv_into(into)
+            else:
+                data = sock.recv(RECV_SIZE)
+                self.buffer += data
+                got = len(data)
+        except BlockingIOError:
+            return 0
+        except OSError:
+            got = 0
+        if not got:
+            with self.lock:
+                if self.sock is sock:
+                    self._lost()
+            return None
+        return got
+
+    @property
+    def in_waiting(self):
+        """Bytes buffered plus those the socket holds, peeked at so readinto() still receives
+        them in place"""
+        sock = self._socket()
+        if sock is None:
+            return len(self.buffer)
+        try:
+            peeked = sock.recv_into(self.peek, 0, socket.MSG_PEEK)
+        except OSError:
+            peeked = 0  # nothing yet, or dropped: the next read finds out
+        return len(self.buffer) + peeked
+
+    def read(self, size=1):
+        deadline = None if self.timeout is None else time.monotonic() + self.timeout
+        while len(self.buffer) < size and self.is_open:
+            remaining = None if deadline is None else deadline - time.monotonic()
+            if remaining is not None and remaining <= 0:
+                break
+            sock = self._socket()
+            if sock is None:
+                time.sleep(RECONNECT_BACKOFF if remaining is None else min(RECONNECT_BACKOFF, remaining))
+                continue
+            self._fill(sock, remaining)
+        data = bytes(self.buffer[:size])
+        del self.buffer[:size]
+        return data
+
+    def readinto(self, b):
+        """read(len(b)) into b: what is buffered, then received straight into it"""
+        view = memoryview(b).cast('B')
+        got = min(len(view), len(self.buffer))
+        view[:got] = self.buffer[:got]
+        del self.buffer[:got]
+        deadline = None if self.timeout is None else time.monotonic() + self.timeout
+        while got < len(view) and self.is_open:
+            remaining = None if deadline is None else deadline - time.monotonic()
+            if remaining is not None and remaining <= 0:
+                break
+            sock = self._socket()
+            if sock is None:
+                time.sleep(RECONNECT_BACKOFF if remaining is None else min(RECONNECT_BACKOFF, remaining))
+                continue
+            got += self._fill(sock, remaining, view[got:]) or 0
+        return got
+
+    def write(self, data):
+        """All of data in one send where the socket buffer takes it"""
+        sock = self._socket()
+        if sock is None:
+            raise ConnectionError(f"{self.port} unreachable")
+        view = memoryview(data)
+        deadline = None if self.write_timeout is None else time.monotonic() + self.write_timeout
+        try:
+            while view:
+                try:
+                    view = view[sock.send(view):]
+                except BlockingIOError:
+                    remaining = None if deadline is None else deadline - time.monotonic()
+                    if remaining is not None and remaining <= 0:
+                        raise TimeoutError(f"write to {self.port} timed out")
+                    select.select([], [sock], [], remaining)
+        except TimeoutError:
+            raise
+        except OSError as e:
+            with self.lock:
+                if self.sock is sock:
+                    self._lost()
+            raise ConnectionError(f"{self.port}: {e}") from e
+        return len(data)
+
+    def flush(self):
+        pass  # send() hands the bytes to the kernel, TCP_NODELAY sends them
+
+    def reset_input_buffer(self):
+        sock = self._socket()
+        while sock is not None and self._fill(sock, 0):
+            self.buffer.clear()
+        self.buffer.clear()
+
+    def close(self):
+        with self.lock:
+            self.is_open = False
+            if self.sock is not None:
+                self.sock.close()
+                self.sock = None
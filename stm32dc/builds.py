@@ -0,0 +1,191 @@
+"""Firmware build profiles side by side: stage cycles and section sizes, and the one to ship.
+
+    python -m stm32dc.builds tinyML --port COM9
+    python -m stm32dc.builds tinyML --port COM9 --configs Release SpeedLTO --json builds.json
+    python -m stm32dc.builds tinyML --sizes-only                 # no board: build and size each
+    python -m stm32dc.builds tinyML --port COM9 --db perf.sqlite # history, stm32dc.perfdb
+
+tinyML/.cproject has a build configuration per profile. STM32CubeIDE
+writes the makefiles of each into a folder of its name on its first
+build:
+
+    Release     -Os          size, the profile the firmware has shipped with
+    Speed       -O3          speed
+    SpeedLTO    -O3 -flto    speed, inlined across files at link time
+
+Each configuration in turn is built with --build, and its sections are
+read from <config>/tinyML.map (stm32dc.memmap): code, constants (the
+weights apart), .data and .bss, and the FLASH and RAM used. It is then
+flashed with --flash. After PING answers, --count images are classified
+with CLASSIFY_PROF after --warmup, for the median cycles of
+preprocessing, network run and argmax, their total, and the run's p99.
+Cycles, not microseconds, so profiles that booted at different clocks
+still compare.
+
+The production profile is the smallest in flash of those within
+--tolerance (2 %) of the fastest total. Code size only decides when the
+speed it costs is noise. A configuration that fails to build is reported
+and skipped. The board is left running the last configuration measured.
+"""
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+
+from . import memmap
+from .bench import percentile, synthetic_images
+from .search import wait_for_board
+
+CONFIGS = {'Release': '-Os', 'Speed': '-O3', 'SpeedLTO': '-O3 -flto'}
+DEFAULT_BUILD = 'make -C {project}/{config} -j8 all'
+DEFAULT_FLASH = 'STM32_Programmer_CLI -c port=SWD -w {project}/{config}/tinyML.elf -v -rst'
+STAGES = ('pre', 'run', 'argmax')
+TOLERANCE = 0.02
+# Output sections of the linker script by kind
+CODE = ('.isr_vector', '.text')
+CONSTANTS = ('.rodata', '.ARM.extab', '.ARM', '.preinit_array', '.init_array', '.fini_array')
+
+
+def sizes(text):
+    """{kind: bytes} of a map file: code, rodata, weights, data, bss, flash and ram used"""
+    regions, sections, _ = memmap.parse_map(text)
+    by_name = {s.name: s.size for s in sections}
+    used = memmap.usage(regions, sections)
+    return {'code': sum(by_name.get(n, 0) for n in CODE),
+            'rodata': sum(by_name.get(n, 0) for n in CONSTANTS),
+            'weights': by_name.get('.ai_weights', 0),
+            'data': by_name.get('.data', 0),
+            'bss': by_name.get('.bss', 0),
+            'flash': used.get('FLASH', 0),
+            'ram': used.get('RAM', 0)}
+
+
+def measure(link, images, warmup):
+    """{stage: median cycles, 'total', 'run_p99', 'cpu_hz'} of classifying images with CLASSIFY_PROF"""
+    for image in images[:warmup]:
+        link.classify(image)
+    stages = {name: [] for name in STAGES}
+    cpu_hz = 0
+    for image in images:
+        _, profile = link.classify_profiled(image)
+        cpu_hz = profile.cpu_hz
+        for name in STAGES:
+            stages[name].append(getattr(profile, name) * cpu_hz / 1e6)
+    result = {name: statistics.median(cycles) for name, cycles in stages.items()}
+    result['total'] = statistics.median(sum(c) for c in zip(*stages.values()))
+    result['run_p99'] = percentile(sorted(stages['run']), 99)
+    result['cpu_hz'] = cpu_hz
+    return result
+
+
+def pick(results, tolerance=TOLERANCE):
+    """The smallest in flash of the measured results within tolerance of the fastest total"""
+    timed = [r for r in results if 'total' in r]
+    if not timed:
+        return None
+    fastest = min(r['total'] for r in timed)
+    return min((r for r in timed if r['total'] <= fastest * (1 + tolerance)),
+               key=lambda r: (r['sizes']['flash'], r['total']))
+
+
+def shell(command, project, config):
+    cmd = command.format(project=project, config=config)
+    print(cmd)
+    subprocess.run(cmd, shell=True, check=True)
+
+
+def run_config(args, config, images):
+    """Build, size, and unless --sizes-only flash and measure one configuration"""
+    result = {'config': config, 'flags': CONFIGS.get(config, '')}
+    try:
+        shell(args.build, args.project, config)
+    except subprocess.CalledProcessError as e:
+        result['error'] = f"build failed ({e.returncode})"
+        return result
+    with open(os.path.join(args.project, config, 'tinyML.map'), encoding='utf-8', errors='replace') as f:
+        result['sizes'] = sizes(f.read())
+    if args.sizes_only:
+        return result
+    try:
+        shell(args.flash, args.project, config)
+    except subprocess.CalledProcessError as e:
+        result['error'] = f"flash failed ({e.returncode})"
+        return result
+    conn, link, _ = wait_for_board(args.port, args.baud, args.rtscts, args.boot_timeout)
+    try:
+        result.update(measure(link, images, args.warmup))
+        if link.caps:
+            result['model_hash'], result['board'] = link.caps.model_hash, link.caps.uid
+    finally:
+        conn.close()
+    return result
+
+
+def report(results, picked, tolerance=TOLERANCE):
+    lines = [f"{'config':<10}{'flags':<11}" + ''.join(f"{h:>10}" for h in STAGES + ('total', 'run p99')) +
+             ''.join(f"{h:>9}" for h in ('code', 'rodata', 'data', 'bss', 'flash', 'ram'))]
+    for r in results:
+        row = f"{r['config']:<10}{r['flags']:<11}"
+        if 'total' in r:
+            row += ''.join(f"{r[k]:>10.0f}" for k in STAGES + ('total', 'run_p99'))
+        else:
+            row += f"{'-':>10}" * (len(STAGES) + 2)
+        if 'sizes' in r:
+            row += ''.join(f"{r['sizes'][k]:>9}" for k in ('code', 'rodata', 'data', 'bss', 'flash', 'ram'))
+        if 'error' in r:
+            row += f"  {r['error']}"
+        lines.append(row + ("  <- production" if r is picked else ""))
+    if picked:
+        lines.append(f"production: {picked['config']} ({picked['flags']}), the smallest within "
+                     f"{tolerance * 100:g} % of the fastest")
+    return "\n".join(lines)
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('project', help="firmware project directory (tinyML)")
+    ap.add_argument('--configs', nargs='+', default=list(CONFIGS), metavar='CONFIG',
+                    help="build configurations to compare (default: %(default)s)")
+    ap.add_argument('--port', help="the board's serial port")
+    ap.add_argument('--baud', type=int, default=921600)
+    ap.add_argument('--rtscts', action='store_true')
+    ap.add_argument('--sizes-only', action='store_true', help="build and size each configuration, no board")
+    ap.add_argument('--count', type=int, default=200, help="images classified per configuration")
+    ap.add_argument('--warmup', type=int, default=10)
+    ap.add_argument('--tolerance', type=float, default=TOLERANCE,
+                    help="slowdown the production pick may trade for flash, 0.02 = 2 %%")
+    ap.add_argument('--build', default=DEFAULT_BUILD, help="build command (default %(default)r)")
+    ap.add_argument('--flash', default=DEFAULT_FLASH, help="flash command (default %(default)r)")
+    ap.add_argument('--boot-timeout', type=float, default=15.0)
+    ap.add_argument('--json', metavar='PATH', help="also write the results as JSON")
+    ap.add_argument('--db', metavar='PATH', help="record each profile's run in this stm32dc.perfdb history")
+    ap.add_argument('--note', default='', help="with --db, a note stored with the runs")
+    args = ap.parse_args(argv)
+    if not args.sizes_only and not args.port:
+        ap.error("--port is needed to measure, or --sizes-only")
+
+    images = synthetic_images(args.count)
+    results = []
+    for config in args.configs:
+        print(f"{config}:")
+        results.append(run_config(args, config, images))
+    picked = pick(results, args.tolerance)
+    print(report(results, picked, args.tolerance))
+    if args.json:
+        with open(args.json, 'w', encoding='utf-8') as f:
+            json.dump({'images': len(images), 'results': results,
+                       'production': picked['config'] if picked else None}, f, indent=1)
+    if args.db:
+        from . import perfdb
+
+        for r in results:
+            if 'error' not in r:
+                perfdb.record(args.db, 'build', perfdb.build_metrics(r), r['config'],
+                              model_hash=r.get('model_hash', ''), board=r.get('board', ''), note=args.note)
+    return 0 if all('error' not in r for r in results) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
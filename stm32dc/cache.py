@@ -0,0 +1,87 @@
+"""LRU cache of classification results keyed by the image content.
+
+    cache = ResultCache(4096)
+    future = cache.classify(image, pool.classify)   # resolved at once on a hit
+
+The key is a 64-bit hash of the 784 uint8 pixels (xxhash's xxh3_64 when the
+package is installed, else blake2b), so an unchanged canvas or a dataset
+entry scored again is answered without the device round trip. Only
+successful results are stored. Results depend on the model that produced
+them: clear() the cache after SELECT_MODEL or reflashing, or give each
+model its own cache.
+"""
+import hashlib
+import threading
+from collections import OrderedDict
+from concurrent.futures import Future
+
+try:
+    import xxhash
+except ImportError:
+    xxhash = None
+
+DEFAULT_CAPACITY = 4096
+
+
+def image_key(image):
+    if xxhash is not None:
+        return xxhash.xxh3_64_intdigest(image)
+    return int.from_bytes(hashlib.blake2b(image, digest_size=8).digest(), 'little')
+
+
+class ResultCache:
+    def __init__(self, capacity=DEFAULT_CAPACITY):
+        self.capacity = capacity
+        self.entries = OrderedDict()    # key -> result, least recently used first
+        self.lock = threading.Lock()
+        self.hits = 0
+        self.misses = 0
+
+    def __len__(self):
+        return len(self.entries)
+
+    def get(self, image):
+        """Cached result of image, None on a miss"""
+        key = image_key(bytes(image))
+        with self.lock:
+            result = self.entries.get(key)
+            if result is None:
+                self.misses += 1
+                return None
+            self.entries.move_to_end(key)
+            self.hits += 1
+            return result
+
+    def put(self, image, result):
+        key = image_key(bytes(image))
+        with self.lock:
+            self.entries[key] = result
+            self.entries.move_to_end(key)
+            while len(self.entries) > self.capacity:
+                self.entries.popitem(last=False)
+
+    def classify(self, image, submit) -> Future:
+        """Future of image's result: from the cache, or from submit(image) and stored once it succeeds"""
+        image = bytes(image)
+        result = self.get(image)
+        if result is not None:
+            future = Future()
+            future.set_result(result)
+            return future
+        future = submit(image)
+        future.add_done_callback(
+            lambda f: self.put(image, f.result()) if not f.cancelled() and f.exception() is None else None)
+        return future
+
+    def clear(self):
+        with self.lock:
+            self.entries.clear()
+
+    @property
+    def hit_rate(self):
+        total = self.hits + self.misses
+        return self.hits / total if total else 0.0
+
+    def report(self):
+        return (f"cache         {self.hits} hits, {self.misses} misses ({100.0 * self.hit_rate:.1f} %), "
+                f"{len(self.entries)} of {self.capacity} entries")
@@ -0,0 +1,309 @@
+"""Classify what a camera sees, continuously, at the rate the board sustains.
+
+    python -m stm32dc.camera --port COM9 --camera 0 --show
+    python -m stm32dc.camera --port COM9 --video digits.mp4 --seconds 30
+    python -m stm32dc.camera --host --camera 0
+
+Three threads hand frames on through one-deep slots (LatestSlot) where a
+newer frame replaces one not yet taken, so no stage ever waits on the one
+after it and the board always gets the most recent view:
+
+    grab     reads the camera as fast as it delivers
+    prepare  cuts the square region of interest out of the centre, finds
+             the ink (stm32dc.segment.to_ink) and frames it to 28x28
+             (stm32dc.preprocess.normalize), all on whole arrays
+    send     keeps --window CLASSIFY_PACKED requests in flight on the link
+             worker; mostly deltas of the previous frame on a steady view
+
+The worker owns the port; nothing here blocks its reader or writer. A
+frame with less ink than --min-ink is not sent, nor is one that differs
+from the frame last sent by less than --delta-gate in summed pixel change
+(stm32dc.preprocess.delta_energy): the digit shown stands for it. The report line gives the
+rate of each stage and how many frames the slots dropped: a pipeline bound
+by the device grabs far more than it classifies.
+
+Needs OpenCV (pip install opencv-python) for the camera and --show.
+"""
+import argparse
+import logging
+import sys
+import threading
+import time
+
+import numpy as np
+
+from .bench import open_device
+from .link import DeviceError
+from .preprocess import DELTA_GATE, MODEL_SIZE, delta_energy, normalize
+from .segment import to_gray, to_ink
+from .worker import LinkWorker
+
+log = logging.getLogger(__name__)
+
+# Side of the centred region of interest, of the frame's shorter side
+DEFAULT_ROI = 0.5
+# Fraction of the region that must be ink for a frame to be classified
+DEFAULT_MIN_INK = 0.01
+
+
+def load_cv2():
+    try:
+        import cv2
+    except ImportError:
+        raise SystemExit("no OpenCV, pip install opencv-python") from None
+    return cv2
+
+
+class LatestSlot:
+    """One-item hand-over: put() replaces an item nobody took, get() waits for one"""
+
+    def __init__(self):
+        self.item = None
+        self.cond = threading.Condition()
+        self.closed = False
+        self.put_count = 0
+        self.dropped = 0
+
+    def put(self, item):
+        with self.cond:
+            if self.item is not None:
+                self.dropped += 1
+            self.item = item
+            self.put_count += 1
+            self.cond.notify()
+
+    def get(self, timeout=None):
+        """The newest item, None once closed or after timeout"""
+        with self.cond:
+            if self.cond.wait_for(lambda: self.item is not None or self.closed, timeout):
+                item, self.item = self.item, None
+                return item
+            return None
+
+    def close(self):
+        with self.cond:
+            self.closed = True
+            self.cond.notify_all()
+
+
+def roi_box(shape, fraction=DEFAULT_ROI):
+    """(y0, x0, y1, x1) of the centred square covering fraction of the shorter side"""
+    h, w = shape[:2]
+    side = max(MODEL_SIZE, int(min(h, w) * fraction))
+    y0, x0 = (h - side) // 2, (w - side) // 2
+    return y0, x0, y0 + side, x0 + side
+
+
+def prepare(frame, fraction=DEFAULT_ROI, min_ink=DEFAULT_MIN_INK):
+    """28x28 uint8 model image of the region of interest, None if it holds too little ink"""
+    y0, x0, y1, x1 = roi_box(frame.shape, fraction)
+    ink = to_ink(to_gray(frame[y0:y1, x0:x1]))
+    if np.count_nonzero(ink) < min_ink * ink.size:
+        return None
+    return normalize(ink)
+
+
+class CameraPipeline:
+    """grab -> prepare -> send over LatestSlots, results to on_result(digit, frame_time)"""
+
+    def __init__(self, source, classify, window=1, roi=DEFAULT_ROI, min_ink=DEFAULT_MIN_INK,
+                 on_result=None, delta_gate=DELTA_GATE):
+        self.source = source            # cv2.VideoCapture or anything with read() -> (ok, frame)
+        self.classify = classify        # image bytes -> Future of the digit
+        self.window = threading.Semaphore(window)
+        self.roi = roi
+        self.min_ink = min_ink
+        self.delta_gate = delta_gate    # 0 sends every frame
+        self.on_result = on_result or (lambda digit, at: None)
+        self.frames = LatestSlot()      # (perf_counter, BGR frame)
+        self.images = LatestSlot()      # (perf_counter, 28x28 image)
+        self.preview = None             # last (frame, digit) for a display, any thread
+        self.digit = None
+        self.stopped = threading.Event()
+        self.threads = []
+        self.sent = None                # the image last sent, None after a blank or lost frame
+        self.blank = 0
+        self.unchanged = 0
+        self.results = 0
+        self.errors = 0
+        self.latencies = []             # frame grabbed to digit, seconds
+
+    def start(self):
+        for target, name in ((self._grab, 'cam-grab'), (self._prepare, 'cam-prepare'),
+                             (self._send, 'cam-send')):
+            self.threads.append(threading.Thread(target=target, name=name, daemon=True))
+        for t in self.threads:
+            t.start()
+        return self
+
+    def stop(self):
+        self.stopped.set()
+        self.frames.close()
+        self.images.close()
+        for t in self.threads:
+            t.join()
+        self.threads = []
+
+    def _grab(self):
+        while not self.stopped.is_set():
+            ok, frame = self.source.read()
+            if not ok:
+                break  # end of a video file, or the camera went away
+            self.frames.put((time.perf_counter(), frame))
+            self.preview = (frame, self.digit)
+        self.frames.close()
+
+    def _prepare(self):
+        while True:
+            item = self.frames.get()
+            if item is None:
+                break
+            at, frame = item
+            image = prepare(frame, self.roi, self.min_ink)
+            if image is None:
+                self.blank += 1
+                self.digit = None
+                self.sent = None
+                continue
+            self.images.put((at, image))
+        self.images.close()
+
+    def _send(self):
+        while True:
+            # A full window waits here, the images slot keeps only the newest
+            while not self.window.acquire(timeout=0.1):
+                if self.stopped.is_set():
+                    return
+            item = self.images.get()
+            if item is None:
+                self.window.release()
+                break
+            at, image = item
+            sent = self.sent
+            if sent is not None and delta_energy(image, sent) < self.delta_gate:
+                self.unchanged += 1
+                self.window.release()
+                continue
+            self.sent = image
+            self.classify(image.tobytes()).add_done_callback(lambda f, at=at: self._done(f, at))
+
+    def _done(self, future, at):
+        # Runs on the worker's reader thread: record and hand on, nothing slow
+        self.window.release()
+        try:
+            digit = future.result()
+        except (DeviceError, TimeoutError, ConnectionError) as e:
+            self.errors += 1
+            self.sent = None
+            log.debug("frame lost: %s", e)
+            return
+        self.results += 1
+        self.latencies.append(time.perf_counter() - at)
+        self.digit = digit
+        self.on_result(digit, at)
+
+    def report(self, elapsed):
+        rate = lambda n: n / elapsed if elapsed else 0.0
+        lat = sorted(self.latencies)
+        p50 = lat[len(lat) // 2] * 1e3 if lat else 0.0
+        return (f"grabbed {rate(self.frames.put_count):.1f}/s, prepared {rate(self.images.put_count):.1f}/s "
+                f"({self.blank} blank, {self.unchanged} unchanged), classified {rate(self.results):.1f}/s, "
+                f"dropped {self.frames.dropped} + {self.images.dropped}, {self.errors} errors, "
+                f"frame to digit p50 {p50:.1f} ms")
+
+
+def show(cv2, pipeline, roi):
+    """Preview window on the calling thread until q or Esc, False when closed"""
+    item = pipeline.preview
+    if item is None:
+        return cv2.waitKey(10) not in (ord('q'), 27)
+    frame, digit = item
+    frame = frame.copy()
+    y0, x0, y1, x1 = roi_box(frame.shape, roi)
+    cv2.rectangle(frame, (x0, y0), (x1, y1), (0, 200, 0), 2)
+    cv2.putText(frame, '-' if digit is None else str(digit), (x0, max(30, y0 - 10)),
+                cv2.FONT_HERSHEY_SIMPLEX, 1.2, (0, 200, 0), 2)
+    cv2.imshow('stm32dc camera', frame)
+    return cv2.waitKey(10) not in (ord('q'), 27)
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--port', help="serial port of the board")
+    ap.add_argument('--host', action='store_true', help="classify with the .tflite instead of a board")
+    ap.add_argument('--baud', type=int, default=921600)
+    ap.add_argument('--rtscts', action='store_true')
+    ap.add_argument('--camera', type=int, default=0, help="camera index (default %(default)s)")
+    ap.add_argument('--video', help="read a video file instead of the camera")
+    ap.add_argument('--roi', type=float, default=DEFAULT_ROI,
+                    help="region of interest, of the shorter side (default %(default)s)")
+    ap.add_argument('--min-ink', type=float, default=DEFAULT_MIN_INK,
+                    help="ink fraction below which a frame is skipped (default %(default)s)")
+    ap.add_argument('--delta-gate', type=int, default=DELTA_GATE,
+                    help="summed pixel change below which a frame is not sent, 0 sends all "
+                         "(default %(default)s)")
+    ap.add_argument('--window', type=int, default=2, help="requests in flight (default %(default)s)")
+    ap.add_argument('--seconds', type=float, default=0, help="stop after this long, 0 runs until q/Ctrl-C")
+    ap.add_argument('--show', action='store_true', help="preview window with the region and the digit")
+    args = ap.parse_args(argv)
+    if bool(args.port) == args.host:
+        ap.error("give either --port or --host")
+    logging.basicConfig(level=logging.INFO, format='%(message)s')
+
+    cv2 = load_cv2()
+    source = cv2.VideoCapture(args.video if args.video else args.camera)
+    if not source.isOpened():
+        raise SystemExit(f"cannot open {args.video or f'camera {args.camera}'}")
+
+    conn = worker = None
+    if args.host:
+        from concurrent.futures import Future
+        from .reference import ReferenceModel
+        model = ReferenceModel()
+
+        def classify(image):
+            future = Future()
+            future.set_result(model.classify(image))
+            return future
+    else:
+        conn, link, _ = open_device(args.port, args.baud, args.rtscts)
+        worker = LinkWorker(link).start()
+        classify = worker.classify_packed
+
+    last = [None]
+
+    def on_result(digit, at):
+        if digit != last[0]:
+            last[0] = digit
+            log.info("digit %s", '-' if digit is None else digit)
+
+    pipeline = CameraPipeline(source, classify, args.window, args.roi, args.min_ink, on_result,
+                              args.delta_gate).start()
+    start = time.perf_counter()
+    try:
+        while any(t.is_alive() for t in pipeline.threads):
+            if args.seconds and time.perf_counter() - start >= args.seconds:
+                break
+            if args.show:
+                if not show(cv2, pipeline, args.roi):
+                    break
+            else:
+                time.sleep(0.05)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        elapsed = time.perf_counter() - start
+        pipeline.stop()
+        source.release()
+        if args.show:
+            cv2.destroyAllWindows()
+        if worker:
+            worker.close()
+        if conn:
+            conn.close()
+    print(pipeline.report(elapsed))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
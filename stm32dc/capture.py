@@ -0,0 +1,263 @@
+"""Append-only capture of request/response pairs, and its replay.
+
+    python main.py --capture session.cap               # GUI, records as it runs
+    python -m stm32dc.service --ports COM9 --capture field.cap
+    python -m stm32dc.capture show session.cap
+    python -m stm32dc.capture replay session.cap --port COM9 [--max-rate]
+
+A LinkWorker given a CaptureWriter records every reply it matches (each
+attempt, retried ones too) and every request that finally timed out:
+
+    file    'STM32CAP' | version(8) | 7 reserved
+    record  time(f64) | rtt_us(32) | source | request type | response type | 0 |
+            request len(16) | response len(16) | request payload | response payload
+
+time is the Unix time the request was sent, rtt_us the round trip of that
+attempt, source the board's index in its pool, the request type as sent
+(PRIORITY_FLAG included) and the response type 0 for a timeout. Records
+are only ever appended, a short record at the end (the process died
+mid-write) is ignored. Capture maps the file and walks it without
+copying: payloads are memoryviews into the mapping.
+
+replay sends the requests again, at the original pace or all at once
+(--max-rate), and reports the responses that differ and both round trip
+distributions. CLASSIFY_PACKED DELTA frames refer to the image sent just
+before on their board; replayed over several boards or from the middle
+of a session they may answer ERR_PARAM.
+"""
+import argparse
+import mmap
+import os
+import struct
+import sys
+import threading
+import time
+from typing import NamedTuple
+
+from . import protocol
+from .timers import sleep_until
+
+MAGIC = b'STM32CAP'
+VERSION = 1
+FILE_HEADER = struct.Struct('<8sB7x')
+RECORD = struct.Struct('<dIBBBxHH')
+
+RESPONSE_NONE = 0
+
+CMD_NAMES = {value: name[4:] for name, value in vars(protocol).items() if name.startswith('CMD_')}
+
+
+class Record(NamedTuple):
+    time: float          # Unix time the request was sent
+    rtt: float           # seconds, 0 for a timeout
+    source: int          # board index in its pool
+    request_type: int    # as sent, PRIORITY_FLAG included
+    request: memoryview
+    response_type: int   # RESPONSE_NONE for a timeout
+    response: memoryview
+
+    @property
+    def command(self):
+        return self.request_type & ~protocol.PRIORITY_FLAG
+
+
+class CaptureWriter:
+    """Appends records to a capture file; safe to share between the workers of a pool"""
+
+    def __init__(self, path):
+        self.path = path
+        self.file = open(path, 'ab')
+        self.lock = threading.Lock()
+        self.count = 0
+        if self.file.tell() == 0:
+            self.file.write(FILE_HEADER.pack(MAGIC, VERSION))
+            self.file.flush()
+
+    def record(self, sent, rtt, source, request_type, request, response_type=RESPONSE_NONE,
+               response=b''):
+        head = RECORD.pack(sent, min(int(rtt * 1e6), 0xFFFFFFFF), source, request_type,
+                           response_type, len(request), len(response))
+        with self.lock:
+            if self.file.closed:
+                return
+            self.file.write(head)
+            self.file.write(request)
+            self.file.write(response)
+            # Flushed per record, a crash loses at most the one being written
+            self.file.flush()
+            self.count += 1
+
+    def close(self):
+        with self.lock:
+            self.file.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+
+class Capture:
+    """Records of a capture file, memory-mapped"""
+
+    def __init__(self, path):
+        self.path = path
+        with open(path, 'rb') as f:
+            size = os.fstat(f.fileno()).st_size
+            if size < FILE_HEADER.size:
+                raise ValueError(f"{path}: not a capture file")
+            self.data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        magic, version = FILE_HEADER.unpack_from(self.data)
+        if magic != MAGIC or version != VERSION:
+            raise ValueError(f"{path}: not a version {VERSION} capture file")
+        self.offsets = self._index()
+
+    def _index(self):
+        offsets, pos, end = [], FILE_HEADER.size, len(self.data)
+        while pos + RECORD.size <= end:
+            *_, request_len, response_len = RECORD.unpack_from(self.data, pos)
+            size = RECORD.size + request_len + response_len
+            if pos + size > end:
+                break
+            offsets.append(pos)
+            pos += size
+        return offsets
+
+    def __len__(self):
+        return len(self.offsets)
+
+    def __getitem__(self, index):
+        pos = self.offsets[index]
+        sent, rtt_us, source, request_type, response_type, request_len, response_len = \
+            RECORD.unpack_from(self.data, pos)
+        view = memoryview(self.data)
+        start = pos + RECORD.size
+        request = view[start:start + request_len]
+        response = view[start + request_len:start + request_len + response_len]
+        return Record(sent, rtt_us / 1e6, source, request_type, request, response_type, response)
+
+    def __iter__(self):
+        for i in range(len(self.offsets)):
+            yield self[i]
+
+
+def describe(record):
+    """One line on a record: request, response and round trip"""
+    name = CMD_NAMES.get(record.command, f'0x{record.command:02X}')
+    if record.response_type == RESPONSE_NONE:
+        outcome = "timeout"
+    elif record.response_type == protocol.TYPE_ERROR:
+        outcome = protocol.describe_error(bytes(record.response))
+    elif record.command in (protocol.CMD_CLASSIFY, protocol.CMD_CLASSIFY_PACKED,
+                            protocol.CMD_CLASSIFY_CROP) and len(record.response) == 1:
+        digit = record.response[0]
+        outcome = "blank" if digit == 0xFF else f"digit {digit}"
+    else:
+        outcome = f"{len(record.response)} B"
+    lane = " !" if record.request_type & protocol.PRIORITY_FLAG else ""
+    return (f"{name:<16}{lane:<3}{len(record.request):>5} B  {outcome:<24}"
+            f"{record.rtt * 1e3:>8.2f} ms  board {record.source}")
+
+
+def show(capture):
+    if not len(capture):
+        return "empty capture"
+    t0 = min(r.time for r in capture)
+    lines = [f"{(r.time - t0) * 1e3:>10.1f} ms  {describe(r)}" for r in capture]
+    lines.append(f"{len(capture)} records over {max(r.time for r in capture) - t0:.1f} s, "
+                 f"from {time.strftime('%Y-%m-%d %H:%M:%S', time.localtime(t0))}")
+    return "\n".join(lines)
+
+
+def replay(capture, worker, max_rate=False):
+    """Send every captured request again through a LinkWorker, in the order first sent
+
+    Records are in reply order, several boards' interleaved. Returns
+    (mismatches, timeouts, captured rtts, replayed rtts); a mismatch is
+    (index in send order, captured record, replayed response type, payload).
+    """
+    from .link import DeviceError
+    from .worker import BULK, INTERACTIVE
+
+    capture = sorted(capture, key=lambda r: r.time)
+    futures = []
+    t0, start = (capture[0].time if capture else 0.0), time.perf_counter()
+    for r in capture:
+        if not max_rate:
+            sleep_until(start + (r.time - t0))
+        # Requests captured without the priority bit go in the bulk lane
+        priority = INTERACTIVE if r.request_type & protocol.PRIORITY_FLAG else BULK
+        future = worker.submit(r.command, bytes(r.request), priority=priority)
+        future.sent = time.perf_counter()
+        future.add_done_callback(lambda f: setattr(f, 'done_at', time.perf_counter()))
+        futures.append(future)
+
+    mismatches, timeouts, replayed = [], 0, []
+    for i, (r, future) in enumerate(zip(capture, futures)):
+        try:
+            frame = future.result()
+            got = (frame.type, frame.payload)
+        except DeviceError as e:
+            got = (protocol.TYPE_ERROR, bytes((e.code,)))
+        except (TimeoutError, ConnectionError):
+            timeouts += 1
+            got = (RESPONSE_NONE, b'')
+        else:
+            replayed.append(future.done_at - future.sent)
+        want = (r.response_type, bytes(r.response))
+        # Only the error code of an ERROR frame is compared, its detail bytes vary
+        if got[0] == protocol.TYPE_ERROR and want[0] == protocol.TYPE_ERROR:
+            want, got = (want[0], want[1][:1]), (got[0], got[1][:1])
+        if got != want:
+            mismatches.append((i, r) + got)
+    captured = [r.rtt for r in capture if r.response_type != RESPONSE_NONE]
+    return mismatches, timeouts, captured, replayed
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    sub = ap.add_subparsers(dest='command', required=True)
+    p = sub.add_parser('show', help="list the records")
+    p.add_argument('capture')
+    p = sub.add_parser('replay', help="send the requests again and compare")
+    p.add_argument('capture')
+    p.add_argument('--port', required=True)
+    p.add_argument('--baud', type=int, default=921600)
+    p.add_argument('--rtscts', action='store_true')
+    p.add_argument('--max-rate', action='store_true',
+                   help="send everything at once instead of at the captured pace")
+    p.add_argument('--board', type=int, metavar='N', help="only the records of board N of a pool")
+    args = ap.parse_args(argv)
+
+    capture = Capture(args.capture)
+    if args.command == 'show':
+        print(show(capture))
+        return 0
+
+    from .bench import open_device, percentile
+    from .worker import LinkWorker
+
+    records = [r for r in capture if args.board is None or r.source == args.board]
+    conn, link, baud = open_device(args.port, args.baud, args.rtscts)
+    try:
+        with LinkWorker(link) as worker:
+            print(f"{args.port} @ {baud} baud, {len(records)} records"
+                  f"{', max rate' if args.max_rate else ', captured pace'}")
+            mismatches, timeouts, captured, replayed = replay(records, worker, args.max_rate)
+    finally:
+        conn.close()
+
+    for i, r, kind, payload in mismatches[:20]:
+        print(f"#{i:<6}{describe(r)}\n{'':<7}now {kind:#04x} {bytes(payload[:16]).hex()}")
+    for name, rtts in (("captured", captured), ("replayed", replayed)):
+        rtts = sorted(rtts)
+        print(f"{name:<14}p50 {percentile(rtts, 50) * 1e3:.2f} ms  "
+              f"p95 {percentile(rtts, 95) * 1e3:.2f} ms  p99 {percentile(rtts, 99) * 1e3:.2f} ms")
+    print(f"mismatches    {len(mismatches)} of {len(records)}")
+    print(f"timeouts      {timeouts}")
+    return 1 if mismatches else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
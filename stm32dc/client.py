@@ -0,0 +1,83 @@
+"""asyncio front end of the device link: awaitable requests, no Tk, no thread per request.
+
+    async with await AsyncClient.open(['COM9', 'COM10'], baud=921600) as client:
+        digit = await client.classify(image)
+        digits = await client.classify_many(images)
+        stats = await client.stats()          # {port: protocol.Stats}
+
+Framing, retries and pipelining stay in LinkWorker, spreading over boards
+in DevicePool; each board costs its worker's two threads however many
+requests are awaited. Their futures are bridged onto the running event
+loop, so thousands of coroutines can wait on one link. AsyncClient(backend)
+wraps a DevicePool or LinkWorker that is already open instead.
+"""
+import asyncio
+
+from .pool import DevicePool, LEAST_OUTSTANDING
+from .worker import BULK, INTERACTIVE, LinkWorker
+
+
+class AsyncClient:
+    """Coroutines over a DevicePool or a single LinkWorker"""
+
+    def __init__(self, backend):
+        self.backend = backend
+
+    @classmethod
+    async def open(cls, ports, baud, policy=LEAST_OUTSTANDING, rtscts=False, weights=None):
+        """Open, probe and start every port off the event loop (DevicePool.open)"""
+        loop = asyncio.get_running_loop()
+        pool = await loop.run_in_executor(
+            None, lambda: DevicePool.open(ports, baud, policy, rtscts=rtscts, weights=weights))
+        return cls(pool)
+
+    async def close(self):
+        """Stop the workers, failing what is still outstanding; closes a pool's ports"""
+        await asyncio.get_running_loop().run_in_executor(None, self.backend.close)
+
+    async def __aenter__(self):
+        return self
+
+    async def __aexit__(self, *exc):
+        await self.close()
+
+    @property
+    def workers(self):
+        if isinstance(self.backend, LinkWorker):
+            return [(self.backend.port.port, self.backend)]
+        return [(m.port, m.worker) for m in self.backend.members]
+
+    async def classify(self, image, priority=INTERACTIVE):
+        """Digit of one 28x28 uint8 image, None if the device found it blank"""
+        return await asyncio.wrap_future(self.backend.classify(bytes(image), priority=priority))
+
+    async def classify_packed(self, image, priority=INTERACTIVE):
+        """classify() with the image in its shortest encoding"""
+        return await asyncio.wrap_future(self.backend.classify_packed(bytes(image), priority=priority))
+
+    async def classify_topk(self, image, k=None, priority=INTERACTIVE):
+        """[(digit, probability)] best first"""
+        args = () if k is None else (k,)
+        return await asyncio.wrap_future(
+            self.backend.classify_topk(bytes(image), *args, priority=priority))
+
+    async def classify_many(self, images, priority=BULK, return_exceptions=False):
+        """Digits of images in order, all in flight at once as the boards' credits allow.
+
+        The first failure is raised, or with return_exceptions it takes
+        that image's place in the list (asyncio.gather).
+        """
+        futures = [asyncio.wrap_future(self.backend.classify(bytes(img), priority=priority))
+                   for img in images]
+        return await asyncio.gather(*futures, return_exceptions=return_exceptions)
+
+    async def stats(self, reset=False):
+        """{port: protocol.Stats} of every board (firmware built with APP_STATS)"""
+        workers = self.workers
+        results = await asyncio.gather(
+            *(asyncio.wrap_future(worker.stats(reset)) for _, worker in workers))
+        return {str(port): stats for (port, _), stats in zip(workers, results)}
+
+    def health(self):
+        """DevicePool.health() of a pool, [] for a single worker"""
+        return [] if isinstance(self.backend, LinkWorker) else self.backend.health()
@@ -0,0 +1,178 @@
+"""Device clock fit and per-request latency breakdown (APP_TIMESTAMPS).
+
+    clock = ClockSync()
+    clock.sync(link)                 # fits the clock, turns reply stamping on
+    with LinkWorker(link, clock=clock) as worker:
+        for img in images:
+            worker.classify(img).result()
+        worker.clock_sync().result()     # refit, the clocks drift apart
+        print(breakdown_report(worker.timings))
+
+    python -m stm32dc.bench --port COM9 --breakdown --pipeline --count 1000
+
+CLOCK_SYNC returns the device's microsecond clock when the request's last
+byte was parsed (t1) and when the reply was framed (t2). With the host's
+perf_counter at the write (t0) and at the decoded reply (t3), the sample's
+offset is ((t1 - t0) + (t2 - t3)) / 2, exact when both directions take
+equally long, and its delay (t3 - t0) - (t2 - t1) bounds the error to half
+of it. ClockSync keeps the last WINDOW samples and fits offset and drift
+through the quarter with the smallest delay: a sample that waited behind
+an inference or in an OS buffer has a large delay and drops out. The fit
+only takes CLOCK_SYNC exchanges, whose frames are short both ways; an
+image request's uplink is far longer than its reply and would bias it.
+
+Replies stamped by the device carry the same clock at the request's
+arrival, at the start of its processing, its network time and the reply.
+With the host's own times each request splits into
+
+    host_queue    submit() to the write, waiting for credits
+    uplink        write to the device parsing the last byte (wire time)
+    device_queue  parsed to taken from the ready queue
+    inference     network runs
+    device        the rest of the processing: preprocessing, argmax, framing
+    downlink      framed to the host decoding the reply (wire time, OS)
+    host_parse    decoded to the future resolved (decode())
+
+uplink and downlink cross the two clocks and carry the fit's error,
+ClockSync.uncertainty; the device terms and the host terms are each on a
+single clock. The parts add up to the request's latency.
+"""
+import threading
+from collections import deque
+from typing import NamedTuple
+
+from . import protocol
+
+# CLOCK_SYNC exchanges per sync()
+ROUNDS = 16
+# Samples the fit looks at, and the share of them with the lowest delay it uses
+WINDOW = 64
+BEST = 0.25
+# Host seconds the fitted samples must span before a drift is fitted
+MIN_SPAN = 2.0
+
+WRAP = 1 << 32
+
+PARTS = ('host_queue', 'uplink', 'device_queue', 'inference', 'device', 'downlink', 'host_parse')
+
+
+class Timing(NamedTuple):
+    cmd: int             # request type
+    host_queue: float    # seconds, PARTS
+    uplink: float
+    device_queue: float
+    inference: float
+    device: float
+    downlink: float
+    host_parse: float
+    total: float         # submit() to resolved
+
+
+class ClockSync:
+    """Maps the device's microsecond stamps onto time.perf_counter()"""
+
+    def __init__(self, window=WINDOW):
+        self.lock = threading.Lock()
+        self.samples = deque(maxlen=window)  # (host mid, offset, delay) in seconds
+        self.ref = None                      # (raw us, unwrapped seconds) of the newest stamp
+        self.mid = 0.0                       # host time the fit is centred on
+        self.offset = None                   # device - host seconds at mid
+        self.skew = 0.0                      # device seconds gained per host second
+        self.cpu_hz = 0
+
+    def device_seconds(self, us):
+        """A 32-bit microsecond stamp as continuous device seconds (holds self.lock)"""
+        if self.ref is None:
+            self.ref = (us, us * 1e-6)
+            return us * 1e-6
+        raw, seconds = self.ref
+        d = (us - raw + WRAP // 2) % WRAP - WRAP // 2
+        value = seconds + d * 1e-6
+        if d > 0:
+            self.ref = (us, value)
+        return value
+
+    def add(self, sent, received, rx_us, tx_us):
+        """Fit one exchange: host perf_counter at write and decoded reply, device stamps"""
+        with self.lock:
+            t1 = self.device_seconds(rx_us)
+            t2 = self.device_seconds(tx_us)
+            self.samples.append(((sent + received) / 2, ((t1 - sent) + (t2 - received)) / 2,
+                                 (received - sent) - (t2 - t1)))
+            self._fit()
+
+    def _fit(self):
+        best = sorted(self.samples, key=lambda s: s[2])[:max(2, int(len(self.samples) * BEST))]
+        mids = [s[0] for s in best]
+        if len(best) < 2 or max(mids) - min(mids) < MIN_SPAN:
+            self.mid, self.offset, _ = best[0]
+            return
+        # Least squares offset = offset(mid) + skew * (host - mid)
+        mid = sum(mids) / len(mids)
+        mean = sum(s[1] for s in best) / len(best)
+        var = sum((m - mid) ** 2 for m in mids)
+        self.skew = sum((s[0] - mid) * (s[1] - mean) for s in best) / var
+        self.mid, self.offset = mid, mean
+
+    @property
+    def synced(self):
+        return self.offset is not None
+
+    @property
+    def uncertainty(self):
+        """Seconds either way a mapped stamp may be off: half the smallest delay"""
+        with self.lock:
+            return min(s[2] for s in self.samples) / 2 if self.samples else None
+
+    def to_host(self, us):
+        """perf_counter() seconds of a device stamp"""
+        with self.lock:
+            return self._to_host(self.device_seconds(us))
+
+    def _to_host(self, seconds):
+        # seconds = host + offset + skew * (host - mid)
+        return (seconds - self.offset + self.skew * self.mid) / (1.0 + self.skew)
+
+    def sync(self, link, rounds=ROUNDS, stamp=True):
+        """CLOCK_SYNC rounds times over a ClassifierLink the worker does not own yet
+
+        stamp turns the device's reply stamping on or off. Returns the
+        uncertainty in seconds.
+        """
+        for _ in range(rounds):
+            sent, received, reply = link.clock_sync(protocol.SYNC_STAMP if stamp else 0)
+            self.cpu_hz = reply.cpu_hz
+            self.add(sent, received, reply.rx_us, reply.tx_us)
+        return self.uncertainty
+
+    def breakdown(self, cmd, queued, sent, received, parsed, stamp):
+        """Timing of one request from its host times and the reply's protocol.Stamp"""
+        with self.lock:
+            rx = self.device_seconds(stamp.rx_us)
+            start = self.device_seconds(stamp.start_us)
+            tx = self.device_seconds(stamp.tx_us)
+            rx_host = self._to_host(rx)
+            tx_host = self._to_host(tx)
+        inference = stamp.run_us * 1e-6
+        return Timing(cmd, sent - queued, rx_host - sent, start - rx, inference, tx - start - inference,
+                      received - tx_host, parsed - received, parsed - queued)
+
+
+def breakdown_report(timings, uncertainty=None):
+    """p50/p95/max of each part over Timings, and its share of the mean latency"""
+    from .bench import percentile
+
+    timings = list(timings)
+    if not timings:
+        return "breakdown     no stamped replies (APP_TIMESTAMPS, CLOCK_SYNC)"
+    total = sum(t.total for t in timings) or 1.0
+    lines = [f"{'part':<13} {'p50 ms':>8} {'p95 ms':>8} {'max ms':>8} {'share':>6}"]
+    for part in PARTS + ('total',):
+        values = sorted(getattr(t, part) for t in timings)
+        share = sum(values) / total * 100
+        lines.append(f"{part:<13} {percentile(values, 50) * 1e3:>8.3f} {percentile(values, 95) * 1e3:>8.3f} "
+                     f"{values[-1] * 1e3:>8.3f} {share:>5.1f}%")
+    if uncertainty is not None:
+        lines.append(f"clock fit     +/- {uncertainty * 1e3:.3f} ms on uplink and downlink, "
+                     f"{len(timings)} requests")
+    return '\n'.join(lines)
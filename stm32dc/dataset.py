@@ -0,0 +1,137 @@
+"""Memory-mapped image datasets: EMNIST/MNIST IDX files and uint8 .npy arrays.
+
+    images = Dataset('emnist-digits-test-images-idx3-ubyte')
+    labels = load_labels('emnist-digits-test-labels-idx1-ubyte')
+    futures = [pool.classify(img) for img in images]
+
+The file is mapped, not read: opening the 40k image EMNIST-digits test
+split costs a header parse, and pages are faulted in as the boards take
+them. Items are 784 B bytes-like images in drawing orientation, which
+the pool, batcher and workers take as they are:
+
+- .npy arrays (and IDX files opened with transposed=False) are stored as
+  drawn, an item is a memoryview into the mapping, no copy;
+- EMNIST IDX images are stored transposed, an item is the upright image
+  gathered from the mapping by 28 strided slices (on the C side), the one
+  copy the request payload needs anyway.
+
+Slicing gives another Dataset over the same mapping. No numpy is needed;
+.npy files of another dtype are converted through numpy into memory.
+"""
+import ast
+import mmap
+import struct
+from collections.abc import Sequence
+
+SIDE = 28
+IMAGE_SIZE = SIDE * SIDE
+
+NPY_MAGIC = b'\x93NUMPY'
+
+
+def _product(dims):
+    count = 1
+    for d in dims:
+        count *= d
+    return count
+
+
+def _map(path):
+    with open(path, 'rb') as f:
+        return mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+
+
+def _idx_header(mm, path):
+    """(dims, offset of the data) of an unsigned byte IDX file"""
+    if len(mm) < 4:
+        raise ValueError(f"{path}: not an IDX file")
+    zero, dtype, ndim = struct.unpack_from('>HBB', mm)
+    if zero != 0 or dtype != 0x08:
+        raise ValueError(f"{path}: only unsigned byte IDX files are supported")
+    dims = struct.unpack_from('>' + 'I' * ndim, mm, 4)
+    offset = 4 + 4 * ndim
+    if len(mm) < offset + _product(dims):
+        raise ValueError(f"{path}: truncated, {dims} needs {offset + _product(dims)} B")
+    return dims, offset
+
+
+def _npy_header(mm, path):
+    """(dtype, fortran order, shape, offset of the data) of a .npy file"""
+    if mm[:len(NPY_MAGIC)] != NPY_MAGIC:
+        raise ValueError(f"{path}: not a .npy file")
+    major = mm[6]
+    if major == 1:
+        (size,), start = struct.unpack_from('<H', mm, 8), 10
+    else:
+        (size,), start = struct.unpack_from('<I', mm, 8), 12
+    header = ast.literal_eval(mm[start:start + size].decode('latin1'))
+    return header['descr'], header['fortran_order'], tuple(header['shape']), start + size
+
+
+class Dataset(Sequence):
+    """28x28 uint8 images of an IDX or .npy file, memory-mapped"""
+
+    def __init__(self, path, transposed=None):
+        """transposed: images stored transposed, by default True for IDX (EMNIST), False for .npy"""
+        self.path = path
+        npy = str(path).endswith('.npy')
+        self.transposed = (not npy) if transposed is None else transposed
+        mm = _map(path)
+        if not npy:
+            dims, offset = _idx_header(mm, path)
+        else:
+            descr, fortran, dims, offset = _npy_header(mm, path)
+            if descr not in ('|u1', '<u1', '>u1') or fortran:
+                import numpy as np
+                mm.close()
+                arr = np.load(path).astype('uint8').reshape(-1, IMAGE_SIZE)
+                mm, offset = arr.tobytes(), 0
+        if len(dims) < 2 or _product(dims) != IMAGE_SIZE * dims[0]:
+            raise ValueError(f"{path}: {dims} are not 28x28 images")
+        if len(mm) < offset + _product(dims):
+            raise ValueError(f"{path}: truncated, {dims} needs {offset + _product(dims)} B")
+        self.data = mm
+        self.offset = offset
+        self.indices = range(dims[0])
+
+    def _view(self, indices):
+        view = object.__new__(Dataset)
+        view.__dict__.update(self.__dict__, indices=indices)
+        return view
+
+    def __len__(self):
+        return len(self.indices)
+
+    def __getitem__(self, index):
+        if isinstance(index, slice):
+            return self._view(self.indices[index])
+        start = self.offset + self.indices[index] * IMAGE_SIZE
+        if not self.transposed:
+            return memoryview(self.data)[start:start + IMAGE_SIZE]
+        # Row r of the upright image is column r of the stored one
+        end = start + IMAGE_SIZE
+        return b''.join([self.data[start + r:end:SIDE] for r in range(SIDE)])
+
+    def __iter__(self):
+        for i in range(len(self.indices)):
+            yield self[i]
+
+    def close(self):
+        """Unmap the file; items still held as memoryviews must be released first"""
+        if isinstance(self.data, mmap.mmap):
+            self.data.close()
+
+
+def load_labels(path):
+    """Labels of an IDX1 file (or a uint8 .npy vector) as a list of ints"""
+    mm = _map(path)
+    try:
+        if str(path).endswith('.npy'):
+            _, _, shape, offset = _npy_header(mm, path)
+            return list(mm[offset:offset + shape[0]])
+        dims, offset = _idx_header(mm, path)
+        if len(dims) != 1:
+            raise ValueError(f"{path}: not a label file, dims {dims}")
+        return list(mm[offset:offset + dims[0]])
+    finally:
+        mm.close()
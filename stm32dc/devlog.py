@@ -0,0 +1,76 @@
+"""Print the APP_LOG records of the device, formatted on the host.
+
+    python -m stm32dc.devlog --port COM9
+    python -m stm32dc.devlog --port COM9 --follow 0.5
+
+The device stores a token and two raw arguments per event (tinyML/Core/Inc/
+log.h), never the text. The format strings are read from the LOG_EVENTS
+list of that header, so the tool always matches the firmware source tree
+given with --header.
+"""
+import argparse
+import os
+import re
+import sys
+import time
+
+DEFAULT_HEADER = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))),
+                              'tinyML', 'Core', 'Inc', 'log.h')
+
+_EVENT = re.compile(r'X\((LOG_\w+),\s*"((?:[^"\\]|\\.)*)"\)')
+_SPEC = re.compile(r'%[-0-9]*([udxX])')
+
+
+def load_formats(path=DEFAULT_HEADER):
+    """[(token name, format string)] in token order"""
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+    start = text.find('#define LOG_EVENTS(X)')
+    if start < 0:
+        raise ValueError(f"{path}: no LOG_EVENTS list")
+    return _EVENT.findall(text[start:text.find('\n\n', start)])
+
+
+def format_record(record, formats):
+    """One line for a protocol.LogRecord"""
+    if record.id >= len(formats):
+        return f"{record.tick / 1000:10.3f}  token {record.id} {record.args[0]:#x} {record.args[1]:#x}"
+    name, fmt = formats[record.id]
+    args = []
+    for spec, value in zip(_SPEC.findall(fmt), record.args):
+        args.append(value - (1 << 32) if spec == 'd' and value & 0x80000000 else value)
+    return f"{record.tick / 1000:10.3f}  {fmt % tuple(args)}"
+
+
+def main(argv=None):
+    from .bench import open_device
+    from .link import DEFAULT_BAUD
+
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--port', required=True)
+    ap.add_argument('--baud', type=int, default=DEFAULT_BAUD)
+    ap.add_argument('--header', default=DEFAULT_HEADER, help="log.h of the running firmware")
+    ap.add_argument('--follow', type=float, metavar='SECONDS',
+                    help="keep polling at this interval until Ctrl-C")
+    args = ap.parse_args(argv)
+
+    formats = load_formats(args.header)
+    conn, link, _ = open_device(args.port, args.baud)
+    try:
+        while True:
+            records, lost = link.log()
+            if lost:
+                print(f"{'':10}  ({lost} records lost, the ring was full)")
+            for record in records:
+                print(format_record(record, formats))
+            if args.follow is None:
+                return 0
+            time.sleep(args.follow)
+    except KeyboardInterrupt:
+        return 0
+    finally:
+        conn.close()
+
+
+if __name__ == '__main__':
+    sys.exit(main())
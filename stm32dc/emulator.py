@@ -0,0 +1,728 @@
+"""Emulated boards speaking the wire protocol, for load-testing the host without a rack of them.
+
+    python -m stm32dc.emulator --boards 100 --ports-file ports.txt       # tcp://localhost:7000 to :7099
+    python -m stm32dc.bench --ports $(cat ports.txt) --count 20000
+    python -m stm32dc.emulator --boards 8 --run-us 3100 9800 --baud 2000000
+    python -m stm32dc.emulator --boards 4 --pty --stall 0.01             # pseudo-terminals, stragglers
+
+Each board listens on its own TCP port, which the rest of stm32dc takes
+as a tcp:// port (stm32dc.bridge), or with --pty (POSIX) on a
+pseudo-terminal that pyserial opens like a board's serial port; Windows
+has no pty, the tcp:// ports serve there. The boards share an event loop,
+or with --processes one per process. Their timings hold while it keeps
+up: a loop running more than LAG_WARN late is reported, and then more
+processes are needed (a hundred boards at full load want several cores,
+the host under test a few more).
+
+A board answers as firmware built with APP_PROFILE, APP_STATS,
+APP_TELEMETRY and APP_CANCEL: PING (credits, a unique ID of its own, the
+registered models), CLASSIFY, CLASSIFY_PACKED (all encodings but
+STROKES), CLASSIFY_TOPK, CLASSIFY_PROF, BATCH, STATS, TELEMETRY (pushes
+every interval and after an ERR_BUSY, no busy share), SELECT_MODEL,
+SET_BAUD, SET_CLOCK and CANCEL, with PRIORITY_FLAG requests queued first.
+
+The rest of the protocol is not emulated, and each of these commands
+answers ERR_TYPE, as from a build without it (UNSUPPORTED, also in --help):
+PROFILE, CLASSIFY_CROP, MEMSTAT, CLASSIFY_CASCADE, KERNEL_BENCH, FLASH,
+SELFTEST, LOG, UPLOAD, STAGE, STRIP, EMBED, KNN, CONFIG, WCET, ENERGY,
+NN_BENCH, IRQ_LATENCY, HEADS, CLASSIFY_SMALL, CLASSIFY_ANYTIME,
+CLOCK_SYNC and CLASSIFY_TTA. Host code built on them needs a board.
+
+Timing follows the board. A request's bytes arrive at 10 bits a byte at
+the line rate, then wait for the core, which runs one request at a time:
+an inference takes PRE_US, the active model's --run-us (at the 96 MHz
+boot clock, longer after SET_CLOCK to a slower profile) and ARGMAX_US,
+anything else CMD_US. The reply goes out at the line rate behind the one
+before it. Frames beyond the RX_SLOTS slots wait in the RX_RING ring while
+it has room and get ERR_BUSY past it, which is what the credits in the
+PING reply promise. --jitter spreads run times, --stall makes a run take
+STALL_FACTOR times as long (a straggler to hedge against) and --loss
+loses a reply on the line. With --admission the board answers as
+APP_ADMISSION firmware: no ring in the credits, and a frame finding every
+slot taken (BATCH_IMAGE apart) gets ERR_BUSY with the frames ahead and a
+retry-after once the running frame is done.
+
+Classes and TOPK scores come from the .tflite (reference.ReferenceModel,
+--reference) or the generated network.c (netref.NetworkModel, --network),
+so they are the board's to the byte; every registered model computes with
+it and only their run times differ. Without numpy or a TFLite interpreter
+a stand-in derived from a hash of the image gives repeatable classes that
+mean nothing.
+"""
+import argparse
+import asyncio
+import hashlib
+import os
+import random
+import socket
+import struct
+import sys
+from collections import deque
+from typing import NamedTuple
+
+from . import protocol
+from .link import BYTE_BITS, IMAGE_SIZE, DeviceError
+
+FIRST_PORT = 7000
+BAUD = 921600
+# Network run per registered model at BOOT_HZ, us
+RUN_US = (3000,)
+PRE_US = 40
+ARGMAX_US = 2
+CMD_US = 15
+STALL_FACTOR = 10.0
+BOOT_HZ = 96000000
+# HCLK per SET_CLOCK profile (clock.c): performance, balanced, low-power
+CLOCK_HZ = (100000000, 48000000, 8000000)
+# A lone UART link's slots and its receive DMA ring (main.c)
+RX_SLOTS = 2
+RX_RING = 4096
+# Shortest retry-after of a refusal (admission.h)
+ADMISSION_MIN_US = 1000
+FW_VERSION = 0x0100
+SLOW_BAUD = 1200
+FAST_BAUD = 12000000
+# APP_TELEMETRY_ERRORS and APP_TELEMETRY_MIN_MS of the firmware's defaults
+TELEMETRY_ERRORS = 1
+TELEMETRY_MIN_MS = 100
+# Event loop lateness checked every LAG_PERIOD seconds, reported past LAG_WARN
+LAG_PERIOD = 0.1
+LAG_WARN = 0.005
+# Seconds for every --processes process to load its model and listen
+START_TIMEOUT = 60.0
+
+
+class Request(NamedTuple):
+    cmd: int          # PRIORITY_FLAG taken off
+    seq: int
+    payload: bytes
+    urgent: bool
+    size: int         # bytes on the line
+    at: float         # loop time its last byte arrived
+
+
+class StandIn:
+    """Repeatable classes and int8 scores from a hash of the image, where no model loads"""
+
+    kind = 'stand-in'
+    scale = 1 / 256
+    zero_point = -128
+    num_classes = 10
+
+    def scores(self, image):
+        return [b - 128 for b in hashlib.blake2b(bytes(image), digest_size=self.num_classes).digest()]
+
+    def classify(self, image):
+        scores = self.scores(image)
+        return scores.index(max(scores))
+
+
+def load_model(reference=None, network=None):
+    """netref.NetworkModel of network, else reference.ReferenceModel of reference, else StandIn"""
+    if network:
+        from .netref import NetworkModel
+        return NetworkModel(network)
+    if reference and os.path.exists(reference):
+        from .reference import ReferenceModel
+        try:
+            return ReferenceModel(reference)
+        except (ImportError, SystemExit) as e:  # numpy, or every interpreter, missing
+            print(f"{reference}: {e}, classes from a stand-in")
+    return StandIn()
+
+
+def _bitmap(data):
+    """Pixel indices a bitmap of IMAGE_SIZE bits marks, in order"""
+    bits = int.from_bytes(data, 'little')
+    return [i for i in range(IMAGE_SIZE) if bits >> i & 1]
+
+
+def unpack_image(payload, prev, prev_tag):
+    """(image, tag) from a CLASSIFY_PACKED payload, prev the last one unpacked (image_pack.c)"""
+    if len(payload) < 2:
+        raise DeviceError(protocol.ERR_LENGTH)
+    kind, tag, body = payload[0], payload[1], payload[2:]
+    bitmap = IMAGE_SIZE // 8
+    if kind == protocol.PACK_RAW:
+        image = bytearray(body)
+    elif kind == protocol.PACK_ZRLE:
+        image = bytearray()
+        i = 0
+        while i < len(body):
+            if body[i]:
+                image.append(body[i])
+                i += 1
+            elif i + 1 < len(body):
+                image += bytes(body[i + 1])
+                i += 2
+            else:
+                raise DeviceError(protocol.ERR_LENGTH)
+    elif kind in (protocol.PACK_BITMAP, protocol.PACK_DELTA):
+        if kind == protocol.PACK_DELTA:
+            if prev is None or not body or body[0] != prev_tag:
+                raise DeviceError(protocol.ERR_PARAM)
+            image, body = bytearray(prev), body[1:]
+        else:
+            image = bytearray(IMAGE_SIZE)
+        marked = _bitmap(body[:bitmap])
+        if len(body) != bitmap + len(marked):
+            raise DeviceError(protocol.ERR_LENGTH)
+        for i, value in zip(marked, body[bitmap:]):
+            image[i] = value
+    elif kind == protocol.PACK_BITS1:
+        if len(body) != bitmap:
+            raise DeviceError(protocol.ERR_LENGTH)
+        image = bytearray(IMAGE_SIZE)
+        for i in _bitmap(body):
+            image[i] = 255
+    elif kind == protocol.PACK_BITS4:
+        if len(body) != IMAGE_SIZE // 2:
+            raise DeviceError(protocol.ERR_LENGTH)
+        image = bytearray(IMAGE_SIZE)
+        image[0::2] = bytes((b & 0x0F) * 17 for b in body)
+        image[1::2] = bytes((b >> 4) * 17 for b in body)
+    else:
+        raise DeviceError(protocol.ERR_PARAM)  # STROKES among them
+    if len(image) != IMAGE_SIZE:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return bytes(image), tag
+
+
+def _bucket(cycles):
+    return min(protocol.STATS_BUCKETS - 1, max(0, int(cycles).bit_length() - 1))
+
+
+class Board:
+    """One emulated board: its line, slots, core and counters on the event loop"""
+
+    def __init__(self, index, model, run_us=RUN_US, baud=BAUD, jitter=0.0, stall=0.0, loss=0.0, seed=0,
+                 admission=False):
+        self.loop = asyncio.get_running_loop()
+        self.model = model
+        self.run_us = tuple(run_us)
+        self.baud = baud
+        self.baud_next = 0          # SET_BAUD rate, switched to once its ack is out
+        self.jitter = jitter
+        self.stall = stall
+        self.loss = loss
+        self.admission = admission
+        self.rng = random.Random(f'{seed}:{index}')
+        self.uid = hashlib.blake2b(f'emulated board {index}'.encode(), digest_size=12).digest()
+        self.hashes = [hashlib.blake2b(f'{model.kind} model {i}'.encode(), digest_size=16).digest()
+                       for i in range(len(self.run_us))]
+        self.active = 0
+        self.hz = BOOT_HZ
+        self.send = None            # the connection's write, None while none is open
+        self.reader = protocol.FrameReader()
+        self.rx_free = 0.0          # loop time the line has delivered what was written so far
+        self.tx_free = 0.0
+        self.last_tx = 0.0          # seconds the previous reply took on the line
+        self.slots = 0              # requests queued or running
+        self.urgent = deque()
+        self.queue = deque()
+        self.ring = deque()         # requests waiting for a slot
+        self.ring_bytes = 0
+        self.refused = []           # seqs refused for want of a slot, answered after the running frame
+        self.running = None         # (Request, TimerHandle)
+        self.batch = None           # (seq, results, indices seen) while a BATCH is open
+        self.packed = (None, 0)     # last CLASSIFY_PACKED image and its tag
+        self.started = self.loop.time()
+        self.telemetry = 0          # TELEMETRY interval, ms
+        self.telemetry_timer = None
+        self.telemetry_number = 0
+        self.reset_stats()
+        self.telemetry_base = self._counts()    # what the last telemetry frame counted to
+
+    def reset_stats(self):
+        self.frames = self.inferences = self.dropped = 0
+        self.crc_base = self.reader.crc_errors
+        self.run_hist = [0] * protocol.STATS_BUCKETS
+        self.frame_hist = [0] * protocol.STATS_BUCKETS
+
+    # Line in
+
+    def received(self, data):
+        now = self.loop.time()
+        self.reader.feed(data)
+        while True:
+            frame = self.reader.next_frame()
+            if frame is None:
+                return
+            size = protocol.OVERHEAD + len(frame.payload)
+            self.rx_free = max(now, self.rx_free) + size * BYTE_BITS / self.baud
+            self.loop.call_at(self.rx_free, self._arrive, frame, size)
+
+    def _arrive(self, frame, size):
+        self.frames += 1
+        req = Request(frame.type & ~protocol.PRIORITY_FLAG, frame.seq, frame.payload,
+                      bool(frame.type & protocol.PRIORITY_FLAG), size, self.loop.time())
+        if req.cmd == protocol.CMD_CANCEL:
+            self._cancel(req)
+        elif self.slots < RX_SLOTS:
+            self._admit(req)
+        elif self.admission and req.cmd != protocol.CMD_BATCH_IMAGE:
+            self.dropped += 1
+            self.refused.append(req.seq)
+        elif self.ring_bytes + size <= RX_RING:
+            self.ring.append(req)
+            self.ring_bytes += size
+        else:
+            self.dropped += 1
+            self._error(req.seq, protocol.ERR_BUSY)
+            self._telemetry_errors()
+
+    def _admit(self, req):
+        self.slots += 1
+        (self.urgent if req.urgent else self.queue).append(req)
+        self._next()
+
+    def _cancel(self, req):
+        """CANCEL: the request with the seq in its payload fails ERR_CANCELLED, unless already answered"""
+        if len(req.payload) != 1:
+            self._error(req.seq, protocol.ERR_LENGTH)
+            return
+        target = req.payload[0]
+        for waiting in (self.urgent, self.queue, self.ring):
+            for r in waiting:
+                if r.seq == target and r.cmd != protocol.CMD_BATCH_IMAGE:
+                    waiting.remove(r)
+                    if waiting is self.ring:
+                        self.ring_bytes -= r.size
+                    else:
+                        self.slots -= 1
+                    self._error(r.seq, protocol.ERR_CANCELLED)
+                    break
+        if self.running and self.running[0].seq == target:
+            # As the firmware, the run goes to its end and its result is dropped
+            running, timer = self.running
+            timer.cancel()
+            self.running = (running, self.loop.call_at(timer.when(), self._done, running,
+                                                       (protocol.TYPE_ERROR, target, bytes((protocol.ERR_CANCELLED,)))))
+        self._reply(protocol.response_type(protocol.CMD_CANCEL), req.seq)
+
+    # Core
+
+    def _next(self):
+        if self.running or not (self.urgent or self.queue):
+            return
+        req = (self.urgent or self.queue).popleft()
+        try:
+            us, reply = self._process(req)
+        except DeviceError as e:
+            us, reply = CMD_US, (protocol.TYPE_ERROR, req.seq, bytes((e.code,)))
+        self.running = (req, self.loop.call_later(us / 1e6, self._done, req, reply))
+
+    def _done(self, req, reply):
+        self.running = None
+        self.frame_hist[_bucket((self.loop.time() - req.at) * self.hz)] += 1
+        if reply is not None:
+            self._reply(*reply)
+        if self.refused:
+            self._refuse()
+        if self.baud_next:
+            # SET_BAUD, acked at the old rate
+            self.baud, self.baud_next = self.baud_next, 0
+        self._free()
+
+    def _refuse(self):
+        """ERR_BUSY with the frames ahead and how long they take, as APP_ADMISSION sends it"""
+        frame_us = PRE_US + self.run_us[self.active] * BOOT_HZ / self.hz + ARGMAX_US
+        # The running frame is done, its slot not yet free
+        ahead = self.slots - 1
+        retry_us = max(ADMISSION_MIN_US, round(ahead * frame_us))
+        for seq in self.refused:
+            self._reply(protocol.TYPE_ERROR, seq, protocol.BUSY.pack(protocol.ERR_BUSY, ahead, retry_us))
+        self.refused = []
+        self._telemetry_errors()
+
+    def _free(self):
+        self.slots -= 1
+        while self.ring and self.slots < RX_SLOTS:
+            req = self.ring.popleft()
+            self.ring_bytes -= req.size
+            self._admit(req)
+        self._next()
+
+    def _run(self, image):
+        """(us, int8 scores) of one inference on the active model"""
+        self.inferences += 1
+        us = self.run_us[self.active] * BOOT_HZ / self.hz
+        if self.jitter:
+            us *= max(0.0, self.rng.gauss(1.0, self.jitter))
+        if self.stall and self.rng.random() < self.stall:
+            us *= STALL_FACTOR
+        self.run_hist[_bucket(us * self.hz / 1e6)] += 1
+        return us, [int(s) for s in self.model.scores(image)]
+
+    def _classify(self, image):
+        us, scores = self._run(image)
+        return PRE_US + us + ARGMAX_US, scores.index(max(scores))
+
+    def _process(self, req):
+        """(us the core takes, (type, seq, payload) of the reply or None)"""
+        handler = self.HANDLERS.get(req.cmd)
+        if handler is None:
+            raise DeviceError(protocol.ERR_TYPE)
+        us, payload = handler(self, req)
+        if payload is None:
+            return us, None
+        if isinstance(payload, tuple):
+            return us, payload
+        return us, (protocol.response_type(req.cmd), req.seq, payload)
+
+    def _image(self, req):
+        if len(req.payload) != IMAGE_SIZE:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return req.payload
+
+    def _on_classify(self, req):
+        us, digit = self._classify(self._image(req))
+        return us, bytes((digit,))
+
+    def _on_packed(self, req):
+        image, tag = unpack_image(req.payload, *self.packed)
+        self.packed = (image, tag)
+        us, digit = self._classify(image)
+        return us, bytes((digit,))
+
+    def _on_profiled(self, req):
+        us, scores = self._run(self._image(req))
+        cycles = [round(t * self.hz / 1e6) for t in (PRE_US, us, ARGMAX_US, self.last_tx * 1e6)]
+        return PRE_US + us + ARGMAX_US, protocol.PROFILE.pack(scores.index(max(scores)), self.hz, *cycles, 0, 0)
+
+    def _on_topk(self, req):
+        if len(req.payload) not in (IMAGE_SIZE, IMAGE_SIZE + 1):
+            raise DeviceError(protocol.ERR_LENGTH)
+        k = req.payload[IMAGE_SIZE] if len(req.payload) > IMAGE_SIZE else protocol.TOPK_DEFAULT
+        if not 1 <= k <= min(protocol.TOPK_MAX, self.model.num_classes):
+            raise DeviceError(protocol.ERR_PARAM)
+        us, scores = self._run(req.payload[:IMAGE_SIZE])
+        ranked = sorted(range(len(scores)), key=lambda c: (-scores[c], c))[:k]
+        body = b''.join(struct.pack('<Bb', c, scores[c]) for c in ranked)
+        return PRE_US + us + ARGMAX_US, \
+            protocol.TOPK_HEADER.pack(self.model.scale, self.model.zero_point, k) + body
+
+    def _on_batch(self, req):
+        if len(req.payload) != 1 or req.payload[0] == 0:
+            raise DeviceError(protocol.ERR_LENGTH)
+        self.batch = (req.seq, bytearray([protocol.CLASS_NONE]) * req.payload[0], set())
+        return CMD_US, None
+
+    def _on_batch_image(self, req):
+        us, digit = CMD_US, protocol.CLASS_NONE
+        if len(req.payload) == IMAGE_SIZE:
+            us, digit = self._classify(req.payload)
+        if self.batch is None:
+            return us, None
+        seq, results, seen = self.batch
+        if req.seq >= len(results) or req.seq in seen:
+            return us, None
+        results[req.seq] = digit
+        seen.add(req.seq)
+        if len(seen) < len(results):
+            return us, None
+        self.batch = None
+        return us, (protocol.response_type(protocol.CMD_BATCH), seq, bytes(results))
+
+    def _on_ping(self, req):
+        h, w, c = 28, 28, 1
+        features = protocol.FEAT_PRIORITY | protocol.FEAT_CANCEL
+        return CMD_US, (protocol.CAPS.pack(protocol.PROTOCOL_VERSION, protocol.CAP_PROFILE, protocol.MAX_PAYLOAD,
+                                           h, w, c, self.model.num_classes, self.hashes[self.active]) +
+                        protocol.CAPS_CREDITS.pack(RX_SLOTS, features, 0 if self.admission else RX_RING) +
+                        protocol.CAPS_IDENTITY.pack(self.uid, FW_VERSION, self.active, len(self.hashes)))
+
+    def _on_stats(self, req):
+        if len(req.payload) > 1:
+            raise DeviceError(protocol.ERR_LENGTH)
+        uptime_ms = round((self.loop.time() - self.started) * 1e3) & 0xFFFFFFFF
+        hists = [min(n, 0xFFFF) for n in self.run_hist + self.frame_hist]
+        payload = protocol.STATS.pack(self.hz, uptime_ms, self.frames, self.inferences, 0,
+                                      self.reader.crc_errors - self.crc_base, self.dropped, 0, 0, 0, 0,
+                                      1, 0, 0, 0, 0, 0, *hists, 0, *(0,) * len(protocol.LOAD_SHARES))
+        if req.payload and req.payload[0] & protocol.STATS_RESET:
+            self.reset_stats()
+        return CMD_US, payload
+
+    def _counts(self):
+        """(loop time, frames, inferences, error counters, run histogram) as a telemetry frame counts them"""
+        errors = (0, self.reader.crc_errors - self.crc_base, self.dropped, 0, 0, 0, 0)
+        return self.loop.time(), self.frames, self.inferences, errors, [min(n, 0xFFFF) for n in self.run_hist]
+
+    def _telemetry_frame(self, reason):
+        """ProtoTelemetry_t of the counts since the last one, which it then replaces"""
+        def since(now, last):
+            return now - last if now >= last else now
+        at, frames, inferences, errors, runs = now = self._counts()
+        last_at, last_frames, last_inferences, last_errors, last_runs = self.telemetry_base
+        self.telemetry_base = now
+        mask, counts = 0, []
+        for b, (n, last) in enumerate(zip(runs, last_runs)):
+            if since(n, last):
+                mask |= 1 << b
+                counts.append(since(n, last))
+        number, self.telemetry_number = self.telemetry_number, (self.telemetry_number + 1) & 0xFF
+        return protocol.TELEMETRY.pack(
+            number, reason, min(0xFFFF, round((at - last_at) * 1e3)),
+            min(0xFFFF, since(frames, last_frames)), min(0xFFFF, since(inferences, last_inferences)),
+            protocol.TELEM_NO_LOAD, round(self.hz / 1e6),
+            bytes(min(0xFF, since(n, last)) for n, last in zip(errors, last_errors)), mask) + \
+            struct.pack(f'<{len(counts)}H', *counts)
+
+    def _telemetry_push(self, reason):
+        self._reply(protocol.response_type(protocol.CMD_TELEMETRY), 0, self._telemetry_frame(reason))
+        self._telemetry_schedule()
+
+    def _telemetry_schedule(self):
+        if self.telemetry_timer is not None:
+            self.telemetry_timer.cancel()
+        self.telemetry_timer = None
+        if self.telemetry:
+            self.telemetry_timer = self.loop.call_later(self.telemetry / 1e3, self._telemetry_push,
+                                                        protocol.TELEM_PERIODIC)
+
+    def _telemetry_errors(self):
+        """Push early once TELEMETRY_ERRORS errors came, TELEMETRY_MIN_MS after the last frame"""
+        at, _, _, errors, _ = self.telemetry_base
+        if self.telemetry and self.loop.time() - at >= TELEMETRY_MIN_MS / 1e3 and \
+                sum(self._counts()[3]) - sum(errors) >= TELEMETRY_ERRORS:
+            self._telemetry_push(protocol.TELEM_ERRORS)
+
+    def _on_telemetry(self, req):
+        if len(req.payload) != protocol.TELEMETRY_REQ.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        (self.telemetry,) = protocol.TELEMETRY_REQ.unpack(req.payload)
+        self._telemetry_schedule()
+        return CMD_US, self._telemetry_frame(protocol.TELEM_ASKED)
+
+    def _on_select_model(self, req):
+        if len(req.payload) > 1:
+            raise DeviceError(protocol.ERR_LENGTH)
+        if req.payload:
+            if req.payload[0] >= len(self.hashes):
+                raise DeviceError(protocol.ERR_PARAM)
+            self.active = req.payload[0]
+        return CMD_US, protocol.MODEL_SEL.pack(self.active, len(self.hashes), 0, 0)
+
+    def _on_set_baud(self, req):
+        if len(req.payload) != 4:
+            raise DeviceError(protocol.ERR_LENGTH)
+        (baud,) = struct.unpack('<I', req.payload)
+        if not SLOW_BAUD <= baud <= FAST_BAUD:
+            raise DeviceError(protocol.ERR_PARAM)
+        self.baud_next = baud
+        return CMD_US, req.payload
+
+    def _on_set_clock(self, req):
+        if len(req.payload) != 1:
+            raise DeviceError(protocol.ERR_LENGTH)
+        if req.payload[0] >= len(CLOCK_HZ):
+            raise DeviceError(protocol.ERR_PARAM)
+        self.hz = CLOCK_HZ[req.payload[0]]
+        return CMD_US, struct.pack('<I', self.hz)
+
+    HANDLERS = {
+        protocol.CMD_CLASSIFY: _on_classify,
+        protocol.CMD_CLASSIFY_PACKED: _on_packed,
+        protocol.CMD_CLASSIFY_PROF: _on_profiled,
+        protocol.CMD_CLASSIFY_TOPK: _on_topk,
+        protocol.CMD_BATCH: _on_batch,
+        protocol.CMD_BATCH_IMAGE: _on_batch_image,
+        protocol.CMD_PING: _on_ping,
+        protocol.CMD_STATS: _on_stats,
+        protocol.CMD_TELEMETRY: _on_telemetry,
+        protocol.CMD_SELECT_MODEL: _on_select_model,
+        protocol.CMD_SET_BAUD: _on_set_baud,
+        protocol.CMD_SET_CLOCK: _on_set_clock,
+    }
+
+    # Line out
+
+    def _error(self, seq, code):
+        self._reply(protocol.TYPE_ERROR, seq, bytes((code,)))
+
+    def _reply(self, frame_type, seq, payload=b''):
+        data = protocol.encode_frame(frame_type, seq, payload)
+        self.last_tx = len(data) * BYTE_BITS / self.baud
+        self.tx_free = max(self.loop.time(), self.tx_free) + self.last_tx
+        if self.loss and self.rng.random() < self.loss:
+            return
+        self.loop.call_at(self.tx_free, self._write, data)
+
+    def _write(self, data):
+        if self.send is not None:
+            self.send(data)
+
+
+# Commands that answer ERR_TYPE: every one of the protocol the handlers and CANCEL leave
+UNSUPPORTED = tuple(sorted(value for name, value in vars(protocol).items() if name.startswith('CMD_') and
+                           value not in Board.HANDLERS and value != protocol.CMD_CANCEL))
+
+
+def command_name(cmd):
+    """CLASSIFY for CMD_CLASSIFY"""
+    return next(name[4:] for name, value in vars(protocol).items() if name.startswith('CMD_') and value == cmd)
+
+
+class _Connection(asyncio.Protocol):
+    """A host on a board's TCP port; a newer one takes the board over, as at a serial bridge"""
+
+    def __init__(self, board):
+        self.board = board
+        self.transport = None
+
+    def connection_made(self, transport):
+        self.transport = transport
+        sock = transport.get_extra_info('socket')
+        if sock is not None:
+            sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.board.send = transport.write
+
+    def data_received(self, data):
+        if self.board.send == self.transport.write:
+            self.board.received(data)
+
+    def connection_lost(self, exc):
+        if self.board.send == self.transport.write:
+            self.board.send = None
+
+
+async def serve_tcp(board, host, port):
+    return await asyncio.get_running_loop().create_server(lambda: _Connection(board), host, port)
+
+
+def serve_pty(board):
+    """Path of a pseudo-terminal the board answers on (POSIX)"""
+    import tty
+
+    master, slave = os.openpty()
+    tty.setraw(slave)
+    os.set_blocking(master, False)
+
+    def readable():
+        try:
+            board.received(os.read(master, 4096))
+        except (BlockingIOError, OSError):
+            pass
+
+    def send(data):
+        try:
+            os.write(master, data)
+        except BlockingIOError:
+            pass  # nobody reads: the pty buffer is full, the reply is lost
+
+    asyncio.get_running_loop().add_reader(master, readable)
+    board.send = send
+    # The slave stays open here too, or the master reads EIO between hosts
+    return os.ttyname(slave)
+
+
+async def run(args, first, count, report):
+    """Serve boards first to first + count - 1 until cancelled, report((first, ports, model kind)) once up"""
+    loop = asyncio.get_running_loop()
+    model = load_model(None if args.stand_in else args.reference, args.network)
+    boards = [Board(first + i, model, args.run_us, args.baud, args.jitter, args.stall, args.loss, args.seed,
+                    args.admission) for i in range(count)]
+    if args.pty:
+        ports = [serve_pty(board) for board in boards]
+    else:
+        ports = [f"tcp://{args.host}:{args.port + first + i}" for i in range(count)]
+        for i, board in enumerate(boards):
+            await serve_tcp(board, args.host, args.port + first + i)
+    report((first, ports, model.kind))
+    # The timings hold while the loop keeps up: a late loop delays every board's replies
+    name = f"boards {first}-{first + count - 1}"
+    lag = 0.0
+    try:
+        while True:
+            at = loop.time()
+            await asyncio.sleep(LAG_PERIOD)
+            late = loop.time() - at - LAG_PERIOD
+            if late > LAG_WARN >= lag:
+                print(f"{name}: the event loop ran {late * 1e3:.1f} ms late, their timing is off "
+                      f"(fewer boards a process, more --processes)")
+            lag = max(lag, late)
+    finally:
+        print(f"{name}: {sum(b.frames for b in boards)} frames, {sum(b.inferences for b in boards)} inferences, "
+              f"{sum(b.dropped for b in boards)} refused busy, loop at most {lag * 1e3:.1f} ms late")
+
+
+def announce(args, ports, kind):
+    print(f"{len(ports)} boards, {kind}, models {', '.join(f'{us} us' for us in args.run_us)}, "
+          f"{args.baud} baud, {args.processes} process{'es' if args.processes > 1 else ''}")
+    print(ports[0] if len(ports) == 1 else f"{ports[0]} ... {ports[-1]}")
+    if args.ports_file:
+        with open(args.ports_file, 'w') as f:
+            f.write(' '.join(ports) + '\n')
+
+
+def _serve(args, first, count, out):
+    try:
+        asyncio.run(run(args, first, count, out.put))
+    except KeyboardInterrupt:
+        pass
+
+
+def main(argv=None):
+    from .reference import DEFAULT_MODEL
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0],
+                                     epilog="Not emulated, answering ERR_TYPE: "
+                                            f"{', '.join(command_name(cmd) for cmd in UNSUPPORTED)}.")
+    parser.add_argument('--boards', type=int, default=1)
+    parser.add_argument('--host', default='localhost', help="address the TCP ports listen on")
+    parser.add_argument('--port', type=int, default=FIRST_PORT, help="the first board's TCP port, one up each")
+    parser.add_argument('--pty', action='store_true', help="pseudo-terminals instead of TCP ports (POSIX)")
+    parser.add_argument('--processes', type=int, default=1, help="event loops the boards are spread over, one a core")
+    parser.add_argument('--ports-file', help="write the ports, space separated, to this file")
+    parser.add_argument('--baud', type=int, default=BAUD,
+                        help="line rate the boards boot at, the host's --baud for tcp:// ports")
+    parser.add_argument('--run-us', type=int, nargs='+', default=list(RUN_US), metavar='US',
+                        help="network run of each registered model at the boot clock")
+    parser.add_argument('--jitter', type=float, default=0.0, help="run time standard deviation, 0.05 = 5 %%")
+    parser.add_argument('--stall', type=float, default=0.0,
+                        help=f"fraction of runs taking {STALL_FACTOR:g} times as long")
+    parser.add_argument('--loss', type=float, default=0.0, help="fraction of replies lost")
+    parser.add_argument('--seed', type=int, default=0)
+    parser.add_argument('--admission', action='store_true',
+                        help="refuse frames finding no slot with a retry-after, as APP_ADMISSION")
+    parser.add_argument('--reference', default=DEFAULT_MODEL, help=".tflite the classes come from")
+    parser.add_argument('--network', metavar='PROJECT', help="generated network.c the classes come from instead")
+    parser.add_argument('--stand-in', action='store_true', help="hashed classes, no model")
+    args = parser.parse_args(argv)
+    if args.pty and os.name != 'posix':
+        parser.error("--pty needs a POSIX system, use the tcp:// ports")
+    args.processes = max(1, min(args.processes, args.boards))
+    if args.processes == 1:
+        try:
+            asyncio.run(run(args, 0, args.boards, lambda up: announce(args, up[1], up[2])))
+        except KeyboardInterrupt:
+            pass
+        return 0
+
+    import multiprocessing
+    import queue
+
+    out = multiprocessing.Queue()
+    share, extra = divmod(args.boards, args.processes)
+    counts = [share + (i < extra) for i in range(args.processes)]
+    processes = [multiprocessing.Process(target=_serve, args=(args, sum(counts[:i]), n, out), daemon=True)
+                 for i, n in enumerate(counts)]
+    for process in processes:
+        process.start()
+    try:
+        try:
+            up = sorted(out.get(timeout=START_TIMEOUT) for _ in processes)
+        except queue.Empty:
+            raise SystemExit("an emulator process did not come up") from None
+        announce(args, [port for _, ports, _ in up for port in ports], up[0][2])
+        for process in processes:
+            process.join()
+    except KeyboardInterrupt:
+        for process in processes:
+            process.join()  # the interrupt reached them too
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,153 @@
+"""Energy per inference on each clock profile, and the profile and idle mode a workload should use.
+
+    python -m stm32dc.energy --port COM9 --count 200
+    python -m stm32dc.energy --port COM9 --rate 20 --deadline-ms 40 --apply --save
+
+Firmware built with APP_ENERGY (energy.h) counts awake and asleep time and
+inferences per clock profile and reports them as microjoules with the
+current model of app_config.h. Each profile is measured with the same
+images sent back to back: awake time per inference is what one request
+costs, parsing and the reply included, and the power asleep in WFI is what
+the gaps between requests cost.
+
+At --rate requests per second a profile spends
+
+    rate x active energy + (1 - rate x active time) x sleep power
+
+per second, and the cheapest profile is not always the slowest: a fast
+clock finishes early and sleeps longer (race to idle), a slow one draws
+less for longer. Profiles busy for more than --max-util of the time, or
+slower than --deadline-ms per request, are ruled out. STOP mode
+(APP_IDLE_STOP_MS) is advised when the gap between requests is longer than
+STOP_MIN_GAP_S, since each wake-up costs a PLL relock and a retried request.
+
+--apply switches the board to the choice, --save also keeps its clock for
+the next boot (CONFIG, APP_CONFIG); the idle mode is not saved. The
+microjoules are only as good as the current model: check APP_ENERGY_RUN_UA
+and APP_ENERGY_SLEEP_UA against an analyzer triggered on PD11.
+"""
+import argparse
+import sys
+from typing import NamedTuple
+
+from . import protocol
+from .bench import load_images, open_device, synthetic_images
+from .link import DeviceError
+
+# Highest busy fraction a profile may run at, headroom for bursts
+DEFAULT_MAX_UTIL = 0.7
+# Mean gap between requests above which STOP mode is worth its wake-up
+STOP_MIN_GAP_S = 2.0
+
+
+class ProfileEnergy(NamedTuple):
+    profile: str
+    hz: int
+    inferences: int
+    uj_per_inference: float   # awake and asleep, back to back
+    active_us: float          # awake time per inference
+    active_uj: float          # its energy at the run current
+    sleep_uw: float           # power in WFI
+
+
+class Choice(NamedTuple):
+    profile: ProfileEnergy
+    utilisation: float
+    power_uw: float           # at the requested rate
+    stop: bool                # advise STOP mode between requests
+
+
+def measure(link, images, profile, warmup=10):
+    """ProfileEnergy of classifying images back to back on profile"""
+    link.set_clock(profile)
+    for img in images[:warmup]:
+        link.classify(img)
+    link.energy(reset=True)
+    for img in images:
+        link.classify(img)
+    e = link.energy()
+    s = e.slots[protocol.CLOCK_PROFILES[profile]]
+    return ProfileEnergy(profile, s.hz, s.inferences, s.uj_per_inference, s.active_us,
+                         s.run_ua * e.mv * s.active_us / 1e9, s.sleep_ua * e.mv / 1e3)
+
+
+def choose(measured, rate, deadline_s=None, max_util=DEFAULT_MAX_UTIL):
+    """Cheapest feasible Choice at rate requests/s, None if no profile keeps up"""
+    best = None
+    for m in measured:
+        util = rate * m.active_us / 1e6
+        if util > max_util or (deadline_s and m.active_us / 1e6 > deadline_s):
+            continue
+        power = rate * m.active_uj + (1.0 - util) * m.sleep_uw
+        if best is None or power < best.power_uw:
+            best = Choice(m, util, power, 1.0 / rate >= STOP_MIN_GAP_S)
+    return best
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--port', required=True)
+    ap.add_argument('--baud', type=int, default=921600)
+    ap.add_argument('--rtscts', action='store_true')
+    ap.add_argument('--images', help="IDX or .npy file of 28x28 uint8 images")
+    ap.add_argument('--count', type=int, default=200, help="images per profile")
+    ap.add_argument('--warmup', type=int, default=10)
+    ap.add_argument('--rate', type=float, help="requests per second the workload sends, enables the choice")
+    ap.add_argument('--deadline-ms', type=float, help="longest a request may take on the device")
+    ap.add_argument('--max-util', type=float, default=DEFAULT_MAX_UTIL,
+                    help="highest busy fraction allowed (default %(default)s)")
+    ap.add_argument('--apply', action='store_true', help="switch the board to the chosen profile and idle mode")
+    ap.add_argument('--save', action='store_true', help="with --apply, also boot on that profile (APP_CONFIG)")
+    args = ap.parse_args(argv)
+    if args.apply and not args.rate:
+        ap.error("--apply needs --rate")
+
+    images = load_images(args.images)[:args.count] if args.images else synthetic_images(args.count)
+    conn, link, _ = open_device(args.port, args.baud, args.rtscts)
+    try:
+        try:
+            start = link.energy()
+        except DeviceError as e:
+            if e.code == protocol.ERR_TYPE:
+                raise SystemExit(f"{args.port}: the firmware has no ENERGY, build it with APP_ENERGY=1")
+            raise
+        measured = []
+        for profile in protocol.CLOCK_PROFILES:
+            try:
+                measured.append(measure(link, images, profile, args.warmup))
+            except (DeviceError, TimeoutError) as e:
+                print(f"{profile:<13} skipped: {e}")
+        for m in measured:
+            print(f"{m.profile:<13} {m.hz / 1e6:.0f} MHz, {m.uj_per_inference:.1f} uJ/inference back to back, "
+                  f"{m.active_us:.0f} us and {m.active_uj:.1f} uJ awake, {m.sleep_uw:.0f} uW asleep")
+
+        choice = choose(measured, args.rate, args.deadline_ms and args.deadline_ms / 1e3,
+                        args.max_util) if args.rate else None
+        if args.rate:
+            if choice is None:
+                print(f"choice        none keeps up with {args.rate:g}/s")
+            else:
+                stop_built = bool(start.flags & protocol.ENERGY_STOP_BUILT)
+                idle = 'STOP' if choice.stop and stop_built else 'WFI'
+                print(f"choice        {choice.profile.profile} at {args.rate:g}/s: "
+                      f"{100.0 * choice.utilisation:.1f} % busy, {choice.power_uw / 1e3:.2f} mW, "
+                      f"{choice.power_uw / args.rate:.1f} uJ/inference, idle {idle}")
+                if args.apply:
+                    link.set_clock(choice.profile.profile)
+                    if stop_built:
+                        link.energy(stop=choice.stop)
+                    if args.save:
+                        link.config(protocol.CONFIG_SAVE)
+                    return 0
+        # Back on the profile the board ran before the sweep
+        if start.slot < len(protocol.CLOCK_PROFILES):
+            link.set_clock(start.slot)
+    except DeviceError as e:
+        raise SystemExit(f"{args.port}: {e}")
+    finally:
+        conn.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
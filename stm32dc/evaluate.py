@@ -0,0 +1,230 @@
+"""Hardware-in-the-loop evaluation: every model's accuracy, confusions and latency on the boards.
+
+    python -m stm32dc.evaluate --ports COM9 COM10 COM11 \\
+        --images emnist-digits-test-images-idx3-ubyte --labels emnist-digits-test-labels-idx1-ubyte
+    python -m stm32dc.evaluate --ports COM9 COM10 --models 0 1 --batch 0 --json eval.json
+
+For each registered model (SELECT_MODEL, or those given with --models)
+every board switches to it and the whole test set goes through the boards
+(BATCH frames of up to --batch images through a DynamicBatcher, or with
+--batch 0 pipelined CLASSIFY through a DevicePool). This is the firmware's
+own int8 network and preprocessing path, which the notebook's host
+evaluation does not see. The report gives per model the accuracy, a
+confusion matrix (a "-" column for images that failed or came back
+blank), latency percentiles and images/s, then one line per model to
+compare them. The boards are kept --window images ahead, so latency is
+what a fed pipeline gives, not the queue of the whole set. Each board
+is switched back to its model afterwards.
+
+--small models N sends those models 14x14 CLASSIFY_SMALL images, a
+quarter of the bytes, pipelined like --batch 0; evaluate the small model
+(APP_MODEL_SMALL) with it next to the digits model to see what the
+throughput mode trades in accuracy:
+
+    python -m stm32dc.evaluate --ports COM9 --images ... --labels ... --batch 0 --small 2
+"""
+import argparse
+import json
+import sys
+
+from .batcher import DEFAULT_MAX_BATCH, DynamicBatcher, _Board
+from .bench import _drive, BenchResult, batcher_report, open_device, percentile, pool_report
+from .dataset import Dataset, load_labels
+from .link import DeviceError
+from .preprocess import downsample
+from .pool import DevicePool, _Member
+from .worker import LinkWorker
+
+
+class ModelResult:
+    def __init__(self, index, sel, classes):
+        self.index = index
+        self.sel = sel
+        self.classes = classes
+        self.result = BenchResult()
+        self.confusion = [[0] * (classes + 1) for _ in range(classes)]
+        self.boards = []
+        self.small = False
+        self.model_hash = ''
+
+    def score(self, labels):
+        for label, digit in zip(labels, self.result.predictions):
+            if label < self.classes:
+                column = digit if digit is not None and digit < self.classes else self.classes
+                self.confusion[label][column] += 1
+
+    @property
+    def correct(self):
+        return sum(self.confusion[c][c] for c in range(self.classes))
+
+    @property
+    def total(self):
+        return sum(sum(row) for row in self.confusion)
+
+    def summary(self):
+        lat = sorted(self.result.latencies)
+        done = sum(p is not None for p in self.result.predictions)
+        return {
+            'model': self.index,
+            'small': self.small,
+            'activations_size': self.sel.activations_size,
+            'weights_size': self.sel.weights_size,
+            'images': self.total,
+            'accuracy': self.correct / self.total if self.total else 0.0,
+            'errors': self.result.errors,
+            'timeouts': self.result.timeouts,
+            'throughput': done / self.result.elapsed if self.result.elapsed else 0.0,
+            'latency_ms': {f'p{p}': percentile(lat, p) * 1e3 for p in (50, 90, 95, 99)},
+            'confusion': self.confusion,
+        }
+
+
+def confusion_report(confusion):
+    classes = len(confusion)
+    width = max(4, len(str(max(max(row) for row in confusion))) + 1)
+    lines = ["true\\pred" + "".join(f"{c:>{width}}" for c in range(classes)) + f"{'-':>{width}}"
+             + f"{'recall':>8}"]
+    for label, row in enumerate(confusion):
+        total = sum(row)
+        recall = row[label] / total * 100 if total else 0.0
+        lines.append(f"{label:<9}" + "".join(f"{n:>{width}}" for n in row) + f"{recall:>7.1f}%")
+    return "\n".join(lines)
+
+
+def evaluate_model(boards, index, images, labels, batch, max_wait, window, warmup, small=False):
+    """Switch every board to model index, push the images through them, score the answers
+
+    small sends 14x14 CLASSIFY_SMALL images through a DevicePool, whatever batch says.
+    """
+    sel = None
+    classes = 0
+    for _, link in boards:
+        sel = link.select_model(index)
+        caps = link.probe()
+        classes = max(classes, caps.num_classes if caps else 10)
+    classes = max(classes, max(labels) + 1)
+    model = ModelResult(index, sel, classes)
+    model.model_hash = caps.model_hash if caps else ''
+    model.small = small
+
+    method = 'classify'
+    if small:
+        images = [downsample(img).tobytes() for img in images]
+        method = 'classify_small'
+        batch = 0
+    if batch:
+        backend = DynamicBatcher([_Board(port, None, link) for port, link in boards], batch, max_wait)
+        report = batcher_report
+    else:
+        backend = DevicePool([_Member(port, None, LinkWorker(link).start()) for port, link in boards])
+        report = pool_report
+    with backend:
+        for f in [getattr(backend, method)(img) for img in images[:warmup * len(boards)]]:
+            try:
+                f.result()
+            except (DeviceError, TimeoutError, ConnectionError):
+                pass
+        backend.reset_stats()
+        _drive(backend, images, None, window, model.result, method)
+        model.boards = report(backend.health())
+    model.score(labels)
+    return model
+
+
+def record(args, results, labels, links):
+    """Store every model's run in the --db history (stm32dc.perfdb)"""
+    from . import perfdb
+
+    board = ','.join(perfdb.link_identity(link)[1] for link in links)
+    for model in results:
+        metrics, samples = perfdb.bench_metrics(model.result, labels)
+        s = model.summary()
+        metrics['accuracy'] = s['accuracy']
+        metrics['weights_size'] = s['weights_size']
+        metrics['activations_size'] = s['activations_size']
+        config = perfdb.hil_config(model.index, model.small, args.batch)
+        run = perfdb.record(args.db, 'hil', metrics, config, samples, model.model_hash, board, args.note)
+        print(f"recorded run {run} in {args.db} ({config})")
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--ports', nargs='+', required=True, metavar='PORT')
+    parser.add_argument('--baud', type=int, default=921600)
+    parser.add_argument('--rtscts', action='store_true')
+    parser.add_argument('--images', required=True, help="IDX or .npy file of 28x28 uint8 images")
+    parser.add_argument('--labels', required=True, help="IDX label file")
+    parser.add_argument('--count', type=int, help="only the first COUNT images")
+    parser.add_argument('--models', type=int, nargs='+', metavar='N',
+                        help="model indices to evaluate (default: every registered model)")
+    parser.add_argument('--batch', type=int, default=DEFAULT_MAX_BATCH, metavar='N',
+                        help="BATCH frames of up to N images, 0 for pipelined CLASSIFY "
+                             "(default %(default)s)")
+    parser.add_argument('--max-wait-ms', type=float, default=1.0)
+    parser.add_argument('--window', type=int, metavar='IMAGES',
+                        help="images in flight over all boards (default: two batches, or "
+                             "eight CLASSIFY, per board)")
+    parser.add_argument('--warmup', type=int, default=10)
+    parser.add_argument('--small', type=int, nargs='+', default=[], metavar='N',
+                        help="send these models 14x14 CLASSIFY_SMALL images")
+    parser.add_argument('--json', metavar='PATH', help="also write the results as JSON")
+    parser.add_argument('--db', metavar='PATH', help="record each model's run in this stm32dc.perfdb history")
+    parser.add_argument('--note', default='', help="with --db, a note stored with the runs")
+    args = parser.parse_args(argv)
+
+    images = Dataset(args.images)[:args.count]
+    labels = load_labels(args.labels)[:len(images)]
+    if len(labels) != len(images):
+        parser.error(f"{len(labels)} labels for {len(images)} images")
+    window = args.window or len(args.ports) * (2 * args.batch if args.batch else 8)
+
+    boards, started = [], []
+    try:
+        for port in args.ports:
+            conn, link, baud = open_device(port, args.baud, args.rtscts)
+            boards.append((port, link))
+            started.append((conn, link, link.select_model().active))
+        count = started[0][1].select_model().count
+        models = args.models if args.models is not None else list(range(count))
+        mode = f"BATCH <= {args.batch}" if args.batch else "CLASSIFY"
+        print(f"{len(boards)} boards @ {baud} baud, {len(images)} images, models {models}, "
+              f"{mode}, {window} in flight")
+
+        results = []
+        for index in models:
+            model = evaluate_model(boards, index, images, labels, args.batch,
+                                   args.max_wait_ms / 1e3, window, args.warmup, index in args.small)
+            results.append(model)
+            s = model.summary()
+            print(f"\nmodel {index}{' (14x14 CLASSIFY_SMALL)' if model.small else ''}: "
+                  f"{s['activations_size']} B arena, {s['weights_size']} B weights")
+            print(model.result.report(labels))
+            print(confusion_report(model.confusion))
+            print(model.boards)
+
+        print(f"\n{'model':<7}{'accuracy':>10}{'p50 ms':>9}{'p95 ms':>9}{'p99 ms':>9}"
+              f"{'img/s':>9}{'errors':>8}")
+        for model in results:
+            s = model.summary()
+            lat = s['latency_ms']
+            name = f"{model.index}/14" if model.small else str(model.index)
+            print(f"{name:<7}{s['accuracy'] * 100:>9.2f}%{lat['p50']:>9.2f}{lat['p95']:>9.2f}"
+                  f"{lat['p99']:>9.2f}{s['throughput']:>9.1f}{s['errors'] + s['timeouts']:>8}")
+        if args.json:
+            with open(args.json, 'w', encoding='utf-8') as f:
+                json.dump({'ports': args.ports, 'images': len(images), 'batch': args.batch,
+                           'models': [m.summary() for m in results]}, f, indent=1)
+        if args.db:
+            record(args, results, labels, [link for _, link in boards])
+    finally:
+        for conn, link, active in started:
+            try:
+                link.select_model(active)
+            except (DeviceError, TimeoutError, OSError):
+                pass
+            conn.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
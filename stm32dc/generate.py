@@ -0,0 +1,296 @@
+"""Generate a model variant into the firmware with ST Edge AI Core.
+
+    python -m stm32dc.generate --time tinyML
+    python -m stm32dc.generate --lite tinyML
+    python -m stm32dc.generate tinyML -m emnist_digits_int8.tflite --name network_time -O time
+    python -m stm32dc.generate --dqnn tinyML
+    python -m stm32dc.generate --separable tinyML
+    python -m stm32dc.generate --gap tinyML
+    python -m stm32dc.generate --balanced tinyML
+    python -m stm32dc.generate --shapes tinyML
+    python -m stm32dc.generate --multihead tinyML
+    python -m stm32dc.generate --small tinyML
+    python -m stm32dc.generate --pertensor tinyML
+    python -m stm32dc.generate tinyML --const-descriptors
+    python -m stm32dc.generate --all tinyML
+
+Runs ``stedgeai generate`` for the STM32F4 target and copies the generated
+sources into tinyML/X-CUBE-AI/App and the c_info report into tinyML/.ai,
+next to the CubeMX-generated ``network``. Each variant needs its own C name
+(``network_time`` for APP_MODEL_TIME) so both link into one image, and the
+tool must be the release the runtime library in Middlewares/ST/AI came from
+(see X-CUBE-AI/App/network_generate_report.txt).
+
+--lite generates the digits model as ``network_lite`` for APP_MODEL_LITE
+on the lite graph runtime: network_lite.c calls the lite operators
+(lite_conv2d_sssa8_ch, lite_dense_is8os8ws8, ...) in one generated
+function instead of describing a chain of layer objects that the generic
+runtime walks, so the model is a single c-node. -O ram as the CubeMX
+network, so --compare-models only sees the runtime. The option that
+selects it is LITE_ARGS; releases that name it differently take
+--tool-arg instead.
+
+--const-descriptors declares the generated tensor descriptors static const,
+so they stay in flash instead of being copied to .data at boot, next to
+the quantisation and chain descriptors the tool already makes const. The
+arrays, layers and network object stay in RAM: the runtime binds the
+buffers into the arrays at init, and the custom kernels swap layer
+forwards. With a variant it applies to that variant. Given alone, it
+rewrites the CubeMX network.c in place; CubeMX undoes it on regeneration.
+GCC then warns where the tensor lists take their addresses, since they
+hold them through non-const pointers. A write to one would be lost, so run
+--selftest on the board once after applying it.
+
+--compression only acts on float dense layers; the int8 digits model keeps
+its weights as they are whatever is asked, see the variant's report.
+
+--dqnn generates the notebook's binarized Larq model (step 11) as ``dqnn``
+for APP_MODEL_DQNN. A Keras model has float I/O, so it is generated with
+int8 input and output (--io-type int8) to take the image the firmware feeds
+every model; the notebook trains it on those int8 values, the report
+must show the input at scale 1, zero point 0.
+
+--separable generates the notebook's depthwise-separable model (step 12),
+conv2d_2 split into a 3x3 depthwise and a 1x1 pointwise convolution, as
+``separable`` for APP_MODEL_SEPARABLE, and --gap the global average pool
+head (step 13) that replaces the 800 -> 128 gemm_5 as ``gap`` for
+APP_MODEL_GAP.
+
+--balanced generates the 47 class EMNIST balanced classifier as
+``balanced`` for APP_MODEL_BALANCED. Its 354 KB of weights do not fit next
+to the digits model, they stream from the external SPI flash (APP_XFLASH):
+the blob is written to X-CUBE-AI/App/balanced_weights.bin and the array in
+balanced_data_params.c cut down to one word, so only the graph links.
+Upload the .bin with python -m stm32dc.upload --model N.
+
+--shapes generates the notebook's int8 quantization of the float shapes
+classifier (step 16) as ``shapes`` for APP_MODEL_SHAPES, and
+--shapes-float the same network kept in float as ``shapes_float`` for
+APP_MODEL_SHAPES_FLOAT, with int8 I/O like --dqnn. Both take the 28x28
+image and scale it up to the 64x64 the original was trained on, so
+--compare-models times the FPU float kernels against the int8 ones on the
+same layers.
+
+--multihead generates the notebook's shared-backbone model (step 17), one
+conv backbone under a digits head (output 0) and an EMNIST balanced head
+(output 1), as ``multihead`` for APP_MODEL_MULTIHEAD. Its two dense heads
+put it at about 215 KB of weights, which link into the internal flash.
+
+--small generates the 14x14 throughput model (step 18), a 2x2 average
+pool in front of the step 3 blocks, as ``small`` for APP_MODEL_SMALL. It
+takes the 28x28 input like the others; CLASSIFY_SMALL feeds it the
+doubled 14x14 image.
+
+--pertensor generates the digits model of step 19, trained and converted
+with one weight scale per layer, as ``pertensor`` for APP_MODEL_PERTENSOR.
+Its layers are those of the digits model, so the conv kernels take it;
+gemm_5's blocked copy (stm32dc.weights) must be written from it for the
+dense kernel to.
+
+--all generates every preset whose model file is in the current directory,
+which is where the notebook's steps write them, for regenerating all the
+variants after a training run (step 20). Missing files are listed and
+skipped; a variant the tool fails on is reported and the others still
+generate. The CubeMX ``network`` is not among them, CubeMX regenerates it.
+"""
+import argparse
+import glob
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+from .weights import load_blob
+
+APP = os.path.join('X-CUBE-AI', 'App')
+DEFAULT_MODEL = 'emnist_digits_int8.tflite'
+
+# Registry variants: option -> (C name, model, -O, I/O type, app_config.h flag)
+PRESETS = {
+    'time': ('network_time', DEFAULT_MODEL, 'time', None, 'APP_MODEL_TIME'),
+    'lite': ('network_lite', DEFAULT_MODEL, 'ram', None, 'APP_MODEL_LITE'),
+    'dqnn': ('dqnn', 'emnist_digits_dqnn.h5', 'time', 'int8', 'APP_MODEL_DQNN'),
+    # -O ram as the CubeMX network, so a comparison only sees the architecture
+    'separable': ('separable', 'emnist_digits_separable_int8.tflite', 'ram', None,
+                  'APP_MODEL_SEPARABLE'),
+    'gap': ('gap', 'emnist_digits_gap_int8.tflite', 'ram', None, 'APP_MODEL_GAP'),
+    'balanced': ('balanced', 'emnist_balanced_classifier.tflite', 'ram', None, 'APP_MODEL_BALANCED'),
+    'shapes': ('shapes', 'shapes_classifier_int8.tflite', 'ram', None, 'APP_MODEL_SHAPES'),
+    'shapes-float': ('shapes_float', 'shapes_classifier_float.h5', 'ram', 'int8', 'APP_MODEL_SHAPES_FLOAT'),
+    'multihead': ('multihead', 'emnist_multihead_int8.tflite', 'ram', None, 'APP_MODEL_MULTIHEAD'),
+    'small': ('small', 'emnist_digits_small_int8.tflite', 'ram', None, 'APP_MODEL_SMALL'),
+    'pertensor': ('pertensor', 'emnist_digits_pertensor_int8.tflite', 'ram', None, 'APP_MODEL_PERTENSOR'),
+}
+# Extra stedgeai options of a preset
+LITE_ARGS = ('--use-lite-runtime',)
+TOOL_ARGS = {'lite': LITE_ARGS}
+# Variants whose weights stream from the external flash instead of linking
+EXTERNAL = ('balanced',)
+SUFFIXES = ('.c', '.h', '_data.c', '_data.h', '_data_params.c', '_data_params.h',
+            '_config.h', '_generate_report.txt')
+
+
+def generate(project, model, name, optimization, compression, tool='stedgeai', io_type=None,
+             extra=()):
+    """Generate model as C name `name`, returns the copied file paths
+
+    io_type ('int8') sets the input and output data type of a float I/O model,
+    extra is appended to the stedgeai command line.
+    """
+    if name == 'network':
+        raise SystemExit("'network' is the CubeMX model; give the variant its own --name")
+    with tempfile.TemporaryDirectory() as tmp:
+        output = os.path.join(tmp, 'output')
+        workspace = os.path.join(tmp, 'workspace')
+        cmd = [tool, 'generate', '--target', 'stm32f4', '--name', name, '-m', model,
+               '--compression', compression, '-O', optimization,
+               '--output', output, '--workspace', workspace]
+        if io_type:
+            cmd += ['--input-data-type', io_type, '--output-data-type', io_type]
+        cmd += list(extra)
+        print(' '.join(cmd))
+        try:
+            subprocess.run(cmd, check=True)
+        except FileNotFoundError:
+            raise SystemExit(f"{tool} not found, install ST Edge AI Core or pass --tool")
+
+        copied = []
+        for suffix in SUFFIXES:
+            src = os.path.join(output, name + suffix)
+            if not os.path.exists(src):
+                raise SystemExit(f"{tool} did not write {name + suffix}")
+            copied.append(shutil.copy(src, os.path.join(project, APP)))
+        reports = glob.glob(os.path.join(workspace, '**', '*_c_info.json'), recursive=True)
+        if reports:
+            os.makedirs(os.path.join(project, '.ai'), exist_ok=True)
+            dst = os.path.join(project, '.ai', f"{name}_{os.path.basename(model)}_c_info.json")
+            copied.append(shutil.copy(reports[0], dst))
+        return copied
+
+
+def externalize(project, name):
+    """Move the weights of generated `name` out of the image, returns the .bin path
+
+    The blob goes to <name>_weights.bin for UPLOAD; the array keeps its
+    symbol with a single word, the weights map and its size are unchanged.
+    """
+    app = os.path.join(project, APP)
+    array = f's_{name}_weights_array_u64'
+    params = os.path.join(app, f'{name}_data_params.c')
+    blob = load_blob(params, array)
+    path = os.path.join(app, f'{name}_weights.bin')
+    with open(path, 'wb') as f:
+        f.write(blob)
+
+    for src, pattern, repl in ((params, array + r'\[\d+\] = \{.*?\};', array + '[1] = { 0x0U };'),
+                               (os.path.join(app, f'{name}_data.h'), array + r'\[\d+\]', array + '[1]')):
+        with open(src, encoding='utf-8') as f:
+            text = f.read()
+        text, n = re.subn(pattern, repl, text, count=1, flags=re.S)
+        if n != 1:
+            raise SystemExit(f"no {array} in {src}")
+        with open(src, 'w', encoding='utf-8') as f:
+            f.write(text)
+    return path
+
+
+def const_descriptors(project, name):
+    """Make the tensor descriptors of generated `name` static const, returns how many"""
+    path = os.path.join(project, APP, f'{name}.c')
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+    text, n = re.subn(r'(AI_TENSOR_OBJ_DECLARE\(\s*\w+,\s*)AI_STATIC\b(?!_)', r'\1AI_STATIC_CONST', text)
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return n
+
+
+def generate_all(args):
+    """--all: every preset with its model file present, returns the exit status"""
+    done, missing, failed = [], [], []
+    for option, (name, model, optimization, io_type, flag) in PRESETS.items():
+        if not os.path.exists(model):
+            missing.append(model)
+            continue
+        print(f"--{option}:")
+        try:
+            for path in generate(args.project, model, name, optimization, args.compression, args.tool,
+                                 io_type, TOOL_ARGS.get(option, ())):
+                print(f"  {path}")
+            if args.const_descriptors:
+                print(f"  {const_descriptors(args.project, name)} tensor descriptors made const")
+            if option in EXTERNAL:
+                print(f"  {externalize(args.project, name)}, weights for the external flash")
+        except (SystemExit, subprocess.CalledProcessError) as e:
+            failed.append(option)
+            print(f"  failed: {e}")
+            continue
+        done.append(flag)
+    if missing:
+        print(f"no model file, skipped: {', '.join(sorted(set(missing)))}")
+    if failed:
+        print(f"failed: {', '.join('--' + o for o in failed)}")
+    if done:
+        print(f"build with {'=1, '.join(done)}=1, then: python -m stm32dc.bench --port COM9 --compare-models")
+    return 1 if failed or not done else 0
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('project', help="firmware project directory (tinyML)")
+    ap.add_argument('-m', '--model')
+    ap.add_argument('--name', help="C name of the variant")
+    ap.add_argument('-O', '--optimization', choices=('time', 'ram', 'balanced'))
+    ap.add_argument('--compression', default='none',
+                    choices=('none', 'lossless', 'low', 'medium', 'high'))
+    variants = ap.add_mutually_exclusive_group()
+    for option, (c_name, model, optimization, io_type, flag) in PRESETS.items():
+        io = f", {io_type} I/O" if io_type else ""
+        variants.add_argument(f'--{option}', action='store_const', const=option, dest='preset',
+                              help=f"the {flag} variant: -m {model} --name {c_name} "
+                                   f"-O {optimization}{io}")
+    variants.add_argument('--all', action='store_const', const='all', dest='preset',
+                          help="every preset whose model file exists")
+    ap.add_argument('--io-type', choices=('int8',),
+                    help="input and output data type of a float I/O (Keras) model")
+    ap.add_argument('--const-descriptors', action='store_true',
+                    help="keep the tensor descriptors in flash (alone: network.c in place)")
+    ap.add_argument('--tool', default='stedgeai')
+    ap.add_argument('--tool-arg', action='append', default=[], metavar='ARG',
+                    help="extra stedgeai option, repeat for each (replaces the preset's own)")
+    args = ap.parse_args(argv)
+
+    if args.const_descriptors and not (args.preset or args.name):
+        print(f"network.c: {const_descriptors(args.project, 'network')} tensor descriptors made const")
+        return 0
+
+    if args.preset == 'all':
+        return generate_all(args)
+
+    preset = PRESETS.get(args.preset, (None, DEFAULT_MODEL, None, None, None))
+    name = args.name or preset[0]
+    model = args.model or preset[1]
+    optimization = args.optimization or preset[2]
+    io_type = args.io_type or preset[3]
+    if not name or not optimization:
+        ap.error(f"give one of {', '.join('--' + o for o in PRESETS)}, or --name and -O")
+
+    extra = args.tool_arg or TOOL_ARGS.get(args.preset, ())
+    for path in generate(args.project, model, name, optimization, args.compression, args.tool,
+                         io_type, extra):
+        print(f"  {path}")
+    if args.const_descriptors:
+        print(f"  {const_descriptors(args.project, name)} tensor descriptors made const")
+    if args.preset in EXTERNAL:
+        print(f"  {externalize(args.project, name)}, weights for the external flash")
+    if name == preset[0]:
+        print(f"build with {preset[4]}=1, then: python -m stm32dc.bench --port COM9 --compare-models")
+    else:
+        print(f"add X({name}, {name.upper()}) and its headers to MODEL_LIST in Core/Inc/models.h")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
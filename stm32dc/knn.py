@@ -0,0 +1,235 @@
+"""Recognise new symbols from a few examples, by nearest neighbour over device embeddings.
+
+    python -m stm32dc.knn enroll --port COM9 --index symbols.npz --label plus --images plus.npy
+    python -m stm32dc.knn lookup --port COM9 --index symbols.npz --images test.npy --labels test.txt
+    python -m stm32dc.knn info --index symbols.npz
+    python -m stm32dc.knn enroll --device --port COM9 --label 10 --images plus.npy
+    python -m stm32dc.knn lookup --device --port COM9 --images test.npy
+
+Firmware built with APP_EMBED answers EMBED with the tensor the network's
+last dense layer reads, 128 int8 values on the digits network. A class the
+network was never trained on still lands in its own region of that space,
+so a handful of enrolled examples per symbol is enough to recognise it,
+without retraining, regenerating network.c or reflashing.
+
+The index keeps every enrolled vector with its label, centred on the
+embedding's zero point and scaled to unit length. A lookup is one float32
+matrix product against all of them (numpy hands it to a BLAS with SIMD
+kernels), which at a few thousand examples is faster than an approximate
+index would be to build; the k best vote, weighted by cosine similarity.
+An index belongs to one model: it stores the model hash from PING and
+refuses embeddings of another.
+
+--device does the same on the board (APP_KNN, knn.h): the examples are
+enrolled into its SRAM table, labels being numbers 0 to 254, and KNN
+CLASSIFY answers the nearest label within the classify request itself.
+That table is lost on reset, enroll again after one; clear empties it.
+
+--labels of lookup is a text file with one label per line, for accuracy.
+"""
+import argparse
+import sys
+from collections import Counter
+
+import numpy as np
+
+from . import protocol
+from .bench import load_images, open_device
+from .link import DeviceError
+
+DEFAULT_K = 3
+
+
+class EmbeddingIndex:
+    """Labelled int8 embeddings of one model, searched by cosine similarity"""
+
+    def __init__(self, model_hash='', zero_point=0):
+        self.model_hash = model_hash
+        self.zero_point = zero_point
+        self.vectors = None     # float32 [n, dim], unit rows
+        self.labels = []        # label of each row
+
+    def __len__(self):
+        return len(self.labels)
+
+    def _unit(self, embeddings):
+        v = np.array([np.frombuffer(bytes(e), np.int8) for e in embeddings], np.float32)
+        v -= self.zero_point
+        norm = np.linalg.norm(v, axis=1, keepdims=True)
+        return v / np.where(norm > 0, norm, 1)
+
+    def add(self, label, embeddings):
+        """Enrol embeddings (int8 bytes each) as examples of label"""
+        v = self._unit(embeddings)
+        self.vectors = v if self.vectors is None else np.concatenate([self.vectors, v])
+        self.labels.extend([label] * len(v))
+
+    def search(self, embeddings, k=DEFAULT_K):
+        """(indices [m, k], similarities [m, k]) of the k nearest examples, best first"""
+        sims = self._unit(embeddings) @ self.vectors.T
+        k = min(k, len(self))
+        top = np.argpartition(-sims, k - 1, axis=1)[:, :k]
+        order = np.argsort(-np.take_along_axis(sims, top, 1), axis=1)
+        top = np.take_along_axis(top, order, 1)
+        return top, np.take_along_axis(sims, top, 1)
+
+    def classify(self, embeddings, k=DEFAULT_K):
+        """(label, similarity of the nearest) per embedding, by similarity-weighted vote"""
+        if not len(self):
+            raise ValueError("the index is empty, enroll examples first")
+        out = []
+        for row, sims in zip(*self.search(embeddings, k)):
+            votes = Counter()
+            for i, s in zip(row, sims):
+                votes[self.labels[i]] += max(float(s), 0.0)
+            label = votes.most_common(1)[0][0] if votes else self.labels[row[0]]
+            out.append((label, float(sims[0])))
+        return out
+
+    def save(self, path):
+        np.savez(path, vectors=self.vectors if self.vectors is not None else np.zeros((0, 0), np.float32),
+                 labels=np.array(self.labels, dtype=str), model_hash=self.model_hash,
+                 zero_point=self.zero_point)
+
+    @classmethod
+    def load(cls, path):
+        data = np.load(path)
+        index = cls(str(data['model_hash']), int(data['zero_point']))
+        if len(data['labels']):
+            index.vectors = data['vectors']
+            index.labels = [str(label) for label in data['labels']]
+        return index
+
+
+def embed_all(link, images):
+    """protocol.Embedding of every image"""
+    return [link.embed(img) for img in images]
+
+
+def check(index, link, embeddings):
+    """Refuse embeddings of another model than the index was built on"""
+    model_hash = link.caps.model_hash if link.caps else ''
+    if not index.model_hash:
+        index.model_hash = model_hash
+        index.zero_point = embeddings[0].zero_point if embeddings else 0
+    elif model_hash and model_hash != index.model_hash:
+        raise SystemExit(f"the index was built on model {index.model_hash}, the board runs {model_hash}")
+
+
+def run_device(args, images):
+    """enroll, lookup or clear against the board's own table (KNN)"""
+    conn, link, _ = open_device(args.port, args.baud, args.rtscts)
+    try:
+        if link.caps and not link.caps.features & protocol.FEAT_KNN:
+            raise SystemExit(f"{args.port}: the firmware has no KNN, build it with APP_KNN=64")
+        if args.command == 'clear':
+            link.knn(protocol.KNN_CLEAR)
+            print(f"{args.port}: table cleared")
+            return 0
+        if args.command == 'enroll':
+            if not 0 <= int(args.label) < protocol.CLASS_NONE:
+                raise SystemExit("device labels are numbers 0 to 254")
+            for img in images:
+                r = link.knn(protocol.KNN_ENROLL, img, int(args.label))
+            print(f"{len(images)} examples of {args.label}, {r.count} of {r.capacity} in the table")
+            return 0
+        results = [link.knn(protocol.KNN_CLASSIFY, img) for img in images]
+    except DeviceError as e:
+        raise SystemExit(f"{args.port}: {e}")
+    finally:
+        conn.close()
+
+    truth = None
+    if args.labels:
+        with open(args.labels) as f:
+            truth = [line.strip() for line in f][:len(results)]
+    for i, r in enumerate(results):
+        label = '-' if r.label == protocol.CLASS_NONE else r.label
+        print(f"{i:5d}  {label!s:<16} {r.distance:6d}  (network: {r.digit})")
+    if truth:
+        hits = sum(str(r.label) == t for r, t in zip(results, truth))
+        print(f"accuracy      {hits}/{len(truth)} ({100.0 * hits / len(truth):.1f}%)")
+    return 0
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    sub = ap.add_subparsers(dest='command', required=True)
+    for name, help_ in (('enroll', "add examples of a label to the index"),
+                        ('lookup', "classify images against the index")):
+        p = sub.add_parser(name, help=help_)
+        p.add_argument('--port', required=True)
+        p.add_argument('--baud', type=int, default=921600)
+        p.add_argument('--rtscts', action='store_true')
+        p.add_argument('--device', action='store_true', help="the board's own table instead of --index")
+        p.add_argument('--index', help=".npz file, created by the first enroll")
+        p.add_argument('--images', required=True, help="IDX or .npy file of 28x28 uint8 images")
+        p.add_argument('--count', type=int, help="only the first images")
+        if name == 'enroll':
+            p.add_argument('--label', required=True)
+        else:
+            p.add_argument('--labels', help="text file, one label per image, enables the accuracy line")
+            p.add_argument('-k', type=int, default=DEFAULT_K, help="neighbours voting (default %(default)s)")
+    p = sub.add_parser('info', help="labels and example counts of an index")
+    p.add_argument('--index', required=True)
+    p = sub.add_parser('clear', help="empty the board's table")
+    p.add_argument('--port', required=True)
+    p.add_argument('--baud', type=int, default=921600)
+    p.add_argument('--rtscts', action='store_true')
+    args = ap.parse_args(argv)
+
+    if args.command == 'clear':
+        return run_device(args, [])
+
+    if args.command == 'info':
+        index = EmbeddingIndex.load(args.index)
+        print(f"model {index.model_hash or '?'}, zero point {index.zero_point}, {len(index)} examples")
+        for label, n in sorted(Counter(index.labels).items()):
+            print(f"  {label:<16} {n}")
+        return 0
+
+    images = load_images(args.images)
+    images = images[:args.count] if args.count else images
+    if args.device:
+        return run_device(args, images)
+    if not args.index:
+        ap.error("give --index, or --device for the board's table")
+    try:
+        index = EmbeddingIndex.load(args.index)
+    except FileNotFoundError:
+        if args.command == 'lookup':
+            raise SystemExit(f"{args.index}: no such index, enroll examples first")
+        index = EmbeddingIndex()
+
+    conn, link, _ = open_device(args.port, args.baud, args.rtscts)
+    try:
+        if link.caps and not link.caps.features & protocol.FEAT_EMBED:
+            raise SystemExit(f"{args.port}: the firmware has no EMBED, build it with APP_EMBED=1")
+        embeddings = embed_all(link, images)
+    except DeviceError as e:
+        raise SystemExit(f"{args.port}: {e}")
+    finally:
+        conn.close()
+    check(index, link, embeddings)
+
+    if args.command == 'enroll':
+        index.add(args.label, [e.vector for e in embeddings])
+        index.save(args.index)
+        print(f"{len(embeddings)} examples of {args.label!r}, {len(index)} in {args.index}")
+        return 0
+
+    results = index.classify([e.vector for e in embeddings], args.k)
+    truth = None
+    if args.labels:
+        with open(args.labels) as f:
+            truth = [line.strip() for line in f][:len(results)]
+    for i, (label, sim) in enumerate(results):
+        print(f"{i:5d}  {label:<16} {sim:.3f}  (network: {embeddings[i].digit})")
+    if truth:
+        hits = sum(r[0] == t for r, t in zip(results, truth))
+        print(f"accuracy      {hits}/{len(truth)} ({100.0 * hits / len(truth):.1f}%)")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
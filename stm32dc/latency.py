@@ -0,0 +1,224 @@
+"""Per-kernel latency table of the F411 and a latency predictor built on it.
+
+    python -m stm32dc.latency calibrate --port COM9 tinyML/.ai/network_emnist_digits_int8.tflite_c_info.json \\
+        [tinyML/.ai/network_time_emnist_digits_int8.tflite_c_info.json ...] --table latency.json
+    python -m stm32dc.latency predict latency.json tinyML/.ai/*_c_info.json
+    python -m stm32dc.latency predict latency.json search/*.tflite --max-ms 4
+
+calibrate needs firmware built with APP_PROFILE_LAYERS. The c_info reports
+are given in MODEL_LIST order (models.h), one per registered model from
+index 0. It selects each model, classifies --count images and reads the
+DWT cycles of every layer. Each layer is matched to its c_info node, and
+so to the runtime function that ran it (forward_conv2d_sssa8_ch_nl_pool,
+forward_dense_integer_SSSA_ch, forward_sm_integer, ...) and its MACC.
+Per function, a least squares line through those (MACC, cycles) points
+gives cycles per MACC and a fixed cost per call. What the layers leave of
+the run cycles is the runtime's own overhead per inference.
+
+The more shapes the registered models cover (network, APP_MODEL_TIME,
+APP_MODEL_SEPARABLE, APP_MODEL_GAP, a search image's candidates), the
+better the fit. A function met only at one MACC count gets no fixed cost.
+
+predict reads c_info reports, or TFLite files it first runs
+``stedgeai analyze`` on, and adds up the table's cost of every node. A
+node whose function is not in the table is priced at the table's mean
+cycles per MACC and marked '?'. Nothing is built or flashed, so a grid of
+candidates takes seconds instead of a firmware image each.
+"""
+import argparse
+import glob
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+from . import protocol
+from .bench import open_device, synthetic_images
+from .link import DeviceError
+
+DEFAULT_CPU_HZ = 100_000_000
+
+
+def load_c_info(path):
+    """Software nodes of a c_info report: [(name, original node ids, function, MACC)]"""
+    with open(path, encoding='utf-8') as f:
+        report = json.load(f)
+    nodes = []
+    for graph in report['graphs']:
+        for node in graph['nodes']:
+            functions = node.get('sw_functions') or [node['description']]
+            nodes.append((node['name'], node.get('original_nodes', []), functions[0],
+                          node.get('macc', 0)))
+    return nodes
+
+
+def analyze(tflite, tool='stedgeai'):
+    """c_info nodes of a TFLite model from ``stedgeai analyze`` for the STM32F4"""
+    with tempfile.TemporaryDirectory() as tmp:
+        cmd = [tool, 'analyze', '--target', 'stm32f4', '-m', tflite, '-O', 'ram',
+               '--output', os.path.join(tmp, 'output'), '--workspace', os.path.join(tmp, 'workspace')]
+        try:
+            subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+        except FileNotFoundError:
+            raise SystemExit(f"{tool} not found, install ST Edge AI Core or pass --tool")
+        reports = glob.glob(os.path.join(tmp, '**', '*_c_info.json'), recursive=True)
+        if not reports:
+            raise SystemExit(f"{tool} analyze wrote no c_info report for {tflite}")
+        return load_c_info(reports[0])
+
+
+def match(layer, nodes):
+    """c_info node of a profiled layer name ('conv2d_0', or 'node_3' outside LAYER_NAMES)"""
+    for node in nodes:
+        if node[0] == layer or (layer.startswith('node_') and layer[5:] in node[1]):
+            return node
+    return None
+
+
+def fit(points):
+    """Least squares cycles = per_macc * macc + fixed over [(macc, cycles)]"""
+    n = len(points)
+    sx = sum(m for m, _ in points)
+    sy = sum(c for _, c in points)
+    sxx = sum(m * m for m, _ in points)
+    sxy = sum(m * c for m, c in points)
+    den = n * sxx - sx * sx
+    if den > 0:
+        per_macc = (n * sxy - sx * sy) / den
+        fixed = (sy - per_macc * sx) / n
+        if fixed >= 0 and per_macc > 0:
+            return per_macc, fixed
+    # One shape, or a line through the points would cost negative: through the origin
+    return (sxy / sxx if sxx else 0.0), 0.0
+
+
+def measure(link, index, images):
+    """Mean run and per layer cycles of registered model index over the images"""
+    link.select_model(index)
+    link.classify(images[0])
+    run, layers = 0.0, {}
+    for img in images:
+        _, profile = link.classify_profiled(img)
+        run += profile.run * profile.cpu_hz / 1e6
+        for name, us in link.layer_profile():
+            layers[name] = layers.get(name, 0.0) + us * profile.cpu_hz / 1e6
+    return run / len(images), {name: c / len(images) for name, c in layers.items()}, profile.cpu_hz
+
+
+def calibrate(link, reports, images):
+    """Measure the registered models described by reports (MODEL_LIST order), returns the table"""
+    count = link.select_model().count
+    if len(reports) > count:
+        raise SystemExit(f"{len(reports)} reports for {count} registered models")
+    points, overheads, cpu_hz = {}, [], DEFAULT_CPU_HZ
+    try:
+        for index, path in enumerate(reports):
+            nodes = load_c_info(path)
+            run, layers, cpu_hz = measure(link, index, images)
+            print(f"  model {index}  {os.path.basename(path)}  {run:.0f} cycles")
+            for name, cycles in layers.items():
+                node = match(name, nodes)
+                if node is None:
+                    print(f"    {name}: not in the report, skipped")
+                    continue
+                points.setdefault(node[2], []).append([node[3], cycles, node[0], index])
+            overheads.append(run - sum(layers.values()))
+    finally:
+        link.select_model(0)
+
+    kernels = {}
+    for function, pts in sorted(points.items()):
+        per_macc, fixed = fit([(m, c) for m, c, _, _ in pts if m])
+        kernels[function] = {'cycles_per_macc': per_macc, 'fixed_cycles': fixed, 'points': pts}
+    return {'cpu_hz': cpu_hz, 'images': len(images),
+            'run_overhead_cycles': sum(overheads) / len(overheads) if overheads else 0.0,
+            'kernels': kernels}
+
+
+def predict(table, nodes):
+    """[(node name, function, MACC, cycles, known)] and the total cycles of a model"""
+    kernels = table['kernels']
+    mean = (sum(k['cycles_per_macc'] for k in kernels.values()) / len(kernels)) if kernels else 0.0
+    rows, total = [], table['run_overhead_cycles']
+    for name, _, function, macc in nodes:
+        k = kernels.get(function)
+        cycles = k['cycles_per_macc'] * macc + k['fixed_cycles'] if k else mean * macc
+        rows.append((name, function, macc, cycles, k is not None))
+        total += cycles
+    return rows, total
+
+
+def table_report(table):
+    lines = [f"{'function':<44}{'cycles/MACC':>12}{'fixed':>10}{'shapes':>8}"]
+    for function, k in table['kernels'].items():
+        lines.append(f"{function:<44}{k['cycles_per_macc']:>12.3f}{k['fixed_cycles']:>10.0f}"
+                     f"{len(k['points']):>8}")
+    lines.append(f"{'run overhead':<44}{'':>12}{table['run_overhead_cycles']:>10.0f}")
+    return "\n".join(lines)
+
+
+def prediction_report(name, rows, total, cpu_hz):
+    lines = [f"{name}: {total:.0f} cycles, {total / cpu_hz * 1e3:.2f} ms"]
+    for node, function, macc, cycles, known in rows:
+        lines.append(f"  {node:<20}{function:<44}{macc:>10}{cycles:>12.0f}{'' if known else ' ?'}")
+    return "\n".join(lines)
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    sub = ap.add_subparsers(dest='command', required=True)
+    p = sub.add_parser('calibrate', help="measure the registered models into a table")
+    p.add_argument('reports', nargs='+', help="c_info JSON of each registered model, MODEL_LIST order")
+    p.add_argument('--port', required=True)
+    p.add_argument('--baud', type=int, default=921600)
+    p.add_argument('--rtscts', action='store_true')
+    p.add_argument('--count', type=int, default=50, help="images per model")
+    p.add_argument('--table', default='latency.json', help="output (default %(default)s)")
+    p = sub.add_parser('predict', help="estimate the latency of models from a table")
+    p.add_argument('table')
+    p.add_argument('models', nargs='+', help="c_info JSON reports or .tflite files")
+    p.add_argument('--max-ms', type=float, help="only list the models predicted within this run time")
+    p.add_argument('--tool', default='stedgeai')
+    p.add_argument('-v', '--verbose', action='store_true', help="per node costs")
+    args = ap.parse_args(argv)
+
+    if args.command == 'calibrate':
+        conn, link, baud = open_device(args.port, args.baud, args.rtscts)
+        try:
+            print(f"{args.port} @ {baud} baud, {len(args.reports)} models, {args.count} images each")
+            table = calibrate(link, args.reports, synthetic_images(args.count))
+        except DeviceError as e:
+            if e.code != protocol.ERR_TYPE:
+                raise
+            raise SystemExit("no layer profile, build the firmware with APP_PROFILE_LAYERS=1")
+        finally:
+            conn.close()
+        with open(args.table, 'w', encoding='utf-8') as f:
+            json.dump(table, f, indent=1)
+        print(table_report(table))
+        print(f"written to {args.table}")
+        return 0
+
+    with open(args.table, encoding='utf-8') as f:
+        table = json.load(f)
+    predictions = []
+    for path in args.models:
+        nodes = analyze(path, args.tool) if path.endswith('.tflite') else load_c_info(path)
+        rows, total = predict(table, nodes)
+        predictions.append((total, os.path.basename(path), rows))
+    cpu_hz = table['cpu_hz']
+    for total, name, rows in sorted(predictions):
+        if args.max_ms is not None and total / cpu_hz * 1e3 > args.max_ms:
+            continue
+        if args.verbose:
+            print(prediction_report(name, rows, total, cpu_hz))
+        else:
+            unknown = sum(not known for *_, known in rows)
+            print(f"{name:<56}{total:>12.0f} cycles{total / cpu_hz * 1e3:>8.2f} ms"
+                  f"{f'  {unknown} unknown' if unknown else ''}")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
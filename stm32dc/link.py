@@ -0,0 +1,870 @@
+"""Request/response session with the classifier over a serial-like port."""
+import struct
+import threading
+import time
+
+from . import protocol
+
+IMAGE_SIZE = 784
+
+# Rate the firmware boots at and falls back to
+DEFAULT_BAUD = 115200
+# Mirrors BAUD_CONFIRM_MS: the device reverts if not spoken to at the new rate
+BAUD_CONFIRM_TIMEOUT = 1.0
+# PINGs at the requested rate before falling back to DEFAULT_BAUD
+WARM_PROBE_TIMEOUT = 0.25
+# Per WCET run, generous: a cold run of the largest registered network
+WCET_TIMEOUT = 0.05
+# Line bits per byte, 8N1
+BYTE_BITS = 10
+
+# Requests answered after one inference or none, timed by Timeouts
+INFERENCE_COMMANDS = (protocol.CMD_CLASSIFY, protocol.CMD_CLASSIFY_PACKED, protocol.CMD_CLASSIFY_CROP,
+                      protocol.CMD_CLASSIFY_PROF, protocol.CMD_CLASSIFY_TOPK, protocol.CMD_CLASSIFY_SMALL,
+                      protocol.CMD_EMBED, protocol.CMD_HEADS)
+# Requests that classify, whatever their run time
+CLASSIFY_COMMANDS = frozenset(INFERENCE_COMMANDS + (protocol.CMD_BATCH, protocol.CMD_CLASSIFY_CASCADE,
+                                                    protocol.CMD_CLASSIFY_ANYTIME, protocol.CMD_CLASSIFY_TTA,
+                                                    protocol.CMD_STRIP))
+TIMED_COMMANDS = frozenset(INFERENCE_COMMANDS + (protocol.CMD_PING, protocol.CMD_MEMSTAT, protocol.CMD_STATS,
+                                                 protocol.CMD_SELECT_MODEL, protocol.CMD_CLOCK_SYNC,
+                                                 protocol.CMD_CANCEL))
+
+
+class DeviceError(Exception):
+    """The device answered a request with an error frame"""
+
+    def __init__(self, code):
+        self.code = code
+        super().__init__(protocol.describe_error(bytes([code])))
+
+
+class DeviceBusy(DeviceError):
+    """The device refused a request for want of a slot and said when to try again (APP_ADMISSION)"""
+
+    def __init__(self, busy):
+        super().__init__(protocol.ERR_BUSY)
+        self.ahead = busy.ahead
+        self.retry_after = busy.retry_after  # seconds
+        self.args = (f"{self.args[0]} ({busy.ahead} ahead, retry in {busy.retry_after * 1e3:.1f} ms)",)
+
+
+def decode_classify(frame):
+    """Digit from a CLASSIFY reply, None if the device found the image blank"""
+    if not frame.payload:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return None if frame.payload[0] == protocol.CLASS_BLANK else frame.payload[0]
+
+
+def decode_batch(frame):
+    """One digit per image from a BATCH reply, None where it was lost, failed or blank"""
+    return [None if c in (protocol.CLASS_NONE, protocol.CLASS_BLANK) else c for c in frame.payload]
+
+
+def batch_frames(images):
+    """The BATCH_IMAGE frames of a batch, seq being each image's index"""
+    return b''.join(protocol.encode_frame(protocol.CMD_BATCH_IMAGE, index, bytes(img))
+                    for index, img in enumerate(images))
+
+
+def decode_embed(frame):
+    """protocol.Embedding from an EMBED reply"""
+    if len(frame.payload) < protocol.EMBED.size or \
+            len(frame.payload) != protocol.EMBED.size + protocol.EMBED.unpack_from(frame.payload)[2]:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return protocol.decode_embed(frame.payload)
+
+
+def decode_heads(frame):
+    """protocol.Heads from a HEADS reply"""
+    if len(frame.payload) != protocol.HEADS.size:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return protocol.decode_heads(frame.payload)
+
+
+def decode_cascade(frame):
+    """protocol.Cascade from a CLASSIFY_CASCADE reply"""
+    if len(frame.payload) != protocol.CASCADE.size:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return protocol.decode_cascade(frame.payload)
+
+
+def decode_anytime(frame):
+    """protocol.Anytime from a CLASSIFY_ANYTIME reply"""
+    if len(frame.payload) != protocol.ANYTIME.size:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return protocol.decode_anytime(frame.payload)
+
+
+def decode_tta(frame):
+    """protocol.Tta from a CLASSIFY_TTA reply"""
+    if len(frame.payload) != protocol.TTA.size:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return protocol.decode_tta(frame.payload)
+
+
+def decode_knn(frame):
+    """protocol.Knn from a KNN reply"""
+    if len(frame.payload) != protocol.KNN.size:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return protocol.decode_knn(frame.payload)
+
+
+def decode_stage(frame):
+    """protocol.Stage from a STAGE reply, its boundary checked against its size"""
+    if len(frame.payload) < protocol.STAGE.size:
+        raise DeviceError(protocol.ERR_LENGTH)
+    stage = protocol.decode_stage(frame.payload)
+    if len(stage.boundary) != (stage.size if stage.stage == protocol.STAGE_FRONT else 0):
+        raise DeviceError(protocol.ERR_LENGTH)
+    return stage
+
+
+def decode_strip(frame):
+    """protocol.Strip from a STRIP reply"""
+    if len(frame.payload) < protocol.STRIP.size or \
+            len(frame.payload) != protocol.STRIP.size + 2 * frame.payload[0]:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return protocol.decode_strip(frame.payload)
+
+
+def strip_payload(strip, stride=0):
+    """STRIP request payload of a 28 x W uint8 image, row-major"""
+    data = bytes(strip)
+    width = len(data) // protocol.STRIP_HEIGHT
+    if width * protocol.STRIP_HEIGHT != len(data) or not 28 <= width <= protocol.STRIP_MAX:
+        raise ValueError(f"a strip is 28 rows of 28 to {protocol.STRIP_MAX} pixels, got {len(data)} bytes")
+    return protocol.STRIP_REQ.pack(width, stride) + data
+
+
+def from_memo(frame):
+    """True if an APP_MEMO device answered a CLASSIFY without running the network"""
+    return len(frame.payload) > 1 and bool(frame.payload[1] & protocol.RESULT_MEMO)
+
+
+def from_gate(frame):
+    """True if an APP_DELTA_GATE device answered a CLASSIFY with the last image's class"""
+    return len(frame.payload) > 1 and bool(frame.payload[1] & protocol.RESULT_GATED)
+
+
+def decode_topk(frame):
+    """[(digit, probability)] from a CLASSIFY_TOPK reply"""
+    if len(frame.payload) < protocol.TOPK_HEADER.size:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return protocol.decode_topk(frame.payload)
+
+
+def decode_profiled(frame):
+    """(digit, Profile) from a CLASSIFY_PROF reply"""
+    if len(frame.payload) != protocol.PROFILE.size:
+        raise DeviceError(protocol.ERR_LENGTH)
+    return protocol.decode_profile(frame.payload)
+
+
+class LinkQuality:
+    """Outcomes of requests on the host side since the last reset"""
+
+    def __init__(self):
+        self.reset()
+
+    def reset(self):
+        self.frames = 0          # replies that arrived intact
+        self.crc = 0             # replies that failed their CRC on the host
+        self.timeouts = 0        # attempts that got no reply
+        self.device_crc = 0      # requests the device answered ERR_CRC
+        self.line = 0            # ERR_UART line errors the device reported
+
+    @property
+    def errors(self):
+        return self.crc + self.timeouts + self.device_crc + self.line
+
+    def permille(self):
+        """Errors per 1000 frames, an error counting as a frame"""
+        total = self.frames + self.errors
+        return 1000.0 * self.errors / total if total else 0.0
+
+    def device_error(self, payload):
+        """Count an ERROR frame's payload, whatever request it answers"""
+        code = payload[0] if payload else protocol.ERR_NONE
+        if code == protocol.ERR_CRC:
+            self.device_crc += 1
+        elif code == protocol.ERR_UART and len(payload) > 1 and payload[1] & protocol.UART_ERROR_LINE:
+            self.line += 1
+
+
+class Timeouts:
+    """Reply timeouts worked out per request rather than one fixed RESPONSE_TIMEOUT
+
+    A TIMED_COMMANDS request waits for the wire time of its frame and a
+    reply at the port's current rate, MARGIN times the longest the device
+    recently took over that command, and SLACK for the USB adapter and the
+    host; each request queued ahead of it on the device adds its share.
+    What a command took decays by DECAY a reply, so one slow run stops
+    counting after a few hundred. A command not seen yet, and every other
+    one (a BATCH, STRIP or UPLOAD runs as long as its payload asks), keeps
+    fallback. calibrate() seeds the inference commands with the p99 of the
+    device's own frame times from STATS, so even the first CLASSIFY that
+    goes unanswered is noticed in tens of ms rather than seconds.
+    """
+    SLACK = 0.03
+    MARGIN = 3.0
+    DECAY = 0.995
+    REPLY_BYTES = protocol.OVERHEAD + 16
+
+    def __init__(self, port, fallback):
+        self.port = port
+        self.fallback = fallback
+        self.run = {}           # command -> seconds the device took, decaying
+
+    def wire(self, nbytes):
+        return nbytes * BYTE_BITS / self.port.baudrate
+
+    def timeout(self, cmd, request_bytes, ahead=0):
+        """Seconds to wait for the reply to a request of request_bytes, ahead others before it"""
+        run = self.run.get(cmd & ~protocol.PRIORITY_FLAG)
+        if run is None:
+            return self.fallback
+        return self.SLACK + (1 + ahead) * (self.wire(request_bytes + self.REPLY_BYTES) + self.MARGIN * run)
+
+    def observe(self, cmd, seconds):
+        """A reply to cmd after the device held the request for seconds"""
+        cmd &= ~protocol.PRIORITY_FLAG
+        if cmd in TIMED_COMMANDS:
+            self.run[cmd] = max(seconds, self.run.get(cmd, 0.0) * self.DECAY)
+
+    def observe_round_trip(self, cmd, rtt, request_bytes, reply_bytes):
+        """The same from a round trip nothing else shared, less the wire time both ways"""
+        self.observe(cmd, max(0.0, rtt - self.wire(request_bytes + reply_bytes)))
+
+    def calibrate(self, stats):
+        """Seed the inference commands from a protocol.Stats"""
+        frame = stats.percentile(stats.frame_hist, 0.99) / 1e6
+        if frame:
+            for cmd in INFERENCE_COMMANDS:
+                self.run.setdefault(cmd, frame)
+
+
+class ClassifierLink:
+    """Framed requests over an open port (pyserial ``Serial`` or compatible)"""
+
+    RESPONSE_TIMEOUT = 2.0
+    MAX_ATTEMPTS = 3
+    # Wire time of one image frame at 115200 baud is ~70 ms, plus inference
+    BATCH_IMAGE_TIMEOUT = 0.1
+
+    def __init__(self, port):
+        self.port = port
+        self.reader = protocol.FrameReader(port)
+        self.encoder = protocol.FrameEncoder()
+        self.seq = 0
+        self.packer = protocol.ImagePacker()
+        self.memo_hits = 0      # CLASSIFY replies from the device's memo (APP_MEMO)
+        self.gate_hits = 0      # CLASSIFY replies reusing the last image's class (APP_DELTA_GATE)
+        self.caps = None        # last probe() answer
+        self.quality = LinkQuality()    # request outcomes, for a governor
+        self.timeouts = Timeouts(port, self.RESPONSE_TIMEOUT)
+        self.governor = None    # linkq.BaudGovernor stepping the baud rate, if any
+        self._governing = False
+        self.on_telemetry = None    # called with each protocol.Telemetry the device pushes
+
+    def next_seq(self):
+        """1 to 255: seq 0 is the device's own, on ERR_UART reports and telemetry pushes"""
+        self.seq = self.seq % 0xFF + 1
+        return self.seq
+
+    def wait_for(self, seq, timeout):
+        """Return the next frame carrying seq, skipping stale replies"""
+        deadline = time.monotonic() + timeout
+        while True:
+            frame = self.reader.read_frame(max(0.0, deadline - time.monotonic()))
+            if frame is None or frame.seq == seq:
+                return frame
+            if frame.type == protocol.TYPE_ERROR:
+                # Unsolicited ERR_UART reports, seq 0
+                self.quality.device_error(frame.payload)
+            elif frame.type == protocol.response_type(protocol.CMD_TELEMETRY) and self.on_telemetry:
+                self.on_telemetry(protocol.decode_telemetry(frame.payload))
+
+    def request(self, cmd, payload=b'', timeout=None):
+        """Send cmd and return its response frame.
+
+        Each attempt uses a fresh seq so a late reply to an earlier attempt
+        is ignored. A CRC error, a frame the device timed out or a timeout
+        triggers a resend. Outcomes are counted in self.quality; with a
+        governor set, it may change the baud rate after the request, and a
+        request that got no reply at all is tried once more after it found
+        the device again.
+        """
+        try:
+            return self._request(cmd, payload, timeout)
+        except TimeoutError:
+            if not self._govern(recover=True):
+                raise
+            return self._request(cmd, payload, timeout)
+        finally:
+            self._govern()
+
+    def _request(self, cmd, payload, timeout):
+        size = protocol.OVERHEAD + len(payload)
+        timed = timeout is None
+        error = None
+
+        for _ in range(self.MAX_ATTEMPTS):
+            seq = self.next_seq()
+            if timed:
+                timeout = self.timeouts.timeout(cmd, size)
+            self.port.write(self.encoder.encode(cmd, seq, payload))
+            sent = time.perf_counter()
+
+            crc_errors = self.reader.crc_errors
+            frame = self.wait_for(seq, timeout)
+            self.quality.crc += self.reader.crc_errors - crc_errors
+            if frame is None:
+                self.quality.timeouts += 1
+                continue
+
+            if frame.type == protocol.TYPE_ERROR:
+                code = frame.payload[0] if frame.payload else protocol.ERR_NONE
+                busy = protocol.decode_busy(frame.payload)
+                error = DeviceError(code) if busy is None else DeviceBusy(busy)
+                self.quality.device_error(frame.payload)
+                if code in (protocol.ERR_CRC, protocol.ERR_TIMEOUT):
+                    continue
+                raise error
+
+            if frame.type == protocol.response_type(cmd):
+                self.quality.frames += 1
+                self.timeouts.observe_round_trip(cmd, time.perf_counter() - sent, size,
+                                                 protocol.OVERHEAD + len(frame.payload))
+                return frame
+
+        if error is not None:
+            raise error
+        raise TimeoutError("No response from STM32")
+
+    def _govern(self, recover=False):
+        """Run the governor outside its own requests; True if recover() found the device"""
+        if self.governor is None or self._governing:
+            return False
+        self._governing = True
+        try:
+            if recover:
+                return self.governor.recover() is not None
+            self.governor.after_request()
+            return False
+        except (DeviceError, TimeoutError):
+            return False
+        finally:
+            self._governing = False
+
+    def probe(self, timeout=2.0, interval=0.02):
+        """PING every interval until the device answers, returns its Capabilities.
+
+        Replaces waiting a fixed time for the boot banner: the first reply
+        proves the firmware is parsing frames. Returns None for firmware
+        that predates PING (it answers ERR_TYPE, which is just as good).
+        """
+        deadline = time.monotonic() + timeout
+        while time.monotonic() < deadline:
+            seq = self.next_seq()
+            self.port.write(protocol.encode_frame(protocol.CMD_PING, seq))
+            frame = self.wait_for(seq, min(interval, max(0.0, deadline - time.monotonic())))
+            if frame is None:
+                continue
+            if frame.type == protocol.response_type(protocol.CMD_PING):
+                if len(frame.payload) not in protocol.CAPS_SIZES:
+                    raise DeviceError(protocol.ERR_LENGTH)
+                self.caps = protocol.decode_caps(frame.payload)
+                return self.caps
+            if frame.type == protocol.TYPE_ERROR:
+                code = frame.payload[0] if frame.payload else protocol.ERR_NONE
+                if code == protocol.ERR_TYPE:
+                    return None
+                # CRC/UART errors while the line settles: ping again
+        raise TimeoutError("No response from STM32")
+
+    def set_baud(self, baud):
+        """Switch device and port to baud, returns the rate in use.
+
+        The device acks at the old rate and switches; the ack is then
+        confirmed at the new rate. If that fails both sides end up back at
+        DEFAULT_BAUD.
+        """
+        payload = struct.pack('<I', baud)
+        if baud == self.port.baudrate:
+            return baud
+
+        try:
+            self.request(protocol.CMD_SET_BAUD, payload)
+        except DeviceError as e:
+            if e.code == protocol.ERR_PARAM:
+                return self.port.baudrate
+            raise
+
+        self.port.baudrate = baud
+        self.reader.buffer.clear()
+        try:
+            self.request(protocol.CMD_SET_BAUD, payload,
+                         timeout=BAUD_CONFIRM_TIMEOUT / (self.MAX_ATTEMPTS + 1))
+            return baud
+        except (DeviceError, TimeoutError):
+            pass
+
+        # Let the device time out and revert before talking at the boot rate
+        self.port.baudrate = DEFAULT_BAUD
+        time.sleep(BAUD_CONFIRM_TIMEOUT)
+        self.reader.buffer.clear()
+        return DEFAULT_BAUD
+
+    def connect(self, baud):
+        """Reach the device at baud, returns the rate in use; Capabilities in self.caps.
+
+        A board with saved settings (CONFIG) boots at the saved rate, so a
+        PING there is tried first and nothing is negotiated. Otherwise the
+        board is reached at DEFAULT_BAUD, where one at another saved rate
+        also returns once those PINGs went unanswered for
+        BAUD_CONFIRM_TIMEOUT, and set_baud() switches.
+        """
+        if baud != DEFAULT_BAUD:
+            self.port.baudrate = baud
+            try:
+                self.probe(timeout=WARM_PROBE_TIMEOUT)
+                return baud
+            except TimeoutError:
+                pass
+            self.port.baudrate = DEFAULT_BAUD
+            self.reader.buffer.clear()
+        self.probe(timeout=self.RESPONSE_TIMEOUT + BAUD_CONFIRM_TIMEOUT)
+        return self.set_baud(baud)
+
+    def config(self, op=protocol.CONFIG_GET):
+        """Save, clear or read the settings the device boots with (protocol.DeviceConfig).
+
+        Needs firmware built with APP_CONFIG, else DeviceError(ERR_TYPE).
+        """
+        frame = self.request(protocol.CMD_CONFIG, bytes((op,)))
+        if len(frame.payload) != protocol.CONFIG.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return protocol.DeviceConfig(*protocol.CONFIG.unpack(frame.payload))
+
+    def set_clock(self, profile):
+        """Switch the device clock profile (name or number), returns HCLK Hz.
+
+        The device keeps the current baud rate when the new APB1 clock can
+        still generate it.
+        """
+        profile = protocol.CLOCK_PROFILES.get(profile, profile)
+        frame = self.request(protocol.CMD_SET_CLOCK, bytes([profile]))
+        return struct.unpack('<I', frame.payload)[0]
+
+    def classify(self, image):
+        """Classify one 28x28 uint8 image, returns the digit"""
+        frame = self.request(protocol.CMD_CLASSIFY, bytes(image))
+        self.memo_hits += from_memo(frame)
+        self.gate_hits += from_gate(frame)
+        return decode_classify(frame)
+
+    def classify_packed(self, image, full=False):
+        """Classify one image sent in its shortest encoding, DELTA when repeated"""
+        try:
+            frame = self.request(protocol.CMD_CLASSIFY_PACKED, self.packer.pack(image, full))
+        except DeviceError as e:
+            if e.code != protocol.ERR_PARAM or full:
+                raise
+            # Device lost the delta base (reset, lost frame)
+            return self.classify_packed(image, full=True)
+        self.memo_hits += from_memo(frame)
+        self.gate_hits += from_gate(frame)
+        return decode_classify(frame)
+
+    def classify_strokes(self, body):
+        """Classify strokes (protocol.pack_strokes body) the device rasterises itself.
+        Firmware without the STROKES encoding answers DeviceError(ERR_PARAM)"""
+        frame = self.request(protocol.CMD_CLASSIFY_PACKED, self.packer.pack_strokes(body))
+        self.memo_hits += from_memo(frame)
+        self.gate_hits += from_gate(frame)
+        return decode_classify(frame)
+
+    def classify_crop(self, crop):
+        """Classify a 2-D ink crop of up to CROP_MAX a side, framed and resized on the device"""
+        return decode_classify(self.request(protocol.CMD_CLASSIFY_CROP, protocol.pack_crop(crop)))
+
+    def classify_small(self, image, model=None):
+        """Classify a 14x14 image (preprocess.downsample), a quarter of the bytes.
+
+        The device doubles it to 28x28. It is meant for the small model
+        (APP_MODEL_SMALL), active or named by index for this request alone;
+        other models see a blurred digit.
+        """
+        payload = bytes(image) + (b'' if model is None else bytes([model]))
+        frame = self.request(protocol.CMD_CLASSIFY_SMALL, payload)
+        self.memo_hits += from_memo(frame)
+        self.gate_hits += from_gate(frame)
+        return decode_classify(frame)
+
+    def classify_anytime(self, image, deadline_us=0, min_margin=0):
+        """Classify one image under a deadline, returns protocol.Anytime.
+
+        Needs firmware built with APP_ANYTIME. gemm_5 runs a slice of rows
+        at a time with gemm_6 after each; the device answers once the digit
+        cannot change, leads by min_margin (0: never), or the next slice
+        would end past deadline_us from the request's start (0: none).
+        """
+        payload = bytes(image) + protocol.ANYTIME_REQ.pack(deadline_us, min_margin)
+        return decode_anytime(self.request(protocol.CMD_CLASSIFY_ANYTIME, payload))
+
+    def classify_tta(self, image, min_margin, variants=protocol.TTA_VARIANTS):
+        """Classify one image, voting over variants of it when unsure; returns protocol.Tta.
+
+        Needs firmware built with APP_TTA. When the digit leads by less than
+        min_margin (0: never), the device classifies up to variants shifted
+        and zoomed copies too, gemm_5 once for all of them, and answers the
+        digit most of them agree on.
+        """
+        payload = bytes(image) + protocol.TTA_REQ.pack(min_margin, variants)
+        return decode_tta(self.request(protocol.CMD_CLASSIFY_TTA, payload))
+
+    def classify_topk(self, image, k=protocol.TOPK_DEFAULT):
+        """Classify one image, returns [(digit, probability)] best first"""
+        return decode_topk(self.request(protocol.CMD_CLASSIFY_TOPK, bytes(image) + bytes([k])))
+
+    def classify_scores(self, image):
+        """Raw int8 output of one image in class order, returns (scale, zero_point, scores)"""
+        frame = self.request(protocol.CMD_CLASSIFY_TOPK, bytes(image) + bytes([protocol.TOPK_MAX]))
+        scale, zero_point, ranked = protocol.decode_topk_scores(frame.payload)
+        scores = [None] * len(ranked)
+        for digit, score in ranked:
+            if digit >= len(scores):
+                raise DeviceError(protocol.ERR_LENGTH)
+            scores[digit] = score
+        return scale, zero_point, scores
+
+    def classify_profiled(self, image):
+        """Classify one image, returns (digit, Profile) with stage timings"""
+        return decode_profiled(self.request(protocol.CMD_CLASSIFY_PROF, bytes(image)))
+
+    def classify_cascade(self, image, first, full, min_margin=protocol.CASCADE_MARGIN_DEFAULT):
+        """Classify with model first, falling back to model full below min_margin (protocol.Cascade)"""
+        payload = bytes(image) + protocol.CASCADE_REQ.pack(first, full, min_margin)
+        return decode_cascade(self.request(protocol.CMD_CLASSIFY_CASCADE, payload))
+
+    def kernel_bench(self, image, kernel=protocol.KERNEL_CONV):
+        """Time a layer on the library and its custom kernel (protocol.KernelBench)"""
+        frame = self.request(protocol.CMD_KERNEL_BENCH, bytes(image) + bytes((kernel,)))
+        if len(frame.payload) != protocol.KERNEL_BENCH.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return protocol.decode_kernel_bench(frame.payload)
+
+    def nn_bench(self, image):
+        """Each layer on the library and on CMSIS-NN, same image (protocol.NnBench).
+
+        Needs firmware built with APP_CMSIS_NN and APP_PROFILE, else
+        DeviceError(ERR_TYPE).
+        """
+        frame = self.request(protocol.CMD_NN_BENCH, bytes(image))
+        try:
+            return protocol.decode_nn_bench(frame.payload)
+        except (ValueError, struct.error):
+            raise DeviceError(protocol.ERR_LENGTH) from None
+
+    def select_model(self, index=None):
+        """Switch the device to registered model index (None only asks), returns protocol.ModelSel.
+
+        probe() afterwards to read the new model's classes and signature.
+        """
+        payload = b'' if index is None else bytes([index])
+        frame = self.request(protocol.CMD_SELECT_MODEL, payload)
+        if len(frame.payload) != protocol.MODEL_SEL.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return protocol.decode_model_sel(frame.payload)
+
+    def upload(self, op, model=0, arg=0, data=b'', timeout=None):
+        """One UPLOAD request (protocol.Upload), see upload_weights"""
+        payload = protocol.UPLOAD_REQ.pack(op, model, arg) + bytes(data)
+        frame = self.request(protocol.CMD_UPLOAD, payload, timeout=timeout)
+        if len(frame.payload) != protocol.UPLOAD.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return protocol.decode_upload(frame.payload)
+
+    def upload_weights(self, model, blob, chunk=2048, progress=None):
+        """Program blob as the weights of registered model index and commit it.
+
+        Needs firmware built with APP_UPLOAD, else DeviceError(ERR_TYPE).
+        BEGIN erases a flash sector first, or the blocks of a streamed
+        model's external flash slot, hence its long timeout. A chunk resent
+        after a lost reply is accepted again. progress(sent, total) is
+        called after each chunk. Returns the COMMIT reply.
+        """
+        blob = bytes(blob)
+        if len(blob) % 4 or chunk % 4:
+            raise ValueError("the blob and the chunks must be whole 32-bit words")
+        self.upload(protocol.UPLOAD_BEGIN, model, len(blob),
+                    protocol.CRC.pack(protocol.crc32(blob)), timeout=15.0)
+        for offset in range(0, len(blob), chunk):
+            self.upload(protocol.UPLOAD_DATA, model, offset, blob[offset:offset + chunk])
+            if progress:
+                progress(min(offset + chunk, len(blob)), len(blob))
+        return self.upload(protocol.UPLOAD_COMMIT, model, timeout=2.0)
+
+    def stage(self, stage, data, split=0, flags=0):
+        """Run one stage of the network split across boards (protocol.Stage).
+
+        Needs firmware built with APP_SPLIT. FRONT takes an image and
+        returns the boundary tensor, BACK takes that tensor and returns the
+        class; split 0 is the firmware's default cut. A FRONT with
+        STAGE_FORWARD is answered by the back board wired to the device, as
+        a BACK.
+        """
+        payload = protocol.STAGE_REQ.pack(stage, split, flags) + bytes(data)
+        return decode_stage(self.request(protocol.CMD_STAGE, payload))
+
+    def embed(self, image):
+        """Classify an image and return what the last dense layer read (protocol.Embedding).
+
+        Needs firmware built with APP_EMBED; stm32dc.knn indexes these.
+        """
+        return decode_embed(self.request(protocol.CMD_EMBED, bytes(image)))
+
+    def classify_heads(self, image, heads=0):
+        """Run the backbone once and the heads in the mask, 0 for all (protocol.Heads).
+
+        Needs firmware built with APP_MODEL_MULTIHEAD and the multihead model
+        active (SELECT_MODEL); bit protocol.HEAD_DIGITS is the digits head,
+        protocol.HEAD_LETTERS the EMNIST balanced one.
+        """
+        return decode_heads(self.request(protocol.CMD_HEADS, bytes(image) + bytes([heads])))
+
+    def knn(self, op, image=b'', label=0):
+        """KNN_CLASSIFY or KNN_ENROLL an image, or KNN_CLEAR the table (protocol.Knn).
+
+        Needs firmware built with APP_KNN; labels are 0 to 254.
+        """
+        payload = protocol.KNN_REQ.pack(op, label) + bytes(image)
+        return decode_knn(self.request(protocol.CMD_KNN, payload))
+
+    def classify_strip(self, strip, stride=0):
+        """Classify every 28x28 window of a 28 x W strip (protocol.Strip).
+
+        Needs firmware built with APP_STRIP. Windows start every stride
+        pixels, a multiple of STRIP_STRIDE, 0 for STRIP_STRIDE itself; the
+        device runs the convolutions once over the whole strip.
+        """
+        return decode_strip(self.request(protocol.CMD_STRIP, strip_payload(strip, stride)))
+
+    def clock_sync(self, flags=None):
+        """(perf_counter at send, perf_counter at reply, protocol.ClockSyncReply)
+
+        Needs firmware built with APP_TIMESTAMPS. flags (SYNC_*) set the
+        device's reply stamping, None leaves it as it is; see clocksync.
+        """
+        sent = time.perf_counter()
+        frame = self.request(protocol.CMD_CLOCK_SYNC, bytes((flags,)) if flags is not None else b'')
+        received = time.perf_counter()
+        if len(frame.payload) != protocol.CLOCK_SYNC.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return sent, received, protocol.decode_clock_sync(frame.payload)
+
+    def memory_stats(self):
+        """SRAM budget and stack high-water mark (protocol.MemStats)"""
+        frame = self.request(protocol.CMD_MEMSTAT)
+        if len(frame.payload) != protocol.MEMSTAT.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return protocol.decode_memstat(frame.payload)
+
+    def stats(self, reset=False):
+        """Device counters and cycle histograms (protocol.Stats), optionally zeroed after"""
+        frame = self.request(protocol.CMD_STATS, bytes((protocol.STATS_RESET,)) if reset else b'')
+        if len(frame.payload) != protocol.STATS.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return protocol.decode_stats(frame.payload)
+
+    def telemetry(self, interval_ms):
+        """Have the device push telemetry every interval_ms (0 stops), returns its protocol.Telemetry.
+
+        Needs firmware built with APP_TELEMETRY, else DeviceError(ERR_TYPE).
+        The pushes reach self.on_telemetry while requests wait for replies.
+        """
+        frame = self.request(protocol.CMD_TELEMETRY, protocol.TELEMETRY_REQ.pack(interval_ms))
+        if len(frame.payload) < protocol.TELEMETRY.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return protocol.decode_telemetry(frame.payload)
+
+    def calibrate(self):
+        """Seed self.timeouts from the device's frame times; False for firmware without STATS
+
+        A board that has not classified since boot has none yet: its
+        first replies teach the timeouts instead.
+        """
+        try:
+            self.timeouts.calibrate(self.stats())
+            return True
+        except DeviceError:
+            return False
+
+    def flash(self, flags=None):
+        """Set the ART accelerator (protocol.FLASH_* flags, None only asks), returns protocol.FlashConfig.
+
+        Needs firmware built with APP_FLASH_BENCH, else DeviceError(ERR_TYPE).
+        """
+        frame = self.request(protocol.CMD_FLASH, b'' if flags is None else bytes((flags,)))
+        if len(frame.payload) != protocol.FLASH.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return protocol.FlashConfig(*protocol.FLASH.unpack(frame.payload))
+
+    def selftest(self, timeout=30.0):
+        """Classify the firmware's embedded test vectors (protocol.SelfTest).
+
+        Needs firmware built with APP_SELFTEST, else DeviceError(ERR_TYPE).
+        The device answers once all of them have run, hence the long timeout.
+        """
+        frame = self.request(protocol.CMD_SELFTEST, timeout=timeout)
+        if len(frame.payload) != protocol.SELFTEST.size:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return protocol.SelfTest(*protocol.SELFTEST.unpack(frame.payload))
+
+    def wcet(self, runs=0, cold=True, load=False, open=False):
+        """Most cycles per stage over runs network runs (protocol.Wcet).
+
+        cold flushes the ART caches before every run. load keeps the line
+        busy with filler bytes until the reply is in, so receive interrupts
+        hit the runs. open leaves interrupts on during the runs of an
+        APP_DETERMINISTIC build, DeviceError(ERR_PARAM) without it. Needs
+        firmware built with APP_WCET, else DeviceError(ERR_TYPE).
+        """
+        flags = (protocol.WCET_COLD if cold else 0) | (protocol.WCET_OPEN if open else 0)
+        payload = protocol.WCET_REQ.pack(runs, flags)
+        seq = self.next_seq()
+        self.port.write(protocol.encode_frame(protocol.CMD_WCET, seq, payload))
+        done = threading.Event()
+
+        def flood():
+            # Zeros are skipped by the parser while it looks for the magic
+            filler = bytes(256)
+            while not done.is_set():
+                self.port.write(filler)
+
+        loader = threading.Thread(target=flood, name='wcet-load', daemon=True)
+        if load:
+            loader.start()
+        try:
+            frame = self.wait_for(seq, WCET_TIMEOUT * (runs or protocol.WCET_RUNS_DEFAULT))
+        finally:
+            done.set()
+            if load:
+                loader.join()
+        if frame is None:
+            raise TimeoutError("No WCET reply")
+        if frame.type == protocol.TYPE_ERROR:
+            raise DeviceError(frame.payload[0] if frame.payload else protocol.ERR_NONE)
+        try:
+            return protocol.decode_wcet(frame.payload)
+        except (ValueError, struct.error):
+            raise DeviceError(protocol.ERR_LENGTH) from None
+
+    def irq_latency(self, baud=0, runs=0):
+        """RX interrupt latency over runs back-to-back network runs (protocol.IrqLatency).
+
+        The device raises an arrival a byte time of baud apart on average
+        at the host USART's priority. Needs firmware built with
+        APP_IRQ_LATENCY, else DeviceError(ERR_TYPE); ERR_PARAM for a byte
+        time too short to measure.
+        """
+        payload = protocol.IRQ_LAT_REQ.pack(baud, runs)
+        seq = self.next_seq()
+        self.port.write(protocol.encode_frame(protocol.CMD_IRQ_LATENCY, seq, payload))
+        frame = self.wait_for(seq, WCET_TIMEOUT * (runs or protocol.WCET_RUNS_DEFAULT))
+        if frame is None:
+            raise TimeoutError("No IRQ_LATENCY reply")
+        if frame.type == protocol.TYPE_ERROR:
+            raise DeviceError(frame.payload[0] if frame.payload else protocol.ERR_NONE)
+        try:
+            return protocol.decode_irq_latency(frame.payload)
+        except (ValueError, struct.error):
+            raise DeviceError(protocol.ERR_LENGTH) from None
+
+    def energy(self, reset=False, stop=None):
+        """Awake and asleep time, inferences and energy per clock profile (protocol.Energy).
+
+        reset zeroes the counters after this reply. stop, unless None, sets
+        whether idle may enter STOP mode (firmware built with
+        APP_IDLE_STOP_MS, else DeviceError(ERR_PARAM) for True). Needs
+        firmware built with APP_ENERGY, else DeviceError(ERR_TYPE).
+        """
+        flags = protocol.ENERGY_RESET if reset else 0
+        if stop is not None:
+            flags |= protocol.ENERGY_SET_IDLE | (protocol.ENERGY_STOP if stop else 0)
+        frame = self.request(protocol.CMD_ENERGY, bytes((flags,)) if flags else b'')
+        try:
+            return protocol.decode_energy(frame.payload)
+        except (ValueError, struct.error):
+            raise DeviceError(protocol.ERR_LENGTH) from None
+
+    def log(self):
+        """Drain the device log: ([protocol.LogRecord], records lost to a full ring).
+
+        Needs firmware built with APP_LOG, else DeviceError(ERR_TYPE).
+        """
+        records, lost = [], 0
+        while True:
+            frame = self.request(protocol.CMD_LOG)
+            try:
+                batch, dropped = protocol.decode_log(frame.payload)
+            except (ValueError, struct.error):
+                raise DeviceError(protocol.ERR_LENGTH) from None
+            records.extend(batch)
+            lost += dropped
+            if not batch:
+                return records, lost
+
+    def layer_profile(self):
+        """Per-layer timings (name, us) of the device's last inference.
+
+        Needs firmware built with APP_PROFILE_LAYERS, else DeviceError(ERR_TYPE).
+        """
+        frame = self.request(protocol.CMD_PROFILE)
+        if len(frame.payload) < 4:
+            raise DeviceError(protocol.ERR_LENGTH)
+        return protocol.decode_layer_profile(frame.payload)
+
+    def layer_counters(self):
+        """Per-layer cycles and DWT event counts (protocol.LayerCounters) of the last inference.
+
+        The events are modulo 256, stm32dc.swo counts them in full from an
+        APP_ITM_TRACE capture. Needs firmware built with APP_PROFILE_COUNTERS,
+        else DeviceError(ERR_PARAM).
+        """
+        frame = self.request(protocol.CMD_PROFILE, bytes((protocol.PROFILE_COUNTERS,)))
+        try:
+            return protocol.decode_layer_counters(frame.payload)
+        except (ValueError, struct.error):
+            raise DeviceError(protocol.ERR_LENGTH) from None
+
+    def classify_batch(self, images):
+        """Classify many images with one reply per PROTO_MAX_BATCH images.
+
+        Returns one digit per image, None where the device lost or failed
+        that image or found it blank.
+        """
+        images = [bytes(img) for img in images]
+        results = []
+        for start in range(0, len(images), protocol.MAX_BATCH):
+            results.extend(self._batch(images[start:start + protocol.MAX_BATCH]))
+        return results
+
+    def _batch(self, images):
+        seq = self.next_seq()
+        self.port.write(protocol.encode_frame(protocol.CMD_BATCH, seq, bytes([len(images)])) +
+                        batch_frames(images))
+
+        timeout = self.RESPONSE_TIMEOUT + len(images) * self.BATCH_IMAGE_TIMEOUT
+        deadline = time.monotonic() + timeout
+        while True:
+            frame = self.wait_for(seq, max(0.0, deadline - time.monotonic()))
+            if frame is None:
+                raise TimeoutError("No batch response from STM32")
+            if frame.type == protocol.TYPE_ERROR:
+                raise DeviceError(frame.payload[0] if frame.payload else protocol.ERR_NONE)
+            if frame.type == protocol.response_type(protocol.CMD_BATCH):
+                break
+
+        return decode_batch(frame)
@@ -0,0 +1,201 @@
+"""Link quality on both ends of the serial link, and the fastest stable baud rate.
+
+    python -m stm32dc.linkq --port COM9 --max-baud 3000000
+    python -m stm32dc.linkq --port COM9 --max-baud 6000000 --count 3000 --save
+
+The host counts, per 1000 frames, the replies that failed their CRC, the
+requests that timed out and the ERR_UART line errors the device reported
+(overrun, framing, noise). When the firmware has STATS it adds the device's
+own CRC failures and line errors over the same window. BaudGovernor turns
+that into a rate:
+
+- A window at or above --down-permille steps one BAUD_LADDER rate down
+  through SET_BAUD. Each rate stepped down from waits twice as long before
+  it is tried again.
+- --up-after clean frames in a row step one rate up, never past
+  --max-baud. SET_BAUD's confirm at the new rate brings both sides back if
+  the step fails.
+- A request that gets no reply at all probes the lower rates, because the
+  device steps down on its own (APP_LINK_FALLBACK_PERMILLE) when the line
+  is too bad to carry a SET_BAUD.
+
+The tool sends --count CLASSIFY images, which are the largest frames, and
+prints each window. It ends on the rate the link settled at. --save keeps
+that rate for the next boot (CONFIG). ClassifierLink.governor =
+BaudGovernor(link, max_baud) gives any other tool the same policy, and
+bench --auto-baud does this.
+"""
+import argparse
+import sys
+
+from . import protocol
+from .link import DEFAULT_BAUD, WARM_PROBE_TIMEOUT, DeviceError
+
+DEFAULT_WINDOW = 200
+DEFAULT_DOWN_PERMILLE = 20
+DEFAULT_UP_AFTER = 2000
+
+
+def device_errors(stats):
+    """CRC failures and line errors in a protocol.Stats"""
+    return stats.err_crc + stats.uart_overrun + stats.uart_framing + stats.uart_noise
+
+
+class BaudGovernor:
+    """Steps a ClassifierLink's baud rate along BAUD_LADDER from its error rate"""
+
+    def __init__(self, link, max_baud, window=DEFAULT_WINDOW, down_permille=DEFAULT_DOWN_PERMILLE,
+                 up_after=DEFAULT_UP_AFTER):
+        self.link = link
+        self.max_baud = max_baud
+        self.window = window
+        self.down_permille = down_permille
+        self.up_after = up_after
+        self.holdoff = {}        # rate -> clean frames needed before it is tried again
+        self.clean = 0           # clean frames in a row
+        self.device = None       # last STATS, None without APP_STATS
+        self.steps = []          # (from, to, permille) of each change
+        self.windows = []        # (rate, frames, host CRC, timeouts, reported, device, permille)
+        self._stats_start()
+
+    def _stats_start(self):
+        try:
+            self.device = self.link.stats()
+        except (DeviceError, TimeoutError):
+            self.device = None
+
+    def _device_window(self):
+        """(frames, errors) the device saw since the window began, (0, 0) without STATS"""
+        if self.device is None:
+            return 0, 0
+        start = self.device
+        try:
+            self.device = self.link.stats()
+        except (DeviceError, TimeoutError):
+            return 0, 0
+        if self.device.frames < start.frames:
+            # Reset under us (STATS reset, reboot): the window is lost
+            return 0, 0
+        return self.device.frames - start.frames, device_errors(self.device) - device_errors(start)
+
+    def _rate(self, offset):
+        """BAUD_LADDER rate offset steps from the current one, None past either end"""
+        baud = self.link.port.baudrate
+        ladder = protocol.BAUD_LADDER
+        below = [r for r in ladder if r < baud]
+        above = [r for r in ladder if baud < r <= self.max_baud]
+        if offset < 0:
+            return below[-1] if below else None
+        return above[0] if above else None
+
+    def _switch(self, baud, permille):
+        before = self.link.port.baudrate
+        now = self.link.set_baud(baud)
+        self.steps.append((before, now, permille))
+        self.clean = 0
+        self.link.quality.reset()
+        self._stats_start()
+        return now
+
+    def after_request(self):
+        """Called by ClassifierLink.request after each request, success or not"""
+        q = self.link.quality
+        self.clean = self.clean + 1 if q.errors == 0 else 0
+        if q.frames + q.errors < self.window:
+            return
+        frames, errors = self._device_window()
+        permille = max(q.permille(), 1000.0 * errors / frames if frames else 0.0)
+        self.windows.append((self.link.port.baudrate, q.frames, q.crc, q.timeouts,
+                             q.device_crc + q.line, errors, permille))
+        if permille >= self.down_permille:
+            lower = self._rate(-1)
+            if lower is not None:
+                failed = self.link.port.baudrate
+                self.holdoff[failed] = 2 * self.holdoff.get(failed, self.up_after)
+                self._switch(lower, permille)
+                return
+        q.reset()
+        higher = self._rate(+1)
+        if higher is not None and self.clean >= self.holdoff.get(higher, self.up_after):
+            self._switch(higher, permille)
+
+    def recover(self):
+        """Find a device that stepped down: the current rate, then each lower one.
+
+        Returns the rate it answered at, None if it answered at none.
+        """
+        port = self.link.port
+        start = port.baudrate
+        for baud in [start] + [r for r in reversed(protocol.BAUD_LADDER) if DEFAULT_BAUD <= r < start]:
+            port.baudrate = baud
+            self.link.reader.buffer.clear()
+            try:
+                self.link.probe(timeout=WARM_PROBE_TIMEOUT)
+            except TimeoutError:
+                continue
+            if baud != start:
+                self.holdoff[start] = 2 * self.holdoff.get(start, self.up_after)
+                self.steps.append((start, baud, None))
+            self.clean = 0
+            self.link.quality.reset()
+            self._stats_start()
+            return baud
+        port.baudrate = start
+        return None
+
+
+def window_report(w):
+    baud, frames, crc, timeouts, device_reported, device, permille = w
+    return (f"{baud:>9} baud  {frames:>5} frames  host CRC {crc:<4} timeouts {timeouts:<4} "
+            f"device-reported {device_reported:<4} device {device:<4} {permille:7.1f} per 1000")
+
+
+def main(argv=None):
+    from .bench import open_device, synthetic_images
+
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--port', required=True)
+    ap.add_argument('--baud', type=int, default=DEFAULT_BAUD, help="rate to start at (default %(default)s)")
+    ap.add_argument('--max-baud', type=int, default=protocol.BAUD_LADDER[-1],
+                    help="highest rate to try, what the adapter supports")
+    ap.add_argument('--rtscts', action='store_true')
+    ap.add_argument('--count', type=int, default=3000, help="CLASSIFY requests to send")
+    ap.add_argument('--window', type=int, default=DEFAULT_WINDOW, help="frames per judged window")
+    ap.add_argument('--down-permille', type=float, default=DEFAULT_DOWN_PERMILLE,
+                    help="errors per 1000 frames that step the rate down (default %(default)s)")
+    ap.add_argument('--up-after', type=int, default=DEFAULT_UP_AFTER,
+                    help="clean frames in a row before stepping up (default %(default)s)")
+    ap.add_argument('--save', action='store_true', help="boot at the rate found (APP_CONFIG)")
+    args = ap.parse_args(argv)
+
+    conn, link, baud = open_device(args.port, args.baud, args.rtscts)
+    try:
+        print(f"{args.port} @ {baud} baud, up to {args.max_baud}")
+        gov = BaudGovernor(link, args.max_baud, args.window, args.down_permille, args.up_after)
+        link.governor = gov
+        shown = 0
+        for img in synthetic_images(args.count):
+            try:
+                link.classify(img)
+            except (DeviceError, TimeoutError):
+                pass
+            for w in gov.windows[shown:]:
+                print(window_report(w))
+            shown = len(gov.windows)
+        for before, after, permille in gov.steps:
+            why = f"{permille:.1f} per 1000" if permille is not None else "no reply, found by probing"
+            print(f"step          {before} -> {after} baud ({why})")
+        print(f"stable        {conn.baudrate} baud")
+        if args.save:
+            link.governor = None
+            config = link.config(protocol.CONFIG_SAVE)
+            print(f"saved         boots at {config.baud} baud")
+    except DeviceError as e:
+        raise SystemExit(f"{args.port}: {e}")
+    finally:
+        conn.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
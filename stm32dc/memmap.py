@@ -0,0 +1,268 @@
+"""Memory map report from the GNU ld map file of a firmware build.
+
+    python -m stm32dc.memmap tinyML/Debug/tinyML.map
+    python -m stm32dc.memmap tinyML/Debug/tinyML.map --symbols
+
+Lists the allocated output sections per memory region, the region usage
+(.data counts twice: in RAM and as its FLASH load image) and checks the
+placement the linker script promises for the network: .ai_weights 16 byte
+aligned, .ai_activations at the start of SRAM.
+
+The flash the network costs besides its weights is also listed: the
+X-CUBE-AI runtime library's code and constants, and each generated
+X-CUBE-AI/App object. Two builds' reports side by side compare a lite
+graph model (APP_MODEL_LITE) with the layer-object one.
+
+--symbols lists every function and constant the runtime library links,
+largest first, grouped by archive member with the reference that pulled
+the member in (ld links a member only when something names one of its
+symbols, and --gc-sections then drops its unreferenced sections). A
+kernel no registered model uses shows up with its referrer, usually
+kernels.c's library slots or a feature of the firmware that calls into
+the runtime (APP_RUNTIME_MIN drops the report).
+"""
+import argparse
+import re
+import sys
+from typing import NamedTuple, Optional
+
+WEIGHTS_ALIGN = 16
+# Sections the startup copies from a FLASH load image (AT> FLASH in the script);
+# ld prints a load address for the sections after them too
+LOADED = ('.data',)
+
+_REGION = re.compile(r'^(\S+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)(?:\s+(\S+))?$')
+_SECTION = re.compile(r'^(\.\S+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)(?:\s+load address 0x([0-9a-f]+))?')
+_CONTINUED = re.compile(r'^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)(?:\s+load address 0x([0-9a-f]+))?$')
+_SYMBOL = re.compile(r'^\s+0x([0-9a-f]+)\s+(\w+) = ')
+# Input section, its name on the line before when long
+_INPUT = re.compile(r'^ (\.\S+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S+)$')
+_INPUT_CONTINUED = re.compile(r'^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S+)$')
+RUNTIME_LIB = re.compile(r'NetworkRuntime\w*\.a')
+
+
+class Region(NamedTuple):
+    name: str
+    origin: int
+    length: int
+
+    def contains(self, addr):
+        return self.origin <= addr < self.origin + self.length
+
+
+class Section(NamedTuple):
+    name: str
+    addr: int
+    size: int
+    load: Optional[int]
+
+
+def parse_map(text):
+    """(regions, output sections, linker script symbols) of a map file"""
+    regions, sections, symbols = [], [], {}
+    lines = text.splitlines()
+    i = 0
+
+    while i < len(lines) and not lines[i].startswith('Memory Configuration'):
+        i += 1
+    for line in lines[i + 1:]:
+        if line.startswith('Linker script and memory map'):
+            break
+        m = _REGION.match(line)
+        if m and m.group(1) not in ('Name', '*default*'):
+            regions.append(Region(m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+        i += 1
+
+    pending = None
+    for line in lines[i:]:
+        m = _SECTION.match(line)
+        if m:
+            load = int(m.group(4), 16) if m.group(4) else None
+            sections.append(Section(m.group(1), int(m.group(2), 16), int(m.group(3), 16), load))
+            pending = None
+            continue
+        # Long section names put the address on the next line
+        if re.match(r'^\.\S+$', line):
+            pending = line
+            continue
+        if pending:
+            m = _CONTINUED.match(line)
+            if m:
+                load = int(m.group(3), 16) if m.group(3) else None
+                sections.append(Section(pending, int(m.group(1), 16), int(m.group(2), 16), load))
+            pending = None
+            continue
+        m = _SYMBOL.match(line)
+        if m:
+            symbols[m.group(2)] = int(m.group(1), 16)
+
+    return regions, sections, symbols
+
+
+def input_sizes(text, region):
+    """Bytes each input file (archive, or object) places in region"""
+    sizes = {}
+    pending = None
+    for line in text.splitlines():
+        m = _INPUT.match(line)
+        if m:
+            addr, size, src = int(m.group(2), 16), int(m.group(3), 16), m.group(4)
+        elif pending and _INPUT_CONTINUED.match(line):
+            m = _INPUT_CONTINUED.match(line)
+            addr, size, src = int(m.group(1), 16), int(m.group(2), 16), m.group(3)
+        else:
+            pending = re.match(r'^ \.\S+$', line)
+            continue
+        pending = None
+        if size and region.contains(addr):
+            # lib.a(member.o) counts for the archive
+            key = src.split('(')[0] if src.endswith(')') else src
+            sizes[key] = sizes.get(key, 0) + size
+    return sizes
+
+
+def runtime_symbols(text, region):
+    """Runtime library sections in region: ({member: [(section, size)]}, {member: referrer})"""
+    members, pulled = {}, {}
+    lines = text.splitlines()
+    i = 0
+    if lines and lines[0].startswith('Archive member included'):
+        i = 1
+        while i < len(lines) and not lines[i].startswith(('Discarded', 'Allocating', 'Memory')):
+            m = re.match(r'^(\S+\.a)\((\S+)\)$', lines[i])
+            if m and RUNTIME_LIB.search(m.group(1)) and i + 1 < len(lines):
+                pulled[m.group(2)] = lines[i + 1].strip()
+                i += 1
+            i += 1
+
+    pending = None
+    for line in lines[i:]:
+        m = _INPUT.match(line)
+        if m:
+            name, addr, size, src = m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4)
+        elif pending and _INPUT_CONTINUED.match(line):
+            m = _INPUT_CONTINUED.match(line)
+            name, addr, size, src = pending, int(m.group(1), 16), int(m.group(2), 16), m.group(3)
+        else:
+            m = re.match(r'^ (\.\S+)$', line)
+            pending = m.group(1) if m else None
+            continue
+        pending = None
+        lib = re.match(r'^(\S+\.a)\((\S+)\)$', src)
+        if size and region.contains(addr) and lib and RUNTIME_LIB.search(lib.group(1)):
+            members.setdefault(lib.group(2), []).append((name, size))
+    return members, pulled
+
+
+def symbols_report(text, out=sys.stdout):
+    """Per-symbol flash of the runtime library, by member, largest first"""
+    regions, _, _ = parse_map(text)
+    flash = next((r for r in regions if r.name == 'FLASH'), None)
+    if flash is None:
+        return
+    members, pulled = runtime_symbols(text, flash)
+    total = sum(n for sections in members.values() for _, n in sections)
+    print(f"runtime {total} B in {len(members)} members", file=out)
+    for member, sections in sorted(members.items(), key=lambda kv: -sum(n for _, n in kv[1])):
+        print(f"\n{member:<32}{sum(n for _, n in sections):>8} B  pulled by {pulled.get(member, '?')}",
+              file=out)
+        for name, size in sorted(sections, key=lambda s: -s[1]):
+            print(f"  {name:<46}{size:>8}", file=out)
+
+
+def region_of(regions, addr):
+    return next((r for r in regions if r.contains(addr)), None)
+
+
+def placed(regions, sections):
+    """(section, region, load region or None) of every allocated section, by address"""
+    out = []
+    for s in sorted(sections, key=lambda s: s.addr):
+        region = region_of(regions, s.addr)
+        if region is None or s.size == 0:
+            continue
+        load = None
+        if s.name in LOADED and s.load is not None and s.load != s.addr:
+            load = region_of(regions, s.load)
+        out.append((s, region, load))
+    return out
+
+
+def usage(regions, sections):
+    """{region name: bytes used}, a loaded section counting in both regions"""
+    used = {r.name: 0 for r in regions}
+    for s, region, load in placed(regions, sections):
+        used[region.name] += s.size
+        if load is not None:
+            used[load.name] += s.size
+    return used
+
+
+def report(text, out=sys.stdout):
+    """Print the report, returns the placement problems found"""
+    regions, sections, symbols = parse_map(text)
+    used = usage(regions, sections)
+
+    print(f"{'section':<20}{'address':>12}{'size':>10}  region", file=out)
+    for s, region, load in placed(regions, sections):
+        where = region.name if load is None else f"{region.name} (load {load.name})"
+        print(f"{s.name:<20}{s.addr:>#12x}{s.size:>10}  {where}", file=out)
+
+    print(file=out)
+    for r in regions:
+        print(f"{r.name:<8}{used[r.name]:>8} / {r.length:<8} B  "
+              f"{100.0 * used[r.name] / r.length:5.1f}% used, {r.length - used[r.name]} B free",
+              file=out)
+
+    problems = []
+    by_name = {s.name: s for s in sections}
+    weights = by_name.get('.ai_weights')
+    acts = by_name.get('.ai_activations')
+    ram = next((r for r in regions if r.name == 'RAM'), None)
+    if weights is None or weights.size == 0:
+        problems.append(".ai_weights missing or empty")
+    elif symbols.get('__ai_weights_start', weights.addr) % WEIGHTS_ALIGN:
+        problems.append(f".ai_weights not {WEIGHTS_ALIGN} byte aligned")
+    if acts is None or acts.size == 0:
+        problems.append(".ai_activations missing or empty")
+    elif (ram is not None and acts.addr != ram.origin and weights is not None
+          and not ram.contains(weights.addr)):
+        # The RAM debug script puts code first, only FLASH builds pin the pool
+        problems.append(f".ai_activations at {acts.addr:#x}, not the start of RAM")
+
+    print(file=out)
+    for name, s in (('weights', weights), ('activations', acts)):
+        if s is not None and s.size:
+            print(f"{name:<12}{s.size:>8} B at {s.addr:#x}", file=out)
+    flash = next((r for r in regions if r.name == 'FLASH'), None)
+    if flash is not None:
+        sizes = input_sizes(text, flash)
+        runtime = sum(n for src, n in sizes.items() if RUNTIME_LIB.search(src))
+        if runtime:
+            print(f"{'runtime':<12}{runtime:>8} B of X-CUBE-AI library code and constants", file=out)
+        for src, n in sorted(sizes.items()):
+            if 'X-CUBE-AI' in src and src.endswith('.o') and not src.endswith('_data_params.o'):
+                print(f"{'':<12}{n:>8} B {src.replace(chr(92), '/').split('/')[-1]}", file=out)
+    for p in problems:
+        print(f"placement: {p}", file=out)
+    return problems
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('map', help="linker map file (-Wl,-Map, CubeIDE writes <project>.map)")
+    ap.add_argument('--symbols', action='store_true',
+                    help="also list the runtime library's symbols, member by member")
+    args = ap.parse_args(argv)
+
+    with open(args.map, encoding='utf-8', errors='replace') as f:
+        text = f.read()
+    problems = report(text)
+    if args.symbols:
+        print()
+        symbols_report(text)
+    return 1 if problems else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
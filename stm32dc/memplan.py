@@ -0,0 +1,174 @@
+"""Plan a receive frame slot inside the activation arena (APP_RX_OVERLAY).
+
+    python -m stm32dc.memplan tinyML/.ai/network_emnist_digits_int8.tflite_c_info.json
+    python -m stm32dc.memplan tinyML/.ai/*_c_info.json --header tinyML/Core/Inc/overlay_plan.h
+
+The c_info report of a generated network gives every activation buffer its
+offset in the pool and its lifetime in epochs. A c-node's epochs run from
+the first of its outputs and scratch buffers being allocated to the last
+scratch buffer being released, so a buffer is live during the nodes whose
+epochs overlap its own.
+
+For each model the planner finds the earliest c-node from which a region
+of the arena big enough for a CLASSIFY frame stays dead to the end of the
+run, outside the network's input and output tensors. The firmware receives
+the next CLASSIFY into that region from the start of that node on: the
+frame that used to need a second slot in RAM waits in the USART2 ring
+through the early layers and lands in the arena once they are done. The
+run after it reads the image into the input tensor before it touches the
+region, so the frame costs no RAM of its own.
+
+The reports are given in MODEL_LIST order (models.h), one per registered
+model. The arena is the largest of their pools, so a smaller model's
+region may lie past its own pool, dead from its first node. --header
+writes the plan the firmware compiles in; a registered model missing from
+it fails the build with APP_RX_OVERLAY.
+"""
+import argparse
+import json
+import os
+import re
+import sys
+
+# offsetof(ProtoFrame_t, payload): header word, CRC, link, priority, padded to 4
+FRAME_HEADER = 12
+ALIGN = 4
+OUTPUT = os.path.join('Core', 'Inc', 'overlay_plan.h')
+
+
+class Buffer:
+    def __init__(self, b):
+        self.id = b['id']
+        self.name = b['name']
+        self.offset = b['offset_start']
+        self.size = b['size_bytes']
+        self.start = b['epochs']['start']
+        self.end = b['epochs']['end']
+
+
+class Pool:
+    """Activation pool of one c_info report: buffers, node spans, input and output"""
+
+    def __init__(self, path):
+        with open(path, encoding='utf-8') as f:
+            report = json.load(f)
+        self.name = c_name(report, path)
+        pool = next(p for p in report['memory_pools'] if not p.get('persistent'))
+        ids = set(pool['buffers'])
+        self.buffers = {b['id']: Buffer(b) for b in report['buffers'] if b['id'] in ids}
+        self.size = pool['used_size_bytes']
+        graph = report['graphs'][0]
+        self.inputs = [self.buffers[i] for i in graph['inputs'] if i in self.buffers]
+        self.outputs = [self.buffers[i] for i in graph['outputs'] if i in self.buffers]
+        self.nodes = []
+        for node in graph['nodes']:
+            made = [self.buffers[i] for i in node.get('outputs', []) + node.get('scratchs', [])
+                    if i in self.buffers]
+            scratch = [self.buffers[i] for i in node.get('scratchs', []) if i in self.buffers]
+            start = min((b.start for b in made), default=0)
+            end = max([b.end for b in scratch] + [b.start for b in made], default=start)
+            self.nodes.append((node['name'], start, end))
+
+    def image_size(self):
+        return self.inputs[0].size
+
+    def live_from(self, k):
+        """Buffers live during c-node k or any node after it, and the I/O tensors"""
+        live = {b.id: b for b in self.inputs + self.outputs}
+        live.update((b.id, b) for b in self.buffers.values() if b.end >= self.nodes[k][1])
+        return list(live.values())
+
+    def plan(self, size, arena):
+        """(c-node, offset) of the earliest region of size bytes dead to the end of the run"""
+        for k in range(len(self.nodes)):
+            offset = lowest_gap(self.live_from(k), size, arena)
+            if offset is not None:
+                return k, offset
+        return None
+
+
+def c_name(report, path):
+    """Name the network was generated under (ai_<name>_*), from the tool's arguments"""
+    for tool in report.get('environment', {}).get('tools', []):
+        m = re.search(r'--name\s+(\w+)', tool.get('arguments', ''))
+        if m:
+            return m.group(1)
+    return os.path.basename(path).split('_')[0]
+
+
+def lowest_gap(taken, size, arena):
+    """Lowest ALIGN-aligned offset of size free bytes in [0, arena), None if none"""
+    offset = 0
+    for b in sorted(taken, key=lambda b: b.offset):
+        if b.offset >= offset + size:
+            break
+        offset = max(offset, (b.offset + b.size + ALIGN - 1) // ALIGN * ALIGN)
+    return offset if offset + size <= arena else None
+
+
+def render(plans, size, sources):
+    rows = []
+    for pool, (node, offset) in plans:
+        upper = pool.name.upper()
+        rows.append(f"// {pool.name}: from {pool.nodes[node][0]} (c-node {node} of {len(pool.nodes)})")
+        rows.append(f"#define OVERLAY_{upper}_NODE {node}U")
+        rows.append(f"#define OVERLAY_{upper}_OFFSET {offset}U")
+    return f"""/**
+  ******************************************************************************
+  * @file           : overlay_plan.h
+  * @brief          : Arena region of the overlay frame slot (APP_RX_OVERLAY)
+  ******************************************************************************
+  * Generated by python -m stm32dc.memplan from {', '.join(sources)},
+  * do not edit. Per model: the c-node from which OVERLAY_BYTES at OFFSET
+  * in the activation arena stay dead until the run ends.
+  ******************************************************************************
+  */
+
+#ifndef __OVERLAY_PLAN_H
+#define __OVERLAY_PLAN_H
+
+#define OVERLAY_BYTES {size}U
+
+{chr(10).join(rows)}
+
+#endif /* __OVERLAY_PLAN_H */
+"""
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('reports', nargs='+', help="c_info JSON of each registered model, MODEL_LIST order")
+    ap.add_argument('--arena', type=int, help="arena bytes (default the largest pool, APP_ARENA_SIZE if set)")
+    ap.add_argument('--header', nargs='?', const='', help=f"write the plan, default tinyML/{OUTPUT}")
+    ap.add_argument('-v', '--verbose', action='store_true', help="node epochs and live buffers")
+    args = ap.parse_args(argv)
+
+    pools = [Pool(path) for path in args.reports]
+    arena = args.arena or max(p.size for p in pools)
+    size = FRAME_HEADER + max(p.image_size() for p in pools)
+    print(f"arena {arena} B, overlay frame {size} B")
+    plans = []
+    for pool in pools:
+        found = pool.plan(size, arena)
+        if found is None:
+            raise SystemExit(f"{pool.name}: no {size} B region outside the input and output tensors")
+        node, offset = found
+        plans.append((pool, found))
+        print(f"{pool.name:<16} pool {pool.size:>6} B  opens at c-node {node}/{len(pool.nodes)} ({pool.nodes[node][0]})"
+              f"  offset {offset}")
+        if args.verbose:
+            for k, (name, start, end) in enumerate(pool.nodes):
+                live = sorted(pool.live_from(k), key=lambda b: b.offset)
+                print(f"  {k:>3} {name:<24} epochs {start:>3}-{end:<3} live from here: "
+                      + ", ".join(f"{b.offset}+{b.size}" for b in live))
+
+    if args.header is not None:
+        output = args.header or os.path.join('tinyML', OUTPUT)
+        with open(output, 'w', encoding='utf-8', newline='\n') as f:
+            f.write(render(plans, size, [os.path.basename(p) for p in args.reports]))
+        print(f"written to {output}")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
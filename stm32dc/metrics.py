@@ -0,0 +1,374 @@
+"""Prometheus metrics of the headless service (GET /metrics).
+
+    python -m stm32dc.service --ports COM9 COM10
+    curl http://127.0.0.1:8784/metrics
+
+    scrape_configs:
+      - job_name: stm32dc
+        static_configs:
+          - targets: ['classifier-host:8784']
+
+The text exposition format, written here without the client library:
+
+    stm32dc_request_seconds         POST /classify latency by priority (histogram),
+                                    its _count the request rate
+    stm32dc_images_total            images classified, by priority
+    stm32dc_board_latency_seconds   dispatch to result per board and model (histogram)
+    stm32dc_board_requests_total    per board, by outcome: ok, error (the device
+                                    refused or failed), failure (timeout, link)
+    stm32dc_board_up                0 once a board is marked down
+    stm32dc_board_outstanding       requests dispatched to a board, unanswered
+    stm32dc_board_queued            its LinkWorker lanes, by priority
+    stm32dc_pool_waiting            requests waiting for a board to switch model
+    stm32dc_cache_*                 hits, misses and hit ratio of --cache
+    stm32dc_link_*                  host side link quality: CRC errors of replies,
+                                    retransmissions and final timeouts
+    stm32dc_device_*                the board's STATS counters: inferences, errors by
+                                    kind, inference time (histogram), CPU shares
+                                    (APP_LOAD), uptime and boots
+    stm32dc_device_busy_ratio       with --telemetry, the board's busy share of the last
+                                    telemetry span (APP_LOAD)
+    stm32dc_telemetry_*             frames pushed, frames lost (a gap in their numbers)
+                                    and the age of the last one, per board
+
+Board latency histograms are kept by the pool as replies come in. STATS
+is a round trip, so a scrape reuses the counters it got within
+STATS_MAX_AGE seconds and asks every board at once otherwise; a board
+that does not answer in STATS_TIMEOUT is left out of that scrape. The
+device's inference histogram has power of two cycle buckets, converted to
+seconds at its clock, and its _sum is estimated from the bucket middles.
+With --batch the boards belong to the batcher's threads: their counters
+come from its health() and STATS is not asked.
+
+With --telemetry the boards push their counts instead (APP_TELEMETRY):
+FleetTelemetry adds up each frame's deltas as the worker reads it, so a
+scrape costs the links nothing and the counters are exact to the last
+frame. They count from when the service started watching. A board whose
+firmware answers TELEMETRY with ERR_TYPE stays on STATS, and one silent
+for TELEMETRY_SILENT intervals (it restarted) is asked again.
+"""
+import threading
+import time
+from bisect import bisect_left
+from concurrent.futures import wait
+from functools import partial
+
+from . import protocol
+from .link import DeviceError
+
+CONTENT_TYPE = 'text/plain; version=0.0.4; charset=utf-8'
+# Seconds, upper bucket edges
+LATENCY_BUCKETS = (0.001, 0.002, 0.005, 0.01, 0.02, 0.05, 0.1, 0.2, 0.5, 1.0, 2.0, 5.0, 10.0)
+STATS_MAX_AGE = 5.0
+STATS_TIMEOUT = 1.0
+TELEMETRY_INTERVAL_MS = 1000
+# Intervals without a frame before a board is asked to push again
+TELEMETRY_SILENT = 3
+
+DEVICE_ERRORS = (('inference', 'err_inference'), ('crc', 'err_crc'), ('dropped', 'err_dropped'),
+                 ('uart_overrun', 'uart_overrun'), ('uart_framing', 'uart_framing'),
+                 ('uart_noise', 'uart_noise'), ('events_lost', 'events_lost'))
+
+
+class Histogram:
+    """Counts per bucket, observe() serialised by the owner's lock"""
+
+    def __init__(self, buckets=LATENCY_BUCKETS):
+        self.buckets = buckets
+        self.counts = [0] * (len(buckets) + 1)  # the last one above every edge
+        self.sum = 0.0
+
+    def observe(self, value):
+        self.counts[bisect_left(self.buckets, value)] += 1
+        self.sum += value
+
+    def snapshot(self):
+        """(buckets, counts, sum), safe to expose outside the lock"""
+        return self.buckets, list(self.counts), self.sum
+
+
+class Exposition:
+    """Samples grouped by metric, in the Prometheus text format"""
+
+    def __init__(self):
+        self.metrics = {}  # name -> (type, help, [lines])
+
+    def _family(self, name, kind, text):
+        return self.metrics.setdefault(name, (kind, text, []))[2]
+
+    def add(self, name, kind, text, value, /, **labels):
+        self._family(name, kind, text).append(f"{name}{_labels(labels)} {_number(value)}")
+
+    def histogram(self, name, text, snapshot, /, **labels):
+        buckets, counts, total = snapshot
+        lines = self._family(name, 'histogram', text)
+        seen = 0
+        for edge, count in zip(buckets, counts):
+            seen += count
+            lines.append(f"{name}_bucket{_labels(dict(labels, le=_number(edge)))} {seen}")
+        seen += counts[-1]
+        lines.append(f"{name}_bucket{_labels(dict(labels, le='+Inf'))} {seen}")
+        lines.append(f"{name}_sum{_labels(labels)} {_number(total)}")
+        lines.append(f"{name}_count{_labels(labels)} {seen}")
+
+    def text(self):
+        out = []
+        for name, (kind, text, lines) in self.metrics.items():
+            out += [f"# HELP {name} {text}", f"# TYPE {name} {kind}"] + lines
+        return '\n'.join(out) + '\n'
+
+
+def _labels(labels):
+    if not labels:
+        return ''
+    return '{' + ','.join(f'{k}="{_escape(v)}"' for k, v in labels.items()) + '}'
+
+
+def _escape(value):
+    return str(value).replace('\\', '\\\\').replace('"', '\\"').replace('\n', '\\n')
+
+
+def _number(value):
+    return repr(float(value)) if isinstance(value, float) else str(int(value))
+
+
+class DeviceStats:
+    """STATS of every pool board, asked at most once per STATS_MAX_AGE"""
+
+    def __init__(self, pool, max_age=STATS_MAX_AGE, telemetry=None):
+        self.pool = pool
+        self.max_age = max_age
+        self.telemetry = telemetry  # FleetTelemetry, whose boards are not asked
+        self.lock = threading.Lock()
+        self.stats = {}   # port -> protocol.Stats
+        self.at = None    # monotonic time of the last ask
+
+    def get(self):
+        with self.lock:
+            if self.at is None or time.monotonic() - self.at >= self.max_age:
+                self.at = time.monotonic()
+                self.stats = self._ask()
+            return dict(self.stats)
+
+    def _ask(self):
+        pushed = self.telemetry.ports() if self.telemetry else set()
+        futures = [(m, m.worker.stats()) for m in self.pool.members if m.healthy and m.port not in pushed]
+        wait([f for _, f in futures], STATS_TIMEOUT)
+        stats = {}
+        for m, future in futures:
+            if future.done() and not future.cancelled() and future.exception() is None:
+                stats[m.port] = future.result()
+            else:
+                m.worker.cancel(future)
+        return stats
+
+
+class _Pushed:
+    """One board's telemetry frames added up"""
+
+    def __init__(self):
+        self.frames = 0
+        self.inferences = 0
+        self.errors = [0] * len(protocol.TELEM_ERROR_KINDS)
+        self.run_hist = [0] * protocol.STATS_BUCKETS
+        self.busy = protocol.TELEM_NO_LOAD
+        self.hclk_mhz = 0
+        self.received = 0     # telemetry frames
+        self.lost = 0         # gaps in their numbers
+        self.number = None    # of the last one
+        self.at = 0.0         # monotonic time of the last one
+
+
+class FleetTelemetry:
+    """Counters of every pool board from the telemetry frames it pushes"""
+
+    def __init__(self, pool, interval_ms=TELEMETRY_INTERVAL_MS):
+        self.pool = pool
+        self.interval_ms = interval_ms
+        self.lock = threading.Lock()
+        self.boards = {}          # port -> _Pushed
+        self.unsupported = set()  # ports whose firmware has no APP_TELEMETRY
+        self.asked = {}           # port -> monotonic time of the last TELEMETRY request
+        for m in pool.members:
+            m.worker.on_telemetry = partial(self._receive, m.port)
+        self.arm()
+
+    def ports(self):
+        """Ports whose counters come from telemetry, for DeviceStats to leave out"""
+        with self.lock:
+            return set(self.boards)
+
+    def arm(self):
+        """Ask the healthy boards that went silent to push, at most once per silence"""
+        now = time.monotonic()
+        silent = now - TELEMETRY_SILENT * self.interval_ms / 1e3
+        with self.lock:
+            due = [m for m in self.pool.members if m.healthy and m.port not in self.unsupported
+                   and self.asked.get(m.port, 0.0) < silent
+                   and (m.port not in self.boards or self.boards[m.port].at < silent)]
+            for m in due:
+                self.asked[m.port] = now
+        for m in due:
+            # The reply carries counts too, added up in the rx thread in order with the pushes
+            m.worker.telemetry(self.interval_ms).add_done_callback(partial(self._answered, m.port))
+
+    def _answered(self, port, future):
+        if future.cancelled():
+            return
+        error = future.exception()
+        if error is None:
+            self._receive(port, future.result())
+        elif isinstance(error, DeviceError) and error.code == protocol.ERR_TYPE:
+            with self.lock:
+                self.unsupported.add(port)
+
+    def _receive(self, port, frame):
+        with self.lock:
+            board = self.boards.setdefault(port, _Pushed())
+            if board.number is not None:
+                board.lost += (frame.number - board.number - 1) & 0xFF
+            board.number = frame.number
+            board.received += 1
+            board.at = time.monotonic()
+            board.frames += frame.frames
+            board.inferences += frame.inferences
+            for k, count in enumerate(frame.errors):
+                board.errors[k] += count
+            for b, count in enumerate(frame.run_hist):
+                board.run_hist[b] += count
+            board.busy = frame.busy
+            board.hclk_mhz = frame.hclk_mhz
+
+    def get(self):
+        """{port: _Pushed copy}, asking silent boards to push again"""
+        self.arm()
+        with self.lock:
+            out = {}
+            for port, board in self.boards.items():
+                copy = _Pushed()
+                copy.__dict__.update(board.__dict__, errors=list(board.errors), run_hist=list(board.run_hist))
+                out[port] = copy
+            return out
+
+
+def collect(classifier, device_stats=None, telemetry=None):
+    """Exposition text of a service.Classifier, with STATS from a DeviceStats and pushes from a FleetTelemetry"""
+    out = Exposition()
+    for priority, snapshot in classifier.snapshot():
+        out.histogram('stm32dc_request_seconds', "POST /classify latency", snapshot, priority=priority)
+    with classifier.lock:
+        images = dict(classifier.images)
+    for priority, count in images.items():
+        out.add('stm32dc_images_total', 'counter', "Images classified", count, priority=priority)
+    out.add('stm32dc_coalesced_total', 'counter', "Images answered by an identical one in flight",
+            classifier.coalesced)
+
+    pool = classifier.pool
+    if hasattr(pool, 'members'):
+        _pool(out, pool)
+    else:
+        _batcher(out, pool)
+
+    cache = classifier.cache
+    if cache is not None:
+        hits, misses = cache.hits, cache.misses
+        out.add('stm32dc_cache_hits_total', 'counter', "Result cache hits", hits)
+        out.add('stm32dc_cache_misses_total', 'counter', "Result cache misses", misses)
+        out.add('stm32dc_cache_hit_ratio', 'gauge', "Result cache hits over lookups",
+                hits / (hits + misses) if hits + misses else 0.0)
+        out.add('stm32dc_cache_entries', 'gauge', "Results cached", len(cache))
+
+    if telemetry is not None:
+        for port, board in telemetry.get().items():
+            _pushed(out, port, board)
+    if device_stats is not None:
+        for port, stats in device_stats.get().items():
+            _device(out, port, stats)
+    return out.text()
+
+
+def _pool(out, pool):
+    for health, m in zip(pool.health(), pool.members):
+        port = health.port
+        out.add('stm32dc_board_up', 'gauge', "1 while the board takes requests", int(health.healthy), port=port)
+        for outcome, count in (('ok', health.completed), ('error', health.errors),
+                               ('failure', health.failures)):
+            out.add('stm32dc_board_requests_total', 'counter', "Board requests by outcome", count,
+                    port=port, outcome=outcome)
+        out.add('stm32dc_board_outstanding', 'gauge', "Requests dispatched to the board, unanswered",
+                health.outstanding, port=port)
+        for lane, count in zip(('interactive', 'bulk'), m.worker.queued()):
+            out.add('stm32dc_board_queued', 'gauge', "Requests waiting in the board's worker",
+                    count, port=port, priority=lane)
+        for model, snapshot in pool.latency_snapshot(m):
+            out.histogram('stm32dc_board_latency_seconds', "Dispatch to result", snapshot,
+                          port=port, model=model)
+        out.add('stm32dc_link_crc_errors_total', 'counter', "Replies that failed their CRC on the host",
+                m.worker.link.reader.crc_errors, port=port)
+        out.add('stm32dc_link_retransmits_total', 'counter', "Requests sent again",
+                m.worker.retransmits, port=port)
+        out.add('stm32dc_link_timeouts_total', 'counter', "Requests that got no reply in the end",
+                m.worker.timeouts, port=port)
+    out.add('stm32dc_pool_waiting', 'gauge', "Requests waiting for a board to switch model",
+            len(pool.waiting))
+    if pool.hedge:
+        out.add('stm32dc_hedges_total', 'counter', "Interactive requests sent to a second board", pool.hedges)
+        out.add('stm32dc_hedge_wins_total', 'counter', "Hedged requests the second board answered first",
+                pool.hedge_wins)
+
+
+def _batcher(out, batcher):
+    for health in batcher.health():
+        port = health.port
+        out.add('stm32dc_board_up', 'gauge', "1 while the board takes requests", int(health.healthy), port=port)
+        for outcome, count in (('ok', health.completed), ('error', health.errors),
+                               ('failure', health.failures)):
+            out.add('stm32dc_board_requests_total', 'counter', "Board requests by outcome", count,
+                    port=port, outcome=outcome)
+        out.add('stm32dc_board_batches_total', 'counter', "Device round trips", health.batches, port=port)
+        out.add('stm32dc_board_batch_wait_seconds', 'gauge', "Mean wait for a batch to be sent",
+                health.mean_wait, port=port)
+    out.add('stm32dc_pool_waiting', 'gauge', "Images waiting for a batch", batcher.requests.qsize())
+
+
+def _device(out, port, stats):
+    out.add('stm32dc_device_inferences_total', 'counter', "Inferences since boot or STATS reset",
+            stats.inferences, port=port)
+    out.add('stm32dc_device_frames_total', 'counter', "Frames received", stats.frames, port=port)
+    for kind, field in DEVICE_ERRORS:
+        out.add('stm32dc_device_errors_total', 'counter', "Device error counters", getattr(stats, field),
+                port=port, kind=kind)
+    if stats.cpu_hz:
+        edges = tuple((1 << (i + 1)) / stats.cpu_hz for i in range(protocol.STATS_BUCKETS))
+        total = sum(count * 1.5 * (1 << i) for i, count in enumerate(stats.run_hist)) / stats.cpu_hz
+        out.histogram('stm32dc_device_inference_seconds', "Network run time on the device",
+                      (edges[:-1], list(stats.run_hist), total), port=port)
+    for share, percent in stats.utilization().items():
+        out.add('stm32dc_device_cpu_share', 'gauge', "Share of the device CPU time (APP_LOAD)",
+                percent / 100, port=port, share=share)
+    out.add('stm32dc_device_uptime_seconds', 'gauge', "Time since the device started",
+            stats.uptime_ms / 1e3, port=port)
+    out.add('stm32dc_device_boots_total', 'counter', "Device starts since power-on", stats.boots, port=port)
+    out.add('stm32dc_device_warm_boots_total', 'counter', "Restarts by the watchdog or a fault",
+            stats.warm_boots, port=port)
+
+
+def _pushed(out, port, board):
+    out.add('stm32dc_device_inferences_total', 'counter', "Inferences since boot or STATS reset",
+            board.inferences, port=port)
+    out.add('stm32dc_device_frames_total', 'counter', "Frames received", board.frames, port=port)
+    for (kind, _), count in zip(DEVICE_ERRORS, board.errors):
+        out.add('stm32dc_device_errors_total', 'counter', "Device error counters", count, port=port, kind=kind)
+    if board.hclk_mhz:
+        hz = board.hclk_mhz * 1e6
+        edges = tuple((1 << (i + 1)) / hz for i in range(protocol.STATS_BUCKETS))
+        total = sum(count * 1.5 * (1 << i) for i, count in enumerate(board.run_hist)) / hz
+        out.histogram('stm32dc_device_inference_seconds', "Network run time on the device",
+                      (edges[:-1], board.run_hist, total), port=port)
+    if board.busy != protocol.TELEM_NO_LOAD:
+        out.add('stm32dc_device_busy_ratio', 'gauge', "Busy share of the last telemetry span (APP_LOAD)",
+                board.busy / 10000, port=port)
+    out.add('stm32dc_telemetry_frames_total', 'counter', "Telemetry frames received", board.received, port=port)
+    out.add('stm32dc_telemetry_lost_total', 'counter', "Telemetry frames lost on the link", board.lost, port=port)
+    out.add('stm32dc_telemetry_age_seconds', 'gauge', "Time since the last telemetry frame",
+            time.monotonic() - board.at, port=port)
@@ -0,0 +1,373 @@
+"""Run the generated int8 network on the host, from the C files it was built from.
+
+    python -m stm32dc.netref tinyML --images emnist-digits-test-images-idx3-ubyte \\
+        --labels emnist-digits-test-labels-idx1-ubyte
+    python -m stm32dc.reference --network tinyML --port COM9 --count 200
+
+The TFLite interpreter is the model the network was generated from, not
+the network: its rounding need not be X-CUBE-AI's. This reads what the
+firmware links instead: the weights blob (s_<name>_weights_array_u64 in
+X-CUBE-AI/App/<name>_data_params.c), and from <name>.c each array's
+offset into it, each tensor's shape and int8 scales and zero points, the
+layer chain and the softmax parameters. The layers then run in integer
+arithmetic over whole batches:
+
+    conv2d_nl_pool  valid conv, requantised per output channel with the
+                    ReLU clamp at the output zero point, 2x2/2 max pool
+    dense           the same requantisation, no pool
+    sm              CMSIS-NN arm_softmax_s8 from its mult, shift, diff_min
+
+Accumulators are exact (float64 matrix products of small integers, which
+BLAS runs at thousands of images a second). Requantisation has two
+roundings: ROUND_LIBRARY, the doubling high multiply and rounding shift
+of CMSIS-NN and TFLite the library kernels follow, and ROUND_KERNEL, the
+single rounding shift of kernels.c (APP_KERNEL_*). reference --network
+compares either byte for byte with a board's CLASSIFY_TOPK scores.
+
+Other layer types (depthwise, average pool, float, binary) are refused.
+Needs numpy.
+"""
+import argparse
+import os
+import re
+import sys
+import time
+
+import numpy as np
+
+from .weights import load_blob
+
+ROUND_LIBRARY = 'library'
+ROUND_KERNEL = 'kernel'
+ROUNDINGS = (ROUND_LIBRARY, ROUND_KERNEL)
+
+APP_DIR = os.path.join('X-CUBE-AI', 'App')
+IMAGE_SIZE = 784
+# Images per vectorised pass: conv2d_2's patches are 139 KB of float64 per image
+CHUNK = 256
+
+Q31_MAX = (1 << 31) - 1
+Q31_MIN = -(1 << 31)
+SOFTMAX_ACCUM_BITS = 12
+
+FORMATS = {'S8': np.int8, 'S32': np.int32}
+
+ARRAY_RE = re.compile(r'AI_ARRAY_OBJ_DECLARE\(\s*(\w+)_array, AI_ARRAY_FORMAT_(\w+)[^,]*,\s*NULL, NULL, (\d+),')
+OFFSET_RE = re.compile(r'(\w+)_array\.data = AI_PTR\(g_\w+_weights_map\[0\] \+ (\d+)\)')
+INTQ_RE = re.compile(r'AI_INTQ_INFO_LIST_OBJ_DECLARE\((\w+)_array_intq,.*?'
+                     r'AI_PACK_INTQ_SCALE\(([^)]*)\),\s*AI_PACK_INTQ_ZP\(([^)]*)\)', re.S)
+TENSOR_RE = re.compile(r'AI_TENSOR_OBJ_DECLARE\(\s*(\w+), AI_STATIC,\s*\d+, 0x\w+,\s*'
+                       r'AI_SHAPE_INIT\(4, (\d+), (\d+), (\d+), (\d+)\),.*?1, &(\w+)_array,', re.S)
+CHAIN_RE = re.compile(r'AI_TENSOR_CHAIN_OBJ_DECLARE\(\s*(\w+)_chain, AI_STATIC_CONST, 4,\s*'
+                      r'AI_TENSOR_LIST_OBJ_INIT\(AI_FLAG_NONE, 1, &(\w+)\),\s*'
+                      r'AI_TENSOR_LIST_OBJ_INIT\(AI_FLAG_NONE, 1, &(\w+)\),\s*'
+                      r'(?:AI_TENSOR_LIST_OBJ_INIT\(AI_FLAG_NONE, \d+, ([^)]*)\)|AI_TENSOR_LIST_OBJ_EMPTY)')
+LAYER_RE = re.compile(r'AI_LAYER_OBJ_DECLARE\(\s*(\w+)_layer, \d+,\s*\w+, 0x\w+, NULL,\s*\w+, (\w+),\s*'
+                      r'&(\w+)_chain,\s*NULL, &(\w+)_layer, AI_STATIC,(.*?)\n\)', re.S)
+PARAMS_RE = re.compile(r'ai_i32 (\w+)_nl_params_data\[\] = \{([^}]*)\}')
+
+
+def _floats(text):
+    return [float(v.rstrip('f')) for v in text.split(',')]
+
+
+def _attr(attrs, name):
+    """Integers of a layer attribute such as .pool_size = AI_SHAPE_2D_INIT(2, 2), None if absent"""
+    m = re.search(r'\.' + name + r' = AI_SHAPE(?:_2D)?_INIT\(([^)]*)\)', attrs)
+    return [int(v) for v in m.group(1).split(',')] if m else None
+
+
+# CMSIS-NN fixed point, on int64 arrays holding int32 values ----------------------------
+
+def _trunc_div(x, exponent):
+    """x / 2^exponent rounded toward zero, as C integer division"""
+    return np.where(x >= 0, x >> exponent, -((-x) >> exponent))
+
+
+def doubling_high_mult(a, b):
+    """arm_nn_doubling_high_mult: round(a * b / 2^31)"""
+    ab = np.asarray(a, np.int64) * np.asarray(b, np.int64)
+    nudge = np.where((np.asarray(a) < 0) ^ (np.asarray(b) < 0), 1 - (1 << 30), 1 << 30)
+    return _trunc_div(ab + nudge, 31)
+
+
+def divide_by_power_of_two(x, exponent):
+    """arm_nn_divide_by_power_of_two: x / 2^exponent rounded half away from zero"""
+    x = np.asarray(x, np.int64)
+    exponent = np.asarray(exponent, np.int64)
+    mask = (np.int64(1) << exponent) - 1
+    result = x >> exponent
+    threshold = (mask >> 1) + (result < 0)
+    return result + ((x & mask) > threshold)
+
+
+def mult_by_power_of_two(x, exponent):
+    """arm_nn_mult_by_power_of_two: x * 2^exponent saturated"""
+    thresh = (1 << (31 - exponent)) - 1
+    return np.where(x > thresh, Q31_MAX, np.where(x < -thresh, Q31_MIN, x << exponent))
+
+
+def exp_on_negative_values(val):
+    """arm_nn_exp_on_negative_values: exp(val / 2^26 - ...) in Q31, val <= 0 in Q5.26"""
+    shift = 24
+    mod = (val & ((1 << shift) - 1)) - (1 << shift)
+    remainder = mod - val
+    x = (mod << 5) + (1 << 28)
+    x2 = doubling_high_mult(x, x)
+    result = 1895147668 + doubling_high_mult(
+        1895147668, x + divide_by_power_of_two(
+            doubling_high_mult(divide_by_power_of_two(doubling_high_mult(x2, x2), 2) +
+                               doubling_high_mult(x2, x), 715827883) + x2, 1))
+    for factor in (1672461947, 1302514674, 790015084, 290630308, 39332535, 720401, 242):
+        result = np.where(remainder & (1 << shift), doubling_high_mult(result, factor), result)
+        shift += 1
+    return np.where(val == 0, Q31_MAX, result)
+
+
+def one_over_one_plus_x(val):
+    """arm_nn_one_over_one_plus_x_for_x_in_0_1: 1 / (1 + val / 2^31) in Q1.30"""
+    total = val + Q31_MAX
+    half = _trunc_div(total + np.where(total >= 0, 1, -1), 1)
+    x = 1515870810 + doubling_high_mult(half, -1010580540)
+    for _ in range(3):
+        x = x + mult_by_power_of_two(doubling_high_mult(x, (1 << 29) - doubling_high_mult(half, x)), 2)
+    return mult_by_power_of_two(x, 1)
+
+
+def softmax_s8(logits, mult, shift, diff_min):
+    """arm_softmax_s8 over the last axis of int8 logits"""
+    x = logits.astype(np.int64)
+    diff = x - x.max(axis=-1, keepdims=True)
+    live = diff >= diff_min
+    e = exp_on_negative_values(doubling_high_mult(np.where(live, diff, 0) * (1 << shift), mult))
+    total = np.where(live, divide_by_power_of_two(e, SOFTMAX_ACCUM_BITS), 0).sum(axis=-1, keepdims=True)
+    # __CLZ of the 32-bit sum; the row's maximum alone makes it at least 2^19
+    headroom = 31 - np.floor(np.log2(total)).astype(np.int64)
+    scale = one_over_one_plus_x((total << headroom) - (1 << 31))
+    out = divide_by_power_of_two(doubling_high_mult(scale, e), SOFTMAX_ACCUM_BITS - headroom + 23) - 128
+    return np.where(live, np.clip(out, -128, 127), -128).astype(np.int8)
+
+
+# Requantisation ------------------------------------------------------------------------
+
+class Requant:
+    """Per output channel int32 accumulator to int8, clamped to [floor, 127]"""
+
+    def __init__(self, in_scale, w_scales, out_scale, out_zp, channels, rounding):
+        # float32 products, as the library and Kernel_Quant form them
+        scales = (np.float32(in_scale) * np.asarray(w_scales, np.float32) / np.float32(out_scale))
+        scales = np.broadcast_to(scales, (channels,)).astype(np.float64)
+        frac, exp = np.frexp(scales)
+        self.rounding = rounding
+        self.out_zp = out_zp
+        if rounding == ROUND_LIBRARY:
+            # QuantizeMultiplier: std::round, 2^31 folds back to 2^30
+            q = np.floor(frac * (1 << 31) + 0.5).astype(np.int64)
+            exp = np.where(q == 1 << 31, exp + 1, exp)
+            q = np.where(q == 1 << 31, 1 << 30, q)
+            q = np.where(scales == 0, 0, q)
+            self.mult = q
+            self.left = np.maximum(exp, 0).astype(np.int64)
+            self.right = np.maximum(-exp, 0).astype(np.int64)
+        else:
+            # Kernel_Multiplier: a float32 mantissa is exact in Q31, the shift 31 - exp kept in 1..62
+            self.mult = np.rint(frac * (1 << 31)).astype(np.int64)
+            self.shift = np.clip(31 - exp, 1, 62).astype(np.int64)
+
+    def __call__(self, acc, floor=-128):
+        acc = acc.astype(np.int64)
+        if self.rounding == ROUND_LIBRARY:
+            v = divide_by_power_of_two(doubling_high_mult(acc << self.left, self.mult), self.right)
+        else:
+            # Kernel_Requant: int8 x int8 sums stay below 2^26, the product below 2^57
+            v = (acc * self.mult + (np.int64(1) << (self.shift - 1))) >> self.shift
+        return np.clip(v + self.out_zp, floor, 127).astype(np.int8)
+
+
+# The network ---------------------------------------------------------------------------
+
+class NetworkModel:
+    """The generated int8 network of a project, bit-exact on the host
+
+    Same interface as reference.ReferenceModel (scale, zero_point,
+    num_classes, scores, classify), plus scores_batch and classify_batch
+    over N x 784 uint8 images.
+    """
+
+    def __init__(self, project, name='network', rounding=ROUND_LIBRARY, softmax=True):
+        if rounding not in ROUNDINGS:
+            raise ValueError(f"rounding must be one of {', '.join(ROUNDINGS)}")
+        self.name = name
+        self.rounding = rounding
+        self.softmax = softmax          # False: gemm_6 logits, as APP_SOFTMAX_BYPASS returns
+        self.kind = f"{name}.c, {rounding} rounding"
+        source_path = os.path.join(project, APP_DIR, f'{name}.c')
+        with open(source_path, encoding='utf-8') as f:
+            source = f.read()
+        blob = load_blob(os.path.join(project, APP_DIR, f'{name}_data_params.c'), f's_{name}_weights_array_u64')
+
+        arrays = {m.group(1): (m.group(2), int(m.group(3))) for m in ARRAY_RE.finditer(source)}
+        offsets = {m.group(1): int(m.group(2)) for m in OFFSET_RE.finditer(source)}
+        intq = {m.group(1): (_floats(m.group(2)), [int(v) for v in m.group(3).split(',')])
+                for m in INTQ_RE.finditer(source)}
+        self.tensors = {m.group(1): ((int(m.group(2)), int(m.group(3)), int(m.group(4)), int(m.group(5))),
+                                     m.group(6))
+                        for m in TENSOR_RE.finditer(source)}
+        chains = {m.group(1): (m.group(2), m.group(3),
+                               [w.strip().lstrip('&') for w in (m.group(4) or '').split(',') if w.strip() not in ('', 'NULL')])
+                  for m in CHAIN_RE.finditer(source)}
+        params = {m.group(1): [int(v) for v in m.group(2).split(',')] for m in PARAMS_RE.finditer(source)}
+        layers = {m.group(1): (m.group(2), m.group(3), m.group(4), m.group(5)) for m in LAYER_RE.finditer(source)}
+        if not layers:
+            raise ValueError(f"{source_path}: no layers found")
+
+        def data(tensor):
+            array = self.tensors[tensor][1]
+            fmt, size = arrays[array]
+            if array not in offsets or fmt not in FORMATS:
+                raise ValueError(f"{array}: not an int8/int32 weights array")
+            dtype = np.dtype(FORMATS[fmt])
+            start = offsets[array]
+            return np.frombuffer(blob[start:start + size * dtype.itemsize], dtype)
+
+        def quant(tensor):
+            array = self.tensors[tensor][1]
+            if array not in intq:
+                raise ValueError(f"{tensor}: not integer quantised")
+            return intq[array]
+
+        # The chain starts at the layer no other one names as next
+        nexts = {nxt for layer, (_, _, nxt, _) in layers.items() if nxt != layer}
+        layer = next(l for l in layers if l not in nexts)
+        self.steps = []
+        while True:
+            forward, chain, nxt, attrs = layers[layer]
+            src, dst, weights = chains[chain]
+            (in_scale,), (in_zp,) = quant(src)
+            (out_scale,), (out_zp,) = quant(dst)
+            if forward.startswith('forward_conv2d_') and forward.endswith('_nl_pool'):
+                if _attr(attrs, 'filter_stride') != [1, 1] or any((_attr(attrs, 'filter_pad') or [0])[1:]) or \
+                        _attr(attrs, 'pool_size') != _attr(attrs, 'pool_stride') or '.groups = 1,' not in attrs:
+                    raise ValueError(f"{layer}: only valid stride 1 convs with a non-overlapping pool")
+                w, b = data(weights[0]), data(weights[1]).astype(np.int64)
+                channels = len(b)
+                w_scales, _ = quant(weights[0])
+                _, in_c, in_w, in_h = self.tensors[src][0]
+                k = int(round((len(w) // (channels * in_c)) ** 0.5))
+                self.steps.append(('conv', layer, dict(
+                    w=w.reshape(channels, k * k * in_c).astype(np.float64).T, b=b, k=k,
+                    shape=(in_h, in_w, in_c), in_zp=in_zp, pool=_attr(attrs, 'pool_size'),
+                    requant=Requant(in_scale, w_scales, out_scale, out_zp, channels, rounding),
+                    out_zp=out_zp)))
+            elif forward.startswith('forward_dense_integer'):
+                w, b = data(weights[0]), data(weights[1]).astype(np.int64)
+                channels = len(b)
+                w_scales, _ = quant(weights[0])
+                self.steps.append(('dense', layer, dict(
+                    w=w.reshape(channels, -1).astype(np.float64).T, b=b, in_zp=in_zp,
+                    requant=Requant(in_scale, w_scales, out_scale, out_zp, channels, rounding))))
+            elif forward == 'forward_sm_integer':
+                mult, shift, diff_min = params[layer]
+                self.steps.append(('softmax', layer, dict(mult=mult, shift=shift, diff_min=diff_min)))
+            else:
+                raise ValueError(f"{layer}: {forward} is not reproduced here")
+            if weights and any(quant(weights[0])[1]):
+                raise ValueError(f"{layer}: asymmetric weights")
+            if forward == 'forward_sm_integer' and not softmax:
+                self.steps.pop()
+                break
+            self.scale, self.zero_point = out_scale, out_zp
+            if nxt == layer:
+                break
+            layer = nxt
+
+    @property
+    def num_classes(self):
+        return len(next(p['b'] for kind, _, p in reversed(self.steps) if kind != 'softmax'))
+
+    def _run(self, pixels):
+        """int8 scores of an N x 784 uint8 batch"""
+        # The firmware's x - 128 into the input tensor
+        x = (pixels.astype(np.int16) - 128).astype(np.int8)
+        n = len(x)
+        for kind, _, p in self.steps:
+            if kind == 'conv':
+                h, w, c = p['shape']
+                k, (ph, pw) = p['k'], p['pool']
+                img = (x.reshape(n, h, w, c).astype(np.float64) - p['in_zp'])
+                patches = np.lib.stride_tricks.sliding_window_view(img, (k, k), axis=(1, 2))
+                oh, ow = h - k + 1, w - k + 1
+                # (n, oh, ow, c, ky, kx) to the OHWI order of the weights
+                patches = patches.transpose(0, 1, 2, 4, 5, 3).reshape(n, oh, ow, k * k * c)
+                acc = np.rint(patches @ p['w']).astype(np.int64) + p['b']
+                # Requantisation is monotonic: pool the accumulators
+                oh, ow = oh // ph, ow // pw
+                acc = acc[:, :oh * ph, :ow * pw].reshape(n, oh, ph, ow, pw, -1).max(axis=(2, 4))
+                x = p['requant'](acc, floor=p['out_zp']).reshape(n, -1)
+            elif kind == 'dense':
+                acc = np.rint((x.astype(np.float64) - p['in_zp']) @ p['w']).astype(np.int64) + p['b']
+                # No activation attribute: a fused ReLU is an output zero point of -128
+                x = p['requant'](acc)
+            else:
+                x = softmax_s8(x, p['mult'], p['shift'], p['diff_min'])
+        return x
+
+    def scores_batch(self, images):
+        """N x classes int8 scores of N 28x28 uint8 images (an array or bytes-like items)"""
+        if isinstance(images, np.ndarray):
+            pixels = images.reshape(-1, IMAGE_SIZE).astype(np.uint8)
+        else:
+            pixels = np.frombuffer(b''.join(bytes(img) for img in images), np.uint8).reshape(-1, IMAGE_SIZE)
+        out = [self._run(pixels[i:i + CHUNK]) for i in range(0, len(pixels), CHUNK)]
+        return np.concatenate(out) if out else np.zeros((0, self.num_classes), np.int8)
+
+    def classify_batch(self, images):
+        return [int(c) for c in self.scores_batch(images).argmax(axis=1)]
+
+    def scores(self, image):
+        return self.scores_batch([image])[0]
+
+    def classify(self, image):
+        return int(self.scores(image).argmax())
+
+
+def main(argv=None):
+    from .bench import load_idx, load_images, synthetic_images
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('project', help="firmware project directory (tinyML)")
+    parser.add_argument('--name', default='network', help="generated network (network, small, ...)")
+    parser.add_argument('--rounding', choices=ROUNDINGS, default=ROUND_LIBRARY)
+    parser.add_argument('--logits', action='store_true', help="stop before the softmax (APP_SOFTMAX_BYPASS)")
+    parser.add_argument('--images', help="IDX or .npy images (default: random)")
+    parser.add_argument('--labels', help="IDX labels for accuracy")
+    parser.add_argument('--count', type=int, default=0, help="0: every image")
+    parser.add_argument('--tflite', help="also count class and score differences from this .tflite")
+    args = parser.parse_args(argv)
+
+    images = load_images(args.images) if args.images else synthetic_images(args.count or 1000)
+    if args.count:
+        images = images[:args.count]
+    model = NetworkModel(args.project, args.name, args.rounding, not args.logits)
+
+    t0 = time.perf_counter()
+    scores = model.scores_batch(images)
+    elapsed = time.perf_counter() - t0
+    classes = scores.argmax(axis=1)
+    print(f"{model.kind}: {len(images)} images in {elapsed:.2f} s, {len(images) / elapsed:.0f} images/s")
+    if args.labels:
+        labels = np.asarray(load_idx(args.labels)[:len(images)])
+        print(f"accuracy      {(classes == labels).mean() * 100:.2f} %")
+    if args.tflite:
+        from .reference import ReferenceModel
+
+        ref = ReferenceModel(args.tflite)
+        tfl = np.stack([ref.scores(img) for img in images])
+        diff = np.abs(tfl.astype(np.int16) - scores).max(axis=1)
+        print(f"tflite        {(tfl.argmax(axis=1) == classes).sum()} of {len(images)} classes agree, "
+              f"{(diff == 0).sum()} bit-exact, max difference {int(diff.max())} LSB")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
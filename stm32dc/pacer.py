@@ -0,0 +1,191 @@
+"""Live frames at the rate the board (or a pool of boards) answers them.
+
+    pacer = FramePacer(worker)                      # or a DevicePool
+    future = pacer.send(worker.classify_packed, image)
+    root.after(pacer.interval_ms(), tick)           # when to look for the next frame
+
+A fixed send rate either leaves the board idle or builds a queue whose
+answers arrive for drawings long gone. The pacer keeps the boards busy
+and nothing more: up to capacity() frames in flight, and at most one more
+waiting here, which a newer frame replaces (the replaced future is
+cancelled, its frame never sent). Each answer's round trip feeds an
+exponential average, and every STATS_PERIOD seconds a BULK STATS request
+to each board gives the mean network run from the growth of its run
+histogram. A board that takes much less time to run a frame than to get
+an answer back (the link is the bottleneck) gets a second frame in flight
+to overlap the two, and a pool scales capacity by its healthy boards.
+interval_ms() is the period at which that capacity is used up, which is
+as often as a producer should sample a new frame. Firmware without
+APP_STATS answers STATS with an error; the pacer then goes by round trips
+alone.
+"""
+import threading
+import time
+from concurrent.futures import Future
+
+from .link import DeviceError
+from .worker import BULK, INTERACTIVE
+
+# Weight of the newest sample in the averages
+ALPHA = 0.2
+# Frames in flight per board: one, or two when the run is under half the round trip
+MAX_DEPTH = 2
+# Bounds of interval_ms(), and its value before the first answer
+MIN_INTERVAL = 0.01
+MAX_INTERVAL = 0.5
+FIRST_INTERVAL = 0.05
+STATS_PERIOD = 2.0
+
+
+def mean_run(before, after):
+    """Mean seconds per run between two protocol.Stats, from their run histograms; None if none ran"""
+    runs = cycles = 0
+    for i, (a, b) in enumerate(zip(before.run_hist, after.run_hist)):
+        n = (b - a) & 0xFFFFFFFF
+        runs += n
+        cycles += n * 1.5 * (1 << i)  # middle of [2^i, 2^(i+1))
+    if not runs or not after.cpu_hz:
+        return None
+    return cycles / runs / after.cpu_hz
+
+
+class FramePacer:
+    """Sends the newest frame as soon as a board can take it, at most one waits"""
+
+    def __init__(self, target, stats_period=STATS_PERIOD):
+        self.target = target              # LinkWorker or DevicePool
+        self.stats_period = stats_period  # 0: round trips only
+        self.lock = threading.Lock()
+        self.in_flight = 0
+        self.waiting = None               # (Future, submit, args) replaced by newer frames
+        self.inner = {}                   # our Future -> the target's, while in flight
+        self.rtt = None                   # seconds, average round trip
+        self.run = None                   # seconds, average device run
+        self.stats = {}                   # worker -> last protocol.Stats
+        self.stats_at = 0.0
+        self.sent = 0
+        self.dropped = 0
+
+    def _workers(self):
+        members = getattr(self.target, 'members', None)
+        if members is None:
+            return [self.target]
+        return [m.worker for m in members if m.healthy]
+
+    def devices(self):
+        return max(1, len(self._workers()))
+
+    def depth(self):
+        """Frames in flight per board"""
+        if self.rtt is None or self.run is None or self.run * 2 > self.rtt:
+            return 1
+        return MAX_DEPTH
+
+    def capacity(self):
+        return self.devices() * self.depth()
+
+    def interval(self):
+        """Seconds between frames that keeps capacity() in flight"""
+        with self.lock:
+            if self.rtt is None:
+                return FIRST_INTERVAL
+            period = self.rtt / self.capacity()
+            if self.run is not None:
+                period = max(period, self.run / self.devices())
+        return min(MAX_INTERVAL, max(MIN_INTERVAL, period))
+
+    def interval_ms(self):
+        return int(round(self.interval() * 1000))
+
+    def send(self, submit, *args) -> Future:
+        """Future of submit(*args, priority=INTERACTIVE), now or once a board is free"""
+        future = Future()
+        with self.lock:
+            now = self.in_flight < self.capacity()
+            if now:
+                self.in_flight += 1
+                replaced = None
+            else:
+                replaced, self.waiting = self.waiting, (future, submit, args)
+        if replaced is not None:
+            self.dropped += 1
+            replaced[0].cancel()
+        if now:
+            self._dispatch(future, submit, args)
+        return future
+
+    def cancel(self, future) -> bool:
+        """Withdraw a frame: waiting here, or in flight through the target's cancel()"""
+        with self.lock:
+            if self.waiting is not None and self.waiting[0] is future:
+                self.waiting = None
+                return future.cancel()
+            inner = self.inner.get(future)
+        cancel = getattr(self.target, 'cancel', None)
+        return bool(inner is not None and cancel is not None and cancel(inner))
+
+    def _dispatch(self, future, submit, args):
+        if not future.set_running_or_notify_cancel():
+            self._done(None, 0.0)  # cancelled while it waited
+            return
+        sent = time.perf_counter()
+        inner = submit(*args, priority=INTERACTIVE)
+        with self.lock:
+            self.sent += 1
+            self.inner[future] = inner
+        inner.add_done_callback(lambda f: self._finish(future, f, sent))
+
+    def _finish(self, future, inner, sent):
+        with self.lock:
+            self.inner.pop(future, None)
+        if inner.cancelled():
+            future.set_exception(ConnectionError("Cancelled"))
+            self._done(None, 0.0)
+            return
+        error = inner.exception()
+        if error is None:
+            future.set_result(inner.result())
+        else:
+            future.set_exception(error)
+        self._done(error, time.perf_counter() - sent)
+
+    def _done(self, error, rtt):
+        """A frame is answered: average its round trip, send the waiting one"""
+        with self.lock:
+            self.in_flight -= 1
+            if rtt and error is None:
+                self.rtt = rtt if self.rtt is None else self.rtt + ALPHA * (rtt - self.rtt)
+            nxt = None
+            if self.waiting is not None and self.in_flight < self.capacity():
+                nxt, self.waiting = self.waiting, None
+                self.in_flight += 1
+            poll = self.stats_period and time.monotonic() - self.stats_at >= self.stats_period
+            if poll:
+                self.stats_at = time.monotonic()
+        if nxt is not None:
+            self._dispatch(*nxt)
+        if poll:
+            self._poll_stats()
+
+    def _poll_stats(self):
+        for worker in self._workers():
+            # Bulk: the poll waits behind live frames rather than ahead of them
+            future = worker.stats(priority=BULK)
+            future.add_done_callback(lambda f, w=worker: self._on_stats(w, f))
+
+    def _on_stats(self, worker, future):
+        if future.cancelled():
+            return
+        error = future.exception()
+        if error is not None:
+            # No APP_STATS: round trips are enough. A lost reply is tried again
+            if isinstance(error, DeviceError):
+                self.stats_period = 0
+            return
+        stats = future.result()
+        with self.lock:
+            before = self.stats.get(worker)
+            self.stats[worker] = stats
+            run = mean_run(before, stats) if before is not None else None
+            if run is not None:
+                self.run = run if self.run is None else self.run + ALPHA * (run - self.run)
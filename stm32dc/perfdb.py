@@ -0,0 +1,415 @@
+"""History of benchmark runs in a local SQLite file, and a check for significant regressions.
+
+    python -m stm32dc.bench --port COM9 --count 1000 --db perf.sqlite
+    python -m stm32dc.sim --elf tinyML/Sim/tinyML.elf --db perf.sqlite
+    python -m stm32dc.perfdb record sim.json eval.json builds.json \\
+        tinyML/.ai/network_emnist_digits_int8.tflite_c_info.json
+    python -m stm32dc.perfdb runs --kind bench
+    python -m stm32dc.perfdb history latency --kind bench
+    python -m stm32dc.perfdb compare                        # exit 1 on a regression
+    python -m stm32dc.perfdb compare --kind hil --base 3f2a1c9
+
+A run is one measurement by one tool: its kind, a config naming what was
+measured (the request mode, the model, the build profile), the git
+revision of this tree (+dirty with uncommitted changes), the model hash
+the board reported and its chip ID. Its metrics are numbers by name, and
+the ones measured per image keep their samples as well:
+
+    bench      bench --db: latency (median ms, samples), latency.p95/p99,
+               throughput, errors, accuracy (with --labels, samples), and
+               layer.<name> us with --layers
+    sim        sim --db: stage.<name> and layer.<name> cycles
+    hil        evaluate --db, one run per model: as bench, with
+               weights_size and activations_size
+    build      builds --db, one run per profile: stage.<name> and total
+               cycles, run.p99, size.<section>
+    footprint  a c_info report: rom and ram, weights, activations
+
+record files in the same runs from the JSON of sim --save, evaluate
+--json and builds --json, and from c_info reports; the figures are those
+files', without samples.
+
+compare takes the latest run of each kind and config (or --run, --rev)
+against the --window runs of it before (or those at --base). A metric
+regresses when it is more than --tolerance worse than the baseline's
+median and the difference is significant at --alpha: a Mann-Whitney
+test between the samples where both runs have them, otherwise the run's
+value against the spread of the baseline runs. With a single baseline
+run and no samples there is no spread, and the change is taken as it is
+(the simulator's counts are exact). Accuracy and throughput regress
+downwards, everything else upwards.
+"""
+import argparse
+import json
+import math
+import os
+import sqlite3
+import statistics
+import subprocess
+import sys
+import time
+
+DEFAULT_DB = 'perf.sqlite'
+WINDOW = 5
+ALPHA = 0.01
+TOLERANCE = 0.02
+# Samples kept per metric; longer runs keep an evenly strided subset
+SAMPLES = 5000
+HIGHER_BETTER = ('accuracy', 'throughput')
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SCHEMA = """
+CREATE TABLE IF NOT EXISTS runs (
+    id INTEGER PRIMARY KEY, time TEXT, kind TEXT, config TEXT,
+    revision TEXT, model_hash TEXT, board TEXT, note TEXT);
+CREATE TABLE IF NOT EXISTS metrics (
+    run INTEGER REFERENCES runs(id), name TEXT, value REAL, samples TEXT,
+    PRIMARY KEY (run, name));
+CREATE INDEX IF NOT EXISTS runs_group ON runs (kind, config, id);
+"""
+
+
+def connect(path=DEFAULT_DB):
+    db = sqlite3.connect(path)
+    db.executescript(SCHEMA)
+    return db
+
+
+def revision(ref='HEAD'):
+    """Short hash of ref in this tree, +dirty when HEAD has uncommitted changes; '' outside git"""
+    try:
+        rev = subprocess.run(['git', 'rev-parse', '--short=12', ref], cwd=ROOT, capture_output=True,
+                             text=True, check=True).stdout.strip()
+        if ref == 'HEAD' and subprocess.run(['git', 'status', '--porcelain', '--untracked-files=no'],
+                                            cwd=ROOT, capture_output=True, text=True).stdout.strip():
+            rev += '+dirty'
+        return rev
+    except (OSError, subprocess.CalledProcessError):
+        return ''
+
+
+def record(path, kind, metrics, config='', samples=None, model_hash='', board='', note='', rev=None):
+    """Store a run of {name: value} metrics and {name: [values]} samples, returns its id"""
+    db = connect(path)
+    with db:
+        cur = db.execute("INSERT INTO runs (time, kind, config, revision, model_hash, board, note) "
+                         "VALUES (?, ?, ?, ?, ?, ?, ?)",
+                         (time.strftime('%Y-%m-%d %H:%M:%S'), kind, config,
+                          revision() if rev is None else rev, model_hash or '', board or '', note or ''))
+        run = cur.lastrowid
+        for name, value in metrics.items():
+            kept = (samples or {}).get(name)
+            if kept:
+                kept = list(kept)[::math.ceil(len(kept) / SAMPLES)]
+            db.execute("INSERT INTO metrics VALUES (?, ?, ?, ?)",
+                       (run, name, float(value), json.dumps(kept) if kept else None))
+    db.close()
+    return run
+
+
+def link_identity(link):
+    """(model hash, chip ID) from the board's last PING, '' where it did not say"""
+    caps = getattr(link, 'caps', None)
+    return (caps.model_hash, caps.uid) if caps else ('', '')
+
+
+def bench_metrics(result, labels=None):
+    """(metrics, samples) of a stm32dc.bench BenchResult"""
+    from .bench import percentile
+
+    lat = [s * 1e3 for s in result.latencies]
+    ordered = sorted(lat)
+    done = sum(p is not None for p in result.predictions)
+    metrics = {'latency': statistics.median(lat) if lat else 0.0,
+               'latency.p95': percentile(ordered, 95) if lat else 0.0,
+               'latency.p99': percentile(ordered, 99) if lat else 0.0,
+               'throughput': done / result.elapsed if result.elapsed else 0.0,
+               'errors': result.errors + result.timeouts}
+    samples = {'latency': lat}
+    if labels:
+        correct = [int(p == label) for p, label in zip(result.predictions, labels)]
+        metrics['accuracy'] = sum(correct) / len(correct) if correct else 0.0
+        samples['accuracy'] = correct
+    return metrics, samples
+
+
+def build_metrics(result):
+    """metrics of one stm32dc.builds result"""
+    metrics = {f'size.{k}': v for k, v in result.get('sizes', {}).items()}
+    if 'total' in result:
+        metrics.update({f'stage.{k}': result[k] for k in ('pre', 'run', 'argmax')})
+        metrics['total'] = result['total']
+        metrics['run.p99'] = result['run_p99']
+    return metrics
+
+
+def footprint_metrics(report):
+    """metrics of a c_info report's memory footprint"""
+    m = report['memory_footprint']
+    return {'rom': m['weights'] + m['kernel_flash'] + m.get('toolchain_flash', 0),
+            'ram': m['activations'] + m['kernel_ram'] + m.get('toolchain_ram', 0),
+            'weights': m['weights'], 'activations': m['activations']}
+
+
+def from_file(path):
+    """[(kind, config, metrics, model hash)] of a sim --save, evaluate --json, builds --json or c_info file"""
+    with open(path, encoding='utf-8') as f:
+        data = json.load(f)
+    if 'memory_footprint' in data:
+        name = os.path.basename(path).replace('_c_info.json', '')
+        signature = data.get('environment', {}).get('network_signature', '')
+        return [('footprint', name, footprint_metrics(data), signature.replace('0x', ''))]
+    if 'stages' in data:
+        metrics = {f'stage.{k}': v for k, v in data['stages'].items()}
+        metrics.update({f'layer.{k}': v for k, v in data.get('layers', {}).items()})
+        return [('sim', '', metrics, '')]
+    if 'models' in data:
+        runs = []
+        for m in data['models']:
+            metrics = {'latency': m['latency_ms']['p50'], 'latency.p95': m['latency_ms']['p95'],
+                       'latency.p99': m['latency_ms']['p99'], 'throughput': m['throughput'],
+                       'errors': m['errors'] + m['timeouts'], 'accuracy': m['accuracy'],
+                       'weights_size': m['weights_size'], 'activations_size': m['activations_size']}
+            runs.append(('hil', hil_config(m['model'], m['small'], data.get('batch', 0)), metrics, ''))
+        return runs
+    if 'results' in data and all('config' in r for r in data['results']):
+        return [('build', r['config'], build_metrics(r), '') for r in data['results'] if 'error' not in r]
+    raise ValueError(f"{path}: not a sim, evaluate, builds or c_info file")
+
+
+def hil_config(model, small, batch):
+    return f"model {model}{'/14' if small else ''} " + (f"batch {batch}" if batch and not small else "classify")
+
+
+def _runs(db, where='', params=()):
+    return db.execute(f"SELECT id, time, kind, config, revision, model_hash, board, note FROM runs "
+                      f"{where} ORDER BY id", params).fetchall()
+
+
+def _metrics(db, run):
+    return {name: (value, json.loads(samples) if samples else None)
+            for name, value, samples in db.execute("SELECT name, value, samples FROM metrics WHERE run = ?",
+                                                   (run,))}
+
+
+def mann_whitney(a, b):
+    """Two-sided p of a Mann-Whitney U test between samples a and b (normal approximation, tie corrected)"""
+    pooled = sorted([(x, 0) for x in a] + [(x, 1) for x in b])
+    n, na, nb = len(pooled), len(a), len(b)
+    rank_b, ties, i = 0.0, 0, 0
+    while i < n:
+        j = i
+        while j < n and pooled[j][0] == pooled[i][0]:
+            j += 1
+        rank = (i + j + 1) / 2
+        rank_b += rank * sum(1 for k in range(i, j) if pooled[k][1])
+        ties += (j - i) ** 3 - (j - i)
+        i = j
+    u = rank_b - nb * (nb + 1) / 2
+    sigma = math.sqrt(na * nb / 12 * ((n + 1) - ties / (n * (n - 1))))
+    if sigma == 0:
+        return 1.0  # every value tied
+    z = max(0.0, abs(u - na * nb / 2) - 0.5) / sigma
+    return math.erfc(z / math.sqrt(2))
+
+
+def significance(base, cand):
+    """p of the candidate's (value, samples) differing from the baseline's [(value, samples)], or None"""
+    value, samples = cand
+    base_samples = [s for _, s in base if s]
+    if samples and len(samples) > 1 and len(base_samples) == len(base):
+        return mann_whitney([x for s in base_samples for x in s], samples)
+    values = [v for v, _ in base]
+    if len(values) < 2:
+        return None
+    spread = statistics.stdev(values)
+    if spread == 0:
+        return 1.0 if value == values[0] else 0.0
+    z = abs(value - statistics.mean(values)) / (spread * math.sqrt(1 + 1 / len(values)))
+    return math.erfc(z / math.sqrt(2))
+
+
+def change(name, before, after):
+    """Relative change of a metric, positive when worse"""
+    if before == 0:
+        delta = 0.0 if after == 0 else math.copysign(math.inf, after)
+    else:
+        delta = after / before - 1
+    return -delta if name.split('.')[0] in HIGHER_BETTER else delta
+
+
+def compare(db, candidate, baseline, alpha=ALPHA, tolerance=TOLERANCE):
+    """[(metric, before, after, worse by, p, regressed)] of candidate run id against baseline run ids"""
+    cand = _metrics(db, candidate)
+    base = [_metrics(db, run) for run in baseline]
+    rows = []
+    for name, (value, samples) in sorted(cand.items()):
+        history = [m[name] for m in base if name in m]
+        if not history:
+            continue
+        before = statistics.median(v for v, _ in history)
+        worse = change(name, before, value)
+        p = significance(history, (value, samples))
+        rows.append((name, before, value, worse, p, worse > tolerance and (p is None or p < alpha)))
+    return rows
+
+
+def groups(db, kind=None, config=None):
+    where, params = [], []
+    if kind:
+        where.append("kind = ?")
+        params.append(kind)
+    if config is not None:
+        where.append("config = ?")
+        params.append(config)
+    clause = f"WHERE {' AND '.join(where)}" if where else ''
+    return db.execute(f"SELECT kind, config FROM runs {clause} GROUP BY kind, config ORDER BY MIN(id)",
+                      params).fetchall()
+
+
+def pick_runs(db, kind, config, run=None, rev=None, base=None, window=WINDOW):
+    """(candidate run id, [baseline run ids]) of a kind and config, candidate None when there is none"""
+    ids = [r[0] for r in db.execute("SELECT id FROM runs WHERE kind = ? AND config = ? ORDER BY id",
+                                    (kind, config))]
+    revs = dict(db.execute("SELECT id, revision FROM runs WHERE kind = ? AND config = ?", (kind, config)))
+    if run is not None:
+        cands = [i for i in ids if i == run]
+    elif rev:
+        cands = [i for i in ids if revs[i].startswith(rev)]
+    else:
+        cands = ids
+    if not cands:
+        return None, []
+    cand = cands[-1]
+    if base:
+        return cand, [i for i in ids if revs[i].startswith(base) and i != cand][-window:]
+    return cand, [i for i in ids if i < cand][-window:]
+
+
+def _resolve(rev):
+    """A revision as recorded: a ref git knows becomes its short hash, anything else is a prefix"""
+    return (revision(rev).split('+')[0] or rev) if rev else rev
+
+
+def cmd_record(args):
+    for path in args.files:
+        for kind, config, metrics, model_hash in from_file(path):
+            run = record(args.db, kind, metrics, args.config if args.config is not None else config,
+                         model_hash=args.model_hash or model_hash, board=args.board, note=args.note,
+                         rev=args.rev)
+            print(f"run {run}: {kind} {config or '-'}, {len(metrics)} metrics from {path}")
+    return 0
+
+
+def cmd_runs(args):
+    db = connect(args.db)
+    where, params = ("WHERE kind = ?", (args.kind,)) if args.kind else ('', ())
+    runs = _runs(db, where, params)[-args.limit:]
+    print(f"{'run':>5}  {'time':<20}{'kind':<10}{'config':<34}{'revision':<19}{'model':<10}"
+          f"{'board':<10}metrics  note")
+    for run, when, kind, config, rev, model_hash, board, note in runs:
+        count = db.execute("SELECT COUNT(*) FROM metrics WHERE run = ?", (run,)).fetchone()[0]
+        print(f"{run:>5}  {when:<20}{kind:<10}{config or '-':<34}{rev or '-':<19}{model_hash[:8] or '-':<10}"
+              f"{board[:8] or '-':<10}{count:>7}  {note}")
+    return 0
+
+
+def cmd_history(args):
+    db = connect(args.db)
+    rows = db.execute("SELECT r.id, r.time, r.kind, r.config, r.revision, m.value FROM runs r "
+                      "JOIN metrics m ON m.run = r.id WHERE m.name = ?"
+                      + (" AND r.kind = ?" if args.kind else "")
+                      + (" AND r.config = ?" if args.config is not None else "") + " ORDER BY r.id",
+                      [args.metric] + ([args.kind] if args.kind else [])
+                      + ([args.config] if args.config is not None else [])).fetchall()
+    if not rows:
+        print(f"no runs with {args.metric}")
+        return 1
+    print(f"{'run':>5}  {'time':<20}{'kind':<10}{'config':<34}{'revision':<19}{args.metric:>14}{'change':>10}")
+    last = {}
+    for run, when, kind, config, rev, value in rows[-args.limit:]:
+        before = last.get((kind, config))
+        delta = f"{100 * (value / before - 1):+9.2f}%" if before else ''
+        print(f"{run:>5}  {when:<20}{kind:<10}{config or '-':<34}{rev or '-':<19}{value:>14.6g}{delta:>10}")
+        last[(kind, config)] = value
+    return 0
+
+
+def cmd_compare(args):
+    db = connect(args.db)
+    rev, base = _resolve(args.rev), _resolve(args.base)
+    if args.run is not None:
+        found = db.execute("SELECT kind, config FROM runs WHERE id = ?", (args.run,)).fetchone()
+        if not found:
+            print(f"no run {args.run}")
+            return 1
+        todo = [found]
+    else:
+        todo = groups(db, args.kind, args.config)
+    regressions = 0
+    for kind, config in todo:
+        cand, baseline = pick_runs(db, kind, config, args.run, rev, base, args.window)
+        if cand is None:
+            continue
+        if not baseline:
+            print(f"{kind} {config or '-'}: run {cand}, no baseline")
+            continue
+        cand_rev = db.execute("SELECT revision FROM runs WHERE id = ?", (cand,)).fetchone()[0]
+        print(f"{kind} {config or '-'}: run {cand} ({cand_rev or '-'}) against runs "
+              f"{', '.join(map(str, baseline))}")
+        for name, before, after, worse, p, regressed in compare(db, cand, baseline, args.alpha, args.tolerance):
+            if args.all or regressed or (p is not None and p < args.alpha and abs(worse) > args.tolerance):
+                label = "REGRESSION" if regressed else ("better" if worse < 0 else "")
+                sig = f"p {p:.2g}" if p is not None else "p ?"
+                delta = f"{100 * (after / before - 1):+9.2f} %" if before else f"{'':>11}"
+                print(f"  {name:<28}{before:>14.6g} -> {after:<14.6g}{delta}  {sig:<10}{label}")
+            regressions += regressed
+    print(f"{regressions} regression{'s' if regressions != 1 else ''} beyond {args.tolerance * 100:g} % "
+          f"at p < {args.alpha:g}")
+    return 1 if regressions else 0
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--db', default=DEFAULT_DB, help="SQLite file (default %(default)s)")
+    sub = ap.add_subparsers(dest='command', required=True)
+
+    p = sub.add_parser('record', help="store runs from sim --save, evaluate/builds --json or c_info files")
+    p.add_argument('files', nargs='+')
+    p.add_argument('--config', help="config of the runs instead of the one the file implies")
+    p.add_argument('--rev', help="revision instead of this tree's")
+    p.add_argument('--model-hash', default='')
+    p.add_argument('--board', default='', help="chip ID of the board measured")
+    p.add_argument('--note', default='')
+    p.set_defaults(func=cmd_record)
+
+    p = sub.add_parser('runs', help="list the runs")
+    p.add_argument('--kind')
+    p.add_argument('--limit', type=int, default=50)
+    p.set_defaults(func=cmd_runs)
+
+    p = sub.add_parser('history', help="one metric over the runs")
+    p.add_argument('metric', help="e.g. latency, stage.run, layer.conv2d_2, accuracy, rom")
+    p.add_argument('--kind')
+    p.add_argument('--config')
+    p.add_argument('--limit', type=int, default=50)
+    p.set_defaults(func=cmd_history)
+
+    p = sub.add_parser('compare', help="latest runs against their baseline, exit 1 on a regression")
+    p.add_argument('--kind')
+    p.add_argument('--config')
+    p.add_argument('--run', type=int, help="compare this run")
+    p.add_argument('--rev', help="compare the latest run at this revision")
+    p.add_argument('--base', help="baseline: the runs at this revision instead of the ones before")
+    p.add_argument('--window', type=int, default=WINDOW, help="baseline runs (default %(default)s)")
+    p.add_argument('--alpha', type=float, default=ALPHA, help="significance level (default %(default)s)")
+    p.add_argument('--tolerance', type=float, default=TOLERANCE, help="slowdown flagged, 0.02 = 2 %%")
+    p.add_argument('--all', action='store_true', help="list every metric, not only significant changes")
+    p.set_defaults(func=cmd_compare)
+
+    args = ap.parse_args(argv)
+    return args.func(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
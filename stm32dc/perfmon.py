@@ -0,0 +1,173 @@
+"""Rolling performance figures of a board session, for the GUI's performance panel.
+
+    monitor = PerfMonitor(worker, cache)
+    perf = monitor.snapshot()        # every refresh
+    for line in perf.lines():
+        print(line)
+
+Host side, over the last WINDOW seconds: the round trips of the worker's
+answered classifications (LinkWorker.round_trips) as p50/p95 and answers per
+second, and the link's errors per 1000 requests: replies that failed
+their CRC, requests sent again and requests that got no reply at all.
+The line rate, the reconnects since connecting and the cache's hits are
+as they are now.
+
+Device side, from a BULK STATS and a BULK PROFILE every DEVICE_PERIOD
+seconds, asked only while snapshots are being taken: inferences per
+second and the p50/p95 network run from the growth of the run histogram
+between two STATS, the device's error counters over the same time, its
+CPU shares (APP_LOAD) and the per-layer times of its last inference
+(APP_PROFILE_LAYERS). Firmware without one of them answers an error, and
+it is not asked again.
+"""
+import threading
+import time
+from collections import deque
+from typing import NamedTuple, Optional
+
+from .link import DeviceError
+from .metrics import DEVICE_ERRORS
+from .worker import BULK
+
+WINDOW = 10.0
+DEVICE_PERIOD = 2.0
+# Layers shown, the slowest first
+TOP_LAYERS = 6
+
+
+class Perf(NamedTuple):
+    window: float               # seconds the host figures cover
+    samples: int                # round trips in it
+    p50_ms: float
+    p95_ms: float
+    fps: float                  # answers per second
+    baud: Optional[int]
+    errors_permille: float      # CRC failures, retransmissions and timeouts per 1000 requests
+    crc: int                    # within the window, as the rest of the link counts
+    retransmits: int
+    timeouts: int
+    reconnects: int
+    cache_hits: int
+    cache_rate: float
+    inferences_per_s: Optional[float]  # None until two STATS were in
+    run_p50_us: Optional[float]
+    run_p95_us: Optional[float]
+    device_errors: int          # growth of the device's error counters between them
+    load: dict                  # protocol.Stats.utilization() of the last, empty without APP_LOAD
+    layers: list                # [(name, us)] of the last PROFILE, slowest first
+
+    def lines(self):
+        out = [f"latency   p50 {self.p50_ms:.1f} ms   p95 {self.p95_ms:.1f} ms   "
+               f"{self.fps:.1f} frames/s   ({self.samples} in {self.window:.0f} s)",
+               f"link      {self.baud or '?'} baud   {self.errors_permille:.1f} errors/1000 "
+               f"(CRC {self.crc}, resent {self.retransmits}, lost {self.timeouts})   "
+               f"reconnects {self.reconnects}",
+               f"cache     {self.cache_hits} hits ({100 * self.cache_rate:.0f} %)"]
+        if self.inferences_per_s is not None:
+            run = "" if self.run_p50_us is None else \
+                f"   run p50 {self.run_p50_us:.0f} us   p95 {self.run_p95_us:.0f} us"
+            out.append(f"device    {self.inferences_per_s:.1f} inferences/s{run}   "
+                       f"errors {self.device_errors}")
+        if self.load:
+            out.append("cpu       " + "   ".join(f"{name} {pct:.0f} %" for name, pct in self.load.items() if pct))
+        if self.layers:
+            out.append("layers    " + "   ".join(f"{name} {us:.0f} us" for name, us in self.layers))
+        return out
+
+
+def _growth(before, after):
+    return tuple((b - a) & 0xFFFFFFFF for a, b in zip(before, after))
+
+
+class PerfMonitor:
+    """Snapshots of a LinkWorker's session, polling the device while they are taken"""
+
+    def __init__(self, worker, cache=None, window=WINDOW, device_period=DEVICE_PERIOD):
+        self.worker = worker
+        self.cache = cache
+        self.window = window
+        self.device_period = device_period
+        self.lock = threading.Lock()
+        self.counters = deque()          # (monotonic, answered, crc, retransmits, timeouts)
+        self.stats = deque(maxlen=2)     # (monotonic, protocol.Stats), the last two
+        self.layers = []
+        self.polled_at = 0.0
+        self.asking = set()              # 'stats', 'profile' while a request is out
+        self.unsupported = set()         # ... that the firmware answered with an error
+
+    def snapshot(self):
+        now = time.monotonic()
+        w = self.worker
+        counts = (now, w.answered, w.link.reader.crc_errors, w.retransmits, w.timeouts)
+        self.counters.append(counts)
+        while len(self.counters) > 1 and self.counters[1][0] <= now - self.window:
+            self.counters.popleft()
+        first = self.counters[0]
+        answered, crc, resent, lost = (b - a for a, b in zip(first[1:], counts[1:]))
+
+        clock = time.perf_counter()
+        recent = [(at, rtt) for at, rtt in list(w.round_trips) if at >= clock - self.window]
+        rtts = sorted(rtt for _, rtt in recent)
+        # Over the window, or since the first answer in it while it fills
+        span = max(clock - recent[0][0], 1e-3) if recent else self.window
+        if now - self.polled_at >= self.device_period:
+            self.polled_at = now
+            self._poll()
+
+        with self.lock:
+            stats = list(self.stats)
+            layers = self.layers
+        rate = run50 = run95 = None
+        device_errors = 0
+        load = {}
+        if stats:
+            load = stats[-1][1].utilization()
+        if len(stats) == 2:
+            (t0, s0), (t1, s1) = stats
+            rate = ((s1.inferences - s0.inferences) & 0xFFFFFFFF) / max(t1 - t0, 1e-3)
+            runs = _growth(s0.run_hist, s1.run_hist)
+            if sum(runs):
+                run50, run95 = s1.percentile(runs, 0.5), s1.percentile(runs, 0.95)
+            device_errors = sum((getattr(s1, field) - getattr(s0, field)) & 0xFFFFFFFF
+                                for _, field in DEVICE_ERRORS)
+
+        cache = self.cache
+        return Perf(self.window, len(rtts), _at(rtts, 0.5) * 1e3, _at(rtts, 0.95) * 1e3, len(rtts) / span,
+                    getattr(w.port, 'baudrate', None),
+                    1000.0 * (crc + resent + lost) / max(1, answered + lost), crc, resent, lost,
+                    w.reconnects, cache.hits if cache else 0, cache.hit_rate if cache else 0.0,
+                    rate, run50, run95, device_errors, load, layers)
+
+    def _poll(self):
+        for name, submit, done in (('stats', self.worker.stats, self._on_stats),
+                                   ('profile', self.worker.layer_profile, self._on_profile)):
+            if name in self.unsupported or name in self.asking:
+                continue
+            self.asking.add(name)
+            future = submit(priority=BULK)  # behind what the user is waiting for
+            future.add_done_callback(lambda f, name=name, done=done: self._answer(name, f, done))
+
+    def _answer(self, name, future, done):
+        self.asking.discard(name)
+        if future.cancelled():
+            return
+        error = future.exception()
+        if isinstance(error, DeviceError):
+            self.unsupported.add(name)
+        elif error is None:
+            done(future.result())
+
+    def _on_stats(self, stats):
+        with self.lock:
+            self.stats.append((time.monotonic(), stats))
+
+    def _on_profile(self, layers):
+        with self.lock:
+            self.layers = sorted(layers, key=lambda layer: -layer[1])[:TOP_LAYERS]
+
+
+def _at(sorted_values, fraction):
+    """The fraction quantile of sorted_values, 0 when empty"""
+    if not sorted_values:
+        return 0.0
+    return sorted_values[min(len(sorted_values) - 1, int(fraction * len(sorted_values)))]
@@ -0,0 +1,170 @@
+"""Split one network across two boards and pipeline images through them (APP_SPLIT).
+
+    python -m stm32dc.pipeline --front COM9 --back COM10 --count 2000
+    python -m stm32dc.pipeline --front COM9 --back COM10 --baseline --count 2000
+    python -m stm32dc.pipeline --front COM9 --forward --count 2000
+
+The front board runs the first c-nodes of each image (STAGE FRONT: conv2d_0
+and conv2d_2 of the digits network) and answers the 800 B tensor they
+leave, which goes to the back board as a STAGE BACK (gemm_5, gemm_6, nl_7)
+as soon as it arrives. Both boards keep several requests in flight
+(stm32dc.worker), so the front one computes image n + 1 while the back one
+finishes image n. Both must run the same model.
+
+--forward: the boards are wired to each other (APP_SPLIT_LINK on the front
+board, see app_config.h); the front one sends the tensor on itself and
+relays the back one's answer, the host only talks to the front one.
+
+--baseline first classifies the same images whole on each board, and
+prints the throughput per board of both setups: two replicas do twice
+what one board does, the split has to beat that to be worth its second
+board.
+"""
+import argparse
+import sys
+import threading
+import time
+from concurrent.futures import Future
+
+from . import protocol
+from .bench import BenchResult, load_idx, load_images, open_device, run_pipelined, synthetic_images
+from .link import DeviceError
+from .worker import LinkWorker
+
+
+def classify_split(front, back, image, split=0):
+    """Future of the digit: FRONT on the front worker, then BACK of its tensor on the back one.
+
+    back None: the front board forwards the tensor itself (STAGE_FORWARD).
+    """
+    future = Future()
+    if back is None:
+        inner = front.stage(protocol.STAGE_FRONT, image, split, protocol.STAGE_FORWARD)
+        inner.add_done_callback(lambda f: _resolve(future, f))
+        return future
+
+    def front_done(f):
+        try:
+            stage = f.result()
+        except Exception as e:
+            future.set_exception(e)
+            return
+        # Runs on the front worker's reader thread, submit only queues
+        back.stage(protocol.STAGE_BACK, stage.boundary, stage.split).add_done_callback(
+            lambda b: _resolve(future, b))
+
+    front.stage(protocol.STAGE_FRONT, image, split).add_done_callback(front_done)
+    return future
+
+
+def _resolve(future, inner):
+    try:
+        future.set_result(inner.result().digit)
+    except Exception as e:
+        future.set_exception(e)
+
+
+def run_split(front, back, images, split=0, window=8):
+    """Every image through both stages, window images in flight"""
+    result = BenchResult()
+    slots = threading.Semaphore(window)
+    futures = []
+    start = time.perf_counter()
+    for img in images:
+        slots.acquire()
+        future = classify_split(front, back, img, split)
+        future.sent = time.perf_counter()
+        future.add_done_callback(lambda f: setattr(f, 'done_at', time.perf_counter()))
+        future.add_done_callback(lambda f: slots.release())
+        futures.append(future)
+    for future in futures:
+        try:
+            digit = future.result()
+        except DeviceError:
+            result.errors += 1
+            digit = None
+        except (TimeoutError, ConnectionError):
+            result.timeouts += 1
+            digit = None
+        result.latencies.append(future.done_at - future.sent)
+        result.predictions.append(digit)
+    result.elapsed = time.perf_counter() - start
+    return result
+
+
+def per_board(result, boards):
+    done = sum(p is not None for p in result.predictions)
+    return done / result.elapsed / boards if result.elapsed else 0.0
+
+
+def check(caps, port):
+    if caps is None or not caps.features & protocol.FEAT_STAGE:
+        raise SystemExit(f"{port}: the firmware has no STAGE, build it with APP_SPLIT=1")
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--front', required=True, metavar='PORT', help="board running the first c-nodes")
+    ap.add_argument('--back', metavar='PORT', help="board running the rest")
+    ap.add_argument('--forward', action='store_true',
+                    help="the front board hands the tensor to its wired back board (APP_SPLIT_LINK)")
+    ap.add_argument('--split', type=int, default=0,
+                    help="c-nodes on the front board, 0 for the firmware default")
+    ap.add_argument('--window', type=int, default=8, help="images in flight (default %(default)s)")
+    ap.add_argument('--baud', type=int, default=921600)
+    ap.add_argument('--rtscts', action='store_true')
+    ap.add_argument('--images', help="IDX or .npy file of 28x28 uint8 images")
+    ap.add_argument('--labels', help="IDX label file, enables the accuracy line")
+    ap.add_argument('--count', type=int, default=500)
+    ap.add_argument('--baseline', action='store_true',
+                    help="also classify the images whole on each board, for the per-board rate")
+    args = ap.parse_args(argv)
+    if bool(args.back) == args.forward:
+        ap.error("give either --back or --forward")
+
+    images = load_images(args.images)[:args.count] if args.images else synthetic_images(args.count)
+    labels = load_idx(args.labels)[:len(images)] if args.labels else None
+
+    ports = [args.front] + ([args.back] if args.back else [])
+    opened = [open_device(port, args.baud, args.rtscts) for port in ports]
+    try:
+        links = [link for _, link, _ in opened]
+        for port, link in zip(ports, links):
+            check(link.caps, port)
+        if args.forward and not links[0].caps.features & protocol.FEAT_FORWARD:
+            raise SystemExit(f"{args.front}: no back board wired, build it with APP_SPLIT_LINK")
+        if len({link.caps.model_hash for link in links}) > 1:
+            raise SystemExit("the boards run different models, the tensor would mean nothing")
+
+        baseline = []
+        if args.baseline:
+            for port, link in zip(ports, links):
+                r = run_pipelined(link, images)
+                baseline.append(r)
+                print(f"--- {port} whole ---")
+                print(r.report(labels))
+
+        workers = [LinkWorker(link).start() for link in links]
+        try:
+            result = run_split(workers[0], workers[1] if args.back else None, images,
+                               args.split, args.window)
+        finally:
+            for worker in workers:
+                worker.close()
+
+        print(f"--- split, {'forwarded' if args.forward else 'relayed by the host'} ---")
+        print(result.report(labels))
+        boards = 2
+        print(f"per board     {per_board(result, boards):.1f} images/s split", end='')
+        if baseline:
+            whole = sum(per_board(r, 1) for r in baseline) / len(baseline)
+            print(f", {whole:.1f} images/s whole ({per_board(result, boards) / whole:.2f}x)", end='')
+        print()
+    finally:
+        for conn, _, _ in opened:
+            conn.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
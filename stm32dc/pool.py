@@ -0,0 +1,611 @@
+"""Spread requests over several boards, one LinkWorker per port.
+
+    pool = DevicePool.open(['COM9', 'COM10', 'COM11'], baud=921600)
+    futures = [pool.classify(img) for img in images]
+    digits = [f.result() for f in futures]
+    for m in pool.health():
+        print(m.port, m.completed, m.throughput)
+    pool.close()
+
+Each request goes to one healthy board: the next in turn (round-robin) or
+the one with the fewest requests outstanding (least-outstanding, the
+default, which lets a faster or less loaded board take more). A board that
+times out or loses its port MAX_FAILURES times in a row is marked down and
+gets no more requests; what fails on it with a transport error is sent
+once more to another board. Device errors (a refused or failed inference)
+are answered as they are, the board stays up. A port lost under a worker
+is first reopened by the worker itself (LinkWorker reopen), its requests
+in flight resent; only one gone for good fails them.
+
+Interactive requests are hedged: one still unanswered the p95 of recent
+interactive round trips after it went on the wire goes to a second board
+as well, and the first answer wins. Both are timed from the write, not
+from submit(), so time spent queued in the pool's own workers neither
+inflates the p95 nor triggers a hedge, and a request still queued is
+never hedged. The copy only goes to a board with nothing queued in its
+worker, where it can win, and hedges are held to HEDGE_BUDGET (5 %) of
+recent interactive requests. The other copy is withdrawn with
+LinkWorker.cancel(), on the device too where it has APP_CANCEL. A board
+stalled on a resync or a UART error then costs one p95 instead of a
+timeout and a retry. Bulk requests are never hedged.
+
+Boards may be built with different model sets. open() asks every board
+for its registered models at the handshake (discover(): SELECT_MODEL and
+PING per index, the X-CUBE-AI signature identifies a model across boards)
+and which one is active. A request made with model=<signature> goes only
+to boards that have it, by load among those where it is active. A board
+is switched to it only when none has it active, or when those that do
+have SWITCH_LOAD requests outstanding, and then only a board with nothing
+outstanding (its queued requests would otherwise run on the new model)
+that has not switched for SWITCH_DWELL seconds. Requests no board can take
+without a switch wait in the pool until one goes idle. model=None takes
+any board, whatever it runs.
+
+drain() takes a board out of rotation until its outstanding requests are
+answered, undrain() puts it back: stm32dc.upload.rollout() uploads new
+weights one board at a time that way, the rest of the pool serving.
+"""
+import heapq
+import itertools
+import threading
+import time
+from collections import deque
+from concurrent.futures import Future
+from typing import NamedTuple
+
+from . import protocol
+from .boards import expand
+from .link import DeviceBusy, DeviceError
+from .metrics import Histogram
+from .worker import INTERACTIVE, LinkWorker
+
+ROUND_ROBIN = 'round-robin'
+LEAST_OUTSTANDING = 'least-outstanding'
+POLICIES = (ROUND_ROBIN, LEAST_OUTSTANDING)
+
+# Failures that say nothing about the request, only about the board or its link
+TRANSPORT_ERRORS = (TimeoutError, ConnectionError, OSError)
+
+
+# _pick(): no board can take the request until one goes idle
+WAIT = object()
+
+
+def discover(link):
+    """({signature: index} of a board's registered models, active index), probed over a link
+
+    Leaves the board on its active model. Firmware that cannot switch
+    answers with its one model.
+    """
+    try:
+        sel = link.select_model()
+    except DeviceError:
+        return ({link.caps.model_hash: 0} if link.caps else {}), 0
+    models = {}
+    try:
+        for index in range(sel.count):
+            link.select_model(index)
+            caps = link.probe()
+            models.setdefault(caps.model_hash, index)
+    finally:
+        link.select_model(sel.active)
+        link.probe()
+    return models, sel.active
+
+
+class MemberHealth(NamedTuple):
+    port: str
+    healthy: bool
+    outstanding: int
+    completed: int
+    errors: int          # device errors, the board answered
+    failures: int        # timeouts and link errors
+    mean_latency: float  # seconds from dispatch to result, completed requests
+    throughput: float    # completed requests per second since open or reset_stats
+    last_error: str
+    model: str = ''      # signature of the active model, '' if unknown
+    switches: int = 0    # model switches the pool made
+    refusals: int = 0    # requests the board refused for want of a slot (APP_ADMISSION)
+
+
+class _Call:
+    """One pool request and the board requests it went out as"""
+
+    __slots__ = ('method', 'args', 'priority', 'model', 'future', 'tried', 'inners', 'done', 'hedged')
+
+    def __init__(self, method, args, priority, model=None):
+        self.method = method
+        self.args = args
+        self.priority = priority
+        self.model = model   # signature the board must run, None for any
+        self.future = Future()
+        self.tried = []      # boards dispatched to, in order
+        self.inners = []     # (member, LinkWorker future, SELECT_MODEL future or None)
+        self.done = False
+        self.hedged = False
+
+
+def _withdrawn(inner):
+    """True if a board request ended because it was cancelled"""
+    if inner.cancelled():
+        return True
+    error = inner.exception()
+    return isinstance(error, DeviceError) and error.code == protocol.ERR_CANCELLED
+
+
+class _Member:
+    def __init__(self, port, conn, worker, models=None, active=None):
+        self.port = port
+        self.conn = conn
+        self.worker = worker
+        self.models = models or {}   # signature -> registry index
+        self.active = active         # index of the active model, None if unknown
+        self.switched_at = 0.0       # monotonic time of the last switch
+        self.switches = 0
+        self.healthy = True
+        self.drained = False         # takes no new requests, drain()
+        self.outstanding = 0
+        self.completed = 0
+        self.errors = 0
+        self.failures = 0
+        self.streak = 0      # consecutive transport failures
+        self.refusals = 0
+        self.busy_until = 0.0        # monotonic time its last refusal said to come back at
+        self.busy_time = 0.0
+        self.last_error = ''
+        self.latency = {}    # model signature -> metrics.Histogram of completed requests
+
+    def signature(self):
+        """Signature of the active model, '' if unknown"""
+        return next((sig for sig, i in self.models.items() if i == self.active), '')
+
+
+class DevicePool:
+    """LinkWorkers of several boards behind the LinkWorker request methods"""
+
+    MAX_FAILURES = 3
+    MAX_DISPATCHES = 2   # first board plus one other after a transport error
+    # Interactive round trips the hedge delay is the p95 of, and how many
+    # are needed before hedging starts
+    HEDGE_WINDOW = 200
+    HEDGE_MIN_SAMPLES = 20
+    HEDGE_PERCENTILE = 95
+    # The delay is recomputed every this many samples
+    HEDGE_UPDATE = 16
+    # Hedges allowed per interactive request, and how many may go out
+    # back to back after a quiet spell
+    HEDGE_BUDGET = 0.05
+    HEDGE_BURST = 2.0
+    # Outstanding requests on every board running a model before an idle
+    # board is switched to it, and the least time between two switches of
+    # a board for load alone
+    SWITCH_LOAD = 2
+    SWITCH_DWELL = 1.0
+    # Seconds between looks at a draining board's outstanding requests
+    DRAIN_POLL = 0.01
+
+    def __init__(self, members, policy=LEAST_OUTSTANDING, hedge=True):
+        if policy not in POLICIES:
+            raise ValueError(f"policy must be one of {', '.join(POLICIES)}")
+        if not members:
+            raise ValueError("a pool needs at least one board")
+        self.members = members
+        self.policy = policy
+        self.lock = threading.Lock()
+        self.turn = itertools.count()
+        self.started = time.perf_counter()
+        self.hedge = hedge and len(members) > 1
+        self.latencies = deque(maxlen=self.HEDGE_WINDOW)  # interactive round trips, seconds
+        self.samples = 0                 # round trips recorded, the window's length stops at HEDGE_WINDOW
+        self.hedge_delay = None          # seconds, None until enough samples
+        self.hedges = 0                  # requests sent to a second board
+        self.hedge_wins = 0              # of those, answered by the second board first
+        self.hedge_credit = 0.0          # hedges the budget allows now
+        self.timers = []                 # heap of (due, n, _Call) awaiting their hedge
+        self.unsent = {}                 # first board request of a hedgeable call -> call, until on the wire
+        self.timer_seq = itertools.count()
+        self.timer_cond = threading.Condition(self.lock)
+        self.timer_thread = None
+        self.closed = False
+        self.waiting = deque()           # _Calls that need a board to go idle and switch
+        if len(members) > 1:
+            for m in members:
+                m.worker.on_busy = lambda busy, m=m: self._refused(m, busy)
+        if self.hedge:
+            for m in members:
+                m.worker.on_sent = self._sent
+
+    @classmethod
+    def open(cls, ports, baud, policy=LEAST_OUTSTANDING, rtscts=False, weights=None,
+             capture=None, hedge=True):
+        """Open, probe and start a worker on every port; ports that don't answer are closed
+
+        weights is each LinkWorker's (interactive, bulk) share, None for strict priority.
+        capture, a CaptureWriter, records every board's traffic, source = index in ports.
+        hedge sends interactive requests slower than the p95 to a second board too.
+        Every board's models are discovered before its worker starts.
+        """
+        from .bench import open_device, reopener
+
+        ports = expand(ports, baud)
+        members = []
+        try:
+            for index, port in enumerate(ports):
+                conn, link, _ = open_device(port, baud, rtscts)
+                try:
+                    models, active = discover(link)
+                except Exception:
+                    conn.close()
+                    raise
+                worker = LinkWorker(link, weights, capture, index, reopen=reopener(port, baud, rtscts))
+                members.append(_Member(port, conn, worker.start(), models, active))
+        except Exception:
+            for m in members:
+                m.worker.close()
+                m.conn.close()
+            raise
+        return cls(members, policy, hedge)
+
+    def close(self):
+        with self.lock:
+            self.closed = True
+            self.timer_cond.notify()
+        if self.timer_thread is not None:
+            self.timer_thread.join()
+            self.timer_thread = None
+        for m in self.members:
+            m.worker.close()
+            if m.conn is not None:
+                m.conn.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def __len__(self):
+        return len(self.members)
+
+    def _pick(self, exclude, model=None, hedge=False):
+        """Next board for a request under the policy
+
+        Returns (member, index to switch it to or None), None if every
+        candidate is down, or WAIT when one must go idle to switch first.
+        A hedge never switches.
+        """
+        with self.lock:
+            up = [m for m in self.members
+                  if m.healthy and m not in exclude and (model is None or model in m.models)]
+            if not up:
+                return None
+            if all(m.drained for m in up):
+                return None if hedge else WAIT
+            up = [m for m in up if not m.drained]
+            # Boards that refused a request lately only when all have
+            now = time.monotonic()
+            up = [m for m in up if m.busy_until <= now] or up
+            first = next(self.turn) % len(up)
+            rotated = up[first:] + up[:first]
+            select = None
+            if model is not None:
+                running = [m for m in rotated if m.active == m.models[model]]
+                idle = [m for m in rotated if m not in running and m.outstanding == 0]
+                if running:
+                    # Switching for load alone must pay off and not thrash
+                    idle = [m for m in idle if now - m.switched_at >= self.SWITCH_DWELL]
+                    if min(m.outstanding for m in running) < self.SWITCH_LOAD:
+                        idle = []
+                if idle and not hedge:
+                    member = idle[0]
+                    select = member.active = member.models[model]
+                    member.switched_at = now
+                    member.switches += 1
+                    member.outstanding += 1
+                    return member, select
+                if not running:
+                    return None if hedge else WAIT
+                rotated = running
+            if self.policy == LEAST_OUTSTANDING:
+                member = min(rotated, key=lambda m: m.outstanding)
+            else:
+                member = rotated[0]
+            member.outstanding += 1
+            return member, select
+
+    def _dispatch(self, call, hedge=False, front=False):
+        """Send call to the next board; False if none is left to take it, WAIT if it waits"""
+        exclude = call.tried
+        if hedge:
+            # A copy queued behind other requests cannot win
+            exclude = exclude + [m for m in self.members if any(m.worker.queued())]
+        picked = self._pick(exclude, call.model, hedge)
+        if picked is WAIT:
+            with self.lock:
+                if front:
+                    self.waiting.appendleft(call)
+                else:
+                    self.waiting.append(call)
+            if not front:
+                self._drain()  # a board may have gone idle since _pick
+            return WAIT
+        if picked is None:
+            return False
+        member, select = picked
+        with self.lock:
+            call.tried.append(member)
+        sent = time.perf_counter()
+        # The switch goes interactive even for a bulk call: the call behind
+        # it on the board must not overtake it
+        switch = member.worker.select_model(select) if select is not None else None
+        inner = getattr(member.worker, call.method)(*call.args, priority=call.priority)
+        with self.lock:
+            call.inners.append((member, inner, switch))
+            if self.hedge and call.priority == INTERACTIVE and not call.hedged and len(call.inners) == 1:
+                if getattr(inner, 'wire_at', None) is not None:
+                    self._arm(call, inner.wire_at)
+                else:
+                    self.unsent[inner] = call  # armed by _sent
+        inner.add_done_callback(lambda f: self._done(call, member, sent, f, switch))
+        return True
+
+    def _drain(self):
+        """Dispatch the calls waiting for an idle board, in order, while boards take them"""
+        while True:
+            with self.lock:
+                if not self.waiting:
+                    return
+                call = self.waiting.popleft()
+            taken = self._dispatch(call, front=True)
+            if taken is WAIT:
+                return
+            if not taken:
+                self._resolve(call, error=ConnectionError("No healthy board has the model"))
+
+    def _done(self, call, member, sent, inner, switch=None):
+        withdrawn = _withdrawn(inner)
+        error = None if withdrawn else inner.exception()
+        if error is None and switch is not None and switch.done() and switch.exception() is not None:
+            # Ran on whatever model the board had: send it again
+            error = ConnectionError(f"Model switch failed: {switch.exception()}")
+        now = time.perf_counter()
+        latency = now - sent
+        with self.lock:
+            self.unsent.pop(inner, None)
+            member.outstanding -= 1
+            if switch is not None and error is not None and not withdrawn:
+                member.active = None  # unknown until switched again
+            if withdrawn:
+                pass  # the losing copy of a hedged request, or cancelled by the caller
+            elif error is None:
+                member.completed += 1
+                member.streak = 0
+                member.busy_time += latency
+                model = call.model or member.signature()
+                if model not in member.latency:
+                    member.latency[model] = Histogram()
+                member.latency[model].observe(latency)
+                wire_at = getattr(inner, 'wire_at', None)
+                if call.priority == INTERACTIVE and wire_at is not None:
+                    self._sample(now - wire_at)
+            elif isinstance(error, DeviceBusy):
+                pass  # counted in _refused, the board is fine
+            elif isinstance(error, TRANSPORT_ERRORS):
+                member.failures += 1
+                member.streak += 1
+                member.last_error = str(error)
+                if member.streak >= self.MAX_FAILURES:
+                    member.healthy = False
+            else:
+                member.errors += 1
+                member.streak = 0
+                member.last_error = str(error)
+
+            # Another copy may still answer
+            others = any(not f.done() for m, f, _ in call.inners if f is not inner)
+            if withdrawn and not others:
+                error = ConnectionError("Cancelled")
+            if call.done or ((withdrawn or isinstance(error, TRANSPORT_ERRORS + (DeviceBusy,))) and others):
+                action = None
+            elif isinstance(error, TRANSPORT_ERRORS) and \
+                    len(call.tried) < self.MAX_DISPATCHES + call.hedged:
+                action = 'retry'
+            elif isinstance(error, DeviceBusy) and len(call.tried) < len(self.members):
+                action = 'retry'  # to a board with room, _refused found one
+            else:
+                action = 'resolve'
+                call.done = True
+                if error is None and call.hedged and member is not call.tried[0]:
+                    self.hedge_wins += 1
+                losers = [(m, f) for m, f, _ in call.inners if f is not inner and not f.done()]
+
+        if action == 'retry' and not self._dispatch(call):
+            self._resolve(call, error=error if isinstance(error, DeviceBusy) else
+                          ConnectionError("No healthy board in the pool"))
+        # The board may be idle now, for a call waiting to switch it
+        self._drain()
+        if action != 'resolve':
+            return
+        for m, f in losers:
+            m.worker.cancel(f)
+        if error is None:
+            call.future.set_result(inner.result())
+        else:
+            call.future.set_exception(error)
+
+    def _refused(self, member, busy):
+        """LinkWorker.on_busy of a member: True to send the request to another board
+
+        The board is passed over until its retry_after is up. The request
+        moves when another healthy board has not refused one lately,
+        otherwise it waits for this one's room.
+        """
+        now = time.monotonic()
+        with self.lock:
+            member.refusals += 1
+            member.busy_until = now + busy.retry_after
+            return any(m is not member and m.healthy and not m.drained and m.busy_until <= now
+                       for m in self.members)
+
+    def _resolve(self, call, result=None, error=None):
+        with self.lock:
+            if call.done:
+                return
+            call.done = True
+        if error is None:
+            call.future.set_result(result)
+        else:
+            call.future.set_exception(error)
+
+    def _sample(self, latency):
+        """Record an interactive round trip from the write, refresh the hedge delay now and then
+
+        Holds self.lock.
+        """
+        self.latencies.append(latency)
+        self.samples += 1
+        n = len(self.latencies)
+        if n >= self.HEDGE_MIN_SAMPLES and (self.hedge_delay is None or self.samples % self.HEDGE_UPDATE == 0):
+            lat = sorted(self.latencies)
+            self.hedge_delay = lat[min(n - 1, n * self.HEDGE_PERCENTILE // 100)]
+
+    def _sent(self, inner):
+        """LinkWorker.on_sent: arm the hedge of a call whose first request just went on the wire"""
+        with self.lock:
+            call = self.unsent.pop(inner, None)
+            if call is not None and not call.done:
+                self._arm(call, inner.wire_at)
+
+    def _arm(self, call, wire_at):
+        """Hedge call the current delay after wire_at unless it is answered by then (holds self.lock)"""
+        if self.hedge_delay is None or self.closed:
+            return
+        heapq.heappush(self.timers, (wire_at + self.hedge_delay, next(self.timer_seq), call))
+        if self.timer_thread is None:
+            self.timer_thread = threading.Thread(target=self._hedge_loop, name='pool-hedge', daemon=True)
+            self.timer_thread.start()
+        self.timer_cond.notify()
+
+    def _hedge_loop(self):
+        while True:
+            with self.lock:
+                while not self.closed:
+                    now = time.perf_counter()
+                    if self.timers and self.timers[0][0] <= now:
+                        break
+                    self.timer_cond.wait(self.timers[0][0] - now if self.timers else None)
+                if self.closed:
+                    return
+                _, _, call = heapq.heappop(self.timers)
+                if call.done or call.hedged or self.hedge_credit < 1.0:
+                    continue
+                call.hedged = True
+                self.hedges += 1
+                self.hedge_credit -= 1.0
+            if not self._dispatch(call, hedge=True):
+                # Every other board has a queue: no copy, nor a hedge spent
+                with self.lock:
+                    call.hedged = False
+                    self.hedges -= 1
+                    self.hedge_credit += 1.0
+
+    def submit(self, method, *args, priority=INTERACTIVE, model=None) -> Future:
+        """Call LinkWorker.<method>(*args, priority=priority) on the board the policy picks
+
+        model, a signature from models(), restricts it to the boards that
+        have that model and switches one to it if need be.
+        """
+        call = _Call(method, args, priority, model)
+        call.future.set_running_or_notify_cancel()
+        if self.hedge and priority == INTERACTIVE:
+            with self.lock:
+                self.hedge_credit = min(self.HEDGE_BURST, self.hedge_credit + self.HEDGE_BUDGET)
+        if not self._dispatch(call):
+            call.future.set_exception(ConnectionError(
+                "No healthy board in the pool" if model is None else f"No healthy board has model {model}"))
+        return call.future
+
+    def classify(self, image, priority=INTERACTIVE, model=None) -> Future:
+        return self.submit('classify', bytes(image), priority=priority, model=model)
+
+    def classify_profiled(self, image, priority=INTERACTIVE, model=None) -> Future:
+        return self.submit('classify_profiled', bytes(image), priority=priority, model=model)
+
+    def classify_packed(self, image, priority=INTERACTIVE, model=None) -> Future:
+        # Every board keeps its own DELTA base, repeated images may go to another one
+        return self.submit('classify_packed', bytes(image), priority=priority, model=model)
+
+    def classify_small(self, image, priority=INTERACTIVE, model=None) -> Future:
+        return self.submit('classify_small', bytes(image), priority=priority, model=model)
+
+    def classify_topk(self, image, k=None, priority=INTERACTIVE, model=None) -> Future:
+        return self.submit('classify_topk', bytes(image), *(() if k is None else (k,)),
+                           priority=priority, model=model)
+
+    def models(self):
+        """{signature: [ports of the healthy boards that have it]}"""
+        with self.lock:
+            found = {}
+            for m in self.members:
+                if m.healthy:
+                    for signature in m.models:
+                        found.setdefault(signature, []).append(m.port)
+            return found
+
+    def drain(self, port, timeout=None):
+        """Stop sending requests to a board and wait until it has answered those it has
+
+        The others take its share meanwhile; requests only it could take
+        wait in the pool until undrain(). Returns False if the board still
+        has requests outstanding after timeout seconds.
+        """
+        member = next(m for m in self.members if m.port == port)
+        with self.lock:
+            member.drained = True
+        deadline = None if timeout is None else time.monotonic() + timeout
+        while True:
+            with self.lock:
+                if member.outstanding == 0:
+                    return True
+            if deadline is not None and time.monotonic() >= deadline:
+                return False
+            time.sleep(self.DRAIN_POLL)
+
+    def undrain(self, port):
+        """Send requests to a drained board again"""
+        with self.lock:
+            for m in self.members:
+                if m.port == port:
+                    m.drained = False
+        self._drain()
+
+    def restore(self, port=None):
+        """Mark a board (all boards by default) healthy again, e.g. after reseating it"""
+        with self.lock:
+            for m in self.members:
+                if port is None or m.port == port:
+                    m.healthy = True
+                    m.streak = 0
+
+    def reset_stats(self):
+        """Zero the per-board counters and restart the throughput clock"""
+        with self.lock:
+            for m in self.members:
+                m.completed = m.errors = m.failures = m.refusals = 0
+                m.busy_time = 0.0
+            self.hedges = self.hedge_wins = 0
+            self.started = time.perf_counter()
+
+    def health(self):
+        elapsed = time.perf_counter() - self.started
+        with self.lock:
+            return [MemberHealth(m.port, m.healthy, m.outstanding, m.completed, m.errors,
+                                 m.failures, m.busy_time / m.completed if m.completed else 0.0,
+                                 m.completed / elapsed if elapsed else 0.0, m.last_error,
+                                 m.signature(), m.switches, m.refusals)
+                    for m in self.members]
+
+    def latency_snapshot(self, member):
+        """[(model signature, Histogram.snapshot())] of a member's completed requests"""
+        with self.lock:
+            return [(model, hist.snapshot()) for model, hist in member.latency.items()]
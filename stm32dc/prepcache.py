@@ -0,0 +1,156 @@
+"""On-disk cache of preprocessed images, so repeat runs skip straight to the boards.
+
+    images = cached_dataset('emnist-digits-test-images-idx3-ubyte')   # bench.load_images
+    images = cached_folder(paths, decode)                             # stm32dc.scan
+
+    STM32DC_PREP_CACHE=/fast/disk python -m stm32dc.bench --port COM9 --images test-images.idx
+    STM32DC_PREP_CACHE=off python -m stm32dc.scan scans/ --ports COM9 --out labels.npy
+
+Entries are N x 28 x 28 uint8 .npy files, in the order and orientation
+the boards take them, opened as a Dataset: memory-mapped, an item a view
+into the page cache. The name is a hash of the source's content and of
+PREP_VERSION, so an edited file or changed preprocessing never hits a
+stale entry, and two copies of one file share theirs.
+
+cached_dataset() stores EMNIST IDX images upright (a first run pays the
+transpose of every image once, later ones none) and .npy files of other
+dtypes as uint8. IDX files opened as stored and uint8 .npy arrays are
+mapped as they are: there is nothing to save. cached_folder() stores a
+folder's decoded, ink-framed images as the decoding streams them in;
+files that failed are listed next to the entry and come back as None.
+The entry is renamed into place only once complete, so an interrupted run
+leaves nothing half written.
+
+The cache lives in STM32DC_PREP_CACHE, by default ~/.cache/stm32dc; "off"
+turns it off.
+"""
+import hashlib
+import os
+
+from .dataset import SIDE, Dataset, _map, _npy_header
+from .sink import NpyMap
+
+# Part of every key: bump when preprocessing changes what an entry holds
+PREP_VERSION = b'stm32dc-prep 1 emnist-frame 28 border 2/128'
+ENV = 'STM32DC_PREP_CACHE'
+READ_SIZE = 1 << 20
+
+
+def cache_dir():
+    """The cache's folder, None when turned off"""
+    folder = os.environ.get(ENV) or os.path.join(os.path.expanduser('~'), '.cache', 'stm32dc')
+    return None if folder == 'off' else folder
+
+
+def file_hash(path):
+    digest = hashlib.blake2b(digest_size=16)
+    with open(path, 'rb') as f:
+        while True:
+            block = f.read(READ_SIZE)
+            if not block:
+                return digest.hexdigest()
+            digest.update(block)
+
+
+def _entry(key):
+    folder = cache_dir()
+    if folder is None:
+        return None
+    os.makedirs(folder, exist_ok=True)
+    return os.path.join(folder, f"{key}.npy")
+
+
+def _needs_copy(path, transposed):
+    """True when a Dataset of path gathers or converts its items"""
+    if not str(path).endswith('.npy'):
+        return transposed is not False
+    mm = _map(path)
+    try:
+        descr, fortran, _, _ = _npy_header(mm, path)
+    finally:
+        mm.close()
+    return descr not in ('|u1', '<u1', '>u1') or fortran or transposed is True
+
+
+def cached_dataset(path, transposed=None):
+    """Dataset(path, transposed), from its cache entry, which a first call writes"""
+    if not _needs_copy(path, transposed):
+        return Dataset(path, transposed)
+    key = hashlib.blake2b(PREP_VERSION + b' dataset ' + repr(transposed).encode() + b' '
+                          + file_hash(path).encode(), digest_size=16).hexdigest()
+    entry = _entry(key)
+    if entry is None:
+        return Dataset(path, transposed)
+    if not os.path.exists(entry):
+        source = Dataset(path, transposed)
+        part = f"{entry}.{os.getpid()}.part"
+        out = NpyMap(part, '|u1', len(source), (SIDE, SIDE))
+        for i, image in enumerate(source):
+            out[i] = image
+        out.close()
+        source.close()
+        os.replace(part, entry)
+    return Dataset(entry, transposed=False)
+
+
+class _FolderWriter:
+    """Streams decoded images into an entry, renamed into place when every one is in"""
+
+    def __init__(self, entry, count):
+        self.entry = entry
+        self.part = f"{entry}.{os.getpid()}.part"
+        self.out = NpyMap(self.part, '|u1', count, (SIDE, SIDE))
+        self.failed = []
+
+    def put(self, index, image):
+        if image is None:
+            self.failed.append(index)
+        else:
+            self.out[index] = image
+
+    def finish(self):
+        self.out.close()
+        with open(self.entry + '.failed', 'w') as f:
+            f.writelines(f"{i}\n" for i in self.failed)
+        os.replace(self.part, self.entry)
+
+    def abandon(self):
+        self.out.close()
+        os.unlink(self.part)
+
+
+def folder_key(paths):
+    digest = hashlib.blake2b(PREP_VERSION + b' folder', digest_size=16)
+    for path in paths:
+        digest.update(os.path.basename(path).encode() + b'\0' + file_hash(path).encode())
+    return digest.hexdigest()
+
+
+def cached_folder(paths, decode):
+    """784 B images of paths in order, None for those that failed: from the cache, or decode(paths)
+
+    decode(paths) yields each path's image or None in order; what it
+    yields passes through and is stored, the entry completed when it ends.
+    """
+    entry = _entry(folder_key(paths)) if paths else None
+    if entry is None:
+        yield from decode(paths)
+        return
+    if os.path.exists(entry):
+        with open(entry + '.failed') as f:
+            failed = {int(line) for line in f if line.strip()}
+        images = Dataset(entry, transposed=False)
+        for i in range(len(images)):
+            yield None if i in failed else images[i]
+        return
+
+    writer = _FolderWriter(entry, len(paths))
+    try:
+        for index, image in enumerate(decode(paths)):
+            writer.put(index, image)
+            yield image
+    except BaseException:
+        writer.abandon()
+        raise
+    writer.finish()
+
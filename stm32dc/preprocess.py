@@ -0,0 +1,264 @@
+"""Drawing-to-model preprocessing, vectorised with numpy.
+
+Strokes are recorded as compact point lists (StrokeRecorder) and only
+rasterised when a prediction is made, straight into the 28x28 model frame.
+Framing follows the EMNIST conversion the model was trained on: the ink
+bounding box is centred in a square frame keeping the aspect ratio, with a
+thin border, and the brush is drawn anti-aliased at the output resolution.
+normalize() applies the same framing to an existing raster image, and
+ink_crop() cuts the ink out for CLASSIFY_CROP, which frames it on the device.
+delta_energy() tells live and camera frames that barely changed, whose
+previous answer stands, and downsample() makes the 14x14 image
+CLASSIFY_SMALL sends.
+StrokeRecorder.packed() sends the strokes themselves for the device to
+rasterise the same way (CLASSIFY_PACKED STROKES).
+"""
+from array import array
+from functools import lru_cache
+
+import numpy as np
+
+from .protocol import CROP_MAX, SMALL_SIZE, pack_strokes
+
+MODEL_SIZE = 28
+# EMNIST pads the 128 px region of interest with 2 px before downsampling
+BORDER_FRACTION = 2 / 128
+# Summed pixel change below which a frame is the one before it: about four
+# fully flipped pixels, as the firmware's APP_DELTA_GATE suggests
+DELTA_GATE = 4 * 255
+
+
+@lru_cache(maxsize=256)
+def area_matrix(n_out, n_in):
+    """(n_out, n_in) weights averaging n_in samples into n_out equal bins, read-only and shared"""
+    edges = np.arange(n_out + 1) * (n_in / n_out)
+    j = np.arange(n_in)
+    overlap = (np.minimum(edges[1:, None], j + 1) - np.maximum(edges[:-1, None], j))
+    matrix = np.clip(overlap, 0, None) * (n_out / n_in)
+    matrix.setflags(write=False)
+    return matrix
+
+
+@lru_cache(maxsize=8)
+def _centres(w, h):
+    """(w * h, 2) float32 pixel centres of a w x h image, read-only and shared"""
+    centres = np.stack(np.meshgrid(np.arange(w), np.arange(h)), -1)
+    centres = centres.reshape(-1, 2).astype(np.float32) + 0.5
+    centres.setflags(write=False)
+    return centres
+
+
+def _bounding_box(ink):
+    """The inked part of an image, None if it is blank"""
+    rows = np.flatnonzero(ink.any(axis=1))
+    cols = np.flatnonzero(ink.any(axis=0))
+    if rows.size == 0:
+        return None
+    return ink[rows[0]:rows[-1] + 1, cols[0]:cols[-1] + 1]
+
+
+def normalize(ink, size=MODEL_SIZE):
+    """EMNIST-style framing of an ink image (0 = background), returns uint8 [size, size]"""
+    crop = _bounding_box(ink)
+    if crop is None:
+        return np.zeros((size, size), np.uint8)
+
+    h, w = crop.shape
+    side = max(h, w)
+    border = max(1, int(round(side * BORDER_FRACTION)))
+    frame = np.zeros((side + 2 * border, side + 2 * border), np.float32)
+    top = border + (side - h) // 2
+    left = border + (side - w) // 2
+    frame[top:top + h, left:left + w] = crop
+
+    resample = area_matrix(size, frame.shape[0])
+    out = resample @ frame @ resample.T
+    peak = out.max()
+    if peak > 0:
+        out *= 255.0 / peak
+    return np.rint(out).astype(np.uint8)
+
+
+def delta_energy(a, b):
+    """Sum of the absolute differences of two uint8 images of the same shape"""
+    return int(np.abs(a.astype(np.int16) - b.astype(np.int16)).sum())
+
+
+def downsample(image, size=SMALL_SIZE):
+    """uint8 size x size means of the equal blocks of a 28x28 image (array or bytes), rounded"""
+    if isinstance(image, (bytes, bytearray, memoryview)):
+        image = np.frombuffer(image, np.uint8)
+    image = np.asarray(image, np.uint8).reshape(MODEL_SIZE, MODEL_SIZE)
+    f = MODEL_SIZE // size
+    blocks = image.reshape(size, f, size, f).astype(np.uint32).sum(axis=(1, 3))
+    return ((blocks + f * f // 2) // (f * f)).astype(np.uint8)
+
+
+def ink_crop(ink, max_side=CROP_MAX):
+    """uint8 bounding box of the ink, area averaged down so no side exceeds max_side"""
+    crop = _bounding_box(ink)
+    if crop is None:
+        return np.zeros((1, 1), np.uint8)
+
+    h, w = crop.shape
+    scale = max(h, w) / max_side
+    if scale > 1:
+        out_h = max(1, int(round(h / scale)))
+        out_w = max(1, int(round(w / scale)))
+        crop = area_matrix(out_h, h) @ crop @ area_matrix(out_w, w).T
+    return np.rint(crop).astype(np.uint8)
+
+
+def simplify(points, tolerance):
+    """Ramer-Douglas-Peucker: indices of the (n, 2) polyline's points that keep
+    every dropped one within tolerance of the line"""
+    keep = np.zeros(len(points), bool)
+    keep[0] = keep[-1] = True
+    spans = [(0, len(points) - 1)]
+    while spans:
+        first, last = spans.pop()
+        if last - first < 2:
+            continue
+        a, d = points[first], points[last] - points[first]
+        rel = points[first + 1:last] - a
+        length = np.hypot(*d)
+        if length > 0:
+            dist = np.abs(rel[:, 0] * d[1] - rel[:, 1] * d[0]) / length
+        else:
+            dist = np.hypot(rel[:, 0], rel[:, 1])
+        worst = int(dist.argmax())
+        if dist[worst] > tolerance:
+            mid = first + 1 + worst
+            keep[mid] = True
+            spans += [(first, mid), (mid, last)]
+    return np.flatnonzero(keep)
+
+
+def emnist_upright(images):
+    """EMNIST IDX/CSV images are stored transposed, flip them to drawing orientation"""
+    images = np.asarray(images).reshape(-1, MODEL_SIZE, MODEL_SIZE)
+    return np.ascontiguousarray(images.transpose(0, 2, 1))
+
+
+# Canvas pixels a simplified stroke may stray from the drawn one, about a
+# tenth of a model pixel on the 320 px canvas
+STROKE_TOLERANCE = 1.25
+
+
+class StrokeRecorder:
+    """Canvas strokes as int16 point lists, rasterised on demand.
+
+    Coordinates are canvas pixels; brush is the stroke width in the same
+    units, so the result does not depend on the canvas resolution.
+    """
+
+    # Motion events closer than this to the previous point add nothing
+    MIN_STEP = 1.5
+    # Segments rasterised per vectorised pass into a model frame, bounds
+    # the temporary arrays
+    CHUNK = 256
+
+    def __init__(self, brush=24):
+        self.radius = brush / 2
+        self.strokes = []
+
+    def clear(self):
+        self.strokes = []
+
+    def begin(self, x, y):
+        self.strokes.append(array('h', (int(x), int(y))))
+
+    def add(self, x, y):
+        """Extend the current stroke, returns False if the point was too close to keep"""
+        stroke = self.strokes[-1]
+        dx, dy = x - stroke[-2], y - stroke[-1]
+        if dx * dx + dy * dy < self.MIN_STEP * self.MIN_STEP:
+            return False
+        stroke.extend((int(x), int(y)))
+        return True
+
+    def current(self):
+        """Flat x0, y0, x1, y1, ... list of the stroke being drawn"""
+        return list(self.strokes[-1]) if self.strokes else []
+
+    def segments(self):
+        """(n, 2) start and end points of every segment, dots as zero length"""
+        starts, ends = [], []
+        for stroke in self.strokes:
+            pts = np.frombuffer(stroke, np.int16).reshape(-1, 2).astype(np.float32)
+            if len(pts) == 1:
+                starts.append(pts)
+                ends.append(pts)
+            else:
+                starts.append(pts[:-1])
+                ends.append(pts[1:])
+        if not starts:
+            return None, None
+        return np.concatenate(starts), np.concatenate(ends)
+
+    def packed(self, width, height, tolerance=STROKE_TOLERANCE):
+        """STROKES body (protocol.pack_strokes) of the strokes on a width x height
+        canvas, simplified to within tolerance canvas pixels; None if blank"""
+        if not self.strokes:
+            return None
+        scale = 255 / max(width - 1, height - 1, 1)
+        radius8 = min(255, max(1, int(round(self.radius * scale * 8))))
+        strokes = []
+        for stroke in self.strokes:
+            pts = np.frombuffer(stroke, np.int16).reshape(-1, 2).astype(np.float32)
+            pts = pts[simplify(pts, tolerance)] if len(pts) > 2 else pts
+            q = np.clip(np.rint(pts * scale), 0, 255).astype(np.uint8)
+            strokes.append(q.tolist())
+        return pack_strokes(radius8, strokes)
+
+    def rasterize(self, size=MODEL_SIZE):
+        """uint8 [size, size] white-on-black image, EMNIST framed"""
+        a, b = self.segments()
+        if a is None:
+            return np.zeros((size, size), np.uint8)
+
+        # Square frame around the inked area, centred on it
+        lo = np.minimum(a.min(0), b.min(0)) - self.radius
+        hi = np.maximum(a.max(0), b.max(0)) + self.radius
+        side = float((hi - lo).max())
+        frame = side * (1 + 2 * BORDER_FRACTION)
+        k = size / frame
+        origin = (lo + hi) / 2 - frame / 2
+        a = (a - origin) * k
+        d = (b - origin) * k - a
+        radius = self.radius * k
+
+        return self._cover(a, d, radius, size, size)
+
+    def ink(self, width, height, scale=1.0):
+        """uint8 [height, width] * scale image of the canvas as drawn, not framed"""
+        a, b = self.segments()
+        w, h = int(round(width * scale)), int(round(height * scale))
+        if a is None:
+            return np.zeros((h, w), np.uint8)
+        return self._cover(a * scale, (b - a) * scale, self.radius * scale, w, h)
+
+    def _cover(self, a, d, radius, w, h):
+        """Anti-aliased coverage of segments a .. a + d at radius, uint8 [h, w]"""
+        # Distance from every output pixel centre to the nearest segment
+        centres = _centres(w, h)
+        dist = np.full(w * h, np.inf, np.float32)
+        # CHUNK segments against a model frame, fewer on larger images
+        step = max(1, self.CHUNK * MODEL_SIZE * MODEL_SIZE // (w * h))
+        for i in range(0, len(a), step):
+            sa, sd = a[i:i + step, None, :], d[i:i + step, None, :]
+            rel = centres[None, :, :] - sa
+            length2 = (sd * sd).sum(-1)
+            t = np.clip((rel * sd).sum(-1) / np.where(length2 > 0, length2, 1), 0.0, 1.0)
+            nearest = np.linalg.norm(rel - t[..., None] * sd, axis=-1).min(0)
+            np.minimum(dist, nearest, out=dist)
+
+        # One output pixel wide anti-aliased edge, worked out in dist's own buffer
+        np.subtract(radius + 0.5, dist, out=dist)
+        np.clip(dist, 0.0, 1.0, out=dist)
+        dist *= 255
+        return np.rint(dist, out=dist).astype(np.uint8).reshape(h, w)
+
+    def to_model(self):
+        """784 uint8 pixels, white digit on black, ready for CLASSIFY"""
+        return self.rasterize().reshape(-1)
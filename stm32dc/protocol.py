@@ -0,0 +1,1261 @@
+"""Binary framing shared with the firmware (tinyML/Core/Src/protocol.c).
+
+Frame layout, little-endian::
+
+    A5 5A | type | seq | len(16) | payload | crc(32)
+
+The CRC reproduces the STM32 CRC unit: CRC-32/MPEG-2 fed 32-bit words, over
+the type/seq/len word and the payload zero padded to a multiple of 4 bytes.
+
+Everything run per frame or per pixel (CRC, image packing) is built from
+bytes/int/zlib primitives that loop in C, not from Python loops over bytes:
+a host driving many boards spends its time in the kernel, not here.
+"""
+import array
+import itertools
+import re
+import struct
+import time
+import zlib
+from typing import NamedTuple, Optional
+
+MAGIC = b'\xA5\x5A'
+HEADER = struct.Struct('<BBH')
+CRC = struct.Struct('<I')
+HEADER_SIZE = len(MAGIC) + HEADER.size
+OVERHEAD = HEADER_SIZE + CRC.size
+
+# Mirrors PROTO_CROP_MAX, longest side of a CLASSIFY_CROP image
+CROP_MAX = 56
+# Mirrors PROTO_MAX_PAYLOAD; longer headers are treated as corruption
+MAX_PAYLOAD = 2 + CROP_MAX * CROP_MAX
+# Mirrors PROTO_SMALL_SIDE, side of a CLASSIFY_SMALL image
+SMALL_SIZE = 14
+
+# Mirrors PROTO_VERSION, checked against the PING reply
+PROTOCOL_VERSION = 1
+
+RESPONSE_FLAG = 0x80
+# Request type bit: the device queues the frame ahead of those without it
+PRIORITY_FLAG = 0x40
+# Response type bit: a Stamp trailer follows the payload (APP_TIMESTAMPS)
+STAMP_FLAG = 0x40
+
+CMD_CLASSIFY = 0x01
+CMD_BATCH = 0x02
+CMD_BATCH_IMAGE = 0x03
+CMD_SET_BAUD = 0x04
+CMD_CLASSIFY_PROF = 0x05
+CMD_PROFILE = 0x06
+CMD_SET_CLOCK = 0x07
+CMD_CLASSIFY_TOPK = 0x08
+CMD_PING = 0x09
+CMD_CLASSIFY_PACKED = 0x0A
+CMD_CLASSIFY_CROP = 0x0B
+CMD_MEMSTAT = 0x0C
+CMD_SELECT_MODEL = 0x0D
+CMD_CLASSIFY_CASCADE = 0x0E
+CMD_KERNEL_BENCH = 0x0F
+CMD_STATS = 0x10
+CMD_FLASH = 0x11
+CMD_SELFTEST = 0x12
+CMD_LOG = 0x13
+CMD_CANCEL = 0x14
+CMD_UPLOAD = 0x15
+CMD_STAGE = 0x16
+CMD_STRIP = 0x17
+CMD_EMBED = 0x18
+CMD_KNN = 0x19
+CMD_CONFIG = 0x1A
+CMD_WCET = 0x1B
+CMD_ENERGY = 0x1C
+CMD_NN_BENCH = 0x1D
+CMD_IRQ_LATENCY = 0x1E
+CMD_HEADS = 0x1F
+CMD_CLASSIFY_SMALL = 0x20
+CMD_CLASSIFY_ANYTIME = 0x21
+CMD_CLOCK_SYNC = 0x22
+CMD_TELEMETRY = 0x23
+CMD_CLASSIFY_TTA = 0x24
+TYPE_ERROR = 0xFF
+
+MAX_BATCH = 255
+# ClockProfile_t values accepted by SET_CLOCK
+CLOCK_PROFILES = {'performance': 0, 'balanced': 1, 'low-power': 2}
+CLASS_NONE = 0xFF
+CLASS_BLANK = 0xFE   # no digit, the image had less ink than APP_BLANK_INK
+
+ERR_NONE = 0
+ERR_CRC = 1
+ERR_LENGTH = 2
+ERR_TYPE = 3
+ERR_BUSY = 4
+ERR_INFERENCE = 5
+ERR_UART = 6
+ERR_PARAM = 7
+ERR_TIMEOUT = 8
+ERR_CANCELLED = 9
+ERR_FLASH = 10
+
+ERROR_NAMES = {
+    ERR_CRC: "CRC mismatch",
+    ERR_LENGTH: "Bad payload length",
+    ERR_TYPE: "Unknown command",
+    ERR_BUSY: "Device busy",
+    ERR_INFERENCE: "Inference failed",
+    ERR_UART: "UART error",
+    ERR_PARAM: "Unsupported parameter",
+    ERR_TIMEOUT: "Frame cut short",
+    ERR_CANCELLED: "Cancelled by the host",
+    ERR_FLASH: "Flash erase or program failed",
+}
+
+
+def response_type(cmd):
+    """Type of the response the device sends for a request type"""
+    return cmd | RESPONSE_FLAG
+
+
+# Each byte with its bits in reverse order
+_BIT_REVERSE = bytes(int(f'{i:08b}'[::-1], 2) for i in range(256))
+assert array.array('I').itemsize == 4
+
+
+def crc32(data):
+    """CRC of data as computed by the STM32 CRC unit.
+
+    The unit shifts each little-endian word in MSB first; zlib's reflected
+    CRC-32 (same polynomial) shifts bytes in LSB first. Swapping the bytes
+    of every word and reversing the bits of every byte feeds zlib the same
+    bit sequence, and reversing its complemented result gives the unit's.
+    """
+    words = array.array('I', bytes(data) + b'\0' * (-len(data) % 4))
+    words.byteswap()
+    return _reverse32(zlib.crc32(words.tobytes().translate(_BIT_REVERSE)) ^ 0xFFFFFFFF)
+
+
+def _reverse32(value):
+    """value with its 32 bits in reverse order"""
+    return int.from_bytes(value.to_bytes(4, 'big').translate(_BIT_REVERSE), 'little')
+
+
+def encode_frame(frame_type, seq, payload=b''):
+    """Build a complete frame"""
+    frame = bytearray(MAGIC)
+    frame += HEADER.pack(frame_type, seq & 0xFF, len(payload))
+    frame += payload
+    frame += CRC.pack(crc32(memoryview(frame)[len(MAGIC):]))
+    return bytes(frame)
+
+
+class FrameEncoder:
+    """encode_frame() into one buffer it keeps, reused by every frame of one sender.
+
+    encode() returns a view of the buffer, valid until the next call: write
+    it out before encoding again. tail (frames already encoded, a BATCH's
+    images) is copied in behind the frame so the two go out in one write.
+    The buffer is replaced, never resized, when a frame outgrows it.
+    """
+
+    def __init__(self, size=OVERHEAD + MAX_PAYLOAD):
+        self.buffer = bytearray(size)
+
+    def encode(self, frame_type, seq, payload=b'', tail=b''):
+        length = len(payload)
+        end = HEADER_SIZE + length + CRC.size
+        size = end + len(tail)
+        if size > len(self.buffer):
+            self.buffer = bytearray(size)
+        buf = self.buffer
+        view = memoryview(buf)
+        view[:len(MAGIC)] = MAGIC
+        HEADER.pack_into(buf, len(MAGIC), frame_type, seq & 0xFF, length)
+        buf[HEADER_SIZE:HEADER_SIZE + length] = payload
+        CRC.pack_into(buf, HEADER_SIZE + length, crc32(view[len(MAGIC):HEADER_SIZE + length]))
+        buf[end:size] = tail
+        return view[:size]
+
+
+# Second byte of an ERR_UART payload: HAL_UART_ERROR_* bits
+UART_ERROR_BITS = {0x01: "parity", 0x02: "noise", 0x04: "framing", 0x08: "overrun", 0x10: "DMA"}
+UART_ERROR_LINE = 0x0F   # parity, noise, framing, overrun: the line, not the firmware
+
+# PROTO_BAUD_LADDER: the rates a link quality step walks, lowest first
+BAUD_LADDER = (115200, 230400, 460800, 921600, 1500000, 2000000, 3000000, 4000000, 6000000, 12000000)
+
+
+def describe_error(payload):
+    """Readable text for an error response payload"""
+    code = payload[0] if payload else ERR_NONE
+    text = f"ERROR: {ERROR_NAMES.get(code, f'code {code}')}"
+    if code == ERR_UART and len(payload) > 1:
+        bits = [name for bit, name in UART_ERROR_BITS.items() if payload[1] & bit]
+        text += f" ({', '.join(bits) or 'unknown'})"
+    busy = decode_busy(payload)
+    if busy is not None:
+        text += f" ({busy.ahead} ahead, retry in {busy.retry_after * 1e3:.1f} ms)"
+    return text
+
+
+# ERROR payload refusing a frame for want of a slot (ProtoBusy_t, APP_ADMISSION)
+BUSY = struct.Struct('<BBI')
+
+
+class Busy(NamedTuple):
+    ahead: int          # frames queued, running or arriving before it
+    retry_after: float  # seconds until those are processed, at the board's measured rate
+
+
+def decode_busy(payload):
+    """protocol.Busy of an ERR_BUSY payload, None for the bare code of firmware without APP_ADMISSION"""
+    if len(payload) != BUSY.size or payload[0] != ERR_BUSY:
+        return None
+    _, ahead, retry_us = BUSY.unpack(payload)
+    return Busy(ahead, retry_us / 1e6)
+
+
+# CLASSIFY_PROF reply (ProtoProfile_t): class, 3 pad, cpu_hz, 4 stage cycle counts,
+# USART2 interrupt cycles and the bytes received meanwhile (absent before
+# the LL UART path, decoded as 0)
+PROFILE = struct.Struct('<B3xIIIIIII')
+PROFILE_STAGES = ('pre', 'run', 'argmax', 'tx')
+
+
+class Profile(NamedTuple):
+    """Stage durations of one classification, in microseconds"""
+    pre: float
+    run: float
+    argmax: float
+    tx: float  # transmission of the device's previous reply
+    cpu_hz: int = 0  # HCLK the stages ran at, us * cpu_hz / 1e6 gives cycles
+    isr: float = 0.0  # in USART2 interrupt handlers since the previous CLASSIFY_PROF
+    isr_bytes: int = 0  # received by USART2 meanwhile
+
+    @property
+    def isr_cycles_per_byte(self):
+        return self.isr * self.cpu_hz / 1e6 / self.isr_bytes if self.isr_bytes else 0.0
+
+
+def decode_profile(payload):
+    """Return (digit, Profile) from a CLASSIFY_PROF reply payload, digit None if blank"""
+    digit, cpu_hz, *cycles, isr, isr_bytes = PROFILE.unpack(bytes(payload).ljust(PROFILE.size, b'\0'))
+    profile = Profile(*(c * 1e6 / cpu_hz for c in cycles), cpu_hz, isr * 1e6 / cpu_hz, isr_bytes)
+    return None if digit == CLASS_BLANK else digit, profile
+
+
+# CLASSIFY_TOPK reply: scale, zero point, k, then k x (class, int8 score)
+TOPK_HEADER = struct.Struct('<fbB')
+TOPK_DEFAULT = 3
+TOPK_MAX = 10
+
+
+def decode_topk_scores(payload):
+    """Return (scale, zero_point, [(digit, int8 score)] best first), scores as the network output them"""
+    scale, zero_point, k = TOPK_HEADER.unpack_from(payload)
+    entries = payload[TOPK_HEADER.size:TOPK_HEADER.size + 2 * k]
+    return scale, zero_point, [(entries[i], struct.unpack_from('b', entries, i + 1)[0])
+                               for i in range(0, len(entries), 2)]
+
+
+def decode_topk(payload):
+    """Return [(digit, probability)] best first"""
+    scale, zero_point, scores = decode_topk_scores(payload)
+    return [(digit, (score - zero_point) * scale) for digit, score in scores]
+
+
+# CLASSIFY_PACKED encodings (tinyML/Core/Inc/image_pack.h)
+PACK_RAW = 0
+PACK_ZRLE = 1
+PACK_BITMAP = 2
+PACK_DELTA = 3
+PACK_BITS1 = 4
+PACK_BITS4 = 5
+PACK_STROKES = 6     # pen radius and polylines, rasterised on the device
+IMAGE_PIXELS = 784
+
+
+def quantize(image, bits):
+    """Pixels reduced to 2**bits levels spread over 0-255 (what the device decodes)"""
+    if bits == 8:
+        return bytes(image)
+    if bits == 4:
+        return bytes(image).translate(_QUANTIZE4)
+    if bits == 1:
+        return bytes(image).translate(_QUANTIZE1)
+    raise ValueError(f"unsupported pixel depth {bits}")
+
+
+_QUANTIZE4 = bytes((px * 15 + 127) // 255 * 17 for px in range(256))
+_QUANTIZE1 = bytes(255 if px >= 128 else 0 for px in range(256))
+# Byte translations: a level 0-15 of a 4-bit pixel, '1' for the pixels a bitmap marks
+_LEVEL4 = bytes(px // 17 for px in range(256))
+_MARKED = b'0' + b'1' * 255
+_ZERO_RUN = re.compile(b'\0{1,255}')
+
+
+def _bitmap(marks):
+    """Bit i set where byte i of marks is nonzero, IMAGE_PIXELS // 8 bytes"""
+    bits = bytes(marks).translate(_MARKED)[::-1]
+    return int(bits, 2).to_bytes(IMAGE_PIXELS // 8, 'little')
+
+
+def pack_bits(image, bits):
+    """BITS1/BITS4 body of an image already passed through quantize()"""
+    if bits == 1:
+        return _bitmap(image)
+    levels = bytes(image).translate(_LEVEL4)
+    # Even pixels in the low nibble: the odd ones' levels shifted into theirs
+    low = int.from_bytes(levels[0::2], 'little')
+    high = int.from_bytes(levels[1::2], 'little')
+    packed = low | high << 4
+    return packed.to_bytes(IMAGE_PIXELS // 2, 'little')
+
+
+def pack_strokes(radius8, strokes):
+    """STROKES body: radius in 1/8 units, then per stroke its count and x, y bytes.
+
+    Coordinates are 0-255 across the canvas's longer side; strokes over 255
+    points go as several sharing their end points.
+    """
+    body = bytearray((radius8,))
+    for points in strokes:
+        points = list(points)
+        start = 0
+        while True:
+            part = points[start:start + 255]
+            body.append(len(part))
+            for x, y in part:
+                body += bytes((x, y))
+            start += 254
+            if start >= len(points) - 1:
+                break
+    return bytes(body)
+
+
+def pack_zrle(image):
+    """Nonzero pixels as they are, runs of zeros as 00 length (at most 255)"""
+    return _ZERO_RUN.sub(lambda run: bytes((0, len(run.group()))), bytes(image))
+
+
+def pack_bitmap(image, base=None):
+    """Bitmap of pixels that are nonzero (or differ from base), then their values"""
+    image = bytes(image)
+    if base is None:
+        return _bitmap(image) + image.replace(b'\0', b'')
+    diff = (int.from_bytes(image, 'little') ^ int.from_bytes(base, 'little')).to_bytes(
+        len(image), 'little')
+    return _bitmap(diff) + bytes(itertools.compress(image, diff))
+
+
+class ImagePacker:
+    """Picks the shortest CLASSIFY_PACKED encoding, DELTA against the last image sent.
+
+    Payloads must reach the device in the order pack() produced them; when
+    the device refuses a DELTA (ERR_PARAM) pack the image again with full=True.
+    bits < 8 quantizes pixels first (lossy) and adds the BITS1/BITS4 encoding.
+    """
+
+    def __init__(self, bits=8):
+        quantize(b'', bits)
+        self.bits = bits
+        self.prev = None
+        self.tag = 0
+
+    def pack(self, image, full=False):
+        image = quantize(image, self.bits)
+        base_tag = self.tag
+        self.tag = (self.tag + 1) & 0xFF
+        tag = self.tag
+
+        candidates = [bytes((PACK_RAW, tag)) + image,
+                      bytes((PACK_ZRLE, tag)) + pack_zrle(image),
+                      bytes((PACK_BITMAP, tag)) + pack_bitmap(image)]
+        if self.bits in (1, 4):
+            kind = PACK_BITS1 if self.bits == 1 else PACK_BITS4
+            candidates.append(bytes((kind, tag)) + pack_bits(image, self.bits))
+        if self.prev is not None and not full:
+            candidates.append(bytes((PACK_DELTA, tag, base_tag)) +
+                              pack_bitmap(image, self.prev))
+        self.prev = image
+        return min(candidates, key=len)
+
+    def pack_strokes(self, body):
+        """STROKES payload of a pack_strokes() body; the next image goes out in full,
+        the device's rasterisation is not known here to take a DELTA against"""
+        self.tag = (self.tag + 1) & 0xFF
+        self.prev = None
+        return bytes((PACK_STROKES, self.tag)) + body
+
+
+def pack_crop(rows):
+    """CLASSIFY_CROP payload of a 2-D uint8 image (rows), sides 1 to CROP_MAX"""
+    height = len(rows)
+    width = len(rows[0]) if height else 0
+    if not (0 < width <= CROP_MAX and 0 < height <= CROP_MAX):
+        raise ValueError(f"crop must be 1-{CROP_MAX} px a side, got {width}x{height}")
+    pixels = b''.join(bytes(row) for row in rows)
+    if len(pixels) != width * height:
+        raise ValueError("crop rows differ in length")
+    return bytes((width, height)) + pixels
+
+
+# PING reply (ProtoCaps_t), then the asking link's credits and the features
+# byte, then the board's identity: unique ID, firmware version, models
+# (older firmware ends before either)
+CAPS = struct.Struct('<BBHBBBB16s')
+CAPS_CREDITS = struct.Struct('<BBH')
+CAPS_IDENTITY = struct.Struct('<12sHBB')
+CAPS_SIZES = (CAPS.size, CAPS.size + CAPS_CREDITS.size,
+              CAPS.size + CAPS_CREDITS.size + CAPS_IDENTITY.size)
+CAP_PROFILE = 0x01
+CAP_LAYERS = 0x02
+CAP_USB = 0x04
+CAP_KERNEL = 0x08
+CAP_LOGITS = 0x10    # scores are logits, APP_SOFTMAX_BYPASS
+CAP_FLASH = 0x20     # FLASH, APP_FLASH_BENCH
+CAP_SELFTEST = 0x40  # SELFTEST, APP_SELFTEST
+CAP_MEMO = 0x80      # repeated images answered from memo, APP_MEMO
+
+# Capabilities.features: protocol extensions
+FEAT_PRIORITY = 0x01  # PRIORITY_FLAG requests are queued first
+FEAT_CANCEL = 0x02    # CANCEL, APP_CANCEL
+FEAT_UPLOAD = 0x04    # UPLOAD, APP_UPLOAD
+FEAT_STAGE = 0x08     # STAGE, APP_SPLIT
+FEAT_FORWARD = 0x10   # STAGE_FORWARD, APP_SPLIT_LINK: a back board is wired
+FEAT_STRIP = 0x20     # STRIP, APP_STRIP
+FEAT_EMBED = 0x40     # EMBED, APP_EMBED
+FEAT_KNN = 0x80       # KNN, APP_KNN
+
+# Flags byte after the class in CLASSIFY/CLASSIFY_PACKED replies (APP_MEMO or
+# APP_DELTA_GATE builds)
+RESULT_MEMO = 0x01   # remembered, the network did not run
+RESULT_GATED = 0x02  # the last image run's, this one barely differs
+
+
+class Capabilities(NamedTuple):
+    version: int
+    flags: int
+    max_payload: int
+    input_shape: tuple   # (height, width, channels)
+    num_classes: int
+    model_hash: str      # X-CUBE-AI model signature, hex
+    # Credits: requests the device always has room for, and bytes of more
+    # that wait in its RX ring; each reply returns its request's. 0: unknown
+    rx_slots: int = 0
+    rx_ring: int = 0
+    features: int = 0    # FEAT_*
+    # Identity, from firmware that reports it: '' and 0 before
+    uid: str = ''        # 96-bit chip unique ID, hex
+    fw_version: int = 0  # APP_FW_VERSION, major << 8 | minor
+    model_active: int = 0
+    model_count: int = 0
+
+    def firmware(self):
+        return f"{self.fw_version >> 8}.{self.fw_version & 0xFF}" if self.fw_version else "unknown"
+
+
+def decode_caps(payload):
+    version, flags, max_payload, h, w, c, classes, model_hash = CAPS.unpack_from(payload)
+    rx_slots, features, rx_ring = CAPS_CREDITS.unpack(
+        payload[CAPS.size:CAPS.size + CAPS_CREDITS.size].ljust(CAPS_CREDITS.size, b'\0'))
+    at = CAPS.size + CAPS_CREDITS.size
+    uid, fw_version, model_active, model_count = CAPS_IDENTITY.unpack(
+        payload[at:at + CAPS_IDENTITY.size].ljust(CAPS_IDENTITY.size, b'\0'))
+    return Capabilities(version, flags, max_payload, (h, w, c), classes, model_hash.hex(),
+                        rx_slots, rx_ring, features, uid.hex() if any(uid) else '', fw_version,
+                        model_active, model_count)
+
+
+# MEMSTAT reply (ProtoMemStat_t)
+MEMSTAT = struct.Struct('<9I')
+
+
+class MemStats(NamedTuple):
+    ram_size: int
+    static_size: int       # activations, .data and .bss
+    activations_size: int
+    heap_end: int          # address
+    heap_used: int
+    stack_peak: int        # deepest stack use since boot
+    stack_reserved: int    # _Min_Stack_Size
+    free: int              # never touched between heap and stack
+    weight_cache: int      # weights served from SRAM (APP_WEIGHT_CACHE)
+
+
+def decode_memstat(payload):
+    return MemStats(*MEMSTAT.unpack(payload))
+
+
+# SELECT_MODEL reply (ProtoModelSel_t)
+MODEL_SEL = struct.Struct('<BB2xII')
+
+
+class ModelSel(NamedTuple):
+    active: int
+    count: int
+    activations_size: int  # arena bytes the active model uses
+    weights_size: int      # its weights in flash
+
+
+def decode_model_sel(payload):
+    return ModelSel(*MODEL_SEL.unpack(payload))
+
+
+# UPLOAD request header (ProtoUploadReq_t) and reply (ProtoUpload_t)
+UPLOAD_REQ = struct.Struct('<BB2xI')
+UPLOAD = struct.Struct('<BB2xII')
+UPLOAD_BEGIN = 0   # arg: blob bytes, then its CRC-32; erases the region
+UPLOAD_DATA = 1    # arg: offset, then the bytes
+UPLOAD_COMMIT = 2  # ERR_PARAM if the CRC differs
+UPLOAD_ERASE = 3   # back to the linked weights
+
+
+class Upload(NamedTuple):
+    op: int
+    model: int       # active model
+    received: int    # blob bytes programmed so far
+    capacity: int    # bytes the region holds
+
+
+def decode_upload(payload):
+    return Upload(*UPLOAD.unpack(payload))
+
+
+# STAGE request header (ProtoStageReq_t) and reply (ProtoStage_t)
+STAGE_REQ = struct.Struct('<BBBx')
+STAGE = struct.Struct('<BBBBH2x')
+STAGE_FRONT = 0      # image in, the first split c-nodes run, the boundary tensor out
+STAGE_BACK = 1       # boundary in, the other c-nodes run, the class out
+STAGE_FORWARD = 0x01  # FRONT: the device hands the boundary to its back board, which answers
+STAGE_MAX = 1024     # largest boundary
+
+
+class Stage(NamedTuple):
+    stage: int
+    split: int       # c-nodes in the front stage, as applied
+    digit: int       # BACK: the class, FRONT: CLASS_NONE
+    model: int       # active model, both boards must run the same
+    size: int        # boundary bytes
+    boundary: bytes  # FRONT: the tensor, BACK: empty
+
+
+def decode_stage(payload):
+    head = STAGE.unpack_from(payload)
+    return Stage(*head, bytes(payload[STAGE.size:]))
+
+
+# STRIP request header (ProtoStripReq_t) and reply (ProtoStrip_t)
+STRIP_REQ = struct.Struct('<BB')
+STRIP = struct.Struct('<BBBx')
+STRIP_HEIGHT = 28
+STRIP_STRIDE = 4     # window stride, and what any stride must be a multiple of
+STRIP_MAX = 112      # widest strip a frame holds
+
+
+class Strip(NamedTuple):
+    stride: int      # pixels between windows, as applied
+    model: int       # active model
+    digits: tuple    # class of each 28x28 window, left to right
+    scores: tuple    # int8 score of that class
+
+
+def decode_strip(payload):
+    count, stride, model = STRIP.unpack_from(payload)
+    body = payload[STRIP.size:]
+    return Strip(stride, model, tuple(body[:count]),
+                 tuple(struct.unpack_from(f'<{count}b', body, count)))
+
+
+# EMBED reply header (ProtoEmbed_t), the int8 embedding follows
+EMBED = struct.Struct('<BBHb3x')
+
+
+class Embedding(NamedTuple):
+    digit: int        # the network's own class
+    model: int        # active model, embeddings of two models do not compare
+    zero_point: int   # int8 value of a zero activation
+    vector: bytes     # size int8 values
+
+
+def decode_embed(payload):
+    digit, model, size, zero_point = EMBED.unpack_from(payload)
+    return Embedding(digit, model, zero_point, bytes(payload[EMBED.size:EMBED.size + size]))
+
+
+# KNN request header (ProtoKnnReq_t), the image follows but for KNN_CLEAR, and reply (ProtoKnn_t)
+KNN_REQ = struct.Struct('<BB2x')
+KNN = struct.Struct('<BBBBI')
+KNN_CLASSIFY = 0     # nearest enrolled label and the network's class
+KNN_ENROLL = 1       # the image's embedding joins the device table
+KNN_CLEAR = 2        # empty the table
+
+
+class Knn(NamedTuple):
+    label: int       # CLASSIFY: nearest enrolled label, CLASS_NONE if the table is empty
+    digit: int       # the network's own class
+    count: int       # entries enrolled
+    capacity: int    # APP_KNN
+    distance: int    # CLASSIFY: L1 distance to the nearest entry
+
+
+def decode_knn(payload):
+    return Knn(*KNN.unpack_from(payload))
+
+
+# HEADS reply (ProtoHeads_t): class and score per head, CLASS_NONE for heads not run
+HEADS_MAX = 4
+HEADS = struct.Struct('<BBBx' + 'Bb' * HEADS_MAX)
+HEAD_DIGITS = 0      # APP_MODEL_MULTIHEAD outputs
+HEAD_LETTERS = 1
+
+
+class Heads(NamedTuple):
+    model: int       # active model
+    ran: int         # mask of the heads run
+    classes: tuple   # per head of the model: its class, None if not run
+    scores: tuple    # per head: int8 output at that class, 0 if not run
+
+
+def decode_heads(payload):
+    fields = HEADS.unpack(payload)
+    count, ran, model = fields[:3]
+    classes = fields[3::2][:count]
+    return Heads(model, ran, tuple(None if c == CLASS_NONE else c for c in classes), fields[4::2][:count])
+
+
+# CLASSIFY_CASCADE request tail (ProtoCascadeReq_t) and reply (ProtoCascade_t)
+CASCADE_REQ = struct.Struct('<BBB')
+CASCADE = struct.Struct('<BBBxI')
+CASCADE_FIRST = 0
+CASCADE_FULL = 1
+# Lead of the best class over the runner-up, in output LSBs (1/256 probability)
+CASCADE_MARGIN_DEFAULT = 64
+
+
+class Cascade(NamedTuple):
+    digit: int
+    stage: int     # CASCADE_FIRST or CASCADE_FULL, the model that answered
+    margin: int    # lead of the answering stage
+    cycles: int    # device cycles incl. model switches, 0 without APP_PROFILE
+
+
+def decode_cascade(payload):
+    return Cascade(*CASCADE.unpack(payload))
+
+
+# CLASSIFY_ANYTIME request tail (ProtoAnytimeReq_t) and reply (ProtoAnytime_t)
+ANYTIME_REQ = struct.Struct('<IB3x')
+ANYTIME = struct.Struct('<BBBBB3xI')
+ANYTIME_SETTLED = 0x01   # the rows left could not change the class
+ANYTIME_MARGIN = 0x02    # stopped at min_margin
+ANYTIME_DEADLINE = 0x04  # stopped before the next step would pass the deadline
+
+
+class Anytime(NamedTuple):
+    digit: int     # CLASS_BLANK: no step ran
+    steps: int     # gemm_5 steps run, of steps_total
+    steps_total: int
+    flags: int     # ANYTIME_*, why it stopped before steps_total
+    margin: int    # lead of the digit in gemm_6 output LSBs, saturated at 255
+    cycles: int    # device cycles of the whole request
+
+
+def decode_anytime(payload):
+    return Anytime(*ANYTIME.unpack(payload))
+
+
+# CLASSIFY_TTA request tail (ProtoTtaReq_t) and reply (ProtoTta_t)
+TTA_REQ = struct.Struct('<BB')
+TTA = struct.Struct('<BBBBB3xI')
+TTA_VARIANTS = 6         # shifted right, left, down, up by 1 px; zoomed in, out by 12 %
+
+
+class Tta(NamedTuple):
+    digit: int     # most votes, CLASS_BLANK for a blank image
+    own: int       # the image's digit before the vote
+    margin: int    # its lead in output LSBs, saturated at 255
+    variants: int  # variants run, 0 when the margin was enough
+    votes: int     # for digit, the image counting as one
+    cycles: int    # device cycles of the whole request, 0 without APP_PROFILE
+
+
+def decode_tta(payload):
+    return Tta(*TTA.unpack(payload))
+
+
+# CLOCK_SYNC request flags and reply (ProtoClockSync_t), APP_TIMESTAMPS
+SYNC_STAMP = 0x01        # stamp the replies to further requests
+CLOCK_SYNC = struct.Struct('<IIIB3x')
+# Trailer of a reply with STAMP_FLAG (ProtoStamp_t)
+STAMP = struct.Struct('<IIII')
+
+
+class ClockSyncReply(NamedTuple):
+    rx_us: int     # device clock when the request's last byte arrived
+    tx_us: int     # ... and when the reply was framed
+    cpu_hz: int
+    flags: int     # SYNC_* in force
+
+
+class Stamp(NamedTuple):
+    rx_us: int     # device clock when the request's last byte arrived
+    start_us: int  # ... when processing began
+    run_us: int    # network time for the request, from DWT cycles
+    tx_us: int     # ... when the reply was framed
+
+
+def decode_clock_sync(payload):
+    return ClockSyncReply(*CLOCK_SYNC.unpack(payload))
+
+
+# KERNEL_BENCH request tail (1 B kernel) and reply (ProtoKernelBench_t)
+KERNEL_BENCH = struct.Struct('<IIIBBHBBH')
+KERNEL_CONV = 0
+KERNEL_DENSE = 1
+KERNEL_SOFTMAX = 2
+KERNEL_CONV0 = 3
+# Layer each kernel replaces, and its output size
+KERNELS = {KERNEL_CONV: ('conv2d_2', 800), KERNEL_DENSE: ('gemm_5', 128),
+           KERNEL_SOFTMAX: ('nl_7', 10), KERNEL_CONV0: ('conv2d_0', 2704)}
+DENSE_INPUT_WORDS = 200  # gemm_5 input, 4 values a word
+CONV0_TILES = 169  # pooled tiles of conv2d_0, 13x13
+
+
+class KernelBench(NamedTuple):
+    """One layer on the library and on its custom kernel, same image"""
+    lib_us: float
+    kernel_us: float
+    lib_digit: int
+    kernel_digit: int
+    mismatches: int   # output activations that differ
+    max_diff: int     # in LSBs
+    kernel: int       # KERNEL_CONV, KERNEL_DENSE, KERNEL_SOFTMAX or KERNEL_CONV0
+    active: int       # gemm_5 input words read (APP_KERNEL_DENSE_SKIP) or conv2d_0 tiles
+                      # computed (APP_KERNEL_BLANK_TILES), else 0
+
+
+def decode_kernel_bench(payload):
+    cpu_hz, lib, kern_cycles, lib_digit, kernel_digit, mismatches, max_diff, kernel, active = \
+        KERNEL_BENCH.unpack(payload)
+    return KernelBench(lib * 1e6 / cpu_hz, kern_cycles * 1e6 / cpu_hz, lib_digit, kernel_digit,
+                       mismatches, max_diff, kernel, active)
+
+
+# STATS request flag and reply (ProtoStats_t)
+STATS_RESET = 0x01
+STATS_BUCKETS = 32
+# Stats.load shares, APP_LOAD
+LOAD_SHARES = ('idle', 'usart', 'dma', 'inference', 'tx', 'other')
+STATS = struct.Struct(f'<13IBB2x2I{STATS_BUCKETS}H{STATS_BUCKETS}HI{len(LOAD_SHARES)}H')
+STATS_FIELDS = 17
+HSI_HZ = 16000000
+
+# Stats.reset_cause and Stats.last_fault
+RESET_CAUSES = ('power', 'pin', 'watchdog', 'software', 'low power')
+FAULTS = ('none', 'hal error', 'ai init', 'hardfault')
+
+
+class Stats(NamedTuple):
+    """Device counters since boot or the last reset"""
+    cpu_hz: int
+    uptime_ms: int
+    frames: int
+    inferences: int
+    err_inference: int
+    err_crc: int
+    err_dropped: int      # no free slot, or too long
+    uart_overrun: int
+    uart_framing: int
+    uart_noise: int
+    events_lost: int      # errors the device's report queue could not hold
+    boots: int            # starts since power-on
+    warm_boots: int       # of those, restarts by the watchdog or a fault
+    reset_cause: int      # index into RESET_CAUSES, of the current start
+    last_fault: int       # index into FAULTS, of the last software restart
+    boot_cycles: int      # main() to ready for requests
+    boot_hsi_cycles: int  # of those, on the 16 MHz HSI before the PLL
+    run_hist: tuple       # bucket i: runs of [2^i, 2^(i+1)) cycles
+    frame_hist: tuple     # same, last byte received to end of processing
+    load_ms: int          # time the load shares cover, 0 without APP_LOAD
+    load: tuple           # share of it per LOAD_SHARES entry, in 1/10000
+
+    @property
+    def boot_us(self):
+        """Boot time, the HSI part of it counted at 16 MHz"""
+        return (self.boot_hsi_cycles * 1e6 / HSI_HZ
+                + (self.boot_cycles - self.boot_hsi_cycles) * 1e6 / self.cpu_hz)
+
+    def utilization(self):
+        """{LOAD_SHARES name: percent of load_ms}, empty without APP_LOAD"""
+        if not self.load_ms:
+            return {}
+        return {name: share / 100 for name, share in zip(LOAD_SHARES, self.load)}
+
+    def percentile(self, hist, fraction):
+        """Upper edge in us of the bucket holding that fraction of the samples"""
+        total = sum(hist)
+        if not total:
+            return 0.0
+        seen = 0
+        for bucket, count in enumerate(hist):
+            seen += count
+            if seen >= fraction * total:
+                return (1 << (bucket + 1)) * 1e6 / self.cpu_hz
+        return (1 << len(hist)) * 1e6 / self.cpu_hz
+
+
+def decode_stats(payload):
+    values = STATS.unpack(payload)
+    hists = STATS_FIELDS + 2 * STATS_BUCKETS
+    return Stats(*values[:STATS_FIELDS], values[STATS_FIELDS:STATS_FIELDS + STATS_BUCKETS],
+                 values[STATS_FIELDS + STATS_BUCKETS:hists], values[hists], values[hists + 1:])
+
+
+# TELEMETRY request (2 B interval ms, 0 stops) and reply or push (ProtoTelemetry_t), APP_TELEMETRY
+TELEMETRY_REQ = struct.Struct('<H')
+TELEMETRY = struct.Struct('<BBHHHHB7sI')
+TELEM_PERIODIC = 0x01    # the interval passed
+TELEM_ERRORS = 0x02      # APP_TELEMETRY_ERRORS errors since the last frame
+TELEM_SLOW = 0x04        # a run reached APP_TELEMETRY_SLOW
+TELEM_ASKED = 0x08       # the reply to TELEMETRY
+TELEM_NO_LOAD = 0xFFFF   # busy without APP_LOAD
+# Telemetry.errors, the Stats fields they count
+TELEM_ERROR_KINDS = ('err_inference', 'err_crc', 'err_dropped', 'uart_overrun',
+                      'uart_framing', 'uart_noise', 'events_lost')
+
+
+class Telemetry(NamedTuple):
+    """Device counts since its previous telemetry frame, saturated"""
+    number: int       # wraps at 256, a gap is a frame lost
+    reason: int       # TELEM_*
+    span_ms: int      # since the previous frame
+    frames: int
+    inferences: int
+    busy: int         # awake and not idling, 1/10000 of span_ms; TELEM_NO_LOAD without APP_LOAD
+    hclk_mhz: int
+    errors: tuple     # per TELEM_ERROR_KINDS entry, saturated at 255
+    run_hist: tuple   # STATS_BUCKETS new runs per Stats.run_hist bucket
+
+
+def decode_telemetry(payload):
+    number, reason, span_ms, frames, inferences, busy, hclk_mhz, errors, mask = \
+        TELEMETRY.unpack_from(payload)
+    counts = iter(struct.unpack_from(f'<{bin(mask).count("1")}H', payload, TELEMETRY.size))
+    hist = tuple(next(counts) if mask >> b & 1 else 0 for b in range(STATS_BUCKETS))
+    return Telemetry(number, reason, span_ms, frames, inferences, busy, hclk_mhz, tuple(errors), hist)
+
+
+# FLASH request flags and reply (ProtoFlash_t)
+FLASH_PREFETCH = 0x01
+FLASH_ICACHE = 0x02
+FLASH_DCACHE = 0x04
+FLASH = struct.Struct('<IBB2xI')
+
+
+class FlashConfig(NamedTuple):
+    cpu_hz: int
+    flags: int       # FLASH_* enabled
+    latency: int     # wait states
+    ram_code: int    # NetworkRuntime code bytes linked to SRAM
+
+
+def flash_name(flags):
+    names = [name for bit, name in ((FLASH_PREFETCH, 'prefetch'), (FLASH_ICACHE, 'icache'),
+                                    (FLASH_DCACHE, 'dcache')) if flags & bit]
+    return '+'.join(names) or 'none'
+
+
+# CONFIG operations and reply (ProtoConfig_t)
+CONFIG_GET = 0
+CONFIG_SAVE = 1      # keep the running baud rate, model, clock profile and ART flags
+CONFIG_CLEAR = 2     # the next boot starts on the defaults
+CONFIG_SAVED = 0x01
+CONFIG_APPLIED = 0x02
+CONFIG = struct.Struct('<IBBBB')
+
+
+class DeviceConfig(NamedTuple):
+    baud: int
+    model: int
+    clock: int       # CLOCK_PROFILES value, 0xFF the generated boot setup
+    flash: int       # FLASH_* flags
+    flags: int       # CONFIG_SAVED, CONFIG_APPLIED
+
+    @property
+    def saved(self):
+        return bool(self.flags & CONFIG_SAVED)
+
+
+# WCET request (ProtoWcetReq_t) and reply (ProtoWcet_t), then u32 per c-node
+WCET_REQ = struct.Struct('<HBx')
+WCET = struct.Struct('<IHBB6I')
+WCET_RUNS_DEFAULT = 256
+WCET_RUNS_MAX = 4096
+WCET_COLD = 0x01     # ART caches flushed before every run
+WCET_OPEN = 0x02     # interrupts left on during the runs (APP_DETERMINISTIC)
+WCET_QUIET = 0x40    # reply: the runs held interrupts off
+WCET_RAM_CODE = 0x80 # reply: the kernels ran from SRAM (RAMFUNC linker script)
+
+
+class Wcet(NamedTuple):
+    cpu_hz: int
+    runs: int
+    flags: int         # WCET_* the runs were made with
+    load_max: int      # cycles, input conversion
+    run_min: int       # network run
+    run_max: int
+    argmax_max: int
+    total_max: int     # the three in one span
+    rx_bytes: int      # received by the device during the runs
+    node_max: tuple    # cycles per c-node, empty without APP_PROFILE_LAYERS
+
+    @property
+    def stage_bound(self):
+        """Cycles of a run with every stage at its worst"""
+        return self.load_max + self.run_max + self.argmax_max
+
+    @property
+    def jitter(self):
+        """Cycles between the fastest and the slowest network run"""
+        return self.run_max - self.run_min
+
+
+def decode_wcet(payload):
+    cpu_hz, runs, flags, nodes, *cycles = WCET.unpack_from(payload)
+    if len(payload) != WCET.size + 4 * nodes:
+        raise ValueError("WCET reply length")
+    node_max = struct.unpack_from(f'<{nodes}I', payload, WCET.size)
+    return Wcet(cpu_hz, runs, flags, *cycles, node_max)
+
+
+# IRQ_LATENCY request (ProtoIrqLatReq_t) and reply (ProtoIrqLat_t), then u32 per bucket
+IRQ_LAT_REQ = struct.Struct('<IH2x')
+IRQ_LAT = struct.Struct('<IIHBx9I')
+IRQ_LAT_BAUD_DEFAULT = 921600
+IRQ_LAT_BUCKETS = 16   # bucket i: [2**i, 2**(i+1)) cycles, the last one and above
+
+
+class IrqLatency(NamedTuple):
+    cpu_hz: int
+    baud: int          # arrivals a byte time of this apart on average
+    runs: int
+    samples: int
+    overruns: int      # serviced a byte time or more late
+    lat_min: int       # cycles from arrival to handler entry
+    lat_max: int
+    lat_mean: int
+    handler_max: int   # cycles of the handler's byte store
+    gap_max: int       # cycles of the longest span without the ring drained
+    usart_max_baud: int
+    rx_ring: int       # receive DMA ring bytes
+    buckets: tuple
+
+    def it_max_baud(self):
+        """Fastest line interrupt reception keeps up with: a byte read within a byte time"""
+        cycles = self.lat_max + self.handler_max
+        return min(self.usart_max_baud, 10 * self.cpu_hz // max(cycles, 1))
+
+    def dma_max_baud(self):
+        """Fastest line DMA reception keeps up with: the ring outlasts the longest run,
+        its half-ring interrupt the longest latency"""
+        ring = 10 * self.rx_ring * self.cpu_hz // max(self.gap_max, 1)
+        half = 10 * (self.rx_ring // 2) * self.cpu_hz // max(self.lat_max, 1)
+        return min(self.usart_max_baud, ring, half)
+
+
+def decode_irq_latency(payload):
+    cpu_hz, baud, runs, buckets, *fields = IRQ_LAT.unpack_from(payload)
+    if len(payload) != IRQ_LAT.size + 4 * buckets:
+        raise ValueError("IRQ_LATENCY reply length")
+    counts = struct.unpack_from(f'<{buckets}I', payload, IRQ_LAT.size)
+    return IrqLatency(cpu_hz, baud, runs, *fields, counts)
+
+
+# ENERGY request flags and reply (ProtoEnergy_t, then ProtoEnergySlot_t per slot)
+ENERGY_RESET = 0x01       # zero the counters once read
+ENERGY_SET_IDLE = 0x02    # ENERGY_STOP is the idle mode from now on
+ENERGY_STOP = 0x04        # idle may enter STOP mode
+ENERGY_STOP_BUILT = 0x08  # reply: APP_IDLE_STOP_MS, STOP can be allowed
+ENERGY = struct.Struct('<IHBBB3xI')
+ENERGY_SLOT = struct.Struct('<7I')
+ENERGY_BOOT_SLOT = len(CLOCK_PROFILES)  # slot of the generated 96 MHz setup
+
+
+class EnergySlot(NamedTuple):
+    hz: int            # HCLK of the profile, 0 if it never ran
+    run_ua: int        # current model, awake
+    sleep_ua: int      # and in WFI
+    awake_us: int
+    asleep_us: int
+    inferences: int
+    energy_uj: int     # awake and asleep time at those currents
+
+    @property
+    def uj_per_inference(self):
+        return self.energy_uj / self.inferences if self.inferences else 0.0
+
+    @property
+    def active_us(self):
+        """Awake time per inference, requests' parsing and replies included"""
+        return self.awake_us / self.inferences if self.inferences else 0.0
+
+
+class Energy(NamedTuple):
+    cpu_hz: int
+    mv: int            # supply of the current model
+    slot: int          # the one running now
+    flags: int         # ENERGY_STOP, ENERGY_STOP_BUILT
+    window_ms: int     # since boot or the last reset
+    slots: tuple       # EnergySlot per CLOCK_PROFILES value, then ENERGY_BOOT_SLOT
+
+
+def decode_energy(payload):
+    cpu_hz, mv, slot, count, flags, window_ms = ENERGY.unpack_from(payload)
+    if len(payload) != ENERGY.size + ENERGY_SLOT.size * count:
+        raise ValueError("ENERGY reply length")
+    slots = tuple(EnergySlot(*ENERGY_SLOT.unpack_from(payload, ENERGY.size + ENERGY_SLOT.size * i))
+                  for i in range(count))
+    return Energy(cpu_hz, mv, slot, flags, window_ms, slots)
+
+
+# NN_BENCH reply (ProtoNnBench_t, then ProtoNnBenchLayer_t per layer on CMSIS-NN)
+NN_BENCH = struct.Struct('<IBBBx')
+NN_BENCH_LAYER = struct.Struct('<IIHBBB')
+NN_KINDS = {0: 'conv', 1: 'dense', 2: 'softmax'}  # PROTO_NN_*
+
+
+class NnBenchLayer(NamedTuple):
+    lib_us: float
+    nn_us: float
+    mismatches: int    # output bytes that differ, same input on both backends
+    max_diff: int      # in LSBs
+    node: int          # c-node index
+    kind: str          # NN_KINDS
+
+
+class NnBench(NamedTuple):
+    lib_class: int     # whole network on the library
+    nn_class: int      # every mapped layer on CMSIS-NN
+    layers: tuple      # NnBenchLayer
+
+
+def decode_nn_bench(payload):
+    cpu_hz, count, lib_class, nn_class = NN_BENCH.unpack_from(payload)
+    if len(payload) != NN_BENCH.size + NN_BENCH_LAYER.size * count:
+        raise ValueError("NN_BENCH reply length")
+    layers = []
+    for i in range(count):
+        lib, nn, mismatches, max_diff, node, kind = \
+            NN_BENCH_LAYER.unpack_from(payload, NN_BENCH.size + NN_BENCH_LAYER.size * i)
+        layers.append(NnBenchLayer(lib * 1e6 / cpu_hz, nn * 1e6 / cpu_hz, mismatches, max_diff, node,
+                                   NN_KINDS.get(kind, str(kind))))
+    return NnBench(lib_class, nn_class, tuple(layers))
+
+
+# SELFTEST reply (ProtoSelfTest_t)
+SELFTEST = struct.Struct('<5I4H')
+SELFTEST_NONE_WRONG = 0xFFFF
+
+
+class SelfTest(NamedTuple):
+    cpu_hz: int
+    macc: int          # per run, from the network report
+    cycles_min: int
+    cycles_mean: int
+    cycles_max: int
+    count: int
+    correct: int
+    failed: int        # runs that returned an error
+    first_wrong: int   # SELFTEST_NONE_WRONG if every image was right
+
+    @property
+    def accuracy(self):
+        return self.correct / self.count if self.count else 0.0
+
+    @property
+    def macc_per_cycle(self):
+        return self.macc / self.cycles_mean if self.cycles_mean else 0.0
+
+
+# LOG reply (ProtoLogHeader_t, then ProtoLogRecord_t per record)
+LOG_HEADER = struct.Struct('<BxH')
+LOG_RECORD = struct.Struct('<IB3xII')
+
+
+class LogRecord(NamedTuple):
+    tick: int        # ms since boot
+    id: int          # LOG_* token of tinyML/Core/Inc/log.h
+    args: tuple
+
+
+def decode_log(payload):
+    """(records, lost) of a LOG reply, lost counting those the full ring dropped"""
+    count, lost = LOG_HEADER.unpack_from(payload)
+    if len(payload) != LOG_HEADER.size + count * LOG_RECORD.size:
+        raise ValueError("LOG reply length does not match its count")
+    records = []
+    for offset in range(LOG_HEADER.size, len(payload), LOG_RECORD.size):
+        tick, token, a, b = LOG_RECORD.unpack_from(payload, offset)
+        records.append(LogRecord(tick, token, (a, b)))
+    return records, lost
+
+
+# PROFILE reply: cpu_hz, then (layer id, c_idx, cycles) per c-node
+PROFILE_NODE = struct.Struct('<HHI')
+# Layer ids assigned in tinyML/X-CUBE-AI/App/network.c
+LAYER_NAMES = {1: 'conv2d_0', 3: 'conv2d_2', 5: 'gemm_5', 6: 'gemm_6', 7: 'nl_7'}
+
+
+# PROFILE request flags
+PROFILE_COUNTERS = 0x01  # DWT event counts follow the nodes, APP_PROFILE_COUNTERS
+# ... one ProfCounters_t per node: each count modulo 256, the DWT counters are 8 bits
+PROFILE_EVENTS = struct.Struct('<5B3x')
+EVENT_NAMES = ('cpi', 'exc', 'sleep', 'lsu', 'fold')
+
+
+class LayerCounters(NamedTuple):
+    name: str
+    us: float
+    cycles: int
+    events: dict       # EVENT_NAMES -> count modulo 256
+
+
+def decode_layer_profile(payload):
+    """Return [(layer name, microseconds)] in execution order"""
+    (cpu_hz,) = struct.unpack_from('<I', payload)
+    layers = []
+    for offset in range(4, len(payload) - PROFILE_NODE.size + 1, PROFILE_NODE.size):
+        layer_id, _, cycles = PROFILE_NODE.unpack_from(payload, offset)
+        layers.append((LAYER_NAMES.get(layer_id, f'node_{layer_id}'), cycles * 1e6 / cpu_hz))
+    return layers
+
+
+def decode_layer_counters(payload):
+    """[LayerCounters] of a PROFILE reply asked with PROFILE_COUNTERS"""
+    (cpu_hz,) = struct.unpack_from('<I', payload)
+    entry = PROFILE_NODE.size + PROFILE_EVENTS.size
+    if (len(payload) - 4) % entry:
+        raise ValueError("PROFILE reply holds no event counts")
+    n = (len(payload) - 4) // entry
+    layers = []
+    for k in range(n):
+        layer_id, _, cycles = PROFILE_NODE.unpack_from(payload, 4 + k * PROFILE_NODE.size)
+        events = PROFILE_EVENTS.unpack_from(payload, 4 + n * PROFILE_NODE.size + k * PROFILE_EVENTS.size)
+        layers.append(LayerCounters(LAYER_NAMES.get(layer_id, f'node_{layer_id}'),
+                                    cycles * 1e6 / cpu_hz, cycles, dict(zip(EVENT_NAMES, events))))
+    return layers
+
+
+class Frame(NamedTuple):
+    type: int
+    seq: int
+    payload: bytes
+    stamp: Optional[Stamp] = None  # device timestamps, taken off the payload
+
+
+class FrameReader:
+    """Incremental frame decoder on top of a serial-like port.
+
+    Bytes that are not part of a valid frame (banner text, a frame damaged
+    by a dropped byte) are skipped by resynchronising on the magic. The port
+    is read into a chunk buffer kept across reads when it has readinto(),
+    and frames are checked in place: a frame costs its payload's copy.
+    """
+
+    # Largest single read, the chunk buffer's size
+    READ_CHUNK = 4096
+
+    def __init__(self, port=None):
+        self.port = port
+        self.buffer = bytearray()
+        self.chunk = bytearray(self.READ_CHUNK)
+        self.crc_errors = 0
+
+    def feed(self, data):
+        self.buffer += data
+
+    def next_frame(self) -> Optional[Frame]:
+        """Decode one frame from the buffered bytes, if complete"""
+        buf = self.buffer
+        while True:
+            start = buf.find(MAGIC)
+            if start < 0:
+                # Keep a trailing first magic byte, it may start a frame
+                del buf[:max(0, len(buf) - 1)]
+                return None
+            del buf[:start]
+
+            if len(buf) < HEADER_SIZE:
+                return None
+            frame_type, seq, length = HEADER.unpack_from(buf, len(MAGIC))
+            if length > MAX_PAYLOAD:
+                del buf[:1]
+                continue
+
+            total = HEADER_SIZE + length + CRC.size
+            if len(buf) < total:
+                return None
+
+            (crc,) = CRC.unpack_from(buf, HEADER_SIZE + length)
+            stamped = frame_type != TYPE_ERROR and frame_type & (RESPONSE_FLAG | STAMP_FLAG) == \
+                RESPONSE_FLAG | STAMP_FLAG and length >= STAMP.size
+            with memoryview(buf) as view:
+                if crc != crc32(view[len(MAGIC):HEADER_SIZE + length]):
+                    payload = None
+                elif stamped:
+                    payload = bytes(view[HEADER_SIZE:HEADER_SIZE + length - STAMP.size])
+                    stamp = Stamp(*STAMP.unpack_from(buf, HEADER_SIZE + length - STAMP.size))
+                else:
+                    payload = bytes(view[HEADER_SIZE:HEADER_SIZE + length])
+            if payload is None:
+                self.crc_errors += 1
+                del buf[:1]
+                continue
+
+            del buf[:total]
+            if stamped:
+                return Frame(frame_type & ~STAMP_FLAG, seq, payload, stamp)
+            return Frame(frame_type, seq, payload)
+
+    def bytes_needed(self):
+        """Bytes still missing before the buffered frame can be decoded"""
+        buf = self.buffer
+        start = buf.find(MAGIC)
+        if start < 0 or len(buf) - start < HEADER_SIZE:
+            return HEADER_SIZE - (len(buf) - start if start >= 0 else 0)
+        (length,) = struct.unpack_from('<H', buf, start + len(MAGIC) + 2)
+        if length > MAX_PAYLOAD:
+            return 1
+        return max(1, start + HEADER_SIZE + length + CRC.size - len(buf))
+
+    def read_frame(self, timeout) -> Optional[Frame]:
+        """Read from the port until a frame is decoded or timeout expires.
+
+        Each read blocks for the rest of the current frame (or its header),
+        bounded by the remaining timeout, so an idle line costs no CPU. The
+        port's own read timeout is restored on return.
+        """
+        deadline = time.monotonic() + timeout
+        port_timeout = self.port.timeout
+        readinto = getattr(self.port, 'readinto', None)
+        try:
+            while True:
+                frame = self.next_frame()
+                if frame is not None:
+                    return frame
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    return None
+                self.port.timeout = remaining
+                size = max(self.bytes_needed(), self.port.in_waiting)
+                if readinto is None:
+                    data = self.port.read(size)
+                    if data:
+                        self.feed(data)
+                    continue
+                with memoryview(self.chunk) as chunk:
+                    got = readinto(chunk[:min(size, len(chunk))])
+                    if got:
+                        self.buffer += chunk[:got]
+        finally:
+            self.port.timeout = port_timeout
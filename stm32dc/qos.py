@@ -0,0 +1,152 @@
+"""Pick the model variant of each request from its latency budget.
+
+    qos = QosSelector(pool, [
+        Variant('full', 'classify', kwargs={'model': full}),
+        Variant('cascade', 'classify_cascade', args=(small_index, full_index)),
+        Variant('small', 'classify_small', kwargs={'model': small}, prepare=downsample),
+    ])
+    served = qos.classify(image, budget=0.030).result()
+    print(served.digit, served.variant, served.latency)
+
+Variants are listed best first, each a request method of the target (a
+LinkWorker or a DevicePool) with its own arguments, and the image
+reshaped for it by prepare. A request takes the first variant expected to
+answer within its budget, the fastest one if none is, and the first one
+without a budget. The expectation is the variant's service time times the
+requests already outstanding per board, plus one: a queue building up on
+the boards moves requests to cheaper variants before their budgets are
+missed, and back once it has drained.
+
+Service times are exponential averages of each answer's round trip
+divided by the same queue factor it was sent under. A variant with no
+answer yet is expected to take Variant.expected, None for "fits any
+budget", so that its first request measures it. Each answer comes back
+as a Served, naming the variant that gave it; stats() counts the
+requests each variant served and the ones that missed their budget.
+"""
+import threading
+import time
+from concurrent.futures import Future
+from typing import Callable, NamedTuple, Optional
+
+from .worker import INTERACTIVE
+
+# Weight of the newest sample in the service time averages
+ALPHA = 0.2
+
+
+class Variant(NamedTuple):
+    name: str
+    method: str                      # request method of the target
+    args: tuple = ()                 # after the image
+    kwargs: dict = {}                # e.g. model=<signature> on a DevicePool
+    prepare: Optional[Callable] = None  # image -> what method takes, e.g. preprocess.downsample
+    expected: Optional[float] = None    # seconds before the first answer, None: fits any budget
+
+
+class Served(NamedTuple):
+    result: object   # what the variant's method resolves to
+    digit: int       # the class in it, None for a blank or unknown result
+    variant: str
+    latency: float   # seconds from submit to answer
+    expected: float  # seconds the variant was expected to take, None if unmeasured
+    budget: float    # seconds, None for none
+
+
+class VariantStats(NamedTuple):
+    name: str
+    served: int
+    missed: int      # answered after the budget
+    errors: int
+    service: float   # seconds per request on an idle board, None until answered
+
+
+def digit_of(result):
+    """The class in a request method's result: an int, or the digit field of a named tuple"""
+    if isinstance(result, int):
+        return result
+    return getattr(result, 'digit', None)
+
+
+class QosSelector:
+    """Routes each request to the best variant its latency budget allows"""
+
+    def __init__(self, target, variants):
+        if not variants:
+            raise ValueError("a selector needs at least one variant")
+        self.target = target          # LinkWorker or DevicePool
+        self.variants = list(variants)
+        self.lock = threading.Lock()
+        self.service = {v.name: None for v in self.variants}  # seconds, average
+        self.served = {v.name: 0 for v in self.variants}
+        self.missed = {v.name: 0 for v in self.variants}
+        self.errors = {v.name: 0 for v in self.variants}
+
+    def load(self):
+        """Requests outstanding per board, the one about to be sent included"""
+        members = getattr(self.target, 'members', None)
+        if members is None:
+            worker = self.target
+            return sum(worker.queued()) + len(worker.pending) + 1
+        up = [m for m in members if m.healthy and not m.drained]
+        return sum(m.outstanding for m in up) / max(1, len(up)) + 1
+
+    def expect(self, variant, load):
+        """Seconds variant would take at load, None if unknown"""
+        with self.lock:
+            service = self.service[variant.name]
+        if service is None:
+            return variant.expected
+        return service * load
+
+    def choose(self, budget=None):
+        """(Variant, expected seconds, load) for a request with budget seconds, None for none"""
+        load = self.load()
+        if budget is None:
+            variant = self.variants[0]
+            return variant, self.expect(variant, load), load
+        fastest = None
+        for variant in self.variants:
+            expected = self.expect(variant, load)
+            if expected is None or expected <= budget:
+                return variant, expected, load
+            if fastest is None or expected < fastest[1]:
+                fastest = (variant, expected)
+        return fastest[0], fastest[1], load
+
+    def classify(self, image, budget=None, priority=INTERACTIVE) -> Future:
+        """Future of a Served: image classified by the variant budget seconds allow"""
+        variant, expected, load = self.choose(budget)
+        data = variant.prepare(image) if variant.prepare is not None else image
+        future = Future()
+        future.set_running_or_notify_cancel()
+        sent = time.perf_counter()
+        inner = getattr(self.target, variant.method)(bytes(data), *variant.args, priority=priority,
+                                                     **variant.kwargs)
+        inner.add_done_callback(lambda f: self._done(future, f, variant, expected, budget, load, sent))
+        return future
+
+    def _done(self, future, inner, variant, expected, budget, load, sent):
+        latency = time.perf_counter() - sent
+        error = ConnectionError("Cancelled") if inner.cancelled() else inner.exception()
+        with self.lock:
+            if error is not None:
+                self.errors[variant.name] += 1
+            else:
+                self.served[variant.name] += 1
+                if budget is not None and latency > budget:
+                    self.missed[variant.name] += 1
+                sample = latency / load
+                service = self.service[variant.name]
+                self.service[variant.name] = sample if service is None else service + ALPHA * (sample - service)
+        if error is not None:
+            future.set_exception(error)
+            return
+        result = inner.result()
+        future.set_result(Served(result, digit_of(result), variant.name, latency, expected, budget))
+
+    def stats(self):
+        with self.lock:
+            return [VariantStats(v.name, self.served[v.name], self.missed[v.name], self.errors[v.name],
+                                 self.service[v.name])
+                    for v in self.variants]
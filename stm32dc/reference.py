@@ -0,0 +1,257 @@
+"""Run the int8 model on the host with the TFLite interpreter.
+
+    python -m stm32dc.reference --images emnist-digits-test-images-idx3-ubyte \\
+        --labels emnist-digits-test-labels-idx1-ubyte --count 1000
+    python -m stm32dc.reference --port COM9 --count 200
+
+Without --port the host model stands in for the board: accuracy and
+per-image interpreter latency. With --port every image also goes to the
+device as CLASSIFY_TOPK with k = 10, and the ten int8 scores must match the
+interpreter's output tensor byte for byte. Both sides get the image the
+firmware builds: uint8 pixels, x - 128 into the int8 input tensor. Any
+difference means the generated network or a custom kernel (APP_KERNEL_*)
+no longer computes what the .tflite does, and the exit status is 1.
+
+Firmware built with APP_SOFTMAX_BYPASS returns logits instead of the
+softmax output, so only the classes are compared then.
+
+--network PROJECT replaces the interpreter with netref.NetworkModel, the
+generated network.c itself run in batches with --rounding library (the
+generated layers) or kernel (kernels.c): the .tflite is where the network
+came from, network.c is what the board runs.
+
+Needs one of ai-edge-litert, tflite-runtime or tensorflow, or with
+--network, numpy alone.
+"""
+import argparse
+import importlib
+import logging
+import sys
+import time
+
+from . import protocol
+from .bench import load_idx, load_images, open_device, percentile, synthetic_images
+from .link import DeviceError, DEFAULT_BAUD, IMAGE_SIZE
+
+DEFAULT_MODEL = 'emnist_digits_int8.tflite'
+INTERPRETERS = ('ai_edge_litert.interpreter', 'tflite_runtime.interpreter',
+                'tensorflow.lite.python.interpreter')
+
+log = logging.getLogger(__name__)
+
+
+def load_interpreter(path):
+    for name in INTERPRETERS:
+        try:
+            module = importlib.import_module(name)
+        except ImportError:
+            continue
+        return module.Interpreter(model_path=path)
+    raise SystemExit("no TFLite interpreter, pip install ai-edge-litert (or tflite-runtime)")
+
+
+class ReferenceModel:
+    """The .tflite model fed the way the firmware feeds the generated network"""
+
+    kind = 'TFLite'
+
+    def __init__(self, path=DEFAULT_MODEL):
+        import numpy as np
+
+        self.np = np
+        self.interpreter = load_interpreter(path)
+        self.interpreter.allocate_tensors()
+        self.input = self.interpreter.get_input_details()[0]
+        self.output = self.interpreter.get_output_details()[0]
+        if self.input['dtype'] != np.int8 or int(np.prod(self.input['shape'])) != IMAGE_SIZE:
+            raise ValueError(f"{path}: expected a {IMAGE_SIZE} pixel int8 input, "
+                             f"got {self.input['shape']} {self.input['dtype']}")
+        # The firmware's x - 128 is only the model's quantization for scale 1/255, zero point -128
+        scale, zero_point = self.input['quantization']
+        if zero_point != -128 or abs(scale * 255.0 - 1.0) > 1e-3:
+            log.warning("%s: input quantization %g, %d is not the x - 128 the firmware applies",
+                        path, scale, zero_point)
+        self.scale, self.zero_point = self.output['quantization']
+
+    @property
+    def num_classes(self):
+        return int(self.output['shape'][-1])
+
+    def scores(self, image):
+        """int8 output tensor for one 28x28 uint8 image"""
+        np = self.np
+        pixels = (np.frombuffer(bytes(image), np.uint8) ^ 0x80).view(np.int8)
+        self.interpreter.set_tensor(self.input['index'], pixels.reshape(self.input['shape']))
+        self.interpreter.invoke()
+        return self.interpreter.get_tensor(self.output['index'])[0].astype(np.int8)
+
+    def classify(self, image):
+        return int(self.scores(image).argmax())
+
+
+class ParityResult:
+    def __init__(self):
+        self.host = []           # host class per image
+        self.device = []         # device class per image, None if the request failed
+        self.host_latencies = []    # seconds per interpreter run, or per image of a batch
+        self.host_timing = 'TFLite'
+        self.device_latencies = []  # seconds per ai_network_run, or per round trip
+        self.device_timing = 'round trip'
+        self.compared = 0        # images whose scores were compared
+        self.identical = 0       # ... and matched byte for byte
+        self.max_diff = 0        # largest score difference, in output LSBs
+        self.first_mismatch = None
+        self.quantization = None  # device (scale, zero point) when it differs from the model's
+        self.errors = 0
+
+    @property
+    def mismatches(self):
+        """Images whose class differs, or with compared scores, whose scores differ"""
+        classes = sum(d is not None and d != h for h, d in zip(self.host, self.device))
+        return max(classes, self.compared - self.identical)
+
+    def report(self, labels=None):
+        host = sorted(self.host_latencies)
+        lines = [f"host          p50 {percentile(host, 50) * 1e3:.3f} ms  "
+                 f"p95 {percentile(host, 95) * 1e3:.3f} ms per image ({self.host_timing})"]
+        if self.device:
+            dev = sorted(self.device_latencies)
+            ratio = percentile(dev, 50) / percentile(host, 50) if host and dev else float('nan')
+            lines += [
+                f"device        p50 {percentile(dev, 50) * 1e3:.3f} ms  "
+                f"p95 {percentile(dev, 95) * 1e3:.3f} ms per image ({self.device_timing}), "
+                f"{ratio:.1f}x host",
+                f"classes       {sum(h == d for h, d in zip(self.host, self.device))} of "
+                f"{len(self.host)} agree, {self.errors} failed requests",
+            ]
+            if self.compared:
+                lines.append(f"scores        {self.identical} of {self.compared} bit-exact, "
+                             f"max difference {self.max_diff} LSB")
+            else:
+                lines.append("scores        not compared, the device returns logits")
+            if self.first_mismatch is not None:
+                lines.append(f"first differs image {self.first_mismatch}")
+            if self.quantization:
+                lines.append("quantization  device output scale %g, zero point %d" % self.quantization)
+        if labels:
+            correct = sum(p == l for p, l in zip(self.host, labels))
+            lines.append(f"accuracy      {correct / len(self.host) * 100:.2f} % host")
+            if self.device:
+                correct = sum(p == l for p, l in zip(self.device, labels))
+                lines.append(f"accuracy      {correct / len(self.device) * 100:.2f} % device")
+        return '\n'.join(lines)
+
+
+def run_host(model, images):
+    result = ParityResult()
+    result.host_timing = model.kind
+    if hasattr(model, 'classify_batch'):
+        t0 = time.perf_counter()
+        result.host = model.classify_batch(images)
+        result.host_latencies = [(time.perf_counter() - t0) / max(1, len(images))] * len(images)
+        return result
+    for img in images:
+        t0 = time.perf_counter()
+        digit = model.classify(img)
+        result.host_latencies.append(time.perf_counter() - t0)
+        result.host.append(digit)
+    return result
+
+
+def device_run_time(link, image):
+    """Seconds of ai_network_run from CLASSIFY_PROF, None without APP_PROFILE"""
+    try:
+        _, profile = link.classify_profiled(image)
+    except DeviceError as e:
+        if e.code == protocol.ERR_TYPE:
+            return None
+        raise
+    return profile.run * 1e-6
+
+
+def compare(link, model, images, logits=False):
+    """Run every image on both sides, scores compared unless the device returns logits"""
+    result = run_host(model, images)
+    profiled = True  # until the first CLASSIFY_PROF is refused
+    for i, img in enumerate(images):
+        host = model.scores(img)
+        t0 = time.perf_counter()
+        try:
+            scale, zero_point, scores = link.classify_scores(img)
+            elapsed = time.perf_counter() - t0
+            # Only the first image decides, so the latencies are all of one kind
+            run = device_run_time(link, img) if profiled else None
+        except (DeviceError, TimeoutError):
+            result.errors += 1
+            result.device.append(None)
+            continue
+        result.device.append(max(range(len(scores)), key=scores.__getitem__))
+        if run is not None:
+            result.device_timing = 'ai_network_run'
+            elapsed = run
+        elif not result.device_latencies:
+            profiled = False
+        result.device_latencies.append(elapsed)
+
+        if logits:
+            continue
+        if (scale, zero_point) != (model.scale, model.zero_point) and result.quantization is None:
+            result.quantization = (scale, zero_point)
+        diff = max(abs(int(h) - s) for h, s in zip(host, scores))
+        result.compared += 1
+        result.identical += diff == 0
+        result.max_diff = max(result.max_diff, diff)
+        if diff and result.first_mismatch is None:
+            result.first_mismatch = i
+    return result
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--port', help="also run on the device and compare (COM9, /dev/ttyACM0)")
+    parser.add_argument('--baud', type=int, default=DEFAULT_BAUD)
+    parser.add_argument('--rtscts', action='store_true',
+                        help="RTS/CTS flow control (firmware built with APP_UART_FLOW)")
+    parser.add_argument('-m', '--model', default=DEFAULT_MODEL)
+    parser.add_argument('--network', metavar='PROJECT',
+                        help="run the generated network.c of this firmware project instead of the .tflite")
+    parser.add_argument('--rounding', choices=('library', 'kernel'), default='library',
+                        help="requantisation of --network: the generated layers' or kernels.c's")
+    parser.add_argument('--images', help="IDX or .npy images (default: random)")
+    parser.add_argument('--labels', help="IDX labels for accuracy")
+    parser.add_argument('--count', type=int, default=100)
+    args = parser.parse_args(argv)
+
+    logging.basicConfig(level=logging.INFO, format='%(message)s')
+    if args.images:
+        images = load_images(args.images)[:args.count]
+    else:
+        images = synthetic_images(args.count)
+    labels = load_idx(args.labels)[:len(images)] if args.labels else None
+    if args.network:
+        from .netref import NetworkModel
+
+        model = NetworkModel(args.network, rounding=args.rounding)
+        args.model = model.kind
+    else:
+        model = ReferenceModel(args.model)
+
+    if not args.port:
+        print(f"{args.model}, {len(images)} images, host only")
+        print(run_host(model, images).report(labels))
+        return 0
+
+    conn, link, baud = open_device(args.port, args.baud, args.rtscts)
+    try:
+        caps = link.probe()
+        logits = caps is not None and bool(caps.flags & protocol.CAP_LOGITS)
+        print(f"{args.model} against {args.port} @ {baud} baud, {len(images)} images")
+        result = compare(link, model, images, logits)
+    finally:
+        conn.close()
+    print(result.report(labels))
+    return 1 if result.mismatches or result.errors else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,190 @@
+"""Score a directory of digit images on the boards, decoding on every core.
+
+    python -m stm32dc.scan scans/ --ports COM9 COM10 --out labels.npy
+    python -m stm32dc.scan scans/ --ports COM9 --batch 32 --out labels.npy
+    python -m stm32dc.scan scans/ --ports COM9 COM10 --out labels.npy --scores scores.npy --jobs 8
+
+Every image file under the directory (PNG, JPEG, GIF, BMP, PGM/PPM, .npy)
+is one digit, sorted by path. A pool of --jobs processes decodes each,
+finds its ink (stm32dc.segment.to_ink) and frames it to 28x28 the EMNIST
+way the canvas does (stm32dc.preprocess.normalize). The parent gets 784 B
+per file, feeds them to a DevicePool, or with --batch to a DynamicBatcher,
+and the results into an OrderedSink (stm32dc.sink). The files' paths go to a .txt
+next to --out, line i the file of row i. A file that cannot be read is
+FAILED in the labels and logged.
+
+Decoding is what a folder of scans costs the host: a few milliseconds a
+file, against well under one for a board to classify it, so it runs on
+every core. Paths are handed out only while the sink has room (its
+window), so decoded images never pile up ahead of the boards; a decoding
+process that dies stops the scan with an error rather than a hang.
+PGM/PPM and .npy are read natively; other formats need Pillow. The framed
+images are kept in the preprocessing cache (stm32dc.prepcache): scoring
+the same files again decodes nothing.
+"""
+import argparse
+import collections
+import logging
+import os
+import sys
+import threading
+from concurrent.futures import ProcessPoolExecutor
+
+import numpy as np
+
+from .prepcache import cached_folder
+from .preprocess import normalize
+from .segment import to_gray, to_ink
+from .sink import DEFAULT_WINDOW, OrderedSink, score
+
+EXTENSIONS = ('.png', '.jpg', '.jpeg', '.gif', '.bmp', '.tif', '.tiff', '.pgm', '.ppm', '.pnm', '.npy')
+# Paths per task sent to a decoding process
+CHUNK = 16
+
+log = logging.getLogger(__name__)
+
+
+def find_images(root):
+    """Image files under root, sorted"""
+    found = []
+    for folder, dirs, files in os.walk(root):
+        dirs.sort()
+        found += [os.path.join(folder, f) for f in sorted(files) if f.lower().endswith(EXTENSIONS)]
+    return found
+
+
+def read_netpbm(path):
+    """uint8 pixels of a binary PGM (P5) or PPM (P6)"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    fields, at = [], 0
+    while len(fields) < 4:
+        while data[at:at + 1].isspace():
+            at += 1
+        if data[at:at + 1] == b'#':
+            at = data.index(b'\n', at)
+            continue
+        end = at
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[at:end])
+        at = end
+    magic, width, height, maxval = fields[0], int(fields[1]), int(fields[2]), int(fields[3])
+    if magic not in (b'P5', b'P6'):
+        raise ValueError(f"{magic.decode(errors='replace')} is not binary PGM/PPM")
+    channels = 3 if magic == b'P6' else 1
+    dtype = np.uint8 if maxval < 256 else np.dtype('>u2')
+    pixels = np.frombuffer(data, dtype, width * height * channels, at + 1)
+    pixels = pixels.reshape((height, width, channels) if channels == 3 else (height, width))
+    return pixels if maxval == 255 else (pixels.astype(np.float32) * (255.0 / maxval)).astype(np.uint8)
+
+
+def read_image(path):
+    """Pixels of an image file, grayscale or RGB(A)"""
+    ext = os.path.splitext(path)[1].lower()
+    if ext == '.npy':
+        return np.load(path)
+    if ext in ('.pgm', '.ppm', '.pnm'):
+        return read_netpbm(path)
+    try:
+        from PIL import Image
+    except ImportError:
+        raise ValueError(f"{ext} needs Pillow, pip install pillow") from None
+    with Image.open(path) as image:
+        return np.asarray(image.convert('L'))
+
+
+def prepare(path):
+    """(784 B model image, None) of an image file, or (None, error)"""
+    try:
+        gray = to_gray(read_image(path))
+        # Already in model polarity, like the canvas's own images: as is
+        ink = gray.astype(np.uint8) if gray.min() == 0 and np.median(gray) == 0 else to_ink(gray)
+        return normalize(ink).tobytes(), None
+    except Exception as e:
+        return None, str(e)
+
+
+def prepare_all(prepare, paths):
+    """prepare() of each of paths, one task of a decoding process"""
+    return [prepare(path) for path in paths]
+
+
+def decoded(paths, jobs, room, prepare=prepare):
+    """prepare() of every path in order on jobs processes, a path sent only once room allows
+
+    Paths are handed out from the consumer's own thread, between the
+    images it takes, so nothing waits on room behind its back: when
+    nothing is out it waits for room itself. A decoding process that dies
+    fails the stream with BrokenProcessPool instead of leaving it waiting
+    for that task, and closing the stream early cancels what is queued.
+    """
+    tasks = collections.deque()     # (paths, future) in order
+    at = 0
+    workers = ProcessPoolExecutor(jobs)
+    try:
+        while at < len(paths) or tasks:
+            while at < len(paths):
+                end = at
+                while end < len(paths) and end - at < CHUNK and room.acquire(blocking=not tasks and end == at):
+                    end += 1
+                if end == at:
+                    break
+                tasks.append((paths[at:end], workers.submit(prepare_all, prepare, paths[at:end])))
+                at = end
+            chunk, future = tasks.popleft()
+            for path, (image, error) in zip(chunk, future.result()):
+                if error is not None:
+                    log.warning("%s: %s", path, error)
+                yield image
+    finally:
+        for _, future in tasks:
+            future.cancel()
+        workers.shutdown()
+
+
+def main(argv=None):
+    from .batcher import DynamicBatcher
+    from .pool import DevicePool
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('folder')
+    parser.add_argument('--ports', nargs='+', required=True, metavar='PORT')
+    parser.add_argument('--baud', type=int, default=921600)
+    parser.add_argument('--rtscts', action='store_true')
+    parser.add_argument('--out', required=True, metavar='LABELS.npy')
+    parser.add_argument('--scores', metavar='SCORES.npy', help="also the 10 probabilities (CLASSIFY_TOPK)")
+    parser.add_argument('--jobs', type=int, default=os.cpu_count() or 1,
+                        help="decoding processes (default: one per core)")
+    parser.add_argument('--window', type=int, default=DEFAULT_WINDOW,
+                        help="images the stream may run ahead of the oldest unanswered one")
+    parser.add_argument('--batch', type=int, default=0, metavar='N',
+                        help="BATCH frames of up to N images (DynamicBatcher), not with --scores")
+    args = parser.parse_args(argv)
+    if args.batch and args.scores:
+        parser.error("--scores needs CLASSIFY_TOPK, which BATCH frames do not carry")
+
+    logging.basicConfig(level=logging.INFO, format='%(asctime)s %(message)s')
+    paths = find_images(args.folder)
+    if not paths:
+        parser.error(f"no images under {args.folder}")
+    listing = os.path.splitext(args.out)[0] + '.txt'
+    with open(listing, 'w', encoding='utf-8') as f:
+        f.writelines(os.path.relpath(p, args.folder) + '\n' for p in paths)
+
+    if args.batch:
+        backend = DynamicBatcher.open(args.ports, args.baud, args.batch, rtscts=args.rtscts)
+    else:
+        backend = DevicePool.open(args.ports, args.baud, rtscts=args.rtscts)
+    # Decoded but not yet sent: the window plus what the processes hold
+    room = threading.Semaphore(args.window + args.jobs * CHUNK)
+    with backend, OrderedSink(args.out, len(paths), args.scores, args.window) as sink:
+        images = cached_folder(paths, lambda paths: decoded(paths, args.jobs, room))
+        job = score(backend, images, sink, sent=room.release)
+    print(job.report())
+    print(f"wrote {args.out} ({listing} lists the files)" + (f" and {args.scores}" if args.scores else ""))
+    return 0 if job.failed < job.count else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
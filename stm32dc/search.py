@@ -0,0 +1,240 @@
+"""Hardware-aware model search: measured F411 latency against accuracy, and its Pareto front.
+
+    python -m stm32dc.search tinyML search/manifest.json --port COM9 \\
+        --images emnist-digits-test-images-idx3-ubyte --labels emnist-digits-test-labels-idx1-ubyte
+    python -m stm32dc.search tinyML search/manifest.json --port COM9 --max-ms 4 --json search/results.json
+
+The notebook's step 14 trains a grid of candidates (filter counts, dense
+width) and writes their int8 TFLite files and a manifest:
+
+    [{"name": "c16_32_d128", "tflite": "c16_32_d128.tflite", "accuracy": 0.99, ...}, ...]
+
+tflite paths are relative to the manifest. The search packs the candidates
+into firmware images of at most --flash-kb of weights (estimated from the
+TFLite sizes). For each image it:
+
+1. generates every candidate with ST Edge AI Core as cand0, cand1, ... (-O ram
+   as the CubeMX network) and lists them in Core/Inc/candidates.h;
+2. runs --build, then --flash, and waits for the board to answer;
+3. selects each candidate in turn and classifies --count labelled images
+   with CLASSIFY_PROF. That gives the on-device accuracy and the DWT run
+   cycles. With APP_PROFILE_LAYERS it also gives the cycles per layer.
+
+Last, it prints every candidate and the Pareto front: the candidates that
+no other one beats on both accuracy and run time. With --max-ms, it also
+picks the most accurate candidate within that run time. The generated files
+are removed and candidates.h is restored afterwards, so the board is left
+with the last image's candidates, after every other model.
+
+--build and --flash are shell commands, {project} stands for the project
+directory. The defaults use the makefiles that STM32CubeIDE writes into
+Release/ on its first build, with arm-none-eabi-gcc on the PATH, and
+STM32_Programmer_CLI over the ST-LINK.
+"""
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+
+from . import protocol
+from .bench import open_device, percentile
+from .dataset import Dataset, load_labels
+from .generate import generate
+from .link import DeviceError
+
+CANDIDATES_H = os.path.join('Core', 'Inc', 'candidates.h')
+DEFAULT_BUILD = 'make -C {project}/Release -j8 all'
+DEFAULT_FLASH = 'STM32_Programmer_CLI -c port=SWD -w {project}/Release/tinyML.elf -v -rst'
+# 384 KB of flash (sector 7 is the UPLOAD region), less the code and the models always linked
+DEFAULT_FLASH_KB = 192
+
+
+def candidates_header(names):
+    """candidates.h registering the generated networks `names`"""
+    lines = [line for name in names for line in (f'#include "{name}.h"', f'#include "{name}_data.h"')]
+    rows = " \\\n".join(f"  X({name}, {name.upper()})" for name in names)
+    return (f"/* Written by python -m stm32dc.search, restored when it ends */\n\n"
+            f"#ifndef __CANDIDATES_H\n#define __CANDIDATES_H\n\n"
+            + "\n".join(lines) + f"\n\n#define MODEL_LIST_CANDIDATES(X) \\\n{rows}\n\n"
+            f"#endif /* __CANDIDATES_H */\n")
+
+
+def pack(candidates, budget):
+    """Split the candidates into groups of at most budget TFLite bytes (at least one each)"""
+    groups, size = [[]], 0
+    for c in candidates:
+        if groups[-1] and size + c['size'] > budget:
+            groups.append([])
+            size = 0
+        groups[-1].append(c)
+        size += c['size']
+    return [g for g in groups if g]
+
+
+def pareto(results):
+    """The results no other one beats on both device accuracy and run cycles, fastest first"""
+    front, best = [], -1.0
+    for r in sorted(results, key=lambda r: (r['cycles'], -r['device_accuracy'])):
+        if r['device_accuracy'] > best:
+            front.append(r)
+            best = r['device_accuracy']
+    return front
+
+
+def wait_for_board(port, baud, rtscts, timeout):
+    """open_device, retried while the board resets after --flash"""
+    deadline = time.monotonic() + timeout
+    while True:
+        try:
+            return open_device(port, baud, rtscts)
+        except (OSError, TimeoutError, DeviceError):
+            if time.monotonic() > deadline:
+                raise
+            time.sleep(0.5)
+
+
+def measure(link, index, images, labels, warmup):
+    """Select registered model index and time it on the labelled images"""
+    sel = link.select_model(index)
+    for img in images[:warmup]:
+        link.classify(img)
+    runs, correct, layers = [], 0, {}
+    for img, label in zip(images, labels):
+        digit, profile = link.classify_profiled(img)
+        runs.append(profile.run * profile.cpu_hz / 1e6)
+        correct += digit == label
+        try:
+            for name, us in link.layer_profile():
+                layers[name] = layers.get(name, 0.0) + us * profile.cpu_hz / 1e6
+        except DeviceError as e:
+            if e.code != protocol.ERR_TYPE:
+                raise
+    runs.sort()
+    return {
+        'weights_size': sel.weights_size,
+        'activations_size': sel.activations_size,
+        'device_accuracy': correct / len(images),
+        'cycles': sum(runs) / len(runs),
+        'cycles_p99': percentile(runs, 99),
+        'run_ms': sum(runs) / len(runs) / profile.cpu_hz * 1e3,
+        'layers': {name: c / len(images) for name, c in layers.items()},
+    }
+
+
+def shell(command, project):
+    cmd = command.format(project=project)
+    print(cmd)
+    subprocess.run(cmd, shell=True, check=True)
+
+
+def run_group(args, group, images, labels):
+    """Generate, build, flash and measure one image's candidates"""
+    names = [f"cand{i}" for i in range(len(group))]
+    header = os.path.join(args.project, CANDIDATES_H)
+    with open(header, encoding='utf-8') as f:
+        original = f.read()
+    generated = []
+    try:
+        for name, c in zip(names, group):
+            generated += generate(args.project, c['path'], name, 'ram', 'none', args.tool)
+        with open(header, 'w', encoding='utf-8') as f:
+            f.write(candidates_header(names))
+        shell(args.build, args.project)
+        shell(args.flash, args.project)
+    finally:
+        with open(header, 'w', encoding='utf-8') as f:
+            f.write(original)
+        for path in generated:
+            os.remove(path)
+
+    conn, link, _ = wait_for_board(args.port, args.baud, args.rtscts, args.boot_timeout)
+    results = []
+    try:
+        count = link.select_model().count
+        # Candidates come last in MODEL_LIST
+        for index, c in enumerate(group, count - len(group)):
+            r = measure(link, index, images, labels, args.warmup)
+            r.update(name=c['name'], host_accuracy=c.get('accuracy'), config=c)
+            print(f"  {c['name']:<20}{r['device_accuracy'] * 100:>8.2f}%{r['cycles']:>12.0f} cycles"
+                  f"{r['weights_size']:>10} B")
+            results.append(r)
+        link.select_model(0)
+    finally:
+        conn.close()
+    return results
+
+
+def report(results, front, picked):
+    lines = [f"{'candidate':<20}{'device':>9}{'host':>9}{'cycles':>11}{'p99':>11}{'ms':>8}"
+             f"{'weights B':>11}{'arena B':>9}"]
+    on_front = {id(r) for r in front}
+    for r in sorted(results, key=lambda r: r['cycles']):
+        host = f"{r['host_accuracy'] * 100:.2f}%" if r['host_accuracy'] is not None else "-"
+        mark = " *" if id(r) in on_front else ""
+        lines.append(f"{r['name']:<20}{r['device_accuracy'] * 100:>8.2f}%{host:>9}{r['cycles']:>11.0f}"
+                     f"{r['cycles_p99']:>11.0f}{r['run_ms']:>8.2f}{r['weights_size']:>11}"
+                     f"{r['activations_size']:>9}{mark}")
+    lines.append(f"* Pareto front: {', '.join(r['name'] for r in front)}")
+    if picked:
+        lines.append(f"picked {picked['name']}: {picked['device_accuracy'] * 100:.2f}% "
+                     f"in {picked['run_ms']:.2f} ms")
+    return "\n".join(lines)
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('project', help="firmware project directory (tinyML)")
+    ap.add_argument('manifest', help="the notebook's search/manifest.json")
+    ap.add_argument('--port', required=True)
+    ap.add_argument('--baud', type=int, default=921600)
+    ap.add_argument('--rtscts', action='store_true')
+    ap.add_argument('--images', required=True, help="IDX or .npy file of 28x28 uint8 images")
+    ap.add_argument('--labels', required=True, help="IDX label file")
+    ap.add_argument('--count', type=int, default=1000, help="labelled images per candidate")
+    ap.add_argument('--warmup', type=int, default=10)
+    ap.add_argument('--flash-kb', type=int, default=DEFAULT_FLASH_KB,
+                    help="candidate weights per firmware image (default %(default)s KB)")
+    ap.add_argument('--build', default=DEFAULT_BUILD, help="build command (default %(default)r)")
+    ap.add_argument('--flash', default=DEFAULT_FLASH, help="flash command (default %(default)r)")
+    ap.add_argument('--boot-timeout', type=float, default=15.0)
+    ap.add_argument('--tool', default='stedgeai')
+    ap.add_argument('--max-ms', type=float, help="pick the most accurate candidate within this run time")
+    ap.add_argument('--json', metavar='PATH', help="also write the results as JSON")
+    args = ap.parse_args(argv)
+
+    with open(args.manifest, encoding='utf-8') as f:
+        candidates = json.load(f)
+    root = os.path.dirname(os.path.abspath(args.manifest))
+    for c in candidates:
+        c['path'] = os.path.join(root, c['tflite'])
+        c['size'] = os.path.getsize(c['path'])
+    images = Dataset(args.images)[:args.count]
+    labels = load_labels(args.labels)[:len(images)]
+    if len(labels) != len(images):
+        ap.error(f"{len(labels)} labels for {len(images)} images")
+
+    groups = pack(candidates, args.flash_kb * 1024)
+    print(f"{len(candidates)} candidates in {len(groups)} firmware images, {len(images)} images each")
+    results = []
+    for n, group in enumerate(groups):
+        print(f"image {n + 1}/{len(groups)}: {', '.join(c['name'] for c in group)}")
+        results += run_group(args, group, images, labels)
+
+    front = pareto(results)
+    within = [r for r in front if args.max_ms is not None and r['run_ms'] <= args.max_ms]
+    picked = within[-1] if within else None
+    print(report(results, front, picked))
+    if args.json:
+        for r in results:
+            r['config'] = {k: v for k, v in r['config'].items() if k not in ('path', 'size')}
+            r['pareto'] = any(r is p for p in front)
+        with open(args.json, 'w', encoding='utf-8') as f:
+            json.dump({'images': len(images), 'results': results,
+                       'picked': picked['name'] if picked else None}, f, indent=1)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,139 @@
+"""Cut an image of a whole number into one 28x28 model input per digit (numpy).
+
+    crops, boxes = segment(image)          # left to right
+    digits = worker.classify_batch(crops).result()
+
+Ink is separated from the background with Otsu's threshold, after
+inverting a dark-on-light image, and labelled into 8-connected components.
+Labelling runs on whole arrays: every inked pixel starts as its own index,
+takes the smallest label of its neighbours, then the label that label's
+pixel holds, until nothing changes; the second step makes it converge in
+a few dozen passes rather than one per pixel of the longest stroke.
+
+Components that overlap horizontally by half the narrower one's width are
+one digit, so a 5 written in two strokes stays whole, and specks smaller
+than MIN_AREA of the largest component are dropped. Each digit is framed
+like EMNIST (preprocess.normalize) on its own ink only, a neighbour
+reaching into its bounding box does not leak into it.
+"""
+import numpy as np
+
+from .preprocess import MODEL_SIZE, normalize
+from .protocol import MAX_BATCH
+
+# Components below this fraction of the largest one's pixels are noise
+MIN_AREA = 0.05
+# Horizontal overlap, of the narrower width, that makes two components one digit
+MERGE_OVERLAP = 0.5
+
+
+def to_gray(image):
+    """2-D float32 image, RGB(A) averaged"""
+    image = np.asarray(image, np.float32)
+    if image.ndim == 3:
+        image = image[..., :3].mean(-1)
+    return image
+
+
+def otsu(gray):
+    """Threshold between the two classes of a 0-255 image, by Otsu's method"""
+    hist = np.bincount(np.clip(gray, 0, 255).astype(np.uint8).ravel(), minlength=256).astype(np.float64)
+    levels = np.arange(256)
+    w0 = np.cumsum(hist)
+    w1 = w0[-1] - w0
+    m0 = np.cumsum(hist * levels)
+    mean0 = m0 / np.where(w0 > 0, w0, 1)
+    mean1 = (m0[-1] - m0) / np.where(w1 > 0, w1, 1)
+    between = w0 * w1 * (mean0 - mean1) ** 2
+    return int(np.argmax(between))
+
+
+def to_ink(image):
+    """uint8 ink image, 0 = background: the pixels past the threshold, darker paper inverted"""
+    gray = to_gray(image)
+    if np.median(gray) > 127:
+        gray = 255 - gray
+    mask = gray > otsu(gray)
+    return np.where(mask, gray, 0).astype(np.uint8)
+
+
+def label(mask):
+    """int32 labels of the 8-connected components of a bool image, -1 for background.
+
+    A component's label is the flat index of its first pixel.
+    """
+    h, w = mask.shape
+    size = h * w
+    none = size  # background, larger than every label
+    labels = np.where(mask, np.arange(size, dtype=np.int32).reshape(h, w), none).astype(np.int32)
+    while True:
+        # Smallest label among the 3x3 neighbourhood
+        padded = np.pad(labels, 1, constant_values=none)
+        low = labels.copy()
+        for dy in range(3):
+            for dx in range(3):
+                np.minimum(low, padded[dy:dy + h, dx:dx + w], out=low)
+        low[~mask] = none
+        # Then the label that pixel holds, twice: pointer jumping
+        flat = np.append(low.ravel(), none)
+        low = flat[flat[low]]
+        if np.array_equal(low, labels):
+            break
+        labels = low
+    labels[~mask] = -1
+    return labels
+
+
+def components(labels):
+    """(roots, boxes, areas) of a label image: boxes as int rows (y0, x0, y1, x1), exclusive ends"""
+    ys, xs = np.nonzero(labels >= 0)
+    roots, index, areas = np.unique(labels[ys, xs], return_inverse=True, return_counts=True)
+    n = len(roots)
+    boxes = np.empty((n, 4), np.int64)
+    boxes[:, :2] = np.iinfo(np.int64).max
+    boxes[:, 2:] = -1
+    np.minimum.at(boxes[:, 0], index, ys)
+    np.minimum.at(boxes[:, 1], index, xs)
+    np.maximum.at(boxes[:, 2], index, ys + 1)
+    np.maximum.at(boxes[:, 3], index, xs + 1)
+    return roots, boxes, areas
+
+
+def group(boxes, areas):
+    """Components of each digit, left to right: lists of component indices"""
+    if len(boxes) == 0:
+        return []
+    keep = np.flatnonzero(areas >= MIN_AREA * areas.max())
+    keep = keep[np.argsort(boxes[keep, 1], kind='stable')]
+    digits = []
+    left = right = 0
+    for i in keep:
+        x0, x1 = boxes[i, 1], boxes[i, 3]
+        if digits and min(right, x1) - max(left, x0) >= MERGE_OVERLAP * min(right - left, x1 - x0):
+            digits[-1].append(i)
+            right = max(right, x1)
+        else:
+            digits.append([i])
+            left, right = x0, x1
+    return digits
+
+
+def segment(image, size=MODEL_SIZE, max_digits=MAX_BATCH):
+    """Digits of an image left to right: (uint8 [n, size, size] EMNIST framed, [(y0, x0, y1, x1)])
+
+    image is grayscale or RGB in either polarity; an image already in
+    model polarity (ink bright, background exactly 0) is used as is.
+    """
+    gray = to_gray(image)
+    ink = gray.astype(np.uint8) if gray.min() == 0 and np.median(gray) == 0 else to_ink(gray)
+    labels = label(ink > 0)
+    roots, boxes, areas = components(labels)
+
+    crops, spans = [], []
+    for members in group(boxes, areas)[:max_digits]:
+        y0, x0 = boxes[members, :2].min(0)
+        y1, x1 = boxes[members, 2:].max(0)
+        own = np.isin(labels[y0:y1, x0:x1], roots[members])
+        crops.append(normalize(np.where(own, ink[y0:y1, x0:x1], 0), size))
+        spans.append((int(y0), int(x0), int(y1), int(x1)))
+    return np.array(crops, np.uint8).reshape(-1, size, size), spans
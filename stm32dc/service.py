@@ -0,0 +1,308 @@
+"""Headless classification service over HTTP, no Tk.
+
+    python -m stm32dc.service --ports COM9 COM10 --listen 127.0.0.1:8784
+    python -m stm32dc.service --ports /dev/ttyACM0 --unix /run/stm32dc.sock
+    python -m stm32dc.service --ports COM9 --shm /run/stm32dc-shm.sock
+
+    curl --data-binary @images.u8 http://127.0.0.1:8784/classify
+    curl --data-binary @scans.u8 'http://127.0.0.1:8784/classify?priority=bulk'
+    curl http://127.0.0.1:8784/health
+    curl http://127.0.0.1:8784/metrics
+
+With --batch N the boards get BATCH frames instead: requests queue for
+up to --max-wait-ms (5 ms) until N have gathered (stm32dc.batcher).
+
+POST /classify takes N x 784 B of 28x28 uint8 images (application/octet-stream)
+and answers {"digits": [...]}, null for an image that failed or was blank. The images of
+all clients go into one DevicePool, each board keeping several frames in
+flight, so concurrent requests share the link's pipeline instead of waiting
+for each other's round trips. The same image asked for again while it is
+still in flight is coalesced onto that request rather than sent twice,
+and with --cache N one already answered comes from an LRU result cache.
+?priority=interactive or bulk picks the LinkWorker lane; without it a
+single image is interactive and more are bulk, so a scoring job soaks up
+what capacity the interactive clients leave (--weights to share it
+instead of strict priority). ?model=<signature> sends the images to
+boards with that model (DevicePool routing, not with --batch); GET /health
+lists every board with its counters and active model (DevicePool.health),
+and the models of the pool. GET /metrics has the same and more for
+Prometheus: request and board latency histograms, queue depths, the
+cache's hit ratio, link errors and the boards' STATS (stm32dc.metrics).
+--telemetry MS has boards built with APP_TELEMETRY push their counters
+every MS instead of being asked for STATS at scrape time.
+
+With --shm local producers skip HTTP: they write images into a shared
+memory ring and read the digits back from it (stm32dc.shmring).
+"""
+import argparse
+import json
+import logging
+import os
+import socketserver
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlsplit
+
+from .link import DeviceError, IMAGE_SIZE
+from .batcher import DynamicBatcher
+from .cache import ResultCache
+from .capture import CaptureWriter
+from .metrics import CONTENT_TYPE, DeviceStats, FleetTelemetry, Histogram, collect
+from .pool import DevicePool, POLICIES, LEAST_OUTSTANDING
+from .worker import BULK, INTERACTIVE
+
+PRIORITY_NAMES = {'interactive': INTERACTIVE, 'bulk': BULK}
+LANE_NAMES = {value: name for name, value in PRIORITY_NAMES.items()}
+
+DEFAULT_LISTEN = '127.0.0.1:8784'
+# Largest POST body, about 1200 images
+MAX_BODY = 1 << 20
+RESULT_TIMEOUT = 30.0
+
+log = logging.getLogger(__name__)
+
+
+class Classifier:
+    """DevicePool or DynamicBatcher front end that coalesces identical images in flight"""
+
+    def __init__(self, pool, cache=None):
+        self.pool = pool
+        self.cache = cache       # ResultCache answering repeated images, or None
+        self.lock = threading.Lock()
+        self.inflight = {}       # image bytes -> Future
+        self.coalesced = 0
+        self.latency = {}        # priority name -> metrics.Histogram of classify() calls
+        self.images = {}         # priority name -> images classified
+
+    def submit(self, image, priority=INTERACTIVE, model=None):
+        image = bytes(image)
+        # Results of one image under two models differ
+        key = image if model is None else model.encode() + image
+        send = (lambda: self.pool.classify(image, priority)) if model is None else \
+            (lambda: self.pool.classify(image, priority, model=model))
+        with self.lock:
+            future = self.inflight.get(key)
+            if future is not None:
+                self.coalesced += 1
+                return future
+            if self.cache is not None:
+                future = self.cache.classify(key, lambda _: send())
+                if future.done():
+                    return future
+            else:
+                future = send()
+            self.inflight[key] = future
+        future.add_done_callback(lambda f: self._forget(key, f))
+        return future
+
+    def _forget(self, key, future):
+        with self.lock:
+            if self.inflight.get(key) is future:
+                del self.inflight[key]
+
+    def classify(self, images, priority=INTERACTIVE, model=None):
+        """Digits of images, None for those that failed or were blank"""
+        start = time.perf_counter()
+        futures = [self.submit(img, priority, model) for img in images]
+        digits = []
+        for f in futures:
+            try:
+                digits.append(f.result(RESULT_TIMEOUT))
+            except (DeviceError, TimeoutError, ConnectionError) as e:
+                log.warning("classification failed: %s", e)
+                digits.append(None)
+        name = LANE_NAMES[priority]
+        with self.lock:
+            if name not in self.latency:
+                self.latency[name] = Histogram()
+            self.latency[name].observe(time.perf_counter() - start)
+            self.images[name] = self.images.get(name, 0) + len(images)
+        return digits
+
+    def snapshot(self):
+        """[(priority name, Histogram.snapshot())] of classify() latency"""
+        with self.lock:
+            return [(name, hist.snapshot()) for name, hist in self.latency.items()]
+
+
+class Handler(BaseHTTPRequestHandler):
+    server_version = 'stm32dc'
+    protocol_version = 'HTTP/1.1'
+
+    def _reply(self, status, body):
+        data = json.dumps(body).encode()
+        self.send_response(status)
+        self.send_header('Content-Type', 'application/json')
+        self.send_header('Content-Length', str(len(data)))
+        self.end_headers()
+        self.wfile.write(data)
+
+    def do_GET(self):
+        if self.path == '/metrics':
+            return self._metrics()
+        if self.path != '/health':
+            return self._reply(404, {'error': 'not found'})
+        classifier = self.server.classifier
+        boards = [m._asdict() for m in classifier.pool.health()]
+        body = {'boards': boards, 'coalesced': classifier.coalesced}
+        if hasattr(classifier.pool, 'models'):
+            body['models'] = classifier.pool.models()
+        if getattr(classifier.pool, 'hedge', False):
+            pool = classifier.pool
+            body['hedges'] = {'sent': pool.hedges, 'won': pool.hedge_wins,
+                              'delay_ms': pool.hedge_delay * 1e3 if pool.hedge_delay else None}
+        if classifier.cache is not None:
+            cache = classifier.cache
+            body['cache'] = {'hits': cache.hits, 'misses': cache.misses,
+                             'entries': len(cache), 'capacity': cache.capacity}
+        self._reply(200, body)
+
+    def _metrics(self):
+        data = collect(self.server.classifier, self.server.device_stats, self.server.telemetry).encode()
+        self.send_response(200)
+        self.send_header('Content-Type', CONTENT_TYPE)
+        self.send_header('Content-Length', str(len(data)))
+        self.end_headers()
+        self.wfile.write(data)
+
+    def do_POST(self):
+        url = urlsplit(self.path)
+        if url.path != '/classify':
+            return self._reply(404, {'error': 'not found'})
+        query = parse_qs(url.query)
+        name = query.get('priority', [None])[0]
+        if name is not None and name not in PRIORITY_NAMES:
+            return self._reply(400, {'error': f"priority must be one of {', '.join(PRIORITY_NAMES)}"})
+        model = query.get('model', [None])[0]
+        pool = self.server.classifier.pool
+        if model is not None and (not hasattr(pool, 'models') or model not in pool.models()):
+            return self._reply(400, {'error': f"no board has model {model}"})
+        length = int(self.headers.get('Content-Length') or 0)
+        if length == 0 or length % IMAGE_SIZE or length > MAX_BODY:
+            return self._reply(400, {'error': f'body must be N x {IMAGE_SIZE} B, '
+                                              f'at most {MAX_BODY} B'})
+        body = self.rfile.read(length)
+        images = [body[i:i + IMAGE_SIZE] for i in range(0, length, IMAGE_SIZE)]
+        if name is None:
+            priority = INTERACTIVE if len(images) == 1 else BULK
+        else:
+            priority = PRIORITY_NAMES[name]
+        self._reply(200, {'digits': self.server.classifier.classify(images, priority, model)})
+
+    def address_string(self):
+        # Unix socket peers have no address
+        return self.client_address[0] if self.client_address else 'unix'
+
+    def log_message(self, fmt, *args):
+        log.debug("%s %s", self.address_string(), fmt % args)
+
+
+class UnixHTTPServer(socketserver.ThreadingMixIn, socketserver.UnixStreamServer):
+    daemon_threads = True
+
+
+def serve(pool, listen=DEFAULT_LISTEN, unix=None, cache=None, shm=None, telemetry_ms=0):
+    """Serve pool until interrupted, shm the socket path of shared-memory rings,
+    telemetry_ms the boards' telemetry interval (0: STATS at scrape time)"""
+    if unix:
+        if os.path.exists(unix):
+            os.unlink(unix)
+        server = UnixHTTPServer(unix, Handler)
+        where = unix
+    else:
+        host, _, port = listen.rpartition(':')
+        server = ThreadingHTTPServer((host or '127.0.0.1', int(port)), Handler)
+        server.daemon_threads = True
+        where = f"http://{host or '127.0.0.1'}:{port}"
+    server.classifier = Classifier(pool, cache)
+    # The batcher's threads own their boards' links
+    server.telemetry = None
+    server.device_stats = None
+    if hasattr(pool, 'members'):
+        if telemetry_ms:
+            server.telemetry = FleetTelemetry(pool, telemetry_ms)
+        server.device_stats = DeviceStats(pool, telemetry=server.telemetry)
+    rings = None
+    if shm:
+        from .shmring import RingServer
+        rings = RingServer(server.classifier, shm).start()
+        log.info("shared-memory rings on %s", shm)
+    log.info("serving %d boards on %s", len(pool), where)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if rings:
+            rings.close()
+        server.server_close()
+        if unix and os.path.exists(unix):
+            os.unlink(unix)
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--ports', nargs='+', required=True, metavar='PORT')
+    parser.add_argument('--baud', type=int, default=921600)
+    parser.add_argument('--rtscts', action='store_true',
+                        help="RTS/CTS flow control (firmware built with APP_UART_FLOW)")
+    parser.add_argument('--policy', choices=POLICIES, default=LEAST_OUTSTANDING)
+    parser.add_argument('--no-hedge', action='store_true',
+                        help="never send a slow interactive request to a second board")
+    parser.add_argument('--listen', default=DEFAULT_LISTEN, metavar='HOST:PORT')
+    parser.add_argument('--unix', metavar='PATH', help="serve on a Unix socket instead of TCP")
+    parser.add_argument('--shm', metavar='PATH',
+                        help="also serve local producers over shared-memory rings, this Unix socket "
+                             "their doorbell (stm32dc.shmring)")
+    parser.add_argument('--batch', type=int, default=0, metavar='N',
+                        help="send BATCH frames of up to N images (DynamicBatcher)")
+    parser.add_argument('--max-wait-ms', type=float, default=5.0,
+                        help="with --batch, longest a request waits for its batch to fill")
+    parser.add_argument('--cache', type=int, default=0, metavar='ENTRIES',
+                        help="answer repeated images from an LRU result cache of this size")
+    parser.add_argument('--capture', metavar='PATH',
+                        help="append every request and reply to a capture file (stm32dc.capture)")
+    parser.add_argument('--weights', metavar='I:B',
+                        help="send I interactive requests per B bulk ones while both wait "
+                             "(default: interactive strictly first)")
+    parser.add_argument('--telemetry', type=int, default=0, metavar='MS',
+                        help="have boards built with APP_TELEMETRY push their counters every MS "
+                             "for /metrics instead of answering STATS")
+    args = parser.parse_args(argv)
+    weights = None
+    if args.weights:
+        try:
+            weights = tuple(int(n) for n in args.weights.split(':'))
+        except ValueError:
+            weights = ()
+        if len(weights) != 2 or min(weights) < 1:
+            parser.error("--weights takes two positive integers, e.g. 4:1")
+    if args.capture and args.batch:
+        parser.error("--capture records the pool's workers, it does not apply to --batch")
+    if args.telemetry and args.batch:
+        parser.error("--telemetry goes through the pool's workers, it does not apply to --batch")
+    if not 0 <= args.telemetry <= 0xFFFF:
+        parser.error("--telemetry takes 1 to 65535 ms")
+
+    logging.basicConfig(level=logging.INFO, format='%(asctime)s %(message)s')
+    capture = CaptureWriter(args.capture) if args.capture else None
+    if args.batch:
+        backend = DynamicBatcher.open(args.ports, args.baud, args.batch, args.max_wait_ms / 1e3,
+                                      rtscts=args.rtscts)
+    else:
+        backend = DevicePool.open(args.ports, args.baud, args.policy, rtscts=args.rtscts,
+                                  weights=weights, capture=capture, hedge=not args.no_hedge)
+    try:
+        with backend:
+            serve(backend, args.listen, args.unix, ResultCache(args.cache) if args.cache else None,
+                  args.shm, args.telemetry)
+    finally:
+        if capture:
+            capture.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
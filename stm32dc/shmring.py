@@ -0,0 +1,311 @@
+"""Shared-memory ring between the service and local producers (POSIX).
+
+    python -m stm32dc.service --ports COM9 COM10 --shm /run/stm32dc-shm.sock
+
+    with RingClient.connect('/run/stm32dc-shm.sock') as ring:
+        for digit in ring.classify_many(Dataset('emnist-digits-test-images-idx3-ubyte')):
+            ...
+
+    python -m stm32dc.shmring --socket /run/stm32dc-shm.sock --images test-images.idx
+
+A client maps a file of SLOTS slots (in /dev/shm where there is one),
+hands its path to the service over the Unix socket and unlinks it once
+the service has mapped it too. A slot is a state byte, the result and the
+784 B image:
+
+    EMPTY  -> READY   the client wrote the image
+    READY  -> TAKEN   the service submitted it (Classifier.submit: cache,
+                      coalescing, the pool)
+    TAKEN  -> DONE    the result was written into the slot in place
+    DONE   -> EMPTY   the client read it
+
+The client fills and drains slots in order; the service takes them in
+order and completes them in any order. Images never cross a socket: the
+service's copy out of the mapping is the one the request payload needs
+anyway. The socket is only a doorbell. A side with nothing to do sets its
+waiting byte in the header, looks at the slot once more, then blocks on
+the socket; the other side sends a byte only when it sees the flag set,
+the futex pattern, so a busy producer makes no syscall per image. Python
+has no memory fences across processes: a wakeup lost to store reordering
+costs WAKE_TIMEOUT, after which the sleeper looks again.
+"""
+import argparse
+import mmap
+import os
+import socket
+import struct
+import sys
+import tempfile
+import threading
+import time
+
+from . import protocol
+from .link import DeviceError, IMAGE_SIZE
+from .worker import BULK, INTERACTIVE
+
+MAGIC = b'SDRG'
+VERSION = 1
+DEFAULT_SLOTS = 4096
+# Seconds a sleeper waits for the doorbell before looking again
+WAKE_TIMEOUT = 0.01
+
+# magic, version, priority, slots, slot size; then the two waiting bytes
+HEADER = struct.Struct('<4sHBxII')
+SERVICE_WAITING = 16
+CLIENT_WAITING = 17
+HEADER_SIZE = 64
+# state, digit, error, then the image
+SLOT_HEAD = 8
+SLOT_SIZE = SLOT_HEAD + IMAGE_SIZE
+
+EMPTY, READY, TAKEN, DONE = range(4)
+# Slot error byte: protocol.ERR_* from the device, or the host's own
+ERR_TIMEOUT = 0xFE
+ERR_LINK = 0xFD
+
+
+def ring_size(slots):
+    return HEADER_SIZE + slots * SLOT_SIZE
+
+
+class RingServer:
+    """Serves the rings of local clients from a service.Classifier"""
+
+    def __init__(self, classifier, path):
+        self.classifier = classifier
+        self.path = path
+        self.closed = threading.Event()
+        if os.path.exists(path):
+            os.unlink(path)
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.sock.bind(path)
+        self.sock.listen()
+        self.sock.settimeout(0.5)
+        self.thread = threading.Thread(target=self._accept, name='shm-accept', daemon=True)
+
+    def start(self):
+        self.thread.start()
+        return self
+
+    def close(self):
+        self.closed.set()
+        self.thread.join()
+        self.sock.close()
+        if os.path.exists(self.path):
+            os.unlink(self.path)
+
+    def _accept(self):
+        while not self.closed.is_set():
+            try:
+                conn, _ = self.sock.accept()
+            except socket.timeout:
+                continue
+            except OSError:
+                return
+            threading.Thread(target=self._serve, args=(conn,), name='shm-ring', daemon=True).start()
+
+    def _serve(self, conn):
+        with conn:
+            try:
+                ring = _open_ring(conn)
+            except (OSError, ValueError) as e:
+                conn.sendall(f"error {e}\n".encode())
+                return
+            conn.sendall(b'ok\n')
+            mm, slots, priority = ring
+            outstanding = [0]
+            done = threading.Condition()
+            conn.settimeout(WAKE_TIMEOUT)
+            try:
+                self._take(conn, mm, slots, priority, outstanding, done)
+            finally:
+                # Completions still write into the mapping
+                with done:
+                    done.wait_for(lambda: outstanding[0] == 0)
+                mm.close()
+
+    def _take(self, conn, mm, slots, priority, outstanding, done):
+        tail = 0
+        while not self.closed.is_set():
+            at = HEADER_SIZE + tail * SLOT_SIZE
+            if mm[at] == READY:
+                mm[at] = TAKEN
+                with done:
+                    outstanding[0] += 1
+                future = self.classifier.submit(mm[at + SLOT_HEAD:at + SLOT_SIZE], priority)
+                future.add_done_callback(lambda f, at=at: self._complete(conn, mm, at, f, outstanding, done))
+                tail = (tail + 1) % slots
+                continue
+            mm[SERVICE_WAITING] = 1
+            if mm[at] != READY:
+                try:
+                    if not conn.recv(256):
+                        return  # client gone
+                except socket.timeout:
+                    pass
+            mm[SERVICE_WAITING] = 0
+
+    def _complete(self, conn, mm, at, future, outstanding, done):
+        error = ConnectionError("Cancelled") if future.cancelled() else future.exception()
+        if error is None:
+            digit = future.result()
+            mm[at + 1] = protocol.CLASS_NONE if digit is None else digit
+            mm[at + 2] = protocol.ERR_NONE
+        else:
+            mm[at + 1] = protocol.CLASS_NONE
+            mm[at + 2] = error.code if isinstance(error, DeviceError) else \
+                ERR_TIMEOUT if isinstance(error, TimeoutError) else ERR_LINK
+        mm[at] = DONE
+        if mm[CLIENT_WAITING]:
+            mm[CLIENT_WAITING] = 0
+            try:
+                conn.send(b'\x01')
+            except OSError:
+                pass
+        with done:
+            outstanding[0] -= 1
+            done.notify_all()
+
+
+def _open_ring(conn):
+    """Map the ring a client names in its first line: (mmap, slots, priority)"""
+    line = b''
+    while not line.endswith(b'\n'):
+        data = conn.recv(4096)
+        if not data:
+            raise ValueError("no ring path")
+        line += data
+    with open(line[:-1].decode(), 'r+b') as f:
+        mm = mmap.mmap(f.fileno(), 0)
+    magic, version, priority, slots, slot_size = HEADER.unpack_from(mm)
+    if magic != MAGIC or version != VERSION or slot_size != SLOT_SIZE or not slots \
+            or len(mm) < ring_size(slots) or priority not in (INTERACTIVE, BULK):
+        mm.close()
+        raise ValueError("not a ring")
+    return mm, slots, priority
+
+
+class RingClient:
+    """A producer's ring: submit() images, result() their digits in order"""
+
+    def __init__(self, sock, mm, slots):
+        self.sock = sock
+        self.mm = mm
+        self.slots = slots
+        self.head = 0   # images submitted
+        self.tail = 0   # results read
+
+    @classmethod
+    def connect(cls, path, slots=DEFAULT_SLOTS, priority=BULK):
+        sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        sock.connect(path)
+        folder = '/dev/shm' if os.path.isdir('/dev/shm') else None
+        fd, ring = tempfile.mkstemp(prefix='stm32dc-ring-', dir=folder)
+        try:
+            os.ftruncate(fd, ring_size(slots))
+            mm = mmap.mmap(fd, ring_size(slots))
+            HEADER.pack_into(mm, 0, MAGIC, VERSION, priority, slots, SLOT_SIZE)
+            sock.sendall(ring.encode() + b'\n')
+            reply = sock.makefile('rb').readline()
+        finally:
+            os.close(fd)
+            os.unlink(ring)
+        if reply != b'ok\n':
+            mm.close()
+            sock.close()
+            raise ConnectionError(f"ring refused: {reply.decode().strip() or 'connection closed'}")
+        sock.settimeout(WAKE_TIMEOUT)
+        return cls(sock, mm, slots)
+
+    def close(self):
+        self.sock.close()
+        self.mm.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    @property
+    def free(self):
+        return self.slots - (self.head - self.tail)
+
+    def submit(self, image):
+        """Queue one 784 B image; False if every slot holds one not read yet"""
+        if not self.free:
+            return False
+        at = HEADER_SIZE + self.head % self.slots * SLOT_SIZE
+        self.mm[at + SLOT_HEAD:at + SLOT_SIZE] = image
+        self.mm[at] = READY
+        self.head += 1
+        if self.mm[SERVICE_WAITING]:
+            self.mm[SERVICE_WAITING] = 0
+            self.sock.send(b'\x01')
+        return True
+
+    def result(self):
+        """Digit of the oldest image not read yet, None if blank; raises what the request failed with"""
+        if self.head == self.tail:
+            raise ValueError("no image submitted")
+        at = HEADER_SIZE + self.tail % self.slots * SLOT_SIZE
+        mm = self.mm
+        while mm[at] != DONE:
+            mm[CLIENT_WAITING] = 1
+            if mm[at] != DONE:
+                try:
+                    if not self.sock.recv(256):
+                        raise ConnectionError("service closed the ring")
+                except socket.timeout:
+                    pass
+        mm[CLIENT_WAITING] = 0
+        digit, error = mm[at + 1], mm[at + 2]
+        mm[at] = EMPTY
+        self.tail += 1
+        if error == ERR_TIMEOUT:
+            raise TimeoutError("No response from STM32")
+        if error == ERR_LINK:
+            raise ConnectionError("Link error")
+        if error != protocol.ERR_NONE:
+            raise DeviceError(error)
+        return None if digit == protocol.CLASS_NONE else digit
+
+    def classify_many(self, images):
+        """Digits of images in order, None for those that failed or were blank; keeps the ring full"""
+        for image in images:
+            while not self.submit(image):
+                yield self._result()
+        while self.tail != self.head:
+            yield self._result()
+
+    def _result(self):
+        try:
+            return self.result()
+        except (DeviceError, TimeoutError, ConnectionError):
+            return None
+
+
+def main(argv=None):
+    from .bench import synthetic_images
+    from .dataset import Dataset
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--socket', required=True, help="the service's --shm socket")
+    parser.add_argument('--images', help="IDX or .npy file of 28x28 uint8 images (default: generated)")
+    parser.add_argument('--count', type=int, default=10000)
+    parser.add_argument('--slots', type=int, default=DEFAULT_SLOTS)
+    parser.add_argument('--interactive', action='store_true', help="the interactive lane instead of bulk")
+    args = parser.parse_args(argv)
+
+    images = Dataset(args.images)[:args.count] if args.images else synthetic_images(args.count)
+    with RingClient.connect(args.socket, args.slots, INTERACTIVE if args.interactive else BULK) as ring:
+        start = time.perf_counter()
+        answered = sum(digit is not None for digit in ring.classify_many(images))
+        elapsed = time.perf_counter() - start
+    print(f"{len(images)} images in {elapsed:.2f} s, {len(images) / elapsed:.0f} images/s, "
+          f"{answered} answered")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
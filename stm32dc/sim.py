@@ -0,0 +1,184 @@
+"""Cycle counts of the firmware in Renode, for tracking its performance without a board.
+
+    python -m stm32dc.sim --elf tinyML/Sim/tinyML.elf                       # stages and layers
+    python -m stm32dc.sim --elf tinyML/Sim/tinyML.elf --save sim.json      # the baseline
+    python -m stm32dc.sim --elf tinyML/Sim/tinyML.elf --against sim.json   # exit 1 on a regression
+    python -m stm32dc.sim --attach tcp://localhost:3456                    # Renode already running
+
+Renode runs tinyML/renode/tinyml.resc on an APP_SIM=1 build, with USART2
+on a TCP port that is a tcp:// bridge to the rest of stm32dc (bench,
+evaluate and the GUI take it too). The simulated core executes one
+instruction per cycle and its DWT counts at the same clock, so the
+cycles the firmware reports are instruction counts: CLASSIFY_PROF gives
+them per stage (preprocessing, network run, argmax) and, with
+APP_PROFILE_LAYERS, PROFILE per layer. They ignore flash wait states and
+pipeline stalls, so they are not a board's figures, but an unchanged
+image gives the same count on every run, and a change to a kernel, the
+compiler flags or the model shows in them to the instruction.
+
+--save writes the figures as JSON; --against compares with such a file
+and flags every stage or layer more than --tolerance slower, for a
+pre-merge check. --db also records them in a stm32dc.perfdb history.
+"""
+import argparse
+import json
+import os
+import socket
+import statistics
+import subprocess
+import sys
+import time
+from typing import NamedTuple
+
+from .link import ClassifierLink, DeviceError, DEFAULT_BAUD
+
+RESC = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), 'tinyML', 'renode', 'tinyml.resc')
+PORT = 3456
+# Seconds for Renode to start and the firmware to answer PING
+BOOT_TIMEOUT = 60.0
+# The simulated link moves bytes instantly, but the simulation runs slower than a board
+REPLY_TIMEOUT = 30.0
+COUNT = 10
+TOLERANCE = 0.02
+STAGES = ('pre', 'run', 'argmax')
+
+
+class SimResult(NamedTuple):
+    stages: dict        # stage -> median cycles over the images
+    layers: dict        # layer -> cycles of the last inference, empty without APP_PROFILE_LAYERS
+    cpu_hz: int
+
+    def lines(self):
+        out = [f"{'stage':<24}{'cycles':>12}"]
+        out += [f"{name:<24}{cycles:>12,}" for name, cycles in self.stages.items()]
+        if self.layers:
+            out.append(f"{'layer':<24}{'cycles':>12}")
+            out += [f"{name:<24}{cycles:>12,}" for name, cycles in self.layers.items()]
+        else:
+            out.append("layers: firmware without APP_PROFILE_LAYERS")
+        return out
+
+    def to_json(self):
+        return {'stages': dict(self.stages), 'layers': dict(self.layers), 'cpu_hz': self.cpu_hz}
+
+
+def launch(elf, port=PORT, renode='renode', log=None):
+    """Renode running tinyml.resc on elf, USART2 on localhost:port"""
+    script = f"$elf=@{os.path.abspath(elf)}; $port={port}; include @{RESC}"
+    out = open(log, 'w') if log else subprocess.DEVNULL
+    return subprocess.Popen([renode, '--disable-xwt', '--plain', '-e', script],
+                            stdout=out, stderr=subprocess.STDOUT)
+
+
+def connect(port, timeout=BOOT_TIMEOUT, process=None):
+    """ClassifierLink to the simulated board once its USART2 socket is up and it answers PING"""
+    from .bridge import TcpSerial
+
+    host, _, number = port[len('tcp://'):].rpartition(':')
+    deadline = time.monotonic() + timeout
+    while True:
+        if process is not None and process.poll() is not None:
+            raise ConnectionError(f"Renode exited with status {process.returncode}")
+        try:
+            socket.create_connection((host, int(number)), timeout=1.0).close()
+            break
+        except OSError:
+            if time.monotonic() > deadline:
+                raise ConnectionError(f"nothing listens on {port}") from None
+            time.sleep(0.2)
+    conn = TcpSerial(port, DEFAULT_BAUD, timeout=REPLY_TIMEOUT, write_timeout=REPLY_TIMEOUT)
+    link = ClassifierLink(conn)
+    link.probe(timeout=max(1.0, deadline - time.monotonic()))
+    return conn, link
+
+
+def measure(link, images):
+    """SimResult of classifying images one at a time"""
+    stages = {name: [] for name in STAGES}
+    cpu_hz = 0
+    for image in images:
+        _, profile = link.classify_profiled(image)
+        cpu_hz = profile.cpu_hz
+        for name in STAGES:
+            stages[name].append(round(getattr(profile, name) * cpu_hz / 1e6))
+    try:
+        layers = {name: round(us * cpu_hz / 1e6) for name, us in link.layer_profile()}
+    except DeviceError:
+        layers = {}
+    return SimResult({name: int(statistics.median(v)) for name, v in stages.items()}, layers, cpu_hz)
+
+
+def compare(baseline, result, tolerance=TOLERANCE):
+    """[(name, before, after, change)] of every stage and layer in both; and those beyond tolerance"""
+    rows = []
+    for group in ('stages', 'layers'):
+        before, after = baseline.get(group, {}), result.to_json()[group]
+        for name in before:
+            if name in after and before[name]:
+                rows.append((name, before[name], after[name], after[name] / before[name] - 1))
+    return rows, [r for r in rows if r[3] > tolerance]
+
+
+def main(argv=None):
+    from .bench import synthetic_images
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--elf', help="APP_SIM=1 firmware, Renode started with it")
+    source.add_argument('--attach', metavar='tcp://HOST:PORT', help="USART2 of a Renode already running")
+    parser.add_argument('--renode', default='renode', help="Renode executable")
+    parser.add_argument('--port', type=int, default=PORT, help="TCP port given to USART2")
+    parser.add_argument('--log', help="Renode's output to this file")
+    parser.add_argument('--count', type=int, default=COUNT, help="images classified")
+    parser.add_argument('--save', help="write the figures to this JSON file")
+    parser.add_argument('--against', help="compare with a --save file, exit 1 on a regression")
+    parser.add_argument('--tolerance', type=float, default=TOLERANCE, help="slowdown flagged, 0.02 = 2 %%")
+    parser.add_argument('--db', metavar='PATH', help="record the figures in this stm32dc.perfdb history")
+    parser.add_argument('--note', default='', help="with --db, a note stored with the run")
+    args = parser.parse_args(argv)
+
+    process = None
+    port = args.attach or f"tcp://localhost:{args.port}"
+    start = time.perf_counter()
+    try:
+        if args.elf:
+            process = launch(args.elf, args.port, args.renode, args.log)
+        conn, link = connect(port, process=process)
+        print(f"{args.elf or port}: answering after {time.perf_counter() - start:.1f} s")
+        try:
+            link.classify(synthetic_images(1)[0])  # the first inference sets up what the others reuse
+            result = measure(link, synthetic_images(args.count))
+            model_hash = link.caps.model_hash if link.caps else ''
+        finally:
+            conn.close()
+    finally:
+        if process is not None:
+            process.terminate()
+            process.wait()
+
+    for line in result.lines():
+        print(line)
+    if args.save:
+        with open(args.save, 'w') as f:
+            json.dump(result.to_json(), f, indent=1)
+    if args.db:
+        from . import perfdb
+
+        metrics = {f'stage.{name}': cycles for name, cycles in result.stages.items()}
+        metrics.update({f'layer.{name}': cycles for name, cycles in result.layers.items()})
+        run = perfdb.record(args.db, 'sim', metrics, model_hash=model_hash, note=args.note)
+        print(f"recorded run {run} in {args.db}")
+    if not args.against:
+        return 0
+    with open(args.against) as f:
+        baseline = json.load(f)
+    rows, regressions = compare(baseline, result, args.tolerance)
+    print(f"against {args.against}:")
+    for name, before, after, change in rows:
+        flag = "  REGRESSION" if change > args.tolerance else ""
+        print(f"{name:<24}{before:>12,} -> {after:>12,} {100 * change:+7.2f} %{flag}")
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
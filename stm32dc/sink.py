@@ -0,0 +1,248 @@
+"""Results of a long batch job, in input order, straight into .npy files.
+
+    with OrderedSink('labels.npy', len(images), scores='scores.npy') as sink:
+        job = score(pool, images, sink)
+    print(job.report())
+
+    labels = numpy.load('labels.npy', mmap_mode='r')
+
+    python -m stm32dc.sink --ports COM9 COM10 --images test-images.idx --out labels.npy --scores scores.npy
+
+A pool completes images in whatever order its boards and hedges answer.
+complete(index, ...) takes them in any order; results ahead of the first
+missing index wait in a reorder buffer and are written once every earlier
+one is in. The files are mapped, so committed rows go into the page cache
+and nothing of the job is held in RAM beyond that buffer. score() sends an
+image only when its index is within WINDOW of the committed prefix, which
+bounds the buffer, and a board that stalls holds the stream back by
+WINDOW images at most.
+
+The labels file is int8: the digit, BLANK where the device found none,
+FAILED where the request failed, and PENDING past `committed` (a job cut
+short leaves a valid prefix). The scores file is float32 N x 10, the
+network's probabilities from CLASSIFY_TOPK with k=10, NaN when failed. No
+numpy is needed to write either.
+"""
+import argparse
+import logging
+import mmap
+import os
+import struct
+import sys
+import threading
+import time
+from typing import NamedTuple
+
+from . import protocol
+from .link import DeviceError
+from .worker import BULK
+
+DEFAULT_WINDOW = 4096
+# Rows the mapping is flushed after, besides close()
+FLUSH_ROWS = 65536
+
+BLANK = -1
+FAILED = -2
+PENDING = -3
+
+CLASSES = protocol.TOPK_MAX
+NAN = struct.pack('<f', float('nan'))
+
+log = logging.getLogger(__name__)
+
+
+class NpyMap:
+    """A new .npy file of shape rows x row_shape, mapped for writing"""
+
+    def __init__(self, path, descr, rows, row_shape=()):
+        shape = (rows,) + tuple(row_shape)
+        header = f"{{'descr': '{descr}', 'fortran_order': False, 'shape': {shape!r}, }}"
+        # Magic, version, length, header: padded to a multiple of 64 bytes
+        size = 10 + len(header) + 1
+        header += ' ' * (-size % 64) + '\n'
+        self.offset = 10 + len(header)
+        self.row_size = int(descr[2:])  # '|i1', '<f4'
+        for n in row_shape:
+            self.row_size *= n
+        self.file = open(path, 'w+b')
+        self.file.write(b'\x93NUMPY\x01\x00' + struct.pack('<H', len(header)) + header.encode('latin1'))
+        self.file.truncate(self.offset + rows * self.row_size)
+        self.data = mmap.mmap(self.file.fileno(), 0) if rows else None
+
+    def __setitem__(self, row, value):
+        at = self.offset + row * self.row_size
+        self.data[at:at + self.row_size] = value
+
+    def fill(self, value):
+        """Every row to value, a row's bytes"""
+        if self.data is not None:
+            self.data[self.offset:] = value * ((len(self.data) - self.offset) // self.row_size)
+
+    def flush(self):
+        if self.data is not None:
+            self.data.flush()
+
+    def close(self):
+        if self.data is not None:
+            self.data.flush()
+            self.data.close()
+        self.file.close()
+
+
+class OrderedSink:
+    """Reorder buffer in front of mapped label and score files"""
+
+    def __init__(self, path, count, scores=None, window=DEFAULT_WINDOW):
+        self.count = count
+        self.window = window
+        self.labels = NpyMap(path, '|i1', count)
+        self.labels.fill(struct.pack('b', PENDING))
+        self.scores = NpyMap(scores, '<f4', count, (CLASSES,)) if scores else None
+        self.pending = {}        # index -> (label, scores) ahead of committed
+        self.committed = 0       # rows written, every index below it
+        self.flushed = 0
+        self.closed = False
+        self.cond = threading.Condition()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def reserve(self, index, timeout=None):
+        """Block until index is within window of the committed prefix; False on timeout"""
+        with self.cond:
+            return self.cond.wait_for(lambda: index < self.committed + self.window, timeout)
+
+    def complete(self, index, label, scores=None):
+        """Result of image index, in any order: a digit, BLANK or FAILED, and 10 probabilities"""
+        row = struct.pack(f'<{CLASSES}f', *scores) if scores is not None else NAN * CLASSES
+        with self.cond:
+            if self.closed or index < self.committed or index in self.pending:
+                return
+            self.pending[index] = (label, row)
+            while self.committed in self.pending:
+                label, row = self.pending.pop(self.committed)
+                self.labels[self.committed] = struct.pack('b', label)
+                if self.scores is not None:
+                    self.scores[self.committed] = row
+                self.committed += 1
+            if self.committed - self.flushed >= FLUSH_ROWS:
+                self.labels.flush()
+                if self.scores is not None:
+                    self.scores.flush()
+                self.flushed = self.committed
+            self.cond.notify_all()
+
+    def join(self, timeout=None):
+        """Wait until every row is committed; False on timeout"""
+        with self.cond:
+            return self.cond.wait_for(lambda: self.committed == self.count, timeout)
+
+    def close(self):
+        """Unmap the files; results of requests still out when a job is cut short are dropped"""
+        with self.cond:
+            self.closed = True
+            self.labels.close()
+            if self.scores is not None:
+                self.scores.close()
+
+
+class JobResult(NamedTuple):
+    count: int
+    answered: int        # digits
+    blank: int
+    failed: int
+    elapsed: float
+
+    def report(self):
+        rate = self.count / self.elapsed if self.elapsed else 0.0
+        return (f"{self.count} images in {self.elapsed:.1f} s, {rate:.0f} images/s: "
+                f"{self.answered} digits, {self.blank} blank, {self.failed} failed")
+
+
+def score(backend, images, sink, priority=BULK, sent=None):
+    """Every image through a DevicePool, DynamicBatcher or LinkWorker into sink, window bounded
+
+    images may be any iterable of sink.count items; one that is None (it
+    could not be read) is recorded FAILED without a request. sent(), if
+    given, is called once per image taken from it.
+    """
+    counts = {'digit': 0, BLANK: 0, FAILED: 0}
+    lock = threading.Lock()
+
+    def done(index, future):
+        scores = None
+        try:
+            result = future.result()
+            if sink.scores is not None:
+                scores = [0.0] * CLASSES
+                for digit, probability in result:
+                    scores[digit] = probability
+                result = result[0][0] if result else None
+            label = BLANK if result is None else result
+        except (DeviceError, TimeoutError, ConnectionError):
+            label = FAILED
+        except Exception as e:
+            # Cancelled by a closing backend or anything else: still a row, or join() never returns
+            log.warning("image %d: %r", index, e)
+            label, scores = FAILED, None
+        with lock:
+            counts[label if label < 0 else 'digit'] += 1
+        sink.complete(index, label, scores)
+
+    start = time.perf_counter()
+    for index, image in enumerate(images):
+        sink.reserve(index)
+        if sent is not None:
+            sent()
+        if image is None:
+            with lock:
+                counts[FAILED] += 1
+            sink.complete(index, FAILED)
+            continue
+        if sink.scores is not None:
+            future = backend.classify_topk(image, CLASSES, priority=priority)
+        else:
+            future = backend.classify(image, priority=priority)
+        future.add_done_callback(lambda f, index=index: done(index, f))
+    sink.join()
+    return JobResult(sink.count, counts['digit'], counts[BLANK], counts[FAILED], time.perf_counter() - start)
+
+
+def main(argv=None):
+    from .batcher import DynamicBatcher
+    from .dataset import Dataset
+    from .pool import DevicePool
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--ports', nargs='+', required=True, metavar='PORT')
+    parser.add_argument('--baud', type=int, default=921600)
+    parser.add_argument('--rtscts', action='store_true')
+    parser.add_argument('--images', required=True, help="IDX or .npy file of 28x28 uint8 images")
+    parser.add_argument('--count', type=int, help="only the first COUNT images")
+    parser.add_argument('--out', required=True, metavar='LABELS.npy')
+    parser.add_argument('--scores', metavar='SCORES.npy', help="also the 10 probabilities (CLASSIFY_TOPK)")
+    parser.add_argument('--window', type=int, default=DEFAULT_WINDOW,
+                        help="images the stream may run ahead of the oldest unanswered one")
+    parser.add_argument('--batch', type=int, default=0, metavar='N',
+                        help="BATCH frames of up to N images (DynamicBatcher), not with --scores")
+    args = parser.parse_args(argv)
+    if args.batch and args.scores:
+        parser.error("--scores needs CLASSIFY_TOPK, which BATCH frames do not carry")
+
+    images = Dataset(args.images)[:args.count]
+    if args.batch:
+        backend = DynamicBatcher.open(args.ports, args.baud, args.batch, rtscts=args.rtscts)
+    else:
+        backend = DevicePool.open(args.ports, args.baud, rtscts=args.rtscts)
+    with backend, OrderedSink(args.out, len(images), args.scores, args.window) as sink:
+        job = score(backend, images, sink)
+    print(job.report())
+    print(f"wrote {os.path.abspath(args.out)}" + (f" and {os.path.abspath(args.scores)}" if args.scores else ""))
+    return 0 if job.failed < job.count else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
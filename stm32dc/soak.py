@@ -0,0 +1,334 @@
+"""Soak test: boards driven flat out for hours, drift and stalls flagged as they show.
+
+    python -m stm32dc.soak --ports COM9 COM10 --hours 4 --out soak.csv
+    python -m stm32dc.soak --ports auto --minutes 10 --sample 10     # before a release
+    python main.py --soak 120                                        # the GUI too, in live mode
+
+Every board keeps as many CLASSIFY requests in flight as it has credits,
+round the images (--images, else synthetic ones) until the time is up.
+Every --sample seconds SoakMonitor takes a Sample from what the workers
+already count: answers per second, p50/p95/p99 round trip (of the last
+LinkWorker.ROUND_TRIPS_KEEP answers of the interval), timeouts, resends
+and reconnects; a BULK STATS from each board (inferences, error
+counters, boots); the process's resident memory; and any probes given,
+such as the GUI canvas's Tk item count. Each sample is a CSV row and a
+line on stdout.
+
+The first BASELINE samples after WARMUP set the baseline; from then on a
+sample is checked and every new finding printed as it appears:
+
+    stall       a board answered nothing, or its STATS went unanswered
+    throughput  answers/s below THROUGHPUT_DROP of baseline, SUSTAIN samples running
+    latency     p95 above LATENCY_RISE times baseline, SUSTAIN samples running
+    growth      RSS, or a probe, rising faster than its GROWTH per hour
+                (least squares over the samples since warm-up, once they span GROWTH_SPAN)
+    reset       a board booted again (its boots counter grew)
+    reconnect   a port was lost and reopened
+    device      inference failures or dropped frames on a board
+
+The exit status is 1 if anything was flagged, so a release gate can run it.
+"""
+import argparse
+import csv
+import os
+import statistics
+import sys
+import threading
+import time
+from typing import NamedTuple
+
+from .link import DEFAULT_BAUD, DeviceError
+from .worker import BULK
+
+SAMPLE = 60.0
+WARMUP = 1          # samples skipped before the baseline: caches, clocks and pacing settle
+BASELINE = 3        # samples averaged into it
+SUSTAIN = 2         # consecutive samples a throughput or latency finding needs
+THROUGHPUT_DROP = 0.8
+LATENCY_RISE = 1.5
+LATENCY_FLOOR = 0.001  # seconds of p95 rise too small to flag whatever the ratio
+# Growth per hour flagged, by sampled quantity
+GROWTH = {'rss_mb': 10.0, 'tk_items': 100.0}
+# Seconds of samples a slope needs first: a few minutes of caches filling are not a leak
+GROWTH_SPAN = 600.0
+STATS_TIMEOUT = 5.0
+
+
+def rss_bytes():
+    """Resident set size of this process, None where it cannot be read"""
+    if sys.platform == 'win32':
+        import ctypes
+        from ctypes import wintypes
+
+        class Counters(ctypes.Structure):
+            _fields_ = [('cb', wintypes.DWORD), ('PageFaultCount', wintypes.DWORD)] + \
+                [(name, ctypes.c_size_t) for name in (
+                    'PeakWorkingSetSize', 'WorkingSetSize', 'QuotaPeakPagedPoolUsage', 'QuotaPagedPoolUsage',
+                    'QuotaPeakNonPagedPoolUsage', 'QuotaNonPagedPoolUsage', 'PagefileUsage', 'PeakPagefileUsage')]
+
+        counters = Counters()
+        counters.cb = ctypes.sizeof(counters)
+        process = ctypes.windll.kernel32.GetCurrentProcess()
+        if not ctypes.windll.psapi.GetProcessMemoryInfo(process, ctypes.byref(counters), counters.cb):
+            return None
+        return counters.WorkingSetSize
+    try:
+        with open('/proc/self/statm') as f:
+            return int(f.read().split()[1]) * os.sysconf('SC_PAGE_SIZE')
+    except (OSError, ValueError, IndexError):
+        return None
+
+
+class Sample(NamedTuple):
+    elapsed: float              # seconds since the soak started
+    rate: float                 # answers per second, all boards
+    p50_ms: float
+    p95_ms: float
+    p99_ms: float
+    timeouts: int               # in the interval, all boards
+    retransmits: int
+    reconnects: int
+    silent: tuple               # ports that answered nothing
+    inferences: int             # device counters' growth, all boards that answered STATS
+    device_errors: int          # inference failures and dropped frames
+    resets: tuple               # ports whose boots counter grew
+    wedged: tuple               # ports whose STATS went unanswered
+    rss_mb: float
+    probes: dict                # name -> value
+
+    def line(self):
+        probes = "".join(f"  {name} {value:g}" for name, value in self.probes.items())
+        flags = "".join(f"  {label} {','.join(ports)}" for label, ports in
+                        (('silent', self.silent), ('reset', self.resets), ('wedged', self.wedged)) if ports)
+        return (f"{self.elapsed / 60:7.1f} min {self.rate:8.1f} img/s  p50 {self.p50_ms:6.2f}  "
+                f"p95 {self.p95_ms:6.2f}  p99 {self.p99_ms:6.2f} ms  timeouts {self.timeouts}  "
+                f"resent {self.retransmits}  device errors {self.device_errors}  "
+                f"rss {self.rss_mb:.1f} MB{probes}{flags}")
+
+
+def _quantile(sorted_values, fraction):
+    if not sorted_values:
+        return 0.0
+    return sorted_values[min(len(sorted_values) - 1, int(fraction * len(sorted_values)))]
+
+
+def _slope_per_hour(points):
+    """Least squares slope of [(seconds, value)], per hour; 0 with fewer than 3 points"""
+    if len(points) < 3:
+        return 0.0
+    xs, ys = zip(*points)
+    mx, my = statistics.fmean(xs), statistics.fmean(ys)
+    var = sum((x - mx) ** 2 for x in xs)
+    if not var:
+        return 0.0
+    return sum((x - mx) * (y - my) for x, y in points) / var * 3600
+
+
+class SoakMonitor:
+    """Samples the workers of a soak and checks each sample against the baseline
+
+    workers is {port: LinkWorker}, probes {name: () -> number}, read from
+    the sampling thread (a GUI probe returns a value its own thread keeps).
+    """
+
+    def __init__(self, workers, probes=None, out=None):
+        self.workers = workers
+        self.probes = probes or {}
+        self.writer = None
+        self.file = None
+        if out:
+            self.file = open(out, 'w', newline='')
+            self.writer = csv.writer(self.file)
+            self.writer.writerow(list(Sample._fields[:-1]) + list(self.probes))
+        self.start = time.monotonic()
+        self.last = self._counters()
+        self.last_at = time.perf_counter()
+        self.stats = {}               # port -> last protocol.Stats
+        self._poll_stats()
+        self.samples = []
+        self.findings = []            # (elapsed, kind, detail), in the order found
+        self.seen = set()             # (kind, subject) already reported
+        self.streaks = {'throughput': 0, 'latency': 0}
+
+    def _counters(self):
+        return {port: (w.answered, w.timeouts, w.retransmits, w.reconnects) for port, w in self.workers.items()}
+
+    def _poll_stats(self):
+        """{port: Stats} of every board at once, None for those that did not answer"""
+        futures = {port: w.stats(priority=BULK) for port, w in self.workers.items()}
+        result = {}
+        for port, future in futures.items():
+            try:
+                result[port] = future.result(STATS_TIMEOUT)
+            except DeviceError:
+                result[port] = False  # no APP_STATS: nothing to compare, not a wedge
+            except Exception:
+                result[port] = None
+        return result
+
+    def sample(self):
+        """Take a Sample, check it; returns it and the findings it added"""
+        now = time.perf_counter()
+        counters = self._counters()
+        rtts = sorted(rtt for w in self.workers.values() for at, rtt in list(w.round_trips) if at > self.last_at)
+        span = max(now - self.last_at, 1e-3)
+        delta = {port: tuple(b - a for a, b in zip(self.last[port], counters[port])) for port in counters}
+        self.last, self.last_at = counters, now
+
+        stats = self._poll_stats()
+        inferences = device_errors = 0
+        resets, wedged = [], []
+        for port, s in stats.items():
+            if s is None:
+                wedged.append(port)
+                continue
+            before = self.stats.get(port)
+            if s and before:
+                inferences += (s.inferences - before.inferences) & 0xFFFFFFFF
+                device_errors += ((s.err_inference - before.err_inference) & 0xFFFFFFFF) + \
+                    ((s.err_dropped - before.err_dropped) & 0xFFFFFFFF)
+                if s.boots != before.boots or s.uptime_ms < before.uptime_ms:
+                    resets.append(port)
+            if s:
+                self.stats[port] = s
+
+        rss = rss_bytes()
+        sample = Sample(time.monotonic() - self.start, sum(d[0] for d in delta.values()) / span,
+                        _quantile(rtts, 0.5) * 1e3, _quantile(rtts, 0.95) * 1e3, _quantile(rtts, 0.99) * 1e3,
+                        sum(d[1] for d in delta.values()), sum(d[2] for d in delta.values()),
+                        sum(d[3] for d in delta.values()),
+                        tuple(port for port, d in delta.items() if not d[0]),
+                        inferences, device_errors, tuple(resets), tuple(wedged),
+                        rss / 2 ** 20 if rss is not None else 0.0,
+                        {name: probe() for name, probe in self.probes.items()})
+        self.samples.append(sample)
+        if self.writer is not None:
+            self.writer.writerow([f"{v:.3f}" if isinstance(v, float) else ' '.join(v) if isinstance(v, tuple)
+                                  else v for v in sample[:-1]] + list(sample.probes.values()))
+            self.file.flush()
+        found = len(self.findings)
+        self._check(sample)
+        return sample, self.findings[found:]
+
+    def _flag(self, sample, kind, subject, detail):
+        if (kind, subject) in self.seen:
+            return
+        self.seen.add((kind, subject))
+        self.findings.append((sample.elapsed, kind, detail))
+
+    def _check(self, s):
+        for port in s.silent:
+            self._flag(s, 'stall', port, f"{port} answered nothing for a sample")
+        for port in s.wedged:
+            self._flag(s, 'stall', port, f"{port} did not answer STATS within {STATS_TIMEOUT:g} s")
+        for port in s.resets:
+            self._flag(s, 'reset', port, f"{port} booted again")
+        if s.reconnects:
+            self._flag(s, 'reconnect', s.elapsed, f"{s.reconnects} port(s) lost and reopened")
+        if s.device_errors:
+            self._flag(s, 'device', s.elapsed, f"{s.device_errors} inference failures or dropped frames")
+
+        base = self.samples[WARMUP:WARMUP + BASELINE]
+        if len(self.samples) <= WARMUP + BASELINE:
+            return
+        rate = statistics.fmean(b.rate for b in base)
+        p95 = statistics.fmean(b.p95_ms for b in base)
+        slow = s.rate < THROUGHPUT_DROP * rate
+        late = s.p95_ms > LATENCY_RISE * p95 and s.p95_ms - p95 > LATENCY_FLOOR * 1e3
+        for kind, bad, detail in (
+                ('throughput', slow, f"{s.rate:.1f} img/s against a baseline of {rate:.1f}"),
+                ('latency', late, f"p95 {s.p95_ms:.2f} ms against a baseline of {p95:.2f} ms")):
+            self.streaks[kind] = self.streaks[kind] + 1 if bad else 0
+            if self.streaks[kind] >= SUSTAIN:
+                self._flag(s, kind, None, detail)
+
+        since = self.samples[WARMUP:]
+        if since[-1].elapsed - since[0].elapsed < GROWTH_SPAN:
+            return
+        series = {'rss_mb': [(x.elapsed, x.rss_mb) for x in since]}
+        for name in s.probes:
+            series[name] = [(x.elapsed, x.probes[name]) for x in since]
+        for name, points in series.items():
+            limit = GROWTH.get(name)
+            slope = _slope_per_hour(points)
+            if limit is not None and slope > limit:
+                self._flag(s, 'growth', name, f"{name} rising {slope:.1f}/h, more than {limit:g}/h")
+
+    def close(self):
+        if self.file is not None:
+            self.file.close()
+            self.file = None
+
+    def report(self):
+        lines = [f"{len(self.samples)} samples over {(time.monotonic() - self.start) / 60:.1f} min"]
+        if not self.findings:
+            lines.append("no drift, stall or reset found")
+        for elapsed, kind, detail in self.findings:
+            lines.append(f"{elapsed / 60:7.1f} min  {kind:<11} {detail}")
+        return "\n".join(lines)
+
+
+def drive(worker, images, stop, depth=None):
+    """Keep depth (the worker's credits) CLASSIFYs in flight, round images, until stop is set"""
+    slots = threading.Semaphore(depth or worker.max_in_flight)
+    n = 0
+    while not stop.is_set():
+        if not slots.acquire(timeout=0.1):
+            continue
+        future = worker.classify(images[n % len(images)], priority=BULK)
+        future.add_done_callback(lambda f: slots.release())
+        n += 1
+
+
+def main(argv=None):
+    from . import timers
+    from .bench import load_images, synthetic_images
+    from .pool import DevicePool
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--ports', nargs='+', required=True, metavar='PORT', help="or auto, uid:PREFIX")
+    parser.add_argument('--baud', type=int, default=DEFAULT_BAUD)
+    parser.add_argument('--rtscts', action='store_true')
+    length = parser.add_mutually_exclusive_group()
+    length.add_argument('--hours', type=float)
+    length.add_argument('--minutes', type=float)
+    parser.add_argument('--sample', type=float, default=SAMPLE, help="seconds between samples")
+    parser.add_argument('--images', help="IDX or .npy images (default: synthetic)")
+    parser.add_argument('--depth', type=int, help="requests in flight per board (default: its credits)")
+    parser.add_argument('--out', help="CSV of every sample")
+    args = parser.parse_args(argv)
+
+    duration = 3600 * args.hours if args.hours else 60 * (args.minutes or 60)
+    images = [bytes(img) for img in load_images(args.images)] if args.images else synthetic_images(256)
+    timers.hold_resolution()
+    pool = DevicePool.open(args.ports, args.baud, rtscts=args.rtscts, hedge=False)
+    stop = threading.Event()
+    monitor = None
+    try:
+        workers = {m.port: m.worker for m in pool.members}
+        monitor = SoakMonitor(workers, out=args.out)
+        threads = [threading.Thread(target=drive, args=(w, images, stop, args.depth), daemon=True)
+                   for w in workers.values()]
+        for t in threads:
+            t.start()
+        print(f"soaking {', '.join(workers)} for {duration / 60:.0f} min, a sample every {args.sample:g} s")
+        end = time.monotonic() + duration
+        while time.monotonic() < end:
+            time.sleep(min(args.sample, max(0.0, end - time.monotonic())))
+            sample, found = monitor.sample()
+            print(sample.line())
+            for elapsed, kind, detail in found:
+                print(f"  !! {kind}: {detail}")
+    except KeyboardInterrupt:
+        pass
+    finally:
+        stop.set()
+        pool.close()
+        if monitor is not None:
+            monitor.close()
+    print(monitor.report())
+    return 1 if monitor.findings else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
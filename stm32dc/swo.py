@@ -0,0 +1,297 @@
+"""Chrome trace / Perfetto timeline from an APP_ITM_TRACE SWO capture.
+
+    python -m stm32dc.swo swo.bin -o trace.json
+    python -m stm32dc.swo --tcp localhost:3344 -o trace.json
+
+The capture is the raw NRZ byte stream of PB3 at APP_ITM_TRACE_BAUD, e.g.
+from OpenOCD (stm32f4x.tpiu configure -protocol uart -output swo.bin
+-traceclk 96000000 -pin-freq 2000000; stm32f4x.tpiu enable) or any USB-UART
+on the pin. With --tcp the stream is read until Ctrl-C. Open the output in
+chrome://tracing or ui.perfetto.dev: one track per span the firmware traces
+(trace.h), network layers nested in the run, USART2 bursts and parser
+states as instants on the receive tracks.
+
+With APP_PROFILE_COUNTERS each c-node also carries its DWT event counts
+(CPI, exception, sleep, LSU and folded instruction events) as slice args,
+and --counters prints their mean per node. The device only sees them
+modulo 256; here the counters' overflow packets between the snapshots at
+the node's edges count the wraps. Wraps lost to an ITM overflow make the
+counts of that node short: raise APP_ITM_TRACE_BAUD if it warns.
+"""
+import argparse
+import json
+import socket
+import sys
+from typing import NamedTuple
+
+# Stimulus ports of trace.h
+PORT_RX = 0
+PORT_RUN = 1
+PORT_TX = 2
+PORT_FRAME = 3
+PORT_LAYER = 4
+PORT_BURST = 5
+PORT_STATE = 6
+PORT_CLOCK = 7
+PORT_COUNTERS = 8
+# Hardware source packets, past the 32 stimulus ports
+PORT_DWT_EVENTS = 32   # DWT event counter wraps, bit per counter
+PORT_OVERFLOW = 33     # the ITM dropped packets
+
+PH_MARK, PH_BEGIN, PH_END = 0, 1, 2
+
+LINKS = ('usart2', 'usb', 'spi', 'usart1', 'usart6')
+STATES = ('sync0', 'sync1', 'header', 'payload', 'crc')
+# DWT counters in the snapshot word's byte order and the event packet's bit order
+COUNTERS = ('cpi', 'exc', 'sleep', 'lsu', 'fold')
+
+# Chrome trace thread ids
+TID_RUN, TID_FRAME, TID_TX, TID_RX = 1, 2, 3, 10
+
+
+class Event(NamedTuple):
+    cycles: int      # timestamp, HCLK cycles since the first packet
+    us: float        # the same in microseconds, through the traced clock changes
+    port: int
+    value: int
+
+
+def _continued(data, i, limit):
+    """(value, next index) of up to limit 7-bit continuation bytes at i"""
+    value, shift = 0, 0
+    for _ in range(limit):
+        if i >= len(data):
+            return None, i
+        b = data[i]
+        i += 1
+        value |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            break
+    return value, i
+
+
+def decode(data, mhz=96.0):
+    """Software source, DWT event counter and overflow packets of an ITM byte stream,
+    timed by the local timestamps
+
+    A timestamp packet gives the cycles since the previous one and times the
+    packets queued since. CLOCK marks rescale the cycles to microseconds.
+    """
+    events, pending = [], []
+    cycles, us = 0, 0.0
+    i = 0
+
+    def stamp(delta):
+        nonlocal cycles, us, mhz
+        cycles += delta
+        us += delta / mhz
+        for port, value in pending:
+            events.append(Event(cycles, us, port, value))
+            if port == PORT_CLOCK and value & 0x3FFF:
+                mhz = float(value & 0x3FFF)
+        pending.clear()
+
+    while i < len(data):
+        b = data[i]
+        i += 1
+        if b == 0x00:
+            # Synchronisation: zeros up to a 0x80
+            while i < len(data) and data[i] == 0x00:
+                i += 1
+            i += 1
+        elif b == 0x70:
+            # Overflow: packets were lost, what follows is still framed
+            pending.append((PORT_OVERFLOW, 0))
+        elif (b & 0x8F) == 0x00:
+            # Short local timestamp, 1-6 cycles
+            stamp((b >> 4) & 0x07)
+        elif (b & 0xCF) == 0xC0:
+            # Long local timestamp, TC in bits 5:4 says whether it was delayed
+            delta, i = _continued(data, i, 4)
+            if delta is None:
+                break
+            stamp(delta)
+        elif (b & 0x0B) == 0x08:
+            # Extension packet
+            if b & 0x80:
+                _, i = _continued(data, i, 4)
+        elif (b & 0xDF) == 0x94:
+            # Global timestamp, not enabled by the firmware
+            _, i = _continued(data, i, 4)
+        elif b & 0x03:
+            size = (1, 2, 4)[(b & 0x03) - 1]
+            if i + size > len(data):
+                break
+            value = int.from_bytes(data[i:i + size], 'little')
+            i += size
+            if not b & 0x04:
+                pending.append((b >> 3, value))
+            elif b >> 3 == 0:
+                pending.append((PORT_DWT_EVENTS, value))
+    stamp(0)
+    return events
+
+
+class NodeCounters(NamedTuple):
+    c_idx: int
+    counts: dict     # COUNTERS -> events between the node's edges
+    lossy: bool      # an ITM overflow fell inside, counts may be short
+
+
+def node_counters(events):
+    """NodeCounters of every c-node span with a snapshot at both edges
+
+    A snapshot is a 32-bit word of the four lower counters and then the
+    phase with FOLDCNT. Every count is 256 times the wraps seen between
+    the two snapshot words plus the difference of their low bytes.
+    """
+    out, wraps = [], [0] * len(COUNTERS)
+    start, word, node, lossy = None, None, None, False
+    for ev in events:
+        if ev.port == PORT_DWT_EVENTS:
+            for k in range(len(COUNTERS)):
+                wraps[k] += ev.value >> k & 1
+        elif ev.port == PORT_OVERFLOW:
+            lossy = True
+        elif ev.port == PORT_LAYER and ev.value >> 14 == PH_BEGIN:
+            node = ev.value & 0x3FFF
+        elif ev.port == PORT_COUNTERS and word is None:
+            word = ([ev.value >> (8 * k) & 0xFF for k in range(4)], list(wraps))
+        elif ev.port == PORT_COUNTERS:
+            low, at = word
+            snap = (low + [ev.value & 0xFF], at)
+            word = None
+            if ev.value >> 14 == PH_BEGIN:
+                start, lossy = snap, False
+            elif start is not None and node is not None:
+                counts = {name: 256 * (snap[1][k] - start[1][k]) + snap[0][k] - start[0][k]
+                          for k, name in enumerate(COUNTERS)}
+                out.append(NodeCounters(node, counts, lossy))
+                start = None
+    return out
+
+
+def counters_report(nodes):
+    """Mean counts per c-node over every run in the capture"""
+    by_node = {}
+    for n in nodes:
+        by_node.setdefault(n.c_idx, []).append(n)
+    lines = [f"{'node':>4} {'runs':>5} " + ' '.join(f"{c:>9}" for c in COUNTERS)]
+    for c_idx in sorted(by_node):
+        runs = by_node[c_idx]
+        means = [sum(n.counts[c] for n in runs) / len(runs) for c in COUNTERS]
+        lossy = sum(n.lossy for n in runs)
+        lines.append(f"{c_idx:>4} {len(runs):>5} " + ' '.join(f"{m:>9.0f}" for m in means)
+                     + (f"  {lossy} run(s) hit an ITM overflow" if lossy else ""))
+    return '\n'.join(lines)
+
+
+def chrome_trace(events):
+    """Chrome trace event list for decoded ITM events"""
+    out, open_spans = [], set()
+    names = {TID_RUN: 'network', TID_FRAME: 'frame', TID_TX: 'usart2 tx'}
+
+    def span(base, name, ph, tid):
+        # The firmware raises a span again while it is up (each TX kick),
+        # as on the pins only the first begin and the first end count
+        key = (tid, name)
+        if (ph == 'B') == (key in open_spans):
+            return
+        if ph == 'B':
+            open_spans.add(key)
+        else:
+            open_spans.discard(key)
+        out.append(dict(base, name=name, ph=ph, tid=tid))
+
+    def rx_tid(link):
+        tid = TID_RX + link
+        names.setdefault(tid, f"rx {LINKS[link] if link < len(LINKS) else link}")
+        return tid
+
+    counted = node_counters(events)[::-1]
+
+    for ev in events:
+        phase, arg = ev.value >> 14, ev.value & 0x3FFF
+        base = {'ts': round(ev.us, 3), 'pid': 1}
+        ph = {PH_BEGIN: 'B', PH_END: 'E'}.get(phase)
+
+        if ev.port == PORT_RX and ph:
+            span(base, 'frame rx', ph, rx_tid(arg))
+        elif ev.port == PORT_RUN and ph:
+            span(base, 'run', ph, TID_RUN)
+        elif ev.port == PORT_LAYER and ph:
+            # Counted nodes end in trace order; the end slice's args merge into the node's
+            if ph == 'E' and counted and counted[-1].c_idx == arg:
+                found = counted.pop()
+                base = dict(base, args=dict(found.counts, lossy=found.lossy))
+            span(base, f"node {arg}", ph, TID_RUN)
+        elif ev.port == PORT_TX and ph:
+            span(base, 'tx', ph, TID_TX)
+        elif ev.port == PORT_FRAME and ph:
+            span(base, 'process', ph, TID_FRAME)
+        elif ev.port == PORT_BURST:
+            out.append(dict(base, name='burst', ph='i', s='t', tid=rx_tid(0),
+                            args={'bytes': arg}))
+        elif ev.port == PORT_STATE:
+            state = arg & 0x0F
+            out.append(dict(base, name=STATES[state] if state < len(STATES) else f"state {state}",
+                            ph='i', s='t', tid=rx_tid(arg >> 4)))
+        elif ev.port == PORT_CLOCK:
+            out.append(dict(base, name='HCLK', ph='C', tid=0, args={'MHz': arg}))
+
+    meta = [{'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': tid, 'args': {'name': name}}
+            for tid, name in names.items()]
+    meta.append({'name': 'process_name', 'ph': 'M', 'pid': 1, 'args': {'name': 'STM32F411'}})
+    return meta + out
+
+
+def read_tcp(address):
+    """Bytes from a TCP SWO server until it closes or Ctrl-C"""
+    host, _, port = address.rpartition(':')
+    chunks = []
+    with socket.create_connection((host or 'localhost', int(port))) as s:
+        try:
+            while True:
+                chunk = s.recv(65536)
+                if not chunk:
+                    break
+                chunks.append(chunk)
+        except KeyboardInterrupt:
+            pass
+    return b''.join(chunks)
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('capture', nargs='?', help="raw SWO capture, - for stdin")
+    ap.add_argument('--tcp', metavar='HOST:PORT', help="read the stream from a TCP SWO server")
+    ap.add_argument('--mhz', type=float, default=96.0,
+                    help="HCLK until the first clock mark (default %(default)s)")
+    ap.add_argument('-o', '--output', default='trace.json')
+    ap.add_argument('--counters', action='store_true',
+                    help="print the mean DWT event counts per c-node (APP_PROFILE_COUNTERS)")
+    args = ap.parse_args(argv)
+
+    if args.tcp:
+        data = read_tcp(args.tcp)
+    elif args.capture == '-':
+        data = sys.stdin.buffer.read()
+    elif args.capture:
+        with open(args.capture, 'rb') as f:
+            data = f.read()
+    else:
+        ap.error("give a capture file or --tcp")
+
+    events = decode(data, args.mhz)
+    with open(args.output, 'w', encoding='utf-8') as f:
+        json.dump({'traceEvents': chrome_trace(events), 'displayTimeUnit': 'ns'}, f)
+    span = events[-1].us - events[0].us if events else 0.0
+    print(f"{len(events)} events over {span / 1000:.1f} ms -> {args.output}")
+    if args.counters:
+        print(counters_report(node_counters(events)))
+    return 0 if events else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
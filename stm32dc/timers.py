@@ -0,0 +1,141 @@
+"""Sleeps that end on time on Windows, and the system tick the rest wait on.
+
+    from .timers import sleep_until
+    sleep_until(start + n / rate)    # open-loop load, capture replay
+
+    timers.hold_resolution()         # bench and the GUI, for the whole run
+
+    python -m stm32dc.timers                    # lateness of each way to wait
+    python -m stm32dc.timers --interval 5 --count 400
+
+Windows wakes a sleeping thread on its system tick, 15.6 ms unless some
+program asked for less: time.sleep(0.005) before Python 3.11 sleeps up to
+a tick, and every timed wait on a lock, event or overlapped read (Condition
+and Future timeouts, pyserial's read timeout, the worker's reader) wakes
+on one. The exe ships its own Python, so both matter.
+
+sleep_until(deadline) sleeps on a high-resolution waitable timer
+(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, Windows 10 1803 and later), which
+is what time.sleep does itself from 3.11 on. Where there is none, it
+sleeps on the tick to within SPIN of the deadline and yields the rest
+away. hold_resolution() asks for a 1 ms tick (timeBeginPeriod) until the
+process exits, for the timed waits a sleep cannot replace. Reading the
+port already blocks for the rest of a frame rather than polling, so
+nothing sleeps per frame on the receive side. Elsewhere time.sleep wakes
+within tens of microseconds and all of this is time.sleep and nothing.
+"""
+import argparse
+import atexit
+import ctypes
+import statistics
+import sys
+import threading
+import time
+
+WINDOWS = sys.platform == 'win32'
+# time.sleep is a high-resolution wait by itself
+NATIVE = not WINDOWS or sys.version_info >= (3, 11)
+# Without a high-resolution timer: the last part of a sleep, yielded away instead
+SPIN = 0.002
+
+CREATE_WAITABLE_TIMER_HIGH_RESOLUTION = 0x00000002
+TIMER_ALL_ACCESS = 0x1F0003
+INFINITE = 0xFFFFFFFF
+
+_local = threading.local()
+_held = []
+
+
+def _timer():
+    """This thread's high-resolution waitable timer, None where Windows has none"""
+    if not hasattr(_local, 'timer'):
+        kernel32 = ctypes.windll.kernel32
+        kernel32.CreateWaitableTimerExW.restype = ctypes.c_void_p
+        _local.timer = kernel32.CreateWaitableTimerExW(
+            None, None, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS) or None
+    return _local.timer
+
+
+def _timer_sleep(seconds):
+    """Sleep on the thread's waitable timer; False if there is none"""
+    timer = _timer()
+    if timer is None:
+        return False
+    kernel32 = ctypes.windll.kernel32
+    due = ctypes.c_longlong(-int(seconds * 1e7))  # relative, 100 ns units
+    if not kernel32.SetWaitableTimer(ctypes.c_void_p(timer), ctypes.byref(due), 0, None, None, False):
+        return False
+    kernel32.WaitForSingleObject(ctypes.c_void_p(timer), INFINITE)
+    return True
+
+
+def sleep_until(deadline):
+    """Sleep until time.perf_counter() reaches deadline"""
+    remaining = deadline - time.perf_counter()
+    if remaining <= 0:
+        return
+    if NATIVE:
+        time.sleep(remaining)
+        return
+    if _timer_sleep(remaining):
+        return
+    if remaining > SPIN:
+        time.sleep(remaining - SPIN)
+    while time.perf_counter() < deadline:
+        time.sleep(0)  # lets the reader threads have the GIL
+
+
+def sleep(seconds):
+    """time.sleep(seconds), ending on time"""
+    sleep_until(time.perf_counter() + seconds)
+
+
+def hold_resolution(ms=1):
+    """Ask Windows for an ms system tick until exit; once per process, nothing elsewhere"""
+    if not WINDOWS or _held:
+        return
+    winmm = ctypes.WinDLL('winmm')
+    if winmm.timeBeginPeriod(ms) == 0:  # TIMERR_NOERROR
+        _held.append(ms)
+        atexit.register(winmm.timeEndPeriod, ms)
+
+
+def _lateness(wait, interval, count):
+    """Milliseconds each wait(interval) overran interval by"""
+    late = []
+    for _ in range(count):
+        start = time.perf_counter()
+        wait(interval)
+        late.append((time.perf_counter() - start - interval) * 1e3)
+    return late
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--interval', type=float, default=5.0, help="ms each wait is for")
+    parser.add_argument('--count', type=int, default=200, help="waits per method")
+    parser.add_argument('--waits', type=int, default=1,
+                        help="waits a frame makes, to scale the lateness to a frame's")
+    args = parser.parse_args(argv)
+
+    event = threading.Event()
+    methods = [('time.sleep', time.sleep), ('Event.wait', event.wait), ('sleep_until', sleep)]
+    interval = args.interval / 1e3
+    print(f"{sys.platform}, Python {sys.version.split()[0]}, {args.count} waits of {args.interval:g} ms, "
+          f"{'time.sleep is high resolution' if NATIVE else 'time.sleep waits on the tick'}")
+    print(f"{'':25}{'mean':>8} {'p99':>8} {'max':>8}   per frame ({args.waits} waits)")
+    for tick in ('default tick', '1 ms tick'):
+        if tick == '1 ms tick':
+            if not WINDOWS:
+                break
+            hold_resolution()
+        for name, wait in methods:
+            late = sorted(_lateness(wait, interval, args.count))
+            mean = statistics.fmean(late)
+            print(f"{name:12} {tick:12}{mean:8.3f}{late[int(len(late) * 0.99)]:9.3f}{late[-1]:9.3f}"
+                  f"   {mean * args.waits:8.3f} ms late")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,156 @@
+"""Host span tracing to a Chrome trace / Perfetto timeline.
+
+    python main.py --trace host.json
+    python -m stm32dc.bench --port COM9 --pipeline --trace host.json
+
+    tracing.enable()
+    with tracing.span('preprocess'):
+        image = canvas.get_image_array()
+    ...
+    tracing.save('host.json')
+
+Open the file in ui.perfetto.dev or chrome://tracing. Spans are recorded
+per thread: the Tk thread's preprocess, submit and UI update, the link
+writer's encode and write, the reader's parse. Each request also gets a
+row of its own from submit() to its future resolving, split into the
+wait for credits, the time on the wire and in the device, and its decode.
+With a clocksync.ClockSync on the worker and APP_TIMESTAMPS, the device's
+stamps of the reply are mapped onto the same time axis as a second
+process: the request waiting in the ready queue and being processed,
+with its network time as an argument.
+
+Nothing is recorded until enable(): span() then hands out a shared no-op
+context and the instrumented code pays a function call. Events are kept
+in memory, the newest LIMIT of them.
+"""
+import contextlib
+import itertools
+import json
+import threading
+import time
+from collections import deque
+
+# Events kept, about 100 bytes each
+LIMIT = 1000000
+HOST_PID = 1
+DEVICE_PID = 2
+DEVICE_TID = 1
+
+_NULL = contextlib.nullcontext()
+
+
+class Tracer:
+    """Spans in memory, as Chrome trace events"""
+
+    def __init__(self, limit=LIMIT):
+        self.events = deque(maxlen=limit)
+        self.lock = threading.Lock()
+        self.origin = time.perf_counter()
+        self.threads = {}                  # thread ident -> (tid, name)
+        self.ids = itertools.count(1)      # async row ids of requests
+
+    def us(self, t):
+        """Trace microseconds of a perf_counter() time"""
+        return round((t - self.origin) * 1e6, 3)
+
+    def _tid(self):
+        ident = threading.get_ident()
+        entry = self.threads.get(ident)
+        if entry is None:
+            with self.lock:
+                entry = self.threads.setdefault(ident, (len(self.threads) + 1,
+                                                        threading.current_thread().name))
+        return entry[0]
+
+    def complete(self, name, start, end, args=None, pid=HOST_PID, tid=None):
+        """A span from start to end, perf_counter() seconds, on the calling thread by default"""
+        event = {'name': name, 'ph': 'X', 'ts': self.us(start), 'dur': round((end - start) * 1e6, 3),
+                 'pid': pid, 'tid': self._tid() if tid is None else tid}
+        if args:
+            event['args'] = args
+        self.events.append(event)
+
+    @contextlib.contextmanager
+    def span(self, name, **args):
+        start = time.perf_counter()
+        try:
+            yield
+        finally:
+            self.complete(name, start, time.perf_counter(), args)
+
+    def instant(self, name, **args):
+        event = {'name': name, 'ph': 'i', 's': 't', 'ts': self.us(time.perf_counter()), 'pid': HOST_PID,
+                 'tid': self._tid()}
+        if args:
+            event['args'] = args
+        self.events.append(event)
+
+    def steps(self, name, times, args=None, pid=HOST_PID, cat='request'):
+        """An async row: name over the whole of times, each (step, start, end) nested in it"""
+        row = next(self.ids)
+        start, end = times[0][1], times[-1][2]
+        for step, (ph_start, ph_end) in [(name, (start, end))] + [(s, (a, b)) for s, a, b in times]:
+            begin = {'name': step, 'cat': cat, 'ph': 'b', 'id': row, 'ts': self.us(ph_start), 'pid': pid}
+            if args and step == name:
+                begin['args'] = args
+            self.events.append(begin)
+            self.events.append({'name': step, 'cat': cat, 'ph': 'e', 'id': row, 'ts': self.us(ph_end),
+                                'pid': pid})
+
+    def request(self, name, queued, sent, received, parsed, clock=None, stamp=None, error=None):
+        """A worker request's row, and the device's side of it when stamped"""
+        args = {'error': str(error)} if error is not None else None
+        self.steps(name, [('credits', queued, sent), ('wire + device', sent, received),
+                          ('decode', received, parsed)], args)
+        if clock is None or stamp is None or not clock.synced:
+            return
+        rx, start, tx = (clock.to_host(us) for us in (stamp.rx_us, stamp.start_us, stamp.tx_us))
+        self.steps(name, [('ready queue', rx, start)], pid=DEVICE_PID, cat='device')
+        self.complete(f"{name} process", start, tx, {'run_us': stamp.run_us}, DEVICE_PID, DEVICE_TID)
+
+    def chrome_trace(self):
+        meta = [{'name': 'process_name', 'ph': 'M', 'pid': HOST_PID, 'args': {'name': 'host'}},
+                {'name': 'process_name', 'ph': 'M', 'pid': DEVICE_PID, 'args': {'name': 'STM32F411'}},
+                {'name': 'thread_name', 'ph': 'M', 'pid': DEVICE_PID, 'tid': DEVICE_TID,
+                 'args': {'name': 'main loop'}}]
+        meta += [{'name': 'thread_name', 'ph': 'M', 'pid': HOST_PID, 'tid': tid, 'args': {'name': name}}
+                 for tid, name in list(self.threads.values())]
+        return meta + list(self.events)
+
+    def save(self, path):
+        with open(path, 'w', encoding='utf-8') as f:
+            json.dump({'traceEvents': self.chrome_trace(), 'displayTimeUnit': 'ns'}, f)
+
+
+_tracer = None
+
+
+def enable(limit=LIMIT):
+    """Start recording, returns the Tracer"""
+    global _tracer
+    if _tracer is None:
+        _tracer = Tracer(limit)
+    return _tracer
+
+
+def active():
+    """The Tracer, None while tracing is off"""
+    return _tracer
+
+
+def span(name, **args):
+    """Context manager timing its block on the calling thread, a no-op while tracing is off"""
+    return _tracer.span(name, **args) if _tracer is not None else _NULL
+
+
+def instant(name, **args):
+    if _tracer is not None:
+        _tracer.instant(name, **args)
+
+
+def save(path):
+    """Write what was recorded as Chrome trace JSON; False if tracing was never enabled"""
+    if _tracer is None:
+        return False
+    _tracer.save(path)
+    return True
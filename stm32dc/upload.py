@@ -0,0 +1,167 @@
+"""Upload a model's weights into the board's flash over the link (APP_UPLOAD).
+
+    python -m stm32dc.upload retrained/network_data_params.c --port COM9
+    python -m stm32dc.upload network_time_data_params.c --port COM9 --model 1
+    python -m stm32dc.upload weights.bin --port COM9 --model 0
+    python -m stm32dc.upload --erase --port COM9
+    python -m stm32dc.upload tinyML/X-CUBE-AI/App/balanced_weights.bin --port COM9 --model 1
+    python -m stm32dc.upload retrained/network_data_params.c --ports COM9 COM10 COM11
+
+Reads the weights blob of a generated <name>_data_params.c (the
+s_<name>_weights_array_u64 array), or a raw .bin, and programs it into
+flash sector 7 as the weights of registered model --model. The device
+checks the CRC-32 of the whole blob before it commits, then runs that
+model on the new weights. Only the weight values change: the graph, the
+tensor sizes and the quantisation stay those linked into the image, so the
+blob must come from a network of the same architecture generated with the
+same options (a retrained or fine-tuned model). A blob of another size is
+refused here, and ignored by the firmware.
+
+The upload survives a reset and a reflash of the image. --erase drops it,
+every model runs on its linked weights again.
+
+The board answers its requests in order, so those ahead of COMMIT ran on
+the old weights and those after it run on the new ones; only the model
+uploaded to is created again. BEGIN stalls the core for the erase and the
+model runs on its linked weights until COMMIT, so a board is out of
+service for the whole upload. rollout() (--ports) does a pool one board at
+a time: it drains the board (DevicePool.drain), uploads, and puts it back
+before the next, the other boards taking the traffic meanwhile.
+
+A model streamed from the external SPI flash (APP_XFLASH, e.g. balanced
+after python -m stm32dc.generate --balanced) links no weights at all: its
+blob, the balanced_weights.bin generate writes, goes to its own slot of
+the external flash, and --erase --model N empties that slot. It cannot be
+selected before its first upload, so its size is only checked by the
+device. The custom kernels compare
+their weight copies with the network's at bind, so a model on uploaded
+weights keeps the library kernels.
+"""
+import argparse
+import os
+import re
+import sys
+
+from . import protocol
+from .bench import open_device
+from .link import DeviceError
+from .weights import load_blob
+from .worker import BULK
+
+CHUNK = 2048
+
+
+def read_blob(path):
+    """Weights bytes of a <name>_data_params.c or a raw file"""
+    if not path.endswith('.c'):
+        with open(path, 'rb') as f:
+            return f.read()
+    name = re.sub(r'_data_params$', '', os.path.splitext(os.path.basename(path))[0])
+    return load_blob(path, f's_{name}_weights_array_u64')
+
+
+def rollout(pool, model, blob, chunk=CHUNK, progress=None):
+    """Upload blob as the weights of registry index model to every healthy board of a DevicePool
+
+    One board at a time leaves the rotation, is uploaded to and committed,
+    then serves again. progress(port, sent, total) is called after each
+    chunk. Returns {port: protocol.Upload of the COMMIT}; a board that
+    fails stops the rollout with DeviceError, the boards before it keep
+    the new weights.
+    """
+    blob = bytes(blob)
+    if len(blob) % 4 or chunk % 4:
+        raise ValueError("the blob and the chunks must be whole 32-bit words")
+    crc = protocol.CRC.pack(protocol.crc32(blob))
+    replies = {}
+    for member in [m for m in pool.members if m.healthy]:
+        worker = member.worker
+        pool.drain(member.port)
+        try:
+            worker.upload(protocol.UPLOAD_BEGIN, model, len(blob), crc, timeout=15.0,
+                          priority=BULK).result()
+            for offset in range(0, len(blob), chunk):
+                worker.upload(protocol.UPLOAD_DATA, model, offset, blob[offset:offset + chunk],
+                              priority=BULK).result()
+                if progress:
+                    progress(member.port, min(offset + chunk, len(blob)), len(blob))
+            replies[member.port] = worker.upload(protocol.UPLOAD_COMMIT, model, timeout=2.0,
+                                                 priority=BULK).result()
+        finally:
+            pool.undrain(member.port)
+    return replies
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('blob', nargs='?', help="<name>_data_params.c or raw weights file")
+    port = ap.add_mutually_exclusive_group(required=True)
+    port.add_argument('--port')
+    port.add_argument('--ports', nargs='+', help="upload to a pool of boards one at a time")
+    ap.add_argument('--baud', type=int, default=921600)
+    ap.add_argument('--rtscts', action='store_true')
+    ap.add_argument('--model', type=int, default=0, help="registry index (default %(default)s)")
+    ap.add_argument('--erase', action='store_true', help="drop the weights uploaded for --model")
+    args = ap.parse_args(argv)
+    if not args.erase and not args.blob:
+        ap.error("give a blob to upload, or --erase")
+    if args.ports:
+        if args.erase:
+            ap.error("--erase takes one --port")
+        return main_pool(args)
+
+    conn, link, baud = open_device(args.port, args.baud, args.rtscts)
+    try:
+        if not link.probe().features & protocol.FEAT_UPLOAD:
+            raise SystemExit("the firmware has no UPLOAD, build it with APP_UPLOAD=1")
+        if args.erase:
+            link.upload(protocol.UPLOAD_ERASE, args.model, timeout=5.0)
+            print("uploaded weights erased")
+            return 0
+
+        blob = read_blob(args.blob)
+        active = link.select_model().active
+        try:
+            expected = link.select_model(args.model).weights_size
+        except DeviceError:
+            # A streamed model without weights yet
+            expected = None
+        link.select_model(active)
+        if expected is not None and len(blob) != expected:
+            raise SystemExit(f"model {args.model} has {expected} B of weights, {args.blob} {len(blob)} B")
+
+        print(f"{args.port} @ {baud} baud: {len(blob)} B for model {args.model}, "
+              f"CRC {protocol.crc32(blob):08x}")
+        reply = link.upload_weights(args.model, blob, CHUNK,
+                                    lambda sent, total: print(f"\r  {sent * 100 // total:3d}%",
+                                                              end='', flush=True))
+        print(f"\ncommitted, model {reply.model} active, {reply.received} of {reply.capacity} B used")
+    except DeviceError as e:
+        raise SystemExit(f"upload failed: {e}")
+    finally:
+        conn.close()
+    return 0
+
+
+def main_pool(args):
+    from .pool import DevicePool
+
+    blob = read_blob(args.blob)
+    pool = DevicePool.open(args.ports, args.baud, rtscts=args.rtscts)
+    try:
+        print(f"{len(pool)} boards: {len(blob)} B for model {args.model}, CRC {protocol.crc32(blob):08x}")
+        replies = rollout(pool, args.model, blob, CHUNK,
+                          lambda port, sent, total: print(f"\r  {port} {sent * 100 // total:3d}%",
+                                                          end='', flush=True))
+        print()
+        for port, reply in replies.items():
+            print(f"{port}: committed, model {reply.model} active, {reply.received} of {reply.capacity} B used")
+    except DeviceError as e:
+        raise SystemExit(f"\nrollout failed: {e}")
+    finally:
+        pool.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
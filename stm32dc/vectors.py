@@ -0,0 +1,75 @@
+"""Embed reference images for the firmware's SELFTEST build.
+
+    python -m stm32dc.vectors tinyML --images emnist-digits-test-images-idx3-ubyte \\
+        --labels emnist-digits-test-labels-idx1-ubyte --count 100
+
+Writes Core/Src/test_vectors.c with the first --count images, turned
+upright as bench sends them, and their labels. The firmware built with
+APP_SELFTEST=1 classifies them all on a SELFTEST request:
+python -m stm32dc.bench --port COM9 --selftest 0.98 then fails on an
+accuracy below 98 %. Every image costs 784 B of flash.
+"""
+import argparse
+import os
+import sys
+
+from .bench import load_idx, load_images
+from .weights import c_array
+
+OUTPUT = os.path.join('Core', 'Src', 'test_vectors.c')
+MAX_COUNT = 1000
+
+
+def render(source, images, labels):
+    rows = []
+    for img in images:
+        rows.append('  {' + ', '.join(str(v) for v in img) + '},')
+    return f"""/**
+  ******************************************************************************
+  * @file           : test_vectors.c
+  * @brief          : Reference images and labels of the SELFTEST build
+  ******************************************************************************
+  * Generated by python -m stm32dc.vectors from {source},
+  * do not edit.
+  ******************************************************************************
+  */
+
+#include "test_vectors.h"
+
+#if APP_SELFTEST
+const uint16_t test_vector_count = {len(images)};
+
+const uint8_t test_vector_images[{len(images)}][MODEL_IN_SIZE] = {{
+{chr(10).join(rows)}
+}};
+
+{c_array('uint8_t', 'test_vector_labels', labels, per_line=16)}
+#endif
+"""
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('project', help="firmware project directory (tinyML)")
+    ap.add_argument('--images', required=True, help="IDX or .npy file of 28x28 uint8 images")
+    ap.add_argument('--labels', required=True, help="IDX label file")
+    ap.add_argument('--count', type=int, default=100)
+    ap.add_argument('-o', '--output', help=f"default <project>/{OUTPUT}")
+    args = ap.parse_args(argv)
+
+    if not 0 < args.count <= MAX_COUNT:
+        ap.error(f"--count must be 1..{MAX_COUNT}")
+    images = load_images(args.images)[:args.count]
+    labels = load_idx(args.labels)[:len(images)]
+    if len(labels) != len(images):
+        raise SystemExit(f"{args.labels} has {len(labels)} labels for {len(images)} images")
+
+    output = args.output or os.path.join(args.project, OUTPUT)
+    with open(output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(render(os.path.basename(args.images), images, labels))
+    print(f"{output}: {len(images)} images, {len(images) * len(images[0])} B")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
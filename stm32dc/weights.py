@@ -0,0 +1,214 @@
+"""Offline weight layouts for the firmware's hand-written kernels.
+
+    python -m stm32dc.weights tinyML
+
+Reads the generated weights blob (X-CUBE-AI/App/network_data_params.c) and
+the c_info report describing it, and writes Core/Src/kernel_weights.c with
+the tensors the kernels in kernels.c read in their own order:
+
+    gemm_5  800 -> 128 dense, rows in 4-row blocks: 32-bit word k of rows
+            4b..4b+3 back to back, so the kernel streams flash sequentially
+            and each input word feeds four outputs (APP_KERNEL_DENSE=1)
+    gemm_5  the same blocks, block-sparse (APP_KERNEL_DENSE=2): only blocks
+            with a nonzero weight are kept, with their word column; all-zero
+            rows are moved to the last blocks so they cost nothing
+    gemm_5  4-bit per-row (APP_KERNEL_DENSE=3): row r rounded to steps of
+            max|w| / 7, eight weights per word in the same 4-row blocks, the
+            bias rescaled to match; half the flash of the int8 copy
+
+Rerun after regenerating the network; the firmware compares the copy with
+the live weights at bind time and keeps the library kernel on a mismatch.
+"""
+import argparse
+import glob
+import json
+import math
+import os
+import re
+import struct
+import sys
+
+DATA_PARAMS = os.path.join('X-CUBE-AI', 'App', 'network_data_params.c')
+OUTPUT = os.path.join('Core', 'Src', 'kernel_weights.c')
+BLOB = 's_network_weights_array_u64'
+DENSE_BLOCK = 4
+WORDS_PER_LINE = 8
+
+
+def load_blob(path, array=BLOB):
+    """Bytes of the u64 weights array, little-endian as on the MCU"""
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+    start = text.index(array + '[')
+    body = text[text.index('{', start) + 1:text.index('};', start)]
+    words = [int(v, 16) for v in re.findall(r'0x([0-9a-fA-F]+)U', body)]
+    return b''.join(struct.pack('<Q', w) for w in words)
+
+
+def find_info(project, blob_size):
+    """The c_info report whose weights pool matches the generated blob"""
+    for path in sorted(glob.glob(os.path.join(project, '.ai', '*_c_info.json'))):
+        with open(path, encoding='utf-8') as f:
+            info = json.load(f)
+        pools = [p for p in info.get('memory_pools', []) if p.get('address') == BLOB]
+        if pools and pools[0]['used_size_bytes'] == blob_size:
+            return path, info
+    raise SystemExit(f"no c_info report in {project}/.ai describes a {blob_size} B weights blob")
+
+
+def tensor(info, blob, name):
+    """(shape, bytes) of a weights buffer, e.g. 'gemm_5_weights_array'"""
+    buf = next((b for b in info['buffers'] if b['name'] == name), None)
+    if buf is None:
+        raise SystemExit(f"{name} not in the c_info report")
+    start = buf['offset_start']
+    return buf['shape'], blob[start:start + buf['size_bytes']]
+
+
+def dense_blocked(shape, data, block=DENSE_BLOCK):
+    """[out][in] int8 rows interleaved per 32-bit word in blocks of rows"""
+    rows, cols = shape
+    if rows % block or cols % 4:
+        raise SystemExit(f"{rows}x{cols} dense does not split into {block}-row blocks of words")
+    out = bytearray()
+    for b in range(0, rows, block):
+        for k in range(0, cols, 4):
+            for r in range(b, b + block):
+                out += data[r * cols + k:r * cols + k + 4]
+    return bytes(out)
+
+
+def dense_sparse(shape, data, block=DENSE_BLOCK):
+    """Block-sparse form of dense_blocked: (rows, ptr, cols, words)
+
+    rows[i] is the output row in lane i % block of row block i // block,
+    ptr[b]..ptr[b + 1] the kept blocks of row block b, cols their word
+    column and words their block words, as in dense_blocked
+    """
+    n_rows, n_cols = shape
+    dense_blocked(shape, data, block)  # same shape checks
+    live = [r for r in range(n_rows) if any(data[r * n_cols:(r + 1) * n_cols])]
+    rows = live + [r for r in range(n_rows) if r not in live]
+    ptr, cols, words = [0], [], bytearray()
+    for b in range(0, n_rows, block):
+        for k in range(0, n_cols, 4):
+            tile = b''.join(data[r * n_cols + k:r * n_cols + k + 4] for r in rows[b:b + block])
+            if any(tile):
+                cols.append(k // 4)
+                words += tile
+        ptr.append(len(cols))
+    return rows, ptr, cols, bytes(words)
+
+
+def dense_int4(shape, data, bias, block=DENSE_BLOCK):
+    """4-bit per-row form of gemm_5: (words, bias, steps)
+
+    Row r is stored as round(w / steps[r]) in -7..7, steps[r] = max|w| / 7.
+    Word (b * cols / 8 + j) * block + r holds columns 8j..8j+7 of row
+    b * block + r: columns 8j..8j+3 in the high nibbles of bytes 0..3,
+    8j+4..8j+7 in the low ones. The kernel masks a nibble set into the top
+    of each byte, which reads as 16 times the weight, so the bias is
+    16 * bias / steps[r] in that same scale. An all-zero row gets step 16,
+    its bias then stays as it is.
+    """
+    rows, cols = shape
+    if rows % block or cols % 8:
+        raise SystemExit(f"{rows}x{cols} dense does not split into {block}-row blocks of 8 columns")
+    weights = struct.unpack(f'<{rows * cols}b', data)
+    biases = struct.unpack(f'<{rows}i', bias)
+    steps, q = [], []
+    for r in range(rows):
+        row = weights[r * cols:(r + 1) * cols]
+        step = max(abs(w) for w in row) / 7 or 16.0
+        steps.append(step)
+        q.append([math.floor(w / step + 0.5) & 0xF for w in row])
+    out = bytearray()
+    for b in range(0, rows, block):
+        for j in range(0, cols, 8):
+            for r in range(b, b + block):
+                out += bytes((q[r][j + i] << 4) | q[r][j + 4 + i] for i in range(4))
+    bias16 = [math.floor(16 * biases[r] / steps[r] + 0.5) for r in range(rows)]
+    if any(not -2**31 <= b < 2**31 for b in bias16):
+        raise SystemExit("a gemm_5 bias does not fit 32 bits in the 4-bit scale")
+    return bytes(out), bias16, steps
+
+
+def c_array(ctype, name, values, attrs='', per_line=WORDS_PER_LINE, fmt='{}'):
+    decl = f"const {ctype} {name}[{len(values)}]" + (f" {attrs}" if attrs else '')
+    lines = [decl + " = {"]
+    for i in range(0, len(values), per_line):
+        lines.append('  ' + ', '.join(fmt.format(v) for v in values[i:i + per_line]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def c_words(name, data, attrs):
+    words = struct.unpack(f'<{len(data) // 4}I', data)
+    return c_array('uint32_t', name, words, attrs, fmt='0x{:08x}U')
+
+
+def render(info_name, gemm_5, sparse, int4):
+    rows, ptr, cols, words = sparse
+    nibbles, bias16, steps = int4
+    return f"""/**
+  ******************************************************************************
+  * @file           : kernel_weights.c
+  * @brief          : Weights in the layouts of the kernels in kernels.c
+  ******************************************************************************
+  * Generated by python -m stm32dc.weights from {info_name},
+  * do not edit. Rerun after regenerating the network.
+  ******************************************************************************
+  */
+
+#include "kernel_weights.h"
+
+#if APP_KERNEL_DENSE == KERNEL_DENSE_BLOCKED
+// gemm_5 in {DENSE_BLOCK}-row blocks, see kernel_weights.h
+{c_words('kernel_gemm_5_blocked', gemm_5, '__attribute__((aligned(16), section(".ai_weights")))')}
+#elif APP_KERNEL_DENSE == KERNEL_DENSE_SPARSE
+// gemm_5 block-sparse, {len(cols)} of {len(gemm_5) // 16} blocks kept, see kernel_weights.h
+{c_array('uint8_t', 'kernel_gemm_5_sparse_rows', rows, per_line=16)}
+
+{c_array('uint16_t', 'kernel_gemm_5_sparse_ptr', ptr, per_line=16)}
+
+{c_array('uint8_t', 'kernel_gemm_5_sparse_cols', cols or [0], per_line=16)}
+
+{c_words('kernel_gemm_5_sparse', words or bytes(16), '__attribute__((aligned(16), section(".ai_weights")))')}
+#elif APP_KERNEL_DENSE == KERNEL_DENSE_INT4
+// gemm_5 4-bit per row in {DENSE_BLOCK}-row blocks, see kernel_weights.h
+{c_words('kernel_gemm_5_int4', nibbles, '__attribute__((aligned(16), section(".ai_weights")))')}
+
+{c_array('int32_t', 'kernel_gemm_5_int4_bias', bias16)}
+
+{c_array('float', 'kernel_gemm_5_int4_step', steps, per_line=4, fmt='{:.9e}f')}
+#endif
+"""
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('project', help="firmware project directory (tinyML)")
+    ap.add_argument('-o', '--output', help=f"default <project>/{OUTPUT}")
+    args = ap.parse_args(argv)
+
+    blob = load_blob(os.path.join(args.project, DATA_PARAMS))
+    info_path, info = find_info(args.project, len(blob))
+    shape, data = tensor(info, blob, 'gemm_5_weights_array')
+    gemm_5 = dense_blocked(shape, data)
+    sparse = dense_sparse(shape, data)
+    _, bias = tensor(info, blob, 'gemm_5_bias_array')
+    int4 = dense_int4(shape, data, bias)
+
+    output = args.output or os.path.join(args.project, OUTPUT)
+    with open(output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(render(os.path.basename(info_path), gemm_5, sparse, int4))
+    rows, ptr, cols, words = sparse
+    print(f"{output}: gemm_5 {shape[0]}x{shape[1]} in {DENSE_BLOCK}-row blocks, {len(gemm_5)} B")
+    print(f"  sparse: {len(cols)} of {len(gemm_5) // 16} blocks, "
+          f"{len(words) + len(cols) + 2 * len(ptr) + len(rows)} B")
+    print(f"  int4: {len(int4[0]) + 8 * len(int4[1])} B")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
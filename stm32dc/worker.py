@@ -0,0 +1,697 @@
+"""Long-lived I/O worker that pipelines requests over a ClassifierLink port.
+
+    worker = LinkWorker(link)
+    worker.start()
+    future = worker.classify(image)      # returns immediately
+    digit = future.result()
+
+    bulk = worker.classify(image, priority=BULK)
+
+A writer thread takes requests from two lanes and sends them while it
+holds credits for them: the frame slots and RX ring bytes the device
+advertised in the link's last PING, one credit per SLOT_BYTES started,
+each reply returning its request's. INTERACTIVE requests go first, BULK
+ones get what is left: strictly, or with weights=(i, b) i interactive for
+every b bulk while both wait. Bulk never holds the last BULK_RESERVE
+credits, and interactive frames carry PRIORITY_FLAG so the device queues
+them ahead of the bulk ones it already has. A reader thread matches
+replies to requests by seq and resolves their futures. cancel() withdraws
+a request whose result is no longer wanted, on the device too when it
+was built with APP_CANCEL. With a capture (stm32dc.capture.CaptureWriter)
+every reply and final timeout is recorded with its request and round
+trip. With a clock (stm32dc.clocksync.ClockSync) every stamped reply
+adds its latency breakdown to timings, and clock_sync() refits the clock
+between requests. With stm32dc.tracing enabled every request is traced,
+and mapped onto the device's clock when it has both. Once started the worker owns the port: do not call the
+link's blocking methods until close() has returned.
+
+A request made without a timeout waits what the link's Timeouts work out
+for it at each transmission, the requests already in flight ahead of it
+included, and teaches them what the device took: the stamp's time on the
+device where it has one, else the round trip of a request sent while
+nothing else was in flight.
+
+With reopen, a callable returning a connected ClassifierLink on the same
+board (stm32dc.bench.reopener), losing the port does not fail what is in
+flight. The reader closes it and calls reopen every RECONNECT_BACKOFF,
+doubling up to RECONNECT_MAX, for up to RECONNECT_WINDOW; queued requests
+wait meanwhile. Once the board answers again every request that was in
+flight is sent again under a new seq, built payloads rebuilt in full, and
+the session goes on from there: a USB glitch costs its outage and
+nothing else. on_state, if given, is called with LINK_DOWN, LINK_UP or
+LINK_GONE from the reader thread.
+"""
+import threading
+import time
+from collections import deque
+from concurrent.futures import Future
+
+from . import protocol, tracing
+from .capture import CMD_NAMES
+from .clocksync import ROUNDS
+from .link import (CLASSIFY_COMMANDS, ClassifierLink, DeviceBusy, DeviceError, batch_frames, decode_anytime,
+                   decode_batch, decode_cascade, decode_classify, decode_embed, decode_heads, decode_knn,
+                   decode_profiled, decode_stage, decode_strip, decode_topk, decode_tta, strip_payload)
+
+# Request priority classes, submit(priority=...)
+INTERACTIVE = 0
+BULK = 1
+PRIORITIES = (INTERACTIVE, BULK)
+
+# on_state() arguments
+LINK_DOWN = 'down'      # the port failed, reopening
+LINK_UP = 'up'          # reopened, in-flight requests sent again
+LINK_GONE = 'gone'      # not back within RECONNECT_WINDOW, everything failed
+
+
+class _Request:
+    __slots__ = ('cmd', 'payload', 'tail', 'build', 'timeout', 'decode', 'future', 'seq', 'attempts',
+                 'deadline', 'units', 'priority', 'sent', 'sent_at', 'queued_at', 'received_at')
+
+    def __init__(self, cmd, payload, timeout, decode, build=None, units=1, priority=INTERACTIVE, tail=b''):
+        self.cmd = cmd
+        self.payload = payload
+        self.tail = tail      # encoded frames written right after the request's own
+        self.build = build    # build(full) -> payload, called at send time
+        self.units = units    # in-flight slots held while outstanding
+        self.priority = priority
+        self.timeout = timeout
+        self.decode = decode
+        self.future = Future()
+        self.seq = None
+        self.attempts = 0
+        self.deadline = 0.0
+        self.sent = 0             # type as last transmitted
+        self.sent_at = (0.0, 0.0)  # (Unix time, perf_counter) of the last transmission
+        self.queued_at = time.perf_counter()
+        self.received_at = 0.0    # perf_counter when its reply was decoded
+
+
+class LinkWorker:
+    """Owns the port of a ClassifierLink and keeps several requests in flight"""
+
+    # Firmware that advertises no credits: two device frame slots plus two
+    # image frames in its 4 KiB RX ring; a full size CLASSIFY_CROP takes
+    # every slot
+    MAX_IN_FLIGHT = 4
+    SLOT_BYTES = 1024
+    RESPONSE_TIMEOUT = ClassifierLink.RESPONSE_TIMEOUT
+    MAX_ATTEMPTS = ClassifierLink.MAX_ATTEMPTS
+    # Longest blocking read, bounds timeout detection and close()
+    READ_TIMEOUT = 0.05
+    # Credits bulk requests leave to interactive ones
+    BULK_RESERVE = 1
+    # Latency breakdowns kept in timings
+    TIMINGS_KEEP = 100000
+    # (perf_counter, seconds) of the last replies, kept in round_trips
+    ROUND_TRIPS_KEEP = 4096
+    # Seconds between attempts to reopen a lost port, doubling, and for how long
+    RECONNECT_BACKOFF = 0.05
+    RECONNECT_MAX = 1.0
+    RECONNECT_WINDOW = 30.0
+
+    def __init__(self, link, weights=None, capture=None, source=0, clock=None, reopen=None, on_state=None):
+        caps = link.caps
+        self.link = link
+        self.port = link.port
+        self.pending = {}                # seq -> _Request
+        self.lock = threading.Lock()     # pending, seq allocation and port writes
+        self.encoder = protocol.FrameEncoder()  # reused by every write, under lock
+        self.max_in_flight = self.credits(caps)
+        self.weights = weights           # (interactive, bulk) shares, None: strict priority
+        self.lanes = (deque(), deque())  # queued _Requests by priority
+        self.turn = [0, 0]               # smooth weighted round robin state
+        self.in_flight = 0               # credits held by sent requests
+        self.ready = threading.Condition()  # lanes, turn and in_flight
+        self.closed = threading.Event()
+        self.threads = []
+        self.device_priority = bool(caps and caps.features & protocol.FEAT_PRIORITY)
+        self.device_cancel = bool(caps and caps.features & protocol.FEAT_CANCEL)
+        self.capture = capture           # CaptureWriter or None
+        self.source = source             # board index recorded with each capture record
+        self.clock = clock               # ClockSync, or None
+        self.timings = deque(maxlen=self.TIMINGS_KEEP)  # clocksync.Timing of stamped replies
+        self.round_trips = deque(maxlen=self.ROUND_TRIPS_KEEP)  # (received, seconds) of answered classifications
+        self.answered = 0                # requests resolved with a reply
+        self.retransmits = 0             # requests sent again, after an error reply or no reply
+        self.timeouts = 0                # requests failed for want of a reply
+        self.reopen = reopen             # () -> ClassifierLink on the same board, or None
+        self.on_state = on_state
+        self.on_telemetry = None         # called with each protocol.Telemetry the device pushes
+        # on_sent(future) is called once a request first goes on the wire,
+        # its future's wire_at then the perf_counter of that
+        self.on_sent = None
+        # on_busy(protocol.Busy) -> True fails a request the device refused with
+        # DeviceBusy, for another board to take; otherwise it goes out again
+        # after the refusal's retry_after
+        self.on_busy = None
+        self.refusals = 0                # requests the device refused for want of a slot
+        self.online = threading.Event()  # clear while the port is being reopened
+        self.online.set()
+        self.reconnects = 0              # ports reopened
+        self.outage = 0.0                # seconds the last one took
+        self.reopened = False            # self.port is the worker's own, closed by close()
+
+    @classmethod
+    def credits(cls, caps):
+        """Credits of SLOT_BYTES advertised in a PING reply (protocol.Capabilities)
+
+        A frame in a slot holds one whatever its size, the ring holds
+        rx_ring bytes of frames waiting for a slot.
+        """
+        if caps is None or not caps.rx_slots:
+            return cls.MAX_IN_FLIGHT
+        return caps.rx_slots + caps.rx_ring // cls.SLOT_BYTES
+
+    def start(self):
+        self.threads = [threading.Thread(target=self._tx_loop, name='link-tx', daemon=True),
+                        threading.Thread(target=self._rx_loop, name='link-rx', daemon=True)]
+        for t in self.threads:
+            t.start()
+        return self
+
+    def close(self):
+        """Stop both threads and fail whatever is still queued or in flight"""
+        with self.ready:
+            self.closed.set()
+            self.ready.notify_all()
+        for t in self.threads:
+            t.join()
+        self.threads = []
+        if self.reopened:
+            self.port.close()
+
+        self._fail_all(ConnectionError("Link closed"))
+        with self.ready:
+            queued = [req for lane in self.lanes for req in lane]
+            for lane in self.lanes:
+                lane.clear()
+        for req in queued:
+            if req.future.set_running_or_notify_cancel():
+                req.future.set_exception(ConnectionError("Link closed"))
+
+    def __enter__(self):
+        return self.start()
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def submit(self, cmd, payload=b'', timeout=None, decode=None, build=None,
+               priority=INTERACTIVE, tail=b'') -> Future:
+        """Queue a request, the future resolves to decode(frame) (the frame by default).
+
+        build, if given, makes the payload on the writer thread right before
+        the first transmission (build(False)) and again with build(True) if
+        the device answers ERR_PARAM. tail, encoded frames that get no reply
+        of their own, goes out with every transmission of the request.
+        """
+        if priority not in PRIORITIES:
+            raise ValueError(f"priority must be INTERACTIVE or BULK, not {priority!r}")
+        payload = None if build else bytes(payload)
+        # Built payloads are packed images, never longer than one slot
+        size = protocol.OVERHEAD + len(payload) + len(tail) if payload is not None else 0
+        units = min(self._limit(priority), max(1, (size + self.SLOT_BYTES - 1) // self.SLOT_BYTES))
+        req = _Request(cmd, payload, timeout, decode or (lambda frame: frame), build, units, priority,
+                       bytes(tail))
+        with self.ready:
+            if not self.closed.is_set():
+                self.lanes[priority].append(req)
+                self.ready.notify()
+                return req.future
+        req.future.set_exception(ConnectionError("Link closed"))
+        return req.future
+
+    def classify(self, image, priority=INTERACTIVE) -> Future:
+        return self.submit(protocol.CMD_CLASSIFY, bytes(image), decode=decode_classify,
+                           priority=priority)
+
+    def classify_batch(self, images, priority=INTERACTIVE) -> Future:
+        """Up to MAX_BATCH images in one round trip, resolves to a digit or None per image, in order"""
+        images = [bytes(img) for img in images]
+        if not 0 < len(images) <= protocol.MAX_BATCH:
+            raise ValueError(f"a batch holds 1 to {protocol.MAX_BATCH} images, not {len(images)}")
+        return self.submit(protocol.CMD_BATCH, bytes([len(images)]), decode=decode_batch,
+                           timeout=self.RESPONSE_TIMEOUT + len(images) * ClassifierLink.BATCH_IMAGE_TIMEOUT,
+                           priority=priority, tail=batch_frames(images))
+
+    def classify_profiled(self, image, priority=INTERACTIVE) -> Future:
+        return self.submit(protocol.CMD_CLASSIFY_PROF, bytes(image), decode=decode_profiled,
+                           priority=priority)
+
+    def classify_packed(self, image, priority=INTERACTIVE) -> Future:
+        """Compressed CLASSIFY; packed in send order so DELTA bases line up"""
+        image = bytes(image)
+        return self.submit(protocol.CMD_CLASSIFY_PACKED, decode=decode_classify,
+                           build=lambda full: self.link.packer.pack(image, full), priority=priority)
+
+    def classify_strokes(self, body, priority=INTERACTIVE) -> Future:
+        """CLASSIFY_PACKED STROKES of a protocol.pack_strokes body, tagged in send order"""
+        body = bytes(body)
+        return self.submit(protocol.CMD_CLASSIFY_PACKED, decode=decode_classify,
+                           build=lambda full: self.link.packer.pack_strokes(body), priority=priority)
+
+    def classify_crop(self, crop, priority=INTERACTIVE) -> Future:
+        return self.submit(protocol.CMD_CLASSIFY_CROP, protocol.pack_crop(crop),
+                           decode=decode_classify, priority=priority)
+
+    def classify_small(self, image, model=None, priority=INTERACTIVE) -> Future:
+        """Resolves to the digit of a 14x14 image (ClassifierLink.classify_small)"""
+        payload = bytes(image) + (b'' if model is None else bytes([model]))
+        return self.submit(protocol.CMD_CLASSIFY_SMALL, payload, decode=decode_classify, priority=priority)
+
+    def classify_cascade(self, image, first, full, min_margin=protocol.CASCADE_MARGIN_DEFAULT,
+                         priority=INTERACTIVE) -> Future:
+        """Resolves to protocol.Cascade (ClassifierLink.classify_cascade)"""
+        return self.submit(protocol.CMD_CLASSIFY_CASCADE,
+                           bytes(image) + protocol.CASCADE_REQ.pack(first, full, min_margin),
+                           decode=decode_cascade, priority=priority)
+
+    def classify_topk(self, image, k=protocol.TOPK_DEFAULT, priority=INTERACTIVE) -> Future:
+        return self.submit(protocol.CMD_CLASSIFY_TOPK, bytes(image) + bytes([k]),
+                           decode=decode_topk, priority=priority)
+
+    def embed(self, image, priority=INTERACTIVE) -> Future:
+        """Resolves to protocol.Embedding (ClassifierLink.embed)"""
+        return self.submit(protocol.CMD_EMBED, bytes(image), decode=decode_embed, priority=priority)
+
+    def classify_heads(self, image, heads=0, priority=INTERACTIVE) -> Future:
+        """Resolves to protocol.Heads (ClassifierLink.classify_heads)"""
+        return self.submit(protocol.CMD_HEADS, bytes(image) + bytes([heads]), decode=decode_heads, priority=priority)
+
+    def classify_anytime(self, image, deadline_us=0, min_margin=0, priority=INTERACTIVE) -> Future:
+        """Resolves to protocol.Anytime (ClassifierLink.classify_anytime)"""
+        return self.submit(protocol.CMD_CLASSIFY_ANYTIME,
+                           bytes(image) + protocol.ANYTIME_REQ.pack(deadline_us, min_margin),
+                           decode=decode_anytime, priority=priority)
+
+    def classify_tta(self, image, min_margin, variants=protocol.TTA_VARIANTS, priority=INTERACTIVE) -> Future:
+        """Resolves to protocol.Tta (ClassifierLink.classify_tta)"""
+        return self.submit(protocol.CMD_CLASSIFY_TTA,
+                           bytes(image) + protocol.TTA_REQ.pack(min_margin, variants),
+                           decode=decode_tta, priority=priority)
+
+    def knn(self, op, image=b'', label=0, priority=INTERACTIVE) -> Future:
+        """Resolves to protocol.Knn (ClassifierLink.knn)"""
+        return self.submit(protocol.CMD_KNN, protocol.KNN_REQ.pack(op, label) + bytes(image),
+                           decode=decode_knn, priority=priority)
+
+    def stage(self, stage, data, split=0, flags=0, priority=INTERACTIVE) -> Future:
+        """One stage of a split network, resolves to protocol.Stage (ClassifierLink.stage)"""
+        return self.submit(protocol.CMD_STAGE, protocol.STAGE_REQ.pack(stage, split, flags) + bytes(data),
+                           decode=decode_stage, priority=priority)
+
+    def classify_strip(self, strip, stride=0, priority=INTERACTIVE) -> Future:
+        """Every window of a 28 x W strip, resolves to protocol.Strip (ClassifierLink.classify_strip)"""
+        return self.submit(protocol.CMD_STRIP, strip_payload(strip, stride),
+                           decode=decode_strip, priority=priority)
+
+    def select_model(self, index=None, priority=INTERACTIVE) -> Future:
+        """Switch to registered model index (None only asks), resolves to protocol.ModelSel"""
+        def decode(frame):
+            if len(frame.payload) != protocol.MODEL_SEL.size:
+                raise DeviceError(protocol.ERR_LENGTH)
+            return protocol.decode_model_sel(frame.payload)
+        return self.submit(protocol.CMD_SELECT_MODEL, b'' if index is None else bytes([index]),
+                           decode=decode, priority=priority)
+
+    def stats(self, reset=False, priority=INTERACTIVE) -> Future:
+        """Device counters and histograms (protocol.Stats), optionally zeroed after"""
+        def decode(frame):
+            if len(frame.payload) != protocol.STATS.size:
+                raise DeviceError(protocol.ERR_LENGTH)
+            return protocol.decode_stats(frame.payload)
+        return self.submit(protocol.CMD_STATS, bytes((protocol.STATS_RESET,)) if reset else b'',
+                           decode=decode, priority=priority)
+
+    def telemetry(self, interval_ms, priority=BULK) -> Future:
+        """Set the device's telemetry interval (0 stops), resolves to protocol.Telemetry (ClassifierLink.telemetry)"""
+        def decode(frame):
+            if len(frame.payload) < protocol.TELEMETRY.size:
+                raise DeviceError(protocol.ERR_LENGTH)
+            return protocol.decode_telemetry(frame.payload)
+        return self.submit(protocol.CMD_TELEMETRY, protocol.TELEMETRY_REQ.pack(interval_ms),
+                           decode=decode, priority=priority)
+
+    def layer_profile(self, priority=BULK) -> Future:
+        """Resolves to [(layer name, us)] of the last inference (ClassifierLink.layer_profile)"""
+        def decode(frame):
+            if len(frame.payload) < 4:
+                raise DeviceError(protocol.ERR_LENGTH)
+            return protocol.decode_layer_profile(frame.payload)
+        return self.submit(protocol.CMD_PROFILE, decode=decode, priority=priority)
+
+    def upload(self, op, model=0, arg=0, data=b'', timeout=None, priority=BULK) -> Future:
+        """One UPLOAD request, resolves to protocol.Upload (ClassifierLink.upload)"""
+        def decode(frame):
+            if len(frame.payload) != protocol.UPLOAD.size:
+                raise DeviceError(protocol.ERR_LENGTH)
+            return protocol.decode_upload(frame.payload)
+        return self.submit(protocol.CMD_UPLOAD, protocol.UPLOAD_REQ.pack(op, model, arg) + bytes(data),
+                           timeout=timeout, decode=decode, priority=priority)
+
+    def clock_sync(self, rounds=ROUNDS, flags=protocol.SYNC_STAMP, priority=INTERACTIVE) -> Future:
+        """Future of the clock's uncertainty after rounds CLOCK_SYNC exchanges, one at a time"""
+        if self.clock is None:
+            raise ValueError("clock_sync() needs LinkWorker(clock=ClockSync())")
+        done = Future()
+        done.set_running_or_notify_cancel()
+        left = [rounds]
+
+        def step(future=None):
+            error = future.exception() if future is not None else None
+            if error is not None:
+                done.set_exception(error)
+            elif left[0] == 0:
+                done.set_result(self.clock.uncertainty)
+            else:
+                left[0] -= 1
+                self.submit(protocol.CMD_CLOCK_SYNC, bytes((flags,)),
+                            priority=priority).add_done_callback(step)
+
+        step()
+        return done
+
+    def queued(self):
+        """Requests waiting to be sent, (interactive, bulk)"""
+        with self.ready:
+            return tuple(len(lane) for lane in self.lanes)
+
+    def cancel(self, future) -> bool:
+        """Withdraw the request of future, returns False if it can no longer be.
+
+        A request still queued here is simply cancelled. One already sent
+        gets a CANCEL: the device drops it unrun, or drops the result of the
+        run under way and runs nothing more for it, and the future fails
+        with DeviceError(ERR_CANCELLED). Only
+        when the reply has been written first does the result still arrive.
+        """
+        if future.cancel():
+            return True
+        if not self.device_cancel:
+            return False
+        with self.lock:
+            seq = next((s for s, req in self.pending.items() if req.future is future), None)
+        if seq is None:
+            return False
+        self.submit(protocol.CMD_CANCEL, bytes([seq]), decode=lambda frame: None)
+        return True
+
+    def _limit(self, priority):
+        """Credits requests of priority may hold together"""
+        if priority == BULK and self.max_in_flight > self.BULK_RESERVE:
+            return self.max_in_flight - self.BULK_RESERVE
+        return self.max_in_flight
+
+    def _next(self):
+        """Next request to send, once it fits its credits; None when closed (holds self.ready)"""
+        while not self.closed.is_set():
+            waiting = [p for p in PRIORITIES if self.lanes[p]]
+            if self.weights is None or len(waiting) < 2:
+                lane = waiting[0] if waiting else None
+            else:
+                # Smooth weighted round robin: each lane gains its weight per
+                # pick, the one picked pays the total
+                lane = max(waiting, key=lambda p: self.turn[p] + self.weights[p])
+            if lane == BULK and not self._fits(BULK) and INTERACTIVE in waiting and \
+                    self._fits(INTERACTIVE):
+                lane = INTERACTIVE  # the bulk turn waits for credits, interactive has one
+            if lane is not None and self._fits(lane):
+                if self.weights is not None and len(waiting) == 2:
+                    for p in waiting:
+                        self.turn[p] += self.weights[p]
+                    self.turn[lane] -= sum(self.weights)
+                req = self.lanes[lane].popleft()
+                self.in_flight += req.units
+                return req
+            self.ready.wait()
+        return None
+
+    def _fits(self, lane):
+        return self.in_flight + self.lanes[lane][0].units <= self._limit(lane)
+
+    def _send(self, req, attempt=True):
+        """(Re)transmit req under a fresh seq, so a late reply to an earlier attempt is ignored
+
+        attempt=False sends it again without counting an attempt: the
+        earlier one went down with the port.
+        """
+        with self.lock:
+            if req.seq is not None:
+                if self.pending.get(req.seq) is not req:
+                    return  # already resolved
+                del self.pending[req.seq]
+            # Skip seqs still owned by another outstanding request
+            for _ in range(256):
+                seq = self.link.next_seq()
+                if seq not in self.pending:
+                    break
+            if req.payload is None:
+                req.payload = req.build(req.attempts > 0)
+            req.seq = seq
+            req.attempts += attempt
+            timeout = req.timeout
+            if timeout is None:
+                timeout = self.link.timeouts.timeout(req.cmd, self._size(req), max(0, self.in_flight - req.units))
+            req.deadline = time.monotonic() + timeout
+            self.pending[seq] = req
+            cmd = req.cmd
+            if req.priority == INTERACTIVE and self.device_priority:
+                cmd |= protocol.PRIORITY_FLAG
+            req.sent = cmd
+            with tracing.span('encode'):
+                data = self.encoder.encode(cmd, seq, req.payload, req.tail)
+            first = not req.sent_at[1]
+            req.sent_at = (time.time(), time.perf_counter())
+            if first:
+                req.future.wire_at = req.sent_at[1]
+            with tracing.span('write', bytes=len(data)):
+                self.port.write(data)
+        if first and self.on_sent is not None:
+            self.on_sent(req.future)
+
+    @staticmethod
+    def _size(req):
+        return protocol.OVERHEAD + len(req.payload) + len(req.tail)
+
+    def _finish(self, req, result=None, error=None):
+        with self.lock:
+            if self.pending.get(req.seq) is not req:
+                return
+            del self.pending[req.seq]
+        with self.ready:
+            self.in_flight -= req.units
+            self.ready.notify()
+
+        frame = result
+        if error is None:
+            try:
+                with tracing.span('decode'):
+                    result = req.decode(result)
+            except Exception as e:
+                error = e
+        if error is None and self.clock is not None:
+            self._timing(req, frame)
+        if error is None and req.received_at:
+            self.answered += 1
+            if req.cmd in CLASSIFY_COMMANDS:
+                self.round_trips.append((req.received_at, req.received_at - req.sent_at[1]))
+        tracer = tracing.active()
+        if tracer is not None and req.sent_at[1]:
+            received = req.received_at or time.perf_counter()
+            tracer.request(CMD_NAMES.get(req.cmd, f"0x{req.cmd:02X}"), req.queued_at, req.sent_at[1],
+                           received, max(received, time.perf_counter()), self.clock,
+                           frame.stamp if error is None else None, error)
+        if error is not None:
+            req.future.set_exception(error)
+        else:
+            req.future.set_result(result)
+
+    def _timing(self, req, frame):
+        """Fit a CLOCK_SYNC reply into the clock, break a stamped one down into timings"""
+        parsed = time.perf_counter()
+        if req.cmd == protocol.CMD_CLOCK_SYNC and len(frame.payload) == protocol.CLOCK_SYNC.size:
+            reply = protocol.decode_clock_sync(frame.payload)
+            self.clock.add(req.sent_at[1], req.received_at, reply.rx_us, reply.tx_us)
+        elif frame.stamp is not None and self.clock.synced:
+            self.timings.append(self.clock.breakdown(req.cmd, req.queued_at, req.sent_at[1],
+                                                     req.received_at, parsed, frame.stamp))
+
+    def _fail_all(self, error):
+        with self.lock:
+            reqs = list(self.pending.values())
+        for req in reqs:
+            self._finish(req, error=error)
+
+    def _tx_loop(self):
+        while True:
+            with self.ready:
+                req = self._next()
+            if req is None:
+                return
+            if not req.future.set_running_or_notify_cancel():
+                # Cancelled while queued: hand its credits back
+                with self.ready:
+                    self.in_flight -= req.units
+                    self.ready.notify()
+                continue
+            while not self.online.is_set() and not self.closed.is_set():
+                self.online.wait(self.READ_TIMEOUT)
+            try:
+                self._send(req)
+            except Exception as e:
+                self._write_failed(req, e)
+
+    def _write_failed(self, req, error):
+        """Fail req, unless the port is being reopened and it goes out again then"""
+        with self.lock:
+            resent = self.reopen is not None and isinstance(error, OSError) and \
+                self.pending.get(req.seq) is req
+        if not resent:
+            self._finish(req, error=error)
+
+    def _rx_loop(self):
+        while not self.closed.is_set():
+            try:
+                frame = self.link.reader.read_frame(self.READ_TIMEOUT)
+            except Exception as e:
+                # Port closed or unplugged underneath us
+                if self.reopen is None or not self._resume():
+                    self._fail_all(e)
+                    return
+                continue
+
+            if frame is not None:
+                self._dispatch(frame, time.perf_counter())
+            self._expire()
+
+    def _resume(self):
+        """Reopen the lost port and send what was in flight again; False if it stayed gone"""
+        lost = time.monotonic()
+        self.online.clear()
+        self._state(LINK_DOWN)
+        try:
+            self.port.close()
+        except Exception:
+            pass
+        delay = self.RECONNECT_BACKOFF
+        while True:
+            try:
+                link = self.reopen()
+                break
+            except Exception:
+                # Not enumerated again yet, or not answering yet
+                if self.closed.is_set() or time.monotonic() + delay > lost + self.RECONNECT_WINDOW:
+                    self._state(LINK_GONE)
+                    return False
+                self.closed.wait(delay)
+                delay = min(delay * 2, self.RECONNECT_MAX)
+
+        link.timeouts.run.update(self.link.timeouts.run)
+        with self.lock:
+            self.link, self.port = link, link.port
+            self.reopened = True
+            resend = sorted(self.pending.values(), key=lambda req: req.sent_at[1])
+            for req in resend:
+                if req.build:
+                    req.payload = None  # the device's DELTA base went with it
+        caps = link.caps
+        with self.ready:
+            self.max_in_flight = self.credits(caps)
+            self.device_priority = bool(caps and caps.features & protocol.FEAT_PRIORITY)
+            self.device_cancel = bool(caps and caps.features & protocol.FEAT_CANCEL)
+            self.ready.notify_all()
+        for req in resend:
+            try:
+                self._send(req, attempt=False)
+            except Exception as e:
+                self._finish(req, error=e)
+        self.reconnects += 1
+        self.outage = time.monotonic() - lost
+        self.online.set()
+        self._state(LINK_UP)
+        return True
+
+    def _state(self, state):
+        if self.on_state is not None:
+            try:
+                self.on_state(state)
+            except Exception:
+                pass  # a listener's bug must not take the link down
+
+    def _dispatch(self, frame, received=0.0):
+        if frame.seq == 0 and frame.type == protocol.response_type(protocol.CMD_TELEMETRY):
+            if self.on_telemetry:
+                self.on_telemetry(protocol.decode_telemetry(frame.payload))
+            return
+        with self.lock:
+            req = self.pending.get(frame.seq)
+        if req is None:
+            return  # stale reply to an abandoned attempt
+        req.received_at = received
+        if self.capture:
+            self._record(req, frame.type, frame.payload)
+        if frame.type == protocol.response_type(req.cmd):
+            self._learn(req, frame)
+
+        if frame.type == protocol.TYPE_ERROR:
+            code = frame.payload[0] if frame.payload else protocol.ERR_NONE
+            busy = protocol.decode_busy(frame.payload)
+            if busy is not None:
+                # Refused with an estimate: elsewhere, or here once there is room (_expire)
+                self.refusals += 1
+                if req.attempts >= self.MAX_ATTEMPTS or (self.on_busy is not None and self.on_busy(busy)):
+                    self._finish(req, error=DeviceBusy(busy))
+                else:
+                    with self.lock:
+                        req.deadline = time.monotonic() + busy.retry_after
+            # BUSY is transient while the pipeline is full, TIMEOUT a frame
+            # the line cut short
+            elif code in (protocol.ERR_CRC, protocol.ERR_BUSY, protocol.ERR_TIMEOUT) and \
+                    req.attempts < self.MAX_ATTEMPTS:
+                self._retry(req)
+            elif code == protocol.ERR_PARAM and req.build and req.attempts < self.MAX_ATTEMPTS:
+                # Stale DELTA base: rebuild with a full encoding
+                req.payload = None
+                self._retry(req)
+            else:
+                self._finish(req, error=DeviceError(code))
+        elif frame.type == protocol.response_type(req.cmd):
+            self._finish(req, frame)
+
+    def _learn(self, req, frame):
+        """Teach the link's Timeouts what the device took over req"""
+        timeouts = self.link.timeouts
+        if frame.stamp is not None:
+            timeouts.observe(req.cmd, ((frame.stamp.tx_us - frame.stamp.rx_us) & 0xFFFFFFFF) / 1e6)
+        elif self.in_flight == req.units and req.received_at:
+            timeouts.observe_round_trip(req.cmd, req.received_at - req.sent_at[1], self._size(req),
+                                        protocol.OVERHEAD + len(frame.payload))
+
+    def _record(self, req, response_type=0, response=b''):
+        sent, at = req.sent_at
+        rtt = time.perf_counter() - at if response_type else 0.0
+        try:
+            self.capture.record(sent, rtt, self.source, req.sent, req.payload,
+                                response_type, response)
+        except OSError:
+            pass  # a full disk must not take the link down
+
+    def _retry(self, req):
+        self.retransmits += 1
+        try:
+            self._send(req)
+        except Exception as e:
+            self._write_failed(req, e)
+
+    def _expire(self):
+        now = time.monotonic()
+        with self.lock:
+            late = [req for req in self.pending.values() if req.deadline <= now]
+        for req in late:
+            if req.attempts < self.MAX_ATTEMPTS:
+                self._retry(req)
+            else:
+                self.timeouts += 1
+                if self.capture:
+                    self._record(req)
+                self._finish(req, error=TimeoutError("No response from STM32"))
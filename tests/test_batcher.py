@@ -0,0 +1,85 @@
+"""stm32dc.batcher: every future completes, even when every board goes down mid-stream.
+
+    python -m unittest discover -s tests
+"""
+import threading
+import time
+import unittest
+from concurrent.futures import wait
+
+from stm32dc.batcher import DynamicBatcher, _Board
+
+IMAGE = bytes(784)
+SUBMITTERS = 4
+# Longest the requests of a round may stay unresolved before they count as hung
+DEADLINE = 10.0
+
+
+class Link:
+    """ClassifierLink stand-in: digit 7 after a short run, a timeout once killed"""
+
+    def __init__(self, killed):
+        self.killed = killed
+
+    def classify(self, image):
+        return self.classify_batch([image])[0]
+
+    def classify_batch(self, images):
+        time.sleep(0.0005)
+        if self.killed.is_set():
+            raise TimeoutError("No response from STM32")
+        return [7] * len(images)
+
+
+class DynamicBatcherTest(unittest.TestCase):
+
+    def batcher(self, boards, killed):
+        batcher = DynamicBatcher([_Board(f'board{i}', None, Link(killed)) for i in range(boards)],
+                                 max_batch=8, max_wait=0.0005)
+        self.addCleanup(batcher.close)
+        return batcher
+
+    def test_answers(self):
+        batcher = self.batcher(2, threading.Event())
+        futures = [batcher.classify(IMAGE) for _ in range(100)]
+        self.assertEqual([f.result(DEADLINE) for f in futures], [7] * 100)
+
+    def test_every_board_down(self):
+        # The last board going down races classify() and the other boards re-queuing: repeat
+        for round in range(20):
+            killed = threading.Event()
+            batcher = self.batcher(3, killed)
+            futures = []
+            lock = threading.Lock()
+
+            def submit():
+                while not stop.is_set():
+                    future = batcher.classify(IMAGE)
+                    with lock:
+                        futures.append(future)
+
+            stop = threading.Event()
+            submitters = [threading.Thread(target=submit, daemon=True) for _ in range(SUBMITTERS)]
+            for t in submitters:
+                t.start()
+            time.sleep(0.01)
+            killed.set()
+            # Keep submitting until no board is left, and a while after
+            while any(h.healthy for h in batcher.health()):
+                time.sleep(0.001)
+            time.sleep(0.01)
+            stop.set()
+            for t in submitters:
+                t.join()
+
+            _, hung = wait(futures, DEADLINE)
+            self.assertFalse(hung, f"round {round}: {len(hung)} of {len(futures)} futures never completed")
+            errors = [f.exception() for f in futures if f.exception() is not None]
+            self.assertTrue(errors)
+            for e in errors:
+                self.assertIsInstance(e, (TimeoutError, ConnectionError))
+            batcher.close()
+
+
+if __name__ == '__main__':
+    unittest.main()
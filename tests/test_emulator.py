@@ -0,0 +1,74 @@
+"""stm32dc.emulator: the commands it emulates answer, and its docstring names the ones it does not.
+
+    python -m unittest discover -s tests
+"""
+import asyncio
+import re
+import struct
+import unittest
+
+from stm32dc import emulator, protocol
+from stm32dc.emulator import Board, StandIn, UNSUPPORTED, command_name
+
+IMAGE = bytes(range(256)) * 3 + bytes(16)
+# Longest a reply may take on the emulated line and core
+REPLY_TIMEOUT = 2.0
+
+
+async def exchange(frames):
+    """Replies (type, seq, payload) of a board to frames (cmd, payload), sent one at a time"""
+    board = Board(0, StandIn())
+    reader = protocol.FrameReader()
+    replies = asyncio.Queue()
+
+    def send(data):
+        reader.feed(data)
+        frame = reader.next_frame()
+        while frame is not None:
+            replies.put_nowait((frame.type, frame.seq, bytes(frame.payload)))
+            frame = reader.next_frame()
+
+    board.send = send
+    answers = []
+    for seq, (cmd, payload) in enumerate(frames):
+        board.received(protocol.encode_frame(cmd, seq, payload))
+        answers.append(await asyncio.wait_for(replies.get(), REPLY_TIMEOUT))
+    return answers
+
+
+class EmulatorTest(unittest.TestCase):
+
+    def test_supported(self):
+        frames = [
+            (protocol.CMD_PING, b''),
+            (protocol.CMD_CLASSIFY, IMAGE),
+            (protocol.CMD_CLASSIFY_TOPK, IMAGE + bytes((3,))),
+            (protocol.CMD_SELECT_MODEL, b''),
+            (protocol.CMD_SET_CLOCK, bytes((1,))),
+            (protocol.CMD_STATS, b''),
+            (protocol.CMD_CLASSIFY, IMAGE[:-1]),
+        ]
+        replies = asyncio.run(exchange(frames))
+        _, classify, topk, model, clock, stats, short = replies
+
+        for seq, ((cmd, _), reply) in enumerate(zip(frames[:-1], replies)):
+            self.assertEqual(reply[:2], (protocol.response_type(cmd), seq))
+        self.assertEqual(classify[2], bytes((StandIn().classify(IMAGE),)))
+        self.assertEqual(protocol.TOPK_HEADER.unpack_from(topk[2])[2], 3)
+        self.assertEqual(topk[2][protocol.TOPK_HEADER.size], classify[2][0])
+        self.assertEqual(protocol.MODEL_SEL.unpack(model[2])[:2], (0, 1))
+        self.assertEqual(struct.unpack('<I', clock[2]), (emulator.CLOCK_HZ[1],))
+        hz, _, frames = protocol.STATS.unpack_from(stats[2])[:3]
+        self.assertEqual((hz, frames), (emulator.CLOCK_HZ[1], 6))
+        self.assertEqual(short, (protocol.TYPE_ERROR, 6, bytes((protocol.ERR_LENGTH,))))
+
+    def test_unsupported_documented(self):
+        # The docstring's list is what --help and the README point at: keep it the handlers' complement
+        listed = re.search(r"answers ERR_TYPE.*?\):\n(.*?)\. Host code", emulator.__doc__, re.S).group(1)
+        names = re.split(r",\s*|\s+and\s+", ' '.join(listed.split()))
+        self.assertEqual(sorted(names), sorted(command_name(cmd) for cmd in UNSUPPORTED))
+        self.assertFalse(set(UNSUPPORTED) & set(Board.HANDLERS))
+
+
+if __name__ == '__main__':
+    unittest.main()
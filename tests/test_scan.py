@@ -0,0 +1,90 @@
+"""stm32dc.scan: the decoding feed surfaces a dead process and shuts down when cut short.
+
+    python -m unittest discover -s tests
+"""
+import os
+import threading
+import unittest
+from concurrent.futures.process import BrokenProcessPool
+
+from stm32dc.scan import CHUNK, decoded
+
+PATHS = [f'image{i}.png' for i in range(4 * CHUNK)]
+# Longest the feed may take over PATHS before it counts as hung
+DEADLINE = 30.0
+
+
+def decode(path):
+    return path.encode(), None
+
+
+def unreadable(path):
+    return (None, "not an image") if path == PATHS[3] else decode(path)
+
+
+def crash(path):
+    """A decoding process dying outright, as a segfault in a codec or the OOM killer would"""
+    if path == PATHS[CHUNK + 1]:
+        os._exit(1)
+    return decode(path)
+
+
+def within(deadline, work):
+    """work()'s result, or AssertionError if it has not returned by deadline"""
+    outcome = []
+
+    def run():
+        try:
+            outcome.append(('result', work()))
+        except BaseException as e:
+            outcome.append(('error', e))
+
+    thread = threading.Thread(target=run, daemon=True)
+    thread.start()
+    thread.join(deadline)
+    if thread.is_alive():
+        raise AssertionError("the decoding feed hung")
+    kind, value = outcome[0]
+    if kind == 'error':
+        raise value
+    return value
+
+
+def drain(room, prepare):
+    """Every image of decoded(), each taken as score() takes it: room released after"""
+    images = []
+    for image in decoded(PATHS, 2, room, prepare):
+        images.append(image)
+        room.release()
+    return images
+
+
+class DecodedTest(unittest.TestCase):
+
+    def test_in_order(self):
+        images = within(DEADLINE, lambda: drain(threading.Semaphore(CHUNK), decode))
+        self.assertEqual(images, [p.encode() for p in PATHS])
+
+    def test_unreadable_file(self):
+        with self.assertLogs('stm32dc.scan', 'WARNING'):
+            images = within(DEADLINE, lambda: drain(threading.Semaphore(CHUNK), unreadable))
+        self.assertIsNone(images[3])
+        self.assertEqual(len(images), len(PATHS))
+
+    def test_process_dies(self):
+        with self.assertRaises(BrokenProcessPool):
+            within(DEADLINE, lambda: drain(threading.Semaphore(CHUNK), crash))
+
+    def test_cut_short(self):
+        # The consumer stops with paths still waiting for room
+        def take_two():
+            images = decoded(PATHS, 2, threading.Semaphore(CHUNK), decode)
+            taken = [next(images), next(images)]
+            images.close()
+            return taken
+
+        self.assertEqual(within(DEADLINE, take_two), [PATHS[0].encode(), PATHS[1].encode()])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,88 @@
+"""stm32dc.sink: rows land in input order, and a failed request still completes the job.
+
+    python -m unittest discover -s tests
+"""
+import os
+import struct
+import tempfile
+import threading
+import unittest
+from concurrent.futures import CancelledError, Future
+
+from stm32dc import protocol
+from stm32dc.link import DeviceError
+from stm32dc.sink import BLANK, FAILED, PENDING, OrderedSink, score
+
+IMAGE = bytes(784)
+# Longest a job of a few images may take before it counts as hung
+DEADLINE = 10.0
+
+
+def labels(path):
+    """int8 rows of a labels .npy, without numpy"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    offset = 10 + struct.unpack_from('<H', data, 8)[0]
+    return list(struct.unpack_from(f'{len(data) - offset}b', data, offset))
+
+
+class Backend:
+    """classify() answers from outcomes, one per image: a digit, None (blank) or an exception"""
+
+    def __init__(self, outcomes):
+        self.outcomes = list(outcomes)
+
+    def classify(self, image, priority=None):
+        future = Future()
+        outcome = self.outcomes.pop(0)
+        # From another thread, as a pool's reader would
+        if isinstance(outcome, BaseException):
+            threading.Timer(0.01, future.set_exception, (outcome,)).start()
+        else:
+            threading.Timer(0.01, future.set_result, (outcome,)).start()
+        return future
+
+
+class OrderedSinkTest(unittest.TestCase):
+
+    def setUp(self):
+        self.dir = tempfile.TemporaryDirectory()
+        self.path = os.path.join(self.dir.name, 'labels.npy')
+
+    def tearDown(self):
+        self.dir.cleanup()
+
+    def test_out_of_order(self):
+        with OrderedSink(self.path, 4, window=4) as sink:
+            sink.complete(2, 7)
+            sink.complete(1, BLANK)
+            self.assertEqual(sink.committed, 0)
+            sink.complete(0, 3)
+            self.assertEqual(sink.committed, 3)
+        self.assertEqual(labels(self.path), [3, BLANK, 7, PENDING])
+
+    def test_failed_requests(self):
+        outcomes = [1, DeviceError(protocol.ERR_BUSY), CancelledError(), RuntimeError("reader died"), None]
+        result = []
+        with OrderedSink(self.path, len(outcomes), window=2) as sink, self.assertLogs('stm32dc.sink') as logged:
+            job = threading.Thread(target=lambda: result.append(score(Backend(outcomes), [IMAGE] * 5, sink)),
+                                   daemon=True)
+            job.start()
+            job.join(DEADLINE)
+            self.assertFalse(job.is_alive(), "score() hung on a failed request")
+        # The unexpected errors are logged, a DeviceError is an ordinary FAILED
+        self.assertEqual(sorted(logged.output), ["WARNING:stm32dc.sink:image 2: CancelledError()",
+                                                 "WARNING:stm32dc.sink:image 3: RuntimeError('reader died')"])
+        self.assertEqual(labels(self.path), [1, FAILED, FAILED, FAILED, BLANK])
+        self.assertEqual((result[0].answered, result[0].blank, result[0].failed), (1, 1, 3))
+
+    def test_complete_after_close(self):
+        sink = OrderedSink(self.path, 2)
+        sink.complete(0, 5)
+        sink.close()
+        sink.complete(1, 6)
+        self.assertEqual(labels(self.path), [5, PENDING])
+
+
+if __name__ == '__main__':
+    unittest.main()
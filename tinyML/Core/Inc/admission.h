@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @file           : admission.h
+  * @brief          : When a frame refused for want of a slot should come back
+  ******************************************************************************
+  * With APP_ADMISSION a frame that finds no slot is refused at once with a
+  * ProtoBusy_t. Its retry_us is the frames ahead of it times the mean time
+  * the main loop (or inference task) took per frame, an exponential
+  * average over about the last eight in DWT cycles. Frames of every kind
+  * count alike: the estimate is of the queue as the board has been
+  * serving it, not of the refused request.
+  ******************************************************************************
+  */
+
+#ifndef __ADMISSION_H
+#define __ADMISSION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+
+#if APP_ADMISSION
+#define ADMISSION_BEGIN()               Admission_Begin()
+#define ADMISSION_END()                 Admission_End()
+#else
+#define ADMISSION_BEGIN()               ((void)0)
+#define ADMISSION_END()                 ((void)0)
+#endif
+
+// Least retry_us: nothing measured yet, or only quick frames
+#define ADMISSION_MIN_US        1000U
+
+void Admission_Begin(void);
+void Admission_End(void);
+uint32_t Admission_RetryUs(uint8_t ahead);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADMISSION_H */
@@ -0,0 +1,1244 @@
+/**
+  ******************************************************************************
+  * @file           : app_config.h
+  * @brief          : Build-time options of the classifier application
+  ******************************************************************************
+  * Each option can be overridden from the compiler command line (-D).
+  ******************************************************************************
+  */
+
+#ifndef __APP_CONFIG_H
+#define __APP_CONFIG_H
+
+/* Transports ----------------------------------------------------------------*/
+/**
+  * USB CDC (OTG FS) link next to USART2. Requires USB_DEVICE with the CDC
+  * class enabled in tinyML.ioc so CubeMX generates usb_device.c and
+  * usbd_cdc_if.c; CDC_Receive_FS must then call USB_Link_Receive().
+  * Replies go back on the transport the request arrived on.
+  */
+#ifndef APP_USB_CDC
+#define APP_USB_CDC 0
+#endif
+
+/**
+  * USART of the host link: 2 (PA2/PA3, the ST-LINK virtual COM port), 1
+  * (PB6/PB7) or 6 (PC6/PC7) for a USB-serial adapter (host_uart.h).
+  * USART2 is on APB1 at HCLK/4, 24 MHz, which tops out at 3 Mbaud with
+  * OVER8; USART1 and USART6 are on APB2 at the full HCLK, four times
+  * that. Everything said of USART2 below is said of the one chosen; the
+  * other two are then not free for APP_UART_LINKS.
+  */
+#ifndef APP_HOST_UART
+#define APP_HOST_UART 2
+#endif
+
+/**
+  * RTS/CTS hardware flow control on USART2: CTS on PA0, RTS on PA1 (AF7),
+  * for a USB-serial adapter wired to PA2/PA3 with its handshake lines
+  * (the ST-LINK has none); on USART1 (APP_HOST_UART 1) CTS is PA11 and
+  * RTS PA12. RTS drops while a received byte is still unread, and TX
+  * pauses while the host holds CTS high, so the host can write a whole
+  * frame in one go at any baud (stm32dc --rtscts). CTS must
+  * be driven: PA0 is the user button on the Discovery board, whose
+  * pull-down keeps CTS asserted when nothing is wired, and pressing it
+  * holds the replies back.
+  */
+#ifndef APP_UART_FLOW
+#define APP_UART_FLOW 0
+#endif
+
+/**
+  * USART2 and its two DMA streams serviced by LL register code instead of
+  * HAL_UART_IRQHandler / HAL_DMA_IRQHandler. HAL still initialises the
+  * UART; CLASSIFY_PROF reports the cycles either way (bench --isr).
+  */
+#ifndef APP_UART_LL
+#define APP_UART_LL 0
+#endif
+
+/**
+  * Build for the Renode STM32F411 target (tinyML/renode) instead of a
+  * board. Renode's USART raises no DMA requests, so USART2 takes its bytes
+  * by RXNE interrupt into the same ring and sends replies from the TX ring
+  * by polling TXE; everything past the ring is the board's code. Needs
+  * APP_UART_LL. Inference cycle counts are the simulator's, one per
+  * instruction (python -m stm32dc.sim).
+  */
+#ifndef APP_SIM
+#define APP_SIM 0
+#endif
+
+/**
+  * SPI2 slave link next to USART2, for an application processor as SPI
+  * master: NSS PB12, SCK PB13, MISO PB14, MOSI PB15, and PB1 high while a
+  * reply waits to be read (spi_link.c). Same frames and slots as USART2,
+  * at up to PCLK1 / 2. Replies go back on the transport the request
+  * arrived on.
+  */
+#ifndef APP_SPI_LINK
+#define APP_SPI_LINK 0
+#endif
+
+/**
+  * Two more host sessions on USART1 (PB6 TX, PB7 RX) and USART6 (PC6 TX,
+  * PC7 RX), 8N1 at APP_UART_LINKS_BAUD (uart_link.c). Each has its own DMA
+  * ring and parser; they share the network with USART2 through the frame
+  * slots, of which every link is guaranteed one.
+  */
+#ifndef APP_UART_LINKS
+#define APP_UART_LINKS 0
+#endif
+
+#ifndef APP_UART_LINKS_BAUD
+#define APP_UART_LINKS_BAUD 115200U
+#endif
+
+/**
+  * A frame on USART2 (or USART1/USART6) that stops arriving for this many
+  * ms is abandoned: its slot is freed, an ERROR with PROTO_ERR_TIMEOUT
+  * goes out if its header was in, and the parser hunts for the next magic.
+  * A host that died mid-frame then costs the next one nothing. 0 waits
+  * forever, as before.
+  */
+#ifndef APP_RX_FRAME_TIMEOUT_MS
+#define APP_RX_FRAME_TIMEOUT_MS 10U
+#endif
+
+/**
+  * Admission control: a USART2 frame that finds every slot its link may
+  * use taken is read past and refused with PROTO_ERR_BUSY, instead of
+  * waiting in the ring until it overruns. The refusal (ProtoBusy_t) says
+  * how many frames are ahead and, from the measured time per frame, when
+  * to try again; a host with other boards sends it to one of them. It goes
+  * out after the frame being processed, not after the whole queue. PING
+  * then promises no ring, only the slots. BATCH_IMAGE and CANCEL frames
+  * still wait in the ring for a slot.
+  */
+#ifndef APP_ADMISSION
+#define APP_ADMISSION 0
+#endif
+
+/**
+  * Link quality fallback on USART2 above the boot rate: over each window
+  * of APP_LINK_WINDOW frames and line errors (overrun, framing, noise),
+  * CRC failures and line errors per 1000 at or above this step the rate
+  * down to the next lower PROTO_BAUD_LADDER rate, unconfirmed like a
+  * SET_BAUD, so a host that does not follow within BAUD_CONFIRM_MS finds
+  * the board back at 115200. Stepping up is the host's, through SET_BAUD
+  * (stm32dc.linkq). 0 never steps down.
+  */
+#ifndef APP_LINK_FALLBACK_PERMILLE
+#define APP_LINK_FALLBACK_PERMILLE 50U
+#endif
+
+#ifndef APP_LINK_WINDOW
+#define APP_LINK_WINDOW 64U
+#endif
+
+/**
+  * Frame payloads moved from the USART2, SPI and USART1/USART6 rings into
+  * their slots by DMA2 stream 3 (dma_copy.h) instead of memcpy, so the
+  * parse in an interrupt or between two nodes of a run hands the bytes off
+  * and returns to the network. Runs shorter than APP_DMA_COPY_MIN bytes
+  * are copied by the CPU, as are all of them with APP_STREAM. 0 (off)
+  * leaves stream 3 free.
+  */
+#ifndef APP_DMA_COPY
+#define APP_DMA_COPY 0
+#endif
+
+#ifndef APP_DMA_COPY_MIN
+#define APP_DMA_COPY_MIN 64U
+#endif
+
+/* Clocks --------------------------------------------------------------------*/
+/**
+  * ClockProfile_t applied at boot after SystemClock_Config: 0 performance
+  * (100 MHz), 1 balanced (48 MHz), 2 low power (8 MHz HSE), 0xFF keeps the
+  * generated 96 MHz setup. The SET_CLOCK request switches at runtime. USB
+  * needs a 48 MHz PLLQ, which the 100 MHz profile cannot provide.
+  */
+#ifndef APP_CLOCK_PROFILE
+#if APP_USB_CDC
+#define APP_CLOCK_PROFILE 0xFF
+#else
+#define APP_CLOCK_PROFILE 0
+#endif
+#endif
+
+/**
+  * Fast boot: run setup on the 16 MHz HSI while HSE starts and the PLL
+  * locks instead of blocking in SystemClock_Config, leave out the ready
+  * banner (hosts wait for a PING reply anyway) and run the network once on
+  * a blank image before taking requests, so the first real one finds the
+  * flash cache and the runtime warm. STATS reports the cycles from main()
+  * to ready either way.
+  */
+#ifndef APP_FAST_BOOT
+#define APP_FAST_BOOT 0
+#endif
+
+#if APP_FAST_BOOT && APP_USB_CDC
+#error "The generated USB init needs the 48 MHz PLL clock before fast boot has it"
+#endif
+
+/* Idle ----------------------------------------------------------------------*/
+/**
+  * Sleep (WFI) whenever the main loop has nothing to do; USART2, DMA and
+  * SysTick interrupts wake it.
+  */
+#ifndef APP_IDLE_SLEEP
+#define APP_IDLE_SLEEP 1
+#endif
+
+/**
+  * Enter STOP mode after this many ms without RX activity, 0 disables it.
+  * A falling edge on USART2 RX (PA3) wakes the MCU; the bytes received
+  * while the clocks restart are lost, so the host must send a wake-up byte
+  * or rely on its request retries.
+  */
+#ifndef APP_IDLE_STOP_MS
+#define APP_IDLE_STOP_MS 0
+#endif
+
+#if APP_IDLE_STOP_MS && APP_USB_CDC
+#error "STOP mode would drop the USB connection"
+#endif
+
+/**
+  * Energy accounting (energy.h): PD11 high while the core is awake, awake
+  * and asleep time and inferences per clock profile, and ENERGY to read
+  * them as microjoules. Takes TIM5.
+  */
+#ifndef APP_ENERGY
+#define APP_ENERGY 0
+#endif
+
+/**
+  * Current model ENERGY reports with: supply in mV, then the supply current
+  * in uA per clock profile (performance, balanced, low-power, boot clock)
+  * awake and in WFI sleep. Defaults are the datasheet's typical values at
+  * 25 C with this firmware's peripherals on, rounded; replace them with the
+  * board's own from a power analyzer on the IDD jumper.
+  */
+#ifndef APP_ENERGY_MV
+#define APP_ENERGY_MV 3000U
+#endif
+
+#ifndef APP_ENERGY_RUN_UA
+#define APP_ENERGY_RUN_UA { 12500U, 6000U, 2000U, 12000U }
+#endif
+
+#ifndef APP_ENERGY_SLEEP_UA
+#define APP_ENERGY_SLEEP_UA { 5000U, 2500U, 900U, 4800U }
+#endif
+
+/* Memory --------------------------------------------------------------------*/
+/**
+  * No heap: every buffer is a static arena and _sbrk (sysmem.c) traps on any
+  * call, so a malloc, or newlib stdio allocating behind printf, shows up as a
+  * HardFault instead of silently taking SRAM. The RAM footprint is then fixed
+  * at link time; _Min_Heap_Size in the linker script can drop to 0.
+  */
+#ifndef APP_NO_HEAP
+#define APP_NO_HEAP 0
+#endif
+
+/**
+  * Bytes of SRAM for a copy of the small weight tensors, taken from flash
+  * in layer order while they fit, 0 to run every layer from flash. The
+  * digits network needs 6776 B for all but gemm_5's 100 KB weights: the
+  * conv kernels re-read theirs for every output pixel, where flash wait
+  * states are only hidden as far as the ART cache holds them.
+  */
+#ifndef APP_WEIGHT_CACHE
+#define APP_WEIGHT_CACHE 0
+#endif
+
+/**
+  * Bytes of the activation arena, 0 for the largest generated pool. Less
+  * only works where kernels leave the end of a pool unused: with
+  * APP_CONV_DIRECT the digits network stays below 4512 B of its 9712 B.
+  * A bind fails for a model with a buffer past the end, and KERNEL_BENCH
+  * refuses a library layer that would write there.
+  */
+#ifndef APP_ARENA_SIZE
+#define APP_ARENA_SIZE 0
+#endif
+
+#if APP_ARENA_SIZE % 16
+#error "APP_ARENA_SIZE is a multiple of 16 bytes"
+#endif
+
+/**
+  * Activation arenas, each of the size above. With more than one, queued
+  * CLASSIFY and BATCH_IMAGE images are converted straight into the input
+  * tensor of a free arena and their frame slot is released at once, so
+  * the links take in the next frames while the staged ones wait. The run
+  * then only rebinds the model to that arena (a warm init, no copy) and
+  * starts. Bare metal without APP_CANCEL or APP_STAI, which keep the
+  * frame or run outside models.c.
+  */
+#ifndef APP_ARENA_SLOTS
+#define APP_ARENA_SLOTS 1
+#endif
+
+/**
+  * SRAM the APP_ARENA_SLOTS arenas may take together, checked at build
+  * time. The rest of the 128 KB holds the frame slots, the DMA rings,
+  * the weight cache and the stacks; the linker has the final word.
+  */
+#ifndef APP_ARENA_BUDGET
+#define APP_ARENA_BUDGET (64U * 1024U)
+#endif
+
+#if APP_ARENA_SLOTS < 1 || APP_ARENA_SLOTS > 8
+#error "APP_ARENA_SLOTS is 1 to 8"
+#endif
+
+/**
+  * Receive the pipelined CLASSIFY into the activation arena instead of a
+  * second frame slot, saving one slot (about 3 KB). overlay_plan.h,
+  * generated from the c_info buffer lifetimes by python -m stm32dc.memplan,
+  * gives each model a region that is unused from one c-node to the end of
+  * the run. Once a CLASSIFY run reaches that node the next CLASSIFY is
+  * parsed from the USART2 ring into the region; until then, and for any
+  * other request, it waits in the ring. It runs next, reading its image
+  * into the input tensor before the arena is used again. Single link,
+  * bare metal, one arena.
+  */
+#ifndef APP_RX_OVERLAY
+#define APP_RX_OVERLAY 0
+#endif
+
+/* Models --------------------------------------------------------------------*/
+/**
+  * Also link network_time, the digits model generated with -O time instead
+  * of -O ram, as registry entry 1 so both builds can be compared on one
+  * board (SELECT_MODEL, bench --compare-models). Needs
+  * python -m stm32dc.generate --time first; costs the weights a second time
+  * in flash, and the shared arena grows to the larger of the two.
+  */
+#ifndef APP_MODEL_TIME
+#define APP_MODEL_TIME 0
+#endif
+
+/**
+  * Also link network_lite, the digits model generated for the lite graph
+  * runtime: one c-node calling the lite operators directly instead of a
+  * chain of layer objects walked by the generic runtime. Needs
+  * python -m stm32dc.generate --lite first. The custom kernels and the
+  * per-layer observer see a single node on it, so KERNEL_BENCH and
+  * PROFILE do not split it; bench --compare-models gives the run time
+  * and the dispatch overhead of the others, memmap the runtime text.
+  */
+#ifndef APP_MODEL_LITE
+#define APP_MODEL_LITE 0
+#endif
+
+/**
+  * Also link dqnn, the binarized digits model (notebook step 11, then
+  * python -m stm32dc.generate --dqnn), as the next registry entry. Its
+  * hidden convolution and both dense layers use 1-bit weights and
+  * activations, run by the runtime's DQNN kernels (lite_conv2d_dqnn,
+  * lite_dense_is1ws1): gemm_5 is 800 x 128 bits, 12.5 KB of flash against
+  * the int8 model's 100 KB. The custom kernels (APP_KERNEL_*) only match
+  * int8 layers and leave it to the library.
+  */
+#ifndef APP_MODEL_DQNN
+#define APP_MODEL_DQNN 0
+#endif
+
+/**
+  * Also link separable, the digits model with conv2d_2 split into a 3x3
+  * depthwise and a 1x1 pointwise convolution (notebook step 12, then
+  * python -m stm32dc.generate --separable), as the next registry entry.
+  * The pair costs 79 k MACC where conv2d_2 takes 558 k, through the
+  * runtime's lite_dw/lite_pw kernels. The APP_KERNEL_CONV kernel only
+  * matches conv2d_2, so it is not installed on this model; those for
+  * conv2d_0 and the dense layers still take the layers whose shapes match.
+  */
+#ifndef APP_MODEL_SEPARABLE
+#define APP_MODEL_SEPARABLE 0
+#endif
+
+/**
+  * Also link gap, the digits model with a 1x1 conv and global average pool
+  * head in place of reshape_4 and the 800 x 128 gemm_5 (notebook step 13,
+  * then python -m stm32dc.generate --gap), as the next registry entry.
+  * About 12 KB of weights against network's 107 KB, so linked alone as the
+  * CubeMX network it leaves the flash for a second, larger model. The
+  * conv kernels match its unchanged conv2d_0/conv2d_2; the gemm_5 kernel
+  * finds no layer to take.
+  */
+#ifndef APP_MODEL_GAP
+#define APP_MODEL_GAP 0
+#endif
+
+/**
+  * Also register shapes, the 4 class shapes classifier quantized to int8
+  * (notebook step 16, then python -m stm32dc.generate --shapes). It
+  * scales the 28x28 image up to the 64x64 it was trained on, nearest
+  * neighbour, inside the graph. About 6.5 KB of weights against the float
+  * original's 26 KB.
+  */
+#ifndef APP_MODEL_SHAPES
+#define APP_MODEL_SHAPES 0
+#endif
+
+/**
+  * Also register shapes_float, the same network left in float with int8
+  * I/O (python -m stm32dc.generate --shapes-float), the FPU baseline for
+  * shapes: bench --compare-models runs both on the same images. Its float
+  * activations, 31x31x8 x 4 B after conv2d_0 alone, size the shared arena
+  * past the digits model's; a benchmark build, not one to ship.
+  */
+#ifndef APP_MODEL_SHAPES_FLOAT
+#define APP_MODEL_SHAPES_FLOAT 0
+#endif
+
+/**
+  * Also register multihead, the conv2d_0/conv2d_2 backbone shared by a
+  * digits head (output 0) and an EMNIST balanced head (output 1), notebook
+  * step 17, then python -m stm32dc.generate --multihead. HEADS runs the
+  * backbone once and the heads a request names (heads.h); every other
+  * request on it runs the digits head alone. About 215 KB of weights, the
+  * backbone's 5 KB stored once.
+  */
+#ifndef APP_MODEL_MULTIHEAD
+#define APP_MODEL_MULTIHEAD 0
+#endif
+
+/**
+  * Also register small, the throughput model of notebook step 18 (python
+  * -m stm32dc.generate --small): it takes the 28x28 input like every other
+  * model but average pools it to 14x14 first, so its convolutions do about
+  * a seventh of the digits model's MACCs. CLASSIFY_SMALL sends it the
+  * 14x14 image, a quarter of the bytes, and the device doubles it back.
+  */
+#ifndef APP_MODEL_SMALL
+#define APP_MODEL_SMALL 0
+#endif
+
+/**
+  * Also register pertensor, notebook step 19's digits model trained and
+  * converted with one weight scale per layer (python -m stm32dc.generate
+  * --pertensor). Same layers as the digits model, so the kernels take it;
+  * with APP_KERNEL_PER_TENSOR they requantise it from one multiplier per
+  * layer.
+  */
+#ifndef APP_MODEL_PERTENSOR
+#define APP_MODEL_PERTENSOR 0
+#endif
+
+/**
+  * Accept weights for a registered model over the link (UPLOAD, upload.h)
+  * into the linker script's UPLOAD region, flash sector 7, and run that
+  * model on them once committed. python -m stm32dc.upload sends a
+  * generated network_data_params.c. The region is reserved whether or not
+  * this is set, which leaves 384 KB of flash for the image.
+  */
+#ifndef APP_UPLOAD
+#define APP_UPLOAD 0
+#endif
+
+/**
+  * Check the CRC of every committed upload (sector 7 and the external
+  * flash slots) after boot, in the background: DMA2 feeds the CRC unit a
+  * slice at a time between frames, and only the first run of a model
+  * still unchecked waits for the rest of its blob. A blob that fails is
+  * erased and its model goes back to its linked weights. LOG reports the
+  * cycles each check took.
+  */
+#ifndef APP_WEIGHT_CHECK
+#define APP_WEIGHT_CHECK 0
+#endif
+
+/**
+  * External SPI NOR flash on SPI4 (xflash.h) for models too large for the
+  * internal flash: registry entries in MODEL_LIST_XFLASH link their graph
+  * but not their weights, which UPLOAD writes to the NOR. Their large
+  * conv and dense layers run on tiled kernels (xmodel.h) that DMA the next
+  * tile of weights into SRAM while the current one computes; the rest of
+  * their weights is copied to SRAM when the model is selected. Needs
+  * APP_UPLOAD to program the chip.
+  */
+#ifndef APP_XFLASH
+#define APP_XFLASH 0
+#endif
+
+/**
+  * Bytes of each of the two weight tile buffers of APP_XFLASH. A tile is
+  * as many output channels as fit, so one 3x3 filter over the deepest
+  * input (1152 B at 128 channels) at least; larger tiles mean fewer reads
+  * to set up, each SPI read costs a 5 byte command.
+  */
+#ifndef APP_XFLASH_TILE
+#define APP_XFLASH_TILE 4608
+#endif
+
+/**
+  * SRAM pool of APP_XFLASH for the weights that do not stream (biases,
+  * batch norm constants, layers under 8 KB of weights). The EMNIST
+  * balanced classifier needs about 10.5 KB.
+  */
+#ifndef APP_XFLASH_RESIDENT
+#define APP_XFLASH_RESIDENT 12288
+#endif
+
+/**
+  * Also register balanced, the 47 class EMNIST balanced classifier
+  * (python -m stm32dc.generate --balanced), as the last registry entry:
+  * 354 KB of weights streamed from the external flash, 36 KB of
+  * activations. Upload balanced_weights.bin to it once
+  * (python -m stm32dc.upload --model N); until then selecting it fails
+  * and the digits model stays active.
+  */
+#ifndef APP_MODEL_BALANCED
+#define APP_MODEL_BALANCED 0
+#endif
+
+/**
+  * Minimal runtime image: register the models without their report
+  * (ai_<name>_get_report), so the runtime's report code is not linked.
+  * PING's model hash then reads zero and its MACC count 0; the arena and
+  * weight sizes come from the generated parameters instead.
+  * python -m stm32dc.memmap <map> --symbols shows what the runtime still
+  * links and why.
+  */
+#ifndef APP_RUNTIME_MIN
+#define APP_RUNTIME_MIN 0
+#endif
+
+/* Inference -----------------------------------------------------------------*/
+/**
+  * Run each inference in PendSV at the lowest interrupt priority instead of
+  * in the main loop. The USART2 and DMA interrupts preempt it, and while a
+  * run is in flight they also parse the received bytes into the free frame
+  * slot, so the next request is validated and queued by the time the
+  * current one finishes. Costs one exception entry per inference and its
+  * stack frame on top of the run's stack depth.
+  */
+#ifndef APP_AI_ASYNC
+#define APP_AI_ASYNC 0
+#endif
+
+/**
+  * CANCEL request: the host abandons a classify request it has sent by its
+  * seq, e.g. a live frame a newer stroke made stale. A queued request is
+  * answered CANCELLED without running. A running one is noticed at the
+  * next c-node boundary (X-CUBE-AI platform observer): the current run
+  * goes to its end, its result is dropped, no further run of the request
+  * starts and it is answered CANCELLED. A CANCEL acts on arrival, ahead
+  * of its place in the queue; in the bare-metal build the observer parses
+  * what arrived during the run so it is seen there. Costs an observer
+  * call per c-node.
+  */
+#ifndef APP_CANCEL
+#define APP_CANCEL 0
+#endif
+
+/**
+  * Run the network through the ST Edge AI contract of stai.h (stai_app.h):
+  * the runtime started with stai_runtime_init, runs submitted with
+  * STAI_MODE_ASYNC under APP_AI_ASYNC (else STAI_MODE_SYNC) and polled for
+  * STAI_DONE, and a STAI_EVENT_NODE_STOP callback after every c-node. In
+  * the bare-metal build without APP_AI_ASYNC that callback parses what
+  * arrived during the node, so the next frame is queued when the run
+  * ends. Costs an observer call per c-node.
+  */
+#ifndef APP_STAI
+#define APP_STAI 0
+#endif
+
+/**
+  * Split execution across two boards running the same model (split.h):
+  * STAGE FRONT runs the first c-nodes of an image and answers the tensor
+  * they leave, STAGE BACK runs the rest from that tensor and answers the
+  * class, so a host can keep one board on the convolutions and another on
+  * the dense layers of consecutive images. Costs a forward swap per c-node
+  * and request, and raises the reply buffers to PROTO_MAX_REPLY.
+  */
+#ifndef APP_SPLIT
+#define APP_SPLIT 0
+#endif
+
+/**
+  * Back board wired to this one: PROTO_LINK_USART1 (3) or PROTO_LINK_USART6
+  * (4) of APP_UART_LINKS. A FRONT with PROTO_STAGE_FORWARD then sends its
+  * tensor there as a BACK of the same seq instead of answering, and the
+  * back board's reply is relayed to the host, which only talks to this
+  * board. The back board takes it on any of its links. Raise
+  * APP_UART_LINKS_BAUD on both: the 800 B of the digits network take 70 ms
+  * at 115200. 0: the host relays the tensor itself.
+  */
+#ifndef APP_SPLIT_LINK
+#define APP_SPLIT_LINK 0
+#endif
+
+/**
+  * EMBED: classify an image and answer, with the class, the tensor the
+  * last dense layer reads (Model_Embedding: gemm_5's 128 int8 ReLU outputs
+  * on the digits network). A host can enrol new symbols from a few of
+  * these and look them up by nearest neighbour (stm32dc.knn) without
+  * retraining the network. Costs nothing per CLASSIFY.
+  */
+#ifndef APP_EMBED
+#define APP_EMBED 0
+#endif
+
+/**
+  * Nearest-neighbour head on the device (knn.h): up to this many labelled
+  * embeddings enrolled with KNN, and KNN CLASSIFY answering the nearest
+  * one's label with the network's class, 0 off. Each entry takes 129 B of
+  * SRAM; the table is lost on reset.
+  */
+#ifndef APP_KNN
+#define APP_KNN 0
+#endif
+
+#if APP_KNN > 255
+#error "APP_KNN counts entries in a byte"
+#endif
+
+/**
+  * Deterministic runs for control loops: while the network runs, BASEPRI
+  * holds off every interrupt of priority APP_DETERMINISTIC_BASEPRI and
+  * lower (the links and DMA streams at 5, PendSV) and SysTick's interrupt
+  * is off, its missed ticks added to the HAL tick afterwards. Received
+  * bytes keep landing in the DMA rings and are parsed once the run ends,
+  * as long as the run is shorter than a ring takes to fill; replies and
+  * APP_CANCEL pause until then. A critical interrupt above the threshold
+  * still preempts. Link with STM32F411VETX_FLASH_RAMFUNC.ld as well so
+  * the kernels run from SRAM and the ART cache state stops mattering.
+  * WCET measures the spread, with PROTO_WCET_OPEN for the same runs
+  * without it (bench --wcet-compare).
+  */
+#ifndef APP_DETERMINISTIC
+#define APP_DETERMINISTIC 0
+#endif
+
+#ifndef APP_DETERMINISTIC_BASEPRI
+#define APP_DETERMINISTIC_BASEPRI 5U
+#endif
+
+#if APP_DETERMINISTIC && (APP_DETERMINISTIC_BASEPRI < 1 || APP_DETERMINISTIC_BASEPRI > 15)
+#error "APP_DETERMINISTIC_BASEPRI is a priority from 1 to 15, 0 would mask nothing"
+#endif
+
+/* RTOS ----------------------------------------------------------------------*/
+/**
+  * CMSIS-RTOS2 build: a receive task parses frames into the slots, an
+  * inference task processes them and a transmit task sends the replies.
+  * Slot and reply buffer indices pass between them on message queues, so
+  * no frame is copied. Priorities rx > tx > inference, so a long inference
+  * never holds up the link. Requires FREERTOS (CMSIS_V2) enabled in
+  * tinyML.ioc with the HAL timebase moved off SysTick, and more than
+  * APP_RTOS_HEAP bytes of configTOTAL_HEAP_SIZE for the tasks and queues.
+  * USART2 and DMA stay at priority 5, the usual
+  * configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, as they signal the tasks.
+  */
+#ifndef APP_RTOS
+#define APP_RTOS 0
+#endif
+
+#define APP_RTOS_STACK_IO       768U    // rx and tx task stacks, bytes
+#define APP_RTOS_STACK_INFER    4096U   // inference task: request handling and the network
+#define APP_RTOS_HEAP           (2U * APP_RTOS_STACK_IO + APP_RTOS_STACK_INFER + 1024U)
+
+#if APP_RTOS && APP_AI_ASYNC
+#error "The RTOS kernel owns PendSV, the inference task already runs below the I/O"
+#endif
+
+#if APP_RTOS && APP_IDLE_STOP_MS
+#error "STOP mode is entered from the bare-metal main loop only"
+#endif
+
+#if APP_SPI_LINK && APP_IDLE_STOP_MS
+#error "SPI2 cannot receive in STOP mode"
+#endif
+
+#if APP_UART_LINKS && APP_IDLE_STOP_MS
+#error "only USART2 is woken from STOP mode"
+#endif
+
+/* Watchdog ------------------------------------------------------------------*/
+/**
+  * Independent watchdog timeout in ms (up to 4095), 0 disables it. The main
+  * loop and every network run feed it; in the RTOS build the receive task
+  * feeds it only while the inference task is idle or has been on its frame
+  * for less than the timeout. Error_Handler and HardFault then restart the
+  * board instead of spinning. A warm restart keeps the selected model,
+  * skips the ready banner and is counted in STATS (boot.h).
+  */
+#ifndef APP_WATCHDOG_MS
+#define APP_WATCHDOG_MS 0
+#endif
+
+/**
+  * Persisted settings (config.h): CONFIG SAVE keeps the baud rate, model,
+  * clock profile and ART flags in the RTC backup registers and every boot
+  * after applies them before the banner, so a host reconnecting at the
+  * saved rate skips the SET_BAUD, SELECT_MODEL and SET_CLOCK round trips.
+  * First bytes at the saved rate that make no intact frame within
+  * BAUD_CONFIRM_MS put USART2 back at 115200, as after a SET_BAUD the host
+  * did not follow. Nothing changes until a host saves.
+  */
+#ifndef APP_CONFIG
+#define APP_CONFIG 1
+#endif
+
+#if APP_WATCHDOG_MS && APP_IDLE_STOP_MS
+#error "The IWDG keeps counting in STOP mode and would reset the idle board"
+#endif
+
+#if APP_WATCHDOG_MS && APP_WATCHDOG_MS < 2500 && APP_UPLOAD
+#error "An UPLOAD sector erase stalls the core for up to 2 s, give the watchdog 2500 ms or more"
+#endif
+
+#if APP_SPLIT_LINK && (!APP_SPLIT || !APP_UART_LINKS || (APP_SPLIT_LINK != 3 && APP_SPLIT_LINK != 4))
+#error "APP_SPLIT_LINK forwards STAGE BACK over USART1 (3) or USART6 (4), enable APP_SPLIT and APP_UART_LINKS"
+#endif
+
+#if APP_SIM && !APP_UART_LL
+#error "APP_SIM replaces the DMA streams of the LL USART2 handlers, enable APP_UART_LL"
+#endif
+
+#if APP_SIM && (APP_IDLE_STOP_MS || APP_USB_CDC || APP_UART_LINKS || APP_SPI_LINK)
+#error "APP_SIM models USART2 only: no STOP mode, USB, SPI or extra UART links"
+#endif
+
+#if APP_HOST_UART != 2 && APP_HOST_UART != 1 && APP_HOST_UART != 6
+#error "APP_HOST_UART is USART 2, 1 or 6"
+#endif
+
+#if APP_HOST_UART != 2 && APP_UART_LINKS
+#error "APP_UART_LINKS needs USART1 and USART6, keep the host link on USART2"
+#endif
+
+#if APP_HOST_UART == 6 && APP_UART_FLOW
+#error "USART6 has no RTS/CTS pins on the F411, use APP_HOST_UART 1"
+#endif
+
+#if APP_HOST_UART != 2 && APP_IDLE_STOP_MS
+#error "The STOP mode wake-up is the EXTI line of PA3, USART2 RX"
+#endif
+
+#if APP_WEIGHT_CHECK && (!APP_UPLOAD || !APP_DMA_COPY)
+#error "APP_WEIGHT_CHECK checks uploaded weights with DMA2, enable APP_UPLOAD and APP_DMA_COPY"
+#endif
+
+#if APP_XFLASH && !APP_UPLOAD
+#error "APP_XFLASH weights are written by UPLOAD, enable APP_UPLOAD"
+#endif
+
+#if APP_MODEL_BALANCED && !APP_XFLASH
+#error "APP_MODEL_BALANCED streams its weights, enable APP_XFLASH"
+#endif
+
+#if APP_XFLASH && (APP_XFLASH_TILE % 4 || APP_XFLASH_TILE < 1152 || APP_XFLASH_RESIDENT % 4)
+#error "APP_XFLASH_TILE and APP_XFLASH_RESIDENT are words, a tile holds at least 1152 B"
+#endif
+
+#if APP_ARENA_SLOTS > 1 && (APP_RTOS || APP_CANCEL || APP_STAI)
+#error "APP_ARENA_SLOTS stages images on the bare metal loop, without APP_CANCEL and APP_STAI"
+#endif
+
+#if APP_RX_OVERLAY && (APP_USB_CDC || APP_SPI_LINK || APP_UART_LINKS || APP_RTOS || APP_CANCEL || \
+                       APP_STAI || APP_STREAM || APP_ARENA_SLOTS > 1)
+#error "APP_RX_OVERLAY needs USART2 alone on the bare metal loop, one arena, no APP_CANCEL, APP_STAI or APP_STREAM"
+#endif
+
+#if APP_MODEL_MULTIHEAD && APP_STAI
+#error "APP_MODEL_MULTIHEAD parks heads around model->run in AI_Run, without APP_STAI"
+#endif
+
+#if APP_DETERMINISTIC && (APP_RTOS || APP_AI_ASYNC || APP_STAI || APP_RX_OVERLAY)
+#error "APP_DETERMINISTIC masks the run on the bare metal loop through AI_Run, without APP_AI_ASYNC, APP_STAI or APP_RX_OVERLAY"
+#endif
+
+/* Kernels -------------------------------------------------------------------*/
+/**
+  * Run conv2d_2 (3x3 conv 16 -> 32, ReLU, 2x2 max pool, 72% of the MACCs)
+  * on the SMLAD kernel in kernels.c instead of the X-CUBE-AI library. A
+  * model without that exact layer keeps the library kernel. Results can
+  * differ from the library in the last bit of a few activations; with
+  * APP_PROFILE the KERNEL_BENCH request times both on the same image.
+  */
+#ifndef APP_KERNEL_CONV
+#define APP_KERNEL_CONV 0
+#endif
+
+/**
+  * conv2d_2 kernel: read the 13x13x16 input in place and expand only the
+  * four patches of one pool window (1152 B of SRAM) instead of two conv
+  * rows in the layer's 6 KB scratch0. The scratch buffers then go unused,
+  * which APP_ARENA_SIZE turns into SRAM. Each weight is read once per
+  * pool window rather than once per pooled row of five.
+  */
+#ifndef APP_CONV_DIRECT
+#define APP_CONV_DIRECT 0
+#endif
+
+#if APP_CONV_DIRECT && !APP_KERNEL_CONV
+#error "APP_CONV_DIRECT is a mode of the APP_KERNEL_CONV kernel"
+#endif
+
+/**
+  * Live drawing: conv2d_0 and conv2d_2 keep their last input and output
+  * (7 KB of SRAM) and recompute only the pooled output tiles whose
+  * receptive field covers pixels that changed since, so a stroke costs a
+  * few tiles instead of the whole image. conv2d_0 then runs on a kernel of
+  * its own (KERNEL_BENCH kernel 3). The first image after a bind, and every
+  * kernel bench, computes everything.
+  */
+#ifndef APP_KERNEL_INCREMENTAL
+#define APP_KERNEL_INCREMENTAL 0
+#endif
+
+#if APP_KERNEL_INCREMENTAL && !APP_KERNEL_CONV
+#error "APP_KERNEL_INCREMENTAL needs APP_KERNEL_CONV"
+#endif
+
+/**
+  * conv2d_0 kernel: a pooled tile whose 4x4 input window is all background
+  * (pixel 0) pools the bias alone, so it gets the per-channel constant
+  * requantised at bind instead of 320 MACs. Four word compares per tile
+  * find them; most of a digit's 169 tiles are blank. With APP_STREAM the
+  * test runs as the rows arrive. KERNEL_BENCH conv2d_0 reports the tiles
+  * computed.
+  */
+#ifndef APP_KERNEL_BLANK_TILES
+#define APP_KERNEL_BLANK_TILES 0
+#endif
+
+#if APP_KERNEL_BLANK_TILES && !APP_KERNEL_INCREMENTAL
+#error "APP_KERNEL_BLANK_TILES is a mode of the APP_KERNEL_INCREMENTAL conv2d_0 kernel"
+#endif
+
+/**
+  * Start a CLASSIFY or CLASSIFY_PROF image on USART2 while it is still
+  * arriving: the main loop reads the DMA position as it polls, and every
+  * 28-pixel row that lands runs the conv2d_0 and conv2d_2 rows it
+  * completes into the incremental caches. Once the frame is checked the
+  * network finds both layers up to date, so at low baud the reply follows
+  * the last byte by about the dense layers. Only a frame with nothing
+  * queued ahead of it and no run in flight is streamed.
+  */
+#ifndef APP_STREAM
+#define APP_STREAM 0
+#endif
+
+#if APP_STREAM && !APP_KERNEL_INCREMENTAL
+#error "APP_STREAM computes into the APP_KERNEL_INCREMENTAL caches"
+#endif
+
+#if APP_STREAM && APP_RTOS
+#error "APP_STREAM runs the kernels from the receive path of the main loop"
+#endif
+
+/**
+  * Multi-digit strips up to this many pixels wide (STRIP, 0 off): a 28 x W
+  * image, e.g. a numeric field, runs conv2d_0 and conv2d_2 once over its
+  * full width on the kernels above, and the dense head (a STAGE BACK,
+  * APP_SPLIT) once per 28-pixel window, at a stride of 4 pixels or a
+  * multiple. The two 2x2 pools make the conv output of a window at a
+  * multiple of 4 exactly 5 columns of the strip's, so overlapping windows
+  * share it and each costs only the dense layers. The two conv outputs
+  * take about 145 x W bytes of SRAM (16 KB at 112); the frame caps W at 112.
+  */
+#ifndef APP_STRIP
+#define APP_STRIP 0
+#endif
+
+#if APP_STRIP && (APP_STRIP < 28 || APP_STRIP > 112 || !APP_KERNEL_INCREMENTAL || !APP_SPLIT)
+#error "APP_STRIP is 28 to 112 pixels, on the APP_KERNEL_INCREMENTAL convs and the APP_SPLIT dense head"
+#endif
+
+/**
+  * Run gemm_5 (800 -> 128 dense, 25% of the MACCs) on a kernel reading a
+  * copy of its weights reordered in 4-row blocks, so each flash word feeds
+  * four outputs. 1: all blocks, 100 KB; 2: block-sparse, only the 4 x 4
+  * blocks holding a nonzero weight, which pays off with a network pruned
+  * in tinyML.ipynb (STEP 10); 3: 4-bit weights per row, 50 KB, unpacked
+  * in registers, so half the flash reads at a small accuracy cost (check
+  * with python -m stm32dc.evaluate). The copy in kernel_weights.c is
+  * written by python -m stm32dc.weights tinyML and adds to flash, the
+  * network's own weights stay for the library path; it is checked against
+  * them at bind and the library kernel is kept if they differ.
+  */
+#ifndef APP_KERNEL_DENSE
+#define APP_KERNEL_DENSE 0
+#endif
+
+/**
+  * The kernels above requantise with one multiplier per layer instead of
+  * one per output channel: the tables shrink to a single entry and every
+  * channel reads it at a fixed address. For per-tensor models such as
+  * pertensor (notebook STEP 19, APP_MODEL_PERTENSOR); a layer whose
+  * channels come out at different multipliers keeps the library kernel,
+  * which KERNEL_BENCH shows as no kernel bound.
+  */
+#ifndef APP_KERNEL_PER_TENSOR
+#define APP_KERNEL_PER_TENSOR 0
+#endif
+
+#if APP_KERNEL_PER_TENSOR && APP_KERNEL_DENSE == 3
+#error "APP_KERNEL_PER_TENSOR cannot hold the per-row steps of the 4-bit gemm_5 (APP_KERNEL_DENSE=3)"
+#endif
+
+/**
+  * Weight-stationary BATCH: each BATCH_IMAGE runs only the convs and
+  * stacks its conv2d_2 output, expanded (1.6 KB per image), until this
+  * many are waiting or the batch is complete. gemm_5 then runs for all of
+  * them in one pass over its weights, every flash word feeding each image,
+  * and gemm_6 and nl_7 per image. 0 runs every batch image whole. Needs the
+  * blocked gemm_5 copy (APP_KERNEL_DENSE=1) and the stages of APP_SPLIT.
+  */
+#ifndef APP_BATCH_DENSE
+#define APP_BATCH_DENSE 0
+#endif
+
+/**
+  * Skip gemm_5 input words (4 values) that are all at the zero point on
+  * the blocked kernel. ReLU and the max pool leave many of them on thin
+  * strokes: a list of the other words is built first, and only their
+  * weight words are read from flash. KERNEL_BENCH gemm_5 reports how many
+  * were read. Costs a 200-word scan per run, a loss on dense inputs.
+  */
+#ifndef APP_KERNEL_DENSE_SKIP
+#define APP_KERNEL_DENSE_SKIP 0
+#endif
+
+#if APP_KERNEL_DENSE_SKIP && APP_KERNEL_DENSE != 1
+#error "APP_KERNEL_DENSE_SKIP works on the blocked gemm_5 kernel, APP_KERNEL_DENSE=1"
+#endif
+
+#if APP_BATCH_DENSE && (APP_BATCH_DENSE > 16 || APP_KERNEL_DENSE != 1 || !APP_SPLIT)
+#error "APP_BATCH_DENSE is 1 to 16 images, on the blocked gemm_5 kernel (APP_KERNEL_DENSE=1) and APP_SPLIT"
+#endif
+
+/**
+  * Anytime classification (CLASSIFY_ANYTIME): the convs run as a STAGE
+  * FRONT, then gemm_5 in steps of KERNEL_ANYTIME_ROWS output rows, each
+  * step adding its rows to a running gemm_6. After each step the class is
+  * the best partial logit. The request stops at its margin, at its
+  * deadline, or once the rows left could not overturn the lead; the
+  * reply says how many steps it took. Needs the blocked gemm_5 copy
+  * (APP_KERNEL_DENSE=1) and the stages of APP_SPLIT.
+  */
+#ifndef APP_ANYTIME
+#define APP_ANYTIME 0
+#endif
+
+#if APP_ANYTIME && (APP_KERNEL_DENSE != 1 || !APP_SPLIT)
+#error "APP_ANYTIME steps through the blocked gemm_5 kernel (APP_KERNEL_DENSE=1) after an APP_SPLIT front stage"
+#endif
+
+/**
+  * Test-time augmentation when unsure (CLASSIFY_TTA): an image whose class
+  * leads the runner-up by less than the request's margin is classified
+  * again as shifted and zoomed copies made on the device (tta.c). The
+  * copies run the convs one by one and gemm_5 once for all of them, as a
+  * weight-stationary BATCH does, and their classes are voted. Confident
+  * images cost one inference. Needs APP_BATCH_DENSE, whose stack the
+  * copies use: at most that many run.
+  */
+#ifndef APP_TTA
+#define APP_TTA 0
+#endif
+
+#if APP_TTA && !APP_BATCH_DENSE
+#error "APP_TTA runs its variants through the batched gemm_5 of APP_BATCH_DENSE"
+#endif
+
+/**
+  * Skip the final softmax (nl_7) and return its int8 logits as the scores.
+  * Softmax is monotonic, so the predicted class is unchanged and the layer
+  * and its exp lookups leave every inference. TOPK scores and CASCADE
+  * margins are then logits: the TOPK reply carries the logits' scale and
+  * zero point, and PING sets PROTO_CAP_LOGITS.
+  */
+#ifndef APP_SOFTMAX_BYPASS
+#define APP_SOFTMAX_BYPASS 0
+#endif
+
+/**
+  * Run the convs, dense layers and int8 softmax of the bound model on
+  * CMSIS-NN (cmsisnn.h) instead of the X-CUBE-AI library, as an open
+  * backend to compare and tune. CMSIS-NN is not in the tree: it builds
+  * only once its Include and Source are copied to Drivers/CMSIS/NN. With
+  * APP_PROFILE, NN_BENCH times every mapped layer on both backends and
+  * counts the output bytes that differ. The layer kernels above swap
+  * the same layers, so only one of the two can be built.
+  */
+#ifndef APP_CMSIS_NN
+#define APP_CMSIS_NN 0
+#endif
+
+#if APP_CMSIS_NN && (APP_KERNEL_CONV || APP_KERNEL_DENSE || APP_SOFTMAX_BYPASS)
+#error "APP_CMSIS_NN replaces the library layers the APP_KERNEL_* kernels would"
+#endif
+
+/* Profiling -----------------------------------------------------------------*/
+/**
+  * Drive the four Discovery LEDs (PD12-PD15) as timing markers for a scope
+  * or logic analyser: reception, network run, USART2 TX and frame
+  * processing each hold one pin high (trace.h).
+  */
+#ifndef APP_TRACE_PINS
+#define APP_TRACE_PINS 0
+#endif
+
+/**
+  * Event trace over SWO (PB3): the same spans plus USART2 receive bursts,
+  * parser state changes and, with APP_PROFILE_LAYERS, every c-node, as ITM
+  * packets with local cycle timestamps. python -m stm32dc.swo turns a
+  * capture into a Chrome trace / Perfetto timeline. Set the probe to NRZ at
+  * APP_ITM_TRACE_BAUD, which must divide every profile's HCLK.
+  */
+#ifndef APP_ITM_TRACE
+#define APP_ITM_TRACE 0
+#endif
+
+#ifndef APP_ITM_TRACE_BAUD
+#define APP_ITM_TRACE_BAUD 2000000U
+#endif
+
+/**
+  * DWT cycle counts of each inference stage, returned by the
+  * CLASSIFY_PROFILED request. Costs a few cycles per stage when on.
+  */
+#ifndef APP_PROFILE
+#define APP_PROFILE 1
+#endif
+
+/**
+  * Per c-node cycle counts through the X-CUBE-AI platform observer, dumped
+  * by the PROFILE request. The observer callbacks slow inference slightly,
+  * so this is off by default. Needs APP_PROFILE.
+  */
+#ifndef APP_PROFILE_LAYERS
+#define APP_PROFILE_LAYERS 0
+#endif
+
+#if APP_PROFILE_LAYERS && !APP_PROFILE
+#error "APP_PROFILE_LAYERS needs the DWT counter started by APP_PROFILE"
+#endif
+
+/**
+  * Per c-node DWT event counts next to the cycles: extra cycles of
+  * multi-cycle instructions (CPI) and of loads and stores (LSU), exception
+  * overhead, sleep and folded instructions. PROFILE with
+  * PROTO_PROFILE_COUNTERS returns them. The counters are 8 bits wide, the
+  * device only sees each count modulo 256; with APP_ITM_TRACE their
+  * overflow packets also go out and stm32dc.swo counts them in full.
+  * Needs APP_PROFILE_LAYERS.
+  */
+#ifndef APP_PROFILE_COUNTERS
+#define APP_PROFILE_COUNTERS 0
+#endif
+
+#if APP_PROFILE_COUNTERS && !APP_PROFILE_LAYERS
+#error "APP_PROFILE_COUNTERS samples around each c-node, enable APP_PROFILE_LAYERS"
+#endif
+
+/**
+  * Flash benchmark build: the FLASH request switches the ART accelerator's
+  * prefetch buffer, instruction cache and data cache at runtime, so bench
+  * --flash-sweep can read per-layer cycles for each setting. Link with
+  * STM32F411VETX_FLASH_RAMFUNC.ld to also run the hot NetworkRuntime
+  * kernels from SRAM. Needs APP_PROFILE_LAYERS.
+  */
+#ifndef APP_FLASH_BENCH
+#define APP_FLASH_BENCH 0
+#endif
+
+#if APP_FLASH_BENCH && !APP_PROFILE_LAYERS
+#error "APP_FLASH_BENCH reports per-layer cycles, enable APP_PROFILE_LAYERS"
+#endif
+
+/**
+  * Self-test build: links the reference images of test_vectors.c (generate
+  * it with python -m stm32dc.vectors tinyML first) and answers SELFTEST by
+  * classifying all of them, with the accuracy and the cycles per network
+  * run. A regression gate for model and kernel changes that needs no host
+  * images: bench --selftest.
+  */
+#ifndef APP_SELFTEST
+#define APP_SELFTEST 0
+#endif
+
+/**
+  * WCET build: WCET runs the network many times under worst conditions,
+  * each run on a cold ART cache (flushed as after a clock change) and on
+  * an input of a rotating adversarial set (noise, full ink, checkerboard,
+  * the test vectors with APP_SELFTEST), with interrupts left on so that
+  * whatever the host streams meanwhile lands in the cycles. It answers the
+  * largest cycles per stage, per c-node too with APP_PROFILE_LAYERS, for
+  * bench --wcet to turn into a latency bound.
+  */
+#ifndef APP_WCET
+#define APP_WCET 0
+#endif
+
+/**
+  * Interrupt latency build: IRQ_LATENCY runs the network back to back, as
+  * WCET does, while TIM2 raises a compare interrupt at the host USART's
+  * priority every byte time of a given baud, give or take half of one at
+  * random. Each arrival is timestamped in hardware, so the handler reads
+  * how late it got in: what an RXNE byte would wait for behind critical
+  * sections and handlers of the same or higher priority. The reply's
+  * histogram and the longest run between ring drains give bench
+  * --irq-latency the highest safe baud for interrupt-driven and for DMA
+  * reception. Takes TIM2.
+  */
+#ifndef APP_IRQ_LATENCY
+#define APP_IRQ_LATENCY 0
+#endif
+
+/**
+  * Blank canvas short-circuit: CLASSIFY, CLASSIFY_PROF, CLASSIFY_PACKED and
+  * BATCH_IMAGE of an image whose pixels sum to less than this answer
+  * PROTO_CLASS_BLANK ("no digit") without running the network. One USADA8
+  * pass over the 784 bytes, about 200 cycles. The default is about 8 fully
+  * inked pixels, well under any drawn digit; 0 classifies every image.
+  */
+#ifndef APP_BLANK_INK
+#define APP_BLANK_INK (8U * 255U)
+#endif
+
+/**
+  * Memoised results: the last APP_MEMO images (CRC-32 of the pixels) and
+  * their classes. CLASSIFY, CLASSIFY_PACKED and BATCH_IMAGE of an image
+  * among them skip the network, and the reply flags it; a host retry after
+  * a timeout costs a CRC pass instead of an inference. 0 (off) keeps every
+  * request an inference, as the benchmarks and layer profiles expect.
+  */
+#ifndef APP_MEMO
+#define APP_MEMO 0
+#endif
+
+#if APP_MEMO > 255
+#error "APP_MEMO holds at most 255 results"
+#endif
+
+/**
+  * Delta gate: CLASSIFY, CLASSIFY_PACKED and BATCH_IMAGE of an image whose
+  * pixels differ from those of the last image the network ran on by less
+  * than this in sum (absolute differences) answer that image's class, and
+  * the reply flags it. Live canvases and camera frames that barely moved
+  * cost one USADA8 pass and a 784-byte copy of RAM instead of a run. About
+  * 4 * 255 tolerates sensor noise and a stray pixel; 0 (off) runs them all.
+  */
+#ifndef APP_DELTA_GATE
+#define APP_DELTA_GATE 0
+#endif
+
+/**
+  * Frame, inference and error counters plus log2 histograms of run and
+  * frame cycles since boot, returned (and optionally reset) by STATS.
+  * A few masked increments per frame; starts the DWT counter itself.
+  */
+#ifndef APP_STATS
+#define APP_STATS 1
+#endif
+
+/**
+  * CPU utilization in STATS: the shares of time spent asleep or idle, in
+  * the USART and DMA interrupt handlers, running the network, framing
+  * replies and everything else (load.h). Costs two masked DWT reads per
+  * interrupt, run and reply. Needs APP_STATS.
+  */
+#ifndef APP_LOAD
+#define APP_LOAD 0
+#endif
+
+#if APP_LOAD && !APP_STATS
+#error "APP_LOAD is reported by STATS, enable APP_STATS"
+#endif
+
+/**
+ * Telemetry push (telemetry.h): once TELEMETRY sets an interval, the board
+ * sends a compact frame of what changed since the last one, unasked, on
+ * the link that asked: frames, inferences, error counts, the busy share
+ * and the new buckets of the run histogram, about 30 bytes. A fleet is
+ * watched without polling STATS. Costs a counter sum per main-loop pass
+ * and a few hundred cycles per frame sent. Needs APP_STATS.
+ */
+#ifndef APP_TELEMETRY
+#define APP_TELEMETRY 0
+#endif
+
+/**
+ * Telemetry is sent ahead of the interval once this many receive or
+ * inference errors have been counted since the last frame; 0 waits for
+ * the interval.
+ */
+#ifndef APP_TELEMETRY_ERRORS
+#define APP_TELEMETRY_ERRORS 1
+#endif
+
+/**
+ * Telemetry is sent ahead of the interval after a network run of at least
+ * 2^APP_TELEMETRY_SLOW cycles (a run histogram bucket); 0 waits for the
+ * interval.
+ */
+#ifndef APP_TELEMETRY_SLOW
+#define APP_TELEMETRY_SLOW 0
+#endif
+
+/**
+ * Milliseconds between early telemetry frames at the least, so an error
+ * storm costs the link no more than a frame per this.
+ */
+#ifndef APP_TELEMETRY_MIN_MS
+#define APP_TELEMETRY_MIN_MS 100
+#endif
+
+#if APP_TELEMETRY && !APP_STATS
+#error "APP_TELEMETRY sends the STATS counters, enable APP_STATS"
+#endif
+#if APP_TELEMETRY_SLOW > 31
+#error "APP_TELEMETRY_SLOW is a run histogram bucket, 0 to 31"
+#endif
+
+/**
+  * Device timestamps for latency attribution (stamp.h): CLOCK_SYNC returns
+  * the microsecond clock at a request's arrival and reply, for the host to
+  * fit its offset and drift, and once asked to, replies to requests carry
+  * when the request arrived, when processing began, its network time and
+  * when the reply was framed. 16 bytes more per reply and a few register
+  * reads per frame.
+  */
+#ifndef APP_TIMESTAMPS
+#define APP_TIMESTAMPS 0
+#endif
+
+/**
+  * Deferred log: APP_LOG records of a log.h token and two raw arguments,
+  * stored in RAM by the code that has something to report and handed out
+  * by LOG. A record costs a masked 16 byte store, nothing is formatted or
+  * sent on the device; python -m stm32dc.devlog prints them. 0 (off)
+  * compiles every LOG() away.
+  */
+#ifndef APP_LOG
+#define APP_LOG 0
+#endif
+
+#if APP_LOG > 0xFFFF
+#error "APP_LOG holds at most 65535 records"
+#endif
+
+/* Identity ------------------------------------------------------------------*/
+/**
+  * Firmware version reported by PING next to the chip's unique ID, major
+  * in the high byte and minor in the low one. A release build sets it
+  * from the command line.
+  */
+#ifndef APP_FW_VERSION
+#define APP_FW_VERSION 0x0100U
+#endif
+
+#endif /* __APP_CONFIG_H */
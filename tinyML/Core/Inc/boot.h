@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file           : boot.h
+  * @brief          : Reset cause, boot counters and the independent watchdog
+  ******************************************************************************
+  * The RTC backup registers keep a boot count, the warm (watchdog or fault)
+  * restarts among them, the last fault and the model that was active, for
+  * as long as VDD or VBAT holds. With APP_WATCHDOG_MS set, Boot_Fail()
+  * replaces the spin of Error_Handler with a restart that comes back in
+  * milliseconds; after BOOT_MAX_RETRIES failed starts in a row it halts,
+  * and the watchdog is left off until a cold start.
+  ******************************************************************************
+  */
+
+#ifndef __BOOT_H
+#define __BOOT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "protocol.h"
+
+#define BOOT_MAX_RETRIES        3U      // failed starts in a row before halting
+
+#if APP_WATCHDOG_MS
+#define WATCHDOG_FEED()         Boot_WatchdogFeed()
+#else
+#define WATCHDOG_FEED()         ((void)0)
+#endif
+
+void Boot_Init(void);
+uint8_t Boot_IsWarm(void);
+uint8_t Boot_ResetCause(void);
+uint8_t Boot_LastFault(void);
+uint32_t Boot_Count(void);
+uint32_t Boot_WarmCount(void);
+uint8_t Boot_SavedModel(void);
+void Boot_SaveModel(uint8_t index);
+void Boot_ClockReady(void);
+void Boot_Ready(void);
+uint32_t Boot_ReadyCycles(void);
+uint32_t Boot_HsiCycles(void);
+void Boot_Fail(uint8_t fault) __attribute__((noreturn));
+
+void Boot_WatchdogStart(uint32_t ms);
+void Boot_WatchdogFeed(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOOT_H */
@@ -0,0 +1,19 @@
+/**
+  ******************************************************************************
+  * @file           : candidates.h
+  * @brief          : Models under measurement by python -m stm32dc.search
+  ******************************************************************************
+  * stm32dc.search rewrites this file with one row per candidate network it
+  * has generated (cand0, cand1, ... under X-CUBE-AI/App), builds, flashes
+  * and times them, then puts it back as below. They are registered after
+  * every other model. Outside a search the list is empty and the image is
+  * the same as without this file.
+  ******************************************************************************
+  */
+
+#ifndef __CANDIDATES_H
+#define __CANDIDATES_H
+
+#define MODEL_LIST_CANDIDATES(X)
+
+#endif /* __CANDIDATES_H */
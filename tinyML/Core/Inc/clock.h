@@ -0,0 +1,46 @@
+/**
+  ******************************************************************************
+  * @file           : clock.h
+  * @brief          : Runtime selectable system clock profiles
+  ******************************************************************************
+  */
+
+#ifndef __CLOCK_H
+#define __CLOCK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "app_config.h"
+
+// ART accelerator features, Clock_SetFlashAccel
+#define CLOCK_FLASH_PREFETCH    0x01U
+#define CLOCK_FLASH_ICACHE      0x02U
+#define CLOCK_FLASH_DCACHE      0x04U
+
+typedef enum {
+  CLOCK_PROFILE_PERFORMANCE = 0,       // 100 MHz PLL, scale 1, APB1 50 MHz
+  CLOCK_PROFILE_BALANCED,              // 48 MHz PLL, scale 3, USB capable
+  CLOCK_PROFILE_LOW_POWER,             // 8 MHz HSE, PLL off, scale 3
+  CLOCK_PROFILE_COUNT,
+  CLOCK_PROFILE_BOOT = 0xFF            // SystemClock_Config: 96 MHz, APB1 24 MHz
+} ClockProfile_t;
+
+int Clock_ApplyProfile(ClockProfile_t profile);
+ClockProfile_t Clock_GetProfile(void);
+void Clock_SetFlashAccel(uint8_t flags);
+uint8_t Clock_GetFlashAccel(void);
+
+#if APP_FAST_BOOT
+void Clock_BootStart(void);
+int Clock_BootPoll(void);
+int Clock_BootFinish(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CLOCK_H */
@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file           : cmsisnn.h
+  * @brief          : CMSIS-NN backend for the library layers (APP_CMSIS_NN)
+  ******************************************************************************
+  * CmsisNN_Install() walks a created network like Kernel_Install() and runs
+  * every layer it can map on CMSIS-NN instead of the closed X-CUBE-AI
+  * runtime, with the weights, biases and quantisation the generated
+  * network.c already holds:
+  *   conv + ReLU + max pool  arm_convolve_s8 two conv rows at a time into
+  *                           the layer's scratch1, arm_max_pool_s8 to one
+  *                           pooled row; scratch0 is the im2col buffer
+  *   dense                   arm_convolve_1x1_s8_fast, a 1x1 conv over a
+  *                           1x1xN input: the weights are per-channel,
+  *                           which arm_fully_connected_s8 is not
+  *   int8 softmax            arm_softmax_s8, TFLite's beta 1 parameters
+  * A layer that does not map, or whose scratch is too small, stays on the
+  * library. NN_BENCH times each mapped layer on both backends with the
+  * others on the library, so every layer sees the library's input, and
+  * counts the output bytes that differ.
+  *
+  * CMSIS-NN is not in the tree and must be added before APP_CMSIS_NN
+  * links: copy its Include and Source directories to Drivers/CMSIS/NN.
+  * Drivers is a source folder and Drivers/CMSIS/NN/Include is already on
+  * the include path, so nothing else changes; without the copy,
+  * cmsisnn.c stops at an #error rather than the link at missing symbols.
+  ******************************************************************************
+  */
+
+#ifndef __CMSISNN_H
+#define __CMSISNN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "protocol.h"
+#include "ai_platform.h"
+
+#define CMSISNN_CHANNELS        256U    // output channels of all mapped layers
+#define CMSISNN_BENCH_OUT_MAX   4096U   // largest layer output NN_BENCH compares
+
+#if APP_CMSIS_NN
+int CmsisNN_Install(ai_handle network);
+#if APP_PROFILE
+ProtoError_t CmsisNN_Bench(const uint8_t *img, int (*classify)(const uint8_t *img),
+                           ProtoNnBench_t *result, ProtoNnBenchLayer_t *layers);
+#endif
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CMSISNN_H */
@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * @file           : config.h
+  * @brief          : Link and clock settings kept across resets (APP_CONFIG)
+  ******************************************************************************
+  * CONFIG SAVE keeps the USART2 baud rate, the active model, the clock
+  * profile and the ART accelerator flags the board runs with in the RTC
+  * backup registers BKP4R to BKP7R (boot.c has BKP0R to BKP3R). main()
+  * applies them before the ready banner, so a reset brings the board back
+  * at the rate the host negotiated, on the model and clock it chose, and a
+  * host that opens the port at that rate is answered at once.
+  *
+  * The block lasts as long as VDD or VBAT holds, like the boot counters; a
+  * check word rejects one that a reset interrupted. The flash is not used:
+  * sector 7 is the UPLOAD region and a sector erase stalls the core for
+  * up to 2 s.
+  ******************************************************************************
+  */
+
+#ifndef __CONFIG_H
+#define __CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "protocol.h"
+
+#if APP_CONFIG
+int Config_Load(ProtoConfig_t *config);
+void Config_Save(const ProtoConfig_t *config);
+void Config_Clear(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CONFIG_H */
@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file           : dma_copy.h
+  * @brief          : Memory-to-memory copies on DMA2 stream 3 (APP_DMA_COPY)
+  ******************************************************************************
+  * Only DMA2 moves memory to memory on the F411; stream 3 is the one no
+  * link or the external flash uses. Copies run one after another in the
+  * order they were started, each calling its done callback from the
+  * stream's interrupt once its bytes have landed. Word transfers when the
+  * source, destination and length are all multiples of 4, bytes otherwise.
+  * A transfer error finishes the copy with memcpy, so done always means
+  * the destination holds the data.
+  *
+  * The receive path hands frame payloads to it (Proto parser copy hook):
+  * the RX interrupt, or the parse between two nodes of a run, then returns
+  * at once instead of copying hundreds of bytes off the time of the
+  * network, and the frame is only processed once its copies are done.
+  *
+  * DmaCopy_Feed writes words to one register instead, the CRC unit's data
+  * register for the boot-time weight check (upload.h).
+  ******************************************************************************
+  */
+
+#ifndef __DMA_COPY_H
+#define __DMA_COPY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+
+// Copies waiting or in flight; DmaCopy_Start refuses more
+#define DMA_COPY_QUEUE 8U
+
+typedef void (*DmaCopyDone_t)(void *arg);
+
+void DmaCopy_Init(void);
+int DmaCopy_Start(void *dst, const void *src, uint32_t len, DmaCopyDone_t done, void *arg);
+int DmaCopy_Feed(volatile uint32_t *reg, const void *src, uint32_t words, DmaCopyDone_t done, void *arg);
+uint8_t DmaCopy_Busy(void);
+void DmaCopy_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DMA_COPY_H */
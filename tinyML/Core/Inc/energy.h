@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @file           : energy.h
+  * @brief          : Awake and asleep time per clock profile (APP_ENERGY)
+  ******************************************************************************
+  * PD11 is high while the core runs and low while Idle() waits in WFI, so a
+  * current probe or power analyzer triggered on it splits the supply trace
+  * into active and idle windows, and the span from one falling edge to the
+  * next is what a request costs.
+  *
+  * The firmware keeps the same split itself, per clock profile: awake time
+  * in DWT cycles of that profile's HCLK, asleep time from TIM5 running free
+  * at 1 MHz (the cycle counter stops with the core clock in WFI, TIM5 does
+  * not), and the inferences run. ENERGY turns them into microjoules with the
+  * current model of app_config.h (APP_ENERGY_MV, APP_ENERGY_RUN_UA,
+  * APP_ENERGY_SLEEP_UA): datasheet typicals until they are replaced with
+  * what the analyzer measured on this board.
+  *
+  * STOP mode (APP_IDLE_STOP_MS) stops TIM5 as well; its time is in neither
+  * column, it draws tens of microamps against milliamps for the others.
+  ******************************************************************************
+  */
+
+#ifndef __ENERGY_H
+#define __ENERGY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "protocol.h"
+#include "clock.h"
+
+#define ENERGY_PORT             GPIOD
+#define ENERGY_PIN              GPIO_PIN_11
+#define ENERGY_TIMER            TIM5
+#define ENERGY_SLOTS            (CLOCK_PROFILE_COUNT + 1U)
+
+#if APP_ENERGY
+void Energy_Init(void);
+void Energy_ClockChanged(void);
+void Energy_Sleep(void);
+void Energy_Wake(void);
+void Energy_Inference(void);
+uint8_t Energy_Read(ProtoEnergy_t *header, ProtoEnergySlot_t *slots);
+void Energy_Reset(void);
+
+#define ENERGY_INFERENCE()      Energy_Inference()
+#else
+#define ENERGY_INFERENCE()      ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ENERGY_H */
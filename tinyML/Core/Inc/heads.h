@@ -0,0 +1,38 @@
+/**
+  ******************************************************************************
+  * @file           : heads.h
+  * @brief          : Some heads of a multi-head network, one backbone pass
+  ******************************************************************************
+  * A network with several outputs (APP_MODEL_MULTIHEAD: digits and EMNIST
+  * balanced on one conv backbone) runs every c-node on each run. Before a
+  * run, Heads_Begin() parks the forwards of the c-nodes that only lead to
+  * outputs the request does not want, as split.c does for the other stage,
+  * so the backbone runs once for whichever heads are asked for and the
+  * observer still sees every c-node.
+  *
+  * Which output a c-node leads to comes from the graph itself: walking the
+  * chain backwards, a c-node whose output tensor another c-node reads
+  * feeds that one's heads, and one nothing reads feeds the output whose
+  * buffer it writes.
+  ******************************************************************************
+  */
+
+#ifndef __HEADS_H
+#define __HEADS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "ai_platform.h"
+
+int Heads_Begin(ai_handle network, const ai_buffer *outputs, uint8_t count, uint8_t heads);
+void Heads_End(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HEADS_H */
@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file           : host_uart.h
+  * @brief          : USART, pins and DMA streams of the host link (APP_HOST_UART)
+  ******************************************************************************
+  * The host link is CubeMX's USART2 (huart2, hdma_usart2_rx/_tx) whichever
+  * peripheral runs it; host_uart.c moves it at boot, and these map it to
+  * the hardware:
+  *
+  *   USART2  PA2 TX, PA3 RX (AF7), DMA1 stream 5 RX, stream 6 TX, ch 4  APB1
+  *   USART1  PB6 TX, PB7 RX (AF7), DMA2 stream 2 RX, stream 7 TX, ch 4  APB2
+  *   USART6  PC6 TX, PC7 RX (AF8), DMA2 stream 1 RX, stream 6 TX, ch 5  APB2
+  *
+  * APB1 runs at HCLK/4 and APB2 at HCLK, so at 96 MHz an APB2 USART takes
+  * 6 Mbaud with OVER16 and 12 Mbaud with OVER8 against USART2's 1.5 and 3.
+  * The pins and streams are those of uart_link.c; flow control is on
+  * PA0/PA1 for USART2, PA11/PA12 for USART1, USART6 has none on the F411.
+  ******************************************************************************
+  */
+
+#ifndef __HOST_UART_H
+#define __HOST_UART_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "app_config.h"
+#include "stm32f4xx_hal.h"
+
+#if APP_HOST_UART == 1
+#define HOST_USART                  USART1
+#define HOST_USART_IRQn             USART1_IRQn
+#define HOST_USART_IRQHandler       USART1_IRQHandler
+#define HOST_USART_CLK_ENABLE()     __HAL_RCC_USART1_CLK_ENABLE()
+#define HOST_USART_CLK_DISABLE()    __HAL_RCC_USART1_CLK_DISABLE()
+#define HOST_PCLK_FREQ()            HAL_RCC_GetPCLK2Freq()
+#define HOST_GPIO                   GPIOB
+#define HOST_GPIO_CLK_ENABLE()      __HAL_RCC_GPIOB_CLK_ENABLE()
+#define HOST_PINS                   (GPIO_PIN_6 | GPIO_PIN_7)
+#define HOST_RX_PIN                 GPIO_PIN_7
+#define HOST_AF                     GPIO_AF7_USART1
+#define HOST_FLOW_GPIO              GPIOA
+#define HOST_FLOW_PINS              (GPIO_PIN_11 | GPIO_PIN_12)
+#define HOST_DMA                    DMA2
+#define HOST_DMA_CLK_ENABLE()       __HAL_RCC_DMA2_CLK_ENABLE()
+#define HOST_DMA_CHANNEL            DMA_CHANNEL_4
+#define HOST_DMA_RX_N               2
+#define HOST_DMA_TX_N               7
+#elif APP_HOST_UART == 6
+#define HOST_USART                  USART6
+#define HOST_USART_IRQn             USART6_IRQn
+#define HOST_USART_IRQHandler       USART6_IRQHandler
+#define HOST_USART_CLK_ENABLE()     __HAL_RCC_USART6_CLK_ENABLE()
+#define HOST_USART_CLK_DISABLE()    __HAL_RCC_USART6_CLK_DISABLE()
+#define HOST_PCLK_FREQ()            HAL_RCC_GetPCLK2Freq()
+#define HOST_GPIO                   GPIOC
+#define HOST_GPIO_CLK_ENABLE()      __HAL_RCC_GPIOC_CLK_ENABLE()
+#define HOST_PINS                   (GPIO_PIN_6 | GPIO_PIN_7)
+#define HOST_RX_PIN                 GPIO_PIN_7
+#define HOST_AF                     GPIO_AF8_USART6
+#define HOST_DMA                    DMA2
+#define HOST_DMA_CLK_ENABLE()       __HAL_RCC_DMA2_CLK_ENABLE()
+#define HOST_DMA_CHANNEL            DMA_CHANNEL_5
+#define HOST_DMA_RX_N               1
+#define HOST_DMA_TX_N               6
+#else
+#define HOST_USART                  USART2
+#define HOST_USART_IRQn             USART2_IRQn
+#define HOST_USART_IRQHandler       USART2_IRQHandler
+#define HOST_USART_CLK_ENABLE()     __HAL_RCC_USART2_CLK_ENABLE()
+#define HOST_USART_CLK_DISABLE()    __HAL_RCC_USART2_CLK_DISABLE()
+#define HOST_PCLK_FREQ()            HAL_RCC_GetPCLK1Freq()
+#define HOST_GPIO                   GPIOA
+#define HOST_GPIO_CLK_ENABLE()      __HAL_RCC_GPIOA_CLK_ENABLE()
+#define HOST_PINS                   (GPIO_PIN_2 | GPIO_PIN_3)
+#define HOST_RX_PIN                 GPIO_PIN_3
+#define HOST_AF                     GPIO_AF7_USART2
+#define HOST_FLOW_GPIO              GPIOA
+#define HOST_FLOW_PINS              (GPIO_PIN_0 | GPIO_PIN_1)
+#define HOST_DMA                    DMA1
+#define HOST_DMA_CLK_ENABLE()       __HAL_RCC_DMA1_CLK_ENABLE()
+#define HOST_DMA_CHANNEL            DMA_CHANNEL_4
+#define HOST_DMA_RX_N               5
+#define HOST_DMA_TX_N               6
+#endif
+
+// DMAx_Streamn, its IRQ and handler, and the LL stream and flag calls,
+// from the controller and stream numbers above
+#define HOST_CAT_(a, b, c)          a##b##c
+#define HOST_CAT(a, b, c)           HOST_CAT_(a, b, c)
+#if APP_HOST_UART == 1 || APP_HOST_UART == 6
+#define HOST_DMA_STREAM(n)          HOST_CAT(DMA2_Stream, n, )
+#define HOST_DMA_IRQn(n)            HOST_CAT(DMA2_Stream, n, _IRQn)
+#define HOST_DMA_IRQHandler(n)      HOST_CAT(DMA2_Stream, n, _IRQHandler)
+#else
+#define HOST_DMA_STREAM(n)          HOST_CAT(DMA1_Stream, n, )
+#define HOST_DMA_IRQn(n)            HOST_CAT(DMA1_Stream, n, _IRQn)
+#define HOST_DMA_IRQHandler(n)      HOST_CAT(DMA1_Stream, n, _IRQHandler)
+#endif
+#define HOST_LL_STREAM(n)           HOST_CAT(LL_DMA_STREAM_, n, )
+#define HOST_LL_FLAG(call, n)       HOST_CAT(LL_DMA_, call, n)(HOST_DMA)
+
+#define HOST_DMA_RX_STREAM          HOST_DMA_STREAM(HOST_DMA_RX_N)
+#define HOST_DMA_TX_STREAM          HOST_DMA_STREAM(HOST_DMA_TX_N)
+#define HOST_DMA_RX_IRQn            HOST_DMA_IRQn(HOST_DMA_RX_N)
+#define HOST_DMA_TX_IRQn            HOST_DMA_IRQn(HOST_DMA_TX_N)
+#define HOST_DMA_RX_IRQHandler      HOST_DMA_IRQHandler(HOST_DMA_RX_N)
+#define HOST_DMA_TX_IRQHandler      HOST_DMA_IRQHandler(HOST_DMA_TX_N)
+#define HOST_LL_RX_STREAM           HOST_LL_STREAM(HOST_DMA_RX_N)
+#define HOST_LL_TX_STREAM           HOST_LL_STREAM(HOST_DMA_TX_N)
+
+#if APP_HOST_UART != 2
+void HostUart_Init(UART_HandleTypeDef *huart);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_UART_H */
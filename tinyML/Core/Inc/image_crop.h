@@ -0,0 +1,33 @@
+/**
+  ******************************************************************************
+  * @file           : image_crop.h
+  * @brief          : Area resampling of CLASSIFY_CROP images to the model input
+  ******************************************************************************
+  * Payload: width (1) | height (1) | width x height uint8 pixels, row major
+  *
+  * The crop is framed the way the EMNIST images were made: centred in a
+  * square of its longer side keeping the aspect ratio, padded with a thin
+  * border, area averaged to 28x28 and stretched so the brightest pixel is
+  * 255. Host side preprocess.normalize() does the same in floating point.
+  ******************************************************************************
+  */
+
+#ifndef __IMAGE_CROP_H
+#define __IMAGE_CROP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "protocol.h"
+
+#define CROP_OUT_SIZE           28U
+#define CROP_HEADER_SIZE        2U
+
+ProtoError_t Crop_Load(const uint8_t *payload, uint16_t len, int8_t *input);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IMAGE_CROP_H */
@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file           : image_pack.h
+  * @brief          : Decoder for the compressed CLASSIFY_PACKED image encodings
+  ******************************************************************************
+  * Payload: encoding (1) | tag (1) | encoded pixels
+  *
+  *   PROTO_PACK_RAW     784 pixels
+  *   PROTO_PACK_ZRLE    nonzero pixels literal, 0x00 n = run of n (1-255) zeros
+  *   PROTO_PACK_BITMAP  98 B bitmap (bit i set = pixel i nonzero, LSB first),
+  *                      then the nonzero pixels in order
+  *   PROTO_PACK_DELTA   base tag (1), 98 B bitmap of pixels that differ from
+  *                      the image tagged base, then their new values
+  *   PROTO_PACK_BITS1   98 B, bit i (LSB first) set = pixel i is 255, else 0
+  *   PROTO_PACK_BITS4   392 B, pixel 2i in the low nibble of byte i, 2i+1 in
+  *                      the high one, pixel = nibble * 17
+  *   PROTO_PACK_STROKES pen radius in 1/8 units (1), then per stroke a point
+  *                      count n (1-255) and n x, y (1 + 1); units span the
+  *                      canvas's longer side in 0-255
+  *
+  * Strokes are rasterised as the host's StrokeRecorder does: the ink's
+  * bounding box, pen included, centred in a square frame with a 2/128
+  * border each side, each pixel covered by its distance to the nearest
+  * segment with a one pixel anti-aliased edge. Integer arithmetic in 1/256
+  * pixel. The last decoded image and its tag are kept as the base for DELTA.
+  ******************************************************************************
+  */
+
+#ifndef __IMAGE_PACK_H
+#define __IMAGE_PACK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "protocol.h"
+
+#define PACK_IMAGE_SIZE         784U
+#define PACK_BITMAP_SIZE        (PACK_IMAGE_SIZE / 8U)
+#define PACK_SIDE               28U
+
+ProtoError_t Pack_Decode(const uint8_t *payload, uint16_t len);
+const uint8_t *Pack_Image(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IMAGE_PACK_H */
@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @file           : irqlat.h
+  * @brief          : RX interrupt latency under inference load (APP_IRQ_LATENCY)
+  ******************************************************************************
+  * The time from RXNE to the handler's entry is what decides whether
+  * interrupt-driven reception keeps up, but the flag's rising edge leaves
+  * no trace the CPU can read. TIM2 stands in for it: its channel 1 compare
+  * fires at the host USART's NVIC priority, a byte time of the benchmark's
+  * baud apart on average (half to one and a half at random, so the
+  * arrivals do not lock onto the network's loops), and the handler's first
+  * read of the counter less the compare value is the latency, in timer
+  * ticks of a whole number of core cycles each.
+  *
+  * A byte in RDR must be read before the next one is complete, a byte time
+  * later, or it is overwritten (ORE): the largest latency plus the
+  * handler's own byte store bounds the baud of interrupt reception. DMA
+  * takes each byte in hardware, there the limit is the ring filling while
+  * the main loop is in a run.
+  ******************************************************************************
+  */
+
+#ifndef __IRQLAT_H
+#define __IRQLAT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "protocol.h"
+
+#define IRQLAT_TIMER            TIM2
+#define IRQLAT_IRQn             TIM2_IRQn
+
+#if APP_IRQ_LATENCY
+int IrqLat_Start(uint32_t baud);
+void IrqLat_Stop(void);
+void IrqLat_Read(ProtoIrqLat_t *reply, uint32_t *buckets);
+void IrqLat_IRQHandler(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IRQLAT_H */
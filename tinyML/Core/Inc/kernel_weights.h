@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file           : kernel_weights.h
+  * @brief          : Weights in the layouts of the kernels in kernels.c
+  ******************************************************************************
+  * kernel_weights.c is generated by python -m stm32dc.weights tinyML from
+  * the network's weights blob; rerun it after regenerating the network.
+  *
+  *   kernel_gemm_5_blocked  gemm_5 [128][800] int8 in blocks of 4 rows:
+  *                          word (b * 200 + k) * 4 + r holds bytes 4k..4k+3
+  *                          of row 4b + r
+  *   kernel_gemm_5_sparse   the 4 x 4 byte blocks of that layout with a
+  *                          nonzero weight, lane r of row block b being
+  *                          output row rows[4b + r]; blocks ptr[b] to
+  *                          ptr[b + 1] - 1 belong to row block b, block j
+  *                          is at word column cols[j]
+  *   kernel_gemm_5_int4     gemm_5 4-bit per row in the same 4-row blocks:
+  *                          word (b * 100 + j) * 4 + r holds columns
+  *                          8j..8j+3 of row 4b + r in the high nibbles of
+  *                          bytes 0..3 and 8j+4..8j+7 in the low ones, the
+  *                          weight times step[r]; bias[r] is in 16 / step[r]
+  *                          units of the network's bias
+  ******************************************************************************
+  */
+
+#ifndef __KERNEL_WEIGHTS_H
+#define __KERNEL_WEIGHTS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+
+#define KERNEL_GEMM_5_ROWS      128U
+#define KERNEL_GEMM_5_COLS      800U
+#define KERNEL_DENSE_BLOCK      4U      // rows interleaved per block
+
+// APP_KERNEL_DENSE weight layouts
+#define KERNEL_DENSE_BLOCKED    1
+#define KERNEL_DENSE_SPARSE     2
+#define KERNEL_DENSE_INT4       3
+
+#if APP_KERNEL_DENSE == KERNEL_DENSE_BLOCKED
+extern const uint32_t kernel_gemm_5_blocked[KERNEL_GEMM_5_ROWS * KERNEL_GEMM_5_COLS / 4U];
+#elif APP_KERNEL_DENSE == KERNEL_DENSE_SPARSE
+extern const uint8_t kernel_gemm_5_sparse_rows[KERNEL_GEMM_5_ROWS];
+extern const uint16_t kernel_gemm_5_sparse_ptr[KERNEL_GEMM_5_ROWS / KERNEL_DENSE_BLOCK + 1U];
+extern const uint8_t kernel_gemm_5_sparse_cols[];
+extern const uint32_t kernel_gemm_5_sparse[];
+#elif APP_KERNEL_DENSE == KERNEL_DENSE_INT4
+extern const uint32_t kernel_gemm_5_int4[KERNEL_GEMM_5_ROWS * KERNEL_GEMM_5_COLS / 8U];
+extern const int32_t kernel_gemm_5_int4_bias[KERNEL_GEMM_5_ROWS];
+extern const float kernel_gemm_5_int4_step[KERNEL_GEMM_5_ROWS];
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __KERNEL_WEIGHTS_H */
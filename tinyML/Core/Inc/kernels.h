@@ -0,0 +1,109 @@
+/**
+  ******************************************************************************
+  * @file           : kernels.h
+  * @brief          : Hand-written int8 kernels in place of X-CUBE-AI layers
+  ******************************************************************************
+  * Kernel_Install() walks a created network and swaps the forward function
+  * of each layer a kernel here matches exactly (shapes, strides, pooling,
+  * quantisation). Layers that do not match keep the library kernel, so a
+  * regenerated or different model still runs, just without the speed-up.
+  *
+  *   APP_KERNEL_CONV  3x3 valid conv 13x13x16 -> 32, ReLU, 2x2/2 max pool
+  *                    (conv2d_2 of the digits network): im2col into the
+  *                    layer's scratch0, SMLAD dual 16-bit MACs, pooling on
+  *                    the accumulators before requantisation
+  *   APP_KERNEL_DENSE 800 -> 128 dense (gemm_5): weights streamed from the
+  *                    4-row blocked copy in kernel_weights.c (int8,
+  *                    block-sparse or 4-bit), one input expansion into
+  *                    scratch0 shared by all rows
+  *   APP_KERNEL_INCREMENTAL conv2d_0 (3x3 valid conv 28x28x1 -> 16, ReLU,
+  *                    2x2/2 max pool) on a kernel too, and both convs
+  *                    diff their input against the last one and recompute
+  *                    only the pooled tiles it reaches
+  *   APP_KERNEL_BLANK_TILES conv2d_0 tiles over background only copy the
+  *                    requantised bias instead of running their MACs
+  *   APP_SOFTMAX_BYPASS the final int8 softmax (nl_7): its logits are
+  *                    copied to the output unchanged, softmax being
+  *                    monotonic the argmax is the same
+  *   APP_BATCH_DENSE  gemm_5 on the blocked copy for a stack of images
+  *                    at once, each weight block unpacked once and fed
+  *                    to all of them
+  *   APP_ANYTIME      gemm_5 a few rows at a time on the blocked copy,
+  *                    gemm_6 accumulated from the rows done so far
+  *   APP_STRIP        both convs over a 28 x W strip at once, the
+  *                    output of every window at a multiple of 4 pixels
+  *                    a slice of it
+  ******************************************************************************
+  */
+
+#ifndef __KERNELS_H
+#define __KERNELS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "app_config.h"
+#include "protocol.h"
+#include "ai_platform.h"
+
+// Kernel slots, numbered as on the wire
+#define KERNEL_CONV             PROTO_KERNEL_CONV
+#define KERNEL_DENSE            PROTO_KERNEL_DENSE
+#define KERNEL_SOFTMAX          PROTO_KERNEL_SOFTMAX
+#define KERNEL_CONV0            PROTO_KERNEL_CONV0
+#define KERNEL_COUNT            4U
+
+// Any layer swap compiled in
+#define KERNEL_ANY              (APP_KERNEL_CONV || APP_KERNEL_DENSE || APP_SOFTMAX_BYPASS)
+
+int Kernel_Install(ai_handle network);
+int Kernel_Logits(float *scale, int8_t *zero_point);
+#if APP_ARENA_SIZE
+uint32_t Kernel_ArenaEnd(ai_handle network);
+#endif
+
+#if APP_KERNEL_INCREMENTAL
+void Kernel_Invalidate(void);
+#endif
+
+#if APP_BATCH_DENSE || APP_ANYTIME
+#define KERNEL_DENSE_FEATURES   800U    // gemm_5 input, the 5x5x32 conv2d_2 output
+#define KERNEL_DENSE_OUTPUTS    128U
+#endif
+
+#if APP_BATCH_DENSE
+int Kernel_DenseStack(uint32_t slot, const int8_t *in);
+int Kernel_DenseBatch(uint32_t count, int8_t *out);
+#endif
+
+#if APP_ANYTIME
+#define KERNEL_ANYTIME_ROWS     16U     // gemm_5 rows per step
+#define KERNEL_ANYTIME_STEPS    (KERNEL_DENSE_OUTPUTS / KERNEL_ANYTIME_ROWS)
+
+int Kernel_AnytimeBegin(const int8_t *in);
+int Kernel_AnytimeStep(uint32_t step, uint8_t *margin, uint8_t *settled);
+#endif
+
+#if APP_STRIP
+#define KERNEL_STRIP_FEATURES   800U    // conv2d_2 output of one window, 5x5x32
+
+uint32_t Kernel_Strip(const uint8_t *img, uint32_t w);
+void Kernel_StripWindow(uint32_t col, int8_t *out);
+#endif
+
+#if APP_STREAM
+void Kernel_StreamBegin(void);
+void Kernel_StreamRows(const uint8_t *img, uint32_t rows);
+#endif
+
+#if KERNEL_ANY && APP_PROFILE
+ProtoError_t Kernel_Bench(uint8_t kernel, const uint8_t *img, int (*classify)(const uint8_t *img),
+                          ProtoKernelBench_t *result);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __KERNELS_H */
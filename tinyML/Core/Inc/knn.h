@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file           : knn.h
+  * @brief          : Nearest-neighbour head over enrolled embeddings
+  ******************************************************************************
+  * With APP_KNN the device keeps up to APP_KNN labelled embeddings of the
+  * active model (Model_Embedding, gemm_5's 128 outputs on the digits
+  * network) in SRAM, enrolled with KNN ENROLL, and KNN CLASSIFY answers the
+  * label of the one nearest to an image's embedding along with the
+  * network's own class: new symbols classify on the device, in the same
+  * request, for a scan of the table after the run.
+  *
+  * The distance is L1 over the int8 values, four bytes per __USADA8: the
+  * table holds them offset by 128 as uint8, which leaves every difference
+  * as it was. 128 values are 32 instructions an entry, a full table of 64
+  * a few microseconds next to the ~ms of the network.
+  *
+  * The table belongs to the model it was enrolled on: enrolling under
+  * another empties it first, and it answers nothing for another. It does
+  * not survive a reset, the host enrols again (stm32dc.knn enroll --device).
+  ******************************************************************************
+  */
+
+#ifndef __KNN_H
+#define __KNN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+
+#define KNN_DIM                 128U    // largest embedding, values
+
+int Knn_Enroll(uint8_t model, const int8_t *v, uint32_t size, uint8_t label);
+int Knn_Nearest(uint8_t model, const int8_t *v, uint32_t size, uint32_t *distance);
+void Knn_Clear(void);
+uint8_t Knn_Count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __KNN_H */
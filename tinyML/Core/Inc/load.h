@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file           : load.h
+  * @brief          : CPU time per activity, for utilization (APP_LOAD)
+  ******************************************************************************
+  * The interrupt handlers of the links and DMA streams, network runs,
+  * reply framing and the idle wait are spans bracketed by DWT timestamps.
+  * A span's own time leaves out the spans that preempted it, so the shares
+  * add up however handlers nest: a USART interrupt during a run counts as
+  * USART, not as inference, and a reply framed in a handler as TX.
+  *
+  * The cycle counter stops in WFI. The time asleep is the wall clock (the
+  * HAL tick) less every awake cycle, which SysTick adds up each
+  * millisecond. Cycles are turned into time at the HCLK they ran at, so a
+  * clock change does not skew the shares. STOP mode halts the tick as
+  * well, its time is outside the window. STATS returns the shares since
+  * its last reset.
+  ******************************************************************************
+  */
+
+#ifndef __LOAD_H
+#define __LOAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "protocol.h"
+
+typedef struct {
+  uint32_t start;                      // DWT at the span's start
+  uint32_t nested;                     // own cycles of all spans ended by then
+} LoadMark_t;
+
+#if APP_LOAD
+// Bracket a handler or a block; span is a PROTO_LOAD_* share
+#define LOAD_BEGIN()            LoadMark_t load_mark = Load_Begin()
+#define LOAD_END(span)          Load_End(&load_mark, (span))
+#else
+#define LOAD_BEGIN()            ((void)0)
+#define LOAD_END(span)          ((void)0)
+#endif
+
+LoadMark_t Load_Begin(void);
+void Load_End(const LoadMark_t *mark, uint8_t span);
+void Load_Tick(void);
+void Load_ClockChanged(void);
+void Load_Get(uint32_t *window_ms, uint16_t *shares, uint8_t reset);
+uint64_t Load_BusyUs(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOAD_H */
@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file           : log.h
+  * @brief          : Deferred, tokenized log of device events (LOG)
+  ******************************************************************************
+  * LOG(id, a, b) stores the token and two 32-bit arguments with the tick in
+  * a RAM ring (any context, no formatting), LOG requests drain it. The
+  * format strings never reach the device: stm32dc/devlog.py reads them from
+  * LOG_EVENTS below, so a token keeps its position once released and new
+  * ones go at the end.
+  ******************************************************************************
+  */
+
+#ifndef __LOG_H
+#define __LOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "protocol.h"
+#include "app_config.h"
+
+// Token, host format string with at most two %u/%d/%x arguments
+#define LOG_EVENTS(X) \
+  X(LOG_BOOT,          "boot %u, reset cause %u") \
+  X(LOG_FAULT,         "restarted after fault %u") \
+  X(LOG_READY,         "ready after %u cycles") \
+  X(LOG_MODEL,         "model %u active, %u B of activations") \
+  X(LOG_MODEL_FAILED,  "model %u failed to load, keeping %u") \
+  X(LOG_RUN_FAILED,    "network run returned %d") \
+  X(LOG_RX_ERROR,      "link %u: receive error 0x%04x (HAL flags << 8 | ProtoError_t)") \
+  X(LOG_RX_LOST,       "link %u: error report lost, %u so far") \
+  X(LOG_BAUD,          "USART2 switching to %u baud") \
+  X(LOG_BAUD_REVERT,   "baud switch not confirmed, back to %u") \
+  X(LOG_CLOCK,         "clock profile %u, HCLK %u Hz") \
+  X(LOG_XFLASH,        "external flash: %u KB, streamed models %u") \
+  X(LOG_BAUD_DOWN,     "%u link errors per 1000 frames, stepping down to %u baud") \
+  X(LOG_WEIGHTS_OK,    "model %u: uploaded weights checked %u cycles after ready") \
+  X(LOG_WEIGHTS_BAD,   "model %u: uploaded weights fail their CRC (0x%08x), erased")
+
+#define LOG_ENUM(id, fmt) id,
+typedef enum {
+  LOG_EVENTS(LOG_ENUM)
+  LOG_COUNT
+} LogEvent_t;
+#undef LOG_ENUM
+
+#if APP_LOG
+#define LOG(id, a, b)           Log_Write((id), (uint32_t)(a), (uint32_t)(b))
+#else
+#define LOG(id, a, b)           ((void)0)
+#endif
+
+void Log_Write(LogEvent_t id, uint32_t a, uint32_t b);
+uint8_t Log_Drain(ProtoLogHeader_t *header, ProtoLogRecord_t *records, uint8_t max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOG_H */
@@ -31,7 +31,7 @@ extern "C" {
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-
+#include "app_config.h"
 /* USER CODE END Includes */
 
 /* Exported types ------------------------------------------------------------*/
@@ -46,13 +46,39 @@ extern "C" {
 
 /* Exported macro ------------------------------------------------------------*/
 /* USER CODE BEGIN EM */
-
+// Bracket the USART2 interrupt handlers, CLASSIFY_PROF reports their cycles
+#if APP_PROFILE
+#define UART_ISR_ENTER()        uint32_t uart_isr_start = DWT->CYCCNT
+#define UART_ISR_EXIT()         UART_IsrCycles(DWT->CYCCNT - uart_isr_start)
+#else
+#define UART_ISR_ENTER()        ((void)0)
+#define UART_ISR_EXIT()         ((void)0)
+#endif
 /* USER CODE END EM */
 
 /* Exported functions prototypes ---------------------------------------------*/
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
+void AI_RunPending(void);
+#if APP_CANCEL
+void AI_NodeBoundary(void);
+#endif
+#if APP_RX_OVERLAY
+void RX_OverlayNode(uint16_t c_idx);
+#endif
+#if APP_STAI
+int AI_Run(void);
+int AI_RunAsync(void (*done)(int status));
+#endif
+#if APP_PROFILE
+void UART_IsrCycles(uint32_t cycles);
+#endif
+#if APP_UART_LL
+void UART_LL_IRQHandler(void);
+void UART_LL_RxDmaIRQHandler(void);
+void UART_LL_TxDmaIRQHandler(void);
+#endif
 
 /* USER CODE END EFP */
 
@@ -0,0 +1,35 @@
+/**
+  ******************************************************************************
+  * @file           : memo.h
+  * @brief          : Results of the last images classified, keyed by CRC
+  ******************************************************************************
+  * With APP_MEMO = K, CLASSIFY, CLASSIFY_PACKED and BATCH_IMAGE look the
+  * image's CRC-32 (CRC unit, model index as the first word) up in the last
+  * K results before running the network. A host resending an image after a
+  * timeout, or an unchanged canvas, is then answered in microseconds; the
+  * reply's PROTO_RESULT_MEMO flag says so (BATCH replies have no flags).
+  * Cleared on every model load.
+  * Two images with the same CRC get the same answer, 1 in 2^32 per pair.
+  ******************************************************************************
+  */
+
+#ifndef __MEMO_H
+#define __MEMO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+
+void Memo_Clear(void);
+uint32_t Memo_Key(uint8_t model, const uint8_t *img);
+int Memo_Find(uint32_t key);
+void Memo_Store(uint32_t key, uint8_t predicted_class);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MEMO_H */
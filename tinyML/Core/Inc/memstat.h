@@ -0,0 +1,30 @@
+/**
+  ******************************************************************************
+  * @file           : memstat.h
+  * @brief          : SRAM usage: static footprint, heap end and stack watermark
+  ******************************************************************************
+  * The free space between the heap and the stack is painted at boot; the
+  * deepest stack use since then is the lowest word no longer holding the
+  * pattern. Interrupts run on the same (MSP) stack and are included.
+  ******************************************************************************
+  */
+
+#ifndef __MEMSTAT_H
+#define __MEMSTAT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "protocol.h"
+
+#define MEM_PAINT_PATTERN       0xC5C5C5C5U
+
+void Mem_PaintStack(void);
+void Mem_GetStats(ProtoMemStat_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MEMSTAT_H */
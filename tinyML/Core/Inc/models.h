@@ -0,0 +1,240 @@
+/**
+  ******************************************************************************
+  * @file           : models.h
+  * @brief          : Registry of the generated networks linked into the image
+  ******************************************************************************
+  * Every network generated by X-CUBE-AI under its own C name (ai_<name>_*
+  * API, AI_<NAME>_* macros) gets one MODEL_LIST row and its two headers
+  * below. All of them run in one activation arena sized for the largest, so
+  * only the active model's buffers are valid. A model is created on its
+  * first selection and its handle cached (the context is a static in the
+  * generated <name>.c); switching back later is a warm re-init that points
+  * it at the arena again. Models must use a single activation pool.
+  * APP_ARENA_SLOTS > 1 gives the arena that many copies; the active model
+  * is bound to one at a time (Model_UseSlot), a warm re-init away from the
+  * next, since the generated code has a single context per model.
+  * APP_RX_OVERLAY reads each row's overlay_plan.h entry (stm32dc.memplan),
+  * OVERLAY_<NAME>_NODE and _OFFSET; a row without one fails to compile.
+  * The firmware feeds every model the same int8 image, MODEL_IN_* below;
+  * a row whose generated header disagrees fails to compile.
+  ******************************************************************************
+  */
+
+#ifndef __MODELS_H
+#define __MODELS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "app_config.h"
+#include "ai_platform.h"
+#include "network.h"
+#include "network_data.h"
+
+#if APP_MODEL_TIME
+// The same model generated with -O time (python -m stm32dc.generate --time)
+#include "network_time.h"
+#include "network_time_data.h"
+#define MODEL_LIST_TIME(X)      X(network_time, NETWORK_TIME)
+#else
+#define MODEL_LIST_TIME(X)
+#endif
+
+#if APP_MODEL_LITE
+// The same model on the lite graph runtime (python -m stm32dc.generate --lite)
+#include "network_lite.h"
+#include "network_lite_data.h"
+#define MODEL_LIST_LITE(X)      X(network_lite, NETWORK_LITE)
+#else
+#define MODEL_LIST_LITE(X)
+#endif
+
+#if APP_MODEL_DQNN
+// Binarized digits model (python -m stm32dc.generate --dqnn)
+#include "dqnn.h"
+#include "dqnn_data.h"
+#define MODEL_LIST_DQNN(X)      X(dqnn, DQNN)
+#else
+#define MODEL_LIST_DQNN(X)
+#endif
+
+#if APP_MODEL_SEPARABLE
+// Depthwise-separable conv2d_2 (python -m stm32dc.generate --separable)
+#include "separable.h"
+#include "separable_data.h"
+#define MODEL_LIST_SEPARABLE(X) X(separable, SEPARABLE)
+#else
+#define MODEL_LIST_SEPARABLE(X)
+#endif
+
+#if APP_MODEL_GAP
+// Global average pool head instead of gemm_5 (python -m stm32dc.generate --gap)
+#include "gap.h"
+#include "gap_data.h"
+#define MODEL_LIST_GAP(X)       X(gap, GAP)
+#else
+#define MODEL_LIST_GAP(X)
+#endif
+
+#if APP_MODEL_SHAPES
+// Shapes classifier quantized to int8 (python -m stm32dc.generate --shapes)
+#include "shapes.h"
+#include "shapes_data.h"
+#define MODEL_LIST_SHAPES(X)    X(shapes, SHAPES)
+#else
+#define MODEL_LIST_SHAPES(X)
+#endif
+
+#if APP_MODEL_SHAPES_FLOAT
+// Its float original with int8 I/O (python -m stm32dc.generate --shapes-float)
+#include "shapes_float.h"
+#include "shapes_float_data.h"
+#define MODEL_LIST_SHAPES_FLOAT(X) X(shapes_float, SHAPES_FLOAT)
+#else
+#define MODEL_LIST_SHAPES_FLOAT(X)
+#endif
+
+#if APP_MODEL_MULTIHEAD
+// Shared conv backbone, digits and balanced heads (python -m stm32dc.generate --multihead)
+#include "multihead.h"
+#include "multihead_data.h"
+#define MODEL_LIST_MULTIHEAD(X) X(multihead, MULTIHEAD)
+#else
+#define MODEL_LIST_MULTIHEAD(X)
+#endif
+
+#if APP_MODEL_SMALL
+// 14x14 throughput model behind a 2x2 average pool (python -m stm32dc.generate --small)
+#include "small.h"
+#include "small_data.h"
+#define MODEL_LIST_SMALL(X) X(small, SMALL)
+#else
+#define MODEL_LIST_SMALL(X)
+#endif
+
+#if APP_MODEL_PERTENSOR
+// Digits model with per-tensor weight scales (python -m stm32dc.generate --pertensor)
+#include "pertensor.h"
+#include "pertensor_data.h"
+#define MODEL_LIST_PERTENSOR(X) X(pertensor, PERTENSOR)
+#else
+#define MODEL_LIST_PERTENSOR(X)
+#endif
+
+// Search candidates (python -m stm32dc.search), empty outside a search
+#include "candidates.h"
+
+#if APP_RX_OVERLAY
+// Arena region of the overlay frame slot per model (python -m stm32dc.memplan)
+#include "overlay_plan.h"
+#endif
+
+#if APP_MODEL_BALANCED
+// EMNIST balanced classifier, 47 classes, weights streamed from the
+// external flash (python -m stm32dc.generate --balanced, xmodel.h)
+#include "balanced.h"
+#include "balanced_data.h"
+#define MODEL_LIST_XFLASH(X)    X(balanced, BALANCED)
+#else
+#define MODEL_LIST_XFLASH(X)
+#endif
+
+// X(c_name, C_NAME), index 0 is selected at boot; the streamed models
+// come last, MODEL_XFLASH_COUNT of them
+#define MODEL_LIST(X) \
+  X(network, NETWORK) \
+  MODEL_LIST_TIME(X) \
+  MODEL_LIST_LITE(X) \
+  MODEL_LIST_DQNN(X) \
+  MODEL_LIST_SEPARABLE(X) \
+  MODEL_LIST_GAP(X) \
+  MODEL_LIST_SHAPES(X) \
+  MODEL_LIST_SHAPES_FLOAT(X) \
+  MODEL_LIST_MULTIHEAD(X) \
+  MODEL_LIST_SMALL(X) \
+  MODEL_LIST_PERTENSOR(X) \
+  MODEL_LIST_CANDIDATES(X) \
+  MODEL_LIST_XFLASH(X)
+
+#define MODEL_ONE(name, NAME)   + 1
+#define MODEL_XFLASH_COUNT      (0 MODEL_LIST_XFLASH(MODEL_ONE))
+
+typedef struct {
+  const char *name;
+  ai_error (*create_and_init)(ai_handle *network, const ai_handle activations[],
+                              const ai_handle weights[]);
+  ai_handle (*destroy)(ai_handle network);
+  ai_bool (*init)(ai_handle network, const ai_network_params *params);
+  ai_bool (*data_params_get)(ai_network_params *params);
+  ai_buffer *(*inputs_get)(ai_handle network, ai_u16 *n_buffer);
+  ai_buffer *(*outputs_get)(ai_handle network, ai_u16 *n_buffer);
+  ai_i32 (*run)(ai_handle network, const ai_buffer *input, ai_buffer *output);
+  ai_bool (*get_report)(ai_handle network, ai_network_report *report);   // NULL with APP_RUNTIME_MIN
+} Model_t;
+
+// The sizes are the largest member, the max over the registered models
+#define MODEL_ARENA_MEMBER(name, NAME)  ai_u8 name[AI_##NAME##_DATA_ACTIVATIONS_SIZE];
+#define MODEL_NODES_MEMBER(name, NAME)  ai_u8 name[AI_##NAME##_N_NODES];
+
+typedef union { MODEL_LIST(MODEL_ARENA_MEMBER) } ModelArena_t;
+typedef union { MODEL_LIST(MODEL_NODES_MEMBER) } ModelNodes_t;
+
+// APP_ARENA_SIZE trims it, Kernel_ArenaEnd checks a bound model fits
+#define MODEL_ARENA_SIZE        (APP_ARENA_SIZE ? APP_ARENA_SIZE : sizeof(ModelArena_t))
+// Distance between the APP_ARENA_SLOTS arenas, each starts 16-byte aligned
+#define MODEL_ARENA_STRIDE      ((MODEL_ARENA_SIZE + 15U) & ~15U)
+#define MODEL_MAX_NODES         sizeof(ModelNodes_t)
+
+// Input and output shapes from the generated headers. The firmware feeds
+// every model the same image, so all rows must agree on the input; the
+// class count may differ, MODEL_CLASSES_FIXED then reads 0.
+#define MODEL_IN_H_MEMBER(name, NAME)   ai_u8 name[AI_##NAME##_IN_1_HEIGHT];
+#define MODEL_IN_W_MEMBER(name, NAME)   ai_u8 name[AI_##NAME##_IN_1_WIDTH];
+#define MODEL_OUT_MEMBER(name, NAME)    ai_u8 name[AI_##NAME##_OUT_1_SIZE];
+#define MODEL_SAME_OUT(name, NAME)      && (AI_##NAME##_OUT_1_SIZE == MODEL_OUT_MAX)
+
+typedef union { MODEL_LIST(MODEL_IN_H_MEMBER) } ModelInH_t;
+typedef union { MODEL_LIST(MODEL_IN_W_MEMBER) } ModelInW_t;
+typedef union { MODEL_LIST(MODEL_OUT_MEMBER) } ModelOut_t;
+
+#define MODEL_IN_HEIGHT         sizeof(ModelInH_t)
+#define MODEL_IN_WIDTH          sizeof(ModelInW_t)
+#define MODEL_IN_SIZE           (MODEL_IN_HEIGHT * MODEL_IN_WIDTH)
+#define MODEL_OUT_MAX           sizeof(ModelOut_t)
+#define MODEL_CLASSES_FIXED     (1 MODEL_LIST(MODEL_SAME_OUT))
+
+// Outputs of a multi-head model (heads.h); the first is the one every
+// request but HEADS reads, so its class count is the model's
+#define MODEL_HEADS_MAX         4U
+
+#define MODEL_CHECK(name, NAME) \
+  _Static_assert(AI_##NAME##_IN_NUM == 1 && AI_##NAME##_OUT_NUM >= 1 && AI_##NAME##_OUT_NUM <= MODEL_HEADS_MAX, \
+                 #name ": one input and one output per head"); \
+  _Static_assert(AI_##NAME##_IN_1_FORMAT == AI_BUFFER_FORMAT_S8 && AI_##NAME##_IN_1_CHANNEL == 1 && \
+                 AI_##NAME##_IN_1_HEIGHT == MODEL_IN_HEIGHT && AI_##NAME##_IN_1_WIDTH == MODEL_IN_WIDTH, \
+                 #name ": input is not the image the other models take"); \
+  _Static_assert(AI_##NAME##_OUT_1_FORMAT == AI_BUFFER_FORMAT_S8, #name ": int8 scores");
+
+MODEL_LIST(MODEL_CHECK)
+
+uint8_t Model_Count(void);
+const Model_t *Model_Get(uint8_t index);
+ai_handle Model_Activate(uint8_t index);
+void Model_Drop(uint8_t index);
+uint32_t Model_CachedBytes(void);
+int Model_Streamed(uint8_t index);
+const uint8_t *Model_Arena(void);
+ai_handle Model_UseSlot(uint8_t slot);
+uint8_t Model_Slot(void);
+uint8_t *Model_SlotArena(uint8_t slot);
+#if APP_RX_OVERLAY
+int Model_Overlay(ai_handle network, uint8_t index, uint8_t **region);
+#endif
+int Model_Embedding(ai_handle network, const int8_t **data, int8_t *zero_point);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MODELS_H */
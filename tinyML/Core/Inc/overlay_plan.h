@@ -0,0 +1,21 @@
+/**
+  ******************************************************************************
+  * @file           : overlay_plan.h
+  * @brief          : Arena region of the overlay frame slot (APP_RX_OVERLAY)
+  ******************************************************************************
+  * Generated by python -m stm32dc.memplan from network_emnist_digits_int8.tflite_c_info.json,
+  * do not edit. Per model: the c-node from which OVERLAY_BYTES at OFFSET
+  * in the activation arena stay dead until the run ends.
+  ******************************************************************************
+  */
+
+#ifndef __OVERLAY_PLAN_H
+#define __OVERLAY_PLAN_H
+
+#define OVERLAY_BYTES 796U
+
+// network: from gemm_5 (c-node 2 of 5)
+#define OVERLAY_NETWORK_NODE 2U
+#define OVERLAY_NETWORK_OFFSET 3808U
+
+#endif /* __OVERLAY_PLAN_H */
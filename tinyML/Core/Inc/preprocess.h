@@ -0,0 +1,37 @@
+/**
+  ******************************************************************************
+  * @file           : preprocess.h
+  * @brief          : Input loading, ink and delta sums and argmax of the hot path
+  ******************************************************************************
+  * The per-image arithmetic around the network, free of HAL calls so it
+  * also builds on the host (tinyML/host, HOST_BUILD): the uint8 image into
+  * an int8 input tensor, its ink for the blank check, its distance from
+  * the last image for the delta gate, and the class of the scores. On a
+  * core with the DSP extension they work four pixels or scores at a time
+  * (USADA8, SSUB8/SEL); elsewhere, the host included, one at a time with
+  * the same results. n counts bytes and is a multiple of 4.
+  ******************************************************************************
+  */
+
+#ifndef __PREPROCESS_H
+#define __PREPROCESS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// Words summed between two checks of Pre_Delta's limit, a 28 pixel row
+#define PRE_DELTA_STRIDE        7U
+
+void Pre_LoadImage(int8_t *input, const uint8_t *img, uint32_t n);
+uint32_t Pre_Ink(const uint8_t *img, uint32_t n);
+uint32_t Pre_Delta(const uint8_t *a, const uint8_t *b, uint32_t n, uint32_t limit);
+int Pre_Argmax(const int8_t *scores, int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PREPROCESS_H */
@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file           : profile.h
+  * @brief          : DWT cycle counter helpers for on-target timing
+  ******************************************************************************
+  */
+
+#ifndef __PROFILE_H
+#define __PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "app_config.h"
+#include "ai_platform.h"
+#include "models.h"
+
+// Current core cycle count, wraps every 2^32 cycles (~44 s at 96 MHz)
+#define PROF_CYCLES()           (DWT->CYCCNT)
+
+// Cycles spent in one c-node during the last inference
+typedef struct {
+  uint16_t id;                         // layer id from network.c (conv2d_2 = 3)
+  uint16_t c_idx;                      // position in the execution list
+  uint32_t cycles;
+} ProfNode_t;
+
+// DWT events in the same c-node, each modulo 256: the counters are 8 bits
+typedef struct {
+  uint8_t cpi;                         // extra cycles of multi-cycle instructions
+  uint8_t exc;                         // exception entry and return
+  uint8_t sleep;                       // cycles asleep
+  uint8_t lsu;                         // extra cycles of loads and stores
+  uint8_t fold;                        // instructions folded into zero cycles
+  uint8_t reserved[3];
+} ProfCounters_t;
+
+void Prof_Init(void);
+
+#if APP_PROFILE_LAYERS || APP_CANCEL || APP_STAI || APP_RX_OVERLAY
+int Prof_ObserverRegister(ai_handle network);
+#endif
+#if APP_PROFILE_LAYERS
+uint16_t Prof_NodeTable(const ProfNode_t **nodes);
+#endif
+#if APP_PROFILE_COUNTERS
+uint16_t Prof_CounterTable(const ProfCounters_t **counters);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PROFILE_H */
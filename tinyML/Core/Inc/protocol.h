@@ -0,0 +1,785 @@
+/**
+  ******************************************************************************
+  * @file           : protocol.h
+  * @brief          : Binary framing of the host link (requests and responses)
+  ******************************************************************************
+  * Frame layout, little-endian:
+  *
+  *   +------+------+------+-----+---------+-----------+---------+
+  *   | 0xA5 | 0x5A | type | seq | len(16) | payload   | crc(32) |
+  *   +------+------+------+-----+---------+-----------+---------+
+  *
+  * The CRC is the STM32 CRC unit (CRC-32/MPEG-2, fed 32-bit words) over the
+  * type/seq/len word followed by the payload, zero padded to a word multiple.
+  * Responses echo the request seq and use type | PROTO_RESPONSE_FLAG.
+  ******************************************************************************
+  */
+
+#ifndef __PROTOCOL_H
+#define __PROTOCOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+
+#define PROTO_MAGIC0            0xA5
+#define PROTO_MAGIC1            0x5A
+#define PROTO_HEADER_SIZE       6U
+#define PROTO_CRC_SIZE          4U
+#define PROTO_OVERHEAD          (PROTO_HEADER_SIZE + PROTO_CRC_SIZE)
+
+// Largest CLASSIFY_CROP side
+#define PROTO_CROP_MAX          56U
+
+// Largest request payload the parser accepts: a full size CLASSIFY_CROP,
+// as much as a STRIP of 28 x 112
+#define PROTO_MAX_PAYLOAD       (2U + PROTO_CROP_MAX * PROTO_CROP_MAX)
+
+// Largest STAGE boundary tensor (split.h)
+#define PROTO_STAGE_MAX         1024U
+
+// Largest EMBED embedding
+#define PROTO_EMBED_MAX         256U
+
+// Outputs a HEADS reply has room for (heads.h)
+#define PROTO_HEADS_MAX         4U
+
+// CLASSIFY_SMALL image: each pixel a 2x2 mean of the 28x28 one, doubled
+// back on the device
+#define PROTO_SMALL_SIDE        14U
+#define PROTO_SMALL_SIZE        (PROTO_SMALL_SIDE * PROTO_SMALL_SIDE)
+
+// Largest reply payload: a STAGE FRONT boundary under APP_SPLIT, else a
+// full LOG page
+#if APP_SPLIT
+#define PROTO_MAX_REPLY         (8U + PROTO_STAGE_MAX)
+#else
+#define PROTO_MAX_REPLY         (4U + PROTO_LOG_MAX * 16U)
+#endif
+
+// Reported by PING, bumped on incompatible changes of the frame set
+#define PROTO_VERSION           1U
+
+#define PROTO_RESPONSE_FLAG     0x80U
+#define PROTO_RESPONSE(type)    ((uint8_t)((type) | PROTO_RESPONSE_FLAG))
+
+// Request type bit: the frame is queued ahead of those sent without it.
+// The parser strips it, the reply carries the plain type
+#define PROTO_PRIORITY_FLAG     0x40U
+
+// Response type bit: a ProtoStamp_t follows the reply's own payload
+// (APP_TIMESTAMPS). Never set on PROTO_TYPE_ERROR
+#define PROTO_STAMP_FLAG        0x40U
+
+// Request types (host -> device)
+#define PROTO_CMD_CLASSIFY      0x01U   // payload: 784 B image, reply: 1 B class
+#define PROTO_CMD_BATCH         0x02U   // payload: 1 B count, reply: count x 1 B class
+#define PROTO_CMD_BATCH_IMAGE   0x03U   // seq: index in batch, payload: 784 B image
+#define PROTO_CMD_SET_BAUD      0x04U   // payload: 4 B baud, reply: 4 B applied baud
+#define PROTO_CMD_CLASSIFY_PROF 0x05U   // payload: 784 B image, reply: ProtoProfile_t
+#define PROTO_CMD_PROFILE       0x06U   // payload: [1 B PROTO_PROFILE_*], reply: 4 B cpu_hz + ProfNode_t per c-node [+ ProfCounters_t each]
+#define PROTO_CMD_SET_CLOCK     0x07U   // payload: 1 B ClockProfile_t, reply: 4 B HCLK Hz
+#define PROTO_CMD_CLASSIFY_TOPK 0x08U   // payload: 784 B image [+ 1 B k], reply: ProtoTopK_t
+#define PROTO_CMD_PING          0x09U   // no payload, reply: ProtoCaps_t
+#define PROTO_CMD_CLASSIFY_PACKED 0x0AU // payload: encoded image (image_pack.h), reply: 1 B class
+#define PROTO_CMD_CLASSIFY_CROP 0x0BU   // payload: w, h, w x h image (image_crop.h), reply: 1 B class
+#define PROTO_CMD_MEMSTAT       0x0CU   // no payload, reply: ProtoMemStat_t
+#define PROTO_CMD_SELECT_MODEL  0x0DU   // payload: [1 B model index], reply: ProtoModelSel_t
+#define PROTO_CMD_CLASSIFY_CASCADE 0x0EU // payload: 784 B image, ProtoCascadeReq_t, reply: ProtoCascade_t
+#define PROTO_CMD_KERNEL_BENCH  0x0FU   // payload: 784 B image, [1 B PROTO_KERNEL_*], reply: ProtoKernelBench_t
+#define PROTO_CMD_STATS         0x10U   // payload: [1 B PROTO_STATS_*], reply: ProtoStats_t
+#define PROTO_CMD_FLASH         0x11U   // payload: [1 B PROTO_FLASH_*], reply: ProtoFlash_t
+#define PROTO_CMD_SELFTEST      0x12U   // no payload, reply: ProtoSelfTest_t
+#define PROTO_CMD_LOG           0x13U   // no payload, reply: ProtoLogHeader_t + ProtoLogRecord_t each
+#define PROTO_CMD_CANCEL        0x14U   // payload: 1 B seq of a classify request, empty reply
+#define PROTO_CMD_UPLOAD        0x15U   // payload: ProtoUploadReq_t [+ CRC or bytes], reply: ProtoUpload_t
+#define PROTO_CMD_STAGE         0x16U   // payload: ProtoStageReq_t + image or boundary, reply: ProtoStage_t [+ boundary]
+#define PROTO_CMD_STRIP         0x17U   // payload: ProtoStripReq_t + 28 x width image, reply: ProtoStrip_t + classes + scores
+#define PROTO_CMD_EMBED         0x18U   // payload: 784 B image, reply: ProtoEmbed_t + embedding
+#define PROTO_CMD_KNN           0x19U   // payload: ProtoKnnReq_t [+ 784 B image], reply: ProtoKnn_t
+#define PROTO_CMD_CONFIG        0x1AU   // payload: [1 B PROTO_CONFIG_*], reply: ProtoConfig_t
+#define PROTO_CMD_WCET          0x1BU   // payload: ProtoWcetReq_t, reply: ProtoWcet_t + u32 per c-node
+#define PROTO_CMD_ENERGY        0x1CU   // payload: [1 B PROTO_ENERGY_*], reply: ProtoEnergy_t + ProtoEnergySlot_t each
+#define PROTO_CMD_NN_BENCH      0x1DU   // payload: 784 B image, reply: ProtoNnBench_t + ProtoNnBenchLayer_t each
+#define PROTO_CMD_IRQ_LATENCY   0x1EU   // payload: ProtoIrqLatReq_t, reply: ProtoIrqLat_t + u32 per bucket
+#define PROTO_CMD_HEADS         0x1FU   // payload: 784 B image + 1 B heads mask, reply: ProtoHeads_t
+#define PROTO_CMD_CLASSIFY_SMALL 0x20U  // payload: 196 B 14x14 image [+ 1 B model index], reply: 1 B class
+#define PROTO_CMD_CLASSIFY_ANYTIME 0x21U // payload: 784 B image, ProtoAnytimeReq_t, reply: ProtoAnytime_t
+#define PROTO_CMD_CLOCK_SYNC    0x22U   // payload: [1 B PROTO_SYNC_*], reply: ProtoClockSync_t
+#define PROTO_CMD_TELEMETRY     0x23U   // payload: 2 B interval ms, 0 stops; reply and pushes: ProtoTelemetry_t
+#define PROTO_CMD_CLASSIFY_TTA  0x24U   // payload: 784 B image, ProtoTtaReq_t, reply: ProtoTta_t
+
+#define PROTO_MAX_BATCH         255U
+#define PROTO_CLASS_NONE        0xFFU   // batch entry that was lost or failed
+#define PROTO_CLASS_BLANK       0xFEU   // no digit: less ink than APP_BLANK_INK, no inference ran
+#define PROTO_TOPK_DEFAULT      3U      // k when CLASSIFY_TOPK carries no k byte
+#define PROTO_TOPK_MAX          10U
+
+// CLASSIFY_PACKED encodings
+#define PROTO_PACK_RAW          0U
+#define PROTO_PACK_ZRLE         1U      // zero runs
+#define PROTO_PACK_BITMAP       2U      // nonzero bitmap + values
+#define PROTO_PACK_DELTA        3U      // changed-pixel bitmap + values vs the previous image
+#define PROTO_PACK_BITS1        4U      // 1 bit per pixel: 0 or 255
+#define PROTO_PACK_BITS4        5U      // 4 bits per pixel: v * 17
+#define PROTO_PACK_STROKES      6U      // pen radius + polylines, rasterised on the device
+
+// SET_BAUD rates a link quality step walks, both sides in this order;
+// the host probes them downwards to find a board that stepped down
+#define PROTO_BAUD_LADDER       { 115200U, 230400U, 460800U, 921600U, 1500000U, 2000000U, \
+                                  3000000U, 4000000U, 6000000U, 12000000U }
+
+// PROFILE flags
+#define PROTO_PROFILE_COUNTERS  0x01U   // DWT event counts follow the nodes, PARAM without APP_PROFILE_COUNTERS
+
+// STATS flags
+#define PROTO_STATS_RESET       0x01U   // zero the counters once they are in the reply
+#define PROTO_STATS_BUCKETS     32U     // histogram bucket i: [2^i, 2^(i+1)) cycles, 0 in bucket 0
+// ProtoStats_t.load: where the time went (APP_LOAD)
+#define PROTO_LOAD_IDLE         0U      // asleep in WFI, or the main loop finding nothing to do
+#define PROTO_LOAD_USART        1U      // USART interrupt handlers, every link
+#define PROTO_LOAD_DMA          2U      // DMA stream interrupt handlers
+#define PROTO_LOAD_INFERENCE    3U      // network runs, less the handlers that preempted them
+#define PROTO_LOAD_TX           4U      // framing and queuing replies
+#define PROTO_LOAD_OTHER        5U      // the rest: parsing, preprocessing, the main loop
+#define PROTO_LOAD_SHARES       6U
+
+// FLASH request: ART accelerator features to enable, the rest is disabled
+#define PROTO_FLASH_PREFETCH    0x01U
+#define PROTO_FLASH_ICACHE      0x02U
+#define PROTO_FLASH_DCACHE      0x04U
+
+// ProtoStats_t.reset_cause: why the board last started
+#define PROTO_RESET_POWER       0U      // power-on or brown-out
+#define PROTO_RESET_PIN         1U      // NRST
+#define PROTO_RESET_WATCHDOG    2U      // the firmware hung and IWDG restarted it
+#define PROTO_RESET_SOFTWARE    3U      // a fault restarted it, see last_fault
+#define PROTO_RESET_LOWPOWER    4U
+
+// ProtoStats_t.last_fault: what triggered the last software restart
+#define PROTO_FAULT_NONE        0U
+#define PROTO_FAULT_HAL         1U      // Error_Handler
+#define PROTO_FAULT_AI_INIT     2U      // no model would load
+#define PROTO_FAULT_HARD        3U      // HardFault
+
+// KERNEL_BENCH kernels
+#define PROTO_KERNEL_CONV       0U      // conv2d_2, the default
+#define PROTO_KERNEL_DENSE      1U      // gemm_5 on the kernel_weights.c copy
+#define PROTO_KERNEL_SOFTMAX    2U      // nl_7 bypassed, logits as scores
+#define PROTO_KERNEL_CONV0      3U      // conv2d_0, APP_KERNEL_INCREMENTAL
+
+// LOG reply: records drained per request, the host asks until count is 0
+#define PROTO_LOG_MAX           32U
+
+// CANCEL: the request of that seq from the same link, still queued or
+// running, is answered ERROR CANCELLED instead of its result (APP_CANCEL)
+
+// UPLOAD operations (upload.h), ProtoUploadReq_t.op
+#define PROTO_UPLOAD_BEGIN      0U      // arg: blob bytes, then 4 B CRC-32; erases the region
+#define PROTO_UPLOAD_DATA       1U      // arg: offset, then the bytes (a word multiple)
+#define PROTO_UPLOAD_COMMIT     2U      // ERR_PARAM if the blob's CRC differs, else the model runs on it from the next frame
+#define PROTO_UPLOAD_ERASE      3U      // back to the linked weights
+
+// STAGE: half of a network split across two boards (split.h), ProtoStageReq_t.stage
+#define PROTO_STAGE_FRONT       0U      // image in, c-nodes [0, split) run, the boundary tensor out
+#define PROTO_STAGE_BACK        1U      // boundary tensor in, the other c-nodes run, the class out
+// ProtoStageReq_t.flags
+#define PROTO_STAGE_FORWARD     0x01U   // FRONT: send the boundary on as a BACK over APP_SPLIT_LINK,
+                                        // the reply of that board is relayed instead
+
+// KNN: ProtoKnnReq_t.op (knn.h)
+#define PROTO_KNN_CLASSIFY      0U      // image: the nearest enrolled label and the network's class
+#define PROTO_KNN_ENROLL        1U      // image: its embedding joins the table under label
+#define PROTO_KNN_CLEAR         2U      // no image: empty the table
+
+// CONFIG operations (config.h), no payload only asks
+#define PROTO_CONFIG_GET        0U      // the saved settings
+#define PROTO_CONFIG_SAVE       1U      // keep the running baud rate, model, clock profile and ART flags
+#define PROTO_CONFIG_CLEAR      2U      // the next boot starts on the defaults
+// ProtoConfig_t.flags
+#define PROTO_CONFIG_SAVED      0x01U   // settings are saved, the other fields hold them
+#define PROTO_CONFIG_APPLIED    0x02U   // this boot started from them
+
+// WCET: network runs of one request (APP_WCET), ProtoWcetReq_t.runs
+#define PROTO_WCET_RUNS_DEFAULT 256U    // runs when the request asks for 0
+#define PROTO_WCET_RUNS_MAX     4096U
+// ProtoWcetReq_t.flags
+#define PROTO_WCET_COLD         0x01U   // flush the ART caches before every run
+#define PROTO_WCET_OPEN         0x02U   // leave interrupts open during the runs (APP_DETERMINISTIC)
+// ProtoWcet_t.flags also
+#define PROTO_WCET_QUIET        0x40U   // the runs held interrupts off (APP_DETERMINISTIC)
+#define PROTO_WCET_RAM_CODE     0x80U   // the kernels ran from SRAM (STM32F411VETX_FLASH_RAMFUNC.ld)
+
+// IRQ_LATENCY: RX interrupt latency under back-to-back runs (APP_IRQ_LATENCY)
+#define PROTO_IRQLAT_BAUD_DEFAULT 921600U // byte rate the arrivals follow when the request asks for 0
+#define PROTO_IRQLAT_BUCKETS    16U     // bucket i: [2^i, 2^(i+1)) cycles, the last one and above
+
+// ENERGY request flags (APP_ENERGY), no payload only reads
+#define PROTO_ENERGY_RESET      0x01U   // zero the counters once read
+#define PROTO_ENERGY_SET_IDLE   0x02U   // PROTO_ENERGY_STOP is the idle mode from now on
+#define PROTO_ENERGY_STOP       0x04U   // idle may enter STOP mode; in the reply: it may
+// ProtoEnergy_t.flags also
+#define PROTO_ENERGY_STOP_BUILT 0x08U   // built with APP_IDLE_STOP_MS, STOP can be allowed
+
+// ProtoNnBenchLayer_t.kind, the CMSIS-NN function a layer maps to (APP_CMSIS_NN)
+#define PROTO_NN_CONV           0U      // arm_convolve_s8 + arm_max_pool_s8
+#define PROTO_NN_DENSE          1U      // arm_convolve_1x1_s8_fast
+#define PROTO_NN_SOFTMAX        2U      // arm_softmax_s8
+
+// STRIP: a 28 x width image, one class per 28x28 window (APP_STRIP)
+#define PROTO_STRIP_STRIDE      4U      // window stride, and what ProtoStripReq_t.stride is a multiple of
+
+// ProtoCaps_t.flags: optional commands compiled in
+#define PROTO_CAP_PROFILE       0x01U   // CLASSIFY_PROF
+#define PROTO_CAP_LAYERS        0x02U   // PROFILE
+#define PROTO_CAP_USB           0x04U   // frames also accepted on USB CDC
+#define PROTO_CAP_KERNEL        0x08U   // layers on custom kernels, KERNEL_BENCH
+#define PROTO_CAP_LOGITS        0x10U   // scores are logits, the softmax is bypassed
+#define PROTO_CAP_FLASH         0x20U   // FLASH (APP_FLASH_BENCH)
+#define PROTO_CAP_SELFTEST      0x40U   // SELFTEST (APP_SELFTEST)
+#define PROTO_CAP_MEMO          0x80U   // repeated images answered from memo (APP_MEMO)
+
+// ProtoCaps_t.features: protocol extensions beyond flags
+#define PROTO_FEAT_PRIORITY     0x01U   // PROTO_PRIORITY_FLAG requests are queued first
+#define PROTO_FEAT_CANCEL       0x02U   // CANCEL (APP_CANCEL)
+#define PROTO_FEAT_UPLOAD       0x04U   // UPLOAD (APP_UPLOAD)
+#define PROTO_FEAT_STAGE        0x08U   // STAGE (APP_SPLIT)
+#define PROTO_FEAT_FORWARD      0x10U   // STAGE with PROTO_STAGE_FORWARD, a back board is wired
+#define PROTO_FEAT_STRIP        0x20U   // STRIP (APP_STRIP)
+#define PROTO_FEAT_EMBED        0x40U   // EMBED (APP_EMBED)
+#define PROTO_FEAT_KNN          0x80U   // KNN (APP_KNN)
+
+// CLASSIFY and CLASSIFY_PACKED replies: class, then with APP_MEMO or
+// APP_DELTA_GATE a flags byte
+#define PROTO_RESULT_MEMO       0x01U   // remembered result, the network did not run
+#define PROTO_RESULT_GATED      0x02U   // the last image run's, this one barely differs
+
+// Transports a frame can arrive on (ProtoFrame_t.link), replies use the same
+#define PROTO_LINK_UART         0U
+#define PROTO_LINK_USB          1U
+#define PROTO_LINK_SPI          2U
+#define PROTO_LINK_USART1       3U
+#define PROTO_LINK_USART6       4U
+
+// Response types (device -> host)
+#define PROTO_TYPE_ERROR        0xFFU   // payload: 1 B ProtoError_t, a refusal ProtoBusy_t
+
+typedef enum {
+  PROTO_ERR_NONE = 0,
+  PROTO_ERR_CRC,
+  PROTO_ERR_LENGTH,
+  PROTO_ERR_TYPE,
+  PROTO_ERR_BUSY,
+  PROTO_ERR_INFERENCE,
+  PROTO_ERR_UART,
+  PROTO_ERR_PARAM,
+  PROTO_ERR_TIMEOUT,
+  PROTO_ERR_CANCELLED,
+  PROTO_ERR_FLASH                      // UPLOAD could not erase or program the flash
+} ProtoError_t;
+
+// ERROR payload refusing a frame for want of a slot with APP_ADMISSION;
+// without it PROTO_ERR_BUSY comes alone
+typedef struct __attribute__((packed)) {
+  uint8_t error;                       // PROTO_ERR_BUSY
+  uint8_t ahead;                       // frames queued, running or arriving before it
+  uint32_t retry_us;                   // until those are processed, at the measured rate
+} ProtoBusy_t;
+
+// CLASSIFY_PROF reply, stage durations in core cycles
+typedef struct __attribute__((packed)) {
+  uint8_t predicted_class;
+  uint8_t reserved[3];
+  uint32_t cpu_hz;                     // converts cycles to time
+  uint32_t pre_cycles;                 // uint8 -> int8 input conversion
+  uint32_t run_cycles;                 // ai_network_run
+  uint32_t argmax_cycles;
+  uint32_t tx_cycles;                  // DMA transfer of the previous reply
+  uint32_t isr_cycles;                 // USART2 interrupt handlers since the previous reply ...
+  uint32_t isr_bytes;                  // ... while this many bytes were received
+} ProtoProfile_t;
+
+// CLASSIFY_TOPK reply: probability = (score - zero_point) * scale
+typedef struct __attribute__((packed)) {
+  float scale;                         // output tensor quantisation
+  int8_t zero_point;
+  uint8_t k;
+  struct {
+    uint8_t predicted_class;
+    int8_t score;
+  } entry[PROTO_TOPK_MAX];             // best first, only k entries are sent
+} ProtoTopK_t;
+
+// PING reply, lets the host check it talks to the firmware and model it expects
+typedef struct __attribute__((packed)) {
+  uint8_t version;                     // PROTO_VERSION
+  uint8_t flags;                       // PROTO_CAP_*
+  uint16_t max_payload;                // PROTO_MAX_PAYLOAD
+  uint8_t in_height;
+  uint8_t in_width;
+  uint8_t in_channels;
+  uint8_t num_classes;
+  uint8_t model_hash[16];              // X-CUBE-AI model signature
+  // Credits of the link the PING came on. Every request but BATCH_IMAGE
+  // gets exactly one reply, and its slot is free again before that reply
+  // has left the wire, so each reply hands its request's credit back
+  uint8_t rx_slots;                    // requests it can always have queued or running
+  uint8_t features;                    // PROTO_FEAT_*
+  uint16_t rx_ring;                    // bytes of further requests that wait unparsed, 0: none
+  // Identity: which board this is whatever port or order it enumerates in
+  uint32_t uid[3];                     // 96-bit device unique ID (UID_BASE)
+  uint16_t fw_version;                 // APP_FW_VERSION
+  uint8_t model_active;                // registry index in use
+  uint8_t model_count;                 // registered models
+} ProtoCaps_t;
+
+// SELECT_MODEL reply; PING then describes the active model
+typedef struct __attribute__((packed)) {
+  uint8_t active;                      // registry index in use
+  uint8_t count;                       // registered models
+  uint8_t reserved[2];
+  uint32_t activations_size;           // bytes of the arena the active model uses
+  uint32_t weights_size;               // bytes of its weights in flash
+} ProtoModelSel_t;
+
+// CLASSIFY_CASCADE parameters, after the image. The first stage answers
+// when its best score leads the runner-up by at least min_margin output
+// LSBs (1/256 of probability for a softmax output), otherwise full runs.
+typedef struct __attribute__((packed)) {
+  uint8_t first;                       // registry index of the cheap model
+  uint8_t full;                        // registry index of the fallback
+  uint8_t min_margin;
+} ProtoCascadeReq_t;
+
+#define PROTO_CASCADE_FIRST     0U      // ProtoCascade_t.stage
+#define PROTO_CASCADE_FULL      1U
+
+// CLASSIFY_CASCADE reply
+typedef struct __attribute__((packed)) {
+  uint8_t predicted_class;
+  uint8_t stage;                       // PROTO_CASCADE_* that answered
+  uint8_t margin;                      // lead of the answering stage
+  uint8_t reserved;
+  uint32_t cycles;                     // whole cascade incl. model switches, 0 without APP_PROFILE
+} ProtoCascade_t;
+
+// CLASSIFY_TTA parameters, after the image. Variants run when the image's
+// class leads the runner-up by less than min_margin output LSBs, 0 never
+typedef struct __attribute__((packed)) {
+  uint8_t min_margin;
+  uint8_t variants;                    // at most, PROTO_TTA_VARIANTS and APP_BATCH_DENSE cap it
+} ProtoTtaReq_t;
+
+#define PROTO_TTA_VARIANTS      6U      // shifted right, left, down, up; zoomed in, out
+
+// CLASSIFY_TTA reply
+typedef struct __attribute__((packed)) {
+  uint8_t predicted_class;             // most votes, PROTO_CLASS_BLANK for a blank image
+  uint8_t own_class;                   // the image's class before the vote
+  uint8_t margin;                      // its lead
+  uint8_t variants;                    // variants run, 0 when the margin was enough
+  uint8_t votes;                       // for predicted_class, the image counting as one
+  uint8_t reserved[3];
+  uint32_t cycles;                     // whole request, 0 without APP_PROFILE
+} ProtoTta_t;
+
+// KERNEL_BENCH reply: the same image classified with the library layer
+// and with the custom kernel
+typedef struct __attribute__((packed)) {
+  uint32_t cpu_hz;
+  uint32_t lib_cycles;                 // that layer's forward only
+  uint32_t kernel_cycles;
+  uint8_t lib_class;
+  uint8_t kernel_class;
+  uint16_t mismatches;                 // layer output bytes that differ
+  uint8_t max_diff;                    // largest difference, in LSBs
+  uint8_t kernel;                      // PROTO_KERNEL_* timed
+  uint16_t active;                     // gemm_5 input words read (APP_KERNEL_DENSE_SKIP), conv2d_0
+                                       // tiles computed (APP_KERNEL_BLANK_TILES), else 0
+} ProtoKernelBench_t;
+
+// MEMSTAT reply, bytes unless noted
+typedef struct __attribute__((packed)) {
+  uint32_t ram_size;
+  uint32_t static_size;                // activations, .data and .bss
+  uint32_t activations_size;           // .ai_activations
+  uint32_t heap_end;                   // address, __sbrk_heap_end
+  uint32_t heap_used;
+  uint32_t stack_peak;                 // deepest stack use since boot
+  uint32_t stack_reserved;             // _Min_Stack_Size
+  uint32_t free;                       // never touched, between heap end and stack peak
+  uint32_t weight_cache;               // weights of the active model in SRAM (APP_WEIGHT_CACHE)
+} ProtoMemStat_t;
+
+// STATS reply, counts since boot or the last reset; histograms saturate
+typedef struct __attribute__((packed)) {
+  uint32_t cpu_hz;                     // converts the histogram cycles to time
+  uint32_t uptime_ms;                  // since the last reset
+  uint32_t frames;                     // complete frames received, intact or not
+  uint32_t inferences;                 // network runs
+  uint32_t err_inference;              // runs that failed
+  uint32_t err_crc;
+  uint32_t err_dropped;                // frames refused while receiving: no free slot, too long
+  uint32_t uart_overrun;               // ORE, or the DMA ring lapped the parser
+  uint32_t uart_framing;               // FE
+  uint32_t uart_noise;                 // NE or PE
+  uint32_t events_lost;                // receive errors the report queue could not hold
+  uint32_t boots;                      // starts since power-on, kept in backup registers
+  uint32_t warm_boots;                 // of those, by the watchdog or a fault
+  uint8_t reset_cause;                 // PROTO_RESET_* of this start
+  uint8_t last_fault;                  // PROTO_FAULT_* of the last software restart
+  uint8_t reserved[2];
+  uint32_t boot_cycles;                // core cycles from main() to ready for requests
+  uint32_t boot_hsi_cycles;            // of those, run on the 16 MHz HSI
+  uint16_t run_hist[PROTO_STATS_BUCKETS];    // cycles of each network run
+  uint16_t frame_hist[PROTO_STATS_BUCKETS];  // cycles from a frame's last byte to the end of its processing
+  uint32_t load_ms;                    // time the shares below cover, 0 without APP_LOAD
+  uint16_t load[PROTO_LOAD_SHARES];    // share of load_ms per PROTO_LOAD_*, in 1/10000
+} ProtoStats_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t cpu_hz;
+  uint8_t flags;                       // PROTO_FLASH_* now enabled
+  uint8_t latency;                     // flash wait states
+  uint8_t reserved[2];
+  uint32_t ram_code;                   // NetworkRuntime code bytes running from SRAM
+} ProtoFlash_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t cpu_hz;
+  uint32_t macc;                       // multiply-accumulates per run, from the network report
+  uint32_t cycles_min;                 // of one network run
+  uint32_t cycles_mean;
+  uint32_t cycles_max;
+  uint16_t count;                      // images run
+  uint16_t correct;                    // classified as labelled
+  uint16_t failed;                     // runs that returned an error
+  uint16_t first_wrong;                // index of the first misclassified image, 0xFFFF if none
+} ProtoSelfTest_t;
+
+typedef struct __attribute__((packed)) {
+  uint16_t runs;                       // 0: PROTO_WCET_RUNS_DEFAULT
+  uint8_t flags;                       // PROTO_WCET_*
+  uint8_t reserved;
+} ProtoWcetReq_t;
+
+// WCET reply, followed by nodes x u32: the most cycles of each c-node
+typedef struct __attribute__((packed)) {
+  uint32_t cpu_hz;
+  uint16_t runs;
+  uint8_t flags;                       // PROTO_WCET_* the runs were made with
+  uint8_t nodes;                       // c-node maxima that follow, 0 without APP_PROFILE_LAYERS
+  uint32_t load_max;                   // input conversion
+  uint32_t run_min;                    // network run
+  uint32_t run_max;
+  uint32_t argmax_max;
+  uint32_t total_max;                  // the three in one span
+  uint32_t rx_bytes;                   // received on USART2 during the runs
+} ProtoWcet_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t baud;                       // 0: PROTO_IRQLAT_BAUD_DEFAULT
+  uint16_t runs;                       // 0: PROTO_WCET_RUNS_DEFAULT, at most PROTO_WCET_RUNS_MAX
+  uint8_t reserved[2];
+} ProtoIrqLatReq_t;
+
+// IRQ_LATENCY reply, followed by buckets x u32: the latency histogram
+typedef struct __attribute__((packed)) {
+  uint32_t cpu_hz;
+  uint32_t baud;                       // the arrivals came a byte time of this apart on average
+  uint16_t runs;
+  uint8_t buckets;                     // PROTO_IRQLAT_BUCKETS
+  uint8_t reserved;
+  uint32_t samples;                    // arrivals serviced
+  uint32_t overruns;                   // serviced a byte time or more late: an RXNE byte lost
+  uint32_t lat_min;                    // cycles from arrival to handler entry
+  uint32_t lat_max;
+  uint32_t lat_mean;
+  uint32_t handler_max;                // cycles of the handler's own byte store
+  uint32_t gap_max;                    // longest span without the receive ring drained
+  uint32_t usart_max_baud;             // the host USART's limit at its PCLK and oversampling
+  uint32_t rx_ring;                    // receive DMA ring bytes
+} ProtoIrqLat_t;
+
+// ENERGY reply, followed by slots x ProtoEnergySlot_t: one per clock
+// profile, then the boot clock
+typedef struct __attribute__((packed)) {
+  uint32_t cpu_hz;
+  uint16_t mv;                         // supply of the current model, APP_ENERGY_MV
+  uint8_t slot;                        // the one running now
+  uint8_t slots;
+  uint8_t flags;                       // PROTO_ENERGY_STOP, PROTO_ENERGY_STOP_BUILT
+  uint8_t reserved[3];
+  uint32_t window_ms;                  // since boot or the last reset
+} ProtoEnergy_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t hz;                         // HCLK of the profile, 0 if it never ran
+  uint32_t run_ua;                     // current model, awake
+  uint32_t sleep_ua;                   // and in WFI
+  uint32_t awake_us;
+  uint32_t asleep_us;
+  uint32_t inferences;
+  uint32_t energy_uj;                  // awake and asleep time at those currents
+} ProtoEnergySlot_t;
+
+// NN_BENCH reply, followed by layers ProtoNnBenchLayer_t
+typedef struct __attribute__((packed)) {
+  uint32_t cpu_hz;
+  uint8_t layers;                      // mapped to CMSIS-NN
+  uint8_t lib_class;                   // every layer on the library
+  uint8_t nn_class;                    // every mapped layer on CMSIS-NN
+  uint8_t reserved;
+} ProtoNnBench_t;
+
+// One mapped layer, alone on CMSIS-NN against the library on the same input
+typedef struct __attribute__((packed)) {
+  uint32_t lib_cycles;
+  uint32_t nn_cycles;
+  uint16_t mismatches;                 // output bytes that differ
+  uint8_t max_diff;                    // in LSBs
+  uint8_t node;                        // c-node index
+  uint8_t kind;                        // PROTO_NN_*
+} ProtoNnBenchLayer_t;
+
+// LOG reply, followed by count records, oldest first
+typedef struct __attribute__((packed)) {
+  uint8_t count;
+  uint8_t reserved;
+  uint16_t lost;                       // records dropped on a full ring since the last LOG
+} ProtoLogHeader_t;
+
+// One log record: a LOG_* token from log.h and its arguments, unformatted
+typedef struct __attribute__((packed)) {
+  uint32_t tick;                       // HAL_GetTick, ms since boot
+  uint8_t id;
+  uint8_t reserved[3];
+  uint32_t arg[2];
+} ProtoLogRecord_t;
+
+// UPLOAD request header
+typedef struct __attribute__((packed)) {
+  uint8_t op;                          // PROTO_UPLOAD_*
+  uint8_t model;                       // registry index the weights are for (BEGIN)
+  uint8_t reserved[2];
+  uint32_t arg;                        // BEGIN: blob bytes, DATA: offset of the bytes that follow
+} ProtoUploadReq_t;
+
+// UPLOAD reply
+typedef struct __attribute__((packed)) {
+  uint8_t op;                          // as requested
+  uint8_t model;                       // active model, re-created on the new weights after COMMIT
+  uint8_t reserved[2];
+  uint32_t received;                   // blob bytes programmed so far
+  uint32_t capacity;                   // bytes the region holds
+} ProtoUpload_t;
+
+// STAGE request, followed by the 784 B image (FRONT) or the boundary (BACK)
+typedef struct __attribute__((packed)) {
+  uint8_t stage;                       // PROTO_STAGE_*
+  uint8_t split;                       // c-nodes in the front stage, 0 for SPLIT_DEFAULT
+  uint8_t flags;                       // PROTO_STAGE_FORWARD
+  uint8_t reserved;
+} ProtoStageReq_t;
+
+// STAGE reply, FRONT: followed by size bytes of boundary tensor
+typedef struct __attribute__((packed)) {
+  uint8_t stage;                       // as requested
+  uint8_t split;                       // as applied
+  uint8_t predicted_class;             // BACK: the class, FRONT: PROTO_CLASS_NONE
+  uint8_t model;                       // active model, both boards must run the same
+  uint16_t size;                       // boundary bytes
+  uint8_t reserved[2];
+} ProtoStage_t;
+
+// STRIP request, followed by 28 rows of width pixels
+typedef struct __attribute__((packed)) {
+  uint8_t width;                       // 28 to APP_STRIP
+  uint8_t stride;                      // pixels between windows, 0 for PROTO_STRIP_STRIDE
+} ProtoStripReq_t;
+
+// STRIP reply, followed by count classes, then count int8 scores of them
+typedef struct __attribute__((packed)) {
+  uint8_t count;                       // windows, (width - 28) / stride + 1
+  uint8_t stride;                      // as applied
+  uint8_t model;                       // active model
+  uint8_t reserved;
+} ProtoStrip_t;
+
+// EMBED reply, followed by size int8 values
+typedef struct __attribute__((packed)) {
+  uint8_t predicted_class;
+  uint8_t model;                       // active model, embeddings of two models do not compare
+  uint16_t size;                       // embedding values
+  int8_t zero_point;                   // of the embedding, the value of a 0 activation
+  uint8_t reserved[3];
+} ProtoEmbed_t;
+
+// HEADS reply: class and score per head of the active model, the heads
+// not run read PROTO_CLASS_NONE
+typedef struct __attribute__((packed)) {
+  uint8_t heads;                       // outputs the model has
+  uint8_t ran;                         // mask of the heads run
+  uint8_t model;                       // active model
+  uint8_t reserved;
+  struct __attribute__((packed)) {
+    uint8_t predicted_class;
+    int8_t score;
+  } head[PROTO_HEADS_MAX];
+} ProtoHeads_t;
+
+// CLASSIFY_ANYTIME request, after the image
+typedef struct __attribute__((packed)) {
+  uint32_t deadline_us;                // from the start of the request, 0: none
+  uint8_t min_margin;                  // stop at this lead in gemm_6 output LSBs, 0: never
+  uint8_t reserved[3];
+} ProtoAnytimeReq_t;
+
+#define PROTO_ANYTIME_SETTLED   0x01U   // ProtoAnytime_t.flags: the rows left could not change the class
+#define PROTO_ANYTIME_MARGIN    0x02U   // stopped at min_margin
+#define PROTO_ANYTIME_DEADLINE  0x04U   // stopped before the next step would pass the deadline
+
+// CLASSIFY_ANYTIME reply
+typedef struct __attribute__((packed)) {
+  uint8_t predicted_class;             // PROTO_CLASS_BLANK: no step ran
+  uint8_t steps;                       // gemm_5 steps run
+  uint8_t steps_total;
+  uint8_t flags;                       // PROTO_ANYTIME_*
+  uint8_t margin;                      // lead of the class, saturated
+  uint8_t reserved[3];
+  uint32_t cycles;                     // the whole request
+} ProtoAnytime_t;
+
+#define PROTO_SYNC_STAMP        0x01U   // CLOCK_SYNC flag: stamp the replies to further requests
+
+// CLOCK_SYNC reply. Stamps are in the device's microsecond clock (stamp.h)
+typedef struct __attribute__((packed)) {
+  uint32_t rx_us;                      // the request's last byte arrived
+  uint32_t tx_us;                      // the reply was framed
+  uint32_t cpu_hz;
+  uint8_t flags;                       // PROTO_SYNC_* in force
+  uint8_t reserved[3];
+} ProtoClockSync_t;
+
+// TELEMETRY: ProtoTelemetry_t.reason, what sent the frame
+#define PROTO_TELEM_PERIODIC    0x01U   // the interval passed
+#define PROTO_TELEM_ERRORS      0x02U   // APP_TELEMETRY_ERRORS errors since the last frame
+#define PROTO_TELEM_SLOW        0x04U   // a run reached bucket APP_TELEMETRY_SLOW
+#define PROTO_TELEM_ASKED       0x08U   // the reply to TELEMETRY itself
+#define PROTO_TELEM_ERROR_KINDS 7U      // ProtoStats_t err_inference to events_lost, in that order
+#define PROTO_TELEM_NO_LOAD     0xFFFFU // ProtoTelemetry_t.busy without APP_LOAD
+
+// TELEMETRY reply, also pushed unasked with seq 0 and the same type. Counts
+// are since the previous frame on any link and saturate; a STATS reset
+// between two frames makes them count from the reset. The frame ends after
+// the run_counts that run_mask has bits for
+typedef struct __attribute__((packed)) {
+  uint8_t number;                      // of the frame, wraps: a gap is a frame lost
+  uint8_t reason;                      // PROTO_TELEM_*
+  uint16_t span_ms;                    // since the previous frame
+  uint16_t frames;                     // complete frames received
+  uint16_t inferences;
+  uint16_t busy;                       // awake and not idling, in 1/10000 of span_ms
+  uint8_t hclk_mhz;
+  uint8_t errors[PROTO_TELEM_ERROR_KINDS];
+  uint32_t run_mask;                   // run histogram buckets with new runs
+  uint16_t run_counts[PROTO_STATS_BUCKETS];  // one per bit of run_mask, lowest first
+} ProtoTelemetry_t;
+
+// Trailer of a reply sent with PROTO_STAMP_FLAG
+typedef struct __attribute__((packed)) {
+  uint32_t rx_us;                      // the request's last byte arrived
+  uint32_t start_us;                   // the main loop took it from the ready queue
+  uint32_t run_us;                     // network runs for it, from DWT cycles
+  uint32_t tx_us;                      // the reply was framed
+} ProtoStamp_t;
+
+// KNN request, followed by the image but for PROTO_KNN_CLEAR
+typedef struct __attribute__((packed)) {
+  uint8_t op;                          // PROTO_KNN_*
+  uint8_t label;                       // ENROLL: label of the image
+  uint8_t reserved[2];
+} ProtoKnnReq_t;
+
+// KNN reply
+typedef struct __attribute__((packed)) {
+  uint8_t label;                       // CLASSIFY: nearest enrolled label, PROTO_CLASS_NONE if none
+  uint8_t predicted_class;             // the network's class, PROTO_CLASS_NONE for CLEAR
+  uint8_t count;                       // entries enrolled
+  uint8_t capacity;                    // APP_KNN
+  uint32_t distance;                   // CLASSIFY: L1 distance to that entry
+} ProtoKnn_t;
+
+// CONFIG reply (config.h), all zero but flags when nothing is saved
+typedef struct __attribute__((packed)) {
+  uint32_t baud;                       // USART2 rate
+  uint8_t model;                       // registry index
+  uint8_t clock;                       // ClockProfile_t, 0xFF the generated boot setup
+  uint8_t flash;                       // PROTO_FLASH_* ART features
+  uint8_t flags;                       // PROTO_CONFIG_*
+} ProtoConfig_t;
+
+typedef struct {
+  union {
+    uint32_t word;                     // header as fed to the CRC unit
+    struct {
+      uint8_t type;
+      uint8_t seq;
+      uint16_t len;
+    } f;
+  } hdr;
+  uint32_t crc;                        // CRC as received
+  uint8_t link;                        // transport the frame arrived on
+  uint8_t priority;                    // type had PROTO_PRIORITY_FLAG, not in hdr
+  uint8_t payload[PROTO_MAX_PAYLOAD] __attribute__((aligned(4)));
+} ProtoFrame_t;
+
+typedef enum {
+  PROTO_RX_SYNC0,
+  PROTO_RX_SYNC1,
+  PROTO_RX_HEADER,
+  PROTO_RX_PAYLOAD,
+  PROTO_RX_CRC
+} ProtoRxState_t;
+
+typedef struct ProtoParser_s ProtoParser_t;
+
+struct ProtoParser_s {
+  ProtoRxState_t state;
+  uint8_t hdr[4];
+  uint8_t crc[4];
+  uint16_t count;
+  ProtoFrame_t *frame;                 // destination, NULL while discarding
+  uint8_t link;                        // transport id stamped on frames
+
+  // Called from the receive context
+  ProtoFrame_t *(*claim)(ProtoParser_t *parser);  // free buffer or NULL when busy
+  void (*complete)(ProtoParser_t *parser, ProtoFrame_t *frame);
+  void (*drop)(ProtoParser_t *parser, uint8_t type, uint8_t seq, ProtoError_t error);
+  // Optional: payload bytes [from, to) of frame have just been stored
+  void (*progress)(ProtoParser_t *parser, ProtoFrame_t *frame, uint16_t from, uint16_t to);
+  // Optional: store len payload bytes of frame in the background, 0 if
+  // taken, else the parser copies them; the bytes stay put until done.
+  // Not called with progress set, which reads the bytes at once
+  int (*copy)(ProtoParser_t *parser, ProtoFrame_t *frame, uint8_t *dst, const uint8_t *src, uint16_t len);
+};
+
+void Proto_Init(void);
+void Proto_ParserReset(ProtoParser_t *parser);
+void Proto_ParserAbort(ProtoParser_t *parser, ProtoError_t error);
+uint16_t Proto_Parse(ProtoParser_t *parser, const uint8_t *data, uint16_t len);
+
+// CRC unit helpers, not reentrant: call from a single context only
+uint32_t Proto_Crc(uint32_t header, const uint8_t *payload, uint16_t len);
+int Proto_CheckFrame(const ProtoFrame_t *frame);
+uint16_t Proto_Encode(uint8_t *out, uint8_t type, uint8_t seq,
+                      const void *payload, uint16_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PROTOCOL_H */
@@ -0,0 +1,32 @@
+/**
+  ******************************************************************************
+  * @file           : spi_link.h
+  * @brief          : SPI slave transport for the framed host protocol
+  ******************************************************************************
+  */
+
+#ifndef __SPI_LINK_H
+#define __SPI_LINK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "app_config.h"
+#include "protocol.h"
+
+void SPI_Link_Init(ProtoParser_t *parser, void (*notify)(void), void (*release)(ProtoFrame_t *frame));
+void SPI_Link_Poll(void);
+uint8_t SPI_Link_Pending(void);
+int SPI_Link_Transmit(const uint8_t *data, uint16_t len, uint32_t timeout);
+
+// Interrupt handlers, called from stm32f4xx_it.c
+void SPI_Link_RxDmaIRQHandler(void);
+void SPI_Link_TxDmaIRQHandler(void);
+void SPI_Link_NssIRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SPI_LINK_H */
@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * @file           : split.h
+  * @brief          : One stage of the active network, split at a c-node boundary
+  ******************************************************************************
+  * With APP_SPLIT two boards can share an inference pipeline-fashion: the
+  * front board runs the first split c-nodes (STAGE FRONT) and hands on the
+  * tensor between them and the rest, the back board writes that tensor
+  * into its own arena and runs the remaining c-nodes (STAGE BACK). Both
+  * run the same model, each stage is a whole run of the runtime with the
+  * c-nodes of the other stage on a forward that does nothing, so the
+  * custom kernels and the observer see the layers they always do.
+  *
+  * The boundary is the output of c-node split - 1, which must be the
+  * input of c-node split: on the digits network SPLIT_DEFAULT cuts after
+  * conv2d_2, the 800 B 5x5x32 tensor gemm_5 reads.
+  ******************************************************************************
+  */
+
+#ifndef __SPLIT_H
+#define __SPLIT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "ai_platform.h"
+
+#define SPLIT_DEFAULT           2U      // conv2d_0, conv2d_2 | gemm_5, gemm_6, nl_7
+#define SPLIT_HEAD              3U      // conv2d_0, conv2d_2, gemm_5 | gemm_6, nl_7
+
+int Split_Begin(ai_handle network, uint8_t stage, uint8_t split, int8_t **boundary);
+void Split_End(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SPLIT_H */
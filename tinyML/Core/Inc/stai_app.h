@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file           : stai_app.h
+  * @brief          : ST Edge AI run and event model over the bound network (APP_STAI)
+  ******************************************************************************
+  * The networks in this tree are generated for the legacy ai_<name>_* API,
+  * and the runtime library only exports the stai_runtime_* half of stai.h;
+  * stai_network_* comes from the code generator with the ST Edge AI C API
+  * selected. This layer gives main.c the stai contract on what is linked:
+  *   StaiApp_Run    STAI_MODE_SYNC runs to completion, STAI_MODE_ASYNC
+  *                  submits to PendSV (APP_AI_ASYNC) and returns
+  *                  STAI_RUNNING_NO_WFE
+  *   StaiApp_Wait   STAI_RUNNING_NO_WFE while the run is in flight, then
+  *                  STAI_DONE or the error it ended with
+  *   events         STAI_EVENT_NODE_START / _STOP per c-node, from the
+  *                  platform observer, with the node's input (start) or
+  *                  output (stop) buffers as stai_event_node_start_stop
+  * Regenerating with the ST Edge AI API only changes stai_app.c.
+  *
+  * Each registered model keeps its own context (models.h), so several
+  * instances exist, one per model; they share one arena and run in turn.
+  ******************************************************************************
+  */
+
+#ifndef __STAI_APP_H
+#define __STAI_APP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "ai_platform.h"
+#include "stai.h"
+#include "stai_events.h"
+
+#define STAI_APP_NODE_BUFFERS   4U      // tensors a node event passes, more are left out
+
+#if APP_STAI
+struct ai_observer_node_s;
+
+stai_return_code StaiApp_Init(void);
+stai_return_code StaiApp_SetCallback(stai_event_cb cb, void *cookie);
+void StaiApp_NodeEvent(uint32_t flags, const struct ai_observer_node_s *node);
+stai_return_code StaiApp_Run(stai_run_mode mode);
+stai_return_code StaiApp_Wait(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STAI_APP_H */
@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @file           : stamp.h
+  * @brief          : Device timestamps on replies, for latency attribution
+  ******************************************************************************
+  * The stamps are a microsecond clock built from the HAL millisecond tick
+  * and the SysTick down counter, which keep running in WFI where the DWT
+  * cycle counter stops. It wraps every 2^32 us (71 minutes); the host
+  * unwraps it against its last CLOCK_SYNC.
+  *
+  * Each frame is stamped when its last byte is parsed and again when the
+  * main loop (or inference task) takes it from the ready queue. Network
+  * runs in between add their DWT cycles. Once CLOCK_SYNC has set
+  * PROTO_SYNC_STAMP, a reply to the frame being processed gets a
+  * ProtoStamp_t appended and PROTO_STAMP_FLAG in its type; errors, replies
+  * that would not fit PROTO_MAX_REPLY and replies sent for other frames
+  * (batches, staged arenas) go out as they are.
+  *
+  * STOP mode halts the tick and APP_DETERMINISTIC holds it during a run,
+  * so the clock jumps against the host's then: resynchronise after both.
+  ******************************************************************************
+  */
+
+#ifndef __STAMP_H
+#define __STAMP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "protocol.h"
+
+#if APP_TIMESTAMPS
+#define STAMP_BEGIN(seq, rx_us)         Stamp_Begin((seq), (rx_us))
+#define STAMP_END()                     Stamp_End()
+#define STAMP_RUN_BEGIN()               Stamp_RunBegin()
+#define STAMP_RUN_END()                 Stamp_RunEnd()
+#else
+#define STAMP_BEGIN(seq, rx_us)         ((void)0)
+#define STAMP_END()                     ((void)0)
+#define STAMP_RUN_BEGIN()               ((void)0)
+#define STAMP_RUN_END()                 ((void)0)
+#endif
+
+uint32_t Stamp_Us(void);
+void Stamp_Begin(uint8_t seq, uint32_t rx_us);
+void Stamp_End(void);
+void Stamp_RunBegin(void);
+void Stamp_RunEnd(void);
+void Stamp_Sync(ProtoClockSync_t *reply, const uint8_t *flags);
+const void *Stamp_Reply(uint8_t *type, uint8_t seq, const void *payload, uint16_t *len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STAMP_H */
@@ -0,0 +1,63 @@
+/**
+  ******************************************************************************
+  * @file           : stats.h
+  * @brief          : Runtime counters and cycle histograms (STATS)
+  ******************************************************************************
+  * Counts frames, inferences and errors by type since boot, and the cycles
+  * of each network run and of each frame from its last byte received to
+  * the end of its processing, in log2 buckets. STATS returns them and can
+  * zero them, so a deployed board shows how it has been doing without a
+  * debugger.
+  ******************************************************************************
+  */
+
+#ifndef __STATS_H
+#define __STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "protocol.h"
+#include "app_config.h"
+
+typedef enum {
+  STATS_FRAMES,
+  STATS_INFERENCES,
+  STATS_ERR_INFERENCE,
+  STATS_ERR_CRC,
+  STATS_ERR_DROPPED,
+  STATS_UART_OVERRUN,
+  STATS_UART_FRAMING,
+  STATS_UART_NOISE,
+  STATS_EVENTS_LOST,
+  STATS_COUNTERS
+} StatsCounter_t;
+
+typedef enum {
+  STATS_HIST_RUN,
+  STATS_HIST_FRAME,
+  STATS_HISTS
+} StatsHist_t;
+
+#if APP_STATS
+#define STATS_COUNT(counter)            Stats_Count(counter)
+#define STATS_CYCLES(hist, cycles)      Stats_Cycles(hist, cycles)
+#else
+#define STATS_COUNT(counter)            ((void)0)
+#define STATS_CYCLES(hist, cycles)      ((void)0)
+#endif
+
+void Stats_Init(void);
+void Stats_Count(StatsCounter_t counter);
+void Stats_Cycles(StatsHist_t hist, uint32_t cycles);
+void Stats_Get(ProtoStats_t *stats, uint8_t reset);
+void Stats_Snapshot(uint32_t *counters, uint16_t *run_hist);
+uint32_t Stats_Errors(void);
+uint32_t Stats_RunsFrom(uint8_t bucket);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STATS_H */
@@ -0,0 +1,38 @@
+/**
+  ******************************************************************************
+  * @file           : telemetry.h
+  * @brief          : Periodic telemetry frames pushed to the host (APP_TELEMETRY)
+  ******************************************************************************
+  * TELEMETRY sets an interval and the link the frames go to. Whenever the
+  * interval has passed, or earlier once APP_TELEMETRY_ERRORS errors or a
+  * run of APP_TELEMETRY_SLOW have come since the last frame (but no more
+  * often than APP_TELEMETRY_MIN_MS), the main loop sends a ProtoTelemetry_t
+  * with seq 0: the STATS counters and run histogram as deltas from the
+  * frame before, and the busy share of the span from the load spans.
+  * The frames go out between replies, through the same TX queue, and
+  * nothing is counted twice: the deltas come from the STATS counters, not
+  * counters of their own, so a host can watch a fleet without a request.
+  ******************************************************************************
+  */
+
+#ifndef __TELEMETRY_H
+#define __TELEMETRY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "protocol.h"
+
+void Telemetry_Configure(uint16_t interval_ms, uint8_t link);
+uint8_t Telemetry_Link(void);
+uint8_t Telemetry_Due(void);
+uint16_t Telemetry_Fill(ProtoTelemetry_t *frame, uint8_t reason);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TELEMETRY_H */
@@ -0,0 +1,34 @@
+/**
+  ******************************************************************************
+  * @file           : test_vectors.h
+  * @brief          : Reference images and labels of the SELFTEST build
+  ******************************************************************************
+  * test_vectors.c is generated by python -m stm32dc.vectors tinyML from an
+  * EMNIST digits test set; rerun it to change the count or the images. The
+  * images are stored as the host sends them: IMG_SIZE uint8 pixels,
+  * upright, row-major.
+  ******************************************************************************
+  */
+
+#ifndef __TEST_VECTORS_H
+#define __TEST_VECTORS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "models.h"
+
+#if APP_SELFTEST
+extern const uint16_t test_vector_count;
+extern const uint8_t test_vector_images[][MODEL_IN_SIZE];
+extern const uint8_t test_vector_labels[];
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TEST_VECTORS_H */
@@ -0,0 +1,159 @@
+/**
+  ******************************************************************************
+  * @file           : trace.h
+  * @brief          : GPIO timing markers and ITM event trace
+  ******************************************************************************
+  * With APP_TRACE_PINS the four Discovery LEDs show what the firmware is
+  * doing, one span per pin:
+  *
+  *   PD12 (green)   a frame is being received, from its header to its CRC
+  *   PD13 (orange)  the network runs
+  *   PD14 (red)     USART2 replies are on the wire, falls at TX done
+  *   PD15 (blue)    the main loop (or inference task) processes a frame
+  *
+  * Probe the host's TX line with them for end-to-end latency and jitter.
+  * Each marker is a single BSRR store: a couple of cycles, atomic and safe
+  * from any context. Without APP_TRACE_PINS they compile to nothing.
+  *
+  * With APP_ITM_TRACE the same spans, and the finer events below, also go
+  * out over SWO as ITM packets, one stimulus port per track and a local
+  * timestamp after each. The 16-bit payload holds the phase in its top two
+  * bits and an argument below, stm32dc/swo.py decodes it. A packet costs
+  * about 2 us of SWO time at 2 Mbaud and spins, with interrupts off, while
+  * the ITM FIFO is full.
+  ******************************************************************************
+  */
+
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+#define TRACE_PORT              GPIOD
+#define TRACE_RX                GPIO_PIN_12
+#define TRACE_RUN               GPIO_PIN_13
+#define TRACE_TX                GPIO_PIN_14
+#define TRACE_FRAME             GPIO_PIN_15
+#define TRACE_PINS              (TRACE_RX | TRACE_RUN | TRACE_TX | TRACE_FRAME)
+
+// ITM stimulus ports; the spans of the pins above use ports 0-3 in order
+#define TRACE_ITM_RX            0U      // frame reception, arg = link
+#define TRACE_ITM_RUN           1U      // network run
+#define TRACE_ITM_TX            2U      // USART2 replies on the wire
+#define TRACE_ITM_FRAME         3U      // frame processing
+#define TRACE_ITM_LAYER         4U      // c-node span, arg = c_idx
+#define TRACE_ITM_BURST         5U      // USART2 receive event, arg = bytes
+#define TRACE_ITM_STATE         6U      // parser state, arg = link << 4 | state
+#define TRACE_ITM_CLOCK         7U      // HCLK changed, arg = MHz
+#define TRACE_ITM_COUNTERS      8U      // DWT event counters at c-node edges, Trace_ItmCounters
+#define TRACE_ITM_PORTS         9U
+
+#define TRACE_PH_MARK           0U
+#define TRACE_PH_BEGIN          1U
+#define TRACE_PH_END            2U
+
+#define TRACE_PIN_PORT(pin)     ((uint32_t)__builtin_ctz(pin) - 12U)
+
+#if APP_ITM_TRACE
+void Trace_Init(void);
+void Trace_Flush(void);
+void Trace_ClockChanged(void);
+
+/**
+  * @brief Write one event word to an ITM stimulus port
+  * @note  Interrupts are off from the FIFO check to the write, a packet
+  *        written to a full FIFO would be lost
+  */
+static inline void Trace_Itm(uint32_t port, uint32_t phase, uint32_t arg)
+{
+  uint32_t primask;
+
+  if (!(ITM->TER & (1UL << port)))
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  while (ITM->PORT[port].u32 == 0UL)
+  {
+  }
+  ITM->PORT[port].u16 = (uint16_t)((phase << 14) | (arg & 0x3FFFU));
+  __set_PRIMASK(primask);
+}
+
+#if APP_PROFILE_COUNTERS
+/**
+  * @brief Snapshot the DWT event counters to TRACE_ITM_COUNTERS
+  * @note  A 32-bit packet of CPICNT, EXCCNT, SLEEPCNT and LSUCNT, lowest
+  *        byte first, then the phase with FOLDCNT as its argument. The
+  *        counters are read once the FIFO takes the word, so the overflow
+  *        packet of a counter that wraps falls on the right side of the
+  *        snapshot and swo.py counts every event between two of them
+  */
+static inline void Trace_ItmCounters(uint32_t phase)
+{
+  uint32_t primask;
+  uint32_t word;
+  uint32_t fold;
+
+  if (!(ITM->TER & (1UL << TRACE_ITM_COUNTERS)))
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  while (ITM->PORT[TRACE_ITM_COUNTERS].u32 == 0UL)
+  {
+  }
+  word = (DWT->CPICNT & 0xFFU) | (DWT->EXCCNT & 0xFFU) << 8 |
+         (DWT->SLEEPCNT & 0xFFU) << 16 | (DWT->LSUCNT & 0xFFU) << 24;
+  fold = DWT->FOLDCNT & 0xFFU;
+  ITM->PORT[TRACE_ITM_COUNTERS].u32 = word;
+  while (ITM->PORT[TRACE_ITM_COUNTERS].u32 == 0UL)
+  {
+  }
+  ITM->PORT[TRACE_ITM_COUNTERS].u16 = (uint16_t)((phase << 14) | fold);
+  __set_PRIMASK(primask);
+}
+#endif
+
+#define TRACE_BEGIN(port, arg)  Trace_Itm((port), TRACE_PH_BEGIN, (arg))
+#define TRACE_END(port, arg)    Trace_Itm((port), TRACE_PH_END, (arg))
+#define TRACE_MARK(port, arg)   Trace_Itm((port), TRACE_PH_MARK, (arg))
+#if APP_PROFILE_COUNTERS
+#define TRACE_COUNTERS(phase)   Trace_ItmCounters(phase)
+#else
+#define TRACE_COUNTERS(phase)   ((void)0)
+#endif
+#else
+#define TRACE_BEGIN(port, arg)  ((void)0)
+#define TRACE_END(port, arg)    ((void)0)
+#define TRACE_MARK(port, arg)   ((void)0)
+#define TRACE_COUNTERS(phase)   ((void)0)
+#endif
+
+#if APP_TRACE_PINS
+#define TRACE_PIN_HIGH(pin)     (TRACE_PORT->BSRR = (pin))
+#define TRACE_PIN_LOW(pin)      (TRACE_PORT->BSRR = (uint32_t)(pin) << 16)
+#else
+#define TRACE_PIN_HIGH(pin)     ((void)0)
+#define TRACE_PIN_LOW(pin)      ((void)0)
+#endif
+
+// Span on a pin and its ITM port, arg only goes to the ITM
+#define TRACE_HIGH_ARG(pin, arg) do { TRACE_PIN_HIGH(pin); TRACE_BEGIN(TRACE_PIN_PORT(pin), (arg)); } while (0)
+#define TRACE_LOW_ARG(pin, arg) do { TRACE_PIN_LOW(pin); TRACE_END(TRACE_PIN_PORT(pin), (arg)); } while (0)
+#define TRACE_HIGH(pin)         TRACE_HIGH_ARG((pin), 0U)
+#define TRACE_LOW(pin)          TRACE_LOW_ARG((pin), 0U)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TRACE_H */
@@ -0,0 +1,33 @@
+/**
+  ******************************************************************************
+  * @file           : tta.h
+  * @brief          : Shifted and zoomed copies of an image for CLASSIFY_TTA
+  ******************************************************************************
+  * Variant k of a 28x28 uint8 image, k < PROTO_TTA_VARIANTS:
+  *   0..3  shifted TTA_SHIFT pixels right, left, down, up
+  *   4, 5  zoomed in, out by TTA_ZOOM_PCT percent about the centre
+  * Pixels that come from outside the image are background, 0. The first
+  * variants are the ones a request asking for fewer gets.
+  ******************************************************************************
+  */
+
+#ifndef __TTA_H
+#define __TTA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "protocol.h"
+
+#define TTA_SIDE                28U
+#define TTA_SHIFT               1U      // pixels
+#define TTA_ZOOM_PCT            12U
+
+void Tta_Variant(const uint8_t *img, uint8_t kind, uint8_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TTA_H */
@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file           : uart_link.h
+  * @brief          : USART1 and USART6 sessions for the framed host protocol
+  ******************************************************************************
+  */
+
+#ifndef __UART_LINK_H
+#define __UART_LINK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "app_config.h"
+#include "protocol.h"
+#include "stm32f4xx_hal.h"
+
+// Ports, in the order of the parsers given to UART_Link_Init
+#define UART_LINK_USART1        0U
+#define UART_LINK_USART6        1U
+#define UART_LINK_PORTS         2U
+
+// RX ring of each port: as USART2's, holds one full size CLASSIFY_CROP frame held back
+#define UART_LINK_RX_SIZE       4096U
+
+void UART_Link_Init(ProtoParser_t *parsers, void (*notify)(void),
+                    uint8_t (*ready)(const ProtoParser_t *parser),
+                    void (*release)(ProtoFrame_t *frame));
+void UART_Link_Poll(void);
+uint8_t UART_Link_Pending(void);
+int UART_Link_Transmit(uint8_t port, const uint8_t *data, uint16_t len, uint32_t timeout);
+void UART_Link_Flush(uint32_t timeout);
+void UART_Link_ClockChanged(void);
+
+// HAL callbacks for USART1/USART6, forwarded from those in main.c
+void UART_Link_RxEvent(UART_HandleTypeDef *huart, uint16_t Size);
+void UART_Link_TxDone(UART_HandleTypeDef *huart);
+void UART_Link_Error(UART_HandleTypeDef *huart);
+
+// Interrupt handlers, called from stm32f4xx_it.c
+void UART_Link_IRQHandler(uint8_t port);
+void UART_Link_RxDmaIRQHandler(uint8_t port);
+void UART_Link_TxDmaIRQHandler(uint8_t port);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __UART_LINK_H */
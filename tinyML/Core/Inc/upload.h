@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file           : upload.h
+  * @brief          : Network weights uploaded over the link into reserved flash
+  ******************************************************************************
+  * With APP_UPLOAD, UPLOAD requests program the weights blob of one
+  * registered model into the linker script's UPLOAD region (sector 7,
+  * 128 KB at 0x08060000), with no debugger:
+  *
+  *   BEGIN   model, size and CRC-32 of the blob: erases the sector
+  *   DATA    offset and bytes, programmed in order as they arrive
+  *   COMMIT  the CRC unit checks the whole blob, then the header is written
+  *   ERASE   forget the upload, the model goes back to its linked weights
+  *
+  * A model streamed from the external flash (APP_XFLASH, xmodel.h) has no
+  * linked weights: its upload goes to its own slot of the SPI NOR instead,
+  * erased a 64 KB block at a time, with the same header, and ERASE leaves
+  * it without weights until the next upload.
+  * The header goes in last, so an upload cut short leaves none and the
+  * model keeps its linked weights. Model_Activate passes a committed blob
+  * as weights[0] to create_and_init and init of its model, if the size
+  * matches the generated weights map: the graph and its quantisation come
+  * from the image, only the weight values change (a retrained network of
+  * the same architecture, or a fine-tune).
+  *
+  * COMMIT is answered between frames like any request, so the frames
+  * ahead of it ran on the old weights and those behind it run on the new
+  * ones. Only the committed model is created again, the others keep their
+  * contexts and the memo of theirs; if the new weights fail to create, the
+  * region is erased and the model is back on its linked weights.
+  *
+  * Erasing a 128 KB sector stalls the core, flash fetches included, for
+  * 1 to 2 s; the receive DMA keeps filling its ring meanwhile.
+  *
+  * APP_WEIGHT_CHECK checks every committed blob against its header's CRC
+  * once after boot. The CRC unit also checks every frame, so the blob goes
+  * through it a CHECK_SLICE at a time, fed by DMA2 between frames; before
+  * each slice the unit is put back at the CRC the last one left (it has no
+  * INIT register), and a frame CRC waits for a slice in flight.
+  ******************************************************************************
+  */
+
+#ifndef __UPLOAD_H
+#define __UPLOAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "protocol.h"
+
+#define UPLOAD_MAGIC            0x57504C55U   // "ULPW"
+
+// At the start of the region, the blob follows 16-byte aligned
+typedef struct {
+  uint32_t magic;                      // UPLOAD_MAGIC once committed, erased (0xFFFFFFFF) before
+  uint32_t size;                       // blob bytes
+  uint32_t crc;                        // CRC unit over the blob words
+  uint8_t model;                       // registry index the weights are for
+  uint8_t reserved[3];
+} UploadHeader_t;
+
+ProtoError_t Upload_Begin(uint8_t model, uint32_t size, uint32_t crc);
+ProtoError_t Upload_Data(uint32_t offset, const uint8_t *data, uint16_t len);
+ProtoError_t Upload_Commit(void);
+ProtoError_t Upload_Erase(uint8_t model);
+uint32_t Upload_Received(void);
+uint8_t Upload_Model(void);
+uint32_t Upload_Capacity(uint8_t model);
+const void *Upload_Weights(uint8_t model, uint32_t size);
+void Upload_CheckStart(void);
+int Upload_CheckPoll(void);
+uint32_t Upload_CheckPending(void);
+void Upload_CheckYield(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __UPLOAD_H */
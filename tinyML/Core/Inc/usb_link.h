@@ -0,0 +1,26 @@
+/**
+  ******************************************************************************
+  * @file           : usb_link.h
+  * @brief          : USB CDC transport for the framed host protocol
+  ******************************************************************************
+  */
+
+#ifndef __USB_LINK_H
+#define __USB_LINK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "app_config.h"
+#include "protocol.h"
+
+void USB_Link_Init(ProtoParser_t *parser);
+void USB_Link_Receive(const uint8_t *buf, uint32_t len);
+int USB_Link_Transmit(const uint8_t *data, uint16_t len, uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USB_LINK_H */
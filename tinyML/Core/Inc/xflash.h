@@ -0,0 +1,46 @@
+/**
+  ******************************************************************************
+  * @file           : xflash.h
+  * @brief          : External SPI NOR flash holding streamed model weights
+  ******************************************************************************
+  * A W25Q-class serial NOR (JEDEC 0x9F id, 0x0B fast read, 256 B pages,
+  * 4 KB sectors, 64 KB blocks) wired to SPI4:
+  *
+  *   SPI4 master, mode 0, 8 bit MSB first, PCLK2 / 2 (50 MHz)
+  *   PE12 SCK, PE13 MISO, PE14 MOSI (AF5), PE11 CS (GPIO, active low)
+  *   DMA2 Stream0 channel 4 RX, DMA2 Stream4 channel 5 TX
+  *
+  * XFlash_ReadStart() sends the command by polling and leaves the data
+  * phase to DMA, so the core computes on one buffer while the next one
+  * fills (xmodel.c); XFlash_ReadWait() polls the streams, no interrupt is
+  * taken. Program and erase are polled, they only run for an UPLOAD.
+  ******************************************************************************
+  */
+
+#ifndef __XFLASH_H
+#define __XFLASH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+
+#define XFLASH_PAGE             256U
+#define XFLASH_SECTOR           0x1000U
+#define XFLASH_BLOCK            0x10000U
+
+int XFlash_Init(void);
+uint32_t XFlash_Size(void);
+int XFlash_Read(uint32_t addr, void *buf, uint32_t len);
+void XFlash_ReadStart(uint32_t addr, void *buf, uint16_t len);
+int XFlash_ReadWait(void);
+int XFlash_Program(uint32_t addr, const void *data, uint32_t len);
+int XFlash_Erase(uint32_t addr, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __XFLASH_H */
@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file           : xmodel.h
+  * @brief          : Models whose weights stream from the external flash
+  ******************************************************************************
+  * A registered model in MODEL_LIST_XFLASH (models.h) links its graph and
+  * quantisation but not its weights: generate.py keeps the blob out of the
+  * image, and UPLOAD writes it to the model's slot of the SPI NOR
+  * (xflash.h) instead of flash sector 7. Slot k of the streamed models
+  * starts at k * XMODEL_SLOT; the UploadHeader_t, then the blob on the next
+  * page.
+  *
+  * The runtime is bound to weights at XMODEL_BASE, an address nothing is
+  * mapped at, so every weight tensor points at base + its blob offset.
+  * XModel_Bind() then walks the layers:
+  *
+  *   - 3x3 stride 1 convolutions fed by a pad layer
+  *     (forward_conv2d_deep_3x3_sssa8_ch) and int8 dense layers, with
+  *     XMODEL_STREAM_MIN bytes of weights or more, move to the tiled
+  *     kernels here, which read their weights from the NOR a tile of
+  *     output channels at a time: while one tile computes, DMA fills the
+  *     other buffer with the next
+  *   - every other tensor in the blob (biases, the batch norm constants
+  *     eltwise layers take as inputs, the small layers) is copied into an
+  *     SRAM pool of APP_XFLASH_RESIDENT bytes
+  *
+  * A tensor left over, in neither, fails the bind rather than fault on
+  * its first read.
+  ******************************************************************************
+  */
+
+#ifndef __XMODEL_H
+#define __XMODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "app_config.h"
+#include "ai_platform.h"
+#include "xflash.h"
+
+#define XMODEL_BASE             0x90000000U   // weights[0] given to the runtime, unmapped on the F411
+#define XMODEL_SLOT             0x80000U      // 512 KB of external flash per streamed model
+#define XMODEL_BLOB             XFLASH_PAGE   // blob offset in a slot, after the header
+
+int XModel_Bind(ai_handle network, uint8_t slot, uint32_t size);
+uint32_t XModel_ResidentBytes(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __XMODEL_H */
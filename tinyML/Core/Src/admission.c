@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file           : admission.c
+  * @brief          : When a frame refused for want of a slot should come back
+  ******************************************************************************
+  */
+
+#include "admission.h"
+#include "main.h"
+#include "profile.h"
+
+#if APP_ADMISSION
+static uint32_t admission_start = 0;   // DWT when the current frame was taken
+static uint32_t admission_cycles = 0;  // mean per frame, 0 until one is measured
+
+/**
+  * @brief A frame is taken from the ready queue
+  */
+void Admission_Begin(void)
+{
+  admission_start = PROF_CYCLES();
+}
+
+/**
+  * @brief ... and has been processed: weigh it in at 1/8
+  */
+void Admission_End(void)
+{
+  uint32_t cycles = PROF_CYCLES() - admission_start;
+
+  if (admission_cycles == 0)
+  {
+    admission_cycles = cycles;
+  }
+  else
+  {
+    admission_cycles = admission_cycles - admission_cycles / 8U + cycles / 8U;
+  }
+}
+
+/**
+  * @brief Microseconds until ahead frames have been processed, at least
+  *        ADMISSION_MIN_US
+  */
+uint32_t Admission_RetryUs(uint8_t ahead)
+{
+  uint32_t mhz = SystemCoreClock / 1000000U;
+  uint64_t us = (uint64_t)ahead * admission_cycles / (mhz ? mhz : 1U);
+
+  if (us < ADMISSION_MIN_US)
+  {
+    return ADMISSION_MIN_US;
+  }
+  return (us > UINT32_MAX) ? UINT32_MAX : (uint32_t)us;
+}
+#endif
@@ -0,0 +1,243 @@
+/**
+  ******************************************************************************
+  * @file           : boot.c
+  * @brief          : Reset cause, boot counters and the independent watchdog
+  ******************************************************************************
+  */
+
+#include "boot.h"
+#include "main.h"
+#include "profile.h"
+
+// Backup register layout
+#define BOOT_MAGIC              0xB0070001U
+#define BOOT_REG_MAGIC          (RTC->BKP0R)
+#define BOOT_REG_COUNT          (RTC->BKP1R)
+#define BOOT_REG_WARM           (RTC->BKP2R)
+#define BOOT_REG_STATE          (RTC->BKP3R)   // fault | streak << 8 | model << 16
+// BKP4R to BKP7R: config.c
+
+#define BOOT_FAULT(state)       ((uint8_t)(state))
+#define BOOT_STREAK(state)      ((uint8_t)((state) >> 8))
+#define BOOT_MODEL(state)       ((uint8_t)((state) >> 16))
+#define BOOT_STATE(fault, streak, model) \
+  ((uint32_t)(fault) | ((uint32_t)(streak) << 8) | ((uint32_t)(model) << 16))
+
+// IWDG: LSI (~32 kHz) / 32, about one count per ms
+#define BOOT_IWDG_KEY_START     0xCCCCU
+#define BOOT_IWDG_KEY_FEED      0xAAAAU
+#define BOOT_IWDG_KEY_UNLOCK    0x5555U
+#define BOOT_IWDG_PR_32         3U
+#define BOOT_IWDG_RELOAD_MAX    0xFFFU
+
+static uint8_t boot_cause = PROTO_RESET_POWER;
+static uint8_t boot_fault = PROTO_FAULT_NONE;
+static uint32_t boot_start = 0;
+static uint32_t boot_hsi_cycles = 0;   // until SYSCLK left the 16 MHz HSI
+static uint32_t boot_ready_cycles = 0;
+
+/**
+  * @brief Start timing the boot, read and clear the reset flags, update the
+  *        counters
+  * @note  Call first in main, before anything can fail
+  */
+void Boot_Init(void)
+{
+  uint32_t csr = RCC->CSR;
+  uint32_t state;
+
+  Prof_Init();
+  boot_start = PROF_CYCLES();
+
+  // PINRSTF is set by every reset that drives NRST, so it comes last
+  if (csr & RCC_CSR_LPWRRSTF)
+  {
+    boot_cause = PROTO_RESET_LOWPOWER;
+  }
+  else if (csr & (RCC_CSR_IWDGRSTF | RCC_CSR_WWDGRSTF))
+  {
+    boot_cause = PROTO_RESET_WATCHDOG;
+  }
+  else if (csr & RCC_CSR_SFTRSTF)
+  {
+    boot_cause = PROTO_RESET_SOFTWARE;
+  }
+  else if (csr & (RCC_CSR_PORRSTF | RCC_CSR_BORRSTF))
+  {
+    boot_cause = PROTO_RESET_POWER;
+  }
+  else
+  {
+    boot_cause = PROTO_RESET_PIN;
+  }
+  RCC->CSR |= RCC_CSR_RMVF;
+
+  __HAL_RCC_PWR_CLK_ENABLE();
+  HAL_PWR_EnableBkUpAccess();
+
+  if (BOOT_REG_MAGIC != BOOT_MAGIC)
+  {
+    BOOT_REG_MAGIC = BOOT_MAGIC;
+    BOOT_REG_COUNT = 0;
+    BOOT_REG_WARM = 0;
+    BOOT_REG_STATE = 0;
+  }
+
+  state = BOOT_REG_STATE;
+  boot_fault = BOOT_FAULT(state);
+  BOOT_REG_COUNT++;
+  if (Boot_IsWarm())
+  {
+    BOOT_REG_WARM++;
+  }
+  else
+  {
+    // A cold start forgets the fault streak and the model
+    BOOT_REG_STATE = 0;
+  }
+}
+
+/**
+  * @brief Whether the watchdog or a fault restarted the board
+  */
+uint8_t Boot_IsWarm(void)
+{
+  return boot_cause == PROTO_RESET_WATCHDOG || boot_cause == PROTO_RESET_SOFTWARE;
+}
+
+uint8_t Boot_ResetCause(void)
+{
+  return boot_cause;
+}
+
+/**
+  * @brief PROTO_FAULT_* that caused the last software restart
+  */
+uint8_t Boot_LastFault(void)
+{
+  return boot_fault;
+}
+
+uint32_t Boot_Count(void)
+{
+  return BOOT_REG_COUNT;
+}
+
+uint32_t Boot_WarmCount(void)
+{
+  return BOOT_REG_WARM;
+}
+
+/**
+  * @brief Model that was active before a warm restart, 0 after a cold one
+  */
+uint8_t Boot_SavedModel(void)
+{
+  return BOOT_MODEL(BOOT_REG_STATE);
+}
+
+/**
+  * @brief Remember the active model for the next warm restart
+  */
+void Boot_SaveModel(uint8_t index)
+{
+  uint32_t state = BOOT_REG_STATE;
+  BOOT_REG_STATE = BOOT_STATE(BOOT_FAULT(state), BOOT_STREAK(state), index);
+}
+
+/**
+  * @brief SYSCLK has left the HSI that the core starts on
+  */
+void Boot_ClockReady(void)
+{
+  boot_hsi_cycles = PROF_CYCLES() - boot_start;
+}
+
+/**
+  * @brief The board came up: stop the boot timer, the next failure may
+  *        restart it again
+  */
+void Boot_Ready(void)
+{
+  uint32_t state = BOOT_REG_STATE;
+
+  boot_ready_cycles = PROF_CYCLES() - boot_start;
+  BOOT_REG_STATE = BOOT_STATE(BOOT_FAULT(state), 0, BOOT_MODEL(state));
+}
+
+/**
+  * @brief Core cycles from Boot_Init to Boot_Ready
+  * @note  The first Boot_HsiCycles() of them ran at 16 MHz
+  */
+uint32_t Boot_ReadyCycles(void)
+{
+  return boot_ready_cycles;
+}
+
+uint32_t Boot_HsiCycles(void)
+{
+  return boot_hsi_cycles;
+}
+
+/**
+  * @brief Record a fault and restart, or halt after BOOT_MAX_RETRIES in a row
+  * @note  Safe from any context, including HardFault. Without
+  *        APP_WATCHDOG_MS it only records the fault and halts, for the
+  *        debugger to find
+  */
+void Boot_Fail(uint8_t fault)
+{
+  __disable_irq();
+#if APP_WATCHDOG_MS
+  uint32_t state = BOOT_REG_STATE;
+  uint8_t streak = BOOT_STREAK(state);
+
+  if (streak < BOOT_MAX_RETRIES)
+  {
+    // The model may be what fails, the next start falls back to model 0
+    BOOT_REG_STATE = BOOT_STATE(fault, streak + 1U, (streak == 0) ? BOOT_MODEL(state) : 0);
+    NVIC_SystemReset();
+  }
+#endif
+
+  BOOT_REG_STATE = BOOT_STATE(fault, BOOT_MAX_RETRIES, 0);
+  while (1)
+  {
+  }
+}
+
+/**
+  * @brief Start the independent watchdog, it cannot be stopped again
+  * @param ms timeout, up to about 4 s
+  * @note  Stays off once BOOT_MAX_RETRIES starts have failed, so a halted
+  *        board is not restarted into the same fault
+  */
+void Boot_WatchdogStart(uint32_t ms)
+{
+  uint32_t reload = (ms > BOOT_IWDG_RELOAD_MAX) ? BOOT_IWDG_RELOAD_MAX : ms;
+
+  if (BOOT_STREAK(BOOT_REG_STATE) >= BOOT_MAX_RETRIES)
+  {
+    return;
+  }
+
+  // Halted cores do not feed it
+  DBGMCU->APB1FZ |= DBGMCU_APB1_FZ_DBG_IWDG_STOP;
+
+  IWDG->KR = BOOT_IWDG_KEY_START;
+  IWDG->KR = BOOT_IWDG_KEY_UNLOCK;
+  IWDG->PR = BOOT_IWDG_PR_32;
+  IWDG->RLR = (reload > 0) ? reload - 1U : 0;
+  while (IWDG->SR & (IWDG_SR_PVU | IWDG_SR_RVU))
+  {
+  }
+  IWDG->KR = BOOT_IWDG_KEY_FEED;
+}
+
+/**
+  * @brief Restart the watchdog countdown
+  */
+void Boot_WatchdogFeed(void)
+{
+  IWDG->KR = BOOT_IWDG_KEY_FEED;
+}
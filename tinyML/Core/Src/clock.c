@@ -0,0 +1,244 @@
+/**
+  ******************************************************************************
+  * @file           : clock.c
+  * @brief          : Runtime selectable system clock profiles
+  ******************************************************************************
+  * All profiles run from the 8 MHz HSE. Peripherals clocked from APB1/APB2
+  * (USART2) must be re-initialised by the caller after a switch.
+  *
+  * APP_FAST_BOOT replaces the blocking SystemClock_Config with
+  * Clock_BootStart/Clock_BootPoll/Clock_BootFinish: the core keeps running
+  * setup on the 16 MHz HSI while HSE starts and the PLL locks, then moves
+  * to the same 96 MHz configuration.
+  ******************************************************************************
+  */
+
+#include "clock.h"
+
+typedef struct {
+  uint32_t pll_n;                      // VCO = 2 MHz * pll_n, 0: SYSCLK = HSE
+  uint32_t pll_p;
+  uint32_t voltage_scale;
+  uint32_t apb1_div;
+  uint32_t flash_latency;              // wait states at 2.7-3.6 V
+  uint8_t usb_ok;                      // PLLQ output is exactly 48 MHz
+} ClockProfileCfg_t;
+
+static const ClockProfileCfg_t clock_profiles[CLOCK_PROFILE_COUNT] = {
+  [CLOCK_PROFILE_PERFORMANCE] = { 200, RCC_PLLP_DIV4, PWR_REGULATOR_VOLTAGE_SCALE1,
+                                  RCC_HCLK_DIV2, FLASH_LATENCY_3, 0 },
+  [CLOCK_PROFILE_BALANCED]    = { 192, RCC_PLLP_DIV8, PWR_REGULATOR_VOLTAGE_SCALE3,
+                                  RCC_HCLK_DIV1, FLASH_LATENCY_1, 1 },
+  [CLOCK_PROFILE_LOW_POWER]   = { 0, 0, PWR_REGULATOR_VOLTAGE_SCALE3,
+                                  RCC_HCLK_DIV1, FLASH_LATENCY_0, 0 },
+};
+
+static ClockProfile_t clock_profile = CLOCK_PROFILE_BOOT;
+#if APP_FAST_BOOT
+static uint8_t clock_boot_done = 0;
+#endif
+
+/**
+  * @brief Switch SYSCLK, bus prescalers and flash latency to a profile
+  * @retval 0 on success, -1 if the profile is unknown or the switch failed
+  */
+int Clock_ApplyProfile(ClockProfile_t profile)
+{
+  RCC_OscInitTypeDef osc = {0};
+  RCC_ClkInitTypeDef clk = {0};
+  const ClockProfileCfg_t *cfg;
+
+  if (profile >= CLOCK_PROFILE_COUNT)
+  {
+    return -1;
+  }
+  cfg = &clock_profiles[profile];
+
+#if APP_USB_CDC
+  // The OTG FS core needs a 48 MHz PLLQ clock
+  if (!cfg->usb_ok)
+  {
+    return -1;
+  }
+#endif
+
+  // HSE is off after a wake-up from STOP mode
+  osc.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  osc.HSEState = RCC_HSE_ON;
+  osc.PLL.PLLState = RCC_PLL_NONE;
+  if (HAL_RCC_OscConfig(&osc) != HAL_OK)
+  {
+    return -1;
+  }
+
+  // Park on HSE: the PLL can only be reprogrammed, and VOS only changed,
+  // while the PLL is off
+  clk.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK
+                | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+  clk.SYSCLKSource = RCC_SYSCLKSOURCE_HSE;
+  clk.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  clk.APB1CLKDivider = RCC_HCLK_DIV1;
+  clk.APB2CLKDivider = RCC_HCLK_DIV1;
+  if (HAL_RCC_ClockConfig(&clk, FLASH_LATENCY_0) != HAL_OK)
+  {
+    return -1;
+  }
+
+  osc.OscillatorType = RCC_OSCILLATORTYPE_NONE;
+  osc.PLL.PLLState = RCC_PLL_OFF;
+  if (HAL_RCC_OscConfig(&osc) != HAL_OK)
+  {
+    return -1;
+  }
+
+  __HAL_PWR_VOLTAGESCALING_CONFIG(cfg->voltage_scale);
+
+  if (cfg->pll_n)
+  {
+    osc.PLL.PLLState = RCC_PLL_ON;
+    osc.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+    osc.PLL.PLLM = 4;
+    osc.PLL.PLLN = cfg->pll_n;
+    osc.PLL.PLLP = cfg->pll_p;
+    osc.PLL.PLLQ = 8;
+    if (HAL_RCC_OscConfig(&osc) != HAL_OK)
+    {
+      return -1;
+    }
+
+    clk.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+    clk.APB1CLKDivider = cfg->apb1_div;
+    if (HAL_RCC_ClockConfig(&clk, cfg->flash_latency) != HAL_OK)
+    {
+      return -1;
+    }
+  }
+
+  // HAL_RCC_ClockConfig has updated SystemCoreClock and the SysTick reload
+  clock_profile = profile;
+  return 0;
+}
+
+/**
+  * @brief Profile in use, CLOCK_PROFILE_BOOT until one has been applied
+  */
+ClockProfile_t Clock_GetProfile(void)
+{
+  return clock_profile;
+}
+
+/**
+  * @brief Enable the CLOCK_FLASH_* features of the ART accelerator, disable
+  *        the others
+  * @note  HAL_Init enables all three (stm32f4xx_hal_conf.h). A cache is
+  *        flushed when it is turned back on, so each setting starts cold
+  */
+void Clock_SetFlashAccel(uint8_t flags)
+{
+  __HAL_FLASH_INSTRUCTION_CACHE_DISABLE();
+  __HAL_FLASH_DATA_CACHE_DISABLE();
+  __HAL_FLASH_INSTRUCTION_CACHE_RESET();
+  __HAL_FLASH_DATA_CACHE_RESET();
+
+  if (flags & CLOCK_FLASH_PREFETCH)
+  {
+    __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+  }
+  else
+  {
+    __HAL_FLASH_PREFETCH_BUFFER_DISABLE();
+  }
+  if (flags & CLOCK_FLASH_ICACHE)
+  {
+    __HAL_FLASH_INSTRUCTION_CACHE_ENABLE();
+  }
+  if (flags & CLOCK_FLASH_DCACHE)
+  {
+    __HAL_FLASH_DATA_CACHE_ENABLE();
+  }
+}
+
+/**
+  * @brief CLOCK_FLASH_* features now enabled
+  */
+uint8_t Clock_GetFlashAccel(void)
+{
+  uint32_t acr = FLASH->ACR;
+
+  return ((acr & FLASH_ACR_PRFTEN) ? CLOCK_FLASH_PREFETCH : 0U)
+       | ((acr & FLASH_ACR_ICEN) ? CLOCK_FLASH_ICACHE : 0U)
+       | ((acr & FLASH_ACR_DCEN) ? CLOCK_FLASH_DCACHE : 0U);
+}
+
+#if APP_FAST_BOOT
+/**
+  * @brief Start HSE and program the SystemClock_Config PLL, without waiting
+  */
+void Clock_BootStart(void)
+{
+  __HAL_RCC_PWR_CLK_ENABLE();
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+  __HAL_RCC_HSE_CONFIG(RCC_HSE_ON);
+  // PLLCFGR is writable while the PLL is off; it is enabled once HSE is up
+  __HAL_RCC_PLL_CONFIG(RCC_PLLSOURCE_HSE, 4, 192, RCC_PLLP_DIV4, 8);
+}
+
+/**
+  * @brief Advance the boot clock switch without blocking
+  * @retval 1 once SYSCLK runs from the PLL, 0 while HSE or the PLL is not
+  *         ready yet, -1 if the switch failed
+  */
+int Clock_BootPoll(void)
+{
+  RCC_ClkInitTypeDef clk = {0};
+
+  if (clock_boot_done)
+  {
+    return 1;
+  }
+
+  if (!__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY))
+  {
+    if (!(RCC->CR & RCC_CR_PLLON) && __HAL_RCC_GET_FLAG(RCC_FLAG_HSERDY))
+    {
+      __HAL_RCC_PLL_ENABLE();
+    }
+    return 0;
+  }
+
+  // Dividers and wait states of SystemClock_Config
+  clk.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK
+                | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+  clk.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  clk.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  clk.APB1CLKDivider = RCC_HCLK_DIV4;
+  clk.APB2CLKDivider = RCC_HCLK_DIV1;
+  if (HAL_RCC_ClockConfig(&clk, FLASH_LATENCY_3) != HAL_OK)
+  {
+    return -1;
+  }
+
+  clock_boot_done = 1;
+  return 1;
+}
+
+/**
+  * @brief Wait for what is left of the boot clock switch
+  * @note  USART2 must be re-initialised afterwards, PCLK1 changes
+  * @retval 0 on success, -1 if HSE or the PLL did not come up in time
+  */
+int Clock_BootFinish(void)
+{
+  uint32_t start = HAL_GetTick();
+  int ret;
+
+  while ((ret = Clock_BootPoll()) == 0)
+  {
+    if (HAL_GetTick() - start > HSE_STARTUP_TIMEOUT + PLL_TIMEOUT_VALUE)
+    {
+      return -1;
+    }
+  }
+  return (ret < 0) ? -1 : 0;
+}
+#endif
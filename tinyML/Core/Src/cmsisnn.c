@@ -0,0 +1,521 @@
+/**
+  ******************************************************************************
+  * @file           : cmsisnn.c
+  * @brief          : CMSIS-NN backend for the library layers (APP_CMSIS_NN)
+  ******************************************************************************
+  */
+
+#include "cmsisnn.h"
+#include "models.h"
+
+#if APP_CMSIS_NN
+#include <math.h>
+#include <string.h>
+#include "main.h"
+#include "profile.h"
+#if !__has_include("arm_nnfunctions.h")
+#error "APP_CMSIS_NN needs CMSIS-NN: copy its Include and Source directories to Drivers/CMSIS/NN"
+#endif
+#include "arm_nnfunctions.h"
+#include "ai_layer_custom_interface.h"
+#include "layers_conv2d.h"
+#include "layers_dense.h"
+#include "layers_nl.h"
+#include "layers_pool.h"
+
+#define NN_SM_INT_BITS          5       // integer bits of the scaled softmax difference, as TFLite
+
+// A library layer running on CMSIS-NN
+typedef struct {
+  ai_node *node;
+  node_func lib;                        // forward to restore for NN_BENCH
+  uint8_t kind;                         // PROTO_NN_*
+  uint8_t index;                        // c-node position
+  uint8_t k;                            // conv kernel side
+  uint16_t first;                       // per-channel multipliers at nn_mult[first]
+  int32_t in_offset;                    // -input zero point
+  int32_t out_offset;                   // output zero point
+  int32_t mult;                         // softmax input multiplier
+  int32_t shift;
+  int32_t diff_min;
+} NNLayer_t;
+
+static NNLayer_t nn_layers[MODEL_MAX_NODES];
+static uint32_t nn_count;
+static uint32_t nn_channels;
+static int32_t nn_mult[CMSISNN_CHANNELS];
+static int32_t nn_shift[CMSISNN_CHANNELS];
+
+/**
+  * @brief Q31 multiplier and left shift of a real scale, CMSIS-NN's form
+  */
+static void NN_Multiplier(double real, int32_t *mult, int32_t *shift)
+{
+  int exp;
+  double m = frexp(real, &exp);
+  int64_t q = llround(m * 2147483648.0);
+
+  if (q == (1LL << 31))
+  {
+    q >>= 1;
+    exp++;
+  }
+  // A pruned channel's scale underflows: it contributes 0
+  if (exp < -31)
+  {
+    q = 0;
+    exp = 0;
+  }
+  *mult = (int32_t)q;
+  *shift = exp;
+}
+
+/**
+  * @brief Tensor shape entry, 0 if the tensor is missing
+  */
+static uint32_t NN_Dim(const ai_tensor *t, ai_u16 pos)
+{
+  return t ? (uint32_t)ai_tensor_get_shape(t, pos) : 0;
+}
+
+/**
+  * @brief Scratch buffer i of a layer and its bytes, NULL if it has none
+  */
+static void *NN_Scratch(ai_node *node, ai_u16 i, uint32_t *size)
+{
+  ai_tensor_list *list = GET_TENSOR_LIST_SCRATCH(node->tensors);
+  ai_tensor *t = (i < GET_TENSOR_LIST_SIZE(list)) ? GET_TENSOR_LIST_ITEM(list, i) : NULL;
+
+  *size = t ? (uint32_t)ai_tensor_get_data_byte_size(t) : 0;
+  return t ? ai_tensor_get_data(t).handle : NULL;
+}
+
+/**
+  * @brief Per-channel requantisation of a conv or dense layer into nn_mult and nn_shift
+  * @retval 0 if the weights are not symmetric per channel or the table is full
+  */
+static int NN_Quant(NNLayer_t *l, ai_tensor *in, ai_tensor *out, ai_tensor *weights, uint32_t channels)
+{
+  ai_tensor_intq_info qin, qout, qw;
+
+  if (!ai_tensor_has_intq(in) || !ai_tensor_has_intq(out) || !ai_tensor_has_intq(weights) ||
+      nn_channels + channels > CMSISNN_CHANNELS)
+  {
+    return 0;
+  }
+  qin = ai_tensor_get_intq(in);
+  qout = ai_tensor_get_intq(out);
+  qw = ai_tensor_get_intq(weights);
+  if (qw.size != channels)
+  {
+    return 0;
+  }
+
+  l->first = (uint16_t)nn_channels;
+  l->in_offset = -qin.zeropoint_s8[0];
+  l->out_offset = qout.zeropoint_s8[0];
+  for (uint32_t c = 0; c < channels; c++)
+  {
+    if (qw.zeropoint_s8[c] != 0)
+    {
+      return 0;
+    }
+    NN_Multiplier((double)qin.scale[0] * qw.scale[c] / qout.scale[0],
+                  &nn_mult[l->first + c], &nn_shift[l->first + c]);
+  }
+  nn_channels += channels;
+  return 1;
+}
+
+/**
+  * @brief Valid conv, stride 1, with ReLU and a 2x2/2 max pool that drops an odd last row
+  */
+static int NN_MatchConv(NNLayer_t *l)
+{
+  const ai_layer_conv2d_nl_pool *c = (const ai_layer_conv2d_nl_pool *)l->node;
+  ai_layer *layer = (ai_layer *)l->node;
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  ai_tensor *weights = ai_layer_get_tensor_weights(layer, 0);
+  ai_tensor *bias = ai_layer_get_tensor_weights(layer, 1);
+  uint32_t in_c = NN_Dim(in, AI_TENSOR_CHANNEL), out_c = NN_Dim(out, AI_TENSOR_CHANNEL);
+  uint32_t taps, conv_w, conv_h, col_size, row_size;
+  cmsis_nn_dims in_dims, filter_dims;
+
+  if (c->groups != 1 || c->pool_func != AI_HANDLE_PTR(pool_func_mp_array_integer_INT8) ||
+      c->filter_stride.data[0] != 1 || c->filter_stride.data[1] != 1 ||
+      c->dilation.data[0] != 1 || c->dilation.data[1] != 1 ||
+      c->pool_size.data[0] != 2 || c->pool_size.data[1] != 2 ||
+      c->pool_stride.data[0] != 2 || c->pool_stride.data[1] != 2 ||
+      !weights || !bias || !in_c || !out_c || ai_tensor_get_data_size(bias) != out_c)
+  {
+    return 0;
+  }
+
+  // Square kernel from the weight count; a padded conv gives other output sizes
+  taps = (uint32_t)ai_tensor_get_data_byte_size(weights) / (in_c * out_c);
+  for (l->k = 1; (uint32_t)(l->k + 1) * (l->k + 1) <= taps; l->k++)
+  {
+  }
+  conv_w = NN_Dim(in, AI_TENSOR_WIDTH) - l->k + 1;
+  conv_h = NN_Dim(in, AI_TENSOR_HEIGHT) - l->k + 1;
+  if ((uint32_t)l->k * l->k != taps || NN_Dim(out, AI_TENSOR_WIDTH) != conv_w / 2 ||
+      NN_Dim(out, AI_TENSOR_HEIGHT) != conv_h / 2)
+  {
+    return 0;
+  }
+
+  // scratch0 is the im2col buffer, scratch1 two conv rows ahead of the pool
+  in_dims = (cmsis_nn_dims){ 1, l->k + 1, (int32_t)NN_Dim(in, AI_TENSOR_WIDTH), (int32_t)in_c };
+  filter_dims = (cmsis_nn_dims){ (int32_t)out_c, l->k, l->k, (int32_t)in_c };
+  if (!NN_Scratch(l->node, 0, &col_size) || !NN_Scratch(l->node, 1, &row_size) ||
+      (uint32_t)arm_convolve_s8_get_buffer_size(&in_dims, &filter_dims) > col_size ||
+      row_size < 2U * conv_w * out_c)
+  {
+    return 0;
+  }
+  return NN_Quant(l, in, out, weights, out_c);
+}
+
+/**
+  * @brief Per-channel dense layer, its input a multiple of 4 bytes
+  */
+static int NN_MatchDense(NNLayer_t *l)
+{
+  ai_layer *layer = (ai_layer *)l->node;
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  ai_tensor *weights = ai_layer_get_tensor_weights(layer, 0);
+  ai_tensor *bias = ai_layer_get_tensor_weights(layer, 1);
+  uint32_t n_in = in ? (uint32_t)ai_tensor_get_data_byte_size(in) : 0;
+  uint32_t n_out = out ? (uint32_t)ai_tensor_get_data_byte_size(out) : 0;
+
+  if (!n_in || !n_out || (n_in & 3U) || !weights || !bias ||
+      ai_tensor_get_data_byte_size(weights) != n_in * n_out || ai_tensor_get_data_size(bias) != n_out)
+  {
+    return 0;
+  }
+  return NN_Quant(l, in, out, weights, n_out);
+}
+
+/**
+  * @brief int8 softmax with TFLite's output, scale 1/256 at zero point -128
+  */
+static int NN_MatchSoftmax(NNLayer_t *l)
+{
+  ai_tensor *in = GET_TENSOR_IN(l->node->tensors, 0);
+  ai_tensor *out = GET_TENSOR_OUT(l->node->tensors, 0);
+  ai_tensor_intq_info qin, qout;
+  double real, radius;
+
+  if (!in || !out || !ai_tensor_has_intq(in) || !ai_tensor_has_intq(out) ||
+      ai_tensor_get_data_byte_size(in) != ai_tensor_get_data_byte_size(out))
+  {
+    return 0;
+  }
+  qin = ai_tensor_get_intq(in);
+  qout = ai_tensor_get_intq(out);
+  if (qout.zeropoint_s8[0] != -128 || fabsf(qout.scale[0] * 256.0f - 1.0f) > 1e-6f)
+  {
+    return 0;
+  }
+
+  // beta 1: the input scale in Q(5.26), as PreprocessSoftmaxScaling
+  real = fmin((double)qin.scale[0] * (1LL << (31 - NN_SM_INT_BITS)), 2147483647.0);
+  NN_Multiplier(real, &l->mult, &l->shift);
+  radius = ((1 << NN_SM_INT_BITS) - 1) * (double)(1LL << (31 - NN_SM_INT_BITS)) / (double)(1LL << l->shift);
+  l->diff_min = -(int32_t)floor(radius);
+  return l->shift >= 0;
+}
+
+/**
+  * @brief Entry of a node on CMSIS-NN, NULL if it stays on the library
+  */
+static const NNLayer_t *NN_Find(const ai_node *node)
+{
+  for (uint32_t i = 0; i < nn_count; i++)
+  {
+    if (nn_layers[i].node == node)
+    {
+      return &nn_layers[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+  * @brief Conv + ReLU + max pool, one pooled row at a time
+  * @note  Called on the arena the output overlaps the start of the input;
+  *        pooled row py only overwrites rows the later ones no longer
+  *        read, as the library's own pass
+  */
+static void NN_Conv(const NNLayer_t *l)
+{
+  ai_layer *layer = (ai_layer *)l->node;
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  const int8_t *x = ai_tensor_get_data(in).s8;
+  int8_t *y = ai_tensor_get_data(out).s8;
+  int32_t in_w = (int32_t)NN_Dim(in, AI_TENSOR_WIDTH), in_c = (int32_t)NN_Dim(in, AI_TENSOR_CHANNEL);
+  int32_t out_w = (int32_t)NN_Dim(out, AI_TENSOR_WIDTH), out_c = (int32_t)NN_Dim(out, AI_TENSOR_CHANNEL);
+  int32_t conv_w = in_w - l->k + 1;
+  uint32_t col_size, row_size;
+  cmsis_nn_context ctx;
+  int8_t *rows = NN_Scratch(l->node, 1, &row_size);
+  const cmsis_nn_conv_params conv = {
+    .input_offset = l->in_offset, .output_offset = l->out_offset,
+    .stride = { 1, 1 }, .padding = { 0, 0 }, .dilation = { 1, 1 },
+    .activation = { l->out_offset, 127 },            // the fused ReLU
+  };
+  const cmsis_nn_pool_params pool = {
+    .stride = { 2, 2 }, .padding = { 0, 0 }, .activation = { -128, 127 },
+  };
+  const cmsis_nn_per_channel_quant_params quant = { &nn_mult[l->first], &nn_shift[l->first] };
+  const cmsis_nn_dims in_dims = { 1, l->k + 1, in_w, in_c };
+  const cmsis_nn_dims filter_dims = { out_c, l->k, l->k, in_c };
+  const cmsis_nn_dims bias_dims = { 1, 1, 1, out_c };
+  const cmsis_nn_dims rows_dims = { 1, 2, conv_w, out_c };
+  const cmsis_nn_dims pool_dims = { 1, 2, 2, 1 };
+  const cmsis_nn_dims out_dims = { 1, 1, out_w, out_c };
+
+  ctx.buf = NN_Scratch(l->node, 0, &col_size);
+  ctx.size = (int32_t)col_size;
+  for (int32_t py = 0; py < (int32_t)NN_Dim(out, AI_TENSOR_HEIGHT); py++)
+  {
+    arm_convolve_s8(&ctx, &conv, &quant, &in_dims, &x[2 * py * in_w * in_c], &filter_dims,
+                    ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 0)).s8, &bias_dims,
+                    ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 1)).s32, &rows_dims, rows);
+    arm_max_pool_s8(&ctx, &pool, &rows_dims, rows, &pool_dims, &out_dims, &y[py * out_w * out_c]);
+  }
+}
+
+/**
+  * @brief Dense as a 1x1 conv over a 1x1xN input, the per-channel form
+  */
+static void NN_Dense(const NNLayer_t *l)
+{
+  ai_layer *layer = (ai_layer *)l->node;
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  int32_t n_in = (int32_t)ai_tensor_get_data_byte_size(in);
+  int32_t n_out = (int32_t)ai_tensor_get_data_byte_size(out);
+  const cmsis_nn_context ctx = { NULL, 0 };
+  const cmsis_nn_conv_params conv = {
+    .input_offset = l->in_offset, .output_offset = l->out_offset,
+    .stride = { 1, 1 }, .padding = { 0, 0 }, .dilation = { 1, 1 },
+    .activation = { -128, 127 },
+  };
+  const cmsis_nn_per_channel_quant_params quant = { &nn_mult[l->first], &nn_shift[l->first] };
+  const cmsis_nn_dims in_dims = { 1, 1, 1, n_in };
+  const cmsis_nn_dims filter_dims = { n_out, 1, 1, n_in };
+  const cmsis_nn_dims bias_dims = { 1, 1, 1, n_out };
+  const cmsis_nn_dims out_dims = { 1, 1, 1, n_out };
+
+  arm_convolve_1x1_s8_fast(&ctx, &conv, &quant, &in_dims, ai_tensor_get_data(in).s8, &filter_dims,
+                           ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 0)).s8, &bias_dims,
+                           ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 1)).s32, &out_dims,
+                           ai_tensor_get_data(out).s8);
+}
+
+/**
+  * @brief Forward of every layer on CMSIS-NN
+  */
+static void NN_Forward(ai_layer *layer)
+{
+  const NNLayer_t *l = NN_Find((ai_node *)layer);
+  ai_tensor *in, *out;
+
+  if (!l)
+  {
+    return;
+  }
+  switch (l->kind)
+  {
+    case PROTO_NN_CONV:
+      NN_Conv(l);
+      break;
+    case PROTO_NN_DENSE:
+      NN_Dense(l);
+      break;
+    default:
+      in = ai_layer_get_tensor_in(layer, 0);
+      out = ai_layer_get_tensor_out(layer, 0);
+      arm_softmax_s8(ai_tensor_get_data(in).s8, 1, (int32_t)ai_tensor_get_data_byte_size(in),
+                     l->mult, l->shift, l->diff_min, ai_tensor_get_data(out).s8);
+      break;
+  }
+}
+
+/**
+  * @brief Move every layer of a created network that maps onto CMSIS-NN
+  * @note  Call after every bind, the model bound before goes back to the library
+  * @retval layers on CMSIS-NN
+  */
+int CmsisNN_Install(ai_handle network)
+{
+  ai_network *net = AI_NETWORK_ACQUIRE_CTX(network);
+  ai_node *node = net ? net->input_node : NULL;
+
+  // The model bound before gets its library forwards back, contexts stay cached
+  for (uint32_t i = 0; i < nn_count; i++)
+  {
+    nn_layers[i].node->forward = nn_layers[i].lib;
+  }
+  nn_count = 0;
+  nn_channels = 0;
+
+  for (uint32_t n = 0; node && n < MODEL_MAX_NODES; n++)
+  {
+    NNLayer_t *l = &nn_layers[nn_count];
+    int ok = 0;
+
+    memset(l, 0, sizeof(*l));
+    l->node = node;
+    l->lib = node->forward;
+    l->index = (uint8_t)n;
+    if (node->forward == AI_NODE_FUNC(forward_conv2d_sssa8_ch_nl_pool))
+    {
+      l->kind = PROTO_NN_CONV;
+      ok = NN_MatchConv(l);
+    }
+    else if (node->forward == AI_NODE_FUNC(forward_dense_integer_SSSA_ch))
+    {
+      l->kind = PROTO_NN_DENSE;
+      ok = NN_MatchDense(l);
+    }
+    else if (node->forward == AI_NODE_FUNC(forward_sm_integer))
+    {
+      l->kind = PROTO_NN_SOFTMAX;
+      ok = NN_MatchSoftmax(l);
+    }
+    if (ok)
+    {
+      node->forward = AI_NODE_FUNC(NN_Forward);
+      nn_count++;
+    }
+    // The last layer links to itself
+    node = (node->next == node) ? NULL : node->next;
+  }
+  return (int)nn_count;
+}
+
+#if APP_PROFILE
+static const NNLayer_t *bench_layer;
+static node_func bench_target;
+static uint32_t bench_cycles;
+static uint8_t bench_pass;
+static int8_t bench_ref[CMSISNN_BENCH_OUT_MAX] __attribute__((section(".noinit")));
+static ProtoNnBenchLayer_t *bench_result;
+
+/**
+  * @brief Time bench_target on the layer and compare its output across passes
+  */
+static void NN_TimedForward(ai_layer *layer)
+{
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  uint32_t size = (uint32_t)ai_tensor_get_data_byte_size(out);
+  const int8_t *y = ai_tensor_get_data(out).s8;
+  uint32_t t0 = PROF_CYCLES();
+
+  bench_target(layer);
+  bench_cycles = PROF_CYCLES() - t0;
+
+  if (bench_pass == 0)
+  {
+    memcpy(bench_ref, y, size);
+    return;
+  }
+  for (uint32_t i = 0; i < size; i++)
+  {
+    int diff = y[i] - bench_ref[i];
+    if (diff < 0) diff = -diff;
+    if (diff)
+    {
+      if (bench_result->mismatches < UINT16_MAX) bench_result->mismatches++;
+      if (diff > bench_result->max_diff) bench_result->max_diff = (uint8_t)diff;
+    }
+  }
+}
+
+/**
+  * @brief Set every mapped layer on the library or on CMSIS-NN
+  */
+static void NN_SetBackend(int nn)
+{
+  for (uint32_t i = 0; i < nn_count; i++)
+  {
+    nn_layers[i].node->forward = nn ? AI_NODE_FUNC(NN_Forward) : nn_layers[i].lib;
+  }
+}
+
+/**
+  * @brief Classify img on both backends, whole and one mapped layer at a time
+  * @param classify runs the active network on a 28x28 image
+  * @param layers nn_count entries, ProtoNnBench_t.layers
+  * @retval PROTO_ERR_PARAM if no layer of the active network is on CMSIS-NN
+  */
+ProtoError_t CmsisNN_Bench(const uint8_t *img, int (*classify)(const uint8_t *img),
+                           ProtoNnBench_t *result, ProtoNnBenchLayer_t *layers)
+{
+  int cls[2];
+
+  if (!nn_count)
+  {
+    return PROTO_ERR_PARAM;
+  }
+  for (uint32_t i = 0; i < nn_count; i++)
+  {
+    if (ai_tensor_get_data_byte_size(ai_layer_get_tensor_out((ai_layer *)nn_layers[i].node, 0)) >
+        CMSISNN_BENCH_OUT_MAX)
+    {
+      return PROTO_ERR_PARAM;
+    }
+  }
+
+  memset(result, 0, sizeof(*result));
+  memset(layers, 0, nn_count * sizeof(*layers));
+  for (uint32_t b = 0; b < 2; b++)
+  {
+    NN_SetBackend((int)b);
+    cls[b] = classify(img);
+  }
+
+  // Each layer alone on CMSIS-NN, so it sees the library's input both times
+  NN_SetBackend(0);
+  for (uint32_t i = 0; i < nn_count && cls[0] >= 0; i++)
+  {
+    bench_layer = &nn_layers[i];
+    bench_result = &layers[i];
+    for (bench_pass = 0; bench_pass < 2; bench_pass++)
+    {
+      bench_target = bench_pass ? AI_NODE_FUNC(NN_Forward) : bench_layer->lib;
+      bench_layer->node->forward = AI_NODE_FUNC(NN_TimedForward);
+      if (classify(img) < 0)
+      {
+        cls[0] = -1;
+        break;
+      }
+      if (bench_pass == 0)
+      {
+        layers[i].lib_cycles = bench_cycles;
+      }
+    }
+    bench_layer->node->forward = bench_layer->lib;
+    layers[i].nn_cycles = bench_cycles;
+    layers[i].node = bench_layer->index;
+    layers[i].kind = bench_layer->kind;
+  }
+  NN_SetBackend(1);
+  if (cls[0] < 0 || cls[1] < 0)
+  {
+    return PROTO_ERR_INFERENCE;
+  }
+
+  result->cpu_hz = HAL_RCC_GetHCLKFreq();
+  result->layers = (uint8_t)nn_count;
+  result->lib_class = (uint8_t)cls[0];
+  result->nn_class = (uint8_t)cls[1];
+  return PROTO_ERR_NONE;
+}
+#endif /* APP_PROFILE */
+#endif /* APP_CMSIS_NN */
@@ -0,0 +1,67 @@
+/**
+  ******************************************************************************
+  * @file           : config.c
+  * @brief          : Link and clock settings kept across resets (APP_CONFIG)
+  ******************************************************************************
+  */
+
+#include "config.h"
+#include "main.h"
+
+#if APP_CONFIG
+// Backup register layout, after boot.c's; Boot_Init enables the access
+#define CONFIG_MAGIC            0xC0F10001U
+#define CONFIG_REG_MAGIC        (RTC->BKP4R)
+#define CONFIG_REG_BAUD         (RTC->BKP5R)
+#define CONFIG_REG_STATE        (RTC->BKP6R)   // model | clock << 8 | flash << 16
+#define CONFIG_REG_CHECK        (RTC->BKP7R)
+
+#define CONFIG_STATE(c) \
+  ((uint32_t)(c)->model | ((uint32_t)(c)->clock << 8) | ((uint32_t)(c)->flash << 16))
+#define CONFIG_CHECK(baud, state) (~((baud) ^ (state) ^ CONFIG_MAGIC))
+
+/**
+  * @brief The saved settings
+  * @retval 0, -1 if none were saved or the block is damaged
+  */
+int Config_Load(ProtoConfig_t *config)
+{
+  uint32_t baud = CONFIG_REG_BAUD;
+  uint32_t state = CONFIG_REG_STATE;
+
+  if (CONFIG_REG_MAGIC != CONFIG_MAGIC || CONFIG_REG_CHECK != CONFIG_CHECK(baud, state))
+  {
+    return -1;
+  }
+
+  config->baud = baud;
+  config->model = (uint8_t)state;
+  config->clock = (uint8_t)(state >> 8);
+  config->flash = (uint8_t)(state >> 16);
+  config->flags = PROTO_CONFIG_SAVED;
+  return 0;
+}
+
+/**
+  * @brief Keep settings for the next boot
+  * @note  The magic goes in last: a reset half way leaves no block
+  */
+void Config_Save(const ProtoConfig_t *config)
+{
+  uint32_t state = CONFIG_STATE(config);
+
+  CONFIG_REG_MAGIC = 0;
+  CONFIG_REG_BAUD = config->baud;
+  CONFIG_REG_STATE = state;
+  CONFIG_REG_CHECK = CONFIG_CHECK(config->baud, state);
+  CONFIG_REG_MAGIC = CONFIG_MAGIC;
+}
+
+/**
+  * @brief Boot on the defaults again
+  */
+void Config_Clear(void)
+{
+  CONFIG_REG_MAGIC = 0;
+}
+#endif /* APP_CONFIG */
@@ -0,0 +1,247 @@
+/**
+  ******************************************************************************
+  * @file           : dma_copy.c
+  * @brief          : Memory-to-memory copies on DMA2 stream 3 (APP_DMA_COPY)
+  ******************************************************************************
+  */
+
+#include "dma_copy.h"
+#include "main.h"
+#include <string.h>
+
+#if APP_DMA_COPY
+typedef struct {
+  void *dst;
+  const void *src;
+  uint32_t len;
+  DmaCopyDone_t done;
+  void *arg;
+  uint8_t feed;                        // dst is a register: words, no increment
+} DmaCopy_t;
+
+static DMA_HandleTypeDef hdma_copy;
+static DmaCopy_t copy_queue[DMA_COPY_QUEUE];
+static volatile uint8_t copy_head = 0;     // in flight while != copy_tail
+static volatile uint8_t copy_tail = 0;
+
+static int DmaCopy_Queue(void *dst, const void *src, uint32_t len, DmaCopyDone_t done, void *arg, uint8_t feed);
+static void DmaCopy_Kick(void);
+static void DmaCopy_Done(DMA_HandleTypeDef *hdma);
+static void DmaCopy_Error(DMA_HandleTypeDef *hdma);
+#endif
+
+/**
+  * @brief Set up DMA2 stream 3 for memory-to-memory copies
+  */
+void DmaCopy_Init(void)
+{
+#if APP_DMA_COPY
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  // The FIFO is mandatory memory to memory; the channel is unused
+  hdma_copy.Instance = DMA2_Stream3;
+  hdma_copy.Init.Channel = DMA_CHANNEL_0;
+  hdma_copy.Init.Direction = DMA_MEMORY_TO_MEMORY;
+  hdma_copy.Init.PeriphInc = DMA_PINC_ENABLE;
+  hdma_copy.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_copy.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_copy.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_copy.Init.Mode = DMA_NORMAL;
+  hdma_copy.Init.Priority = DMA_PRIORITY_LOW;
+  hdma_copy.Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+  hdma_copy.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  hdma_copy.Init.MemBurst = DMA_MBURST_SINGLE;
+  hdma_copy.Init.PeriphBurst = DMA_PBURST_SINGLE;
+  if (HAL_DMA_Init(&hdma_copy) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  hdma_copy.XferCpltCallback = DmaCopy_Done;
+  hdma_copy.XferErrorCallback = DmaCopy_Error;
+
+  // With the links: a completion must not wait behind a long parse
+  HAL_NVIC_SetPriority(DMA2_Stream3_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream3_IRQn);
+#endif
+}
+
+/**
+  * @brief Queue a copy of len bytes from src to dst, any context
+  * @note  Neither buffer may change until done is called. dst is written
+  *        by the DMA: keep it out of the CPU's way until then
+  * @retval 0 if queued, -1 if the queue is full (copy it with the CPU)
+  */
+int DmaCopy_Start(void *dst, const void *src, uint32_t len, DmaCopyDone_t done, void *arg)
+{
+#if APP_DMA_COPY
+  if (len == 0 || len > 0xFFFFU)
+  {
+    return -1;
+  }
+  return DmaCopy_Queue(dst, src, len, done, arg, 0);
+#else
+  (void)dst;
+  (void)src;
+  (void)len;
+  (void)done;
+  (void)arg;
+  return -1;
+#endif
+}
+
+/**
+  * @brief Queue words 32-bit writes of src, one after another, to register reg
+  * @note  src must be word aligned and stay unchanged until done is called
+  * @retval 0 if queued, -1 if the queue is full (feed it with the CPU)
+  */
+int DmaCopy_Feed(volatile uint32_t *reg, const void *src, uint32_t words, DmaCopyDone_t done, void *arg)
+{
+#if APP_DMA_COPY
+  if (words == 0 || words > 0xFFFFU || ((uint32_t)src & 3U))
+  {
+    return -1;
+  }
+  return DmaCopy_Queue((void *)reg, src, words * 4U, done, arg, 1);
+#else
+  (void)reg;
+  (void)src;
+  (void)words;
+  (void)done;
+  (void)arg;
+  return -1;
+#endif
+}
+
+#if APP_DMA_COPY
+/**
+  * @brief Queue a copy or a feed, any context
+  */
+static int DmaCopy_Queue(void *dst, const void *src, uint32_t len, DmaCopyDone_t done, void *arg, uint8_t feed)
+{
+  uint32_t primask = __get_PRIMASK();
+  DmaCopy_t *copy;
+
+  __disable_irq();
+  if ((uint8_t)(copy_tail - copy_head) >= DMA_COPY_QUEUE)
+  {
+    __set_PRIMASK(primask);
+    return -1;
+  }
+  copy = &copy_queue[copy_tail % DMA_COPY_QUEUE];
+  copy->dst = dst;
+  copy->src = src;
+  copy->len = len;
+  copy->done = done;
+  copy->arg = arg;
+  copy->feed = feed;
+  // Idle stream: this one starts now
+  if (copy_tail++ == copy_head)
+  {
+    DmaCopy_Kick();
+  }
+  __set_PRIMASK(primask);
+  return 0;
+}
+#endif
+
+/**
+  * @brief Whether a copy is waiting or in flight
+  */
+uint8_t DmaCopy_Busy(void)
+{
+#if APP_DMA_COPY
+  return copy_head != copy_tail;
+#else
+  return 0;
+#endif
+}
+
+/**
+  * @brief DMA2 stream 3 interrupt
+  */
+void DmaCopy_IRQHandler(void)
+{
+#if APP_DMA_COPY
+  HAL_DMA_IRQHandler(&hdma_copy);
+#endif
+}
+
+#if APP_DMA_COPY
+/**
+  * @brief Start the copy at the head of the queue
+  * @note  With interrupts masked, or from the stream's interrupt
+  */
+static void DmaCopy_Kick(void)
+{
+  const DmaCopy_t *copy = &copy_queue[copy_head % DMA_COPY_QUEUE];
+  uint32_t width = DMA_PDATAALIGN_BYTE | DMA_MDATAALIGN_BYTE;
+  uint32_t count = copy->len;
+
+  if ((((uint32_t)copy->dst | (uint32_t)copy->src | copy->len) & 3U) == 0U)
+  {
+    width = DMA_PDATAALIGN_WORD | DMA_MDATAALIGN_WORD;
+    count = copy->len / 4U;
+  }
+  // The stream is disabled between copies, its widths and whether the
+  // destination moves may change
+  MODIFY_REG(hdma_copy.Instance->CR, DMA_SxCR_PSIZE | DMA_SxCR_MSIZE | DMA_SxCR_MINC,
+             width | (copy->feed ? 0U : DMA_MINC_ENABLE));
+
+  // Memory to memory the "peripheral" port is the source
+  if (HAL_DMA_Start_IT(&hdma_copy, (uint32_t)copy->src, (uint32_t)copy->dst, count) != HAL_OK)
+  {
+    DmaCopy_Error(&hdma_copy);
+  }
+}
+
+/**
+  * @brief Retire the head copy and start the next
+  */
+static void DmaCopy_Retire(void)
+{
+  const DmaCopy_t *copy = &copy_queue[copy_head % DMA_COPY_QUEUE];
+  DmaCopyDone_t done = copy->done;
+  void *arg = copy->arg;
+
+  copy_head++;
+  if (copy_head != copy_tail)
+  {
+    DmaCopy_Kick();
+  }
+  if (done)
+  {
+    done(arg);
+  }
+}
+
+/**
+  * @brief Transfer complete
+  */
+static void DmaCopy_Done(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  DmaCopy_Retire();
+}
+
+/**
+  * @brief Transfer or start error: the CPU copies instead
+  */
+static void DmaCopy_Error(DMA_HandleTypeDef *hdma)
+{
+  const DmaCopy_t *copy = &copy_queue[copy_head % DMA_COPY_QUEUE];
+
+  HAL_DMA_Abort(hdma);
+  if (copy->feed)
+  {
+    for (uint32_t i = 0; i < copy->len / 4U; i++)
+    {
+      *(volatile uint32_t *)copy->dst = ((const uint32_t *)copy->src)[i];
+    }
+  }
+  else
+  {
+    memcpy(copy->dst, copy->src, copy->len);
+  }
+  DmaCopy_Retire();
+}
+#endif
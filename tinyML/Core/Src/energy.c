@@ -0,0 +1,185 @@
+/**
+  ******************************************************************************
+  * @file           : energy.c
+  * @brief          : Awake and asleep time per clock profile (APP_ENERGY)
+  ******************************************************************************
+  */
+
+#include "energy.h"
+#include "main.h"
+#include "profile.h"
+#include <string.h>
+
+#if APP_ENERGY
+typedef struct {
+  uint64_t awake_cycles;               // DWT cycles at hz
+  uint32_t hz;
+  uint32_t asleep_us;
+  uint32_t inferences;
+} EnergySlot_t;
+
+static const uint32_t energy_run_ua[ENERGY_SLOTS] = APP_ENERGY_RUN_UA;
+static const uint32_t energy_sleep_ua[ENERGY_SLOTS] = APP_ENERGY_SLEEP_UA;
+
+static EnergySlot_t energy_slots[ENERGY_SLOTS];
+static uint8_t energy_slot;
+static uint8_t energy_asleep;
+static uint32_t energy_mark;           // DWT at the last wake-up or checkpoint
+static uint32_t energy_sleep_us;       // TIM5 at sleep entry
+static uint32_t energy_since;          // HAL_GetTick of the last reset
+
+/**
+  * @brief Slot of the running clock profile, the boot clock last
+  */
+static uint8_t Energy_Slot(void)
+{
+  ClockProfile_t profile = Clock_GetProfile();
+
+  return (profile < CLOCK_PROFILE_COUNT) ? (uint8_t)profile : CLOCK_PROFILE_COUNT;
+}
+
+/**
+  * @brief Restart TIM5 at 1 MHz from the current PCLK1
+  */
+static void Energy_StartTimer(void)
+{
+  uint32_t clk = HAL_RCC_GetPCLK1Freq();
+
+  // APB1 timers run at twice PCLK1 when it is divided
+  if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+  {
+    clk *= 2U;
+  }
+  ENERGY_TIMER->CR1 = 0;
+  ENERGY_TIMER->PSC = clk / 1000000U - 1U;
+  ENERGY_TIMER->ARR = 0xFFFFFFFFU;
+  ENERGY_TIMER->EGR = TIM_EGR_UG;      // loads PSC, zeroes CNT
+  ENERGY_TIMER->CR1 = TIM_CR1_CEN;
+}
+
+/**
+  * @brief Awake cycles up to now go to the running slot
+  */
+static void Energy_Checkpoint(void)
+{
+  uint32_t now = PROF_CYCLES();
+
+  energy_slots[energy_slot].awake_cycles += now - energy_mark;
+  energy_mark = now;
+}
+
+/**
+  * @brief Marker pin, TIM5 and the counters, on the clock the application runs at
+  */
+void Energy_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  __HAL_RCC_GPIOD_CLK_ENABLE();
+  HAL_GPIO_WritePin(ENERGY_PORT, ENERGY_PIN, GPIO_PIN_SET);
+  GPIO_InitStruct.Pin = ENERGY_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+  HAL_GPIO_Init(ENERGY_PORT, &GPIO_InitStruct);
+
+  Prof_Init();
+  __HAL_RCC_TIM5_CLK_ENABLE();
+  Energy_StartTimer();
+  energy_slot = Energy_Slot();
+  Energy_Reset();
+}
+
+/**
+  * @brief Move to the new profile's slot after HCLK or PCLK1 changed
+  * @note  Asleep (STOP wake-up) the time since Energy_Sleep is dropped,
+  *        TIM5 did not count it
+  */
+void Energy_ClockChanged(void)
+{
+  if (!energy_asleep)
+  {
+    Energy_Checkpoint();
+  }
+  energy_slot = Energy_Slot();
+  energy_slots[energy_slot].hz = HAL_RCC_GetHCLKFreq();
+  Energy_StartTimer();
+  energy_sleep_us = 0;
+}
+
+/**
+  * @brief Entering WFI or STOP, interrupts masked
+  */
+void Energy_Sleep(void)
+{
+  Energy_Checkpoint();
+  ENERGY_PORT->BSRR = (uint32_t)ENERGY_PIN << 16;
+  energy_sleep_us = ENERGY_TIMER->CNT;
+  energy_asleep = 1;
+}
+
+/**
+  * @brief Back from WFI or STOP, before the interrupt that woke the core runs
+  */
+void Energy_Wake(void)
+{
+  ENERGY_PORT->BSRR = ENERGY_PIN;
+  energy_slots[energy_slot].asleep_us += ENERGY_TIMER->CNT - energy_sleep_us;
+  energy_mark = PROF_CYCLES();
+  energy_asleep = 0;
+}
+
+/**
+  * @brief Count one network run against the running profile
+  */
+void Energy_Inference(void)
+{
+  energy_slots[energy_slot].inferences++;
+}
+
+/**
+  * @brief Fill the ENERGY reply up to the request's current span
+  * @retval slots written
+  */
+uint8_t Energy_Read(ProtoEnergy_t *header, ProtoEnergySlot_t *slots)
+{
+  Energy_Checkpoint();
+
+  memset(header, 0, sizeof(*header));
+  header->cpu_hz = HAL_RCC_GetHCLKFreq();
+  header->mv = (uint16_t)APP_ENERGY_MV;
+  header->slot = energy_slot;
+  header->slots = ENERGY_SLOTS;
+  header->window_ms = HAL_GetTick() - energy_since;
+
+  for (uint8_t i = 0; i < ENERGY_SLOTS; i++)
+  {
+    const EnergySlot_t *s = &energy_slots[i];
+    uint32_t mhz = s->hz / 1000000U;
+    uint64_t ua_us;
+
+    slots[i].hz = s->hz;
+    slots[i].run_ua = energy_run_ua[i];
+    slots[i].sleep_ua = energy_sleep_ua[i];
+    slots[i].awake_us = mhz ? (uint32_t)(s->awake_cycles / mhz) : 0;
+    slots[i].asleep_us = s->asleep_us;
+    slots[i].inferences = s->inferences;
+    // uA x us x mV is 1e-9 uJ
+    ua_us = (uint64_t)slots[i].run_ua * slots[i].awake_us +
+            (uint64_t)slots[i].sleep_ua * slots[i].asleep_us;
+    slots[i].energy_uj = (uint32_t)(ua_us * APP_ENERGY_MV / 1000000000ULL);
+  }
+  return ENERGY_SLOTS;
+}
+
+/**
+  * @brief Zero the counters, the window starts now
+  */
+void Energy_Reset(void)
+{
+  memset(energy_slots, 0, sizeof(energy_slots));
+  energy_slots[energy_slot].hz = HAL_RCC_GetHCLKFreq();
+  energy_mark = PROF_CYCLES();
+  energy_since = HAL_GetTick();
+}
+#endif /* APP_ENERGY */
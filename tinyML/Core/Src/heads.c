@@ -0,0 +1,148 @@
+/**
+  ******************************************************************************
+  * @file           : heads.c
+  * @brief          : Some heads of a multi-head network, one backbone pass
+  ******************************************************************************
+  */
+
+#include "heads.h"
+#include "models.h"
+#include "ai_layer_custom_interface.h"
+
+#if APP_MODEL_MULTIHEAD
+// c-nodes of the heads not run and the forwards they had
+static ai_node *heads_nodes[MODEL_MAX_NODES];
+static node_func heads_saved[MODEL_MAX_NODES];
+static uint8_t heads_count;
+
+// Heads each c-node of heads_net leads to, a bit per output
+static ai_network *heads_net;
+static uint8_t heads_uses[MODEL_MAX_NODES];
+
+/**
+  * @brief Forward of a c-node only heads not asked for read
+  */
+static void Heads_Skip(ai_node *node)
+{
+  (void)node;
+}
+
+/**
+  * @brief Whether node reads tensor
+  */
+static int Heads_Reads(ai_node *node, const ai_tensor *tensor)
+{
+  ai_size n = ai_layer_get_tensor_in_size((ai_layer *)node);
+
+  for (ai_size i = 0; i < n; i++)
+  {
+    if (ai_layer_get_tensor_in((ai_layer *)node, i) == tensor)
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief Find the heads each c-node of net leads to, once per network
+  * @retval c-nodes, 0 if some lead to none of the outputs
+  */
+static uint32_t Heads_Map(ai_network *net, ai_node **nodes, const ai_buffer *outputs, uint8_t count)
+{
+  ai_node *node = net->input_node;
+  uint32_t n = 0;
+
+  while (node && n < MODEL_MAX_NODES)
+  {
+    nodes[n++] = node;
+    // The last layer links to itself
+    node = (node->next == node) ? NULL : node->next;
+  }
+  if (heads_net == net)
+  {
+    return n;
+  }
+
+  for (uint32_t i = n; i-- > 0;)
+  {
+    const ai_tensor *out = ai_layer_get_tensor_out((ai_layer *)nodes[i], 0);
+    uint8_t read = 0;
+
+    heads_uses[i] = 0;
+    for (uint32_t j = i + 1U; j < n; j++)
+    {
+      if (Heads_Reads(nodes[j], out))
+      {
+        heads_uses[i] |= heads_uses[j];
+        read = 1;
+      }
+    }
+    // Only a c-node nothing reads writes an output: the arena may put an
+    // earlier tensor where an output ends up
+    for (uint8_t k = 0; !read && out && k < count; k++)
+    {
+      if (ai_tensor_get_data(out).s8 == (ai_i8 *)outputs[k].data)
+      {
+        heads_uses[i] |= (uint8_t)(1U << k);
+      }
+    }
+    if (heads_uses[i] == 0)
+    {
+      return 0;
+    }
+  }
+  heads_net = net;
+  return n;
+}
+#endif
+
+/**
+  * @brief Leave only the backbone and the given heads of a network to run
+  * @param outputs the network's count output buffers, one per head
+  * @param heads   a bit per output to compute, the rest are left as they were
+  * @note  Heads_End() puts the other heads back, after the run
+  * @retval 0, -1 if the graph does not split into heads
+  */
+int Heads_Begin(ai_handle network, const ai_buffer *outputs, uint8_t count, uint8_t heads)
+{
+#if APP_MODEL_MULTIHEAD
+  ai_network *net = AI_NETWORK_ACQUIRE_CTX(network);
+  ai_node *nodes[MODEL_MAX_NODES];
+  uint32_t n;
+
+  heads_count = 0;
+  n = net ? Heads_Map(net, nodes, outputs, count) : 0;
+  if (n == 0)
+  {
+    return -1;
+  }
+  for (uint32_t i = 0; i < n; i++)
+  {
+    if ((heads_uses[i] & heads) == 0)
+    {
+      heads_nodes[heads_count] = nodes[i];
+      heads_saved[heads_count++] = nodes[i]->forward;
+      nodes[i]->forward = AI_NODE_FUNC(Heads_Skip);
+    }
+  }
+  return 0;
+#else
+  (void)network; (void)outputs; (void)count; (void)heads;
+  return -1;
+#endif
+}
+
+/**
+  * @brief Give the c-nodes Heads_Begin() parked their forwards back
+  */
+void Heads_End(void)
+{
+#if APP_MODEL_MULTIHEAD
+  while (heads_count)
+  {
+    heads_count--;
+    heads_nodes[heads_count]->forward = heads_saved[heads_count];
+  }
+#endif
+}
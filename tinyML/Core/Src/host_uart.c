@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file           : host_uart.c
+  * @brief          : Host link moved off USART2 onto USART1 or USART6
+  ******************************************************************************
+  * tinyML.ioc, and the code CubeMX generates from it, keep the host link
+  * on USART2. With APP_HOST_UART 1 or 6, MX_USART2_UART_Init sets it up
+  * there as generated, then hands it here from its USER CODE: USART2 is
+  * de-initialised, which frees PA2/PA3 and DMA1 streams 5 and 6 through
+  * the generated MSP, and huart2 with hdma_usart2_rx/_tx is set up again
+  * on the APB2 USART and the streams of host_uart.h.
+  *
+  * HAL_UART_MspInit only knows USART2, so everything it would do is done
+  * here, as uart_link.c does for its ports. The IRQ handlers are in the
+  * USER CODE of stm32f4xx_it.c and call the generated USART2 ones, which
+  * serve whichever peripheral huart2 runs.
+  ******************************************************************************
+  */
+
+#include "host_uart.h"
+
+#if APP_HOST_UART != 2
+
+#include "main.h"
+
+extern DMA_HandleTypeDef hdma_usart2_rx;
+extern DMA_HandleTypeDef hdma_usart2_tx;
+
+/**
+  * @brief Move the initialised USART2 host link onto HOST_USART
+  * @note  Keeps huart->Init, the flow control and baud set after it apply
+  *        to the new USART
+  */
+void HostUart_Init(UART_HandleTypeDef *huart)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  if (HAL_UART_DeInit(huart) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  // MX_DMA_Init enabled these for USART2, nothing runs on them now
+  HAL_NVIC_DisableIRQ(DMA1_Stream5_IRQn);
+  HAL_NVIC_DisableIRQ(DMA1_Stream6_IRQn);
+
+  HOST_USART_CLK_ENABLE();
+  HOST_GPIO_CLK_ENABLE();
+  HOST_DMA_CLK_ENABLE();
+
+  GPIO_InitStruct.Pin = HOST_PINS;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  GPIO_InitStruct.Alternate = HOST_AF;
+  HAL_GPIO_Init(HOST_GPIO, &GPIO_InitStruct);
+#if APP_UART_FLOW
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  GPIO_InitStruct.Pin = HOST_FLOW_PINS;
+  HAL_GPIO_Init(HOST_FLOW_GPIO, &GPIO_InitStruct);
+#endif
+
+  // As the generated MSP sets up USART2's streams
+  hdma_usart2_rx.Instance = HOST_DMA_RX_STREAM;
+  hdma_usart2_rx.Init.Channel = HOST_DMA_CHANNEL;
+  hdma_usart2_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_usart2_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_usart2_rx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_usart2_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_usart2_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_usart2_rx.Init.Mode = DMA_CIRCULAR;
+  hdma_usart2_rx.Init.Priority = DMA_PRIORITY_HIGH;
+  hdma_usart2_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_usart2_rx) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  __HAL_LINKDMA(huart, hdmarx, hdma_usart2_rx);
+
+  hdma_usart2_tx.Instance = HOST_DMA_TX_STREAM;
+  hdma_usart2_tx.Init.Channel = HOST_DMA_CHANNEL;
+  hdma_usart2_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_usart2_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_usart2_tx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_usart2_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_usart2_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_usart2_tx.Init.Mode = DMA_NORMAL;
+  hdma_usart2_tx.Init.Priority = DMA_PRIORITY_MEDIUM;
+  hdma_usart2_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_usart2_tx) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  __HAL_LINKDMA(huart, hdmatx, hdma_usart2_tx);
+
+  // USART2's priorities, the rest of the firmware assumes them
+  HAL_NVIC_SetPriority(HOST_DMA_RX_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(HOST_DMA_RX_IRQn);
+  HAL_NVIC_SetPriority(HOST_DMA_TX_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(HOST_DMA_TX_IRQn);
+  HAL_NVIC_SetPriority(HOST_USART_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(HOST_USART_IRQn);
+
+  huart->Instance = HOST_USART;
+  if (HAL_UART_Init(huart) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+#endif /* APP_HOST_UART != 2 */
@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file           : image_crop.c
+  * @brief          : Area resampling of CLASSIFY_CROP images to the model input
+  ******************************************************************************
+  * Positions are kept in 1/28 of a frame pixel: output pixel i spans
+  * [i * frame, (i + 1) * frame) and every overlap is an integer weight, so
+  * there is no floating point and a single rounding in the final divide.
+  ******************************************************************************
+  */
+
+#include "image_crop.h"
+#include <string.h>
+
+// Framed crop side: longest crop side plus the border on both ends
+#define CROP_FRAME_MAX          (PROTO_CROP_MAX + 2U)
+// Frame pixels an output pixel can touch: 58/28 wide, partial at both ends
+#define CROP_TAPS               4U
+
+typedef struct {
+  uint8_t first;                       // first frame pixel covered
+  uint8_t count;
+  uint8_t weight[CROP_TAPS];           // overlap in 1/28 pixel units
+} CropTaps_t;
+
+static CropTaps_t crop_taps[CROP_OUT_SIZE];
+// Horizontal pass, one row of CROP_OUT_SIZE sums per crop row
+static uint16_t crop_rows[PROTO_CROP_MAX][CROP_OUT_SIZE];
+
+/**
+  * @brief Overlap of every output pixel with the frame pixels of a side
+  */
+static void Crop_BuildTaps(uint16_t frame)
+{
+  for (uint16_t i = 0; i < CROP_OUT_SIZE; i++)
+  {
+    uint16_t lo = i * frame;
+    uint16_t hi = lo + frame;
+    CropTaps_t *t = &crop_taps[i];
+
+    t->first = (uint8_t)(lo / CROP_OUT_SIZE);
+    t->count = (uint8_t)((hi - 1U) / CROP_OUT_SIZE - t->first + 1U);
+    for (uint16_t k = 0; k < t->count; k++)
+    {
+      uint16_t p_lo = (t->first + k) * CROP_OUT_SIZE;
+      uint16_t p_hi = p_lo + CROP_OUT_SIZE;
+      t->weight[k] = (uint8_t)(((hi < p_hi) ? hi : p_hi) - ((lo > p_lo) ? lo : p_lo));
+    }
+  }
+}
+
+/**
+  * @brief Vertical pass of output row j: weight * row sum over the crop rows
+  */
+static void Crop_SumRow(uint16_t j, uint16_t top, uint16_t h, uint32_t *acc)
+{
+  const CropTaps_t *t = &crop_taps[j];
+
+  memset(acc, 0, CROP_OUT_SIZE * sizeof(*acc));
+  for (uint16_t k = 0; k < t->count; k++)
+  {
+    uint16_t y = t->first + k - top;   // wraps for the top border
+    if (y >= h) continue;
+    const uint16_t *row = crop_rows[y];
+    uint32_t wt = t->weight[k];
+    for (uint16_t i = 0; i < CROP_OUT_SIZE; i++)
+    {
+      acc[i] += wt * row[i];
+    }
+  }
+}
+
+/**
+  * @brief Frame, resample and quantise a crop into the int8 input tensor
+  * @param input CROP_OUT_SIZE^2 int8 input tensor
+  * @retval PROTO_ERR_LENGTH if the size bytes and len disagree,
+  *         PROTO_ERR_PARAM for an empty or oversized crop
+  */
+ProtoError_t Crop_Load(const uint8_t *payload, uint16_t len, int8_t *input)
+{
+  if (len < CROP_HEADER_SIZE) return PROTO_ERR_LENGTH;
+
+  uint16_t w = payload[0];
+  uint16_t h = payload[1];
+  const uint8_t *px = payload + CROP_HEADER_SIZE;
+
+  if (w == 0 || h == 0 || w > PROTO_CROP_MAX || h > PROTO_CROP_MAX) return PROTO_ERR_PARAM;
+  if (len != CROP_HEADER_SIZE + w * h) return PROTO_ERR_LENGTH;
+
+  // EMNIST pads with 2/128 of the side, at least one pixel
+  uint16_t side = (w > h) ? w : h;
+  uint16_t border = (side + 32U) / 64U;
+  if (border == 0) border = 1;
+  uint16_t frame = side + 2U * border;
+  uint16_t left = border + (side - w) / 2U;
+  uint16_t top = border + (side - h) / 2U;
+
+  Crop_BuildTaps(frame);
+
+  // Horizontal: each crop row to CROP_OUT_SIZE sums of weight * pixel
+  for (uint16_t y = 0; y < h; y++)
+  {
+    const uint8_t *row = &px[y * w];
+    for (uint16_t i = 0; i < CROP_OUT_SIZE; i++)
+    {
+      const CropTaps_t *t = &crop_taps[i];
+      uint32_t sum = 0;
+      for (uint16_t k = 0; k < t->count; k++)
+      {
+        uint16_t x = t->first + k - left;  // wraps for the left border
+        if (x < w) sum += t->weight[k] * row[x];
+      }
+      crop_rows[y][i] = (uint16_t)sum;
+    }
+  }
+
+  // Vertical twice: first for the brightest sum, then each sum scaled so
+  // it becomes 255 (the area divide cancels out)
+  uint32_t acc[CROP_OUT_SIZE];
+  uint32_t peak = 0;
+  for (uint16_t j = 0; j < CROP_OUT_SIZE; j++)
+  {
+    Crop_SumRow(j, top, h, acc);
+    for (uint16_t i = 0; i < CROP_OUT_SIZE; i++)
+    {
+      if (acc[i] > peak) peak = acc[i];
+    }
+  }
+
+  if (peak == 0) peak = 1;
+
+  // uint8 -> int8 is x ^ 0x80
+  int8_t *out = input;
+  for (uint16_t j = 0; j < CROP_OUT_SIZE; j++)
+  {
+    Crop_SumRow(j, top, h, acc);
+    for (uint16_t i = 0; i < CROP_OUT_SIZE; i++)
+    {
+      *out++ = (int8_t)((uint8_t)((acc[i] * 255U + peak / 2U) / peak) ^ 0x80U);
+    }
+  }
+
+  return PROTO_ERR_NONE;
+}
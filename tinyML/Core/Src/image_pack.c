@@ -0,0 +1,349 @@
+/**
+  ******************************************************************************
+  * @file           : image_pack.c
+  * @brief          : Decoder for the compressed CLASSIFY_PACKED image encodings
+  ******************************************************************************
+  */
+
+#include "image_pack.h"
+#include <string.h>
+
+// Last decoded image, the base of the next DELTA frame
+static uint8_t pack_image[PACK_IMAGE_SIZE] __attribute__((aligned(4)));
+static uint8_t pack_tag = 0;
+static uint8_t pack_valid = 0;
+
+/**
+  * @brief Expand zero runs into pack_image
+  */
+static ProtoError_t Pack_DecodeZrle(const uint8_t *p, const uint8_t *end)
+{
+  uint16_t n = 0;
+
+  while (p < end)
+  {
+    uint8_t b = *p++;
+    if (b)
+    {
+      if (n >= PACK_IMAGE_SIZE) return PROTO_ERR_LENGTH;
+      pack_image[n++] = b;
+      continue;
+    }
+
+    if (p == end) return PROTO_ERR_LENGTH;
+    uint8_t run = *p++;
+    if (run == 0 || run > PACK_IMAGE_SIZE - n) return PROTO_ERR_LENGTH;
+    memset(&pack_image[n], 0, run);
+    n += run;
+  }
+
+  return (n == PACK_IMAGE_SIZE) ? PROTO_ERR_NONE : PROTO_ERR_LENGTH;
+}
+
+/**
+  * @brief Replace the pixels flagged in bitmap, others become fill or stay
+  * @param keep 0: unflagged pixels are zero (BITMAP), 1: unchanged (DELTA)
+  */
+static ProtoError_t Pack_DecodeBitmap(const uint8_t *p, const uint8_t *end, uint8_t keep)
+{
+  const uint8_t *bitmap = p;
+  const uint8_t *values = p + PACK_BITMAP_SIZE;
+
+  if (end - p < (int)PACK_BITMAP_SIZE) return PROTO_ERR_LENGTH;
+
+  for (uint16_t i = 0; i < PACK_BITMAP_SIZE; i++)
+  {
+    uint8_t bits = bitmap[i];
+    uint8_t *dst = &pack_image[i * 8U];
+
+    if (!bits)
+    {
+      // Whole byte of untouched pixels, the common case
+      if (!keep) memset(dst, 0, 8);
+      continue;
+    }
+
+    for (uint8_t b = 0; b < 8; b++)
+    {
+      if (bits & (1U << b))
+      {
+        if (values == end) return PROTO_ERR_LENGTH;
+        dst[b] = *values++;
+      }
+      else if (!keep)
+      {
+        dst[b] = 0;
+      }
+    }
+  }
+
+  return (values == end) ? PROTO_ERR_NONE : PROTO_ERR_LENGTH;
+}
+
+/**
+  * @brief Expand 1 or 4 bit pixels to the 0-255 range
+  */
+static ProtoError_t Pack_DecodeBits(const uint8_t *p, uint16_t len, uint8_t bits)
+{
+  if (len != PACK_IMAGE_SIZE * bits / 8U) return PROTO_ERR_LENGTH;
+
+  if (bits == 1U)
+  {
+    for (uint16_t i = 0; i < PACK_IMAGE_SIZE; i++)
+    {
+      pack_image[i] = (p[i >> 3] & (1U << (i & 7U))) ? 255U : 0U;
+    }
+  }
+  else
+  {
+    for (uint16_t i = 0; i < PACK_IMAGE_SIZE / 2U; i++)
+    {
+      pack_image[2U * i] = (uint8_t)((p[i] & 0x0FU) * 17U);
+      pack_image[2U * i + 1U] = (uint8_t)((p[i] >> 4) * 17U);
+    }
+  }
+
+  return PROTO_ERR_NONE;
+}
+
+/**
+  * @brief Integer square root, rounded down
+  */
+static uint32_t Pack_Sqrt(uint32_t v)
+{
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+
+  while (bit > v)
+  {
+    bit >>= 2;
+  }
+  while (bit)
+  {
+    if (v >= root + bit)
+    {
+      v -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+/**
+  * @brief Cover the pixels near segment a-b at radius r, all in 1/256 px
+  * @note  A pixel keeps the most coverage of any segment, which is the
+  *        coverage of the nearest one
+  */
+static void Pack_Segment(int32_t ax, int32_t ay, int32_t bx, int32_t by, int32_t r)
+{
+  int32_t dx = bx - ax;
+  int32_t dy = by - ay;
+  int32_t len2 = dx * dx + dy * dy;
+  int32_t len = (int32_t)Pack_Sqrt((uint32_t)len2);
+  int32_t reach = r + 128;              // half a pixel of edge outside the pen
+  int32_t inner2 = (r >= 128) ? (r - 128) * (r - 128) : -1;
+  int32_t x0 = (((ax < bx) ? ax : bx) - reach) >> 8;
+  int32_t x1 = (((ax > bx) ? ax : bx) + reach) >> 8;
+  int32_t y0 = (((ay < by) ? ay : by) - reach) >> 8;
+  int32_t y1 = (((ay > by) ? ay : by) + reach) >> 8;
+
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 > (int32_t)PACK_SIDE - 1) x1 = PACK_SIDE - 1;
+  if (y1 > (int32_t)PACK_SIDE - 1) y1 = PACK_SIDE - 1;
+
+  for (int32_t y = y0; y <= y1; y++)
+  {
+    int32_t py = y * 256 + 128 - ay;
+
+    for (int32_t x = x0; x <= x1; x++)
+    {
+      int32_t px = x * 256 + 128 - ax;
+      int32_t dot = px * dx + py * dy;
+      int32_t dist, cover;
+      uint8_t *pixel = &pack_image[y * PACK_SIDE + x];
+
+      if (len2 != 0 && dot > 0 && dot < len2)
+      {
+        // Beside the segment: the cross product over its length
+        int32_t cross = px * dy - py * dx;
+        dist = ((cross < 0) ? -cross : cross) / len;
+      }
+      else
+      {
+        // Past an end: the distance to that end
+        int32_t d2;
+        if (len2 != 0 && dot >= len2)
+        {
+          px -= dx;
+          d2 = px * px + (py - dy) * (py - dy);
+          px += dx;
+        }
+        else
+        {
+          d2 = px * px + py * py;
+        }
+        if (d2 >= reach * reach) continue;
+        dist = (d2 <= inner2) ? 0 : (int32_t)Pack_Sqrt((uint32_t)d2);
+      }
+
+      cover = reach - dist;
+      if (cover <= 0) continue;
+      if (cover > 256) cover = 256;
+      cover = (cover * 255 + 128) >> 8;
+      if (cover > *pixel) *pixel = (uint8_t)cover;
+    }
+  }
+}
+
+/**
+  * @brief Frame position in 1/256 px of coordinate g, c the frame's
+  *        lower plus upper edge in 1/8 units
+  */
+static int32_t Pack_Px(uint8_t g, int32_t c, int32_t denom)
+{
+  return (16 * g - c) * (int32_t)(PACK_SIDE * 16U * 256U) / denom + (int32_t)(PACK_SIDE * 128U);
+}
+
+/**
+  * @brief Rasterise strokes into pack_image, framed as the host frames them
+  */
+static ProtoError_t Pack_DecodeStrokes(const uint8_t *p, const uint8_t *end)
+{
+  const uint8_t *q;
+  int32_t lo_x = INT32_MAX, lo_y = INT32_MAX, hi_x = INT32_MIN, hi_y = INT32_MIN;
+  int32_t r, side, c_x, c_y, denom, pen;
+
+  if (end - p < 2) return PROTO_ERR_LENGTH;
+  r = *p++;
+  if (r == 0) return PROTO_ERR_PARAM;
+
+  // Check the strokes and find the ink's extent, coordinates in 1/8 units
+  for (q = p; q < end; )
+  {
+    uint8_t n = *q++;
+    if (n == 0 || end - q < 2 * (int32_t)n) return PROTO_ERR_LENGTH;
+    for (uint8_t i = 0; i < n; i++, q += 2)
+    {
+      int32_t x = q[0] * 8, y = q[1] * 8;
+      if (x < lo_x) lo_x = x;
+      if (x > hi_x) hi_x = x;
+      if (y < lo_y) lo_y = y;
+      if (y > hi_y) hi_y = y;
+    }
+  }
+  lo_x -= r;
+  lo_y -= r;
+  hi_x += r;
+  hi_y += r;
+  side = (hi_x - lo_x > hi_y - lo_y) ? hi_x - lo_x : hi_y - lo_y;
+  c_x = lo_x + hi_x;
+  c_y = lo_y + hi_y;
+
+  // Frame = side * 33 / 32 (a 2/128 border each side) over PACK_SIDE
+  // pixels: a unit is PACK_SIDE * 32 * 256 / (33 * side) in 1/256 px
+  denom = 33 * side;
+  pen = r * (int32_t)(PACK_SIDE * 32U * 256U) / denom;
+
+  memset(pack_image, 0, PACK_IMAGE_SIZE);
+  for (q = p; q < end; )
+  {
+    uint8_t n = *q++;
+    int32_t ax = Pack_Px(q[0], c_x, denom), ay = Pack_Px(q[1], c_y, denom);
+
+    if (n == 1)
+    {
+      Pack_Segment(ax, ay, ax, ay, pen);
+    }
+    for (uint8_t i = 1; i < n; i++)
+    {
+      int32_t bx = Pack_Px(q[2 * i], c_x, denom), by = Pack_Px(q[2 * i + 1], c_y, denom);
+      Pack_Segment(ax, ay, bx, by, pen);
+      ax = bx;
+      ay = by;
+    }
+    q += 2 * n;
+  }
+
+  return PROTO_ERR_NONE;
+}
+
+/**
+  * @brief Decode a CLASSIFY_PACKED payload into the image returned by Pack_Image
+  * @note  A DELTA whose base is not the last image is refused with
+  *        PROTO_ERR_PARAM so the host resends a full encoding; the retry of
+  *        an already applied DELTA (same tag) is accepted as is. Any failure
+  *        drops the base.
+  */
+ProtoError_t Pack_Decode(const uint8_t *payload, uint16_t len)
+{
+  const uint8_t *end = payload + len;
+  ProtoError_t err;
+  uint8_t tag;
+
+  if (len < 2) return PROTO_ERR_LENGTH;
+  tag = payload[1];
+
+  switch (payload[0])
+  {
+    case PROTO_PACK_RAW:
+      if (len != 2U + PACK_IMAGE_SIZE)
+      {
+        return PROTO_ERR_LENGTH;
+      }
+      memcpy(pack_image, &payload[2], PACK_IMAGE_SIZE);
+      err = PROTO_ERR_NONE;
+      break;
+
+    case PROTO_PACK_ZRLE:
+      err = Pack_DecodeZrle(&payload[2], end);
+      break;
+
+    case PROTO_PACK_BITMAP:
+      err = Pack_DecodeBitmap(&payload[2], end, 0);
+      break;
+
+    case PROTO_PACK_BITS1:
+      err = Pack_DecodeBits(&payload[2], len - 2U, 1U);
+      break;
+
+    case PROTO_PACK_BITS4:
+      err = Pack_DecodeBits(&payload[2], len - 2U, 4U);
+      break;
+
+    case PROTO_PACK_STROKES:
+      err = Pack_DecodeStrokes(&payload[2], end);
+      break;
+
+    case PROTO_PACK_DELTA:
+      if (len < 3) return PROTO_ERR_LENGTH;
+      if (!pack_valid || payload[2] != pack_tag)
+      {
+        // Host retry of a frame that was applied but whose reply was lost
+        return (pack_valid && tag == pack_tag) ? PROTO_ERR_NONE : PROTO_ERR_PARAM;
+      }
+      err = Pack_DecodeBitmap(&payload[3], end, 1);
+      break;
+
+    default:
+      return PROTO_ERR_PARAM;
+  }
+
+  // Partial decodes have already overwritten the base
+  pack_valid = (err == PROTO_ERR_NONE);
+  pack_tag = tag;
+  return err;
+}
+
+/**
+  * @brief Image of the last successful Pack_Decode (uint8, PACK_IMAGE_SIZE)
+  */
+const uint8_t *Pack_Image(void)
+{
+  return pack_image;
+}
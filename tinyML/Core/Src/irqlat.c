@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file           : irqlat.c
+  * @brief          : RX interrupt latency under inference load (APP_IRQ_LATENCY)
+  ******************************************************************************
+  */
+
+#include "irqlat.h"
+#include "host_uart.h"
+#include "main.h"
+#include "profile.h"
+#include <string.h>
+
+#if APP_IRQ_LATENCY
+// Fewer timer ticks between arrivals would leave the core no time for runs
+#define IRQLAT_MIN_TICKS        32U
+
+static uint32_t irqlat_interval;       // ticks of a byte time
+static uint32_t irqlat_scale;          // core cycles per tick
+static uint32_t irqlat_lcg;
+static uint32_t irqlat_baud;
+static uint32_t irqlat_samples;
+static uint32_t irqlat_overruns;
+static uint32_t irqlat_min;
+static uint32_t irqlat_max;
+static uint64_t irqlat_sum;
+static uint32_t irqlat_handler_max;
+static uint32_t irqlat_buckets[PROTO_IRQLAT_BUCKETS];
+static volatile uint8_t irqlat_sink[16]; // where an RXNE handler would store
+static uint8_t irqlat_head;
+
+/**
+  * @brief Ticks to the next arrival: half to one and a half byte times
+  */
+static uint32_t IrqLat_Next(void)
+{
+  irqlat_lcg = irqlat_lcg * 1664525U + 1013904223U;
+  return irqlat_interval / 2U + (irqlat_lcg >> 8) % irqlat_interval;
+}
+
+/**
+  * @brief Zero the counters and let TIM2 raise arrivals at the given baud
+  * @retval 0, or -1 if a byte time is too short to measure
+  */
+int IrqLat_Start(uint32_t baud)
+{
+  uint32_t clk = HAL_RCC_GetPCLK1Freq();
+
+  // APB1 timers run at twice PCLK1 when it is divided
+  if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+  {
+    clk *= 2U;
+  }
+  // 10 bit times per byte, 8N1
+  if (baud == 0U || (uint64_t)clk * 10U / baud < IRQLAT_MIN_TICKS)
+  {
+    return -1;
+  }
+  irqlat_interval = (uint32_t)((uint64_t)clk * 10U / baud);
+  irqlat_scale = HAL_RCC_GetHCLKFreq() / clk;
+  irqlat_baud = baud;
+  irqlat_lcg = PROF_CYCLES();
+  irqlat_samples = 0;
+  irqlat_overruns = 0;
+  irqlat_min = UINT32_MAX;
+  irqlat_max = 0;
+  irqlat_sum = 0;
+  irqlat_handler_max = 0;
+  memset(irqlat_buckets, 0, sizeof(irqlat_buckets));
+
+  __HAL_RCC_TIM2_CLK_ENABLE();
+  IRQLAT_TIMER->CR1 = 0;
+  IRQLAT_TIMER->PSC = 0;
+  IRQLAT_TIMER->ARR = 0xFFFFFFFFU;
+  IRQLAT_TIMER->EGR = TIM_EGR_UG;      // loads PSC, zeroes CNT
+  IRQLAT_TIMER->CCR1 = IrqLat_Next();
+  IRQLAT_TIMER->SR = 0;
+  IRQLAT_TIMER->DIER = TIM_DIER_CC1IE;
+
+  // Where RXNE would be raised, so the same handlers hold it off
+  NVIC_SetPriority(IRQLAT_IRQn, NVIC_GetPriority(HOST_USART_IRQn));
+  NVIC_ClearPendingIRQ(IRQLAT_IRQn);
+  NVIC_EnableIRQ(IRQLAT_IRQn);
+  IRQLAT_TIMER->CR1 = TIM_CR1_CEN;
+  return 0;
+}
+
+/**
+  * @brief No more arrivals
+  */
+void IrqLat_Stop(void)
+{
+  IRQLAT_TIMER->CR1 = 0;
+  IRQLAT_TIMER->DIER = 0;
+  NVIC_DisableIRQ(IRQLAT_IRQn);
+  IRQLAT_TIMER->SR = 0;
+  NVIC_ClearPendingIRQ(IRQLAT_IRQn);
+  __HAL_RCC_TIM2_CLK_DISABLE();
+}
+
+/**
+  * @brief Fill the IRQ_LATENCY reply but for runs, gap_max and rx_ring
+  */
+void IrqLat_Read(ProtoIrqLat_t *reply, uint32_t *buckets)
+{
+  reply->cpu_hz = HAL_RCC_GetHCLKFreq();
+  reply->baud = irqlat_baud;
+  reply->buckets = PROTO_IRQLAT_BUCKETS;
+  reply->samples = irqlat_samples;
+  reply->overruns = irqlat_overruns;
+  reply->lat_min = irqlat_samples ? irqlat_min : 0U;
+  reply->lat_max = irqlat_max;
+  reply->lat_mean = irqlat_samples ? (uint32_t)(irqlat_sum / irqlat_samples) : 0U;
+  reply->handler_max = irqlat_handler_max;
+  reply->usart_max_baud = HOST_PCLK_FREQ() / ((HOST_USART->CR1 & USART_CR1_OVER8) ? 8U : 16U);
+  memcpy(buckets, irqlat_buckets, sizeof(irqlat_buckets));
+}
+
+/**
+  * @brief TIM2 compare: an arrival, serviced now
+  */
+void IrqLat_IRQHandler(void)
+{
+  uint32_t now = IRQLAT_TIMER->CNT;    // first: the latency ends here
+  uint32_t start = PROF_CYCLES();
+  uint32_t due = IRQLAT_TIMER->CCR1;
+  uint32_t late = now - due;
+  uint32_t cycles = late * irqlat_scale;
+  uint32_t next = due + IrqLat_Next();
+  uint32_t bucket;
+
+  IRQLAT_TIMER->SR = ~TIM_SR_CC1IF;
+  // An arrival already passed would only match again after 2^32 ticks
+  if ((int32_t)(next - now) < (int32_t)(irqlat_interval / 4U))
+  {
+    next = now + irqlat_interval / 2U;
+  }
+  IRQLAT_TIMER->CCR1 = next;
+
+  irqlat_samples++;
+  if (late >= irqlat_interval)
+  {
+    irqlat_overruns++;
+  }
+  if (cycles < irqlat_min) irqlat_min = cycles;
+  if (cycles > irqlat_max) irqlat_max = cycles;
+  irqlat_sum += cycles;
+  bucket = cycles ? 31U - __CLZ(cycles) : 0U;
+  irqlat_buckets[(bucket < PROTO_IRQLAT_BUCKETS) ? bucket : PROTO_IRQLAT_BUCKETS - 1U]++;
+
+  irqlat_sink[irqlat_head++ & (sizeof(irqlat_sink) - 1U)] = (uint8_t)now;
+  cycles = PROF_CYCLES() - start;
+  if (cycles > irqlat_handler_max) irqlat_handler_max = cycles;
+}
+#endif
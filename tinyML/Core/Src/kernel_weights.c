@@ -0,0 +1,7824 @@
+/**
+  ******************************************************************************
+  * @file           : kernel_weights.c
+  * @brief          : Weights in the layouts of the kernels in kernels.c
+  ******************************************************************************
+  * Generated by python -m stm32dc.weights from network_emnist_digits_int8.tflite_c_info.json,
+  * do not edit. Rerun after regenerating the network.
+  ******************************************************************************
+  */
+
+#include "kernel_weights.h"
+
+#if APP_KERNEL_DENSE == KERNEL_DENSE_BLOCKED
+// gemm_5 in 4-row blocks, see kernel_weights.h
+const uint32_t kernel_gemm_5_blocked[25600] __attribute__((aligned(16), section(".ai_weights"))) = {
+  0x09ec00e0U, 0x00000000U, 0x25110014U, 0xf70700d7U, 0x030efe35U, 0x00000000U, 0x14f20af6U, 0xf6f00404U,
+  0xf208dd00U, 0x00000000U, 0x05030700U, 0x07ca1700U, 0x00dde8e6U, 0x00000000U, 0x003a0529U, 0x0021d4ffU,
+  0x05f8febfU, 0x00000000U, 0x0b1e2311U, 0x03fde9dfU, 0xff0a35ffU, 0x00000000U, 0x05044004U, 0xfe1337e0U,
+  0x0efef1f9U, 0x00000000U, 0x1909f0e3U, 0x31d8151eU, 0x03070603U, 0x00000000U, 0x20290703U, 0x1410e2fdU,
+  0xe9a300f7U, 0x00000000U, 0x2103000fU, 0x192f00b7U, 0x041eeb4aU, 0x00000000U, 0x0cdf02f8U, 0xf8c420eaU,
+  0x1bffb600U, 0x00000000U, 0xfceaf800U, 0x06b00a00U, 0x00e5bd05U, 0x00000000U, 0x0031ff36U, 0x003cd1fdU,
+  0x13ed30d7U, 0x00000000U, 0x2cfc262bU, 0xed1d14b2U, 0x0b0c27fbU, 0x00000000U, 0x17243bdfU, 0xd00454fcU,
+  0x0cf9f311U, 0x00000000U, 0x0822fadaU, 0x50b70405U, 0x3c152ff7U, 0x00000000U, 0x444efe00U, 0x32330e08U,
+  0xec990005U, 0x00000000U, 0x05e800f8U, 0x302800e2U, 0x0b14d246U, 0x00000000U, 0x18e4f5c9U, 0x189c1ee1U,
+  0x17f9af00U, 0x00000000U, 0x0ff4e800U, 0x11b3ce00U, 0x001dc608U, 0x00000000U, 0x00e80026U, 0x0020c608U,
+  0x11e82ae9U, 0x00000000U, 0x71df1307U, 0xd22206ceU, 0x22072af1U, 0x00000000U, 0x08014be1U, 0xc51e1d16U,
+  0x110d0223U, 0x00000000U, 0x0a3921efU, 0x33940109U, 0x2b011214U, 0x00000000U, 0x4155e304U, 0x353a0c01U,
+  0xf2ab000dU, 0x00000000U, 0x02fa00deU, 0x3dfa0026U, 0xff12ea26U, 0x00000000U, 0xf3eaf2c3U, 0x26cafd12U,
+  0x1006be00U, 0x00000000U, 0x25fafa00U, 0xecc4e400U, 0x0005f00aU, 0x00000000U, 0x00c5f441U, 0x002801fdU,
+  0x15e8230aU, 0x00000000U, 0x59dcd1f3U, 0xc0221ce5U, 0x3a07110eU, 0x00000000U, 0x1dfb12fcU, 0xc9ef1c08U,
+  0xf91eff1cU, 0x00000000U, 0xf44123edU, 0x22a4f405U, 0x2bdce4efU, 0x00000000U, 0x1143f825U, 0x1ef7f4f7U,
+  0x00a2000dU, 0x00000000U, 0xfef400daU, 0x39f20013U, 0x161e0306U, 0x00000000U, 0xf32afbf7U, 0x2ee3fcf7U,
+  0x1205dd00U, 0x00000000U, 0xfa14f700U, 0xe80ee300U, 0x00ee041fU, 0x00000000U, 0x00e5ff21U, 0x00271dd4U,
+  0x15ec2012U, 0x00000000U, 0x2bdfc2daU, 0xeb280507U, 0x2f040706U, 0x00000000U, 0x262f0c05U, 0xeae8fb03U,
+  0xf730122bU, 0x00000000U, 0x065a3403U, 0x0cafe3fcU, 0xf8e1fc24U, 0x00000000U, 0xe818e526U, 0x0de72c18U,
+  0xe1ed00dcU, 0x00000000U, 0x1b160022U, 0xf05300dcU, 0x0b05ff12U, 0x00000000U, 0x23ff0eefU, 0xfddf310aU,
+  0xf5e8f500U, 0x00000000U, 0x081e0c00U, 0x06101100U, 0x00f0dbefU, 0x00000000U, 0x0039f518U, 0x0013c2f2U,
+  0xfffaecc0U, 0x00000000U, 0x272c151cU, 0x2601d3e0U, 0xf81e21ebU, 0x00000000U, 0xf00f34e1U, 0xea052ceeU,
+  0x14e9dd14U, 0x00000000U, 0x0924f103U, 0x0fed0a00U, 0x0cf6e0f6U, 0x00000000U, 0x31340408U, 0x264eecffU,
+  0xd8d100f4U, 0x00000000U, 0x341300ffU, 0xe45f00b5U, 0xfb2dfb0cU, 0x00000000U, 0x1ee818e8U, 0x06de4b02U,
+  0x04f4fd00U, 0x00000000U, 0x02080d00U, 0x0e01ed00U, 0x00f8be08U, 0x00000000U, 0x000cf126U, 0x001cb7c9U,
+  0x301413ddU, 0x00000000U, 0x3e0be944U, 0x170deee9U, 0x0a2e33feU, 0x00000000U, 0xfb124ac7U, 0xab1d2200U,
+  0x0be0d91dU, 0x00000000U, 0x0e350219U, 0x24ca10e7U, 0x3e0204d8U, 0x00000000U, 0x093cf40fU, 0x3846e607U,
+  0x07ca00d6U, 0x00000000U, 0x0c1a00bdU, 0x100300e3U, 0x0a21be35U, 0x00000000U, 0xf71913e9U, 0x1dcf3cf0U,
+  0x0214f900U, 0x00000000U, 0x2b0bfa00U, 0x12b8d100U, 0x0015bedeU, 0x00000000U, 0x00d5f51aU, 0x0010ddcfU,
+  0x020e23ebU, 0x00000000U, 0x5d00cc2fU, 0xdcfff0f5U, 0xf83d06f7U, 0x00000000U, 0xeefe13e3U, 0x8d181521U,
+  0xfbdbfc2eU, 0x00000000U, 0x06122513U, 0x448101e6U, 0x2feeeef8U, 0x00000000U, 0xf3530b1aU, 0x3c220a00U,
+  0xfcae000eU, 0x00000000U, 0xe11300a4U, 0x37080016U, 0xee2dd02bU, 0x00000000U, 0xd42ff7feU, 0x1b0821bfU,
+  0x111b0b00U, 0x00000000U, 0x09060800U, 0x0ec5e500U, 0x00e3eac9U, 0x00000000U, 0x00ca03e8U, 0x0011fde4U,
+  0xed01ee21U, 0x00000000U, 0x44d8adeaU, 0xe21207f2U, 0x0f11f314U, 0x00000000U, 0x030ed81bU, 0xb7e24900U,
+  0x12fbee5dU, 0x00000000U, 0x06fc6424U, 0x2b96e1d9U, 0xf8cce9edU, 0x00000000U, 0xf72eed1fU, 0x2a2b3708U,
+  0xf38100efU, 0x00000000U, 0xf91c00cfU, 0x3223000fU, 0xe126e50eU, 0x00000000U, 0xe01305f5U, 0x34de1bfbU,
+  0x1f030400U, 0x00000000U, 0xed15f000U, 0x0ce20400U, 0x00c70a10U, 0x00000000U, 0x00dfeec5U, 0x002607d0U,
+  0x240cd9faU, 0x00000000U, 0x1efc81dcU, 0xd23112ddU, 0xfb03e33cU, 0x00000000U, 0xe4300c13U, 0xe3e221dfU,
+  0x0a2de42fU, 0x00000000U, 0x1ee82e02U, 0x01a2e4f1U, 0xd6af0ad6U, 0x00000000U, 0x0726f72fU, 0x2f18fdefU,
+  0xb71000e1U, 0x00000000U, 0x0e2300f0U, 0xdc2100eaU, 0xf4000d05U, 0x00000000U, 0x2ff317fbU, 0x1702090aU,
+  0xfedbef00U, 0x00000000U, 0x10251a00U, 0x152fff00U, 0x0004d6f4U, 0x00000000U, 0x00fb03ffU, 0x00f9e4daU,
+  0xeb10c4d6U, 0x00000000U, 0x1a15de0dU, 0x47f8e801U, 0x06190006U, 0x00000000U, 0xe2fd47dbU, 0xc50908d6U,
+  0x0ef7e61fU, 0x00000000U, 0x0b41051eU, 0x051be2feU, 0x1204e2f8U, 0x00000000U, 0x1535d81cU, 0x012f061fU,
+  0xe81700ffU, 0x00000000U, 0x111600ebU, 0xe30100dbU, 0x0c18fa13U, 0x00000000U, 0x2bf80e01U, 0x05e10cf8U,
+  0xe71d1500U, 0x00000000U, 0x161a0600U, 0x030ee100U, 0x00f1bcedU, 0x00000000U, 0x00df0703U, 0x0006e7dbU,
+  0x1119dbd7U, 0x00000000U, 0x300dda18U, 0x0be8eeeeU, 0x1a22dc0cU, 0x00000000U, 0xf0e52fd4U, 0xdff918c6U,
+  0xfef7091fU, 0x00000000U, 0x170b0309U, 0x211f0003U, 0x05e6de1eU, 0x00000000U, 0xd43df429U, 0xfb1af523U,
+  0xfef200ffU, 0x00000000U, 0xf60a00baU, 0x00f200f2U, 0x26f3e227U, 0x00000000U, 0x08f60e22U, 0x04cc0d01U,
+  0xeb2c2100U, 0x00000000U, 0x36e6e600U, 0x02fdce00U, 0x00fed7e2U, 0x00000000U, 0x00da0a05U, 0x0012f4deU,
+  0xdd18d3edU, 0x00000000U, 0xff0dda01U, 0xd800f1dcU, 0x1023d504U, 0x00000000U, 0x1ff2fafcU, 0xbfea2fd4U,
+  0xf4f4042cU, 0x00000000U, 0x0c044209U, 0x32f4e80bU, 0x0cf2d413U, 0x00000000U, 0xfd28e948U, 0x1d1401ecU,
+  0x0dd500ddU, 0x00000000U, 0xee0f00b2U, 0x121300f8U, 0xefdae0f3U, 0x00000000U, 0xfbefebfeU, 0x10f510f3U,
+  0x10020c00U, 0x00000000U, 0xf6ddf600U, 0x10f3db00U, 0x00f3f3e6U, 0x00000000U, 0x0009e92dU, 0x00ff0cedU,
+  0xf527e306U, 0x00000000U, 0xe319beb7U, 0xdefc0224U, 0x2e12c327U, 0x00000000U, 0x2810eb05U, 0xcacb2aefU,
+  0x29f2da02U, 0x00000000U, 0x22e2572fU, 0xf9f612f5U, 0xf7e7e7fcU, 0x00000000U, 0x0bd8d547U, 0xfe2a07f2U,
+  0xebbe00c6U, 0x00000000U, 0x041700f2U, 0x211000e5U, 0xc419dfe1U, 0x00000000U, 0x09d712f2U, 0x4eef38ecU,
+  0x0ed53d00U, 0x00000000U, 0x1ae4d800U, 0xfed4e100U, 0x00e00adbU, 0x00000000U, 0x001bf600U, 0x00f714daU,
+  0x2145ddf5U, 0x00000000U, 0xbf37b3d5U, 0xe2fc1f04U, 0x2327cc28U, 0x00000000U, 0x0a07f7f2U, 0xe5c913ddU,
+  0x0944e02dU, 0x00000000U, 0x238c3008U, 0xe8b70cd5U, 0xe3baf4dbU, 0x00000000U, 0x39e0e845U, 0x230720e1U,
+  0xd81300f0U, 0x00000000U, 0x0c2300e5U, 0x110400faU, 0xe5e80b0cU, 0x00000000U, 0x2edb23f1U, 0xf6eb1310U,
+  0x01e7f500U, 0x00000000U, 0x05fa0500U, 0x0bf20500U, 0x00dce1eaU, 0x00000000U, 0x00f10812U, 0x0003ecebU,
+  0xf810b9dbU, 0x00000000U, 0xf915c9f4U, 0x4611f700U, 0xf61011fcU, 0x00000000U, 0xf6f933e3U, 0xdc021500U,
+  0x2701e220U, 0x00000000U, 0x0d5af02eU, 0xff17fb0bU, 0x100be700U, 0x00000000U, 0xf535d525U, 0x1b1f0bf6U,
+  0x071700f9U, 0x00000000U, 0x051600ecU, 0x0612000bU, 0x15ed0f21U, 0x00000000U, 0x21fd1511U, 0xd0fd10efU,
+  0xf6fa0b00U, 0x00000000U, 0x30ea0300U, 0x13e0e600U, 0x00eec90cU, 0x00000000U, 0x00eae41cU, 0x0002070eU,
+  0xe30dd8d9U, 0x00000000U, 0xea03e5d2U, 0x10ff04edU, 0x20240bfaU, 0x00000000U, 0x0cfb16bcU, 0x050215edU,
+  0x02f5f217U, 0x00000000U, 0x0a1d091eU, 0x11290f13U, 0xe8eeed21U, 0x00000000U, 0xdf30e71aU, 0x0a0f06f8U,
+  0x1de200ebU, 0x00000000U, 0xce0500efU, 0x03230008U, 0x2fd8f8faU, 0x00000000U, 0xe8defc0fU, 0xcbfff625U,
+  0xfc0d1900U, 0x00000000U, 0x1fc4f100U, 0x09fff600U, 0x000cdaf1U, 0x00000000U, 0x0006cf2bU, 0x00fb08f0U,
+  0xe811f9e0U, 0x00000000U, 0xb3e3d6e8U, 0xed100f17U, 0x3921c30dU, 0x00000000U, 0x0e08fbdfU, 0x0efa07e4U,
+  0x0ad6fef3U, 0x00000000U, 0x1beb2321U, 0x1620123cU, 0xdddac00dU, 0x00000000U, 0x0cefdefbU, 0xf30911daU,
+  0x23e500ccU, 0x00000000U, 0xf0f300e0U, 0xf9080013U, 0x1ce8e1f7U, 0x00000000U, 0x0df408eaU, 0x0f2210f3U,
+  0x030a0900U, 0x00000000U, 0x1d0fff00U, 0xf5e60500U, 0x00f10fdcU, 0x00000000U, 0x0002df2cU, 0x00df10e5U,
+  0xef20ecd8U, 0x00000000U, 0xb80fe1daU, 0xfb0c040bU, 0x0c29c708U, 0x00000000U, 0x232016f6U, 0xeacc040bU,
+  0x16f301f3U, 0x00000000U, 0x17ea1dfdU, 0x1206fe1bU, 0x11cfd40cU, 0x00000000U, 0x32e5d825U, 0xf7e20be7U,
+  0xfec900bdU, 0x00000000U, 0x29fc0016U, 0x1bfe000dU, 0x1bf5ebe4U, 0x00000000U, 0x51d903dfU, 0x39f321e0U,
+  0x00de3f00U, 0x00000000U, 0x0233fe00U, 0xeee3dd00U, 0x00bf0bb1U, 0x00000000U, 0x00f813efU, 0x00bef2e8U,
+  0x1554d2d1U, 0x00000000U, 0xc725ecf9U, 0xfbe50a00U, 0xea2ad614U, 0x00000000U, 0xfa0e08ebU, 0xd8c0f6fdU,
+  0x01f7f308U, 0x00000000U, 0x109ffaeaU, 0xe60dd5f8U, 0xefa6dedeU, 0x00000000U, 0x72dff3fbU, 0x09f316f5U,
+  0x232500ffU, 0x00000000U, 0xf61000f7U, 0x44f200f1U, 0xfbe8f301U, 0x00000000U, 0xe9fdef03U, 0xdd0f1700U,
+  0xffd00700U, 0x00000000U, 0xfbcff600U, 0x05130400U, 0x00d90ae1U, 0x00000000U, 0x00e01102U, 0x00ffe8efU,
+  0xeffbc6f0U, 0x00000000U, 0xf005e106U, 0x1a1af3f0U, 0xf0240c08U, 0x00000000U, 0x250bff06U, 0xedc713ffU,
+  0x36e5f513U, 0x00000000U, 0x1348f22dU, 0xf520f0fbU, 0x09050310U, 0x00000000U, 0xee1fe919U, 0x15fb00e4U,
+  0x1af900e2U, 0x00000000U, 0xe41a00e5U, 0x30d8001cU, 0x2ce8ed0eU, 0x00000000U, 0xf9f4dafaU, 0xc4fe1a1cU,
+  0xfeeb0700U, 0x00000000U, 0x1801f700U, 0x0d2af900U, 0x00dbddcdU, 0x00000000U, 0x00c7ea24U, 0x00e8fddeU,
+  0xf209e0d9U, 0x00000000U, 0xe2efe7d9U, 0xfcecfb08U, 0x0635f907U, 0x00000000U, 0x2a1d04d9U, 0xe4f829f7U,
+  0x4de2f203U, 0x00000000U, 0x2721fd26U, 0xf920e12aU, 0xdffcd914U, 0x00000000U, 0xe331df23U, 0x28ef19d2U,
+  0x2df200a8U, 0x00000000U, 0xddf400f0U, 0x24d30003U, 0x13daf6f7U, 0x00000000U, 0x06c2bd05U, 0xe80c1112U,
+  0x0c052100U, 0x00000000U, 0x20291900U, 0x0edefe00U, 0x00ccf4c4U, 0x00000000U, 0x00f1e518U, 0x00e327f6U,
+  0xe917eae7U, 0x00000000U, 0xaff4f4e9U, 0xece52231U, 0xfa44da05U, 0x00000000U, 0x25ff12d9U, 0xf10c1e10U,
+  0x29e0fcd8U, 0x00000000U, 0x1aeff0eaU, 0x1e25cd30U, 0xf8eae00aU, 0x00000000U, 0xe822dcf1U, 0x1ef316e3U,
+  0x16c100a0U, 0x00000000U, 0xe0df00fbU, 0x1eef00fdU, 0xfedbe3e3U, 0x00000000U, 0x0fd3d5eeU, 0xf62918fbU,
+  0x05fe2c00U, 0x00000000U, 0x17362600U, 0x0ad82d00U, 0x00c40ebeU, 0x00000000U, 0x00e62811U, 0x00e6efecU,
+  0xf327d9e1U, 0x00000000U, 0xf421f509U, 0xfc080735U, 0xfc24ddf3U, 0x00000000U, 0xfc180ff9U, 0xdaf5051aU,
+  0x12dce8dfU, 0x00000000U, 0xf6d2ededU, 0x0e04dc0cU, 0x1cdcf5ffU, 0x00000000U, 0x0922e8f8U, 0x1bdc18f5U,
+  0x02db00c1U, 0x00000000U, 0x3309001eU, 0x2af3000dU, 0xe5fbedeaU, 0x00000000U, 0x21e7ededU, 0xdb0a05fdU,
+  0xf8004100U, 0x00000000U, 0x0f341200U, 0x07e40700U, 0x00b6f5bfU, 0x00000000U, 0x00e317e7U, 0x00e2c5ddU,
+  0x0703e9d2U, 0x00000000U, 0xebfdfc14U, 0x12e1f53dU, 0xec2ce4eeU, 0x00000000U, 0xee0906f4U, 0xdcee0315U,
+  0x02e3d7eaU, 0x00000000U, 0xf9bad8e8U, 0xed05bce4U, 0xdfc8f1e5U, 0x00000000U, 0x16f2fef7U, 0xe9e60ce8U,
+  0x00000000U, 0x0cff00e5U, 0x080a000fU, 0x13cb002dU, 0x00000000U, 0xf8e705efU, 0xecf40bdbU, 0x191bfe10U,
+  0x00000000U, 0x05fdea00U, 0x12f9ff00U, 0xf918e000U, 0x00000000U, 0x00e7c6eaU, 0x00e4e522U, 0x00d40524U,
+  0x00000000U, 0x08f8deeeU, 0x0aec1d2cU, 0x080e16d9U, 0x00000000U, 0xfc0c16d6U, 0xff202416U, 0x0620faf9U,
+  0x00000000U, 0x01d803c8U, 0x1912d9edU, 0x020b000dU, 0x00000000U, 0x071cfb05U, 0x0b40f9fbU, 0x0bdb16feU,
+  0x00000000U, 0xfc0600e8U, 0x03080047U, 0x09c20050U, 0x00000000U, 0x12cf16f1U, 0xd9ece914U, 0x15f2e02cU,
+  0x00000000U, 0xf91dcd00U, 0x3c130300U, 0xdd142100U, 0x00000000U, 0x0004d7d2U, 0x00b20012U, 0x00fbf944U,
+  0x00000000U, 0x0b04f7faU, 0x24c80e36U, 0xf6f4f226U, 0x00000000U, 0xd4453ed5U, 0x12362104U, 0x1b1d0907U,
+  0x00000000U, 0xe5cf1bceU, 0x2c33e7ceU, 0x141ade1cU, 0x00000000U, 0x3222fc1aU, 0xe84ef002U, 0x06d6eee6U,
+  0x00000000U, 0x0bf800efU, 0xe705001eU, 0xecd80038U, 0x00000000U, 0x21be17ebU, 0xdb02f215U, 0x0902d601U,
+  0x00000000U, 0xda0da900U, 0x383ef800U, 0xfa1a5300U, 0x00000000U, 0x000a00e5U, 0x00810d02U, 0x00200aedU,
+  0x00000000U, 0xdf2ef4f5U, 0x45b1dc24U, 0x09d8fb35U, 0x00000000U, 0xa65d31dfU, 0x04262312U, 0x1d0c2319U,
+  0x00000000U, 0x0dc232daU, 0x171d0bc2U, 0x0523d214U, 0x00000000U, 0x5013ef24U, 0xd557d713U, 0xebd8e9f8U,
+  0x00000000U, 0xe6040003U, 0xf1170004U, 0x03cf00ffU, 0x00000000U, 0x32bf0de2U, 0xc620fa02U, 0x0e39fb12U,
+  0x00000000U, 0xef0ecb00U, 0x0e2bf700U, 0xf2ff4500U, 0x00000000U, 0x001a0e21U, 0x00a5f8e7U, 0x00ed1ac0U,
+  0x00000000U, 0xf546dee3U, 0x4accbf0dU, 0x0fe53114U, 0x00000000U, 0xbd4a19fdU, 0x0931120dU, 0x2200fcfdU,
+  0x00000000U, 0x12bc1cdbU, 0xf91e0cebU, 0xea1bd825U, 0x00000000U, 0x29ee0116U, 0xf04de216U, 0xdfe40ee5U,
+  0x00000000U, 0xdcf40025U, 0x150800e1U, 0x30de00e8U, 0x00000000U, 0x3fcafdebU, 0xd620f3fbU, 0x1a3e07edU,
+  0x00000000U, 0xfffec700U, 0xf5fa1600U, 0xf5091b00U, 0x00000000U, 0x002b051aU, 0x00c901ceU, 0x00d110a0U,
+  0x00000000U, 0xd42ddcd7U, 0x43faa0e0U, 0x29f3fa0bU, 0x00000000U, 0xfb331307U, 0xf728fdffU, 0xecc6f5e7U,
+  0x00000000U, 0xf9c333deU, 0x120e1aeeU, 0xe7faf026U, 0x00000000U, 0x20d4ef14U, 0xee21be2aU, 0x00f91b04U,
+  0x00000000U, 0x020300feU, 0xf0250002U, 0x2ad80034U, 0x00000000U, 0xfffc14d3U, 0x05dbfb07U, 0xec1bd900U,
+  0x00000000U, 0xfb4dda00U, 0x1efffc00U, 0xff06ff00U, 0x00000000U, 0x000bf5d4U, 0x00e2d927U, 0x00141a2aU,
+  0x00000000U, 0x2beee612U, 0x39e8e0faU, 0x0a153003U, 0x00000000U, 0xc5120ce1U, 0xf81633efU, 0x18fcdc05U,
+  0x00000000U, 0xe9e7fcaeU, 0x0a28e107U, 0x0520dd0bU, 0x00000000U, 0xfb15270bU, 0xfe4ecd06U, 0x0fc929ecU,
+  0x00000000U, 0x0c0000faU, 0xd811001cU, 0x1ed6003cU, 0x00000000U, 0x0ccf08efU, 0x13edf525U, 0xf013bd15U,
+  0x00000000U, 0xe62ece00U, 0x1736f900U, 0xe2204800U, 0x00000000U, 0x001802deU, 0x00d723f2U, 0x00086a05U,
+  0x00000000U, 0x15fbf717U, 0x2af1cc35U, 0xf0011e0fU, 0x00000000U, 0xd66a43eaU, 0x0b0f03dfU, 0x0102d80aU,
+  0x00000000U, 0xe9f411bbU, 0x0e300e01U, 0x0a05bb60U, 0x00000000U, 0x18161322U, 0xa21bb2ffU, 0xe79c0bceU,
+  0x00000000U, 0x23fc00ecU, 0xc1e400f2U, 0x06f0001eU, 0x00000000U, 0x04b5eff4U, 0x0a17f51eU, 0x0937c6feU,
+  0x00000000U, 0xd403d800U, 0xfc4fe400U, 0xb7206300U, 0x00000000U, 0x00061f00U, 0x00c12af6U, 0x000138feU,
+  0x00000000U, 0xf6e7e3f5U, 0x31feaf29U, 0x0d192907U, 0x00000000U, 0xc06622edU, 0xfa23dd0bU, 0x0222ca0bU,
+  0x00000000U, 0x14c43abbU, 0xca10480fU, 0x18efe13aU, 0x00000000U, 0x230bfc2fU, 0xde00cd0eU, 0xb9bffdfdU,
+  0x00000000U, 0x110f0009U, 0xd7f600d4U, 0x3006000eU, 0x00000000U, 0xffc80ae7U, 0x044f0204U, 0x0824e9e7U,
+  0x00000000U, 0xfc1b0100U, 0xcd13f900U, 0xc1f62800U, 0x00000000U, 0x0004351fU, 0x00abfc0aU, 0x002312c9U,
+  0x00000000U, 0x02e1c6f2U, 0x3402a7e8U, 0x0438ee08U, 0x00000000U, 0xb74938efU, 0xfb1ecc16U, 0x2101aeeeU,
+  0x00000000U, 0x26e917d6U, 0xfef6522cU, 0x0610d527U, 0x00000000U, 0x0915f50cU, 0x06c9c31cU, 0xcfbf0218U,
+  0x00000000U, 0xd70c0002U, 0x1c0a00f7U, 0x7208002dU, 0x00000000U, 0x50d30ef9U, 0xf915f204U, 0x042d08f6U,
+  0x00000000U, 0xf3170200U, 0xe1f4f500U, 0xdfd3e200U, 0x00000000U, 0x000b0634U, 0x00d2f9d8U, 0x00340096U,
+  0x00000000U, 0xa9e80efeU, 0x1f0d9bbbU, 0x041de646U, 0x00000000U, 0x0c460c00U, 0x0a1dd801U, 0xd6abe1f1U,
+  0x00000000U, 0x17ea1fe1U, 0x03d04814U, 0xfae9db14U, 0x00000000U, 0x26e2ed19U, 0xf4e0d50bU, 0xeded2119U,
+  0x00000000U, 0xfe1c00e9U, 0xbe0d00f8U, 0x3ece000fU, 0x00000000U, 0x1613e4dbU, 0x27e60a04U, 0xd6f9e412U,
+  0x00000000U, 0xf919e000U, 0x200dfb00U, 0x0aa8f500U, 0x00000000U, 0x000530ceU, 0x001bdb06U, 0x00173212U,
+  0x00000000U, 0x32f82d23U, 0x1f03d508U, 0xf12c57dfU, 0x00000000U, 0xa11efecaU, 0xf0f53de2U, 0x25f2f726U,
+  0x00000000U, 0xdaff1fc1U, 0x09451b2eU, 0xdb09de21U, 0x00000000U, 0x06014b1dU, 0xe649ea2bU, 0xe9941bf0U,
+  0x00000000U, 0x121900f2U, 0xc42600dfU, 0xf3f90011U, 0x00000000U, 0x2cd8e6ebU, 0x2ae00515U, 0xe00dd827U,
+  0x00000000U, 0x050af500U, 0x2708f800U, 0xc60c2e00U, 0x00000000U, 0x000c1edaU, 0x000de71cU, 0x000c47f9U,
+  0x00000000U, 0x32000522U, 0xf40fd62cU, 0xcc393eefU, 0x00000000U, 0x8b4919d6U, 0x2dec06daU, 0x1c00cd32U,
+  0x00000000U, 0xf0e22cc0U, 0x1a142b22U, 0x2218ef39U, 0x00000000U, 0xde1d0c2eU, 0xd923cb1aU, 0xe496fdf7U,
+  0x00000000U, 0x1bf9000dU, 0xeacf00eaU, 0xfbfa0010U, 0x00000000U, 0x22dbfe0cU, 0x1ef3e625U, 0xec390205U,
+  0x00000000U, 0xff2af100U, 0x11e40e00U, 0xc2ed2f00U, 0x00000000U, 0x001634ffU, 0x00e4ed11U, 0x0018d8dbU,
+  0x00000000U, 0x17ebf30eU, 0xef13c1e9U, 0xe8580d02U, 0x00000000U, 0x8d141fd9U, 0x36e7dbdeU, 0x2352aa14U,
+  0x00000000U, 0x241a15d2U, 0xfad0512bU, 0xff0a0b2dU, 0x00000000U, 0xe8290416U, 0x31b1bb15U, 0xe2f5f602U,
+  0x00000000U, 0xee1000f8U, 0xf8fb00f9U, 0x0e0100fbU, 0x00000000U, 0xfdfd34e0U, 0xfe10dc04U, 0xfef113efU,
+  0x00000000U, 0x1624e000U, 0x03000200U, 0xe5e4e400U, 0x00000000U, 0x00112823U, 0x00d4ff2bU, 0x003fc3a5U,
+  0x00000000U, 0x1ff3f003U, 0xa32ab3c5U, 0xc0270307U, 0x00000000U, 0xe50c2412U, 0x1609f4fbU, 0xeb0dee17U,
+  0x00000000U, 0x151b220aU, 0x11d8432bU, 0xfdc8fe03U, 0x00000000U, 0xff261a28U, 0x55a9bfedU, 0xe60f472dU,
+  0x00000000U, 0xc8120007U, 0xf9040036U, 0x4f1a002bU, 0x00000000U, 0x4cca08feU, 0xfffb0bf7U, 0x20e60126U,
+  0x00000000U, 0xfc29ee00U, 0x0f01b100U, 0x05e1b000U, 0x00000000U, 0x00110561U, 0x00e7f53bU, 0x003ef9aaU,
+  0x00000000U, 0xc2ec0ed4U, 0xc814ec19U, 0xe808ed40U, 0x00000000U, 0x3b34f338U, 0x2909dcefU, 0xdab805e2U,
+  0x00000000U, 0x300b271aU, 0x04da1602U, 0xde94d5faU, 0x00000000U, 0x34d9fd24U, 0x2ec1e2fdU, 0x100a553cU,
+  0x00000000U, 0x130300d4U, 0xc61800feU, 0x0fd40004U, 0x00000000U, 0x131ee7e7U, 0x26cc13f1U, 0x02f41424U,
+  0x00000000U, 0x02f2f800U, 0x061bfa00U, 0xfadfe100U, 0x00000000U, 0x000642f6U, 0x000cda14U, 0x001e16f9U,
+  0x00000000U, 0x23142201U, 0x0afceef9U, 0xb2093ad0U, 0x00000000U, 0xd8f4f20fU, 0x10ef17ebU, 0x04dc19fcU,
+  0x00000000U, 0xe33ee8e9U, 0x1749292fU, 0x0fdbcffdU, 0x00000000U, 0xe6093a23U, 0xd119ec31U, 0x04ccf0f1U,
+  0x00000000U, 0x11030004U, 0xe0f800daU, 0xdcfb000bU, 0x00000000U, 0x2e0513e9U, 0x1eec0122U, 0xe5ec0436U,
+  0x00000000U, 0x03d0f900U, 0x3c0b0c00U, 0xd1050100U, 0x00000000U, 0x00293fdaU, 0x0020e312U, 0x003ef101U,
+  0x00000000U, 0x1d281721U, 0x1cf2ddfbU, 0xa42408e0U, 0x00000000U, 0xb00d1f1cU, 0x260000d5U, 0x2b0bd7f2U,
+  0x00000000U, 0x01f60700U, 0x28df1eeeU, 0x0ae2e707U, 0x00000000U, 0xd2283b5aU, 0xe534f026U, 0x0dc6e4f6U,
+  0x00000000U, 0xf4120006U, 0x0ae600f4U, 0xda130028U, 0x00000000U, 0x22250bfeU, 0x04fbf20aU, 0x19021e53U,
+  0x00000000U, 0x20c2e400U, 0x40e73100U, 0xcbe30a00U, 0x00000000U, 0x00161503U, 0x0000f200U, 0x000fd3dfU,
+  0x00000000U, 0x3c240116U, 0x21edcf07U, 0x90091dedU, 0x00000000U, 0xf1e1f013U, 0x1c12fbebU, 0x1549c6eeU,
+  0x00000000U, 0xf8211f30U, 0x04bce2feU, 0x03d6f10bU, 0x00000000U, 0xba032e2eU, 0x2717e420U, 0x2aeaf023U,
+  0x00000000U, 0xbe2200f4U, 0xd413000fU, 0xf609001dU, 0x00000000U, 0x0350ded4U, 0xf5ffd3d7U, 0x2ee42943U,
+  0x00000000U, 0x06c5f700U, 0x23061500U, 0x22e6e200U, 0x00000000U, 0x00ffdc35U, 0x00ec000aU, 0x000902efU,
+  0x00000000U, 0x1e1c0909U, 0xd419e105U, 0x89f4381aU, 0x00000000U, 0x0316f3f8U, 0x0f07d8fbU, 0xfe1229eeU,
+  0x00000000U, 0x212c3132U, 0x0ecfd417U, 0x01a0e1efU, 0x00000000U, 0xe5d5201fU, 0x16f2d926U, 0x1eff152bU,
+  0x00000000U, 0xbe080025U, 0xe3ff003dU, 0x1d220044U, 0x00000000U, 0x2902d31aU, 0x0de4eec8U, 0x33cc092dU,
+  0x00000000U, 0xeb340a00U, 0xfe2ddf00U, 0x3ef3e400U, 0x00000000U, 0x00eddf69U, 0x00fe0246U, 0x002209bcU,
+  0x00000000U, 0xc8e916cbU, 0xe118e716U, 0xc2f33451U, 0x00000000U, 0x253ad429U, 0x16fde2f9U, 0x0edf0909U,
+  0x00000000U, 0x33162444U, 0xfbe6f3faU, 0xdc81afdfU, 0x00000000U, 0x03a82211U, 0x2acae5f2U, 0x250421fbU,
+  0x00000000U, 0x1dfc0092U, 0xe50a0003U, 0x29f40002U, 0x00000000U, 0xecf1d7feU, 0xfaf6fd00U, 0xe5eb2e25U,
+  0x00000000U, 0x15effa00U, 0x07e8f400U, 0xfe09f000U, 0x00000000U, 0x001f44fbU, 0x00f1f215U, 0x00160006U,
+  0x00000000U, 0xfd28e2f8U, 0xf6eef7ffU, 0xcbd9e5e5U, 0x00000000U, 0x04e2eb21U, 0x29040ff6U, 0xf7162af7U,
+  0x00000000U, 0xf04dcb06U, 0x1b1d030dU, 0x2fd4d510U, 0x00000000U, 0xb5f7e8fbU, 0xfd12f812U, 0x1d00eee2U,
+  0x00000000U, 0x27f500e0U, 0xea0c00f5U, 0xfa110001U, 0x00000000U, 0xfa0bcf07U, 0x13c9f209U, 0xfccb1b24U,
+  0x00000000U, 0x150de700U, 0x22210100U, 0xf8090600U, 0x00000000U, 0x000025ffU, 0x00e4091cU, 0x000af4deU,
+  0x00000000U, 0x183bf306U, 0xf1dbfbf1U, 0x8fe8e8f2U, 0x00000000U, 0x0dce0a19U, 0x1df20af7U, 0x124c3ecdU,
+  0x00000000U, 0xf33bf523U, 0x09eaf5ddU, 0x25b4c608U, 0x00000000U, 0xcaf6f40fU, 0xee36e515U, 0x1bf3f7dfU,
+  0x00000000U, 0x0ed500ebU, 0xe0ff00faU, 0x2d35002eU, 0x00000000U, 0xbd33ff1eU, 0x0de8e0fbU, 0x09cbff17U,
+  0x00000000U, 0xfaddca00U, 0x201e2700U, 0x03101800U, 0x00000000U, 0x00d5ff36U, 0x00081f0cU, 0x00f608e7U,
+  0x00000000U, 0x151afc09U, 0xf704eb07U, 0x9fe8e9fbU, 0x00000000U, 0x5eccf9feU, 0x0fe4f8edU, 0xea4a1ceaU,
+  0x00000000U, 0x0c3a2d1fU, 0xe3b3dad5U, 0x3a91d8d3U, 0x00000000U, 0xabc8e60fU, 0x2029f3f9U, 0x171cfa20U,
+  0x00000000U, 0xc0dd00d4U, 0xd6f9001eU, 0x41370036U, 0x00000000U, 0xb14bf010U, 0x04f1c7ecU, 0x28cae81bU,
+  0x00000000U, 0xf1dd2700U, 0xe222f600U, 0x23f4fc00U, 0x00000000U, 0x00efcd72U, 0x00e83b15U, 0x000234baU,
+  0x00000000U, 0xf2e906f5U, 0xeb3ceed8U, 0xd706141aU, 0x00000000U, 0x46140df3U, 0xefeef2fdU, 0xf01bfafeU,
+  0x00000000U, 0x160f1427U, 0xf0b5dbecU, 0x0a98e4f2U, 0x00000000U, 0xf4ca12faU, 0x39fbfe39U, 0x1226151fU,
+  0x00000000U, 0xd6110011U, 0x070f0022U, 0x2c230037U, 0x00000000U, 0xd7ed0623U, 0x27e4e0e1U, 0x23eaf3faU,
+  0x00000000U, 0x09411700U, 0xec33c100U, 0x16ffd400U, 0x00000000U, 0x00d6fe7fU, 0x00f5131cU, 0x0007ebc6U,
+  0x00000000U, 0xc9c7f9f7U, 0xb81004e1U, 0xf8ea1107U, 0x00000000U, 0x5e00eef7U, 0xf6f3f405U, 0xcfe6f609U,
+  0x00000000U, 0xfeef172cU, 0xe7dae6e5U, 0xf3a4f4e8U, 0x00000000U, 0x00e8faecU, 0x1bea0e29U, 0xf5f90e0aU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x191c00f8U, 0x00000000U, 0x00000000U, 0x00000000U, 0x0af110dfU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x101a0700U, 0x00000000U, 0x00000000U, 0x00000000U, 0x000bfeffU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x13eafe1dU, 0x00000000U, 0x00000000U, 0x00000000U, 0x051842fcU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1c0cd8ceU, 0x00000000U, 0x00000000U, 0x00000000U, 0x19400ffbU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1317000aU, 0x00000000U, 0x00000000U, 0x00000000U, 0x22cf10d1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x30110900U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00272626U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x47ef242cU, 0x00000000U, 0x00000000U, 0x00000000U, 0xf9232ad4U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0a0801dbU, 0x00000000U, 0x00000000U, 0x00000000U, 0x44370313U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x05210005U, 0x00000000U, 0x00000000U, 0x00000000U, 0x0adfffd6U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x12291500U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00102a0aU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x5dbd2409U, 0x00000000U, 0x00000000U, 0x00000000U, 0x0ff14fe1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x222d1bcdU, 0x00000000U, 0x00000000U, 0x00000000U, 0x1228e7fdU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x08ff00f9U, 0x00000000U, 0x00000000U, 0x00000000U, 0xe8f4eecdU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x17281a00U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00de190dU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x46d63116U, 0x00000000U, 0x00000000U, 0x00000000U, 0x16194901U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf92506e2U, 0x00000000U, 0x00000000U, 0x00000000U, 0xfa6ee71aU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf2e600faU, 0x00000000U, 0x00000000U, 0x00000000U, 0xfa2cecddU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf41b0000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00d60220U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x34e008caU, 0x00000000U, 0x00000000U, 0x00000000U, 0x25152117U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x042f10f3U, 0x00000000U, 0x00000000U, 0x00000000U, 0x0232e207U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf83900eaU, 0x00000000U, 0x00000000U, 0x00000000U, 0x1eeeffe9U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xfb460700U, 0x00000000U, 0x00000000U, 0x00000000U, 0x000301fbU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x2a0d10dfU, 0x00000000U, 0x00000000U, 0x00000000U, 0xde2733d4U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0a0ded02U, 0x00000000U, 0x00000000U, 0x00000000U, 0x1444f111U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1d4800edU, 0x00000000U, 0x00000000U, 0x00000000U, 0x24e517fdU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x3f4c0000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00e32dffU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x7112cafcU, 0x00000000U, 0x00000000U, 0x00000000U, 0xa70354d0U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x13174a02U, 0x00000000U, 0x00000000U, 0x00000000U, 0xeb4fd51bU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x2d3300d2U, 0x00000000U, 0x00000000U, 0x00000000U, 0xf70e1c08U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0a4cfc00U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00e93a0aU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x7ff0b6feU, 0x00000000U, 0x00000000U, 0x00000000U, 0xc7e856daU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf7155011U, 0x00000000U, 0x00000000U, 0x00000000U, 0xe365e90cU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x45df00b2U, 0x00000000U, 0x00000000U, 0x00000000U, 0xe23e0b18U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0530ed00U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00d42affU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x49dbe2eaU, 0x00000000U, 0x00000000U, 0x00000000U, 0xe8024709U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xece746f4U, 0x00000000U, 0x00000000U, 0x00000000U, 0x0a65e636U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1f0700dcU, 0x00000000U, 0x00000000U, 0x00000000U, 0xe95de915U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xe119d100U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00c3ffc1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x24ec98e5U, 0x00000000U, 0x00000000U, 0x00000000U, 0xd622ff26U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x03e345e1U, 0x00000000U, 0x00000000U, 0x00000000U, 0x0941f541U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1bf900c6U, 0x00000000U, 0x00000000U, 0x00000000U, 0x16fd240fU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0b23f700U, 0x00000000U, 0x00000000U, 0x00000000U, 0x001429fbU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x241cfcd3U, 0x00000000U, 0x00000000U, 0x00000000U, 0xe9e741e1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xee6dd024U, 0x00000000U, 0x00000000U, 0x00000000U, 0xee0dd10aU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf21800c4U, 0x00000000U, 0x00000000U, 0x00000000U, 0x1e0827f3U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x15e7d100U, 0x00000000U, 0x00000000U, 0x00000000U, 0x0005f51eU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x37f8f4ccU, 0x00000000U, 0x00000000U, 0x00000000U, 0xfac330adU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0a290438U, 0x00000000U, 0x00000000U, 0x00000000U, 0x1024d223U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xd51b00bfU, 0x00000000U, 0x00000000U, 0x00000000U, 0x1707fa11U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xc6d5c400U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00effc2fU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xd5f9f4c6U, 0x00000000U, 0x00000000U, 0x00000000U, 0x2ecc03d3U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0823252cU, 0x00000000U, 0x00000000U, 0x00000000U, 0x1a11f245U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xd3f100aeU, 0x00000000U, 0x00000000U, 0x00000000U, 0xf84ade51U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xe6bbba00U, 0x00000000U, 0x00000000U, 0x00000000U, 0x0022d92eU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0d0a0b85U, 0x00000000U, 0x00000000U, 0x00000000U, 0x20fff4f2U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf0205046U, 0x00000000U, 0x00000000U, 0x00000000U, 0x30b1043cU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xed1a00bbU, 0x00000000U, 0x00000000U, 0x00000000U, 0x05021c53U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1ee99200U, 0x00000000U, 0x00000000U, 0x00000000U, 0x001e0925U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xdf23cfbaU, 0x00000000U, 0x00000000U, 0x00000000U, 0x200801e9U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf7842620U, 0x00000000U, 0x00000000U, 0x00000000U, 0x35c8f93dU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1ccf00e6U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00c847f7U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x08e6db00U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00121021U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xd81bc8e0U, 0x00000000U, 0x00000000U, 0x00000000U, 0x14d534d5U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x02709c2fU, 0x00000000U, 0x00000000U, 0x00000000U, 0xf821e8faU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x03b80019U, 0x00000000U, 0x00000000U, 0x00000000U, 0xfff82f0dU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1eccdc00U, 0x00000000U, 0x00000000U, 0x00000000U, 0x0016ca46U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xc60ec1caU, 0x00000000U, 0x00000000U, 0x00000000U, 0x24e115b2U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x3f309e36U, 0x00000000U, 0x00000000U, 0x00000000U, 0xdc14dcfbU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xb6ec003bU, 0x00000000U, 0x00000000U, 0x00000000U, 0xddfedb20U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1cc91400U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00ffbb55U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xa2e9d3edU, 0x00000000U, 0x00000000U, 0x00000000U, 0x3b0241d2U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x25079d43U, 0x00000000U, 0x00000000U, 0x00000000U, 0x13e5d3f1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xd0f9001aU, 0x00000000U, 0x00000000U, 0x00000000U, 0x1b12e605U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x29f30d00U, 0x00000000U, 0x00000000U, 0x00000000U, 0x000ed151U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xaad9e8e8U, 0x00000000U, 0x00000000U, 0x00000000U, 0x560c5225U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x03fcfa27U, 0x00000000U, 0x00000000U, 0x00000000U, 0x3502dce5U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xeffc002bU, 0x00000000U, 0x00000000U, 0x00000000U, 0x66c207ffU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1824cc00U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00030224U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xb1ee02d4U, 0x00000000U, 0x00000000U, 0x00000000U, 0x59eb2cf5U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf699e402U, 0x00000000U, 0x00000000U, 0x00000000U, 0x77d1f0e9U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x06d6000eU, 0x00000000U, 0x00000000U, 0x00000000U, 0xe0cefaf9U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xfee5d500U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00f2f7e6U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf7e8eaf9U, 0x00000000U, 0x00000000U, 0x00000000U, 0xfdff10ebU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x28f9c4f6U, 0x00000000U, 0x00000000U, 0x00000000U, 0xf4fb09fbU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x1ae000fcU, 0x00000000U, 0x00000000U, 0x00000000U, 0x3b9cbef9U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x3037f100U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00c80ef1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xbdf7ecfdU, 0x00000000U, 0x00000000U, 0x00000000U, 0xf31849d1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x55d2c1ecU, 0x00000000U, 0x00000000U, 0x00000000U, 0xf119d6fcU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x25ce0011U, 0x00000000U, 0x00000000U, 0x00000000U, 0x32a1ad11U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x27333300U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00ea1018U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xaa080906U, 0x00000000U, 0x00000000U, 0x00000000U, 0xe23030d4U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x35a1ceeaU, 0x00000000U, 0x00000000U, 0x00000000U, 0xdf32ce0aU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0abc0013U, 0x00000000U, 0x00000000U, 0x00000000U, 0x29d5e8ffU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x192d4000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00db231fU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xb810f310U, 0x00000000U, 0x00000000U, 0x00000000U, 0x1b3413faU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x10b7c6e9U, 0x00000000U, 0x00000000U, 0x00000000U, 0x2026e30eU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x41fd0022U, 0x00000000U, 0x00000000U, 0x00000000U, 0x1bd4f3ebU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0336ee00U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00df1f03U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xc0e1f813U, 0x00000000U, 0x00000000U, 0x00000000U, 0x05f21001U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x03a8d6ddU, 0x00000000U, 0x00000000U, 0x00000000U, 0x32e1f8fbU,
+  0x040900fdU, 0xf3f70011U, 0xf72000f3U, 0x00000000U, 0x09f8fff0U, 0xfdf1faf1U, 0xf70101f6U, 0x00000000U,
+  0xff0ce300U, 0x03fa2700U, 0x02ece200U, 0x00000000U, 0x00412a23U, 0x00021307U, 0x00f6fc06U, 0x00000000U,
+  0x040538f6U, 0xef08db23U, 0x01ff0602U, 0x00000000U, 0xfccf0f21U, 0xfc21f30aU, 0xf4eb0a01U, 0x00000000U,
+  0x0b2de207U, 0x2601fd0cU, 0x1011f3efU, 0x00000000U, 0xfde90e01U, 0x0e01eefeU, 0xed2e0e09U, 0x00000000U,
+  0xffe40033U, 0x06f80002U, 0xf3060002U, 0x00000000U, 0xfeffe00eU, 0xfd0406d8U, 0x08071518U, 0x00000000U,
+  0x08f9e800U, 0x06f52c00U, 0x1705e100U, 0x00000000U, 0x000b1e55U, 0x00091f24U, 0x00e127d6U, 0x00000000U,
+  0x21ee272eU, 0xd00ae3d9U, 0x2de7f514U, 0x00000000U, 0x24f30a12U, 0x140ee70cU, 0xfaef1b03U, 0x00000000U,
+  0x0d49ddf3U, 0x38f7d60aU, 0x2015e0e3U, 0x00000000U, 0xe4da38fbU, 0x0606f4f8U, 0xcb51e212U, 0x00000000U,
+  0xf9e3002dU, 0x0e2700efU, 0x1c06000fU, 0x00000000U, 0xe30ec309U, 0xe72106fcU, 0xec051534U, 0x00000000U,
+  0x14052a00U, 0xefe31500U, 0x1e0dd800U, 0x00000000U, 0x00bc193bU, 0x000f1d37U, 0x00cf0ecaU, 0x00000000U,
+  0x48b9fd34U, 0xeb132aaeU, 0x44ea1d1bU, 0x00000000U, 0x4be70a05U, 0x37eefe17U, 0x05021d11U, 0x00000000U,
+  0xf467dcf4U, 0x2a07f501U, 0x0623cac1U, 0x00000000U, 0xc902fcffU, 0x02240207U, 0xcf35e2f3U, 0x00000000U,
+  0xfdfe00f6U, 0x313a00ebU, 0x0e1a00f9U, 0x00000000U, 0xb74de0faU, 0xe4e9111cU, 0x15192243U, 0x00000000U,
+  0x0d2e4800U, 0xe706db00U, 0x3344ee00U, 0x00000000U, 0x009e06f7U, 0x00f12a27U, 0x00da2ebcU, 0x00000000U,
+  0x36bbce0dU, 0xd32d1de2U, 0x3f0a11f1U, 0x00000000U, 0x3a13e516U, 0x13ee3014U, 0xe30c1519U, 0x00000000U,
+  0xd55edcfdU, 0x1920ff17U, 0xf00ad3c9U, 0x00000000U, 0xa411e416U, 0xfb140ae6U, 0xfa27f0f8U, 0x00000000U,
+  0xee0500c7U, 0x541000ffU, 0xfcec00e5U, 0x00000000U, 0xae3eef05U, 0x0501170bU, 0x1e291727U, 0x00000000U,
+  0xf50c3c00U, 0xfd040800U, 0x1414d600U, 0x00000000U, 0x00c106daU, 0x001a0634U, 0x00e609d0U, 0x00000000U,
+  0x41cbb6ffU, 0xf42e3dfeU, 0x4d23fcd5U, 0x00000000U, 0x1c12f014U, 0xfffc0c1cU, 0xe8031f07U, 0x00000000U,
+  0x0b68060fU, 0xe650bb15U, 0x0dedded6U, 0x00000000U, 0xd826d805U, 0x030718e6U, 0x123afe11U, 0x00000000U,
+  0x15000005U, 0x07040003U, 0xf20e00e4U, 0x00000000U, 0xfdf2e4ddU, 0xfcbc0cf0U, 0x21ec00e0U, 0x00000000U,
+  0x0a02ee00U, 0x05c83700U, 0x193bd000U, 0x00000000U, 0x00200932U, 0x00e8ebfdU, 0x00f41c04U, 0x00000000U,
+  0x1d151d04U, 0xc40db418U, 0x28fcd13bU, 0x00000000U, 0x09c22721U, 0xfe3405f4U, 0xedcb01f8U, 0x00000000U,
+  0x2d29e019U, 0x16d0e01eU, 0xed2004c4U, 0x00000000U, 0x10d80ef5U, 0x10f5fc09U, 0xca4bf41bU, 0x00000000U,
+  0x0f140002U, 0x070f00f8U, 0xd4f900d1U, 0x00000000U, 0x0511f0fbU, 0xfeb711f5U, 0x05041d0fU, 0x00000000U,
+  0x0d270600U, 0x13e51c00U, 0x0a40d700U, 0x00000000U, 0x00e30731U, 0x00cf06f6U, 0x00e513beU, 0x00000000U,
+  0x4c03fe37U, 0x8916affaU, 0x30ebb522U, 0x00000000U, 0x2ef51609U, 0x142207fdU, 0xfae32ee4U, 0x00000000U,
+  0x1a3c020aU, 0x0a8ddc1bU, 0xfb4ef8dbU, 0x00000000U, 0xf4eef0dfU, 0x0f1b0211U, 0xc424ca24U, 0x00000000U,
+  0xe30d00f3U, 0x000b00f9U, 0xee1800d2U, 0x00000000U, 0xf026ea0dU, 0x0804fc0dU, 0xdd131328U, 0x00000000U,
+  0xeb24ff00U, 0x35ec1100U, 0xfe2fea00U, 0x00000000U, 0x00cc01f5U, 0x00e32914U, 0x00c633d4U, 0x00000000U,
+  0x4befdd23U, 0xdc0719f6U, 0x1de9e03bU, 0x00000000U, 0x3cf6131aU, 0x370c2212U, 0x14f11a00U, 0x00000000U,
+  0xef2118fcU, 0x09f0ede5U, 0xde2fecd5U, 0x00000000U, 0xc31bebedU, 0xdf371e13U, 0xeb1fcde6U, 0x00000000U,
+  0xc5d500e6U, 0x04f90020U, 0x0b0700e9U, 0x00000000U, 0xd1682202U, 0xe3f7170fU, 0xf33c1d24U, 0x00000000U,
+  0xe3151400U, 0x3bd30300U, 0xe0461000U, 0x00000000U, 0x00b2f7d9U, 0x000c2f22U, 0x00d248eeU, 0x00000000U,
+  0x57e8e00cU, 0xe5151848U, 0xfce7e508U, 0x00000000U, 0x162de22eU, 0x17f32f27U, 0x03fc160dU, 0x00000000U,
+  0xd323171cU, 0xf72e03e6U, 0xd619dbe6U, 0x00000000U, 0xc041d900U, 0xd91b1fefU, 0x0a11fae8U, 0x00000000U,
+  0xfbdb00ebU, 0xf5d500ffU, 0x0e0200c9U, 0x00000000U, 0xa82704f2U, 0xfe1c1b40U, 0x29300b1bU, 0x00000000U,
+  0xd6ed1500U, 0x19043300U, 0x0e241400U, 0x00000000U, 0x00aee4afU, 0x00f92a01U, 0x00e318e8U, 0x00000000U,
+  0x4eff8102U, 0xef07462eU, 0x29071d09U, 0x00000000U, 0xf411d615U, 0xe4dd5525U, 0xfded12f4U, 0x00000000U,
+  0x12080815U, 0xdc29bdeeU, 0xfc00eee6U, 0x00000000U, 0xc409d51bU, 0x091a3edeU, 0x170517efU, 0x00000000U,
+  0x102100f0U, 0x17260011U, 0xedfa00f7U, 0x00000000U, 0x11fe19daU, 0xf7c5fa0cU, 0x30fb25bcU, 0x00000000U,
+  0x01241100U, 0x1ff82400U, 0x053cd500U, 0x00000000U, 0x0011f711U, 0x00bbebdfU, 0x00004000U, 0x00000000U,
+  0x370def08U, 0xbe0bc12eU, 0x0104ed48U, 0x00000000U, 0xf3ce2bf7U, 0xfd30e808U, 0xdfbaf30cU, 0x00000000U,
+  0x1f4d030bU, 0x269c14f1U, 0xc53e25caU, 0x00000000U, 0x1a1ed7fdU, 0xed250004U, 0xa735393dU, 0x00000000U,
+  0xf32f00daU, 0x1d1400d8U, 0xcf2700d5U, 0x00000000U, 0x0e2ae61bU, 0x20dfe90aU, 0xfbf910f4U, 0x00000000U,
+  0x0c581100U, 0x1e2eff00U, 0xf162e300U, 0x00000000U, 0x00e81016U, 0x00c2df97U, 0x00e324f1U, 0x00000000U,
+  0x43f6d70cU, 0xc704ce2dU, 0x0d05bf39U, 0x00000000U, 0x35cfe8fcU, 0xee222327U, 0xd5ebebfcU, 0x00000000U,
+  0x0d380513U, 0x11812cb7U, 0xf95303e5U, 0x00000000U, 0xcd02fc1cU, 0xbe33221dU, 0xb5380b19U, 0x00000000U,
+  0xcff000d1U, 0x000300e5U, 0x06e500e0U, 0x00000000U, 0x04030504U, 0x271db6e6U, 0xea0a05e7U, 0x00000000U,
+  0x1c420600U, 0x4a480500U, 0xdd3ffc00U, 0x00000000U, 0x00e134e8U, 0x00e31ea2U, 0x00d517e8U, 0x00000000U,
+  0x290dd504U, 0xf9042721U, 0xe4f9be24U, 0x00000000U, 0x3402e304U, 0xff2a403cU, 0xfd0dff09U, 0x00000000U,
+  0xd9fe2c13U, 0xe9d823adU, 0xf60409e9U, 0x00000000U, 0xfc12ce2cU, 0xd2094ccaU, 0xdc3acedfU, 0x00000000U,
+  0xdff500d7U, 0xf4db0020U, 0x0bf600efU, 0x00000000U, 0xff04f905U, 0xfb02e01fU, 0xf4fefd06U, 0x00000000U,
+  0xedfd1900U, 0x1f450900U, 0xef110900U, 0x00000000U, 0x00d30411U, 0x00f940faU, 0x00da240fU, 0x00000000U,
+  0x0b24b1c4U, 0xfae64134U, 0xeee1db00U, 0x00000000U, 0x0939eb0bU, 0x29f828f4U, 0x0f0ffd05U, 0x00000000U,
+  0x0d00431cU, 0xda20f5dfU, 0x1314e80eU, 0x00000000U, 0x35c0a80fU, 0xd50b49cdU, 0x17dee8dbU, 0x00000000U,
+  0x13110001U, 0x13a90024U, 0xd82400ddU, 0x00000000U, 0xb0ed1ce6U, 0xe51f044eU, 0x34e304f5U, 0x00000000U,
+  0xdfcdfa00U, 0x0a2d5400U, 0xf3f40200U, 0x00000000U, 0x00d6f309U, 0x00f225eaU, 0x00f11655U, 0x00000000U,
+  0xdb33a6e6U, 0x2bee2efdU, 0xebe51a11U, 0x00000000U, 0x063ef3f5U, 0xf2df4515U, 0x10fa0518U, 0x00000000U,
+  0xf8f60d0dU, 0xddfcb1f6U, 0xfef8dee3U, 0x00000000U, 0x39f3aa20U, 0xe1305ad0U, 0x37dfe2b9U, 0x00000000U,
+  0x062400f1U, 0x08fb000eU, 0x10fc00f5U, 0x00000000U, 0x270421e8U, 0xfe01e2faU, 0x6709edaeU, 0x00000000U,
+  0xeff71a00U, 0x041b2000U, 0xd727e900U, 0x00000000U, 0x0030fae6U, 0x00d1ebffU, 0x00075afbU, 0x00000000U,
+  0x260707ffU, 0xd0f5d21fU, 0xef141430U, 0x00000000U, 0xffe9fed9U, 0xe12fb007U, 0x06adcd2fU, 0x00000000U,
+  0x08530f24U, 0xfac21cdeU, 0xdf2d05e9U, 0x00000000U, 0xf7f3f007U, 0xeb06020fU, 0xab0f5040U, 0x00000000U,
+  0xca1000dbU, 0x0bfc00b9U, 0xe11800d8U, 0x00000000U, 0xf419ea00U, 0xe50ff8e1U, 0x441102d2U, 0x00000000U,
+  0x23031900U, 0x342c1400U, 0xcd0aeb00U, 0x00000000U, 0x00100f20U, 0x00f8e2c3U, 0x00033109U, 0x00000000U,
+  0x0c03eef1U, 0xf7e3c93aU, 0x1d10d934U, 0x00000000U, 0x1fdbfce4U, 0xc7fdaf1fU, 0x02d9dc45U, 0x00000000U,
+  0xf32f2e10U, 0xcf922bfaU, 0xf53afff2U, 0x00000000U, 0x0405fa01U, 0xc3ec0200U, 0xb11b5235U, 0x00000000U,
+  0xe0e000e2U, 0xf41400d5U, 0xfa0c0002U, 0x00000000U, 0xf20603f2U, 0x07f514c7U, 0x290509ceU, 0x00000000U,
+  0x2f070400U, 0x0b4c1200U, 0xf5120b00U, 0x00000000U, 0x00fdfa06U, 0x00ed29c1U, 0x000c120dU, 0x00000000U,
+  0x33fedbeeU, 0x0ae6fa5cU, 0x10f8d11fU, 0x00000000U, 0x110bedf7U, 0x0dfbeaecU, 0xfef9fd2eU, 0x00000000U,
+  0xf1031d13U, 0xc2f40914U, 0x0b151409U, 0x00000000U, 0x35f9e405U, 0xd7fc08eaU, 0xb4f82328U, 0x00000000U,
+  0x010100e9U, 0x25d300f3U, 0xf1fa000eU, 0x00000000U, 0x180804f7U, 0x2b0810faU, 0xf400ffe9U, 0x00000000U,
+  0x02ff0e00U, 0xea59f800U, 0xfefe1c00U, 0x00000000U, 0x00d7f9f3U, 0x00ca56d3U, 0x00fb1700U, 0x00000000U,
+  0x1225c8e3U, 0x1211180dU, 0x21ef0e19U, 0x00000000U, 0x0a15e124U, 0x0c2003d7U, 0xf11de913U, 0x00000000U,
+  0xf4020806U, 0xe6d902e3U, 0x121af413U, 0x00000000U, 0x48e9d10eU, 0xc1f70cfdU, 0xfe0c04ffU, 0x00000000U,
+  0x0021001cU, 0x3bb400e7U, 0xa7100016U, 0x00000000U, 0xf4fe03d8U, 0x032df517U, 0x1cfbeb09U, 0x00000000U,
+  0xedf81700U, 0xff291700U, 0xf6181a00U, 0x00000000U, 0x00ebe20dU, 0x00f726d5U, 0x00fe0157U, 0x00000000U,
+  0xf621d110U, 0x441c17dbU, 0xfbe02232U, 0x00000000U, 0xfa12e8f6U, 0xeb170b0dU, 0x0d04fb28U, 0x00000000U,
+  0xf81105fdU, 0xe2dbca01U, 0x0931f2e1U, 0x00000000U, 0x4103db0fU, 0xc8fb03c4U, 0x15f004dfU, 0x00000000U,
+  0x090d0002U, 0xea13002aU, 0x00e900e7U, 0x00000000U, 0xfa06f90cU, 0x20e0ddceU, 0x2209c6d0U, 0x00000000U,
+  0xf7c90000U, 0xf4601e00U, 0xf226f800U, 0x00000000U, 0x000e10feU, 0x0004ec0aU, 0x003836ecU, 0x00000000U,
+  0xfe06090eU, 0xe804fa15U, 0xe7f22b1cU, 0x00000000U, 0x02fd0c05U, 0xe319bbfdU, 0x19d5da51U, 0x00000000U,
+  0x0e48fd1bU, 0xe4f32e01U, 0xcd21eef5U, 0x00000000U, 0xf9f0fa1aU, 0xfbcdf609U, 0xd5d23b02U, 0x00000000U,
+  0xe91500f3U, 0xebe2001cU, 0x10ff00f5U, 0x00000000U, 0xdde8fa08U, 0x26060cb9U, 0x1603c3ceU, 0x00000000U,
+  0x0de9fd00U, 0x09241200U, 0xf21af500U, 0x00000000U, 0x0010f832U, 0x001a0aebU, 0x00465bf1U, 0x00000000U,
+  0x06ff0114U, 0x4641ea1dU, 0x23101619U, 0x00000000U, 0x2718f01dU, 0xe9f6a409U, 0x24d1f07fU, 0x00000000U,
+  0x05451a34U, 0xe6e23a07U, 0xeb2de303U, 0x00000000U, 0xf7f1e933U, 0x00dd21fdU, 0xda08620cU, 0x00000000U,
+  0xe1e100ecU, 0x09d5000cU, 0x16f8002eU, 0x00000000U, 0xecec020cU, 0x2b31189eU, 0x0e15ecd6U, 0x00000000U,
+  0x02f22700U, 0xe612ec00U, 0xff040300U, 0x00000000U, 0x000ddb0eU, 0x00fafcd9U, 0x002e3402U, 0x00000000U,
+  0x0402dfefU, 0x3f32e60dU, 0x4326223cU, 0x00000000U, 0x10fdeef8U, 0x2e0da7f7U, 0x0abfca66U, 0x00000000U,
+  0xf7ff150cU, 0x022222f8U, 0x20261614U, 0x00000000U, 0x2700f804U, 0x08b83102U, 0xb5182f19U, 0x00000000U,
+  0xfcef00fdU, 0x4bbf00deU, 0xe8e30029U, 0x00000000U, 0xfff3d6f3U, 0x222814c1U, 0xe539fff8U, 0x00000000U,
+  0x011f1a00U, 0xcddbe600U, 0xe4f93100U, 0x00000000U, 0x00f5f401U, 0x00edd4cdU, 0x002d2100U, 0x00000000U,
+  0x0f29dae6U, 0x2920ffedU, 0x392d1036U, 0x00000000U, 0x030c01f0U, 0xeb3fd2feU, 0xfaedd72fU, 0x00000000U,
+  0xe4f1dcffU, 0x1d1012faU, 0x0c501216U, 0x00000000U, 0x24f6e519U, 0xedaa1608U, 0xa4ef24fbU, 0x00000000U,
+  0x1200002eU, 0x1fcd00c7U, 0xc9fe0040U, 0x00000000U, 0x0f0101ddU, 0x042102f5U, 0xb511f7f7U, 0x00000000U,
+  0xfe2afa00U, 0xe0f61c00U, 0xf40e2d00U, 0x00000000U, 0x00ec0a06U, 0x00f8d6d6U, 0x00262e26U, 0x00000000U,
+  0xd316fc00U, 0x3d2dfcf1U, 0x39100658U, 0x00000000U, 0xf7fe05efU, 0xd72aef16U, 0x12fbf52fU, 0x00000000U,
+  0x05fad8eeU, 0xfa2dfe0aU, 0x0b6ef923U, 0x00000000U, 0x1b0efa33U, 0xe4bb00f2U, 0xb6ed1000U, 0x00000000U,
+  0x00000000U, 0x18150001U, 0x132400eeU, 0x00000000U, 0x00000000U, 0x01d80528U, 0x03ee0c10U, 0x00000000U,
+  0x00000000U, 0x030b1700U, 0xff01fe00U, 0x00000000U, 0x00000000U, 0x00e2f9deU, 0x00e5dcebU, 0x00000000U,
+  0x00000000U, 0xfe0fd40aU, 0x18faece1U, 0x00000000U, 0x00000000U, 0x0629fefbU, 0x0000211aU, 0x00000000U,
+  0x00000000U, 0x04f6f801U, 0x05090af3U, 0x00000000U, 0x00000000U, 0xee0d0d04U, 0x0037ef04U, 0x00000000U,
+  0x00000000U, 0x070100f5U, 0xfe0100d3U, 0x00000000U, 0x00000000U, 0x10d70630U, 0x03ee0712U, 0x00000000U,
+  0x00000000U, 0x06100a00U, 0x21eeea00U, 0x00000000U, 0x00000000U, 0x00f201eaU, 0x00250903U, 0x00000000U,
+  0x00000000U, 0xfe17db00U, 0x2ef9de19U, 0x00000000U, 0x00000000U, 0xfc33ef0aU, 0xf53215eaU, 0x00000000U,
+  0x00000000U, 0xf6e514ffU, 0xf9d50e09U, 0x00000000U, 0x00000000U, 0xfd1f1207U, 0x0932ea11U, 0x00000000U,
+  0x00000000U, 0xe8f6000bU, 0xf8df00e3U, 0x00000000U, 0x00000000U, 0x11f7f8ffU, 0xf90d0212U, 0x00000000U,
+  0x00000000U, 0xe30e1500U, 0x08e1ec00U, 0x00000000U, 0x00000000U, 0x0001f5eeU, 0x0010e809U, 0x00000000U,
+  0x00000000U, 0xf806e70fU, 0x21d9f40dU, 0x00000000U, 0x00000000U, 0xeb3b1723U, 0x082e1cf1U, 0x00000000U,
+  0x00000000U, 0xeff30d0cU, 0xe2e42a0bU, 0x00000000U, 0x00000000U, 0xfa18de00U, 0x1d12d107U, 0x00000000U,
+  0x00000000U, 0xf2d0000bU, 0xf0dd00e8U, 0x00000000U, 0x00000000U, 0x0f1efeefU, 0xd720f5efU, 0x00000000U,
+  0x00000000U, 0xd4f8fa00U, 0xe8def400U, 0x00000000U, 0x00000000U, 0x0006ecf8U, 0x00d9d528U, 0x00000000U,
+  0x00000000U, 0x01e50d32U, 0x19bde507U, 0x00000000U, 0x00000000U, 0xe32b0523U, 0x11092812U, 0x00000000U,
+  0x00000000U, 0xf5f5fd1eU, 0xe3de1319U, 0x00000000U, 0x00000000U, 0xf1f7ec02U, 0x3d1dd00aU, 0x00000000U,
+  0x00000000U, 0x0af40020U, 0x03e900edU, 0x00000000U, 0x00000000U, 0x26110e06U, 0xd616f0f8U, 0x00000000U,
+  0x00000000U, 0xfe2bee00U, 0xfded1300U, 0x00000000U, 0x00000000U, 0x00f908ddU, 0x00d6fe0cU, 0x00000000U,
+  0x00000000U, 0xffe20c0aU, 0x28c7c3f8U, 0x00000000U, 0x00000000U, 0xe0ffff09U, 0x18192201U, 0x00000000U,
+  0x00000000U, 0xffe3f710U, 0x0d0b3c23U, 0x00000000U, 0x00000000U, 0x0df70f01U, 0x081aea1bU, 0x00000000U,
+  0x00000000U, 0x021f00e8U, 0xdf3000d6U, 0x00000000U, 0x00000000U, 0x1cec0d27U, 0x22e90dfeU, 0x00000000U,
+  0x00000000U, 0xef300f00U, 0xf01ae800U, 0x00000000U, 0x00000000U, 0x00e91cc5U, 0x0004f2e8U, 0x00000000U,
+  0x00000000U, 0xe8fbd0f5U, 0x3413c5bbU, 0x00000000U, 0x00000000U, 0xdb1feefeU, 0xe712fbe9U, 0x00000000U,
+  0x00000000U, 0x16ede312U, 0x151deb2cU, 0x00000000U, 0x00000000U, 0xdf19eb05U, 0xf414e208U, 0x00000000U,
+  0x00000000U, 0xf80600e7U, 0xde2400d1U, 0x00000000U, 0x00000000U, 0x17e80e15U, 0x1fe72513U, 0x00000000U,
+  0x00000000U, 0x083d0e00U, 0xd93af200U, 0x00000000U, 0x00000000U, 0x000f0d00U, 0x00fea81fU, 0x00000000U,
+  0x00000000U, 0xfe0af8feU, 0x5127a5d1U, 0x00000000U, 0x00000000U, 0xd600ff1dU, 0xef1919dbU, 0x00000000U,
+  0x00000000U, 0x1c0f0d17U, 0x30222244U, 0x00000000U, 0x00000000U, 0xf3effbe7U, 0xf0fdc406U, 0x00000000U,
+  0x00000000U, 0xe5c300f5U, 0xe2ed00caU, 0x00000000U, 0x00000000U, 0x34100d23U, 0x04351238U, 0x00000000U,
+  0x00000000U, 0xbf112900U, 0xf730fa00U, 0x00000000U, 0x00000000U, 0x000a13fbU, 0x00c1bfeaU, 0x00000000U,
+  0x00000000U, 0x090df6f1U, 0x500abdcbU, 0x00000000U, 0x00000000U, 0xe2302615U, 0x16f945f1U, 0x00000000U,
+  0x00000000U, 0x15eef929U, 0x032f2633U, 0x00000000U, 0x00000000U, 0x20e7e8f0U, 0x031d0012U, 0x00000000U,
+  0x00000000U, 0x1fb600fbU, 0xf3cd00a2U, 0x00000000U, 0x00000000U, 0x1808f810U, 0xd9561330U, 0x00000000U,
+  0x00000000U, 0xd0081700U, 0x0f02ee00U, 0x00000000U, 0x00000000U, 0x00f6dae5U, 0x00b4f2eeU, 0x00000000U,
+  0x00000000U, 0x0d14fdfaU, 0x34e4cfdaU, 0x00000000U, 0x00000000U, 0xfa1efd08U, 0x16f6e81fU, 0x00000000U,
+  0x00000000U, 0x0ad8d43bU, 0xf21b1d39U, 0x00000000U, 0x00000000U, 0x19cef3dfU, 0x1708fe18U, 0x00000000U,
+  0x00000000U, 0x15a200f7U, 0xf5ca00c5U, 0x00000000U, 0x00000000U, 0x0329fc05U, 0xa92c0106U, 0x00000000U,
+  0x00000000U, 0xecfd0600U, 0xf208eb00U, 0x00000000U, 0x00000000U, 0x00ec04c3U, 0x00a300c5U, 0x00000000U,
+  0x00000000U, 0x0502f7f7U, 0x0c028fb6U, 0x00000000U, 0x00000000U, 0xd8fa100eU, 0x0025e71aU, 0x00000000U,
+  0x00000000U, 0x05f7ec16U, 0x25f73227U, 0x00000000U, 0x00000000U, 0x1bdd19e8U, 0x19f7f914U, 0x00000000U,
+  0x00000000U, 0x0bf600d8U, 0xdb0900dfU, 0x00000000U, 0x00000000U, 0x1bfbdfdbU, 0x1de107f9U, 0x00000000U,
+  0x00000000U, 0xe3fdff00U, 0xfd0ff000U, 0x00000000U, 0x00000000U, 0x000c45cbU, 0x000ddad6U, 0x00000000U,
+  0x00000000U, 0xe015f9faU, 0x2929d5caU, 0x00000000U, 0x00000000U, 0xdd0e0008U, 0x08f11dd9U, 0x00000000U,
+  0x00000000U, 0x1906df13U, 0x2842ea48U, 0x00000000U, 0x00000000U, 0xf5cb0e1eU, 0xf91fd014U, 0x00000000U,
+  0x00000000U, 0x04f500deU, 0xd44a00cfU, 0x00000000U, 0x00000000U, 0x1df5f903U, 0x3908edf5U, 0x00000000U,
+  0x00000000U, 0xe02b0b00U, 0xe14afd00U, 0x00000000U, 0x00000000U, 0x000f2ff7U, 0x00e0c412U, 0x00000000U,
+  0x00000000U, 0xf21ffff1U, 0x0613dfb5U, 0x00000000U, 0x00000000U, 0x13e92807U, 0x0ffae7b9U, 0x00000000U,
+  0x00000000U, 0x131ed756U, 0x3e3d054fU, 0x00000000U, 0x00000000U, 0x09cefbfbU, 0xc81dc546U, 0x00000000U,
+  0x00000000U, 0xf8f000e8U, 0xb31500b0U, 0x00000000U, 0x00000000U, 0x472c0d18U, 0x3128eb3cU, 0x00000000U,
+  0x00000000U, 0xda2c3400U, 0xcf280700U, 0x00000000U, 0x00000000U, 0x00fc1ef4U, 0x00f6e711U, 0x00000000U,
+  0x00000000U, 0x172707d6U, 0xe506d4d6U, 0x00000000U, 0x00000000U, 0x1d00ebe8U, 0x4bebb9eaU, 0x00000000U,
+  0x00000000U, 0x2014bf53U, 0x070b133fU, 0x00000000U, 0x00000000U, 0xf9b919eeU, 0x1a00fa35U, 0x00000000U,
+  0x00000000U, 0x0dd10000U, 0xc9d100abU, 0x00000000U, 0x00000000U, 0x2e302115U, 0x0f0be4ecU, 0x00000000U,
+  0x00000000U, 0xbe2d2200U, 0x0bf3ef00U, 0x00000000U, 0x00000000U, 0x00e3e9e2U, 0x00dfe93bU, 0x00000000U,
+  0x00000000U, 0x2513fbd2U, 0xf226b6beU, 0x00000000U, 0x00000000U, 0x0f17c7fbU, 0x20089cfbU, 0x00000000U,
+  0x00000000U, 0x2ce3dd68U, 0x1be21355U, 0x00000000U, 0x00000000U, 0xf5b110dbU, 0x38ade632U, 0x00000000U,
+  0x00000000U, 0x09a900dbU, 0xfbec00e4U, 0x00000000U, 0x00000000U, 0x150d09fbU, 0xfcf211faU, 0x00000000U,
+  0x00000000U, 0x09f80000U, 0xfee4eb00U, 0x00000000U, 0x00000000U, 0x00e50ff2U, 0x00b4f70aU, 0x00000000U,
+  0x00000000U, 0x0d15e4d0U, 0xee35a8a9U, 0x00000000U, 0x00000000U, 0x1f04cb0aU, 0x2a28bafbU, 0x00000000U,
+  0x00000000U, 0x24fff65fU, 0x13b80e19U, 0x00000000U, 0x00000000U, 0xef8405caU, 0x1db2de09U, 0x00000000U,
+  0x00000000U, 0xfcf000eeU, 0xfc0d00fdU, 0x00000000U, 0x00000000U, 0xf243e6ebU, 0xcd0234deU, 0x00000000U,
+  0x00000000U, 0xdc260300U, 0x0c0ef300U, 0x00000000U, 0x00000000U, 0x000d33ccU, 0x00e40adaU, 0x00000000U,
+  0x00000000U, 0xdb1fd8efU, 0x0d0ad8d2U, 0x00000000U, 0x00000000U, 0xf811f514U, 0xf7d81ff6U, 0x00000000U,
+  0x00000000U, 0xe72a051cU, 0x1d4eea3eU, 0x00000000U, 0x00000000U, 0x1ca10605U, 0xf407f1f8U, 0x00000000U,
+  0x00000000U, 0x07ed0007U, 0x061700d8U, 0x00000000U, 0x00000000U, 0x0b2711f8U, 0xff1623f8U, 0x00000000U,
+  0x00000000U, 0xe8321900U, 0x0410ef00U, 0x00000000U, 0x00000000U, 0x00e71fafU, 0x00fee80cU, 0x00000000U,
+  0x00000000U, 0xc9300708U, 0xdcfcdbc6U, 0x00000000U, 0x00000000U, 0x1f08fbf3U, 0x27f4e2cbU, 0x00000000U,
+  0x00000000U, 0x2841af60U, 0x0c345019U, 0x00000000U, 0x00000000U, 0x12bc03f1U, 0xd012dd02U, 0x00000000U,
+  0x00000000U, 0x04fe00e8U, 0xf50200bcU, 0x00000000U, 0x00000000U, 0x0b3114e2U, 0xfa1700faU, 0x00000000U,
+  0x00000000U, 0xda2f1500U, 0xf8070800U, 0x00000000U, 0x00000000U, 0x00e1ebc5U, 0x00f9dc34U, 0x00000000U,
+  0x00000000U, 0xbc1c21d9U, 0xaee9cdcbU, 0x00000000U, 0x00000000U, 0x2a21b30cU, 0x4a15c3d6U, 0x00000000U,
+  0x00000000U, 0x323fbf69U, 0x0bf9372dU, 0x00000000U, 0x00000000U, 0xd0bbfcfeU, 0xf2eadb0dU, 0x00000000U,
+  0x00000000U, 0xf7f600f7U, 0x10eb00bcU, 0x00000000U, 0x00000000U, 0x0a2f1ad9U, 0x04ff1aeeU, 0x00000000U,
+  0x00000000U, 0xbf4ff300U, 0x1c210700U, 0x00000000U, 0x00000000U, 0x00def2eaU, 0x00cbd30dU, 0x00000000U,
+  0x00000000U, 0xc418f9d6U, 0xcc21bff2U, 0x00000000U, 0x00000000U, 0x35299efdU, 0x1d2de7efU, 0x00000000U,
+  0x00000000U, 0x161df76eU, 0x09dd0008U, 0x00000000U, 0x00000000U, 0xc39bfd20U, 0x49d9cd2aU, 0x00000000U,
+  0x00000000U, 0x1af20003U, 0x30df00e9U, 0x00000000U, 0x00000000U, 0x140017f0U, 0x1f0014d2U, 0x00000000U,
+  0x00000000U, 0xee20ef00U, 0x1c321100U, 0x00000000U, 0x00000000U, 0x00cdeb05U, 0x00a8ef12U, 0x00000000U,
+  0x00000000U, 0xdf19f0cbU, 0xff03cee6U, 0x00000000U, 0x00000000U, 0x1d0fcb13U, 0x2328daefU, 0x00000000U,
+  0x00000000U, 0xead7e02aU, 0xeee0d6deU, 0x00000000U, 0x00000000U, 0x00a6f107U, 0x31d7deebU, 0x00000000U,
+  0x00000000U, 0x0ae300e8U, 0x31010005U, 0x00000000U, 0x00000000U, 0x8120d501U, 0xa91b0ae5U, 0x00000000U,
+  0x00000000U, 0xf3dcf900U, 0xf8e6ee00U, 0x00000000U, 0x00000000U, 0x0002ffbbU, 0x00b9fa05U, 0x00000000U,
+  0x00000000U, 0x2d05d1f2U, 0xe5cfdbe5U, 0x00000000U, 0x00000000U, 0xeafecbf4U, 0x1fe0e8ebU, 0x00000000U,
+  0x00000000U, 0xef4df328U, 0x4b47d216U, 0x00000000U, 0x00000000U, 0x05b02aeaU, 0x31e308efU, 0x00000000U,
+  0x00000000U, 0x16c800cfU, 0x23f900cdU, 0x00000000U, 0x00000000U, 0x9de517f5U, 0x0fec13deU, 0x00000000U,
+  0x00000000U, 0xd6c30300U, 0x020cd400U, 0x00000000U, 0x00000000U, 0x00e5e5bdU, 0x00b6f2edU, 0x00000000U,
+  0x00000000U, 0xe10bd0fcU, 0xb181fcccU, 0x00000000U, 0x00000000U, 0xf238d6efU, 0x1af01ecaU, 0x00000000U,
+  0x00000000U, 0x1952bf2cU, 0x47ffffecU, 0x00000000U, 0x00000000U, 0x0599deedU, 0x1c0bdf00U, 0x00000000U,
+  0x00000000U, 0x11be00beU, 0x091f00b8U, 0x00000000U, 0x00000000U, 0xccfe3cf1U, 0x27e716fcU, 0x00000000U,
+  0x00000000U, 0xc9eeed00U, 0x03181500U, 0x00000000U, 0x00000000U, 0x00bfbde2U, 0x00c801efU, 0x00000000U,
+  0x00000000U, 0x9712f1dcU, 0xe1c3ebecU, 0x00000000U, 0x00000000U, 0xde60b9ecU, 0xd40344e2U, 0x00000000U,
+  0x00000000U, 0x28d49314U, 0x1aa4d9b2U, 0x00000000U, 0x00000000U, 0x22b6ee2cU, 0x2d5ef223U, 0x00000000U,
+  0x00000000U, 0x33bf00e0U, 0xf51900e1U, 0x00000000U, 0x00000000U, 0xe2f433eeU, 0x0cdce5f1U, 0x00000000U,
+  0x00000000U, 0xb202e000U, 0xff2e1300U, 0x00000000U, 0x00000000U, 0x00b3dfd3U, 0x00ce24d1U, 0x00000000U,
+  0x00000000U, 0x8ff2fc08U, 0xf802daf6U, 0x00000000U, 0x00000000U, 0xec38bd01U, 0xc51b0cf5U, 0x00000000U,
+  0x00000000U, 0x04a2ba05U, 0xe3a7c4e0U, 0x00000000U, 0x00000000U, 0x19980132U, 0x273ee540U, 0x00000000U,
+  0x00000000U, 0x33e600dfU, 0xf4fc00eeU, 0x00000000U, 0x00000000U, 0xdaf210f7U, 0xcef6f4deU, 0x00000000U,
+  0x00000000U, 0xe60df600U, 0x061aff00U, 0x00000000U, 0x00000000U, 0x00b6f1e3U, 0x00ce0be0U, 0x00000000U,
+  0x00000000U, 0xd1c8fad6U, 0x0bbce5e4U, 0x00000000U, 0x00000000U, 0xebffee04U, 0xf811f4ffU, 0x00000000U,
+  0x00000000U, 0xf2c1ebf7U, 0xf2e9d9ecU, 0x00000000U, 0x00000000U, 0x1ecafd0fU, 0xddfdff25U, 0x00000000U,
+  0x3c0a005dU, 0xd2ea000dU, 0x19ef00eeU, 0xfdf200f6U, 0x13ecffe7U, 0x0b4afc06U, 0x1d13f223U, 0x11f1fa0eU,
+  0xfc213800U, 0xfb1ff500U, 0xfa1bea00U, 0xfe0e0100U, 0x001f2a1dU, 0x00f74a0eU, 0x000e3716U, 0x00b1440eU,
+  0xf6221141U, 0x02064e03U, 0xfb2b3ceeU, 0xf502f205U, 0x0afefd11U, 0xfdd1d5fcU, 0x09e80907U, 0xfafde108U,
+  0x0821f8f6U, 0xd603f3f9U, 0xda190c04U, 0xe302fcd6U, 0x12e4e90cU, 0xf1f12501U, 0x03c01011U, 0xf00b0f06U,
+  0x1dfd0039U, 0xfaf200fbU, 0x13dd00faU, 0x08df000dU, 0x00d207c7U, 0xe579f1dcU, 0x3be5eb25U, 0x2ff20035U,
+  0xd4d64500U, 0xdf2a0d00U, 0xdb19d500U, 0xfc44ed00U, 0x00180d21U, 0x00f047d0U, 0x00f74334U, 0x00b334f8U,
+  0xe63a0617U, 0x290a17fbU, 0x0925222eU, 0xeed30014U, 0x20141804U, 0x0de7b721U, 0x21e4fc15U, 0x250dde28U,
+  0x0e03fce8U, 0xe05df8eaU, 0xd41f220dU, 0xf42addd0U, 0x29e8ea01U, 0xb7d41600U, 0x00a40a00U, 0xf4132102U,
+  0x2538000aU, 0xf9e200f3U, 0x1f290004U, 0xf2db00faU, 0xe6dbf5eaU, 0xf131fdf0U, 0x2ee5e31dU, 0x1000002eU,
+  0xe7c02900U, 0xcc1f3d00U, 0xca0dc900U, 0x1845d000U, 0x002df415U, 0x00043e81U, 0x001141e5U, 0x00cd4408U,
+  0xd215050bU, 0x5405ee0aU, 0xf324181fU, 0xfaccfc2fU, 0x2b171c12U, 0xe719b434U, 0x0acef71fU, 0x19ecf622U,
+  0x0efff8eeU, 0xe53dcff2U, 0xdf132b07U, 0x0f2be705U, 0x0bfc0e0fU, 0x99cf25fdU, 0xeac83d1dU, 0xea1b0515U,
+  0x093e0007U, 0xfbee00e8U, 0x1838000cU, 0x0bf900f2U, 0xf9c506fbU, 0x172dfa15U, 0x4ce0071cU, 0x1fee081bU,
+  0x23d22900U, 0xd3373600U, 0xdd1fcd00U, 0xfb54e500U, 0x00380323U, 0x00022b9aU, 0x000b31cfU, 0x00c222f5U,
+  0xc1001714U, 0x44fbe3efU, 0xdd39eef3U, 0x19ffe72dU, 0x26e919f4U, 0xfe2d9f29U, 0xefd7db2aU, 0x140f1224U,
+  0x1ef5ec05U, 0xed06d0e5U, 0xf3f7190eU, 0xfd35f812U, 0xfa2924efU, 0xb4d80706U, 0xd2e64529U, 0x0218fa21U,
+  0xfa2800f1U, 0xf0ec00c8U, 0xfc1f0021U, 0x19240017U, 0x00e9fd00U, 0xec39fe27U, 0x0fff1305U, 0x5e2e0c11U,
+  0x03e5f900U, 0xe6262900U, 0xf4d5c900U, 0xfb56d300U, 0x002af916U, 0x001220d3U, 0x002cfa18U, 0x00d0080eU,
+  0xe0fd2810U, 0x23decd29U, 0xef23d019U, 0x201237d1U, 0x04ee0204U, 0x0e10dc0cU, 0x1ef0051cU, 0x0af60417U,
+  0xf209d3fbU, 0x1328c210U, 0xe024db09U, 0xf7390303U, 0xe3090bf0U, 0xc3e1faecU, 0xe503f2f9U, 0x221f081eU,
+  0x34080065U, 0x0cef0032U, 0x4ad000cfU, 0x2ce900dcU, 0x19da02eaU, 0x031bfb01U, 0x0c0701f7U, 0x23fcfddeU,
+  0xf41c4700U, 0x012d0500U, 0xe4dbdc00U, 0xfe0dec00U, 0x00f92926U, 0x00383e05U, 0x00f55b07U, 0x00e463dfU,
+  0xe52a3631U, 0xf8f83f34U, 0xe52a10fdU, 0xd4f8ba35U, 0x1529db11U, 0x0cb3d32dU, 0x35f6ed33U, 0x07d6d72bU,
+  0x041e01fdU, 0xcd13f4c5U, 0xb715f0b6U, 0xc002d9dfU, 0x28d40efbU, 0xe4d226ebU, 0x2abc24f6U, 0xcb0d15fcU,
+  0x5a15005eU, 0xfbe300eeU, 0x2fe400dbU, 0x050100deU, 0x0fb1f8faU, 0xe26425f1U, 0x0c0ed9f8U, 0xf21b0dfbU,
+  0xf9004100U, 0xee411400U, 0xdb00c800U, 0xf115fa00U, 0x00e20cf4U, 0x00fa45d0U, 0x00f82a11U, 0x00f94dbcU,
+  0xb2112315U, 0x071d3c44U, 0xe4fd27f9U, 0xc8cde72cU, 0x03341f0fU, 0xeeffe51cU, 0x38f41a4eU, 0x22eeea33U,
+  0xddff18fbU, 0xc702dccaU, 0xd3f50ce5U, 0xe8fce30dU, 0x33f8eb0bU, 0xd30229e8U, 0x4cc42c04U, 0xbff524e7U,
+  0x311a001eU, 0x26f100edU, 0x07200015U, 0xf0d200caU, 0x17c9e5dbU, 0xe5563f25U, 0x05f4d2f9U, 0xd70700d8U,
+  0x1aea2f00U, 0xcd242b00U, 0xff3ec100U, 0x030aec00U, 0x00182012U, 0x00f013baU, 0x00037230U, 0x00f74216U,
+  0xca062008U, 0xff29021fU, 0xbacf3a16U, 0xf1c70d0cU, 0x01363003U, 0xbc1f0323U, 0x30ff2b33U, 0x11ecfe16U,
+  0x13f526eaU, 0xeabee8ffU, 0x04fa1104U, 0x1e04dffdU, 0xfceabd28U, 0xaf1242c9U, 0x17cf381bU, 0xe7fb22f7U,
+  0x021f000eU, 0x2be200c6U, 0xd92f0029U, 0x00f400f8U, 0xf9c6e00dU, 0xfa314120U, 0xf2e0ef1dU, 0xdd0c170aU,
+  0x12d81a00U, 0xe3203b00U, 0xaf41f600U, 0xd326e400U, 0x005d1823U, 0x00f623a1U, 0x000d4231U, 0x00f7381eU,
+  0xd60e2e14U, 0x2907efe8U, 0xb7020c06U, 0x1ee3f321U, 0x1c111e0eU, 0xe7efef2bU, 0x42feef31U, 0xcfbd01fdU,
+  0x231f0be5U, 0xfb9bd5f3U, 0x031e161aU, 0x0c10c829U, 0xed1b132fU, 0xbff033d3U, 0xddc9103cU, 0x0cfa23fdU,
+  0xed4300f7U, 0x41d60093U, 0xdc3a0018U, 0x1cd000eaU, 0x10f10214U, 0xb62e0f24U, 0xd412100cU, 0x601e3507U,
+  0x1dfcfc00U, 0xbe182300U, 0xc61def00U, 0xf84ec700U, 0x007ff611U, 0x00121293U, 0x0010fa19U, 0x00e60af3U,
+  0xd9ea392dU, 0x55eba6f6U, 0xe0220f4dU, 0x18e23b02U, 0x19e32df8U, 0x3409db28U, 0x0b10df21U, 0xdbc91010U,
+  0xed1bd1f7U, 0x33fcf71eU, 0xf625de2aU, 0xf109b9fcU, 0xb90c3613U, 0xb1f3f1eaU, 0xb9da0434U, 0x57204039U,
+  0x69ef005cU, 0x021b0034U, 0x7fb000feU, 0x19f300f1U, 0x1c0df9f6U, 0x39f92416U, 0xecefdff1U, 0x1448e5c1U,
+  0x030e3600U, 0x06111800U, 0xdde1da00U, 0x095ade00U, 0x00cc1a4bU, 0x002231e1U, 0x003f64e3U, 0x00027fa1U,
+  0xda1b3826U, 0xeadd0770U, 0xb200f644U, 0x210ad967U, 0x011ef439U, 0xf5c6f31fU, 0xfe0c2454U, 0xe4cac505U,
+  0xf1180ce1U, 0xeaeaffb7U, 0xd2cfddb5U, 0xd1f712f8U, 0xfecaf9f9U, 0xdc351af1U, 0xf7a04ce7U, 0xbab43007U,
+  0x3d0c005eU, 0xf61b0000U, 0x40c300fdU, 0x23f300daU, 0x0afd0f01U, 0x33193206U, 0xf2d0ec1fU, 0x0b08e9d7U,
+  0x35dd2c00U, 0x22440b00U, 0x23e1fc00U, 0xef69e400U, 0x00c446e4U, 0x003b35eaU, 0x002e1309U, 0x00f751b2U,
+  0xf600dc0aU, 0xe5ef1377U, 0xb2dd151cU, 0x031eee5aU, 0xef210e5eU, 0xb6fff2feU, 0x211c2133U, 0xd3e9e015U,
+  0xe92425c5U, 0xc9d3eb9aU, 0xeeb2cdbaU, 0xee08f21bU, 0xf801d901U, 0x2d252df8U, 0x22c334f5U, 0xfdea4909U,
+  0x37eb00d5U, 0xff08000eU, 0x2ced00f7U, 0x10e700ecU, 0xf100f20aU, 0x02053ffcU, 0x04ded913U, 0x303413c8U,
+  0x3ded1a00U, 0x094e0900U, 0x19021000U, 0xe153ff00U, 0x00074dc8U, 0x001238e2U, 0x00004a37U, 0x00e855ddU,
+  0x01d9e2f9U, 0x24062747U, 0xb5f53e24U, 0x021ce735U, 0x172c214cU, 0xa223e2fdU, 0x1d1a1314U, 0xdce2da04U,
+  0x0af107d4U, 0xd0fd01bfU, 0x0bf3b4cdU, 0x1319cf0aU, 0xccf61109U, 0x012718f2U, 0xdcee380dU, 0xfddc44eeU,
+  0x170500d8U, 0x22fc00d8U, 0x0a26001cU, 0x2bde00f5U, 0xd204de24U, 0xfd0830ecU, 0x10f21d12U, 0x440115ecU,
+  0x19f10e00U, 0xed311900U, 0xd1081a00U, 0xcf481100U, 0x004729f9U, 0x00092cf0U, 0x00005d1bU, 0x00024cd9U,
+  0xeced48f1U, 0x20f34824U, 0xc2103a25U, 0x4efef115U, 0x091b411fU, 0xd1eb0304U, 0x1507ec30U, 0xd2ac0fd4U,
+  0x09f9d6e6U, 0xf5c6faecU, 0x140ed2f2U, 0x1540abfeU, 0xba003415U, 0xfa4406e0U, 0xf9ec2512U, 0x20f728d3U,
+  0xe73000e6U, 0x10d500b2U, 0xd8f300fcU, 0x25c800f6U, 0x0607ef30U, 0xb71318e0U, 0x17111d08U, 0x7e26240fU,
+  0x17f9f200U, 0xdd292200U, 0xca0c0b00U, 0x002cf300U, 0x0055faf6U, 0x001414d4U, 0x000cdf26U, 0x00ec29cbU,
+  0x13eb4517U, 0x1317d9e0U, 0xeefd2a1cU, 0x0aeef71bU, 0x09e25f10U, 0x1228e00cU, 0x0e2f0138U, 0xe4c2210fU,
+  0x0c0bdff3U, 0x24e00d0bU, 0xfb58bc03U, 0x100e9f28U, 0xe31a320cU, 0xd90addd3U, 0x20f20526U, 0x2e1c2df3U,
+  0x6be5001aU, 0xee1f001eU, 0x6cd5003fU, 0xfaec0004U, 0x12f2ffceU, 0x4eedf641U, 0xd839daedU, 0xda2ebceeU,
+  0x0d1cfb00U, 0x22ea1a00U, 0xde11f600U, 0xf7e1fe00U, 0x00dc3d38U, 0x00031806U, 0x001174cfU, 0x0013f3e1U,
+  0x0200061cU, 0xfcdbfc6eU, 0xecee305aU, 0x572ac323U, 0x0ee2f756U, 0x0127f30aU, 0xe8dbfd5fU, 0xeaf4ae1fU,
+  0xd61700ddU, 0xd81011deU, 0xdfe0f3c1U, 0xf1201e1fU, 0xe8ef01f2U, 0xdc402f11U, 0xf0d674e3U, 0x0f9b180bU,
+  0x71ec00f7U, 0xc2300005U, 0x49d60050U, 0x09cd00fdU, 0xcdd11ccdU, 0x4ad726ebU, 0xd1190314U, 0xd42fe1c3U,
+  0x2be2e600U, 0x251d0900U, 0xfffd1e00U, 0x132cf000U, 0x00c319c3U, 0x003017feU, 0x004c24f6U, 0x00da0b97U,
+  0xfceee605U, 0x0ceaf056U, 0xfcc52a33U, 0x6b31d167U, 0x25fa2c5dU, 0xd90a0800U, 0x0aee1661U, 0xcefecc16U,
+  0x03c42be0U, 0xda1a1ec5U, 0xf7bfdccfU, 0xfe57e441U, 0xbb0c06fdU, 0xd22c1725U, 0xd8f266e3U, 0x2388360aU,
+  0x3df300c6U, 0xe52b0024U, 0x27d40032U, 0x4eba0006U, 0xb8cef4efU, 0x1cee38c9U, 0xe4f1f5fcU, 0xf42af1adU,
+  0x2710f200U, 0x0524f400U, 0x0d023300U, 0xd5411000U, 0x00f53ba6U, 0x000b0123U, 0x003b5310U, 0x00d32ba6U,
+  0xe9dff6f1U, 0x31f4fc04U, 0x20db2c4dU, 0x1f102858U, 0x2f06543fU, 0xd1fd07f4U, 0xfdf1082aU, 0xc1f5cc00U,
+  0x17a2f1dcU, 0xfe2036ceU, 0x0917d0cdU, 0x0b4acc3dU, 0xb81d1bccU, 0xf31d10ffU, 0xcbe723d1U, 0xee8f30d4U,
+  0x08fe00d0U, 0x03eb00e1U, 0x21ea0005U, 0x41d500faU, 0xe3f7f236U, 0xf1dc0edbU, 0x0bf2f429U, 0x3a280ebcU,
+  0x12300500U, 0xe7350900U, 0xedec4800U, 0xc9220000U, 0x002341ecU, 0x003eef17U, 0x00412c01U, 0x00ed2aadU,
+  0x0c0346efU, 0x2be5f2e8U, 0x29080239U, 0x2d111c06U, 0x0a292d0dU, 0xfa000cefU, 0xf8f1fe10U, 0xcdedf6ebU,
+  0x0cf4e5f8U, 0xff1133f3U, 0xf32ee5ebU, 0x2f190117U, 0xc41136d4U, 0x0f1ff806U, 0x12e6f9ceU, 0x04b70ad9U,
+  0xf42a00ffU, 0x0ef200afU, 0xebf700edU, 0x22c700f7U, 0x0efb024bU, 0xc80d1ae0U, 0x2022ea38U, 0x3f230d08U,
+  0xf5fcf800U, 0xb82d3300U, 0xebcc3900U, 0xebe80500U, 0x00390106U, 0x0026fc0dU, 0x0043eaf4U, 0x00f100cdU,
+  0x08083600U, 0x2504bfedU, 0x0c020019U, 0x0f0ff426U, 0x020841fcU, 0x1c180afdU, 0x01411727U, 0xdbe81c0fU,
+  0x19ede6e2U, 0x1cdf3e07U, 0x162cfef7U, 0x150ede02U, 0x03f612cdU, 0x15feea03U, 0x2ffd06eaU, 0x11f3e0cfU,
+  0x04e20003U, 0xd01e000bU, 0x3bec0001U, 0x30f20016U, 0xf5f3f0f2U, 0x2300d217U, 0xca44d438U, 0xfeceb9efU,
+  0x04fbe300U, 0x19f80300U, 0xf8f50a00U, 0xe5270a00U, 0x00fef9f4U, 0x00fe3211U, 0x003b60d8U, 0x0024d5e0U,
+  0xe8ede60cU, 0x21fe2828U, 0x2df81d2cU, 0xfe42d2f5U, 0xe4fd282fU, 0x2a25d621U, 0xcc04ec5aU, 0xe106d0e7U,
+  0x16cdfb13U, 0xcc40410dU, 0x0918201aU, 0x15d80f11U, 0xf3f002f7U, 0xd8421d19U, 0xe1f83713U, 0x2ca2f2edU,
+  0x4eed00dbU, 0x9b1f001dU, 0x37fd004dU, 0x36b9000bU, 0x01dff9fdU, 0xedeedaf7U, 0xa315dc1cU, 0x0df3eadfU,
+  0x1900d000U, 0xecdbef00U, 0xd7124200U, 0xf4fd0000U, 0x00dd01c9U, 0x0021f85cU, 0x005b4c06U, 0x0022a5cdU,
+  0xe7f1d609U, 0x4dfe0f1dU, 0x2e160f26U, 0x4353e004U, 0xe611323dU, 0x2bf8be09U, 0xeadcec6dU, 0xb746bdcbU,
+  0x1ec7e4ffU, 0xda204514U, 0x0d1b1513U, 0x1eeddf1bU, 0xde0928e7U, 0xfa04f70aU, 0xf2f94ae5U, 0x1e91dee8U,
+  0x1ee300d8U, 0xcdf20021U, 0xeeec0054U, 0x3bb000dcU, 0xf2dbeb1dU, 0xff0f19cdU, 0xf1d7f22fU, 0x14310cb6U,
+  0x330ecd00U, 0xddf9d800U, 0xf10a6d00U, 0xfbc11a00U, 0x00db10baU, 0x0014db45U, 0x003f21dcU, 0x00f5c7bdU,
+  0xedd4f2f2U, 0xe50616d2U, 0x361f2324U, 0x452a10efU, 0xef1b2e37U, 0x1afcd6e4U, 0x08fbf423U, 0xb33aafc1U,
+  0x25d6ece9U, 0x0e1c1b09U, 0x000c1f17U, 0x34fd0e20U, 0xcdfc1af2U, 0x01c5f112U, 0xe5e229a4U, 0xf6acf020U,
+  0x08ca00ecU, 0x08d500f3U, 0xc6d500e6U, 0x2fb800baU, 0xe62cec32U, 0xcf1717f7U, 0x1714242cU, 0x102108cdU,
+  0x0ef4ea00U, 0xa010fe00U, 0xf4ea5900U, 0xf5bc0200U, 0x000206eaU, 0x0015d32eU, 0x003bd6e5U, 0x00e5ecd6U,
+  0x08e90de3U, 0xcff41397U, 0x182b28edU, 0x352b06f1U, 0xf6331918U, 0x200ffef9U, 0x1509f007U, 0xbb37e8ddU,
+  0x1e24ff14U, 0x14440401U, 0x0ffb3804U, 0x2ed32e03U, 0xfaed09e4U, 0x0fd1f72aU, 0xfcc109d5U, 0x14a1f421U,
+  0x0bfd00f2U, 0x34e500b6U, 0xd0d300d8U, 0x0ebb00ccU, 0x08150640U, 0xcc110212U, 0x0a141e18U, 0xe813f5efU,
+  0xf5f50100U, 0xde150d00U, 0xf5024800U, 0xe9c61200U, 0x0013f22dU, 0x00f6070fU, 0x002118d3U, 0x00d5e3e0U,
+  0xffe31dfbU, 0xf3fbfec5U, 0x40490d03U, 0x4d1df1f9U, 0xf62217fbU, 0x471802ddU, 0x044515fcU, 0xdc0c0beeU,
+  0x1619e41aU, 0x1b0c0504U, 0x12101715U, 0x26f91406U, 0x2c0a0bcbU, 0x00d60bf5U, 0xedeaf4dcU, 0xffd0ffe9U,
+  0xff0700faU, 0xf0ff00ffU, 0x0e0100fbU, 0x01e8002dU, 0x08ff03f8U, 0xfcdd05e3U, 0xfcf001feU, 0x160df10eU,
+  0x070a1500U, 0xf6ff0e00U, 0x05e3f700U, 0xf6121600U, 0x00130502U, 0x0031daf5U, 0x000cf3fbU, 0x0026402bU,
+  0x01ff08f1U, 0x0404ff0aU, 0xfc06de00U, 0xfc1e4507U, 0x07f9ece2U, 0x022009dcU, 0x01fd0113U, 0x0ceeda00U,
+  0xf6e307faU, 0x12d10001U, 0x150bf908U, 0x1409fa25U, 0x04fbfd08U, 0x14eef5fbU, 0x07ffe9ffU, 0xf7c40a04U,
+  0x070200e4U, 0x040100ebU, 0x050100ebU, 0x0afc0029U, 0x27e50202U, 0x19dc0ae5U, 0xf4ee0eceU, 0x2114d604U,
+  0x091e1100U, 0xe4f5e300U, 0xf8dbfe00U, 0x0a103d00U, 0x0019f7edU, 0x0030fa14U, 0x0021d80bU, 0x00f32651U,
+  0xf40f01f5U, 0xd41721cbU, 0xf0f9fcf3U, 0xf3072fefU, 0xf60cf2f0U, 0xe30802d3U, 0xf8ff03f6U, 0x43d9c61fU,
+  0xf4f1fcfbU, 0x0bbc100eU, 0x1cecd810U, 0x0e23f916U, 0x04f60619U, 0x28c300fbU, 0x08fee8f4U, 0xf3af07ebU,
+  0x010a00e3U, 0x101600e4U, 0xf80f00fcU, 0x14350005U, 0x35f409fcU, 0x25e509e3U, 0xf00617e2U, 0x0a14ced2U,
+  0x0f151700U, 0xd6cfba00U, 0xe7dbed00U, 0xdc1c4700U, 0x000bf7f9U, 0x001b063fU, 0x000edc3dU, 0x00f6370eU,
+  0xdf0bfb05U, 0xc5341fb5U, 0x020d2bd3U, 0xf7020a19U, 0xe7fc08f1U, 0xc70205d9U, 0xf3f811edU, 0x3ae0c137U,
+  0x01f814faU, 0x3ad71506U, 0x1e07d206U, 0xf92af9ffU, 0x0f0f00fbU, 0x2cc4f7f4U, 0x171601f4U, 0xb8c319eeU,
+  0xfc0700f9U, 0x1b120009U, 0xe4050009U, 0x1136001fU, 0x181008f2U, 0x24d211e7U, 0xf6e615f3U, 0x1905cdf7U,
+  0xffdc2100U, 0xcce3ca00U, 0xebe8c300U, 0xba264c00U, 0x0007f2f7U, 0x001f042bU, 0x00f2ea30U, 0x00082200U,
+  0xf6e11c25U, 0xb34506d7U, 0x0cff21e1U, 0xf7f9fc28U, 0xe4dffefaU, 0xc505fa0cU, 0x000039fbU, 0x3ff5ad21U,
+  0x0bf0150cU, 0x24cc28feU, 0x0d17eae2U, 0xe056ff19U, 0x0012f7e2U, 0x33e8fcdaU, 0x193a0ef9U, 0x85c802f5U,
+  0xf1140002U, 0x0e0c0012U, 0x06f400f7U, 0x32240012U, 0xf70cf8f1U, 0x3bc819e6U, 0x07110b05U, 0xf03a0214U,
+  0x0828ed00U, 0xe9f8d800U, 0x0be4fd00U, 0xa44f3c00U, 0x00f31706U, 0x0033222bU, 0x00f9f02bU, 0x00f527feU,
+  0x15dd0ce5U, 0xc74cf3fcU, 0x1b143afdU, 0x1ee50d0fU, 0xfff9fcf5U, 0x0108f308U, 0xf1ef2b07U, 0x24f8cd17U,
+  0x01f9100eU, 0xf3c31dfcU, 0xf335cedfU, 0xf359e928U, 0x111316f2U, 0x20e8f9f1U, 0x0e251bf6U, 0xa3e803f4U,
+  0x091b00f1U, 0xfc050001U, 0xf21000f5U, 0x38df002bU, 0x12f10c15U, 0xfee30013U, 0xdfea0aeeU, 0x1030eb01U,
+  0x07110500U, 0xf3c71800U, 0xffd40200U, 0xf1b93500U, 0x0002ffe9U, 0x000bd5ebU, 0x0017ddf3U, 0x001a4135U,
+  0x0307f9e4U, 0xd202eef1U, 0xf90ee205U, 0xdf2c48f9U, 0xfde60ffcU, 0xe12b22deU, 0xf60ff8fbU, 0x33d8c72aU,
+  0x00fb040cU, 0x27d1ee05U, 0x16f10e11U, 0x241ff515U, 0xfb05fffdU, 0x32fe1306U, 0x01fe0105U, 0x11940ae4U,
+  0xf91f00e5U, 0x1feb00eaU, 0xf51200eeU, 0x2dfc0011U, 0x15dc1b15U, 0x06c5ff11U, 0xec0218d8U, 0x293fe3f6U,
+  0xfc2afb00U, 0xf3b2e800U, 0xe6d40000U, 0x2dc83700U, 0x002608d7U, 0x001becf6U, 0x000ac814U, 0x00f84d2bU,
+  0xfc15f2efU, 0xb71905bbU, 0x08ffe0efU, 0xdb0244eaU, 0xddef09f5U, 0xc630f4e5U, 0xf209fde2U, 0x56b3b052U,
+  0x170708ffU, 0x1dced207U, 0x13f1ed2dU, 0x02fdd3feU, 0xe914ec01U, 0x42f7fa0eU, 0x1b020106U, 0xcde43cd2U,
+  0xfbfd00e3U, 0x180800e4U, 0xea1800f1U, 0x161700fdU, 0x17e30ef4U, 0x0cd3e9faU, 0xfc1af2f3U, 0xd93fd902U,
+  0x03090000U, 0x00b5e300U, 0xe6daf800U, 0xd2000f00U, 0x000cf408U, 0x0037e91cU, 0x000cbd14U, 0x00fe0e0aU,
+  0x082bf2ecU, 0xd50e0dc7U, 0x03fbf9feU, 0x2a0e37f0U, 0xebf90cffU, 0xda1905feU, 0xf4f301e4U, 0xece1d430U,
+  0x1e152208U, 0x30f3c901U, 0x070ff616U, 0xd90ae5e7U, 0x0511e8f3U, 0x110b26f0U, 0x05210117U, 0xb5fe36e5U,
+  0x041700e0U, 0xfb070035U, 0xebfd00f4U, 0xfe2200e7U, 0x041111fdU, 0x08cedf01U, 0xf818faecU, 0xfc1af804U,
+  0xf5f10e00U, 0x16c4ee00U, 0xf9ebd800U, 0xd3020b00U, 0x0017e111U, 0x001ceb44U, 0x00ffdee6U, 0x000c2602U,
+  0xf40c17ecU, 0xb51c27fcU, 0x0bf10800U, 0x382c2226U, 0xe4e80eeaU, 0xc91a2a10U, 0xf1defef0U, 0xe3ebdb0cU,
+  0x050c1913U, 0x1e0ff8fdU, 0xee1bf9f1U, 0xd21700f1U, 0xf92ee7e8U, 0x14fd15dbU, 0xfa1a1d18U, 0xeb1b39eaU,
+  0xfc150003U, 0xbaec0018U, 0x090000edU, 0x2f1100e1U, 0xebf504feU, 0x18cc0308U, 0x12170802U, 0xe068feffU,
+  0x01e3ec00U, 0x03ed0c00U, 0x04fe0100U, 0xa4f83400U, 0x0021f1feU, 0x001d0447U, 0x0000140fU, 0x00f824dfU,
+  0xf0f208dfU, 0x9b1a20fdU, 0x030b2f00U, 0x3a0cde1dU, 0xedfa03f7U, 0xf12b2b19U, 0xeedc2903U, 0xf3c0cc24U,
+  0xf2ef100eU, 0xe914e8f0U, 0xe814ece3U, 0xfa5ed72fU, 0x0f26eb11U, 0x3bd61cf2U, 0x15312ef5U, 0xbd34fe10U,
+  0xfe1b00f1U, 0xde0e00ffU, 0xf9050006U, 0x6a030020U, 0xf01e1e0bU, 0xead9fa2cU, 0xebf1feecU, 0xea050628U,
+  0xf7150400U, 0x0bf81a00U, 0x09f10000U, 0x08903b00U, 0x00ec0fdfU, 0x00c5e8d5U, 0x00f7e3f5U, 0x00e7f413U,
+  0x2400d1f9U, 0xc300ebfbU, 0xf012fe0cU, 0xf115ff04U, 0xfeda0ce4U, 0xd0400ae0U, 0xff0703ecU, 0x3ef1f039U,
+  0x1135db1bU, 0x18980008U, 0x15de120dU, 0x2af3de10U, 0xed0c010cU, 0x162a2515U, 0x06fc0a0aU, 0x25fcdeb8U,
+  0xff2400ecU, 0xf9e600f9U, 0xf7fe00ebU, 0xfa0d0010U, 0xef000903U, 0xf5e8070dU, 0xff02f6ebU, 0xd5240d18U,
+  0xfd23ef00U, 0xf9f80300U, 0xe9ecf200U, 0x37c52300U, 0x00f807ebU, 0x00e8c9d5U, 0x00f1c504U, 0x00fe2814U,
+  0x2413e2ecU, 0xfa26fae1U, 0xee00ebf7U, 0xdeea3c05U, 0xefc91af2U, 0xbd451cf8U, 0x072104e2U, 0x51c20d34U,
+  0x00260338U, 0x17e0e9ecU, 0x13ed001bU, 0x1adcc5e6U, 0xbd1001f8U, 0xff1f2e10U, 0xf8000114U, 0xfc3115adU,
+  0xff0600f2U, 0xf3f90009U, 0xf9ff00d4U, 0xe6fd0013U, 0xf91d03e3U, 0xf3efedeeU, 0x0917fcfbU, 0xc820190fU,
+  0xeb25e500U, 0x32ff0d00U, 0xfffae100U, 0x0bf5f000U, 0x0007e3dfU, 0x00f9fc1dU, 0x00fcd0f1U, 0x00281c1bU,
+  0x21f804b9U, 0xf9f9f624U, 0x1410f3f2U, 0x0ffe33feU, 0xf1d52902U, 0xde38390fU, 0x05021beeU, 0xfdebf613U,
+  0x170c0426U, 0x0823fed2U, 0xfd070811U, 0xe8f4f9f2U, 0x050604dcU, 0xec26eff0U, 0xf50df417U, 0xdb1920cbU,
+  0x081a0008U, 0xdb0b0041U, 0x0b0f00f8U, 0x15d50008U, 0x13101607U, 0xffbf1317U, 0xf0f8e8faU, 0xfcfe22edU,
+  0x022ee900U, 0x41f02400U, 0x1301e600U, 0xf701f900U, 0x0015edf4U, 0x00130928U, 0x0007fcefU, 0x00170cffU,
+  0xf5e9f4ceU, 0xd2f9002fU, 0x0c0efe0fU, 0x29e7431aU, 0xf1e31bfbU, 0x03022214U, 0xf5d215efU, 0xf7dd2ef0U,
+  0x05fef61fU, 0xfa03e5ecU, 0xf119fbecU, 0xd2ef08d9U, 0x1b031ceeU, 0x0f1604e7U, 0x0e070100U, 0x0f100de7U,
+  0x290600e3U, 0xedcb001eU, 0x2cfa000fU, 0x43c600faU, 0x02fd130eU, 0x21c9f52dU, 0x1100dc0fU, 0xe235180fU,
+  0x1511ed00U, 0x4a1a3f00U, 0x23f1f300U, 0xcad15500U, 0x002ef9cfU, 0x00f90d3aU, 0x00102426U, 0x00f814cbU,
+  0xfee4ded5U, 0xfde52310U, 0x10043f1aU, 0x19eeee09U, 0x0e0801ffU, 0x2223152cU, 0xebba3900U, 0xe8d31714U,
+  0x0ae71241U, 0x001bddf8U, 0xf51ce1e8U, 0xe82edc08U, 0x09100240U, 0xf4de2ac8U, 0x001a3edbU, 0xe13b1ee7U,
+  0xf50200ecU, 0xdd0b00fdU, 0xf6fd001bU, 0x43fa001cU, 0xd23700deU, 0x2a0a00f3U, 0xf2170205U, 0x0ed3f738U,
+  0xeb0c0100U, 0x03143000U, 0x08081200U, 0x2dd41400U, 0x00f005feU, 0x00cceef6U, 0x00e8e3f7U, 0x00f6c4eaU,
+  0x0a01db01U, 0xe70b01f9U, 0x0deef508U, 0xeb07e4fbU, 0x0be7d609U, 0xcb30f117U, 0x0215f801U, 0x1d3c16f5U,
+  0x0f58cd17U, 0x25b8fde8U, 0x01e112fcU, 0x2281f9ceU, 0xe7da020cU, 0xf01a3638U, 0xff0d1007U, 0xfb08b9edU,
+  0xe41900f4U, 0x1d1400f2U, 0xec1800efU, 0xca0900f1U, 0xd81d25b2U, 0x2fe5f6e7U, 0x0910dcfdU, 0x13edf0f1U,
+  0x0312e400U, 0x16362800U, 0xfa140e00U, 0x3c0c1900U, 0x00eef7f2U, 0x00eb07b0U, 0x00dae5dcU, 0x00e81df4U,
+  0x1afbf0eeU, 0x10220b18U, 0xfce1e401U, 0xd6dd2644U, 0x16d5fee1U, 0xbf15f93cU, 0x1414f115U, 0xf81600e8U,
+  0x1431ee30U, 0x19f6f6feU, 0xf6e5fdf5U, 0x12becbc7U, 0xf5f903fbU, 0xca16191fU, 0xfff21208U, 0xf83109eeU,
+  0xf72100e7U, 0xe72b000aU, 0x020000e4U, 0xf1fb001cU, 0xf03c30ddU, 0x19e701edU, 0x09f3cb0aU, 0xf5f3ff04U,
+  0xe835e600U, 0x25063400U, 0xef2bf100U, 0xff3f2100U, 0x00f8feceU, 0x000f1005U, 0x00f918ffU, 0x00f42ae5U,
+  0xf5df06c7U, 0xf9121b2aU, 0x15fdf102U, 0xee03273aU, 0x04e207d1U, 0xf3fc1115U, 0xeaf5fd21U, 0xbffd04f6U,
+  0x3328194cU, 0x0828f607U, 0xcff201edU, 0xcceafac4U, 0xfbe4f6efU, 0xe53119eaU, 0x030a1102U, 0xfe3319ddU,
+  0x050f00fbU, 0x01e7003eU, 0x25e60003U, 0x23d2002eU, 0xff291efaU, 0xe7f11219U, 0x0beeec10U, 0x03f32908U,
+  0xea0edc00U, 0x311d2800U, 0x091ce700U, 0xe31cfd00U, 0x0005dfe2U, 0x000bf723U, 0x00f828f7U, 0x001415d3U,
+  0xf0d801cfU, 0x0a251224U, 0x1f180724U, 0x0bf72908U, 0x1ef6fcfdU, 0x0c24e902U, 0xebd60f0dU, 0xe3e43217U,
+  0x27280b48U, 0x01ecda14U, 0xe10cf9d1U, 0xc8dfeec6U, 0xfefd011aU, 0xb91b190aU, 0xf6100ed8U, 0xec2b0bc7U,
+  0x2ef000d2U, 0x2aac0048U, 0x10e70028U, 0x3ddb0020U, 0x010e250eU, 0x03eae214U, 0x0616ec0cU, 0xdef90515U,
+  0xf3f3f800U, 0x0c422900U, 0x20f8fe00U, 0x01cbff00U, 0x00faddb4U, 0x00fa14e3U, 0x00f61e0cU, 0x001809a4U,
+  0xe4e2e7a4U, 0x051107fdU, 0x27243e32U, 0x38f3faf1U, 0x25040203U, 0x0f38da17U, 0xbdd4211aU, 0xf0d636f1U,
+  0x23e01345U, 0xf8091321U, 0xf442c9d8U, 0xdefdcd0eU, 0x05fe0140U, 0x81c60ef4U, 0xcf271cceU, 0xd92ff6f6U,
+  0xf5ee00d8U, 0xf51c00f8U, 0xf80a002eU, 0xf5120050U, 0x860adfd7U, 0x1ef4e0e9U, 0x1101f810U, 0x39c22425U,
+  0xe80dfc00U, 0x050e2400U, 0x051c1100U, 0x080e0d00U, 0x00da070eU, 0x00040a05U, 0x000cdffcU, 0x0011c8e9U,
+  0xcd06d0efU, 0xfb220b04U, 0x1a060711U, 0x08020418U, 0x09dfe2f1U, 0xf021e009U, 0xfb23130eU, 0xe43122dfU,
+  0x114ac40dU, 0xf3e520f8U, 0xf2e11800U, 0xf89d38f5U, 0x0cbd03e0U, 0xe4f60804U, 0xfd1f080fU, 0x1915dc14U,
+  0xdae200edU, 0xfe190008U, 0xf7040021U, 0xce030006U, 0xbf1e0cbbU, 0x10fa00c9U, 0x20f9f207U, 0x39d30904U,
+  0xe0faeb00U, 0x13fe1c00U, 0x0c271a00U, 0x39211600U, 0x00e7f91eU, 0x002f0bdeU, 0x0025dde4U, 0x001bd4d1U,
+  0xaadae9e8U, 0x08371914U, 0x1515fa1fU, 0x112f1932U, 0x20ffe5e9U, 0xdffcc01fU, 0xed1dfb1cU, 0xbe3203c4U,
+  0x2559c823U, 0xd0db2a04U, 0xf9f70700U, 0xeabbffceU, 0x379dfee8U, 0xcfe700eeU, 0xf60f0f1aU, 0xf426e6edU,
+  0xf4ea00d7U, 0x11f80001U, 0xff140017U, 0x24f70004U, 0xdf2e1fbfU, 0x191e2de8U, 0x26fbef07U, 0x14ff2102U,
+  0xbbe0e600U, 0xf4e11000U, 0x193b3000U, 0xf91b0200U, 0x00fde711U, 0x001ef7e8U, 0x002d13dcU, 0x0025e9caU,
+  0x81e1f1b9U, 0xf71a1323U, 0x3123f931U, 0x051c012aU, 0x2232e2f3U, 0x1f09e9ecU, 0xfd100a11U, 0xa02df0d3U,
+  0x3355f560U, 0x0cff1fffU, 0x040200efU, 0xd4f01fc8U, 0x33a7f508U, 0xc2d60dffU, 0xd60b0b10U, 0xf0f40011U,
+  0x370000d6U, 0x15d800f0U, 0x09ef0005U, 0x45ce00f6U, 0xfb113c0eU, 0xef1415f3U, 0x230100dcU, 0x06ff4ee2U,
+  0xa1e7c900U, 0xf0f71000U, 0x3a1b1700U, 0xe507fa00U, 0x00f5b8daU, 0x0006e7ecU, 0x003417ddU, 0x000ee8d6U,
+  0xa5e4f796U, 0x0631f124U, 0x67341446U, 0x16251c1cU, 0x1e43f8fcU, 0xf919cdd6U, 0xe5f315ffU, 0xb01402e7U,
+  0x3e220358U, 0x15e11202U, 0xf81906d5U, 0xe716effaU, 0x29c5f932U, 0xc4b50215U, 0xd517fcd5U, 0xfbfcf601U,
+  0x4b1000d5U, 0x23ea00f9U, 0xe3f000fdU, 0x36f30009U, 0x00f10f0fU, 0x150dfe04U, 0x1229f0faU, 0xe8082403U,
+  0xdae2eb00U, 0xef252d00U, 0x1bfb2c00U, 0xfed7f900U, 0x00e4c5dbU, 0x0001fcfaU, 0x0021fde4U, 0x000bf5c7U,
+  0xcad9f295U, 0xf52b030fU, 0x7f341748U, 0x1a1a0b07U, 0x0d09fbf8U, 0xe813e109U, 0xd0001117U, 0xf6ec07e6U,
+  0x2ad0f71eU, 0xebeef508U, 0xfa6afb09U, 0xfe03eef1U, 0x29f4f927U, 0xbba7f2e7U, 0xc4320ed6U, 0xfa1f02faU,
+  0x3c300000U, 0x021700dfU, 0x29110002U, 0x00000000U, 0x18d702faU, 0x03f6fe19U, 0x1e10fc12U, 0x00000000U,
+  0x07fc1400U, 0xfdf3f900U, 0xff31df00U, 0x00000000U, 0x00241927U, 0x00da0cfeU, 0x00df28faU, 0x00000000U,
+  0xf9401f1bU, 0x04fafff3U, 0x081006eaU, 0x00000000U, 0x0bf73006U, 0xfee9e9fcU, 0xfbe3fb2aU, 0x00000000U,
+  0xf91a0cf7U, 0xf803ffe2U, 0xdc3910e4U, 0x00000000U, 0x132af81eU, 0xfd000700U, 0x08ee1c04U, 0x00000000U,
+  0x110100e9U, 0x01f500feU, 0x0fe90002U, 0x00000000U, 0x1ad504f0U, 0x0f090122U, 0x1cfbfc0eU, 0x00000000U,
+  0x0efefb00U, 0x070af100U, 0xf72bd700U, 0x00000000U, 0x000d1c24U, 0x00e72a02U, 0x00f02b22U, 0x00000000U,
+  0x102c1231U, 0xef0200eeU, 0x0a10f2f3U, 0x00000000U, 0x26dc27f7U, 0x02fbef12U, 0x09eb0103U, 0x00000000U,
+  0x241517dfU, 0x04130403U, 0xfb1407edU, 0x00000000U, 0xfc18e129U, 0xe5fc0406U, 0x1bbf0dffU, 0x00000000U,
+  0x281700e6U, 0xed0b00f6U, 0x18ed001aU, 0x00000000U, 0x17dd04fbU, 0x1ced0721U, 0x1ce4e8f5U, 0x00000000U,
+  0xfef1e500U, 0xfc12d800U, 0x043eea00U, 0x00000000U, 0x00f50bf5U, 0x00e82902U, 0x00ee352eU, 0x00000000U,
+  0xfd210d1bU, 0xe9fee6f8U, 0x220a200eU, 0x00000000U, 0x18ea1b0eU, 0xf720fb13U, 0x12e60cfcU, 0x00000000U,
+  0x0c0c18f6U, 0x1109fc0cU, 0x17320bf1U, 0x00000000U, 0xd732f41dU, 0xdfe40d12U, 0x3bdd1309U, 0x00000000U,
+  0x163100efU, 0xfa0a00f2U, 0x38ee00f6U, 0x00000000U, 0x22f0fa0dU, 0x261e1122U, 0x2fd8f414U, 0x00000000U,
+  0xfaf1ef00U, 0xdc330700U, 0xdc4b0400U, 0x00000000U, 0x00e8fbe1U, 0x00fb2afbU, 0x00fe2333U, 0x00000000U,
+  0xe00bec29U, 0xf5ffd6f3U, 0x171c15f5U, 0x00000000U, 0x0ef20b21U, 0x1a17ea15U, 0x060200fcU, 0x00000000U,
+  0xed0ef4e6U, 0xf80f0318U, 0x17211615U, 0x00000000U, 0xe321f71eU, 0xe6dd0408U, 0x19d90c08U, 0x00000000U,
+  0x042b00e9U, 0xfa0400f2U, 0x3bf400fbU, 0x00000000U, 0x0c010201U, 0x110d0e1fU, 0x2af90d06U, 0x00000000U,
+  0x060ae200U, 0x0d26f700U, 0xd8150d00U, 0x00000000U, 0x000403f6U, 0x000710e5U, 0x00010e3bU, 0x00000000U,
+  0x1204d8f7U, 0x0a0ff108U, 0x1c341cf4U, 0x00000000U, 0x13ee0106U, 0x0f26fefbU, 0x1b1c170bU, 0x00000000U,
+  0xf6f0dee5U, 0x04f00b08U, 0x0a101426U, 0x00000000U, 0xf9111008U, 0x0df306f8U, 0xf3fcf601U, 0x00000000U,
+  0x41330001U, 0x0dff00d0U, 0x14dd0002U, 0x00000000U, 0x3ff61309U, 0x12e8fe01U, 0x14210df4U, 0x00000000U,
+  0xf63f0200U, 0x090ad900U, 0x10fdef00U, 0x00000000U, 0x00ca3408U, 0x00d122ecU, 0x00f3240bU, 0x00000000U,
+  0x1045f603U, 0xf6f6f60aU, 0x13fe15f5U, 0x00000000U, 0x07f2f20bU, 0xfce4f30cU, 0xfedd1f07U, 0x00000000U,
+  0xe31937d2U, 0xe2ec00c7U, 0xdbfef7e5U, 0x00000000U, 0x0739eb1cU, 0xdb0e010fU, 0x2ff40cf4U, 0x00000000U,
+  0x2d4000cbU, 0xfde200e3U, 0x37dc00ffU, 0x00000000U, 0x32eb1403U, 0x05dd0517U, 0xf90ceceeU, 0x00000000U,
+  0x1013eb00U, 0x1815e100U, 0x01e6f500U, 0x00000000U, 0x00d73001U, 0x00f62be9U, 0x00ed33fdU, 0x00000000U,
+  0x0718e3f8U, 0xfaf70618U, 0x2bf41cc7U, 0x00000000U, 0x0ac40900U, 0x1cff02fbU, 0xfff60907U, 0x00000000U,
+  0x01172aecU, 0xf9eb20d7U, 0xfff9ebe8U, 0x00000000U, 0xe31ac810U, 0xf0f9ea23U, 0x33d836d7U, 0x00000000U,
+  0x262f00e7U, 0x040300fbU, 0x44d8000cU, 0x00000000U, 0x05e418d1U, 0x0afa0a2aU, 0xece9e3f2U, 0x00000000U,
+  0x1302ef00U, 0x0908e600U, 0x1afef400U, 0x00000000U, 0x00de38f9U, 0x00f72a00U, 0x00083820U, 0x00000000U,
+  0xe314f228U, 0xddf3022cU, 0x1ef403c9U, 0x00000000U, 0x06d709fcU, 0x141b0631U, 0xcc0308eeU, 0x00000000U,
+  0xf615e8e9U, 0x061100e3U, 0x24f8e4d8U, 0x00000000U, 0xde23d21cU, 0xf4ec031aU, 0x2bf01fdfU, 0x00000000U,
+  0x0e2c00e7U, 0x03ff0002U, 0x35d200d3U, 0x00000000U, 0xf0e619e0U, 0x1c150119U, 0xfcf404f4U, 0x00000000U,
+  0xdb0a0800U, 0xee280300U, 0x1026e800U, 0x00000000U, 0x00f414ffU, 0x00081504U, 0x00043c21U, 0x00000000U,
+  0xc4ffd129U, 0xe8e10110U, 0x0a21dedfU, 0x00000000U, 0x0de0fb06U, 0x1320f50fU, 0xdd0d0ffbU, 0x00000000U,
+  0xf21beaefU, 0x1706fd11U, 0x29f906f2U, 0x00000000U, 0xfa01d13aU, 0x07e0fc0bU, 0xfc12e7fbU, 0x00000000U,
+  0xe63100d6U, 0x0be400f1U, 0x1bef00b6U, 0x00000000U, 0xfeedf9f9U, 0x101d1737U, 0x34121de0U, 0x00000000U,
+  0x0ef91000U, 0xe72e0600U, 0xf21c0a00U, 0x00000000U, 0x0014f026U, 0x00070efbU, 0x00ba1ae5U, 0x00000000U,
+  0xbdeb1f15U, 0x09ea0702U, 0x2729d6d2U, 0x00000000U, 0x30f0f604U, 0x1a28f501U, 0xf01406feU, 0x00000000U,
+  0xfd20e213U, 0x0ae6132eU, 0x0e27ff0eU, 0x00000000U, 0xf8f6fe11U, 0x06c912fcU, 0x000be5fbU, 0x00000000U,
+  0x26210003U, 0x1ff500e0U, 0x33d000f3U, 0x00000000U, 0x2d060f03U, 0x21f302f9U, 0xe42c1de8U, 0x00000000U,
+  0xe006fb00U, 0x121ccd00U, 0x14f1ea00U, 0x00000000U, 0x00b24911U, 0x00f451dfU, 0x00fd0022U, 0x00000000U,
+  0x0437eb05U, 0xfbf7f93cU, 0x1cdd1cddU, 0x00000000U, 0x02e1fefdU, 0xf2ecd30eU, 0x06cc4f11U, 0x00000000U,
+  0xd73f37d9U, 0xd2e717b6U, 0xea16cae2U, 0x00000000U, 0xd215ff31U, 0xa5f53423U, 0x2601ecddU, 0x00000000U,
+  0x182300e3U, 0xfc0000deU, 0x7fcc0001U, 0x00000000U, 0x00de07ddU, 0x24e2fdf5U, 0xe01bf11eU, 0x00000000U,
+  0xd7f1ea00U, 0x132cf300U, 0xf808f500U, 0x00000000U, 0x00c21116U, 0x000332e6U, 0x001623ebU, 0x00000000U,
+  0x0020d5dfU, 0xeaf0d92bU, 0x32c163d0U, 0x00000000U, 0x04fef1f3U, 0x010ec305U, 0xf9d3381eU, 0x00000000U,
+  0xed2201faU, 0xd0d728a5U, 0xf406d7f2U, 0x00000000U, 0xcf1af31dU, 0xe50a1d24U, 0x47fa1adaU, 0x00000000U,
+  0x110100cdU, 0xf7f40008U, 0x44100029U, 0x00000000U, 0xfa040fa8U, 0x12ee0407U, 0xe504f3e6U, 0x00000000U,
+  0xdfece100U, 0x02320700U, 0xeef6ef00U, 0x00000000U, 0x00ec4517U, 0x000235f4U, 0x001b2519U, 0x00000000U,
+  0x0b0cddf5U, 0xd9f3ef0cU, 0x17ce3cd5U, 0x00000000U, 0xeef2ec04U, 0x3321de0eU, 0xd201292fU, 0x00000000U,
+  0xf616f900U, 0xf805f7ebU, 0x08e60bcfU, 0x00000000U, 0xe122eb09U, 0xf1eff10dU, 0x42f819e5U, 0x00000000U,
+  0xec0d00faU, 0xf7ec0007U, 0xfb1c00f4U, 0x00000000U, 0xe4ea23daU, 0x0b0327efU, 0x0f1008f3U, 0x00000000U,
+  0xe8f40700U, 0xf5180500U, 0xdef80500U, 0x00000000U, 0x000c252bU, 0x00161e30U, 0x000cf2f0U, 0x00000000U,
+  0xddeee424U, 0xeaf01611U, 0x060109aeU, 0x00000000U, 0xf3f1e514U, 0x220606f3U, 0xe017f90fU, 0x00000000U,
+  0x292dd939U, 0x2808c92cU, 0x0b171cc0U, 0x00000000U, 0xf0e7ef0bU, 0xfcf611fcU, 0x1d15f2f6U, 0x00000000U,
+  0xdded00eeU, 0x14cc00fcU, 0xff2000f1U, 0x00000000U, 0xe6f812eaU, 0x140e0024U, 0x491107e7U, 0x00000000U,
+  0xf5e82f00U, 0xdc211700U, 0xd6010100U, 0x00000000U, 0x00f2fa39U, 0x00061c3eU, 0x00edfcdaU, 0x00000000U,
+  0xdcce1224U, 0x03fb17feU, 0x03151fa1U, 0x00000000U, 0x15fcfa1fU, 0x3d1de715U, 0xcf01efe5U, 0x00000000U,
+  0x317fd71dU, 0x23ece529U, 0x04f00cdcU, 0x00000000U, 0xd0e7e5eeU, 0x17d216ebU, 0x2c090ae0U, 0x00000000U,
+  0x280700e9U, 0x34e400f5U, 0x0dd200ebU, 0x00000000U, 0x1f17edd6U, 0x2a14da01U, 0xfb0029eeU, 0x00000000U,
+  0xef35ec00U, 0xfc18db00U, 0x160eed00U, 0x00000000U, 0x00cf590bU, 0x001442f7U, 0x0005ea18U, 0x00000000U,
+  0xf009ef0aU, 0x20f11e3dU, 0x1fe4e5fcU, 0x00000000U, 0x1fdfc21eU, 0xf4d3bd1aU, 0x02c455ddU, 0x00000000U,
+  0xc740eed1U, 0xd7e31ec1U, 0x16f0cdeaU, 0x00000000U, 0xcdf31f15U, 0xabe7531aU, 0x0841d905U, 0x00000000U,
+  0x04ea00ddU, 0x1ff800c6U, 0x60df00eeU, 0x00000000U, 0x040becddU, 0x1d0802feU, 0xf0f9062cU, 0x00000000U,
+  0xe512e800U, 0x0205da00U, 0x0420eb00U, 0x00000000U, 0x0000400dU, 0x002d31dbU, 0x00f412f0U, 0x00000000U,
+  0xc1fbff26U, 0x25ffef45U, 0x2ee20d05U, 0x00000000U, 0x2bead22aU, 0xe8f9a237U, 0xecdc55eaU, 0x00000000U,
+  0xcb2af5e3U, 0xcecd29b8U, 0x0a0fac20U, 0x00000000U, 0xd6014c36U, 0xd4e55f47U, 0xda3ae4f4U, 0x00000000U,
+  0x18bf00daU, 0xf71d00e6U, 0x3de20024U, 0x00000000U, 0xe9f4dcb1U, 0x1c1507efU, 0xb9e0eb2dU, 0x00000000U,
+  0xf3e50b00U, 0xc414ff00U, 0x0dfe2100U, 0x00000000U, 0x00fa491cU, 0x000352f0U, 0x00ff0405U, 0x00000000U,
+  0xd6e01600U, 0xff11eb06U, 0x2cdf1c2fU, 0x00000000U, 0x26d7f327U, 0x0013dd44U, 0xcae93d00U, 0x00000000U,
+  0xfc33d336U, 0x080909f1U, 0xea11d3e4U, 0x00000000U, 0xcfd93805U, 0xf4de422dU, 0x1005dcd1U, 0x00000000U,
+  0x06c500f7U, 0xea160010U, 0xf5f40020U, 0x00000000U, 0xe0c0e7c4U, 0x1418fdedU, 0xb701f72fU, 0x00000000U,
+  0xf10e1700U, 0xd1271800U, 0x13f43500U, 0x00000000U, 0x00040813U, 0x000f402aU, 0x00fdef21U, 0x00000000U,
+  0xc2d60a14U, 0x1b14190bU, 0x14d52622U, 0x00000000U, 0x29dbdd26U, 0x2f1ae400U, 0xe0f14af1U, 0x00000000U,
+  0x2d1fdb40U, 0x461ae523U, 0xe821e1d0U, 0x00000000U, 0xdfe11de3U, 0xfcde1004U, 0x2a1aeecbU, 0x00000000U,
+  0xe0b70012U, 0xe00100f4U, 0xb8200045U, 0x00000000U, 0xc90b04e6U, 0x130ae825U, 0xf8ffe802U, 0x00000000U,
+  0xe8133300U, 0xc0191700U, 0x40e21800U, 0x00000000U, 0x00e7e32fU, 0x000df374U, 0x00f6f440U, 0x00000000U,
+  0x06e7112eU, 0xdffd0f07U, 0xf6d63c2fU, 0x00000000U, 0xeafbe930U, 0x3928d61cU, 0xdee34aeeU, 0x00000000U,
+  0x2f79d717U, 0x2d0a0426U, 0xf30fede0U, 0x00000000U, 0xb8fefae1U, 0x10a31000U, 0x3e1bffdeU, 0x00000000U,
+  0xfbd800b9U, 0x12e600cfU, 0xceed0022U, 0x00000000U, 0x9c1cd0e6U, 0x2af7d7e9U, 0x2e0612f5U, 0x00000000U,
+  0xfa28e900U, 0xf44afc00U, 0x0a06f300U, 0x00000000U, 0x00f630e0U, 0x001e1aeaU, 0x00ffdef5U, 0x00000000U,
+  0xfedcecfbU, 0xe20027f8U, 0x1307fb14U, 0x00000000U, 0x09d2d634U, 0x02d1bc0aU, 0x01f72ffbU, 0x00000000U,
+  0xd21edef0U, 0xcde6f0deU, 0x02fc1202U, 0x00000000U, 0xd3c90902U, 0xcdb12008U, 0x0a16fc1cU, 0x00000000U,
+  0x30cc00dbU, 0x370500eeU, 0xe2ef00feU, 0x00000000U, 0xa813caf8U, 0x1326f414U, 0x3709dd25U, 0x00000000U,
+  0xf029f400U, 0x0541ed00U, 0x2e1ff700U, 0x00000000U, 0x00e949e0U, 0x00326bb9U, 0x00f7d9f9U, 0x00000000U,
+  0xe6e8cc0eU, 0x7f1e0606U, 0x3718e916U, 0x00000000U, 0x3808e148U, 0xeabbc143U, 0x0be95dd7U, 0x00000000U,
+  0xef46d611U, 0xc2f027d5U, 0x3128d31bU, 0x00000000U, 0xcfe82c14U, 0xfaf960e8U, 0xe241ef0aU, 0x00000000U,
+  0xf3c900e0U, 0x291700feU, 0x41d80012U, 0x00000000U, 0xb8ecd8d7U, 0x0b491ceeU, 0x01ecd145U, 0x00000000U,
+  0x024a2500U, 0xe816fb00U, 0x4b122200U, 0x00000000U, 0x00071cdfU, 0x001775dbU, 0x00fe03ffU, 0x00000000U,
+  0xbb06ea0eU, 0x5c1a0831U, 0x160cf953U, 0x00000000U, 0x43f8f745U, 0xf3ffa74bU, 0xffe25dedU, 0x00000000U,
+  0x2e4ace1fU, 0xea2a060cU, 0x090ea6e7U, 0x00000000U, 0xd2221cf2U, 0xd9ca50ecU, 0xb739eff8U, 0x00000000U,
+  0x05ab000eU, 0xd8fa00f8U, 0x1aee003dU, 0x00000000U, 0xc6e2f9caU, 0xd55f12f0U, 0xc4dee011U, 0x00000000U,
+  0xd7492700U, 0x99124600U, 0x50455a00U, 0x00000000U, 0x000a11bcU, 0x00162009U, 0x00ff2d1cU, 0x00000000U,
+  0xdb22ff05U, 0x202e0ef5U, 0x1004017aU, 0x00000000U, 0x0709fa27U, 0x244daf1fU, 0xebe8520eU, 0x00000000U,
+  0x3c22d319U, 0x392f0244U, 0xe113a4ddU, 0x00000000U, 0xe5edff0cU, 0xdf9a25eaU, 0xf655f8c9U, 0x00000000U,
+  0x2fc20000U, 0xe5dc0024U, 0xd6fe0039U, 0x00000000U, 0xee1af8fbU, 0xc601ff0dU, 0xcdfaf211U, 0x00000000U,
+  0xef394200U, 0xb7205e00U, 0x42242900U, 0x00000000U, 0x00ff14e1U, 0x0006f442U, 0x00f3273fU, 0x00000000U,
+  0x2d3bff1bU, 0x0b1c0301U, 0x3bea1147U, 0x00000000U, 0xe20afd32U, 0x4930d018U, 0xfff92c17U, 0x00000000U,
+  0x1841e32cU, 0x0a231330U, 0xdf3df8f2U, 0x00000000U, 0xc2e207eaU, 0xf1870c0dU, 0xf3560ac4U, 0x00000000U,
+  0x110100fbU, 0x00000000U, 0x21f700f1U, 0x191500edU, 0x09d2030aU, 0x00000000U, 0x2efbf505U, 0xfaf70904U,
+  0xfb1aea00U, 0x00000000U, 0x0af8ee00U, 0x00092300U, 0x00f4d9ddU, 0x00000000U, 0x00cf4c3dU, 0x00fddceeU,
+  0x0b0cde0fU, 0x00000000U, 0x001417a1U, 0x0610e11aU, 0xfa0d0df4U, 0x00000000U, 0x0ef0f919U, 0xff2ef1f0U,
+  0xf1f418f6U, 0x00000000U, 0x1734f3f6U, 0xfde22b14U, 0x0bfffd08U, 0x00000000U, 0x01e4e805U, 0x0c03fe08U,
+  0x0ffc00e8U, 0x00000000U, 0x03dd0029U, 0x183f00daU, 0x14e806eeU, 0x00000000U, 0x3be8d118U, 0x07ea0e00U,
+  0xe413c800U, 0x00000000U, 0x18d2fa00U, 0xe41e1700U, 0x0006f1cdU, 0x00000000U, 0x00e03571U, 0x00fef0cfU,
+  0xee17c9f4U, 0x00000000U, 0x0fd913ffU, 0xf924dc19U, 0xcd180beaU, 0x00000000U, 0x3cd31427U, 0xcb3cf6e5U,
+  0xf3ac18dbU, 0x00000000U, 0x3a52dcd3U, 0x00c6280cU, 0x1cfaf80dU, 0x00000000U, 0x03f3f3efU, 0xfb131412U,
+  0x21f900efU, 0x00000000U, 0xddce0056U, 0x4c4700d9U, 0x12db02fbU, 0x00000000U, 0x01f2ba0eU, 0x21012af6U,
+  0xd6faa100U, 0x00000000U, 0x06e55800U, 0xcd2e0500U, 0x0013fbe4U, 0x00000000U, 0x00003331U, 0x00fcfcb1U,
+  0xc227f3f8U, 0x00000000U, 0x24c11543U, 0x0737d50fU, 0xcc100ff9U, 0x00000000U, 0x46db0124U, 0xc44cf4edU,
+  0x05a618dcU, 0x00000000U, 0xf864cfebU, 0x0d933df9U, 0x2bf31525U, 0x00000000U, 0xc9d4e7e9U, 0xf1030013U,
+  0xe2f40011U, 0x00000000U, 0xecf2001cU, 0x3d3900edU, 0x19b00df2U, 0x00000000U, 0xd317dd0aU, 0x3de711e5U,
+  0xfee99400U, 0x00000000U, 0x0ae87300U, 0xd01d0600U, 0x000b0320U, 0x00000000U, 0x00021b1fU, 0x0018058fU,
+  0xac30e8f6U, 0x00000000U, 0x15c7312bU, 0xec44c003U, 0xd6fb32f5U, 0x00000000U, 0x5403e71eU, 0xa335f5e8U,
+  0x07980ce3U, 0x00000000U, 0xe67fc41fU, 0x2c813902U, 0x2fec1026U, 0x00000000U, 0xbcc9f5edU, 0x0f091c26U,
+  0xceeb0019U, 0x00000000U, 0xe10400cfU, 0x4b2400fcU, 0x35ab0ef6U, 0x00000000U, 0xb122f3feU, 0x1fd60d01U,
+  0x02b99300U, 0x00000000U, 0xf2fd4600U, 0xf5fbef00U, 0x0023f007U, 0x00000000U, 0x00db0423U, 0x000f0ba6U,
+  0x9e33f3ebU, 0x00000000U, 0x21bb0338U, 0xe23fccedU, 0xfc100cfaU, 0x00000000U, 0x27fef409U, 0xe30d07eeU,
+  0xf7bf0ee0U, 0x00000000U, 0xe563c303U, 0x1784280fU, 0x1be2e90bU, 0x00000000U, 0xf6071defU, 0x23030a11U,
+  0x04fb001eU, 0x00000000U, 0x2dfb00fcU, 0x083e00f7U, 0x0de115e4U, 0x00000000U, 0x0f03ecf7U, 0x030212ffU,
+  0x0114ed00U, 0x00000000U, 0x07f1f700U, 0xf9071c00U, 0x0003ffd1U, 0x00000000U, 0x00d72526U, 0x00e1f0e2U,
+  0xe4fee326U, 0x00000000U, 0xf51d09d6U, 0xfe21f60bU, 0xe323f0eeU, 0x00000000U, 0x19d5f33eU, 0xf739f6f6U,
+  0xebdd0ad8U, 0x00000000U, 0xf32ddfe5U, 0xf0e520e9U, 0x132c3311U, 0x00000000U, 0xfed609eaU, 0x1713f90fU,
+  0x1cf80027U, 0x00000000U, 0xfbc1000fU, 0x1c2d00d1U, 0x11e0ec11U, 0x00000000U, 0x0f1ce02aU, 0x25eaf8e9U,
+  0xe80ed300U, 0x00000000U, 0x1c1c1000U, 0xda230200U, 0x000f08dbU, 0x00000000U, 0x00d33717U, 0x00f60701U,
+  0xe80c00f0U, 0x00000000U, 0x19e01efcU, 0xdd2eeb1bU, 0xc62117faU, 0x00000000U, 0x23c52c34U, 0xde54f2f9U,
+  0xe3b501f0U, 0x00000000U, 0xf63bcc1aU, 0xeedf2be8U, 0x19091515U, 0x00000000U, 0xf0d7dfc8U, 0x090f013aU,
+  0x14160017U, 0x00000000U, 0xe2c5000fU, 0x371400f7U, 0x04c7d6fdU, 0x00000000U, 0x0a0ae11aU, 0x2802fce8U,
+  0xfaebde00U, 0x00000000U, 0xeb115900U, 0xe70efc00U, 0x002b0a1dU, 0x00000000U, 0x00ca59e3U, 0x00f6f614U,
+  0xdcfbf9f1U, 0x00000000U, 0x06dc093bU, 0xda16ccfaU, 0xba1afefcU, 0x00000000U, 0x0507331eU, 0xe42efbfeU,
+  0x04eefbecU, 0x00000000U, 0xe71dae31U, 0x0de83003U, 0xf804e904U, 0x00000000U, 0xe2bfece8U, 0xfd100d39U,
+  0xe71e000cU, 0x00000000U, 0x05e20042U, 0x312c00f2U, 0xf9b4f700U, 0x00000000U, 0xed37edfaU, 0x251a0de6U,
+  0x1202ef00U, 0x00000000U, 0xbdfa5b00U, 0xf00d0200U, 0x003c034fU, 0x00000000U, 0x000744f0U, 0x0009f2e0U,
+  0xb60f0401U, 0x00000000U, 0x0e071d08U, 0xf825d9ebU, 0xd3131bf7U, 0x00000000U, 0x201ee515U, 0xe613efe2U,
+  0xfdf0ece0U, 0x00000000U, 0xf80fad13U, 0x21ee250eU, 0xf904f007U, 0x00000000U, 0xdbb4fa10U, 0xf8050548U,
+  0x9a140030U, 0x00000000U, 0x350e000dU, 0x363a0007U, 0x33ac04fdU, 0x00000000U, 0xba3c060cU, 0x18e011f4U,
+  0x010be800U, 0x00000000U, 0xd5d8dc00U, 0xf4f6f600U, 0x0028fe3bU, 0x00000000U, 0x00e4effcU, 0x002cf1daU,
+  0x810c2722U, 0x00000000U, 0x04df0324U, 0xdd32f6f8U, 0x082e2202U, 0x00000000U, 0xf4f6fe02U, 0xe510ebe5U,
+  0xf6e4e7e3U, 0x00000000U, 0xf301b2fbU, 0x16c7053bU, 0x26e81200U, 0x00000000U, 0xe3e12039U, 0xfc04031fU,
+  0x13f70019U, 0x00000000U, 0x28d60018U, 0x151d00f5U, 0x1405e8e4U, 0x00000000U, 0x0018f9f3U, 0xf21104eaU,
+  0x0dfff500U, 0x00000000U, 0x1004e000U, 0xec0b0800U, 0x00fc38f8U, 0x00000000U, 0x00fc32ffU, 0x00e616e9U,
+  0xe6e32329U, 0x00000000U, 0xee1942f2U, 0x1027da00U, 0xc719fb01U, 0x00000000U, 0x24b51259U, 0xd82ae5f0U,
+  0xf3f31fe2U, 0x00000000U, 0xc9f7d6c9U, 0xe6ea11f6U, 0x08f04619U, 0x00000000U, 0xafd52f02U, 0x082cfb2bU,
+  0x12f10026U, 0x00000000U, 0x07cf000bU, 0x25fc00dfU, 0x00f3e214U, 0x00000000U, 0xfd17f522U, 0xd9efffdfU,
+  0xef1d0500U, 0x00000000U, 0x1f0cf700U, 0xe50ae400U, 0x00f1183aU, 0x00000000U, 0x00ff3fe6U, 0x00edf8faU,
+  0xf5f40a0fU, 0x00000000U, 0x120b3be8U, 0xfc1ce6fdU, 0x9a020607U, 0x00000000U, 0x3fdd244aU, 0xd633f60eU,
+  0x0614ecedU, 0x00000000U, 0xf3e3e916U, 0xe5fa07f7U, 0x0df13df9U, 0x00000000U, 0xbfd131dbU, 0xfa0c0d22U,
+  0x27d60023U, 0x00000000U, 0x25cb00f7U, 0x1c050000U, 0x02d604ddU, 0x00000000U, 0x0f0bfc15U, 0xe9dcf3edU,
+  0xe71c2600U, 0x00000000U, 0x0d071900U, 0x03ffe300U, 0x00242928U, 0x00000000U, 0x001a4be5U, 0x00edf013U,
+  0xf8f5f820U, 0x00000000U, 0x1ef92a0eU, 0x0804feecU, 0xb10f030dU, 0x00000000U, 0x3114f310U, 0xfe180f12U,
+  0xf42dcde2U, 0x00000000U, 0xf6edb935U, 0x19011b0eU, 0x08ecec01U, 0x00000000U, 0xcec222dcU, 0xef0d1e28U,
+  0xfee70015U, 0x00000000U, 0x1a000025U, 0x03260011U, 0x1bc21608U, 0x00000000U, 0x02190603U, 0xe5ff0befU,
+  0x0f002800U, 0x00000000U, 0xb40a3700U, 0xfbefd400U, 0x002d1229U, 0x00000000U, 0x00062ce5U, 0x000ef50aU,
+  0xfcfe0602U, 0x00000000U, 0x17090a1aU, 0x13fc08e1U, 0xdf181e22U, 0x00000000U, 0xf20be436U, 0x09fd0c08U,
+  0xff0bc6edU, 0x00000000U, 0x0115b717U, 0x1e1311ffU, 0xebe0dfe4U, 0x00000000U, 0xe3cd15edU, 0xeb0fff31U,
+  0xdcf100fdU, 0x00000000U, 0x501c000aU, 0x1a350017U, 0x5bd6040bU, 0x00000000U, 0xdc18061dU, 0xefe91704U,
+  0xf6291a00U, 0x00000000U, 0xe3fef300U, 0xf2f4d300U, 0x001cf02cU, 0x00000000U, 0x00fbf4dfU, 0x002cf8feU,
+  0xd1e50012U, 0x00000000U, 0xf8ede014U, 0xd1012309U, 0x10361128U, 0x00000000U, 0x15eaef0cU, 0xfb0210f2U,
+  0x0d20c4ecU, 0x00000000U, 0x030ab605U, 0x1e00051bU, 0x17ccec07U, 0x00000000U, 0x02fc2f1dU, 0xf71ced17U,
+  0x23ee0004U, 0x00000000U, 0x24870010U, 0x0a1000efU, 0xf814d7f4U, 0x00000000U, 0xeb2e03e3U, 0xccff00e7U,
+  0x01f0f400U, 0x00000000U, 0x26dfc600U, 0xe6020200U, 0x000b1f01U, 0x00000000U, 0x003718eaU, 0x00f12a02U,
+  0x0ced4418U, 0x00000000U, 0x05f77119U, 0x0320e5fbU, 0xe7e7012eU, 0x00000000U, 0x00af181bU, 0xf20edf02U,
+  0xf11c07daU, 0x00000000U, 0xc6ded9e6U, 0xfb041608U, 0xfdf23513U, 0x00000000U, 0xe1ca3de7U, 0x02f0070cU,
+  0x27f7000fU, 0x00000000U, 0x1faf00eeU, 0xf71000f8U, 0xf2f1ddfbU, 0x00000000U, 0xfd1a0cf7U, 0xda0211ecU,
+  0x01ca0e00U, 0x00000000U, 0x1607cf00U, 0xdc0ff800U, 0x00082017U, 0x00000000U, 0x00333ed4U, 0x0003090cU,
+  0x22e24b1eU, 0x00000000U, 0x15f63f08U, 0x1813fcf9U, 0xe2ff0e0fU, 0x00000000U, 0x2db03d3fU, 0xed07ecfeU,
+  0x0e22ffdeU, 0x00000000U, 0x07d7d309U, 0x0a131f14U, 0x1ce92c12U, 0x00000000U, 0xece040edU, 0x08091510U,
+  0x23fc0006U, 0x00000000U, 0x18f40022U, 0x101b0006U, 0xed03efd3U, 0x00000000U, 0xebf717feU, 0xecfd0eebU,
+  0x00cc3500U, 0x00000000U, 0xd90fea00U, 0xec01ea00U, 0x0014040fU, 0x00000000U, 0x002c35d6U, 0x000e071bU,
+  0x3d102533U, 0x00000000U, 0x1dfe300cU, 0x12090bf3U, 0xd20c0610U, 0x00000000U, 0x14fb093cU, 0xf6f9000bU,
+  0x122212dcU, 0x00000000U, 0x1b01dc23U, 0x1b161914U, 0x09ec1815U, 0x00000000U, 0xd6c22de0U, 0xf9f81b10U,
+  0x0c050013U, 0x00000000U, 0x2116000cU, 0xfb0f0010U, 0xd9f80709U, 0x00000000U, 0x15110f16U, 0xfc0036fbU,
+  0x28d13f00U, 0x00000000U, 0xa826f400U, 0xe8e1ef00U, 0x00feeeffU, 0x00000000U, 0x002300c8U, 0x0011e420U,
+  0x191e0d07U, 0x00000000U, 0x13031701U, 0x27f40bf5U, 0xef161212U, 0x00000000U, 0xf30df039U, 0xeff71901U,
+  0x0f2f05e5U, 0x00000000U, 0x0a1d031eU, 0x1f0112f5U, 0xee0809eaU, 0x00000000U, 0xf7e5fc0eU, 0x0d1016f8U,
+  0xf42100f5U, 0x00000000U, 0x01450004U, 0xf2f1001eU, 0x10f4f51cU, 0x00000000U, 0x04fcf718U, 0xe31b401aU,
+  0x03f63200U, 0x00000000U, 0xced5de00U, 0xf1eedd00U, 0x00fefbccU, 0x00000000U, 0x001af2d1U, 0x0002f30cU,
+  0x0efbfcf2U, 0x00000000U, 0xe60401f3U, 0x04da1103U, 0x0f39f6feU, 0x00000000U, 0xf9fad9fdU, 0xf7fe1804U,
+  0x222009f7U, 0x00000000U, 0x16e712fdU, 0x1e09f118U, 0xf0fbfef6U, 0x00000000U, 0x24ef071fU, 0x112c0e21U,
+  0x16f100d5U, 0x00000000U, 0xf7bc0011U, 0x230700e8U, 0xfa14ee0dU, 0x00000000U, 0xb1011003U, 0xb910f7e6U,
+  0x14defd00U, 0x00000000U, 0x02aae800U, 0xfa070700U, 0x00111515U, 0x00000000U, 0x006409f8U, 0x00090a13U,
+  0x1cfe2017U, 0x00000000U, 0x0c043429U, 0xfb10fefbU, 0xfffb2621U, 0x00000000U, 0xf3d7f301U, 0x0cf3d4f3U,
+  0x020afa0aU, 0x00000000U, 0xf7fef824U, 0x001dfe04U, 0xd80105f3U, 0x00000000U, 0xefb72befU, 0x0ad700fbU,
+  0x24ec0003U, 0x00000000U, 0x02a600f5U, 0xfc1a00f6U, 0xe8fafb04U, 0x00000000U, 0xcf050b24U, 0xb019fbe4U,
+  0xf6dc3000U, 0x00000000U, 0xf8ded600U, 0xe1120c00U, 0x000ae704U, 0x00000000U, 0x00471beeU, 0x000c1c1aU,
+  0x11f0210dU, 0x00000000U, 0x2515202aU, 0xf5e5f6e6U, 0x0bef480cU, 0x00000000U, 0x05fc092cU, 0x1ce7d6efU,
+  0x0111f9feU, 0x00000000U, 0x1205ec1eU, 0xef232f0dU, 0xfdf2e9f9U, 0x00000000U, 0x03c929f7U, 0x16ef11ecU,
+  0x05ee0003U, 0x00000000U, 0xe5da0025U, 0xee2700f7U, 0xf8e41805U, 0x00000000U, 0xe6072afeU, 0xe90e0df2U,
+  0x18e64000U, 0x00000000U, 0xb0f40a00U, 0xd7fdfd00U, 0x0004e2dcU, 0x00000000U, 0x0021e4e8U, 0x00021555U,
+  0x10f6e4fbU, 0x00000000U, 0xfcf72512U, 0xddee0df5U, 0xf4fd48fcU, 0x00000000U, 0xe23607fdU, 0x0ef1f804U,
+  0x11f7fefcU, 0x00000000U, 0x2efb002bU, 0xf915361aU, 0xef15d6deU, 0x00000000U, 0x21c42506U, 0x38fa12f7U,
+  0x0bf700e2U, 0x00000000U, 0xf715002eU, 0xfe2000fcU, 0x02fd0f11U, 0x00000000U, 0x19090f25U, 0x10172a19U,
+  0x4cd30c00U, 0x00000000U, 0xb8ff0500U, 0xd5e4ed00U, 0x0015fbdcU, 0x00000000U, 0x0007cd1eU, 0x0019f54eU,
+  0xf9feebd3U, 0x00000000U, 0xd5161edaU, 0xeff40cecU, 0x0b0c3cf6U, 0x00000000U, 0xe32cf5fdU, 0x01020b06U,
+  0x13ff1effU, 0x00000000U, 0x2aea0026U, 0x0bee1b1cU, 0xc94309d0U, 0x00000000U, 0x38e3f73bU, 0x16fd1903U,
+  0x13fb00f3U, 0x00000000U, 0xdd3c0043U, 0xeffd00fdU, 0xf00b0e0eU, 0x00000000U, 0x030a08fdU, 0xf2093230U,
+  0x17e8f600U, 0x00000000U, 0xc8f8f000U, 0x01edef00U, 0x000ceee2U, 0x00000000U, 0x000dd90bU, 0x0008eb1cU,
+  0x06060ee0U, 0x00000000U, 0xbe29fcccU, 0x1408fef4U, 0xf20c0cfeU, 0x00000000U, 0xf219e50bU, 0x00fb161cU,
+  0x1ae71a0aU, 0x00000000U, 0xf8e31902U, 0x04faf117U, 0xb70c00eeU, 0x00000000U, 0x12f3f51aU, 0xfe21fbfeU,
+  0xeb0300f7U, 0x460300dbU, 0xd6eb00f8U, 0x08fa00ceU, 0xf4f9fdf5U, 0x29f9031dU, 0xfbfe01ebU, 0x0ae7ff0aU,
+  0xf9eb1800U, 0xfb17df00U, 0x000f0200U, 0xfcd9eb00U, 0x0005e2e7U, 0x003b1b21U, 0x00dc0603U, 0x00260af5U,
+  0xffdbfd10U, 0x023057b4U, 0x01f6e4f6U, 0xf6fa1cd1U, 0x091ce8e2U, 0x0ad03626U, 0xfcefefeeU, 0xf9e7e9feU,
+  0x18cff909U, 0x023e04faU, 0x05e7effaU, 0xf107e8f6U, 0xf9e2fdffU, 0x12040a08U, 0x01f7f2f6U, 0xf5c90ffcU,
+  0x081d00f0U, 0xf2e100faU, 0x04e600ffU, 0xefd00003U, 0xfddbfbf9U, 0x28e20415U, 0x01f5fae7U, 0x0bc8ea0bU,
+  0x060f1a00U, 0xf0a7b200U, 0xfb291100U, 0xf7cfe800U, 0x0003ead2U, 0x003e124dU, 0x00e2211dU, 0x002b1d28U,
+  0xd9f736e3U, 0x000b36beU, 0x060bf9f2U, 0xefe754d9U, 0xd81e03eeU, 0x36c15a03U, 0xfbfed8ecU, 0x01cd05f2U,
+  0x4db70118U, 0x202cee0bU, 0xfa0ee711U, 0x14fccffaU, 0xe9d12202U, 0x42080409U, 0xf1cfeaf3U, 0x16b01ef0U,
+  0x36250003U, 0xe1ee00c2U, 0x0ce9001eU, 0xcdc00001U, 0xfca706e0U, 0x0ff00cf7U, 0x0cbdfecdU, 0x0bddda05U,
+  0x10e9f900U, 0xd68acd00U, 0xfe082600U, 0x17f3d000U, 0x000ff3dfU, 0x000d0ffbU, 0x00f50e2cU, 0x00170f6dU,
+  0xaf2c0fdaU, 0xe7f92cf1U, 0xfc19fe27U, 0x0ed562dbU, 0xc245130cU, 0x2c973c1dU, 0xed2feae8U, 0x39b91df7U,
+  0x46ba0f2eU, 0x053fec2cU, 0x2105f1f2U, 0xfd48e2e2U, 0xe4dceffbU, 0x2c2c0d0aU, 0xeccdc0e8U, 0x08c101e2U,
+  0x5e240010U, 0x21e400bbU, 0x160200fcU, 0xcad3000cU, 0x21ab07f2U, 0xee100c04U, 0x03e007eaU, 0xfffcddefU,
+  0xe7e6eb00U, 0xddbeef00U, 0x05f53a00U, 0x0215f800U, 0x003afe0aU, 0x00bdeedbU, 0x00051c1eU, 0x00090f22U,
+  0xb557fce5U, 0x15edebdcU, 0xf52bfcfdU, 0xf5e0291fU, 0xba230f0cU, 0x2bbe0439U, 0xf422e502U, 0x41e7bd10U,
+  0x24ade912U, 0xdd4fe44bU, 0x1efff6eaU, 0xf16ad9deU, 0x16e0f602U, 0x021b41e1U, 0xccf0b8e7U, 0xc9bff2e9U,
+  0x60030026U, 0x49e700d6U, 0x061000eeU, 0xadd200f9U, 0x37d10f01U, 0xecf2f915U, 0xfaeafaf6U, 0xc72dfb03U,
+  0x05fed800U, 0xfddddb00U, 0x01f93e00U, 0xff3d2500U, 0x004219eeU, 0x00ed01edU, 0x00f1152bU, 0x00f2062bU,
+  0xdf3e2de7U, 0x04f2b008U, 0xf722e825U, 0x19ba2aebU, 0xdb000f04U, 0x19ebe909U, 0x1a1debffU, 0x2d1ee507U,
+  0xf598d3f7U, 0xf8161023U, 0xf90fdef4U, 0xfa7ffaecU, 0x0de04809U, 0xe6eb1df1U, 0xdde4efe8U, 0xdae901e2U,
+  0xf3190002U, 0x1cdd00faU, 0x18100021U, 0x18d400d1U, 0xffc30408U, 0x33d20d03U, 0x000d01deU, 0xf4dbf702U,
+  0x02e53300U, 0x0d10f300U, 0xeff31c00U, 0x01b8c500U, 0x00fcb6c9U, 0x0032fa2fU, 0x003613fcU, 0x0035f7fbU,
+  0xe2dce9f4U, 0xfd3346ecU, 0xeaf00df5U, 0xf01320e5U, 0xd53614e7U, 0xf6d33bf0U, 0xfde1dd06U, 0xeefa28f9U,
+  0x32bfe203U, 0x10f21cdaU, 0x05eadef3U, 0x27fad202U, 0x17f6f8ebU, 0x4c02fdffU, 0xf3e81df5U, 0xfcb404e4U,
+  0x154900d7U, 0x1fd600daU, 0x263200f4U, 0x1bba0002U, 0x05af0ecbU, 0x30e0dbfbU, 0xeb0213ddU, 0xfbe0f6f2U,
+  0x2df10c00U, 0xf4f2e400U, 0x00030a00U, 0x0dc3ed00U, 0x0026dcddU, 0x00340f36U, 0x002b2503U, 0x0037eb30U,
+  0xc504e4d7U, 0x100819acU, 0xf106fee5U, 0xf8eb5307U, 0xc43ce613U, 0x1add58fdU, 0xea01cc0fU, 0x24cb1df3U,
+  0x3eccf3e0U, 0x18041dfeU, 0x1803c917U, 0x3fe0c300U, 0xf21ef904U, 0x40f1d5e9U, 0xd8f11bfdU, 0x33cb08e1U,
+  0x202f00ffU, 0x200000afU, 0x1f4d000cU, 0xf9cd0004U, 0x21bb25e0U, 0x08e6c3fdU, 0xfcde22daU, 0xfc13d90eU,
+  0x2bc7f700U, 0xd9a7f800U, 0x10002800U, 0x110ade00U, 0x0003f0caU, 0x00fa1707U, 0x002928e6U, 0x0017011cU,
+  0xd823e2ebU, 0xe702f0f6U, 0x003ee3f9U, 0x26e34913U, 0x9b571752U, 0x00da1f17U, 0xbb2fde06U, 0x41bb11e8U,
+  0x58c4fadaU, 0xf8fd2105U, 0x28e8d4f3U, 0x1318090cU, 0xcc490514U, 0x25efec05U, 0xe6150c07U, 0xf8e815e9U,
+  0x1b180030U, 0x270b00beU, 0x083f0007U, 0xcdd200e7U, 0x3aae26dcU, 0xcdead9f7U, 0x24f400f1U, 0x1e2fdae5U,
+  0x06b9ed00U, 0xf1ff1700U, 0xee032100U, 0xed350a00U, 0x00fbecfcU, 0x00e915f2U, 0x00214000U, 0x00f413e0U,
+  0xc93ce3faU, 0x8a09e6fcU, 0x034ceb04U, 0xf0eb0c33U, 0x96264e1cU, 0x1a03c323U, 0x0818c10eU, 0x2900eafeU,
+  0x30c0cce6U, 0x19ef1904U, 0xf4dbe3f4U, 0xec1efb07U, 0x0f203b0dU, 0x00d4190aU, 0xf3f4f8f9U, 0xd0d61bd2U,
+  0x0d340038U, 0x1cce00e3U, 0x20370004U, 0xb1bd00fcU, 0x7fab230eU, 0xbdfced28U, 0x0cf0ee07U, 0xe777c909U,
+  0x0bd1eb00U, 0x0d1ce600U, 0xf0ee4100U, 0xdd342d00U, 0x003bfc13U, 0x00fef002U, 0x00f21cf6U, 0x00d0f50aU,
+  0x962f3914U, 0xa10bbf4bU, 0xee34cffdU, 0x59c30f0aU, 0xf20729daU, 0x181efcfdU, 0x1513dffeU, 0x171bd629U,
+  0xf59cd3fdU, 0x13df23fbU, 0x0112dceeU, 0xfe63f600U, 0x61f42a10U, 0x17eeee02U, 0xdccfedffU, 0xb3edfedeU,
+  0xdb2e00f9U, 0x14010002U, 0xf1f6002eU, 0x1fe200f9U, 0xfcf21009U, 0x27daf6f1U, 0xe8121724U, 0x09e807edU,
+  0x07182500U, 0x081e0b00U, 0x16ba2e00U, 0xf4e7ca00U, 0x00dbc1c3U, 0x00e5c51cU, 0x00110d08U, 0x002901deU,
+  0x16dade02U, 0xe919fbe8U, 0xd4f93a27U, 0xe9110ce3U, 0xb74debc2U, 0x13f51510U, 0xf6fe211bU, 0xefeb1d0bU,
+  0x11c30d02U, 0xdf0c08d3U, 0x10bec1f3U, 0x1ae3e2f1U, 0xf2410c0eU, 0x3fe3f621U, 0xef0e38f6U, 0x17c9f1f0U,
+  0x141f00d3U, 0x26f000f0U, 0xf6f00030U, 0x0bdf0018U, 0xecd61ff0U, 0x32fdc7d3U, 0xdb0e36f9U, 0x200addd6U,
+  0x0526fe00U, 0x0444fd00U, 0x2aa0ff00U, 0xf0121700U, 0x0003fcd8U, 0x00e9fcf3U, 0x00122d02U, 0x002be004U,
+  0x0edfdefdU, 0x28f9d8b5U, 0xd1fc4a19U, 0xf4051ee4U, 0x911c1deeU, 0x0cea2d1cU, 0xd3013525U, 0x20d40c02U,
+  0x2ccd33ddU, 0x0ddcf3d6U, 0x00d8aae8U, 0x27fdc81bU, 0x9f66e62eU, 0x1ece0d08U, 0x0a26420fU, 0x30d506d7U,
+  0xe83400f6U, 0x0bfa00d4U, 0x0a01005fU, 0x02f50005U, 0xebad1600U, 0xfdebc102U, 0xeaea2dfeU, 0x061eee03U,
+  0xff190000U, 0x040d0200U, 0x1db3f700U, 0xf91bff00U, 0x00e92fecU, 0x000926faU, 0x001327ccU, 0x0022f8fbU,
+  0x0e00d918U, 0xeb04d0efU, 0xf2f73c25U, 0x2cf512f5U, 0xb91135f2U, 0x1b1d2b26U, 0xbf06181aU, 0x58c02215U,
+  0x27e115ccU, 0x06e4fac5U, 0x01f3cbfbU, 0x1032f722U, 0xbf6ceceeU, 0x17050d0aU, 0xed2a300eU, 0xdef009cdU,
+  0xd11d001aU, 0x22d300d1U, 0xe61b0061U, 0x00ee00d2U, 0x05e71d25U, 0xc2d9e8ffU, 0x23fb12ebU, 0xf61cea13U,
+  0xeaf3ef00U, 0x18f81e00U, 0x29d90f00U, 0x0b260100U, 0x00eee529U, 0x00220534U, 0x001b2c03U, 0x0005e2fcU,
+  0xd6fce132U, 0xbe14eaf3U, 0x00ea353fU, 0x1cea0023U, 0xd8e34d06U, 0xfb27dc0dU, 0xfdce081aU, 0x44fbbf05U,
+  0xfcc40cddU, 0xf5ab01fbU, 0xedf2e718U, 0xe903130cU, 0x03330b07U, 0xfdd30b03U, 0xe70d3af8U, 0xf6f816f0U,
+  0xf1250012U, 0xe8c70001U, 0xe329003eU, 0xaff900d1U, 0x72c51d23U, 0xd6f0e01dU, 0x2ee4e5faU, 0xc25edbffU,
+  0x0af0ec00U, 0x13350700U, 0xf3e61c00U, 0xf23e3d00U, 0x00040512U, 0x00e6f13dU, 0x00350429U, 0x00f0db08U,
+  0xefde1530U, 0xb8f9e5d9U, 0xd5d0fe33U, 0x3703c00fU, 0x01db39f8U, 0x263000fcU, 0x36f8ee10U, 0x0530c427U,
+  0xf3bf12ddU, 0x14b903f1U, 0x08f9fefcU, 0x0f253516U, 0x2feb2efaU, 0x31d30cf9U, 0xffc919c6U, 0xb509ec27U,
+  0xe51200f6U, 0x31120001U, 0xd9fa0029U, 0xf3f80002U, 0x1a08e4f3U, 0x21ea0ec3U, 0x03d62842U, 0x0bfb0df4U,
+  0xf50b2300U, 0xfd351300U, 0x2dc12000U, 0x010ed500U, 0x00dd12efU, 0x00f8cbfcU, 0x0009fa0eU, 0x0027d8e1U,
+  0x2e120211U, 0xfdf5f503U, 0xe905dd2fU, 0xeaf80df3U, 0xc02ccb0eU, 0xf01c0404U, 0xfa4a0e0bU, 0x11f022f7U,
+  0x13f642efU, 0xebc3f6cfU, 0x0dcfe2f4U, 0xfbf4d80eU, 0xe30f2d2aU, 0x0a0bf813U, 0x1562fc0cU, 0xfa050105U,
+  0xb73200d8U, 0x251200f6U, 0xd2dc001fU, 0xfd1c0034U, 0x14e5f3e0U, 0x29e8e7efU, 0x19d5303eU, 0x221decebU,
+  0x13121500U, 0x16303300U, 0x169a0000U, 0x01160d00U, 0x00e744f5U, 0x0006142aU, 0x00240400U, 0x000c1403U,
+  0x3c3be213U, 0xe2e0d1e9U, 0xd2fa1135U, 0xeef50bccU, 0xe4e5c714U, 0xfd140601U, 0xca1b1816U, 0xfbef23f7U,
+  0x0c4e3a10U, 0x07b80bb2U, 0x13c4dcf9U, 0x1013d618U, 0xc32d2d39U, 0x1706f212U, 0xd93e1703U, 0x15f40cfbU,
+  0xdc0000e3U, 0x0c0f00dbU, 0xf2130058U, 0xf60b0007U, 0xf2df16f7U, 0x20f6bffcU, 0xf6e42c25U, 0xf41ef617U,
+  0xf8320300U, 0x031e3a00U, 0x0bade900U, 0x0733ff00U, 0x00d31411U, 0x000f4238U, 0x002c041dU, 0x00221c10U,
+  0xfd2de411U, 0xcaf0dcccU, 0xf1f6103dU, 0xedea09d0U, 0x400009dcU, 0x450b15f0U, 0xe9e04217U, 0x3de206f6U,
+  0x09291f2dU, 0xffb821c4U, 0x0de50debU, 0x0526052dU, 0xdb0e0617U, 0x1601eb14U, 0xde320decU, 0xd01601dbU,
+  0xcefd00f0U, 0xf4fc00c1U, 0xd30c0044U, 0xebea00d5U, 0xfe100f0fU, 0x02f1c411U, 0xdd073ad9U, 0xf521f014U,
+  0xdef10e00U, 0x2e382500U, 0x1ddd0d00U, 0x0d12ee00U, 0x00b7e256U, 0x00e2174fU, 0x002dd552U, 0x00120c1eU,
+  0xe9f3e3eeU, 0xd21bcdefU, 0xf7c10244U, 0x15e2ebe9U, 0x35f9ff04U, 0x2e0ce2faU, 0xf7e8f7f1U, 0x35fcfc1eU,
+  0x15f62e32U, 0xf69b00e9U, 0x01f41fffU, 0x0b001e17U, 0xe7e6f6f6U, 0x0af4e512U, 0xf8281f05U, 0xecf01515U,
+  0xebf00010U, 0xddfb00f1U, 0xe9110037U, 0xc70500b1U, 0x2bdc0619U, 0xf5eee102U, 0x04e9fa11U, 0xd426f3f0U,
+  0x0724f400U, 0x1c5d1d00U, 0xf4161500U, 0x00062200U, 0x00bbed2bU, 0x00a6fc7fU, 0x000cf071U, 0x002df62aU,
+  0xda9d08feU, 0xa6dee90aU, 0xd4a0f138U, 0x0b29d1d8U, 0x22e5fc15U, 0x3d20e503U, 0x2a19ecebU, 0x3336f512U,
+  0xf5f40401U, 0x10a5efccU, 0x24d5450dU, 0x2d0c3833U, 0xf1f30105U, 0x31f8f511U, 0x0ddbfc08U, 0x1cfbef31U,
+  0x240a00efU, 0x0a1400daU, 0xee12001bU, 0xd7f70003U, 0xf811fbf7U, 0xdc1af6deU, 0x26e4f91dU, 0x0ff037fdU,
+  0x06071c00U, 0x0718ee00U, 0x16ff0300U, 0xf8ceee00U, 0x000b1aeaU, 0x00dedff2U, 0x001634e1U, 0x000b040dU,
+  0x0b1ff6ffU, 0x19daf901U, 0x132a081eU, 0xf613f107U, 0xe3ebdf15U, 0xfaf5ee0aU, 0xe634331bU, 0x15e708ffU,
+  0xd81e0711U, 0xe8ffe7efU, 0x0bda2a16U, 0xf708df1dU, 0xeaddfce7U, 0xc403f00cU, 0xe940f932U, 0xe806fc15U,
+  0x10e700faU, 0x020700efU, 0xebfc00e4U, 0xe6250015U, 0xee1403e2U, 0x100ac9e6U, 0x30f6e74bU, 0x12ec0df8U,
+  0xe01d0c00U, 0xf0190b00U, 0x22f4ed00U, 0xdcd6e200U, 0x00e2ede2U, 0x00da1f15U, 0x00061510U, 0x00eefd2dU,
+  0x2223f102U, 0xd6bdeb10U, 0x1a39f426U, 0xf10efa06U, 0x19d2c508U, 0x3300cf21U, 0xf20a2a2bU, 0x202b0419U,
+  0xe2301dfbU, 0x05fb0fd9U, 0xefcb321fU, 0x0b46d046U, 0xdbaf2105U, 0xc40cfe34U, 0xbf2afb0aU, 0xe2e6ed1dU,
+  0xe0ea00c3U, 0xacdc00f2U, 0xe3eb0020U, 0xe3fe0011U, 0xe0210604U, 0x12e5defaU, 0x13fa1c3dU, 0xdcf21225U,
+  0xe420fa00U, 0xd92a6e00U, 0xf8e7e300U, 0xe413e600U, 0x00c3ea16U, 0x00b9472eU, 0x00f3f564U, 0x0017e927U,
+  0xdbfefbffU, 0xb0e6dd25U, 0xfe07051dU, 0xc90c18d5U, 0x3308cffaU, 0x38fbdb2fU, 0x33ee1c0bU, 0x3a3600f2U,
+  0x0b130719U, 0x13dae9bfU, 0x09f30b01U, 0x113bf94fU, 0xfacb1c31U, 0xbcf1f051U, 0xb2ef090dU, 0xe1f1f911U,
+  0xfaee00c1U, 0x8dfc00fbU, 0xeff00025U, 0x05f400f5U, 0xcefb14e6U, 0xe4dbd32dU, 0xd7e9302bU, 0xf813eb16U,
+  0xcb243a00U, 0x01576600U, 0xf3f50f00U, 0x1216ef00U, 0x00bb1f30U, 0x00ac5568U, 0x00edf17fU, 0x002de736U,
+  0xc5e4e802U, 0xbedbdf1aU, 0xd2cc04f9U, 0xf2e619e5U, 0x2323e2ffU, 0x3ff2e615U, 0x1af001f8U, 0x41300611U,
+  0xffeb0d1dU, 0xd4bcc3edU, 0x03eb1322U, 0x201d261dU, 0x0dda0923U, 0x1afff414U, 0x03edfb0fU, 0x16ea0eedU,
+  0x240400e2U, 0xcd030002U, 0x0e24001eU, 0xf50f00e0U, 0xe00604ffU, 0xc9efe400U, 0xf1dd0c13U, 0x1611ebfcU,
+  0xfb3e0200U, 0x07604a00U, 0xdb2a3000U, 0xf71a2300U, 0x00e00c24U, 0x00cf2f45U, 0x00fd2d73U, 0x001d1135U,
+  0xeec0ebf0U, 0xb28ce419U, 0xa5cbf9f4U, 0x1030f5d0U, 0x27f2ea16U, 0x4f31e717U, 0x3119f2f0U, 0x5036f9dfU,
+  0xeee9f3f8U, 0xede3bedfU, 0xfed20cfbU, 0x39173b2cU, 0xe9ec0207U, 0x09f1f30eU, 0x11d6f811U, 0x7304f90fU,
+  0x00000000U, 0x2b0600feU, 0xdefe0040U, 0x0a030000U, 0x00000000U, 0x1a0000edU, 0xe813fef5U, 0x10e40affU,
+  0x00000000U, 0x0315ee00U, 0x06f43400U, 0xfef7f500U, 0x00000000U, 0x00001919U, 0x00caf103U, 0x00f4e8d5U,
+  0x00000000U, 0xfe2409f0U, 0x06e3ea45U, 0x04f8e8f9U, 0x00000000U, 0xffef1624U, 0x0930caeaU, 0xf82b2b01U,
+  0x00000000U, 0xf63dfcf0U, 0xfbebf611U, 0xf7f7fae3U, 0x00000000U, 0x1b2c1109U, 0xebf7f6f9U, 0x1501fefdU,
+  0x00000000U, 0xffe00015U, 0x13110038U, 0x02eb0008U, 0x00000000U, 0x0ff60a06U, 0xdbfefbeeU, 0x22e00414U,
+  0x00000000U, 0xed13d600U, 0x06f96900U, 0xddf8cf00U, 0x00000000U, 0x00fd1240U, 0x00eb0aefU, 0x001ae4d9U,
+  0x00000000U, 0x24fa2101U, 0x0dfdfe1dU, 0xef0b09d9U, 0x00000000U, 0x2bce270eU, 0xd946c4f9U, 0xdb5046e5U,
+  0x00000000U, 0x0d4febefU, 0x0be1f604U, 0x07cf02ecU, 0x00000000U, 0x2a2b190aU, 0xc5cfd100U, 0x280d21f7U,
+  0x00000000U, 0x080100fdU, 0x21210069U, 0xe6ec001bU, 0x00000000U, 0x1bf00e0fU, 0xd30bfd0aU, 0x15d3fc04U,
+  0x00000000U, 0xe1e5de00U, 0x0ded6800U, 0xfd01b800U, 0x00000000U, 0x00f0ff1dU, 0x00190e01U, 0x001fea27U,
+  0x00000000U, 0x34052ef0U, 0x11e3e012U, 0xc01304d8U, 0x00000000U, 0x239d111aU, 0xea3ff203U, 0xe11641d6U,
+  0x00000000U, 0x035df806U, 0x1ec7f3ddU, 0x36ae13e8U, 0x00000000U, 0xfe0b1a1bU, 0xc3c1e9f0U, 0x5e040d00U,
+  0x00000000U, 0x151100daU, 0x28070023U, 0xb7df0030U, 0x00000000U, 0x0dfb10ffU, 0xc903fcf7U, 0x04c905eeU,
+  0x00000000U, 0xf2d8f400U, 0x2fef3700U, 0x06f3c300U, 0x00000000U, 0x00e8eefaU, 0x00160501U, 0x001dfb45U,
+  0x00000000U, 0x3c200becU, 0xf8dddef8U, 0xae3b09f8U, 0x00000000U, 0x16c4bf0eU, 0xfd08fffeU, 0xda0c46f7U,
+  0x00000000U, 0xeb5be713U, 0x29c506f7U, 0x01eaf4f2U, 0x00000000U, 0xef011bf0U, 0xd6e0e5d9U, 0x57f6f101U,
+  0x00000000U, 0x1f0a00dcU, 0xf4f400fcU, 0xd4db001bU, 0x00000000U, 0xfef40cf6U, 0xd6edf80cU, 0x31e305f6U,
+  0x00000000U, 0xdec2ec00U, 0x05f22800U, 0xfef4ca00U, 0x00000000U, 0x0007f2ecU, 0x000007e4U, 0x00ef0954U,
+  0x00000000U, 0xfc14c8f2U, 0xedf2c1fcU, 0xcf421ff1U, 0x00000000U, 0xfee8ee0cU, 0xeb0ef6feU, 0xff2425fbU,
+  0x00000000U, 0xf51bd0ecU, 0x26cbe101U, 0xf5f9f0d9U, 0x00000000U, 0xebf41703U, 0xf5e7f0eaU, 0x32e8fcf0U,
+  0x00000000U, 0x13ff00f6U, 0xef2c003fU, 0xf4f6001dU, 0x00000000U, 0x13f505dbU, 0xfdd7fdedU, 0x12e819ffU,
+  0x00000000U, 0x0a0eeb00U, 0xf9054200U, 0x03210100U, 0x00000000U, 0x00c00110U, 0x00de1002U, 0x00f1f9d5U,
+  0x00000000U, 0x252bf014U, 0xe9d7e61fU, 0xe0f5f106U, 0x00000000U, 0x11e42617U, 0xfb3ed000U, 0xd34013d8U,
+  0x00000000U, 0xe73717ecU, 0x1be0f508U, 0xeecffbeaU, 0x00000000U, 0x14060215U, 0xeef9ebeeU, 0x06302504U,
+  0x00000000U, 0x10f500d6U, 0x13350048U, 0x07cc0009U, 0x00000000U, 0x09f9c8e1U, 0xf6ea09e3U, 0x14e5031bU,
+  0x00000000U, 0xf52ad400U, 0x04084500U, 0x09170f00U, 0x00000000U, 0x00d30b0fU, 0x00ef23f2U, 0x000bf8f5U,
+  0x00000000U, 0x00f2f7feU, 0xd5ebf60cU, 0xe4f91908U, 0x00000000U, 0x31dd1e22U, 0xd53bef07U, 0xad5932d8U,
+  0x00000000U, 0xfa2cf3efU, 0x0def0d13U, 0xfbdbeaf0U, 0x00000000U, 0x04061700U, 0xebf2c9f4U, 0x2143ed10U,
+  0x00000000U, 0x01f900c3U, 0x192a003dU, 0x03e60006U, 0x00000000U, 0x04f0d2ffU, 0xf0f608d4U, 0x12dce7f4U,
+  0x00000000U, 0x0613de00U, 0xffea2900U, 0x1b232300U, 0x00000000U, 0x00e42cf6U, 0x00ed30ecU, 0x00101f20U,
+  0x00000000U, 0xecf6ec0dU, 0x0f00fa00U, 0xedf7fa0cU, 0x00000000U, 0x0dae2b19U, 0xdc20fd18U, 0xba2539dfU,
+  0x00000000U, 0xf71f0a03U, 0x1cebeadbU, 0x2a1af3efU, 0x00000000U, 0xf200091cU, 0xdefee5d0U, 0xf32bd2f6U,
+  0x00000000U, 0xf41400f2U, 0x1e20002bU, 0xf1e9002aU, 0x00000000U, 0xee0efbd9U, 0xe606fde1U, 0xf10cf9ebU,
+  0x00000000U, 0xeae70400U, 0x18d7f000U, 0x10e04a00U, 0x00000000U, 0x00da2902U, 0x000a1116U, 0x00f0122aU,
+  0x00000000U, 0xea30e225U, 0x0b10e306U, 0x04fb15f9U, 0x00000000U, 0x08cee11bU, 0xf31cf706U, 0xd0312be1U,
+  0x00000000U, 0xef57f71aU, 0x0bca08caU, 0xf538dff5U, 0x00000000U, 0xe3ccf309U, 0xe50a0817U, 0xe0250fd4U,
+  0x00000000U, 0x112a00fbU, 0x00580022U, 0xc2dd00f9U, 0x00000000U, 0xe4060aedU, 0xe2eb000bU, 0x3ff90e0eU,
+  0x00000000U, 0xffe5f400U, 0x09e2f500U, 0x0ce91d00U, 0x00000000U, 0x00e6ff08U, 0x0016fae8U, 0x00cc0a2bU,
+  0x00000000U, 0xd32cfa49U, 0xef06bb1aU, 0xf8e62cfcU, 0x00000000U, 0xd3d7de10U, 0xf20ee9f7U, 0xe4252517U,
+  0x00000000U, 0xf345d206U, 0x04a7eae2U, 0xfb1dc5dfU, 0x00000000U, 0xd9da0222U, 0xfe061803U, 0x15fd22fdU,
+  0x00000000U, 0x070e00f4U, 0xf4100017U, 0x0bef0004U, 0x00000000U, 0x04fb05dfU, 0x0ee903f9U, 0x191ef2d3U,
+  0x00000000U, 0xe820df00U, 0xfbfc3600U, 0x060a0000U, 0x00000000U, 0x00a201fdU, 0x00e92affU, 0x00093e07U,
+  0x00000000U, 0xfa0ed0ffU, 0xe0c7b802U, 0xe1f83812U, 0x00000000U, 0x18f2161cU, 0xdf45dc10U, 0xcc05e313U,
+  0x00000000U, 0xdf3c00d4U, 0x1b00ed19U, 0xf7df0ddfU, 0x00000000U, 0xf0fc0623U, 0xd906f4f9U, 0xd7f44f2dU,
+  0x00000000U, 0x11fe00e0U, 0xf12d0022U, 0x29f500eaU, 0x00000000U, 0x0309cae6U, 0xfdec2324U, 0x100b0ad5U,
+  0x00000000U, 0xea42d900U, 0x0cf51100U, 0x0e2f2200U, 0x00000000U, 0x00b9f101U, 0x00ff29e9U, 0x00292609U,
+  0x00000000U, 0xe6f7db01U, 0xbff5ddffU, 0xe70a32fcU, 0x00000000U, 0x0d0f1d1bU, 0xfa13de09U, 0xbd09ef52U,
+  0x00000000U, 0xee0aeed4U, 0x1eff1718U, 0xfe0adefaU, 0x00000000U, 0x04ef1b0bU, 0xaa26e211U, 0xdc0e501cU,
+  0x00000000U, 0xfbe500dcU, 0x1122002bU, 0x34e5000dU, 0x00000000U, 0x02fbcecdU, 0xe8be1133U, 0x16f4e0c4U,
+  0x00000000U, 0xf20ceb00U, 0xdae1e300U, 0x09104700U, 0x00000000U, 0x00e71b27U, 0x00201ac2U, 0x002651deU,
+  0x00000000U, 0xd521e50eU, 0xd3100105U, 0x1d241d23U, 0x00000000U, 0x12ee091dU, 0x0929211eU, 0xa408ff0dU,
+  0x00000000U, 0xf804f7e9U, 0x08d1f1f9U, 0x112fe1e5U, 0x00000000U, 0x050a0afcU, 0xee0bd8f9U, 0xe6fc0f17U,
+  0x00000000U, 0xf6f60002U, 0xf614001cU, 0xeb10001eU, 0x00000000U, 0xf4e20edfU, 0xe2ee0d33U, 0x2211ed05U,
+  0x00000000U, 0xf9d90a00U, 0xf1cff100U, 0x09f47f00U, 0x00000000U, 0x00dd0e03U, 0x0034f31aU, 0x0011fad6U,
+  0x00000000U, 0xd94fbf1aU, 0xf2fc1d0bU, 0x1f1a1d12U, 0x00000000U, 0xf9f9e711U, 0x181e3a15U, 0xd914f41aU,
+  0x00000000U, 0xfe2a011fU, 0xfac01dcbU, 0x0f03a606U, 0x00000000U, 0xfadee4f0U, 0x0b00111eU, 0xbaf419feU,
+  0x00000000U, 0x030100f4U, 0xc84d0013U, 0x051b0018U, 0x00000000U, 0xdaf701cfU, 0xf7d81923U, 0x0727da24U,
+  0x00000000U, 0xf1cc1000U, 0xfa04d700U, 0xe9f94600U, 0x00000000U, 0x00d5ed19U, 0x0035e719U, 0x000de1d1U,
+  0x00000000U, 0xf32ae946U, 0xd6f8f206U, 0x23f2fa1aU, 0x00000000U, 0xdbe6ea24U, 0x16f8f9d8U, 0x0d37e72bU,
+  0x00000000U, 0xf878eef2U, 0xf19e0bd3U, 0x161da3fcU, 0x00000000U, 0xcff1d900U, 0x30030d15U, 0x92d61afbU,
+  0x00000000U, 0x171200f9U, 0xfa080001U, 0x1bf20004U, 0x00000000U, 0xf9340de8U, 0xcbc5f204U, 0xfc13e3c8U,
+  0x00000000U, 0xe23bef00U, 0x00f31600U, 0x0bf30100U, 0x00000000U, 0x00ea4beaU, 0x00e22bf5U, 0x00263af5U,
+  0x00000000U, 0x1bdde41eU, 0xff02ccf1U, 0xfc133912U, 0x00000000U, 0x00f1d21bU, 0xe62d150dU, 0xe2b5215bU,
+  0x00000000U, 0xde3becd6U, 0x250ce312U, 0xe921ddfeU, 0x00000000U, 0xc009350aU, 0x01f6f7efU, 0xf0ee270dU,
+  0x00000000U, 0x1b0100cdU, 0x03cf0006U, 0x3fd80016U, 0x00000000U, 0xef00ee09U, 0xddbe002bU, 0xe5fb08caU,
+  0x00000000U, 0xec3a0b00U, 0x16f0f300U, 0x0dea1400U, 0x00000000U, 0x00ec1ef0U, 0x00f019edU, 0x002454f2U,
+  0x00000000U, 0x1accdb0eU, 0xf927eff3U, 0x130829ffU, 0x00000000U, 0x04f6da02U, 0xed0e2a02U, 0xf0b54a3fU,
+  0x00000000U, 0xdb2214d5U, 0x30ffde21U, 0xf102072cU, 0x00000000U, 0xe91b3514U, 0xc500e1ebU, 0xfae63616U,
+  0x00000000U, 0x09d100e7U, 0x01f00005U, 0x33f4001eU, 0x00000000U, 0xf80ade06U, 0x15fb2866U, 0x22132ce2U,
+  0x00000000U, 0xfa193900U, 0x0becde00U, 0x06c33200U, 0x00000000U, 0x00f525ffU, 0x0021ead7U, 0x001823b6U,
+  0x00000000U, 0x1bf3da22U, 0xe90813f0U, 0x22283002U, 0x00000000U, 0xf1d8e327U, 0x1e252803U, 0xd9f52110U,
+  0x00000000U, 0xe511e1e4U, 0x19dbe242U, 0x0af6f627U, 0x00000000U, 0x070409e0U, 0xd8fbdef0U, 0xda1f10e8U,
+  0x00000000U, 0xf7fa00f5U, 0xf1430001U, 0xf912000aU, 0x00000000U, 0xe4ecf103U, 0x2302203eU, 0xfc1f16f8U,
+  0x00000000U, 0x0d071700U, 0xfde6df00U, 0xf69f3a00U, 0x00000000U, 0x00f40712U, 0x0016f51aU, 0x0006d7c9U,
+  0x00000000U, 0x090ac943U, 0xd4f91beaU, 0x0a0013e3U, 0x00000000U, 0xfee8f824U, 0x151322feU, 0xcc12f610U,
+  0x00000000U, 0xf22bd5ffU, 0x16d01d29U, 0x19032215U, 0x00000000U, 0x1605f0e2U, 0xee04031cU, 0x9c0a34fcU,
+  0x00000000U, 0xc1d800e5U, 0x036400faU, 0xeb0e00faU, 0x00000000U, 0xb31709e3U, 0x06e00511U, 0xf905f90dU,
+  0x00000000U, 0x0cd52600U, 0xf422bd00U, 0xf3ea0000U, 0x00000000U, 0x00f0d72cU, 0x00380f2eU, 0x0014deb6U,
+  0x00000000U, 0x25f9035cU, 0xc2fffbf7U, 0x08f808eeU, 0x00000000U, 0xed00fc29U, 0x1cf90ac4U, 0x1140d408U,
+  0x00000000U, 0x087fd3f5U, 0xee8132ffU, 0x2300ee2aU, 0x00000000U, 0xeb1becdaU, 0x31e00911U, 0x9fedfb17U,
+  0x00000000U, 0xf2da00deU, 0x18ef001fU, 0xe7f000e4U, 0x00000000U, 0x9f3fe2f0U, 0xd5d7feeaU, 0xe2dd090dU,
+  0x00000000U, 0xfdedf400U, 0x040d0600U, 0x14cbf600U, 0x00000000U, 0x000928e9U, 0x00fd39e5U, 0x0020f51fU,
+  0x00000000U, 0x18ddf912U, 0xee21e701U, 0xe01ee603U, 0x00000000U, 0x11ebdf43U, 0xde4704efU, 0xf5d91b15U,
+  0x00000000U, 0xe749de17U, 0x10e402e6U, 0x0107e42dU, 0x00000000U, 0xb8ff250bU, 0x0efde7e7U, 0xdaf5df09U,
+  0x00000000U, 0x1af00008U, 0x0a1f000bU, 0xede7001aU, 0x00000000U, 0xb120d1faU, 0x00e2f904U, 0xe9d1360cU,
+  0x00000000U, 0xf80c0d00U, 0x40f9fc00U, 0xfbe8f100U, 0x00000000U, 0x002551f6U, 0x000ff4ceU, 0x0004d52eU,
+  0x00000000U, 0x21e4eb2aU, 0x1b2cedf9U, 0xad11090dU, 0x00000000U, 0x1aeee150U, 0xe5323df1U, 0x1de521fdU,
+  0x00000000U, 0x0a46d517U, 0x0ed80119U, 0x0b0ee736U, 0x00000000U, 0xbf1f3d30U, 0x1a2adbd1U, 0xfcfae3faU,
+  0x00000000U, 0xe9c60010U, 0x230f0002U, 0xf907003dU, 0x00000000U, 0xbdf5ebf2U, 0x35fdf334U, 0x22ed2c14U,
+  0x00000000U, 0x00275a00U, 0x11dfd300U, 0xf5d5ea00U, 0x00000000U, 0x002a0cf8U, 0x0008f8caU, 0x0015da07U,
+  0x00000000U, 0x05f2f45dU, 0x3a2412eeU, 0xda060409U, 0x00000000U, 0x1acdd954U, 0xd42b02f3U, 0x06fd22f2U,
+  0x00000000U, 0x1135bd0cU, 0x11f4ed23U, 0x20ec1226U, 0x00000000U, 0xea26261eU, 0xd0e0f712U, 0xfa17eb1aU,
+  0x00000000U, 0xc9cd002eU, 0x210300e7U, 0x05090037U, 0x00000000U, 0x99fadcf9U, 0x3221f541U, 0x2ef90c04U,
+  0x00000000U, 0x0e184900U, 0x13b5be00U, 0x15cedf00U, 0x00000000U, 0x0011ff19U, 0x00d6fb11U, 0x0025e813U,
+  0x00000000U, 0xf81bff3eU, 0x192421dfU, 0xe2010ce6U, 0x00000000U, 0x25eb0d15U, 0xde17e4f1U, 0x01fe1300U,
+  0x00000000U, 0x121eb001U, 0x25f00f13U, 0x1ac23330U, 0x00000000U, 0xf42106d9U, 0xefcffd45U, 0xc4010614U,
+  0x00000000U, 0xbed70006U, 0x391500f4U, 0x1514000fU, 0x00000000U, 0x871fe5feU, 0x2de90b02U, 0x32ec080aU,
+  0x00000000U, 0x1ef05500U, 0xf3ed9900U, 0xf7f8c600U, 0x00000000U, 0x00010102U, 0x00ddf91cU, 0x0000e411U,
+  0x00000000U, 0x3022fa43U, 0xc0260ed5U, 0xe80612c1U, 0x00000000U, 0xf2290718U, 0xf3f302f6U, 0x02fff5efU,
+  0x00000000U, 0x1b5afb22U, 0xf3ad0bf7U, 0x1dbe1408U, 0x00000000U, 0xd9180bd2U, 0x1debf93dU, 0xf0f002feU,
+  0x00000000U, 0x0afb00f8U, 0x00000000U, 0x191a0015U, 0x00000000U, 0xfdf702f8U, 0x00000000U, 0x011a001aU,
+  0x00000000U, 0x0411fb00U, 0x00000000U, 0xfc201c00U, 0x00000000U, 0x000603feU, 0x00000000U, 0x0005ffe9U,
+  0x00000000U, 0xfef7ebf6U, 0x00000000U, 0x04131f27U, 0x00000000U, 0x02ed0808U, 0x00000000U, 0x02f3ca05U,
+  0x00000000U, 0x14fde301U, 0x00000000U, 0xc40e3302U, 0x00000000U, 0x0e10e9fbU, 0x00000000U, 0xf0e0090aU,
+  0x00000000U, 0x091300e2U, 0x00000000U, 0x0c1e00e6U, 0x00000000U, 0xedf81ce9U, 0x00000000U, 0x0a280605U,
+  0x00000000U, 0xe715ff00U, 0x00000000U, 0xce401d00U, 0x00000000U, 0x000df214U, 0x00000000U, 0x000818d0U,
+  0x00000000U, 0x2200eaf9U, 0x00000000U, 0x0a35eb20U, 0x00000000U, 0x01e906fdU, 0x00000000U, 0xf01ccaffU,
+  0x00000000U, 0x000002f6U, 0x00000000U, 0xd2f92b27U, 0x00000000U, 0x1a09fefbU, 0x00000000U, 0xbcaf080fU,
+  0x00000000U, 0x140e00f1U, 0x00000000U, 0x313b00cbU, 0x00000000U, 0x01f80cf2U, 0x00000000U, 0x1c102415U,
+  0x00000000U, 0xfa0de500U, 0x00000000U, 0xe0461100U, 0x00000000U, 0x00050c15U, 0x00000000U, 0x0000ede0U,
+  0x00000000U, 0x1220ec0aU, 0x00000000U, 0x1b43c3f1U, 0x00000000U, 0xf7d30d00U, 0x00000000U, 0xf22bccfaU,
+  0x00000000U, 0xf613f3dfU, 0x00000000U, 0xf0f22c1dU, 0x00000000U, 0x0301fc14U, 0x00000000U, 0xdbd7051bU,
+  0x00000000U, 0x0bf500e3U, 0x00000000U, 0x310400ecU, 0x00000000U, 0x15000502U, 0x00000000U, 0x3bf31212U,
+  0x00000000U, 0x051bc700U, 0x00000000U, 0xeb412100U, 0x00000000U, 0x00091111U, 0x00000000U, 0x0001ebcbU,
+  0x00000000U, 0x0f2813fcU, 0x00000000U, 0x0f26aee0U, 0x00000000U, 0xf7dc18ffU, 0x00000000U, 0x0736b1e4U,
+  0x00000000U, 0xe911eee7U, 0x00000000U, 0x08c0290aU, 0x00000000U, 0x070101f6U, 0x00000000U, 0xfdf4eb31U,
+  0x00000000U, 0x06f300f7U, 0x00000000U, 0x181700f7U, 0x00000000U, 0x20f20109U, 0x00000000U, 0x26bcff08U,
+  0x00000000U, 0xfdf2cb00U, 0x00000000U, 0x10fcf600U, 0x00000000U, 0x00150016U, 0x00000000U, 0x0004f6b9U,
+  0x00000000U, 0x12362003U, 0x00000000U, 0xf4fa9addU, 0x00000000U, 0x0d001b07U, 0x00000000U, 0x0329e9f2U,
+  0x00000000U, 0x011de5faU, 0x00000000U, 0x0db5330fU, 0x00000000U, 0xe900df0cU, 0x00000000U, 0xf2fdca27U,
+  0x00000000U, 0x04f3000eU, 0x00000000U, 0x0df8002dU, 0x00000000U, 0xf209f9eaU, 0x00000000U, 0x13150b07U,
+  0x00000000U, 0xf910fd00U, 0x00000000U, 0xfe2d1100U, 0x00000000U, 0x00282300U, 0x00000000U, 0x00d938ebU,
+  0x00000000U, 0x0df51af5U, 0x00000000U, 0xfd12f64aU, 0x00000000U, 0xf0f2fcf5U, 0x00000000U, 0x1c03c20aU,
+  0x00000000U, 0x07f5f5f4U, 0x00000000U, 0xc1131dd1U, 0x00000000U, 0x10f0fe05U, 0x00000000U, 0xf3d4120bU,
+  0x00000000U, 0x0d09000eU, 0x00000000U, 0xfc180005U, 0x00000000U, 0xe203def0U, 0x00000000U, 0x090520f2U,
+  0x00000000U, 0xef0bf100U, 0x00000000U, 0xed340b00U, 0x00000000U, 0x00012107U, 0x00000000U, 0x00fbf8fbU,
+  0x00000000U, 0x00f91ad7U, 0x00000000U, 0xe7190013U, 0x00000000U, 0x00f718edU, 0x00000000U, 0x1519d60bU,
+  0x00000000U, 0xf3f603dcU, 0x00000000U, 0xe1fa10edU, 0x00000000U, 0x1a06120eU, 0x00000000U, 0x16df0b0aU,
+  0x00000000U, 0x09120011U, 0x00000000U, 0x0c3e0007U, 0x00000000U, 0xdcf2e9f7U, 0x00000000U, 0x01fb20efU,
+  0x00000000U, 0xe7fae100U, 0x00000000U, 0xfa19e900U, 0x00000000U, 0x00050813U, 0x00000000U, 0x00fae013U,
+  0x00000000U, 0xf30701dfU, 0x00000000U, 0x121bf0f9U, 0x00000000U, 0xf0ed04f0U, 0x00000000U, 0x1f00e7e3U,
+  0x00000000U, 0xd4f9f0d7U, 0x00000000U, 0xfd14230eU, 0x00000000U, 0x08fc0efeU, 0x00000000U, 0x15ec0635U,
+  0x00000000U, 0xf9f300feU, 0x00000000U, 0x1c17000dU, 0x00000000U, 0xf9f808daU, 0x00000000U, 0x24ee2b04U,
+  0x00000000U, 0x000dc100U, 0x00000000U, 0xf222e300U, 0x00000000U, 0x00f21c11U, 0x00000000U, 0x0007e816U,
+  0x00000000U, 0x022015f9U, 0x00000000U, 0x1b12e7eeU, 0x00000000U, 0x07dd1403U, 0x00000000U, 0x131ffad1U,
+  0x00000000U, 0xde01f0dbU, 0x00000000U, 0xed151afdU, 0x00000000U, 0xf0060dfeU, 0x00000000U, 0x080fc83eU,
+  0x00000000U, 0x18ec0002U, 0x00000000U, 0x0a0e0009U, 0x00000000U, 0x200413f1U, 0x00000000U, 0x2dc80e05U,
+  0x00000000U, 0xeef9dc00U, 0x00000000U, 0xed45f500U, 0x00000000U, 0x00e61409U, 0x00000000U, 0x0007eae4U,
+  0x00000000U, 0x1628f7fbU, 0x00000000U, 0xe505e1d4U, 0x00000000U, 0x01e61e07U, 0x00000000U, 0x1e3ce3e7U,
+  0x00000000U, 0xfd1ffdf0U, 0x00000000U, 0x1bd6161bU, 0x00000000U, 0xfd0c0d05U, 0x00000000U, 0xef07a938U,
+  0x00000000U, 0x1ce8000fU, 0x00000000U, 0x23f4002eU, 0x00000000U, 0xdf14f117U, 0x00000000U, 0x000ef7d7U,
+  0x00000000U, 0x20c50000U, 0x00000000U, 0xfe1a0c00U, 0x00000000U, 0x00181516U, 0x00000000U, 0x00dd730eU,
+  0x00000000U, 0x1bef55fdU, 0x00000000U, 0xfaf1db5aU, 0x00000000U, 0xf5eb37f8U, 0x00000000U, 0xf528b90aU,
+  0x00000000U, 0xf3fb04ebU, 0x00000000U, 0xd6081ddbU, 0x00000000U, 0x2b140ff8U, 0x00000000U, 0xf9c5280cU,
+  0x00000000U, 0x24ee002cU, 0x00000000U, 0x1d0a000bU, 0x00000000U, 0xd010e316U, 0x00000000U, 0x0c19e5d0U,
+  0x00000000U, 0x00d80100U, 0x00000000U, 0xe60a1d00U, 0x00000000U, 0x00022133U, 0x00000000U, 0x00e434f9U,
+  0x00000000U, 0x1dd44307U, 0x00000000U, 0xf0eae207U, 0x00000000U, 0xe9f436feU, 0x00000000U, 0xee15cbe4U,
+  0x00000000U, 0xee38fec7U, 0x00000000U, 0xf204ebeeU, 0x00000000U, 0x1ff40de3U, 0x00000000U, 0x04e40823U,
+  0x00000000U, 0xfeeb0012U, 0x00000000U, 0x110d000eU, 0x00000000U, 0xcde5edf1U, 0x00000000U, 0xfd080cdeU,
+  0x00000000U, 0xe1e70e00U, 0x00000000U, 0xdc0d0300U, 0x00000000U, 0x00e6fd49U, 0x00000000U, 0x00e80500U,
+  0x00000000U, 0x08e41e1cU, 0x00000000U, 0x17ff06dcU, 0x00000000U, 0xc10e22f7U, 0x00000000U, 0xeb0813f7U,
+  0x00000000U, 0xe2022ba9U, 0x00000000U, 0xf635f105U, 0x00000000U, 0x11e7f9fbU, 0x00000000U, 0x01010e09U,
+  0x00000000U, 0xe2020028U, 0x00000000U, 0x19280006U, 0x00000000U, 0xf9d9e7d6U, 0x00000000U, 0x12ff2fe3U,
+  0x00000000U, 0x0e0afa00U, 0x00000000U, 0xd3ebe600U, 0x00000000U, 0x00e82f61U, 0x00000000U, 0x000bf411U,
+  0x00000000U, 0x0c040114U, 0x00000000U, 0x40fd1cf7U, 0x00000000U, 0xdbea150dU, 0x00000000U, 0x03ee11eeU,
+  0x00000000U, 0xf72703adU, 0x00000000U, 0xdc1e0003U, 0x00000000U, 0x0003e9d8U, 0x00000000U, 0x1311fd24U,
+  0x00000000U, 0xfdf700ffU, 0x00000000U, 0x29fb00e3U, 0x00000000U, 0x300c01d5U, 0x00000000U, 0x2b062a17U,
+  0x00000000U, 0xf7f2ff00U, 0x00000000U, 0xe724f900U, 0x00000000U, 0x00031c0eU, 0x00000000U, 0x000ff116U,
+  0x00000000U, 0x1409ef15U, 0x00000000U, 0x11dcfcf7U, 0x00000000U, 0xe2dc2000U, 0x00000000U, 0x0110f204U,
+  0x00000000U, 0xfa23f7c6U, 0x00000000U, 0xf8010c16U, 0x00000000U, 0x050af8dcU, 0x00000000U, 0x0009e321U,
+  0x00000000U, 0x1be80011U, 0x00000000U, 0x5afa001aU, 0x00000000U, 0x06083005U, 0x00000000U, 0x0516dce1U,
+  0x00000000U, 0x2ab40600U, 0x00000000U, 0xe1fe0800U, 0x00000000U, 0x000ae810U, 0x00000000U, 0x00e57ffeU,
+  0x00000000U, 0x49f63d0bU, 0x00000000U, 0x0b00f63dU, 0x00000000U, 0x1cf42ff8U, 0x00000000U, 0xfb18a021U,
+  0x00000000U, 0x041909feU, 0x00000000U, 0xe30229ceU, 0x00000000U, 0x2139fb0dU, 0x00000000U, 0xe8c829fdU,
+  0x00000000U, 0x30dc0014U, 0x00000000U, 0x19050000U, 0x00000000U, 0x9b14ea19U, 0x00000000U, 0xe509dde5U,
+  0x00000000U, 0x10ad0b00U, 0x00000000U, 0xe7d30300U, 0x00000000U, 0x00dcfd0dU, 0x00000000U, 0x00f95901U,
+  0x00000000U, 0x46cc541cU, 0x00000000U, 0x040af9ffU, 0x00000000U, 0xe2f65d0dU, 0x00000000U, 0x0b21c708U,
+  0x00000000U, 0x0b3ee10dU, 0x00000000U, 0xf3190cc7U, 0x00000000U, 0xf81ae8deU, 0x00000000U, 0x06e20c1bU,
+  0x00000000U, 0x31d3002aU, 0x00000000U, 0x0116000dU, 0x00000000U, 0x8bc9caffU, 0x00000000U, 0xedffffdaU,
+  0x00000000U, 0x14cf1800U, 0x00000000U, 0xd7e80800U, 0x00000000U, 0x00e5f014U, 0x00000000U, 0x00f91137U,
+  0x00000000U, 0x2bcf1443U, 0x00000000U, 0xf70b10eaU, 0x00000000U, 0xded24703U, 0x00000000U, 0x00f71805U,
+  0x00000000U, 0xe727e6b5U, 0x00000000U, 0xf72cece1U, 0x00000000U, 0x0f01f5edU, 0x00000000U, 0x0cfd0826U,
+  0x00000000U, 0xf5d00026U, 0x00000000U, 0xfe010017U, 0x00000000U, 0xb2f0cfd8U, 0x00000000U, 0x07ec13ecU,
+  0x00000000U, 0x42e83d00U, 0x00000000U, 0xe3e30300U, 0x00000000U, 0x00f5143eU, 0x00000000U, 0x0022f446U,
+  0x00000000U, 0x2fdc1c1bU, 0x00000000U, 0xe3f519f5U, 0x00000000U, 0xecdb43fcU, 0x00000000U, 0x04f525eeU,
+  0x00000000U, 0xd341dd87U, 0x00000000U, 0xed1aef09U, 0x00000000U, 0x0a0108edU, 0x00000000U, 0x1e030803U,
+  0x00000000U, 0xe9ec00e6U, 0x00000000U, 0x1ce200fbU, 0x00000000U, 0xf8f7ece3U, 0x00000000U, 0xe10e300eU,
+  0x00000000U, 0xeccd3900U, 0x00000000U, 0xdbeaf000U, 0x00000000U, 0x00f82addU, 0x00000000U, 0x000bfd3fU,
+  0x00000000U, 0x02fe05eaU, 0x00000000U, 0xede70aefU, 0x00000000U, 0xe8ee2eecU, 0x00000000U, 0x11f3f00aU,
+  0x00000000U, 0xe72dd0c3U, 0x00000000U, 0xfb0d001fU, 0x00000000U, 0x07fb0afdU, 0x00000000U, 0x07fd01e3U,
+  0x00000000U, 0x07030034U, 0x00000000U, 0x41fd0008U, 0x00000000U, 0x5e1611fbU, 0x00000000U, 0x0d36c6f2U,
+  0x00000000U, 0x26ee0e00U, 0x00000000U, 0xfa190800U, 0x00000000U, 0x0014d20aU, 0x00000000U, 0x002435e3U,
+  0x00000000U, 0x4b1b2527U, 0x00000000U, 0x0cf42420U, 0x00000000U, 0x06215517U, 0x00000000U, 0x08ebd523U,
+  0x00000000U, 0x11f71509U, 0x00000000U, 0xea1f1af5U, 0x00000000U, 0x20571519U, 0x00000000U, 0xdff22c09U,
+  0x00000000U, 0x19e8002aU, 0x00000000U, 0x1bfb0023U, 0x00000000U, 0x34f2d1f1U, 0x00000000U, 0xe841dbf7U,
+  0x00000000U, 0x3df81e00U, 0x00000000U, 0xe5fa1e00U, 0x00000000U, 0x0024e1d8U, 0x00000000U, 0x00333ff7U,
+  0x00000000U, 0x623d1736U, 0x00000000U, 0x39071b11U, 0x00000000U, 0x260e7f07U, 0x00000000U, 0xfddfd42aU,
+  0x00000000U, 0x1019ece7U, 0x00000000U, 0xd7110c0bU, 0x00000000U, 0xed7404ffU, 0x00000000U, 0xfbf53903U,
+  0x00000000U, 0x56eb0048U, 0x00000000U, 0xf4ed001eU, 0x00000000U, 0x05fabddeU, 0x00000000U, 0xe81efa0aU,
+  0x00000000U, 0x57d92f00U, 0x00000000U, 0xe8f83200U, 0x00000000U, 0x002507dfU, 0x00000000U, 0x00283717U,
+  0x00000000U, 0x6940303fU, 0x00000000U, 0x11151315U, 0x00000000U, 0xfee6790bU, 0x00000000U, 0xfaeace27U,
+  0x00000000U, 0x0c2fca9bU, 0x00000000U, 0xf918d8faU, 0x00000000U, 0xc579eadfU, 0x00000000U, 0x0dca19ecU,
+  0x00000000U, 0x3bc00011U, 0x00000000U, 0xe0f2001fU, 0x00000000U, 0xce02dcb7U, 0x00000000U, 0xe2081df7U,
+  0x00000000U, 0x20bd3200U, 0x00000000U, 0xc6f83200U, 0x00000000U, 0x000debd1U, 0x00000000U, 0x002a1c33U,
+  0x00000000U, 0x70001d1aU, 0x00000000U, 0xe1040e19U, 0x00000000U, 0x0ddd27feU, 0x00000000U, 0xefeffa18U,
+  0x00000000U, 0xf164f4c7U, 0x00000000U, 0xfe1ad31aU, 0x00000000U, 0xd31cf8cfU, 0x00000000U, 0xffc506ebU,
+  0x00000000U, 0xfff300e3U, 0x00000000U, 0xf8e40027U, 0x00000000U, 0xda09dcf5U, 0x00000000U, 0xb60f14fbU,
+  0x00000000U, 0xf1d54600U, 0x00000000U, 0xd2fa1600U, 0x00000000U, 0x000beadfU, 0x00000000U, 0x000f0327U,
+  0x00000000U, 0x13d907ecU, 0x00000000U, 0xfa000719U, 0x00000000U, 0xf8f815f8U, 0x00000000U, 0x16f8f613U,
+  0x00000000U, 0xff13ede6U, 0x00000000U, 0x0827f01bU, 0x00000000U, 0xd8ef06d1U, 0x00000000U, 0xe3db06f0U,
+  0xd1df00f8U, 0x17160034U, 0x4c21000bU, 0x1d050039U, 0xf70903f3U, 0x0e20f30fU, 0x2ff81017U, 0xfefd02f8U,
+  0x03dee900U, 0x001b2a00U, 0x01213100U, 0xfc171b00U, 0x00e606f9U, 0x00fd3fffU, 0x0056f9edU, 0x00f302f3U,
+  0xfae1dcdbU, 0x05072b32U, 0x0949282fU, 0x05f7f61dU, 0x0000dbf1U, 0x0affc015U, 0x00cee50fU, 0xfaedf30eU,
+  0x19eef5f4U, 0xd91df9faU, 0xbd1d5217U, 0xe301fcf6U, 0xf90006feU, 0xd9ba110dU, 0x28d9ff1bU, 0xf6eafafcU,
+  0xfcec00e9U, 0xf02f0004U, 0x172a00a5U, 0xfaf90024U, 0xf9160b01U, 0x1619f0f4U, 0x47c30e19U, 0xf5db00eaU,
+  0x08f2e300U, 0xf1254100U, 0xd8090d00U, 0xebff2300U, 0x00e40dd1U, 0x00ee15eeU, 0x0056d307U, 0x0014f8f5U,
+  0x0be2dfb0U, 0x0a232344U, 0xdd6fda64U, 0xe914f511U, 0x03e1030fU, 0x0c0cc112U, 0x03dddae1U, 0xef06f6f2U,
+  0x2bfce108U, 0xe01b0404U, 0xced74910U, 0xe0ece807U, 0xea2af80bU, 0xbdae2003U, 0x0eb1fc3eU, 0xedd2fcfeU,
+  0xf7d2001bU, 0xfc4800feU, 0x2c0e009dU, 0xfff8000fU, 0xfb291a39U, 0x2efaf00fU, 0x56c10624U, 0xececf6e1U,
+  0x0befd700U, 0xe92c6f00U, 0xc0df3500U, 0xd5fc2700U, 0x00ee1dc9U, 0x00f51603U, 0x0033dc11U, 0x0023f1d9U,
+  0x47e60af7U, 0x012cf425U, 0xf13bccfdU, 0xe0080329U, 0xf1f72c08U, 0x1414a016U, 0x32fcced5U, 0xfa1c010dU,
+  0x0c07a4f9U, 0xd7f31e0dU, 0xe5b16315U, 0xeaeffcf0U, 0xd63eeff5U, 0xa3bd270aU, 0x0d0ad742U, 0xedd0160fU,
+  0x2ae800f7U, 0xc6190001U, 0xffe000baU, 0xe6f30001U, 0x18101e39U, 0x350ce307U, 0x3cfcfb2bU, 0xf9fdffdeU,
+  0xf428fa00U, 0xf3535f00U, 0xfde01e00U, 0xcbea2b00U, 0x00062fbeU, 0x00f53016U, 0x0019efe7U, 0x002becefU,
+  0x45fe080cU, 0x0700dd02U, 0x0000c8f4U, 0xc0edf51bU, 0xd9081813U, 0x150fa3feU, 0x19f5d1ceU, 0x0e13f1feU,
+  0xef07b6f7U, 0xfdf72529U, 0x149f3c0cU, 0x04f4f404U, 0xe40cfefdU, 0xbbd9fe17U, 0xf92a0156U, 0xd9c52301U,
+  0x1dd500c6U, 0xeb11000fU, 0xf60200ecU, 0xebe700feU, 0xfa2e0e32U, 0x0714fc19U, 0x06dd0814U, 0xe1ebfaf6U,
+  0x170a1c00U, 0xd0304300U, 0x210de800U, 0xebf41800U, 0x001108fdU, 0x00050f14U, 0x00030ac7U, 0x002702e0U,
+  0x260828f2U, 0x04f6fa1aU, 0xddedce14U, 0xdbefcf30U, 0xfd0d1c07U, 0x1b12f81dU, 0x121403f6U, 0xf8f709fcU,
+  0xf10ba5d1U, 0x28330f42U, 0x11d22d1fU, 0x13e3e70cU, 0xe71bfbedU, 0xddf1e012U, 0x0b1af719U, 0xe8de38efU,
+  0xf3f80017U, 0x31f80053U, 0x43fc0016U, 0x060b005aU, 0x0b04f1f1U, 0x150eeee6U, 0x291c3616U, 0xfefa0beeU,
+  0x081af600U, 0xfce42c00U, 0xe03d2300U, 0xea422c00U, 0x00ef1defU, 0x002d7af9U, 0x0028fed3U, 0x0004fb0aU,
+  0xead2050bU, 0xfe1b484cU, 0x0b630051U, 0x02f41c17U, 0xf5eff00bU, 0x2def921bU, 0x11cab9f0U, 0xf809ecf2U,
+  0xf5e8f8d8U, 0xf20008f4U, 0xc9222af7U, 0xe8effcf6U, 0xe6fb26f7U, 0xce981ae9U, 0x41cc1f08U, 0xf7d113f3U,
+  0xc5060026U, 0xfc2f000dU, 0x49f700afU, 0x0807003fU, 0x0a331715U, 0x1d170dcbU, 0x1ecd670cU, 0xfae613dfU,
+  0x1517e800U, 0xe2fb3600U, 0xee4ae300U, 0xf5332600U, 0x00e422deU, 0x00044a05U, 0x004ad5f1U, 0x00f307f3U,
+  0xe2e901f5U, 0xd72e3e2eU, 0xe240e51eU, 0xca031402U, 0xd4e32408U, 0x27079b17U, 0x07d7c8c2U, 0xf2301f09U,
+  0x11f5d9f7U, 0x0e1d15e8U, 0xdbec39e3U, 0xfad20213U, 0xd7492003U, 0xd8cd2104U, 0x61ed0810U, 0x0ee9f5edU,
+  0xe0d5002cU, 0xe02a0022U, 0x290300b2U, 0x14f00026U, 0x191d343cU, 0xfdf91f00U, 0x36cb6e0cU, 0xfad9f5f5U,
+  0xf114da00U, 0xf3eb3800U, 0xdf40e000U, 0xe5233300U, 0x00e30ac2U, 0x00fe0e1aU, 0x0029b900U, 0x000907e1U,
+  0x0afcfa16U, 0x142c0b24U, 0x0704f4d9U, 0xbf0008f4U, 0xd0163df3U, 0xfeeb9fe9U, 0x25f8f09eU, 0x10500a0fU,
+  0x0114d323U, 0xd129e1fdU, 0xf2fb35feU, 0x11e00b01U, 0xd338ebecU, 0xc7fa551eU, 0x0dfdcd2aU, 0x02efdeedU,
+  0x10b200e8U, 0xf2230000U, 0xef1700a9U, 0x040a0002U, 0x15254028U, 0x10dd0c09U, 0x04e641f9U, 0x0acff0cbU,
+  0xdf2a0c00U, 0xe21a2500U, 0xdc21fb00U, 0xe6ec2e00U, 0x00dc1bceU, 0x0008f210U, 0x003db9f5U, 0x003211f6U,
+  0x0aeffa21U, 0x58fff413U, 0xeef4cce0U, 0xd7e917f3U, 0xe0e12f04U, 0x04e0aee7U, 0x272cfcbcU, 0x1620e915U,
+  0xfb1cad0bU, 0xde0d0600U, 0x15d810edU, 0x3aeb0504U, 0xfd19fad5U, 0xc7171a22U, 0xfc48a464U, 0xf2db02f3U,
+  0x3cc100b0U, 0xf1350009U, 0xb32f00cbU, 0x18060016U, 0xf4442203U, 0xe91d050dU, 0x19b80b0dU, 0xc9d1f2e3U,
+  0xed184a00U, 0xd7523100U, 0x25320600U, 0xf6d21a00U, 0x00d235cfU, 0x00f7fa07U, 0x0061d5d5U, 0x0032f5eeU,
+  0x2bfc0a05U, 0x4bdfc70fU, 0xa4dcf2f7U, 0xdbf2f50cU, 0xeef5290fU, 0x1016d71bU, 0x453e04e1U, 0x0906d20fU,
+  0x0102b0dcU, 0x223cf039U, 0x24d13225U, 0x2ef60f3aU, 0xf9221deaU, 0xc241e700U, 0x0a4cb03bU, 0xc5d419e8U,
+  0xeedf0036U, 0x40e20030U, 0x5e110029U, 0x0ff8002dU, 0x11f90506U, 0x131bfc08U, 0x0c3c30efU, 0x070e0efcU,
+  0x190cf000U, 0x0aba3700U, 0xd15c1f00U, 0xf6212600U, 0x00fe19e3U, 0x00357f07U, 0x000e36f1U, 0x0029061eU,
+  0xe5c82527U, 0x0c1a2e47U, 0x3120d34fU, 0x16f669f9U, 0xe7d50509U, 0x27fec714U, 0xecf3c9c0U, 0xda11d2f6U,
+  0xebcef8cfU, 0xd3291208U, 0xe84eee07U, 0xdef11cf7U, 0xb8234207U, 0xe4941bdfU, 0x43d520f5U, 0xe3c6f3edU,
+  0xd9fe0018U, 0xf73b000fU, 0x340e0003U, 0x0825001dU, 0xfc150613U, 0xfe1cf30fU, 0xe0221af0U, 0x05e113f0U,
+  0x2701f000U, 0xf3ef2c00U, 0xd958f800U, 0x0e130e00U, 0x00fd1ffeU, 0x00224408U, 0x0001cffbU, 0x000e0f0dU,
+  0xebd9272cU, 0x1df8242eU, 0x3cd9e806U, 0xe5ed41fbU, 0xadea1d30U, 0x14dea9edU, 0xced11eabU, 0xf821e116U,
+  0x0302dfd8U, 0xd3241fe9U, 0xef3cd6f8U, 0x12ce23f0U, 0xe05d26f6U, 0xdbd22e10U, 0x5de20522U, 0xd303ea0dU,
+  0xfdd40038U, 0xd9420003U, 0xf20d00c4U, 0x08130010U, 0x01240afaU, 0xde073402U, 0xe7161ffcU, 0xefd719d5U,
+  0xfb1a0500U, 0xeee3c800U, 0xe62edb00U, 0xf7110500U, 0x000a1fbfU, 0x0029e31dU, 0x000db43dU, 0x00071dfbU,
+  0x11f81b5bU, 0x2ce70209U, 0x2dbe04a3U, 0xe001d9e8U, 0xc215f30cU, 0xebcfe0c4U, 0xef0543b7U, 0x1838e10dU,
+  0x1d14b300U, 0xcf4810d6U, 0xf121ea0eU, 0x10d41ddaU, 0xf0ff13deU, 0xdbfa1f18U, 0x3e121123U, 0xcf2df036U,
+  0x2cdf0014U, 0xe72400e0U, 0xd83200abU, 0x090b0016U, 0x23250ff2U, 0xe30640ddU, 0x1e073bd1U, 0xc60af8c6U,
+  0xcc242200U, 0xddf7cb00U, 0xdb210500U, 0xf5171700U, 0x00f825dcU, 0x0023d04aU, 0x001eea0fU, 0x00050de9U,
+  0xf9e61432U, 0x3bc8dd26U, 0xedd5e5cfU, 0xd419da09U, 0xf4021201U, 0x0eda08beU, 0xfe3402edU, 0x0a51da14U,
+  0x0619ce05U, 0xeb342ed0U, 0x14e6073cU, 0x38ec060aU, 0xf50108d0U, 0xfa21f630U, 0x272fb249U, 0xda0fd3f5U,
+  0x49fb00c9U, 0xed2000f1U, 0xcf3500fbU, 0x213d0029U, 0xf41b08fcU, 0xb6472700U, 0x6bb17c00U, 0xc2fcf7d1U,
+  0xf5e82600U, 0xdf2a1500U, 0xd441fa00U, 0xeb07f700U, 0x00eb26b6U, 0x00e7002eU, 0x001ad4d5U, 0x001e03d9U,
+  0x13e3e602U, 0x30dfd214U, 0x91e0d5c8U, 0xdd27ddfaU, 0xede9fdf8U, 0xf40d1ddfU, 0x2251fce3U, 0x0731e5e6U,
+  0x000cf1fbU, 0x0c420e07U, 0x20810e31U, 0x34f0271cU, 0x08370ac3U, 0x0458cf1fU, 0x362ea55eU, 0xcef5d8fbU,
+  0xe5de0033U, 0x5af10020U, 0x5c420018U, 0x22f6000aU, 0x3125f7fbU, 0xea0a0a0aU, 0xf3561332U, 0x08012042U,
+  0x28feeb00U, 0x28e00f00U, 0xf64e1a00U, 0x0be7ff00U, 0x004e1613U, 0x00186e0cU, 0x00e14413U, 0x0039032fU,
+  0xe8d66547U, 0x17ed0c32U, 0x4ff6f834U, 0x16003edeU, 0x06c0e21eU, 0x26f40900U, 0x0e0d9fe1U, 0x05f819f8U,
+  0xdfd30ec3U, 0xf523df0aU, 0xff77f316U, 0xd61ae526U, 0xd5ff7c0fU, 0x0de6fad2U, 0xf1c70df5U, 0x01e2f4e3U,
+  0xc3ea00fcU, 0x0de20017U, 0x3d620048U, 0x0bfa0000U, 0x01170ce2U, 0xdc090930U, 0xe82b2e10U, 0x03041f2fU,
+  0xf10bf100U, 0x1fe30400U, 0xe8411f00U, 0x11bbe600U, 0x0027212dU, 0x000e2a37U, 0x00dcfe26U, 0x002eed1aU,
+  0xfecf2835U, 0x10db1719U, 0x34c0f701U, 0x16f808c6U, 0x09d4f635U, 0x38d115c2U, 0xe2ecefa8U, 0x04f9ec0aU,
+  0xe905e6cdU, 0x041cd9faU, 0x0559fdf6U, 0xebeb3efaU, 0xfa034501U, 0x14ebefe7U, 0x6f11f315U, 0xfaf1f2fbU,
+  0xfd18000fU, 0xe2ec00faU, 0x44190007U, 0xfc2a00f1U, 0xeb08f1d9U, 0xe9f31922U, 0xe11e3ae2U, 0x14ec120aU,
+  0xe72c1f00U, 0xdee1d100U, 0xff2e1c00U, 0xdcd4da00U, 0x00ff1314U, 0x0001ce44U, 0x00e9f923U, 0x0024d9ddU,
+  0xfae6f93cU, 0xf7be05d4U, 0x3cc417f9U, 0xeeeee3efU, 0xec0d1621U, 0xf1c02bc0U, 0xca0324a9U, 0xe122cffaU,
+  0x14f9d3beU, 0xf727fadcU, 0xe2230ce0U, 0xf4df2cdeU, 0x1fec180cU, 0x1dfbde0bU, 0x4d1bf2fbU, 0x35e0ea24U,
+  0x130f000fU, 0xf8ef00e9U, 0x0ae600deU, 0x012600deU, 0x0a0911e2U, 0xd0ec1514U, 0xf32b370fU, 0x071616e9U,
+  0xdf391800U, 0x05d1cb00U, 0x050b2c00U, 0xece5d800U, 0x00eb06edU, 0x0013f42dU, 0x00f5ee0eU, 0x0018eaf2U,
+  0x1adbfe0cU, 0x24aae808U, 0xffcad6d5U, 0xf208da0aU, 0xfa25240eU, 0xeec053c9U, 0xd82244ccU, 0xf228c4e0U,
+  0x0418ebe8U, 0xde2720e0U, 0xfcfc2109U, 0x19e15816U, 0x040ff8ffU, 0x4344d9eeU, 0x4725e91dU, 0x1ee8f449U,
+  0x2a2b0010U, 0xdaf900d7U, 0x000300ecU, 0xef4500f2U, 0xeafb01eaU, 0xd5072c10U, 0x1ae9620bU, 0xf2ff08ffU,
+  0xe0fb2100U, 0x1ffe2500U, 0x1e371d00U, 0x1204da00U, 0x00ef13d0U, 0x00082338U, 0x00dcebd2U, 0x000110e7U,
+  0x0cdd0216U, 0x2ed2e7feU, 0x97a4deedU, 0xe024e235U, 0xf304f0edU, 0xfadd3ed8U, 0x103321e4U, 0xe12301ceU,
+  0xf5f7fae8U, 0x052feafbU, 0x24eacaf6U, 0x12bb3302U, 0xff18fdffU, 0x3363d4f3U, 0x2a56da37U, 0x1d15f71eU,
+  0xe2f2001bU, 0x13ea0004U, 0x260200a4U, 0x35cd00ecU, 0x3907ef1bU, 0xd00925faU, 0xa63ffd30U, 0x0def3539U,
+  0x0c2efe00U, 0x0df9f500U, 0x0b0bfc00U, 0x12f1db00U, 0x0042f717U, 0x000a2af2U, 0x00d62038U, 0x0025f738U,
+  0x1bf57f25U, 0x1dd8ed10U, 0x0fe8eae7U, 0xff0908e6U, 0x0ccdea1fU, 0x20001508U, 0x35e6c3dcU, 0x17e32deeU,
+  0xd6003af7U, 0x1f12defdU, 0x1076f6f9U, 0xee23cf22U, 0xea0644f2U, 0xec24fa07U, 0xeed9daf1U, 0xfd0ce1edU,
+  0xd3010026U, 0xfdf700fdU, 0x16e900ffU, 0x20d600f9U, 0x331827f4U, 0xe21ef108U, 0xb33df6f9U, 0xd4eb3b77U,
+  0xe225f000U, 0x27e4ee00U, 0x09cf1f00U, 0x17d8d300U, 0x003ffb36U, 0x00e51e32U, 0x009d1b72U, 0x0020e41eU,
+  0x2df6552dU, 0x1fdeff12U, 0xbfa1f411U, 0x0ceb15fdU, 0x1ecbe311U, 0x1bf224e7U, 0x16d0c386U, 0x14ef30e1U,
+  0xe1e443ccU, 0x1c0cdf0dU, 0xff63020fU, 0x05fdf550U, 0xf9f14802U, 0xfe34f2fdU, 0x32bfed2aU, 0x14e5edc2U,
+  0xdb09004eU, 0xeaf80004U, 0x1ad80000U, 0xf90f000cU, 0x1df736d2U, 0xcc0de11eU, 0xc00de0deU, 0xdaed1f7fU,
+  0xb5242600U, 0x1ce1df00U, 0xf8fa4800U, 0x0fc2e300U, 0x001de426U, 0x00e6033dU, 0x00a51875U, 0x000eb720U,
+  0xfaf30f1fU, 0xeeebe5f2U, 0x938c0a16U, 0x03c0010aU, 0xfd14edf5U, 0x07f433c1U, 0xefe234b3U, 0xf4d14ae4U,
+  0xf2dc2fd5U, 0x1634f81aU, 0xf02afd0fU, 0xfbecef11U, 0x20f9290bU, 0x2f25fffaU, 0x52f2e5eaU, 0x61e8ea00U,
+  0xdb1c004dU, 0x02ce0007U, 0x01c200e1U, 0xe93a0020U, 0xe0f41fedU, 0xc7d90015U, 0x09261c1bU, 0xd3000a59U,
+  0xae432b00U, 0x3218e800U, 0x23041e00U, 0x23d3e200U, 0x00f9ec14U, 0x00f50d5aU, 0x00d7fa50U, 0x000ace23U,
+  0xd8f600f3U, 0xf7d2e620U, 0xb895ebffU, 0xdad30014U, 0xe71ffbebU, 0xe6e545f7U, 0x19fe42f9U, 0x1beb24ebU,
+  0xfb03fee3U, 0xe332f3faU, 0xd405ef1cU, 0x00f80021U, 0x10102304U, 0x2d3bfe0aU, 0x1f3508d4U, 0x5914f325U,
+  0xfe240055U, 0x00e7000dU, 0x12e700dcU, 0xc8530011U, 0xd0f001f1U, 0xec0512f3U, 0xe7ed4a12U, 0xf0e5161fU,
+  0xea181d00U, 0x001f1a00U, 0x3a2b2700U, 0x2908cb00U, 0x00fa05f8U, 0x00fa1f3fU, 0x00e31a0dU, 0x0010e735U,
+  0xecf70617U, 0x0dd40114U, 0x1e81ef0bU, 0xd0dfff08U, 0xef1ff3f1U, 0x23dc2304U, 0x3e002202U, 0x0bf318f3U,
+  0xf404f6f1U, 0xfe2adff6U, 0x09fdcde6U, 0xf5b91efaU, 0xf5230cfbU, 0x1927feceU, 0x034702ebU, 0x3b3f0423U,
+  0xf9fd000bU, 0x00000000U, 0x00000000U, 0xf4070008U, 0x0614fa0aU, 0x00000000U, 0x00000000U, 0xfdfb031aU,
+  0xfb040100U, 0x00000000U, 0x00000000U, 0x02f70f00U, 0x00ea0eebU, 0x00000000U, 0x00000000U, 0x00e8e8f0U,
+  0x01070407U, 0x00000000U, 0x00000000U, 0x02efec1eU, 0x09fcd7faU, 0x00000000U, 0x00000000U, 0x02fad1f4U,
+  0xcf041d0aU, 0x00000000U, 0x00000000U, 0xecf31b11U, 0xeae0130bU, 0x00000000U, 0x00000000U, 0xf002ef03U,
+  0x06fb00feU, 0x00000000U, 0x00000000U, 0xf80e00dbU, 0x0b1dff08U, 0x00000000U, 0x00000000U, 0xf1ed2231U,
+  0xd52cfa00U, 0x00000000U, 0x00000000U, 0xe0181200U, 0x00f90eeaU, 0x00000000U, 0x00000000U, 0x0024dec1U,
+  0x0510010dU, 0x00000000U, 0x00000000U, 0xfbf40d00U, 0xf71fc011U, 0x00000000U, 0x00000000U, 0xdb05e0e0U,
+  0xdcff1e38U, 0x00000000U, 0x00000000U, 0xeaf904fbU, 0xe29715fbU, 0x00000000U, 0x00000000U, 0xe2e7e40bU,
+  0x021b00f0U, 0x00000000U, 0x00000000U, 0x1d1200e5U, 0x271c0216U, 0x00000000U, 0x00000000U, 0x17d82c30U,
+  0xe9390b00U, 0x00000000U, 0x00000000U, 0xe90af400U, 0x00f914f7U, 0x00000000U, 0x00000000U, 0x0020e493U,
+  0x0d1a0114U, 0x00000000U, 0x00000000U, 0x39041fe9U, 0x0422ce11U, 0x00000000U, 0x00000000U, 0xad6dfce9U,
+  0xf70e1e38U, 0x00000000U, 0x00000000U, 0xfeb40cd4U, 0xd9810108U, 0x00000000U, 0x00000000U, 0x14ee1901U,
+  0x023600daU, 0x00000000U, 0x00000000U, 0x10fb00e5U, 0x3f0bff14U, 0x00000000U, 0x00000000U, 0x46e1091dU,
+  0xca3d2300U, 0x00000000U, 0x00000000U, 0xf511fa00U, 0x00f918e0U, 0x00000000U, 0x00000000U, 0x00070883U,
+  0x0920e6e8U, 0x00000000U, 0x00000000U, 0x3004eee9U, 0x0c2a9b04U, 0x00000000U, 0x00000000U, 0xce62f5ebU,
+  0x07f02e2eU, 0x00000000U, 0x00000000U, 0x328814edU, 0xe3c4051fU, 0x00000000U, 0x00000000U, 0x1df20c14U,
+  0x193700f5U, 0x00000000U, 0x00000000U, 0xf22700d1U, 0x2df00a14U, 0x00000000U, 0x00000000U, 0x36bf0f12U,
+  0xd9120500U, 0x00000000U, 0x00000000U, 0x05f7df00U, 0x0010fab2U, 0x00000000U, 0x00000000U, 0x00260f97U,
+  0xfa14caefU, 0x00000000U, 0x00000000U, 0xf920b2e0U, 0x0615d602U, 0x00000000U, 0x00000000U, 0xe02d05f5U,
+  0x23d7312cU, 0x00000000U, 0x00000000U, 0x2f812315U, 0xfdfde219U, 0x00000000U, 0x00000000U, 0x080cc624U,
+  0x12d30016U, 0x00000000U, 0x00000000U, 0xf4110022U, 0x0207fd06U, 0x00000000U, 0x00000000U, 0x0a041700U,
+  0xf6f8fa00U, 0x00000000U, 0x00000000U, 0xfd231400U, 0x00f839dcU, 0x00000000U, 0x00000000U, 0x000711d6U,
+  0xe7f8eb2dU, 0x00000000U, 0x00000000U, 0x01dfaf4eU, 0x0d00af20U, 0x00000000U, 0x00000000U, 0xf8ecc8fbU,
+  0xcafb11e4U, 0x00000000U, 0x00000000U, 0xd204fde8U, 0xf1bf24f9U, 0x00000000U, 0x00000000U, 0xf6f608f7U,
+  0x270f0015U, 0x00000000U, 0x00000000U, 0x07330001U, 0x0b201305U, 0x00000000U, 0x00000000U, 0x08e41d07U,
+  0xdd0c0400U, 0x00000000U, 0x00000000U, 0xde330800U, 0x000644efU, 0x00000000U, 0x00000000U, 0x001affdcU,
+  0xcefa0a24U, 0x00000000U, 0x00000000U, 0xfee7d83eU, 0x0f16b927U, 0x00000000U, 0x00000000U, 0xd415edeeU,
+  0xeedd0604U, 0x00000000U, 0x00000000U, 0xed1de6e2U, 0x0fa916f0U, 0x00000000U, 0x00000000U, 0x07fcfa00U,
+  0x234000f3U, 0x00000000U, 0x00000000U, 0x2e1d0015U, 0x1210101cU, 0x00000000U, 0x00000000U, 0x15f33c11U,
+  0xf917e900U, 0x00000000U, 0x00000000U, 0xe62ff100U, 0x00063904U, 0x00000000U, 0x00000000U, 0x002d07d8U,
+  0xeefefef5U, 0x00000000U, 0x00000000U, 0x0fe6fc22U, 0x0406dd1fU, 0x00000000U, 0x00000000U, 0xcd5311efU,
+  0xf8f8f118U, 0x00000000U, 0x00000000U, 0xefe800f1U, 0x07d0270aU, 0x00000000U, 0x00000000U, 0x24f2f9eaU,
+  0x053c00fbU, 0x00000000U, 0x00000000U, 0x2afc0008U, 0x33022134U, 0x00000000U, 0x00000000U, 0x21d83720U,
+  0xd427e600U, 0x00000000U, 0x00000000U, 0x0609fd00U, 0x00ea13fdU, 0x00000000U, 0x00000000U, 0x001d0bc4U,
+  0x210ceee7U, 0x00000000U, 0x00000000U, 0xfdffeee2U, 0xff15dcfaU, 0x00000000U, 0x00000000U, 0xc13f0bfcU,
+  0xec0f0527U, 0x00000000U, 0x00000000U, 0x1da82803U, 0x10e2fc31U, 0x00000000U, 0x00000000U, 0x33e602fcU,
+  0x162f00fcU, 0x00000000U, 0x00000000U, 0x060f00ddU, 0x35ef1a13U, 0x00000000U, 0x00000000U, 0x49b52208U,
+  0xd136e200U, 0x00000000U, 0x00000000U, 0x021aff00U, 0x00f70dcfU, 0x00000000U, 0x00000000U, 0x003c05b5U,
+  0xf713e8f8U, 0x00000000U, 0x00000000U, 0xd925ecbeU, 0x0102c902U, 0x00000000U, 0x00000000U, 0xe72af501U,
+  0x25e92537U, 0x00000000U, 0x00000000U, 0x3c972523U, 0x11e3d625U, 0x00000000U, 0x00000000U, 0x2adcda16U,
+  0x29e6001fU, 0x00000000U, 0x00000000U, 0xfb130034U, 0xef14f1efU, 0x00000000U, 0x00000000U, 0x1ef401e5U,
+  0x03f8f600U, 0x00000000U, 0x00000000U, 0xf41cff00U, 0x000e56e5U, 0x00000000U, 0x00000000U, 0x00f83ddbU,
+  0xf0eef863U, 0x00000000U, 0x00000000U, 0x23e8e766U, 0x0619ce12U, 0x00000000U, 0x00000000U, 0xd4fbe106U,
+  0xcfe21fdbU, 0x00000000U, 0x00000000U, 0xdc160aeeU, 0xedbd37ebU, 0x00000000U, 0x00000000U, 0xe3f53afdU,
+  0x38f8001cU, 0x00000000U, 0x00000000U, 0x14190036U, 0xed28f3e6U, 0x00000000U, 0x00000000U, 0x13db1eedU,
+  0xfbfd0400U, 0x00000000U, 0x00000000U, 0xe2010a00U, 0x001064feU, 0x00000000U, 0x00000000U, 0x0010f6e3U,
+  0xdbe4f351U, 0x00000000U, 0x00000000U, 0x01f1ce6dU, 0x0b1ec305U, 0x00000000U, 0x00000000U, 0xef2cefefU,
+  0xefe7f5e3U, 0x00000000U, 0x00000000U, 0xe71007e9U, 0x0fdf2ff9U, 0x00000000U, 0x00000000U, 0xf4010300U,
+  0x33040011U, 0x00000000U, 0x00000000U, 0x3f180005U, 0xfd14f3fdU, 0x00000000U, 0x00000000U, 0xf8f80919U,
+  0x081b1100U, 0x00000000U, 0x00000000U, 0xd3170d00U, 0x00f72ffeU, 0x00000000U, 0x00000000U, 0x00080df7U,
+  0xe9fe1b17U, 0x00000000U, 0x00000000U, 0xf1f90f13U, 0x0211e9f1U, 0x00000000U, 0x00000000U, 0xe14201f3U,
+  0xf7fecbfaU, 0x00000000U, 0x00000000U, 0x0ff11ffcU, 0x0dda1defU, 0x00000000U, 0x00000000U, 0x0907f3faU,
+  0x311f0009U, 0x00000000U, 0x00000000U, 0x351e00feU, 0x20f71f00U, 0x00000000U, 0x00000000U, 0xf4ef1206U,
+  0xd90efc00U, 0x00000000U, 0x00000000U, 0xf6faf600U, 0x00092226U, 0x00000000U, 0x00000000U, 0x000a110aU,
+  0x0ffb1cfdU, 0x00000000U, 0x00000000U, 0xd9312ceaU, 0xea0104f3U, 0x00000000U, 0x00000000U, 0xe93df7ecU,
+  0xf111dc01U, 0x00000000U, 0x00000000U, 0x15df30f1U, 0x17e70f0bU, 0x00000000U, 0x00000000U, 0x13d5f0edU,
+  0x29070017U, 0x00000000U, 0x00000000U, 0x200700f1U, 0x2af02a05U, 0x00000000U, 0x00000000U, 0x4bc62cf6U,
+  0xdb2bf100U, 0x00000000U, 0x00000000U, 0xde150000U, 0x0006fb07U, 0x00000000U, 0x00000000U, 0x00010427U,
+  0xebebf816U, 0x00000000U, 0x00000000U, 0xc21823c0U, 0x030ae7f8U, 0x00000000U, 0x00000000U, 0xfc02ebf2U,
+  0xff02f90dU, 0x00000000U, 0x00000000U, 0x20dc27f6U, 0x24feec15U, 0x00000000U, 0x00000000U, 0x3fd8d400U,
+  0x25ff0016U, 0x00000000U, 0x00000000U, 0x0e270029U, 0x1b35e8f3U, 0x00000000U, 0x00000000U, 0x2a08def2U,
+  0xe1250700U, 0x00000000U, 0x00000000U, 0xf1f2fd00U, 0x00f41efdU, 0x00000000U, 0x00000000U, 0x00f1230aU,
+  0x1afeff39U, 0x00000000U, 0x00000000U, 0x1cf9f44cU, 0xfc09cc11U, 0x00000000U, 0x00000000U, 0xe226de03U,
+  0xe1df2be8U, 0x00000000U, 0x00000000U, 0xf71134d3U, 0xf6d44409U, 0x00000000U, 0x00000000U, 0xe7023bffU,
+  0x260d001cU, 0x00000000U, 0x00000000U, 0xf6160025U, 0xfd1b00f5U, 0x00000000U, 0x00000000U, 0x23ed1ffbU,
+  0xd8ef1d00U, 0x00000000U, 0x00000000U, 0xcdf7fe00U, 0x000141ebU, 0x00000000U, 0x00000000U, 0x00ef13efU,
+  0x13eef636U, 0x00000000U, 0x00000000U, 0xe305e62dU, 0xf31eb00bU, 0x00000000U, 0x00000000U, 0xe934d7f4U,
+  0xf70b00c9U, 0x00000000U, 0x00000000U, 0x0c010edbU, 0x1fd620e8U, 0x00000000U, 0x00000000U, 0xcf040e22U,
+  0x1f010027U, 0x00000000U, 0x00000000U, 0x13170020U, 0x0f1011e6U, 0x00000000U, 0x00000000U, 0x0c0721faU,
+  0xe6091500U, 0x00000000U, 0x00000000U, 0xe7f70800U, 0x00132104U, 0x00000000U, 0x00000000U, 0x00dd1802U,
+  0xfffc140fU, 0x00000000U, 0x00000000U, 0xd90cf9efU, 0x0411e208U, 0x00000000U, 0x00000000U, 0xff1ede0aU,
+  0xea15f0e5U, 0x00000000U, 0x00000000U, 0x000b1f00U, 0x08e520feU, 0x00000000U, 0x00000000U, 0xecf9f736U,
+  0x10030017U, 0x00000000U, 0x00000000U, 0x20fe0005U, 0x09100f1aU, 0x00000000U, 0x00000000U, 0x0cf0f8edU,
+  0xd51d0900U, 0x00000000U, 0x00000000U, 0xf8e7f800U, 0x00140823U, 0x00000000U, 0x00000000U, 0x00e9f010U,
+  0x07fb2102U, 0x00000000U, 0x00000000U, 0xf81904e6U, 0x041307ecU, 0x00000000U, 0x00000000U, 0xf022dfeeU,
+  0xf511faffU, 0x00000000U, 0x00000000U, 0x0f1508e5U, 0x2de507f4U, 0x00000000U, 0x00000000U, 0xe9b50116U,
+  0x1606000dU, 0x00000000U, 0x00000000U, 0x0ff800ebU, 0x050b0c08U, 0x00000000U, 0x00000000U, 0x32fcfce8U,
+  0xd7fb0c00U, 0x00000000U, 0x00000000U, 0xded51a00U, 0x000d0712U, 0x00000000U, 0x00000000U, 0x00d2fe21U,
+  0xe8ecf61cU, 0x00000000U, 0x00000000U, 0xe7110005U, 0x010bf9faU, 0x00000000U, 0x00000000U, 0xf4e8da01U,
+  0xf700f6f3U, 0x00000000U, 0x00000000U, 0xfb250dd5U, 0x2703f3fdU, 0x00000000U, 0x00000000U, 0x17bbf5efU,
+  0x2f0f000cU, 0x00000000U, 0x00000000U, 0x1df400e9U, 0x142fd9f7U, 0x00000000U, 0x00000000U, 0x0624cdedU,
+  0xf5251700U, 0x00000000U, 0x00000000U, 0xfdfd0800U, 0x002205ecU, 0x00000000U, 0x00000000U, 0x000c1ef2U,
+  0x1d092720U, 0x00000000U, 0x00000000U, 0x1def222cU, 0x0313d009U, 0x00000000U, 0x00000000U, 0x0bfbbd22U,
+  0xef0b35f1U, 0x00000000U, 0x00000000U, 0xe23127f8U, 0x07ff3505U, 0x00000000U, 0x00000000U, 0xc6e224ffU,
+  0x19170037U, 0x00000000U, 0x00000000U, 0x06110026U, 0xf835eff9U, 0x00000000U, 0x00000000U, 0xe92614fcU,
+  0xeb0a2c00U, 0x00000000U, 0x00000000U, 0xce011c00U, 0x002123f3U, 0x00000000U, 0x00000000U, 0x00f73aeaU,
+  0x4cf82817U, 0x00000000U, 0x00000000U, 0x15f82626U, 0xdef0c620U, 0x00000000U, 0x00000000U, 0xeefecc41U,
+  0xd50b30e7U, 0x00000000U, 0x00000000U, 0xe2212ff9U, 0x08e633f7U, 0x00000000U, 0x00000000U, 0xece83c05U,
+  0x07f20048U, 0x00000000U, 0x00000000U, 0x1a00002aU, 0x0e1a0df9U, 0x00000000U, 0x00000000U, 0xf30e0212U,
+  0xe9002f00U, 0x00000000U, 0x00000000U, 0xdbef0800U, 0x001a360bU, 0x00000000U, 0x00000000U, 0x000120d9U,
+  0x260a261bU, 0x00000000U, 0x00000000U, 0xf4011afbU, 0xe303c427U, 0x00000000U, 0x00000000U, 0xfbefe04dU,
+  0xd8180804U, 0x00000000U, 0x00000000U, 0x05282b18U, 0xeaca17e1U, 0x00000000U, 0x00000000U, 0xebd4070aU,
+  0xea0c002eU, 0x00000000U, 0x00000000U, 0x14df0003U, 0xfb13040eU, 0x00000000U, 0x00000000U, 0xef17ec2aU,
+  0xc9f32200U, 0x00000000U, 0x00000000U, 0xd8e40800U, 0x001dfff8U, 0x00000000U, 0x00000000U, 0x0007ed02U,
+  0x0ffc0fffU, 0x00000000U, 0x00000000U, 0x02ea0af3U, 0x010ced0eU, 0x00000000U, 0x00000000U, 0xefe0e409U,
+  0xfc221516U, 0x00000000U, 0x00000000U, 0x14181708U, 0xfcb70601U, 0x00000000U, 0x00000000U, 0xffba09dbU,
+  0xe4f200feU, 0x00000000U, 0x00000000U, 0xeaf800f5U, 0xca0b07f9U, 0x00000000U, 0x00000000U, 0xee07f808U,
+  0xe5f72200U, 0x00000000U, 0x00000000U, 0xf7eb0b00U, 0x000ffef8U, 0x00000000U, 0x00000000U, 0x00faf716U,
+  0xfe07ff0cU, 0x00000000U, 0x00000000U, 0xfcd0eb13U, 0x100efdfdU, 0x00000000U, 0x00000000U, 0x02e1f1f7U,
+  0x071cf8ffU, 0x00000000U, 0x00000000U, 0xf412f8f8U, 0xefdeff0dU, 0x00000000U, 0x00000000U, 0xdcddf9f3U,
+  0xfaed00f9U, 0xf2f600fdU, 0xfe0400feU, 0x00000000U, 0xf0120417U, 0xf7df05f1U, 0x0402ff09U, 0x00000000U,
+  0x110de600U, 0x08e50300U, 0xfcfc1700U, 0x00000000U, 0x0007f91fU, 0x000eda06U, 0x00c2dad3U, 0x00000000U,
+  0x110208fdU, 0xfcfafb08U, 0x07f1d00bU, 0x00000000U, 0x04f522f4U, 0x030b29efU, 0x005d23e0U, 0x00000000U,
+  0x0ef0fe0bU, 0x17ddf006U, 0xfedb0efbU, 0x00000000U, 0x0710fef9U, 0x1517e6f7U, 0x121c03feU, 0x00000000U,
+  0xfbe6001fU, 0x021500e6U, 0x000900c1U, 0x00000000U, 0xe5071207U, 0xf4e50fe7U, 0x010d1004U, 0x00000000U,
+  0x0807da00U, 0x01eff300U, 0xe9f1ed00U, 0x00000000U, 0x000afe0dU, 0x001ad100U, 0x00cee8e9U, 0x00000000U,
+  0x26091919U, 0xff061be3U, 0x03ea12e7U, 0x00000000U, 0x0b0c10f3U, 0xe61814e5U, 0xdb4706ecU, 0x00000000U,
+  0xeb0008e9U, 0x17dd11f7U, 0x00c43b12U, 0x00000000U, 0x1b1a0ff4U, 0x271ef8f9U, 0x452827e9U, 0x00000000U,
+  0xfbd7003bU, 0x0d0400e7U, 0x1a1e00fcU, 0x00000000U, 0xf7e510f7U, 0x13c5fbecU, 0x29f1eee5U, 0x00000000U,
+  0x0ff6e100U, 0x0be2d200U, 0xf2fca900U, 0x00000000U, 0x00eff10bU, 0x0009e50eU, 0x0005ecfeU, 0x00000000U,
+  0x2d022304U, 0xef1603e9U, 0xb510f2f0U, 0x00000000U, 0x1a1e17f9U, 0xe13bececU, 0xe61c000eU, 0x00000000U,
+  0xea1af7dcU, 0x11f815efU, 0x1ff6382cU, 0x00000000U, 0x2901070aU, 0x2bfef008U, 0x30f90b17U, 0x00000000U,
+  0xf6f90025U, 0x0402001bU, 0x05150026U, 0x00000000U, 0xffed09feU, 0x10cdfbffU, 0x3ad3e9faU, 0x00000000U,
+  0x12fee800U, 0xefe6ec00U, 0xedf89d00U, 0x00000000U, 0x00ebf01bU, 0x0008e021U, 0x000cf7ecU, 0x00000000U,
+  0x11020f02U, 0x0215efd5U, 0x9d42d31fU, 0x00000000U, 0x0b0b0bffU, 0xf225020dU, 0xda082703U, 0x00000000U,
+  0xf40bf9dcU, 0x0b0618f2U, 0x08074e5aU, 0x00000000U, 0x0c09f50dU, 0x03f2e00eU, 0x20d4f62bU, 0x00000000U,
+  0xee03001cU, 0xeff90028U, 0x2f1a001fU, 0x00000000U, 0xf3f7fefdU, 0x19c804f7U, 0x6ae618d3U, 0x00000000U,
+  0xffe40700U, 0xfcede800U, 0xc001c000U, 0x00000000U, 0x0011e91aU, 0x0029ff0dU, 0x001a04ffU, 0x00000000U,
+  0xedf7080cU, 0xe312f5eeU, 0xce5b0ffcU, 0x00000000U, 0x0dea0c07U, 0xff0d0cffU, 0xf7fef1f7U, 0x00000000U,
+  0xf9fff3ecU, 0x11f106faU, 0xf8d7523cU, 0x00000000U, 0xfb0a070dU, 0x11ec000eU, 0x06df0216U, 0x00000000U,
+  0xf8ef0009U, 0xf1320005U, 0xe32000deU, 0x00000000U, 0xf21c0813U, 0xf4e719fcU, 0xf1fe081bU, 0x00000000U,
+  0x1001e800U, 0x05fe0800U, 0xfabe1400U, 0x00000000U, 0x00230318U, 0x0016b6ecU, 0x00e0d9daU, 0x00000000U,
+  0x2efb1204U, 0x1fece9f1U, 0x17eafdbcU, 0x00000000U, 0x0cfc0feeU, 0xe70c31dfU, 0xe47f09e3U, 0x00000000U,
+  0xf11804f6U, 0x2ff60709U, 0xf5c61d0aU, 0x00000000U, 0x1505f704U, 0x103df700U, 0x1924e7f9U, 0x00000000U,
+  0x20e40017U, 0xf92d00f0U, 0x020b00d0U, 0x00000000U, 0xf417f40cU, 0xf0c619c8U, 0xdcf8e91cU, 0x00000000U,
+  0x0fe1f800U, 0x0cf5de00U, 0x0695fe00U, 0x00000000U, 0x000b0401U, 0x001ba7e4U, 0x00f61315U, 0x00000000U,
+  0x3c060f2bU, 0xfa01eef7U, 0xecf10fc7U, 0x00000000U, 0x081522e1U, 0xe42632ddU, 0xdd56030bU, 0x00000000U,
+  0xe30a05f4U, 0x1bf607ffU, 0xf7ba2deeU, 0x00000000U, 0x1fece705U, 0x0c4cfe1cU, 0x321d05f8U, 0x00000000U,
+  0x05f70023U, 0x110800feU, 0x1afe001bU, 0x00000000U, 0xfdfaf9edU, 0x12c4f6eeU, 0xef0adf04U, 0x00000000U,
+  0x13eefa00U, 0x24dbde00U, 0x15aed600U, 0x00000000U, 0x0007e116U, 0x0019d9e7U, 0x002f0533U, 0x00000000U,
+  0x08fd0521U, 0x0d0df3f2U, 0xd705fbd2U, 0x00000000U, 0xfe390b00U, 0xdb3c13feU, 0xe508f916U, 0x00000000U,
+  0xe4faf8e1U, 0x1bbe04f1U, 0x29e815f0U, 0x00000000U, 0x0cf5caf1U, 0x09271920U, 0xf72eee05U, 0x00000000U,
+  0xeb11000fU, 0xf30b000bU, 0x1b050039U, 0x00000000U, 0x0df703f7U, 0x13cbf4f5U, 0x08f3fcfeU, 0x00000000U,
+  0x0df20400U, 0x1adfe000U, 0x0cc9ef00U, 0x00000000U, 0x00f0ed0fU, 0x000dea07U, 0x001de92fU, 0x00000000U,
+  0xf3eefafaU, 0x0919efe2U, 0xe5190115U, 0x00000000U, 0x06270109U, 0xea190c06U, 0x0a09111aU, 0x00000000U,
+  0xf4071edeU, 0x1ec10df4U, 0x401de624U, 0x00000000U, 0xfc09de18U, 0x0d0d0a10U, 0xccf6f3f1U, 0x00000000U,
+  0xe11f000bU, 0xed0e0024U, 0x000a000fU, 0x00000000U, 0x14f504e1U, 0x26d3fbf3U, 0x6fe3fcfdU, 0x00000000U,
+  0x05ec0800U, 0x13e6f600U, 0xbff2fd00U, 0x00000000U, 0x00f5f605U, 0x0020f732U, 0x00230a08U, 0x00000000U,
+  0x05e409edU, 0xd7160e0cU, 0x00341108U, 0x00000000U, 0x00fef602U, 0xf61d1efdU, 0x0ecffa15U, 0x00000000U,
+  0xfc0810e0U, 0x1fefffefU, 0x1a1dd94bU, 0x00000000U, 0xf2f60326U, 0x14f4fa1dU, 0xe7b703f2U, 0x00000000U,
+  0x0ae600fbU, 0xd92400faU, 0xee1d00d3U, 0x00000000U, 0xf9ea1110U, 0x0efc1012U, 0xd0ff0039U, 0x00000000U,
+  0x0ccefb00U, 0x050d0900U, 0x089c0500U, 0x00000000U, 0x000ff910U, 0x0002cef0U, 0x0004b703U, 0x00000000U,
+  0x22ec05feU, 0x30f7e6f9U, 0xe9f41fa9U, 0x00000000U, 0x00fe21eaU, 0xce191ec8U, 0xe75613f6U, 0x00000000U,
+  0xf5130ceeU, 0x3d09141cU, 0xe9a72729U, 0x00000000U, 0x2d18e8ffU, 0x0259f31eU, 0x4928bb03U, 0x00000000U,
+  0x20fb0005U, 0xf02900eeU, 0x0ff900dbU, 0x00000000U, 0x04f710feU, 0x04f61ae3U, 0xe5f4002bU, 0x00000000U,
+  0xf7a8fb00U, 0x081ceb00U, 0x0094f200U, 0x00000000U, 0x000df9fbU, 0x0008b5faU, 0x0008fe17U, 0x00000000U,
+  0x1cf00106U, 0x2907d007U, 0xbc04f2caU, 0x00000000U, 0x00031ceeU, 0xa7242dcaU, 0xe6260548U, 0x00000000U,
+  0xf110e6dcU, 0x2f1a1212U, 0xf2b92f00U, 0x00000000U, 0x1f10de0cU, 0xe37fea2eU, 0x32ebccfaU, 0x00000000U,
+  0x190000f0U, 0xf61500e3U, 0xeaf8000fU, 0x00000000U, 0x14f50000U, 0x07d713dfU, 0x19dd0818U, 0x00000000U,
+  0xf9c00e00U, 0x190aee00U, 0x21b02300U, 0x00000000U, 0x0013d901U, 0x00fcdd27U, 0x000a0529U, 0x00000000U,
+  0x05fae2faU, 0x1408cf12U, 0xe503f419U, 0x00000000U, 0xfc130cfbU, 0xd0144ed8U, 0xc3edea24U, 0x00000000U,
+  0xed0c04ecU, 0x22fb24f6U, 0x36e400e9U, 0x00000000U, 0x0b11e71fU, 0x017ad323U, 0xf71009efU, 0x00000000U,
+  0x0e0f00eeU, 0xed0a00f3U, 0x0ce40036U, 0x00000000U, 0x1800ea02U, 0x1ce504eaU, 0x10fa2203U, 0x00000000U,
+  0xffe9ff00U, 0x2307f000U, 0xf6b73100U, 0x00000000U, 0x0002f00dU, 0x00f7001aU, 0x001f0fedU, 0x00000000U,
+  0x0d06e0e2U, 0x2814c906U, 0xed262329U, 0x00000000U, 0x080f0807U, 0xef0f1cfbU, 0xe2ca241fU, 0x00000000U,
+  0xef0411bcU, 0x0eed13eeU, 0x2726bcf8U, 0x00000000U, 0xf218f72eU, 0xfe44e51eU, 0xc7fe27c8U, 0x00000000U,
+  0x162f00e0U, 0xf20000f0U, 0xf8d20016U, 0x00000000U, 0x29030de0U, 0x33dcf90cU, 0x302104f3U, 0x00000000U,
+  0xe1ddf000U, 0x28000c00U, 0xbbce2600U, 0x00000000U, 0x00fcf3d0U, 0x001f0c2aU, 0x001702beU, 0x00000000U,
+  0x1911e8caU, 0x22100308U, 0xf7401b0fU, 0x00000000U, 0xed100b08U, 0x061b2312U, 0xe7d4e213U, 0x00000000U,
+  0xf4f4facfU, 0x0bfa16e8U, 0x12429e2aU, 0x00000000U, 0xf51afd48U, 0xf50def03U, 0xb8d01bd0U, 0x00000000U,
+  0x14fc0008U, 0xd92c0009U, 0xfbe800fbU, 0x00000000U, 0x1dcf2216U, 0x16f42df4U, 0xffc52f31U, 0x00000000U,
+  0x0af90b00U, 0x0dfa1700U, 0xf5da1800U, 0x00000000U, 0x0000f0feU, 0x000ce613U, 0x00f7b3eeU, 0x00000000U,
+  0x0dddfff5U, 0x2607f107U, 0xd80aedb5U, 0x00000000U, 0x06043df1U, 0xe21f12f6U, 0xf05c09f1U, 0x00000000U,
+  0x0ff109f6U, 0x1933fc09U, 0x21b2ff0cU, 0x00000000U, 0x1630e700U, 0x06540525U, 0x3328cc00U, 0x00000000U,
+  0x20e4001bU, 0xcd2e0013U, 0x2ed00001U, 0x00000000U, 0x09e0ff17U, 0x12e71000U, 0xe2b9fa4fU, 0x00000000U,
+  0xfeec0b00U, 0xf4081300U, 0x2fc91000U, 0x00000000U, 0x00f40304U, 0x0000d50dU, 0x000603f3U, 0x00000000U,
+  0xe7e207d2U, 0x0f13eff9U, 0xc21e09f7U, 0x00000000U, 0xe50826fbU, 0xee2704e1U, 0x0743f70bU, 0x00000000U,
+  0x02d9fdd4U, 0x0e48190cU, 0x03b302f4U, 0x00000000U, 0xfa26ed0aU, 0xda41f93bU, 0x05ecfd03U, 0x00000000U,
+  0x03fb00feU, 0xc12600faU, 0x04e0002bU, 0x00000000U, 0x1bdef212U, 0xfff9fee8U, 0x11d2f812U, 0x00000000U,
+  0x0ddbf700U, 0xe5fcf800U, 0x38d74700U, 0x00000000U, 0x0000ecefU, 0x0019e61bU, 0x000f12d6U, 0x00000000U,
+  0xeceeffd2U, 0x0512f2f1U, 0x001d1941U, 0x00000000U, 0xf3f00ff4U, 0x01140becU, 0xd1e6e413U, 0x00000000U,
+  0x04f7efccU, 0x043127f6U, 0x06f5d1daU, 0x00000000U, 0xf218df19U, 0xe311f820U, 0x0cfa0eefU, 0x00000000U,
+  0x180a00e6U, 0xf51600deU, 0x26d40029U, 0x00000000U, 0x42faf9ffU, 0x1807f5f2U, 0x12ed09efU, 0x00000000U,
+  0x02b4ec00U, 0x00f0f900U, 0xf1bf3600U, 0x00000000U, 0x000f10e1U, 0x001ae318U, 0x00f012ceU, 0x00000000U,
+  0xec1200e7U, 0x2210ffe3U, 0x18332823U, 0x00000000U, 0xd300f9faU, 0xfd0d11f5U, 0xaab2f004U, 0x00000000U,
+  0xfeed10d6U, 0xfc042002U, 0x0b2ca0daU, 0x00000000U, 0xe8d50b03U, 0xe811030aU, 0xe1ee08e5U, 0x00000000U,
+  0x0a0900d5U, 0x0f0100efU, 0xfbc0000bU, 0x00000000U, 0x4ff307e9U, 0x1a16e90fU, 0x120e0de4U, 0x00000000U,
+  0xefd5fa00U, 0x0c0f1500U, 0xeea52200U, 0x00000000U, 0x001c12a4U, 0x000d1317U, 0x00ff2696U, 0x00000000U,
+  0x062404d7U, 0x1b0b17e7U, 0x07501324U, 0x00000000U, 0xe2ed06e5U, 0x1f0b0affU, 0xaee1f802U, 0x00000000U,
+  0x05f7dde4U, 0x1610130eU, 0xec34b20eU, 0x00000000U, 0xfafa0a06U, 0xc8f70befU, 0xb9c3fcd0U, 0x00000000U,
+  0xf3100015U, 0x021c00eeU, 0x231b0033U, 0x00000000U, 0x08f11f11U, 0xfb00110cU, 0x46defd2eU, 0x00000000U,
+  0x15f71a00U, 0x11ec1100U, 0x1ee12500U, 0x00000000U, 0x0006e406U, 0x00fb071cU, 0x00fceac9U, 0x00000000U,
+  0x17f0fc03U, 0x2313fdfeU, 0x1615e0faU, 0x00000000U, 0x041b39f6U, 0x03022303U, 0x02624efcU, 0x00000000U,
+  0x11ed12efU, 0x1427090cU, 0x06be0c03U, 0x00000000U, 0xd84ef424U, 0xf638f719U, 0x3044eb16U, 0x00000000U,
+  0xf8220039U, 0x03230011U, 0x59040000U, 0x00000000U, 0x08d9f52bU, 0x0104fd09U, 0x319fc755U, 0x00000000U,
+  0x21392c00U, 0xfe161a00U, 0x53133f00U, 0x00000000U, 0x001b01e0U, 0x00f4fa22U, 0x0032ffa5U, 0x00000000U,
+  0x051a0f07U, 0xf3f8090cU, 0x05380c08U, 0x00000000U, 0xe60e2bfeU, 0x0cfd20f2U, 0xf34f2403U, 0x00000000U,
+  0x01cd15e6U, 0x0a2df91bU, 0x17b1d3eeU, 0x00000000U, 0xe84af3f8U, 0xfd1cfd10U, 0xf3f8d3f4U, 0x00000000U,
+  0xf238003cU, 0xf6210008U, 0x55c900c7U, 0x00000000U, 0x40cfee0cU, 0xfa07fcf5U, 0x41daf714U, 0x00000000U,
+  0x051c0800U, 0x13010a00U, 0x3ef43f00U, 0x00000000U, 0x004911beU, 0x0013f324U, 0x002efb88U, 0x00000000U,
+  0x072207ecU, 0xd9e11a09U, 0x6121102fU, 0x00000000U, 0xccf1f9eaU, 0x1b0432f2U, 0xb010fcf6U, 0x00000000U,
+  0xffd931edU, 0x0f191501U, 0x21d9e3d6U, 0x00000000U, 0xf423f2c8U, 0x021cdbe8U, 0xfdd5ecfcU, 0x00000000U,
+  0x0f1e0020U, 0xf80400f2U, 0x44c900b5U, 0x00000000U, 0x79f50ce0U, 0xfafaf2f1U, 0x1a0007e4U, 0x00000000U,
+  0xf1e5d100U, 0x20ee1700U, 0xefb73800U, 0x00000000U, 0x0036ecb8U, 0x0028ff1fU, 0x00f0ea89U, 0x00000000U,
+  0x10200ad4U, 0xf5e72211U, 0x5248f92dU, 0x00000000U, 0xb800edeaU, 0x0e0016f5U, 0xbaeb07f5U, 0x00000000U,
+  0x04de1afcU, 0x020c2bf6U, 0x2c31e6edU, 0x00000000U, 0xe1eefde8U, 0x071103daU, 0xe9be0ae0U, 0x00000000U,
+  0x010f0008U, 0xf90e00ffU, 0x09c800c4U, 0x00000000U, 0x7ff80eeeU, 0x0c04fb11U, 0xf70205faU, 0x00000000U,
+  0xf5d5dc00U, 0x13f31b00U, 0x01b9e200U, 0x00000000U, 0x0026e4c0U, 0x00120e10U, 0x00d9e78dU, 0x00000000U,
+  0xfb2117e8U, 0x1cf01218U, 0x3042f901U, 0x00000000U, 0xc8eff5efU, 0x15ed0808U, 0xd3e3fcf0U, 0x00000000U,
+  0x0fe106eeU, 0x0f001806U, 0xfd03d2f7U, 0x00000000U, 0xeefd040bU, 0xe90e11f5U, 0xc8dffcd2U, 0x00000000U,
+  0xf8ed00f1U, 0xfa210009U, 0x04fe002aU, 0x0d060001U, 0xf6ff06f3U, 0x04ea121fU, 0x1f09022dU, 0x11e1ff11U,
+  0xfceff500U, 0x140a1300U, 0x00251500U, 0xfb0b2400U, 0x00dbd9eeU, 0x00fafa08U, 0x001f3907U, 0x00483819U,
+  0x06dfe4e3U, 0x0afae409U, 0xfc0d1432U, 0xeb301c21U, 0xf9f9f0ecU, 0xfc341aeaU, 0x080c01e0U, 0x04dc0009U,
+  0xcce8f8f2U, 0x29eb05ecU, 0xfbe9fefdU, 0x07fffb15U, 0xf2fb11fbU, 0xfe61f3fbU, 0xfcf9fcfcU, 0xfbf0fc0cU,
+  0xefc9000fU, 0x140e00d9U, 0x19f3000aU, 0x11ea00f9U, 0xe918f119U, 0x23ec3b06U, 0x3bec032cU, 0x2efaf8feU,
+  0xff04ce00U, 0x3d141300U, 0x0e1d1300U, 0x0b001000U, 0x00d5d2dbU, 0x000ef5b1U, 0x001c3ff6U, 0x002c2722U,
+  0x30d0fd02U, 0xf908dcd8U, 0x0d170520U, 0xfd1e1c27U, 0xeb2414eaU, 0xda3824f0U, 0x0d150de4U, 0x44efc6feU,
+  0xe8ff000fU, 0x38eddac8U, 0x041307fcU, 0x0341e0ffU, 0x03ec3b06U, 0xe17fc929U, 0xf41fed04U, 0x03de1e0aU,
+  0xd3c600f8U, 0x21fd00eaU, 0x1ff20002U, 0x022600ceU, 0xfb33e238U, 0x130f58fbU, 0x21e1ff11U, 0x25f011faU,
+  0x27f8b800U, 0x2ffeec00U, 0x04292000U, 0x00092d00U, 0x0000a1f8U, 0x00f703b1U, 0x00fa3c11U, 0x000c020bU,
+  0x40e101e1U, 0x091be8e6U, 0x0bfb0c16U, 0xf7110d24U, 0xd9401cd8U, 0xb4372d19U, 0x01020f0fU, 0x24fdceecU,
+  0xfed30f04U, 0x41e7bdd3U, 0x1626fcfcU, 0xfd30e2f0U, 0x271a17ebU, 0xdf61d207U, 0xe9ffdffaU, 0xf70700e9U,
+  0x95c9002bU, 0x35f70009U, 0x1bf400e4U, 0x181d0009U, 0xff09fe0aU, 0x0b0f42efU, 0x0ceef80eU, 0x23fc040dU,
+  0x27bdb100U, 0x4207c100U, 0x08112400U, 0x0bf92600U, 0x0000b209U, 0x00e603cdU, 0x00ea180dU, 0x00f105e7U,
+  0x2ccc3211U, 0x0b1edb0aU, 0x1910f7f7U, 0x09faf71bU, 0xe7f43fdfU, 0xb42f6910U, 0x13140a05U, 0x0105f8feU,
+  0x19eafd05U, 0x1cdfd5cdU, 0xfe0f2507U, 0xfa0f251dU, 0x33f8eaecU, 0x2f3deb10U, 0xebf8d50eU, 0xd710cd15U,
+  0xb7cc0042U, 0x1fee00f5U, 0xf50500d6U, 0x17150015U, 0x180f0bf2U, 0x13fd1902U, 0xfc16feebU, 0xf20b0103U,
+  0x23d8d900U, 0x40f9c900U, 0xfe121800U, 0xf517fd00U, 0x00dde734U, 0x0008fcdfU, 0x00ef0c2aU, 0x00d611f2U,
+  0x17ba480cU, 0xfa1bfae9U, 0x0cebdef7U, 0x05ededf2U, 0x17ef4407U, 0xda262efdU, 0x1427f701U, 0x0809fd06U,
+  0xec1607edU, 0x0cd2d3e1U, 0x002f130aU, 0x05100e16U, 0xfa1b09f7U, 0x1e01030dU, 0xfcf7e718U, 0x0910e411U,
+  0xe7e800d9U, 0xea2f0000U, 0x29060029U, 0x37010001U, 0xf305000fU, 0x43efffe6U, 0x291e0b30U, 0x18b4fc20U,
+  0xf5dccd00U, 0x2c3a0800U, 0xf91a1000U, 0xfdf02700U, 0x0006d1f5U, 0x00e00ee3U, 0x00233b00U, 0x00fcf912U,
+  0x11e1f9d6U, 0xf5e0c729U, 0xef1b1f38U, 0xbf40d239U, 0xefec1ce6U, 0xe61ffae8U, 0xfd1704f3U, 0x1deef403U,
+  0xf5dedf15U, 0x100a08e0U, 0xf00fe801U, 0x0bcffe28U, 0xd3d206feU, 0xdf720a2eU, 0xe40432f6U, 0x01efe9ffU,
+  0xeedd0000U, 0x050500eeU, 0x42ee001aU, 0x2b0b00f0U, 0xc53d1e12U, 0x3b012213U, 0x1ff41244U, 0x2afb1cf9U,
+  0xf4d1ca00U, 0x41450600U, 0x0a221700U, 0x2cfe1b00U, 0x00ece3ddU, 0x00c22accU, 0x000554ebU, 0x00ef120fU,
+  0x60f6f7e7U, 0x0cf1dc4eU, 0xf60f174cU, 0xdb1ccb37U, 0xea2056deU, 0xf5061ecfU, 0xe8f60afaU, 0x3bfaf206U,
+  0x12d2f624U, 0x314dd8d9U, 0xf81502fcU, 0x04e1ef11U, 0x20f915efU, 0x8d6bfb27U, 0xc3181f02U, 0xdf0bf0fbU,
+  0xdb9d00f8U, 0xc81a0003U, 0xfefa0000U, 0x062100dfU, 0xf22dca16U, 0x1dfe1afbU, 0xfd1c19ffU, 0x23fc0adbU,
+  0xecd6cc00U, 0x174f2000U, 0x13092900U, 0x24140900U, 0x001b850eU, 0x00b22003U, 0x00ca52f5U, 0x00d319f9U,
+  0x61f105eeU, 0x0aebec45U, 0x1520042bU, 0x0917e31eU, 0xf94626c4U, 0x0be136d1U, 0xf6f0fb28U, 0x1ee90023U,
+  0x2dc10652U, 0x2a20d7f1U, 0x12fde227U, 0xff0204f5U, 0x53f4eef8U, 0xbb5bdb0dU, 0xbcf727ffU, 0xe31b0005U,
+  0xe8be001fU, 0x07f800fcU, 0xe51700ccU, 0xfd0d0002U, 0x0316c4f2U, 0xe0111b0bU, 0xf314e200U, 0x16f1fa05U,
+  0x06d4cb00U, 0xf82a2500U, 0x02042600U, 0xf728fe00U, 0x0016a90fU, 0x00cf1e16U, 0x00e71df0U, 0x00d201f6U,
+  0x3ac02128U, 0x20f6011cU, 0x1afbf5f3U, 0x1602f50aU, 0x01fe28ddU, 0xd6f642f6U, 0x172ad217U, 0x0df22324U,
+  0x13dffc48U, 0x0917e9d6U, 0xfc0a1a31U, 0xf7140e0eU, 0xfcc80e08U, 0xcc41fbe2U, 0xccf1eb01U, 0xd92beff2U,
+  0xdc97001bU, 0x04c600c4U, 0xe3f400d0U, 0x18d600eeU, 0x0e35ef03U, 0xfd06fb15U, 0xcf13f6f4U, 0xd900e915U,
+  0x18f7ea00U, 0x3a043300U, 0xeb020f00U, 0x0bf80400U, 0x00d3e625U, 0x00d9190fU, 0x00d6efe8U, 0x00e3f2f4U,
+  0x25a352e1U, 0x15040ad9U, 0xf6fec1d5U, 0x06f6e7faU, 0x04d22b1eU, 0xfc102f00U, 0xf82bea1cU, 0xf40d312cU,
+  0xf707e9efU, 0x0ccf02e6U, 0x0c0d151bU, 0x00fcec05U, 0xf3f12b09U, 0x11fbf7e7U, 0xdbd8e419U, 0xed2de209U,
+  0xc8f500c1U, 0xf21d00f6U, 0x43fa000eU, 0x3f2f0014U, 0xe1091c0eU, 0x3ddfecbfU, 0x25f326f5U, 0x15effdeeU,
+  0x03b5c800U, 0x0ee10400U, 0x02f60800U, 0xfb0e2800U, 0x0011dceaU, 0x00dc2ce9U, 0x00125802U, 0x00da26e8U,
+  0x0bfa15c7U, 0x0c230536U, 0xe419fa4dU, 0xb20bb42bU, 0x0c052be5U, 0xd81eb6e4U, 0xe002defeU, 0x0c18c60bU,
+  0x2700db26U, 0x020d0f12U, 0x0d23d81aU, 0x32d006e0U, 0xe7faf1e8U, 0xc718354eU, 0x12171810U, 0xf20bf101U,
+  0xda0a00ceU, 0xc33900ecU, 0x2ae30025U, 0x250c0001U, 0xf0f809f6U, 0x1bfdffc4U, 0x02fb37ecU, 0x06fe07e6U,
+  0xf6bbeb00U, 0x1521f000U, 0x2ac31500U, 0x27431d00U, 0x0017d3d7U, 0x00e41513U, 0x0009391dU, 0x00de30ccU,
+  0xf904fdd4U, 0x2e43db44U, 0x0d250743U, 0x02f1e704U, 0x0121170fU, 0xfcf9cde7U, 0x08e003fbU, 0x21f0d81aU,
+  0x3034d63bU, 0x0f39270eU, 0x130bd70aU, 0x0623e7e5U, 0x0ff9e70bU, 0x9332311bU, 0xed121000U, 0xcd0e01dbU,
+  0xf5e700b5U, 0xeef800ebU, 0x05fb001eU, 0xf90e0000U, 0x1225ed15U, 0x20092ba6U, 0xd2f337ddU, 0xf50504dfU,
+  0xe4e60200U, 0xd44a0a00U, 0x32da1100U, 0x0f45fc00U, 0x001995fbU, 0x00053218U, 0x00f91ff3U, 0x00fe3ff3U,
+  0x050de1ceU, 0x452bd11bU, 0x092c2113U, 0x28f90401U, 0x3b2a12f7U, 0x18f7bbbaU, 0x18f80e00U, 0x0cf119fcU,
+  0x290c1459U, 0xfd083818U, 0x1701e80dU, 0xf30feaefU, 0x19e4cd0aU, 0xd91b0946U, 0xe72103f0U, 0xe729ffcaU,
+  0x22ba00f1U, 0x0ac100e2U, 0xf20500d6U, 0x01cd0025U, 0x2bf5db1cU, 0xfd1e1be3U, 0xddd52505U, 0x0b1c48fcU,
+  0x2fde0000U, 0x9f251700U, 0x0ae6e900U, 0xf24df400U, 0x0010c5d6U, 0x001b1a10U, 0x000cd2faU, 0x00ed1ce9U,
+  0x14120c34U, 0x2205f0b8U, 0x070efea9U, 0x31f2fd17U, 0x2713ef07U, 0x040ccbe6U, 0x2beedd01U, 0xf2d21ae6U,
+  0x2205e65aU, 0x0c0a2823U, 0x07d73831U, 0xfce7c607U, 0x15f71203U, 0xcae7ef1dU, 0xf307e727U, 0xe64510f7U,
+  0x059700ffU, 0x17e900cdU, 0xf32000e3U, 0x2acc00e3U, 0x1e2cd712U, 0xc90af1feU, 0xe9c03902U, 0xc31f2316U,
+  0x41e0f800U, 0xc90e3300U, 0x1009e700U, 0xf7133400U, 0x00e2fe0dU, 0x0000f725U, 0x000de70eU, 0x00f1f8d7U,
+  0x0c16150aU, 0x3cf3fec9U, 0xdf06b3bfU, 0x30f6d2f6U, 0xebdefb47U, 0x2823c913U, 0x1910d0eeU, 0x05060efdU,
+  0x100cdf1fU, 0x0b131704U, 0x03960623U, 0xfbe5f21cU, 0xcad939feU, 0xa9c6f3d9U, 0x32eef821U, 0xd8260d11U,
+  0xc9d800d2U, 0x01f100efU, 0x0e250002U, 0x1c320017U, 0xc2e33cfcU, 0x19cbe3c9U, 0x0cdc06d3U, 0x08f1cc94U,
+  0xf5b2df00U, 0xfc090000U, 0xfcc3fc00U, 0xff092a00U, 0x0032d2dbU, 0x00fc18edU, 0x00053e1eU, 0x00ee1bfeU,
+  0xd227e9d6U, 0xc41f2a22U, 0xd121d3f6U, 0xf90be226U, 0xfbfb2f01U, 0xe7dbf523U, 0xfb0d0003U, 0x1020a81eU,
+  0x02e8b14aU, 0xeeececdfU, 0x163bd720U, 0xf6081ff3U, 0x1c0d0ffbU, 0x05f30efdU, 0x3222fb0eU, 0x00ed062bU,
+  0x090900e6U, 0xf8ce00fbU, 0xea160034U, 0x0302001cU, 0xf50a111fU, 0x41e8f584U, 0x02d733f6U, 0xf520e781U,
+  0xfbe6f000U, 0xdc1bea00U, 0x13b50000U, 0x041d1600U, 0x001ac7e4U, 0x00ff7b0aU, 0x00f51b06U, 0x00fc61d7U,
+  0xcd16f1b3U, 0xd41b4533U, 0xdc1edceaU, 0x17230407U, 0x1f251c05U, 0x08ccfb1aU, 0x18f6eedfU, 0x1aefaffdU,
+  0x03f2d14fU, 0xf3f3f2f0U, 0x3710e338U, 0x0508ef27U, 0x00d9f5fbU, 0xedb14514U, 0x0e28e9f0U, 0xd0c91bfaU,
+  0xed2400daU, 0x10bc00f3U, 0xc4320027U, 0x04be0004U, 0x4221fd1dU, 0x3237f6acU, 0xf5e54200U, 0x012de5beU,
+  0x071cf600U, 0xcafcee00U, 0x01badc00U, 0xc509ee00U, 0x001fccf9U, 0x0012270eU, 0x00ebd61cU, 0x00053dfcU,
+  0xdbfdfdaeU, 0xc50a3cf0U, 0xa5f3ecb0U, 0x020a1ee3U, 0x3812e4faU, 0x09f9f428U, 0x320af3edU, 0x05f207f5U,
+  0x1ef00435U, 0x19fff401U, 0x28eefa1aU, 0x1d05ed2aU, 0x04d6d50cU, 0x04924f55U, 0xf40c082bU, 0x07a31802U,
+  0x0cf100d1U, 0xeedc00d4U, 0xc9040010U, 0x17ba00e2U, 0x6113c6f1U, 0x1348fbd1U, 0x08ef4702U, 0x182a12eeU,
+  0x10e4d900U, 0x9e07fa00U, 0xf6fee000U, 0xc0140000U, 0x0012efeeU, 0x0005f00bU, 0x0008df4bU, 0x000df00eU,
+  0xf41403b2U, 0xdefb01a3U, 0x81fdcf9cU, 0x0f1017ccU, 0x1cfba40fU, 0x001ef005U, 0x4821fe01U, 0xfef90b13U,
+  0x31ebee1eU, 0x0efe1a22U, 0x09a116f1U, 0x0cf7d729U, 0xf5caf520U, 0xf09026faU, 0x030ef74fU, 0x009809ecU,
+  0xf2ba00a1U, 0x25f300efU, 0x2d120009U, 0x49c300ebU, 0x6416c9e1U, 0xe910f5eaU, 0x17ca39edU, 0xfa1c0601U,
+  0x10e61700U, 0x9df90500U, 0xe114ec00U, 0xbffc1900U, 0x0016f8c9U, 0x00f609f8U, 0x00170ee0U, 0x0007f8eeU,
+  0x105eece7U, 0xe90cf0a0U, 0xb906c3c1U, 0x1007deccU, 0x02fac82cU, 0x181de612U, 0x281be4edU, 0x0afbef05U,
+  0x0c3af31dU, 0x02ebe408U, 0x0284f0dfU, 0x0f07f231U, 0xdbafedf8U, 0xd5ae0bf2U, 0x4bd2f05fU, 0xf5ade7e7U,
+  0x202200eaU, 0x07ee00d2U, 0xfd1900ffU, 0xf91f00f2U, 0xc6e81fffU, 0xddf717f6U, 0xcfe901e7U, 0x1de4e0b8U,
+  0xfcc70100U, 0x0012f800U, 0xf3e1f300U, 0xf71f1600U, 0x0010ead0U, 0x00e8fa13U, 0x00dc3225U, 0x000d16dfU,
+  0xd724c5e1U, 0xcacd0af5U, 0xcd07df03U, 0xe020eb0aU, 0xfb063df6U, 0xebc4fbf7U, 0x1100fa0dU, 0xe8f6cf0cU,
+  0x18d9d722U, 0xf2fdede2U, 0x2617f813U, 0xf7f127f4U, 0x211107f3U, 0xedecf7f2U, 0x0828e621U, 0xf4d20912U,
+  0x36fd00e9U, 0x2dea0019U, 0xf20d0002U, 0xfbde000dU, 0x1ae81a06U, 0xfe023ec8U, 0xe9d72aecU, 0x2a30f3a5U,
+  0xf1fde900U, 0xd433e300U, 0xc4dfda00U, 0xe41eef00U, 0x0013c2bdU, 0x00df120bU, 0x00bd1258U, 0x00031df9U,
+  0xe20ee5d7U, 0xa1af2708U, 0x92f2efcfU, 0x191616fcU, 0x0c2c1f08U, 0x1cf3fef8U, 0x4423e4e4U, 0x10ebc5f5U,
+  0x38ded63bU, 0x04f9dde4U, 0x27fff108U, 0x033e0d15U, 0x11f2dfefU, 0x26f405eaU, 0x0816d92fU, 0x02ae150fU,
+  0x19e900a6U, 0x2ef00035U, 0xfef6000fU, 0x109c00e7U, 0x1e0505f1U, 0x0a0b2eedU, 0x00e01f07U, 0xe821edbbU,
+  0xeff7fd00U, 0xd4410800U, 0xdff0d700U, 0xb1e2f400U, 0x000cd6b2U, 0x00ea11f0U, 0x00d9e03cU, 0x00f3c7e1U,
+  0x01fff6b5U, 0xd3c049eaU, 0x86ddfb9eU, 0xea0b2be6U, 0xee32ee05U, 0x110f1002U, 0x423f05d1U, 0x0a35e3eaU,
+  0x4ef0fe39U, 0x16efe6eaU, 0x18c3f3e5U, 0x1a3b0120U, 0x10b8d9ffU, 0x400929f7U, 0x04f8e624U, 0x1d8a0d02U,
+  0x09d90081U, 0x0de90030U, 0x14e90002U, 0x1cc000ccU, 0x13f5d5dcU, 0xef0b29daU, 0x2de2f210U, 0xf002efdcU,
+  0x09cf0400U, 0xd21e1e00U, 0xc316ed00U, 0xa8f6ff00U, 0x0003bad0U, 0x00fd31e3U, 0x00ff070dU, 0x00e6d6dbU,
+  0x0b0eedb2U, 0x01f125f7U, 0x9ecbf9aeU, 0xf7180bd9U, 0x1718e20aU, 0xff13f4e5U, 0x2f3c1de2U, 0xfd39fce2U,
+  0x3c000f0fU, 0xf1f40ff8U, 0x02a40ad6U, 0x16f10311U, 0x04a7dce0U, 0x33ec20e6U, 0x1ec9e81cU, 0x1b9c0804U,
+  0xded60089U, 0x1edc0035U, 0x7ef00002U, 0x2bc600f1U, 0x2705d2fbU, 0xe2ff18f6U, 0x29e0f1f6U, 0xe514ecfaU,
+  0xf3e41900U, 0xeffa0b00U, 0xf30a1500U, 0xd3fc1400U, 0x00ddd796U, 0x00fff7ebU, 0x00f81ae0U, 0x00e5e8eaU,
+  0x314eeabdU, 0xf4f80df1U, 0xa3e806e1U, 0x1116f7e3U, 0xed12e8f5U, 0xf8070bebU, 0xf50806e7U, 0xeb26fde5U,
+  0x30171424U, 0xfbbe0e08U, 0x028ed5e3U, 0x14f5fd01U, 0xf7bcfbe9U, 0xfcfb05fdU, 0x2bdcfe07U, 0x0bc2f9e6U,
+  0x13fc0002U, 0x00fc00fcU, 0x12380014U, 0x00000000U, 0x0aec01f7U, 0x25f6f9faU, 0x02f30cddU, 0x00000000U,
+  0x0cfbea00U, 0xff151e00U, 0x01fe2800U, 0x00000000U, 0x00fef3f8U, 0x002c06f2U, 0x00ed14f5U, 0x00000000U,
+  0x020af3faU, 0x041a0f29U, 0x0cfdd51fU, 0x00000000U, 0xfdfa1510U, 0x051edeeeU, 0x0409f416U, 0x00000000U,
+  0x0915fb00U, 0xfde630fcU, 0x150505e5U, 0x00000000U, 0x0b14fa06U, 0x11e2100aU, 0xfa3ae7fdU, 0x00000000U,
+  0x0bf40005U, 0x102800caU, 0x174800e8U, 0x00000000U, 0xf4fc09f6U, 0x45e4f2f1U, 0xfffc39d6U, 0x00000000U,
+  0x03f7ef00U, 0xf6072f00U, 0x0e3f3000U, 0x00000000U, 0x0005eb19U, 0x002e0cf1U, 0x00e8ebbeU, 0x00000000U,
+  0xff0a1001U, 0xdd14d625U, 0x1dffd6fdU, 0x00000000U, 0xfaff04feU, 0xfff7f1feU, 0xdffefe14U, 0x00000000U,
+  0x10fdeffdU, 0xe1c83a06U, 0x3807eed8U, 0x00000000U, 0xfefb1500U, 0x22cfff11U, 0xe768c41cU, 0x00000000U,
+  0x09fe0002U, 0x031100b3U, 0x394000c4U, 0x00000000U, 0xf3f60c0cU, 0x330deefcU, 0xf2133806U, 0x00000000U,
+  0xf9ecf000U, 0xdbc71d00U, 0x1d471400U, 0x00000000U, 0x00f0f20fU, 0x002e01bcU, 0x00ed0396U, 0x00000000U,
+  0x281518f3U, 0xa80e0efdU, 0x1f17dfe3U, 0x00000000U, 0x02050000U, 0x0fd9faf5U, 0xd10b0513U, 0x00000000U,
+  0x081004f8U, 0xedce2436U, 0x26f0f2e5U, 0x00000000U, 0x00080b03U, 0x03de0013U, 0xfc51d914U, 0x00000000U,
+  0x152900fbU, 0x0bfd00b4U, 0x570400caU, 0x00000000U, 0x04f005f7U, 0x121dfa05U, 0x2724161bU, 0x00000000U,
+  0xfeed1000U, 0xe1c92300U, 0x3653dd00U, 0x00000000U, 0x00fc0203U, 0x0053fccfU, 0x00fa07b5U, 0x00000000U,
+  0x2008f7dbU, 0xcd1a1ff3U, 0x4b3721d6U, 0x00000000U, 0xf907fa09U, 0xfdccf0eaU, 0xd7314effU, 0x00000000U,
+  0x0d090aecU, 0x11cbf747U, 0x32cfd5fbU, 0x00000000U, 0xfd06ff07U, 0xefdc2c09U, 0x2a4803e5U, 0x00000000U,
+  0x201000d7U, 0x41fc00d0U, 0x71ec00e8U, 0x00000000U, 0x05f50a0aU, 0xfc03f3fdU, 0x420c0b33U, 0x00000000U,
+  0x01dd2700U, 0xf7f50a00U, 0x2807d400U, 0x00000000U, 0x000e0718U, 0x002d0cdeU, 0x0011fedcU, 0x00000000U,
+  0x111901f5U, 0xee0afd0aU, 0x414557e2U, 0x00000000U, 0x04ee0f08U, 0x10ddf3f5U, 0xe4015a0cU, 0x00000000U,
+  0x0f00ea07U, 0x06ede716U, 0x10d8ddf3U, 0x00000000U, 0x0b200e08U, 0x09ec26eaU, 0x1d410f00U, 0x00000000U,
+  0xf11000f5U, 0x1a1800faU, 0xe23f002eU, 0x00000000U, 0x01f40be7U, 0x43ec12f7U, 0x19f60bfbU, 0x00000000U,
+  0xf3ebfd00U, 0xfa062800U, 0x0a383400U, 0x00000000U, 0x00f1fff6U, 0x00310ff2U, 0x00da1f00U, 0x00000000U,
+  0x0405e40bU, 0xf237fc02U, 0x04e9c444U, 0x00000000U, 0xf3050d08U, 0x030bef00U, 0xf5f3f7ffU, 0x00000000U,
+  0x19f70cf9U, 0xf5e80307U, 0xf6071fe4U, 0x00000000U, 0x070afc0cU, 0x2604e805U, 0xca35f319U, 0x00000000U,
+  0x01f700fbU, 0x193500c0U, 0xd06400ffU, 0x00000000U, 0xfffb04eeU, 0x56dcfee1U, 0xf7f01fe8U, 0x00000000U,
+  0xf6daf500U, 0xe4e01a00U, 0x08452300U, 0x00000000U, 0x00e7f90dU, 0x0038040aU, 0x00ed01ebU, 0x00000000U,
+  0xfb06e908U, 0xe120e81aU, 0x03f3a037U, 0x00000000U, 0x09fd1502U, 0x1314d518U, 0xf9edc7ebU, 0x00000000U,
+  0x07f204fbU, 0xf1ea2504U, 0xf62729dcU, 0x00000000U, 0xf823230eU, 0x0fdeee19U, 0x8330e41aU, 0x00000000U,
+  0x0ae800f1U, 0x1c2e00e1U, 0xd77f00caU, 0x00000000U, 0xebf6fcfdU, 0x4011ebd0U, 0xda0b50dbU, 0x00000000U,
+  0xfdcdfb00U, 0xded52300U, 0x151b1c00U, 0x00000000U, 0x001cec11U, 0x0020e8faU, 0x00e0fcdfU, 0x00000000U,
+  0x09f2f4f8U, 0xe525dbf6U, 0x0dface1bU, 0x00000000U, 0x01ee10f8U, 0x25fcfd15U, 0xe2fb22cbU, 0x00000000U,
+  0xf5fbf60eU, 0x3e15181dU, 0x0b2afedfU, 0x00000000U, 0xeaff1511U, 0x1ef7f228U, 0xd359f3eeU, 0x00000000U,
+  0x0a0600eaU, 0x294900c3U, 0x1d4100d4U, 0x00000000U, 0xe6f10febU, 0x0ef5eff4U, 0xed220ff9U, 0x00000000U,
+  0xf2effb00U, 0xcecf0800U, 0x1913f000U, 0x00000000U, 0x000809feU, 0x002fe114U, 0x00e7ddfcU, 0x00000000U,
+  0x0ffe00ffU, 0xb825fbe6U, 0x1e1a0d09U, 0x00000000U, 0x0af9fdf9U, 0x32f3e0ecU, 0xc90b3fb0U, 0x00000000U,
+  0x12120bf9U, 0x3403df30U, 0x3016c5f7U, 0x00000000U, 0xeefa1607U, 0xebe7103cU, 0xfc4b0ed4U, 0x00000000U,
+  0x253200fdU, 0x422e00faU, 0x400200e1U, 0x00000000U, 0xe0ff28edU, 0xf0e8f603U, 0x22131a37U, 0x00000000U,
+  0xf4ec2100U, 0xd3e7f900U, 0x25400100U, 0x00000000U, 0x00081529U, 0x002809f9U, 0x00e61b06U, 0x00000000U,
+  0x141b1df5U, 0x8721f317U, 0x243823f3U, 0x00000000U, 0x00e62705U, 0x1305f1e6U, 0xeee157d6U, 0x00000000U,
+  0x153dedeaU, 0x12cfd207U, 0x0aeae404U, 0x00000000U, 0xf43627ffU, 0x03fff713U, 0x2e4411efU, 0x00000000U,
+  0xed0200e9U, 0x271b00f7U, 0xf00b002dU, 0x00000000U, 0xfdfbf2fbU, 0x1ffb1508U, 0x2ce1fcf7U, 0x00000000U,
+  0xfde6ff00U, 0xe72d2500U, 0x1b1d1d00U, 0x00000000U, 0x00fdeafeU, 0x00fb03e8U, 0x00ef4b17U, 0x00000000U,
+  0xf7fddbf9U, 0xf42ce0ebU, 0xeb0c004dU, 0x00000000U, 0xff0210feU, 0xeaf3e7f9U, 0x0b0ddafbU, 0x00000000U,
+  0x0bd908eaU, 0xfefa1231U, 0xe4fc49e9U, 0x00000000U, 0x01f7ee0eU, 0xff04eb12U, 0xca111a35U, 0x00000000U,
+  0x08fd00f0U, 0x131d00daU, 0x040e0005U, 0x00000000U, 0x08edfce2U, 0x1cf80feeU, 0x0ff904faU, 0x00000000U,
+  0xe9e9e900U, 0xe80b2000U, 0x02140e00U, 0x00000000U, 0x00fcec18U, 0x0011eef5U, 0x00f93c25U, 0x00000000U,
+  0xd4f7f9fbU, 0x040ac4eeU, 0x2de1f83dU, 0x00000000U, 0xf50c1903U, 0x12ebe60eU, 0x1115cae6U, 0x00000000U,
+  0xf6dcf9e3U, 0x03eff407U, 0xdd364edcU, 0x00000000U, 0xe7121a18U, 0xe4f6f20dU, 0xa8fd180aU, 0x00000000U,
+  0x0bec00ceU, 0x082500e2U, 0xe60600edU, 0x00000000U, 0xeafd08edU, 0xeb0d0adeU, 0xdc0e0edfU, 0x00000000U,
+  0xfaead800U, 0x00cf2600U, 0xe01a1b00U, 0x00000000U, 0x0004f40bU, 0x0020d4c8U, 0x00f9f314U, 0x00000000U,
+  0xf01913d4U, 0x05f5e8f2U, 0x35e3de3eU, 0x00000000U, 0x1603ff06U, 0xf2171503U, 0xf81ae2c6U, 0x00000000U,
+  0x06db0320U, 0x31e4f100U, 0xfd412cc5U, 0x00000000U, 0xc42110fcU, 0x0a081f15U, 0xc0f2ea12U, 0x00000000U,
+  0x38fd00e8U, 0xf74500e0U, 0xda020000U, 0x00000000U, 0xe4f30bf4U, 0xf5f6f2feU, 0xcb0ffc15U, 0x00000000U,
+  0xfbe0dc00U, 0xecb7f900U, 0xf20b0900U, 0x00000000U, 0x00fdf5f9U, 0x002eefd1U, 0x00df122eU, 0x00000000U,
+  0x2d1819c9U, 0xf3e71ceaU, 0x2cd4ef31U, 0x00000000U, 0xeef118f4U, 0xf22e33faU, 0xcf0635cdU, 0x00000000U,
+  0x1afb2801U, 0x2acf05f1U, 0x1924e1c3U, 0x00000000U, 0xe1ec09deU, 0x10fb233eU, 0xf926ddedU, 0x00000000U,
+  0x39f8001cU, 0x08300011U, 0xdeff00e1U, 0x00000000U, 0xdbef16e1U, 0xfcde0305U, 0x020e1505U, 0x00000000U,
+  0x05dafa00U, 0xe1e70e00U, 0x132bfe00U, 0x00000000U, 0x0004f92cU, 0x002f01daU, 0x00c83b34U, 0x00000000U,
+  0x200f5613U, 0xa3eaea24U, 0x2af3fc3fU, 0x00000000U, 0xd0d64412U, 0x052a0decU, 0xc9d446fdU, 0x00000000U,
+  0x0a60f7deU, 0x17b1d5e7U, 0xf60cd1ceU, 0x00000000U, 0xee231adbU, 0x19f6135dU, 0x1825fdc8U, 0x00000000U,
+  0x080c00faU, 0x213c0003U, 0x1fe0000cU, 0x00000000U, 0xe6ecf418U, 0x281b1106U, 0x15f90d04U, 0x00000000U,
+  0x04290e00U, 0xfb362600U, 0xf51a0600U, 0x00000000U, 0x0010f1e8U, 0x00f30cebU, 0x00012b1bU, 0x00000000U,
+  0x10e7ecffU, 0x10ebfcdfU, 0xf003d823U, 0x00000000U, 0xf7050c02U, 0x0205f3f9U, 0xf8f7f319U, 0x00000000U,
+  0x06e80be0U, 0x1f2b1a1cU, 0xe7df02edU, 0x00000000U, 0x1105f4f9U, 0xee01e9f0U, 0xf104ff0dU, 0x00000000U,
+  0x042100eaU, 0x0e3c00d2U, 0x31c000f6U, 0x00000000U, 0xefebea15U, 0x043a0dd2U, 0x2f01fddbU, 0x00000000U,
+  0xeb06f700U, 0x04443000U, 0x1819ed00U, 0x00000000U, 0x0002f60dU, 0x0007eef2U, 0x00f942e3U, 0x00000000U,
+  0xdfd9fdf3U, 0x20e3f1f4U, 0x2dfde82dU, 0x00000000U, 0xe10201fcU, 0x24edfaf1U, 0x08e5ed1cU, 0x00000000U,
+  0xf6f20ed1U, 0x182f180dU, 0xe1f606f3U, 0x00000000U, 0x3005fd10U, 0xfff016e3U, 0xe3e90d22U, 0x00000000U,
+  0xe50f00d1U, 0xff1b00c4U, 0x4cd800e1U, 0x00000000U, 0xd301d60cU, 0xde6302e7U, 0xe2e4f5e0U, 0x00000000U,
+  0xe600df00U, 0xf6471500U, 0xf8020700U, 0x00000000U, 0x0006e137U, 0x00d7f0daU, 0x00df03f0U, 0x00000000U,
+  0xcbff12e0U, 0x1fccf5e9U, 0x1bf2e62fU, 0x00000000U, 0xd80cf9e5U, 0x2b0e28c5U, 0xed040aeaU, 0x00000000U,
+  0xf1e10ff8U, 0x21f9f8e8U, 0xf00cebf3U, 0x00000000U, 0x41fd0911U, 0x191311e0U, 0x08d81e08U, 0x00000000U,
+  0x000700fcU, 0xf72400d8U, 0x23ce00bcU, 0x00000000U, 0xdedce6feU, 0xda4c030eU, 0xc414d0f1U, 0x00000000U,
+  0xff08df00U, 0xf9131100U, 0x071d3000U, 0x00000000U, 0x0014003dU, 0x00e9e4cdU, 0x00c62108U, 0x00000000U,
+  0xfc2a01f7U, 0xfdac03efU, 0x1bccec15U, 0x00000000U, 0xe5effaedU, 0x3b4031dbU, 0xe5f228e3U, 0x00000000U,
+  0xeae819f7U, 0x23c920faU, 0x2115cbceU, 0x00000000U, 0x1df3ebe9U, 0x0b100434U, 0xdd03eee4U, 0x00000000U,
+  0x1ff50038U, 0x0bfe00f8U, 0xe9d600d9U, 0x00000000U, 0xf6091001U, 0xc6272923U, 0xf213e1f3U, 0x00000000U,
+  0x3be1ef00U, 0x0ef71000U, 0x112e2e00U, 0x00000000U, 0x00113722U, 0x00c6e2b7U, 0x00db240cU, 0x00000000U,
+  0x403a4758U, 0xde91071fU, 0x3ddef62eU, 0x00000000U, 0xb5cb43fbU, 0x19162ef8U, 0xdae938fbU, 0x00000000U,
+  0x095fefdbU, 0x1bdef703U, 0xe41dd2beU, 0x00000000U, 0xed2dfd9bU, 0x2b0e1349U, 0xfe1ae8d8U, 0x00000000U,
+  0xfd08001eU, 0x132200e7U, 0x0e03000fU, 0x00000000U, 0xbd17fd2fU, 0x050e0ae1U, 0x2de40bf5U, 0x00000000U,
+  0x081b1500U, 0xfd3c0600U, 0xec5a0800U, 0x00000000U, 0x00fddff1U, 0x00f10e09U, 0x00030aecU, 0x00000000U,
+  0x32e1eb10U, 0xf2d306d7U, 0xf4010800U, 0x00000000U, 0xf91c23fbU, 0x1ed6a6e7U, 0xf7e7f515U, 0x00000000U,
+  0xf9f91f03U, 0x0c2b20f9U, 0xfad314e6U, 0x00000000U, 0xe81eff06U, 0xf2ddde03U, 0x01f5110bU, 0x00000000U,
+  0xfb000025U, 0xe52b00beU, 0x2f000010U, 0x00000000U, 0xd205e62eU, 0xdd5636d1U, 0x5cec17efU, 0x00000000U,
+  0x3f342900U, 0x03080100U, 0xf51eee00U, 0x00000000U, 0x00fce50eU, 0x00e9091eU, 0x000b07b8U, 0x00000000U,
+  0x18c8f226U, 0xfaa016f0U, 0x3a15dcfaU, 0x00000000U, 0xe8fe24efU, 0x33c0b6c1U, 0xfbfd0413U, 0x00000000U,
+  0x0014eee3U, 0xfc3a35d2U, 0xf6c1f9f0U, 0x00000000U, 0x1c1113e9U, 0x21f4f7ffU, 0xccfc1611U, 0x00000000U,
+  0xd5150035U, 0xb80700a6U, 0x4dea00f2U, 0x00000000U, 0xe7f3cb17U, 0xe16a0407U, 0x3ff7d8eaU, 0x00000000U,
+  0x3e374900U, 0xd8f91600U, 0x00f6f800U, 0x00000000U, 0x001bf602U, 0x00a40a11U, 0x00de06bfU, 0x00000000U,
+  0xe1cd0262U, 0xe78611edU, 0x3e22f0ecU, 0x00000000U, 0xeefb18efU, 0x2af7e1ccU, 0xf200f3fdU, 0x00000000U,
+  0xfe12e2c2U, 0xf820fbf6U, 0x16e2f6f1U, 0x00000000U, 0x1f09f6e3U, 0x35090525U, 0xaff2f82bU, 0x00000000U,
+  0xa00b0018U, 0xbb1200b6U, 0x36ab00c6U, 0x00000000U, 0x1bdae4f6U, 0xb20a083dU, 0x1105dad6U, 0x00000000U,
+  0x6c413500U, 0xd91f1600U, 0xf4311700U, 0x00000000U, 0x002746f6U, 0x00b5fc38U, 0x00e416bdU, 0x00000000U,
+  0x1317fd7fU, 0xd98d00fdU, 0x390efcf5U, 0x00000000U, 0xde020ff9U, 0x4d3b0ce0U, 0xea06efeeU, 0x00000000U,
+  0xdffa05c1U, 0x12e7db29U, 0x0d081ce8U, 0x00000000U, 0x1b2af0bcU, 0x14fe0042U, 0xc3cf0314U, 0x00000000U,
+  0xb9fd0001U, 0xf70200e3U, 0x22e500d3U, 0x00000000U, 0x26260cf5U, 0x9bfb242dU, 0x210eeeeaU, 0x00000000U,
+  0x44110f00U, 0x151f2900U, 0x06361300U, 0x00000000U, 0x002b54f0U, 0x00bb03d5U, 0x00fe09d4U, 0x00000000U,
+  0x52571e6cU, 0x0b81f505U, 0x5e0b03faU, 0x00000000U, 0xa6fd1b24U, 0x2b420d03U, 0xe4f00617U, 0x00000000U,
+  0x044bfbf9U, 0x07e3d4eeU, 0xf71df1f5U, 0x00000000U, 0xdc4a0bb4U, 0x2c280538U, 0xd2f109efU, 0x00000000U,
+  0x10fa00faU, 0x06e700f9U, 0xedda00fbU, 0x00000000U, 0xf8fefb15U, 0x2d190e0fU, 0xf5edfbdfU, 0x00000000U,
+  0xfc0ffc00U, 0xf749f300U, 0xfbe01000U, 0x00000000U, 0x0002f2e4U, 0x0009f5e2U, 0x002ff0e7U, 0x00000000U,
+  0xfdf9faf4U, 0x0129211cU, 0xf1e3ee03U, 0x00000000U, 0x040bf102U, 0xfdcfed11U, 0x00eaf7e8U, 0x00000000U,
+  0xf1f60710U, 0xbc301103U, 0x04d6f016U, 0x00000000U, 0x00e112ffU, 0x13d52111U, 0xfde9f8f5U, 0x00000000U,
+  0x080200f7U, 0xfeec00e1U, 0xf5030005U, 0x00000000U, 0xf310f212U, 0x1625f806U, 0x000603cdU, 0x00000000U,
+  0xe3fefc00U, 0xc42cf100U, 0xebeff900U, 0x00000000U, 0x0003f710U, 0x000bc5efU, 0x001fe7f6U, 0x00000000U,
+  0xd80911f5U, 0x04211036U, 0xdaf51eebU, 0x00000000U, 0x0f1af00dU, 0x15d80901U, 0xe5f207e4U, 0x00000000U,
+  0xf2e00e26U, 0xae1316f3U, 0x05c4eb15U, 0x00000000U, 0x24c81febU, 0x028b2112U, 0x0abe1001U, 0x00000000U,
+  0x050100fcU, 0xf01e00aeU, 0x0d040013U, 0x00000000U, 0x010be700U, 0x1a3df3f0U, 0x03e7f2ccU, 0x00000000U,
+  0xef1e0100U, 0xcb2b0200U, 0xc3ed0400U, 0x00000000U, 0x001de810U, 0x001dd9d6U, 0x0016d525U, 0x00000000U,
+  0xc107fbdeU, 0xe41f2900U, 0xa4100cfdU, 0x00000000U, 0x1e12f203U, 0x3ed4f4f4U, 0xed2903e0U, 0x00000000U,
+  0x05f21633U, 0xbf1a11ebU, 0x0ecad20cU, 0x00000000U, 0x2aa5f5f1U, 0x3cd3281bU, 0x02aafeeeU, 0x00000000U,
+  0x0af40009U, 0xec1600b6U, 0xf30e0011U, 0x00000000U, 0x15f9e00cU, 0x2627e90cU, 0x02fcf5edU, 0x00000000U,
+  0xee03fc00U, 0xdc17f100U, 0xe6e41600U, 0x00000000U, 0x0029f90fU, 0x00f6cef4U, 0x001be235U, 0x00000000U,
+  0xc4fe19f8U, 0xe8f512eaU, 0xb6f1f203U, 0x00000000U, 0x1f13e902U, 0x59c3c1e4U, 0x1312f1f2U, 0x00000000U,
+  0x03fc1d33U, 0xd8142525U, 0x04dc270eU, 0x00000000U, 0x0ebbf4d5U, 0x33e60103U, 0xe0dbd9e7U, 0x00000000U,
+  0x10e90010U, 0xd70500c5U, 0xde110041U, 0x00000000U, 0x1000f9f7U, 0xf70bebf6U, 0xeae402e3U, 0x00000000U,
+  0xdf0b1900U, 0xecfd1000U, 0xffff0b00U, 0x00000000U, 0x00230317U, 0x00f4ddfbU, 0x000b0911U, 0x00000000U,
+  0xf2f51c12U, 0xd5f0e4fcU, 0xdff9df30U, 0x00000000U, 0x1e07e2f9U, 0x2ff1f50bU, 0x0a1ad4f8U, 0x00000000U,
+  0x0c053630U, 0x133b0921U, 0x01f23600U, 0x00000000U, 0xf7c300f0U, 0xf607e7eaU, 0xe5d105ebU, 0x00000000U,
+  0xfff00002U, 0xfe0600efU, 0xefff00fbU, 0x00000000U, 0xe9090816U, 0x0a2a14f0U, 0xf7f1fdeeU, 0x00000000U,
+  0xf60e0800U, 0xe930f000U, 0xf5c32900U, 0x00000000U, 0x0005dcf6U, 0x00c9ffe5U, 0x003dc5e2U, 0x00000000U,
+  0xe2fa1de0U, 0x0335d1f2U, 0xdaf916e4U, 0x00000000U, 0x0a1ee8f6U, 0x0ae6f30aU, 0xff0403ecU, 0x00000000U,
+  0xfce2ed1aU, 0x052ae514U, 0x50d5f842U, 0x00000000U, 0x14e504edU, 0x12e502faU, 0x1bd8edfcU, 0x00000000U,
+  0x04ff0012U, 0xfffa00f1U, 0xfd0500dbU, 0x00000000U, 0xec030c10U, 0xf522f7ffU, 0x14f10af1U, 0x00000000U,
+  0xfaf41b00U, 0xfb25fd00U, 0xf2be1d00U, 0x00000000U, 0x000ef5fbU, 0x00b0e9f2U, 0x0033ba05U, 0x00000000U,
+  0xc81b19cfU, 0x2106d70cU, 0xa01318faU, 0x00000000U, 0x052cd528U, 0x60f4d806U, 0xf31cc9f0U, 0x00000000U,
+  0xf8daf423U, 0xe121d715U, 0x3aace12aU, 0x00000000U, 0x3edaf5f9U, 0x14bc22f8U, 0x35dfd0fbU, 0x00000000U,
+  0xf50a0022U, 0x131000caU, 0x0afc00eeU, 0x00000000U, 0xe30a0401U, 0xea40f2f2U, 0x19def8e3U, 0x00000000U,
+  0x10081700U, 0x0a20e800U, 0x10cc1600U, 0x00000000U, 0x0023edf1U, 0x00cbc5ffU, 0x0046c016U, 0x00000000U,
+  0xb2171acaU, 0xf7d20fcfU, 0x962d1bf7U, 0x00000000U, 0x0416e229U, 0x4ae0ded4U, 0x1a39c0ceU, 0x00000000U,
+  0x1df1ee18U, 0xcd30141fU, 0x1bbde518U, 0x00000000U, 0x1dce07ebU, 0x26c4490fU, 0x30b50ef9U, 0x00000000U,
+  0xfbdc002fU, 0xed0300e6U, 0xfe080014U, 0x00000000U, 0x0ff8f20bU, 0xf400e1e1U, 0x2ae4f0c9U, 0x00000000U,
+  0x23f60300U, 0x1c03d200U, 0x11d3f600U, 0x00000000U, 0x0035eef8U, 0x00e5d2fcU, 0x0011b90aU, 0x00000000U,
+  0xea1d1bf4U, 0xe9b003e2U, 0xb529f7d1U, 0x00000000U, 0x1930f602U, 0x3dcfe4dcU, 0x0c27cf05U, 0x00000000U,
+  0x11fde623U, 0x0620392aU, 0x1ae01128U, 0x00000000U, 0x0fe103dcU, 0x21fbf71fU, 0xfddffaebU, 0x00000000U,
+  0xefbd001dU, 0xa8f4000aU, 0x08090027U, 0x00000000U, 0x00fcebfbU, 0xbee904e2U, 0xf4d4e8e7U, 0x00000000U,
+  0xf7ed0d00U, 0x42100300U, 0xe6efeb00U, 0x00000000U, 0x00200810U, 0x00dfe80eU, 0x0039ee1eU, 0x00000000U,
+  0xfe1f2a00U, 0xe2cacee9U, 0x9226cf09U, 0x00000000U, 0x0e01ee18U, 0x17f8fafcU, 0x2841d2feU, 0x00000000U,
+  0x1800ef2fU, 0x115e0e39U, 0x0d1af22aU, 0x00000000U, 0x09ad0ed7U, 0x072bd0f7U, 0xe8c0e10eU, 0x00000000U,
+  0xf4f700f2U, 0xe31a0008U, 0xdd0c0005U, 0x00000000U, 0xe6e40b22U, 0xd423e4daU, 0xd3e0fe36U, 0x00000000U,
+  0xf2030000U, 0xf456f100U, 0x0dca3100U, 0x00000000U, 0x000bd714U, 0x00c0d3e8U, 0x00fd87edU, 0x00000000U,
+  0xb6fc0ad2U, 0x0610d5e2U, 0xb111f4e1U, 0x00000000U, 0x030ff60bU, 0x3bf2e9f4U, 0xfd2918f3U, 0x00000000U,
+  0x0fcde931U, 0x231ff50bU, 0x5395d868U, 0x00000000U, 0x24f0e0f2U, 0x24daeae2U, 0x101bdff3U, 0x00000000U,
+  0x04fb001fU, 0x17f80008U, 0xedc600ffU, 0x00000000U, 0xf4d91621U, 0xc64dc5d1U, 0xecd620f7U, 0x00000000U,
+  0x02ddf800U, 0x08480800U, 0x15ba1200U, 0x00000000U, 0x000fe90fU, 0x00e4d908U, 0x00fd85eaU, 0x00000000U,
+  0xab060fd6U, 0x4ddff5efU, 0xa541f1e0U, 0x00000000U, 0x1c0d1034U, 0x49ec0002U, 0x2b45ed06U, 0x00000000U,
+  0x0dc8e832U, 0x022f081bU, 0x13b7e055U, 0x00000000U, 0x3de9efd9U, 0x2ba300cfU, 0x28bb0108U, 0x00000000U,
+  0x00050021U, 0x06d700e7U, 0xe70700f8U, 0x00000000U, 0xffe70f12U, 0xbd31efecU, 0xe3e6f9c6U, 0x00000000U,
+  0x26eb0e00U, 0x0517dd00U, 0x40dd0d00U, 0x00000000U, 0x0006f1efU, 0x00eac53dU, 0x00f5a7e5U, 0x00000000U,
+  0xdd0b18f9U, 0x14c1f9c9U, 0xf6090efeU, 0x00000000U, 0x1510f71fU, 0x3cdff5f6U, 0x3647e114U, 0x00000000U,
+  0x16e9ec0fU, 0xd6f41d0bU, 0x05020cf5U, 0x00000000U, 0x14ef14dcU, 0x36dbf2efU, 0x08fffbedU, 0x00000000U,
+  0x04fc001cU, 0xdff50004U, 0xaa24002eU, 0x00000000U, 0xfbd61319U, 0xe7ce04ebU, 0x19a3f1f0U, 0x00000000U,
+  0x0ee72900U, 0x2cf9c600U, 0x42dff600U, 0x00000000U, 0x000ce1e1U, 0x00e9c322U, 0x00fad6ccU, 0x00000000U,
+  0xdb0c240dU, 0xdcbfbb0dU, 0x01f2ea27U, 0x00000000U, 0x1713001aU, 0x00fecc14U, 0xe319f814U, 0x00000000U,
+  0x12e9e01aU, 0x0bd9211cU, 0x08f7190eU, 0x00000000U, 0xede10ddcU, 0x06f9cd28U, 0x0847ff17U, 0x00000000U,
+  0xeacf002bU, 0xbde7003eU, 0xaf050040U, 0x00000000U, 0xe40bf115U, 0xd2f530e4U, 0xffc1d938U, 0x00000000U,
+  0xf2073c00U, 0xf6100b00U, 0x3df72300U, 0x00000000U, 0x000afdf0U, 0x00d7b83dU, 0x0026ff2bU, 0x00000000U,
+  0x002b3c19U, 0xeccad7deU, 0xd118c95eU, 0x00000000U, 0x0e09ef2cU, 0xee09e214U, 0x0c290b19U, 0x00000000U,
+  0x060fd62aU, 0x145df80dU, 0x1805fa22U, 0x00000000U, 0xd2cb24c1U, 0xd830c013U, 0xebe20e00U, 0x00000000U,
+  0xdbf500f8U, 0xe306000aU, 0xbb3a0020U, 0x00000000U, 0xf1cb1a13U, 0xa752f4caU, 0x0aea5439U, 0x00000000U,
+  0x04f7ff00U, 0xf6701300U, 0x18dd3200U, 0x00000000U, 0x00f8cb08U, 0x0009e603U, 0x00d789ebU, 0x00000000U,
+  0xab06d7ceU, 0x14e2ebe2U, 0xd706def0U, 0x00000000U, 0xfe1211f4U, 0x2c00e5d1U, 0xf24512f7U, 0x00000000U,
+  0x2ab1d913U, 0x2146ff1dU, 0x70961424U, 0x00000000U, 0x2ef3d4f2U, 0xfbb4e5f8U, 0xf450ee26U, 0x00000000U,
+  0x0bff0011U, 0xe80800fbU, 0xf00600fdU, 0x00000000U, 0xfae30a1bU, 0x9a53e2d3U, 0x20ad3b1fU, 0x00000000U,
+  0x05edf200U, 0xe1433200U, 0x34121a00U, 0x00000000U, 0x00eeec09U, 0x00c6f40cU, 0x00ee8eaeU, 0x00000000U,
+  0xc612ebebU, 0x45bbebd3U, 0xe716e1f5U, 0x00000000U, 0x1617fa00U, 0x2c1bcec3U, 0xfb53060dU, 0x00000000U,
+  0x13ccd41dU, 0xd4472912U, 0x2f9913f0U, 0x00000000U, 0x22efdeebU, 0x41bfcdd2U, 0xb815f2feU, 0x00000000U,
+  0x1df50012U, 0xd0ef00eeU, 0xf5210018U, 0x00000000U, 0xffe60a2fU, 0xc927f145U, 0x33c42114U, 0x00000000U,
+  0xf9191500U, 0xef062000U, 0x433a1c00U, 0x00000000U, 0x00eadbd4U, 0x00d4f139U, 0x000c28bfU, 0x00000000U,
+  0xd205000fU, 0xfcd9d1e4U, 0x0e1ce904U, 0x00000000U, 0x161aeb03U, 0xf90cade9U, 0xd70a2102U, 0x00000000U,
+  0x0adee7f5U, 0xc7fe0dffU, 0xebdc26ceU, 0x00000000U, 0xf9f6f2d1U, 0x300eb615U, 0x04530c0dU, 0x00000000U,
+  0x20000022U, 0x03d0000eU, 0x0e0f0020U, 0x00000000U, 0xe9c50c1eU, 0xcfbb0c24U, 0x02e51c2cU, 0x00000000U,
+  0x05150d00U, 0x0306f900U, 0x32131600U, 0x00000000U, 0x00f9f7c1U, 0x00fec9ffU, 0x002a27f2U, 0x00000000U,
+  0xd2190b08U, 0xe6ebdf29U, 0x190ce007U, 0x00000000U, 0xeb13f20fU, 0x0508d7edU, 0x11eef2fcU, 0x00000000U,
+  0x00e1def6U, 0xeb03eff2U, 0xfbee1e04U, 0x00000000U, 0xdbff03eaU, 0x1d2fd230U, 0xeb521411U, 0x00000000U,
+  0x14c30012U, 0xe9b80012U, 0xdfdc00efU, 0x00000000U, 0xe610fe05U, 0xdbff41faU, 0xd416fa56U, 0x00000000U,
+  0x15052500U, 0xfe004d00U, 0x271c4d00U, 0x00000000U, 0x00f8ffc5U, 0x00b4cd0bU, 0x002deb31U, 0x00000000U,
+  0x00350728U, 0x16f0f72cU, 0x15fee319U, 0x00000000U, 0xe120f315U, 0xe1160107U, 0x3224fc05U, 0x00000000U,
+  0xed25d520U, 0x1178ccebU, 0x2bd21d0eU, 0x00000000U, 0xc7eafbe5U, 0xe13ade16U, 0xca08f204U, 0x00000000U,
+  0xeb1c002bU, 0xff2f00f4U, 0xcd7f0022U, 0x00000000U, 0x20d30c01U, 0x812f02e0U, 0x5cc40df4U, 0x00000000U,
+  0xf10a1200U, 0xf1011400U, 0x06e13600U, 0x00000000U, 0x00edf4fdU, 0x00f7ee31U, 0x00e5bf02U, 0x00000000U,
+  0xc200d7f9U, 0xe5d9f8e7U, 0xfa150afaU, 0x00000000U, 0xed1e0ae6U, 0x1dfcfce0U, 0xe93af4e0U, 0x00000000U,
+  0x20aef407U, 0x2066ff17U, 0x2ff65a15U, 0x00000000U, 0x36fc0007U, 0x13ecfde8U, 0x154df141U, 0x00000000U,
+  0xfff800fdU, 0xbd23002eU, 0xc14a00eaU, 0x00000000U, 0x15b60902U, 0x9f221ae8U, 0x42c724f2U, 0x00000000U,
+  0x12f9f900U, 0xe1f55100U, 0x23161100U, 0x00000000U, 0x00ffe3e5U, 0x00fb074dU, 0x0026faffU, 0x00000000U,
+  0xb61beae8U, 0xb5c5f2f2U, 0x11260afeU, 0x00000000U, 0xee40fbe1U, 0x1d0906dfU, 0xbf3fd6f1U, 0x00000000U,
+  0x28b7e5eeU, 0x115a040cU, 0xfab369fbU, 0x00000000U, 0x120dcdfcU, 0x48f0c2efU, 0xc62bed0bU, 0x00000000U,
+  0x29f600d0U, 0xd3310027U, 0xe11a00e5U, 0x00000000U, 0x0bd6170aU, 0xf2ec0119U, 0x41164be3U, 0x00000000U,
+  0x0ef50000U, 0x24f02900U, 0x2808f300U, 0x00000000U, 0x0009dac3U, 0x001df91aU, 0x00271e23U, 0x00000000U,
+  0xe518d9feU, 0xd2e6d830U, 0x33400bfeU, 0x00000000U, 0xe04bf6d9U, 0x29f71bedU, 0xef03fcf4U, 0x00000000U,
+  0x1dbdd8e8U, 0xf713d10aU, 0xf8154407U, 0x00000000U, 0xfee8dd06U, 0x1b24c50aU, 0xbc1effdbU, 0x00000000U,
+  0x29e900e1U, 0x1efd0025U, 0xf60400ceU, 0x00000000U, 0x03e41cf4U, 0x17d0060cU, 0x0c2a1314U, 0x00000000U,
+  0x1611fa00U, 0x373f1900U, 0x39cbf000U, 0x00000000U, 0x00fddf90U, 0x000a09ccU, 0x001def2aU, 0x00000000U,
+  0x0333fd1bU, 0x140aec40U, 0x1bfd22d3U, 0x00000000U, 0xc73ef7f8U, 0xd6ec4df6U, 0x58e3fdcfU, 0x00000000U,
+  0x1af3f2e5U, 0x12e2aed1U, 0x292c4116U, 0x00000000U, 0xfc03f90bU, 0x064adaf6U, 0xcef106eeU, 0x00000000U,
+  0x2ce000c6U, 0x0ed200f1U, 0xfb040096U, 0x00000000U, 0x0d0a0708U, 0xe627fd05U, 0xeb100a35U, 0x00000000U,
+  0x021cff00U, 0x340e4500U, 0x12053c00U, 0x00000000U, 0x00f0fc81U, 0x00eb1ed8U, 0x000e101aU, 0x00000000U,
+  0x402bf914U, 0x54f3fd29U, 0x08fefad4U, 0x00000000U, 0xce1ffb04U, 0xcf08160eU, 0x442c00f5U, 0x00000000U,
+  0x1013fd04U, 0x1f7dcd01U, 0x21ff2116U, 0x00000000U, 0xd70bfaf8U, 0xe23e06ecU, 0xbbeee8f1U, 0x00000000U,
+  0xfa0300e5U, 0x0a1400fdU, 0x00000000U, 0xf4f300ecU, 0xecef0ad8U, 0x14f5ff24U, 0x00000000U, 0xf6f8feebU,
+  0x0ad0ec00U, 0xfaf10900U, 0x00000000U, 0x00e2f700U, 0x00cfd307U, 0x00fd1c21U, 0x00000000U, 0x00e2e8eeU,
+  0xf8e2e0d7U, 0x021b20f3U, 0x00000000U, 0x00efeff7U, 0xfefc1b09U, 0x00ed1204U, 0x00000000U, 0xfef7fafcU,
+  0x2ff6ddfbU, 0x060c140bU, 0x00000000U, 0x03fdf8f1U, 0x0830edfbU, 0xf9f6030aU, 0x00000000U, 0x0301f8feU,
+  0xf7fe0025U, 0xfcfc002aU, 0x00000000U, 0xf7f600f0U, 0xd62115deU, 0x0edc0920U, 0x00000000U, 0xf2fd01e6U,
+  0x16d7da00U, 0x0fe8e600U, 0x00000000U, 0x09dfef00U, 0x00dfefe5U, 0x00fa0716U, 0x00000000U, 0x0015e4f5U,
+  0x08d503dbU, 0xf10efe0bU, 0x00000000U, 0x02f405f1U, 0xecff1306U, 0x2fe502ffU, 0x00000000U, 0xf4fff6feU,
+  0x4ff2d7f0U, 0x19050a0aU, 0x00000000U, 0x02e9fbf8U, 0xf346f60eU, 0x00030900U, 0x00000000U, 0x0bfd10feU,
+  0xe2fe003aU, 0xf9fd001aU, 0x00000000U, 0xeee20005U, 0xe90b17e5U, 0x15dcff0fU, 0x00000000U, 0x07f9fff5U,
+  0x00fbee00U, 0x05d6e800U, 0x00000000U, 0x09e7e000U, 0x00e3ef0aU, 0x000501ffU, 0x00000000U, 0x000eea00U,
+  0x06e8e411U, 0xddfcfd00U, 0x00000000U, 0x130e0b09U, 0xf7fc0716U, 0x2ce919f8U, 0x00000000U, 0x030203f9U,
+  0x2111eadeU, 0x0c0fe70fU, 0x00000000U, 0x12ddf105U, 0xea27fb09U, 0xf8fe0506U, 0x00000000U, 0x14d815fbU,
+  0xfa10000eU, 0x0f160005U, 0x00000000U, 0x12d80011U, 0xe90305e8U, 0x09000309U, 0x00000000U, 0x17ee03fdU,
+  0xea0cfd00U, 0xf0ddef00U, 0x00000000U, 0x0afde700U, 0x00e9f008U, 0x000ef907U, 0x00000000U, 0x00fdf80aU,
+  0x19e0eb1dU, 0xe4f20021U, 0x00000000U, 0x0d121506U, 0x1fee0825U, 0x2bfb040bU, 0x00000000U, 0xf8080005U,
+  0xf829ebe0U, 0xeb1ae11fU, 0x00000000U, 0xfee8fb02U, 0x19251afbU, 0xfc03080dU, 0x00000000U, 0xfde70e00U,
+  0x040b00f8U, 0x151200f4U, 0x00000000U, 0x14e20008U, 0xfbf7f6f8U, 0xf21b0106U, 0x00000000U, 0x14f5fc07U,
+  0xf9e51500U, 0x02f00000U, 0x00000000U, 0xfff50200U, 0x00f6f61cU, 0x00fb01f5U, 0x00000000U, 0x0010010bU,
+  0x1bf4e4f7U, 0x08ee0416U, 0x00000000U, 0xfa13140eU, 0x12eef00aU, 0xffebf90bU, 0x00000000U, 0x05fa0c05U,
+  0x0213daebU, 0xe523e80cU, 0x00000000U, 0x0ee8fbfcU, 0xeff61901U, 0xed0125f0U, 0x00000000U, 0xf4e60703U,
+  0xce0900e1U, 0x21fc00f8U, 0x00000000U, 0xeffd00eeU, 0xf3ee0ce6U, 0x16f3f708U, 0x00000000U, 0xeb0b05f9U,
+  0x0af1f900U, 0x000eeb00U, 0x00000000U, 0xf3fffa00U, 0x00c0cdfeU, 0x00e2fe22U, 0x00000000U, 0x00f0eae9U,
+  0x03dadedcU, 0x0c13faf2U, 0x00000000U, 0x14e5edf4U, 0xe8fb22f9U, 0x2ae70713U, 0x00000000U, 0xeafbf501U,
+  0x2af8eefcU, 0xf30805eeU, 0x00000000U, 0xeffc09fdU, 0x0341ef0bU, 0xf1f9da09U, 0x00000000U, 0x09f1f3f8U,
+  0xbd0e00feU, 0x17030008U, 0x00000000U, 0xe6fc00fdU, 0xe405fce8U, 0x0af906ffU, 0x00000000U, 0xfbf7f9ebU,
+  0xfaf5f200U, 0x15fae600U, 0x00000000U, 0xfaeef900U, 0x00dbeaebU, 0x00f12bfdU, 0x00000000U, 0x0006efe1U,
+  0x0af9eae4U, 0x0611eaecU, 0x00000000U, 0x0ef509f0U, 0xeff00e07U, 0x1cff2113U, 0x00000000U, 0xee0cef00U,
+  0x330bfa07U, 0x02060406U, 0x00000000U, 0xfee8fbfeU, 0xaf261600U, 0xe7f9bb0cU, 0x00000000U, 0x11e617faU,
+  0xc5fa001fU, 0x0aef001dU, 0x00000000U, 0x01ef0012U, 0xf51afbfcU, 0x21d7e01cU, 0x00000000U, 0x17ef0aeeU,
+  0xeff50900U, 0xf7160400U, 0x00000000U, 0xfbf8ef00U, 0x00eddd1eU, 0x000a20e7U, 0x00000000U, 0x0017e2fdU,
+  0xe1e8ec10U, 0xd40ef524U, 0x00000000U, 0x1c0a15f1U, 0x01e10af8U, 0x231d0e1fU, 0x00000000U, 0xfc12fcf9U,
+  0x000b0707U, 0x0506ec0bU, 0x00000000U, 0xfb0100feU, 0xda0203feU, 0xebf4d328U, 0x00000000U, 0x0cf310fdU,
+  0xd9000005U, 0x1cee0013U, 0x00000000U, 0x37d60017U, 0xec0a06fdU, 0x1006fd0bU, 0x00000000U, 0x1aec050dU,
+  0xf5f90e00U, 0xf7f51a00U, 0x00000000U, 0x07ffe900U, 0x00e0f12fU, 0x00fb0ce9U, 0x00000000U, 0x0005e9f9U,
+  0xdee0ea0bU, 0xbf06fe27U, 0x00000000U, 0x06091905U, 0x1fcef716U, 0xfefe0d41U, 0x00000000U, 0x051515f0U,
+  0xfb321d11U, 0x021ac139U, 0x00000000U, 0x09f20b01U, 0xf019eef6U, 0xf4e4f00eU, 0x00000000U, 0xf8f200f4U,
+  0xfcfd0007U, 0x0cde00eaU, 0x00000000U, 0x11eb0005U, 0xd6e4fdfaU, 0xecf7f40fU, 0x00000000U, 0x20f4090bU,
+  0x03f40b00U, 0xfdea0900U, 0x00000000U, 0x060d0600U, 0x00fbff20U, 0x0002f8f3U, 0x00000000U, 0x00e603feU,
+  0xfae703ffU, 0xc8f70d28U, 0x00000000U, 0x011218e5U, 0x1cd0fbf9U, 0x14e4f61dU, 0x00000000U, 0x02fafc04U,
+  0xfe34f6feU, 0xf925cf34U, 0x00000000U, 0x0fee210dU, 0xd3e400e7U, 0x03c21310U, 0x00000000U, 0xe7e3f3f9U,
+  0x992400f5U, 0x03f900ffU, 0x00000000U, 0xe9ff0012U, 0xf7fceadfU, 0x14e304f0U, 0x00000000U, 0xed04f114U,
+  0xf3001200U, 0xf4e4f000U, 0x00000000U, 0x05faf900U, 0x00d1a211U, 0x00d60211U, 0x00000000U, 0x00f3def1U,
+  0xf0e6d2c5U, 0xd711def2U, 0x00000000U, 0x23f6fbf4U, 0x0d080debU, 0x10e71629U, 0x00000000U, 0xed0201fbU,
+  0x27081115U, 0xf809f4efU, 0x00000000U, 0xf4f318f5U, 0x0b0bd513U, 0x0313e60dU, 0x00000000U, 0xfff1f4fdU,
+  0xb71b00e7U, 0x0cfd00f7U, 0x00000000U, 0x040700fdU, 0xf907e3f6U, 0x1dcbfffbU, 0x00000000U, 0x03f4f912U,
+  0xe927fe00U, 0x00e5f900U, 0x00000000U, 0xf6ec0500U, 0x00e5b209U, 0x00fc150eU, 0x00000000U, 0x00f4d6f2U,
+  0xf1faf1d3U, 0xfc14d6ecU, 0x00000000U, 0x15ee05e2U, 0xf105f303U, 0x2a00f81fU, 0x00000000U, 0xe711fcffU,
+  0x1907122bU, 0xfdf3defdU, 0x00000000U, 0xf9fa0dd3U, 0xd0f7d2f6U, 0xf3f9d6f1U, 0x00000000U, 0x0fe6f509U,
+  0xddfa00f9U, 0xf9dd00fbU, 0x00000000U, 0x08f800fdU, 0x0001f0fcU, 0x0be7f4e5U, 0x00000000U, 0x12f30101U,
+  0xfc160800U, 0xfb100400U, 0x00000000U, 0xd8fcff00U, 0x00f6c31bU, 0x00f62ff7U, 0x00000000U, 0x0002d0eeU,
+  0xf207ff00U, 0xf221ce16U, 0x00000000U, 0x07f000e1U, 0x06f1dff0U, 0x260afa30U, 0x00000000U, 0xea020cfeU,
+  0xf9081423U, 0x1cf3f2faU, 0x00000000U, 0xf8fd06e7U, 0xe0faebefU, 0xc3ecd4f7U, 0x00000000U, 0x17f6f3f5U,
+  0xe9f3001aU, 0x03e7000cU, 0x00000000U, 0x1cdc00eeU, 0xdafa04edU, 0xe102f6dcU, 0x00000000U, 0x2a0ef203U,
+  0x11f8fd00U, 0xdb1c1000U, 0x00000000U, 0x01ece000U, 0x00e6df15U, 0x00f71404U, 0x00000000U, 0x00fae8edU,
+  0xeb00e004U, 0xd405f636U, 0x00000000U, 0x220400c9U, 0x11e9e306U, 0x1a09eb2eU, 0x00000000U, 0xf2f621e8U,
+  0xf11d3407U, 0x2513e136U, 0x00000000U, 0x120908f9U, 0xf2eddee1U, 0xbcdaf1efU, 0x00000000U, 0x010402edU,
+  0xe306001dU, 0x11cb0005U, 0x00000000U, 0x1ddb00c8U, 0xc8fcefe7U, 0xde14faeaU, 0x00000000U, 0x500ffaf0U,
+  0x11fe0600U, 0xcdfe2200U, 0x00000000U, 0x11f7ee00U, 0x00f70328U, 0x00da0306U, 0x00000000U, 0x00e50ec9U,
+  0x0eff2f03U, 0xf1df0a03U, 0x00000000U, 0x280bf8d5U, 0x0ad015f3U, 0xffe9e81cU, 0x00000000U, 0xefe005efU,
+  0xf442fae6U, 0x2037e108U, 0x00000000U, 0x03ed21f3U, 0xd81700caU, 0xe8c81cd6U, 0x00000000U, 0xeef3f4f4U,
+  0xb03d000cU, 0x060400fcU, 0x00000000U, 0x19e3002bU, 0xf000f4e5U, 0x1eeb07cfU, 0x00000000U, 0xfe050726U,
+  0xfb221800U, 0xe90f0400U, 0x00000000U, 0x0a01f500U, 0x00e2a0feU, 0x00d214ebU, 0x00000000U, 0x0009eaeeU,
+  0xf6f1dcd5U, 0xdafbd617U, 0x00000000U, 0x44fc090cU, 0x0113f6efU, 0x0cebee17U, 0x00000000U, 0xfd1319fdU,
+  0x1bfa2f0cU, 0xf6d7f0deU, 0x00000000U, 0xf1f41ce9U, 0x0803d805U, 0xc5fafa0cU, 0x00000000U, 0x030609f5U,
+  0xb73200e7U, 0xfc0e00fdU, 0x00000000U, 0x25f30000U, 0xf4f6f0f4U, 0x41e42801U, 0x00000000U, 0xeb03ef26U,
+  0xdf160100U, 0xedfbf400U, 0x00000000U, 0xe80dfc00U, 0x00d5c312U, 0x00fb25f6U, 0x00000000U, 0x00fae4fdU,
+  0xea04ddc4U, 0xcef9d400U, 0x00000000U, 0x15f1f708U, 0x150fcce4U, 0x21e7012cU, 0x00000000U, 0xde1c01f5U,
+  0x03052905U, 0x0ed2fcf6U, 0x00000000U, 0xe7fc20e2U, 0xf3fac007U, 0xc7f10422U, 0x00000000U, 0x16f6f8f1U,
+  0xcbeb00e3U, 0xffdb0002U, 0x00000000U, 0x062600f5U, 0xf1fadf00U, 0x22f403f0U, 0x00000000U, 0xf10aeb0dU,
+  0x031f0600U, 0xdd3f1c00U, 0x00000000U, 0xea100b00U, 0x00d7c41eU, 0x0002290bU, 0x00000000U, 0x00fadd15U,
+  0xd40ee214U, 0xccfa120aU, 0x00000000U, 0x04d3ee0dU, 0xfc07dbfbU, 0x2cfbe44fU, 0x00000000U, 0xcb0ff9f3U,
+  0xf0f01610U, 0x20cfe7fcU, 0x00000000U, 0xf6090fd4U, 0x0b12d1e4U, 0xc8ce441cU, 0x00000000U, 0x19f9e503U,
+  0xfdcf00fbU, 0x0dd200faU, 0x00000000U, 0xdd2600fdU, 0xe2d3e707U, 0x1511dcddU, 0x00000000U, 0x1204f50eU,
+  0x24110100U, 0xd6601a00U, 0x00000000U, 0xee030200U, 0x00dee912U, 0x00072cfaU, 0x00000000U, 0x00f408f6U,
+  0xf3fbf140U, 0xebf6ebf9U, 0x00000000U, 0xf2f303e5U, 0xe5daf401U, 0x2efbcc0dU, 0x00000000U, 0xe6e906f3U,
+  0xe6f2eefbU, 0x2011e333U, 0x00000000U, 0x00e9fee8U, 0x0d0fe1d7U, 0xdec51b0eU, 0x00000000U, 0x2af6f5fcU,
+  0x01d70012U, 0x00c300f8U, 0x00000000U, 0xfe090011U, 0xdc1d0fdfU, 0xcc25eef0U, 0x00000000U, 0x37e9f5efU,
+  0x2f1a2b00U, 0xc9262100U, 0x00000000U, 0x01eace00U, 0x00e90608U, 0x00fcf516U, 0x00000000U, 0x00e416e8U,
+  0x2007272eU, 0x0dce0c14U, 0x00000000U, 0xeb0916d4U, 0xeae53004U, 0xed02e628U, 0x00000000U, 0xfacf0cf0U,
+  0xee4ae2e6U, 0x1a69fd24U, 0x00000000U, 0xf8b9eeebU, 0xc84103d5U, 0xeccf030aU, 0x00000000U, 0x2cf902f6U,
+  0xbf2500f1U, 0xfbe500d7U, 0x00000000U, 0x2fe80029U, 0xf710010eU, 0xd522cadaU, 0x00000000U, 0x2d21141cU,
+  0xf90f0a00U, 0xfaf90400U, 0x00000000U, 0x0cfe0700U, 0x00ea8117U, 0x00f215c9U, 0x00000000U, 0x001cede8U,
+  0xfbd8f1e1U, 0xfdd2fc17U, 0x00000000U, 0x49fa2c07U, 0xf61417eaU, 0xfbd2c21eU, 0x00000000U, 0xf2fc1c02U,
+  0x22191a1cU, 0xea0ae6eeU, 0x00000000U, 0xe6f422ffU, 0x151ce907U, 0xb3bd3602U, 0x00000000U, 0x03101df9U,
+  0x901f0018U, 0x1db50018U, 0x00000000U, 0x4bf60034U, 0x0fe20207U, 0xda49d4feU, 0x00000000U, 0x011cfc3bU,
+  0x1d161a00U, 0xda4f0600U, 0x00000000U, 0x150c2100U, 0x00e8a414U, 0x000257e0U, 0x00000000U, 0x0014fbd0U,
+  0xe1d5eefbU, 0x08c9eb29U, 0x00000000U, 0x41f80c1fU, 0xf30521eaU, 0x10fab845U, 0x00000000U, 0xd3ec250aU,
+  0x191921f5U, 0xfe2bd9faU, 0x00000000U, 0xef0e05f7U, 0xfd00d6f3U, 0xa99b3907U, 0x00000000U, 0x08ff00edU,
+  0xae05001bU, 0x06ac00f9U, 0x00000000U, 0x38f30010U, 0x33fdfdf1U, 0xd93bede3U, 0x00000000U, 0xce1ad439U,
+  0x3b3e2200U, 0xc45b2b00U, 0x00000000U, 0x160e4100U, 0x00ebdedeU, 0x00f439dfU, 0x00000000U, 0x00f408c9U,
+  0xddf9df3eU, 0x13c9f406U, 0x00000000U, 0x3a01fc55U, 0xfc0714e5U, 0x3f1cb93dU, 0x00000000U, 0xae032c00U,
+  0xfd00e9efU, 0x2d58a90fU, 0x00000000U, 0xf32de4deU, 0x0023d617U, 0xc09c39caU, 0x00000000U, 0x23fd04fdU,
+  0x050a0021U, 0xd2ce0001U, 0x00000000U, 0xe4030025U, 0x0eda04d4U, 0xb816fac6U, 0x00000000U, 0xca0fd10eU,
+  0x3a4c3300U, 0x812f4200U, 0x00000000U, 0x28f94b00U, 0x000213d0U, 0x00e819d6U, 0x00000000U, 0x00dd0203U,
+  0x0010ef65U, 0xed0e060fU, 0x00000000U, 0x27ed0950U, 0xf3f817edU, 0x1e3cbd0bU, 0x00000000U, 0xcefd2ef3U,
+  0xf308c4d6U, 0x3840c236U, 0x00000000U, 0xe822c3d7U, 0xdf3aece0U, 0xf79f0aedU, 0x00000000U, 0x241dfcc1U,
+  0xf90600f8U, 0xe5bc0010U, 0x00000000U, 0x98fe0038U, 0x162b04f2U, 0xb123edf1U, 0x00000000U, 0xcd11f900U,
+  0x35353600U, 0xc73f4000U, 0x00000000U, 0x25ef2400U, 0x001f3fc7U, 0x00cc09e3U, 0x00000000U, 0x00e1e719U,
+  0x2d0e0a37U, 0x1b32021bU, 0x00000000U, 0x04d7117fU, 0xd60b0f15U, 0xf631e51dU, 0x00000000U, 0xdd041508U,
+  0x054bf5fbU, 0x0d56f32cU, 0x00000000U, 0xed3dd2dbU, 0xcb570deaU, 0xd9ab08eaU, 0x00000000U, 0x1f090dc0U,
+  0x180c00e8U, 0x3a310012U, 0xfef500feU, 0x0fe400d6U, 0xf8eb06c8U, 0x080b03f3U, 0x1607ffe4U, 0xecf5fef8U,
+  0x08bfe500U, 0x04440200U, 0xfd29ef00U, 0xf9deda00U, 0x00111e30U, 0x001446fbU, 0x00ae4520U, 0x0017f301U,
+  0xf8fde2ebU, 0x0219fbfaU, 0x04050905U, 0x0ee827a6U, 0xf6c31635U, 0xfb0d0c44U, 0x04edeb09U, 0xf9de13f0U,
+  0x5f30bbf5U, 0x3a49f503U, 0xee15edcfU, 0xeae8f2f0U, 0xf738effbU, 0xf121f80bU, 0x0bfd1004U, 0xf6e414feU,
+  0x01fb003eU, 0x33260037U, 0x06f2001fU, 0xeee8000bU, 0xea1306dcU, 0x131e0ffeU, 0x08fae0d7U, 0xf4cceff7U,
+  0x36c3e700U, 0x120e3800U, 0xf82e0600U, 0xfcfbcc00U, 0x00f53afeU, 0x00f354d9U, 0x009f2d2eU, 0x0032dbfeU,
+  0x48ca0930U, 0x2916ff38U, 0x11dcf30eU, 0xf4f133e9U, 0x44af2b12U, 0x04fa2723U, 0x29f2cd25U, 0xf8191be8U,
+  0x5652b6ceU, 0x3d2bd0e1U, 0xe85de9c2U, 0xf5f1d5fbU, 0xda510e0bU, 0xf856cd13U, 0xf7d232f7U, 0x17d92b08U,
+  0xff28001bU, 0x5247002fU, 0x02f5002cU, 0xe7bb003aU, 0xe3f7feefU, 0x0e100810U, 0x0514d5dfU, 0x13d2e5f2U,
+  0x09e02100U, 0x05fb6c00U, 0xf5312000U, 0x040be800U, 0x00a435dbU, 0x00fe4010U, 0x00e63a01U, 0x0019eb2fU,
+  0x3aa70852U, 0x1f41f206U, 0x57c4f7edU, 0xd9fa1719U, 0x48a30f14U, 0x0ff60334U, 0x2000d635U, 0xdf2509c5U,
+  0x0e6cd4caU, 0x2104dae3U, 0x095cf7feU, 0x08eecfebU, 0xa82defebU, 0xf44dde08U, 0xc6f71ed7U, 0x1e9ff0f0U,
+  0xf92800f0U, 0x365a0004U, 0xf6f7003eU, 0xd9b00042U, 0xd9eafa21U, 0xf8da17f3U, 0xff2effdcU, 0x11ddf2e3U,
+  0x24ef1d00U, 0x19bf3a00U, 0xe6390e00U, 0x1ee60100U, 0x00ac1ff4U, 0x000c1a03U, 0x00f90befU, 0x0022075cU,
+  0x29b6fe3dU, 0xfb5af6e3U, 0x77e1191fU, 0xd1011520U, 0x36b0da2bU, 0xf9c0f718U, 0x1be7db02U, 0xf213dcd3U,
+  0xfc5aaaccU, 0x1d059c06U, 0xed4fcc15U, 0xfe01d4e7U, 0x9c17e3d2U, 0xef3414d6U, 0xbcd807faU, 0x0db8d1ecU,
+  0xfaf400caU, 0x572c00c8U, 0x1af80011U, 0xc8bc0011U, 0xb02df709U, 0xf2d404ecU, 0xd962f9f5U, 0xfcffebd6U,
+  0x1dec2500U, 0xedb30e00U, 0xf7193800U, 0xf51a1900U, 0x00c2faf3U, 0x00f4f9e2U, 0x00dd0211U, 0x0005093dU,
+  0x40cbcb24U, 0xf641c2e8U, 0x4cd735f6U, 0xdcc81afdU, 0x12f0ed15U, 0xd5d7f9faU, 0x0d020704U, 0x2220f9f9U,
+  0xf664d8e6U, 0xf6ffa1f2U, 0xf85bce07U, 0xfa0406e0U, 0xbb0ce7d3U, 0xee1214f3U, 0xb821fdfcU, 0xf9c3f7d5U,
+  0xf4ec00cfU, 0x101d000bU, 0x16fe00f5U, 0x00f200edU, 0xfbdee4b4U, 0x01190602U, 0xf513f1eeU, 0xf4df0703U,
+  0x1801f100U, 0x09260700U, 0x00ebd500U, 0xfef7bf00U, 0x00ea091dU, 0x00d64134U, 0x00d605fdU, 0x0045cafdU,
+  0x1bf1e7feU, 0x0e06140bU, 0x2700e80bU, 0x08f52fc6U, 0x01c5490eU, 0x0a0b251eU, 0xfff90517U, 0xf2ce39f7U,
+  0x601dddeaU, 0x0319f8f0U, 0xd31a04e4U, 0x24ead8f0U, 0xf813f7ffU, 0xe43afc1fU, 0xf0fd2ff4U, 0x04de03f6U,
+  0xedf300e7U, 0x412b003dU, 0x02e5001bU, 0xffef0012U, 0x0f1fe6f5U, 0x081befe1U, 0xe82ecde8U, 0x12c711f1U,
+  0x2706fd00U, 0xf5073c00U, 0xf3eaef00U, 0xc3f5d400U, 0x00ce26faU, 0x00ef52f9U, 0x00b421f9U, 0x005bd8edU,
+  0x45d8fa1aU, 0x0e01e625U, 0x1fd5f312U, 0xe8092a1fU, 0x1fa92cf8U, 0xeef91c01U, 0xf00c2f12U, 0xc23439e5U,
+  0x4218f0e8U, 0xdd12f9f7U, 0xe0defb02U, 0x3dd0a508U, 0xacf0f1f8U, 0xcb21f742U, 0x020737ecU, 0x44f1fef3U,
+  0xde2000eaU, 0x4b3f001cU, 0x04e10006U, 0x11cc0029U, 0x150cfaf6U, 0xcf05d2d8U, 0xed2dcef6U, 0x27bc00e6U,
+  0x1c0a1400U, 0x15d76200U, 0xde11fd00U, 0xdfff0200U, 0x00c237eaU, 0x00f36019U, 0x00d71219U, 0x001fe6dcU,
+  0xf6c9d443U, 0x0bfb0d23U, 0x25e6e9ffU, 0x1e27fb10U, 0x2081ff0bU, 0x18be0819U, 0xd10511f2U, 0xda2926d9U,
+  0xdf2d30d4U, 0xee01efe6U, 0x05faf836U, 0x3207c6deU, 0xcb10c0dbU, 0xd40806f4U, 0xf21624f1U, 0x38f3f0e1U,
+  0xc20e000dU, 0x096f001bU, 0x1af7001fU, 0xf9ca001eU, 0x000a1ec5U, 0xb9d512e6U, 0x001aebcdU, 0x15e4d8d2U,
+  0xff173700U, 0xf8db5700U, 0xd2100100U, 0x060a1000U, 0x00c21b06U, 0x00f1331dU, 0x00f0ffeaU, 0x00c8e820U,
+  0xc1caaf2eU, 0xe020ff08U, 0x4eef0907U, 0x11fc21f7U, 0x38c6e326U, 0x26d72415U, 0xc1ee1ecdU, 0x06f10dfaU,
+  0xe558e902U, 0xfa29a7e2U, 0xf5fccc04U, 0x0711fdc7U, 0xd8e7d7c2U, 0xe13af1e5U, 0xf71027f5U, 0xf5ff16c1U,
+  0xf91a00efU, 0x087a00feU, 0x29d2001dU, 0xcdc7001cU, 0xcefb08f4U, 0xadd924f5U, 0xe07ff008U, 0xdd20cde1U,
+  0x09f12a00U, 0xfbcf2a00U, 0xc9141800U, 0xfaf7f200U, 0x00eefbeeU, 0x002b0114U, 0x008d06e4U, 0x00b1f550U,
+  0x08e0d217U, 0xbd1f0c40U, 0x7bff17d9U, 0x18bcfa07U, 0x2dddeef6U, 0xdcd118ffU, 0xc1d915f5U, 0x1337da35U,
+  0xf648fc02U, 0xd4138bd3U, 0xed24d0eeU, 0x192713d1U, 0xc613dab5U, 0xde4826f8U, 0xbf382d0dU, 0xbbdcebdcU,
+  0xdb2a00d3U, 0x2d010004U, 0xf2e60007U, 0xd62300e6U, 0x15f1edc0U, 0xec03ff03U, 0xd740de12U, 0x10ee150cU,
+  0x0415fb00U, 0x0cfcf900U, 0x14e9c300U, 0xe121d600U, 0x0008c709U, 0x00da2539U, 0x000efd03U, 0x0038d8f4U,
+  0x03ef02e6U, 0xd915e2efU, 0x56db300fU, 0x08fa41e6U, 0x07c11511U, 0x1cf01e2eU, 0xfcef12f3U, 0xd4fa15c9U,
+  0x1913fde9U, 0xe40c0cc1U, 0xd7fa09ecU, 0x29ebd812U, 0x0418e01cU, 0xc91cec2aU, 0xf3d61dfaU, 0xeaddfe0aU,
+  0xe21a00d9U, 0x2a1c00e5U, 0xedef0001U, 0xe83900f9U, 0x18ecd6e3U, 0xdc06fdfaU, 0xe40eea22U, 0x1aec06f5U,
+  0x211efb00U, 0xf4181600U, 0xe9efd900U, 0xe82dff00U, 0x0008ef23U, 0x00e536feU, 0x000106ffU, 0x002fe9e1U,
+  0x10ecf711U, 0xc1fadc17U, 0x20d71a01U, 0x250c0801U, 0x2ab20722U, 0x000c4d26U, 0xff160c0aU, 0xbb311faaU,
+  0xf01bfde9U, 0xe0dee8e0U, 0xe3021afeU, 0x38d4da1dU, 0xdee8ded7U, 0xbb05f3faU, 0x1a050efdU, 0xfa11cd1bU,
+  0xffe300ebU, 0x330a00f5U, 0x010400ffU, 0x13000003U, 0x01d201bbU, 0xc4e4eff4U, 0xf51ce8f9U, 0x2fe610dfU,
+  0x3f070400U, 0x02fb1700U, 0xdbf7e500U, 0x12200300U, 0x00e13d08U, 0x00d948ccU, 0x00f6f9fdU, 0x00d503deU,
+  0x0eface45U, 0xd5fee10bU, 0x42df1502U, 0x650abb33U, 0x3d9fd628U, 0x12f5250cU, 0xfa1d03f6U, 0xdbfb2ee9U,
+  0xb10b34ebU, 0xd9e4e4f3U, 0x12270b00U, 0x201602edU, 0xedd7c2e6U, 0xa126f80aU, 0xd5f01e01U, 0xd80efafdU,
+  0xe71c0009U, 0xd74d003aU, 0x36f70003U, 0xc8e700f0U, 0xf0de19f6U, 0xb8c73bfaU, 0x1e2ae308U, 0x12f510f2U,
+  0x22fb3300U, 0x05d02f00U, 0xd6fff900U, 0x1afefc00U, 0x00c5330bU, 0x0014100bU, 0x00f6eadeU, 0x00e7f30bU,
+  0xdaed9c13U, 0xbeef073aU, 0x50dd1d18U, 0x43f7c617U, 0x12ebd916U, 0x0c014024U, 0xc7ca23d6U, 0x02f7df11U,
+  0xe53410edU, 0xec35dcb3U, 0x05ef05ebU, 0x14322a07U, 0x09f0abbeU, 0xae22311aU, 0xf2f33024U, 0xf41e0f39U,
+  0x9e5300f5U, 0x987e002bU, 0x42cb00daU, 0xae1000d6U, 0xe8ec2ff6U, 0xbbcd2813U, 0xfa6706f1U, 0xb937d4f2U,
+  0x0b012000U, 0x0cb50c00U, 0xd8040100U, 0xff1bfe00U, 0x00fefe2dU, 0x0031ff43U, 0x00d50ba2U, 0x0002f92eU,
+  0xd7dcfafbU, 0xebed6d2fU, 0x5af6d6e1U, 0x050f81e6U, 0x00fbea05U, 0xd4da5301U, 0xa4d115f4U, 0x0d74b729U,
+  0xe84b08f3U, 0xd142d0b1U, 0xdef1d3e7U, 0x2310421eU, 0xf528d8c8U, 0xcb402412U, 0xc62b3f21U, 0xd4e1d755U,
+  0xd70f00e4U, 0x47ee00f7U, 0xf7c10011U, 0xcbe400e0U, 0x3cf8eed8U, 0xecf9ffefU, 0xaf1b2443U, 0xfb04430aU,
+  0xf518fa00U, 0x07f3db00U, 0x2de0e100U, 0xfbe7e700U, 0x0008d100U, 0x00fc5406U, 0x0047c8e7U, 0x0055f2f0U,
+  0xf9030311U, 0xf813f815U, 0x61f42b09U, 0x171630ddU, 0x09da15ffU, 0x04df0a3dU, 0x1a052aebU, 0xfde826e1U,
+  0xe6ee03edU, 0xb9e0f3c0U, 0xf309f317U, 0xed4bb92dU, 0xf50e181aU, 0xa60f0afeU, 0x331714d3U, 0xeef6080cU,
+  0xe7f900d8U, 0x27eb00c2U, 0xd9db0002U, 0xbc280005U, 0x10d9d1f3U, 0xd1ba1301U, 0xd329f72eU, 0x110f2605U,
+  0x0f060100U, 0xf0c7e900U, 0x0afee000U, 0xdaf30200U, 0x0020f42dU, 0x00ee4114U, 0x0025dbfeU, 0x0037fd08U,
+  0x0e19fd02U, 0xc506e116U, 0x11e510fbU, 0x0922f79cU, 0x0bb80a07U, 0x08f1252dU, 0x01101cf1U, 0xf41346d9U,
+  0xc1f533e5U, 0xc9ceecdcU, 0x18011b0fU, 0xf85bf068U, 0xe904fdf5U, 0x98280a21U, 0x35cc01f6U, 0xf10cef28U,
+  0x0dd10003U, 0x080a00eaU, 0xeee700efU, 0xb336000bU, 0xefd00eccU, 0xfbbb3517U, 0xed45ed0bU, 0x13291bfdU,
+  0x2be60300U, 0xfcb5e700U, 0xd921ec00U, 0xf9f3cf00U, 0x0001061eU, 0x001a0503U, 0x0002cdf4U, 0x0020de16U,
+  0x2222d65cU, 0xe1ff140eU, 0x18e407e2U, 0x0d07e5c2U, 0xdacdf930U, 0xf0e0202dU, 0xf208f6dcU, 0x1dc8f4c8U,
+  0xca0e1500U, 0xe6f8df00U, 0x25f6090bU, 0x0335014dU, 0xd306f6cbU, 0x8e2221faU, 0x04edfdfdU, 0x0a04e4fbU,
+  0xd6ee0021U, 0xd8030021U, 0x17e700d3U, 0xb72600d7U, 0xe9c73beaU, 0xfcd23626U, 0x0f24dce0U, 0x1a37f2e5U,
+  0x48dd1c00U, 0x29b7e900U, 0xdd10e200U, 0xfba5da00U, 0x00f20dffU, 0x004f03fbU, 0x00feefc8U, 0x0028c936U,
+  0xe6f2ea54U, 0xdafc2f6fU, 0x34bf18e7U, 0xe2f2f9caU, 0xeee1ee20U, 0x01eb30feU, 0xeed81beaU, 0x31ddd111U,
+  0xf83fedf4U, 0x020f0ac2U, 0xec0318eaU, 0x1e372334U, 0xdd29f0e3U, 0x9c01261aU, 0x04ee0b0bU, 0x20dc034dU,
+  0xae15000aU, 0xbe4e003eU, 0x120700c5U, 0xb60f00aaU, 0xfafd13d5U, 0x11f91326U, 0x1e08e1e7U, 0xfc24e202U,
+  0x1e212f00U, 0x26dcf300U, 0xf1e2cf00U, 0x210bfd00U, 0x001e044fU, 0x00692373U, 0x0009f3a3U, 0x0037d636U,
+  0x06fb3323U, 0xe3f77a44U, 0x23f2faa3U, 0xd417adb2U, 0xf5eaeffeU, 0xe2dc3105U, 0xbfe224f9U, 0x524dd8ebU,
+  0x145610edU, 0xfd3502bfU, 0xd4e70af6U, 0x3d0a544fU, 0xca1c02eeU, 0xa70232deU, 0x2aff071bU, 0x1dafff32U,
+  0xd30200e8U, 0x1cc600d9U, 0x2fdb0028U, 0xf60a00ccU, 0x45fdf104U, 0xdbf7e8ffU, 0xfefc343aU, 0xe3e85affU,
+  0xf3ecf600U, 0x12f5ee00U, 0x06fcf500U, 0x07ecee00U, 0x00fdd2ecU, 0x004436e4U, 0x0046eff8U, 0x0040f02cU,
+  0xefff09ffU, 0xee002925U, 0x2c250efcU, 0xf721ebdcU, 0xded1080cU, 0xf2e61044U, 0x16173703U, 0x1fb22cebU,
+  0xe3efecfeU, 0xddd2e6e5U, 0x0dfd0338U, 0xeb4fd234U, 0xeef00800U, 0xc8e935ffU, 0x121c16f0U, 0xea12e1fdU,
+  0xb90100e7U, 0x2bdf00dfU, 0x1fc50019U, 0xd0fd00e3U, 0x35def812U, 0xfaf9f71cU, 0xe5011c49U, 0x02fc4b1aU,
+  0xf21def00U, 0x1fdbd300U, 0x14ff0f00U, 0xddedcd00U, 0x0029fc0aU, 0x00513eafU, 0x000fadf5U, 0x000fdd66U,
+  0xe735d811U, 0x14360521U, 0x3a0a1e14U, 0xcb15febaU, 0xf7e51036U, 0x03eb2f6bU, 0xe8133200U, 0x46f32ee0U,
+  0xc5eefe0cU, 0xefcdf604U, 0x13e8ed34U, 0x1f7cb071U, 0xcbf11a1aU, 0xdb31631bU, 0x2df20eecU, 0xdd0bdd07U,
+  0xc4190000U, 0x0c0a00edU, 0xffe0001fU, 0xb1220006U, 0x41e017ddU, 0x3fee0451U, 0xe1220b12U, 0xdae92232U,
+  0x2e0ef000U, 0x33f7b300U, 0xef042600U, 0xf5e5c100U, 0x0023fb02U, 0x005124c0U, 0x00f5cdcfU, 0x0005ba54U,
+  0x0a61cc40U, 0x2a480406U, 0x37f109eeU, 0xa21505bfU, 0xeedb121fU, 0xfbdb2a3aU, 0xd1e403d3U, 0x5f0516cfU,
+  0xf1f31312U, 0x2701280eU, 0x0d15ed11U, 0x2e3ae54bU, 0xb638fa13U, 0xaa2b2c2cU, 0x42de0912U, 0x0af7c328U,
+  0xe40f0045U, 0x152400ffU, 0xf90900f3U, 0xeafa0014U, 0x3ad90ecdU, 0x57000928U, 0xfb14e1efU, 0xfd05db03U,
+  0x390ee300U, 0x2fbca700U, 0xe9fafd00U, 0x15d7c700U, 0x001bf1feU, 0x0074f3f1U, 0x00f4e5e9U, 0x0032b474U,
+  0x1639ea52U, 0x203326ffU, 0x3ef810cfU, 0xa9ddfeccU, 0xece6d60cU, 0xd5d30725U, 0xc3f320ecU, 0x581ffaf0U,
+  0x202004fdU, 0x3512220fU, 0xf80406ffU, 0x231a2c4aU, 0x9c2ffe08U, 0x83132803U, 0x50f6ec01U, 0x0ee2f92bU,
+  0xd31d0029U, 0xc34e0020U, 0xecf8000aU, 0xf7150002U, 0x120fe8e0U, 0x491e171bU, 0x1306edecU, 0x3de5f0ffU,
+  0x142de700U, 0x12d9a400U, 0xe8dce800U, 0x1501f300U, 0x003e1e06U, 0x007f1063U, 0x00e5f9e1U, 0x000ee434U,
+  0xfe411430U, 0x3b3c3b19U, 0x2114fbcfU, 0xcccfdcbdU, 0xf60df516U, 0xd2d60e25U, 0xe4f2f6fcU, 0x6808edd8U,
+  0x294c240eU, 0x1d552c1cU, 0xf6fc2201U, 0x47ba3c32U, 0x99180c09U, 0x9c4d18ecU, 0x27f70608U, 0x2fddf214U,
+  0x0e0500f7U, 0xd5f500eaU, 0xd2190023U, 0x00000000U, 0xeaeafd27U, 0xe6dffffaU, 0xda0df8d4U, 0x00000000U,
+  0xfbdcfb00U, 0x03c10600U, 0x01f53d00U, 0x00000000U, 0x00f2cdf4U, 0x000cdff4U, 0x008ecbd9U, 0x00000000U,
+  0xf3eb02d1U, 0xf8ebd1d6U, 0x0abfc465U, 0x00000000U, 0x000d1c05U, 0x03e618f2U, 0xf94c9deeU, 0x00000000U,
+  0x22f8f212U, 0x12d9dd0fU, 0xc7e1fdd9U, 0x00000000U, 0x0af912fdU, 0xfb14d1fcU, 0xf4ff06f5U, 0x00000000U,
+  0xecdc0010U, 0xe1f500c6U, 0xee2100f2U, 0x00000000U, 0xefe7f928U, 0xdf0017daU, 0xd344f528U, 0x00000000U,
+  0x0fd4ce00U, 0x0b980d00U, 0xea1a4100U, 0x00000000U, 0x00fce422U, 0x0030d6feU, 0x00d0d381U, 0x00000000U,
+  0xd8f019bbU, 0xdfff07b7U, 0x19cf0756U, 0x00000000U, 0x090711eeU, 0xf1072afdU, 0xc06b9ef6U, 0x00000000U,
+  0x17eaed09U, 0x1ec2cb1bU, 0xc3da1ad1U, 0x00000000U, 0x23f80ffcU, 0x0708cdffU, 0xddd524f1U, 0x00000000U,
+  0xb2d90030U, 0xe4f500daU, 0xe9400043U, 0x00000000U, 0xfaedfa15U, 0xdd481adaU, 0xd752e920U, 0x00000000U,
+  0x08c4ab00U, 0x078c0a00U, 0xe94d3e00U, 0x00000000U, 0x0018d134U, 0x0009d81bU, 0x000aee81U, 0x00000000U,
+  0xccef1decU, 0x9ef51cf2U, 0x37cef02cU, 0x00000000U, 0x230727f9U, 0xe40426fbU, 0xa263c7edU, 0x00000000U,
+  0x17fdeb0dU, 0x11c6ba07U, 0xf7c00cedU, 0x00000000U, 0x1addf8e5U, 0x202defe8U, 0xc9a902e8U, 0x00000000U,
+  0xc1d80022U, 0xf3df0015U, 0xdd03003dU, 0x00000000U, 0xdfe0ff05U, 0xc40ff5dbU, 0xe631fb10U, 0x00000000U,
+  0xffd3d500U, 0x03860f00U, 0xfc540d00U, 0x00000000U, 0x000edd3dU, 0x0028ca1aU, 0x00e7f8ccU, 0x00000000U,
+  0xe4e82b11U, 0xc4d2150cU, 0x13ddd704U, 0x00000000U, 0x1f1d181fU, 0xf8f91bf4U, 0xa94de7e6U, 0x00000000U,
+  0xf525d909U, 0xf1e9d6feU, 0x3abc2206U, 0x00000000U, 0x0fee04c5U, 0x1319ddeaU, 0xfdcbf709U, 0x00000000U,
+  0xc6de002eU, 0x0ee40020U, 0xe102004bU, 0x00000000U, 0xef0c0cfeU, 0xcc02e705U, 0xdef2ff0dU, 0x00000000U,
+  0xf50b0600U, 0x0af91500U, 0x12032100U, 0x00000000U, 0x00e50a34U, 0x000c0520U, 0x00eafff4U, 0x00000000U,
+  0x0cdc1714U, 0xeccf0718U, 0xf1f3c61fU, 0x00000000U, 0x14190509U, 0xfaed0c07U, 0xf049e6faU, 0x00000000U,
+  0xfa30dafbU, 0x0ae3e0fbU, 0x40d60efeU, 0x00000000U, 0x00d026ccU, 0x11f724deU, 0xd9d9ddffU, 0x00000000U,
+  0x00f300d8U, 0xdd2100edU, 0xc733005aU, 0x00000000U, 0xf1dbff29U, 0xdfbc2af6U, 0xf81af1cdU, 0x00000000U,
+  0x05ebf500U, 0xffde0900U, 0xf1105300U, 0x00000000U, 0x00e3b8f1U, 0x000faffaU, 0x00adbfe0U, 0x00000000U,
+  0xc6e109bbU, 0xdfede391U, 0xeec5bc34U, 0x00000000U, 0x001d24f7U, 0xf6f734f3U, 0xfa688af5U, 0x00000000U,
+  0x29cbe811U, 0x51dfde43U, 0xd5d501eeU, 0x00000000U, 0x181aedf3U, 0x0836c6f8U, 0xe6ecff1aU, 0x00000000U,
+  0x01ee000cU, 0xd22300daU, 0xd6fb0007U, 0x00000000U, 0xf9cc090aU, 0xee014aebU, 0xde36ea20U, 0x00000000U,
+  0x11e9f500U, 0xf9e41600U, 0x0aff2700U, 0x00000000U, 0x00fbcbffU, 0x002599e6U, 0x00f7e6c9U, 0x00000000U,
+  0xd20512d9U, 0xd812d8b5U, 0xebe3d335U, 0x00000000U, 0x0017100fU, 0xf7110ef6U, 0xd66b85ecU, 0x00000000U,
+  0x05d8f615U, 0x4ef4ec32U, 0xcdc01310U, 0x00000000U, 0x130af107U, 0x123ab9f7U, 0xe9c8f009U, 0x00000000U,
+  0xc7c80012U, 0xccf600e0U, 0xf8f40050U, 0x00000000U, 0xf3e1e81bU, 0x020d300bU, 0xe73b0024U, 0x00000000U,
+  0xebe60700U, 0x00af1e00U, 0x24000f00U, 0x00000000U, 0x0008c2ecU, 0x001ca7d3U, 0x0005db01U, 0x00000000U,
+  0xd219ff09U, 0x0331df02U, 0xfcebe02aU, 0x00000000U, 0xf4301537U, 0xfa0407efU, 0xee2eaac9U, 0x00000000U,
+  0x0cf4d911U, 0x14e0e902U, 0x2a98050aU, 0x00000000U, 0x0301efe9U, 0x1d33e7e2U, 0x0bafe4f6U, 0x00000000U,
+  0xc8c60027U, 0xece000f3U, 0x04f30052U, 0x00000000U, 0x1b03f21dU, 0x15f90becU, 0xf205f906U, 0x00000000U,
+  0xf6ce2200U, 0xfdae0700U, 0x4af9dc00U, 0x00000000U, 0x00dceefcU, 0x0001a3c5U, 0x00dac70cU, 0x00000000U,
+  0xcc111d06U, 0xfbf1ec1fU, 0x45e90a31U, 0x00000000U, 0xff210b1cU, 0xeced0012U, 0xb825f3d7U, 0x00000000U,
+  0xf4e5e818U, 0xe8e3d0fcU, 0x1cb5f701U, 0x00000000U, 0x13ec09cdU, 0x312be5e4U, 0x0bcb0412U, 0x00000000U,
+  0xe3a50026U, 0x0cd5000dU, 0xe7d90057U, 0x00000000U, 0xdf0be010U, 0xd709ec06U, 0xd509fa1aU, 0x00000000U,
+  0xf6de1a00U, 0x18bd0800U, 0x3a081500U, 0x00000000U, 0x00e1f610U, 0x0011e2fdU, 0x00c3ef33U, 0x00000000U,
+  0xf9eb11f5U, 0xe3ecddebU, 0x40f1e54eU, 0x00000000U, 0xe6f4fe21U, 0xed0003f7U, 0xf04afcecU, 0x00000000U,
+  0xe816e1f9U, 0x05d2f2f5U, 0x2ff60dfcU, 0x00000000U, 0x11a922d1U, 0xfd12e2f1U, 0xd8f8e9fdU, 0x00000000U,
+  0xcd2100d1U, 0xa95000d6U, 0xc906003bU, 0x00000000U, 0xeff40b1cU, 0xf8d4040aU, 0xeeeff604U, 0x00000000U,
+  0x0618f300U, 0x00160500U, 0xf1e43f00U, 0x00000000U, 0x0004b7fbU, 0x0010b4ffU, 0x000df0fbU, 0x00000000U,
+  0xc0e9e8ccU, 0x1effe297U, 0xdcdee614U, 0x00000000U, 0xfe001401U, 0x08042cdfU, 0x0869c4faU, 0x00000000U,
+  0x1bd7ec10U, 0x6022e15fU, 0x09b82b17U, 0x00000000U, 0x272f0506U, 0xf536bb00U, 0xece20306U, 0x00000000U,
+  0xe2f5000bU, 0xaf2f00f8U, 0xd9030015U, 0x00000000U, 0x16f8fff9U, 0x18083b09U, 0xebfd0f3fU, 0x00000000U,
+  0x09351300U, 0xf010f200U, 0xdcb81200U, 0x00000000U, 0x0007c0d2U, 0x0004bbe7U, 0x000c1703U, 0x00000000U,
+  0xef19f5f0U, 0x1809e9aaU, 0xa005ca11U, 0x00000000U, 0x0cf8f835U, 0x15f510b5U, 0xfb4ba6eeU, 0x00000000U,
+  0x05e6f840U, 0x6e43fd7fU, 0x1ea21728U, 0x00000000U, 0xeef8fde7U, 0xe333a4feU, 0xc6cad710U, 0x00000000U,
+  0xe0e4000fU, 0xb80000e1U, 0xd2360023U, 0x00000000U, 0x23f5050dU, 0x21073a3bU, 0xe71c2a3fU, 0x00000000U,
+  0x0d222c00U, 0x06fff900U, 0xe7e10100U, 0x00000000U, 0x00e2ecd3U, 0x00feb8ccU, 0x0005c0ffU, 0x00000000U,
+  0xce24e224U, 0x0d04fbd3U, 0x1a00c8fcU, 0x00000000U, 0x1f08ee17U, 0x11d912cfU, 0x0722f1b3U, 0x00000000U,
+  0x0dffd92cU, 0x01eceb57U, 0x25a9f808U, 0x00000000U, 0x08f5fae8U, 0x1a26acefU, 0xdb00d722U, 0x00000000U,
+  0x06d40020U, 0xedea00c5U, 0xddf70032U, 0x00000000U, 0x08fff028U, 0xf80e1438U, 0xf5120832U, 0x00000000U,
+  0x110c2800U, 0x07ece500U, 0x0a1eed00U, 0x00000000U, 0x00f4f1fcU, 0x00fad8e2U, 0x00ecc8f7U, 0x00000000U,
+  0xda1e030eU, 0x13ebf1f9U, 0x5ad3e538U, 0x00000000U, 0x210ccf0aU, 0x0cdb0bf5U, 0xd4281de0U, 0x00000000U,
+  0x0ee8d33bU, 0xe3e9022dU, 0x20dbcadfU, 0x00000000U, 0x04b920eeU, 0x0329e5fbU, 0xfa1fd02cU, 0x00000000U,
+  0x23ad000bU, 0x11e5009fU, 0xbffb001bU, 0x00000000U, 0xd817ce11U, 0xb81e1022U, 0xba15ff32U, 0x00000000U,
+  0xf6041900U, 0x17dd1900U, 0x23252400U, 0x00000000U, 0x00d604e3U, 0x00f504d9U, 0x00e2ed3eU, 0x00000000U,
+  0x153305ffU, 0x4604bcd8U, 0x58b3cf28U, 0x00000000U, 0xfe07da1aU, 0x02e80af6U, 0x2b1a0dfeU, 0x00000000U,
+  0x0b01fd2bU, 0xf4e91c21U, 0x1a0716f2U, 0x00000000U, 0xd38131d0U, 0xe51f1a00U, 0xd451dc15U, 0x00000000U,
+  0xb01100e3U, 0xaf1000f5U, 0xe01d0006U, 0x00000000U, 0x23f2f4e5U, 0xd0df2ffeU, 0xfcf2f726U, 0x00000000U,
+  0x00000a00U, 0x03defb00U, 0xfa202400U, 0x00000000U, 0x0000dcebU, 0x00f8befbU, 0x00d74dfbU, 0x00000000U,
+  0xb81ee9efU, 0x0323d2b6U, 0xd5ebc4e8U, 0x00000000U, 0xf51de616U, 0xf0081dddU, 0x0754e303U, 0x00000000U,
+  0x0ccaf925U, 0x1711094cU, 0x38c7091fU, 0x00000000U, 0xf9f4ff24U, 0x0d08c103U, 0xede3e502U, 0x00000000U,
+  0xbc230012U, 0xb93900f9U, 0xb420000cU, 0x00000000U, 0x28e7f5edU, 0x1ee510f7U, 0xfe041b34U, 0x00000000U,
+  0xf7272500U, 0x1417f200U, 0xdb042300U, 0x00000000U, 0x00ebf8f2U, 0x00fbcf0eU, 0x00d347ffU, 0x00000000U,
+  0xe03ce8fcU, 0x1727f4cdU, 0xb303bcdaU, 0x00000000U, 0x2a15bb20U, 0x18fe04c2U, 0x1536bcffU, 0x00000000U,
+  0x1fdbe74aU, 0x373c1356U, 0x26a5f10aU, 0x00000000U, 0xcff60cf0U, 0xef04c4efU, 0xe835d330U, 0x00000000U,
+  0xf9040020U, 0xd21e00f8U, 0xb5fd00e4U, 0x00000000U, 0x2800e503U, 0x1d011635U, 0x05f8fd1eU, 0x00000000U,
+  0xf6293300U, 0x2017f000U, 0x011b1900U, 0x00000000U, 0x00ff08f3U, 0x0004d710U, 0x00cdc807U, 0x00000000U,
+  0xd014fafdU, 0x071107e3U, 0x080ed0f4U, 0x00000000U, 0x4217b118U, 0x24fafac0U, 0x11370bd4U, 0x00000000U,
+  0x1ec3e115U, 0xfe1d2268U, 0x14e1cfdfU, 0x00000000U, 0xc6c2ebeeU, 0x19f0e6f2U, 0x11f6e642U, 0x00000000U,
+  0x08de0010U, 0x04ef00d1U, 0xe71900f2U, 0x00000000U, 0x2ef6ce08U, 0x10092d04U, 0xf3d4e304U, 0x00000000U,
+  0xf83a1500U, 0x2410d900U, 0xf51f0600U, 0x00000000U, 0x00f4f5e3U, 0x00f5e9efU, 0x00d3d805U, 0x00000000U,
+  0xc324f3f3U, 0x2009ffe7U, 0x2cd8c3f5U, 0x00000000U, 0x1d1a9939U, 0x27ee16e9U, 0x1f17febcU, 0x00000000U,
+  0x14cdec42U, 0x0ef52d2fU, 0x110fe5cdU, 0x00000000U, 0xc787f5f5U, 0xfe00e404U, 0xea2beb0eU, 0x00000000U,
+  0x16d500fdU, 0x36eb00c7U, 0xe7e300b5U, 0x00000000U, 0x1cf5daf0U, 0xd80109f1U, 0xb61d0914U, 0x00000000U,
+  0xf6321300U, 0x0fe10f00U, 0xde541d00U, 0x00000000U, 0x00ebe9edU, 0x00f400ccU, 0x00e90f3eU, 0x00000000U,
+  0xf62bf8f9U, 0x1522d7edU, 0x18c6d1d3U, 0x00000000U, 0x011fc31eU, 0x22e5fdf1U, 0x3902fbf2U, 0x00000000U,
+  0xf4f5fb1dU, 0xf8ee1023U, 0x00ed1a11U, 0x00000000U, 0xe796fde1U, 0xf5f205ffU, 0xdbf6e236U, 0x00000000U,
+  0xcd1d00ebU, 0xe0fe0017U, 0xdd4000deU, 0x00000000U, 0x06cbe4edU, 0xecd433e5U, 0x03f90316U, 0x00000000U,
+  0xf12d0900U, 0xeafe0100U, 0x09fa1e00U, 0x00000000U, 0x00f0ebfbU, 0x00dbf312U, 0x00dd2907U, 0x00000000U,
+  0xc81edff5U, 0xdc21fddbU, 0xebf6d4e0U, 0x00000000U, 0xe937f706U, 0xf9ed01c5U, 0x0c45080bU, 0x00000000U,
+  0x1ec4eb19U, 0x0d11e30bU, 0x3b000704U, 0x00000000U, 0xfde9fef9U, 0x2bd0de00U, 0xe940da10U, 0x00000000U,
+  0xea2800f6U, 0xe9e900ffU, 0xbe4500ecU, 0x00000000U, 0x17ddf5ecU, 0x28c53af3U, 0xf806d6e7U, 0x00000000U,
+  0xe50f0100U, 0x1418cd00U, 0xf7ea3800U, 0x00000000U, 0x00e6e2ecU, 0x00e5e5fbU, 0x00c0fa25U, 0x00000000U,
+  0xc527ead7U, 0xd7f2f7e1U, 0xdee8d2f4U, 0x00000000U, 0x1b36d71eU, 0xed0d18baU, 0x544bdc04U, 0x00000000U,
+  0x27d524f2U, 0x1607da27U, 0x2320f4fdU, 0x00000000U, 0xdedef601U, 0x21ffe1d8U, 0xec29c525U, 0x00000000U,
+  0x22ed00deU, 0x192100daU, 0xcc2900d0U, 0x00000000U, 0xf7fd0ee3U, 0x2bff26efU, 0xafedbfd5U, 0x00000000U,
+  0xd2141000U, 0x28ffc200U, 0x04343800U, 0x00000000U, 0x00d3dfe1U, 0x00fec2f5U, 0x00c1c125U, 0x00000000U,
+  0xcb1d07deU, 0xfbdfffe2U, 0xc2fcd6d8U, 0x00000000U, 0x2b4eb018U, 0xe04818b0U, 0x4b12fde3U, 0x00000000U,
+  0x23d61817U, 0x1713002eU, 0x0f2bcfeaU, 0x00000000U, 0xe0b1111eU, 0x1803e91bU, 0x05f5d1eaU, 0x00000000U,
+  0x1bc800eaU, 0x182000c4U, 0xfdfd00b5U, 0x00000000U, 0x15eae7d6U, 0x0e031406U, 0xa9efe00bU, 0x00000000U,
+  0xce360d00U, 0x2cf3df00U, 0xe57cfb00U, 0x00000000U, 0x00c2f3d5U, 0x0007dfe5U, 0x00ee26fdU, 0x00000000U,
+  0xf02efaf7U, 0x0a01f5e5U, 0xe1dff7daU, 0x00000000U, 0x1f2ccc0dU, 0x092d19dfU, 0x1c01f7d8U, 0x00000000U,
+  0x10c60ff5U, 0x211916faU, 0xee26f600U, 0x00000000U, 0xfcad0a0dU, 0x1a0be00aU, 0xe5e1e805U, 0x00000000U,
+  0x12e500e3U, 0x102000c4U, 0x10fb009cU, 0x00000000U, 0x2501e6ebU, 0xecfdf6f0U, 0xd8080b05U, 0x00000000U,
+  0xf52f2200U, 0x1ce20c00U, 0xdd42db00U, 0x00000000U, 0x00d2facfU, 0x0007dbc5U, 0x00073fe7U, 0x00000000U,
+  0x1019f6f6U, 0x0cf5ebf6U, 0xd5e8f5ddU, 0x00000000U, 0xfd27e508U, 0x0a0affefU, 0xf5161415U, 0x00000000U,
+  0xf7fdfcf6U, 0x18020ae8U, 0xe108ff13U, 0x00000000U, 0xfabcfd15U, 0x08fd04f3U, 0xda04000cU, 0x00000000U,
+  0x000f00fdU, 0xe8e5002fU, 0x31fd0026U, 0x2bfb005bU, 0xece80adeU, 0x0925fc00U, 0x1efcfc03U, 0x030e00f8U,
+  0x09cc2500U, 0x053b1a00U, 0xfb020800U, 0xf6173900U, 0x00facee0U, 0x00f72deaU, 0x00192a19U, 0x00d3e3ddU,
+  0xfaebc71aU, 0x0cf82838U, 0x021e1e0aU, 0x1303d128U, 0x04f1f907U, 0x0b27c6d8U, 0x0df1f916U, 0xfe1ed80eU,
+  0xf1eaf803U, 0xe9e610f1U, 0xfb25fb1cU, 0xf0fd0c1aU, 0x0705ed01U, 0xf8e527fdU, 0xf9c5110aU, 0xf4d7fc04U,
+  0xf42a00c0U, 0x094800f6U, 0x01fb0046U, 0xfdfa0029U, 0xcd0513fdU, 0x23e0e8ddU, 0x17e0f4fbU, 0xfaeeedecU,
+  0x01e20b00U, 0xf5503c00U, 0x00f61700U, 0xcd064f00U, 0x0041c2c1U, 0x000444d4U, 0x0012f73fU, 0x00f6d5f1U,
+  0xf5f6e01eU, 0x06180733U, 0xeb011424U, 0xe618e80aU, 0xd9eecef3U, 0xf336b9f8U, 0x2ae90d02U, 0xfe3fd0f4U,
+  0xfbd5fdffU, 0xf3f51b05U, 0xf923f708U, 0xead4f535U, 0xdff203f9U, 0xdbc20901U, 0x02b4fbf3U, 0xeca8eafeU,
+  0x0b2800bdU, 0x36480002U, 0xf4140029U, 0x1c080014U, 0xdc271a02U, 0x41bddedfU, 0x05d6e7f6U, 0xfbf9f705U,
+  0x08fd2000U, 0xfb726600U, 0xf8ea2800U, 0xd0f84800U, 0x0010e0bcU, 0x000849ebU, 0x000a082dU, 0x0018d0f6U,
+  0x0a10e440U, 0xcb0fd00dU, 0xdcee0f22U, 0xc2f6f71eU, 0xdd29e0eaU, 0xd745b413U, 0x3ef0e704U, 0xf71be7e4U,
+  0xefb208c0U, 0x09d542fcU, 0xe521050aU, 0xfccf1621U, 0xcdf90cfbU, 0xddabf325U, 0xeebf03f5U, 0xccaa0dfdU,
+  0xff1000c1U, 0x1e360000U, 0xe8260019U, 0x0df100fbU, 0xed33fa1dU, 0x56e9e9f2U, 0xf9deee0bU, 0xeddefd0aU,
+  0xef0f0a00U, 0xdd6f5300U, 0xedee1e00U, 0xf9ed3100U, 0x00eae4a3U, 0x00282907U, 0x00091527U, 0x0038e7d9U,
+  0x23f8f101U, 0xd022b9ddU, 0xc9e5140bU, 0xbee0e332U, 0xea28dae5U, 0xfc25a6f4U, 0x38f2e506U, 0x07ea01e5U,
+  0x13b74ee9U, 0x08ce3a31U, 0xfa20fb10U, 0x08b9150bU, 0x0705de0aU, 0xc1d2d63dU, 0xdee1fbf5U, 0xdeca1bf0U,
+  0xfafd00a8U, 0x231e001bU, 0xeb170005U, 0xd6da00e9U, 0xf3ed0b0eU, 0x0ed4f001U, 0xe30af60fU, 0xedf2ff01U,
+  0x0aeafc00U, 0xc8262300U, 0xf60e1a00U, 0xfeca1200U, 0x0001f5c4U, 0x0028ffeaU, 0x000a092bU, 0x001ef9deU,
+  0xfb10d810U, 0xbf11c9fcU, 0xfbde0a13U, 0xdbf1d828U, 0xf90c0cf7U, 0x1945dae9U, 0x2beef60bU, 0xf7e508feU,
+  0x50b33221U, 0x16df4f48U, 0xf1320009U, 0x09b704ffU, 0x1207d20aU, 0xd4dcca18U, 0xec0400d6U, 0xf1e112eeU,
+  0xe5240003U, 0x1205004aU, 0x25e50020U, 0x0007007fU, 0xcedc1ef4U, 0x2a27fde9U, 0x0b02fc0aU, 0xf2e20ffeU,
+  0x0d192100U, 0x09f51d00U, 0xf5f01100U, 0xec335000U, 0x00ffdcc6U, 0x00217cf7U, 0x001bfe21U, 0x00cfebf3U,
+  0xd6d0c6fbU, 0x01064823U, 0xee1b3c14U, 0x02010423U, 0x07fef3fcU, 0x0401a8fdU, 0x26f3cd11U, 0xf447dfefU,
+  0x21d8f61cU, 0x01010af3U, 0x0c25f90cU, 0x1ee40302U, 0xf61cdffaU, 0xeecf2efdU, 0xf99d19eaU, 0x0bd303efU,
+  0xdaf800e1U, 0x4341002aU, 0x21eb0034U, 0xed17004cU, 0xd41e5921U, 0x100010dfU, 0x1009fbf4U, 0x1bd011f2U,
+  0x08320b00U, 0x1b091700U, 0x02f02900U, 0xc6215f00U, 0x001ae9c8U, 0x001371faU, 0x000a140aU, 0x00f7f304U,
+  0xdf00c906U, 0x0a111d0eU, 0xeff51509U, 0xb80c04daU, 0xebf3ecf5U, 0xbdf58917U, 0x29e9ec03U, 0xed5ef9eeU,
+  0x22d0ee05U, 0x120d22ecU, 0x0b29f811U, 0x0fd60929U, 0xe407e3feU, 0xe5f50a16U, 0x0fb1de07U, 0x3199cce4U,
+  0xeafd00d6U, 0x2b3e001aU, 0x090a001fU, 0xf92c0031U, 0xe80d6c23U, 0x08e43f11U, 0x06f5ecf3U, 0x28f3e9e5U,
+  0x10d90700U, 0x21090400U, 0xf8f42400U, 0xe4194200U, 0x002bb3b9U, 0x0001371dU, 0x0011371cU, 0x0029ecf2U,
+  0x0407f3f5U, 0x1cfae7f2U, 0xddf319f2U, 0xc00826e5U, 0x0422dfc8U, 0xe8f1b418U, 0x0beee315U, 0x133303eaU,
+  0xd8e103f5U, 0xfc1f0c0aU, 0xf014f71cU, 0x2a142d18U, 0x1226f902U, 0xcc351221U, 0xe2c6f007U, 0x08acecdfU,
+  0x0cee00e5U, 0xf9070004U, 0xff1f0023U, 0x19140022U, 0xe2e0291aU, 0x24fc3fe9U, 0xf5edee00U, 0x22e4d219U,
+  0x2de2da00U, 0xe438f100U, 0xcbe4fd00U, 0x13d02500U, 0x0015aad3U, 0x000f2f26U, 0x002e2228U, 0x0070e501U,
+  0x13d3fc00U, 0x2f23cbf0U, 0xd2fb0deeU, 0xd4f73af9U, 0x192300c9U, 0xef00d400U, 0x1705da0cU, 0x2d1114eeU,
+  0x07f1130eU, 0x021623f5U, 0x0810fd0bU, 0x25052c29U, 0x2918d201U, 0xe7220922U, 0xd1e5db0dU, 0xf7bb26d9U,
+  0xe1f300eeU, 0x082000fbU, 0xf82b000fU, 0x00f20028U, 0xd2d318f1U, 0x0e1014f3U, 0xf5f7f0f9U, 0xfdeef207U,
+  0x3de21300U, 0xce570400U, 0xe90ced00U, 0x25be1900U, 0x0022e1ebU, 0x0006fcf3U, 0x003e0729U, 0x0074edf9U,
+  0x0ff000d1U, 0x063998deU, 0xd9eb0630U, 0xdceff946U, 0x2d1011e0U, 0x2243c0eeU, 0x12fee315U, 0xfed207fbU,
+  0x4ce72127U, 0x231e2949U, 0xf51eef14U, 0xfee3f134U, 0xf926cce0U, 0xed13ae2dU, 0xcfecf21cU, 0xebe22bd9U,
+  0xc32700ebU, 0x2f00000dU, 0x3dd80017U, 0x09fd0049U, 0xf9e40ef7U, 0xfb0600fdU, 0xf406f505U, 0x050704ebU,
+  0xfb2b0900U, 0x04ba2000U, 0x01b91000U, 0x06314300U, 0x0031ffe4U, 0x00ff5a11U, 0x0021041cU, 0x00fa0c1fU,
+  0x0ce6c7d0U, 0x0908f714U, 0xdc13200cU, 0xeef83505U, 0xfc0800deU, 0xfd0bd9f9U, 0x41dbf436U, 0xe545cc02U,
+  0x30fe0820U, 0x023ee713U, 0x022cbf09U, 0x0bf40401U, 0xef09b7f9U, 0xffddeed5U, 0x0797fde1U, 0xf2c8f904U,
+  0xf22500e2U, 0x17240007U, 0x0dfb0026U, 0x04250029U, 0xf2094204U, 0xdbfbf928U, 0xfdfefbfaU, 0x0902ed06U,
+  0x0726f100U, 0x26b60800U, 0x10813400U, 0xfa194600U, 0x003cba04U, 0x00192f0eU, 0x00132806U, 0x00f80800U,
+  0xff14cbbdU, 0x0cfe0c1fU, 0xe20311feU, 0xd6ebf6efU, 0xfe261dc1U, 0xefd0e8ecU, 0x3be1f04aU, 0xfd21d10eU,
+  0x19220046U, 0xed2126faU, 0x0bfce212U, 0x24f42705U, 0x1615a3f5U, 0xf20af40fU, 0x06b90bf1U, 0xecccef06U,
+  0x01010001U, 0xc22900fdU, 0xf7fe0006U, 0x152c0005U, 0xe9f5371eU, 0xf7f94220U, 0xfbfafc0bU, 0x09edf1eeU,
+  0x1ce9ec00U, 0x05b2c200U, 0x00d10c00U, 0x06142a00U, 0x001b90e9U, 0x002ad64eU, 0x00201d26U, 0x003a09e4U,
+  0x320c00d9U, 0x33c824d7U, 0xeb0f15f0U, 0xb3f7ecdaU, 0x0b28f8b5U, 0xefb02fe2U, 0x2bdbf715U, 0xf944c616U,
+  0xe4e03441U, 0xf94303ecU, 0x1902dc1dU, 0x19f81d12U, 0x17ffc7e7U, 0x300ffa28U, 0xebe016eeU, 0xcde2d203U,
+  0x060300ecU, 0xe91900bbU, 0xf519000eU, 0x0deb0011U, 0xdbe31100U, 0xf73751f2U, 0xea03f7eaU, 0x08f8d500U,
+  0x44bfe100U, 0xd9f0d400U, 0xe3f2e400U, 0x1dff2400U, 0x0009bc17U, 0x000be435U, 0x00291c1cU, 0x004203e5U,
+  0x06d1f7d8U, 0x40d61de9U, 0xe91c0e30U, 0xd41b111cU, 0x1918f3eeU, 0xeac233d7U, 0x1fe2db11U, 0x2833eb1bU,
+  0x02e53c03U, 0xff2c3ef4U, 0x0620ce0aU, 0x1ee8152bU, 0x20ee9a08U, 0x2d4b1426U, 0xedf50814U, 0xd6d1e1f0U,
+  0xd3030004U, 0x021000e9U, 0xf01900f6U, 0x2616001aU, 0xcdef18ecU, 0xef0f4408U, 0xf30bfa14U, 0xc6f0d600U,
+  0x1df00f00U, 0xcc2ef700U, 0xed16fe00U, 0x0be30c00U, 0x0006f91aU, 0x00f5e30cU, 0x002b0525U, 0x0043efc5U,
+  0x15e830d2U, 0x0ee4b8edU, 0xc405ed30U, 0xf9221e0dU, 0x041a150bU, 0xe9301bd1U, 0x15f7f917U, 0x0ce6f3e9U,
+  0x2f192409U, 0xfef84523U, 0xf030e316U, 0x13d83440U, 0xd718dc02U, 0x3f1edb2fU, 0x02fbf919U, 0xb7daf1ecU,
+  0xb42400fcU, 0x2efb00e6U, 0x3dc900fcU, 0x1dfa000bU, 0xf0042cf8U, 0xd1d5030bU, 0xcb03000dU, 0xd728e304U,
+  0xed12fb00U, 0xf5d7f300U, 0x11ad0900U, 0x25fd0500U, 0x0025da13U, 0x00f7471fU, 0x001716fdU, 0x00132819U,
+  0x1504d5c6U, 0xd30bcee0U, 0xea0c1bfcU, 0xfcfc78e4U, 0xec1123c9U, 0xfdfbf6ecU, 0x26f70425U, 0xebdfe520U,
+  0x1c121042U, 0x1c41bf01U, 0x01d7bbfbU, 0xeb06fc08U, 0x2811e102U, 0xf9f1cfe1U, 0x1fdc05e0U, 0xeabc1bf5U,
+  0xc72200e8U, 0xcefa00f1U, 0x0dd2000bU, 0x1a050022U, 0xfb133ae7U, 0xeee10232U, 0xe3f7f11fU, 0xc9f3e0f7U,
+  0xe0fae200U, 0xf3d3e600U, 0x1abb1600U, 0xfefefd00U, 0x00f98934U, 0x0013eb31U, 0x000720efU, 0x000d220dU,
+  0xeb18d1a5U, 0xf614dbd5U, 0xefec2918U, 0xf20538f7U, 0xf72c0eb6U, 0x1bea03b1U, 0x22d51b34U, 0x1aefc926U,
+  0x1118253dU, 0x32fef11eU, 0x16d0caecU, 0xfde64002U, 0x1b199df7U, 0xfc19a51fU, 0x16cc34e6U, 0xcea72003U,
+  0xd10e00e6U, 0xc2ee00fcU, 0xfbe20029U, 0x16120000U, 0xfa05f218U, 0xf7f73211U, 0xe804030aU, 0xf6e8f120U,
+  0x020de800U, 0xf2dde400U, 0x00f00f00U, 0xebe7e700U, 0x00e98114U, 0x00f9c82aU, 0x001f2e02U, 0x004814d7U,
+  0x2406e6d1U, 0xebe2f6b9U, 0xff074916U, 0xe3221bf3U, 0xea2befcdU, 0x10d442afU, 0x1bd7ff25U, 0x0c29b408U,
+  0x030a2f17U, 0x1725e50aU, 0x000fe3e2U, 0x0ccb2515U, 0x2710bbe5U, 0x322bdbf9U, 0xebfe29e7U, 0xf3c20925U,
+  0x060b00f6U, 0x180200f1U, 0xfc070031U, 0x271a000fU, 0xdadffb0fU, 0xe10839f9U, 0xe9f2060eU, 0xddfdfb24U,
+  0x19dc0200U, 0xe0cbe800U, 0xfdfaf800U, 0x0312f700U, 0x000dc2efU, 0x0012eb4bU, 0x0037330dU, 0x0016fdd8U,
+  0x15faeff7U, 0xe1d111afU, 0xf4f7282cU, 0xec283116U, 0xf1f21befU, 0x09d028c1U, 0x0ce30316U, 0x0442ff04U,
+  0x031e14f2U, 0xe840042aU, 0xf114e4f9U, 0x28eaff2aU, 0x2b26d6e9U, 0x4423f1fdU, 0xf5fa18e3U, 0xcbc6211dU,
+  0x19ee00ebU, 0x26e600ecU, 0xe9fb0016U, 0xfc4400fdU, 0xdf2c3cf1U, 0xcfe7490eU, 0xf7f5f638U, 0xdaec002bU,
+  0x1fef2e00U, 0xe8fbe400U, 0x04f10d00U, 0x081cd800U, 0x00fb1ef3U, 0x0020fd42U, 0x004f1501U, 0x001800a4U,
+  0x42211a01U, 0xe4d1dcbcU, 0xddf9201bU, 0x111c0c10U, 0xe4fd3e0fU, 0x2d001edcU, 0x24fd0f03U, 0xf327f6dbU,
+  0x0c5feefbU, 0xeef2ec3bU, 0xff06dc04U, 0x02b5332eU, 0xee4302ffU, 0x41ddec26U, 0xf3f00af5U, 0xd3eb1b21U,
+  0xe22300feU, 0x1bee000eU, 0xffff0010U, 0x03e9000cU, 0xe70f43ffU, 0xb9e7def0U, 0xcadd0e22U, 0xdc1f0f20U,
+  0x02e70600U, 0xfddaf100U, 0x05c50200U, 0x1dcef200U, 0x00c9c132U, 0x00133efcU, 0x0022f8faU, 0x0000f619U,
+  0x0113f6deU, 0xe907e800U, 0xf80afb17U, 0x11080efaU, 0xf70531deU, 0xfaebf4efU, 0xed392e02U, 0xfaf941feU,
+  0x142d0cfcU, 0x0e1aec0dU, 0x0fc0f615U, 0x0c03fd1aU, 0x3927ec0dU, 0xf4d4e4feU, 0x1e03f5e8U, 0x180408d4U,
+  0xc13c00efU, 0xdd0800d0U, 0x06d30016U, 0x10e90004U, 0x00ec39edU, 0xe2c6d5e7U, 0xe3df0a35U, 0xb3050b1eU,
+  0xfff20f00U, 0xe700e500U, 0x21020000U, 0x22c8df00U, 0x00e1b831U, 0x00ef143cU, 0x0013eef4U, 0x001be824U,
+  0xdce3dddcU, 0x8815e0dfU, 0xe50e0519U, 0x05e822fdU, 0xfff527c2U, 0x2af904bfU, 0xf73e2b1fU, 0x2dfa4816U,
+  0x0728f8fdU, 0x1ff7bcfeU, 0x08ecea12U, 0xfce3260bU, 0x3415d4fdU, 0x15e3b3f7U, 0x0cfc00d1U, 0x0be6f3c2U,
+  0x025f00edU, 0xf4ec00e3U, 0xfef5002fU, 0xff3c001bU, 0xfed819faU, 0x13dbe5d6U, 0xe5e80d1cU, 0x04ee2c3aU,
+  0x3f0bfb00U, 0xe70ee000U, 0x1bf21900U, 0xe4b7d800U, 0x00120015U, 0x00e41734U, 0x000af9e7U, 0x0021f1feU,
+  0xeffef900U, 0x811100b7U, 0xf7052120U, 0xfdde040fU, 0xea0424cbU, 0x111a23cfU, 0xf8262415U, 0x25054af7U,
+  0xe21edde7U, 0x08d5ded6U, 0x0a0d0303U, 0x29e81102U, 0x2a1dced4U, 0x1e0ee40aU, 0xfe1119e5U, 0x33f40500U,
+  0x410b00f7U, 0x1bd800fbU, 0xf4f10034U, 0xf05d0049U, 0x22f101e6U, 0x29defff4U, 0xf7fd071aU, 0xfb0f2f4bU,
+  0x3d120600U, 0xecefee00U, 0x0c081500U, 0x07d4da00U, 0x001a1cc4U, 0x00efef32U, 0x0016f1f2U, 0x0005fdfdU,
+  0x15faff30U, 0x8af619b8U, 0xeb0f3228U, 0xfff62945U, 0xdae332e6U, 0x081416eaU, 0xf6161a16U, 0xff2224ecU,
+  0x123207d3U, 0x05fa020eU, 0x141b08f6U, 0x2e01de2aU, 0x0622f7d6U, 0x20d5fb2dU, 0xed0a16ebU, 0x0d1d0a37U,
+  0x22e000c1U, 0x53e1000eU, 0xf6e80019U, 0xd8600027U, 0x17210516U, 0xf5d41307U, 0x0614fb10U, 0x00f02d1dU,
+  0x36e81c00U, 0xe8f8d200U, 0xfbf21900U, 0x00029e00U, 0x000124c7U, 0x00e40b36U, 0x00130bebU, 0x0014e308U,
+  0x4a1a0333U, 0xadd60fc3U, 0x0f19240fU, 0xd9041a0dU, 0xbefb3803U, 0x41ea18e4U, 0x0f1113f3U, 0xd517fafdU,
+  0x0d43fcfeU, 0x0ea8dcfaU, 0x181afe0dU, 0xe9bafe05U, 0xef420bf7U, 0x3addfefbU, 0xd60207dcU, 0x00390b36U,
+  0x00000000U, 0x01ee0018U, 0x02ff00e2U, 0xfae000faU, 0x00000000U, 0x16020315U, 0x06fefc12U, 0xfff602e5U,
+  0x00000000U, 0x03edee00U, 0x07c5ff00U, 0x03ecf000U, 0x00000000U, 0x00f2ff1eU, 0x00301313U, 0x00030f03U,
+  0x00000000U, 0x04051ff3U, 0xf3ff22dbU, 0xf7f7f9daU, 0x00000000U, 0x0118f6f9U, 0x02d9ef04U, 0x01e4e60eU,
+  0x00000000U, 0x0f0efd02U, 0xe10be2f9U, 0x0bfbf510U, 0x00000000U, 0xfefe0fffU, 0xfbd50f02U, 0xfae3eafcU,
+  0x00000000U, 0xfae90022U, 0xdfd6000cU, 0x0dee0011U, 0x00000000U, 0x29d3ec10U, 0x1ce1ed22U, 0xe30205ccU,
+  0x00000000U, 0xfaf31500U, 0x02f0ea00U, 0xf8e4ec00U, 0x00000000U, 0x00f8191aU, 0x001d3133U, 0x00270103U,
+  0x00000000U, 0x0e0bfe07U, 0xf3ed4816U, 0xeae91fd8U, 0x00000000U, 0x180b11fbU, 0x0edb02efU, 0x02d02707U,
+  0x00000000U, 0x192e041fU, 0xfb1acdf7U, 0x21f1c3eeU, 0x00000000U, 0xeefbef09U, 0xf6ab10edU, 0x08db06dfU,
+  0x00000000U, 0xeed0001aU, 0xd6f2001cU, 0x0ff70033U, 0x00000000U, 0x0ce9e80eU, 0x20e4d62bU, 0xccfa0fd0U,
+  0x00000000U, 0xff152900U, 0x11fdf700U, 0x02d41000U, 0x00000000U, 0x00180c1bU, 0x00082442U, 0x001ce21fU,
+  0x00000000U, 0x0405021fU, 0xedbd4c3fU, 0xd4f81a12U, 0x00000000U, 0x04ec1914U, 0x1bb3fffcU, 0x080a18e0U,
+  0x00000000U, 0x0539df07U, 0x0130cee2U, 0x08ebbe07U, 0x00000000U, 0xe4e3fd00U, 0xdcc016eaU, 0x0dceeac6U,
+  0x00000000U, 0x06d800e2U, 0xa3e60034U, 0xeae2000fU, 0x00000000U, 0x0a00f0feU, 0x10f6c8f8U, 0xbdf1fdddU,
+  0x00000000U, 0xea041900U, 0x2b12ef00U, 0xf6f60300U, 0x00000000U, 0x00fb07e5U, 0x00e30d2eU, 0x00020032U,
+  0x00000000U, 0x200d1511U, 0xebd72736U, 0xb5f7fb1cU, 0x00000000U, 0x02f3020eU, 0x3ed2db0eU, 0x1019fcfaU,
+  0x00000000U, 0xe532db02U, 0xea6f03e6U, 0x0703f0dfU, 0x00000000U, 0xe7eb05f8U, 0xaeb0d1f0U, 0xd3d2eed3U,
+  0x00000000U, 0x14d900e6U, 0xa2d8000dU, 0xceeb001bU, 0x00000000U, 0x0e2202e6U, 0xe633e809U, 0xc905f9efU,
+  0x00000000U, 0xefe3ff00U, 0x113f0d00U, 0x12071900U, 0x00000000U, 0x00ebfee3U, 0x00ea1550U, 0x00ee2732U,
+  0x00000000U, 0x12f713ebU, 0x19c5051bU, 0xff05fc2aU, 0x00000000U, 0xf4f1f6f7U, 0x3a1bf408U, 0x141ced07U,
+  0x00000000U, 0xe015e0feU, 0xfd7f0cffU, 0x091ed4efU, 0x00000000U, 0xf4eaff08U, 0xaadff0edU, 0x0bf6f1e3U,
+  0x00000000U, 0x2bef0016U, 0x1bca00d6U, 0x07ef0009U, 0x00000000U, 0x0a14ee10U, 0xf8f8f81cU, 0xf115f6deU,
+  0x00000000U, 0x0dfef600U, 0xf3abce00U, 0xf5d90500U, 0x00000000U, 0x000e2820U, 0x00582a22U, 0x005ef41cU,
+  0x00000000U, 0xfa0f34f8U, 0xf21b37f8U, 0xe4ef2ae9U, 0x00000000U, 0x0616230dU, 0x2ddd190fU, 0x11e7c20fU,
+  0x00000000U, 0x0222e3f6U, 0xfe0fcb02U, 0x19f5ef0cU, 0x00000000U, 0x0fea1ffeU, 0x08a31fdbU, 0xfdbf0af2U,
+  0x00000000U, 0x0bfd0024U, 0xfad5000fU, 0x16e30015U, 0x00000000U, 0x0207eb07U, 0x12fafe2dU, 0xfd12fbd6U,
+  0x00000000U, 0xe9f91f00U, 0x0ab6ee00U, 0xe7e01200U, 0x00000000U, 0x000d4e23U, 0x00361e23U, 0x004606f3U,
+  0x00000000U, 0xfefe3df1U, 0x0be8562dU, 0xddf238f0U, 0x00000000U, 0xf8ed1d2dU, 0x15c3ea11U, 0x05ffc8f3U,
+  0x00000000U, 0x1729f11aU, 0x2f02c214U, 0x1debcb23U, 0x00000000U, 0xf3dc0ef0U, 0x03bc16ebU, 0x22ca03e3U,
+  0x00000000U, 0xe6ea0023U, 0xf2ef00feU, 0x00e70037U, 0x00000000U, 0x0415cb1dU, 0xf6f4dc10U, 0xf30200c6U,
+  0x00000000U, 0xec213200U, 0x2800f500U, 0xf1fc2100U, 0x00000000U, 0x00f0430eU, 0x00322416U, 0x0023f901U,
+  0x00000000U, 0xf2072a1fU, 0x07da433bU, 0xdefe1cf0U, 0x00000000U, 0xfbf1f50fU, 0x34b4e604U, 0xff16ce19U,
+  0x00000000U, 0x021dda33U, 0x0456ea17U, 0x14eaadf9U, 0x00000000U, 0xe3df15ecU, 0xc0ba18f6U, 0xf0c4ebebU,
+  0x00000000U, 0x11ee00f8U, 0xceeb0010U, 0xe2e70004U, 0x00000000U, 0xfe23e602U, 0x0011eee8U, 0xf60610cfU,
+  0x00000000U, 0xd4341100U, 0x26140500U, 0xf6f11500U, 0x00000000U, 0x00dd2ac0U, 0x001b0e09U, 0x00331403U,
+  0x00000000U, 0xfa11fa03U, 0x0bfa153aU, 0xee191af6U, 0x00000000U, 0x00f5d8ffU, 0x4ad7c805U, 0x162ddc06U,
+  0x00000000U, 0xec23ec18U, 0xed520b09U, 0xf7f8cce0U, 0x00000000U, 0xd6bc0e09U, 0x9ac006eaU, 0xe2ace8e8U,
+  0x00000000U, 0x27fa0013U, 0xaccb000fU, 0xeb0e00faU, 0x00000000U, 0x0717f5faU, 0xd04add28U, 0xe2e9ede8U,
+  0x00000000U, 0xe1eff500U, 0xf8230900U, 0xe0e03b00U, 0x00000000U, 0x00d50dabU, 0x00df0123U, 0x0054fe31U,
+  0x00000000U, 0xe9fbde19U, 0x46b7f121U, 0xfa0ad90eU, 0x00000000U, 0xecece6fcU, 0x2f48c723U, 0x201ed006U,
+  0x00000000U, 0xe3f6dffcU, 0xfe612807U, 0x021ec7fdU, 0x00000000U, 0xfcdc1121U, 0x89dfd700U, 0xcab406f9U,
+  0x00000000U, 0x2ddb00fcU, 0x32c300e2U, 0x06e4000cU, 0x00000000U, 0x11fdf8f2U, 0xfefe0207U, 0xd60bf81dU,
+  0x00000000U, 0x00dbff00U, 0xf500d100U, 0x04b51900U, 0x00000000U, 0x00162afcU, 0x004534f1U, 0x002de80aU,
+  0x00000000U, 0xfbfd34e8U, 0xdb0625f7U, 0xcc063d01U, 0x00000000U, 0x02062c15U, 0x28eb3625U, 0x15040b11U,
+  0x00000000U, 0x0c10e601U, 0x0c14ac05U, 0x1fb8dc28U, 0x00000000U, 0x18de020aU, 0x33af1dd5U, 0x02c60ee9U,
+  0x00000000U, 0x24e50022U, 0x1de6000aU, 0x03f2000dU, 0x00000000U, 0xfcf3e60fU, 0xf3e8fee6U, 0xe3ea18e8U,
+  0x00000000U, 0x1ae92700U, 0xf5f1ec00U, 0xf7ae2d00U, 0x00000000U, 0x002c3512U, 0x004c102bU, 0x003a281eU,
+  0x00000000U, 0x12083426U, 0xfee63401U, 0xa01e3ff0U, 0x00000000U, 0x02e91514U, 0x2ebe061eU, 0xf803dc4eU,
+  0x00000000U, 0x1f1ed426U, 0x110aa114U, 0x28acc103U, 0x00000000U, 0x28c9f5ddU, 0x38d639edU, 0x30c03a01U,
+  0x00000000U, 0x06ec0047U, 0x19fb0014U, 0xfc0b003cU, 0x00000000U, 0x011fe538U, 0xf4f01b05U, 0xffdf02d3U,
+  0x00000000U, 0xfff52d00U, 0x1cf9e200U, 0x1bd73800U, 0x00000000U, 0x00180bfdU, 0x001e262cU, 0x002c07f2U,
+  0x00000000U, 0xf01b3039U, 0x3e0d2f1eU, 0xc80a4dfbU, 0x00000000U, 0x160ed7fdU, 0x3dad120bU, 0xfc08d24aU,
+  0x00000000U, 0xfe06e72eU, 0x0225d5f1U, 0x0adaa7f6U, 0x00000000U, 0xeeb525eeU, 0xfc0e2d02U, 0x20df13edU,
+  0x00000000U, 0x05e60005U, 0x0d030004U, 0xd02e001fU, 0x00000000U, 0x01250213U, 0xdd050414U, 0x22ebc4deU,
+  0x00000000U, 0xfb170300U, 0x371cfd00U, 0x0c061e00U, 0x00000000U, 0x000df2c7U, 0x00ee0613U, 0x002924e4U,
+  0x00000000U, 0xed14fdeeU, 0x15012933U, 0xeb13330eU, 0x00000000U, 0x0c13dff3U, 0x30b0cdffU, 0x2105de2fU,
+  0x00000000U, 0x03e3202dU, 0xf11af1f7U, 0xf405d5f7U, 0x00000000U, 0xe6bf1309U, 0xc02213e0U, 0xd7d129f7U,
+  0x00000000U, 0x20130005U, 0xa7f500cfU, 0x0174002fU, 0x00000000U, 0x1ff5f8f8U, 0x893fdd0eU, 0xfad3bdf8U,
+  0x00000000U, 0xfbede200U, 0x092b1700U, 0xe8f2fd00U, 0x00000000U, 0x00f0fab6U, 0x00d9d449U, 0x003a19eeU,
+  0x00000000U, 0xf7facef0U, 0x59efc31eU, 0xbeff14fbU, 0x00000000U, 0x01e1cdf1U, 0x2949b735U, 0x4511df0cU,
+  0x00000000U, 0x00db2311U, 0xfb422e26U, 0xf703ebfbU, 0x00000000U, 0x12e00823U, 0x86f1dd14U, 0xb9d20cfeU,
+  0x00000000U, 0x05e800f0U, 0x2ff600e0U, 0xfa0d001aU, 0x00000000U, 0xfb0514f4U, 0x261308d8U, 0xdef43b5eU,
+  0x00000000U, 0xe9f3fa00U, 0xfb32cd00U, 0x24cc1400U, 0x00000000U, 0x002007f9U, 0x00214ebeU, 0x0032dbfdU,
+  0x00000000U, 0xf70602edU, 0xf8faed15U, 0xebf5f307U, 0x00000000U, 0x0effff08U, 0x10e01309U, 0xf4182a1cU,
+  0x00000000U, 0xfe09e4feU, 0xf9feb60fU, 0x22c5c709U, 0x00000000U, 0x15ecf2ffU, 0x11ef15fcU, 0x2323f8e5U,
+  0x00000000U, 0x13f90013U, 0x11f00005U, 0x3bf2003dU, 0x00000000U, 0xf9f12b0fU, 0x4616f4ebU, 0xafd93b39U,
+  0x00000000U, 0xf9f81400U, 0xfc31fc00U, 0x28c52b00U, 0x00000000U, 0x0024f80dU, 0x00184615U, 0x000efed7U,
+  0x00000000U, 0xfb0fe8f5U, 0x03ff00feU, 0xe6e81c41U, 0x00000000U, 0x270217ebU, 0xfe0728e3U, 0x02274650U,
+  0x00000000U, 0x2008cc0dU, 0x2302c01dU, 0x02dfbef3U, 0x00000000U, 0x2207d0f2U, 0x220b2405U, 0x02102cdeU,
+  0x00000000U, 0xde1a002eU, 0x2200000aU, 0x20180045U, 0x00000000U, 0xfe072530U, 0x11f40f16U, 0xa4d12e29U,
+  0x00000000U, 0x07001400U, 0x09180100U, 0x26cb2500U, 0x00000000U, 0x00f6e714U, 0x00f3442bU, 0x0000fbbfU,
+  0x00000000U, 0xcbed01f2U, 0xff1807f2U, 0xe3f92539U, 0x00000000U, 0x3f24de00U, 0x29c219edU, 0x04026b16U,
+  0x00000000U, 0x1bedda12U, 0x213aca31U, 0xf91800e5U, 0x00000000U, 0x03f1f0f8U, 0xf42318dfU, 0xf44f25edU,
+  0x00000000U, 0xe40b000bU, 0x01ef00eeU, 0xf409002cU, 0x00000000U, 0x08eef60bU, 0xea192111U, 0xc5072022U,
+  0x00000000U, 0x0c0df100U, 0x16fbe600U, 0x5eee0000U, 0x00000000U, 0x00ddf101U, 0x002e3d41U, 0x002c07afU,
+  0x00000000U, 0x9dfbefd0U, 0x26ededcfU, 0xffeb0631U, 0x00000000U, 0x2115ecf1U, 0x35c0ec0dU, 0xf70a4b02U,
+  0x00000000U, 0x0dc62d17U, 0xf22c0008U, 0xe4f236f5U, 0x00000000U, 0xe3e4ee45U, 0xee1004f1U, 0xca5635eeU,
+  0x00000000U, 0x0a000008U, 0xa6f000b0U, 0xc8330026U, 0x00000000U, 0x23e3fee3U, 0xaa1a090eU, 0xd414f74aU,
+  0x00000000U, 0xf6f6dc00U, 0x0d190b00U, 0x1404fa00U, 0x00000000U, 0x00eeecc8U, 0x0032ec62U, 0x0024f5edU,
+  0x00000000U, 0xd409e5e5U, 0x2914d2d0U, 0xf1d4e00aU, 0x00000000U, 0xfde4f1f7U, 0x343aef12U, 0x172803f6U,
+  0x00000000U, 0xe79908e6U, 0x171f302fU, 0x10f33e0eU, 0x00000000U, 0x2cdbf528U, 0x03eefd0eU, 0xe62c09fcU,
+  0x00000000U, 0x1fe300fdU, 0xfcec00e9U, 0xe03a0046U, 0x00000000U, 0xdb081409U, 0xebe81ef8U, 0x25ca4141U,
+  0x00000000U, 0xf607ef00U, 0xf6c6e800U, 0x09c10f00U, 0x00000000U, 0x002414efU, 0x00203703U, 0x0020ee05U,
+  0x00000000U, 0x140ae3faU, 0xf910db10U, 0x0b0f0a1aU, 0x00000000U, 0x0ffcec15U, 0xeac00012U, 0xd52f4feaU,
+  0x00000000U, 0xf705f112U, 0xf811d019U, 0x3cbf3d26U, 0x00000000U, 0xfcdcfb09U, 0xd00a0efbU, 0x1a63f519U,
+  0x00000000U, 0x08130014U, 0xf2fe001cU, 0xda210020U, 0x00000000U, 0xfee02f08U, 0x13ec0904U, 0x43c03646U,
+  0x00000000U, 0xbcfd0600U, 0xecd4dc00U, 0x2fd20600U, 0x00000000U, 0x00faf73bU, 0x00e13034U, 0x0006df15U,
+  0x00000000U, 0xa9e9dffaU, 0xdf16e3faU, 0x052f0113U, 0x00000000U, 0x2a1302eeU, 0x0e0cfe0dU, 0xc73635edU,
+  0x00000000U, 0x2f0cd502U, 0x0864cd60U, 0x1fa53f1dU, 0x00000000U, 0xfff2f016U, 0xe303f51cU, 0xdf4beffcU,
+  0x00000000U, 0xe013003bU, 0xf0f60013U, 0x0a270030U, 0x00000000U, 0x0bde200bU, 0xdde506faU, 0x5bad3a22U,
+  0x00000000U, 0xb1111d00U, 0xda11d200U, 0x2c0a0200U, 0x00000000U, 0x00ddfb3eU, 0x00e5ec33U, 0x0024ef14U,
+  0x00000000U, 0x9accecdcU, 0xb3011ad7U, 0x39270808U, 0x00000000U, 0x3d44f8e0U, 0x2b2006edU, 0xdc0e33d8U,
+  0x00000000U, 0x31e5caedU, 0x1554ec38U, 0x0f9274daU, 0x00000000U, 0x0ceef82eU, 0xf1e2f2f7U, 0xc250fc1bU,
+  0x00000000U, 0xee150023U, 0xf1d100faU, 0xf30a0011U, 0x00000000U, 0xf8cbfeecU, 0xfe26fa1aU, 0x12153722U,
+  0x00000000U, 0xe2130300U, 0xfa0aba00U, 0x51fde100U, 0x00000000U, 0x00e40102U, 0x001e0369U, 0x0053073bU,
+  0x00000000U, 0x81ecf8b5U, 0xe7d22bc2U, 0x30f92dfbU, 0x00000000U, 0x1808e902U, 0x5b260705U, 0xfeec1cf1U,
+  0x00000000U, 0x02b6e9e7U, 0x1729280eU, 0x07d87ffaU, 0x00000000U, 0x3cfdf62fU, 0xfac004f7U, 0xa92a0af7U,
+  0x00000000U, 0x2c0b0011U, 0x06fb0002U, 0xd82500f5U, 0x00000000U, 0x14e2e6e5U, 0xfd13f907U, 0x1d072034U,
+  0x00000000U, 0xf3f7de00U, 0xdc312400U, 0x0bdbe700U, 0x00000000U, 0x00eaf5d9U, 0x0001264cU, 0x0057e755U,
+  0x00000000U, 0xabdef8bcU, 0x130406c9U, 0x3af31ae7U, 0x00000000U, 0xe2e9effbU, 0x674018e9U, 0x13000be1U,
+  0x00000000U, 0xf2a0efe8U, 0x280d2b13U, 0x170c541fU, 0x00000000U, 0x2be0f61cU, 0x5bde03eaU, 0x030cf901U,
+  0x160000e8U, 0x220400f3U, 0xf1e60000U, 0xf00300ffU, 0xfcdc0d3fU, 0x00eefbf7U, 0xeffa03e9U, 0xf3ffff18U,
+  0x01f4f300U, 0xfcd7e700U, 0x03e7ef00U, 0xfbe50f00U, 0x0014ec0bU, 0x00e5f3f8U, 0x00eeedf9U, 0x002203fdU,
+  0xf028fbefU, 0xfcf1e7e1U, 0x02eed0ebU, 0xf812e408U, 0x041b44faU, 0xfdf2f20cU, 0xff00d2f1U, 0x08f602edU,
+  0x1df1f210U, 0xf719f6e2U, 0xedeefb02U, 0x14ea1532U, 0x1c25fd0cU, 0xf8f3fb01U, 0xfaedfbfeU, 0x04fbe7eeU,
+  0x0cc100f1U, 0xede600fdU, 0xf8e500e6U, 0x030a00d5U, 0x2ac41553U, 0x0af5f0f3U, 0xe3f7f707U, 0xfaf11b09U,
+  0x1becc800U, 0xfceee200U, 0xeafb0100U, 0xf1c71d00U, 0x00221442U, 0x001007daU, 0x001803dcU, 0x0010fbfaU,
+  0xec191be1U, 0xedec1ad3U, 0xfc02c2e8U, 0xce2cb8e9U, 0x2b2a06eaU, 0xfef9e6f6U, 0xf0f2db01U, 0xf7ec17f2U,
+  0x23fefde9U, 0x11e4dae9U, 0x02e7f915U, 0x1edc1230U, 0x2e231306U, 0xffe22400U, 0xf1c5deecU, 0x1a15b1feU,
+  0xe2cd00e5U, 0xe4c20028U, 0x01e700c6U, 0x412100a3U, 0x31ccfe10U, 0x1ccef9deU, 0xf3f0fdf5U, 0x02ed12f0U,
+  0x0aeeb700U, 0x1d08bb00U, 0xe8f10c00U, 0xe9d43b00U, 0x001b2b4aU, 0x002a0b26U, 0x0037f3e3U, 0x002a02d8U,
+  0xeff427f4U, 0xe8ef45c8U, 0xea1af625U, 0xad2eb619U, 0x37f01530U, 0x08e232dfU, 0xe40ce1eeU, 0xfdf804eaU,
+  0x2922f700U, 0x26dfdcf2U, 0xfcf4001aU, 0x1def1415U, 0x342ef308U, 0x26df12f8U, 0xfeb4ddf8U, 0x370bc8ebU,
+  0xcfc80018U, 0xd4de0044U, 0x0bf200dcU, 0x450700d0U, 0x0da90612U, 0x0fd4f9cdU, 0xfeeff905U, 0x0fd5f0f8U,
+  0x15e0c900U, 0x2807d800U, 0xeeee2700U, 0xe7d62500U, 0x00e9f247U, 0x002e0768U, 0x00430b02U, 0x0061f5f2U,
+  0xf1fd1618U, 0xe9eb21f2U, 0xf9290e21U, 0x8e10e144U, 0x2800412bU, 0x1700240fU, 0x09130af0U, 0x09e40bedU,
+  0xff5202fbU, 0x0b22caf6U, 0x0cf61616U, 0x35c7f50eU, 0x30020eebU, 0x07f9f9e0U, 0xf4c6c4eeU, 0x0e07e7e2U,
+  0xcadc0029U, 0xcadf0028U, 0x29f300c1U, 0x130400e6U, 0x370408feU, 0x060000e7U, 0x0af9f80bU, 0xfed80fe0U,
+  0x1503de00U, 0xfb092c00U, 0xfe072a00U, 0x06fe0800U, 0x00b80b5aU, 0x000b1371U, 0x002c1f0eU, 0x004b0cdeU,
+  0x121943f3U, 0xeedf15fcU, 0xf2212d14U, 0xc224f741U, 0x1411260fU, 0x16091519U, 0xfe0305fbU, 0xed05f7edU,
+  0xdb5fe1f1U, 0xe846d4dcU, 0x0af7d704U, 0x14b900fdU, 0x19fe1fefU, 0xfbdc24d7U, 0xfad9f2e8U, 0xf5ebfaf8U,
+  0x1b0000d9U, 0xfdf300ebU, 0xe5f0002eU, 0x0e0e0026U, 0x06f10bfdU, 0x07eafef9U, 0xeb16fc09U, 0xfb1b1a27U,
+  0xfb2bfb00U, 0xfddede00U, 0xfde4f900U, 0xf5082700U, 0x0007efdeU, 0x00df07edU, 0x000fee06U, 0x001c34feU,
+  0xcc18be0bU, 0x16fafcdbU, 0xf4d92ce6U, 0xe70920ebU, 0xfe320af6U, 0xe5022fe3U, 0x01f9e702U, 0x02ece7f2U,
+  0x25d5e5f9U, 0x1ae400dfU, 0xfff1eefdU, 0x1ce6ef11U, 0x45180b08U, 0xdbd8fcf9U, 0xf9d92fedU, 0x0cf906e3U,
+  0x0fd400d7U, 0xeff8000fU, 0xe9fb002fU, 0x210f00feU, 0x17f4e7fbU, 0x18bce5edU, 0xe92012e8U, 0x07ce1c1bU,
+  0x181b1200U, 0xf2d6e900U, 0xcc050c00U, 0x11172b00U, 0x00f8f405U, 0x000c02fbU, 0x00fe25e8U, 0x001614dfU,
+  0xe6fde301U, 0x01e12bd3U, 0xe8f705d2U, 0xdd2ef0e4U, 0x22200712U, 0xd31f50f1U, 0xdcf2dbf9U, 0x08cfe2e9U,
+  0xfe01d522U, 0x2ac9c8f4U, 0x14f9e32eU, 0x0c0d0319U, 0x3300f8fdU, 0x0cf60df0U, 0x0cd718e3U, 0xf230c4feU,
+  0xdbd200cfU, 0xfde40032U, 0x02f5000eU, 0x22f800e6U, 0x1304c6daU, 0x24b2cfd4U, 0x1ffe26e0U, 0x19e421ebU,
+  0x2f1e2800U, 0x2112e500U, 0xd5271f00U, 0x22f93800U, 0x00d3192cU, 0x00120914U, 0x001f34e4U, 0x003020e5U,
+  0xecf1fc12U, 0x00de39e4U, 0xec11edd8U, 0xdc38eff5U, 0xf2022924U, 0xcafa5a04U, 0xdc09c1efU, 0x21f6fc0cU,
+  0x2332db17U, 0x2cdffbf2U, 0x09f1ee32U, 0x1421fd05U, 0xf110ecf0U, 0xe7240eddU, 0x19dcf6deU, 0xe402b8f4U,
+  0xf3f100f9U, 0xe8ce0032U, 0x1f0000e2U, 0x0c0100edU, 0x20ffc72fU, 0x17fae6daU, 0x29fe15f2U, 0x32d6f9ddU,
+  0x31252d00U, 0x141f0900U, 0xc60c1100U, 0x06f94400U, 0x00b929fcU, 0x00f72bfeU, 0x002452d5U, 0x004823faU,
+  0xed1901f8U, 0xf7e62201U, 0xe62702dbU, 0xb4301fe7U, 0xe0fbed2aU, 0xf9133212U, 0x11f7eeefU, 0x2502d700U,
+  0xf4efd81cU, 0x050d0bf3U, 0x1dfe020bU, 0x2ff6f9fdU, 0xf2fc16f1U, 0xe60a08d8U, 0x23ead6dcU, 0xf1bad3d1U,
+  0xe8c00008U, 0xd7e90019U, 0x24eb00dcU, 0xf80500d5U, 0x56f2f825U, 0x0a27de07U, 0x34e5fff1U, 0x2ac8eadfU,
+  0x1f1e1e00U, 0xfbf43700U, 0xede92000U, 0xf3c61c00U, 0x00b607edU, 0x00d20b34U, 0x000937deU, 0x007c14f0U,
+  0x01e80ff6U, 0xfdd3290dU, 0xda3901f7U, 0xa73d201bU, 0xdcf8fa40U, 0x020e0115U, 0x16fdf4efU, 0xe303d6f6U,
+  0xe12acffeU, 0xea25edf4U, 0x171df405U, 0x2c10d32aU, 0xe3c12628U, 0x01ea2cdfU, 0x33e9dde2U, 0xfc8fdbd1U,
+  0x1b2b00d4U, 0xe80300e4U, 0xdede0028U, 0x1935002bU, 0x3afcf3caU, 0xf20aeff0U, 0xfa0afa27U, 0xf5ed2d2cU,
+  0xf4292000U, 0x03cddd00U, 0x1797f600U, 0x06b02700U, 0x0010facaU, 0x00fa00e8U, 0x000ff736U, 0x0023fc2bU,
+  0xbf15f7f9U, 0x17ed58d2U, 0xeee559efU, 0xf5fe1bf9U, 0xe913e011U, 0xe4010607U, 0xf70e0ceeU, 0xf2e3f502U,
+  0x33d01c10U, 0xfafae1c4U, 0x14e3cf02U, 0x11f5d40fU, 0xe6f51835U, 0xe8ee0af4U, 0x06eb19f1U, 0x021deb10U,
+  0x130500d5U, 0xd9ec00e6U, 0xf9e7005dU, 0x051a0035U, 0x4105e3d5U, 0x09ebe0f1U, 0xeb13fdf6U, 0xe9f53f1bU,
+  0xf8563f00U, 0x1713ff00U, 0xd2811e00U, 0x09060900U, 0x000bf2d2U, 0x0005fdedU, 0x0002292cU, 0x000b1e1bU,
+  0x0037f713U, 0x17e541d7U, 0xd8ed5ffbU, 0xfb202103U, 0x0104e221U, 0xb00c37e4U, 0xc9090805U, 0x08b1e5f5U,
+  0x30fdf72eU, 0x04b2dcddU, 0x2b0cc11aU, 0xfa05f51eU, 0xc5e91009U, 0xf10ad20bU, 0x1ad125e6U, 0xeb11f6e0U,
+  0xe50d000fU, 0x04ee0028U, 0x0f140067U, 0x1e0d0031U, 0x3af7f9d6U, 0x1af7d0f9U, 0x14020ce4U, 0x14f244b4U,
+  0x3b333400U, 0x0e23e100U, 0xd5d62e00U, 0x15141900U, 0x001404baU, 0x000834fcU, 0x000a350fU, 0x001649e1U,
+  0xf62cde02U, 0x08fd1f12U, 0xd2ee4226U, 0x300d2817U, 0x1808bd23U, 0xc21042fcU, 0xd4f3e003U, 0x23eacf07U,
+  0x1904d711U, 0x18f606feU, 0x190ae026U, 0xf3e63516U, 0xea081dfaU, 0xca1affefU, 0x08e436f7U, 0xf536f4e0U,
+  0x02d00015U, 0xf0bb0015U, 0x07020033U, 0x320e0011U, 0x25e6ea10U, 0x1131f914U, 0x29002bebU, 0x24d41dc6U,
+  0x09192700U, 0xf9f80e00U, 0xda132100U, 0x08f23b00U, 0x00ffeec7U, 0x00020a04U, 0x00fd3cd7U, 0x000c51b2U,
+  0xef25f7eaU, 0xfdf80c13U, 0xfc0611faU, 0xe7291b0dU, 0x16f7b10aU, 0x0b2f061bU, 0xedeedff7U, 0x3d14c511U,
+  0x14eccc26U, 0x0f072c0fU, 0x0cf7fd05U, 0xfecf4f10U, 0xd7d52cecU, 0xe1f43915U, 0xec0826f4U, 0xd4ebf2e1U,
+  0x32ba00fcU, 0xffe5001aU, 0x2ffd0013U, 0x35060004U, 0x1a22df06U, 0xd930dbfbU, 0x1ee512dfU, 0x2aaefbdcU,
+  0x07313500U, 0x0b1f2100U, 0xe9db0a00U, 0xd2da3800U, 0x000903c3U, 0x00fef826U, 0x00fc17b7U, 0x00340d96U,
+  0x0629f0dfU, 0x0413ecfaU, 0xfef6f8f6U, 0xc627f0f5U, 0x1002d017U, 0x1a19f716U, 0xebffd8f1U, 0x0efbae0aU,
+  0x0fdcdd23U, 0x19010212U, 0x0814fefcU, 0x29fed42bU, 0x988526d7U, 0x0dbf1c23U, 0x1dfef8dbU, 0xb8a3d2daU,
+  0xf04800e8U, 0xdfac00dcU, 0xefe30002U, 0xfc10001bU, 0x51ebd7d5U, 0xd613270bU, 0x27f4f624U, 0x0ae0101bU,
+  0xea142c00U, 0x1acede00U, 0x12be0600U, 0x1aa30400U, 0x00ea00eeU, 0x0042f3eaU, 0x002ff210U, 0x0027024dU,
+  0xbf23dc0bU, 0x19074ad9U, 0x0b024805U, 0xe81424fdU, 0xe6fdcf1bU, 0xf7de2efcU, 0x0802eefeU, 0xdffa0c00U,
+  0x29f00e15U, 0xd80bc60dU, 0x0fe101e4U, 0x0bdf0bdbU, 0xf1e40321U, 0xe4f908eeU, 0x0ce80ff0U, 0x10f7f703U,
+  0xff4300f8U, 0xeaf700f2U, 0x03e70015U, 0xf905002aU, 0x35f3fcbeU, 0x041cfbebU, 0xfd0a081bU, 0x26f84ef8U,
+  0xf42c4200U, 0x04e9dd00U, 0xcfb22200U, 0xf3c8f900U, 0x000719c9U, 0x00390af3U, 0x0027f52eU, 0x00081f2cU,
+  0xc638d50bU, 0x181812d4U, 0xf4073b1eU, 0xff1f3902U, 0x0efec824U, 0x00e83613U, 0x052222feU, 0xfad221dbU,
+  0x12f2f429U, 0xe30fdb4cU, 0x0aeed6f6U, 0xf81f3af4U, 0xa4c22513U, 0xde09f008U, 0x0de900e7U, 0xecd9f6f7U,
+  0xe50e0009U, 0xe5f400ffU, 0x07fb004bU, 0x22440031U, 0x3012ebb4U, 0x0f20f919U, 0xe6f40208U, 0x1c0b6ed1U,
+  0xf10a3100U, 0x17e3b200U, 0xc4b23700U, 0xe1e1dd00U, 0x00ec1ed1U, 0x002f0300U, 0x0000f62aU, 0x00281bffU,
+  0xcf2211f3U, 0x150ddff2U, 0xe202262cU, 0x13ff4912U, 0x320dc211U, 0x48fff90fU, 0xf42610f4U, 0xdedaf420U,
+  0x09e2fffaU, 0x10040d35U, 0x0609ebfdU, 0xed114224U, 0xb7ad1e0cU, 0xcfcee601U, 0x1ee9f6f4U, 0xfc28250cU,
+  0x15d500f4U, 0xdcf200ebU, 0xec040032U, 0x4611001eU, 0x1d02c7d1U, 0xf248de0bU, 0xdae722d9U, 0xf2e05cecU,
+  0xeb021200U, 0x09ccff00U, 0xf3db1e00U, 0x05f6e600U, 0x00e6ebcbU, 0x0005d029U, 0x0002ea39U, 0x002c00aeU,
+  0xe02521cbU, 0xf51d0126U, 0xe7f4182fU, 0xf50ff2faU, 0x1825b3fcU, 0x1638d91aU, 0xc90000feU, 0xc6ece31bU,
+  0x1cce1b18U, 0x1cf42b3cU, 0xf40bfa05U, 0xe8ca7f22U, 0xb68124f2U, 0xc684fb1cU, 0xfbf215f4U, 0xc60b1f15U,
+  0x18c300f6U, 0xe92700efU, 0x1201005aU, 0x522700ebU, 0x0d0be0eeU, 0xe604e21fU, 0xd2e90e02U, 0xc8f32debU,
+  0xf4001500U, 0x110f0600U, 0xf9f10f00U, 0x0ee31800U, 0x00dd02bdU, 0x0007de2aU, 0x00faf109U, 0x0034dc98U,
+  0xf13d01f2U, 0xcd06eedeU, 0xe4cd1e53U, 0xf509cf1bU, 0xfa1bcdfbU, 0x1a47e60aU, 0xe6eceaf2U, 0xe1fdf5f4U,
+  0x17ddf315U, 0x15ed432eU, 0xebfdd8fbU, 0x08d80cf4U, 0xc19efbd0U, 0x0eb7070fU, 0xebfd25e7U, 0xc6260606U,
+  0xf4300002U, 0xf0cc00c1U, 0x0ef90003U, 0xef0b0036U, 0x0fe6d9e1U, 0xe2f5351aU, 0x40e70914U, 0x77c01701U,
+  0xf61e2700U, 0x0fdfcc00U, 0x0e0b0600U, 0xf6eafd00U, 0x00fa04e2U, 0x003b0efbU, 0x001600fcU, 0x00150559U,
+  0xe116e306U, 0x1d25e2d8U, 0x1d111a03U, 0xef076617U, 0xdb1ed712U, 0x0dad1f13U, 0xf0f20cf7U, 0xedd615d8U,
+  0x07fc2018U, 0xea21b627U, 0xf0d205f7U, 0x04e110d5U, 0xf9ed1609U, 0xe0ffdef3U, 0xfcfbf4f0U, 0x21080f09U,
+  0xff2c000cU, 0x18ac00edU, 0x14fa00fcU, 0xea22000eU, 0x0df4e2bbU, 0xf5e42f2aU, 0x1cf4190aU, 0x51d455f6U,
+  0xf7442a00U, 0xfce9b300U, 0xed1f1800U, 0xe2d6dd00U, 0x00ebf8faU, 0x000fe519U, 0x0007ec08U, 0x00391b24U,
+  0xf11bf007U, 0xea05f0e7U, 0xff191711U, 0x0aff69ecU, 0x1327b505U, 0x25d5411aU, 0x04f10af5U, 0xc8cd26ddU,
+  0x090e2cfeU, 0x1718c539U, 0xeee2f7edU, 0xe1d44fd9U, 0xd6c502feU, 0xefe1e126U, 0x0205fef3U, 0xfc3602e8U,
+  0xfcf000eaU, 0xf2b70001U, 0x211d0046U, 0x126d0032U, 0x2a05f1bdU, 0xb2f70f68U, 0xe9db2204U, 0x22f165f9U,
+  0xe0192500U, 0xf4f1c800U, 0xb0192500U, 0xb5969800U, 0x00e1e9d8U, 0x00d2c433U, 0x00f50912U, 0x002af923U,
+  0x1d09d9e3U, 0xf7cff3ebU, 0xcc080d23U, 0x0efb5adaU, 0x1628c40aU, 0x6f043611U, 0x0f1e0c08U, 0xbbd21ff9U,
+  0x27232405U, 0x37f7d21dU, 0xebddd6d7U, 0xf6f2490aU, 0xc8c5f6f2U, 0x03cff510U, 0xfb091606U, 0xf71a1208U,
+  0x10c200caU, 0xbb1b0003U, 0x0d290058U, 0x11540046U, 0x1cfbd8d6U, 0xa9faeb38U, 0xdfc81cf7U, 0x06f67802U,
+  0xf908fa00U, 0x24f61800U, 0xd0101a00U, 0xb6b89900U, 0x00d9edd9U, 0x00eedc7fU, 0x00f71714U, 0x00479d1dU,
+  0x270df2e6U, 0xc9def208U, 0xbbe70823U, 0xd7f91cbaU, 0x252acbf6U, 0x5c2420faU, 0x1410070cU, 0xd8d9e1f6U,
+  0x07fb31e4U, 0x06fee20eU, 0xdce9cfe5U, 0x0fbf4a0aU, 0xd4ad02fbU, 0x2c12ff13U, 0x051f2127U, 0xf7192033U,
+  0x02d200deU, 0xb7560029U, 0x0f02004aU, 0x114d0028U, 0xe50cebf9U, 0xe5edf010U, 0xd1f30501U, 0xf7f84008U,
+  0xf8f62500U, 0x1635f900U, 0xf80a0e00U, 0xdfe2bc00U, 0x00dafad7U, 0x00f21a4dU, 0x0009f731U, 0x0048b80bU,
+  0x0a07eafdU, 0xbceff0d4U, 0xd6c6121eU, 0xcc0026c5U, 0xee33ed00U, 0x4e21fbf5U, 0x0afb05ffU, 0xf5f3fdd8U,
+  0x12f4f5f5U, 0xfcc41a1eU, 0xe5eadbecU, 0xf19421ebU, 0xedbff4eeU, 0x3d12ff2bU, 0xd0ff01ddU, 0xd03d0818U,
+  0xffed00f6U, 0x490600e6U, 0x202300fcU, 0xe1f200eeU, 0x050bf913U, 0x27e900ebU, 0x28d10727U, 0xeee6072eU,
+  0xf213f000U, 0xf9faed00U, 0xf9252600U, 0x08d3e600U, 0x000742fbU, 0x00101d10U, 0x0007170aU, 0x00cddc04U,
+  0xf10b23efU, 0xff310cbaU, 0x0413fff8U, 0xfdebf2ecU, 0x02e5ec08U, 0xff053d1dU, 0x0801eceeU, 0x081913e4U,
+  0xe205f5f1U, 0x2932f7d9U, 0x04f700f3U, 0x11e9ddfbU, 0xeebd0d02U, 0x1e130207U, 0xf70f070bU, 0xf80c0301U,
+  0xfeea00fbU, 0x1ee100fbU, 0x140b00e7U, 0xf7ec0027U, 0x18fcdb21U, 0x43b011ebU, 0x45c80615U, 0xfee30c41U,
+  0xe312f900U, 0xfecac400U, 0x253c1700U, 0x26daea00U, 0x00f32e13U, 0x002f356dU, 0x000929f2U, 0x00e012e6U,
+  0xf1174409U, 0xf71e178bU, 0x07180900U, 0xeaf01039U, 0x1ae2f40eU, 0x01e979eaU, 0x0015e3fcU, 0xf6131dffU,
+  0xea22f700U, 0x3e13e0e8U, 0x0bf20a00U, 0x28d3dcfbU, 0xec940cf7U, 0x7a2607ffU, 0xf31a0627U, 0xe90e0109U,
+  0xf8f00004U, 0x09dc00d0U, 0x0b1c00f3U, 0xe7e80010U, 0x10f4d91dU, 0x39f0eddcU, 0x3ee200e8U, 0x17d4102cU,
+  0x0521ff00U, 0xfaeaa100U, 0x0e571400U, 0x14d5d900U, 0x000e2530U, 0x00ee5354U, 0x00191202U, 0x001609efU,
+  0x11032a17U, 0xf91953c9U, 0x0aed0bfaU, 0xcd070a46U, 0x4bf5ed1cU, 0x1ab74211U, 0xf2f60b04U, 0xfef70b0bU,
+  0xe3330cf9U, 0x1a7fdbe3U, 0xfa0a0efcU, 0x02e4f5f9U, 0xf68107f8U, 0x561d29f1U, 0x051fdbf4U, 0x05caf104U,
+  0xdf080010U, 0x05d10007U, 0x2ee30012U, 0xeee40024U, 0x1cf5dc1eU, 0x33d9fbceU, 0x220ffed7U, 0x2bc6070bU,
+  0xf4392100U, 0xd510ba00U, 0x031a0a00U, 0x15dbce00U, 0x00f81f13U, 0x00db253eU, 0x0012f601U, 0x001b1bd7U,
+  0xfafcf0f9U, 0x08351ff8U, 0x0ad22025U, 0xec360d41U, 0x4f22c10eU, 0xdcef0c1eU, 0xdd033005U, 0xf700f106U,
+  0xe82c07f6U, 0xe570ea01U, 0x08fb13f8U, 0xf5f806f5U, 0xd5adf4fcU, 0x4ef538e6U, 0xf930f40aU, 0x18cfe5eeU,
+  0xc3020001U, 0x0dd90009U, 0x27fa002bU, 0xf0e600f1U, 0xf70ff204U, 0x4d2101ebU, 0x1d19fb0aU, 0x1ee00d10U,
+  0xf80c4200U, 0xd613f000U, 0x113cf000U, 0x06b8e600U, 0x00f51437U, 0x00f00e54U, 0x000c08f0U, 0x001bfaecU,
+  0x03d5faf5U, 0x042a190cU, 0x08c71ffbU, 0xe425e5f3U, 0x481fcf0bU, 0xfc020511U, 0xf206010cU, 0xf9f6fb02U,
+  0x065b1d03U, 0xe168f4e6U, 0x01f9000cU, 0xfdcb01fbU, 0xd9eaedf2U, 0x04f42a0dU, 0xff13fd0dU, 0x08f1dbf1U,
+  0x27c900ebU, 0x30f300e2U, 0x141d00f7U, 0xe5f200dfU, 0xfe16fb07U, 0x16f508eeU, 0x46efff34U, 0x0bcaff04U,
+  0xf1ece000U, 0x1aebe700U, 0xeb340000U, 0x14f1e200U, 0x003e3cf9U, 0x0011f71cU, 0x00f131d4U, 0x00f0e1f0U,
+  0xe30d35eeU, 0xf92f13cfU, 0xec07d0d6U, 0xfdcbbb0bU, 0x0fdad119U, 0xe32e65e9U, 0xe2e30501U, 0xec100cf4U,
+  0xdb01e6f0U, 0x0febfdddU, 0x1112e50fU, 0x0ef1fbdcU, 0xfe9718dfU, 0x52320115U, 0xe01afe06U, 0x0206f8fcU,
+  0x2ccd00faU, 0x2ef400f1U, 0x241400cfU, 0xe6ec0016U, 0x0832fa41U, 0x0ff8c4d1U, 0x3bee0625U, 0x2cd4172eU,
+  0xfde8e800U, 0x1cccec00U, 0xe63cf800U, 0x09f20d00U, 0x001938f7U, 0x00131f38U, 0x001e2de2U, 0x002830dcU,
+  0xe9025709U, 0x12eb32ccU, 0x1b07ebe0U, 0xe7c00220U, 0x27e6d822U, 0xb00e6ce8U, 0xd6c81b22U, 0xec213110U,
+  0xdee5f5e4U, 0x1aeed904U, 0x171a0afaU, 0x22f0d3e8U, 0x0fbb25e5U, 0x082ffbf8U, 0xd010dce8U, 0xc70ee5eaU,
+  0x07e10012U, 0x08dd00e9U, 0x0b0a00d1U, 0xf3c20013U, 0xf030f93cU, 0xfd17e9b9U, 0x33e40bfeU, 0x22da2655U,
+  0x1c13da00U, 0xf6ddf100U, 0xdc25fb00U, 0xe9d10200U, 0x000731e8U, 0x00075d2aU, 0x001a25f8U, 0x00182f18U,
+  0xeefa2e08U, 0xf9d02cecU, 0x1a030dceU, 0xced91d3cU, 0x20f2ef1bU, 0xdafc2a3dU, 0xe4d02915U, 0xfef6fe27U,
+  0xf0e3f8fcU, 0x08fbeff8U, 0x2c1ee114U, 0xf7d1ee12U, 0xefc213f2U, 0x160f5be7U, 0xe10bf5edU, 0x14ba14e1U,
+  0xdcf400fcU, 0x00e0001fU, 0x23ee00dfU, 0xe2c7002fU, 0x1310f917U, 0x021be9f0U, 0x1bee0e03U, 0x2ec5fd17U,
+  0x02361b00U, 0x0f250200U, 0xd71ffc00U, 0x5f0bf600U, 0x00f919fbU, 0x00ec6523U, 0x0005f6f5U, 0x000a40fdU,
+  0x10fafa14U, 0xdb182009U, 0xfcf41ae3U, 0xe418fe1cU, 0x191add06U, 0xda13ce23U, 0xc5da3808U, 0x0cdb0300U,
+  0xee00070bU, 0xfbe6e0fcU, 0x1b070022U, 0xfab00400U, 0xdca0e3e5U, 0x1bb14ae8U, 0x042bf1ffU, 0x36b51705U,
+  0xc4f00002U, 0x0c0b001aU, 0x29e500ebU, 0xf0f2001cU, 0xf52bee14U, 0x3c18ec10U, 0x0e0cfe07U, 0x24bbf903U,
+  0xe2163c00U, 0xe62fe400U, 0x0b0cfb00U, 0x18f30000U, 0x00d7012cU, 0x00c841e0U, 0x002affdfU, 0x00060fdfU,
+  0x32cbf2f8U, 0x0f0cffd6U, 0xf70523e1U, 0xd21d07c7U, 0x3f1cbe2cU, 0xd715d435U, 0xe0fc230cU, 0x0de9eff6U,
+  0x094b1a1eU, 0xdb240311U, 0x06f5ec02U, 0x00c31af9U, 0xa9c5ee08U, 0x0dcb2a2eU, 0x0a2805fcU, 0x19c3cf0eU,
+  0x2ac20006U, 0x30f100deU, 0x0dfd00f8U, 0xc91e00e1U, 0xe901fff6U, 0x1d0805d7U, 0xff2108deU, 0x2ceaebe8U,
+  0x03eed700U, 0x1923fa00U, 0xeb27f000U, 0x0230f500U, 0x003a0bfcU, 0x0008f1f2U, 0x001370daU, 0x000916b3U,
+  0xc8ff1b0fU, 0xf91822d4U, 0x0befd6faU, 0x08e5d240U, 0x0cd71f18U, 0xdd164b03U, 0xdfe2f9e1U, 0xbb00e0edU,
+  0xf201d9eeU, 0x06d109deU, 0x1860c32bU, 0xf4de2bd7U, 0x18b108daU, 0x22390439U, 0xd4e0fb0aU, 0xfc144924U,
+  0x23be0025U, 0x4bcc00e0U, 0x0a2300dcU, 0xeded001bU, 0xd600f924U, 0x0bffc1bfU, 0xe5fd2ef6U, 0x40db283dU,
+  0x11dee900U, 0x31f50500U, 0xdc1fee00U, 0xe5212b00U, 0x002a2722U, 0x001d3d0eU, 0x000d24f9U, 0x002b250bU,
+  0xb4f4282fU, 0x30fa3bdaU, 0x2501e3d7U, 0x17efe626U, 0x3cdd0b17U, 0xe2fc5d06U, 0x16ac25d0U, 0xb620f5e0U,
+  0xeed2c4fbU, 0x3be4d129U, 0x1f3ef244U, 0x2907f00dU, 0x3bde2ac5U, 0x252aeec5U, 0xd0ddf8ddU, 0xe0f8fc02U,
+  0x24e80019U, 0xf6e2003bU, 0xf80300d9U, 0x2ec7001eU, 0xeded082bU, 0xe9efd1a8U, 0xf8132cd6U, 0x1cf51039U,
+  0x4cecff00U, 0x27a41700U, 0xdb34f300U, 0xe9042b00U, 0x001c2b0aU, 0x0010023fU, 0x00ef05d9U, 0x00f73c4dU,
+  0xe7ff252aU, 0xc9ff4f25U, 0x0ffe01b9U, 0xe4ff013bU, 0x37e80a08U, 0x08152d25U, 0xf7cc13e6U, 0x02f100e9U,
+  0xefe0c6ddU, 0x4125db0eU, 0x3215dd31U, 0x1415c811U, 0x02e412e1U, 0x02e939f2U, 0xf9f434e5U, 0xf2b8f1c9U,
+  0x0c1400f2U, 0xdeb20035U, 0x2005000bU, 0x3dc70029U, 0xf503f2feU, 0x001de01dU, 0x001e2fc6U, 0x25f0fee8U,
+  0x13172f00U, 0x29d85600U, 0xce0eed00U, 0x1e22fb00U, 0x000812fcU, 0x00140143U, 0x00eaf9e7U, 0x00e1361bU,
+  0x14103517U, 0xfa17300fU, 0xd9f608a6U, 0xe2190005U, 0x1c13c7f8U, 0xf632d224U, 0x03e206e6U, 0x27d3dffaU,
+  0xfcfb00faU, 0xf9fcf7f6U, 0x320ef235U, 0x0ecdfddeU, 0xf4dff8e4U, 0xddb052daU, 0x05f937c8U, 0x23a9f5d5U,
+  0xd90200f7U, 0xc7110010U, 0x34e800ccU, 0x44f9001aU, 0xc80fdf04U, 0x320cd927U, 0xfd1e24f1U, 0x7fb3faeeU,
+  0xe12d3300U, 0x4418ee00U, 0xfe0df000U, 0x153eda00U, 0x00e3e132U, 0x00f71900U, 0x001d0ee2U, 0x00e819f1U,
+  0x28f5e8feU, 0xf30f0500U, 0xdc0bfeafU, 0xbd0312b3U, 0x2c24c621U, 0x1a27f01dU, 0x0df4fafaU, 0x0ad50002U,
+  0x07292617U, 0xe8ca0a0dU, 0x26e90b56U, 0xdd8d14dbU, 0xcbdae1fbU, 0xedd33105U, 0x00ecfef6U, 0x30e4fee1U,
+  0x14fb0007U, 0x1eca00ddU, 0xe2ef00f2U, 0xf00700ffU, 0xfdf52503U, 0x23ee14c3U, 0xb82cdfb1U, 0x4624d5c5U,
+  0xfc0cec00U, 0x1739f300U, 0xed01f000U, 0xd2390000U, 0x0030fdf7U, 0x001cd8eaU, 0x00f2210cU, 0x00fa1ae5U,
+  0xdff4ed10U, 0xee160f07U, 0x102edff0U, 0x0412e943U, 0x01f6f8feU, 0xd0e82a2dU, 0xffeff70aU, 0xd8edc732U,
+  0xecf3e505U, 0xfc06faf2U, 0x1069bd02U, 0xd90132e7U, 0x11f2fffaU, 0xe028142fU, 0x0b9001ffU, 0xf4e8602dU,
+  0x0d0a0039U, 0x3cdb00dfU, 0xbdf200e8U, 0xe9e50034U, 0x07f10814U, 0x1a02ffb6U, 0xc6320995U, 0x12e603f9U,
+  0xfde9fc00U, 0x10170c00U, 0xeff8df00U, 0xbc0f2700U, 0x001d3202U, 0x00220df9U, 0x00e41900U, 0x00fefd2dU,
+  0xc3ed1318U, 0x34edeef9U, 0xfc31e7d5U, 0xf826d721U, 0x16fd0617U, 0x10dd7104U, 0x16e309e4U, 0xf725b808U,
+  0x02d4ebfeU, 0x2ffebd30U, 0x2f67b14bU, 0x1d2ded17U, 0x20f515cfU, 0xbb35f6d3U, 0x23b800f1U, 0xe7da10f7U,
+  0x0507000bU, 0x0afa0035U, 0xd2eb00e9U, 0x1ec90011U, 0xecef0d28U, 0xbdfadedfU, 0xfe4e2ec0U, 0x0c09f6f0U,
+  0x37f5fc00U, 0x0da84700U, 0xd20d0000U, 0xf60a2800U, 0x00292f0cU, 0x0012f615U, 0x00ddfdd8U, 0x00d7eb28U,
+  0x0afd11f5U, 0x10120d4cU, 0xba2a15c1U, 0xf81eed1bU, 0xfeec0d07U, 0x05054608U, 0xf406e0f6U, 0x15fecfe4U,
+  0xf3f803e2U, 0x2f18b514U, 0x3b41b159U, 0x1214d9f7U, 0x0a1120e2U, 0xcbf709e8U, 0x019d07faU, 0xefcb10e6U,
+  0x040300f2U, 0xfb0e002dU, 0x08000019U, 0x31fa0010U, 0xe60a140aU, 0xab14df20U, 0x142858deU, 0x1e20f8eaU,
+  0xf8001200U, 0x24f23d00U, 0xd1fbda00U, 0xf80ff300U, 0x00110f06U, 0x00fccb40U, 0x00f8d8c3U, 0x00ccff17U,
+  0x170aefedU, 0xe2f40504U, 0xab1d06b8U, 0x1afaedffU, 0xf6f0cdf6U, 0x031f2e06U, 0xf530cd03U, 0xe6eadef8U,
+  0x02140c03U, 0x00f6f004U, 0x2039e46cU, 0xf7e1f1e9U, 0x08f90110U, 0xdafd20f9U, 0x0db71a16U, 0x13caf3eeU,
+  0xeb1d00dbU, 0xe41d001bU, 0x64f60008U, 0x0e04001cU, 0xc42411efU, 0x1bceeb20U, 0x27022fffU, 0x5bed00e3U,
+  0xeb0a2900U, 0x3930dc00U, 0xdde9ca00U, 0xfd16c500U, 0x002b0614U, 0x0009f837U, 0x00f1d7c0U, 0x00cf0f03U,
+  0x132bc6d8U, 0xdbee00d8U, 0xbb0afaafU, 0xc9ce0200U, 0x0f32dff3U, 0x30101deeU, 0x0310fb06U, 0xeecee1fcU,
+  0x141c341bU, 0x12be31f1U, 0x1dd7fe57U, 0xe9e704deU, 0x0820e943U, 0x1fdafb03U, 0x14f5fe23U, 0x1fd9090bU,
+  0xe6080019U, 0x1be300edU, 0x1bdd00eeU, 0x210300b0U, 0x0cfd1517U, 0xf2f5ec11U, 0x87eaece2U, 0x0741c9e7U,
+  0x05c70100U, 0x05f0e600U, 0xf2ddf400U, 0xfd111100U, 0x0014060fU, 0x0028f5cfU, 0x00f6e8deU, 0x0028290aU,
+  0x0908041fU, 0x0f07ed09U, 0xe6f6c005U, 0x1b091806U, 0xf9060507U, 0xf7e21e2dU, 0xddf6d3e3U, 0xeb0ee11eU,
+  0x0210050fU, 0x0f04f824U, 0x102bb3eeU, 0xfa2d2b0aU, 0xf8001b0cU, 0xc6f2f50eU, 0x36b508e9U, 0xcfd539f2U,
+  0xe218001fU, 0x3fe400ebU, 0xf3d000e5U, 0x07ff0036U, 0x06e5ff1dU, 0x01cfd418U, 0xb0d121e1U, 0xe736eaeaU,
+  0xf1d61300U, 0x29f2f700U, 0xd7d6fb00U, 0xbb013c00U, 0x00fe2f28U, 0x00fc2ee1U, 0x00f1cedcU, 0x00ebfa09U,
+  0xee182807U, 0xfc02e212U, 0xa308e801U, 0x2518fd31U, 0x0424f200U, 0x36f46c13U, 0xc937f3d6U, 0xfaf1d311U,
+  0x07fb0000U, 0x3528dc0bU, 0x1413a1eeU, 0x0f3e3105U, 0xea16fc1bU, 0xa327e537U, 0x54a3f201U, 0xffd02105U,
+  0xdf070010U, 0x1dfc00f7U, 0x01d300c3U, 0x03f3003dU, 0xeedf1734U, 0xc2cbc145U, 0xccf837f0U, 0xe511ede1U,
+  0x11f0f500U, 0x26fe4200U, 0xc2dcfa00U, 0xe4332f00U, 0x001efb1aU, 0x00f21034U, 0x00fbe6ceU, 0x00f2dfeeU,
+  0x0e1110e0U, 0xd1e5eb49U, 0x940ff6deU, 0x252aeaf7U, 0xfd0804dbU, 0x4f03361aU, 0xbe7fe1e8U, 0xf11bd9f8U,
+  0xe6f80afcU, 0x2f01ace4U, 0x1520c319U, 0xfe1515feU, 0x1c1602d1U, 0x9fffe71bU, 0x4dabf41eU, 0xffc8fa1dU,
+  0x0efd0003U, 0xe7100021U, 0x52e000d3U, 0x0eef0008U, 0x16161c17U, 0x8400c723U, 0xebfd4204U, 0xea2a01e9U,
+  0xf5ead800U, 0x450c5600U, 0xd9ddd700U, 0xce240500U, 0x001ede07U, 0x00e94f44U, 0x00dee8caU, 0x00dc07faU,
+  0x13f216b7U, 0xaaecf241U, 0xa40ef5ebU, 0x070ddef2U, 0xe9f0fdfbU, 0x4f172ef5U, 0xe3430004U, 0xd8e6efedU,
+  0x051117e9U, 0x04e2c9eaU, 0x29faee40U, 0xe8f5eadfU, 0x25df0cf8U, 0xf021f2f6U, 0x48b4ed31U, 0xebdc0024U,
+  0x0a0700ebU, 0xf81f0015U, 0x52ec00ecU, 0xf4fc0005U, 0x241509f8U, 0xefe2def9U, 0x01f90afeU, 0xe6f2faeeU,
+  0xe5f3f900U, 0x0028f800U, 0xeacedc00U, 0xf802dc00U, 0x001b0814U, 0x00ea0935U, 0x00cecce9U, 0x00ef02f6U,
+  0xe711ffafU, 0xbccefffaU, 0xc9d7f0cdU, 0xcfd9fe06U, 0x070800eaU, 0x20071405U, 0xf30403f0U, 0xe9dbf500U,
+  0x180d14fcU, 0x09bcf2e8U, 0x1ecaee12U, 0xeb0be8faU, 0x4ee2ff25U, 0x2debf2f8U, 0x29dcf821U, 0xe0ddff08U,
+  0xf70c000eU, 0xfeed000aU, 0xff0300f3U, 0x00000000U, 0xfdf30808U, 0x01e20adeU, 0xeef7f7f6U, 0x00000000U,
+  0x02e71b00U, 0x1cd30c00U, 0xfceef300U, 0x00000000U, 0x0015ebf3U, 0x00f3e826U, 0x00f6c3e5U, 0x00000000U,
+  0x03110d0eU, 0x01e000f5U, 0x05e3eaebU, 0x00000000U, 0xf807fdf2U, 0x07ff3efdU, 0xf815e308U, 0x00000000U,
+  0xf1f10914U, 0x34e5d710U, 0xf6fe1307U, 0x00000000U, 0x0602fd0aU, 0x182af4f2U, 0xf7ecfef8U, 0x00000000U,
+  0xe9f70003U, 0xf5fd0029U, 0xfbfb0021U, 0x00000000U, 0x03f5fafaU, 0xe2eb07bbU, 0xdc2afc01U, 0x00000000U,
+  0x0bbcf800U, 0x28b10100U, 0xe7f3d700U, 0x00000000U, 0x0003f609U, 0x0015c825U, 0x0007c2d7U, 0x00000000U,
+  0x0119fa0aU, 0xf8ce24e7U, 0x05f015e6U, 0x00000000U, 0x100afbe5U, 0xfd050ddcU, 0xc72dffe8U, 0x00000000U,
+  0xe1de1e16U, 0x3d15cf03U, 0x04ca232eU, 0x00000000U, 0xfbe61003U, 0x29f9fddaU, 0xf9cf1505U, 0x00000000U,
+  0xd0e50006U, 0xeedb002fU, 0x0dee0025U, 0x00000000U, 0xf900f6f3U, 0xe6ddf6d3U, 0xe21f1113U, 0x00000000U,
+  0xdec1f300U, 0x22bcf300U, 0xd600e200U, 0x00000000U, 0x0010f601U, 0x00e3ca32U, 0x001ccbccU, 0x00000000U,
+  0xc8ff0a06U, 0xb6ce2f06U, 0x073e1703U, 0x00000000U, 0x1c0efeefU, 0xf43e03d0U, 0xbd30d7dbU, 0x00000000U,
+  0x09dc142eU, 0x422ab504U, 0x1fab2528U, 0x00000000U, 0xeadbf607U, 0xf8e302d7U, 0xee90ddf7U, 0x00000000U,
+  0xe3f600e4U, 0xda9f0053U, 0x211200f3U, 0x00000000U, 0xf101f10eU, 0xc2c8f3daU, 0x07ef110aU, 0x00000000U,
+  0xf9fdf600U, 0x11bbf300U, 0xd905ef00U, 0x00000000U, 0x00e5fd17U, 0x00fccf49U, 0x001e0ae7U, 0x00000000U,
+  0xd9e8e6ebU, 0xdcd8de07U, 0xfb50f3ecU, 0x00000000U, 0x310df704U, 0x092b19f1U, 0xc91bf8eeU, 0x00000000U,
+  0x0edf0c17U, 0x2742d5edU, 0x218e2416U, 0x00000000U, 0xf7f8f91aU, 0xf5ffeceaU, 0x0dc9fbdaU, 0x00000000U,
+  0x020400f6U, 0xe2a00049U, 0x570200b9U, 0x00000000U, 0xde08f001U, 0xd7ecf4f1U, 0x1ce10d05U, 0x00000000U,
+  0xfbfe1c00U, 0x20071400U, 0xe8e7ee00U, 0x00000000U, 0x00c5f50eU, 0x00eff544U, 0x001f18beU, 0x00000000U,
+  0xf2e8b21dU, 0xffe3ea38U, 0xf74dd20aU, 0x00000000U, 0x1417e1feU, 0x10230502U, 0xe809f904U, 0x00000000U,
+  0x16e416feU, 0x122dd6eeU, 0x08a01a13U, 0x00000000U, 0xf4ecea08U, 0xe1c6fef5U, 0x11e6f5fdU, 0x00000000U,
+  0x1618002bU, 0xdf310012U, 0xddff00efU, 0x00000000U, 0x02df060dU, 0xc3e802dfU, 0xf00500faU, 0x00000000U,
+  0x05f81300U, 0x25e61f00U, 0xf60ff400U, 0x00000000U, 0x00fcdd0eU, 0x00ceab1aU, 0x000eb8f5U, 0x00000000U,
+  0xf21df60aU, 0x0fc0e0d2U, 0xf2e1f7deU, 0x00000000U, 0xea0bdefbU, 0xec216cefU, 0xeb21f2fdU, 0x00000000U,
+  0x09e6020fU, 0x790ae333U, 0x06de0504U, 0x00000000U, 0x1706eefeU, 0x1d64ddf6U, 0x04d5f703U, 0x00000000U,
+  0xf81a002fU, 0xe1430005U, 0xecff000fU, 0x00000000U, 0x0fdc0b2cU, 0xebc2f0aeU, 0xe4f818feU, 0x00000000U,
+  0xede5fb00U, 0x19030a00U, 0xc0f5e600U, 0x00000000U, 0x0005f612U, 0x00e1b7ecU, 0x0003d0dfU, 0x00000000U,
+  0xf727e41eU, 0x15ebefddU, 0xd61904d0U, 0x00000000U, 0x0b48e0ecU, 0xeb30ffceU, 0xbf3201f2U, 0x00000000U,
+  0xfed4ff14U, 0x660f0113U, 0x03ce0322U, 0x00000000U, 0xddf4f104U, 0xdd13e9faU, 0x1cd8f10bU, 0x00000000U,
+  0x00ee0027U, 0xf4f40031U, 0x2b0a000aU, 0x00000000U, 0x09eff826U, 0x2dbcf19aU, 0xf415260bU, 0x00000000U,
+  0xf3fef800U, 0x11e50300U, 0xd2dcea00U, 0x00000000U, 0x00b1edf4U, 0x00e585f2U, 0x0020d8dfU, 0x00000000U,
+  0xe323e630U, 0x3b0dcdfdU, 0xf83511dfU, 0x00000000U, 0x132ee40cU, 0x0c59edc7U, 0xa634d6ddU, 0x00000000U,
+  0x10f8fc12U, 0x3ef604f4U, 0xffc31124U, 0x00000000U, 0xe9dbd01aU, 0x0027e80aU, 0x4cc90b0fU, 0x00000000U,
+  0xeeeb00ffU, 0xe6fd0040U, 0x1a140022U, 0x00000000U, 0xfd06f41cU, 0x09c8eafdU, 0x2a1020f0U, 0x00000000U,
+  0xe11b1500U, 0x13b7f100U, 0xd308d000U, 0x00000000U, 0x00ca0003U, 0x00d1a3f3U, 0x0024fdc2U, 0x00000000U,
+  0xc403e503U, 0x330dddfcU, 0xe63f060eU, 0x00000000U, 0x2b07c912U, 0xfd0304f8U, 0x9431d1deU, 0x00000000U,
+  0x11e4fefcU, 0x22d705dfU, 0x0bba0125U, 0x00000000U, 0xfeb6fa36U, 0xd930e9e7U, 0x21c9251eU, 0x00000000U,
+  0x00d400f6U, 0xeee6002aU, 0x14380014U, 0x00000000U, 0xe404f413U, 0xd7eecb03U, 0x3ed70906U, 0x00000000U,
+  0xfb1bfe00U, 0x37e73400U, 0xe2f0d900U, 0x00000000U, 0x00ccfd12U, 0x00f1f90eU, 0x004d1dd7U, 0x00000000U,
+  0xe7f9b42dU, 0x42feb231U, 0xb75a02f6U, 0x00000000U, 0x3134dc05U, 0xed12062dU, 0xed0ff9faU, 0x00000000U,
+  0xfeda19f7U, 0x05f20ed6U, 0x129c081aU, 0x00000000U, 0x23b30429U, 0xb3e4dafbU, 0x37c82310U, 0x00000000U,
+  0x231c0012U, 0x9f3800fcU, 0xd4010006U, 0x00000000U, 0x23d4f512U, 0xffd7f5e8U, 0xccf0fa37U, 0x00000000U,
+  0xf7e22800U, 0x0af63b00U, 0xfdc1ef00U, 0x00000000U, 0x0015fbfeU, 0x0004bafdU, 0x00e6bcf0U, 0x00000000U,
+  0xe615e71cU, 0x1debd2e5U, 0xc5fcf0d6U, 0x00000000U, 0xe540c501U, 0xef2928cbU, 0xe30c19efU, 0x00000000U,
+  0x01cd280bU, 0x7b07044cU, 0x16a8ef12U, 0x00000000U, 0x061bfc18U, 0xff6eca1bU, 0x24ef0f00U, 0x00000000U,
+  0xf915002fU, 0xab2a00faU, 0xf3fe00feU, 0x00000000U, 0x2dc80028U, 0x2adf31b6U, 0xf6001923U, 0x00000000U,
+  0xfbfb1300U, 0x1d2d0500U, 0xd6d7db00U, 0x00000000U, 0x00000221U, 0x000ed716U, 0x0005d6f7U, 0x00000000U,
+  0x021fca2fU, 0x4016cfe1U, 0x9c23f3b4U, 0x00000000U, 0x0a34c102U, 0xfa0e0eb9U, 0xcf2b0000U, 0x00000000U,
+  0x00c0dde3U, 0x5f070b60U, 0x1096f11aU, 0x00000000U, 0xfaed0316U, 0xcd51ab29U, 0xfef008ffU, 0x00000000U,
+  0xe7e8003aU, 0xc0ff00d2U, 0x2fd30017U, 0x00000000U, 0x16fcf409U, 0x56ce1fc0U, 0x130df62bU, 0x00000000U,
+  0xf4fb0b00U, 0x354c0f00U, 0xc8c1fa00U, 0x00000000U, 0x00f21e06U, 0x00eeeff6U, 0x0039de00U, 0x00000000U,
+  0x1f0cde34U, 0x4b2cb80bU, 0xa0052ae4U, 0x00000000U, 0x1a29d506U, 0xfc1b1cbdU, 0xdd330905U, 0x00000000U,
+  0x11dddbd3U, 0x1bf61c2eU, 0x269ad840U, 0x00000000U, 0xf2eed839U, 0xfd68ad16U, 0x0dc92202U, 0x00000000U,
+  0xbff00004U, 0xcc1300ebU, 0xffef004fU, 0x00000000U, 0xf218f6f4U, 0x20fdcc13U, 0xfde01721U, 0x00000000U,
+  0xdd202300U, 0x45240f00U, 0x00c0eb00U, 0x00000000U, 0x00f50f01U, 0x00d3ffe5U, 0x0043e90aU, 0x00000000U,
+  0x2407f404U, 0x170baf02U, 0xaf09592dU, 0x00000000U, 0x1917d424U, 0x32fdec2bU, 0xe1232cf0U, 0x00000000U,
+  0xf1cae40dU, 0xf3e237ecU, 0x24f2d618U, 0x00000000U, 0xf0d3df53U, 0xc240ed17U, 0x16b33a0dU, 0x00000000U,
+  0xc8c300eaU, 0x096400e3U, 0xf8090039U, 0x00000000U, 0xc507f514U, 0xc313df0cU, 0x2dabec2eU, 0x00000000U,
+  0xff3e2600U, 0x20ec0e00U, 0x2ce1f600U, 0x00000000U, 0x00defa44U, 0x000912d2U, 0x002d0f3fU, 0x00000000U,
+  0xffe6bb29U, 0x431eaedbU, 0xa5027f30U, 0x00000000U, 0x3c44d606U, 0x4411e906U, 0x05ff20ffU, 0x00000000U,
+  0xf8c813eeU, 0xeacb60f8U, 0xfaf2c504U, 0x00000000U, 0x0eaaea32U, 0x92ffff14U, 0x51ab25ddU, 0x00000000U,
+  0x042000f1U, 0x92340018U, 0xf8f00017U, 0x00000000U, 0x2fcf030dU, 0x1eae1e12U, 0xc00b1111U, 0x00000000U,
+  0x00041c00U, 0x28f23b00U, 0xfdd4f100U, 0x00000000U, 0x000dfffdU, 0x001581f0U, 0x00e3e509U, 0x00000000U,
+  0xc807df0aU, 0x10200dfeU, 0xbd07e6e2U, 0x00000000U, 0xec45fdf2U, 0xfa2e39d8U, 0xe625f010U, 0x00000000U,
+  0x08b1170cU, 0x39232445U, 0x2390e2faU, 0x00000000U, 0xe518ed18U, 0x0c56d72cU, 0x0ae82301U, 0x00000000U,
+  0xf30b000fU, 0x981f0023U, 0xeaf70001U, 0x00000000U, 0x32e0fe2dU, 0x36dc260eU, 0xc70d0f29U, 0x00000000U,
+  0x05101d00U, 0x18fc0c00U, 0xe2f6e800U, 0x00000000U, 0x00fc1a10U, 0x0009b208U, 0x00ded413U, 0x00000000U,
+  0xfd0eeb04U, 0x253308d4U, 0xd6fefee1U, 0x00000000U, 0x080eca0cU, 0x191c2badU, 0xfe1fea47U, 0x00000000U,
+  0x08d5f0cdU, 0x2b462446U, 0x0fb4e021U, 0x00000000U, 0x181ff013U, 0xc93cb112U, 0xef033406U, 0x00000000U,
+  0x070b00e8U, 0x9c1c00f4U, 0x00d8002fU, 0x00000000U, 0x1ff3db21U, 0x24ff1713U, 0xd5f1f822U, 0x00000000U,
+  0xd6432400U, 0x3ce9e300U, 0xb6001300U, 0x00000000U, 0x00e7382dU, 0x0016c9e0U, 0x00dce423U, 0x00000000U,
+  0x1100eef7U, 0x0c3fe8cbU, 0xd6fa352aU, 0x00000000U, 0x4705e000U, 0x1c0d1cdcU, 0xfe33d125U, 0x00000000U,
+  0xfcc9dedaU, 0xe3104939U, 0x31ebdc36U, 0x00000000U, 0x1afdfc32U, 0xe859bb09U, 0xeade5006U, 0x00000000U,
+  0xdfcf00adU, 0xed2000b6U, 0x11040040U, 0x00000000U, 0x1611df03U, 0x2012140fU, 0xe5d50e47U, 0x00000000U,
+  0xd2412200U, 0x5dd6d200U, 0xd2f02400U, 0x00000000U, 0x00e8fd27U, 0x0017d902U, 0x0006d607U, 0x00000000U,
+  0xfdf8dfe1U, 0xfe09f3eaU, 0xee1f341aU, 0x00000000U, 0x3316f00dU, 0x231016f3U, 0xf5130813U, 0x00000000U,
+  0xe8b6f209U, 0xddf45cedU, 0xfd11d7dcU, 0x00000000U, 0x0cdef34dU, 0xf026fbfaU, 0xe3ef25ccU, 0x00000000U,
+  0xc9ca00caU, 0x093000daU, 0x02e10032U, 0x00000000U, 0xd9f8f20fU, 0xef0bed0bU, 0xf5f9103dU, 0x00000000U,
+  0xca5f3600U, 0x2a0fff00U, 0x2bf23300U, 0x00000000U, 0x00ccf16eU, 0x0031feebU, 0x00f0040bU, 0x00000000U,
+  0xdde2b7d5U, 0x251fd9eaU, 0xfcfa5211U, 0x00000000U, 0x6d37d1fbU, 0x200b07e6U, 0x00103e22U, 0x00000000U,
+  0x009504e0U, 0x05bc3b1fU, 0xe62abed1U, 0x00000000U, 0x3181f028U, 0xc8f300f9U, 0x04f22dcdU, 0x00000000U,
+  0xe93100e6U, 0xb3310007U, 0xf4f80023U, 0x00000000U, 0x2ae50e05U, 0x41d05e11U, 0xda15df1dU, 0x00000000U,
+  0x04f7f900U, 0x20c20900U, 0xf31f0700U, 0x00000000U, 0x00f110f8U, 0x001c953aU, 0x00f9e8eeU, 0x00000000U,
+  0xf5fef8f4U, 0xee0f00f6U, 0x00ddfd09U, 0x00000000U, 0x1a1becf8U, 0xe1056dc9U, 0xf325f905U, 0x00000000U,
+  0xfad717eaU, 0x25e31328U, 0x0ecf0fecU, 0x00000000U, 0xe225f819U, 0x097ad81eU, 0x20fc22ecU, 0x00000000U,
+  0xfd1300dbU, 0xad21001fU, 0xe6fe000bU, 0x00000000U, 0x2510fe0dU, 0x67d01d1cU, 0xbbfee124U, 0x00000000U,
+  0xed0cf200U, 0x2cdae800U, 0xe81e1800U, 0x00000000U, 0x00c7352dU, 0x00188a09U, 0x00f01b05U, 0x00000000U,
+  0xe8dd0ce6U, 0xe70e1a0aU, 0xdefd0af4U, 0x00000000U, 0x48fcc6f5U, 0xd01a6cabU, 0xfe1b022aU, 0x00000000U,
+  0xd8d807cfU, 0x1ce80f32U, 0x29e5f803U, 0x00000000U, 0xd025ff2cU, 0xd575dd36U, 0x11092cf6U, 0x00000000U,
+  0xf0d900b8U, 0x9518001bU, 0x091c002eU, 0x00000000U, 0xfefeeafdU, 0x5fcc0f21U, 0xe7d50010U, 0x00000000U,
+  0xba191b00U, 0x46e9c600U, 0xc3314000U, 0x00000000U, 0x00af1f29U, 0x003da312U, 0x00f01ae9U, 0x00000000U,
+  0xd9dc04d5U, 0xfb0614f5U, 0xf5231538U, 0x00000000U, 0x4f02c9e2U, 0x11f737acU, 0x122f0a1dU, 0x00000000U,
+  0xe4cdfbceU, 0x1bdf130cU, 0x20ecf2e4U, 0x00000000U, 0xf4e6f445U, 0xba70b60dU, 0x08e71df5U, 0x00000000U,
+  0xbdc600a2U, 0xde1a00dbU, 0x1b2b002bU, 0x00000000U, 0xe305e406U, 0x29f80520U, 0x15eb200aU, 0x00000000U,
+  0xa84b5100U, 0x66d5b600U, 0xe0423c00U, 0x00000000U, 0x00d23647U, 0x0058e630U, 0x001f35c8U, 0x00000000U,
+  0xa8befdc9U, 0x00fb0cefU, 0xfa521248U, 0x00000000U, 0x6827f3ffU, 0x03f414d4U, 0xd815fd05U, 0x00000000U,
+  0xf4d5b9eeU, 0xf9ec23fdU, 0xdeddf3c1U, 0x00000000U, 0x2599fd2cU, 0xdc20dfe3U, 0x041b00eeU, 0x00000000U,
+  0xc1fd00d7U, 0xed3d00deU, 0x13ea000dU, 0x00000000U, 0xbff902fcU, 0x2dedf912U, 0x1611140fU, 0x00000000U,
+  0xe7646c00U, 0x37ede500U, 0x0e182200U, 0x00000000U, 0x00d20b32U, 0x0044f128U, 0x001748c5U, 0x00000000U,
+  0x94a0ecdcU, 0xf90e1703U, 0x623d1b4fU, 0x00000000U, 0x7b2ee4f9U, 0x2af121edU, 0xccf90914U, 0x00000000U,
+  0xf1c3d6eeU, 0x22f4240aU, 0xdd1fdf07U, 0x00000000U, 0x26aff608U, 0x242409edU, 0xb31806dcU, 0x00000000U,
+  0x00000000U, 0xfbf300fcU, 0x15110008U, 0x00000000U, 0x00000000U, 0xf7e50ad7U, 0xfe0702f7U, 0x00000000U,
+  0x00000000U, 0x05d9e900U, 0x061e0c00U, 0x00000000U, 0x00000000U, 0x0005090eU, 0x000dff00U, 0x00000000U,
+  0x00000000U, 0xf3fad303U, 0x02eff917U, 0x00000000U, 0x00000000U, 0xf8ef2719U, 0x01fc0d1aU, 0x00000000U,
+  0x00000000U, 0x4013d305U, 0x1717f8f1U, 0x00000000U, 0x00000000U, 0x062cf0f1U, 0x0508f8f1U, 0x00000000U,
+  0x00000000U, 0xfe0e0016U, 0x0d2300faU, 0x00000000U, 0x00000000U, 0xee211eaeU, 0xeafb0afbU, 0x00000000U,
+  0x00000000U, 0x03e2da00U, 0x10231200U, 0x00000000U, 0x00000000U, 0x0004000fU, 0x001614f8U, 0x00000000U,
+  0x00000000U, 0x2afdfeceU, 0x07f70d04U, 0x00000000U, 0x00000000U, 0x06d8230dU, 0xebf40af9U, 0x00000000U,
+  0x00000000U, 0x3735c9fdU, 0x0fff02edU, 0x00000000U, 0x00000000U, 0xf359f2ecU, 0xfa070bf3U, 0x00000000U,
+  0x00000000U, 0x0a110014U, 0x222100feU, 0x00000000U, 0x00000000U, 0xdb2f27d1U, 0xf0ee0ff3U, 0x00000000U,
+  0x00000000U, 0x14cbd600U, 0x180f0100U, 0x00000000U, 0x00000000U, 0x00dafa22U, 0x00041704U, 0x00000000U,
+  0x00000000U, 0x590820fdU, 0xf9130202U, 0x00000000U, 0x00000000U, 0xf5e14e00U, 0xf917fbf9U, 0x00000000U,
+  0x00000000U, 0x2a39daf9U, 0xf8eb0ed8U, 0x00000000U, 0x00000000U, 0xf15e03f1U, 0xee17f40dU, 0x00000000U,
+  0x00000000U, 0x1b040015U, 0x0f0400fcU, 0x00000000U, 0x00000000U, 0xe9fc20f8U, 0xf4f111f6U, 0x00000000U,
+  0x00000000U, 0x07fafa00U, 0x06020100U, 0x00000000U, 0x00000000U, 0x00c10d13U, 0x000d18f9U, 0x00000000U,
+  0x00000000U, 0x390803f5U, 0xf90bfffcU, 0x00000000U, 0x00000000U, 0xfbf01a24U, 0xf60d00fcU, 0x00000000U,
+  0x00000000U, 0xfa25bec7U, 0xfee516eaU, 0x00000000U, 0x00000000U, 0xf82a09cfU, 0xf426df0eU, 0x00000000U,
+  0x00000000U, 0x20f600e7U, 0x101100eaU, 0x00000000U, 0x00000000U, 0xf90d0916U, 0xf0ed00eeU, 0x00000000U,
+  0x00000000U, 0x25d6f900U, 0xfcec1700U, 0x00000000U, 0x00000000U, 0x00e1f13fU, 0x002c0212U, 0x00000000U,
+  0x00000000U, 0x12161603U, 0x0409eef2U, 0x00000000U, 0x00000000U, 0xf0ed1e15U, 0x14120304U, 0x00000000U,
+  0x00000000U, 0xee4ab0cfU, 0x18fb0a09U, 0x00000000U, 0x00000000U, 0xf208f3e1U, 0xec0ee803U, 0x00000000U,
+  0x00000000U, 0xd71400ebU, 0xfd25000aU, 0x00000000U, 0x00000000U, 0xeae9f7cfU, 0xf9120c02U, 0x00000000U,
+  0x00000000U, 0x1ddc0b00U, 0x0e181200U, 0x00000000U, 0x00000000U, 0x0006f303U, 0x001a1ffeU, 0x00000000U,
+  0x00000000U, 0x0707e600U, 0x1ae20bf8U, 0x00000000U, 0x00000000U, 0xf4012af1U, 0xf506fae5U, 0x00000000U,
+  0x00000000U, 0x29f10ff7U, 0x22ff05e7U, 0x00000000U, 0x00000000U, 0xf2430120U, 0xf316e7f8U, 0x00000000U,
+  0x00000000U, 0xddee00f9U, 0x0933000fU, 0x00000000U, 0x00000000U, 0xfd12fbddU, 0xeef61cddU, 0x00000000U,
+  0x00000000U, 0x09e0e200U, 0x171c0300U, 0x00000000U, 0x00000000U, 0x00f3f519U, 0x000e06fcU, 0x00000000U,
+  0x00000000U, 0x2401ebe1U, 0x02e012e4U, 0x00000000U, 0x00000000U, 0x10e623e5U, 0xeeee16dfU, 0x00000000U,
+  0x00000000U, 0x1803fcf4U, 0x200002deU, 0x00000000U, 0x00000000U, 0xc94ffc26U, 0x0327f20fU, 0x00000000U,
+  0x00000000U, 0xf7f700e7U, 0x10030022U, 0x00000000U, 0x00000000U, 0x032113dcU, 0xf6d13befU, 0x00000000U,
+  0x00000000U, 0xf4d3f300U, 0x1ef6ec00U, 0x00000000U, 0x00000000U, 0x00fed002U, 0x0000f30cU, 0x00000000U,
+  0x00000000U, 0x2eecf40eU, 0x07f3f7f1U, 0x00000000U, 0x00000000U, 0x0cc943f5U, 0xfe151ef6U, 0x00000000U,
+  0x00000000U, 0xee0ff1ecU, 0xf4ffe8ceU, 0x00000000U, 0x00000000U, 0xd554eb12U, 0xf42aececU, 0x00000000U,
+  0x00000000U, 0x070b0005U, 0x00eb000aU, 0x00000000U, 0x00000000U, 0xf0070fcdU, 0xfeec1fdaU, 0x00000000U,
+  0x00000000U, 0xf9f52300U, 0x1102f400U, 0x00000000U, 0x00000000U, 0x00f7030bU, 0x00ed0a05U, 0x00000000U,
+  0x00000000U, 0x04f0002aU, 0x1e05fae1U, 0x00000000U, 0x00000000U, 0xffd90925U, 0xfb1e0901U, 0x00000000U,
+  0x00000000U, 0xce20c5eeU, 0xf7f41dd9U, 0x00000000U, 0x00000000U, 0xe00325cbU, 0xfe21dff7U, 0x00000000U,
+  0x00000000U, 0x09f800f8U, 0x00fe00e2U, 0x00000000U, 0x00000000U, 0xfd17f3ebU, 0xfeea02d5U, 0x00000000U,
+  0x00000000U, 0xfcf52f00U, 0x06ff1000U, 0x00000000U, 0x00000000U, 0x00e01d1fU, 0x000c0512U, 0x00000000U,
+  0x00000000U, 0x2205111aU, 0x1416f6aaU, 0x00000000U, 0x00000000U, 0x08ca0826U, 0x12110609U, 0x00000000U,
+  0x00000000U, 0xdd49e0c6U, 0x23053203U, 0x00000000U, 0x00000000U, 0xd51527beU, 0xff19de0bU, 0x00000000U,
+  0x00000000U, 0xf00700e8U, 0x11e700e5U, 0x00000000U, 0x00000000U, 0x0ff7f3edU, 0x13051028U, 0x00000000U,
+  0x00000000U, 0x24f0fb00U, 0x11d20a00U, 0x00000000U, 0x00000000U, 0x00fbe9eaU, 0x002b12feU, 0x00000000U,
+  0x00000000U, 0xf30d170bU, 0x1fe2f9e1U, 0x00000000U, 0x00000000U, 0xfffc2cfaU, 0xf6001fe3U, 0x00000000U,
+  0x00000000U, 0x0dcb12d6U, 0x050c020cU, 0x00000000U, 0x00000000U, 0x064f0825U, 0x0907d6f2U, 0x00000000U,
+  0x00000000U, 0xedf200d5U, 0x121d00f8U, 0x00000000U, 0x00000000U, 0x1511f8e6U, 0xff0229faU, 0x00000000U,
+  0x00000000U, 0x07f2d100U, 0x01b3f800U, 0x00000000U, 0x00000000U, 0x00f2def9U, 0x002ae007U, 0x00000000U,
+  0x00000000U, 0x06fb30e4U, 0xfddf17ddU, 0x00000000U, 0x00000000U, 0xecf140feU, 0xd4f921e3U, 0x00000000U,
+  0x00000000U, 0x0d05fff0U, 0x0800fef9U, 0x00000000U, 0x00000000U, 0xed3af301U, 0x0e1eda00U, 0x00000000U,
+  0x00000000U, 0xfff100caU, 0xf31d0021U, 0x00000000U, 0x00000000U, 0x041f04d3U, 0xfd062de7U, 0x00000000U,
+  0x00000000U, 0x0dffdb00U, 0x13cce700U, 0x00000000U, 0x00000000U, 0x0005e300U, 0x00149e32U, 0x00000000U,
+  0x00000000U, 0x1af31afbU, 0x24e404dbU, 0x00000000U, 0x00000000U, 0xf1db3408U, 0xcd0436deU, 0x00000000U,
+  0x00000000U, 0xee150bf4U, 0xf70920e8U, 0x00000000U, 0x00000000U, 0x0240e6efU, 0x1d32dd10U, 0x00000000U,
+  0x00000000U, 0xf4ef000aU, 0xfc1000ebU, 0x00000000U, 0x00000000U, 0xecdd08c9U, 0xe1feffdeU, 0x00000000U,
+  0x00000000U, 0x1ff60200U, 0x1ae6f500U, 0x00000000U, 0x00000000U, 0x00e90a1bU, 0x00ffe409U, 0x00000000U,
+  0x00000000U, 0x0af0ee23U, 0x2feff6ecU, 0x00000000U, 0x00000000U, 0x16c92b0eU, 0xe70b14e9U, 0x00000000U,
+  0x00000000U, 0xd132f5d7U, 0x02063cdbU, 0x00000000U, 0x00000000U, 0xf72306dbU, 0x0732eef2U, 0x00000000U,
+  0x00000000U, 0x1125000cU, 0xef0a00e9U, 0x00000000U, 0x00000000U, 0xf1f7e2e8U, 0xfe1007d4U, 0x00000000U,
+  0x00000000U, 0x2dfa0400U, 0x1800fa00U, 0x00000000U, 0x00000000U, 0x000a1642U, 0x0018050dU, 0x00000000U,
+  0x00000000U, 0x0ed93d05U, 0x2e1508e7U, 0x00000000U, 0x00000000U, 0x01c23214U, 0xee101ef9U, 0x00000000U,
+  0x00000000U, 0xd63aefc8U, 0x060a3fffU, 0x00000000U, 0x00000000U, 0xe4212faeU, 0x0b0ae5fdU, 0x00000000U,
+  0x00000000U, 0xe0050004U, 0x03f100e7U, 0x00000000U, 0x00000000U, 0x22ef061bU, 0x0ad1341cU, 0x00000000U,
+  0x00000000U, 0x1f030d00U, 0x25d6ff00U, 0x00000000U, 0x00000000U, 0x00f4c3d2U, 0x000cfb0eU, 0x00000000U,
+  0x00000000U, 0xeff7f112U, 0x0af4d1e2U, 0x00000000U, 0x00000000U, 0xe7153b17U, 0xfef442e4U, 0x00000000U,
+  0x00000000U, 0xfcb4fff1U, 0x16f8e30cU, 0x00000000U, 0x00000000U, 0x096c0513U, 0x0541bbeeU, 0x00000000U,
+  0x00000000U, 0xdff400eaU, 0x0bda00f9U, 0x00000000U, 0x00000000U, 0x13f0e20cU, 0x01041e20U, 0x00000000U,
+  0x00000000U, 0x1f05f600U, 0x13b7fb00U, 0x00000000U, 0x00000000U, 0x00e4d1d8U, 0x00f7b218U, 0x00000000U,
+  0x00000000U, 0x01e10c18U, 0x0de8f1e0U, 0x00000000U, 0x00000000U, 0xd0fb3721U, 0xee0a59e2U, 0x00000000U,
+  0x00000000U, 0xf8dcd5f1U, 0x0f08d30dU, 0x00000000U, 0x00000000U, 0xd2410202U, 0x1120cbe4U, 0x00000000U,
+  0x00000000U, 0xf7da00faU, 0xd9050028U, 0x00000000U, 0x00000000U, 0x00f500f7U, 0xfbe2f214U, 0x00000000U,
+  0x00000000U, 0x230bf000U, 0x0cc3eb00U, 0x00000000U, 0x00000000U, 0x00fef510U, 0x00f3810cU, 0x00000000U,
+  0x00000000U, 0x17080e31U, 0x02d803f2U, 0x00000000U, 0x00000000U, 0xb9e32826U, 0xd61a2dc5U, 0x00000000U,
+  0x00000000U, 0xd708ffeeU, 0x1716ede9U, 0x00000000U, 0x00000000U, 0xd71f07f1U, 0x1226d1fdU, 0x00000000U,
+  0x00000000U, 0x0eda0012U, 0x07260006U, 0x00000000U, 0x00000000U, 0xe0db23f1U, 0xd3e2e2e8U, 0x00000000U,
+  0x00000000U, 0x28041700U, 0x33d0f800U, 0x00000000U, 0x00000000U, 0x000aee2bU, 0x0018d01bU, 0x00000000U,
+  0x00000000U, 0x11ed1a3aU, 0x02c90208U, 0x00000000U, 0x00000000U, 0xccca1a0eU, 0xf2e530ddU, 0x00000000U,
+  0x00000000U, 0xd9290fcdU, 0xfa1723dbU, 0x00000000U, 0x00000000U, 0xe90d1eb4U, 0xfe2fefefU, 0x00000000U,
+  0x00000000U, 0x0cfd0022U, 0x051000f2U, 0x00000000U, 0x00000000U, 0x011ffd01U, 0xf7f7fbe9U, 0x00000000U,
+  0x00000000U, 0x1cfe0f00U, 0x35fc0900U, 0x00000000U, 0x00000000U, 0x00302343U, 0x002f24ffU, 0x00000000U,
+  0x00000000U, 0x1dca4144U, 0x1d0d0c0aU, 0x00000000U, 0x00000000U, 0xd3d42901U, 0xfbf43ce0U, 0x00000000U,
+  0x00000000U, 0xd94eefc6U, 0x071e3114U, 0x00000000U, 0x00000000U, 0xe63e24b2U, 0xe8fef0dfU, 0x00000000U,
+  0x00000000U, 0xbe0a0029U, 0xf007002bU, 0x00000000U, 0x00000000U, 0x3be81813U, 0x14db14f8U, 0x00000000U,
+  0x00000000U, 0x10191500U, 0x0fd80400U, 0x00000000U, 0x00000000U, 0x0017cbf0U, 0x00eef502U, 0x00000000U,
+  0x00000000U, 0x03f90920U, 0x0ffde907U, 0x00000000U, 0x00000000U, 0xe21c5212U, 0x04f928edU, 0x00000000U,
+  0x00000000U, 0x08cc2105U, 0x17ebf3f5U, 0x00000000U, 0x00000000U, 0xf7520928U, 0x0320e80bU, 0x00000000U,
+  0x00000000U, 0xc4140030U, 0xfd0100ffU, 0x00000000U, 0x00000000U, 0x43e7f30aU, 0x23ddfe22U, 0x00000000U,
+  0x00000000U, 0x393e1f00U, 0x37090400U, 0x00000000U, 0x00000000U, 0x0005cbf4U, 0x00e7cf17U, 0x00000000U,
+  0x00000000U, 0x0f270336U, 0x0412d7ffU, 0x00000000U, 0x00000000U, 0xf516401dU, 0xf80649d4U, 0x00000000U,
+  0x00000000U, 0xf8e8feefU, 0x2afcc403U, 0x00000000U, 0x00000000U, 0xf67e1e11U, 0xe244dde9U, 0x00000000U,
+  0x00000000U, 0xd010004dU, 0x09220019U, 0x00000000U, 0x00000000U, 0x52d4f2d7U, 0x10c7f223U, 0x00000000U,
+  0x00000000U, 0x48422600U, 0x4413f600U, 0x00000000U, 0x00000000U, 0x0020f3f8U, 0x00f3e504U, 0x00000000U,
+  0x00000000U, 0x40430b4aU, 0xfb00f408U, 0x00000000U, 0x00000000U, 0xf91c202bU, 0xdcfa3dd0U, 0x00000000U,
+  0x00000000U, 0x07ff0eceU, 0x060ed9dcU, 0x00000000U, 0x00000000U, 0xbe4f09f0U, 0xde2fe8ceU, 0x00000000U,
+  0x00000000U, 0xfb140027U, 0x0924002bU, 0x00000000U, 0x00000000U, 0x26f501d0U, 0x1ce3fce4U, 0x00000000U,
+  0x00000000U, 0x63153c00U, 0x5017ed00U, 0x00000000U, 0x00000000U, 0x0060fefeU, 0x00241efdU, 0x00000000U,
+  0x00000000U, 0x5d471b61U, 0xfee1071cU, 0x00000000U, 0x00000000U, 0xc6ef0f01U, 0xf3f72fd9U, 0x00000000U,
+  0x00000000U, 0xf3302cb5U, 0xf51517cdU, 0x00000000U, 0x00000000U, 0xbc5b06a4U, 0xdf38f9d1U, 0x00000000U,
+  0x00000000U, 0xeffb000fU, 0x01090019U, 0x00000000U, 0x00000000U, 0x3029f4f8U, 0x1f020ff8U, 0x00000000U,
+  0x00000000U, 0x10001900U, 0x0cfdf100U, 0x00000000U, 0x00000000U, 0x005929faU, 0x00352efaU, 0x00000000U,
+  0x00000000U, 0x7f34203aU, 0x07141919U, 0x00000000U, 0x00000000U, 0xc6e90908U, 0xe9f217f3U, 0x00000000U,
+  0x00000000U, 0x0c6f3f14U, 0x10fe26feU, 0x00000000U, 0x00000000U, 0xbd3f05bcU, 0xeb170be9U, 0x00000000U,
+  0xf9eb00f1U, 0x00000000U, 0x00000000U, 0x15fa00f4U, 0x2f27feeaU, 0x00000000U, 0x00000000U, 0x1325fc1bU,
+  0x023aec00U, 0x00000000U, 0x00000000U, 0xf724ff00U, 0x00d4513dU, 0x00000000U, 0x00000000U, 0x001115dcU,
+  0x0b2e25c2U, 0x00000000U, 0x00000000U, 0x0b0a16feU, 0x06050210U, 0x00000000U, 0x00000000U, 0x020106fcU,
+  0xe8230918U, 0x00000000U, 0x00000000U, 0xdbfc20f9U, 0x24e5f906U, 0x00000000U, 0x00000000U, 0x13ec1207U,
+  0x15ec00f6U, 0x00000000U, 0x00000000U, 0x02fe00d4U, 0x45f2dad9U, 0x00000000U, 0x00000000U, 0x220f041fU,
+  0x01161500U, 0x00000000U, 0x00000000U, 0xf113e400U, 0x009e5344U, 0x00000000U, 0x00000000U, 0x0030ef1cU,
+  0x12222ae4U, 0x00000000U, 0x00000000U, 0xfd063af5U, 0x10f3f309U, 0x00000000U, 0x00000000U, 0x10050eeeU,
+  0x0d4de7f8U, 0x00000000U, 0x00000000U, 0xe7f0340eU, 0x30df18eeU, 0x00000000U, 0x00000000U, 0x58dd03f0U,
+  0x4c39000fU, 0x00000000U, 0x00000000U, 0x040000ceU, 0x31feccbcU, 0x00000000U, 0x00000000U, 0x2bfde504U,
+  0xfe337f00U, 0x00000000U, 0x00000000U, 0x17f4c700U, 0x00a87852U, 0x00000000U, 0x00000000U, 0x00480f15U,
+  0x1a0b2ecdU, 0x00000000U, 0x00000000U, 0xe6113edbU, 0x04eadf15U, 0x00000000U, 0x00000000U, 0x1ef213ffU,
+  0x2756de0eU, 0x00000000U, 0x00000000U, 0xf40a4921U, 0xe2faf713U, 0x00000000U, 0x00000000U, 0x52e2ed1bU,
+  0x3a280002U, 0x00000000U, 0x00000000U, 0xe8f700dcU, 0x37f8dce3U, 0x00000000U, 0x00000000U, 0x2ce9ea12U,
+  0xef534800U, 0x00000000U, 0x00000000U, 0x13f4d100U, 0x00e02526U, 0x00000000U, 0x00000000U, 0x002bee15U,
+  0x210c2dd9U, 0x00000000U, 0x00000000U, 0xe51911dcU, 0x160ef4f5U, 0x00000000U, 0x00000000U, 0x28ff2705U,
+  0x1c47e73dU, 0x00000000U, 0x00000000U, 0xfe1b2c29U, 0xd6030103U, 0x00000000U, 0x00000000U, 0x2ff70223U,
+  0x624b002dU, 0x00000000U, 0x00000000U, 0xf0f500d2U, 0x3a29f9ffU, 0x00000000U, 0x00000000U, 0x35fd0106U,
+  0x92612e00U, 0x00000000U, 0x00000000U, 0x020bf300U, 0x00d31121U, 0x00000000U, 0x00000000U, 0x0009072dU,
+  0x1efc19c5U, 0x00000000U, 0x00000000U, 0xf51f0ce3U, 0xf8e8fe0dU, 0x00000000U, 0x00000000U, 0x27ff040aU,
+  0x1b34fd46U, 0x00000000U, 0x00000000U, 0x03241d2eU, 0xfe0f0f18U, 0x00000000U, 0x00000000U, 0x0a00e80dU,
+  0x40f100f1U, 0x00000000U, 0x00000000U, 0x08e20008U, 0x0e10eaebU, 0x00000000U, 0x00000000U, 0xfd1e0a08U,
+  0x05a8fb00U, 0x00000000U, 0x00000000U, 0xe7150500U, 0x00122d54U, 0x00000000U, 0x00000000U, 0x0001f3f7U,
+  0x263553c4U, 0x00000000U, 0x00000000U, 0x011d1906U, 0x19cef212U, 0x00000000U, 0x00000000U, 0x0d11f2fcU,
+  0x0b3b0011U, 0x00000000U, 0x00000000U, 0xd401f717U, 0x19b9f9f4U, 0x00000000U, 0x00000000U, 0x32e004efU,
+  0x442100d1U, 0x00000000U, 0x00000000U, 0x14f300f8U, 0xf30fc9efU, 0x00000000U, 0x00000000U, 0x040a0c0fU,
+  0xf1bd0300U, 0x00000000U, 0x00000000U, 0xfedafd00U, 0x00023f28U, 0x00000000U, 0x00000000U, 0x000ee509U,
+  0x121420b6U, 0x00000000U, 0x00000000U, 0x0900fee8U, 0x0ad9e327U, 0x00000000U, 0x00000000U, 0x1e180cf8U,
+  0xf82405d9U, 0x00000000U, 0x00000000U, 0xd0e6230bU, 0xfd2915f1U, 0x00000000U, 0x00000000U, 0x7fe2f0f8U,
+  0x213e00d6U, 0x00000000U, 0x00000000U, 0x23f700f1U, 0xdd151bdbU, 0x00000000U, 0x00000000U, 0xfde60102U,
+  0xedad1b00U, 0x00000000U, 0x00000000U, 0x25f3e000U, 0x00f81412U, 0x00000000U, 0x00000000U, 0x00ebfe08U,
+  0x3c3ec8a2U, 0x00000000U, 0x00000000U, 0xe4ebf8d5U, 0x9202fa1dU, 0x00000000U, 0x00000000U, 0x16041b08U,
+  0xfc070feaU, 0x00000000U, 0x00000000U, 0x041306feU, 0xd24cfcedU, 0x00000000U, 0x00000000U, 0x2ceeeefbU,
+  0x232100caU, 0x00000000U, 0x00000000U, 0x00f80005U, 0xfc3b36f7U, 0x00000000U, 0x00000000U, 0xffd71b02U,
+  0xe2ecf900U, 0x00000000U, 0x00000000U, 0x4200f800U, 0x0015eed8U, 0x00000000U, 0x00000000U, 0x0001f60cU,
+  0x6631bcc9U, 0x00000000U, 0x00000000U, 0xe0edfde4U, 0x9f03fdddU, 0x00000000U, 0x00000000U, 0x0a1d280eU,
+  0x19f505daU, 0x00000000U, 0x00000000U, 0x1f15d816U, 0x0d460009U, 0x00000000U, 0x00000000U, 0x221fe4f2U,
+  0x12400016U, 0x00000000U, 0x00000000U, 0xe6d700f2U, 0x094f29deU, 0x00000000U, 0x00000000U, 0x380015f9U,
+  0xe12fe600U, 0x00000000U, 0x00000000U, 0x021b0500U, 0x00ec16d6U, 0x00000000U, 0x00000000U, 0x00fb0bfdU,
+  0x0026bb06U, 0x00000000U, 0x00000000U, 0x0d13f1caU, 0xafe10eeeU, 0x00000000U, 0x00000000U, 0x1ffff519U,
+  0xf9f7fe0eU, 0x00000000U, 0x00000000U, 0x111bf713U, 0x0c79f91dU, 0x00000000U, 0x00000000U, 0x16f7f5ebU,
+  0x6fd900f9U, 0x00000000U, 0x00000000U, 0xf70700fcU, 0xf112351bU, 0x00000000U, 0x00000000U, 0xe0121509U,
+  0x239cf300U, 0x00000000U, 0x00000000U, 0xec240400U, 0x0013d133U, 0x00000000U, 0x00000000U, 0x00e2ce1dU,
+  0x190437d4U, 0x00000000U, 0x00000000U, 0x09f9eaddU, 0x39c34ffcU, 0x00000000U, 0x00000000U, 0x152810f3U,
+  0x1618cc17U, 0x00000000U, 0x00000000U, 0xfc18f41fU, 0xfb2aa1cbU, 0x00000000U, 0x00000000U, 0x37efd0e0U,
+  0x04ed00d7U, 0x00000000U, 0x00000000U, 0x19050006U, 0xf20d3640U, 0x00000000U, 0x00000000U, 0xf003082cU,
+  0xe6ade000U, 0x00000000U, 0x00000000U, 0xfdfefc00U, 0x003fb913U, 0x00000000U, 0x00000000U, 0x00d2cc10U,
+  0xeec136acU, 0x00000000U, 0x00000000U, 0xf0dfd5e4U, 0x22c651d0U, 0x00000000U, 0x00000000U, 0x0c1227fcU,
+  0x1c020a15U, 0x00000000U, 0x00000000U, 0xf7e728f5U, 0x4e0ba116U, 0x00000000U, 0x00000000U, 0x4a01ecf5U,
+  0x980d001aU, 0x00000000U, 0x00000000U, 0x0b040006U, 0xf509283bU, 0x00000000U, 0x00000000U, 0xeedc1903U,
+  0xffc5d400U, 0x00000000U, 0x00000000U, 0x0bef0000U, 0x0030a315U, 0x00000000U, 0x00000000U, 0x00fae80cU,
+  0xfbec13ceU, 0x00000000U, 0x00000000U, 0xdbe1d3f3U, 0xe5fa32dfU, 0x00000000U, 0x00000000U, 0x060dfbfcU,
+  0xfef10a00U, 0x00000000U, 0x00000000U, 0x0ae413cbU, 0x6924d10eU, 0x00000000U, 0x00000000U, 0x0b21ff1bU,
+  0xa70d0029U, 0x00000000U, 0x00000000U, 0xf6020006U, 0xfd0e2027U, 0x00000000U, 0x00000000U, 0x01ef1ce8U,
+  0xfdb7f200U, 0x00000000U, 0x00000000U, 0x051a2300U, 0x0037e80dU, 0x00000000U, 0x00000000U, 0x00f504e6U,
+  0xdad01a17U, 0x00000000U, 0x00000000U, 0xf9f1e7e6U, 0xdad045e1U, 0x00000000U, 0x00000000U, 0xf11bf504U,
+  0xef050ae8U, 0x00000000U, 0x00000000U, 0x26f5d0f2U, 0x4c201f07U, 0x00000000U, 0x00000000U, 0xf30ff318U,
+  0xe9fa001bU, 0x00000000U, 0x00000000U, 0x0eda0015U, 0x2724390aU, 0x00000000U, 0x00000000U, 0x14ef06e6U,
+  0x1ad30800U, 0x00000000U, 0x00000000U, 0xd0132800U, 0x000b37e8U, 0x00000000U, 0x00000000U, 0x00ef01c5U,
+  0x02d9ef43U, 0x00000000U, 0x00000000U, 0x0e11fbe5U, 0xc6de61ccU, 0x00000000U, 0x00000000U, 0xe609e30aU,
+  0xf1eff4f2U, 0x00000000U, 0x00000000U, 0x1103daf6U, 0x29633b1cU, 0x00000000U, 0x00000000U, 0xedcafdf8U,
+  0x18e900f4U, 0x00000000U, 0x00000000U, 0x000400f7U, 0x209f2b09U, 0x00000000U, 0x00000000U, 0xe71b1510U,
+  0x2edcf300U, 0x00000000U, 0x00000000U, 0x08190200U, 0x00e9b3deU, 0x00000000U, 0x00000000U, 0x00d1defbU,
+  0x14f1f0e6U, 0x00000000U, 0x00000000U, 0x0cd6e2ddU, 0x22f440b6U, 0x00000000U, 0x00000000U, 0x091d1ce7U,
+  0x60d1d515U, 0x00000000U, 0x00000000U, 0x1710fffeU, 0xf149a8f7U, 0x00000000U, 0x00000000U, 0x211ce5feU,
+  0xe7d900e2U, 0x00000000U, 0x00000000U, 0x13000000U, 0x13bced20U, 0x00000000U, 0x00000000U, 0xebfcf036U,
+  0x3b21fc00U, 0x00000000U, 0x00000000U, 0x17f11200U, 0x00d5d70bU, 0x00000000U, 0x00000000U, 0x00d8e5faU,
+  0xf9ffbef1U, 0x00000000U, 0x00000000U, 0xfecfeffeU, 0xff1356adU, 0x00000000U, 0x00000000U, 0xff2122deU,
+  0x54bb8e1fU, 0x00000000U, 0x00000000U, 0xfee913d2U, 0xe034bae8U, 0x00000000U, 0x00000000U, 0x2f09df18U,
+  0xf7d00010U, 0x00000000U, 0x00000000U, 0x1ff90018U, 0x15b3f027U, 0x00000000U, 0x00000000U, 0xfadbec15U,
+  0x63413700U, 0x00000000U, 0x00000000U, 0x2be31600U, 0x00c1e6e3U, 0x00000000U, 0x00000000U, 0x00ef0beeU,
+  0x060ed521U, 0x00000000U, 0x00000000U, 0xe5e4f222U, 0xe61b4da8U, 0x00000000U, 0x00000000U, 0xdd110ff2U,
+  0x09a897e4U, 0x00000000U, 0x00000000U, 0xf3d7cabbU, 0xf427c8c3U, 0x00000000U, 0x00000000U, 0x1403e212U,
+  0xfcd60033U, 0x00000000U, 0x00000000U, 0x0bf70009U, 0x20f02011U, 0x00000000U, 0x00000000U, 0x04f4f7f8U,
+  0x26f13600U, 0x00000000U, 0x00000000U, 0x00132d00U, 0x00e711f1U, 0x00000000U, 0x00000000U, 0x00e7f9cfU,
+  0xfac80b30U, 0x00000000U, 0x00000000U, 0xe002f615U, 0xfddd42e7U, 0x00000000U, 0x00000000U, 0xca0ce8e4U,
+  0xfcefc6e7U, 0x00000000U, 0x00000000U, 0x06e3c1caU, 0xd60de1b7U, 0x00000000U, 0x00000000U, 0xdee8def2U,
+  0x12f20020U, 0x00000000U, 0x00000000U, 0x1ee30006U, 0x2fce22deU, 0x00000000U, 0x00000000U, 0x09f207efU,
+  0x17def900U, 0x00000000U, 0x00000000U, 0xf41d1b00U, 0x00f320e8U, 0x00000000U, 0x00000000U, 0x00ddf4d0U,
+  0xf9bc02eeU, 0x00000000U, 0x00000000U, 0xe301e8fdU, 0x00cb2ce2U, 0x00000000U, 0x00000000U, 0xdc22f8f1U,
+  0xfaea03f1U, 0x00000000U, 0x00000000U, 0x0df3d3efU, 0x0e2513efU, 0x00000000U, 0x00000000U, 0xede4ea06U,
+  0xbcf4005dU, 0x00000000U, 0x00000000U, 0x0f0e000bU, 0x29c410c7U, 0x00000000U, 0x00000000U, 0xfb010100U,
+  0xe519eb00U, 0x00000000U, 0x00000000U, 0x14f91400U, 0x00c30da9U, 0x00000000U, 0x00000000U, 0x00e8ebf3U,
+  0x1527defaU, 0x00000000U, 0x00000000U, 0x0decfbfbU, 0xe7e2e2eaU, 0x00000000U, 0x00000000U, 0x051f1ff9U,
+  0xf5aae9ecU, 0x00000000U, 0x00000000U, 0x14f60100U, 0xfefef518U, 0x00000000U, 0x00000000U, 0x0e29fc0bU,
+  0xdde40008U, 0x00000000U, 0x00000000U, 0x1e00001fU, 0x48bdcccaU, 0x00000000U, 0x00000000U, 0x06d2dd34U,
+  0x1278d100U, 0x00000000U, 0x00000000U, 0x35fd3800U, 0x00b002d7U, 0x00000000U, 0x00000000U, 0x00e5f2dcU,
+  0x1c3ed9faU, 0x00000000U, 0x00000000U, 0x1804110dU, 0xed10eed2U, 0x00000000U, 0x00000000U, 0xee2417f0U,
+  0x06c0dcd2U, 0x00000000U, 0x00000000U, 0x11d9f8d2U, 0xe726d01bU, 0x00000000U, 0x00000000U, 0x1633fcffU,
+  0x0be100eaU, 0x00000000U, 0x00000000U, 0x15ea0009U, 0x35cbc5d0U, 0x00000000U, 0x00000000U, 0x16daf328U,
+  0x135fe600U, 0x00000000U, 0x00000000U, 0x47193500U, 0x00db1decU, 0x00000000U, 0x00000000U, 0x00f009abU,
+  0xe60ee70aU, 0x00000000U, 0x00000000U, 0x32ff152fU, 0xecfbebc6U, 0x00000000U, 0x00000000U, 0xbc1a1cecU,
+  0xe7cff5c4U, 0x00000000U, 0x00000000U, 0xf1d1dcb9U, 0xde32ef04U, 0x00000000U, 0x00000000U, 0x152cfae7U,
+  0x2dd700e4U, 0x00000000U, 0x00000000U, 0x05ed0000U, 0x47e9ebebU, 0x00000000U, 0x00000000U, 0x0df509fbU,
+  0xf548cf00U, 0x00000000U, 0x00000000U, 0x0f112700U, 0x00cf24f0U, 0x00000000U, 0x00000000U, 0x00e11bb2U,
+  0x0402eeeaU, 0x00000000U, 0x00000000U, 0x32f2fc33U, 0xcdede6e2U, 0x00000000U, 0x00000000U, 0xbf0400e4U,
+  0xf8eff9e2U, 0x00000000U, 0x00000000U, 0xfbece0d0U, 0xdfeafe1bU, 0x00000000U, 0x00000000U, 0xf40e0ce3U,
+  0x640600fdU, 0x00000000U, 0x00000000U, 0xf2f300f1U, 0x37e6f2f1U, 0x00000000U, 0x00000000U, 0xed05f500U,
+  0xf714ad00U, 0x00000000U, 0x00000000U, 0x011a2900U, 0x00f62bf2U, 0x00000000U, 0x00000000U, 0x00e404cfU,
+  0x0cdd01eaU, 0x00000000U, 0x00000000U, 0x04ddf512U, 0xf5cf0403U, 0x00000000U, 0x00000000U, 0xd01004f9U,
+  0xf2c408d8U, 0x00000000U, 0x00000000U, 0xfcecebe7U, 0xe3000126U, 0x00000000U, 0x00000000U, 0xedf4fefcU,
+  0xfe2100e8U, 0x280800f2U, 0x11fa00daU, 0xe4080008U, 0xf9eb0e05U, 0x0afe0308U, 0x0507f917U, 0xe904fbedU,
+  0x00011200U, 0xf407f500U, 0xf8fceb00U, 0x04d73200U, 0x0009cdddU, 0x00e600e8U, 0x00010cf9U, 0x00b5e6e7U,
+  0x0905c70bU, 0x0501f5ddU, 0xfc0112e1U, 0xfee4c13aU, 0xff411ef5U, 0x08ebdd1aU, 0x08e9e213U, 0x020cc3f4U,
+  0x07e3250bU, 0xe2130fffU, 0xe70ffd01U, 0xefdcf70bU, 0x2048f2fbU, 0xffcbf8fcU, 0x00cd0bffU, 0xf3f70101U,
+  0x143100a3U, 0xfbfa0014U, 0xf6e200eaU, 0xf0ea00ecU, 0x00e34213U, 0x02dfefedU, 0x0d23f63dU, 0xd521fdf4U,
+  0xfef2eb00U, 0xe00b0500U, 0xfd04e100U, 0xf0062b00U, 0x0034c9ddU, 0x0008f506U, 0x00f81413U, 0x0016ceacU,
+  0xf909f0f2U, 0xdc1803ecU, 0xdc0d21dcU, 0x04eef317U, 0xc73033e2U, 0x0916e4f7U, 0x1deb0206U, 0xef2bacfbU,
+  0x1da83004U, 0xdee00220U, 0xec081320U, 0xf8c70e25U, 0x45640f0eU, 0x1c97f1f6U, 0x17b71af3U, 0xd7d80101U,
+  0x423200c2U, 0x00f00032U, 0xf5e300fcU, 0x1b0a00fcU, 0x31dc4e00U, 0x0af0d6faU, 0xfc17d32bU, 0xd70ffdfdU,
+  0x18e6c200U, 0xe9132400U, 0x0f15dd00U, 0xf0034900U, 0x0030dadaU, 0x002dfc1cU, 0x00fb1d0aU, 0x0037ec94U,
+  0xe72807fdU, 0xb30bf71bU, 0xda000cffU, 0xd6ecfc24U, 0xbb1533edU, 0x1724f3fbU, 0x35e8e81fU, 0xc935d0e7U,
+  0x288141f5U, 0x01cd1e24U, 0x0911ff32U, 0x14810f04U, 0x4d58fb24U, 0x2081ef03U, 0x108103fcU, 0xb7b0f9f2U,
+  0x1c1500faU, 0x0904001eU, 0xee0b000eU, 0x431100f3U, 0x1ee71ee0U, 0x15ebe017U, 0x1711d71bU, 0xef0506f6U,
+  0x12d99d00U, 0xc9f63900U, 0xf33cfe00U, 0xf8122e00U, 0x0009eef0U, 0x0033fb1cU, 0x00fc1907U, 0x003d03a6U,
+  0xef3202e7U, 0x9ff80f08U, 0xf2fd0910U, 0xc8fbff0dU, 0xb8f83af6U, 0x2e0ef6fdU, 0x43f9d614U, 0xcd2ae5d2U,
+  0x459441fdU, 0xf3f0142bU, 0x021efb22U, 0x36810b02U, 0x3c45d922U, 0xfbb2f4f1U, 0x039f0af2U, 0xe8d8f0f6U,
+  0x22390003U, 0x02fe00f4U, 0x00180009U, 0x241400e9U, 0x259f14d8U, 0xf50100ffU, 0x0815070cU, 0xebf7ff0fU,
+  0x12bebd00U, 0xdb0d3d00U, 0xdf051700U, 0x0c131f00U, 0x002ef6f7U, 0x000817faU, 0x00000409U, 0x000b13bcU,
+  0xca4efbc2U, 0xdef4e323U, 0xf6e7101eU, 0xfd0ee03bU, 0xf1e60b00U, 0x15fdf404U, 0x2e03e40dU, 0xe715fcfbU,
+  0x1fad3c07U, 0x0700111fU, 0x0b420726U, 0x3aa50210U, 0x0e1ad73bU, 0xf3d325d7U, 0xe4d108fdU, 0xfcedf0e9U,
+  0xe74400e5U, 0xfcf30002U, 0x0cd600d5U, 0xe9380012U, 0xf8001a2eU, 0x07f20d13U, 0xfc0f041aU, 0xebfdf8ddU,
+  0x0c171600U, 0xfa21f600U, 0xf8f3e900U, 0x02f04800U, 0x00f4b9e3U, 0x00fbf302U, 0x0017f6f5U, 0x0014e1eaU,
+  0x0df5d4ecU, 0xf5fe0cc5U, 0xe4f2fcfaU, 0xe5e2ba1dU, 0xeb4a23ddU, 0xf9f3efecU, 0x11e70efaU, 0x043bcf08U,
+  0x10d52005U, 0xf4efe60dU, 0xebf2e4faU, 0xf4dcf518U, 0x2869e60fU, 0x0ad6eee5U, 0x12c408e0U, 0xf400e2f9U,
+  0xf02d00ceU, 0x09ee001eU, 0x10bf00e6U, 0xe44d00eaU, 0x06f8fc0eU, 0x0deb1bdcU, 0xf3100c3bU, 0xe21719f6U,
+  0xf8e2e800U, 0xf8130e00U, 0x1ae7f000U, 0xea053100U, 0x000fcdffU, 0x0002ec0aU, 0x000810f2U, 0x0030fcc7U,
+  0xfcf4edd9U, 0xbe0f10bdU, 0xd00614f1U, 0xcdf3d525U, 0xd93724c2U, 0xf129dffcU, 0x36f5f204U, 0xf726a9fcU,
+  0x0fce2df1U, 0xfefbef24U, 0xe0c9e70dU, 0x1ad60b12U, 0x2d3bdf23U, 0x44c6bcfcU, 0x42d41ce8U, 0xd4e2ddedU,
+  0x211100ecU, 0xf6d70032U, 0x06c600f2U, 0x1b430019U, 0x18e2f4fbU, 0x11f9ebd0U, 0xd422e704U, 0xe3361c00U,
+  0x17c9b500U, 0x11fe3400U, 0x3a24de00U, 0xf9132b00U, 0x002fd404U, 0x000c1f1dU, 0x001b1104U, 0x002209a9U,
+  0xf9f41acdU, 0xc50d15d4U, 0xbefe31ecU, 0xd223d312U, 0xe5fc2de4U, 0x132ae902U, 0x3c0ce225U, 0xdd26ade6U,
+  0x1fe321f2U, 0x1903fd35U, 0x11b8f80dU, 0x08c406e9U, 0x1e00f00dU, 0x28a0d9ffU, 0x2db23ce1U, 0xd7edf7ecU,
+  0x2f27000aU, 0xf507001fU, 0xf4df0007U, 0x3131000cU, 0xefc9fec8U, 0x1cf7e1efU, 0x0d1a041cU, 0xf5060f07U,
+  0x28b8c400U, 0xeaf33f00U, 0xfc12f900U, 0x2dfefe00U, 0x0019cd1aU, 0x00101819U, 0x000217feU, 0x0032e993U,
+  0xfa15f5d8U, 0xe60a0fd9U, 0xf1fe1cf4U, 0xf217d919U, 0xe6f732fbU, 0x112ab8f6U, 0x2e1ddf19U, 0xd82eeee1U,
+  0x30f828dfU, 0x1b301029U, 0x04e51624U, 0xf6a3dfe3U, 0x07f7e2f7U, 0xe2abe2f3U, 0x1eae22edU, 0xf0ddf80fU,
+  0xfa2b00e3U, 0x07210007U, 0xde050004U, 0x160700f7U, 0x54ab1ffdU, 0x0c0de5f6U, 0x15240105U, 0xdfec0918U,
+  0x1bf0dd00U, 0xbfe31400U, 0xdb010b00U, 0x3d001600U, 0x003c0a36U, 0x0030fdeaU, 0x00f4120dU, 0x002f01c7U,
+  0xd32e25caU, 0xe9fb0a06U, 0x0ef51bfbU, 0xf72ab315U, 0xf7f31df4U, 0x060db3eeU, 0x19f8d523U, 0xe72000fdU,
+  0x1bd50d03U, 0x110f2030U, 0x102b0821U, 0x22a7f21fU, 0x46fdeb00U, 0xe4b2faf4U, 0xf5bcf711U, 0x0407efeeU,
+  0xd42e00e7U, 0x16fa000aU, 0xfef300ffU, 0xd5130012U, 0xeb05171dU, 0x06fa0100U, 0xfaea11faU, 0xeaf20809U,
+  0xf3de0700U, 0x0adbee00U, 0xf4eeea00U, 0xff1f3800U, 0x00fcc904U, 0x000f1125U, 0x0020e5e8U, 0x00ffede4U,
+  0x2606fdd7U, 0xd7045cd3U, 0xcbe6ed0dU, 0xdff2de13U, 0xd53d0dbcU, 0xfbe4f318U, 0x05f9fc00U, 0xf039eeffU,
+  0x06d73519U, 0xf9f5ccfaU, 0xf7eaf20bU, 0x12bd1239U, 0x293df514U, 0xdfd0faf7U, 0x0add06f2U, 0xd70df2f8U,
+  0xf3fe00e5U, 0xf7030021U, 0x13f500ffU, 0xf4050010U, 0x031409f3U, 0x060cf6f0U, 0xe407192eU, 0xda1b2633U,
+  0xe9d4f100U, 0xfde21200U, 0x0ff4eb00U, 0xd4141b00U, 0x0010c537U, 0x001c200bU, 0x000efaedU, 0x000e3ad9U,
+  0x081406d0U, 0xc0fe52b9U, 0xdcfaf5f6U, 0xcaf2cdf7U, 0xd75218c4U, 0x0aebdc3bU, 0x3208eb04U, 0xf3fbb201U,
+  0x03f63b00U, 0x240ee50bU, 0xfdc2f50aU, 0x06e01036U, 0x2d00f40eU, 0x1cda16f0U, 0x24e808ecU, 0xc3fcbbf5U,
+  0x29fc00eaU, 0x180c0030U, 0x13f900e4U, 0x00160017U, 0xfde8e118U, 0x0ff9e224U, 0xf108ea1aU, 0xc1046125U,
+  0x15c0f000U, 0x05f13400U, 0x2d350800U, 0xf5ed0900U, 0x000fd90aU, 0x002445ddU, 0x000f18eeU, 0x0035e997U,
+  0x07051bd7U, 0xfa1109e5U, 0xf10516f4U, 0x0adf0cfdU, 0xf7fffdf3U, 0x0e0dd425U, 0x1a250108U, 0x0b2bc906U,
+  0x09f538eaU, 0x0e01e20fU, 0x07aee8feU, 0xedc9e021U, 0x1505fc21U, 0x0fda0309U, 0x32ec14d1U, 0xcae2dcecU,
+  0x081b0015U, 0xce250016U, 0x28f300dcU, 0x17fe001cU, 0xeadc0bedU, 0x141ef912U, 0x0901ee2bU, 0xd2e72823U,
+  0x0dbaf900U, 0xd70d2100U, 0xe4281c00U, 0xfd080300U, 0x00fcef0aU, 0x001f04ddU, 0x00f60b04U, 0x0035cba2U,
+  0xf70d0605U, 0xf22900ebU, 0xdd0b24f3U, 0x24d2070bU, 0xd9f0ff0eU, 0xf51db21cU, 0x261dd719U, 0xfa3208fcU,
+  0x0b0fd4e0U, 0x1211eefbU, 0x10dcf212U, 0x05a9f203U, 0x130ce3fdU, 0xeae01108U, 0x10c701d8U, 0xebef0aebU,
+  0x02020027U, 0xec380016U, 0xf9d200f2U, 0xff240004U, 0x30d82ee3U, 0xfe16ef22U, 0x08180400U, 0xaef60c36U,
+  0xe1d3f500U, 0xd413e700U, 0xed003400U, 0x19192200U, 0x00e50a08U, 0x00390bd4U, 0x00e6ef04U, 0x002cf2beU,
+  0x0b1a2b06U, 0xde320805U, 0x051f09e7U, 0x29f7db00U, 0xd6d92ef9U, 0xe71cebf0U, 0x02fee727U, 0x070f1df2U,
+  0x0918cefdU, 0x04edfb40U, 0x06170710U, 0x11b32105U, 0xfce9ee05U, 0x21d51b09U, 0xfacaefe9U, 0xf60404e8U,
+  0xf30c00f7U, 0x1bc80000U, 0xf80d0007U, 0xe5130005U, 0x10004213U, 0xdd01fd1bU, 0x20e1f805U, 0xf90afa15U,
+  0xe6100900U, 0x2bb0e200U, 0xede40a00U, 0x034b1a00U, 0x00ddcb18U, 0x000afb00U, 0x0002dcf7U, 0x00e011fbU,
+  0x310cd5d3U, 0xf7f353d0U, 0xc703ebfdU, 0x02fcc3e8U, 0xe7221cddU, 0x05d41212U, 0xfc0ff9f6U, 0xf4240003U,
+  0x09fd3c0fU, 0xffdbd702U, 0x06e50210U, 0x2dfa173aU, 0x313de70bU, 0xf3e7f2d8U, 0x14e70402U, 0xe000ee01U,
+  0x1aff00faU, 0x32d9000fU, 0x030b000fU, 0xcefa00fbU, 0xfaf9ff2cU, 0xcf02ff15U, 0x1afd0223U, 0x0fdc13f9U,
+  0xf1f91500U, 0x23d5f200U, 0xf3d30b00U, 0xf8201a00U, 0x00d6e60dU, 0x00124afdU, 0x0018d10cU, 0x00e9dc0fU,
+  0x02121fffU, 0x0cdf50f8U, 0xc201f7f2U, 0xf3fccae4U, 0xf34911e1U, 0x23c80e47U, 0x1b1dd3f6U, 0x1011f705U,
+  0xfaf037f3U, 0x18f2dd07U, 0xfed005ffU, 0x29f90b4bU, 0x0b20e4fdU, 0x12ed1ae6U, 0x06d0f200U, 0xf9fee7e2U,
+  0x140400f5U, 0x39e1004eU, 0x19fb00f9U, 0x0ddb00e2U, 0xead0e910U, 0xcf0e1c42U, 0xf90cfe1bU, 0x02d10e28U,
+  0x1be11b00U, 0x0be01400U, 0xfa1dfd00U, 0x0418fc00U, 0x00e5f603U, 0x002033dcU, 0x00fc07ddU, 0x00e1beddU,
+  0xf4120b1bU, 0xe4f14d22U, 0xfa0704e4U, 0x17e5ece6U, 0xf9fa03f3U, 0x24eb1f2fU, 0xee1ee408U, 0x162d1410U,
+  0xe6d6eee0U, 0x07cde404U, 0xf6d11210U, 0x2b02ff21U, 0x1c28d807U, 0x08d026efU, 0x0bdf05efU, 0x10dce9ebU,
+  0x27fe000dU, 0xef230030U, 0x25ec00eeU, 0x2b0700dfU, 0x08d60bd4U, 0xdb271b32U, 0x06e8f32aU, 0xcdf01b18U,
+  0x2bd41e00U, 0xfc061800U, 0xe9280c00U, 0xe4370800U, 0x00d3fdfbU, 0x001711f5U, 0x00df12e0U, 0x00fbe8eeU,
+  0x192e0647U, 0xcff63c31U, 0xf313ffd1U, 0x2fd8ff04U, 0xc1e231efU, 0x000b150eU, 0xf40af61eU, 0x071934f1U,
+  0xe502bca6U, 0x05f6e61aU, 0x15e9f7fcU, 0x22f7f20eU, 0x0515ede7U, 0xf7fd1204U, 0x14defce5U, 0xe606f1d9U,
+  0x2ce7001cU, 0xd1370028U, 0x0fd100d8U, 0x160d00d0U, 0x250704cbU, 0xe0fef852U, 0xfc0efdf6U, 0x9c1b312bU,
+  0xeabd2200U, 0x1e1ff200U, 0x04ed2700U, 0xed1ffc00U, 0x00cb20b6U, 0x0026f7deU, 0x0010fdcfU, 0x000605f7U,
+  0x2b51f234U, 0xbde8253dU, 0x1938edd5U, 0x22dcf9ffU, 0xb6cb0b01U, 0x072b16eaU, 0x0318f60bU, 0x0bfe2f07U,
+  0xf643bcc7U, 0x0ecbfe1dU, 0xf824f71bU, 0x09dd3c0dU, 0xc802fadaU, 0x21fe1b06U, 0xf9eaeaeeU, 0x021610f6U,
+  0x18290016U, 0x00c40018U, 0x1917000bU, 0x01070013U, 0x160d1216U, 0x05df1e0fU, 0x20e3f506U, 0xcbf116f1U,
+  0x0efb2100U, 0x14ebe000U, 0xf0101800U, 0xfc190600U, 0x00e1df15U, 0x0015d3e1U, 0x00f5fd01U, 0x00d4f70cU,
+  0x2816f602U, 0xf50310f4U, 0xd901fc04U, 0x0a21f0f5U, 0x072049f6U, 0xecfd08e3U, 0xf21a00fcU, 0xfdffedeaU,
+  0xf31629f7U, 0x08cbef12U, 0x19e10802U, 0x1b0eff02U, 0x0946fb17U, 0x2de6ddd0U, 0x0ce7f20fU, 0x1bf30f11U,
+  0x181d0014U, 0x22d800ebU, 0x1000000bU, 0xe1f900f7U, 0x20c5ef2aU, 0xf2d21811U, 0x22de0221U, 0x000516e4U,
+  0x16333d00U, 0x35ecd900U, 0xe7f72c00U, 0xea150500U, 0x00f9fbfbU, 0x001bf8bfU, 0x001ff3f1U, 0x00d2ee22U,
+  0x071b100dU, 0x10fd0d22U, 0xda0d0ce3U, 0xf0f1e4d9U, 0xf80d38eeU, 0x13ff2af6U, 0x1032e1f3U, 0x200fe5dbU,
+  0xe4f505e6U, 0x0becd209U, 0x0dca0ee8U, 0x0d1cee2eU, 0xf745ea04U, 0x10ffe5c5U, 0x06fcea04U, 0x3adddc00U,
+  0x12260013U, 0x30020020U, 0x11ff0003U, 0x212900caU, 0x2fc1f906U, 0xf9e7283bU, 0x10e8260eU, 0xde0c3101U,
+  0x40322200U, 0xfdfff200U, 0xf6091500U, 0xd301db00U, 0x00270cb8U, 0x0016fde4U, 0x0017febcU, 0x00cfefffU,
+  0x1f1d1532U, 0x19ef0e39U, 0xf81affd4U, 0xf7f0eab9U, 0xcf0a1deeU, 0x070b3cf5U, 0xe53cf3e7U, 0x142cebd6U,
+  0xc2eefbb7U, 0x16e2b8faU, 0x0cd3f7f8U, 0x1a06f61aU, 0xeb1ecddfU, 0x061017e7U, 0x0c0506e4U, 0x33e2fc04U,
+  0x43ef00e3U, 0x0e2f0026U, 0x2b0c00fdU, 0x2b0100a1U, 0x42fe0cd8U, 0xf0f31447U, 0x1d0520f6U, 0xb41a2e1bU,
+  0x2de51600U, 0xe8f10800U, 0xff1c0400U, 0xe61fcd00U, 0x0023138dU, 0x000c12f8U, 0x001dec92U, 0x00ea0e0dU,
+  0x4b11fe2dU, 0xf7091f2bU, 0x1031f3e3U, 0x00f904d8U, 0xaee003f0U, 0x09162514U, 0xe929e509U, 0xfe161cf4U,
+  0xe1062bbeU, 0x2a01d117U, 0x1dfa01eeU, 0x2a0d0820U, 0xe106fbd7U, 0xe71b201aU, 0xe00000ebU, 0x26eef322U,
+  0x05ee00c6U, 0x013d0017U, 0x00e500e0U, 0x1b1700a3U, 0x1f080301U, 0xfee80a34U, 0x2f160bdbU, 0xd101302bU,
+  0x05c30f00U, 0xf723e100U, 0xf7100a00U, 0xff14c100U, 0x0017f5a3U, 0x000d03f5U, 0x00060f9eU, 0x00f6101bU,
+  0x2f1dff27U, 0xe8fd1ff3U, 0x2b44f2e0U, 0x17e501d9U, 0xabe8080dU, 0x07110311U, 0xea28f4f6U, 0x31fd1c04U,
+  0xf015e1e5U, 0xfec3e50dU, 0x1a19fe04U, 0x111a0b17U, 0xc3f301e0U, 0xff1315efU, 0xf1ecf903U, 0x1837fc14U,
+  0xf0ed0005U, 0xfffa00eeU, 0xf10400d5U, 0xfd0500f4U, 0xf9e504d7U, 0x08e902e5U, 0xff10fd06U, 0xf6f1f9eeU,
+  0x06d9ff00U, 0xf908ea00U, 0x0023f200U, 0x02d81800U, 0x00f9fdf0U, 0x00d2fdf3U, 0x00af16efU, 0x000df2f6U,
+  0x05f7c2feU, 0x05f2ebe7U, 0x06f4ccf9U, 0x07f9f807U, 0xf5f511f0U, 0xfcf4e3f2U, 0xfdf9fc02U, 0x0400f3f7U,
+  0x0ef7f2f7U, 0xebfeebcdU, 0xeb05f5ddU, 0x0de10b0bU, 0x1317f207U, 0xfbfc100aU, 0xfe1803fcU, 0x03fcfdfcU,
+  0xfe0300e9U, 0x04f3000aU, 0xf5fb00d3U, 0x0b2300dcU, 0xf4f122c3U, 0x0cd102e4U, 0x090f0913U, 0xf2daf6d6U,
+  0xf1e3dd00U, 0xf91af000U, 0x033fe100U, 0xfaf21600U, 0x001ae2f5U, 0x00d00ef5U, 0x00a609e5U, 0x000fdfd8U,
+  0xf0f7dac7U, 0xf2dff4d7U, 0x20d9d906U, 0xef11190fU, 0xd8f905f3U, 0xeaf9fbf9U, 0x110ae21aU, 0xe31ffdf7U,
+  0x29dfe402U, 0xe3ebe0e0U, 0xe32302e8U, 0x1ec00400U, 0x3620f5f8U, 0x1fe81ef8U, 0xfe271afeU, 0xe4f0280eU,
+  0x03ee0002U, 0xebe90034U, 0xf1e200c5U, 0x110e0011U, 0xf61819e3U, 0x1104d8d3U, 0x1a120023U, 0x0eb5f604U,
+  0x1af8cd00U, 0x142fe900U, 0x0a35c300U, 0x14da2800U, 0x00fdee2bU, 0x00fa325cU, 0x00bb12e0U, 0x00eedee5U,
+  0x281137abU, 0x0edd27b1U, 0x3bd8f20dU, 0xe91c2026U, 0xedd610e6U, 0xe6f90606U, 0x1f000c0dU, 0xb91e07f6U,
+  0x4408c205U, 0x1715cc00U, 0x0e1c00f8U, 0x26dbf5eeU, 0x154319f5U, 0x06f919e9U, 0x0448340fU, 0xc0e2330aU,
+  0x0bd00024U, 0xe7df006eU, 0x02e30007U, 0x1ce10023U, 0x09fb10f5U, 0xf20fffebU, 0x31151022U, 0x0cc60018U,
+  0x0911c000U, 0x0c34ef00U, 0x0e4eb600U, 0xf6de1500U, 0x00e6001dU, 0x00020847U, 0x009f07e1U, 0x0010e8ebU,
+  0x521c3fe2U, 0x28f818e9U, 0x3dfd0920U, 0x010811f8U, 0xce0129eaU, 0xf8e7330dU, 0x03011c01U, 0xdd1200fdU,
+  0x0532c0d3U, 0x054a94faU, 0x013aed01U, 0x10e1ecf8U, 0x1d2517d3U, 0xc40916efU, 0x1c333616U, 0xcae23401U,
+  0x25c00000U, 0xf8d60027U, 0x13f40022U, 0x11f40025U, 0x1f180007U, 0xe54f0515U, 0x492e0b2cU, 0x0de60700U,
+  0x16f70300U, 0x05191100U, 0x2042a800U, 0x0304ed00U, 0x00ecff51U, 0x00d2ee6bU, 0x00d2f7f1U, 0x001d10e3U,
+  0x362e3debU, 0x46e153cfU, 0x2a154fcaU, 0xfdfdd8fcU, 0xe9fc1b17U, 0x16f23814U, 0xfefb3500U, 0xef030400U,
+  0xf125c6baU, 0xea7f9d0bU, 0xf925f82bU, 0x11cfe808U, 0xe503fdedU, 0xcf2b17f2U, 0x23371716U, 0xe9f0330bU,
+  0xf8020001U, 0xf8f600e7U, 0x00fd00caU, 0xfb2900e7U, 0xfbf204d9U, 0xf304f704U, 0xf80e05f0U, 0xe4e404eeU,
+  0xff02fe00U, 0xfcf7d900U, 0xff27df00U, 0xf9d73100U, 0x00e3f4f1U, 0x00d0e5e6U, 0x00e914d0U, 0x000bdce6U,
+  0x07f5e809U, 0x1af4dffdU, 0x1c03dc21U, 0xf402f702U, 0xdff2fcf7U, 0xdff718faU, 0xf8e3cafdU, 0xe0f414fbU,
+  0x0e0904f9U, 0xed05f4daU, 0xc709fed0U, 0x1bcced0aU, 0x040a0108U, 0xe7e30a05U, 0xe5001502U, 0x0d0908fdU,
+  0xd211001cU, 0xedfa00fbU, 0xdff800dfU, 0x104e00b7U, 0x0111fbd0U, 0xf218dcbfU, 0xd62403efU, 0x00bc089eU,
+  0xd807e100U, 0xeee6e300U, 0xe61ce900U, 0x01c7ef00U, 0x00e2d3fbU, 0x00c7fddeU, 0x00df0fccU, 0x003fe8e6U,
+  0x05fae4e1U, 0x2ee606f1U, 0x2ffbcd2dU, 0xd50dfe0cU, 0xd21f06eaU, 0xc1153cf6U, 0x0107e000U, 0xd123f836U,
+  0x160ddcfdU, 0xfbd1fcf5U, 0xdff623f2U, 0x28a8edcfU, 0x002c0d19U, 0x052e1cf0U, 0xece41defU, 0x07022b00U,
+  0xde0a00f4U, 0xfafb00ffU, 0xcff100d6U, 0x36f800e2U, 0x041df6d6U, 0xe343a6ccU, 0xd50adcfaU, 0x1f8ffcbeU,
+  0xeb15d900U, 0xea06cf00U, 0xfcf4c800U, 0x1de2f500U, 0x00edd501U, 0x00dd131cU, 0x00e60c04U, 0x003202edU,
+  0x2607eee6U, 0x60ed16daU, 0x17e5e4f9U, 0xd63af917U, 0xaa012addU, 0xc2fc18feU, 0xe6120709U, 0xee4a0a42U,
+  0x2720e2faU, 0x2b0e0319U, 0xf6e313f8U, 0x26a0fdd2U, 0xfb3f0902U, 0xf10336e4U, 0x190a2ae9U, 0xf9f81e06U,
+  0x21d400f1U, 0x10fd0020U, 0x0fca0011U, 0x3df50005U, 0x10260cdfU, 0xfd23c6f7U, 0xf40bff26U, 0x1eb0f5f7U,
+  0xf3fcdf00U, 0xdf20e900U, 0xe9f7b500U, 0xf7cf0100U, 0x00f5ebe9U, 0x00dd1ef5U, 0x00ddf808U, 0x0036e523U,
+  0x251e0e08U, 0x62f81228U, 0x33d1f507U, 0xc02201f2U, 0xb9df28feU, 0xcaf237fbU, 0xceea11d2U, 0xf50e151eU,
+  0xea13d4e1U, 0xf62bddfbU, 0xfbfded0cU, 0x1cafe8f6U, 0x102218caU, 0xd10b4b09U, 0x2712170dU, 0xdad91918U,
+  0x4ab400e0U, 0x19ca00fbU, 0x17ae000eU, 0x452e0036U, 0x31270901U, 0xec5dfd03U, 0x5d113409U, 0xffd1e3f8U,
+  0xf0ff1000U, 0xce1a0d00U, 0xf85ba600U, 0xffe6f800U, 0x00c726f9U, 0x00ae0ff8U, 0x00c905d6U, 0x0063f5e6U,
+  0x22290ef1U, 0x73f615f1U, 0x32ea2ee0U, 0xc930121cU, 0xe0e60a16U, 0xd2e02e10U, 0xded33ee8U, 0xfd211ae5U,
+  0xd5f6f2afU, 0xd030c7d4U, 0xf4e1eaf5U, 0x09d2de0eU, 0xf8f70dd3U, 0xc8363c12U, 0x4131250bU, 0xc8e00425U,
+  0xf7fe001eU, 0xf0d7000cU, 0x07e700d1U, 0xe56a00e6U, 0x100b0dd9U, 0xd43e00f0U, 0x1b31f2e9U, 0xfa0518f7U,
+  0x0520f400U, 0xfffcd600U, 0x0837cf00U, 0xfe4f3000U, 0x00fc18e4U, 0x00ecdbefU, 0x000e33d6U, 0x0000d0c0U,
+  0x0ce524f5U, 0x3ee0fe16U, 0x3e08ef39U, 0x34dfb3fbU, 0xecf51803U, 0xe2f31b00U, 0xe4e1faf3U, 0xca1606f4U,
+  0x0c0df4c6U, 0xf21ef5f2U, 0xd9231dd4U, 0xffd3130aU, 0xf9161b05U, 0xdceb20fdU, 0xeaea3606U, 0x176ae0fdU,
+  0xd7000014U, 0xddfc00feU, 0xf01100e8U, 0x062c00d6U, 0x1115ebf1U, 0xeb30e5e4U, 0x0ff1f0eeU, 0x06d421e6U,
+  0xd513e400U, 0xeae8e300U, 0x0d3ee500U, 0xfb29eb00U, 0x00d7f004U, 0x00ddcbdcU, 0x00fc36f9U, 0x0003b6afU,
+  0xfcd224efU, 0x3cb211e4U, 0x1f10d844U, 0xdcfac1f7U, 0xdb092fefU, 0xde09381aU, 0xe802de01U, 0xb1381e07U,
+  0x1028e1e0U, 0x050ded20U, 0xec2837e5U, 0x13ca09bfU, 0xf61af60eU, 0xef1714daU, 0xf6ef1501U, 0xc83ef003U,
+  0xd214000cU, 0xeb0400f9U, 0xe1fc00ebU, 0x0a3400c8U, 0x1207f70bU, 0xfa4bc117U, 0x03fff4f8U, 0xfab123f8U,
+  0xe01ffc00U, 0x0600c200U, 0x0545ee00U, 0x1ae7e100U, 0x00e808eeU, 0x000108dbU, 0x00daf115U, 0x00e4b8caU,
+  0x1af0fd20U, 0x46d5f7e9U, 0x1900c714U, 0x0711e4f7U, 0xcef83ff9U, 0x03122c06U, 0xd510fcedU, 0xa03364ecU,
+  0x0516dad6U, 0x10efdaf9U, 0xfe131dceU, 0x209b17c6U, 0x1437fc08U, 0xe10920fcU, 0xf906f80cU, 0xe17f0417U,
+  0x0d080006U, 0x1bde00eeU, 0x0aec00ffU, 0x013700f6U, 0x1d10e8fcU, 0x093cd83cU, 0x0d2bf402U, 0x10e717f8U,
+  0xefed0900U, 0xd32ae600U, 0xf341fa00U, 0x05ead800U, 0x00f51fefU, 0x001c06cbU, 0x00e2fa0eU, 0x0000e7e2U,
+  0x210c0813U, 0x1ddc050fU, 0x5de8df05U, 0xee0df2f3U, 0xd1bffc04U, 0xede91d13U, 0xc0da28deU, 0xc005520bU,
+  0xe126ece2U, 0x07e3e8f2U, 0xf716eebbU, 0x17b6f3daU, 0x041216faU, 0x18e32627U, 0xfa1912e4U, 0xfa372213U,
+  0x3bec0001U, 0x21b800b4U, 0x03c500feU, 0x124c0021U, 0x0322d2f7U, 0x0264eff1U, 0x78340805U, 0x2bdb18fbU,
+  0xf1e7ea00U, 0xe7fa0f00U, 0xf63ad800U, 0xfff2e900U, 0x00ef31f1U, 0x00ef13b1U, 0x00d520bcU, 0x00510cf4U,
+  0x2e10fe03U, 0x26f2ceebU, 0x15f7fc1eU, 0xd61f1f2fU, 0xd9aafb03U, 0xb5d51f0eU, 0xc6cc36ebU, 0x020a3defU,
+  0xe211cae8U, 0x0215d0e1U, 0xf1fac5d1U, 0x12d5e9feU, 0x0ff03cc0U, 0xfc052025U, 0x311928eeU, 0xf9f8351fU,
+  0xf9ef0025U, 0xece4001dU, 0x09c300ecU, 0xdb3a00faU, 0xf80908f5U, 0xb21d0911U, 0xeb24d50eU, 0xfa170119U,
+  0x0f07fe00U, 0x00e9e000U, 0xfbcde500U, 0xf0361f00U, 0x002ce6f4U, 0x0018d8d5U, 0x0039f0d7U, 0x00fde1d2U,
+  0x25d2341dU, 0x44ce1b06U, 0x490fed23U, 0x5e00de22U, 0xe6f72516U, 0xfdef1e14U, 0xfbfcee07U, 0xd12d06e8U,
+  0xe218f9ecU, 0x0d34e118U, 0xe4030af2U, 0x13195c1bU, 0xf6201cf4U, 0xfc0a0eddU, 0xfee92a12U, 0xd9440d41U,
+  0xde0c0005U, 0xc9e90020U, 0x2fda00e5U, 0xbb5100d7U, 0xee0adbf8U, 0xed1fe4ffU, 0xe60cf404U, 0x16f8fa12U,
+  0xfd06ec00U, 0xe90de000U, 0x1617ed00U, 0x0f4c1300U, 0x00f7e5faU, 0x00fcf3e6U, 0x001c1bb5U, 0x00ee1803U,
+  0x10bd1a1fU, 0x17af08e7U, 0x4a09dd19U, 0x0511c8faU, 0xfbf32721U, 0x39e93d11U, 0xd7f30b1eU, 0xda0aecd2U,
+  0x0425d9eaU, 0x181bed17U, 0x050eed12U, 0xf91943f6U, 0xf13b16fbU, 0x030c0600U, 0x03df200cU, 0xdd32f90eU,
+  0xec02001bU, 0xf3e600ebU, 0x3ff000f8U, 0xd83a00d3U, 0xed0bcaffU, 0x001fda1fU, 0xfbf5f50eU, 0x27051125U,
+  0x08090300U, 0xfb34d900U, 0x1249fe00U, 0x112cf900U, 0x00f6f208U, 0x0008e7eaU, 0x000d0ce4U, 0x00fe2e02U,
+  0x14f5083cU, 0x2cc4fed1U, 0x29fefafbU, 0x07f5c4f6U, 0xeb04400dU, 0x5aef0ffdU, 0xdde4faeaU, 0xeee627eeU,
+  0xd721e5c5U, 0xf5f405faU, 0xe8f1f3f7U, 0xeb1630eeU, 0x18271b15U, 0x02f4f616U, 0xe6ea0ef9U, 0xe73bedf7U,
+  0x04030004U, 0x0ef400b6U, 0x32c700e4U, 0xd22900ecU, 0xdb02c1e7U, 0x1442c915U, 0x271be406U, 0x08f424f5U,
+  0x050f1f00U, 0xe524fd00U, 0x1027ff00U, 0xe0de0200U, 0x00f02104U, 0x00f4fae4U, 0x00f509e2U, 0x0030f118U,
+  0x2a161534U, 0x22d908daU, 0x44fefd1cU, 0xcee7fb14U, 0xdfd93d13U, 0x1de71631U, 0xcfe734e6U, 0x11fa1f05U,
+  0xc931cdcbU, 0x02ef0d05U, 0xdc06d3cdU, 0x00fd1206U, 0x060c04ebU, 0x12d31b28U, 0x21fae3e5U, 0xec1200faU,
+  0x100c004bU, 0x0f0800b9U, 0x0ddd0007U, 0xda16000eU, 0xccf8cae8U, 0x1911c8f6U, 0x5808eaf3U, 0x36e91319U,
+  0x18eb0b00U, 0xe6db0700U, 0xfaf30c00U, 0x1cf0f600U, 0x00ec1f0eU, 0x00f8f7beU, 0x00f1eebbU, 0x00130e40U,
+  0x1d0b3865U, 0x12faf5a1U, 0x1beffc17U, 0xc7d01b23U, 0xe5b717faU, 0x02dc0a0dU, 0xd6e12309U, 0x20e22502U,
+  0xd618c1c7U, 0x0ae8fcf8U, 0xf4dac6c2U, 0x29e10d07U, 0xe9081ec7U, 0x27e6050bU, 0x22fee5eeU, 0x1ff811feU,
+  0xf6e40021U, 0x07f30022U, 0x33e60018U, 0x1d2100caU, 0x27051800U, 0xed031d17U, 0x0adce40fU, 0xed112009U,
+  0x1119fa00U, 0xfcefea00U, 0x0025fa00U, 0x120a1100U, 0x0039eb0cU, 0x0026d6d8U, 0x0040f3dbU, 0x0023f9e9U,
+  0x34131d0fU, 0x2dfefa04U, 0x112a0d21U, 0x2824f501U, 0x0ad63e0eU, 0x0bd32c00U, 0xf6230effU, 0x08e3f613U,
+  0xee10250fU, 0x1107f216U, 0xfdda190cU, 0xf457092aU, 0x02330c12U, 0x101014fcU, 0x0fe715e6U, 0xd32dfa1aU,
+  0xffdf002cU, 0xffd90016U, 0x5bf400f8U, 0xf51900f6U, 0x2c36e8d7U, 0x0b0e0e1eU, 0x301b0420U, 0xbd16f9f8U,
+  0x290bfe00U, 0x04f7e000U, 0xfee60300U, 0x18f01a00U, 0x002fe204U, 0x000bdcdbU, 0x0031dfb6U, 0x0024f32cU,
+  0x4604092cU, 0x39e1f3f3U, 0x7028e608U, 0x21d0e234U, 0x15c75814U, 0x0def272cU, 0xc90721f3U, 0x28b9ee03U,
+  0x021fd803U, 0x2306e915U, 0x0edbf315U, 0xd63d481fU, 0x013f230aU, 0x1a05fafbU, 0xf1fe1ac3U, 0x19011f09U,
+  0xfad0003bU, 0x0acd00f1U, 0x5fe600cfU, 0xb00200f1U, 0x1a0ec1e0U, 0xff3bee38U, 0x3817eefaU, 0xb51be107U,
+  0x32113b00U, 0xf21d0200U, 0x21c31100U, 0x14e9f600U, 0x0015f8eaU, 0x00f1dae5U, 0x00fee1b6U, 0x001aed54U,
+  0x53151062U, 0x34d20ae4U, 0x7025edfaU, 0xfcc3ff40U, 0x05ec490eU, 0x09fd3b1eU, 0xb4fef5dbU, 0x36d4051cU,
+  0xf422cfe6U, 0x2629e10bU, 0x0cebf9fdU, 0xda372f19U, 0xf52b0a2dU, 0x11c70e0bU, 0xd5d9e5fbU, 0x210914f0U,
+  0xe9e20035U, 0xf11e00e2U, 0x2bc5009bU, 0xda0c00f0U, 0xaf14d9e3U, 0xc721c210U, 0x2527e5f3U, 0x93151119U,
+  0x3d0f5b00U, 0x0d1b1a00U, 0x1ddc1d00U, 0x17ff2a00U, 0x00fa2d10U, 0x00f1ff10U, 0x00fff4e3U, 0x00fefb69U,
+  0x49061778U, 0x26e4f6edU, 0x7f35fa11U, 0xd7c60325U, 0xf8e53b0eU, 0x0e182e1cU, 0xc9190ef2U, 0x160e2810U,
+  0xd633b6c3U, 0x0d3dfd0eU, 0xf909faeaU, 0x0f09f530U, 0x06460bc4U, 0x411c0ef7U, 0x0ecbf1ebU, 0x19101ff3U,
+  0xd5f00037U, 0xc81400ffU, 0x0bc500cdU, 0xf2120000U, 0x9518e4f8U, 0xd404de0fU, 0xf80ae7f1U, 0xb70a0d2fU,
+  0x2cf64f00U, 0xfde81f00U, 0x08dd2900U, 0x2f262100U, 0x00040012U, 0x00dfdd05U, 0x00e0d8beU, 0x00e9f745U,
+  0x3fe60f7fU, 0x1b0cffe3U, 0x5a19f306U, 0xe4a30330U, 0xf9f51c18U, 0x190ff4faU, 0xf3050dfaU, 0x3c05fb15U,
+  0xe174e1e6U, 0x132d1814U, 0x101af5daU, 0x1e17ec0bU, 0xde2909c6U, 0x4e1704eaU, 0x0ddf02e5U, 0xf12c10ebU,
+  0x19fb00f7U, 0x0afb00f7U, 0x23350000U, 0xe82800f3U, 0x04f300fbU, 0xf3e2fee8U, 0x1fe80b0fU, 0xeaf40ed7U,
+  0xfce2fe00U, 0xf9f20200U, 0x08321f00U, 0x05f30c00U, 0x00e3ec04U, 0x001bd1e1U, 0x00da3c1eU, 0x00e4b2e9U,
+  0x01f0e1feU, 0x0d0be7efU, 0x0932f333U, 0x06dfbbd6U, 0x01e9f513U, 0xff13f2e6U, 0xfffa270cU, 0xf51110f4U,
+  0x0710f606U, 0xe8d51ef7U, 0xea1509e0U, 0x29f0faf3U, 0xfeeeebfcU, 0xfad81107U, 0x0e2c0b15U, 0x084fd2ffU,
+  0xfb04000fU, 0x12e300e5U, 0x1c1c00c1U, 0xf23300b9U, 0xfe0403e9U, 0x06e9ff0dU, 0x2edc1cffU, 0xc9fc32e8U,
+  0x01eeff00U, 0xd204d100U, 0x16580300U, 0x3ae60f00U, 0x00fdeef0U, 0x000fe2f4U, 0x00da2408U, 0x000ec7cdU,
+  0xeaef01f9U, 0xea1cfccdU, 0x221d0229U, 0x1de5aa8cU, 0xefe015f8U, 0xe52ffbeaU, 0x31f70218U, 0xd71c3c05U,
+  0x02fbe70bU, 0xfeb92915U, 0xde231cd0U, 0x10b3f5efU, 0x07f0fff0U, 0x1ec61a05U, 0x083d1a24U, 0x157faf0cU,
+  0xfde90023U, 0x0bfc0006U, 0x312c009fU, 0xf1ea00c9U, 0xf7f711e0U, 0x1fd314f5U, 0x36fb06ffU, 0xe7f32b22U,
+  0xf6e2f900U, 0xe201bd00U, 0x0752c200U, 0x22df1000U, 0x0016e70fU, 0x000ffb1dU, 0x00c73ee3U, 0x0012d292U,
+  0xc5f90a1aU, 0xd732d3f7U, 0x26023afdU, 0x22ebf3daU, 0xf51414deU, 0xce2eef09U, 0x25dc1e2dU, 0xc42c350eU,
+  0x03e4c50bU, 0x1f9f3b1dU, 0xfc2d1ed4U, 0x1890c6e3U, 0xffcf15e9U, 0x41dc13f5U, 0x074d2e3dU, 0xf868daf8U,
+  0xede00026U, 0x0ff40029U, 0x233100d6U, 0x25ca000fU, 0xd7f011dbU, 0x2db610faU, 0x4b15021aU, 0xc9231de5U,
+  0x04f40600U, 0xd7f8d700U, 0x0b4acb00U, 0x15cd0f00U, 0x00f6e418U, 0x000a0f23U, 0x00d20accU, 0x000dd7c2U,
+  0xc0e8e622U, 0xc51dcb0cU, 0x220d240dU, 0x38dd1812U, 0x011716efU, 0xe60ae208U, 0x0e02091cU, 0xbe0e3004U,
+  0xfef6e4f0U, 0x23aa3ffaU, 0xf51904e7U, 0x218ca1d7U, 0x05e51efbU, 0x2bdaf7deU, 0xec4b0e37U, 0x264ce3e6U,
+  0xcbd90032U, 0xfc15002dU, 0x1629000bU, 0x20e100f5U, 0xdffb06f7U, 0x37c915edU, 0x4920101dU, 0xc72cf4fdU,
+  0x061b0c00U, 0xf90ddf00U, 0x15ffca00U, 0x1a091f00U, 0x00d01b0eU, 0x00121b04U, 0x00cdfdb8U, 0x0002fee5U,
+  0x02efd80dU, 0xbf17fd0eU, 0x3d1e11e5U, 0x38ef03e3U, 0x021cf4fbU, 0xfc1efe04U, 0xf707f51aU, 0xe1fc3b05U,
+  0x1002d2ebU, 0xfba72deaU, 0x101f181dU, 0x29b9c7d8U, 0x12e209e9U, 0x27e121dbU, 0xf043fb3cU, 0x153403d5U,
+  0xfbfe0014U, 0xfbf800f2U, 0x303400fcU, 0xd73300deU, 0xde08faeeU, 0xf9fe140bU, 0x421329e7U, 0x0beb1effU,
+  0x05f80200U, 0xf01eef00U, 0x047ff700U, 0x0528f400U, 0x002ae403U, 0x0002c0c7U, 0x008632efU, 0x00efbefdU,
+  0xeef208fbU, 0xf4f822ebU, 0x3a1e9516U, 0x3fe4dbafU, 0xfffbf2efU, 0xee1a0df8U, 0xfcfee004U, 0xdaf1fde2U,
+  0x16f0edf0U, 0xe1bc13d8U, 0xd23136ccU, 0x0a271325U, 0x00e6fd03U, 0x22fe15fbU, 0xf340fd14U, 0xf232c215U,
+  0x01cc000fU, 0x1cec0007U, 0xf55200cfU, 0xb93100e1U, 0xf2fefcf9U, 0x07e60110U, 0x1beb2af0U, 0x27051319U,
+  0xeeff1300U, 0xd112e100U, 0x0f50f100U, 0xee3bf700U, 0x003febdeU, 0x000904d8U, 0x00940bdeU, 0x00ded6dfU,
+  0xd2042110U, 0xc72124e8U, 0x67f6a7f8U, 0x3f05c7b0U, 0xfa11d0d5U, 0xc7330404U, 0x30ff36fdU, 0xc80f37ceU,
+  0x09efd6f6U, 0xf3a014feU, 0xe41e14dfU, 0x192b1c21U, 0x28d7e905U, 0x38e71008U, 0xf515fe0eU, 0xf5509c0dU,
+  0x11dd0020U, 0x23ea0006U, 0xf72400b4U, 0xc82600e7U, 0xfa0714f2U, 0xf9cbfa00U, 0xfdf4f7fbU, 0x0f262e38U,
+  0xebec0800U, 0xfcfbc700U, 0x0738c900U, 0xdf261600U, 0x0046cafbU, 0x002410fbU, 0x00c2f807U, 0x00e3bcbeU,
+  0xd3081c0eU, 0xaf200df7U, 0x0ee508e4U, 0x2f34dce1U, 0x0524fadeU, 0xbc330114U, 0x0ac953f6U, 0xd11e38b2U,
+  0xfadfe1e9U, 0x22a7050fU, 0x0c0ddedcU, 0xf9f50a07U, 0x0fe5f1f1U, 0x42e4f911U, 0x183d050bU, 0xe24dc0d0U,
+  0xffc80015U, 0x1915000bU, 0x07f100ccU, 0x1de000adU, 0x05051bf4U, 0x0bf5030dU, 0x23040bf4U, 0xfd4614f7U,
+  0xfce01a00U, 0xf5e9d300U, 0xf619ce00U, 0x02e70400U, 0x0020e80eU, 0x0025fd18U, 0x00ca0be3U, 0x00e298d3U,
+  0xf1f614fbU, 0xa608f6feU, 0x040601d9U, 0x2115e0e7U, 0xf531eee5U, 0xcd35f114U, 0xe4ad18fbU, 0xd40130c1U,
+  0x06d7dfebU, 0x36dbfa2cU, 0xff2606f1U, 0xf6daf5faU, 0x0fc3ffe6U, 0x1fbeeff1U, 0x012a071eU, 0xf63ce7daU,
+  0xecf00020U, 0xdd0600f9U, 0x13f500bcU, 0x11e200c4U, 0xd1ecf2efU, 0x29c6f5dbU, 0x4c1e2512U, 0xdb38041bU,
+  0xfed33400U, 0x010f0400U, 0x030ce700U, 0x14e30600U, 0x001e051aU, 0x004dfd19U, 0x00f00ecfU, 0x00d103bbU,
+  0xf3ef0c18U, 0x9afd2602U, 0x162d01f3U, 0x4412e6c2U, 0xf82eccfcU, 0x0427ef03U, 0xf2c7f803U, 0xd6fb30e3U,
+  0x0af7df00U, 0x0be90a11U, 0x1321ec25U, 0x13c515dfU, 0xc9ce0fdaU, 0x4ba111eeU, 0x1b24142dU, 0x284fead7U,
+  0x06e7001eU, 0xe50500edU, 0x14fc00eaU, 0xc0f400e9U, 0xe609ee29U, 0xfcef1222U, 0x4013c6d4U, 0xdcf22112U,
+  0x03c01b00U, 0xf32df200U, 0xf252df00U, 0x18c5fd00U, 0x0038e012U, 0x00eeddfeU, 0x00f97c03U, 0x00d7e71dU,
+  0xea0b53ffU, 0xc2edeafbU, 0x3818b128U, 0x1801f2c2U, 0x0100ddfdU, 0xd1260ef9U, 0x02f0bde4U, 0x00df3bf2U,
+  0x08cb061aU, 0xfc99e017U, 0xc84a3decU, 0x185ece2dU, 0xffc313f8U, 0x2607120aU, 0xcfbe0f32U, 0x0c19eb0cU,
+  0x0eea0002U, 0xf2cb0008U, 0x1b2200f5U, 0xbdf100ebU, 0xdefc09f5U, 0x0fd71921U, 0x1e06e8b4U, 0x17162c05U,
+  0xf6db1f00U, 0xeef5e900U, 0xc953e100U, 0xf3f9fa00U, 0x004508edU, 0x0016e6e3U, 0x00d32a31U, 0x0002f629U,
+  0xc71133faU, 0xb80ffce4U, 0x1b0bb807U, 0x07f503ccU, 0xf705da06U, 0xce490316U, 0xf60bd4dcU, 0x05f4fadcU,
+  0x04bbdf25U, 0x079df405U, 0xfc48faf3U, 0xfe6acf11U, 0x25dcfff4U, 0x3afa0921U, 0xe2e80e34U, 0x24edef05U,
+  0x04e60010U, 0x39f0000aU, 0xfcdf00ccU, 0xcdd500e8U, 0xf904f6e2U, 0xf5f9f7faU, 0x0d15e2a5U, 0x4523153aU,
+  0x03f71f00U, 0x03ef0c00U, 0xc648e300U, 0xae0ff300U, 0x00561102U, 0x0014ed14U, 0x00bb3140U, 0x000b031fU,
+  0xdf082affU, 0xc0031717U, 0x1403d4edU, 0x01fefebcU, 0xec1dce0eU, 0xb0320216U, 0xeef3ebe4U, 0xf50fc0cbU,
+  0x04d3db13U, 0x20f6f905U, 0x001b05e5U, 0xf10b022dU, 0x22d705efU, 0x1ee40907U, 0x1222161bU, 0x2cc0d1f5U,
+  0xd3fd0018U, 0x07ec0019U, 0x10b900d2U, 0xebd100dfU, 0x0b04ddc4U, 0xfded0f21U, 0x420019bdU, 0x2525f627U,
+  0x03f12d00U, 0x32e01900U, 0xb9fd0900U, 0xccf9e800U, 0x002504fdU, 0x0008fe0cU, 0x00f03226U, 0x000e0313U,
+  0xe1112d03U, 0xf5191b10U, 0x1811defaU, 0xfa00e3e2U, 0x1924e70eU, 0x1423f206U, 0xd9c1dee8U, 0x1819d5d1U,
+  0x05e8b2ffU, 0x3514d33eU, 0xff27031aU, 0xebef1d0bU, 0xe19904faU, 0x13be06eaU, 0x24e714d4U, 0x10b6cf05U,
+  0xff3f0031U, 0xf4b60017U, 0x1abd00caU, 0x1d04009bU, 0xefd2c6f2U, 0x21e3e519U, 0x57f439d1U, 0xf9253006U,
+  0xe4e01c00U, 0x131c3800U, 0xf9cd1a00U, 0x12daf300U, 0x0029ffe4U, 0x00090f0eU, 0x00e422fdU, 0x00e432e6U,
+  0xe60813f9U, 0xd615530eU, 0xee2ccf1eU, 0x3e13e8ceU, 0x2d27e105U, 0x1322e722U, 0xccd10503U, 0xeac0f2d2U,
+  0xf8e6ffffU, 0x3913d246U, 0x0634cb21U, 0x03c81b23U, 0x9cc1ff00U, 0x2b811ac7U, 0x1df8e2e6U, 0x0c10ee05U,
+  0x05f9002cU, 0xdbff00f2U, 0x1dde00eeU, 0xe7c900feU, 0xd80e235dU, 0xfa0a01f3U, 0xc114dff2U, 0xc8a436e5U,
+  0x17bd2600U, 0xcc200700U, 0xeef5eb00U, 0x33cde500U, 0x002cdb13U, 0x00f7e610U, 0x00e84adaU, 0x0000edf5U,
+  0xef013affU, 0xc714ccf0U, 0x2d1dd11dU, 0x050fc1d9U, 0xf4ff0e0eU, 0xe10cf619U, 0xf2c1f11aU, 0xfcec37faU,
+  0x12ddee1dU, 0x2acbe613U, 0xdc51e7e9U, 0x0dd5cf0fU, 0x2e050ce9U, 0x05ec1d08U, 0xf7ca3ff3U, 0x1414bfe1U,
+  0x2dea0043U, 0x1aff0004U, 0x48d800f9U, 0x26ad0003U, 0xcbfd3b23U, 0x1fc50d17U, 0xd41bf6eeU, 0x3ab919eeU,
+  0xf0bc2900U, 0xe4121700U, 0xee1ddf00U, 0x47f8e500U, 0x0023e4d1U, 0x000ee201U, 0x00d266e7U, 0x00faf6e0U,
+  0xd8082cf5U, 0xd529e4dcU, 0x2f0df318U, 0x0914f6e0U, 0xe710252bU, 0xc208e334U, 0xf0dbd717U, 0xe6ff2ce5U,
+  0xf5cec110U, 0x0fc5ee31U, 0xff66c1f6U, 0x31cecc00U, 0x200b04f9U, 0xf2011709U, 0x08ef3ff8U, 0x1d09f4faU,
+  0x180a003dU, 0x190d0024U, 0x3dc400e2U, 0x28c60000U, 0xc4ea0df2U, 0x18d70e06U, 0xf0efffccU, 0x12f80306U,
+  0x09a90f00U, 0xe71a3e00U, 0xc4060100U, 0x30f21900U, 0x000f0dcbU, 0x00faf4faU, 0x00d644ebU, 0x00fec107U,
+  0x04160f12U, 0x052d0a08U, 0x0711fd1cU, 0xfcf1f425U, 0xfa0c3426U, 0xdd05dd1eU, 0xdaf2cd1dU, 0x0021fbe4U,
+  0xfb0bdc16U, 0x2607d829U, 0xf24bb923U, 0x1608c534U, 0x071f2602U, 0xd9fa18ecU, 0xdef04015U, 0x1ecd05e9U,
+  0xf22c002fU, 0xf0f70029U, 0x23a700f5U, 0x11fa00daU, 0xcdffd6faU, 0xf6bf07faU, 0xe9fa03ceU, 0xf721ff00U,
+  0x31ce1200U, 0x0bf12e00U, 0xf5ff3200U, 0x13072800U, 0x0013e6bfU, 0x0006e218U, 0x00ed1c12U, 0x00caf300U,
+  0x05080e1eU, 0xff3f0d13U, 0x010af22bU, 0x21efe72aU, 0xf2241e15U, 0x0bf8d9f9U, 0xefe6fb17U, 0x13091408U,
+  0xff02f0fcU, 0x32efd129U, 0xf629d226U, 0x1818af15U, 0xe52234ebU, 0xf0bc1eceU, 0x16e918d8U, 0x33cc01ceU,
+  0xdc3c0016U, 0xf99e0009U, 0x0fb600efU, 0xf5f400baU, 0xde0ee528U, 0x0b0ddee9U, 0xeff516ceU, 0x070c06c9U,
+  0x0401f800U, 0xf7255300U, 0xfdee2900U, 0xf4ea1600U, 0x0036f8c4U, 0x000ff515U, 0x00e4ecbcU, 0x00d908dbU,
+  0xf1fffe1dU, 0x144b331cU, 0x3a0be040U, 0xf704f6f9U, 0x004709f6U, 0x0529bf24U, 0xf5f5fe0eU, 0xf8d9fcffU,
+  0x12ea0b0cU, 0x2026f235U, 0x023edde0U, 0xe821c3f2U, 0xc5010f0aU, 0xd78407c3U, 0xee0ce1d1U, 0x34def4eeU,
+  0xd9490018U, 0xf02700d9U, 0x0adc00e3U, 0x00ec0040U, 0x1cc25c35U, 0x02f2d30bU, 0xa102d3edU, 0xe7ec1ad5U,
+  0x0d812300U, 0xee131800U, 0xfb1fff00U, 0xed03f200U, 0x0039bf2aU, 0x00ea1f12U, 0x0003fbb6U, 0x00cd0bcfU,
+  0x01ff0ff7U, 0xe12bc9e4U, 0xfefac202U, 0xff06d6f5U, 0xec313cf6U, 0xf420ff07U, 0xfe15e608U, 0xebd236f9U,
+  0x36f93020U, 0x14fa0f09U, 0xf3fdd1f2U, 0x01c5efdfU, 0x1a55f00fU, 0xf9f8fe00U, 0xfaf417d4U, 0x25df0efcU,
+  0xce150035U, 0xff0a0004U, 0x1dd4000cU, 0x25da00f6U, 0xe8e1542aU, 0xedf4020aU, 0xf6ff0105U, 0x46bf19deU,
+  0xecb11a00U, 0xf6f03700U, 0x0acaf000U, 0x1234bc00U, 0x0032a027U, 0x00e3080aU, 0x00f9f7a1U, 0x00c807b6U,
+  0x060d13f8U, 0xdf3ae3daU, 0x4903be0cU, 0xf4e9e4e3U, 0xdf33310cU, 0xfd06d929U, 0xbe08060eU, 0xd8fc43f2U,
+  0x2bfc2637U, 0xf8e30e39U, 0x20f2b228U, 0x17a9c1d6U, 0xf643f5f6U, 0xe4f419e2U, 0x09f847e3U, 0x0002061aU,
+  0xee1f0044U, 0x112a00f9U, 0x2ead00f1U, 0x70de00ceU, 0xe1d85118U, 0x120729ccU, 0xd10915e3U, 0x31ebe1e3U,
+  0x0ef70000U, 0xf4063700U, 0x3fe22700U, 0xfc31ec00U, 0x002dc211U, 0x00f4e30aU, 0x00e816a6U, 0x00bd08c6U,
+  0x2715fffcU, 0xf147e210U, 0x332cf42dU, 0x0fe1fbfcU, 0xf81a470fU, 0x0e23c418U, 0xb015f50cU, 0xda301ce7U,
+  0x13e53e15U, 0x16fcf40fU, 0x1a21a910U, 0x1dc6cefaU, 0xf55de6fdU, 0xb5e618fcU, 0xd3fc09ffU, 0x0cf21406U,
+  0xea38002bU, 0x0af600fdU, 0x0d9400e1U, 0x5aed00c8U, 0xf812341eU, 0x150916aeU, 0xce16f7daU, 0x04ffc5dcU,
+  0x34deed00U, 0xe51b3400U, 0x02004c00U, 0x062e0500U, 0x005fe0efU, 0x0011d7e5U, 0x00ed0aacU, 0x00cc1cc0U,
+  0x28eb12fcU, 0xfd39f52aU, 0x4948ec51U, 0x25e4e812U, 0x03ec37f1U, 0x1130a7fbU, 0xc91de3faU, 0xdb231105U,
+  0x0aef60f4U, 0x36fc1005U, 0x0e37d605U, 0x1be8e1e7U, 0xdd4f0801U, 0xbda30efaU, 0xeed0f107U, 0x040b070cU,
+  0xb7390008U, 0xfed100deU, 0x27bf00d6U, 0x0b1600e6U, 0xf30a2d1fU, 0x2f11e7f4U, 0xb710f1e9U, 0xf5e9e2e8U,
+  0x03dfee00U, 0x02304000U, 0x06034000U, 0x01ee1a00U, 0x0063ea30U, 0x000022d2U, 0x00e2fcb8U, 0x00f4f3e7U,
+  0x28fb1902U, 0x113eff2dU, 0x5940ee2dU, 0xfcdd0302U, 0x080e0de2U, 0xe218e014U, 0xd3050610U, 0xe6fcfffeU,
+  0x1bfb2f14U, 0x2019152aU, 0x0925e6f1U, 0xf3fcf5e5U, 0xe42cfa07U, 0xc3a1f1e8U, 0xcbdcf6d2U, 0x0e0f09edU,
+  0x0afc0016U, 0x07060008U, 0x1f13000eU, 0xdbdd0052U, 0xff13fde7U, 0x1e0c0106U, 0x22f3fd08U, 0xff1000dcU,
+  0xff181500U, 0x0319ea00U, 0xf911fc00U, 0x042c1f00U, 0x00151bf5U, 0x00ebebf7U, 0x00fb350fU, 0x0016221cU,
+  0x0010f42bU, 0x04000300U, 0xfb2a2af5U, 0xf0011534U, 0x0503dc00U, 0xfd3e31e8U, 0x0300f91fU, 0x05280cedU,
+  0x0608091aU, 0xe9ea09f2U, 0xf2310b13U, 0x3de5dc20U, 0xfefcf800U, 0x180916feU, 0xf9e3060bU, 0x05db01fdU,
+  0x190a0006U, 0x01e1001dU, 0x1b110018U, 0x14ea0062U, 0xe63f1cfbU, 0x2eddf801U, 0x24d2f2f6U, 0x22f4f2e6U,
+  0x032e2500U, 0xe60cdc00U, 0xed070600U, 0xf1e94a00U, 0x00f034edU, 0x00f0e7d9U, 0x00ec2336U, 0x001d182dU,
+  0x16feef25U, 0xf01114f1U, 0xe91d2c0aU, 0xf7021e0eU, 0x03d7010eU, 0xdd5138e6U, 0x1a120a0fU, 0xfb26e9e5U,
+  0x09fdfe0eU, 0x01d302e1U, 0x1017f809U, 0x2f0cca0bU, 0xfc0ce1fdU, 0x460815feU, 0x17d21d02U, 0x2bd4dcedU,
+  0x212e00e7U, 0x04d10040U, 0x213b002eU, 0x2e080057U, 0xe63f1312U, 0x22c4ff01U, 0x40cde3e1U, 0x02eaefefU,
+  0xe91c0c00U, 0xf11db400U, 0xe2273100U, 0xf7ca6700U, 0x000124ebU, 0x0007e71fU, 0x00fa2814U, 0x001f0635U,
+  0x0509fe2aU, 0xdafc1ce8U, 0xdafc0d1bU, 0xf7f903e0U, 0x18dad80bU, 0xdb3237e7U, 0x111cf925U, 0x0206dff7U,
+  0xe8000403U, 0x0ec1f4e2U, 0x1722f906U, 0x34ffe6f7U, 0x131de816U, 0x5ddd1407U, 0x11e0180bU, 0x13d0dbdbU,
+  0x163700dcU, 0xd1b60048U, 0x23440014U, 0x25ee001aU, 0x12260b16U, 0x2bac080aU, 0x1dd3ecf3U, 0xe5eff8f1U,
+  0x03290100U, 0x0a00ad00U, 0xdf103e00U, 0xf2dd4200U, 0x00f127eaU, 0x00ff0642U, 0x000d0e1eU, 0x001d1045U,
+  0x011a0609U, 0xb71d1b16U, 0xc9f5fcfeU, 0x03f526f6U, 0x0abefa00U, 0xe40e27f4U, 0x1915eb18U, 0x14f5f9ecU,
+  0xef1404f5U, 0x0dd805f2U, 0x132a052fU, 0x07090ff3U, 0x1b19e61cU, 0x3ae3e104U, 0xddeefd0eU, 0xfbced7b6U,
+  0x293a00f0U, 0xafc80017U, 0x271e0009U, 0x13d90014U, 0x2bf41201U, 0x49c605f4U, 0x02fa03f4U, 0xd3def8edU,
+  0xefd90100U, 0x0cffcf00U, 0xe2031900U, 0xd6d22800U, 0x0010e402U, 0x00fbfb53U, 0x00fc0c0eU, 0x0034ff3aU,
+  0x10371401U, 0xa2242ef1U, 0xe8faf311U, 0xe9fffdf6U, 0x04d00effU, 0x201329f8U, 0x15fef30cU, 0xf70adbf0U,
+  0xf12ddf0eU, 0xe8e3ffd4U, 0x0c14f914U, 0xfe1c0ff9U, 0xf826f323U, 0x1bddfa16U, 0xe3fe00ffU, 0xadc9c8dfU,
+  0x03ff002fU, 0xffe10012U, 0x25ef00fdU, 0x150b003eU, 0xf71004e3U, 0x1d1509dcU, 0x280302f2U, 0xfad3eaf4U,
+  0xf5ea2600U, 0x070cd700U, 0xfac6fd00U, 0x03dd4b00U, 0x004a1813U, 0x00182df8U, 0x00d93519U, 0x00011c38U,
+  0xf71c2b41U, 0xf6fd0c15U, 0xfb2a0ae6U, 0xd80c03f0U, 0x1d0de302U, 0xee2910e9U, 0x1700f915U, 0x1631fd1cU,
+  0xfff11a19U, 0xf2eed8e2U, 0x140bf70bU, 0x390adc34U, 0xe4e2180cU, 0x20174810U, 0x07d0f403U, 0x28efe8f2U,
+  0x1e0a0025U, 0x1ad10027U, 0x2e0600f9U, 0x28070052U, 0xee3cf709U, 0x00dbe1f6U, 0x19fbf0e7U, 0x0ee5f31bU,
+  0x05c51600U, 0xe5100e00U, 0x04dd0c00U, 0xfbd75b00U, 0x00241e20U, 0x001e1b1cU, 0x0000331cU, 0x000a1d1cU,
+  0xfd16fd0aU, 0xe9e93804U, 0xe70718f6U, 0xaef71ce3U, 0x40efeafeU, 0xba29ff07U, 0x0afbeb2eU, 0xdd04fb28U,
+  0xf3d1fd05U, 0x06e7cdf5U, 0x1a1fc415U, 0x2616c513U, 0xf00d0a0fU, 0x30f83efdU, 0xebd1fff4U, 0x2aea1508U,
+  0x202700ddU, 0x05eb002cU, 0x263500f5U, 0x23fc004eU, 0xeb2edf08U, 0xf4c8d8f3U, 0x09dbd2e4U, 0x09300ee5U,
+  0x23d7ef00U, 0xdc160b00U, 0xe9ea2d00U, 0x2cd93c00U, 0x000e23fcU, 0x00311e2dU, 0x00082a0aU, 0x00f92218U,
+  0xe8e6f115U, 0x13db3002U, 0x07fa06ebU, 0xee1805e8U, 0x3fe8fbfeU, 0xb218dbebU, 0xe304d117U, 0xe5f129faU,
+  0xeee101e7U, 0x0d42d0edU, 0x182dd910U, 0x0913a716U, 0xeaff0e15U, 0xf5d9fd0cU, 0xcce20707U, 0x0af735faU,
+  0x0e530013U, 0x00ee0033U, 0x11340003U, 0x19030015U, 0xea11f5f6U, 0x16cbfc0fU, 0xf7d9de00U, 0x1503dc02U,
+  0x2f02f600U, 0x02f31400U, 0xebe00900U, 0x47021a00U, 0x000a20e0U, 0x00f21e24U, 0x00161004U, 0x00fe03f4U,
+  0xf518f813U, 0x08fb1cf9U, 0x08100afbU, 0x0a3a1af5U, 0x13d0fa08U, 0xf413f5fcU, 0xe5f6ef0cU, 0xf33c10f6U,
+  0xea1ee8d5U, 0x0b46d104U, 0x1f3bef05U, 0xee07ecfcU, 0xf2100d27U, 0xffcce7deU, 0xd5fc0d19U, 0xea061dd3U,
+  0x064000f4U, 0xace600fbU, 0x1b44001dU, 0xf71f00fbU, 0x1dff22dfU, 0x65dff8f4U, 0xfaf412e6U, 0x1bcde6f5U,
+  0xfaf7f300U, 0xfe061000U, 0xef01fc00U, 0x03e5e900U, 0x002d0d12U, 0x00dbf945U, 0x000bf902U, 0x00330606U,
+  0x030a2c2aU, 0xc4d42af9U, 0x0618fe17U, 0xee34f7f1U, 0xffaa28f9U, 0x1e251b2fU, 0xf6f1f106U, 0xe71ffdfaU,
+  0xef43b3e6U, 0xf929dae0U, 0xfa2ed80fU, 0xe2e219d5U, 0x0b431efbU, 0x26ac0cf5U, 0xe90c1016U, 0xc9f81d15U,
+  0x26030023U, 0x2dee00efU, 0x470000f1U, 0x2b070014U, 0xe71d0ff3U, 0x051ad8cfU, 0xf309d2e7U, 0xdcbc0410U,
+  0x14f42300U, 0x06d5f300U, 0x02ccff00U, 0x06fb3900U, 0x00d0fd26U, 0x001a7900U, 0x00134200U, 0x00b80805U,
+  0xe42b0c42U, 0x0de05027U, 0x07192bf4U, 0xcc06bcedU, 0x1a1105ffU, 0xe6d11c2bU, 0x25eae830U, 0xfe271127U,
+  0xedddfcf1U, 0x263604ebU, 0xf5f0e4e6U, 0x53e4e00bU, 0x1f1b1102U, 0x14e82f15U, 0xf2c506e6U, 0x0d1dd0f9U,
+  0x24f30018U, 0x5d070000U, 0x1a2a0001U, 0x1cdf0012U, 0xd04fff46U, 0xf605d602U, 0x0007daf3U, 0xe5e8142dU,
+  0x1fe30900U, 0x01e82900U, 0xfde00a00U, 0x28ed0f00U, 0x00bafd05U, 0x00216021U, 0x000857e5U, 0x00d815d2U,
+  0xfcfbf326U, 0x31ff4317U, 0x0a0222e2U, 0xd60f09f6U, 0x2e080beeU, 0xb7e10821U, 0xfde6ea4eU, 0xfd114114U,
+  0xd20f14f2U, 0x0044db1cU, 0xfaf9f1e2U, 0x12fae1fdU, 0xf72504f0U, 0x17e83611U, 0xe1f316ecU, 0xef12ddf6U,
+  0x0e0b0003U, 0x4526001cU, 0x161700f2U, 0x050f0044U, 0xb2030834U, 0x070ff2e5U, 0x09fd0c0fU, 0xdce32afbU,
+  0x42dd0900U, 0xdbd43300U, 0xd7d9f500U, 0x3abdf700U, 0x00f527f3U, 0x001e341cU, 0x001b39faU, 0x00dcf0dcU,
+  0x06bc1338U, 0x4c14181aU, 0x06151dbbU, 0x060c2734U, 0xfae2f504U, 0xb90fe4f3U, 0xfde9db24U, 0xfe0a4506U,
+  0xca1c11d9U, 0xfd3506faU, 0x010df2ecU, 0xe329e9e3U, 0xcd0703ddU, 0xdcd81306U, 0xb8172909U, 0x0b2cfbfbU,
+  0x04eb004dU, 0x0e2900f6U, 0x13f7000cU, 0xfcf90021U, 0xded9f0f6U, 0x24ec1910U, 0x030b20f9U, 0xd30cf315U,
+  0x41e63a00U, 0xffcb5100U, 0xdde4ee00U, 0x40f8e400U, 0x00fc3905U, 0x0002e6d9U, 0x001c10f2U, 0x0003daddU,
+  0x15dc2f56U, 0x0017e009U, 0x132118e5U, 0x2e0543f7U, 0xe0f03bf9U, 0xecfedf17U, 0xf2d61b02U, 0x2c1859f4U,
+  0xdc2be0b4U, 0x1621f8e4U, 0x0223e3e6U, 0xcf0324d5U, 0xe30d05efU, 0xc711f308U, 0xd60b1703U, 0x0a512a32U,
+  0xfcdd0007U, 0xf8ff00d2U, 0x2323000cU, 0xe52200daU, 0xfae40eebU, 0x2211f803U, 0x0d1f19edU, 0xf8e3df39U,
+  0xf3d54c00U, 0xf1ec2700U, 0x00edf400U, 0x46faea00U, 0x00121810U, 0x00f2e0cdU, 0x00340bedU, 0x002beac9U,
+  0x20f55626U, 0x1dd5d5f2U, 0x0f22343bU, 0x2af905d4U, 0xbec95dfaU, 0x132ee63aU, 0xd5d22aeaU, 0x010225e6U,
+  0xf16e91cbU, 0x1a26e1e5U, 0xf630d1f6U, 0xdcad35f3U, 0xda2f0dc6U, 0xc6f8ff27U, 0x031c170fU, 0xf0391a3fU,
+  0x270d00fcU, 0x22f400e1U, 0x43e500e9U, 0x0b130005U, 0x31f739fdU, 0x1eebfdfbU, 0xb312fa0dU, 0xea9d13fdU,
+  0xffff2200U, 0x0eda1a00U, 0x28f7e600U, 0x08001400U, 0x009d1716U, 0x002e12f8U, 0x0012000bU, 0x00badffcU,
+  0xeffcbff5U, 0xfc1111fcU, 0x01041a11U, 0xbffdb7f8U, 0x1d210718U, 0x04e33d22U, 0x1bea2601U, 0xec2e0517U,
+  0xf8d20bcbU, 0x172bda18U, 0xe9efc3fbU, 0x27c2fdf0U, 0x182ab81eU, 0x0d01e612U, 0xf6f301d0U, 0xf111c014U,
+  0x2dd900eaU, 0x2b0c0010U, 0xf1fc00efU, 0x16ed0006U, 0xeded0000U, 0x0104ed10U, 0xc0f1f303U, 0x02813019U,
+  0x200cfc00U, 0xe6c71200U, 0xf721d700U, 0x2f08f000U, 0x00b4180aU, 0x00291211U, 0x00090619U, 0x00cdddceU,
+  0xe8ecde07U, 0xf61520ddU, 0xd7e62df9U, 0xe315dceaU, 0x28fb15e5U, 0x19e53fffU, 0xfbf80bffU, 0xd11d3decU,
+  0xe3f2f7ccU, 0x1818e22aU, 0x03eae8efU, 0x1cccfe0fU, 0xde28c717U, 0xf209e119U, 0x121904e6U, 0xde1ab7d2U,
+  0x49d600eaU, 0x1a04001aU, 0xf5f00011U, 0x101100faU, 0xfbde04ccU, 0xffd027faU, 0xfae2040bU, 0x20bc4b32U,
+  0x3efce000U, 0xf381f000U, 0xf2f9d700U, 0x2312fc00U, 0x00ef3fc9U, 0x0015d505U, 0x001ef51fU, 0x00e0d6c6U,
+  0x45dbe70cU, 0xd0f41dd9U, 0xe0f14cf1U, 0xe30502eeU, 0xfad805fbU, 0x10eb00e6U, 0xeff30be2U, 0xde2844d2U,
+  0xc4f1efb8U, 0x1a1a051bU, 0x03f910fbU, 0x16f7f7ebU, 0xc142ccc7U, 0xf30cd01dU, 0x1b0d10e4U, 0xd324e1eeU,
+  0x4ac800ccU, 0xf60100e3U, 0x01ee0019U, 0xeb1c00fdU, 0x0cd5f0f4U, 0x20e4f901U, 0x0af316fcU, 0x24ee434eU,
+  0x3fdf1900U, 0x1ea20d00U, 0x2bdfe200U, 0x43e0dc00U, 0x00ee17b9U, 0x0023e5d5U, 0x00250d19U, 0x000a06c9U,
+  0x49040827U, 0xf3011cbcU, 0xf30e3929U, 0xfeec1c02U, 0xd0ce27efU, 0x0100f7ebU, 0xeaca23fcU, 0xedf747dbU,
+  0xdb1ce1b3U, 0x100637f5U, 0xf10bfdf6U, 0xf4ec24dfU, 0xbc19e1c4U, 0xba20f72bU, 0x1c1210d6U, 0xac4d1211U,
+  0x2fca0099U, 0x0ff300d0U, 0xfd010012U, 0x171200e8U, 0x0f1ef202U, 0x12e5fcdbU, 0x21f70f1bU, 0x17f91a05U,
+  0x0fc61600U, 0x04ca1c00U, 0x31dcf000U, 0x2ee09c00U, 0x00ff1f95U, 0x001cf990U, 0x002c1306U, 0x00271cb6U,
+  0x781509beU, 0x1414f8b5U, 0x0f0b3244U, 0x1c09efa6U, 0xdbc62c07U, 0xf61fe6faU, 0xdfc436e6U, 0x13c419d2U,
+  0xfa48d3e4U, 0x23e709faU, 0xfd19ddf3U, 0xf29346f5U, 0xa738f4e1U, 0xadf2f502U, 0x0b2cf8eaU, 0xe7141b29U,
+  0x0227001bU, 0x16f700edU, 0xfae700f1U, 0xe2ed0045U, 0x5dc8f1fcU, 0xf5cb142aU, 0x81031c10U, 0x0cd6d5c7U,
+  0x050b1a00U, 0x08e00a00U, 0x10ecf000U, 0xf3120e00U, 0x00d8f7e8U, 0x0022d8fdU, 0x000bccffU, 0x00f1331eU,
+  0xdaedf612U, 0xe608f008U, 0x1f01f110U, 0xd1fdfb10U, 0xef12e80dU, 0x14083a00U, 0x03113cf7U, 0xd932e1e8U,
+  0xfbcf18d2U, 0x36e7d71bU, 0x0aeee906U, 0x10e90ef3U, 0xfb19f524U, 0xd323d21cU, 0xf138f3f1U, 0xece8f20dU,
+  0xf01400f3U, 0xf8020009U, 0xeee300fdU, 0x031100ffU, 0x4bb016f2U, 0x26ca1b38U, 0xaffbea12U, 0x3fc1ddfaU,
+  0x02220000U, 0x08ea1b00U, 0x3c19f500U, 0x11db0c00U, 0x0003e0d6U, 0x0002e115U, 0x0007de11U, 0x00f319e9U,
+  0xcd4cf80aU, 0x9d1c0ff2U, 0xeefa012aU, 0xf740eaf6U, 0xfa11e0fcU, 0x290145daU, 0x0a1043dfU, 0xc04dfcd4U,
+  0xf4ce2cbaU, 0x30efcb22U, 0x0403cb02U, 0x21d9160bU, 0xdc1a0d38U, 0xf735cc36U, 0x0813f8edU, 0xf400d816U,
+  0x252500e2U, 0xf31f0028U, 0xe6ef0016U, 0x1b5500d6U, 0x6ed80ac9U, 0x1eba0731U, 0xedcfe911U, 0x5deddf2cU,
+  0x193cc700U, 0x09c5d900U, 0x37130100U, 0x56d1d700U, 0x001ce9a1U, 0x0015f92aU, 0x0008ec10U, 0x0011febcU,
+  0x074ce5daU, 0xba0ef9e8U, 0xdae41638U, 0xf5320dd7U, 0xdbfcf5efU, 0x32ff30f2U, 0x010034e2U, 0xaa4e06c6U,
+  0xf8c51cd4U, 0x0adfe30eU, 0xfefd0208U, 0x18df21f2U, 0xb91ff414U, 0xf635d320U, 0x1927f503U, 0xac15f3f9U,
+  0x450900d4U, 0x0f150017U, 0xfae80012U, 0x1c0d00deU, 0x7bee1eceU, 0x53d204ecU, 0x05e1fcf7U, 0x69f10415U,
+  0x2df1b300U, 0x21ddb800U, 0x2bfc0900U, 0x28a88f00U, 0x001dc581U, 0x0029fff3U, 0x0009180dU, 0x000ff6b0U,
+  0x3733f6d1U, 0xe72006d1U, 0x130c1036U, 0x1a3c12d5U, 0xd2ede7faU, 0x0ef4f6faU, 0xe4d433f5U, 0xaf09f4c5U,
+  0x09ff3ad6U, 0x03b71dfdU, 0x0411020bU, 0x1de02df2U, 0x8f180304U, 0xca1b0521U, 0x1720ffedU, 0xb303f802U,
+  0x17e300c7U, 0x33ff000aU, 0xf9fe0016U, 0x70ea00edU, 0x480a0ff1U, 0x38f60af0U, 0x14f80c0fU, 0x78ef09f6U,
+  0x10cfc100U, 0xfde3cf00U, 0x0cf20900U, 0xe8b89f00U, 0x00181193U, 0x0009f9b3U, 0x000b0c15U, 0x0000ccb2U,
+  0x223404bdU, 0x031c0fccU, 0xfb081311U, 0x073216caU, 0xcfe70405U, 0xd6fbfcdbU, 0xe9e61408U, 0x94e30eceU,
+  0x1be50f04U, 0x15be140cU, 0x05f6eefeU, 0x08a20df4U, 0xc91300feU, 0xc8f9010aU, 0xf72607d8U, 0x10e7050aU,
+};
+#elif APP_KERNEL_DENSE == KERNEL_DENSE_SPARSE
+// gemm_5 block-sparse, 5200 of 6400 blocks kept, see kernel_weights.h
+const uint8_t kernel_gemm_5_sparse_rows[128] = {
+  0, 2, 3, 5, 6, 7, 11, 12, 13, 14, 17, 18, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 32, 34, 35, 36, 37, 38, 39, 41, 42,
+  43, 45, 47, 48, 49, 50, 51, 52, 55, 56, 57, 58, 60, 61, 62, 63,
+  64, 65, 66, 68, 69, 70, 72, 73, 75, 76, 77, 78, 79, 80, 81, 82,
+  84, 85, 86, 87, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100,
+  101, 102, 105, 106, 108, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+  122, 123, 124, 125, 126, 127, 1, 4, 8, 9, 10, 15, 16, 19, 31, 33,
+  40, 44, 46, 53, 54, 59, 67, 71, 74, 83, 88, 103, 104, 107, 109, 110,
+};
+
+const uint16_t kernel_gemm_5_sparse_ptr[33] = {
+  0, 200, 400, 600, 800, 1000, 1200, 1400, 1600, 1800, 2000, 2200, 2400, 2600, 2800, 3000,
+  3200, 3400, 3600, 3800, 4000, 4200, 4400, 4600, 4800, 5000, 5200, 5200, 5200, 5200, 5200, 5200,
+  5200,
+};
+
+const uint8_t kernel_gemm_5_sparse_cols[5200] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+  168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+};
+
+const uint32_t kernel_gemm_5_sparse[20800] __attribute__((aligned(16), section(".ai_weights"))) = {
+  0x09ec00e0U, 0x25110014U, 0xf70700d7U, 0x0cff00e5U, 0x030efe35U, 0x14f20af6U, 0xf6f00404U, 0xf8e705efU,
+  0xf208dd00U, 0x05030700U, 0x07ca1700U, 0x05fdea00U, 0x00dde8e6U, 0x003a0529U, 0x0021d4ffU, 0x00e7c6eaU,
+  0x05f8febfU, 0x0b1e2311U, 0x03fde9dfU, 0x08f8deeeU, 0xff0a35ffU, 0x05044004U, 0xfe1337e0U, 0xfc0c16d6U,
+  0x0efef1f9U, 0x1909f0e3U, 0x31d8151eU, 0x01d803c8U, 0x03070603U, 0x20290703U, 0x1410e2fdU, 0x071cfb05U,
+  0xe9a300f7U, 0x2103000fU, 0x192f00b7U, 0xfc0600e8U, 0x041eeb4aU, 0x0cdf02f8U, 0xf8c420eaU, 0x12cf16f1U,
+  0x1bffb600U, 0xfceaf800U, 0x06b00a00U, 0xf91dcd00U, 0x00e5bd05U, 0x0031ff36U, 0x003cd1fdU, 0x0004d7d2U,
+  0x13ed30d7U, 0x2cfc262bU, 0xed1d14b2U, 0x0b04f7faU, 0x0b0c27fbU, 0x17243bdfU, 0xd00454fcU, 0xd4453ed5U,
+  0x0cf9f311U, 0x0822fadaU, 0x50b70405U, 0xe5cf1bceU, 0x3c152ff7U, 0x444efe00U, 0x32330e08U, 0x3222fc1aU,
+  0xec990005U, 0x05e800f8U, 0x302800e2U, 0x0bf800efU, 0x0b14d246U, 0x18e4f5c9U, 0x189c1ee1U, 0x21be17ebU,
+  0x17f9af00U, 0x0ff4e800U, 0x11b3ce00U, 0xda0da900U, 0x001dc608U, 0x00e80026U, 0x0020c608U, 0x000a00e5U,
+  0x11e82ae9U, 0x71df1307U, 0xd22206ceU, 0xdf2ef4f5U, 0x22072af1U, 0x08014be1U, 0xc51e1d16U, 0xa65d31dfU,
+  0x110d0223U, 0x0a3921efU, 0x33940109U, 0x0dc232daU, 0x2b011214U, 0x4155e304U, 0x353a0c01U, 0x5013ef24U,
+  0xf2ab000dU, 0x02fa00deU, 0x3dfa0026U, 0xe6040003U, 0xff12ea26U, 0xf3eaf2c3U, 0x26cafd12U, 0x32bf0de2U,
+  0x1006be00U, 0x25fafa00U, 0xecc4e400U, 0xef0ecb00U, 0x0005f00aU, 0x00c5f441U, 0x002801fdU, 0x001a0e21U,
+  0x15e8230aU, 0x59dcd1f3U, 0xc0221ce5U, 0xf546dee3U, 0x3a07110eU, 0x1dfb12fcU, 0xc9ef1c08U, 0xbd4a19fdU,
+  0xf91eff1cU, 0xf44123edU, 0x22a4f405U, 0x12bc1cdbU, 0x2bdce4efU, 0x1143f825U, 0x1ef7f4f7U, 0x29ee0116U,
+  0x00a2000dU, 0xfef400daU, 0x39f20013U, 0xdcf40025U, 0x161e0306U, 0xf32afbf7U, 0x2ee3fcf7U, 0x3fcafdebU,
+  0x1205dd00U, 0xfa14f700U, 0xe80ee300U, 0xfffec700U, 0x00ee041fU, 0x00e5ff21U, 0x00271dd4U, 0x002b051aU,
+  0x15ec2012U, 0x2bdfc2daU, 0xeb280507U, 0xd42ddcd7U, 0x2f040706U, 0x262f0c05U, 0xeae8fb03U, 0xfb331307U,
+  0xf730122bU, 0x065a3403U, 0x0cafe3fcU, 0xf9c333deU, 0xf8e1fc24U, 0xe818e526U, 0x0de72c18U, 0x20d4ef14U,
+  0xe1ed00dcU, 0x1b160022U, 0xf05300dcU, 0x020300feU, 0x0b05ff12U, 0x23ff0eefU, 0xfddf310aU, 0xfffc14d3U,
+  0xf5e8f500U, 0x081e0c00U, 0x06101100U, 0xfb4dda00U, 0x00f0dbefU, 0x0039f518U, 0x0013c2f2U, 0x000bf5d4U,
+  0xfffaecc0U, 0x272c151cU, 0x2601d3e0U, 0x2beee612U, 0xf81e21ebU, 0xf00f34e1U, 0xea052ceeU, 0xc5120ce1U,
+  0x14e9dd14U, 0x0924f103U, 0x0fed0a00U, 0xe9e7fcaeU, 0x0cf6e0f6U, 0x31340408U, 0x264eecffU, 0xfb15270bU,
+  0xd8d100f4U, 0x341300ffU, 0xe45f00b5U, 0x0c0000faU, 0xfb2dfb0cU, 0x1ee818e8U, 0x06de4b02U, 0x0ccf08efU,
+  0x04f4fd00U, 0x02080d00U, 0x0e01ed00U, 0xe62ece00U, 0x00f8be08U, 0x000cf126U, 0x001cb7c9U, 0x001802deU,
+  0x301413ddU, 0x3e0be944U, 0x170deee9U, 0x15fbf717U, 0x0a2e33feU, 0xfb124ac7U, 0xab1d2200U, 0xd66a43eaU,
+  0x0be0d91dU, 0x0e350219U, 0x24ca10e7U, 0xe9f411bbU, 0x3e0204d8U, 0x093cf40fU, 0x3846e607U, 0x18161322U,
+  0x07ca00d6U, 0x0c1a00bdU, 0x100300e3U, 0x23fc00ecU, 0x0a21be35U, 0xf71913e9U, 0x1dcf3cf0U, 0x04b5eff4U,
+  0x0214f900U, 0x2b0bfa00U, 0x12b8d100U, 0xd403d800U, 0x0015bedeU, 0x00d5f51aU, 0x0010ddcfU, 0x00061f00U,
+  0x020e23ebU, 0x5d00cc2fU, 0xdcfff0f5U, 0xf6e7e3f5U, 0xf83d06f7U, 0xeefe13e3U, 0x8d181521U, 0xc06622edU,
+  0xfbdbfc2eU, 0x06122513U, 0x448101e6U, 0x14c43abbU, 0x2feeeef8U, 0xf3530b1aU, 0x3c220a00U, 0x230bfc2fU,
+  0xfcae000eU, 0xe11300a4U, 0x37080016U, 0x110f0009U, 0xee2dd02bU, 0xd42ff7feU, 0x1b0821bfU, 0xffc80ae7U,
+  0x111b0b00U, 0x09060800U, 0x0ec5e500U, 0xfc1b0100U, 0x00e3eac9U, 0x00ca03e8U, 0x0011fde4U, 0x0004351fU,
+  0xed01ee21U, 0x44d8adeaU, 0xe21207f2U, 0x02e1c6f2U, 0x0f11f314U, 0x030ed81bU, 0xb7e24900U, 0xb74938efU,
+  0x12fbee5dU, 0x06fc6424U, 0x2b96e1d9U, 0x26e917d6U, 0xf8cce9edU, 0xf72eed1fU, 0x2a2b3708U, 0x0915f50cU,
+  0xf38100efU, 0xf91c00cfU, 0x3223000fU, 0xd70c0002U, 0xe126e50eU, 0xe01305f5U, 0x34de1bfbU, 0x50d30ef9U,
+  0x1f030400U, 0xed15f000U, 0x0ce20400U, 0xf3170200U, 0x00c70a10U, 0x00dfeec5U, 0x002607d0U, 0x000b0634U,
+  0x240cd9faU, 0x1efc81dcU, 0xd23112ddU, 0xa9e80efeU, 0xfb03e33cU, 0xe4300c13U, 0xe3e221dfU, 0x0c460c00U,
+  0x0a2de42fU, 0x1ee82e02U, 0x01a2e4f1U, 0x17ea1fe1U, 0xd6af0ad6U, 0x0726f72fU, 0x2f18fdefU, 0x26e2ed19U,
+  0xb71000e1U, 0x0e2300f0U, 0xdc2100eaU, 0xfe1c00e9U, 0xf4000d05U, 0x2ff317fbU, 0x1702090aU, 0x1613e4dbU,
+  0xfedbef00U, 0x10251a00U, 0x152fff00U, 0xf919e000U, 0x0004d6f4U, 0x00fb03ffU, 0x00f9e4daU, 0x000530ceU,
+  0xeb10c4d6U, 0x1a15de0dU, 0x47f8e801U, 0x32f82d23U, 0x06190006U, 0xe2fd47dbU, 0xc50908d6U, 0xa11efecaU,
+  0x0ef7e61fU, 0x0b41051eU, 0x051be2feU, 0xdaff1fc1U, 0x1204e2f8U, 0x1535d81cU, 0x012f061fU, 0x06014b1dU,
+  0xe81700ffU, 0x111600ebU, 0xe30100dbU, 0x121900f2U, 0x0c18fa13U, 0x2bf80e01U, 0x05e10cf8U, 0x2cd8e6ebU,
+  0xe71d1500U, 0x161a0600U, 0x030ee100U, 0x050af500U, 0x00f1bcedU, 0x00df0703U, 0x0006e7dbU, 0x000c1edaU,
+  0x1119dbd7U, 0x300dda18U, 0x0be8eeeeU, 0x32000522U, 0x1a22dc0cU, 0xf0e52fd4U, 0xdff918c6U, 0x8b4919d6U,
+  0xfef7091fU, 0x170b0309U, 0x211f0003U, 0xf0e22cc0U, 0x05e6de1eU, 0xd43df429U, 0xfb1af523U, 0xde1d0c2eU,
+  0xfef200ffU, 0xf60a00baU, 0x00f200f2U, 0x1bf9000dU, 0x26f3e227U, 0x08f60e22U, 0x04cc0d01U, 0x22dbfe0cU,
+  0xeb2c2100U, 0x36e6e600U, 0x02fdce00U, 0xff2af100U, 0x00fed7e2U, 0x00da0a05U, 0x0012f4deU, 0x001634ffU,
+  0xdd18d3edU, 0xff0dda01U, 0xd800f1dcU, 0x17ebf30eU, 0x1023d504U, 0x1ff2fafcU, 0xbfea2fd4U, 0x8d141fd9U,
+  0xf4f4042cU, 0x0c044209U, 0x32f4e80bU, 0x241a15d2U, 0x0cf2d413U, 0xfd28e948U, 0x1d1401ecU, 0xe8290416U,
+  0x0dd500ddU, 0xee0f00b2U, 0x121300f8U, 0xee1000f8U, 0xefdae0f3U, 0xfbefebfeU, 0x10f510f3U, 0xfdfd34e0U,
+  0x10020c00U, 0xf6ddf600U, 0x10f3db00U, 0x1624e000U, 0x00f3f3e6U, 0x0009e92dU, 0x00ff0cedU, 0x00112823U,
+  0xf527e306U, 0xe319beb7U, 0xdefc0224U, 0x1ff3f003U, 0x2e12c327U, 0x2810eb05U, 0xcacb2aefU, 0xe50c2412U,
+  0x29f2da02U, 0x22e2572fU, 0xf9f612f5U, 0x151b220aU, 0xf7e7e7fcU, 0x0bd8d547U, 0xfe2a07f2U, 0xff261a28U,
+  0xebbe00c6U, 0x041700f2U, 0x211000e5U, 0xc8120007U, 0xc419dfe1U, 0x09d712f2U, 0x4eef38ecU, 0x4cca08feU,
+  0x0ed53d00U, 0x1ae4d800U, 0xfed4e100U, 0xfc29ee00U, 0x00e00adbU, 0x001bf600U, 0x00f714daU, 0x00110561U,
+  0x2145ddf5U, 0xbf37b3d5U, 0xe2fc1f04U, 0xc2ec0ed4U, 0x2327cc28U, 0x0a07f7f2U, 0xe5c913ddU, 0x3b34f338U,
+  0x0944e02dU, 0x238c3008U, 0xe8b70cd5U, 0x300b271aU, 0xe3baf4dbU, 0x39e0e845U, 0x230720e1U, 0x34d9fd24U,
+  0xd81300f0U, 0x0c2300e5U, 0x110400faU, 0x130300d4U, 0xe5e80b0cU, 0x2edb23f1U, 0xf6eb1310U, 0x131ee7e7U,
+  0x01e7f500U, 0x05fa0500U, 0x0bf20500U, 0x02f2f800U, 0x00dce1eaU, 0x00f10812U, 0x0003ecebU, 0x000642f6U,
+  0xf810b9dbU, 0xf915c9f4U, 0x4611f700U, 0x23142201U, 0xf61011fcU, 0xf6f933e3U, 0xdc021500U, 0xd8f4f20fU,
+  0x2701e220U, 0x0d5af02eU, 0xff17fb0bU, 0xe33ee8e9U, 0x100be700U, 0xf535d525U, 0x1b1f0bf6U, 0xe6093a23U,
+  0x071700f9U, 0x051600ecU, 0x0612000bU, 0x11030004U, 0x15ed0f21U, 0x21fd1511U, 0xd0fd10efU, 0x2e0513e9U,
+  0xf6fa0b00U, 0x30ea0300U, 0x13e0e600U, 0x03d0f900U, 0x00eec90cU, 0x00eae41cU, 0x0002070eU, 0x00293fdaU,
+  0xe30dd8d9U, 0xea03e5d2U, 0x10ff04edU, 0x1d281721U, 0x20240bfaU, 0x0cfb16bcU, 0x050215edU, 0xb00d1f1cU,
+  0x02f5f217U, 0x0a1d091eU, 0x11290f13U, 0x01f60700U, 0xe8eeed21U, 0xdf30e71aU, 0x0a0f06f8U, 0xd2283b5aU,
+  0x1de200ebU, 0xce0500efU, 0x03230008U, 0xf4120006U, 0x2fd8f8faU, 0xe8defc0fU, 0xcbfff625U, 0x22250bfeU,
+  0xfc0d1900U, 0x1fc4f100U, 0x09fff600U, 0x20c2e400U, 0x000cdaf1U, 0x0006cf2bU, 0x00fb08f0U, 0x00161503U,
+  0xe811f9e0U, 0xb3e3d6e8U, 0xed100f17U, 0x3c240116U, 0x3921c30dU, 0x0e08fbdfU, 0x0efa07e4U, 0xf1e1f013U,
+  0x0ad6fef3U, 0x1beb2321U, 0x1620123cU, 0xf8211f30U, 0xdddac00dU, 0x0cefdefbU, 0xf30911daU, 0xba032e2eU,
+  0x23e500ccU, 0xf0f300e0U, 0xf9080013U, 0xbe2200f4U, 0x1ce8e1f7U, 0x0df408eaU, 0x0f2210f3U, 0x0350ded4U,
+  0x030a0900U, 0x1d0fff00U, 0xf5e60500U, 0x06c5f700U, 0x00f10fdcU, 0x0002df2cU, 0x00df10e5U, 0x00ffdc35U,
+  0xef20ecd8U, 0xb80fe1daU, 0xfb0c040bU, 0x1e1c0909U, 0x0c29c708U, 0x232016f6U, 0xeacc040bU, 0x0316f3f8U,
+  0x16f301f3U, 0x17ea1dfdU, 0x1206fe1bU, 0x212c3132U, 0x11cfd40cU, 0x32e5d825U, 0xf7e20be7U, 0xe5d5201fU,
+  0xfec900bdU, 0x29fc0016U, 0x1bfe000dU, 0xbe080025U, 0x1bf5ebe4U, 0x51d903dfU, 0x39f321e0U, 0x2902d31aU,
+  0x00de3f00U, 0x0233fe00U, 0xeee3dd00U, 0xeb340a00U, 0x00bf0bb1U, 0x00f813efU, 0x00bef2e8U, 0x00eddf69U,
+  0x1554d2d1U, 0xc725ecf9U, 0xfbe50a00U, 0xc8e916cbU, 0xea2ad614U, 0xfa0e08ebU, 0xd8c0f6fdU, 0x253ad429U,
+  0x01f7f308U, 0x109ffaeaU, 0xe60dd5f8U, 0x33162444U, 0xefa6dedeU, 0x72dff3fbU, 0x09f316f5U, 0x03a82211U,
+  0x232500ffU, 0xf61000f7U, 0x44f200f1U, 0x1dfc0092U, 0xfbe8f301U, 0xe9fdef03U, 0xdd0f1700U, 0xecf1d7feU,
+  0xffd00700U, 0xfbcff600U, 0x05130400U, 0x15effa00U, 0x00d90ae1U, 0x00e01102U, 0x00ffe8efU, 0x001f44fbU,
+  0xeffbc6f0U, 0xf005e106U, 0x1a1af3f0U, 0xfd28e2f8U, 0xf0240c08U, 0x250bff06U, 0xedc713ffU, 0x04e2eb21U,
+  0x36e5f513U, 0x1348f22dU, 0xf520f0fbU, 0xf04dcb06U, 0x09050310U, 0xee1fe919U, 0x15fb00e4U, 0xb5f7e8fbU,
+  0x1af900e2U, 0xe41a00e5U, 0x30d8001cU, 0x27f500e0U, 0x2ce8ed0eU, 0xf9f4dafaU, 0xc4fe1a1cU, 0xfa0bcf07U,
+  0xfeeb0700U, 0x1801f700U, 0x0d2af900U, 0x150de700U, 0x00dbddcdU, 0x00c7ea24U, 0x00e8fddeU, 0x000025ffU,
+  0xf209e0d9U, 0xe2efe7d9U, 0xfcecfb08U, 0x183bf306U, 0x0635f907U, 0x2a1d04d9U, 0xe4f829f7U, 0x0dce0a19U,
+  0x4de2f203U, 0x2721fd26U, 0xf920e12aU, 0xf33bf523U, 0xdffcd914U, 0xe331df23U, 0x28ef19d2U, 0xcaf6f40fU,
+  0x2df200a8U, 0xddf400f0U, 0x24d30003U, 0x0ed500ebU, 0x13daf6f7U, 0x06c2bd05U, 0xe80c1112U, 0xbd33ff1eU,
+  0x0c052100U, 0x20291900U, 0x0edefe00U, 0xfaddca00U, 0x00ccf4c4U, 0x00f1e518U, 0x00e327f6U, 0x00d5ff36U,
+  0xe917eae7U, 0xaff4f4e9U, 0xece52231U, 0x151afc09U, 0xfa44da05U, 0x25ff12d9U, 0xf10c1e10U, 0x5eccf9feU,
+  0x29e0fcd8U, 0x1aeff0eaU, 0x1e25cd30U, 0x0c3a2d1fU, 0xf8eae00aU, 0xe822dcf1U, 0x1ef316e3U, 0xabc8e60fU,
+  0x16c100a0U, 0xe0df00fbU, 0x1eef00fdU, 0xc0dd00d4U, 0xfedbe3e3U, 0x0fd3d5eeU, 0xf62918fbU, 0xb14bf010U,
+  0x05fe2c00U, 0x17362600U, 0x0ad82d00U, 0xf1dd2700U, 0x00c40ebeU, 0x00e62811U, 0x00e6efecU, 0x00efcd72U,
+  0xf327d9e1U, 0xf421f509U, 0xfc080735U, 0xf2e906f5U, 0xfc24ddf3U, 0xfc180ff9U, 0xdaf5051aU, 0x46140df3U,
+  0x12dce8dfU, 0xf6d2ededU, 0x0e04dc0cU, 0x160f1427U, 0x1cdcf5ffU, 0x0922e8f8U, 0x1bdc18f5U, 0xf4ca12faU,
+  0x02db00c1U, 0x3309001eU, 0x2af3000dU, 0xd6110011U, 0xe5fbedeaU, 0x21e7ededU, 0xdb0a05fdU, 0xd7ed0623U,
+  0xf8004100U, 0x0f341200U, 0x07e40700U, 0x09411700U, 0x00b6f5bfU, 0x00e317e7U, 0x00e2c5ddU, 0x00d6fe7fU,
+  0x0703e9d2U, 0xebfdfc14U, 0x12e1f53dU, 0xc9c7f9f7U, 0xec2ce4eeU, 0xee0906f4U, 0xdcee0315U, 0x5e00eef7U,
+  0x02e3d7eaU, 0xf9bad8e8U, 0xed05bce4U, 0xfeef172cU, 0xdfc8f1e5U, 0x16f2fef7U, 0xe9e60ce8U, 0x00e8faecU,
+  0x080a000fU, 0x13cb002dU, 0x191c00f8U, 0x040900fdU, 0xecf40bdbU, 0x191bfe10U, 0x0af110dfU, 0x09f8fff0U,
+  0x12f9ff00U, 0xf918e000U, 0x101a0700U, 0xff0ce300U, 0x00e4e522U, 0x00d40524U, 0x000bfeffU, 0x00412a23U,
+  0x0aec1d2cU, 0x080e16d9U, 0x13eafe1dU, 0x040538f6U, 0xff202416U, 0x0620faf9U, 0x051842fcU, 0xfccf0f21U,
+  0x1912d9edU, 0x020b000dU, 0x1c0cd8ceU, 0x0b2de207U, 0x0b40f9fbU, 0x0bdb16feU, 0x19400ffbU, 0xfde90e01U,
+  0x03080047U, 0x09c20050U, 0x1317000aU, 0xffe40033U, 0xd9ece914U, 0x15f2e02cU, 0x22cf10d1U, 0xfeffe00eU,
+  0x3c130300U, 0xdd142100U, 0x30110900U, 0x08f9e800U, 0x00b20012U, 0x00fbf944U, 0x00272626U, 0x000b1e55U,
+  0x24c80e36U, 0xf6f4f226U, 0x47ef242cU, 0x21ee272eU, 0x12362104U, 0x1b1d0907U, 0xf9232ad4U, 0x24f30a12U,
+  0x2c33e7ceU, 0x141ade1cU, 0x0a0801dbU, 0x0d49ddf3U, 0xe84ef002U, 0x06d6eee6U, 0x44370313U, 0xe4da38fbU,
+  0xe705001eU, 0xecd80038U, 0x05210005U, 0xf9e3002dU, 0xdb02f215U, 0x0902d601U, 0x0adfffd6U, 0xe30ec309U,
+  0x383ef800U, 0xfa1a5300U, 0x12291500U, 0x14052a00U, 0x00810d02U, 0x00200aedU, 0x00102a0aU, 0x00bc193bU,
+  0x45b1dc24U, 0x09d8fb35U, 0x5dbd2409U, 0x48b9fd34U, 0x04262312U, 0x1d0c2319U, 0x0ff14fe1U, 0x4be70a05U,
+  0x171d0bc2U, 0x0523d214U, 0x222d1bcdU, 0xf467dcf4U, 0xd557d713U, 0xebd8e9f8U, 0x1228e7fdU, 0xc902fcffU,
+  0xf1170004U, 0x03cf00ffU, 0x08ff00f9U, 0xfdfe00f6U, 0xc620fa02U, 0x0e39fb12U, 0xe8f4eecdU, 0xb74de0faU,
+  0x0e2bf700U, 0xf2ff4500U, 0x17281a00U, 0x0d2e4800U, 0x00a5f8e7U, 0x00ed1ac0U, 0x00de190dU, 0x009e06f7U,
+  0x4accbf0dU, 0x0fe53114U, 0x46d63116U, 0x36bbce0dU, 0x0931120dU, 0x2200fcfdU, 0x16194901U, 0x3a13e516U,
+  0xf91e0cebU, 0xea1bd825U, 0xf92506e2U, 0xd55edcfdU, 0xf04de216U, 0xdfe40ee5U, 0xfa6ee71aU, 0xa411e416U,
+  0x150800e1U, 0x30de00e8U, 0xf2e600faU, 0xee0500c7U, 0xd620f3fbU, 0x1a3e07edU, 0xfa2cecddU, 0xae3eef05U,
+  0xf5fa1600U, 0xf5091b00U, 0xf41b0000U, 0xf50c3c00U, 0x00c901ceU, 0x00d110a0U, 0x00d60220U, 0x00c106daU,
+  0x43faa0e0U, 0x29f3fa0bU, 0x34e008caU, 0x41cbb6ffU, 0xf728fdffU, 0xecc6f5e7U, 0x25152117U, 0x1c12f014U,
+  0x120e1aeeU, 0xe7faf026U, 0x042f10f3U, 0x0b68060fU, 0xee21be2aU, 0x00f91b04U, 0x0232e207U, 0xd826d805U,
+  0xf0250002U, 0x2ad80034U, 0xf83900eaU, 0x15000005U, 0x05dbfb07U, 0xec1bd900U, 0x1eeeffe9U, 0xfdf2e4ddU,
+  0x1efffc00U, 0xff06ff00U, 0xfb460700U, 0x0a02ee00U, 0x00e2d927U, 0x00141a2aU, 0x000301fbU, 0x00200932U,
+  0x39e8e0faU, 0x0a153003U, 0x2a0d10dfU, 0x1d151d04U, 0xf81633efU, 0x18fcdc05U, 0xde2733d4U, 0x09c22721U,
+  0x0a28e107U, 0x0520dd0bU, 0x0a0ded02U, 0x2d29e019U, 0xfe4ecd06U, 0x0fc929ecU, 0x1444f111U, 0x10d80ef5U,
+  0xd811001cU, 0x1ed6003cU, 0x1d4800edU, 0x0f140002U, 0x13edf525U, 0xf013bd15U, 0x24e517fdU, 0x0511f0fbU,
+  0x1736f900U, 0xe2204800U, 0x3f4c0000U, 0x0d270600U, 0x00d723f2U, 0x00086a05U, 0x00e32dffU, 0x00e30731U,
+  0x2af1cc35U, 0xf0011e0fU, 0x7112cafcU, 0x4c03fe37U, 0x0b0f03dfU, 0x0102d80aU, 0xa70354d0U, 0x2ef51609U,
+  0x0e300e01U, 0x0a05bb60U, 0x13174a02U, 0x1a3c020aU, 0xa21bb2ffU, 0xe79c0bceU, 0xeb4fd51bU, 0xf4eef0dfU,
+  0xc1e400f2U, 0x06f0001eU, 0x2d3300d2U, 0xe30d00f3U, 0x0a17f51eU, 0x0937c6feU, 0xf70e1c08U, 0xf026ea0dU,
+  0xfc4fe400U, 0xb7206300U, 0x0a4cfc00U, 0xeb24ff00U, 0x00c12af6U, 0x000138feU, 0x00e93a0aU, 0x00cc01f5U,
+  0x31feaf29U, 0x0d192907U, 0x7ff0b6feU, 0x4befdd23U, 0xfa23dd0bU, 0x0222ca0bU, 0xc7e856daU, 0x3cf6131aU,
+  0xca10480fU, 0x18efe13aU, 0xf7155011U, 0xef2118fcU, 0xde00cd0eU, 0xb9bffdfdU, 0xe365e90cU, 0xc31bebedU,
+  0xd7f600d4U, 0x3006000eU, 0x45df00b2U, 0xc5d500e6U, 0x044f0204U, 0x0824e9e7U, 0xe23e0b18U, 0xd1682202U,
+  0xcd13f900U, 0xc1f62800U, 0x0530ed00U, 0xe3151400U, 0x00abfc0aU, 0x002312c9U, 0x00d42affU, 0x00b2f7d9U,
+  0x3402a7e8U, 0x0438ee08U, 0x49dbe2eaU, 0x57e8e00cU, 0xfb1ecc16U, 0x2101aeeeU, 0xe8024709U, 0x162de22eU,
+  0xfef6522cU, 0x0610d527U, 0xece746f4U, 0xd323171cU, 0x06c9c31cU, 0xcfbf0218U, 0x0a65e636U, 0xc041d900U,
+  0x1c0a00f7U, 0x7208002dU, 0x1f0700dcU, 0xfbdb00ebU, 0xf915f204U, 0x042d08f6U, 0xe95de915U, 0xa82704f2U,
+  0xe1f4f500U, 0xdfd3e200U, 0xe119d100U, 0xd6ed1500U, 0x00d2f9d8U, 0x00340096U, 0x00c3ffc1U, 0x00aee4afU,
+  0x1f0d9bbbU, 0x041de646U, 0x24ec98e5U, 0x4eff8102U, 0x0a1dd801U, 0xd6abe1f1U, 0xd622ff26U, 0xf411d615U,
+  0x03d04814U, 0xfae9db14U, 0x03e345e1U, 0x12080815U, 0xf4e0d50bU, 0xeded2119U, 0x0941f541U, 0xc409d51bU,
+  0xbe0d00f8U, 0x3ece000fU, 0x1bf900c6U, 0x102100f0U, 0x27e60a04U, 0xd6f9e412U, 0x16fd240fU, 0x11fe19daU,
+  0x200dfb00U, 0x0aa8f500U, 0x0b23f700U, 0x01241100U, 0x001bdb06U, 0x00173212U, 0x001429fbU, 0x0011f711U,
+  0x1f03d508U, 0xf12c57dfU, 0x241cfcd3U, 0x370def08U, 0xf0f53de2U, 0x25f2f726U, 0xe9e741e1U, 0xf3ce2bf7U,
+  0x09451b2eU, 0xdb09de21U, 0xee6dd024U, 0x1f4d030bU, 0xe649ea2bU, 0xe9941bf0U, 0xee0dd10aU, 0x1a1ed7fdU,
+  0xc42600dfU, 0xf3f90011U, 0xf21800c4U, 0xf32f00daU, 0x2ae00515U, 0xe00dd827U, 0x1e0827f3U, 0x0e2ae61bU,
+  0x2708f800U, 0xc60c2e00U, 0x15e7d100U, 0x0c581100U, 0x000de71cU, 0x000c47f9U, 0x0005f51eU, 0x00e81016U,
+  0xf40fd62cU, 0xcc393eefU, 0x37f8f4ccU, 0x43f6d70cU, 0x2dec06daU, 0x1c00cd32U, 0xfac330adU, 0x35cfe8fcU,
+  0x1a142b22U, 0x2218ef39U, 0x0a290438U, 0x0d380513U, 0xd923cb1aU, 0xe496fdf7U, 0x1024d223U, 0xcd02fc1cU,
+  0xeacf00eaU, 0xfbfa0010U, 0xd51b00bfU, 0xcff000d1U, 0x1ef3e625U, 0xec390205U, 0x1707fa11U, 0x04030504U,
+  0x11e40e00U, 0xc2ed2f00U, 0xc6d5c400U, 0x1c420600U, 0x00e4ed11U, 0x0018d8dbU, 0x00effc2fU, 0x00e134e8U,
+  0xef13c1e9U, 0xe8580d02U, 0xd5f9f4c6U, 0x290dd504U, 0x36e7dbdeU, 0x2352aa14U, 0x2ecc03d3U, 0x3402e304U,
+  0xfad0512bU, 0xff0a0b2dU, 0x0823252cU, 0xd9fe2c13U, 0x31b1bb15U, 0xe2f5f602U, 0x1a11f245U, 0xfc12ce2cU,
+  0xf8fb00f9U, 0x0e0100fbU, 0xd3f100aeU, 0xdff500d7U, 0xfe10dc04U, 0xfef113efU, 0xf84ade51U, 0xff04f905U,
+  0x03000200U, 0xe5e4e400U, 0xe6bbba00U, 0xedfd1900U, 0x00d4ff2bU, 0x003fc3a5U, 0x0022d92eU, 0x00d30411U,
+  0xa32ab3c5U, 0xc0270307U, 0x0d0a0b85U, 0x0b24b1c4U, 0x1609f4fbU, 0xeb0dee17U, 0x20fff4f2U, 0x0939eb0bU,
+  0x11d8432bU, 0xfdc8fe03U, 0xf0205046U, 0x0d00431cU, 0x55a9bfedU, 0xe60f472dU, 0x30b1043cU, 0x35c0a80fU,
+  0xf9040036U, 0x4f1a002bU, 0xed1a00bbU, 0x13110001U, 0xfffb0bf7U, 0x20e60126U, 0x05021c53U, 0xb0ed1ce6U,
+  0x0f01b100U, 0x05e1b000U, 0x1ee99200U, 0xdfcdfa00U, 0x00e7f53bU, 0x003ef9aaU, 0x001e0925U, 0x00d6f309U,
+  0xc814ec19U, 0xe808ed40U, 0xdf23cfbaU, 0xdb33a6e6U, 0x2909dcefU, 0xdab805e2U, 0x200801e9U, 0x063ef3f5U,
+  0x04da1602U, 0xde94d5faU, 0xf7842620U, 0xf8f60d0dU, 0x2ec1e2fdU, 0x100a553cU, 0x35c8f93dU, 0x39f3aa20U,
+  0xc61800feU, 0x0fd40004U, 0x1ccf00e6U, 0x062400f1U, 0x26cc13f1U, 0x02f41424U, 0x00c847f7U, 0x270421e8U,
+  0x061bfa00U, 0xfadfe100U, 0x08e6db00U, 0xeff71a00U, 0x000cda14U, 0x001e16f9U, 0x00121021U, 0x0030fae6U,
+  0x0afceef9U, 0xb2093ad0U, 0xd81bc8e0U, 0x260707ffU, 0x10ef17ebU, 0x04dc19fcU, 0x14d534d5U, 0xffe9fed9U,
+  0x1749292fU, 0x0fdbcffdU, 0x02709c2fU, 0x08530f24U, 0xd119ec31U, 0x04ccf0f1U, 0xf821e8faU, 0xf7f3f007U,
+  0xe0f800daU, 0xdcfb000bU, 0x03b80019U, 0xca1000dbU, 0x1eec0122U, 0xe5ec0436U, 0xfff82f0dU, 0xf419ea00U,
+  0x3c0b0c00U, 0xd1050100U, 0x1eccdc00U, 0x23031900U, 0x0020e312U, 0x003ef101U, 0x0016ca46U, 0x00100f20U,
+  0x1cf2ddfbU, 0xa42408e0U, 0xc60ec1caU, 0x0c03eef1U, 0x260000d5U, 0x2b0bd7f2U, 0x24e115b2U, 0x1fdbfce4U,
+  0x28df1eeeU, 0x0ae2e707U, 0x3f309e36U, 0xf32f2e10U, 0xe534f026U, 0x0dc6e4f6U, 0xdc14dcfbU, 0x0405fa01U,
+  0x0ae600f4U, 0xda130028U, 0xb6ec003bU, 0xe0e000e2U, 0x04fbf20aU, 0x19021e53U, 0xddfedb20U, 0xf20603f2U,
+  0x40e73100U, 0xcbe30a00U, 0x1cc91400U, 0x2f070400U, 0x0000f200U, 0x000fd3dfU, 0x00ffbb55U, 0x00fdfa06U,
+  0x21edcf07U, 0x90091dedU, 0xa2e9d3edU, 0x33fedbeeU, 0x1c12fbebU, 0x1549c6eeU, 0x3b0241d2U, 0x110bedf7U,
+  0x04bce2feU, 0x03d6f10bU, 0x25079d43U, 0xf1031d13U, 0x2717e420U, 0x2aeaf023U, 0x13e5d3f1U, 0x35f9e405U,
+  0xd413000fU, 0xf609001dU, 0xd0f9001aU, 0x010100e9U, 0xf5ffd3d7U, 0x2ee42943U, 0x1b12e605U, 0x180804f7U,
+  0x23061500U, 0x22e6e200U, 0x29f30d00U, 0x02ff0e00U, 0x00ec000aU, 0x000902efU, 0x000ed151U, 0x00d7f9f3U,
+  0xd419e105U, 0x89f4381aU, 0xaad9e8e8U, 0x1225c8e3U, 0x0f07d8fbU, 0xfe1229eeU, 0x560c5225U, 0x0a15e124U,
+  0x0ecfd417U, 0x01a0e1efU, 0x03fcfa27U, 0xf4020806U, 0x16f2d926U, 0x1eff152bU, 0x3502dce5U, 0x48e9d10eU,
+  0xe3ff003dU, 0x1d220044U, 0xeffc002bU, 0x0021001cU, 0x0de4eec8U, 0x33cc092dU, 0x66c207ffU, 0xf4fe03d8U,
+  0xfe2ddf00U, 0x3ef3e400U, 0x1824cc00U, 0xedf81700U, 0x00fe0246U, 0x002209bcU, 0x00030224U, 0x00ebe20dU,
+  0xe118e716U, 0xc2f33451U, 0xb1ee02d4U, 0xf621d110U, 0x16fde2f9U, 0x0edf0909U, 0x59eb2cf5U, 0xfa12e8f6U,
+  0xfbe6f3faU, 0xdc81afdfU, 0xf699e402U, 0xf81105fdU, 0x2acae5f2U, 0x250421fbU, 0x77d1f0e9U, 0x4103db0fU,
+  0xe50a0003U, 0x29f40002U, 0x06d6000eU, 0x090d0002U, 0xfaf6fd00U, 0xe5eb2e25U, 0xe0cefaf9U, 0xfa06f90cU,
+  0x07e8f400U, 0xfe09f000U, 0xfee5d500U, 0xf7c90000U, 0x00f1f215U, 0x00160006U, 0x00f2f7e6U, 0x000e10feU,
+  0xf6eef7ffU, 0xcbd9e5e5U, 0xf7e8eaf9U, 0xfe06090eU, 0x29040ff6U, 0xf7162af7U, 0xfdff10ebU, 0x02fd0c05U,
+  0x1b1d030dU, 0x2fd4d510U, 0x28f9c4f6U, 0x0e48fd1bU, 0xfd12f812U, 0x1d00eee2U, 0xf4fb09fbU, 0xf9f0fa1aU,
+  0xea0c00f5U, 0xfa110001U, 0x1ae000fcU, 0xe91500f3U, 0x13c9f209U, 0xfccb1b24U, 0x3b9cbef9U, 0xdde8fa08U,
+  0x22210100U, 0xf8090600U, 0x3037f100U, 0x0de9fd00U, 0x00e4091cU, 0x000af4deU, 0x00c80ef1U, 0x0010f832U,
+  0xf1dbfbf1U, 0x8fe8e8f2U, 0xbdf7ecfdU, 0x06ff0114U, 0x1df20af7U, 0x124c3ecdU, 0xf31849d1U, 0x2718f01dU,
+  0x09eaf5ddU, 0x25b4c608U, 0x55d2c1ecU, 0x05451a34U, 0xee36e515U, 0x1bf3f7dfU, 0xf119d6fcU, 0xf7f1e933U,
+  0xe0ff00faU, 0x2d35002eU, 0x25ce0011U, 0xe1e100ecU, 0x0de8e0fbU, 0x09cbff17U, 0x32a1ad11U, 0xecec020cU,
+  0x201e2700U, 0x03101800U, 0x27333300U, 0x02f22700U, 0x00081f0cU, 0x00f608e7U, 0x00ea1018U, 0x000ddb0eU,
+  0xf704eb07U, 0x9fe8e9fbU, 0xaa080906U, 0x0402dfefU, 0x0fe4f8edU, 0xea4a1ceaU, 0xe23030d4U, 0x10fdeef8U,
+  0xe3b3dad5U, 0x3a91d8d3U, 0x35a1ceeaU, 0xf7ff150cU, 0x2029f3f9U, 0x171cfa20U, 0xdf32ce0aU, 0x2700f804U,
+  0xd6f9001eU, 0x41370036U, 0x0abc0013U, 0xfcef00fdU, 0x04f1c7ecU, 0x28cae81bU, 0x29d5e8ffU, 0xfff3d6f3U,
+  0xe222f600U, 0x23f4fc00U, 0x192d4000U, 0x011f1a00U, 0x00e83b15U, 0x000234baU, 0x00db231fU, 0x00f5f401U,
+  0xeb3ceed8U, 0xd706141aU, 0xb810f310U, 0x0f29dae6U, 0xefeef2fdU, 0xf01bfafeU, 0x1b3413faU, 0x030c01f0U,
+  0xf0b5dbecU, 0x0a98e4f2U, 0x10b7c6e9U, 0xe4f1dcffU, 0x39fbfe39U, 0x1226151fU, 0x2026e30eU, 0x24f6e519U,
+  0x070f0022U, 0x2c230037U, 0x41fd0022U, 0x1200002eU, 0x27e4e0e1U, 0x23eaf3faU, 0x1bd4f3ebU, 0x0f0101ddU,
+  0xec33c100U, 0x16ffd400U, 0x0336ee00U, 0xfe2afa00U, 0x00f5131cU, 0x0007ebc6U, 0x00df1f03U, 0x00ec0a06U,
+  0xb81004e1U, 0xf8ea1107U, 0xc0e1f813U, 0xd316fc00U, 0xf6f3f405U, 0xcfe6f609U, 0x05f21001U, 0xf7fe05efU,
+  0xe7dae6e5U, 0xf3a4f4e8U, 0x03a8d6ddU, 0x05fad8eeU, 0x1bea0e29U, 0xf5f90e0aU, 0x32e1f8fbU, 0x1b0efa33U,
+  0xf3f70011U, 0xf72000f3U, 0x18150001U, 0x132400eeU, 0xfdf1faf1U, 0xf70101f6U, 0x01d80528U, 0x03ee0c10U,
+  0x03fa2700U, 0x02ece200U, 0x030b1700U, 0xff01fe00U, 0x00021307U, 0x00f6fc06U, 0x00e2f9deU, 0x00e5dcebU,
+  0xef08db23U, 0x01ff0602U, 0xfe0fd40aU, 0x18faece1U, 0xfc21f30aU, 0xf4eb0a01U, 0x0629fefbU, 0x0000211aU,
+  0x2601fd0cU, 0x1011f3efU, 0x04f6f801U, 0x05090af3U, 0x0e01eefeU, 0xed2e0e09U, 0xee0d0d04U, 0x0037ef04U,
+  0x06f80002U, 0xf3060002U, 0x070100f5U, 0xfe0100d3U, 0xfd0406d8U, 0x08071518U, 0x10d70630U, 0x03ee0712U,
+  0x06f52c00U, 0x1705e100U, 0x06100a00U, 0x21eeea00U, 0x00091f24U, 0x00e127d6U, 0x00f201eaU, 0x00250903U,
+  0xd00ae3d9U, 0x2de7f514U, 0xfe17db00U, 0x2ef9de19U, 0x140ee70cU, 0xfaef1b03U, 0xfc33ef0aU, 0xf53215eaU,
+  0x38f7d60aU, 0x2015e0e3U, 0xf6e514ffU, 0xf9d50e09U, 0x0606f4f8U, 0xcb51e212U, 0xfd1f1207U, 0x0932ea11U,
+  0x0e2700efU, 0x1c06000fU, 0xe8f6000bU, 0xf8df00e3U, 0xe72106fcU, 0xec051534U, 0x11f7f8ffU, 0xf90d0212U,
+  0xefe31500U, 0x1e0dd800U, 0xe30e1500U, 0x08e1ec00U, 0x000f1d37U, 0x00cf0ecaU, 0x0001f5eeU, 0x0010e809U,
+  0xeb132aaeU, 0x44ea1d1bU, 0xf806e70fU, 0x21d9f40dU, 0x37eefe17U, 0x05021d11U, 0xeb3b1723U, 0x082e1cf1U,
+  0x2a07f501U, 0x0623cac1U, 0xeff30d0cU, 0xe2e42a0bU, 0x02240207U, 0xcf35e2f3U, 0xfa18de00U, 0x1d12d107U,
+  0x313a00ebU, 0x0e1a00f9U, 0xf2d0000bU, 0xf0dd00e8U, 0xe4e9111cU, 0x15192243U, 0x0f1efeefU, 0xd720f5efU,
+  0xe706db00U, 0x3344ee00U, 0xd4f8fa00U, 0xe8def400U, 0x00f12a27U, 0x00da2ebcU, 0x0006ecf8U, 0x00d9d528U,
+  0xd32d1de2U, 0x3f0a11f1U, 0x01e50d32U, 0x19bde507U, 0x13ee3014U, 0xe30c1519U, 0xe32b0523U, 0x11092812U,
+  0x1920ff17U, 0xf00ad3c9U, 0xf5f5fd1eU, 0xe3de1319U, 0xfb140ae6U, 0xfa27f0f8U, 0xf1f7ec02U, 0x3d1dd00aU,
+  0x541000ffU, 0xfcec00e5U, 0x0af40020U, 0x03e900edU, 0x0501170bU, 0x1e291727U, 0x26110e06U, 0xd616f0f8U,
+  0xfd040800U, 0x1414d600U, 0xfe2bee00U, 0xfded1300U, 0x001a0634U, 0x00e609d0U, 0x00f908ddU, 0x00d6fe0cU,
+  0xf42e3dfeU, 0x4d23fcd5U, 0xffe20c0aU, 0x28c7c3f8U, 0xfffc0c1cU, 0xe8031f07U, 0xe0ffff09U, 0x18192201U,
+  0xe650bb15U, 0x0dedded6U, 0xffe3f710U, 0x0d0b3c23U, 0x030718e6U, 0x123afe11U, 0x0df70f01U, 0x081aea1bU,
+  0x07040003U, 0xf20e00e4U, 0x021f00e8U, 0xdf3000d6U, 0xfcbc0cf0U, 0x21ec00e0U, 0x1cec0d27U, 0x22e90dfeU,
+  0x05c83700U, 0x193bd000U, 0xef300f00U, 0xf01ae800U, 0x00e8ebfdU, 0x00f41c04U, 0x00e91cc5U, 0x0004f2e8U,
+  0xc40db418U, 0x28fcd13bU, 0xe8fbd0f5U, 0x3413c5bbU, 0xfe3405f4U, 0xedcb01f8U, 0xdb1feefeU, 0xe712fbe9U,
+  0x16d0e01eU, 0xed2004c4U, 0x16ede312U, 0x151deb2cU, 0x10f5fc09U, 0xca4bf41bU, 0xdf19eb05U, 0xf414e208U,
+  0x070f00f8U, 0xd4f900d1U, 0xf80600e7U, 0xde2400d1U, 0xfeb711f5U, 0x05041d0fU, 0x17e80e15U, 0x1fe72513U,
+  0x13e51c00U, 0x0a40d700U, 0x083d0e00U, 0xd93af200U, 0x00cf06f6U, 0x00e513beU, 0x000f0d00U, 0x00fea81fU,
+  0x8916affaU, 0x30ebb522U, 0xfe0af8feU, 0x5127a5d1U, 0x142207fdU, 0xfae32ee4U, 0xd600ff1dU, 0xef1919dbU,
+  0x0a8ddc1bU, 0xfb4ef8dbU, 0x1c0f0d17U, 0x30222244U, 0x0f1b0211U, 0xc424ca24U, 0xf3effbe7U, 0xf0fdc406U,
+  0x000b00f9U, 0xee1800d2U, 0xe5c300f5U, 0xe2ed00caU, 0x0804fc0dU, 0xdd131328U, 0x34100d23U, 0x04351238U,
+  0x35ec1100U, 0xfe2fea00U, 0xbf112900U, 0xf730fa00U, 0x00e32914U, 0x00c633d4U, 0x000a13fbU, 0x00c1bfeaU,
+  0xdc0719f6U, 0x1de9e03bU, 0x090df6f1U, 0x500abdcbU, 0x370c2212U, 0x14f11a00U, 0xe2302615U, 0x16f945f1U,
+  0x09f0ede5U, 0xde2fecd5U, 0x15eef929U, 0x032f2633U, 0xdf371e13U, 0xeb1fcde6U, 0x20e7e8f0U, 0x031d0012U,
+  0x04f90020U, 0x0b0700e9U, 0x1fb600fbU, 0xf3cd00a2U, 0xe3f7170fU, 0xf33c1d24U, 0x1808f810U, 0xd9561330U,
+  0x3bd30300U, 0xe0461000U, 0xd0081700U, 0x0f02ee00U, 0x000c2f22U, 0x00d248eeU, 0x00f6dae5U, 0x00b4f2eeU,
+  0xe5151848U, 0xfce7e508U, 0x0d14fdfaU, 0x34e4cfdaU, 0x17f32f27U, 0x03fc160dU, 0xfa1efd08U, 0x16f6e81fU,
+  0xf72e03e6U, 0xd619dbe6U, 0x0ad8d43bU, 0xf21b1d39U, 0xd91b1fefU, 0x0a11fae8U, 0x19cef3dfU, 0x1708fe18U,
+  0xf5d500ffU, 0x0e0200c9U, 0x15a200f7U, 0xf5ca00c5U, 0xfe1c1b40U, 0x29300b1bU, 0x0329fc05U, 0xa92c0106U,
+  0x19043300U, 0x0e241400U, 0xecfd0600U, 0xf208eb00U, 0x00f92a01U, 0x00e318e8U, 0x00ec04c3U, 0x00a300c5U,
+  0xef07462eU, 0x29071d09U, 0x0502f7f7U, 0x0c028fb6U, 0xe4dd5525U, 0xfded12f4U, 0xd8fa100eU, 0x0025e71aU,
+  0xdc29bdeeU, 0xfc00eee6U, 0x05f7ec16U, 0x25f73227U, 0x091a3edeU, 0x170517efU, 0x1bdd19e8U, 0x19f7f914U,
+  0x17260011U, 0xedfa00f7U, 0x0bf600d8U, 0xdb0900dfU, 0xf7c5fa0cU, 0x30fb25bcU, 0x1bfbdfdbU, 0x1de107f9U,
+  0x1ff82400U, 0x053cd500U, 0xe3fdff00U, 0xfd0ff000U, 0x00bbebdfU, 0x00004000U, 0x000c45cbU, 0x000ddad6U,
+  0xbe0bc12eU, 0x0104ed48U, 0xe015f9faU, 0x2929d5caU, 0xfd30e808U, 0xdfbaf30cU, 0xdd0e0008U, 0x08f11dd9U,
+  0x269c14f1U, 0xc53e25caU, 0x1906df13U, 0x2842ea48U, 0xed250004U, 0xa735393dU, 0xf5cb0e1eU, 0xf91fd014U,
+  0x1d1400d8U, 0xcf2700d5U, 0x04f500deU, 0xd44a00cfU, 0x20dfe90aU, 0xfbf910f4U, 0x1df5f903U, 0x3908edf5U,
+  0x1e2eff00U, 0xf162e300U, 0xe02b0b00U, 0xe14afd00U, 0x00c2df97U, 0x00e324f1U, 0x000f2ff7U, 0x00e0c412U,
+  0xc704ce2dU, 0x0d05bf39U, 0xf21ffff1U, 0x0613dfb5U, 0xee222327U, 0xd5ebebfcU, 0x13e92807U, 0x0ffae7b9U,
+  0x11812cb7U, 0xf95303e5U, 0x131ed756U, 0x3e3d054fU, 0xbe33221dU, 0xb5380b19U, 0x09cefbfbU, 0xc81dc546U,
+  0x000300e5U, 0x06e500e0U, 0xf8f000e8U, 0xb31500b0U, 0x271db6e6U, 0xea0a05e7U, 0x472c0d18U, 0x3128eb3cU,
+  0x4a480500U, 0xdd3ffc00U, 0xda2c3400U, 0xcf280700U, 0x00e31ea2U, 0x00d517e8U, 0x00fc1ef4U, 0x00f6e711U,
+  0xf9042721U, 0xe4f9be24U, 0x172707d6U, 0xe506d4d6U, 0xff2a403cU, 0xfd0dff09U, 0x1d00ebe8U, 0x4bebb9eaU,
+  0xe9d823adU, 0xf60409e9U, 0x2014bf53U, 0x070b133fU, 0xd2094ccaU, 0xdc3acedfU, 0xf9b919eeU, 0x1a00fa35U,
+  0xf4db0020U, 0x0bf600efU, 0x0dd10000U, 0xc9d100abU, 0xfb02e01fU, 0xf4fefd06U, 0x2e302115U, 0x0f0be4ecU,
+  0x1f450900U, 0xef110900U, 0xbe2d2200U, 0x0bf3ef00U, 0x00f940faU, 0x00da240fU, 0x00e3e9e2U, 0x00dfe93bU,
+  0xfae64134U, 0xeee1db00U, 0x2513fbd2U, 0xf226b6beU, 0x29f828f4U, 0x0f0ffd05U, 0x0f17c7fbU, 0x20089cfbU,
+  0xda20f5dfU, 0x1314e80eU, 0x2ce3dd68U, 0x1be21355U, 0xd50b49cdU, 0x17dee8dbU, 0xf5b110dbU, 0x38ade632U,
+  0x13a90024U, 0xd82400ddU, 0x09a900dbU, 0xfbec00e4U, 0xe51f044eU, 0x34e304f5U, 0x150d09fbU, 0xfcf211faU,
+  0x0a2d5400U, 0xf3f40200U, 0x09f80000U, 0xfee4eb00U, 0x00f225eaU, 0x00f11655U, 0x00e50ff2U, 0x00b4f70aU,
+  0x2bee2efdU, 0xebe51a11U, 0x0d15e4d0U, 0xee35a8a9U, 0xf2df4515U, 0x10fa0518U, 0x1f04cb0aU, 0x2a28bafbU,
+  0xddfcb1f6U, 0xfef8dee3U, 0x24fff65fU, 0x13b80e19U, 0xe1305ad0U, 0x37dfe2b9U, 0xef8405caU, 0x1db2de09U,
+  0x08fb000eU, 0x10fc00f5U, 0xfcf000eeU, 0xfc0d00fdU, 0xfe01e2faU, 0x6709edaeU, 0xf243e6ebU, 0xcd0234deU,
+  0x041b2000U, 0xd727e900U, 0xdc260300U, 0x0c0ef300U, 0x00d1ebffU, 0x00075afbU, 0x000d33ccU, 0x00e40adaU,
+  0xd0f5d21fU, 0xef141430U, 0xdb1fd8efU, 0x0d0ad8d2U, 0xe12fb007U, 0x06adcd2fU, 0xf811f514U, 0xf7d81ff6U,
+  0xfac21cdeU, 0xdf2d05e9U, 0xe72a051cU, 0x1d4eea3eU, 0xeb06020fU, 0xab0f5040U, 0x1ca10605U, 0xf407f1f8U,
+  0x0bfc00b9U, 0xe11800d8U, 0x07ed0007U, 0x061700d8U, 0xe50ff8e1U, 0x441102d2U, 0x0b2711f8U, 0xff1623f8U,
+  0x342c1400U, 0xcd0aeb00U, 0xe8321900U, 0x0410ef00U, 0x00f8e2c3U, 0x00033109U, 0x00e71fafU, 0x00fee80cU,
+  0xf7e3c93aU, 0x1d10d934U, 0xc9300708U, 0xdcfcdbc6U, 0xc7fdaf1fU, 0x02d9dc45U, 0x1f08fbf3U, 0x27f4e2cbU,
+  0xcf922bfaU, 0xf53afff2U, 0x2841af60U, 0x0c345019U, 0xc3ec0200U, 0xb11b5235U, 0x12bc03f1U, 0xd012dd02U,
+  0xf41400d5U, 0xfa0c0002U, 0x04fe00e8U, 0xf50200bcU, 0x07f514c7U, 0x290509ceU, 0x0b3114e2U, 0xfa1700faU,
+  0x0b4c1200U, 0xf5120b00U, 0xda2f1500U, 0xf8070800U, 0x00ed29c1U, 0x000c120dU, 0x00e1ebc5U, 0x00f9dc34U,
+  0x0ae6fa5cU, 0x10f8d11fU, 0xbc1c21d9U, 0xaee9cdcbU, 0x0dfbeaecU, 0xfef9fd2eU, 0x2a21b30cU, 0x4a15c3d6U,
+  0xc2f40914U, 0x0b151409U, 0x323fbf69U, 0x0bf9372dU, 0xd7fc08eaU, 0xb4f82328U, 0xd0bbfcfeU, 0xf2eadb0dU,
+  0x25d300f3U, 0xf1fa000eU, 0xf7f600f7U, 0x10eb00bcU, 0x2b0810faU, 0xf400ffe9U, 0x0a2f1ad9U, 0x04ff1aeeU,
+  0xea59f800U, 0xfefe1c00U, 0xbf4ff300U, 0x1c210700U, 0x00ca56d3U, 0x00fb1700U, 0x00def2eaU, 0x00cbd30dU,
+  0x1211180dU, 0x21ef0e19U, 0xc418f9d6U, 0xcc21bff2U, 0x0c2003d7U, 0xf11de913U, 0x35299efdU, 0x1d2de7efU,
+  0xe6d902e3U, 0x121af413U, 0x161df76eU, 0x09dd0008U, 0xc1f70cfdU, 0xfe0c04ffU, 0xc39bfd20U, 0x49d9cd2aU,
+  0x3bb400e7U, 0xa7100016U, 0x1af20003U, 0x30df00e9U, 0x032df517U, 0x1cfbeb09U, 0x140017f0U, 0x1f0014d2U,
+  0xff291700U, 0xf6181a00U, 0xee20ef00U, 0x1c321100U, 0x00f726d5U, 0x00fe0157U, 0x00cdeb05U, 0x00a8ef12U,
+  0x441c17dbU, 0xfbe02232U, 0xdf19f0cbU, 0xff03cee6U, 0xeb170b0dU, 0x0d04fb28U, 0x1d0fcb13U, 0x2328daefU,
+  0xe2dbca01U, 0x0931f2e1U, 0xead7e02aU, 0xeee0d6deU, 0xc8fb03c4U, 0x15f004dfU, 0x00a6f107U, 0x31d7deebU,
+  0xea13002aU, 0x00e900e7U, 0x0ae300e8U, 0x31010005U, 0x20e0ddceU, 0x2209c6d0U, 0x8120d501U, 0xa91b0ae5U,
+  0xf4601e00U, 0xf226f800U, 0xf3dcf900U, 0xf8e6ee00U, 0x0004ec0aU, 0x003836ecU, 0x0002ffbbU, 0x00b9fa05U,
+  0xe804fa15U, 0xe7f22b1cU, 0x2d05d1f2U, 0xe5cfdbe5U, 0xe319bbfdU, 0x19d5da51U, 0xeafecbf4U, 0x1fe0e8ebU,
+  0xe4f32e01U, 0xcd21eef5U, 0xef4df328U, 0x4b47d216U, 0xfbcdf609U, 0xd5d23b02U, 0x05b02aeaU, 0x31e308efU,
+  0xebe2001cU, 0x10ff00f5U, 0x16c800cfU, 0x23f900cdU, 0x26060cb9U, 0x1603c3ceU, 0x9de517f5U, 0x0fec13deU,
+  0x09241200U, 0xf21af500U, 0xd6c30300U, 0x020cd400U, 0x001a0aebU, 0x00465bf1U, 0x00e5e5bdU, 0x00b6f2edU,
+  0x4641ea1dU, 0x23101619U, 0xe10bd0fcU, 0xb181fcccU, 0xe9f6a409U, 0x24d1f07fU, 0xf238d6efU, 0x1af01ecaU,
+  0xe6e23a07U, 0xeb2de303U, 0x1952bf2cU, 0x47ffffecU, 0x00dd21fdU, 0xda08620cU, 0x0599deedU, 0x1c0bdf00U,
+  0x09d5000cU, 0x16f8002eU, 0x11be00beU, 0x091f00b8U, 0x2b31189eU, 0x0e15ecd6U, 0xccfe3cf1U, 0x27e716fcU,
+  0xe612ec00U, 0xff040300U, 0xc9eeed00U, 0x03181500U, 0x00fafcd9U, 0x002e3402U, 0x00bfbde2U, 0x00c801efU,
+  0x3f32e60dU, 0x4326223cU, 0x9712f1dcU, 0xe1c3ebecU, 0x2e0da7f7U, 0x0abfca66U, 0xde60b9ecU, 0xd40344e2U,
+  0x022222f8U, 0x20261614U, 0x28d49314U, 0x1aa4d9b2U, 0x08b83102U, 0xb5182f19U, 0x22b6ee2cU, 0x2d5ef223U,
+  0x4bbf00deU, 0xe8e30029U, 0x33bf00e0U, 0xf51900e1U, 0x222814c1U, 0xe539fff8U, 0xe2f433eeU, 0x0cdce5f1U,
+  0xcddbe600U, 0xe4f93100U, 0xb202e000U, 0xff2e1300U, 0x00edd4cdU, 0x002d2100U, 0x00b3dfd3U, 0x00ce24d1U,
+  0x2920ffedU, 0x392d1036U, 0x8ff2fc08U, 0xf802daf6U, 0xeb3fd2feU, 0xfaedd72fU, 0xec38bd01U, 0xc51b0cf5U,
+  0x1d1012faU, 0x0c501216U, 0x04a2ba05U, 0xe3a7c4e0U, 0xedaa1608U, 0xa4ef24fbU, 0x19980132U, 0x273ee540U,
+  0x1fcd00c7U, 0xc9fe0040U, 0x33e600dfU, 0xf4fc00eeU, 0x042102f5U, 0xb511f7f7U, 0xdaf210f7U, 0xcef6f4deU,
+  0xe0f61c00U, 0xf40e2d00U, 0xe60df600U, 0x061aff00U, 0x00f8d6d6U, 0x00262e26U, 0x00b6f1e3U, 0x00ce0be0U,
+  0x3d2dfcf1U, 0x39100658U, 0xd1c8fad6U, 0x0bbce5e4U, 0xd72aef16U, 0x12fbf52fU, 0xebffee04U, 0xf811f4ffU,
+  0xfa2dfe0aU, 0x0b6ef923U, 0xf2c1ebf7U, 0xf2e9d9ecU, 0xe4bb00f2U, 0xb6ed1000U, 0x1ecafd0fU, 0xddfdff25U,
+  0x3c0a005dU, 0xd2ea000dU, 0x19ef00eeU, 0xfdf200f6U, 0x13ecffe7U, 0x0b4afc06U, 0x1d13f223U, 0x11f1fa0eU,
+  0xfc213800U, 0xfb1ff500U, 0xfa1bea00U, 0xfe0e0100U, 0x001f2a1dU, 0x00f74a0eU, 0x000e3716U, 0x00b1440eU,
+  0xf6221141U, 0x02064e03U, 0xfb2b3ceeU, 0xf502f205U, 0x0afefd11U, 0xfdd1d5fcU, 0x09e80907U, 0xfafde108U,
+  0x0821f8f6U, 0xd603f3f9U, 0xda190c04U, 0xe302fcd6U, 0x12e4e90cU, 0xf1f12501U, 0x03c01011U, 0xf00b0f06U,
+  0x1dfd0039U, 0xfaf200fbU, 0x13dd00faU, 0x08df000dU, 0x00d207c7U, 0xe579f1dcU, 0x3be5eb25U, 0x2ff20035U,
+  0xd4d64500U, 0xdf2a0d00U, 0xdb19d500U, 0xfc44ed00U, 0x00180d21U, 0x00f047d0U, 0x00f74334U, 0x00b334f8U,
+  0xe63a0617U, 0x290a17fbU, 0x0925222eU, 0xeed30014U, 0x20141804U, 0x0de7b721U, 0x21e4fc15U, 0x250dde28U,
+  0x0e03fce8U, 0xe05df8eaU, 0xd41f220dU, 0xf42addd0U, 0x29e8ea01U, 0xb7d41600U, 0x00a40a00U, 0xf4132102U,
+  0x2538000aU, 0xf9e200f3U, 0x1f290004U, 0xf2db00faU, 0xe6dbf5eaU, 0xf131fdf0U, 0x2ee5e31dU, 0x1000002eU,
+  0xe7c02900U, 0xcc1f3d00U, 0xca0dc900U, 0x1845d000U, 0x002df415U, 0x00043e81U, 0x001141e5U, 0x00cd4408U,
+  0xd215050bU, 0x5405ee0aU, 0xf324181fU, 0xfaccfc2fU, 0x2b171c12U, 0xe719b434U, 0x0acef71fU, 0x19ecf622U,
+  0x0efff8eeU, 0xe53dcff2U, 0xdf132b07U, 0x0f2be705U, 0x0bfc0e0fU, 0x99cf25fdU, 0xeac83d1dU, 0xea1b0515U,
+  0x093e0007U, 0xfbee00e8U, 0x1838000cU, 0x0bf900f2U, 0xf9c506fbU, 0x172dfa15U, 0x4ce0071cU, 0x1fee081bU,
+  0x23d22900U, 0xd3373600U, 0xdd1fcd00U, 0xfb54e500U, 0x00380323U, 0x00022b9aU, 0x000b31cfU, 0x00c222f5U,
+  0xc1001714U, 0x44fbe3efU, 0xdd39eef3U, 0x19ffe72dU, 0x26e919f4U, 0xfe2d9f29U, 0xefd7db2aU, 0x140f1224U,
+  0x1ef5ec05U, 0xed06d0e5U, 0xf3f7190eU, 0xfd35f812U, 0xfa2924efU, 0xb4d80706U, 0xd2e64529U, 0x0218fa21U,
+  0xfa2800f1U, 0xf0ec00c8U, 0xfc1f0021U, 0x19240017U, 0x00e9fd00U, 0xec39fe27U, 0x0fff1305U, 0x5e2e0c11U,
+  0x03e5f900U, 0xe6262900U, 0xf4d5c900U, 0xfb56d300U, 0x002af916U, 0x001220d3U, 0x002cfa18U, 0x00d0080eU,
+  0xe0fd2810U, 0x23decd29U, 0xef23d019U, 0x201237d1U, 0x04ee0204U, 0x0e10dc0cU, 0x1ef0051cU, 0x0af60417U,
+  0xf209d3fbU, 0x1328c210U, 0xe024db09U, 0xf7390303U, 0xe3090bf0U, 0xc3e1faecU, 0xe503f2f9U, 0x221f081eU,
+  0x34080065U, 0x0cef0032U, 0x4ad000cfU, 0x2ce900dcU, 0x19da02eaU, 0x031bfb01U, 0x0c0701f7U, 0x23fcfddeU,
+  0xf41c4700U, 0x012d0500U, 0xe4dbdc00U, 0xfe0dec00U, 0x00f92926U, 0x00383e05U, 0x00f55b07U, 0x00e463dfU,
+  0xe52a3631U, 0xf8f83f34U, 0xe52a10fdU, 0xd4f8ba35U, 0x1529db11U, 0x0cb3d32dU, 0x35f6ed33U, 0x07d6d72bU,
+  0x041e01fdU, 0xcd13f4c5U, 0xb715f0b6U, 0xc002d9dfU, 0x28d40efbU, 0xe4d226ebU, 0x2abc24f6U, 0xcb0d15fcU,
+  0x5a15005eU, 0xfbe300eeU, 0x2fe400dbU, 0x050100deU, 0x0fb1f8faU, 0xe26425f1U, 0x0c0ed9f8U, 0xf21b0dfbU,
+  0xf9004100U, 0xee411400U, 0xdb00c800U, 0xf115fa00U, 0x00e20cf4U, 0x00fa45d0U, 0x00f82a11U, 0x00f94dbcU,
+  0xb2112315U, 0x071d3c44U, 0xe4fd27f9U, 0xc8cde72cU, 0x03341f0fU, 0xeeffe51cU, 0x38f41a4eU, 0x22eeea33U,
+  0xddff18fbU, 0xc702dccaU, 0xd3f50ce5U, 0xe8fce30dU, 0x33f8eb0bU, 0xd30229e8U, 0x4cc42c04U, 0xbff524e7U,
+  0x311a001eU, 0x26f100edU, 0x07200015U, 0xf0d200caU, 0x17c9e5dbU, 0xe5563f25U, 0x05f4d2f9U, 0xd70700d8U,
+  0x1aea2f00U, 0xcd242b00U, 0xff3ec100U, 0x030aec00U, 0x00182012U, 0x00f013baU, 0x00037230U, 0x00f74216U,
+  0xca062008U, 0xff29021fU, 0xbacf3a16U, 0xf1c70d0cU, 0x01363003U, 0xbc1f0323U, 0x30ff2b33U, 0x11ecfe16U,
+  0x13f526eaU, 0xeabee8ffU, 0x04fa1104U, 0x1e04dffdU, 0xfceabd28U, 0xaf1242c9U, 0x17cf381bU, 0xe7fb22f7U,
+  0x021f000eU, 0x2be200c6U, 0xd92f0029U, 0x00f400f8U, 0xf9c6e00dU, 0xfa314120U, 0xf2e0ef1dU, 0xdd0c170aU,
+  0x12d81a00U, 0xe3203b00U, 0xaf41f600U, 0xd326e400U, 0x005d1823U, 0x00f623a1U, 0x000d4231U, 0x00f7381eU,
+  0xd60e2e14U, 0x2907efe8U, 0xb7020c06U, 0x1ee3f321U, 0x1c111e0eU, 0xe7efef2bU, 0x42feef31U, 0xcfbd01fdU,
+  0x231f0be5U, 0xfb9bd5f3U, 0x031e161aU, 0x0c10c829U, 0xed1b132fU, 0xbff033d3U, 0xddc9103cU, 0x0cfa23fdU,
+  0xed4300f7U, 0x41d60093U, 0xdc3a0018U, 0x1cd000eaU, 0x10f10214U, 0xb62e0f24U, 0xd412100cU, 0x601e3507U,
+  0x1dfcfc00U, 0xbe182300U, 0xc61def00U, 0xf84ec700U, 0x007ff611U, 0x00121293U, 0x0010fa19U, 0x00e60af3U,
+  0xd9ea392dU, 0x55eba6f6U, 0xe0220f4dU, 0x18e23b02U, 0x19e32df8U, 0x3409db28U, 0x0b10df21U, 0xdbc91010U,
+  0xed1bd1f7U, 0x33fcf71eU, 0xf625de2aU, 0xf109b9fcU, 0xb90c3613U, 0xb1f3f1eaU, 0xb9da0434U, 0x57204039U,
+  0x69ef005cU, 0x021b0034U, 0x7fb000feU, 0x19f300f1U, 0x1c0df9f6U, 0x39f92416U, 0xecefdff1U, 0x1448e5c1U,
+  0x030e3600U, 0x06111800U, 0xdde1da00U, 0x095ade00U, 0x00cc1a4bU, 0x002231e1U, 0x003f64e3U, 0x00027fa1U,
+  0xda1b3826U, 0xeadd0770U, 0xb200f644U, 0x210ad967U, 0x011ef439U, 0xf5c6f31fU, 0xfe0c2454U, 0xe4cac505U,
+  0xf1180ce1U, 0xeaeaffb7U, 0xd2cfddb5U, 0xd1f712f8U, 0xfecaf9f9U, 0xdc351af1U, 0xf7a04ce7U, 0xbab43007U,
+  0x3d0c005eU, 0xf61b0000U, 0x40c300fdU, 0x23f300daU, 0x0afd0f01U, 0x33193206U, 0xf2d0ec1fU, 0x0b08e9d7U,
+  0x35dd2c00U, 0x22440b00U, 0x23e1fc00U, 0xef69e400U, 0x00c446e4U, 0x003b35eaU, 0x002e1309U, 0x00f751b2U,
+  0xf600dc0aU, 0xe5ef1377U, 0xb2dd151cU, 0x031eee5aU, 0xef210e5eU, 0xb6fff2feU, 0x211c2133U, 0xd3e9e015U,
+  0xe92425c5U, 0xc9d3eb9aU, 0xeeb2cdbaU, 0xee08f21bU, 0xf801d901U, 0x2d252df8U, 0x22c334f5U, 0xfdea4909U,
+  0x37eb00d5U, 0xff08000eU, 0x2ced00f7U, 0x10e700ecU, 0xf100f20aU, 0x02053ffcU, 0x04ded913U, 0x303413c8U,
+  0x3ded1a00U, 0x094e0900U, 0x19021000U, 0xe153ff00U, 0x00074dc8U, 0x001238e2U, 0x00004a37U, 0x00e855ddU,
+  0x01d9e2f9U, 0x24062747U, 0xb5f53e24U, 0x021ce735U, 0x172c214cU, 0xa223e2fdU, 0x1d1a1314U, 0xdce2da04U,
+  0x0af107d4U, 0xd0fd01bfU, 0x0bf3b4cdU, 0x1319cf0aU, 0xccf61109U, 0x012718f2U, 0xdcee380dU, 0xfddc44eeU,
+  0x170500d8U, 0x22fc00d8U, 0x0a26001cU, 0x2bde00f5U, 0xd204de24U, 0xfd0830ecU, 0x10f21d12U, 0x440115ecU,
+  0x19f10e00U, 0xed311900U, 0xd1081a00U, 0xcf481100U, 0x004729f9U, 0x00092cf0U, 0x00005d1bU, 0x00024cd9U,
+  0xeced48f1U, 0x20f34824U, 0xc2103a25U, 0x4efef115U, 0x091b411fU, 0xd1eb0304U, 0x1507ec30U, 0xd2ac0fd4U,
+  0x09f9d6e6U, 0xf5c6faecU, 0x140ed2f2U, 0x1540abfeU, 0xba003415U, 0xfa4406e0U, 0xf9ec2512U, 0x20f728d3U,
+  0xe73000e6U, 0x10d500b2U, 0xd8f300fcU, 0x25c800f6U, 0x0607ef30U, 0xb71318e0U, 0x17111d08U, 0x7e26240fU,
+  0x17f9f200U, 0xdd292200U, 0xca0c0b00U, 0x002cf300U, 0x0055faf6U, 0x001414d4U, 0x000cdf26U, 0x00ec29cbU,
+  0x13eb4517U, 0x1317d9e0U, 0xeefd2a1cU, 0x0aeef71bU, 0x09e25f10U, 0x1228e00cU, 0x0e2f0138U, 0xe4c2210fU,
+  0x0c0bdff3U, 0x24e00d0bU, 0xfb58bc03U, 0x100e9f28U, 0xe31a320cU, 0xd90addd3U, 0x20f20526U, 0x2e1c2df3U,
+  0x6be5001aU, 0xee1f001eU, 0x6cd5003fU, 0xfaec0004U, 0x12f2ffceU, 0x4eedf641U, 0xd839daedU, 0xda2ebceeU,
+  0x0d1cfb00U, 0x22ea1a00U, 0xde11f600U, 0xf7e1fe00U, 0x00dc3d38U, 0x00031806U, 0x001174cfU, 0x0013f3e1U,
+  0x0200061cU, 0xfcdbfc6eU, 0xecee305aU, 0x572ac323U, 0x0ee2f756U, 0x0127f30aU, 0xe8dbfd5fU, 0xeaf4ae1fU,
+  0xd61700ddU, 0xd81011deU, 0xdfe0f3c1U, 0xf1201e1fU, 0xe8ef01f2U, 0xdc402f11U, 0xf0d674e3U, 0x0f9b180bU,
+  0x71ec00f7U, 0xc2300005U, 0x49d60050U, 0x09cd00fdU, 0xcdd11ccdU, 0x4ad726ebU, 0xd1190314U, 0xd42fe1c3U,
+  0x2be2e600U, 0x251d0900U, 0xfffd1e00U, 0x132cf000U, 0x00c319c3U, 0x003017feU, 0x004c24f6U, 0x00da0b97U,
+  0xfceee605U, 0x0ceaf056U, 0xfcc52a33U, 0x6b31d167U, 0x25fa2c5dU, 0xd90a0800U, 0x0aee1661U, 0xcefecc16U,
+  0x03c42be0U, 0xda1a1ec5U, 0xf7bfdccfU, 0xfe57e441U, 0xbb0c06fdU, 0xd22c1725U, 0xd8f266e3U, 0x2388360aU,
+  0x3df300c6U, 0xe52b0024U, 0x27d40032U, 0x4eba0006U, 0xb8cef4efU, 0x1cee38c9U, 0xe4f1f5fcU, 0xf42af1adU,
+  0x2710f200U, 0x0524f400U, 0x0d023300U, 0xd5411000U, 0x00f53ba6U, 0x000b0123U, 0x003b5310U, 0x00d32ba6U,
+  0xe9dff6f1U, 0x31f4fc04U, 0x20db2c4dU, 0x1f102858U, 0x2f06543fU, 0xd1fd07f4U, 0xfdf1082aU, 0xc1f5cc00U,
+  0x17a2f1dcU, 0xfe2036ceU, 0x0917d0cdU, 0x0b4acc3dU, 0xb81d1bccU, 0xf31d10ffU, 0xcbe723d1U, 0xee8f30d4U,
+  0x08fe00d0U, 0x03eb00e1U, 0x21ea0005U, 0x41d500faU, 0xe3f7f236U, 0xf1dc0edbU, 0x0bf2f429U, 0x3a280ebcU,
+  0x12300500U, 0xe7350900U, 0xedec4800U, 0xc9220000U, 0x002341ecU, 0x003eef17U, 0x00412c01U, 0x00ed2aadU,
+  0x0c0346efU, 0x2be5f2e8U, 0x29080239U, 0x2d111c06U, 0x0a292d0dU, 0xfa000cefU, 0xf8f1fe10U, 0xcdedf6ebU,
+  0x0cf4e5f8U, 0xff1133f3U, 0xf32ee5ebU, 0x2f190117U, 0xc41136d4U, 0x0f1ff806U, 0x12e6f9ceU, 0x04b70ad9U,
+  0xf42a00ffU, 0x0ef200afU, 0xebf700edU, 0x22c700f7U, 0x0efb024bU, 0xc80d1ae0U, 0x2022ea38U, 0x3f230d08U,
+  0xf5fcf800U, 0xb82d3300U, 0xebcc3900U, 0xebe80500U, 0x00390106U, 0x0026fc0dU, 0x0043eaf4U, 0x00f100cdU,
+  0x08083600U, 0x2504bfedU, 0x0c020019U, 0x0f0ff426U, 0x020841fcU, 0x1c180afdU, 0x01411727U, 0xdbe81c0fU,
+  0x19ede6e2U, 0x1cdf3e07U, 0x162cfef7U, 0x150ede02U, 0x03f612cdU, 0x15feea03U, 0x2ffd06eaU, 0x11f3e0cfU,
+  0x04e20003U, 0xd01e000bU, 0x3bec0001U, 0x30f20016U, 0xf5f3f0f2U, 0x2300d217U, 0xca44d438U, 0xfeceb9efU,
+  0x04fbe300U, 0x19f80300U, 0xf8f50a00U, 0xe5270a00U, 0x00fef9f4U, 0x00fe3211U, 0x003b60d8U, 0x0024d5e0U,
+  0xe8ede60cU, 0x21fe2828U, 0x2df81d2cU, 0xfe42d2f5U, 0xe4fd282fU, 0x2a25d621U, 0xcc04ec5aU, 0xe106d0e7U,
+  0x16cdfb13U, 0xcc40410dU, 0x0918201aU, 0x15d80f11U, 0xf3f002f7U, 0xd8421d19U, 0xe1f83713U, 0x2ca2f2edU,
+  0x4eed00dbU, 0x9b1f001dU, 0x37fd004dU, 0x36b9000bU, 0x01dff9fdU, 0xedeedaf7U, 0xa315dc1cU, 0x0df3eadfU,
+  0x1900d000U, 0xecdbef00U, 0xd7124200U, 0xf4fd0000U, 0x00dd01c9U, 0x0021f85cU, 0x005b4c06U, 0x0022a5cdU,
+  0xe7f1d609U, 0x4dfe0f1dU, 0x2e160f26U, 0x4353e004U, 0xe611323dU, 0x2bf8be09U, 0xeadcec6dU, 0xb746bdcbU,
+  0x1ec7e4ffU, 0xda204514U, 0x0d1b1513U, 0x1eeddf1bU, 0xde0928e7U, 0xfa04f70aU, 0xf2f94ae5U, 0x1e91dee8U,
+  0x1ee300d8U, 0xcdf20021U, 0xeeec0054U, 0x3bb000dcU, 0xf2dbeb1dU, 0xff0f19cdU, 0xf1d7f22fU, 0x14310cb6U,
+  0x330ecd00U, 0xddf9d800U, 0xf10a6d00U, 0xfbc11a00U, 0x00db10baU, 0x0014db45U, 0x003f21dcU, 0x00f5c7bdU,
+  0xedd4f2f2U, 0xe50616d2U, 0x361f2324U, 0x452a10efU, 0xef1b2e37U, 0x1afcd6e4U, 0x08fbf423U, 0xb33aafc1U,
+  0x25d6ece9U, 0x0e1c1b09U, 0x000c1f17U, 0x34fd0e20U, 0xcdfc1af2U, 0x01c5f112U, 0xe5e229a4U, 0xf6acf020U,
+  0x08ca00ecU, 0x08d500f3U, 0xc6d500e6U, 0x2fb800baU, 0xe62cec32U, 0xcf1717f7U, 0x1714242cU, 0x102108cdU,
+  0x0ef4ea00U, 0xa010fe00U, 0xf4ea5900U, 0xf5bc0200U, 0x000206eaU, 0x0015d32eU, 0x003bd6e5U, 0x00e5ecd6U,
+  0x08e90de3U, 0xcff41397U, 0x182b28edU, 0x352b06f1U, 0xf6331918U, 0x200ffef9U, 0x1509f007U, 0xbb37e8ddU,
+  0x1e24ff14U, 0x14440401U, 0x0ffb3804U, 0x2ed32e03U, 0xfaed09e4U, 0x0fd1f72aU, 0xfcc109d5U, 0x14a1f421U,
+  0x0bfd00f2U, 0x34e500b6U, 0xd0d300d8U, 0x0ebb00ccU, 0x08150640U, 0xcc110212U, 0x0a141e18U, 0xe813f5efU,
+  0xf5f50100U, 0xde150d00U, 0xf5024800U, 0xe9c61200U, 0x0013f22dU, 0x00f6070fU, 0x002118d3U, 0x00d5e3e0U,
+  0xffe31dfbU, 0xf3fbfec5U, 0x40490d03U, 0x4d1df1f9U, 0xf62217fbU, 0x471802ddU, 0x044515fcU, 0xdc0c0beeU,
+  0x1619e41aU, 0x1b0c0504U, 0x12101715U, 0x26f91406U, 0x2c0a0bcbU, 0x00d60bf5U, 0xedeaf4dcU, 0xffd0ffe9U,
+  0xff0700faU, 0xf0ff00ffU, 0x0e0100fbU, 0x01e8002dU, 0x08ff03f8U, 0xfcdd05e3U, 0xfcf001feU, 0x160df10eU,
+  0x070a1500U, 0xf6ff0e00U, 0x05e3f700U, 0xf6121600U, 0x00130502U, 0x0031daf5U, 0x000cf3fbU, 0x0026402bU,
+  0x01ff08f1U, 0x0404ff0aU, 0xfc06de00U, 0xfc1e4507U, 0x07f9ece2U, 0x022009dcU, 0x01fd0113U, 0x0ceeda00U,
+  0xf6e307faU, 0x12d10001U, 0x150bf908U, 0x1409fa25U, 0x04fbfd08U, 0x14eef5fbU, 0x07ffe9ffU, 0xf7c40a04U,
+  0x070200e4U, 0x040100ebU, 0x050100ebU, 0x0afc0029U, 0x27e50202U, 0x19dc0ae5U, 0xf4ee0eceU, 0x2114d604U,
+  0x091e1100U, 0xe4f5e300U, 0xf8dbfe00U, 0x0a103d00U, 0x0019f7edU, 0x0030fa14U, 0x0021d80bU, 0x00f32651U,
+  0xf40f01f5U, 0xd41721cbU, 0xf0f9fcf3U, 0xf3072fefU, 0xf60cf2f0U, 0xe30802d3U, 0xf8ff03f6U, 0x43d9c61fU,
+  0xf4f1fcfbU, 0x0bbc100eU, 0x1cecd810U, 0x0e23f916U, 0x04f60619U, 0x28c300fbU, 0x08fee8f4U, 0xf3af07ebU,
+  0x010a00e3U, 0x101600e4U, 0xf80f00fcU, 0x14350005U, 0x35f409fcU, 0x25e509e3U, 0xf00617e2U, 0x0a14ced2U,
+  0x0f151700U, 0xd6cfba00U, 0xe7dbed00U, 0xdc1c4700U, 0x000bf7f9U, 0x001b063fU, 0x000edc3dU, 0x00f6370eU,
+  0xdf0bfb05U, 0xc5341fb5U, 0x020d2bd3U, 0xf7020a19U, 0xe7fc08f1U, 0xc70205d9U, 0xf3f811edU, 0x3ae0c137U,
+  0x01f814faU, 0x3ad71506U, 0x1e07d206U, 0xf92af9ffU, 0x0f0f00fbU, 0x2cc4f7f4U, 0x171601f4U, 0xb8c319eeU,
+  0xfc0700f9U, 0x1b120009U, 0xe4050009U, 0x1136001fU, 0x181008f2U, 0x24d211e7U, 0xf6e615f3U, 0x1905cdf7U,
+  0xffdc2100U, 0xcce3ca00U, 0xebe8c300U, 0xba264c00U, 0x0007f2f7U, 0x001f042bU, 0x00f2ea30U, 0x00082200U,
+  0xf6e11c25U, 0xb34506d7U, 0x0cff21e1U, 0xf7f9fc28U, 0xe4dffefaU, 0xc505fa0cU, 0x000039fbU, 0x3ff5ad21U,
+  0x0bf0150cU, 0x24cc28feU, 0x0d17eae2U, 0xe056ff19U, 0x0012f7e2U, 0x33e8fcdaU, 0x193a0ef9U, 0x85c802f5U,
+  0xf1140002U, 0x0e0c0012U, 0x06f400f7U, 0x32240012U, 0xf70cf8f1U, 0x3bc819e6U, 0x07110b05U, 0xf03a0214U,
+  0x0828ed00U, 0xe9f8d800U, 0x0be4fd00U, 0xa44f3c00U, 0x00f31706U, 0x0033222bU, 0x00f9f02bU, 0x00f527feU,
+  0x15dd0ce5U, 0xc74cf3fcU, 0x1b143afdU, 0x1ee50d0fU, 0xfff9fcf5U, 0x0108f308U, 0xf1ef2b07U, 0x24f8cd17U,
+  0x01f9100eU, 0xf3c31dfcU, 0xf335cedfU, 0xf359e928U, 0x111316f2U, 0x20e8f9f1U, 0x0e251bf6U, 0xa3e803f4U,
+  0x091b00f1U, 0xfc050001U, 0xf21000f5U, 0x38df002bU, 0x12f10c15U, 0xfee30013U, 0xdfea0aeeU, 0x1030eb01U,
+  0x07110500U, 0xf3c71800U, 0xffd40200U, 0xf1b93500U, 0x0002ffe9U, 0x000bd5ebU, 0x0017ddf3U, 0x001a4135U,
+  0x0307f9e4U, 0xd202eef1U, 0xf90ee205U, 0xdf2c48f9U, 0xfde60ffcU, 0xe12b22deU, 0xf60ff8fbU, 0x33d8c72aU,
+  0x00fb040cU, 0x27d1ee05U, 0x16f10e11U, 0x241ff515U, 0xfb05fffdU, 0x32fe1306U, 0x01fe0105U, 0x11940ae4U,
+  0xf91f00e5U, 0x1feb00eaU, 0xf51200eeU, 0x2dfc0011U, 0x15dc1b15U, 0x06c5ff11U, 0xec0218d8U, 0x293fe3f6U,
+  0xfc2afb00U, 0xf3b2e800U, 0xe6d40000U, 0x2dc83700U, 0x002608d7U, 0x001becf6U, 0x000ac814U, 0x00f84d2bU,
+  0xfc15f2efU, 0xb71905bbU, 0x08ffe0efU, 0xdb0244eaU, 0xddef09f5U, 0xc630f4e5U, 0xf209fde2U, 0x56b3b052U,
+  0x170708ffU, 0x1dced207U, 0x13f1ed2dU, 0x02fdd3feU, 0xe914ec01U, 0x42f7fa0eU, 0x1b020106U, 0xcde43cd2U,
+  0xfbfd00e3U, 0x180800e4U, 0xea1800f1U, 0x161700fdU, 0x17e30ef4U, 0x0cd3e9faU, 0xfc1af2f3U, 0xd93fd902U,
+  0x03090000U, 0x00b5e300U, 0xe6daf800U, 0xd2000f00U, 0x000cf408U, 0x0037e91cU, 0x000cbd14U, 0x00fe0e0aU,
+  0x082bf2ecU, 0xd50e0dc7U, 0x03fbf9feU, 0x2a0e37f0U, 0xebf90cffU, 0xda1905feU, 0xf4f301e4U, 0xece1d430U,
+  0x1e152208U, 0x30f3c901U, 0x070ff616U, 0xd90ae5e7U, 0x0511e8f3U, 0x110b26f0U, 0x05210117U, 0xb5fe36e5U,
+  0x041700e0U, 0xfb070035U, 0xebfd00f4U, 0xfe2200e7U, 0x041111fdU, 0x08cedf01U, 0xf818faecU, 0xfc1af804U,
+  0xf5f10e00U, 0x16c4ee00U, 0xf9ebd800U, 0xd3020b00U, 0x0017e111U, 0x001ceb44U, 0x00ffdee6U, 0x000c2602U,
+  0xf40c17ecU, 0xb51c27fcU, 0x0bf10800U, 0x382c2226U, 0xe4e80eeaU, 0xc91a2a10U, 0xf1defef0U, 0xe3ebdb0cU,
+  0x050c1913U, 0x1e0ff8fdU, 0xee1bf9f1U, 0xd21700f1U, 0xf92ee7e8U, 0x14fd15dbU, 0xfa1a1d18U, 0xeb1b39eaU,
+  0xfc150003U, 0xbaec0018U, 0x090000edU, 0x2f1100e1U, 0xebf504feU, 0x18cc0308U, 0x12170802U, 0xe068feffU,
+  0x01e3ec00U, 0x03ed0c00U, 0x04fe0100U, 0xa4f83400U, 0x0021f1feU, 0x001d0447U, 0x0000140fU, 0x00f824dfU,
+  0xf0f208dfU, 0x9b1a20fdU, 0x030b2f00U, 0x3a0cde1dU, 0xedfa03f7U, 0xf12b2b19U, 0xeedc2903U, 0xf3c0cc24U,
+  0xf2ef100eU, 0xe914e8f0U, 0xe814ece3U, 0xfa5ed72fU, 0x0f26eb11U, 0x3bd61cf2U, 0x15312ef5U, 0xbd34fe10U,
+  0xfe1b00f1U, 0xde0e00ffU, 0xf9050006U, 0x6a030020U, 0xf01e1e0bU, 0xead9fa2cU, 0xebf1feecU, 0xea050628U,
+  0xf7150400U, 0x0bf81a00U, 0x09f10000U, 0x08903b00U, 0x00ec0fdfU, 0x00c5e8d5U, 0x00f7e3f5U, 0x00e7f413U,
+  0x2400d1f9U, 0xc300ebfbU, 0xf012fe0cU, 0xf115ff04U, 0xfeda0ce4U, 0xd0400ae0U, 0xff0703ecU, 0x3ef1f039U,
+  0x1135db1bU, 0x18980008U, 0x15de120dU, 0x2af3de10U, 0xed0c010cU, 0x162a2515U, 0x06fc0a0aU, 0x25fcdeb8U,
+  0xff2400ecU, 0xf9e600f9U, 0xf7fe00ebU, 0xfa0d0010U, 0xef000903U, 0xf5e8070dU, 0xff02f6ebU, 0xd5240d18U,
+  0xfd23ef00U, 0xf9f80300U, 0xe9ecf200U, 0x37c52300U, 0x00f807ebU, 0x00e8c9d5U, 0x00f1c504U, 0x00fe2814U,
+  0x2413e2ecU, 0xfa26fae1U, 0xee00ebf7U, 0xdeea3c05U, 0xefc91af2U, 0xbd451cf8U, 0x072104e2U, 0x51c20d34U,
+  0x00260338U, 0x17e0e9ecU, 0x13ed001bU, 0x1adcc5e6U, 0xbd1001f8U, 0xff1f2e10U, 0xf8000114U, 0xfc3115adU,
+  0xff0600f2U, 0xf3f90009U, 0xf9ff00d4U, 0xe6fd0013U, 0xf91d03e3U, 0xf3efedeeU, 0x0917fcfbU, 0xc820190fU,
+  0xeb25e500U, 0x32ff0d00U, 0xfffae100U, 0x0bf5f000U, 0x0007e3dfU, 0x00f9fc1dU, 0x00fcd0f1U, 0x00281c1bU,
+  0x21f804b9U, 0xf9f9f624U, 0x1410f3f2U, 0x0ffe33feU, 0xf1d52902U, 0xde38390fU, 0x05021beeU, 0xfdebf613U,
+  0x170c0426U, 0x0823fed2U, 0xfd070811U, 0xe8f4f9f2U, 0x050604dcU, 0xec26eff0U, 0xf50df417U, 0xdb1920cbU,
+  0x081a0008U, 0xdb0b0041U, 0x0b0f00f8U, 0x15d50008U, 0x13101607U, 0xffbf1317U, 0xf0f8e8faU, 0xfcfe22edU,
+  0x022ee900U, 0x41f02400U, 0x1301e600U, 0xf701f900U, 0x0015edf4U, 0x00130928U, 0x0007fcefU, 0x00170cffU,
+  0xf5e9f4ceU, 0xd2f9002fU, 0x0c0efe0fU, 0x29e7431aU, 0xf1e31bfbU, 0x03022214U, 0xf5d215efU, 0xf7dd2ef0U,
+  0x05fef61fU, 0xfa03e5ecU, 0xf119fbecU, 0xd2ef08d9U, 0x1b031ceeU, 0x0f1604e7U, 0x0e070100U, 0x0f100de7U,
+  0x290600e3U, 0xedcb001eU, 0x2cfa000fU, 0x43c600faU, 0x02fd130eU, 0x21c9f52dU, 0x1100dc0fU, 0xe235180fU,
+  0x1511ed00U, 0x4a1a3f00U, 0x23f1f300U, 0xcad15500U, 0x002ef9cfU, 0x00f90d3aU, 0x00102426U, 0x00f814cbU,
+  0xfee4ded5U, 0xfde52310U, 0x10043f1aU, 0x19eeee09U, 0x0e0801ffU, 0x2223152cU, 0xebba3900U, 0xe8d31714U,
+  0x0ae71241U, 0x001bddf8U, 0xf51ce1e8U, 0xe82edc08U, 0x09100240U, 0xf4de2ac8U, 0x001a3edbU, 0xe13b1ee7U,
+  0xf50200ecU, 0xdd0b00fdU, 0xf6fd001bU, 0x43fa001cU, 0xd23700deU, 0x2a0a00f3U, 0xf2170205U, 0x0ed3f738U,
+  0xeb0c0100U, 0x03143000U, 0x08081200U, 0x2dd41400U, 0x00f005feU, 0x00cceef6U, 0x00e8e3f7U, 0x00f6c4eaU,
+  0x0a01db01U, 0xe70b01f9U, 0x0deef508U, 0xeb07e4fbU, 0x0be7d609U, 0xcb30f117U, 0x0215f801U, 0x1d3c16f5U,
+  0x0f58cd17U, 0x25b8fde8U, 0x01e112fcU, 0x2281f9ceU, 0xe7da020cU, 0xf01a3638U, 0xff0d1007U, 0xfb08b9edU,
+  0xe41900f4U, 0x1d1400f2U, 0xec1800efU, 0xca0900f1U, 0xd81d25b2U, 0x2fe5f6e7U, 0x0910dcfdU, 0x13edf0f1U,
+  0x0312e400U, 0x16362800U, 0xfa140e00U, 0x3c0c1900U, 0x00eef7f2U, 0x00eb07b0U, 0x00dae5dcU, 0x00e81df4U,
+  0x1afbf0eeU, 0x10220b18U, 0xfce1e401U, 0xd6dd2644U, 0x16d5fee1U, 0xbf15f93cU, 0x1414f115U, 0xf81600e8U,
+  0x1431ee30U, 0x19f6f6feU, 0xf6e5fdf5U, 0x12becbc7U, 0xf5f903fbU, 0xca16191fU, 0xfff21208U, 0xf83109eeU,
+  0xf72100e7U, 0xe72b000aU, 0x020000e4U, 0xf1fb001cU, 0xf03c30ddU, 0x19e701edU, 0x09f3cb0aU, 0xf5f3ff04U,
+  0xe835e600U, 0x25063400U, 0xef2bf100U, 0xff3f2100U, 0x00f8feceU, 0x000f1005U, 0x00f918ffU, 0x00f42ae5U,
+  0xf5df06c7U, 0xf9121b2aU, 0x15fdf102U, 0xee03273aU, 0x04e207d1U, 0xf3fc1115U, 0xeaf5fd21U, 0xbffd04f6U,
+  0x3328194cU, 0x0828f607U, 0xcff201edU, 0xcceafac4U, 0xfbe4f6efU, 0xe53119eaU, 0x030a1102U, 0xfe3319ddU,
+  0x050f00fbU, 0x01e7003eU, 0x25e60003U, 0x23d2002eU, 0xff291efaU, 0xe7f11219U, 0x0beeec10U, 0x03f32908U,
+  0xea0edc00U, 0x311d2800U, 0x091ce700U, 0xe31cfd00U, 0x0005dfe2U, 0x000bf723U, 0x00f828f7U, 0x001415d3U,
+  0xf0d801cfU, 0x0a251224U, 0x1f180724U, 0x0bf72908U, 0x1ef6fcfdU, 0x0c24e902U, 0xebd60f0dU, 0xe3e43217U,
+  0x27280b48U, 0x01ecda14U, 0xe10cf9d1U, 0xc8dfeec6U, 0xfefd011aU, 0xb91b190aU, 0xf6100ed8U, 0xec2b0bc7U,
+  0x2ef000d2U, 0x2aac0048U, 0x10e70028U, 0x3ddb0020U, 0x010e250eU, 0x03eae214U, 0x0616ec0cU, 0xdef90515U,
+  0xf3f3f800U, 0x0c422900U, 0x20f8fe00U, 0x01cbff00U, 0x00faddb4U, 0x00fa14e3U, 0x00f61e0cU, 0x001809a4U,
+  0xe4e2e7a4U, 0x051107fdU, 0x27243e32U, 0x38f3faf1U, 0x25040203U, 0x0f38da17U, 0xbdd4211aU, 0xf0d636f1U,
+  0x23e01345U, 0xf8091321U, 0xf442c9d8U, 0xdefdcd0eU, 0x05fe0140U, 0x81c60ef4U, 0xcf271cceU, 0xd92ff6f6U,
+  0xf5ee00d8U, 0xf51c00f8U, 0xf80a002eU, 0xf5120050U, 0x860adfd7U, 0x1ef4e0e9U, 0x1101f810U, 0x39c22425U,
+  0xe80dfc00U, 0x050e2400U, 0x051c1100U, 0x080e0d00U, 0x00da070eU, 0x00040a05U, 0x000cdffcU, 0x0011c8e9U,
+  0xcd06d0efU, 0xfb220b04U, 0x1a060711U, 0x08020418U, 0x09dfe2f1U, 0xf021e009U, 0xfb23130eU, 0xe43122dfU,
+  0x114ac40dU, 0xf3e520f8U, 0xf2e11800U, 0xf89d38f5U, 0x0cbd03e0U, 0xe4f60804U, 0xfd1f080fU, 0x1915dc14U,
+  0xdae200edU, 0xfe190008U, 0xf7040021U, 0xce030006U, 0xbf1e0cbbU, 0x10fa00c9U, 0x20f9f207U, 0x39d30904U,
+  0xe0faeb00U, 0x13fe1c00U, 0x0c271a00U, 0x39211600U, 0x00e7f91eU, 0x002f0bdeU, 0x0025dde4U, 0x001bd4d1U,
+  0xaadae9e8U, 0x08371914U, 0x1515fa1fU, 0x112f1932U, 0x20ffe5e9U, 0xdffcc01fU, 0xed1dfb1cU, 0xbe3203c4U,
+  0x2559c823U, 0xd0db2a04U, 0xf9f70700U, 0xeabbffceU, 0x379dfee8U, 0xcfe700eeU, 0xf60f0f1aU, 0xf426e6edU,
+  0xf4ea00d7U, 0x11f80001U, 0xff140017U, 0x24f70004U, 0xdf2e1fbfU, 0x191e2de8U, 0x26fbef07U, 0x14ff2102U,
+  0xbbe0e600U, 0xf4e11000U, 0x193b3000U, 0xf91b0200U, 0x00fde711U, 0x001ef7e8U, 0x002d13dcU, 0x0025e9caU,
+  0x81e1f1b9U, 0xf71a1323U, 0x3123f931U, 0x051c012aU, 0x2232e2f3U, 0x1f09e9ecU, 0xfd100a11U, 0xa02df0d3U,
+  0x3355f560U, 0x0cff1fffU, 0x040200efU, 0xd4f01fc8U, 0x33a7f508U, 0xc2d60dffU, 0xd60b0b10U, 0xf0f40011U,
+  0x370000d6U, 0x15d800f0U, 0x09ef0005U, 0x45ce00f6U, 0xfb113c0eU, 0xef1415f3U, 0x230100dcU, 0x06ff4ee2U,
+  0xa1e7c900U, 0xf0f71000U, 0x3a1b1700U, 0xe507fa00U, 0x00f5b8daU, 0x0006e7ecU, 0x003417ddU, 0x000ee8d6U,
+  0xa5e4f796U, 0x0631f124U, 0x67341446U, 0x16251c1cU, 0x1e43f8fcU, 0xf919cdd6U, 0xe5f315ffU, 0xb01402e7U,
+  0x3e220358U, 0x15e11202U, 0xf81906d5U, 0xe716effaU, 0x29c5f932U, 0xc4b50215U, 0xd517fcd5U, 0xfbfcf601U,
+  0x4b1000d5U, 0x23ea00f9U, 0xe3f000fdU, 0x36f30009U, 0x00f10f0fU, 0x150dfe04U, 0x1229f0faU, 0xe8082403U,
+  0xdae2eb00U, 0xef252d00U, 0x1bfb2c00U, 0xfed7f900U, 0x00e4c5dbU, 0x0001fcfaU, 0x0021fde4U, 0x000bf5c7U,
+  0xcad9f295U, 0xf52b030fU, 0x7f341748U, 0x1a1a0b07U, 0x0d09fbf8U, 0xe813e109U, 0xd0001117U, 0xf6ec07e6U,
+  0x2ad0f71eU, 0xebeef508U, 0xfa6afb09U, 0xfe03eef1U, 0x29f4f927U, 0xbba7f2e7U, 0xc4320ed6U, 0xfa1f02faU,
+  0x3c300000U, 0x021700dfU, 0x29110002U, 0x110100fbU, 0x18d702faU, 0x03f6fe19U, 0x1e10fc12U, 0x09d2030aU,
+  0x07fc1400U, 0xfdf3f900U, 0xff31df00U, 0xfb1aea00U, 0x00241927U, 0x00da0cfeU, 0x00df28faU, 0x00f4d9ddU,
+  0xf9401f1bU, 0x04fafff3U, 0x081006eaU, 0x0b0cde0fU, 0x0bf73006U, 0xfee9e9fcU, 0xfbe3fb2aU, 0xfa0d0df4U,
+  0xf91a0cf7U, 0xf803ffe2U, 0xdc3910e4U, 0xf1f418f6U, 0x132af81eU, 0xfd000700U, 0x08ee1c04U, 0x0bfffd08U,
+  0x110100e9U, 0x01f500feU, 0x0fe90002U, 0x0ffc00e8U, 0x1ad504f0U, 0x0f090122U, 0x1cfbfc0eU, 0x14e806eeU,
+  0x0efefb00U, 0x070af100U, 0xf72bd700U, 0xe413c800U, 0x000d1c24U, 0x00e72a02U, 0x00f02b22U, 0x0006f1cdU,
+  0x102c1231U, 0xef0200eeU, 0x0a10f2f3U, 0xee17c9f4U, 0x26dc27f7U, 0x02fbef12U, 0x09eb0103U, 0xcd180beaU,
+  0x241517dfU, 0x04130403U, 0xfb1407edU, 0xf3ac18dbU, 0xfc18e129U, 0xe5fc0406U, 0x1bbf0dffU, 0x1cfaf80dU,
+  0x281700e6U, 0xed0b00f6U, 0x18ed001aU, 0x21f900efU, 0x17dd04fbU, 0x1ced0721U, 0x1ce4e8f5U, 0x12db02fbU,
+  0xfef1e500U, 0xfc12d800U, 0x043eea00U, 0xd6faa100U, 0x00f50bf5U, 0x00e82902U, 0x00ee352eU, 0x0013fbe4U,
+  0xfd210d1bU, 0xe9fee6f8U, 0x220a200eU, 0xc227f3f8U, 0x18ea1b0eU, 0xf720fb13U, 0x12e60cfcU, 0xcc100ff9U,
+  0x0c0c18f6U, 0x1109fc0cU, 0x17320bf1U, 0x05a618dcU, 0xd732f41dU, 0xdfe40d12U, 0x3bdd1309U, 0x2bf31525U,
+  0x163100efU, 0xfa0a00f2U, 0x38ee00f6U, 0xe2f40011U, 0x22f0fa0dU, 0x261e1122U, 0x2fd8f414U, 0x19b00df2U,
+  0xfaf1ef00U, 0xdc330700U, 0xdc4b0400U, 0xfee99400U, 0x00e8fbe1U, 0x00fb2afbU, 0x00fe2333U, 0x000b0320U,
+  0xe00bec29U, 0xf5ffd6f3U, 0x171c15f5U, 0xac30e8f6U, 0x0ef20b21U, 0x1a17ea15U, 0x060200fcU, 0xd6fb32f5U,
+  0xed0ef4e6U, 0xf80f0318U, 0x17211615U, 0x07980ce3U, 0xe321f71eU, 0xe6dd0408U, 0x19d90c08U, 0x2fec1026U,
+  0x042b00e9U, 0xfa0400f2U, 0x3bf400fbU, 0xceeb0019U, 0x0c010201U, 0x110d0e1fU, 0x2af90d06U, 0x35ab0ef6U,
+  0x060ae200U, 0x0d26f700U, 0xd8150d00U, 0x02b99300U, 0x000403f6U, 0x000710e5U, 0x00010e3bU, 0x0023f007U,
+  0x1204d8f7U, 0x0a0ff108U, 0x1c341cf4U, 0x9e33f3ebU, 0x13ee0106U, 0x0f26fefbU, 0x1b1c170bU, 0xfc100cfaU,
+  0xf6f0dee5U, 0x04f00b08U, 0x0a101426U, 0xf7bf0ee0U, 0xf9111008U, 0x0df306f8U, 0xf3fcf601U, 0x1be2e90bU,
+  0x41330001U, 0x0dff00d0U, 0x14dd0002U, 0x04fb001eU, 0x3ff61309U, 0x12e8fe01U, 0x14210df4U, 0x0de115e4U,
+  0xf63f0200U, 0x090ad900U, 0x10fdef00U, 0x0114ed00U, 0x00ca3408U, 0x00d122ecU, 0x00f3240bU, 0x0003ffd1U,
+  0x1045f603U, 0xf6f6f60aU, 0x13fe15f5U, 0xe4fee326U, 0x07f2f20bU, 0xfce4f30cU, 0xfedd1f07U, 0xe323f0eeU,
+  0xe31937d2U, 0xe2ec00c7U, 0xdbfef7e5U, 0xebdd0ad8U, 0x0739eb1cU, 0xdb0e010fU, 0x2ff40cf4U, 0x132c3311U,
+  0x2d4000cbU, 0xfde200e3U, 0x37dc00ffU, 0x1cf80027U, 0x32eb1403U, 0x05dd0517U, 0xf90ceceeU, 0x11e0ec11U,
+  0x1013eb00U, 0x1815e100U, 0x01e6f500U, 0xe80ed300U, 0x00d73001U, 0x00f62be9U, 0x00ed33fdU, 0x000f08dbU,
+  0x0718e3f8U, 0xfaf70618U, 0x2bf41cc7U, 0xe80c00f0U, 0x0ac40900U, 0x1cff02fbU, 0xfff60907U, 0xc62117faU,
+  0x01172aecU, 0xf9eb20d7U, 0xfff9ebe8U, 0xe3b501f0U, 0xe31ac810U, 0xf0f9ea23U, 0x33d836d7U, 0x19091515U,
+  0x262f00e7U, 0x040300fbU, 0x44d8000cU, 0x14160017U, 0x05e418d1U, 0x0afa0a2aU, 0xece9e3f2U, 0x04c7d6fdU,
+  0x1302ef00U, 0x0908e600U, 0x1afef400U, 0xfaebde00U, 0x00de38f9U, 0x00f72a00U, 0x00083820U, 0x002b0a1dU,
+  0xe314f228U, 0xddf3022cU, 0x1ef403c9U, 0xdcfbf9f1U, 0x06d709fcU, 0x141b0631U, 0xcc0308eeU, 0xba1afefcU,
+  0xf615e8e9U, 0x061100e3U, 0x24f8e4d8U, 0x04eefbecU, 0xde23d21cU, 0xf4ec031aU, 0x2bf01fdfU, 0xf804e904U,
+  0x0e2c00e7U, 0x03ff0002U, 0x35d200d3U, 0xe71e000cU, 0xf0e619e0U, 0x1c150119U, 0xfcf404f4U, 0xf9b4f700U,
+  0xdb0a0800U, 0xee280300U, 0x1026e800U, 0x1202ef00U, 0x00f414ffU, 0x00081504U, 0x00043c21U, 0x003c034fU,
+  0xc4ffd129U, 0xe8e10110U, 0x0a21dedfU, 0xb60f0401U, 0x0de0fb06U, 0x1320f50fU, 0xdd0d0ffbU, 0xd3131bf7U,
+  0xf21beaefU, 0x1706fd11U, 0x29f906f2U, 0xfdf0ece0U, 0xfa01d13aU, 0x07e0fc0bU, 0xfc12e7fbU, 0xf904f007U,
+  0xe63100d6U, 0x0be400f1U, 0x1bef00b6U, 0x9a140030U, 0xfeedf9f9U, 0x101d1737U, 0x34121de0U, 0x33ac04fdU,
+  0x0ef91000U, 0xe72e0600U, 0xf21c0a00U, 0x010be800U, 0x0014f026U, 0x00070efbU, 0x00ba1ae5U, 0x0028fe3bU,
+  0xbdeb1f15U, 0x09ea0702U, 0x2729d6d2U, 0x810c2722U, 0x30f0f604U, 0x1a28f501U, 0xf01406feU, 0x082e2202U,
+  0xfd20e213U, 0x0ae6132eU, 0x0e27ff0eU, 0xf6e4e7e3U, 0xf8f6fe11U, 0x06c912fcU, 0x000be5fbU, 0x26e81200U,
+  0x26210003U, 0x1ff500e0U, 0x33d000f3U, 0x13f70019U, 0x2d060f03U, 0x21f302f9U, 0xe42c1de8U, 0x1405e8e4U,
+  0xe006fb00U, 0x121ccd00U, 0x14f1ea00U, 0x0dfff500U, 0x00b24911U, 0x00f451dfU, 0x00fd0022U, 0x00fc38f8U,
+  0x0437eb05U, 0xfbf7f93cU, 0x1cdd1cddU, 0xe6e32329U, 0x02e1fefdU, 0xf2ecd30eU, 0x06cc4f11U, 0xc719fb01U,
+  0xd73f37d9U, 0xd2e717b6U, 0xea16cae2U, 0xf3f31fe2U, 0xd215ff31U, 0xa5f53423U, 0x2601ecddU, 0x08f04619U,
+  0x182300e3U, 0xfc0000deU, 0x7fcc0001U, 0x12f10026U, 0x00de07ddU, 0x24e2fdf5U, 0xe01bf11eU, 0x00f3e214U,
+  0xd7f1ea00U, 0x132cf300U, 0xf808f500U, 0xef1d0500U, 0x00c21116U, 0x000332e6U, 0x001623ebU, 0x00f1183aU,
+  0x0020d5dfU, 0xeaf0d92bU, 0x32c163d0U, 0xf5f40a0fU, 0x04fef1f3U, 0x010ec305U, 0xf9d3381eU, 0x9a020607U,
+  0xed2201faU, 0xd0d728a5U, 0xf406d7f2U, 0x0614ecedU, 0xcf1af31dU, 0xe50a1d24U, 0x47fa1adaU, 0x0df13df9U,
+  0x110100cdU, 0xf7f40008U, 0x44100029U, 0x27d60023U, 0xfa040fa8U, 0x12ee0407U, 0xe504f3e6U, 0x02d604ddU,
+  0xdfece100U, 0x02320700U, 0xeef6ef00U, 0xe71c2600U, 0x00ec4517U, 0x000235f4U, 0x001b2519U, 0x00242928U,
+  0x0b0cddf5U, 0xd9f3ef0cU, 0x17ce3cd5U, 0xf8f5f820U, 0xeef2ec04U, 0x3321de0eU, 0xd201292fU, 0xb10f030dU,
+  0xf616f900U, 0xf805f7ebU, 0x08e60bcfU, 0xf42dcde2U, 0xe122eb09U, 0xf1eff10dU, 0x42f819e5U, 0x08ecec01U,
+  0xec0d00faU, 0xf7ec0007U, 0xfb1c00f4U, 0xfee70015U, 0xe4ea23daU, 0x0b0327efU, 0x0f1008f3U, 0x1bc21608U,
+  0xe8f40700U, 0xf5180500U, 0xdef80500U, 0x0f002800U, 0x000c252bU, 0x00161e30U, 0x000cf2f0U, 0x002d1229U,
+  0xddeee424U, 0xeaf01611U, 0x060109aeU, 0xfcfe0602U, 0xf3f1e514U, 0x220606f3U, 0xe017f90fU, 0xdf181e22U,
+  0x292dd939U, 0x2808c92cU, 0x0b171cc0U, 0xff0bc6edU, 0xf0e7ef0bU, 0xfcf611fcU, 0x1d15f2f6U, 0xebe0dfe4U,
+  0xdded00eeU, 0x14cc00fcU, 0xff2000f1U, 0xdcf100fdU, 0xe6f812eaU, 0x140e0024U, 0x491107e7U, 0x5bd6040bU,
+  0xf5e82f00U, 0xdc211700U, 0xd6010100U, 0xf6291a00U, 0x00f2fa39U, 0x00061c3eU, 0x00edfcdaU, 0x001cf02cU,
+  0xdcce1224U, 0x03fb17feU, 0x03151fa1U, 0xd1e50012U, 0x15fcfa1fU, 0x3d1de715U, 0xcf01efe5U, 0x10361128U,
+  0x317fd71dU, 0x23ece529U, 0x04f00cdcU, 0x0d20c4ecU, 0xd0e7e5eeU, 0x17d216ebU, 0x2c090ae0U, 0x17ccec07U,
+  0x280700e9U, 0x34e400f5U, 0x0dd200ebU, 0x23ee0004U, 0x1f17edd6U, 0x2a14da01U, 0xfb0029eeU, 0xf814d7f4U,
+  0xef35ec00U, 0xfc18db00U, 0x160eed00U, 0x01f0f400U, 0x00cf590bU, 0x001442f7U, 0x0005ea18U, 0x000b1f01U,
+  0xf009ef0aU, 0x20f11e3dU, 0x1fe4e5fcU, 0x0ced4418U, 0x1fdfc21eU, 0xf4d3bd1aU, 0x02c455ddU, 0xe7e7012eU,
+  0xc740eed1U, 0xd7e31ec1U, 0x16f0cdeaU, 0xf11c07daU, 0xcdf31f15U, 0xabe7531aU, 0x0841d905U, 0xfdf23513U,
+  0x04ea00ddU, 0x1ff800c6U, 0x60df00eeU, 0x27f7000fU, 0x040becddU, 0x1d0802feU, 0xf0f9062cU, 0xf2f1ddfbU,
+  0xe512e800U, 0x0205da00U, 0x0420eb00U, 0x01ca0e00U, 0x0000400dU, 0x002d31dbU, 0x00f412f0U, 0x00082017U,
+  0xc1fbff26U, 0x25ffef45U, 0x2ee20d05U, 0x22e24b1eU, 0x2bead22aU, 0xe8f9a237U, 0xecdc55eaU, 0xe2ff0e0fU,
+  0xcb2af5e3U, 0xcecd29b8U, 0x0a0fac20U, 0x0e22ffdeU, 0xd6014c36U, 0xd4e55f47U, 0xda3ae4f4U, 0x1ce92c12U,
+  0x18bf00daU, 0xf71d00e6U, 0x3de20024U, 0x23fc0006U, 0xe9f4dcb1U, 0x1c1507efU, 0xb9e0eb2dU, 0xed03efd3U,
+  0xf3e50b00U, 0xc414ff00U, 0x0dfe2100U, 0x00cc3500U, 0x00fa491cU, 0x000352f0U, 0x00ff0405U, 0x0014040fU,
+  0xd6e01600U, 0xff11eb06U, 0x2cdf1c2fU, 0x3d102533U, 0x26d7f327U, 0x0013dd44U, 0xcae93d00U, 0xd20c0610U,
+  0xfc33d336U, 0x080909f1U, 0xea11d3e4U, 0x122212dcU, 0xcfd93805U, 0xf4de422dU, 0x1005dcd1U, 0x09ec1815U,
+  0x06c500f7U, 0xea160010U, 0xf5f40020U, 0x0c050013U, 0xe0c0e7c4U, 0x1418fdedU, 0xb701f72fU, 0xd9f80709U,
+  0xf10e1700U, 0xd1271800U, 0x13f43500U, 0x28d13f00U, 0x00040813U, 0x000f402aU, 0x00fdef21U, 0x00feeeffU,
+  0xc2d60a14U, 0x1b14190bU, 0x14d52622U, 0x191e0d07U, 0x29dbdd26U, 0x2f1ae400U, 0xe0f14af1U, 0xef161212U,
+  0x2d1fdb40U, 0x461ae523U, 0xe821e1d0U, 0x0f2f05e5U, 0xdfe11de3U, 0xfcde1004U, 0x2a1aeecbU, 0xee0809eaU,
+  0xe0b70012U, 0xe00100f4U, 0xb8200045U, 0xf42100f5U, 0xc90b04e6U, 0x130ae825U, 0xf8ffe802U, 0x10f4f51cU,
+  0xe8133300U, 0xc0191700U, 0x40e21800U, 0x03f63200U, 0x00e7e32fU, 0x000df374U, 0x00f6f440U, 0x00fefbccU,
+  0x06e7112eU, 0xdffd0f07U, 0xf6d63c2fU, 0x0efbfcf2U, 0xeafbe930U, 0x3928d61cU, 0xdee34aeeU, 0x0f39f6feU,
+  0x2f79d717U, 0x2d0a0426U, 0xf30fede0U, 0x222009f7U, 0xb8fefae1U, 0x10a31000U, 0x3e1bffdeU, 0xf0fbfef6U,
+  0xfbd800b9U, 0x12e600cfU, 0xceed0022U, 0x16f100d5U, 0x9c1cd0e6U, 0x2af7d7e9U, 0x2e0612f5U, 0xfa14ee0dU,
+  0xfa28e900U, 0xf44afc00U, 0x0a06f300U, 0x14defd00U, 0x00f630e0U, 0x001e1aeaU, 0x00ffdef5U, 0x00111515U,
+  0xfedcecfbU, 0xe20027f8U, 0x1307fb14U, 0x1cfe2017U, 0x09d2d634U, 0x02d1bc0aU, 0x01f72ffbU, 0xfffb2621U,
+  0xd21edef0U, 0xcde6f0deU, 0x02fc1202U, 0x020afa0aU, 0xd3c90902U, 0xcdb12008U, 0x0a16fc1cU, 0xd80105f3U,
+  0x30cc00dbU, 0x370500eeU, 0xe2ef00feU, 0x24ec0003U, 0xa813caf8U, 0x1326f414U, 0x3709dd25U, 0xe8fafb04U,
+  0xf029f400U, 0x0541ed00U, 0x2e1ff700U, 0xf6dc3000U, 0x00e949e0U, 0x00326bb9U, 0x00f7d9f9U, 0x000ae704U,
+  0xe6e8cc0eU, 0x7f1e0606U, 0x3718e916U, 0x11f0210dU, 0x3808e148U, 0xeabbc143U, 0x0be95dd7U, 0x0bef480cU,
+  0xef46d611U, 0xc2f027d5U, 0x3128d31bU, 0x0111f9feU, 0xcfe82c14U, 0xfaf960e8U, 0xe241ef0aU, 0xfdf2e9f9U,
+  0xf3c900e0U, 0x291700feU, 0x41d80012U, 0x05ee0003U, 0xb8ecd8d7U, 0x0b491ceeU, 0x01ecd145U, 0xf8e41805U,
+  0x024a2500U, 0xe816fb00U, 0x4b122200U, 0x18e64000U, 0x00071cdfU, 0x001775dbU, 0x00fe03ffU, 0x0004e2dcU,
+  0xbb06ea0eU, 0x5c1a0831U, 0x160cf953U, 0x10f6e4fbU, 0x43f8f745U, 0xf3ffa74bU, 0xffe25dedU, 0xf4fd48fcU,
+  0x2e4ace1fU, 0xea2a060cU, 0x090ea6e7U, 0x11f7fefcU, 0xd2221cf2U, 0xd9ca50ecU, 0xb739eff8U, 0xef15d6deU,
+  0x05ab000eU, 0xd8fa00f8U, 0x1aee003dU, 0x0bf700e2U, 0xc6e2f9caU, 0xd55f12f0U, 0xc4dee011U, 0x02fd0f11U,
+  0xd7492700U, 0x99124600U, 0x50455a00U, 0x4cd30c00U, 0x000a11bcU, 0x00162009U, 0x00ff2d1cU, 0x0015fbdcU,
+  0xdb22ff05U, 0x202e0ef5U, 0x1004017aU, 0xf9feebd3U, 0x0709fa27U, 0x244daf1fU, 0xebe8520eU, 0x0b0c3cf6U,
+  0x3c22d319U, 0x392f0244U, 0xe113a4ddU, 0x13ff1effU, 0xe5edff0cU, 0xdf9a25eaU, 0xf655f8c9U, 0xc94309d0U,
+  0x2fc20000U, 0xe5dc0024U, 0xd6fe0039U, 0x13fb00f3U, 0xee1af8fbU, 0xc601ff0dU, 0xcdfaf211U, 0xf00b0e0eU,
+  0xef394200U, 0xb7205e00U, 0x42242900U, 0x17e8f600U, 0x00ff14e1U, 0x0006f442U, 0x00f3273fU, 0x000ceee2U,
+  0x2d3bff1bU, 0x0b1c0301U, 0x3bea1147U, 0x06060ee0U, 0xe20afd32U, 0x4930d018U, 0xfff92c17U, 0xf20c0cfeU,
+  0x1841e32cU, 0x0a231330U, 0xdf3df8f2U, 0x1ae71a0aU, 0xc2e207eaU, 0xf1870c0dU, 0xf3560ac4U, 0xb70c00eeU,
+  0x21f700f1U, 0x191500edU, 0xeb0300f7U, 0x460300dbU, 0x2efbf505U, 0xfaf70904U, 0xf4f9fdf5U, 0x29f9031dU,
+  0x0af8ee00U, 0x00092300U, 0xf9eb1800U, 0xfb17df00U, 0x00cf4c3dU, 0x00fddceeU, 0x0005e2e7U, 0x003b1b21U,
+  0x001417a1U, 0x0610e11aU, 0xffdbfd10U, 0x023057b4U, 0x0ef0f919U, 0xff2ef1f0U, 0x091ce8e2U, 0x0ad03626U,
+  0x1734f3f6U, 0xfde22b14U, 0x18cff909U, 0x023e04faU, 0x01e4e805U, 0x0c03fe08U, 0xf9e2fdffU, 0x12040a08U,
+  0x03dd0029U, 0x183f00daU, 0x081d00f0U, 0xf2e100faU, 0x3be8d118U, 0x07ea0e00U, 0xfddbfbf9U, 0x28e20415U,
+  0x18d2fa00U, 0xe41e1700U, 0x060f1a00U, 0xf0a7b200U, 0x00e03571U, 0x00fef0cfU, 0x0003ead2U, 0x003e124dU,
+  0x0fd913ffU, 0xf924dc19U, 0xd9f736e3U, 0x000b36beU, 0x3cd31427U, 0xcb3cf6e5U, 0xd81e03eeU, 0x36c15a03U,
+  0x3a52dcd3U, 0x00c6280cU, 0x4db70118U, 0x202cee0bU, 0x03f3f3efU, 0xfb131412U, 0xe9d12202U, 0x42080409U,
+  0xddce0056U, 0x4c4700d9U, 0x36250003U, 0xe1ee00c2U, 0x01f2ba0eU, 0x21012af6U, 0xfca706e0U, 0x0ff00cf7U,
+  0x06e55800U, 0xcd2e0500U, 0x10e9f900U, 0xd68acd00U, 0x00003331U, 0x00fcfcb1U, 0x000ff3dfU, 0x000d0ffbU,
+  0x24c11543U, 0x0737d50fU, 0xaf2c0fdaU, 0xe7f92cf1U, 0x46db0124U, 0xc44cf4edU, 0xc245130cU, 0x2c973c1dU,
+  0xf864cfebU, 0x0d933df9U, 0x46ba0f2eU, 0x053fec2cU, 0xc9d4e7e9U, 0xf1030013U, 0xe4dceffbU, 0x2c2c0d0aU,
+  0xecf2001cU, 0x3d3900edU, 0x5e240010U, 0x21e400bbU, 0xd317dd0aU, 0x3de711e5U, 0x21ab07f2U, 0xee100c04U,
+  0x0ae87300U, 0xd01d0600U, 0xe7e6eb00U, 0xddbeef00U, 0x00021b1fU, 0x0018058fU, 0x003afe0aU, 0x00bdeedbU,
+  0x15c7312bU, 0xec44c003U, 0xb557fce5U, 0x15edebdcU, 0x5403e71eU, 0xa335f5e8U, 0xba230f0cU, 0x2bbe0439U,
+  0xe67fc41fU, 0x2c813902U, 0x24ade912U, 0xdd4fe44bU, 0xbcc9f5edU, 0x0f091c26U, 0x16e0f602U, 0x021b41e1U,
+  0xe10400cfU, 0x4b2400fcU, 0x60030026U, 0x49e700d6U, 0xb122f3feU, 0x1fd60d01U, 0x37d10f01U, 0xecf2f915U,
+  0xf2fd4600U, 0xf5fbef00U, 0x05fed800U, 0xfddddb00U, 0x00db0423U, 0x000f0ba6U, 0x004219eeU, 0x00ed01edU,
+  0x21bb0338U, 0xe23fccedU, 0xdf3e2de7U, 0x04f2b008U, 0x27fef409U, 0xe30d07eeU, 0xdb000f04U, 0x19ebe909U,
+  0xe563c303U, 0x1784280fU, 0xf598d3f7U, 0xf8161023U, 0xf6071defU, 0x23030a11U, 0x0de04809U, 0xe6eb1df1U,
+  0x2dfb00fcU, 0x083e00f7U, 0xf3190002U, 0x1cdd00faU, 0x0f03ecf7U, 0x030212ffU, 0xffc30408U, 0x33d20d03U,
+  0x07f1f700U, 0xf9071c00U, 0x02e53300U, 0x0d10f300U, 0x00d72526U, 0x00e1f0e2U, 0x00fcb6c9U, 0x0032fa2fU,
+  0xf51d09d6U, 0xfe21f60bU, 0xe2dce9f4U, 0xfd3346ecU, 0x19d5f33eU, 0xf739f6f6U, 0xd53614e7U, 0xf6d33bf0U,
+  0xf32ddfe5U, 0xf0e520e9U, 0x32bfe203U, 0x10f21cdaU, 0xfed609eaU, 0x1713f90fU, 0x17f6f8ebU, 0x4c02fdffU,
+  0xfbc1000fU, 0x1c2d00d1U, 0x154900d7U, 0x1fd600daU, 0x0f1ce02aU, 0x25eaf8e9U, 0x05af0ecbU, 0x30e0dbfbU,
+  0x1c1c1000U, 0xda230200U, 0x2df10c00U, 0xf4f2e400U, 0x00d33717U, 0x00f60701U, 0x0026dcddU, 0x00340f36U,
+  0x19e01efcU, 0xdd2eeb1bU, 0xc504e4d7U, 0x100819acU, 0x23c52c34U, 0xde54f2f9U, 0xc43ce613U, 0x1add58fdU,
+  0xf63bcc1aU, 0xeedf2be8U, 0x3eccf3e0U, 0x18041dfeU, 0xf0d7dfc8U, 0x090f013aU, 0xf21ef904U, 0x40f1d5e9U,
+  0xe2c5000fU, 0x371400f7U, 0x202f00ffU, 0x200000afU, 0x0a0ae11aU, 0x2802fce8U, 0x21bb25e0U, 0x08e6c3fdU,
+  0xeb115900U, 0xe70efc00U, 0x2bc7f700U, 0xd9a7f800U, 0x00ca59e3U, 0x00f6f614U, 0x0003f0caU, 0x00fa1707U,
+  0x06dc093bU, 0xda16ccfaU, 0xd823e2ebU, 0xe702f0f6U, 0x0507331eU, 0xe42efbfeU, 0x9b571752U, 0x00da1f17U,
+  0xe71dae31U, 0x0de83003U, 0x58c4fadaU, 0xf8fd2105U, 0xe2bfece8U, 0xfd100d39U, 0xcc490514U, 0x25efec05U,
+  0x05e20042U, 0x312c00f2U, 0x1b180030U, 0x270b00beU, 0xed37edfaU, 0x251a0de6U, 0x3aae26dcU, 0xcdead9f7U,
+  0xbdfa5b00U, 0xf00d0200U, 0x06b9ed00U, 0xf1ff1700U, 0x000744f0U, 0x0009f2e0U, 0x00fbecfcU, 0x00e915f2U,
+  0x0e071d08U, 0xf825d9ebU, 0xc93ce3faU, 0x8a09e6fcU, 0x201ee515U, 0xe613efe2U, 0x96264e1cU, 0x1a03c323U,
+  0xf80fad13U, 0x21ee250eU, 0x30c0cce6U, 0x19ef1904U, 0xdbb4fa10U, 0xf8050548U, 0x0f203b0dU, 0x00d4190aU,
+  0x350e000dU, 0x363a0007U, 0x0d340038U, 0x1cce00e3U, 0xba3c060cU, 0x18e011f4U, 0x7fab230eU, 0xbdfced28U,
+  0xd5d8dc00U, 0xf4f6f600U, 0x0bd1eb00U, 0x0d1ce600U, 0x00e4effcU, 0x002cf1daU, 0x003bfc13U, 0x00fef002U,
+  0x04df0324U, 0xdd32f6f8U, 0x962f3914U, 0xa10bbf4bU, 0xf4f6fe02U, 0xe510ebe5U, 0xf20729daU, 0x181efcfdU,
+  0xf301b2fbU, 0x16c7053bU, 0xf59cd3fdU, 0x13df23fbU, 0xe3e12039U, 0xfc04031fU, 0x61f42a10U, 0x17eeee02U,
+  0x28d60018U, 0x151d00f5U, 0xdb2e00f9U, 0x14010002U, 0x0018f9f3U, 0xf21104eaU, 0xfcf21009U, 0x27daf6f1U,
+  0x1004e000U, 0xec0b0800U, 0x07182500U, 0x081e0b00U, 0x00fc32ffU, 0x00e616e9U, 0x00dbc1c3U, 0x00e5c51cU,
+  0xee1942f2U, 0x1027da00U, 0x16dade02U, 0xe919fbe8U, 0x24b51259U, 0xd82ae5f0U, 0xb74debc2U, 0x13f51510U,
+  0xc9f7d6c9U, 0xe6ea11f6U, 0x11c30d02U, 0xdf0c08d3U, 0xafd52f02U, 0x082cfb2bU, 0xf2410c0eU, 0x3fe3f621U,
+  0x07cf000bU, 0x25fc00dfU, 0x141f00d3U, 0x26f000f0U, 0xfd17f522U, 0xd9efffdfU, 0xecd61ff0U, 0x32fdc7d3U,
+  0x1f0cf700U, 0xe50ae400U, 0x0526fe00U, 0x0444fd00U, 0x00ff3fe6U, 0x00edf8faU, 0x0003fcd8U, 0x00e9fcf3U,
+  0x120b3be8U, 0xfc1ce6fdU, 0x0edfdefdU, 0x28f9d8b5U, 0x3fdd244aU, 0xd633f60eU, 0x911c1deeU, 0x0cea2d1cU,
+  0xf3e3e916U, 0xe5fa07f7U, 0x2ccd33ddU, 0x0ddcf3d6U, 0xbfd131dbU, 0xfa0c0d22U, 0x9f66e62eU, 0x1ece0d08U,
+  0x25cb00f7U, 0x1c050000U, 0xe83400f6U, 0x0bfa00d4U, 0x0f0bfc15U, 0xe9dcf3edU, 0xebad1600U, 0xfdebc102U,
+  0x0d071900U, 0x03ffe300U, 0xff190000U, 0x040d0200U, 0x001a4be5U, 0x00edf013U, 0x00e92fecU, 0x000926faU,
+  0x1ef92a0eU, 0x0804feecU, 0x0e00d918U, 0xeb04d0efU, 0x3114f310U, 0xfe180f12U, 0xb91135f2U, 0x1b1d2b26U,
+  0xf6edb935U, 0x19011b0eU, 0x27e115ccU, 0x06e4fac5U, 0xcec222dcU, 0xef0d1e28U, 0xbf6ceceeU, 0x17050d0aU,
+  0x1a000025U, 0x03260011U, 0xd11d001aU, 0x22d300d1U, 0x02190603U, 0xe5ff0befU, 0x05e71d25U, 0xc2d9e8ffU,
+  0xb40a3700U, 0xfbefd400U, 0xeaf3ef00U, 0x18f81e00U, 0x00062ce5U, 0x000ef50aU, 0x00eee529U, 0x00220534U,
+  0x17090a1aU, 0x13fc08e1U, 0xd6fce132U, 0xbe14eaf3U, 0xf20be436U, 0x09fd0c08U, 0xd8e34d06U, 0xfb27dc0dU,
+  0x0115b717U, 0x1e1311ffU, 0xfcc40cddU, 0xf5ab01fbU, 0xe3cd15edU, 0xeb0fff31U, 0x03330b07U, 0xfdd30b03U,
+  0x501c000aU, 0x1a350017U, 0xf1250012U, 0xe8c70001U, 0xdc18061dU, 0xefe91704U, 0x72c51d23U, 0xd6f0e01dU,
+  0xe3fef300U, 0xf2f4d300U, 0x0af0ec00U, 0x13350700U, 0x00fbf4dfU, 0x002cf8feU, 0x00040512U, 0x00e6f13dU,
+  0xf8ede014U, 0xd1012309U, 0xefde1530U, 0xb8f9e5d9U, 0x15eaef0cU, 0xfb0210f2U, 0x01db39f8U, 0x263000fcU,
+  0x030ab605U, 0x1e00051bU, 0xf3bf12ddU, 0x14b903f1U, 0x02fc2f1dU, 0xf71ced17U, 0x2feb2efaU, 0x31d30cf9U,
+  0x24870010U, 0x0a1000efU, 0xe51200f6U, 0x31120001U, 0xeb2e03e3U, 0xccff00e7U, 0x1a08e4f3U, 0x21ea0ec3U,
+  0x26dfc600U, 0xe6020200U, 0xf50b2300U, 0xfd351300U, 0x003718eaU, 0x00f12a02U, 0x00dd12efU, 0x00f8cbfcU,
+  0x05f77119U, 0x0320e5fbU, 0x2e120211U, 0xfdf5f503U, 0x00af181bU, 0xf20edf02U, 0xc02ccb0eU, 0xf01c0404U,
+  0xc6ded9e6U, 0xfb041608U, 0x13f642efU, 0xebc3f6cfU, 0xe1ca3de7U, 0x02f0070cU, 0xe30f2d2aU, 0x0a0bf813U,
+  0x1faf00eeU, 0xf71000f8U, 0xb73200d8U, 0x251200f6U, 0xfd1a0cf7U, 0xda0211ecU, 0x14e5f3e0U, 0x29e8e7efU,
+  0x1607cf00U, 0xdc0ff800U, 0x13121500U, 0x16303300U, 0x00333ed4U, 0x0003090cU, 0x00e744f5U, 0x0006142aU,
+  0x15f63f08U, 0x1813fcf9U, 0x3c3be213U, 0xe2e0d1e9U, 0x2db03d3fU, 0xed07ecfeU, 0xe4e5c714U, 0xfd140601U,
+  0x07d7d309U, 0x0a131f14U, 0x0c4e3a10U, 0x07b80bb2U, 0xece040edU, 0x08091510U, 0xc32d2d39U, 0x1706f212U,
+  0x18f40022U, 0x101b0006U, 0xdc0000e3U, 0x0c0f00dbU, 0xebf717feU, 0xecfd0eebU, 0xf2df16f7U, 0x20f6bffcU,
+  0xd90fea00U, 0xec01ea00U, 0xf8320300U, 0x031e3a00U, 0x002c35d6U, 0x000e071bU, 0x00d31411U, 0x000f4238U,
+  0x1dfe300cU, 0x12090bf3U, 0xfd2de411U, 0xcaf0dcccU, 0x14fb093cU, 0xf6f9000bU, 0x400009dcU, 0x450b15f0U,
+  0x1b01dc23U, 0x1b161914U, 0x09291f2dU, 0xffb821c4U, 0xd6c22de0U, 0xf9f81b10U, 0xdb0e0617U, 0x1601eb14U,
+  0x2116000cU, 0xfb0f0010U, 0xcefd00f0U, 0xf4fc00c1U, 0x15110f16U, 0xfc0036fbU, 0xfe100f0fU, 0x02f1c411U,
+  0xa826f400U, 0xe8e1ef00U, 0xdef10e00U, 0x2e382500U, 0x002300c8U, 0x0011e420U, 0x00b7e256U, 0x00e2174fU,
+  0x13031701U, 0x27f40bf5U, 0xe9f3e3eeU, 0xd21bcdefU, 0xf30df039U, 0xeff71901U, 0x35f9ff04U, 0x2e0ce2faU,
+  0x0a1d031eU, 0x1f0112f5U, 0x15f62e32U, 0xf69b00e9U, 0xf7e5fc0eU, 0x0d1016f8U, 0xe7e6f6f6U, 0x0af4e512U,
+  0x01450004U, 0xf2f1001eU, 0xebf00010U, 0xddfb00f1U, 0x04fcf718U, 0xe31b401aU, 0x2bdc0619U, 0xf5eee102U,
+  0xced5de00U, 0xf1eedd00U, 0x0724f400U, 0x1c5d1d00U, 0x001af2d1U, 0x0002f30cU, 0x00bbed2bU, 0x00a6fc7fU,
+  0xe60401f3U, 0x04da1103U, 0xda9d08feU, 0xa6dee90aU, 0xf9fad9fdU, 0xf7fe1804U, 0x22e5fc15U, 0x3d20e503U,
+  0x16e712fdU, 0x1e09f118U, 0xf5f40401U, 0x10a5efccU, 0x24ef071fU, 0x112c0e21U, 0xf1f30105U, 0x31f8f511U,
+  0xf7bc0011U, 0x230700e8U, 0x240a00efU, 0x0a1400daU, 0xb1011003U, 0xb910f7e6U, 0xf811fbf7U, 0xdc1af6deU,
+  0x02aae800U, 0xfa070700U, 0x06071c00U, 0x0718ee00U, 0x006409f8U, 0x00090a13U, 0x000b1aeaU, 0x00dedff2U,
+  0x0c043429U, 0xfb10fefbU, 0x0b1ff6ffU, 0x19daf901U, 0xf3d7f301U, 0x0cf3d4f3U, 0xe3ebdf15U, 0xfaf5ee0aU,
+  0xf7fef824U, 0x001dfe04U, 0xd81e0711U, 0xe8ffe7efU, 0xefb72befU, 0x0ad700fbU, 0xeaddfce7U, 0xc403f00cU,
+  0x02a600f5U, 0xfc1a00f6U, 0x10e700faU, 0x020700efU, 0xcf050b24U, 0xb019fbe4U, 0xee1403e2U, 0x100ac9e6U,
+  0xf8ded600U, 0xe1120c00U, 0xe01d0c00U, 0xf0190b00U, 0x00471beeU, 0x000c1c1aU, 0x00e2ede2U, 0x00da1f15U,
+  0x2515202aU, 0xf5e5f6e6U, 0x2223f102U, 0xd6bdeb10U, 0x05fc092cU, 0x1ce7d6efU, 0x19d2c508U, 0x3300cf21U,
+  0x1205ec1eU, 0xef232f0dU, 0xe2301dfbU, 0x05fb0fd9U, 0x03c929f7U, 0x16ef11ecU, 0xdbaf2105U, 0xc40cfe34U,
+  0xe5da0025U, 0xee2700f7U, 0xe0ea00c3U, 0xacdc00f2U, 0xe6072afeU, 0xe90e0df2U, 0xe0210604U, 0x12e5defaU,
+  0xb0f40a00U, 0xd7fdfd00U, 0xe420fa00U, 0xd92a6e00U, 0x0021e4e8U, 0x00021555U, 0x00c3ea16U, 0x00b9472eU,
+  0xfcf72512U, 0xddee0df5U, 0xdbfefbffU, 0xb0e6dd25U, 0xe23607fdU, 0x0ef1f804U, 0x3308cffaU, 0x38fbdb2fU,
+  0x2efb002bU, 0xf915361aU, 0x0b130719U, 0x13dae9bfU, 0x21c42506U, 0x38fa12f7U, 0xfacb1c31U, 0xbcf1f051U,
+  0xf715002eU, 0xfe2000fcU, 0xfaee00c1U, 0x8dfc00fbU, 0x19090f25U, 0x10172a19U, 0xcefb14e6U, 0xe4dbd32dU,
+  0xb8ff0500U, 0xd5e4ed00U, 0xcb243a00U, 0x01576600U, 0x0007cd1eU, 0x0019f54eU, 0x00bb1f30U, 0x00ac5568U,
+  0xd5161edaU, 0xeff40cecU, 0xc5e4e802U, 0xbedbdf1aU, 0xe32cf5fdU, 0x01020b06U, 0x2323e2ffU, 0x3ff2e615U,
+  0x2aea0026U, 0x0bee1b1cU, 0xffeb0d1dU, 0xd4bcc3edU, 0x38e3f73bU, 0x16fd1903U, 0x0dda0923U, 0x1afff414U,
+  0xdd3c0043U, 0xeffd00fdU, 0x240400e2U, 0xcd030002U, 0x030a08fdU, 0xf2093230U, 0xe00604ffU, 0xc9efe400U,
+  0xc8f8f000U, 0x01edef00U, 0xfb3e0200U, 0x07604a00U, 0x000dd90bU, 0x0008eb1cU, 0x00e00c24U, 0x00cf2f45U,
+  0xbe29fcccU, 0x1408fef4U, 0xeec0ebf0U, 0xb28ce419U, 0xf219e50bU, 0x00fb161cU, 0x27f2ea16U, 0x4f31e717U,
+  0xf8e31902U, 0x04faf117U, 0xeee9f3f8U, 0xede3bedfU, 0x12f3f51aU, 0xfe21fbfeU, 0xe9ec0207U, 0x09f1f30eU,
+  0xd6eb00f8U, 0x08fa00ceU, 0x2b0600feU, 0xdefe0040U, 0xfbfe01ebU, 0x0ae7ff0aU, 0x1a0000edU, 0xe813fef5U,
+  0x000f0200U, 0xfcd9eb00U, 0x0315ee00U, 0x06f43400U, 0x00dc0603U, 0x00260af5U, 0x00001919U, 0x00caf103U,
+  0x01f6e4f6U, 0xf6fa1cd1U, 0xfe2409f0U, 0x06e3ea45U, 0xfcefefeeU, 0xf9e7e9feU, 0xffef1624U, 0x0930caeaU,
+  0x05e7effaU, 0xf107e8f6U, 0xf63dfcf0U, 0xfbebf611U, 0x01f7f2f6U, 0xf5c90ffcU, 0x1b2c1109U, 0xebf7f6f9U,
+  0x04e600ffU, 0xefd00003U, 0xffe00015U, 0x13110038U, 0x01f5fae7U, 0x0bc8ea0bU, 0x0ff60a06U, 0xdbfefbeeU,
+  0xfb291100U, 0xf7cfe800U, 0xed13d600U, 0x06f96900U, 0x00e2211dU, 0x002b1d28U, 0x00fd1240U, 0x00eb0aefU,
+  0x060bf9f2U, 0xefe754d9U, 0x24fa2101U, 0x0dfdfe1dU, 0xfbfed8ecU, 0x01cd05f2U, 0x2bce270eU, 0xd946c4f9U,
+  0xfa0ee711U, 0x14fccffaU, 0x0d4febefU, 0x0be1f604U, 0xf1cfeaf3U, 0x16b01ef0U, 0x2a2b190aU, 0xc5cfd100U,
+  0x0ce9001eU, 0xcdc00001U, 0x080100fdU, 0x21210069U, 0x0cbdfecdU, 0x0bddda05U, 0x1bf00e0fU, 0xd30bfd0aU,
+  0xfe082600U, 0x17f3d000U, 0xe1e5de00U, 0x0ded6800U, 0x00f50e2cU, 0x00170f6dU, 0x00f0ff1dU, 0x00190e01U,
+  0xfc19fe27U, 0x0ed562dbU, 0x34052ef0U, 0x11e3e012U, 0xed2feae8U, 0x39b91df7U, 0x239d111aU, 0xea3ff203U,
+  0x2105f1f2U, 0xfd48e2e2U, 0x035df806U, 0x1ec7f3ddU, 0xeccdc0e8U, 0x08c101e2U, 0xfe0b1a1bU, 0xc3c1e9f0U,
+  0x160200fcU, 0xcad3000cU, 0x151100daU, 0x28070023U, 0x03e007eaU, 0xfffcddefU, 0x0dfb10ffU, 0xc903fcf7U,
+  0x05f53a00U, 0x0215f800U, 0xf2d8f400U, 0x2fef3700U, 0x00051c1eU, 0x00090f22U, 0x00e8eefaU, 0x00160501U,
+  0xf52bfcfdU, 0xf5e0291fU, 0x3c200becU, 0xf8dddef8U, 0xf422e502U, 0x41e7bd10U, 0x16c4bf0eU, 0xfd08fffeU,
+  0x1efff6eaU, 0xf16ad9deU, 0xeb5be713U, 0x29c506f7U, 0xccf0b8e7U, 0xc9bff2e9U, 0xef011bf0U, 0xd6e0e5d9U,
+  0x061000eeU, 0xadd200f9U, 0x1f0a00dcU, 0xf4f400fcU, 0xfaeafaf6U, 0xc72dfb03U, 0xfef40cf6U, 0xd6edf80cU,
+  0x01f93e00U, 0xff3d2500U, 0xdec2ec00U, 0x05f22800U, 0x00f1152bU, 0x00f2062bU, 0x0007f2ecU, 0x000007e4U,
+  0xf722e825U, 0x19ba2aebU, 0xfc14c8f2U, 0xedf2c1fcU, 0x1a1debffU, 0x2d1ee507U, 0xfee8ee0cU, 0xeb0ef6feU,
+  0xf90fdef4U, 0xfa7ffaecU, 0xf51bd0ecU, 0x26cbe101U, 0xdde4efe8U, 0xdae901e2U, 0xebf41703U, 0xf5e7f0eaU,
+  0x18100021U, 0x18d400d1U, 0x13ff00f6U, 0xef2c003fU, 0x000d01deU, 0xf4dbf702U, 0x13f505dbU, 0xfdd7fdedU,
+  0xeff31c00U, 0x01b8c500U, 0x0a0eeb00U, 0xf9054200U, 0x003613fcU, 0x0035f7fbU, 0x00c00110U, 0x00de1002U,
+  0xeaf00df5U, 0xf01320e5U, 0x252bf014U, 0xe9d7e61fU, 0xfde1dd06U, 0xeefa28f9U, 0x11e42617U, 0xfb3ed000U,
+  0x05eadef3U, 0x27fad202U, 0xe73717ecU, 0x1be0f508U, 0xf3e81df5U, 0xfcb404e4U, 0x14060215U, 0xeef9ebeeU,
+  0x263200f4U, 0x1bba0002U, 0x10f500d6U, 0x13350048U, 0xeb0213ddU, 0xfbe0f6f2U, 0x09f9c8e1U, 0xf6ea09e3U,
+  0x00030a00U, 0x0dc3ed00U, 0xf52ad400U, 0x04084500U, 0x002b2503U, 0x0037eb30U, 0x00d30b0fU, 0x00ef23f2U,
+  0xf106fee5U, 0xf8eb5307U, 0x00f2f7feU, 0xd5ebf60cU, 0xea01cc0fU, 0x24cb1df3U, 0x31dd1e22U, 0xd53bef07U,
+  0x1803c917U, 0x3fe0c300U, 0xfa2cf3efU, 0x0def0d13U, 0xd8f11bfdU, 0x33cb08e1U, 0x04061700U, 0xebf2c9f4U,
+  0x1f4d000cU, 0xf9cd0004U, 0x01f900c3U, 0x192a003dU, 0xfcde22daU, 0xfc13d90eU, 0x04f0d2ffU, 0xf0f608d4U,
+  0x10002800U, 0x110ade00U, 0x0613de00U, 0xffea2900U, 0x002928e6U, 0x0017011cU, 0x00e42cf6U, 0x00ed30ecU,
+  0x003ee3f9U, 0x26e34913U, 0xecf6ec0dU, 0x0f00fa00U, 0xbb2fde06U, 0x41bb11e8U, 0x0dae2b19U, 0xdc20fd18U,
+  0x28e8d4f3U, 0x1318090cU, 0xf71f0a03U, 0x1cebeadbU, 0xe6150c07U, 0xf8e815e9U, 0xf200091cU, 0xdefee5d0U,
+  0x083f0007U, 0xcdd200e7U, 0xf41400f2U, 0x1e20002bU, 0x24f400f1U, 0x1e2fdae5U, 0xee0efbd9U, 0xe606fde1U,
+  0xee032100U, 0xed350a00U, 0xeae70400U, 0x18d7f000U, 0x00214000U, 0x00f413e0U, 0x00da2902U, 0x000a1116U,
+  0x034ceb04U, 0xf0eb0c33U, 0xea30e225U, 0x0b10e306U, 0x0818c10eU, 0x2900eafeU, 0x08cee11bU, 0xf31cf706U,
+  0xf4dbe3f4U, 0xec1efb07U, 0xef57f71aU, 0x0bca08caU, 0xf3f4f8f9U, 0xd0d61bd2U, 0xe3ccf309U, 0xe50a0817U,
+  0x20370004U, 0xb1bd00fcU, 0x112a00fbU, 0x00580022U, 0x0cf0ee07U, 0xe777c909U, 0xe4060aedU, 0xe2eb000bU,
+  0xf0ee4100U, 0xdd342d00U, 0xffe5f400U, 0x09e2f500U, 0x00f21cf6U, 0x00d0f50aU, 0x00e6ff08U, 0x0016fae8U,
+  0xee34cffdU, 0x59c30f0aU, 0xd32cfa49U, 0xef06bb1aU, 0x1513dffeU, 0x171bd629U, 0xd3d7de10U, 0xf20ee9f7U,
+  0x0112dceeU, 0xfe63f600U, 0xf345d206U, 0x04a7eae2U, 0xdccfedffU, 0xb3edfedeU, 0xd9da0222U, 0xfe061803U,
+  0xf1f6002eU, 0x1fe200f9U, 0x070e00f4U, 0xf4100017U, 0xe8121724U, 0x09e807edU, 0x04fb05dfU, 0x0ee903f9U,
+  0x16ba2e00U, 0xf4e7ca00U, 0xe820df00U, 0xfbfc3600U, 0x00110d08U, 0x002901deU, 0x00a201fdU, 0x00e92affU,
+  0xd4f93a27U, 0xe9110ce3U, 0xfa0ed0ffU, 0xe0c7b802U, 0xf6fe211bU, 0xefeb1d0bU, 0x18f2161cU, 0xdf45dc10U,
+  0x10bec1f3U, 0x1ae3e2f1U, 0xdf3c00d4U, 0x1b00ed19U, 0xef0e38f6U, 0x17c9f1f0U, 0xf0fc0623U, 0xd906f4f9U,
+  0xf6f00030U, 0x0bdf0018U, 0x11fe00e0U, 0xf12d0022U, 0xdb0e36f9U, 0x200addd6U, 0x0309cae6U, 0xfdec2324U,
+  0x2aa0ff00U, 0xf0121700U, 0xea42d900U, 0x0cf51100U, 0x00122d02U, 0x002be004U, 0x00b9f101U, 0x00ff29e9U,
+  0xd1fc4a19U, 0xf4051ee4U, 0xe6f7db01U, 0xbff5ddffU, 0xd3013525U, 0x20d40c02U, 0x0d0f1d1bU, 0xfa13de09U,
+  0x00d8aae8U, 0x27fdc81bU, 0xee0aeed4U, 0x1eff1718U, 0x0a26420fU, 0x30d506d7U, 0x04ef1b0bU, 0xaa26e211U,
+  0x0a01005fU, 0x02f50005U, 0xfbe500dcU, 0x1122002bU, 0xeaea2dfeU, 0x061eee03U, 0x02fbcecdU, 0xe8be1133U,
+  0x1db3f700U, 0xf91bff00U, 0xf20ceb00U, 0xdae1e300U, 0x001327ccU, 0x0022f8fbU, 0x00e71b27U, 0x00201ac2U,
+  0xf2f73c25U, 0x2cf512f5U, 0xd521e50eU, 0xd3100105U, 0xbf06181aU, 0x58c02215U, 0x12ee091dU, 0x0929211eU,
+  0x01f3cbfbU, 0x1032f722U, 0xf804f7e9U, 0x08d1f1f9U, 0xed2a300eU, 0xdef009cdU, 0x050a0afcU, 0xee0bd8f9U,
+  0xe61b0061U, 0x00ee00d2U, 0xf6f60002U, 0xf614001cU, 0x23fb12ebU, 0xf61cea13U, 0xf4e20edfU, 0xe2ee0d33U,
+  0x29d90f00U, 0x0b260100U, 0xf9d90a00U, 0xf1cff100U, 0x001b2c03U, 0x0005e2fcU, 0x00dd0e03U, 0x0034f31aU,
+  0x00ea353fU, 0x1cea0023U, 0xd94fbf1aU, 0xf2fc1d0bU, 0xfdce081aU, 0x44fbbf05U, 0xf9f9e711U, 0x181e3a15U,
+  0xedf2e718U, 0xe903130cU, 0xfe2a011fU, 0xfac01dcbU, 0xe70d3af8U, 0xf6f816f0U, 0xfadee4f0U, 0x0b00111eU,
+  0xe329003eU, 0xaff900d1U, 0x030100f4U, 0xc84d0013U, 0x2ee4e5faU, 0xc25edbffU, 0xdaf701cfU, 0xf7d81923U,
+  0xf3e61c00U, 0xf23e3d00U, 0xf1cc1000U, 0xfa04d700U, 0x00350429U, 0x00f0db08U, 0x00d5ed19U, 0x0035e719U,
+  0xd5d0fe33U, 0x3703c00fU, 0xf32ae946U, 0xd6f8f206U, 0x36f8ee10U, 0x0530c427U, 0xdbe6ea24U, 0x16f8f9d8U,
+  0x08f9fefcU, 0x0f253516U, 0xf878eef2U, 0xf19e0bd3U, 0xffc919c6U, 0xb509ec27U, 0xcff1d900U, 0x30030d15U,
+  0xd9fa0029U, 0xf3f80002U, 0x171200f9U, 0xfa080001U, 0x03d62842U, 0x0bfb0df4U, 0xf9340de8U, 0xcbc5f204U,
+  0x2dc12000U, 0x010ed500U, 0xe23bef00U, 0x00f31600U, 0x0009fa0eU, 0x0027d8e1U, 0x00ea4beaU, 0x00e22bf5U,
+  0xe905dd2fU, 0xeaf80df3U, 0x1bdde41eU, 0xff02ccf1U, 0xfa4a0e0bU, 0x11f022f7U, 0x00f1d21bU, 0xe62d150dU,
+  0x0dcfe2f4U, 0xfbf4d80eU, 0xde3becd6U, 0x250ce312U, 0x1562fc0cU, 0xfa050105U, 0xc009350aU, 0x01f6f7efU,
+  0xd2dc001fU, 0xfd1c0034U, 0x1b0100cdU, 0x03cf0006U, 0x19d5303eU, 0x221decebU, 0xef00ee09U, 0xddbe002bU,
+  0x169a0000U, 0x01160d00U, 0xec3a0b00U, 0x16f0f300U, 0x00240400U, 0x000c1403U, 0x00ec1ef0U, 0x00f019edU,
+  0xd2fa1135U, 0xeef50bccU, 0x1accdb0eU, 0xf927eff3U, 0xca1b1816U, 0xfbef23f7U, 0x04f6da02U, 0xed0e2a02U,
+  0x13c4dcf9U, 0x1013d618U, 0xdb2214d5U, 0x30ffde21U, 0xd93e1703U, 0x15f40cfbU, 0xe91b3514U, 0xc500e1ebU,
+  0xf2130058U, 0xf60b0007U, 0x09d100e7U, 0x01f00005U, 0xf6e42c25U, 0xf41ef617U, 0xf80ade06U, 0x15fb2866U,
+  0x0bade900U, 0x0733ff00U, 0xfa193900U, 0x0becde00U, 0x002c041dU, 0x00221c10U, 0x00f525ffU, 0x0021ead7U,
+  0xf1f6103dU, 0xedea09d0U, 0x1bf3da22U, 0xe90813f0U, 0xe9e04217U, 0x3de206f6U, 0xf1d8e327U, 0x1e252803U,
+  0x0de50debU, 0x0526052dU, 0xe511e1e4U, 0x19dbe242U, 0xde320decU, 0xd01601dbU, 0x070409e0U, 0xd8fbdef0U,
+  0xd30c0044U, 0xebea00d5U, 0xf7fa00f5U, 0xf1430001U, 0xdd073ad9U, 0xf521f014U, 0xe4ecf103U, 0x2302203eU,
+  0x1ddd0d00U, 0x0d12ee00U, 0x0d071700U, 0xfde6df00U, 0x002dd552U, 0x00120c1eU, 0x00f40712U, 0x0016f51aU,
+  0xf7c10244U, 0x15e2ebe9U, 0x090ac943U, 0xd4f91beaU, 0xf7e8f7f1U, 0x35fcfc1eU, 0xfee8f824U, 0x151322feU,
+  0x01f41fffU, 0x0b001e17U, 0xf22bd5ffU, 0x16d01d29U, 0xf8281f05U, 0xecf01515U, 0x1605f0e2U, 0xee04031cU,
+  0xe9110037U, 0xc70500b1U, 0xc1d800e5U, 0x036400faU, 0x04e9fa11U, 0xd426f3f0U, 0xb31709e3U, 0x06e00511U,
+  0xf4161500U, 0x00062200U, 0x0cd52600U, 0xf422bd00U, 0x000cf071U, 0x002df62aU, 0x00f0d72cU, 0x00380f2eU,
+  0xd4a0f138U, 0x0b29d1d8U, 0x25f9035cU, 0xc2fffbf7U, 0x2a19ecebU, 0x3336f512U, 0xed00fc29U, 0x1cf90ac4U,
+  0x24d5450dU, 0x2d0c3833U, 0x087fd3f5U, 0xee8132ffU, 0x0ddbfc08U, 0x1cfbef31U, 0xeb1becdaU, 0x31e00911U,
+  0xee12001bU, 0xd7f70003U, 0xf2da00deU, 0x18ef001fU, 0x26e4f91dU, 0x0ff037fdU, 0x9f3fe2f0U, 0xd5d7feeaU,
+  0x16ff0300U, 0xf8ceee00U, 0xfdedf400U, 0x040d0600U, 0x001634e1U, 0x000b040dU, 0x000928e9U, 0x00fd39e5U,
+  0x132a081eU, 0xf613f107U, 0x18ddf912U, 0xee21e701U, 0xe634331bU, 0x15e708ffU, 0x11ebdf43U, 0xde4704efU,
+  0x0bda2a16U, 0xf708df1dU, 0xe749de17U, 0x10e402e6U, 0xe940f932U, 0xe806fc15U, 0xb8ff250bU, 0x0efde7e7U,
+  0xebfc00e4U, 0xe6250015U, 0x1af00008U, 0x0a1f000bU, 0x30f6e74bU, 0x12ec0df8U, 0xb120d1faU, 0x00e2f904U,
+  0x22f4ed00U, 0xdcd6e200U, 0xf80c0d00U, 0x40f9fc00U, 0x00061510U, 0x00eefd2dU, 0x002551f6U, 0x000ff4ceU,
+  0x1a39f426U, 0xf10efa06U, 0x21e4eb2aU, 0x1b2cedf9U, 0xf20a2a2bU, 0x202b0419U, 0x1aeee150U, 0xe5323df1U,
+  0xefcb321fU, 0x0b46d046U, 0x0a46d517U, 0x0ed80119U, 0xbf2afb0aU, 0xe2e6ed1dU, 0xbf1f3d30U, 0x1a2adbd1U,
+  0xe3eb0020U, 0xe3fe0011U, 0xe9c60010U, 0x230f0002U, 0x13fa1c3dU, 0xdcf21225U, 0xbdf5ebf2U, 0x35fdf334U,
+  0xf8e7e300U, 0xe413e600U, 0x00275a00U, 0x11dfd300U, 0x00f3f564U, 0x0017e927U, 0x002a0cf8U, 0x0008f8caU,
+  0xfe07051dU, 0xc90c18d5U, 0x05f2f45dU, 0x3a2412eeU, 0x33ee1c0bU, 0x3a3600f2U, 0x1acdd954U, 0xd42b02f3U,
+  0x09f30b01U, 0x113bf94fU, 0x1135bd0cU, 0x11f4ed23U, 0xb2ef090dU, 0xe1f1f911U, 0xea26261eU, 0xd0e0f712U,
+  0xeff00025U, 0x05f400f5U, 0xc9cd002eU, 0x210300e7U, 0xd7e9302bU, 0xf813eb16U, 0x99fadcf9U, 0x3221f541U,
+  0xf3f50f00U, 0x1216ef00U, 0x0e184900U, 0x13b5be00U, 0x00edf17fU, 0x002de736U, 0x0011ff19U, 0x00d6fb11U,
+  0xd2cc04f9U, 0xf2e619e5U, 0xf81bff3eU, 0x192421dfU, 0x1af001f8U, 0x41300611U, 0x25eb0d15U, 0xde17e4f1U,
+  0x03eb1322U, 0x201d261dU, 0x121eb001U, 0x25f00f13U, 0x03edfb0fU, 0x16ea0eedU, 0xf42106d9U, 0xefcffd45U,
+  0x0e24001eU, 0xf50f00e0U, 0xbed70006U, 0x391500f4U, 0xf1dd0c13U, 0x1611ebfcU, 0x871fe5feU, 0x2de90b02U,
+  0xdb2a3000U, 0xf71a2300U, 0x1ef05500U, 0xf3ed9900U, 0x00fd2d73U, 0x001d1135U, 0x00010102U, 0x00ddf91cU,
+  0xa5cbf9f4U, 0x1030f5d0U, 0x3022fa43U, 0xc0260ed5U, 0x3119f2f0U, 0x5036f9dfU, 0xf2290718U, 0xf3f302f6U,
+  0xfed20cfbU, 0x39173b2cU, 0x1b5afb22U, 0xf3ad0bf7U, 0x11d6f811U, 0x7304f90fU, 0xd9180bd2U, 0x1debf93dU,
+  0x0a030000U, 0x0afb00f8U, 0x191a0015U, 0xd1df00f8U, 0x10e40affU, 0xfdf702f8U, 0x011a001aU, 0xf70903f3U,
+  0xfef7f500U, 0x0411fb00U, 0xfc201c00U, 0x03dee900U, 0x00f4e8d5U, 0x000603feU, 0x0005ffe9U, 0x00e606f9U,
+  0x04f8e8f9U, 0xfef7ebf6U, 0x04131f27U, 0xfae1dcdbU, 0xf82b2b01U, 0x02ed0808U, 0x02f3ca05U, 0x0000dbf1U,
+  0xf7f7fae3U, 0x14fde301U, 0xc40e3302U, 0x19eef5f4U, 0x1501fefdU, 0x0e10e9fbU, 0xf0e0090aU, 0xf90006feU,
+  0x02eb0008U, 0x091300e2U, 0x0c1e00e6U, 0xfcec00e9U, 0x22e00414U, 0xedf81ce9U, 0x0a280605U, 0xf9160b01U,
+  0xddf8cf00U, 0xe715ff00U, 0xce401d00U, 0x08f2e300U, 0x001ae4d9U, 0x000df214U, 0x000818d0U, 0x00e40dd1U,
+  0xef0b09d9U, 0x2200eaf9U, 0x0a35eb20U, 0x0be2dfb0U, 0xdb5046e5U, 0x01e906fdU, 0xf01ccaffU, 0x03e1030fU,
+  0x07cf02ecU, 0x000002f6U, 0xd2f92b27U, 0x2bfce108U, 0x280d21f7U, 0x1a09fefbU, 0xbcaf080fU, 0xea2af80bU,
+  0xe6ec001bU, 0x140e00f1U, 0x313b00cbU, 0xf7d2001bU, 0x15d3fc04U, 0x01f80cf2U, 0x1c102415U, 0xfb291a39U,
+  0xfd01b800U, 0xfa0de500U, 0xe0461100U, 0x0befd700U, 0x001fea27U, 0x00050c15U, 0x0000ede0U, 0x00ee1dc9U,
+  0xc01304d8U, 0x1220ec0aU, 0x1b43c3f1U, 0x47e60af7U, 0xe11641d6U, 0xf7d30d00U, 0xf22bccfaU, 0xf1f72c08U,
+  0x36ae13e8U, 0xf613f3dfU, 0xf0f22c1dU, 0x0c07a4f9U, 0x5e040d00U, 0x0301fc14U, 0xdbd7051bU, 0xd63eeff5U,
+  0xb7df0030U, 0x0bf500e3U, 0x310400ecU, 0x2ae800f7U, 0x04c905eeU, 0x15000502U, 0x3bf31212U, 0x18101e39U,
+  0x06f3c300U, 0x051bc700U, 0xeb412100U, 0xf428fa00U, 0x001dfb45U, 0x00091111U, 0x0001ebcbU, 0x00062fbeU,
+  0xae3b09f8U, 0x0f2813fcU, 0x0f26aee0U, 0x45fe080cU, 0xda0c46f7U, 0xf7dc18ffU, 0x0736b1e4U, 0xd9081813U,
+  0x01eaf4f2U, 0xe911eee7U, 0x08c0290aU, 0xef07b6f7U, 0x57f6f101U, 0x070101f6U, 0xfdf4eb31U, 0xe40cfefdU,
+  0xd4db001bU, 0x06f300f7U, 0x181700f7U, 0x1dd500c6U, 0x31e305f6U, 0x20f20109U, 0x26bcff08U, 0xfa2e0e32U,
+  0xfef4ca00U, 0xfdf2cb00U, 0x10fcf600U, 0x170a1c00U, 0x00ef0954U, 0x00150016U, 0x0004f6b9U, 0x001108fdU,
+  0xcf421ff1U, 0x12362003U, 0xf4fa9addU, 0x260828f2U, 0xff2425fbU, 0x0d001b07U, 0x0329e9f2U, 0xfd0d1c07U,
+  0xf5f9f0d9U, 0x011de5faU, 0x0db5330fU, 0xf10ba5d1U, 0x32e8fcf0U, 0xe900df0cU, 0xf2fdca27U, 0xe71bfbedU,
+  0xf4f6001dU, 0x04f3000eU, 0x0df8002dU, 0xf3f80017U, 0x12e819ffU, 0xf209f9eaU, 0x13150b07U, 0x0b04f1f1U,
+  0x03210100U, 0xf910fd00U, 0xfe2d1100U, 0x081af600U, 0x00f1f9d5U, 0x00282300U, 0x00d938ebU, 0x00ef1defU,
+  0xe0f5f106U, 0x0df51af5U, 0xfd12f64aU, 0xead2050bU, 0xd34013d8U, 0xf0f2fcf5U, 0x1c03c20aU, 0xf5eff00bU,
+  0xeecffbeaU, 0x07f5f5f4U, 0xc1131dd1U, 0xf5e8f8d8U, 0x06302504U, 0x10f0fe05U, 0xf3d4120bU, 0xe6fb26f7U,
+  0x07cc0009U, 0x0d09000eU, 0xfc180005U, 0xc5060026U, 0x14e5031bU, 0xe203def0U, 0x090520f2U, 0x0a331715U,
+  0x09170f00U, 0xef0bf100U, 0xed340b00U, 0x1517e800U, 0x000bf8f5U, 0x00012107U, 0x00fbf8fbU, 0x00e422deU,
+  0xe4f91908U, 0x00f91ad7U, 0xe7190013U, 0xe2e901f5U, 0xad5932d8U, 0x00f718edU, 0x1519d60bU, 0xd4e32408U,
+  0xfbdbeaf0U, 0xf3f603dcU, 0xe1fa10edU, 0x11f5d9f7U, 0x2143ed10U, 0x1a06120eU, 0x16df0b0aU, 0xd7492003U,
+  0x03e60006U, 0x09120011U, 0x0c3e0007U, 0xe0d5002cU, 0x12dce7f4U, 0xdcf2e9f7U, 0x01fb20efU, 0x191d343cU,
+  0x1b232300U, 0xe7fae100U, 0xfa19e900U, 0xf114da00U, 0x00101f20U, 0x00050813U, 0x00fae013U, 0x00e30ac2U,
+  0xedf7fa0cU, 0xf30701dfU, 0x121bf0f9U, 0x0afcfa16U, 0xba2539dfU, 0xf0ed04f0U, 0x1f00e7e3U, 0xd0163df3U,
+  0x2a1af3efU, 0xd4f9f0d7U, 0xfd14230eU, 0x0114d323U, 0xf32bd2f6U, 0x08fc0efeU, 0x15ec0635U, 0xd338ebecU,
+  0xf1e9002aU, 0xf9f300feU, 0x1c17000dU, 0x10b200e8U, 0xf10cf9ebU, 0xf9f808daU, 0x24ee2b04U, 0x15254028U,
+  0x10e04a00U, 0x000dc100U, 0xf222e300U, 0xdf2a0c00U, 0x00f0122aU, 0x00f21c11U, 0x0007e816U, 0x00dc1bceU,
+  0x04fb15f9U, 0x022015f9U, 0x1b12e7eeU, 0x0aeffa21U, 0xd0312be1U, 0x07dd1403U, 0x131ffad1U, 0xe0e12f04U,
+  0xf538dff5U, 0xde01f0dbU, 0xed151afdU, 0xfb1cad0bU, 0xe0250fd4U, 0xf0060dfeU, 0x080fc83eU, 0xfd19fad5U,
+  0xc2dd00f9U, 0x18ec0002U, 0x0a0e0009U, 0x3cc100b0U, 0x3ff90e0eU, 0x200413f1U, 0x2dc80e05U, 0xf4442203U,
+  0x0ce91d00U, 0xeef9dc00U, 0xed45f500U, 0xed184a00U, 0x00cc0a2bU, 0x00e61409U, 0x0007eae4U, 0x00d235cfU,
+  0xf8e62cfcU, 0x1628f7fbU, 0xe505e1d4U, 0x2bfc0a05U, 0xe4252517U, 0x01e61e07U, 0x1e3ce3e7U, 0xeef5290fU,
+  0xfb1dc5dfU, 0xfd1ffdf0U, 0x1bd6161bU, 0x0102b0dcU, 0x15fd22fdU, 0xfd0c0d05U, 0xef07a938U, 0xf9221deaU,
+  0x0bef0004U, 0x1ce8000fU, 0x23f4002eU, 0xeedf0036U, 0x191ef2d3U, 0xdf14f117U, 0x000ef7d7U, 0x11f90506U,
+  0x060a0000U, 0x20c50000U, 0xfe1a0c00U, 0x190cf000U, 0x00093e07U, 0x00181516U, 0x00dd730eU, 0x00fe19e3U,
+  0xe1f83812U, 0x1bef55fdU, 0xfaf1db5aU, 0xe5c82527U, 0xcc05e313U, 0xf5eb37f8U, 0xf528b90aU, 0xe7d50509U,
+  0xf7df0ddfU, 0xf3fb04ebU, 0xd6081ddbU, 0xebcef8cfU, 0xd7f44f2dU, 0x2b140ff8U, 0xf9c5280cU, 0xb8234207U,
+  0x29f500eaU, 0x24ee002cU, 0x1d0a000bU, 0xd9fe0018U, 0x100b0ad5U, 0xd010e316U, 0x0c19e5d0U, 0xfc150613U,
+  0x0e2f2200U, 0x00d80100U, 0xe60a1d00U, 0x2701f000U, 0x00292609U, 0x00022133U, 0x00e434f9U, 0x00fd1ffeU,
+  0xe70a32fcU, 0x1dd44307U, 0xf0eae207U, 0xebd9272cU, 0xbd09ef52U, 0xe9f436feU, 0xee15cbe4U, 0xadea1d30U,
+  0xfe0adefaU, 0xee38fec7U, 0xf204ebeeU, 0x0302dfd8U, 0xdc0e501cU, 0x1ff40de3U, 0x04e40823U, 0xe05d26f6U,
+  0x34e5000dU, 0xfeeb0012U, 0x110d000eU, 0xfdd40038U, 0x16f4e0c4U, 0xcde5edf1U, 0xfd080cdeU, 0x01240afaU,
+  0x09104700U, 0xe1e70e00U, 0xdc0d0300U, 0xfb1a0500U, 0x002651deU, 0x00e6fd49U, 0x00e80500U, 0x000a1fbfU,
+  0x1d241d23U, 0x08e41e1cU, 0x17ff06dcU, 0x11f81b5bU, 0xa408ff0dU, 0xc10e22f7U, 0xeb0813f7U, 0xc215f30cU,
+  0x112fe1e5U, 0xe2022ba9U, 0xf635f105U, 0x1d14b300U, 0xe6fc0f17U, 0x11e7f9fbU, 0x01010e09U, 0xf0ff13deU,
+  0xeb10001eU, 0xe2020028U, 0x19280006U, 0x2cdf0014U, 0x2211ed05U, 0xf9d9e7d6U, 0x12ff2fe3U, 0x23250ff2U,
+  0x09f47f00U, 0x0e0afa00U, 0xd3ebe600U, 0xcc242200U, 0x0011fad6U, 0x00e82f61U, 0x000bf411U, 0x00f825dcU,
+  0x1f1a1d12U, 0x0c040114U, 0x40fd1cf7U, 0xf9e61432U, 0xd914f41aU, 0xdbea150dU, 0x03ee11eeU, 0xf4021201U,
+  0x0f03a606U, 0xf72703adU, 0xdc1e0003U, 0x0619ce05U, 0xbaf419feU, 0x0003e9d8U, 0x1311fd24U, 0xf50108d0U,
+  0x051b0018U, 0xfdf700ffU, 0x29fb00e3U, 0x49fb00c9U, 0x0727da24U, 0x300c01d5U, 0x2b062a17U, 0xf41b08fcU,
+  0xe9f94600U, 0xf7f2ff00U, 0xe724f900U, 0xf5e82600U, 0x000de1d1U, 0x00031c0eU, 0x000ff116U, 0x00eb26b6U,
+  0x23f2fa1aU, 0x1409ef15U, 0x11dcfcf7U, 0x13e3e602U, 0x0d37e72bU, 0xe2dc2000U, 0x0110f204U, 0xede9fdf8U,
+  0x161da3fcU, 0xfa23f7c6U, 0xf8010c16U, 0x000cf1fbU, 0x92d61afbU, 0x050af8dcU, 0x0009e321U, 0x08370ac3U,
+  0x1bf20004U, 0x1be80011U, 0x5afa001aU, 0xe5de0033U, 0xfc13e3c8U, 0x06083005U, 0x0516dce1U, 0x3125f7fbU,
+  0x0bf30100U, 0x2ab40600U, 0xe1fe0800U, 0x28feeb00U, 0x00263af5U, 0x000ae810U, 0x00e57ffeU, 0x004e1613U,
+  0xfc133912U, 0x49f63d0bU, 0x0b00f63dU, 0xe8d66547U, 0xe2b5215bU, 0x1cf42ff8U, 0xfb18a021U, 0x06c0e21eU,
+  0xe921ddfeU, 0x041909feU, 0xe30229ceU, 0xdfd30ec3U, 0xf0ee270dU, 0x2139fb0dU, 0xe8c829fdU, 0xd5ff7c0fU,
+  0x3fd80016U, 0x30dc0014U, 0x19050000U, 0xc3ea00fcU, 0xe5fb08caU, 0x9b14ea19U, 0xe509dde5U, 0x01170ce2U,
+  0x0dea1400U, 0x10ad0b00U, 0xe7d30300U, 0xf10bf100U, 0x002454f2U, 0x00dcfd0dU, 0x00f95901U, 0x0027212dU,
+  0x130829ffU, 0x46cc541cU, 0x040af9ffU, 0xfecf2835U, 0xf0b54a3fU, 0xe2f65d0dU, 0x0b21c708U, 0x09d4f635U,
+  0xf102072cU, 0x0b3ee10dU, 0xf3190cc7U, 0xe905e6cdU, 0xfae63616U, 0xf81ae8deU, 0x06e20c1bU, 0xfa034501U,
+  0x33f4001eU, 0x31d3002aU, 0x0116000dU, 0xfd18000fU, 0x22132ce2U, 0x8bc9caffU, 0xedffffdaU, 0xeb08f1d9U,
+  0x06c33200U, 0x14cf1800U, 0xd7e80800U, 0xe72c1f00U, 0x001823b6U, 0x00e5f014U, 0x00f91137U, 0x00ff1314U,
+  0x22283002U, 0x2bcf1443U, 0xf70b10eaU, 0xfae6f93cU, 0xd9f52110U, 0xded24703U, 0x00f71805U, 0xec0d1621U,
+  0x0af6f627U, 0xe727e6b5U, 0xf72cece1U, 0x14f9d3beU, 0xda1f10e8U, 0x0f01f5edU, 0x0cfd0826U, 0x1fec180cU,
+  0xf912000aU, 0xf5d00026U, 0xfe010017U, 0x130f000fU, 0xfc1f16f8U, 0xb2f0cfd8U, 0x07ec13ecU, 0x0a0911e2U,
+  0xf69f3a00U, 0x42e83d00U, 0xe3e30300U, 0xdf391800U, 0x0006d7c9U, 0x00f5143eU, 0x0022f446U, 0x00eb06edU,
+  0x0a0013e3U, 0x2fdc1c1bU, 0xe3f519f5U, 0x1adbfe0cU, 0xcc12f610U, 0xecdb43fcU, 0x04f525eeU, 0xfa25240eU,
+  0x19032215U, 0xd341dd87U, 0xed1aef09U, 0x0418ebe8U, 0x9c0a34fcU, 0x0a0108edU, 0x1e030803U, 0x040ff8ffU,
+  0xeb0e00faU, 0xe9ec00e6U, 0x1ce200fbU, 0x2a2b0010U, 0xf905f90dU, 0xf8f7ece3U, 0xe10e300eU, 0xeafb01eaU,
+  0xf3ea0000U, 0xeccd3900U, 0xdbeaf000U, 0xe0fb2100U, 0x0014deb6U, 0x00f82addU, 0x000bfd3fU, 0x00ef13d0U,
+  0x08f808eeU, 0x02fe05eaU, 0xede70aefU, 0x0cdd0216U, 0x1140d408U, 0xe8ee2eecU, 0x11f3f00aU, 0xf304f0edU,
+  0x2300ee2aU, 0xe72dd0c3U, 0xfb0d001fU, 0xf5f7fae8U, 0x9fedfb17U, 0x07fb0afdU, 0x07fd01e3U, 0xff18fdffU,
+  0xe7f000e4U, 0x07030034U, 0x41fd0008U, 0xe2f2001bU, 0xe2dd090dU, 0x5e1611fbU, 0x0d36c6f2U, 0x3907ef1bU,
+  0x14cbf600U, 0x26ee0e00U, 0xfa190800U, 0x0c2efe00U, 0x0020f51fU, 0x0014d20aU, 0x002435e3U, 0x0042f717U,
+  0xe01ee603U, 0x4b1b2527U, 0x0cf42420U, 0x1bf57f25U, 0xf5d91b15U, 0x06215517U, 0x08ebd523U, 0x0ccdea1fU,
+  0x0107e42dU, 0x11f71509U, 0xea1f1af5U, 0xd6003af7U, 0xdaf5df09U, 0x20571519U, 0xdff22c09U, 0xea0644f2U,
+  0xede7001aU, 0x19e8002aU, 0x1bfb0023U, 0xd3010026U, 0xe9d1360cU, 0x34f2d1f1U, 0xe841dbf7U, 0x331827f4U,
+  0xfbe8f100U, 0x3df81e00U, 0xe5fa1e00U, 0xe225f000U, 0x0004d52eU, 0x0024e1d8U, 0x00333ff7U, 0x003ffb36U,
+  0xad11090dU, 0x623d1736U, 0x39071b11U, 0x2df6552dU, 0x1de521fdU, 0x260e7f07U, 0xfddfd42aU, 0x1ecbe311U,
+  0x0b0ee736U, 0x1019ece7U, 0xd7110c0bU, 0xe1e443ccU, 0xfcfae3faU, 0xed7404ffU, 0xfbf53903U, 0xf9f14802U,
+  0xf907003dU, 0x56eb0048U, 0xf4ed001eU, 0xdb09004eU, 0x22ed2c14U, 0x05fabddeU, 0xe81efa0aU, 0x1df736d2U,
+  0xf5d5ea00U, 0x57d92f00U, 0xe8f83200U, 0xb5242600U, 0x0015da07U, 0x002507dfU, 0x00283717U, 0x001de426U,
+  0xda060409U, 0x6940303fU, 0x11151315U, 0xfaf30f1fU, 0x06fd22f2U, 0xfee6790bU, 0xfaeace27U, 0xfd14edf5U,
+  0x20ec1226U, 0x0c2fca9bU, 0xf918d8faU, 0xf2dc2fd5U, 0xfa17eb1aU, 0xc579eadfU, 0x0dca19ecU, 0x20f9290bU,
+  0x05090037U, 0x3bc00011U, 0xe0f2001fU, 0xdb1c004dU, 0x2ef90c04U, 0xce02dcb7U, 0xe2081df7U, 0xe0f41fedU,
+  0x15cedf00U, 0x20bd3200U, 0xc6f83200U, 0xae432b00U, 0x0025e813U, 0x000debd1U, 0x002a1c33U, 0x00f9ec14U,
+  0xe2010ce6U, 0x70001d1aU, 0xe1040e19U, 0xd8f600f3U, 0x01fe1300U, 0x0ddd27feU, 0xefeffa18U, 0xe71ffbebU,
+  0x1ac23330U, 0xf164f4c7U, 0xfe1ad31aU, 0xfb03fee3U, 0xc4010614U, 0xd31cf8cfU, 0xffc506ebU, 0x10102304U,
+  0x1514000fU, 0xfff300e3U, 0xf8e40027U, 0xfe240055U, 0x32ec080aU, 0xda09dcf5U, 0xb60f14fbU, 0xd0f001f1U,
+  0xf7f8c600U, 0xf1d54600U, 0xd2fa1600U, 0xea181d00U, 0x0000e411U, 0x000beadfU, 0x000f0327U, 0x00fa05f8U,
+  0xe80612c1U, 0x13d907ecU, 0xfa000719U, 0xecf70617U, 0x02fff5efU, 0xf8f815f8U, 0x16f8f613U, 0xef1ff3f1U,
+  0x1dbe1408U, 0xff13ede6U, 0x0827f01bU, 0xf404f6f1U, 0xf0f002feU, 0xd8ef06d1U, 0xe3db06f0U, 0xf5230cfbU,
+  0x17160034U, 0x4c21000bU, 0x1d050039U, 0xf9fd000bU, 0x0e20f30fU, 0x2ff81017U, 0xfefd02f8U, 0x0614fa0aU,
+  0x001b2a00U, 0x01213100U, 0xfc171b00U, 0xfb040100U, 0x00fd3fffU, 0x0056f9edU, 0x00f302f3U, 0x00ea0eebU,
+  0x05072b32U, 0x0949282fU, 0x05f7f61dU, 0x01070407U, 0x0affc015U, 0x00cee50fU, 0xfaedf30eU, 0x09fcd7faU,
+  0xd91df9faU, 0xbd1d5217U, 0xe301fcf6U, 0xcf041d0aU, 0xd9ba110dU, 0x28d9ff1bU, 0xf6eafafcU, 0xeae0130bU,
+  0xf02f0004U, 0x172a00a5U, 0xfaf90024U, 0x06fb00feU, 0x1619f0f4U, 0x47c30e19U, 0xf5db00eaU, 0x0b1dff08U,
+  0xf1254100U, 0xd8090d00U, 0xebff2300U, 0xd52cfa00U, 0x00ee15eeU, 0x0056d307U, 0x0014f8f5U, 0x00f90eeaU,
+  0x0a232344U, 0xdd6fda64U, 0xe914f511U, 0x0510010dU, 0x0c0cc112U, 0x03dddae1U, 0xef06f6f2U, 0xf71fc011U,
+  0xe01b0404U, 0xced74910U, 0xe0ece807U, 0xdcff1e38U, 0xbdae2003U, 0x0eb1fc3eU, 0xedd2fcfeU, 0xe29715fbU,
+  0xfc4800feU, 0x2c0e009dU, 0xfff8000fU, 0x021b00f0U, 0x2efaf00fU, 0x56c10624U, 0xececf6e1U, 0x271c0216U,
+  0xe92c6f00U, 0xc0df3500U, 0xd5fc2700U, 0xe9390b00U, 0x00f51603U, 0x0033dc11U, 0x0023f1d9U, 0x00f914f7U,
+  0x012cf425U, 0xf13bccfdU, 0xe0080329U, 0x0d1a0114U, 0x1414a016U, 0x32fcced5U, 0xfa1c010dU, 0x0422ce11U,
+  0xd7f31e0dU, 0xe5b16315U, 0xeaeffcf0U, 0xf70e1e38U, 0xa3bd270aU, 0x0d0ad742U, 0xedd0160fU, 0xd9810108U,
+  0xc6190001U, 0xffe000baU, 0xe6f30001U, 0x023600daU, 0x350ce307U, 0x3cfcfb2bU, 0xf9fdffdeU, 0x3f0bff14U,
+  0xf3535f00U, 0xfde01e00U, 0xcbea2b00U, 0xca3d2300U, 0x00f53016U, 0x0019efe7U, 0x002becefU, 0x00f918e0U,
+  0x0700dd02U, 0x0000c8f4U, 0xc0edf51bU, 0x0920e6e8U, 0x150fa3feU, 0x19f5d1ceU, 0x0e13f1feU, 0x0c2a9b04U,
+  0xfdf72529U, 0x149f3c0cU, 0x04f4f404U, 0x07f02e2eU, 0xbbd9fe17U, 0xf92a0156U, 0xd9c52301U, 0xe3c4051fU,
+  0xeb11000fU, 0xf60200ecU, 0xebe700feU, 0x193700f5U, 0x0714fc19U, 0x06dd0814U, 0xe1ebfaf6U, 0x2df00a14U,
+  0xd0304300U, 0x210de800U, 0xebf41800U, 0xd9120500U, 0x00050f14U, 0x00030ac7U, 0x002702e0U, 0x0010fab2U,
+  0x04f6fa1aU, 0xddedce14U, 0xdbefcf30U, 0xfa14caefU, 0x1b12f81dU, 0x121403f6U, 0xf8f709fcU, 0x0615d602U,
+  0x28330f42U, 0x11d22d1fU, 0x13e3e70cU, 0x23d7312cU, 0xddf1e012U, 0x0b1af719U, 0xe8de38efU, 0xfdfde219U,
+  0x31f80053U, 0x43fc0016U, 0x060b005aU, 0x12d30016U, 0x150eeee6U, 0x291c3616U, 0xfefa0beeU, 0x0207fd06U,
+  0xfce42c00U, 0xe03d2300U, 0xea422c00U, 0xf6f8fa00U, 0x002d7af9U, 0x0028fed3U, 0x0004fb0aU, 0x00f839dcU,
+  0xfe1b484cU, 0x0b630051U, 0x02f41c17U, 0xe7f8eb2dU, 0x2def921bU, 0x11cab9f0U, 0xf809ecf2U, 0x0d00af20U,
+  0xf20008f4U, 0xc9222af7U, 0xe8effcf6U, 0xcafb11e4U, 0xce981ae9U, 0x41cc1f08U, 0xf7d113f3U, 0xf1bf24f9U,
+  0xfc2f000dU, 0x49f700afU, 0x0807003fU, 0x270f0015U, 0x1d170dcbU, 0x1ecd670cU, 0xfae613dfU, 0x0b201305U,
+  0xe2fb3600U, 0xee4ae300U, 0xf5332600U, 0xdd0c0400U, 0x00044a05U, 0x004ad5f1U, 0x00f307f3U, 0x000644efU,
+  0xd72e3e2eU, 0xe240e51eU, 0xca031402U, 0xcefa0a24U, 0x27079b17U, 0x07d7c8c2U, 0xf2301f09U, 0x0f16b927U,
+  0x0e1d15e8U, 0xdbec39e3U, 0xfad20213U, 0xeedd0604U, 0xd8cd2104U, 0x61ed0810U, 0x0ee9f5edU, 0x0fa916f0U,
+  0xe02a0022U, 0x290300b2U, 0x14f00026U, 0x234000f3U, 0xfdf91f00U, 0x36cb6e0cU, 0xfad9f5f5U, 0x1210101cU,
+  0xf3eb3800U, 0xdf40e000U, 0xe5233300U, 0xf917e900U, 0x00fe0e1aU, 0x0029b900U, 0x000907e1U, 0x00063904U,
+  0x142c0b24U, 0x0704f4d9U, 0xbf0008f4U, 0xeefefef5U, 0xfeeb9fe9U, 0x25f8f09eU, 0x10500a0fU, 0x0406dd1fU,
+  0xd129e1fdU, 0xf2fb35feU, 0x11e00b01U, 0xf8f8f118U, 0xc7fa551eU, 0x0dfdcd2aU, 0x02efdeedU, 0x07d0270aU,
+  0xf2230000U, 0xef1700a9U, 0x040a0002U, 0x053c00fbU, 0x10dd0c09U, 0x04e641f9U, 0x0acff0cbU, 0x33022134U,
+  0xe21a2500U, 0xdc21fb00U, 0xe6ec2e00U, 0xd427e600U, 0x0008f210U, 0x003db9f5U, 0x003211f6U, 0x00ea13fdU,
+  0x58fff413U, 0xeef4cce0U, 0xd7e917f3U, 0x210ceee7U, 0x04e0aee7U, 0x272cfcbcU, 0x1620e915U, 0xff15dcfaU,
+  0xde0d0600U, 0x15d810edU, 0x3aeb0504U, 0xec0f0527U, 0xc7171a22U, 0xfc48a464U, 0xf2db02f3U, 0x10e2fc31U,
+  0xf1350009U, 0xb32f00cbU, 0x18060016U, 0x162f00fcU, 0xe91d050dU, 0x19b80b0dU, 0xc9d1f2e3U, 0x35ef1a13U,
+  0xd7523100U, 0x25320600U, 0xf6d21a00U, 0xd136e200U, 0x00f7fa07U, 0x0061d5d5U, 0x0032f5eeU, 0x00f70dcfU,
+  0x4bdfc70fU, 0xa4dcf2f7U, 0xdbf2f50cU, 0xf713e8f8U, 0x1016d71bU, 0x453e04e1U, 0x0906d20fU, 0x0102c902U,
+  0x223cf039U, 0x24d13225U, 0x2ef60f3aU, 0x25e92537U, 0xc241e700U, 0x0a4cb03bU, 0xc5d419e8U, 0x11e3d625U,
+  0x40e20030U, 0x5e110029U, 0x0ff8002dU, 0x29e6001fU, 0x131bfc08U, 0x0c3c30efU, 0x070e0efcU, 0xef14f1efU,
+  0x0aba3700U, 0xd15c1f00U, 0xf6212600U, 0x03f8f600U, 0x00357f07U, 0x000e36f1U, 0x0029061eU, 0x000e56e5U,
+  0x0c1a2e47U, 0x3120d34fU, 0x16f669f9U, 0xf0eef863U, 0x27fec714U, 0xecf3c9c0U, 0xda11d2f6U, 0x0619ce12U,
+  0xd3291208U, 0xe84eee07U, 0xdef11cf7U, 0xcfe21fdbU, 0xe4941bdfU, 0x43d520f5U, 0xe3c6f3edU, 0xedbd37ebU,
+  0xf73b000fU, 0x340e0003U, 0x0825001dU, 0x38f8001cU, 0xfe1cf30fU, 0xe0221af0U, 0x05e113f0U, 0xed28f3e6U,
+  0xf3ef2c00U, 0xd958f800U, 0x0e130e00U, 0xfbfd0400U, 0x00224408U, 0x0001cffbU, 0x000e0f0dU, 0x001064feU,
+  0x1df8242eU, 0x3cd9e806U, 0xe5ed41fbU, 0xdbe4f351U, 0x14dea9edU, 0xced11eabU, 0xf821e116U, 0x0b1ec305U,
+  0xd3241fe9U, 0xef3cd6f8U, 0x12ce23f0U, 0xefe7f5e3U, 0xdbd22e10U, 0x5de20522U, 0xd303ea0dU, 0x0fdf2ff9U,
+  0xd9420003U, 0xf20d00c4U, 0x08130010U, 0x33040011U, 0xde073402U, 0xe7161ffcU, 0xefd719d5U, 0xfd14f3fdU,
+  0xeee3c800U, 0xe62edb00U, 0xf7110500U, 0x081b1100U, 0x0029e31dU, 0x000db43dU, 0x00071dfbU, 0x00f72ffeU,
+  0x2ce70209U, 0x2dbe04a3U, 0xe001d9e8U, 0xe9fe1b17U, 0xebcfe0c4U, 0xef0543b7U, 0x1838e10dU, 0x0211e9f1U,
+  0xcf4810d6U, 0xf121ea0eU, 0x10d41ddaU, 0xf7fecbfaU, 0xdbfa1f18U, 0x3e121123U, 0xcf2df036U, 0x0dda1defU,
+  0xe72400e0U, 0xd83200abU, 0x090b0016U, 0x311f0009U, 0xe30640ddU, 0x1e073bd1U, 0xc60af8c6U, 0x20f71f00U,
+  0xddf7cb00U, 0xdb210500U, 0xf5171700U, 0xd90efc00U, 0x0023d04aU, 0x001eea0fU, 0x00050de9U, 0x00092226U,
+  0x3bc8dd26U, 0xedd5e5cfU, 0xd419da09U, 0x0ffb1cfdU, 0x0eda08beU, 0xfe3402edU, 0x0a51da14U, 0xea0104f3U,
+  0xeb342ed0U, 0x14e6073cU, 0x38ec060aU, 0xf111dc01U, 0xfa21f630U, 0x272fb249U, 0xda0fd3f5U, 0x17e70f0bU,
+  0xed2000f1U, 0xcf3500fbU, 0x213d0029U, 0x29070017U, 0xb6472700U, 0x6bb17c00U, 0xc2fcf7d1U, 0x2af02a05U,
+  0xdf2a1500U, 0xd441fa00U, 0xeb07f700U, 0xdb2bf100U, 0x00e7002eU, 0x001ad4d5U, 0x001e03d9U, 0x0006fb07U,
+  0x30dfd214U, 0x91e0d5c8U, 0xdd27ddfaU, 0xebebf816U, 0xf40d1ddfU, 0x2251fce3U, 0x0731e5e6U, 0x030ae7f8U,
+  0x0c420e07U, 0x20810e31U, 0x34f0271cU, 0xff02f90dU, 0x0458cf1fU, 0x362ea55eU, 0xcef5d8fbU, 0x24feec15U,
+  0x5af10020U, 0x5c420018U, 0x22f6000aU, 0x25ff0016U, 0xea0a0a0aU, 0xf3561332U, 0x08012042U, 0x1b35e8f3U,
+  0x28e00f00U, 0xf64e1a00U, 0x0be7ff00U, 0xe1250700U, 0x00186e0cU, 0x00e14413U, 0x0039032fU, 0x00f41efdU,
+  0x17ed0c32U, 0x4ff6f834U, 0x16003edeU, 0x1afeff39U, 0x26f40900U, 0x0e0d9fe1U, 0x05f819f8U, 0xfc09cc11U,
+  0xf523df0aU, 0xff77f316U, 0xd61ae526U, 0xe1df2be8U, 0x0de6fad2U, 0xf1c70df5U, 0x01e2f4e3U, 0xf6d44409U,
+  0x0de20017U, 0x3d620048U, 0x0bfa0000U, 0x260d001cU, 0xdc090930U, 0xe82b2e10U, 0x03041f2fU, 0xfd1b00f5U,
+  0x1fe30400U, 0xe8411f00U, 0x11bbe600U, 0xd8ef1d00U, 0x000e2a37U, 0x00dcfe26U, 0x002eed1aU, 0x000141ebU,
+  0x10db1719U, 0x34c0f701U, 0x16f808c6U, 0x13eef636U, 0x38d115c2U, 0xe2ecefa8U, 0x04f9ec0aU, 0xf31eb00bU,
+  0x041cd9faU, 0x0559fdf6U, 0xebeb3efaU, 0xf70b00c9U, 0x14ebefe7U, 0x6f11f315U, 0xfaf1f2fbU, 0x1fd620e8U,
+  0xe2ec00faU, 0x44190007U, 0xfc2a00f1U, 0x1f010027U, 0xe9f31922U, 0xe11e3ae2U, 0x14ec120aU, 0x0f1011e6U,
+  0xdee1d100U, 0xff2e1c00U, 0xdcd4da00U, 0xe6091500U, 0x0001ce44U, 0x00e9f923U, 0x0024d9ddU, 0x00132104U,
+  0xf7be05d4U, 0x3cc417f9U, 0xeeeee3efU, 0xfffc140fU, 0xf1c02bc0U, 0xca0324a9U, 0xe122cffaU, 0x0411e208U,
+  0xf727fadcU, 0xe2230ce0U, 0xf4df2cdeU, 0xea15f0e5U, 0x1dfbde0bU, 0x4d1bf2fbU, 0x35e0ea24U, 0x08e520feU,
+  0xf8ef00e9U, 0x0ae600deU, 0x012600deU, 0x10030017U, 0xd0ec1514U, 0xf32b370fU, 0x071616e9U, 0x09100f1aU,
+  0x05d1cb00U, 0x050b2c00U, 0xece5d800U, 0xd51d0900U, 0x0013f42dU, 0x00f5ee0eU, 0x0018eaf2U, 0x00140823U,
+  0x24aae808U, 0xffcad6d5U, 0xf208da0aU, 0x07fb2102U, 0xeec053c9U, 0xd82244ccU, 0xf228c4e0U, 0x041307ecU,
+  0xde2720e0U, 0xfcfc2109U, 0x19e15816U, 0xf511faffU, 0x4344d9eeU, 0x4725e91dU, 0x1ee8f449U, 0x2de507f4U,
+  0xdaf900d7U, 0x000300ecU, 0xef4500f2U, 0x1606000dU, 0xd5072c10U, 0x1ae9620bU, 0xf2ff08ffU, 0x050b0c08U,
+  0x1ffe2500U, 0x1e371d00U, 0x1204da00U, 0xd7fb0c00U, 0x00082338U, 0x00dcebd2U, 0x000110e7U, 0x000d0712U,
+  0x2ed2e7feU, 0x97a4deedU, 0xe024e235U, 0xe8ecf61cU, 0xfadd3ed8U, 0x103321e4U, 0xe12301ceU, 0x010bf9faU,
+  0x052feafbU, 0x24eacaf6U, 0x12bb3302U, 0xf700f6f3U, 0x3363d4f3U, 0x2a56da37U, 0x1d15f71eU, 0x2703f3fdU,
+  0x13ea0004U, 0x260200a4U, 0x35cd00ecU, 0x2f0f000cU, 0xd00925faU, 0xa63ffd30U, 0x0def3539U, 0x142fd9f7U,
+  0x0df9f500U, 0x0b0bfc00U, 0x12f1db00U, 0xf5251700U, 0x000a2af2U, 0x00d62038U, 0x0025f738U, 0x002205ecU,
+  0x1dd8ed10U, 0x0fe8eae7U, 0xff0908e6U, 0x1d092720U, 0x20001508U, 0x35e6c3dcU, 0x17e32deeU, 0x0313d009U,
+  0x1f12defdU, 0x1076f6f9U, 0xee23cf22U, 0xef0b35f1U, 0xec24fa07U, 0xeed9daf1U, 0xfd0ce1edU, 0x07ff3505U,
+  0xfdf700fdU, 0x16e900ffU, 0x20d600f9U, 0x19170037U, 0xe21ef108U, 0xb33df6f9U, 0xd4eb3b77U, 0xf835eff9U,
+  0x27e4ee00U, 0x09cf1f00U, 0x17d8d300U, 0xeb0a2c00U, 0x00e51e32U, 0x009d1b72U, 0x0020e41eU, 0x002123f3U,
+  0x1fdeff12U, 0xbfa1f411U, 0x0ceb15fdU, 0x4cf82817U, 0x1bf224e7U, 0x16d0c386U, 0x14ef30e1U, 0xdef0c620U,
+  0x1c0cdf0dU, 0xff63020fU, 0x05fdf550U, 0xd50b30e7U, 0xfe34f2fdU, 0x32bfed2aU, 0x14e5edc2U, 0x08e633f7U,
+  0xeaf80004U, 0x1ad80000U, 0xf90f000cU, 0x07f20048U, 0xcc0de11eU, 0xc00de0deU, 0xdaed1f7fU, 0x0e1a0df9U,
+  0x1ce1df00U, 0xf8fa4800U, 0x0fc2e300U, 0xe9002f00U, 0x00e6033dU, 0x00a51875U, 0x000eb720U, 0x001a360bU,
+  0xeeebe5f2U, 0x938c0a16U, 0x03c0010aU, 0x260a261bU, 0x07f433c1U, 0xefe234b3U, 0xf4d14ae4U, 0xe303c427U,
+  0x1634f81aU, 0xf02afd0fU, 0xfbecef11U, 0xd8180804U, 0x2f25fffaU, 0x52f2e5eaU, 0x61e8ea00U, 0xeaca17e1U,
+  0x02ce0007U, 0x01c200e1U, 0xe93a0020U, 0xea0c002eU, 0xc7d90015U, 0x09261c1bU, 0xd3000a59U, 0xfb13040eU,
+  0x3218e800U, 0x23041e00U, 0x23d3e200U, 0xc9f32200U, 0x00f50d5aU, 0x00d7fa50U, 0x000ace23U, 0x001dfff8U,
+  0xf7d2e620U, 0xb895ebffU, 0xdad30014U, 0x0ffc0fffU, 0xe6e545f7U, 0x19fe42f9U, 0x1beb24ebU, 0x010ced0eU,
+  0xe332f3faU, 0xd405ef1cU, 0x00f80021U, 0xfc221516U, 0x2d3bfe0aU, 0x1f3508d4U, 0x5914f325U, 0xfcb70601U,
+  0x00e7000dU, 0x12e700dcU, 0xc8530011U, 0xe4f200feU, 0xec0512f3U, 0xe7ed4a12U, 0xf0e5161fU, 0xca0b07f9U,
+  0x001f1a00U, 0x3a2b2700U, 0x2908cb00U, 0xe5f72200U, 0x00fa1f3fU, 0x00e31a0dU, 0x0010e735U, 0x000ffef8U,
+  0x0dd40114U, 0x1e81ef0bU, 0xd0dfff08U, 0xfe07ff0cU, 0x23dc2304U, 0x3e002202U, 0x0bf318f3U, 0x100efdfdU,
+  0xfe2adff6U, 0x09fdcde6U, 0xf5b91efaU, 0x071cf8ffU, 0x1927feceU, 0x034702ebU, 0x3b3f0423U, 0xefdeff0dU,
+  0xf4070008U, 0xfaed00f9U, 0xf2f600fdU, 0xfe0400feU, 0xfdfb031aU, 0xf0120417U, 0xf7df05f1U, 0x0402ff09U,
+  0x02f70f00U, 0x110de600U, 0x08e50300U, 0xfcfc1700U, 0x00e8e8f0U, 0x0007f91fU, 0x000eda06U, 0x00c2dad3U,
+  0x02efec1eU, 0x110208fdU, 0xfcfafb08U, 0x07f1d00bU, 0x02fad1f4U, 0x04f522f4U, 0x030b29efU, 0x005d23e0U,
+  0xecf31b11U, 0x0ef0fe0bU, 0x17ddf006U, 0xfedb0efbU, 0xf002ef03U, 0x0710fef9U, 0x1517e6f7U, 0x121c03feU,
+  0xf80e00dbU, 0xfbe6001fU, 0x021500e6U, 0x000900c1U, 0xf1ed2231U, 0xe5071207U, 0xf4e50fe7U, 0x010d1004U,
+  0xe0181200U, 0x0807da00U, 0x01eff300U, 0xe9f1ed00U, 0x0024dec1U, 0x000afe0dU, 0x001ad100U, 0x00cee8e9U,
+  0xfbf40d00U, 0x26091919U, 0xff061be3U, 0x03ea12e7U, 0xdb05e0e0U, 0x0b0c10f3U, 0xe61814e5U, 0xdb4706ecU,
+  0xeaf904fbU, 0xeb0008e9U, 0x17dd11f7U, 0x00c43b12U, 0xe2e7e40bU, 0x1b1a0ff4U, 0x271ef8f9U, 0x452827e9U,
+  0x1d1200e5U, 0xfbd7003bU, 0x0d0400e7U, 0x1a1e00fcU, 0x17d82c30U, 0xf7e510f7U, 0x13c5fbecU, 0x29f1eee5U,
+  0xe90af400U, 0x0ff6e100U, 0x0be2d200U, 0xf2fca900U, 0x0020e493U, 0x00eff10bU, 0x0009e50eU, 0x0005ecfeU,
+  0x39041fe9U, 0x2d022304U, 0xef1603e9U, 0xb510f2f0U, 0xad6dfce9U, 0x1a1e17f9U, 0xe13bececU, 0xe61c000eU,
+  0xfeb40cd4U, 0xea1af7dcU, 0x11f815efU, 0x1ff6382cU, 0x14ee1901U, 0x2901070aU, 0x2bfef008U, 0x30f90b17U,
+  0x10fb00e5U, 0xf6f90025U, 0x0402001bU, 0x05150026U, 0x46e1091dU, 0xffed09feU, 0x10cdfbffU, 0x3ad3e9faU,
+  0xf511fa00U, 0x12fee800U, 0xefe6ec00U, 0xedf89d00U, 0x00070883U, 0x00ebf01bU, 0x0008e021U, 0x000cf7ecU,
+  0x3004eee9U, 0x11020f02U, 0x0215efd5U, 0x9d42d31fU, 0xce62f5ebU, 0x0b0b0bffU, 0xf225020dU, 0xda082703U,
+  0x328814edU, 0xf40bf9dcU, 0x0b0618f2U, 0x08074e5aU, 0x1df20c14U, 0x0c09f50dU, 0x03f2e00eU, 0x20d4f62bU,
+  0xf22700d1U, 0xee03001cU, 0xeff90028U, 0x2f1a001fU, 0x36bf0f12U, 0xf3f7fefdU, 0x19c804f7U, 0x6ae618d3U,
+  0x05f7df00U, 0xffe40700U, 0xfcede800U, 0xc001c000U, 0x00260f97U, 0x0011e91aU, 0x0029ff0dU, 0x001a04ffU,
+  0xf920b2e0U, 0xedf7080cU, 0xe312f5eeU, 0xce5b0ffcU, 0xe02d05f5U, 0x0dea0c07U, 0xff0d0cffU, 0xf7fef1f7U,
+  0x2f812315U, 0xf9fff3ecU, 0x11f106faU, 0xf8d7523cU, 0x080cc624U, 0xfb0a070dU, 0x11ec000eU, 0x06df0216U,
+  0xf4110022U, 0xf8ef0009U, 0xf1320005U, 0xe32000deU, 0x0a041700U, 0xf21c0813U, 0xf4e719fcU, 0xf1fe081bU,
+  0xfd231400U, 0x1001e800U, 0x05fe0800U, 0xfabe1400U, 0x000711d6U, 0x00230318U, 0x0016b6ecU, 0x00e0d9daU,
+  0x01dfaf4eU, 0x2efb1204U, 0x1fece9f1U, 0x17eafdbcU, 0xf8ecc8fbU, 0x0cfc0feeU, 0xe70c31dfU, 0xe47f09e3U,
+  0xd204fde8U, 0xf11804f6U, 0x2ff60709U, 0xf5c61d0aU, 0xf6f608f7U, 0x1505f704U, 0x103df700U, 0x1924e7f9U,
+  0x07330001U, 0x20e40017U, 0xf92d00f0U, 0x020b00d0U, 0x08e41d07U, 0xf417f40cU, 0xf0c619c8U, 0xdcf8e91cU,
+  0xde330800U, 0x0fe1f800U, 0x0cf5de00U, 0x0695fe00U, 0x001affdcU, 0x000b0401U, 0x001ba7e4U, 0x00f61315U,
+  0xfee7d83eU, 0x3c060f2bU, 0xfa01eef7U, 0xecf10fc7U, 0xd415edeeU, 0x081522e1U, 0xe42632ddU, 0xdd56030bU,
+  0xed1de6e2U, 0xe30a05f4U, 0x1bf607ffU, 0xf7ba2deeU, 0x07fcfa00U, 0x1fece705U, 0x0c4cfe1cU, 0x321d05f8U,
+  0x2e1d0015U, 0x05f70023U, 0x110800feU, 0x1afe001bU, 0x15f33c11U, 0xfdfaf9edU, 0x12c4f6eeU, 0xef0adf04U,
+  0xe62ff100U, 0x13eefa00U, 0x24dbde00U, 0x15aed600U, 0x002d07d8U, 0x0007e116U, 0x0019d9e7U, 0x002f0533U,
+  0x0fe6fc22U, 0x08fd0521U, 0x0d0df3f2U, 0xd705fbd2U, 0xcd5311efU, 0xfe390b00U, 0xdb3c13feU, 0xe508f916U,
+  0xefe800f1U, 0xe4faf8e1U, 0x1bbe04f1U, 0x29e815f0U, 0x24f2f9eaU, 0x0cf5caf1U, 0x09271920U, 0xf72eee05U,
+  0x2afc0008U, 0xeb11000fU, 0xf30b000bU, 0x1b050039U, 0x21d83720U, 0x0df703f7U, 0x13cbf4f5U, 0x08f3fcfeU,
+  0x0609fd00U, 0x0df20400U, 0x1adfe000U, 0x0cc9ef00U, 0x001d0bc4U, 0x00f0ed0fU, 0x000dea07U, 0x001de92fU,
+  0xfdffeee2U, 0xf3eefafaU, 0x0919efe2U, 0xe5190115U, 0xc13f0bfcU, 0x06270109U, 0xea190c06U, 0x0a09111aU,
+  0x1da82803U, 0xf4071edeU, 0x1ec10df4U, 0x401de624U, 0x33e602fcU, 0xfc09de18U, 0x0d0d0a10U, 0xccf6f3f1U,
+  0x060f00ddU, 0xe11f000bU, 0xed0e0024U, 0x000a000fU, 0x49b52208U, 0x14f504e1U, 0x26d3fbf3U, 0x6fe3fcfdU,
+  0x021aff00U, 0x05ec0800U, 0x13e6f600U, 0xbff2fd00U, 0x003c05b5U, 0x00f5f605U, 0x0020f732U, 0x00230a08U,
+  0xd925ecbeU, 0x05e409edU, 0xd7160e0cU, 0x00341108U, 0xe72af501U, 0x00fef602U, 0xf61d1efdU, 0x0ecffa15U,
+  0x3c972523U, 0xfc0810e0U, 0x1fefffefU, 0x1a1dd94bU, 0x2adcda16U, 0xf2f60326U, 0x14f4fa1dU, 0xe7b703f2U,
+  0xfb130034U, 0x0ae600fbU, 0xd92400faU, 0xee1d00d3U, 0x1ef401e5U, 0xf9ea1110U, 0x0efc1012U, 0xd0ff0039U,
+  0xf41cff00U, 0x0ccefb00U, 0x050d0900U, 0x089c0500U, 0x00f83ddbU, 0x000ff910U, 0x0002cef0U, 0x0004b703U,
+  0x23e8e766U, 0x22ec05feU, 0x30f7e6f9U, 0xe9f41fa9U, 0xd4fbe106U, 0x00fe21eaU, 0xce191ec8U, 0xe75613f6U,
+  0xdc160aeeU, 0xf5130ceeU, 0x3d09141cU, 0xe9a72729U, 0xe3f53afdU, 0x2d18e8ffU, 0x0259f31eU, 0x4928bb03U,
+  0x14190036U, 0x20fb0005U, 0xf02900eeU, 0x0ff900dbU, 0x13db1eedU, 0x04f710feU, 0x04f61ae3U, 0xe5f4002bU,
+  0xe2010a00U, 0xf7a8fb00U, 0x081ceb00U, 0x0094f200U, 0x0010f6e3U, 0x000df9fbU, 0x0008b5faU, 0x0008fe17U,
+  0x01f1ce6dU, 0x1cf00106U, 0x2907d007U, 0xbc04f2caU, 0xef2cefefU, 0x00031ceeU, 0xa7242dcaU, 0xe6260548U,
+  0xe71007e9U, 0xf110e6dcU, 0x2f1a1212U, 0xf2b92f00U, 0xf4010300U, 0x1f10de0cU, 0xe37fea2eU, 0x32ebccfaU,
+  0x3f180005U, 0x190000f0U, 0xf61500e3U, 0xeaf8000fU, 0xf8f80919U, 0x14f50000U, 0x07d713dfU, 0x19dd0818U,
+  0xd3170d00U, 0xf9c00e00U, 0x190aee00U, 0x21b02300U, 0x00080df7U, 0x0013d901U, 0x00fcdd27U, 0x000a0529U,
+  0xf1f90f13U, 0x05fae2faU, 0x1408cf12U, 0xe503f419U, 0xe14201f3U, 0xfc130cfbU, 0xd0144ed8U, 0xc3edea24U,
+  0x0ff11ffcU, 0xed0c04ecU, 0x22fb24f6U, 0x36e400e9U, 0x0907f3faU, 0x0b11e71fU, 0x017ad323U, 0xf71009efU,
+  0x351e00feU, 0x0e0f00eeU, 0xed0a00f3U, 0x0ce40036U, 0xf4ef1206U, 0x1800ea02U, 0x1ce504eaU, 0x10fa2203U,
+  0xf6faf600U, 0xffe9ff00U, 0x2307f000U, 0xf6b73100U, 0x000a110aU, 0x0002f00dU, 0x00f7001aU, 0x001f0fedU,
+  0xd9312ceaU, 0x0d06e0e2U, 0x2814c906U, 0xed262329U, 0xe93df7ecU, 0x080f0807U, 0xef0f1cfbU, 0xe2ca241fU,
+  0x15df30f1U, 0xef0411bcU, 0x0eed13eeU, 0x2726bcf8U, 0x13d5f0edU, 0xf218f72eU, 0xfe44e51eU, 0xc7fe27c8U,
+  0x200700f1U, 0x162f00e0U, 0xf20000f0U, 0xf8d20016U, 0x4bc62cf6U, 0x29030de0U, 0x33dcf90cU, 0x302104f3U,
+  0xde150000U, 0xe1ddf000U, 0x28000c00U, 0xbbce2600U, 0x00010427U, 0x00fcf3d0U, 0x001f0c2aU, 0x001702beU,
+  0xc21823c0U, 0x1911e8caU, 0x22100308U, 0xf7401b0fU, 0xfc02ebf2U, 0xed100b08U, 0x061b2312U, 0xe7d4e213U,
+  0x20dc27f6U, 0xf4f4facfU, 0x0bfa16e8U, 0x12429e2aU, 0x3fd8d400U, 0xf51afd48U, 0xf50def03U, 0xb8d01bd0U,
+  0x0e270029U, 0x14fc0008U, 0xd92c0009U, 0xfbe800fbU, 0x2a08def2U, 0x1dcf2216U, 0x16f42df4U, 0xffc52f31U,
+  0xf1f2fd00U, 0x0af90b00U, 0x0dfa1700U, 0xf5da1800U, 0x00f1230aU, 0x0000f0feU, 0x000ce613U, 0x00f7b3eeU,
+  0x1cf9f44cU, 0x0dddfff5U, 0x2607f107U, 0xd80aedb5U, 0xe226de03U, 0x06043df1U, 0xe21f12f6U, 0xf05c09f1U,
+  0xf71134d3U, 0x0ff109f6U, 0x1933fc09U, 0x21b2ff0cU, 0xe7023bffU, 0x1630e700U, 0x06540525U, 0x3328cc00U,
+  0xf6160025U, 0x20e4001bU, 0xcd2e0013U, 0x2ed00001U, 0x23ed1ffbU, 0x09e0ff17U, 0x12e71000U, 0xe2b9fa4fU,
+  0xcdf7fe00U, 0xfeec0b00U, 0xf4081300U, 0x2fc91000U, 0x00ef13efU, 0x00f40304U, 0x0000d50dU, 0x000603f3U,
+  0xe305e62dU, 0xe7e207d2U, 0x0f13eff9U, 0xc21e09f7U, 0xe934d7f4U, 0xe50826fbU, 0xee2704e1U, 0x0743f70bU,
+  0x0c010edbU, 0x02d9fdd4U, 0x0e48190cU, 0x03b302f4U, 0xcf040e22U, 0xfa26ed0aU, 0xda41f93bU, 0x05ecfd03U,
+  0x13170020U, 0x03fb00feU, 0xc12600faU, 0x04e0002bU, 0x0c0721faU, 0x1bdef212U, 0xfff9fee8U, 0x11d2f812U,
+  0xe7f70800U, 0x0ddbf700U, 0xe5fcf800U, 0x38d74700U, 0x00dd1802U, 0x0000ecefU, 0x0019e61bU, 0x000f12d6U,
+  0xd90cf9efU, 0xeceeffd2U, 0x0512f2f1U, 0x001d1941U, 0xff1ede0aU, 0xf3f00ff4U, 0x01140becU, 0xd1e6e413U,
+  0x000b1f00U, 0x04f7efccU, 0x043127f6U, 0x06f5d1daU, 0xecf9f736U, 0xf218df19U, 0xe311f820U, 0x0cfa0eefU,
+  0x20fe0005U, 0x180a00e6U, 0xf51600deU, 0x26d40029U, 0x0cf0f8edU, 0x42faf9ffU, 0x1807f5f2U, 0x12ed09efU,
+  0xf8e7f800U, 0x02b4ec00U, 0x00f0f900U, 0xf1bf3600U, 0x00e9f010U, 0x000f10e1U, 0x001ae318U, 0x00f012ceU,
+  0xf81904e6U, 0xec1200e7U, 0x2210ffe3U, 0x18332823U, 0xf022dfeeU, 0xd300f9faU, 0xfd0d11f5U, 0xaab2f004U,
+  0x0f1508e5U, 0xfeed10d6U, 0xfc042002U, 0x0b2ca0daU, 0xe9b50116U, 0xe8d50b03U, 0xe811030aU, 0xe1ee08e5U,
+  0x0ff800ebU, 0x0a0900d5U, 0x0f0100efU, 0xfbc0000bU, 0x32fcfce8U, 0x4ff307e9U, 0x1a16e90fU, 0x120e0de4U,
+  0xded51a00U, 0xefd5fa00U, 0x0c0f1500U, 0xeea52200U, 0x00d2fe21U, 0x001c12a4U, 0x000d1317U, 0x00ff2696U,
+  0xe7110005U, 0x062404d7U, 0x1b0b17e7U, 0x07501324U, 0xf4e8da01U, 0xe2ed06e5U, 0x1f0b0affU, 0xaee1f802U,
+  0xfb250dd5U, 0x05f7dde4U, 0x1610130eU, 0xec34b20eU, 0x17bbf5efU, 0xfafa0a06U, 0xc8f70befU, 0xb9c3fcd0U,
+  0x1df400e9U, 0xf3100015U, 0x021c00eeU, 0x231b0033U, 0x0624cdedU, 0x08f11f11U, 0xfb00110cU, 0x46defd2eU,
+  0xfdfd0800U, 0x15f71a00U, 0x11ec1100U, 0x1ee12500U, 0x000c1ef2U, 0x0006e406U, 0x00fb071cU, 0x00fceac9U,
+  0x1def222cU, 0x17f0fc03U, 0x2313fdfeU, 0x1615e0faU, 0x0bfbbd22U, 0x041b39f6U, 0x03022303U, 0x02624efcU,
+  0xe23127f8U, 0x11ed12efU, 0x1427090cU, 0x06be0c03U, 0xc6e224ffU, 0xd84ef424U, 0xf638f719U, 0x3044eb16U,
+  0x06110026U, 0xf8220039U, 0x03230011U, 0x59040000U, 0xe92614fcU, 0x08d9f52bU, 0x0104fd09U, 0x319fc755U,
+  0xce011c00U, 0x21392c00U, 0xfe161a00U, 0x53133f00U, 0x00f73aeaU, 0x001b01e0U, 0x00f4fa22U, 0x0032ffa5U,
+  0x15f82626U, 0x051a0f07U, 0xf3f8090cU, 0x05380c08U, 0xeefecc41U, 0xe60e2bfeU, 0x0cfd20f2U, 0xf34f2403U,
+  0xe2212ff9U, 0x01cd15e6U, 0x0a2df91bU, 0x17b1d3eeU, 0xece83c05U, 0xe84af3f8U, 0xfd1cfd10U, 0xf3f8d3f4U,
+  0x1a00002aU, 0xf238003cU, 0xf6210008U, 0x55c900c7U, 0xf30e0212U, 0x40cfee0cU, 0xfa07fcf5U, 0x41daf714U,
+  0xdbef0800U, 0x051c0800U, 0x13010a00U, 0x3ef43f00U, 0x000120d9U, 0x004911beU, 0x0013f324U, 0x002efb88U,
+  0xf4011afbU, 0x072207ecU, 0xd9e11a09U, 0x6121102fU, 0xfbefe04dU, 0xccf1f9eaU, 0x1b0432f2U, 0xb010fcf6U,
+  0x05282b18U, 0xffd931edU, 0x0f191501U, 0x21d9e3d6U, 0xebd4070aU, 0xf423f2c8U, 0x021cdbe8U, 0xfdd5ecfcU,
+  0x14df0003U, 0x0f1e0020U, 0xf80400f2U, 0x44c900b5U, 0xef17ec2aU, 0x79f50ce0U, 0xfafaf2f1U, 0x1a0007e4U,
+  0xd8e40800U, 0xf1e5d100U, 0x20ee1700U, 0xefb73800U, 0x0007ed02U, 0x0036ecb8U, 0x0028ff1fU, 0x00f0ea89U,
+  0x02ea0af3U, 0x10200ad4U, 0xf5e72211U, 0x5248f92dU, 0xefe0e409U, 0xb800edeaU, 0x0e0016f5U, 0xbaeb07f5U,
+  0x14181708U, 0x04de1afcU, 0x020c2bf6U, 0x2c31e6edU, 0xffba09dbU, 0xe1eefde8U, 0x071103daU, 0xe9be0ae0U,
+  0xeaf800f5U, 0x010f0008U, 0xf90e00ffU, 0x09c800c4U, 0xee07f808U, 0x7ff80eeeU, 0x0c04fb11U, 0xf70205faU,
+  0xf7eb0b00U, 0xf5d5dc00U, 0x13f31b00U, 0x01b9e200U, 0x00faf716U, 0x0026e4c0U, 0x00120e10U, 0x00d9e78dU,
+  0xfcd0eb13U, 0xfb2117e8U, 0x1cf01218U, 0x3042f901U, 0x02e1f1f7U, 0xc8eff5efU, 0x15ed0808U, 0xd3e3fcf0U,
+  0xf412f8f8U, 0x0fe106eeU, 0x0f001806U, 0xfd03d2f7U, 0xdcddf9f3U, 0xeefd040bU, 0xe90e11f5U, 0xc8dffcd2U,
+  0xf8ed00f1U, 0xfa210009U, 0x04fe002aU, 0x0d060001U, 0xf6ff06f3U, 0x04ea121fU, 0x1f09022dU, 0x11e1ff11U,
+  0xfceff500U, 0x140a1300U, 0x00251500U, 0xfb0b2400U, 0x00dbd9eeU, 0x00fafa08U, 0x001f3907U, 0x00483819U,
+  0x06dfe4e3U, 0x0afae409U, 0xfc0d1432U, 0xeb301c21U, 0xf9f9f0ecU, 0xfc341aeaU, 0x080c01e0U, 0x04dc0009U,
+  0xcce8f8f2U, 0x29eb05ecU, 0xfbe9fefdU, 0x07fffb15U, 0xf2fb11fbU, 0xfe61f3fbU, 0xfcf9fcfcU, 0xfbf0fc0cU,
+  0xefc9000fU, 0x140e00d9U, 0x19f3000aU, 0x11ea00f9U, 0xe918f119U, 0x23ec3b06U, 0x3bec032cU, 0x2efaf8feU,
+  0xff04ce00U, 0x3d141300U, 0x0e1d1300U, 0x0b001000U, 0x00d5d2dbU, 0x000ef5b1U, 0x001c3ff6U, 0x002c2722U,
+  0x30d0fd02U, 0xf908dcd8U, 0x0d170520U, 0xfd1e1c27U, 0xeb2414eaU, 0xda3824f0U, 0x0d150de4U, 0x44efc6feU,
+  0xe8ff000fU, 0x38eddac8U, 0x041307fcU, 0x0341e0ffU, 0x03ec3b06U, 0xe17fc929U, 0xf41fed04U, 0x03de1e0aU,
+  0xd3c600f8U, 0x21fd00eaU, 0x1ff20002U, 0x022600ceU, 0xfb33e238U, 0x130f58fbU, 0x21e1ff11U, 0x25f011faU,
+  0x27f8b800U, 0x2ffeec00U, 0x04292000U, 0x00092d00U, 0x0000a1f8U, 0x00f703b1U, 0x00fa3c11U, 0x000c020bU,
+  0x40e101e1U, 0x091be8e6U, 0x0bfb0c16U, 0xf7110d24U, 0xd9401cd8U, 0xb4372d19U, 0x01020f0fU, 0x24fdceecU,
+  0xfed30f04U, 0x41e7bdd3U, 0x1626fcfcU, 0xfd30e2f0U, 0x271a17ebU, 0xdf61d207U, 0xe9ffdffaU, 0xf70700e9U,
+  0x95c9002bU, 0x35f70009U, 0x1bf400e4U, 0x181d0009U, 0xff09fe0aU, 0x0b0f42efU, 0x0ceef80eU, 0x23fc040dU,
+  0x27bdb100U, 0x4207c100U, 0x08112400U, 0x0bf92600U, 0x0000b209U, 0x00e603cdU, 0x00ea180dU, 0x00f105e7U,
+  0x2ccc3211U, 0x0b1edb0aU, 0x1910f7f7U, 0x09faf71bU, 0xe7f43fdfU, 0xb42f6910U, 0x13140a05U, 0x0105f8feU,
+  0x19eafd05U, 0x1cdfd5cdU, 0xfe0f2507U, 0xfa0f251dU, 0x33f8eaecU, 0x2f3deb10U, 0xebf8d50eU, 0xd710cd15U,
+  0xb7cc0042U, 0x1fee00f5U, 0xf50500d6U, 0x17150015U, 0x180f0bf2U, 0x13fd1902U, 0xfc16feebU, 0xf20b0103U,
+  0x23d8d900U, 0x40f9c900U, 0xfe121800U, 0xf517fd00U, 0x00dde734U, 0x0008fcdfU, 0x00ef0c2aU, 0x00d611f2U,
+  0x17ba480cU, 0xfa1bfae9U, 0x0cebdef7U, 0x05ededf2U, 0x17ef4407U, 0xda262efdU, 0x1427f701U, 0x0809fd06U,
+  0xec1607edU, 0x0cd2d3e1U, 0x002f130aU, 0x05100e16U, 0xfa1b09f7U, 0x1e01030dU, 0xfcf7e718U, 0x0910e411U,
+  0xe7e800d9U, 0xea2f0000U, 0x29060029U, 0x37010001U, 0xf305000fU, 0x43efffe6U, 0x291e0b30U, 0x18b4fc20U,
+  0xf5dccd00U, 0x2c3a0800U, 0xf91a1000U, 0xfdf02700U, 0x0006d1f5U, 0x00e00ee3U, 0x00233b00U, 0x00fcf912U,
+  0x11e1f9d6U, 0xf5e0c729U, 0xef1b1f38U, 0xbf40d239U, 0xefec1ce6U, 0xe61ffae8U, 0xfd1704f3U, 0x1deef403U,
+  0xf5dedf15U, 0x100a08e0U, 0xf00fe801U, 0x0bcffe28U, 0xd3d206feU, 0xdf720a2eU, 0xe40432f6U, 0x01efe9ffU,
+  0xeedd0000U, 0x050500eeU, 0x42ee001aU, 0x2b0b00f0U, 0xc53d1e12U, 0x3b012213U, 0x1ff41244U, 0x2afb1cf9U,
+  0xf4d1ca00U, 0x41450600U, 0x0a221700U, 0x2cfe1b00U, 0x00ece3ddU, 0x00c22accU, 0x000554ebU, 0x00ef120fU,
+  0x60f6f7e7U, 0x0cf1dc4eU, 0xf60f174cU, 0xdb1ccb37U, 0xea2056deU, 0xf5061ecfU, 0xe8f60afaU, 0x3bfaf206U,
+  0x12d2f624U, 0x314dd8d9U, 0xf81502fcU, 0x04e1ef11U, 0x20f915efU, 0x8d6bfb27U, 0xc3181f02U, 0xdf0bf0fbU,
+  0xdb9d00f8U, 0xc81a0003U, 0xfefa0000U, 0x062100dfU, 0xf22dca16U, 0x1dfe1afbU, 0xfd1c19ffU, 0x23fc0adbU,
+  0xecd6cc00U, 0x174f2000U, 0x13092900U, 0x24140900U, 0x001b850eU, 0x00b22003U, 0x00ca52f5U, 0x00d319f9U,
+  0x61f105eeU, 0x0aebec45U, 0x1520042bU, 0x0917e31eU, 0xf94626c4U, 0x0be136d1U, 0xf6f0fb28U, 0x1ee90023U,
+  0x2dc10652U, 0x2a20d7f1U, 0x12fde227U, 0xff0204f5U, 0x53f4eef8U, 0xbb5bdb0dU, 0xbcf727ffU, 0xe31b0005U,
+  0xe8be001fU, 0x07f800fcU, 0xe51700ccU, 0xfd0d0002U, 0x0316c4f2U, 0xe0111b0bU, 0xf314e200U, 0x16f1fa05U,
+  0x06d4cb00U, 0xf82a2500U, 0x02042600U, 0xf728fe00U, 0x0016a90fU, 0x00cf1e16U, 0x00e71df0U, 0x00d201f6U,
+  0x3ac02128U, 0x20f6011cU, 0x1afbf5f3U, 0x1602f50aU, 0x01fe28ddU, 0xd6f642f6U, 0x172ad217U, 0x0df22324U,
+  0x13dffc48U, 0x0917e9d6U, 0xfc0a1a31U, 0xf7140e0eU, 0xfcc80e08U, 0xcc41fbe2U, 0xccf1eb01U, 0xd92beff2U,
+  0xdc97001bU, 0x04c600c4U, 0xe3f400d0U, 0x18d600eeU, 0x0e35ef03U, 0xfd06fb15U, 0xcf13f6f4U, 0xd900e915U,
+  0x18f7ea00U, 0x3a043300U, 0xeb020f00U, 0x0bf80400U, 0x00d3e625U, 0x00d9190fU, 0x00d6efe8U, 0x00e3f2f4U,
+  0x25a352e1U, 0x15040ad9U, 0xf6fec1d5U, 0x06f6e7faU, 0x04d22b1eU, 0xfc102f00U, 0xf82bea1cU, 0xf40d312cU,
+  0xf707e9efU, 0x0ccf02e6U, 0x0c0d151bU, 0x00fcec05U, 0xf3f12b09U, 0x11fbf7e7U, 0xdbd8e419U, 0xed2de209U,
+  0xc8f500c1U, 0xf21d00f6U, 0x43fa000eU, 0x3f2f0014U, 0xe1091c0eU, 0x3ddfecbfU, 0x25f326f5U, 0x15effdeeU,
+  0x03b5c800U, 0x0ee10400U, 0x02f60800U, 0xfb0e2800U, 0x0011dceaU, 0x00dc2ce9U, 0x00125802U, 0x00da26e8U,
+  0x0bfa15c7U, 0x0c230536U, 0xe419fa4dU, 0xb20bb42bU, 0x0c052be5U, 0xd81eb6e4U, 0xe002defeU, 0x0c18c60bU,
+  0x2700db26U, 0x020d0f12U, 0x0d23d81aU, 0x32d006e0U, 0xe7faf1e8U, 0xc718354eU, 0x12171810U, 0xf20bf101U,
+  0xda0a00ceU, 0xc33900ecU, 0x2ae30025U, 0x250c0001U, 0xf0f809f6U, 0x1bfdffc4U, 0x02fb37ecU, 0x06fe07e6U,
+  0xf6bbeb00U, 0x1521f000U, 0x2ac31500U, 0x27431d00U, 0x0017d3d7U, 0x00e41513U, 0x0009391dU, 0x00de30ccU,
+  0xf904fdd4U, 0x2e43db44U, 0x0d250743U, 0x02f1e704U, 0x0121170fU, 0xfcf9cde7U, 0x08e003fbU, 0x21f0d81aU,
+  0x3034d63bU, 0x0f39270eU, 0x130bd70aU, 0x0623e7e5U, 0x0ff9e70bU, 0x9332311bU, 0xed121000U, 0xcd0e01dbU,
+  0xf5e700b5U, 0xeef800ebU, 0x05fb001eU, 0xf90e0000U, 0x1225ed15U, 0x20092ba6U, 0xd2f337ddU, 0xf50504dfU,
+  0xe4e60200U, 0xd44a0a00U, 0x32da1100U, 0x0f45fc00U, 0x001995fbU, 0x00053218U, 0x00f91ff3U, 0x00fe3ff3U,
+  0x050de1ceU, 0x452bd11bU, 0x092c2113U, 0x28f90401U, 0x3b2a12f7U, 0x18f7bbbaU, 0x18f80e00U, 0x0cf119fcU,
+  0x290c1459U, 0xfd083818U, 0x1701e80dU, 0xf30feaefU, 0x19e4cd0aU, 0xd91b0946U, 0xe72103f0U, 0xe729ffcaU,
+  0x22ba00f1U, 0x0ac100e2U, 0xf20500d6U, 0x01cd0025U, 0x2bf5db1cU, 0xfd1e1be3U, 0xddd52505U, 0x0b1c48fcU,
+  0x2fde0000U, 0x9f251700U, 0x0ae6e900U, 0xf24df400U, 0x0010c5d6U, 0x001b1a10U, 0x000cd2faU, 0x00ed1ce9U,
+  0x14120c34U, 0x2205f0b8U, 0x070efea9U, 0x31f2fd17U, 0x2713ef07U, 0x040ccbe6U, 0x2beedd01U, 0xf2d21ae6U,
+  0x2205e65aU, 0x0c0a2823U, 0x07d73831U, 0xfce7c607U, 0x15f71203U, 0xcae7ef1dU, 0xf307e727U, 0xe64510f7U,
+  0x059700ffU, 0x17e900cdU, 0xf32000e3U, 0x2acc00e3U, 0x1e2cd712U, 0xc90af1feU, 0xe9c03902U, 0xc31f2316U,
+  0x41e0f800U, 0xc90e3300U, 0x1009e700U, 0xf7133400U, 0x00e2fe0dU, 0x0000f725U, 0x000de70eU, 0x00f1f8d7U,
+  0x0c16150aU, 0x3cf3fec9U, 0xdf06b3bfU, 0x30f6d2f6U, 0xebdefb47U, 0x2823c913U, 0x1910d0eeU, 0x05060efdU,
+  0x100cdf1fU, 0x0b131704U, 0x03960623U, 0xfbe5f21cU, 0xcad939feU, 0xa9c6f3d9U, 0x32eef821U, 0xd8260d11U,
+  0xc9d800d2U, 0x01f100efU, 0x0e250002U, 0x1c320017U, 0xc2e33cfcU, 0x19cbe3c9U, 0x0cdc06d3U, 0x08f1cc94U,
+  0xf5b2df00U, 0xfc090000U, 0xfcc3fc00U, 0xff092a00U, 0x0032d2dbU, 0x00fc18edU, 0x00053e1eU, 0x00ee1bfeU,
+  0xd227e9d6U, 0xc41f2a22U, 0xd121d3f6U, 0xf90be226U, 0xfbfb2f01U, 0xe7dbf523U, 0xfb0d0003U, 0x1020a81eU,
+  0x02e8b14aU, 0xeeececdfU, 0x163bd720U, 0xf6081ff3U, 0x1c0d0ffbU, 0x05f30efdU, 0x3222fb0eU, 0x00ed062bU,
+  0x090900e6U, 0xf8ce00fbU, 0xea160034U, 0x0302001cU, 0xf50a111fU, 0x41e8f584U, 0x02d733f6U, 0xf520e781U,
+  0xfbe6f000U, 0xdc1bea00U, 0x13b50000U, 0x041d1600U, 0x001ac7e4U, 0x00ff7b0aU, 0x00f51b06U, 0x00fc61d7U,
+  0xcd16f1b3U, 0xd41b4533U, 0xdc1edceaU, 0x17230407U, 0x1f251c05U, 0x08ccfb1aU, 0x18f6eedfU, 0x1aefaffdU,
+  0x03f2d14fU, 0xf3f3f2f0U, 0x3710e338U, 0x0508ef27U, 0x00d9f5fbU, 0xedb14514U, 0x0e28e9f0U, 0xd0c91bfaU,
+  0xed2400daU, 0x10bc00f3U, 0xc4320027U, 0x04be0004U, 0x4221fd1dU, 0x3237f6acU, 0xf5e54200U, 0x012de5beU,
+  0x071cf600U, 0xcafcee00U, 0x01badc00U, 0xc509ee00U, 0x001fccf9U, 0x0012270eU, 0x00ebd61cU, 0x00053dfcU,
+  0xdbfdfdaeU, 0xc50a3cf0U, 0xa5f3ecb0U, 0x020a1ee3U, 0x3812e4faU, 0x09f9f428U, 0x320af3edU, 0x05f207f5U,
+  0x1ef00435U, 0x19fff401U, 0x28eefa1aU, 0x1d05ed2aU, 0x04d6d50cU, 0x04924f55U, 0xf40c082bU, 0x07a31802U,
+  0x0cf100d1U, 0xeedc00d4U, 0xc9040010U, 0x17ba00e2U, 0x6113c6f1U, 0x1348fbd1U, 0x08ef4702U, 0x182a12eeU,
+  0x10e4d900U, 0x9e07fa00U, 0xf6fee000U, 0xc0140000U, 0x0012efeeU, 0x0005f00bU, 0x0008df4bU, 0x000df00eU,
+  0xf41403b2U, 0xdefb01a3U, 0x81fdcf9cU, 0x0f1017ccU, 0x1cfba40fU, 0x001ef005U, 0x4821fe01U, 0xfef90b13U,
+  0x31ebee1eU, 0x0efe1a22U, 0x09a116f1U, 0x0cf7d729U, 0xf5caf520U, 0xf09026faU, 0x030ef74fU, 0x009809ecU,
+  0xf2ba00a1U, 0x25f300efU, 0x2d120009U, 0x49c300ebU, 0x6416c9e1U, 0xe910f5eaU, 0x17ca39edU, 0xfa1c0601U,
+  0x10e61700U, 0x9df90500U, 0xe114ec00U, 0xbffc1900U, 0x0016f8c9U, 0x00f609f8U, 0x00170ee0U, 0x0007f8eeU,
+  0x105eece7U, 0xe90cf0a0U, 0xb906c3c1U, 0x1007deccU, 0x02fac82cU, 0x181de612U, 0x281be4edU, 0x0afbef05U,
+  0x0c3af31dU, 0x02ebe408U, 0x0284f0dfU, 0x0f07f231U, 0xdbafedf8U, 0xd5ae0bf2U, 0x4bd2f05fU, 0xf5ade7e7U,
+  0x202200eaU, 0x07ee00d2U, 0xfd1900ffU, 0xf91f00f2U, 0xc6e81fffU, 0xddf717f6U, 0xcfe901e7U, 0x1de4e0b8U,
+  0xfcc70100U, 0x0012f800U, 0xf3e1f300U, 0xf71f1600U, 0x0010ead0U, 0x00e8fa13U, 0x00dc3225U, 0x000d16dfU,
+  0xd724c5e1U, 0xcacd0af5U, 0xcd07df03U, 0xe020eb0aU, 0xfb063df6U, 0xebc4fbf7U, 0x1100fa0dU, 0xe8f6cf0cU,
+  0x18d9d722U, 0xf2fdede2U, 0x2617f813U, 0xf7f127f4U, 0x211107f3U, 0xedecf7f2U, 0x0828e621U, 0xf4d20912U,
+  0x36fd00e9U, 0x2dea0019U, 0xf20d0002U, 0xfbde000dU, 0x1ae81a06U, 0xfe023ec8U, 0xe9d72aecU, 0x2a30f3a5U,
+  0xf1fde900U, 0xd433e300U, 0xc4dfda00U, 0xe41eef00U, 0x0013c2bdU, 0x00df120bU, 0x00bd1258U, 0x00031df9U,
+  0xe20ee5d7U, 0xa1af2708U, 0x92f2efcfU, 0x191616fcU, 0x0c2c1f08U, 0x1cf3fef8U, 0x4423e4e4U, 0x10ebc5f5U,
+  0x38ded63bU, 0x04f9dde4U, 0x27fff108U, 0x033e0d15U, 0x11f2dfefU, 0x26f405eaU, 0x0816d92fU, 0x02ae150fU,
+  0x19e900a6U, 0x2ef00035U, 0xfef6000fU, 0x109c00e7U, 0x1e0505f1U, 0x0a0b2eedU, 0x00e01f07U, 0xe821edbbU,
+  0xeff7fd00U, 0xd4410800U, 0xdff0d700U, 0xb1e2f400U, 0x000cd6b2U, 0x00ea11f0U, 0x00d9e03cU, 0x00f3c7e1U,
+  0x01fff6b5U, 0xd3c049eaU, 0x86ddfb9eU, 0xea0b2be6U, 0xee32ee05U, 0x110f1002U, 0x423f05d1U, 0x0a35e3eaU,
+  0x4ef0fe39U, 0x16efe6eaU, 0x18c3f3e5U, 0x1a3b0120U, 0x10b8d9ffU, 0x400929f7U, 0x04f8e624U, 0x1d8a0d02U,
+  0x09d90081U, 0x0de90030U, 0x14e90002U, 0x1cc000ccU, 0x13f5d5dcU, 0xef0b29daU, 0x2de2f210U, 0xf002efdcU,
+  0x09cf0400U, 0xd21e1e00U, 0xc316ed00U, 0xa8f6ff00U, 0x0003bad0U, 0x00fd31e3U, 0x00ff070dU, 0x00e6d6dbU,
+  0x0b0eedb2U, 0x01f125f7U, 0x9ecbf9aeU, 0xf7180bd9U, 0x1718e20aU, 0xff13f4e5U, 0x2f3c1de2U, 0xfd39fce2U,
+  0x3c000f0fU, 0xf1f40ff8U, 0x02a40ad6U, 0x16f10311U, 0x04a7dce0U, 0x33ec20e6U, 0x1ec9e81cU, 0x1b9c0804U,
+  0xded60089U, 0x1edc0035U, 0x7ef00002U, 0x2bc600f1U, 0x2705d2fbU, 0xe2ff18f6U, 0x29e0f1f6U, 0xe514ecfaU,
+  0xf3e41900U, 0xeffa0b00U, 0xf30a1500U, 0xd3fc1400U, 0x00ddd796U, 0x00fff7ebU, 0x00f81ae0U, 0x00e5e8eaU,
+  0x314eeabdU, 0xf4f80df1U, 0xa3e806e1U, 0x1116f7e3U, 0xed12e8f5U, 0xf8070bebU, 0xf50806e7U, 0xeb26fde5U,
+  0x30171424U, 0xfbbe0e08U, 0x028ed5e3U, 0x14f5fd01U, 0xf7bcfbe9U, 0xfcfb05fdU, 0x2bdcfe07U, 0x0bc2f9e6U,
+  0x13fc0002U, 0x00fc00fcU, 0x12380014U, 0x10fa00faU, 0x0aec01f7U, 0x25f6f9faU, 0x02f30cddU, 0xf8fefb15U,
+  0x0cfbea00U, 0xff151e00U, 0x01fe2800U, 0xfc0ffc00U, 0x00fef3f8U, 0x002c06f2U, 0x00ed14f5U, 0x0002f2e4U,
+  0x020af3faU, 0x041a0f29U, 0x0cfdd51fU, 0xfdf9faf4U, 0xfdfa1510U, 0x051edeeeU, 0x0409f416U, 0x040bf102U,
+  0x0915fb00U, 0xfde630fcU, 0x150505e5U, 0xf1f60710U, 0x0b14fa06U, 0x11e2100aU, 0xfa3ae7fdU, 0x00e112ffU,
+  0x0bf40005U, 0x102800caU, 0x174800e8U, 0x080200f7U, 0xf4fc09f6U, 0x45e4f2f1U, 0xfffc39d6U, 0xf310f212U,
+  0x03f7ef00U, 0xf6072f00U, 0x0e3f3000U, 0xe3fefc00U, 0x0005eb19U, 0x002e0cf1U, 0x00e8ebbeU, 0x0003f710U,
+  0xff0a1001U, 0xdd14d625U, 0x1dffd6fdU, 0xd80911f5U, 0xfaff04feU, 0xfff7f1feU, 0xdffefe14U, 0x0f1af00dU,
+  0x10fdeffdU, 0xe1c83a06U, 0x3807eed8U, 0xf2e00e26U, 0xfefb1500U, 0x22cfff11U, 0xe768c41cU, 0x24c81febU,
+  0x09fe0002U, 0x031100b3U, 0x394000c4U, 0x050100fcU, 0xf3f60c0cU, 0x330deefcU, 0xf2133806U, 0x010be700U,
+  0xf9ecf000U, 0xdbc71d00U, 0x1d471400U, 0xef1e0100U, 0x00f0f20fU, 0x002e01bcU, 0x00ed0396U, 0x001de810U,
+  0x281518f3U, 0xa80e0efdU, 0x1f17dfe3U, 0xc107fbdeU, 0x02050000U, 0x0fd9faf5U, 0xd10b0513U, 0x1e12f203U,
+  0x081004f8U, 0xedce2436U, 0x26f0f2e5U, 0x05f21633U, 0x00080b03U, 0x03de0013U, 0xfc51d914U, 0x2aa5f5f1U,
+  0x152900fbU, 0x0bfd00b4U, 0x570400caU, 0x0af40009U, 0x04f005f7U, 0x121dfa05U, 0x2724161bU, 0x15f9e00cU,
+  0xfeed1000U, 0xe1c92300U, 0x3653dd00U, 0xee03fc00U, 0x00fc0203U, 0x0053fccfU, 0x00fa07b5U, 0x0029f90fU,
+  0x2008f7dbU, 0xcd1a1ff3U, 0x4b3721d6U, 0xc4fe19f8U, 0xf907fa09U, 0xfdccf0eaU, 0xd7314effU, 0x1f13e902U,
+  0x0d090aecU, 0x11cbf747U, 0x32cfd5fbU, 0x03fc1d33U, 0xfd06ff07U, 0xefdc2c09U, 0x2a4803e5U, 0x0ebbf4d5U,
+  0x201000d7U, 0x41fc00d0U, 0x71ec00e8U, 0x10e90010U, 0x05f50a0aU, 0xfc03f3fdU, 0x420c0b33U, 0x1000f9f7U,
+  0x01dd2700U, 0xf7f50a00U, 0x2807d400U, 0xdf0b1900U, 0x000e0718U, 0x002d0cdeU, 0x0011fedcU, 0x00230317U,
+  0x111901f5U, 0xee0afd0aU, 0x414557e2U, 0xf2f51c12U, 0x04ee0f08U, 0x10ddf3f5U, 0xe4015a0cU, 0x1e07e2f9U,
+  0x0f00ea07U, 0x06ede716U, 0x10d8ddf3U, 0x0c053630U, 0x0b200e08U, 0x09ec26eaU, 0x1d410f00U, 0xf7c300f0U,
+  0xf11000f5U, 0x1a1800faU, 0xe23f002eU, 0xfff00002U, 0x01f40be7U, 0x43ec12f7U, 0x19f60bfbU, 0xe9090816U,
+  0xf3ebfd00U, 0xfa062800U, 0x0a383400U, 0xf60e0800U, 0x00f1fff6U, 0x00310ff2U, 0x00da1f00U, 0x0005dcf6U,
+  0x0405e40bU, 0xf237fc02U, 0x04e9c444U, 0xe2fa1de0U, 0xf3050d08U, 0x030bef00U, 0xf5f3f7ffU, 0x0a1ee8f6U,
+  0x19f70cf9U, 0xf5e80307U, 0xf6071fe4U, 0xfce2ed1aU, 0x070afc0cU, 0x2604e805U, 0xca35f319U, 0x14e504edU,
+  0x01f700fbU, 0x193500c0U, 0xd06400ffU, 0x04ff0012U, 0xfffb04eeU, 0x56dcfee1U, 0xf7f01fe8U, 0xec030c10U,
+  0xf6daf500U, 0xe4e01a00U, 0x08452300U, 0xfaf41b00U, 0x00e7f90dU, 0x0038040aU, 0x00ed01ebU, 0x000ef5fbU,
+  0xfb06e908U, 0xe120e81aU, 0x03f3a037U, 0xc81b19cfU, 0x09fd1502U, 0x1314d518U, 0xf9edc7ebU, 0x052cd528U,
+  0x07f204fbU, 0xf1ea2504U, 0xf62729dcU, 0xf8daf423U, 0xf823230eU, 0x0fdeee19U, 0x8330e41aU, 0x3edaf5f9U,
+  0x0ae800f1U, 0x1c2e00e1U, 0xd77f00caU, 0xf50a0022U, 0xebf6fcfdU, 0x4011ebd0U, 0xda0b50dbU, 0xe30a0401U,
+  0xfdcdfb00U, 0xded52300U, 0x151b1c00U, 0x10081700U, 0x001cec11U, 0x0020e8faU, 0x00e0fcdfU, 0x0023edf1U,
+  0x09f2f4f8U, 0xe525dbf6U, 0x0dface1bU, 0xb2171acaU, 0x01ee10f8U, 0x25fcfd15U, 0xe2fb22cbU, 0x0416e229U,
+  0xf5fbf60eU, 0x3e15181dU, 0x0b2afedfU, 0x1df1ee18U, 0xeaff1511U, 0x1ef7f228U, 0xd359f3eeU, 0x1dce07ebU,
+  0x0a0600eaU, 0x294900c3U, 0x1d4100d4U, 0xfbdc002fU, 0xe6f10febU, 0x0ef5eff4U, 0xed220ff9U, 0x0ff8f20bU,
+  0xf2effb00U, 0xcecf0800U, 0x1913f000U, 0x23f60300U, 0x000809feU, 0x002fe114U, 0x00e7ddfcU, 0x0035eef8U,
+  0x0ffe00ffU, 0xb825fbe6U, 0x1e1a0d09U, 0xea1d1bf4U, 0x0af9fdf9U, 0x32f3e0ecU, 0xc90b3fb0U, 0x1930f602U,
+  0x12120bf9U, 0x3403df30U, 0x3016c5f7U, 0x11fde623U, 0xeefa1607U, 0xebe7103cU, 0xfc4b0ed4U, 0x0fe103dcU,
+  0x253200fdU, 0x422e00faU, 0x400200e1U, 0xefbd001dU, 0xe0ff28edU, 0xf0e8f603U, 0x22131a37U, 0x00fcebfbU,
+  0xf4ec2100U, 0xd3e7f900U, 0x25400100U, 0xf7ed0d00U, 0x00081529U, 0x002809f9U, 0x00e61b06U, 0x00200810U,
+  0x141b1df5U, 0x8721f317U, 0x243823f3U, 0xfe1f2a00U, 0x00e62705U, 0x1305f1e6U, 0xeee157d6U, 0x0e01ee18U,
+  0x153dedeaU, 0x12cfd207U, 0x0aeae404U, 0x1800ef2fU, 0xf43627ffU, 0x03fff713U, 0x2e4411efU, 0x09ad0ed7U,
+  0xed0200e9U, 0x271b00f7U, 0xf00b002dU, 0xf4f700f2U, 0xfdfbf2fbU, 0x1ffb1508U, 0x2ce1fcf7U, 0xe6e40b22U,
+  0xfde6ff00U, 0xe72d2500U, 0x1b1d1d00U, 0xf2030000U, 0x00fdeafeU, 0x00fb03e8U, 0x00ef4b17U, 0x000bd714U,
+  0xf7fddbf9U, 0xf42ce0ebU, 0xeb0c004dU, 0xb6fc0ad2U, 0xff0210feU, 0xeaf3e7f9U, 0x0b0ddafbU, 0x030ff60bU,
+  0x0bd908eaU, 0xfefa1231U, 0xe4fc49e9U, 0x0fcde931U, 0x01f7ee0eU, 0xff04eb12U, 0xca111a35U, 0x24f0e0f2U,
+  0x08fd00f0U, 0x131d00daU, 0x040e0005U, 0x04fb001fU, 0x08edfce2U, 0x1cf80feeU, 0x0ff904faU, 0xf4d91621U,
+  0xe9e9e900U, 0xe80b2000U, 0x02140e00U, 0x02ddf800U, 0x00fcec18U, 0x0011eef5U, 0x00f93c25U, 0x000fe90fU,
+  0xd4f7f9fbU, 0x040ac4eeU, 0x2de1f83dU, 0xab060fd6U, 0xf50c1903U, 0x12ebe60eU, 0x1115cae6U, 0x1c0d1034U,
+  0xf6dcf9e3U, 0x03eff407U, 0xdd364edcU, 0x0dc8e832U, 0xe7121a18U, 0xe4f6f20dU, 0xa8fd180aU, 0x3de9efd9U,
+  0x0bec00ceU, 0x082500e2U, 0xe60600edU, 0x00050021U, 0xeafd08edU, 0xeb0d0adeU, 0xdc0e0edfU, 0xffe70f12U,
+  0xfaead800U, 0x00cf2600U, 0xe01a1b00U, 0x26eb0e00U, 0x0004f40bU, 0x0020d4c8U, 0x00f9f314U, 0x0006f1efU,
+  0xf01913d4U, 0x05f5e8f2U, 0x35e3de3eU, 0xdd0b18f9U, 0x1603ff06U, 0xf2171503U, 0xf81ae2c6U, 0x1510f71fU,
+  0x06db0320U, 0x31e4f100U, 0xfd412cc5U, 0x16e9ec0fU, 0xc42110fcU, 0x0a081f15U, 0xc0f2ea12U, 0x14ef14dcU,
+  0x38fd00e8U, 0xf74500e0U, 0xda020000U, 0x04fc001cU, 0xe4f30bf4U, 0xf5f6f2feU, 0xcb0ffc15U, 0xfbd61319U,
+  0xfbe0dc00U, 0xecb7f900U, 0xf20b0900U, 0x0ee72900U, 0x00fdf5f9U, 0x002eefd1U, 0x00df122eU, 0x000ce1e1U,
+  0x2d1819c9U, 0xf3e71ceaU, 0x2cd4ef31U, 0xdb0c240dU, 0xeef118f4U, 0xf22e33faU, 0xcf0635cdU, 0x1713001aU,
+  0x1afb2801U, 0x2acf05f1U, 0x1924e1c3U, 0x12e9e01aU, 0xe1ec09deU, 0x10fb233eU, 0xf926ddedU, 0xede10ddcU,
+  0x39f8001cU, 0x08300011U, 0xdeff00e1U, 0xeacf002bU, 0xdbef16e1U, 0xfcde0305U, 0x020e1505U, 0xe40bf115U,
+  0x05dafa00U, 0xe1e70e00U, 0x132bfe00U, 0xf2073c00U, 0x0004f92cU, 0x002f01daU, 0x00c83b34U, 0x000afdf0U,
+  0x200f5613U, 0xa3eaea24U, 0x2af3fc3fU, 0x002b3c19U, 0xd0d64412U, 0x052a0decU, 0xc9d446fdU, 0x0e09ef2cU,
+  0x0a60f7deU, 0x17b1d5e7U, 0xf60cd1ceU, 0x060fd62aU, 0xee231adbU, 0x19f6135dU, 0x1825fdc8U, 0xd2cb24c1U,
+  0x080c00faU, 0x213c0003U, 0x1fe0000cU, 0xdbf500f8U, 0xe6ecf418U, 0x281b1106U, 0x15f90d04U, 0xf1cb1a13U,
+  0x04290e00U, 0xfb362600U, 0xf51a0600U, 0x04f7ff00U, 0x0010f1e8U, 0x00f30cebU, 0x00012b1bU, 0x00f8cb08U,
+  0x10e7ecffU, 0x10ebfcdfU, 0xf003d823U, 0xab06d7ceU, 0xf7050c02U, 0x0205f3f9U, 0xf8f7f319U, 0xfe1211f4U,
+  0x06e80be0U, 0x1f2b1a1cU, 0xe7df02edU, 0x2ab1d913U, 0x1105f4f9U, 0xee01e9f0U, 0xf104ff0dU, 0x2ef3d4f2U,
+  0x042100eaU, 0x0e3c00d2U, 0x31c000f6U, 0x0bff0011U, 0xefebea15U, 0x043a0dd2U, 0x2f01fddbU, 0xfae30a1bU,
+  0xeb06f700U, 0x04443000U, 0x1819ed00U, 0x05edf200U, 0x0002f60dU, 0x0007eef2U, 0x00f942e3U, 0x00eeec09U,
+  0xdfd9fdf3U, 0x20e3f1f4U, 0x2dfde82dU, 0xc612ebebU, 0xe10201fcU, 0x24edfaf1U, 0x08e5ed1cU, 0x1617fa00U,
+  0xf6f20ed1U, 0x182f180dU, 0xe1f606f3U, 0x13ccd41dU, 0x3005fd10U, 0xfff016e3U, 0xe3e90d22U, 0x22efdeebU,
+  0xe50f00d1U, 0xff1b00c4U, 0x4cd800e1U, 0x1df50012U, 0xd301d60cU, 0xde6302e7U, 0xe2e4f5e0U, 0xffe60a2fU,
+  0xe600df00U, 0xf6471500U, 0xf8020700U, 0xf9191500U, 0x0006e137U, 0x00d7f0daU, 0x00df03f0U, 0x00eadbd4U,
+  0xcbff12e0U, 0x1fccf5e9U, 0x1bf2e62fU, 0xd205000fU, 0xd80cf9e5U, 0x2b0e28c5U, 0xed040aeaU, 0x161aeb03U,
+  0xf1e10ff8U, 0x21f9f8e8U, 0xf00cebf3U, 0x0adee7f5U, 0x41fd0911U, 0x191311e0U, 0x08d81e08U, 0xf9f6f2d1U,
+  0x000700fcU, 0xf72400d8U, 0x23ce00bcU, 0x20000022U, 0xdedce6feU, 0xda4c030eU, 0xc414d0f1U, 0xe9c50c1eU,
+  0xff08df00U, 0xf9131100U, 0x071d3000U, 0x05150d00U, 0x0014003dU, 0x00e9e4cdU, 0x00c62108U, 0x00f9f7c1U,
+  0xfc2a01f7U, 0xfdac03efU, 0x1bccec15U, 0xd2190b08U, 0xe5effaedU, 0x3b4031dbU, 0xe5f228e3U, 0xeb13f20fU,
+  0xeae819f7U, 0x23c920faU, 0x2115cbceU, 0x00e1def6U, 0x1df3ebe9U, 0x0b100434U, 0xdd03eee4U, 0xdbff03eaU,
+  0x1ff50038U, 0x0bfe00f8U, 0xe9d600d9U, 0x14c30012U, 0xf6091001U, 0xc6272923U, 0xf213e1f3U, 0xe610fe05U,
+  0x3be1ef00U, 0x0ef71000U, 0x112e2e00U, 0x15052500U, 0x00113722U, 0x00c6e2b7U, 0x00db240cU, 0x00f8ffc5U,
+  0x403a4758U, 0xde91071fU, 0x3ddef62eU, 0x00350728U, 0xb5cb43fbU, 0x19162ef8U, 0xdae938fbU, 0xe120f315U,
+  0x095fefdbU, 0x1bdef703U, 0xe41dd2beU, 0xed25d520U, 0xed2dfd9bU, 0x2b0e1349U, 0xfe1ae8d8U, 0xc7eafbe5U,
+  0xfd08001eU, 0x132200e7U, 0x0e03000fU, 0xeb1c002bU, 0xbd17fd2fU, 0x050e0ae1U, 0x2de40bf5U, 0x20d30c01U,
+  0x081b1500U, 0xfd3c0600U, 0xec5a0800U, 0xf10a1200U, 0x00fddff1U, 0x00f10e09U, 0x00030aecU, 0x00edf4fdU,
+  0x32e1eb10U, 0xf2d306d7U, 0xf4010800U, 0xc200d7f9U, 0xf91c23fbU, 0x1ed6a6e7U, 0xf7e7f515U, 0xed1e0ae6U,
+  0xf9f91f03U, 0x0c2b20f9U, 0xfad314e6U, 0x20aef407U, 0xe81eff06U, 0xf2ddde03U, 0x01f5110bU, 0x36fc0007U,
+  0xfb000025U, 0xe52b00beU, 0x2f000010U, 0xfff800fdU, 0xd205e62eU, 0xdd5636d1U, 0x5cec17efU, 0x15b60902U,
+  0x3f342900U, 0x03080100U, 0xf51eee00U, 0x12f9f900U, 0x00fce50eU, 0x00e9091eU, 0x000b07b8U, 0x00ffe3e5U,
+  0x18c8f226U, 0xfaa016f0U, 0x3a15dcfaU, 0xb61beae8U, 0xe8fe24efU, 0x33c0b6c1U, 0xfbfd0413U, 0xee40fbe1U,
+  0x0014eee3U, 0xfc3a35d2U, 0xf6c1f9f0U, 0x28b7e5eeU, 0x1c1113e9U, 0x21f4f7ffU, 0xccfc1611U, 0x120dcdfcU,
+  0xd5150035U, 0xb80700a6U, 0x4dea00f2U, 0x29f600d0U, 0xe7f3cb17U, 0xe16a0407U, 0x3ff7d8eaU, 0x0bd6170aU,
+  0x3e374900U, 0xd8f91600U, 0x00f6f800U, 0x0ef50000U, 0x001bf602U, 0x00a40a11U, 0x00de06bfU, 0x0009dac3U,
+  0xe1cd0262U, 0xe78611edU, 0x3e22f0ecU, 0xe518d9feU, 0xeefb18efU, 0x2af7e1ccU, 0xf200f3fdU, 0xe04bf6d9U,
+  0xfe12e2c2U, 0xf820fbf6U, 0x16e2f6f1U, 0x1dbdd8e8U, 0x1f09f6e3U, 0x35090525U, 0xaff2f82bU, 0xfee8dd06U,
+  0xa00b0018U, 0xbb1200b6U, 0x36ab00c6U, 0x29e900e1U, 0x1bdae4f6U, 0xb20a083dU, 0x1105dad6U, 0x03e41cf4U,
+  0x6c413500U, 0xd91f1600U, 0xf4311700U, 0x1611fa00U, 0x002746f6U, 0x00b5fc38U, 0x00e416bdU, 0x00fddf90U,
+  0x1317fd7fU, 0xd98d00fdU, 0x390efcf5U, 0x0333fd1bU, 0xde020ff9U, 0x4d3b0ce0U, 0xea06efeeU, 0xc73ef7f8U,
+  0xdffa05c1U, 0x12e7db29U, 0x0d081ce8U, 0x1af3f2e5U, 0x1b2af0bcU, 0x14fe0042U, 0xc3cf0314U, 0xfc03f90bU,
+  0xb9fd0001U, 0xf70200e3U, 0x22e500d3U, 0x2ce000c6U, 0x26260cf5U, 0x9bfb242dU, 0x210eeeeaU, 0x0d0a0708U,
+  0x44110f00U, 0x151f2900U, 0x06361300U, 0x021cff00U, 0x002b54f0U, 0x00bb03d5U, 0x00fe09d4U, 0x00f0fc81U,
+  0x52571e6cU, 0x0b81f505U, 0x5e0b03faU, 0x402bf914U, 0xa6fd1b24U, 0x2b420d03U, 0xe4f00617U, 0xce1ffb04U,
+  0x044bfbf9U, 0x07e3d4eeU, 0xf71df1f5U, 0x1013fd04U, 0xdc4a0bb4U, 0x2c280538U, 0xd2f109efU, 0xd70bfaf8U,
+  0x06e700f9U, 0xedda00fbU, 0xfa0300e5U, 0x0a1400fdU, 0x2d190e0fU, 0xf5edfbdfU, 0xecef0ad8U, 0x14f5ff24U,
+  0xf749f300U, 0xfbe01000U, 0x0ad0ec00U, 0xfaf10900U, 0x0009f5e2U, 0x002ff0e7U, 0x00cfd307U, 0x00fd1c21U,
+  0x0129211cU, 0xf1e3ee03U, 0xf8e2e0d7U, 0x021b20f3U, 0xfdcfed11U, 0x00eaf7e8U, 0xfefc1b09U, 0x00ed1204U,
+  0xbc301103U, 0x04d6f016U, 0x2ff6ddfbU, 0x060c140bU, 0x13d52111U, 0xfde9f8f5U, 0x0830edfbU, 0xf9f6030aU,
+  0xfeec00e1U, 0xf5030005U, 0xf7fe0025U, 0xfcfc002aU, 0x1625f806U, 0x000603cdU, 0xd62115deU, 0x0edc0920U,
+  0xc42cf100U, 0xebeff900U, 0x16d7da00U, 0x0fe8e600U, 0x000bc5efU, 0x001fe7f6U, 0x00dfefe5U, 0x00fa0716U,
+  0x04211036U, 0xdaf51eebU, 0x08d503dbU, 0xf10efe0bU, 0x15d80901U, 0xe5f207e4U, 0xecff1306U, 0x2fe502ffU,
+  0xae1316f3U, 0x05c4eb15U, 0x4ff2d7f0U, 0x19050a0aU, 0x028b2112U, 0x0abe1001U, 0xf346f60eU, 0x00030900U,
+  0xf01e00aeU, 0x0d040013U, 0xe2fe003aU, 0xf9fd001aU, 0x1a3df3f0U, 0x03e7f2ccU, 0xe90b17e5U, 0x15dcff0fU,
+  0xcb2b0200U, 0xc3ed0400U, 0x00fbee00U, 0x05d6e800U, 0x001dd9d6U, 0x0016d525U, 0x00e3ef0aU, 0x000501ffU,
+  0xe41f2900U, 0xa4100cfdU, 0x06e8e411U, 0xddfcfd00U, 0x3ed4f4f4U, 0xed2903e0U, 0xf7fc0716U, 0x2ce919f8U,
+  0xbf1a11ebU, 0x0ecad20cU, 0x2111eadeU, 0x0c0fe70fU, 0x3cd3281bU, 0x02aafeeeU, 0xea27fb09U, 0xf8fe0506U,
+  0xec1600b6U, 0xf30e0011U, 0xfa10000eU, 0x0f160005U, 0x2627e90cU, 0x02fcf5edU, 0xe90305e8U, 0x09000309U,
+  0xdc17f100U, 0xe6e41600U, 0xea0cfd00U, 0xf0ddef00U, 0x00f6cef4U, 0x001be235U, 0x00e9f008U, 0x000ef907U,
+  0xe8f512eaU, 0xb6f1f203U, 0x19e0eb1dU, 0xe4f20021U, 0x59c3c1e4U, 0x1312f1f2U, 0x1fee0825U, 0x2bfb040bU,
+  0xd8142525U, 0x04dc270eU, 0xf829ebe0U, 0xeb1ae11fU, 0x33e60103U, 0xe0dbd9e7U, 0x19251afbU, 0xfc03080dU,
+  0xd70500c5U, 0xde110041U, 0x040b00f8U, 0x151200f4U, 0xf70bebf6U, 0xeae402e3U, 0xfbf7f6f8U, 0xf21b0106U,
+  0xecfd1000U, 0xffff0b00U, 0xf9e51500U, 0x02f00000U, 0x00f4ddfbU, 0x000b0911U, 0x00f6f61cU, 0x00fb01f5U,
+  0xd5f0e4fcU, 0xdff9df30U, 0x1bf4e4f7U, 0x08ee0416U, 0x2ff1f50bU, 0x0a1ad4f8U, 0x12eef00aU, 0xffebf90bU,
+  0x133b0921U, 0x01f23600U, 0x0213daebU, 0xe523e80cU, 0xf607e7eaU, 0xe5d105ebU, 0xeff61901U, 0xed0125f0U,
+  0xfe0600efU, 0xefff00fbU, 0xce0900e1U, 0x21fc00f8U, 0x0a2a14f0U, 0xf7f1fdeeU, 0xf3ee0ce6U, 0x16f3f708U,
+  0xe930f000U, 0xf5c32900U, 0x0af1f900U, 0x000eeb00U, 0x00c9ffe5U, 0x003dc5e2U, 0x00c0cdfeU, 0x00e2fe22U,
+  0x0335d1f2U, 0xdaf916e4U, 0x03dadedcU, 0x0c13faf2U, 0x0ae6f30aU, 0xff0403ecU, 0xe8fb22f9U, 0x2ae70713U,
+  0x052ae514U, 0x50d5f842U, 0x2af8eefcU, 0xf30805eeU, 0x12e502faU, 0x1bd8edfcU, 0x0341ef0bU, 0xf1f9da09U,
+  0xfffa00f1U, 0xfd0500dbU, 0xbd0e00feU, 0x17030008U, 0xf522f7ffU, 0x14f10af1U, 0xe405fce8U, 0x0af906ffU,
+  0xfb25fd00U, 0xf2be1d00U, 0xfaf5f200U, 0x15fae600U, 0x00b0e9f2U, 0x0033ba05U, 0x00dbeaebU, 0x00f12bfdU,
+  0x2106d70cU, 0xa01318faU, 0x0af9eae4U, 0x0611eaecU, 0x60f4d806U, 0xf31cc9f0U, 0xeff00e07U, 0x1cff2113U,
+  0xe121d715U, 0x3aace12aU, 0x330bfa07U, 0x02060406U, 0x14bc22f8U, 0x35dfd0fbU, 0xaf261600U, 0xe7f9bb0cU,
+  0x131000caU, 0x0afc00eeU, 0xc5fa001fU, 0x0aef001dU, 0xea40f2f2U, 0x19def8e3U, 0xf51afbfcU, 0x21d7e01cU,
+  0x0a20e800U, 0x10cc1600U, 0xeff50900U, 0xf7160400U, 0x00cbc5ffU, 0x0046c016U, 0x00eddd1eU, 0x000a20e7U,
+  0xf7d20fcfU, 0x962d1bf7U, 0xe1e8ec10U, 0xd40ef524U, 0x4ae0ded4U, 0x1a39c0ceU, 0x01e10af8U, 0x231d0e1fU,
+  0xcd30141fU, 0x1bbde518U, 0x000b0707U, 0x0506ec0bU, 0x26c4490fU, 0x30b50ef9U, 0xda0203feU, 0xebf4d328U,
+  0xed0300e6U, 0xfe080014U, 0xd9000005U, 0x1cee0013U, 0xf400e1e1U, 0x2ae4f0c9U, 0xec0a06fdU, 0x1006fd0bU,
+  0x1c03d200U, 0x11d3f600U, 0xf5f90e00U, 0xf7f51a00U, 0x00e5d2fcU, 0x0011b90aU, 0x00e0f12fU, 0x00fb0ce9U,
+  0xe9b003e2U, 0xb529f7d1U, 0xdee0ea0bU, 0xbf06fe27U, 0x3dcfe4dcU, 0x0c27cf05U, 0x1fcef716U, 0xfefe0d41U,
+  0x0620392aU, 0x1ae01128U, 0xfb321d11U, 0x021ac139U, 0x21fbf71fU, 0xfddffaebU, 0xf019eef6U, 0xf4e4f00eU,
+  0xa8f4000aU, 0x08090027U, 0xfcfd0007U, 0x0cde00eaU, 0xbee904e2U, 0xf4d4e8e7U, 0xd6e4fdfaU, 0xecf7f40fU,
+  0x42100300U, 0xe6efeb00U, 0x03f40b00U, 0xfdea0900U, 0x00dfe80eU, 0x0039ee1eU, 0x00fbff20U, 0x0002f8f3U,
+  0xe2cacee9U, 0x9226cf09U, 0xfae703ffU, 0xc8f70d28U, 0x17f8fafcU, 0x2841d2feU, 0x1cd0fbf9U, 0x14e4f61dU,
+  0x115e0e39U, 0x0d1af22aU, 0xfe34f6feU, 0xf925cf34U, 0x072bd0f7U, 0xe8c0e10eU, 0xd3e400e7U, 0x03c21310U,
+  0xe31a0008U, 0xdd0c0005U, 0x992400f5U, 0x03f900ffU, 0xd423e4daU, 0xd3e0fe36U, 0xf7fceadfU, 0x14e304f0U,
+  0xf456f100U, 0x0dca3100U, 0xf3001200U, 0xf4e4f000U, 0x00c0d3e8U, 0x00fd87edU, 0x00d1a211U, 0x00d60211U,
+  0x0610d5e2U, 0xb111f4e1U, 0xf0e6d2c5U, 0xd711def2U, 0x3bf2e9f4U, 0xfd2918f3U, 0x0d080debU, 0x10e71629U,
+  0x231ff50bU, 0x5395d868U, 0x27081115U, 0xf809f4efU, 0x24daeae2U, 0x101bdff3U, 0x0b0bd513U, 0x0313e60dU,
+  0x17f80008U, 0xedc600ffU, 0xb71b00e7U, 0x0cfd00f7U, 0xc64dc5d1U, 0xecd620f7U, 0xf907e3f6U, 0x1dcbfffbU,
+  0x08480800U, 0x15ba1200U, 0xe927fe00U, 0x00e5f900U, 0x00e4d908U, 0x00fd85eaU, 0x00e5b209U, 0x00fc150eU,
+  0x4ddff5efU, 0xa541f1e0U, 0xf1faf1d3U, 0xfc14d6ecU, 0x49ec0002U, 0x2b45ed06U, 0xf105f303U, 0x2a00f81fU,
+  0x022f081bU, 0x13b7e055U, 0x1907122bU, 0xfdf3defdU, 0x2ba300cfU, 0x28bb0108U, 0xd0f7d2f6U, 0xf3f9d6f1U,
+  0x06d700e7U, 0xe70700f8U, 0xddfa00f9U, 0xf9dd00fbU, 0xbd31efecU, 0xe3e6f9c6U, 0x0001f0fcU, 0x0be7f4e5U,
+  0x0517dd00U, 0x40dd0d00U, 0xfc160800U, 0xfb100400U, 0x00eac53dU, 0x00f5a7e5U, 0x00f6c31bU, 0x00f62ff7U,
+  0x14c1f9c9U, 0xf6090efeU, 0xf207ff00U, 0xf221ce16U, 0x3cdff5f6U, 0x3647e114U, 0x06f1dff0U, 0x260afa30U,
+  0xd6f41d0bU, 0x05020cf5U, 0xf9081423U, 0x1cf3f2faU, 0x36dbf2efU, 0x08fffbedU, 0xe0faebefU, 0xc3ecd4f7U,
+  0xdff50004U, 0xaa24002eU, 0xe9f3001aU, 0x03e7000cU, 0xe7ce04ebU, 0x19a3f1f0U, 0xdafa04edU, 0xe102f6dcU,
+  0x2cf9c600U, 0x42dff600U, 0x11f8fd00U, 0xdb1c1000U, 0x00e9c322U, 0x00fad6ccU, 0x00e6df15U, 0x00f71404U,
+  0xdcbfbb0dU, 0x01f2ea27U, 0xeb00e004U, 0xd405f636U, 0x00fecc14U, 0xe319f814U, 0x11e9e306U, 0x1a09eb2eU,
+  0x0bd9211cU, 0x08f7190eU, 0xf11d3407U, 0x2513e136U, 0x06f9cd28U, 0x0847ff17U, 0xf2eddee1U, 0xbcdaf1efU,
+  0xbde7003eU, 0xaf050040U, 0xe306001dU, 0x11cb0005U, 0xd2f530e4U, 0xffc1d938U, 0xc8fcefe7U, 0xde14faeaU,
+  0xf6100b00U, 0x3df72300U, 0x11fe0600U, 0xcdfe2200U, 0x00d7b83dU, 0x0026ff2bU, 0x00f70328U, 0x00da0306U,
+  0xeccad7deU, 0xd118c95eU, 0x0eff2f03U, 0xf1df0a03U, 0xee09e214U, 0x0c290b19U, 0x0ad015f3U, 0xffe9e81cU,
+  0x145df80dU, 0x1805fa22U, 0xf442fae6U, 0x2037e108U, 0xd830c013U, 0xebe20e00U, 0xd81700caU, 0xe8c81cd6U,
+  0xe306000aU, 0xbb3a0020U, 0xb03d000cU, 0x060400fcU, 0xa752f4caU, 0x0aea5439U, 0xf000f4e5U, 0x1eeb07cfU,
+  0xf6701300U, 0x18dd3200U, 0xfb221800U, 0xe90f0400U, 0x0009e603U, 0x00d789ebU, 0x00e2a0feU, 0x00d214ebU,
+  0x14e2ebe2U, 0xd706def0U, 0xf6f1dcd5U, 0xdafbd617U, 0x2c00e5d1U, 0xf24512f7U, 0x0113f6efU, 0x0cebee17U,
+  0x2146ff1dU, 0x70961424U, 0x1bfa2f0cU, 0xf6d7f0deU, 0xfbb4e5f8U, 0xf450ee26U, 0x0803d805U, 0xc5fafa0cU,
+  0xe80800fbU, 0xf00600fdU, 0xb73200e7U, 0xfc0e00fdU, 0x9a53e2d3U, 0x20ad3b1fU, 0xf4f6f0f4U, 0x41e42801U,
+  0xe1433200U, 0x34121a00U, 0xdf160100U, 0xedfbf400U, 0x00c6f40cU, 0x00ee8eaeU, 0x00d5c312U, 0x00fb25f6U,
+  0x45bbebd3U, 0xe716e1f5U, 0xea04ddc4U, 0xcef9d400U, 0x2c1bcec3U, 0xfb53060dU, 0x150fcce4U, 0x21e7012cU,
+  0xd4472912U, 0x2f9913f0U, 0x03052905U, 0x0ed2fcf6U, 0x41bfcdd2U, 0xb815f2feU, 0xf3fac007U, 0xc7f10422U,
+  0xd0ef00eeU, 0xf5210018U, 0xcbeb00e3U, 0xffdb0002U, 0xc927f145U, 0x33c42114U, 0xf1fadf00U, 0x22f403f0U,
+  0xef062000U, 0x433a1c00U, 0x031f0600U, 0xdd3f1c00U, 0x00d4f139U, 0x000c28bfU, 0x00d7c41eU, 0x0002290bU,
+  0xfcd9d1e4U, 0x0e1ce904U, 0xd40ee214U, 0xccfa120aU, 0xf90cade9U, 0xd70a2102U, 0xfc07dbfbU, 0x2cfbe44fU,
+  0xc7fe0dffU, 0xebdc26ceU, 0xf0f01610U, 0x20cfe7fcU, 0x300eb615U, 0x04530c0dU, 0x0b12d1e4U, 0xc8ce441cU,
+  0x03d0000eU, 0x0e0f0020U, 0xfdcf00fbU, 0x0dd200faU, 0xcfbb0c24U, 0x02e51c2cU, 0xe2d3e707U, 0x1511dcddU,
+  0x0306f900U, 0x32131600U, 0x24110100U, 0xd6601a00U, 0x00fec9ffU, 0x002a27f2U, 0x00dee912U, 0x00072cfaU,
+  0xe6ebdf29U, 0x190ce007U, 0xf3fbf140U, 0xebf6ebf9U, 0x0508d7edU, 0x11eef2fcU, 0xe5daf401U, 0x2efbcc0dU,
+  0xeb03eff2U, 0xfbee1e04U, 0xe6f2eefbU, 0x2011e333U, 0x1d2fd230U, 0xeb521411U, 0x0d0fe1d7U, 0xdec51b0eU,
+  0xe9b80012U, 0xdfdc00efU, 0x01d70012U, 0x00c300f8U, 0xdbff41faU, 0xd416fa56U, 0xdc1d0fdfU, 0xcc25eef0U,
+  0xfe004d00U, 0x271c4d00U, 0x2f1a2b00U, 0xc9262100U, 0x00b4cd0bU, 0x002deb31U, 0x00e90608U, 0x00fcf516U,
+  0x16f0f72cU, 0x15fee319U, 0x2007272eU, 0x0dce0c14U, 0xe1160107U, 0x3224fc05U, 0xeae53004U, 0xed02e628U,
+  0x1178ccebU, 0x2bd21d0eU, 0xee4ae2e6U, 0x1a69fd24U, 0xe13ade16U, 0xca08f204U, 0xc84103d5U, 0xeccf030aU,
+  0xff2f00f4U, 0xcd7f0022U, 0xbf2500f1U, 0xfbe500d7U, 0x812f02e0U, 0x5cc40df4U, 0xf710010eU, 0xd522cadaU,
+  0xf1011400U, 0x06e13600U, 0xf90f0a00U, 0xfaf90400U, 0x00f7ee31U, 0x00e5bf02U, 0x00ea8117U, 0x00f215c9U,
+  0xe5d9f8e7U, 0xfa150afaU, 0xfbd8f1e1U, 0xfdd2fc17U, 0x1dfcfce0U, 0xe93af4e0U, 0xf61417eaU, 0xfbd2c21eU,
+  0x2066ff17U, 0x2ff65a15U, 0x22191a1cU, 0xea0ae6eeU, 0x13ecfde8U, 0x154df141U, 0x151ce907U, 0xb3bd3602U,
+  0xbd23002eU, 0xc14a00eaU, 0x901f0018U, 0x1db50018U, 0x9f221ae8U, 0x42c724f2U, 0x0fe20207U, 0xda49d4feU,
+  0xe1f55100U, 0x23161100U, 0x1d161a00U, 0xda4f0600U, 0x00fb074dU, 0x0026faffU, 0x00e8a414U, 0x000257e0U,
+  0xb5c5f2f2U, 0x11260afeU, 0xe1d5eefbU, 0x08c9eb29U, 0x1d0906dfU, 0xbf3fd6f1U, 0xf30521eaU, 0x10fab845U,
+  0x115a040cU, 0xfab369fbU, 0x191921f5U, 0xfe2bd9faU, 0x48f0c2efU, 0xc62bed0bU, 0xfd00d6f3U, 0xa99b3907U,
+  0xd3310027U, 0xe11a00e5U, 0xae05001bU, 0x06ac00f9U, 0xf2ec0119U, 0x41164be3U, 0x33fdfdf1U, 0xd93bede3U,
+  0x24f02900U, 0x2808f300U, 0x3b3e2200U, 0xc45b2b00U, 0x001df91aU, 0x00271e23U, 0x00ebdedeU, 0x00f439dfU,
+  0xd2e6d830U, 0x33400bfeU, 0xddf9df3eU, 0x13c9f406U, 0x29f71bedU, 0xef03fcf4U, 0xfc0714e5U, 0x3f1cb93dU,
+  0xf713d10aU, 0xf8154407U, 0xfd00e9efU, 0x2d58a90fU, 0x1b24c50aU, 0xbc1effdbU, 0x0023d617U, 0xc09c39caU,
+  0x1efd0025U, 0xf60400ceU, 0x050a0021U, 0xd2ce0001U, 0x17d0060cU, 0x0c2a1314U, 0x0eda04d4U, 0xb816fac6U,
+  0x373f1900U, 0x39cbf000U, 0x3a4c3300U, 0x812f4200U, 0x000a09ccU, 0x001def2aU, 0x000213d0U, 0x00e819d6U,
+  0x140aec40U, 0x1bfd22d3U, 0x0010ef65U, 0xed0e060fU, 0xd6ec4df6U, 0x58e3fdcfU, 0xf3f817edU, 0x1e3cbd0bU,
+  0x12e2aed1U, 0x292c4116U, 0xf308c4d6U, 0x3840c236U, 0x064adaf6U, 0xcef106eeU, 0xdf3aece0U, 0xf79f0aedU,
+  0x0ed200f1U, 0xfb040096U, 0xf90600f8U, 0xe5bc0010U, 0xe627fd05U, 0xeb100a35U, 0x162b04f2U, 0xb123edf1U,
+  0x340e4500U, 0x12053c00U, 0x35353600U, 0xc73f4000U, 0x00eb1ed8U, 0x000e101aU, 0x001f3fc7U, 0x00cc09e3U,
+  0x54f3fd29U, 0x08fefad4U, 0x2d0e0a37U, 0x1b32021bU, 0xcf08160eU, 0x442c00f5U, 0xd60b0f15U, 0xf631e51dU,
+  0x1f7dcd01U, 0x21ff2116U, 0x054bf5fbU, 0x0d56f32cU, 0xe23e06ecU, 0xbbeee8f1U, 0xcb570deaU, 0xd9ab08eaU,
+  0xf4f300ecU, 0x180c00e8U, 0x3a310012U, 0xfef500feU, 0xf6f8feebU, 0xf8eb06c8U, 0x080b03f3U, 0x1607ffe4U,
+  0x00e2f700U, 0x08bfe500U, 0x04440200U, 0xfd29ef00U, 0x00e2e8eeU, 0x00111e30U, 0x001446fbU, 0x00ae4520U,
+  0x00efeff7U, 0xf8fde2ebU, 0x0219fbfaU, 0x04050905U, 0xfef7fafcU, 0xf6c31635U, 0xfb0d0c44U, 0x04edeb09U,
+  0x03fdf8f1U, 0x5f30bbf5U, 0x3a49f503U, 0xee15edcfU, 0x0301f8feU, 0xf738effbU, 0xf121f80bU, 0x0bfd1004U,
+  0xf7f600f0U, 0x01fb003eU, 0x33260037U, 0x06f2001fU, 0xf2fd01e6U, 0xea1306dcU, 0x131e0ffeU, 0x08fae0d7U,
+  0x09dfef00U, 0x36c3e700U, 0x120e3800U, 0xf82e0600U, 0x0015e4f5U, 0x00f53afeU, 0x00f354d9U, 0x009f2d2eU,
+  0x02f405f1U, 0x48ca0930U, 0x2916ff38U, 0x11dcf30eU, 0xf4fff6feU, 0x44af2b12U, 0x04fa2723U, 0x29f2cd25U,
+  0x02e9fbf8U, 0x5652b6ceU, 0x3d2bd0e1U, 0xe85de9c2U, 0x0bfd10feU, 0xda510e0bU, 0xf856cd13U, 0xf7d232f7U,
+  0xeee20005U, 0xff28001bU, 0x5247002fU, 0x02f5002cU, 0x07f9fff5U, 0xe3f7feefU, 0x0e100810U, 0x0514d5dfU,
+  0x09e7e000U, 0x09e02100U, 0x05fb6c00U, 0xf5312000U, 0x000eea00U, 0x00a435dbU, 0x00fe4010U, 0x00e63a01U,
+  0x130e0b09U, 0x3aa70852U, 0x1f41f206U, 0x57c4f7edU, 0x030203f9U, 0x48a30f14U, 0x0ff60334U, 0x2000d635U,
+  0x12ddf105U, 0x0e6cd4caU, 0x2104dae3U, 0x095cf7feU, 0x14d815fbU, 0xa82defebU, 0xf44dde08U, 0xc6f71ed7U,
+  0x12d80011U, 0xf92800f0U, 0x365a0004U, 0xf6f7003eU, 0x17ee03fdU, 0xd9eafa21U, 0xf8da17f3U, 0xff2effdcU,
+  0x0afde700U, 0x24ef1d00U, 0x19bf3a00U, 0xe6390e00U, 0x00fdf80aU, 0x00ac1ff4U, 0x000c1a03U, 0x00f90befU,
+  0x0d121506U, 0x29b6fe3dU, 0xfb5af6e3U, 0x77e1191fU, 0xf8080005U, 0x36b0da2bU, 0xf9c0f718U, 0x1be7db02U,
+  0xfee8fb02U, 0xfc5aaaccU, 0x1d059c06U, 0xed4fcc15U, 0xfde70e00U, 0x9c17e3d2U, 0xef3414d6U, 0xbcd807faU,
+  0x14e20008U, 0xfaf400caU, 0x572c00c8U, 0x1af80011U, 0x14f5fc07U, 0xb02df709U, 0xf2d404ecU, 0xd962f9f5U,
+  0xfff50200U, 0x1dec2500U, 0xedb30e00U, 0xf7193800U, 0x0010010bU, 0x00c2faf3U, 0x00f4f9e2U, 0x00dd0211U,
+  0xfa13140eU, 0x40cbcb24U, 0xf641c2e8U, 0x4cd735f6U, 0x05fa0c05U, 0x12f0ed15U, 0xd5d7f9faU, 0x0d020704U,
+  0x0ee8fbfcU, 0xf664d8e6U, 0xf6ffa1f2U, 0xf85bce07U, 0xf4e60703U, 0xbb0ce7d3U, 0xee1214f3U, 0xb821fdfcU,
+  0xeffd00eeU, 0xf4ec00cfU, 0x101d000bU, 0x16fe00f5U, 0xeb0b05f9U, 0xfbdee4b4U, 0x01190602U, 0xf513f1eeU,
+  0xf3fffa00U, 0x1801f100U, 0x09260700U, 0x00ebd500U, 0x00f0eae9U, 0x00ea091dU, 0x00d64134U, 0x00d605fdU,
+  0x14e5edf4U, 0x1bf1e7feU, 0x0e06140bU, 0x2700e80bU, 0xeafbf501U, 0x01c5490eU, 0x0a0b251eU, 0xfff90517U,
+  0xeffc09fdU, 0x601dddeaU, 0x0319f8f0U, 0xd31a04e4U, 0x09f1f3f8U, 0xf813f7ffU, 0xe43afc1fU, 0xf0fd2ff4U,
+  0xe6fc00fdU, 0xedf300e7U, 0x412b003dU, 0x02e5001bU, 0xfbf7f9ebU, 0x0f1fe6f5U, 0x081befe1U, 0xe82ecde8U,
+  0xfaeef900U, 0x2706fd00U, 0xf5073c00U, 0xf3eaef00U, 0x0006efe1U, 0x00ce26faU, 0x00ef52f9U, 0x00b421f9U,
+  0x0ef509f0U, 0x45d8fa1aU, 0x0e01e625U, 0x1fd5f312U, 0xee0cef00U, 0x1fa92cf8U, 0xeef91c01U, 0xf00c2f12U,
+  0xfee8fbfeU, 0x4218f0e8U, 0xdd12f9f7U, 0xe0defb02U, 0x11e617faU, 0xacf0f1f8U, 0xcb21f742U, 0x020737ecU,
+  0x01ef0012U, 0xde2000eaU, 0x4b3f001cU, 0x04e10006U, 0x17ef0aeeU, 0x150cfaf6U, 0xcf05d2d8U, 0xed2dcef6U,
+  0xfbf8ef00U, 0x1c0a1400U, 0x15d76200U, 0xde11fd00U, 0x0017e2fdU, 0x00c237eaU, 0x00f36019U, 0x00d71219U,
+  0x1c0a15f1U, 0xf6c9d443U, 0x0bfb0d23U, 0x25e6e9ffU, 0xfc12fcf9U, 0x2081ff0bU, 0x18be0819U, 0xd10511f2U,
+  0xfb0100feU, 0xdf2d30d4U, 0xee01efe6U, 0x05faf836U, 0x0cf310fdU, 0xcb10c0dbU, 0xd40806f4U, 0xf21624f1U,
+  0x37d60017U, 0xc20e000dU, 0x096f001bU, 0x1af7001fU, 0x1aec050dU, 0x000a1ec5U, 0xb9d512e6U, 0x001aebcdU,
+  0x07ffe900U, 0xff173700U, 0xf8db5700U, 0xd2100100U, 0x0005e9f9U, 0x00c21b06U, 0x00f1331dU, 0x00f0ffeaU,
+  0x06091905U, 0xc1caaf2eU, 0xe020ff08U, 0x4eef0907U, 0x051515f0U, 0x38c6e326U, 0x26d72415U, 0xc1ee1ecdU,
+  0x09f20b01U, 0xe558e902U, 0xfa29a7e2U, 0xf5fccc04U, 0xf8f200f4U, 0xd8e7d7c2U, 0xe13af1e5U, 0xf71027f5U,
+  0x11eb0005U, 0xf91a00efU, 0x087a00feU, 0x29d2001dU, 0x20f4090bU, 0xcefb08f4U, 0xadd924f5U, 0xe07ff008U,
+  0x060d0600U, 0x09f12a00U, 0xfbcf2a00U, 0xc9141800U, 0x00e603feU, 0x00eefbeeU, 0x002b0114U, 0x008d06e4U,
+  0x011218e5U, 0x08e0d217U, 0xbd1f0c40U, 0x7bff17d9U, 0x02fafc04U, 0x2dddeef6U, 0xdcd118ffU, 0xc1d915f5U,
+  0x0fee210dU, 0xf648fc02U, 0xd4138bd3U, 0xed24d0eeU, 0xe7e3f3f9U, 0xc613dab5U, 0xde4826f8U, 0xbf382d0dU,
+  0xe9ff0012U, 0xdb2a00d3U, 0x2d010004U, 0xf2e60007U, 0xed04f114U, 0x15f1edc0U, 0xec03ff03U, 0xd740de12U,
+  0x05faf900U, 0x0415fb00U, 0x0cfcf900U, 0x14e9c300U, 0x00f3def1U, 0x0008c709U, 0x00da2539U, 0x000efd03U,
+  0x23f6fbf4U, 0x03ef02e6U, 0xd915e2efU, 0x56db300fU, 0xed0201fbU, 0x07c11511U, 0x1cf01e2eU, 0xfcef12f3U,
+  0xf4f318f5U, 0x1913fde9U, 0xe40c0cc1U, 0xd7fa09ecU, 0xfff1f4fdU, 0x0418e01cU, 0xc91cec2aU, 0xf3d61dfaU,
+  0x040700fdU, 0xe21a00d9U, 0x2a1c00e5U, 0xedef0001U, 0x03f4f912U, 0x18ecd6e3U, 0xdc06fdfaU, 0xe40eea22U,
+  0xf6ec0500U, 0x211efb00U, 0xf4181600U, 0xe9efd900U, 0x00f4d6f2U, 0x0008ef23U, 0x00e536feU, 0x000106ffU,
+  0x15ee05e2U, 0x10ecf711U, 0xc1fadc17U, 0x20d71a01U, 0xe711fcffU, 0x2ab20722U, 0x000c4d26U, 0xff160c0aU,
+  0xf9fa0dd3U, 0xf01bfde9U, 0xe0dee8e0U, 0xe3021afeU, 0x0fe6f509U, 0xdee8ded7U, 0xbb05f3faU, 0x1a050efdU,
+  0x08f800fdU, 0xffe300ebU, 0x330a00f5U, 0x010400ffU, 0x12f30101U, 0x01d201bbU, 0xc4e4eff4U, 0xf51ce8f9U,
+  0xd8fcff00U, 0x3f070400U, 0x02fb1700U, 0xdbf7e500U, 0x0002d0eeU, 0x00e13d08U, 0x00d948ccU, 0x00f6f9fdU,
+  0x07f000e1U, 0x0eface45U, 0xd5fee10bU, 0x42df1502U, 0xea020cfeU, 0x3d9fd628U, 0x12f5250cU, 0xfa1d03f6U,
+  0xf8fd06e7U, 0xb10b34ebU, 0xd9e4e4f3U, 0x12270b00U, 0x17f6f3f5U, 0xedd7c2e6U, 0xa126f80aU, 0xd5f01e01U,
+  0x1cdc00eeU, 0xe71c0009U, 0xd74d003aU, 0x36f70003U, 0x2a0ef203U, 0xf0de19f6U, 0xb8c73bfaU, 0x1e2ae308U,
+  0x01ece000U, 0x22fb3300U, 0x05d02f00U, 0xd6fff900U, 0x00fae8edU, 0x00c5330bU, 0x0014100bU, 0x00f6eadeU,
+  0x220400c9U, 0xdaed9c13U, 0xbeef073aU, 0x50dd1d18U, 0xf2f621e8U, 0x12ebd916U, 0x0c014024U, 0xc7ca23d6U,
+  0x120908f9U, 0xe53410edU, 0xec35dcb3U, 0x05ef05ebU, 0x010402edU, 0x09f0abbeU, 0xae22311aU, 0xf2f33024U,
+  0x1ddb00c8U, 0x9e5300f5U, 0x987e002bU, 0x42cb00daU, 0x500ffaf0U, 0xe8ec2ff6U, 0xbbcd2813U, 0xfa6706f1U,
+  0x11f7ee00U, 0x0b012000U, 0x0cb50c00U, 0xd8040100U, 0x00e50ec9U, 0x00fefe2dU, 0x0031ff43U, 0x00d50ba2U,
+  0x280bf8d5U, 0xd7dcfafbU, 0xebed6d2fU, 0x5af6d6e1U, 0xefe005efU, 0x00fbea05U, 0xd4da5301U, 0xa4d115f4U,
+  0x03ed21f3U, 0xe84b08f3U, 0xd142d0b1U, 0xdef1d3e7U, 0xeef3f4f4U, 0xf528d8c8U, 0xcb402412U, 0xc62b3f21U,
+  0x19e3002bU, 0xd70f00e4U, 0x47ee00f7U, 0xf7c10011U, 0xfe050726U, 0x3cf8eed8U, 0xecf9ffefU, 0xaf1b2443U,
+  0x0a01f500U, 0xf518fa00U, 0x07f3db00U, 0x2de0e100U, 0x0009eaeeU, 0x0008d100U, 0x00fc5406U, 0x0047c8e7U,
+  0x44fc090cU, 0xf9030311U, 0xf813f815U, 0x61f42b09U, 0xfd1319fdU, 0x09da15ffU, 0x04df0a3dU, 0x1a052aebU,
+  0xf1f41ce9U, 0xe6ee03edU, 0xb9e0f3c0U, 0xf309f317U, 0x030609f5U, 0xf50e181aU, 0xa60f0afeU, 0x331714d3U,
+  0x25f30000U, 0xe7f900d8U, 0x27eb00c2U, 0xd9db0002U, 0xeb03ef26U, 0x10d9d1f3U, 0xd1ba1301U, 0xd329f72eU,
+  0xe80dfc00U, 0x0f060100U, 0xf0c7e900U, 0x0afee000U, 0x00fae4fdU, 0x0020f42dU, 0x00ee4114U, 0x0025dbfeU,
+  0x15f1f708U, 0x0e19fd02U, 0xc506e116U, 0x11e510fbU, 0xde1c01f5U, 0x0bb80a07U, 0x08f1252dU, 0x01101cf1U,
+  0xe7fc20e2U, 0xc1f533e5U, 0xc9ceecdcU, 0x18011b0fU, 0x16f6f8f1U, 0xe904fdf5U, 0x98280a21U, 0x35cc01f6U,
+  0x062600f5U, 0x0dd10003U, 0x080a00eaU, 0xeee700efU, 0xf10aeb0dU, 0xefd00eccU, 0xfbbb3517U, 0xed45ed0bU,
+  0xea100b00U, 0x2be60300U, 0xfcb5e700U, 0xd921ec00U, 0x00fadd15U, 0x0001061eU, 0x001a0503U, 0x0002cdf4U,
+  0x04d3ee0dU, 0x2222d65cU, 0xe1ff140eU, 0x18e407e2U, 0xcb0ff9f3U, 0xdacdf930U, 0xf0e0202dU, 0xf208f6dcU,
+  0xf6090fd4U, 0xca0e1500U, 0xe6f8df00U, 0x25f6090bU, 0x19f9e503U, 0xd306f6cbU, 0x8e2221faU, 0x04edfdfdU,
+  0xdd2600fdU, 0xd6ee0021U, 0xd8030021U, 0x17e700d3U, 0x1204f50eU, 0xe9c73beaU, 0xfcd23626U, 0x0f24dce0U,
+  0xee030200U, 0x48dd1c00U, 0x29b7e900U, 0xdd10e200U, 0x00f408f6U, 0x00f20dffU, 0x004f03fbU, 0x00feefc8U,
+  0xf2f303e5U, 0xe6f2ea54U, 0xdafc2f6fU, 0x34bf18e7U, 0xe6e906f3U, 0xeee1ee20U, 0x01eb30feU, 0xeed81beaU,
+  0x00e9fee8U, 0xf83fedf4U, 0x020f0ac2U, 0xec0318eaU, 0x2af6f5fcU, 0xdd29f0e3U, 0x9c01261aU, 0x04ee0b0bU,
+  0xfe090011U, 0xae15000aU, 0xbe4e003eU, 0x120700c5U, 0x37e9f5efU, 0xfafd13d5U, 0x11f91326U, 0x1e08e1e7U,
+  0x01eace00U, 0x1e212f00U, 0x26dcf300U, 0xf1e2cf00U, 0x00e416e8U, 0x001e044fU, 0x00692373U, 0x0009f3a3U,
+  0xeb0916d4U, 0x06fb3323U, 0xe3f77a44U, 0x23f2faa3U, 0xfacf0cf0U, 0xf5eaeffeU, 0xe2dc3105U, 0xbfe224f9U,
+  0xf8b9eeebU, 0x145610edU, 0xfd3502bfU, 0xd4e70af6U, 0x2cf902f6U, 0xca1c02eeU, 0xa70232deU, 0x2aff071bU,
+  0x2fe80029U, 0xd30200e8U, 0x1cc600d9U, 0x2fdb0028U, 0x2d21141cU, 0x45fdf104U, 0xdbf7e8ffU, 0xfefc343aU,
+  0x0cfe0700U, 0xf3ecf600U, 0x12f5ee00U, 0x06fcf500U, 0x001cede8U, 0x00fdd2ecU, 0x004436e4U, 0x0046eff8U,
+  0x49fa2c07U, 0xefff09ffU, 0xee002925U, 0x2c250efcU, 0xf2fc1c02U, 0xded1080cU, 0xf2e61044U, 0x16173703U,
+  0xe6f422ffU, 0xe3efecfeU, 0xddd2e6e5U, 0x0dfd0338U, 0x03101df9U, 0xeef00800U, 0xc8e935ffU, 0x121c16f0U,
+  0x4bf60034U, 0xb90100e7U, 0x2bdf00dfU, 0x1fc50019U, 0x011cfc3bU, 0x35def812U, 0xfaf9f71cU, 0xe5011c49U,
+  0x150c2100U, 0xf21def00U, 0x1fdbd300U, 0x14ff0f00U, 0x0014fbd0U, 0x0029fc0aU, 0x00513eafU, 0x000fadf5U,
+  0x41f80c1fU, 0xe735d811U, 0x14360521U, 0x3a0a1e14U, 0xd3ec250aU, 0xf7e51036U, 0x03eb2f6bU, 0xe8133200U,
+  0xef0e05f7U, 0xc5eefe0cU, 0xefcdf604U, 0x13e8ed34U, 0x08ff00edU, 0xcbf11a1aU, 0xdb31631bU, 0x2df20eecU,
+  0x38f30010U, 0xc4190000U, 0x0c0a00edU, 0xffe0001fU, 0xce1ad439U, 0x41e017ddU, 0x3fee0451U, 0xe1220b12U,
+  0x160e4100U, 0x2e0ef000U, 0x33f7b300U, 0xef042600U, 0x00f408c9U, 0x0023fb02U, 0x005124c0U, 0x00f5cdcfU,
+  0x3a01fc55U, 0x0a61cc40U, 0x2a480406U, 0x37f109eeU, 0xae032c00U, 0xeedb121fU, 0xfbdb2a3aU, 0xd1e403d3U,
+  0xf32de4deU, 0xf1f31312U, 0x2701280eU, 0x0d15ed11U, 0x23fd04fdU, 0xb638fa13U, 0xaa2b2c2cU, 0x42de0912U,
+  0xe4030025U, 0xe40f0045U, 0x152400ffU, 0xf90900f3U, 0xca0fd10eU, 0x3ad90ecdU, 0x57000928U, 0xfb14e1efU,
+  0x28f94b00U, 0x390ee300U, 0x2fbca700U, 0xe9fafd00U, 0x00dd0203U, 0x001bf1feU, 0x0074f3f1U, 0x00f4e5e9U,
+  0x27ed0950U, 0x1639ea52U, 0x203326ffU, 0x3ef810cfU, 0xcefd2ef3U, 0xece6d60cU, 0xd5d30725U, 0xc3f320ecU,
+  0xe822c3d7U, 0x202004fdU, 0x3512220fU, 0xf80406ffU, 0x241dfcc1U, 0x9c2ffe08U, 0x83132803U, 0x50f6ec01U,
+  0x98fe0038U, 0xd31d0029U, 0xc34e0020U, 0xecf8000aU, 0xcd11f900U, 0x120fe8e0U, 0x491e171bU, 0x1306edecU,
+  0x25ef2400U, 0x142de700U, 0x12d9a400U, 0xe8dce800U, 0x00e1e719U, 0x003e1e06U, 0x007f1063U, 0x00e5f9e1U,
+  0x04d7117fU, 0xfe411430U, 0x3b3c3b19U, 0x2114fbcfU, 0xdd041508U, 0xf60df516U, 0xd2d60e25U, 0xe4f2f6fcU,
+  0xed3dd2dbU, 0x294c240eU, 0x1d552c1cU, 0xf6fc2201U, 0x1f090dc0U, 0x99180c09U, 0x9c4d18ecU, 0x27f70608U,
+  0x0fe400d6U, 0x0e0500f7U, 0xd5f500eaU, 0xd2190023U, 0xecf5fef8U, 0xeaeafd27U, 0xe6dffffaU, 0xda0df8d4U,
+  0xf9deda00U, 0xfbdcfb00U, 0x03c10600U, 0x01f53d00U, 0x0017f301U, 0x00f2cdf4U, 0x000cdff4U, 0x008ecbd9U,
+  0x0ee827a6U, 0xf3eb02d1U, 0xf8ebd1d6U, 0x0abfc465U, 0xf9de13f0U, 0x000d1c05U, 0x03e618f2U, 0xf94c9deeU,
+  0xeae8f2f0U, 0x22f8f212U, 0x12d9dd0fU, 0xc7e1fdd9U, 0xf6e414feU, 0x0af912fdU, 0xfb14d1fcU, 0xf4ff06f5U,
+  0xeee8000bU, 0xecdc0010U, 0xe1f500c6U, 0xee2100f2U, 0xf4cceff7U, 0xefe7f928U, 0xdf0017daU, 0xd344f528U,
+  0xfcfbcc00U, 0x0fd4ce00U, 0x0b980d00U, 0xea1a4100U, 0x0032dbfeU, 0x00fce422U, 0x0030d6feU, 0x00d0d381U,
+  0xf4f133e9U, 0xd8f019bbU, 0xdfff07b7U, 0x19cf0756U, 0xf8191be8U, 0x090711eeU, 0xf1072afdU, 0xc06b9ef6U,
+  0xf5f1d5fbU, 0x17eaed09U, 0x1ec2cb1bU, 0xc3da1ad1U, 0x17d92b08U, 0x23f80ffcU, 0x0708cdffU, 0xddd524f1U,
+  0xe7bb003aU, 0xb2d90030U, 0xe4f500daU, 0xe9400043U, 0x13d2e5f2U, 0xfaedfa15U, 0xdd481adaU, 0xd752e920U,
+  0x040be800U, 0x08c4ab00U, 0x078c0a00U, 0xe94d3e00U, 0x0019eb2fU, 0x0018d134U, 0x0009d81bU, 0x000aee81U,
+  0xd9fa1719U, 0xccef1decU, 0x9ef51cf2U, 0x37cef02cU, 0xdf2509c5U, 0x230727f9U, 0xe40426fbU, 0xa263c7edU,
+  0x08eecfebU, 0x17fdeb0dU, 0x11c6ba07U, 0xf7c00cedU, 0x1e9ff0f0U, 0x1addf8e5U, 0x202defe8U, 0xc9a902e8U,
+  0xd9b00042U, 0xc1d80022U, 0xf3df0015U, 0xdd03003dU, 0x11ddf2e3U, 0xdfe0ff05U, 0xc40ff5dbU, 0xe631fb10U,
+  0x1ee60100U, 0xffd3d500U, 0x03860f00U, 0xfc540d00U, 0x0022075cU, 0x000edd3dU, 0x0028ca1aU, 0x00e7f8ccU,
+  0xd1011520U, 0xe4e82b11U, 0xc4d2150cU, 0x13ddd704U, 0xf213dcd3U, 0x1f1d181fU, 0xf8f91bf4U, 0xa94de7e6U,
+  0xfe01d4e7U, 0xf525d909U, 0xf1e9d6feU, 0x3abc2206U, 0x0db8d1ecU, 0x0fee04c5U, 0x1319ddeaU, 0xfdcbf709U,
+  0xc8bc0011U, 0xc6de002eU, 0x0ee40020U, 0xe102004bU, 0xfcffebd6U, 0xef0c0cfeU, 0xcc02e705U, 0xdef2ff0dU,
+  0xf51a1900U, 0xf50b0600U, 0x0af91500U, 0x12032100U, 0x0005093dU, 0x00e50a34U, 0x000c0520U, 0x00eafff4U,
+  0xdcc81afdU, 0x0cdc1714U, 0xeccf0718U, 0xf1f3c61fU, 0x2220f9f9U, 0x14190509U, 0xfaed0c07U, 0xf049e6faU,
+  0xfa0406e0U, 0xfa30dafbU, 0x0ae3e0fbU, 0x40d60efeU, 0xf9c3f7d5U, 0x00d026ccU, 0x11f724deU, 0xd9d9ddffU,
+  0x00f200edU, 0x00f300d8U, 0xdd2100edU, 0xc733005aU, 0xf4df0703U, 0xf1dbff29U, 0xdfbc2af6U, 0xf81af1cdU,
+  0xfef7bf00U, 0x05ebf500U, 0xffde0900U, 0xf1105300U, 0x0045cafdU, 0x00e3b8f1U, 0x000faffaU, 0x00adbfe0U,
+  0x08f52fc6U, 0xc6e109bbU, 0xdfede391U, 0xeec5bc34U, 0xf2ce39f7U, 0x001d24f7U, 0xf6f734f3U, 0xfa688af5U,
+  0x24ead8f0U, 0x29cbe811U, 0x51dfde43U, 0xd5d501eeU, 0x04de03f6U, 0x181aedf3U, 0x0836c6f8U, 0xe6ecff1aU,
+  0xffef0012U, 0x01ee000cU, 0xd22300daU, 0xd6fb0007U, 0x12c711f1U, 0xf9cc090aU, 0xee014aebU, 0xde36ea20U,
+  0xc3f5d400U, 0x11e9f500U, 0xf9e41600U, 0x0aff2700U, 0x005bd8edU, 0x00fbcbffU, 0x002599e6U, 0x00f7e6c9U,
+  0xe8092a1fU, 0xd20512d9U, 0xd812d8b5U, 0xebe3d335U, 0xc23439e5U, 0x0017100fU, 0xf7110ef6U, 0xd66b85ecU,
+  0x3dd0a508U, 0x05d8f615U, 0x4ef4ec32U, 0xcdc01310U, 0x44f1fef3U, 0x130af107U, 0x123ab9f7U, 0xe9c8f009U,
+  0x11cc0029U, 0xc7c80012U, 0xccf600e0U, 0xf8f40050U, 0x27bc00e6U, 0xf3e1e81bU, 0x020d300bU, 0xe73b0024U,
+  0xdfff0200U, 0xebe60700U, 0x00af1e00U, 0x24000f00U, 0x001fe6dcU, 0x0008c2ecU, 0x001ca7d3U, 0x0005db01U,
+  0x1e27fb10U, 0xd219ff09U, 0x0331df02U, 0xfcebe02aU, 0xda2926d9U, 0xf4301537U, 0xfa0407efU, 0xee2eaac9U,
+  0x3207c6deU, 0x0cf4d911U, 0x14e0e902U, 0x2a98050aU, 0x38f3f0e1U, 0x0301efe9U, 0x1d33e7e2U, 0x0bafe4f6U,
+  0xf9ca001eU, 0xc8c60027U, 0xece000f3U, 0x04f30052U, 0x15e4d8d2U, 0x1b03f21dU, 0x15f90becU, 0xf205f906U,
+  0x060a1000U, 0xf6ce2200U, 0xfdae0700U, 0x4af9dc00U, 0x00c8e820U, 0x00dceefcU, 0x0001a3c5U, 0x00dac70cU,
+  0x11fc21f7U, 0xcc111d06U, 0xfbf1ec1fU, 0x45e90a31U, 0x06f10dfaU, 0xff210b1cU, 0xeced0012U, 0xb825f3d7U,
+  0x0711fdc7U, 0xf4e5e818U, 0xe8e3d0fcU, 0x1cb5f701U, 0xf5ff16c1U, 0x13ec09cdU, 0x312be5e4U, 0x0bcb0412U,
+  0xcdc7001cU, 0xe3a50026U, 0x0cd5000dU, 0xe7d90057U, 0xdd20cde1U, 0xdf0be010U, 0xd709ec06U, 0xd509fa1aU,
+  0xfaf7f200U, 0xf6de1a00U, 0x18bd0800U, 0x3a081500U, 0x00b1f550U, 0x00e1f610U, 0x0011e2fdU, 0x00c3ef33U,
+  0x18bcfa07U, 0xf9eb11f5U, 0xe3ecddebU, 0x40f1e54eU, 0x1337da35U, 0xe6f4fe21U, 0xed0003f7U, 0xf04afcecU,
+  0x192713d1U, 0xe816e1f9U, 0x05d2f2f5U, 0x2ff60dfcU, 0xbbdcebdcU, 0x11a922d1U, 0xfd12e2f1U, 0xd8f8e9fdU,
+  0xd62300e6U, 0xcd2100d1U, 0xa95000d6U, 0xc906003bU, 0x10ee150cU, 0xeff40b1cU, 0xf8d4040aU, 0xeeeff604U,
+  0xe121d600U, 0x0618f300U, 0x00160500U, 0xf1e43f00U, 0x0038d8f4U, 0x0004b7fbU, 0x0010b4ffU, 0x000df0fbU,
+  0x08fa41e6U, 0xc0e9e8ccU, 0x1effe297U, 0xdcdee614U, 0xd4fa15c9U, 0xfe001401U, 0x08042cdfU, 0x0869c4faU,
+  0x29ebd812U, 0x1bd7ec10U, 0x6022e15fU, 0x09b82b17U, 0xeaddfe0aU, 0x272f0506U, 0xf536bb00U, 0xece20306U,
+  0xe83900f9U, 0xe2f5000bU, 0xaf2f00f8U, 0xd9030015U, 0x1aec06f5U, 0x16f8fff9U, 0x18083b09U, 0xebfd0f3fU,
+  0xe82dff00U, 0x09351300U, 0xf010f200U, 0xdcb81200U, 0x002fe9e1U, 0x0007c0d2U, 0x0004bbe7U, 0x000c1703U,
+  0x250c0801U, 0xef19f5f0U, 0x1809e9aaU, 0xa005ca11U, 0xbb311faaU, 0x0cf8f835U, 0x15f510b5U, 0xfb4ba6eeU,
+  0x38d4da1dU, 0x05e6f840U, 0x6e43fd7fU, 0x1ea21728U, 0xfa11cd1bU, 0xeef8fde7U, 0xe333a4feU, 0xc6cad710U,
+  0x13000003U, 0xe0e4000fU, 0xb80000e1U, 0xd2360023U, 0x2fe610dfU, 0x23f5050dU, 0x21073a3bU, 0xe71c2a3fU,
+  0x12200300U, 0x0d222c00U, 0x06fff900U, 0xe7e10100U, 0x00d503deU, 0x00e2ecd3U, 0x00feb8ccU, 0x0005c0ffU,
+  0x650abb33U, 0xce24e224U, 0x0d04fbd3U, 0x1a00c8fcU, 0xdbfb2ee9U, 0x1f08ee17U, 0x11d912cfU, 0x0722f1b3U,
+  0x201602edU, 0x0dffd92cU, 0x01eceb57U, 0x25a9f808U, 0xd80efafdU, 0x08f5fae8U, 0x1a26acefU, 0xdb00d722U,
+  0xc8e700f0U, 0x06d40020U, 0xedea00c5U, 0xddf70032U, 0x12f510f2U, 0x08fff028U, 0xf80e1438U, 0xf5120832U,
+  0x1afefc00U, 0x110c2800U, 0x07ece500U, 0x0a1eed00U, 0x00e7f30bU, 0x00f4f1fcU, 0x00fad8e2U, 0x00ecc8f7U,
+  0x43f7c617U, 0xda1e030eU, 0x13ebf1f9U, 0x5ad3e538U, 0x02f7df11U, 0x210ccf0aU, 0x0cdb0bf5U, 0xd4281de0U,
+  0x14322a07U, 0x0ee8d33bU, 0xe3e9022dU, 0x20dbcadfU, 0xf41e0f39U, 0x04b920eeU, 0x0329e5fbU, 0xfa1fd02cU,
+  0xae1000d6U, 0x23ad000bU, 0x11e5009fU, 0xbffb001bU, 0xb937d4f2U, 0xd817ce11U, 0xb81e1022U, 0xba15ff32U,
+  0xff1bfe00U, 0xf6041900U, 0x17dd1900U, 0x23252400U, 0x0002f92eU, 0x00d604e3U, 0x00f504d9U, 0x00e2ed3eU,
+  0x050f81e6U, 0x153305ffU, 0x4604bcd8U, 0x58b3cf28U, 0x0d74b729U, 0xfe07da1aU, 0x02e80af6U, 0x2b1a0dfeU,
+  0x2310421eU, 0x0b01fd2bU, 0xf4e91c21U, 0x1a0716f2U, 0xd4e1d755U, 0xd38131d0U, 0xe51f1a00U, 0xd451dc15U,
+  0xcbe400e0U, 0xb01100e3U, 0xaf1000f5U, 0xe01d0006U, 0xfb04430aU, 0x23f2f4e5U, 0xd0df2ffeU, 0xfcf2f726U,
+  0xfbe7e700U, 0x00000a00U, 0x03defb00U, 0xfa202400U, 0x0055f2f0U, 0x0000dcebU, 0x00f8befbU, 0x00d74dfbU,
+  0x171630ddU, 0xb81ee9efU, 0x0323d2b6U, 0xd5ebc4e8U, 0xfde826e1U, 0xf51de616U, 0xf0081dddU, 0x0754e303U,
+  0xed4bb92dU, 0x0ccaf925U, 0x1711094cU, 0x38c7091fU, 0xeef6080cU, 0xf9f4ff24U, 0x0d08c103U, 0xede3e502U,
+  0xbc280005U, 0xbc230012U, 0xb93900f9U, 0xb420000cU, 0x110f2605U, 0x28e7f5edU, 0x1ee510f7U, 0xfe041b34U,
+  0xdaf30200U, 0xf7272500U, 0x1417f200U, 0xdb042300U, 0x0037fd08U, 0x00ebf8f2U, 0x00fbcf0eU, 0x00d347ffU,
+  0x0922f79cU, 0xe03ce8fcU, 0x1727f4cdU, 0xb303bcdaU, 0xf41346d9U, 0x2a15bb20U, 0x18fe04c2U, 0x1536bcffU,
+  0xf85bf068U, 0x1fdbe74aU, 0x373c1356U, 0x26a5f10aU, 0xf10cef28U, 0xcff60cf0U, 0xef04c4efU, 0xe835d330U,
+  0xb336000bU, 0xf9040020U, 0xd21e00f8U, 0xb5fd00e4U, 0x13291bfdU, 0x2800e503U, 0x1d011635U, 0x05f8fd1eU,
+  0xf9f3cf00U, 0xf6293300U, 0x2017f000U, 0x011b1900U, 0x0020de16U, 0x00ff08f3U, 0x0004d710U, 0x00cdc807U,
+  0x0d07e5c2U, 0xd014fafdU, 0x071107e3U, 0x080ed0f4U, 0x1dc8f4c8U, 0x4217b118U, 0x24fafac0U, 0x11370bd4U,
+  0x0335014dU, 0x1ec3e115U, 0xfe1d2268U, 0x14e1cfdfU, 0x0a04e4fbU, 0xc6c2ebeeU, 0x19f0e6f2U, 0x11f6e642U,
+  0xb72600d7U, 0x08de0010U, 0x04ef00d1U, 0xe71900f2U, 0x1a37f2e5U, 0x2ef6ce08U, 0x10092d04U, 0xf3d4e304U,
+  0xfba5da00U, 0xf83a1500U, 0x2410d900U, 0xf51f0600U, 0x0028c936U, 0x00f4f5e3U, 0x00f5e9efU, 0x00d3d805U,
+  0xe2f2f9caU, 0xc324f3f3U, 0x2009ffe7U, 0x2cd8c3f5U, 0x31ddd111U, 0x1d1a9939U, 0x27ee16e9U, 0x1f17febcU,
+  0x1e372334U, 0x14cdec42U, 0x0ef52d2fU, 0x110fe5cdU, 0x20dc034dU, 0xc787f5f5U, 0xfe00e404U, 0xea2beb0eU,
+  0xb60f00aaU, 0x16d500fdU, 0x36eb00c7U, 0xe7e300b5U, 0xfc24e202U, 0x1cf5daf0U, 0xd80109f1U, 0xb61d0914U,
+  0x210bfd00U, 0xf6321300U, 0x0fe10f00U, 0xde541d00U, 0x0037d636U, 0x00ebe9edU, 0x00f400ccU, 0x00e90f3eU,
+  0xd417adb2U, 0xf62bf8f9U, 0x1522d7edU, 0x18c6d1d3U, 0x524dd8ebU, 0x011fc31eU, 0x22e5fdf1U, 0x3902fbf2U,
+  0x3d0a544fU, 0xf4f5fb1dU, 0xf8ee1023U, 0x00ed1a11U, 0x1dafff32U, 0xe796fde1U, 0xf5f205ffU, 0xdbf6e236U,
+  0xf60a00ccU, 0xcd1d00ebU, 0xe0fe0017U, 0xdd4000deU, 0xe3e85affU, 0x06cbe4edU, 0xecd433e5U, 0x03f90316U,
+  0x07ecee00U, 0xf12d0900U, 0xeafe0100U, 0x09fa1e00U, 0x0040f02cU, 0x00f0ebfbU, 0x00dbf312U, 0x00dd2907U,
+  0xf721ebdcU, 0xc81edff5U, 0xdc21fddbU, 0xebf6d4e0U, 0x1fb22cebU, 0xe937f706U, 0xf9ed01c5U, 0x0c45080bU,
+  0xeb4fd234U, 0x1ec4eb19U, 0x0d11e30bU, 0x3b000704U, 0xea12e1fdU, 0xfde9fef9U, 0x2bd0de00U, 0xe940da10U,
+  0xd0fd00e3U, 0xea2800f6U, 0xe9e900ffU, 0xbe4500ecU, 0x02fc4b1aU, 0x17ddf5ecU, 0x28c53af3U, 0xf806d6e7U,
+  0xddedcd00U, 0xe50f0100U, 0x1418cd00U, 0xf7ea3800U, 0x000fdd66U, 0x00e6e2ecU, 0x00e5e5fbU, 0x00c0fa25U,
+  0xcb15febaU, 0xc527ead7U, 0xd7f2f7e1U, 0xdee8d2f4U, 0x46f32ee0U, 0x1b36d71eU, 0xed0d18baU, 0x544bdc04U,
+  0x1f7cb071U, 0x27d524f2U, 0x1607da27U, 0x2320f4fdU, 0xdd0bdd07U, 0xdedef601U, 0x21ffe1d8U, 0xec29c525U,
+  0xb1220006U, 0x22ed00deU, 0x192100daU, 0xcc2900d0U, 0xdae92232U, 0xf7fd0ee3U, 0x2bff26efU, 0xafedbfd5U,
+  0xf5e5c100U, 0xd2141000U, 0x28ffc200U, 0x04343800U, 0x0005ba54U, 0x00d3dfe1U, 0x00fec2f5U, 0x00c1c125U,
+  0xa21505bfU, 0xcb1d07deU, 0xfbdfffe2U, 0xc2fcd6d8U, 0x5f0516cfU, 0x2b4eb018U, 0xe04818b0U, 0x4b12fde3U,
+  0x2e3ae54bU, 0x23d61817U, 0x1713002eU, 0x0f2bcfeaU, 0x0af7c328U, 0xe0b1111eU, 0x1803e91bU, 0x05f5d1eaU,
+  0xeafa0014U, 0x1bc800eaU, 0x182000c4U, 0xfdfd00b5U, 0xfd05db03U, 0x15eae7d6U, 0x0e031406U, 0xa9efe00bU,
+  0x15d7c700U, 0xce360d00U, 0x2cf3df00U, 0xe57cfb00U, 0x0032b474U, 0x00c2f3d5U, 0x0007dfe5U, 0x00ee26fdU,
+  0xa9ddfeccU, 0xf02efaf7U, 0x0a01f5e5U, 0xe1dff7daU, 0x581ffaf0U, 0x1f2ccc0dU, 0x092d19dfU, 0x1c01f7d8U,
+  0x231a2c4aU, 0x10c60ff5U, 0x211916faU, 0xee26f600U, 0x0ee2f92bU, 0xfcad0a0dU, 0x1a0be00aU, 0xe5e1e805U,
+  0xf7150002U, 0x12e500e3U, 0x102000c4U, 0x10fb009cU, 0x3de5f0ffU, 0x2501e6ebU, 0xecfdf6f0U, 0xd8080b05U,
+  0x1501f300U, 0xf52f2200U, 0x1ce20c00U, 0xdd42db00U, 0x000ee434U, 0x00d2facfU, 0x0007dbc5U, 0x00073fe7U,
+  0xcccfdcbdU, 0x1019f6f6U, 0x0cf5ebf6U, 0xd5e8f5ddU, 0x6808edd8U, 0xfd27e508U, 0x0a0affefU, 0xf5161415U,
+  0x47ba3c32U, 0xf7fdfcf6U, 0x18020ae8U, 0xe108ff13U, 0x2fddf214U, 0xfabcfd15U, 0x08fd04f3U, 0xda04000cU,
+  0x000f00fdU, 0xe8e5002fU, 0x31fd0026U, 0x2bfb005bU, 0xece80adeU, 0x0925fc00U, 0x1efcfc03U, 0x030e00f8U,
+  0x09cc2500U, 0x053b1a00U, 0xfb020800U, 0xf6173900U, 0x00facee0U, 0x00f72deaU, 0x00192a19U, 0x00d3e3ddU,
+  0xfaebc71aU, 0x0cf82838U, 0x021e1e0aU, 0x1303d128U, 0x04f1f907U, 0x0b27c6d8U, 0x0df1f916U, 0xfe1ed80eU,
+  0xf1eaf803U, 0xe9e610f1U, 0xfb25fb1cU, 0xf0fd0c1aU, 0x0705ed01U, 0xf8e527fdU, 0xf9c5110aU, 0xf4d7fc04U,
+  0xf42a00c0U, 0x094800f6U, 0x01fb0046U, 0xfdfa0029U, 0xcd0513fdU, 0x23e0e8ddU, 0x17e0f4fbU, 0xfaeeedecU,
+  0x01e20b00U, 0xf5503c00U, 0x00f61700U, 0xcd064f00U, 0x0041c2c1U, 0x000444d4U, 0x0012f73fU, 0x00f6d5f1U,
+  0xf5f6e01eU, 0x06180733U, 0xeb011424U, 0xe618e80aU, 0xd9eecef3U, 0xf336b9f8U, 0x2ae90d02U, 0xfe3fd0f4U,
+  0xfbd5fdffU, 0xf3f51b05U, 0xf923f708U, 0xead4f535U, 0xdff203f9U, 0xdbc20901U, 0x02b4fbf3U, 0xeca8eafeU,
+  0x0b2800bdU, 0x36480002U, 0xf4140029U, 0x1c080014U, 0xdc271a02U, 0x41bddedfU, 0x05d6e7f6U, 0xfbf9f705U,
+  0x08fd2000U, 0xfb726600U, 0xf8ea2800U, 0xd0f84800U, 0x0010e0bcU, 0x000849ebU, 0x000a082dU, 0x0018d0f6U,
+  0x0a10e440U, 0xcb0fd00dU, 0xdcee0f22U, 0xc2f6f71eU, 0xdd29e0eaU, 0xd745b413U, 0x3ef0e704U, 0xf71be7e4U,
+  0xefb208c0U, 0x09d542fcU, 0xe521050aU, 0xfccf1621U, 0xcdf90cfbU, 0xddabf325U, 0xeebf03f5U, 0xccaa0dfdU,
+  0xff1000c1U, 0x1e360000U, 0xe8260019U, 0x0df100fbU, 0xed33fa1dU, 0x56e9e9f2U, 0xf9deee0bU, 0xeddefd0aU,
+  0xef0f0a00U, 0xdd6f5300U, 0xedee1e00U, 0xf9ed3100U, 0x00eae4a3U, 0x00282907U, 0x00091527U, 0x0038e7d9U,
+  0x23f8f101U, 0xd022b9ddU, 0xc9e5140bU, 0xbee0e332U, 0xea28dae5U, 0xfc25a6f4U, 0x38f2e506U, 0x07ea01e5U,
+  0x13b74ee9U, 0x08ce3a31U, 0xfa20fb10U, 0x08b9150bU, 0x0705de0aU, 0xc1d2d63dU, 0xdee1fbf5U, 0xdeca1bf0U,
+  0xfafd00a8U, 0x231e001bU, 0xeb170005U, 0xd6da00e9U, 0xf3ed0b0eU, 0x0ed4f001U, 0xe30af60fU, 0xedf2ff01U,
+  0x0aeafc00U, 0xc8262300U, 0xf60e1a00U, 0xfeca1200U, 0x0001f5c4U, 0x0028ffeaU, 0x000a092bU, 0x001ef9deU,
+  0xfb10d810U, 0xbf11c9fcU, 0xfbde0a13U, 0xdbf1d828U, 0xf90c0cf7U, 0x1945dae9U, 0x2beef60bU, 0xf7e508feU,
+  0x50b33221U, 0x16df4f48U, 0xf1320009U, 0x09b704ffU, 0x1207d20aU, 0xd4dcca18U, 0xec0400d6U, 0xf1e112eeU,
+  0xe5240003U, 0x1205004aU, 0x25e50020U, 0x0007007fU, 0xcedc1ef4U, 0x2a27fde9U, 0x0b02fc0aU, 0xf2e20ffeU,
+  0x0d192100U, 0x09f51d00U, 0xf5f01100U, 0xec335000U, 0x00ffdcc6U, 0x00217cf7U, 0x001bfe21U, 0x00cfebf3U,
+  0xd6d0c6fbU, 0x01064823U, 0xee1b3c14U, 0x02010423U, 0x07fef3fcU, 0x0401a8fdU, 0x26f3cd11U, 0xf447dfefU,
+  0x21d8f61cU, 0x01010af3U, 0x0c25f90cU, 0x1ee40302U, 0xf61cdffaU, 0xeecf2efdU, 0xf99d19eaU, 0x0bd303efU,
+  0xdaf800e1U, 0x4341002aU, 0x21eb0034U, 0xed17004cU, 0xd41e5921U, 0x100010dfU, 0x1009fbf4U, 0x1bd011f2U,
+  0x08320b00U, 0x1b091700U, 0x02f02900U, 0xc6215f00U, 0x001ae9c8U, 0x001371faU, 0x000a140aU, 0x00f7f304U,
+  0xdf00c906U, 0x0a111d0eU, 0xeff51509U, 0xb80c04daU, 0xebf3ecf5U, 0xbdf58917U, 0x29e9ec03U, 0xed5ef9eeU,
+  0x22d0ee05U, 0x120d22ecU, 0x0b29f811U, 0x0fd60929U, 0xe407e3feU, 0xe5f50a16U, 0x0fb1de07U, 0x3199cce4U,
+  0xeafd00d6U, 0x2b3e001aU, 0x090a001fU, 0xf92c0031U, 0xe80d6c23U, 0x08e43f11U, 0x06f5ecf3U, 0x28f3e9e5U,
+  0x10d90700U, 0x21090400U, 0xf8f42400U, 0xe4194200U, 0x002bb3b9U, 0x0001371dU, 0x0011371cU, 0x0029ecf2U,
+  0x0407f3f5U, 0x1cfae7f2U, 0xddf319f2U, 0xc00826e5U, 0x0422dfc8U, 0xe8f1b418U, 0x0beee315U, 0x133303eaU,
+  0xd8e103f5U, 0xfc1f0c0aU, 0xf014f71cU, 0x2a142d18U, 0x1226f902U, 0xcc351221U, 0xe2c6f007U, 0x08acecdfU,
+  0x0cee00e5U, 0xf9070004U, 0xff1f0023U, 0x19140022U, 0xe2e0291aU, 0x24fc3fe9U, 0xf5edee00U, 0x22e4d219U,
+  0x2de2da00U, 0xe438f100U, 0xcbe4fd00U, 0x13d02500U, 0x0015aad3U, 0x000f2f26U, 0x002e2228U, 0x0070e501U,
+  0x13d3fc00U, 0x2f23cbf0U, 0xd2fb0deeU, 0xd4f73af9U, 0x192300c9U, 0xef00d400U, 0x1705da0cU, 0x2d1114eeU,
+  0x07f1130eU, 0x021623f5U, 0x0810fd0bU, 0x25052c29U, 0x2918d201U, 0xe7220922U, 0xd1e5db0dU, 0xf7bb26d9U,
+  0xe1f300eeU, 0x082000fbU, 0xf82b000fU, 0x00f20028U, 0xd2d318f1U, 0x0e1014f3U, 0xf5f7f0f9U, 0xfdeef207U,
+  0x3de21300U, 0xce570400U, 0xe90ced00U, 0x25be1900U, 0x0022e1ebU, 0x0006fcf3U, 0x003e0729U, 0x0074edf9U,
+  0x0ff000d1U, 0x063998deU, 0xd9eb0630U, 0xdceff946U, 0x2d1011e0U, 0x2243c0eeU, 0x12fee315U, 0xfed207fbU,
+  0x4ce72127U, 0x231e2949U, 0xf51eef14U, 0xfee3f134U, 0xf926cce0U, 0xed13ae2dU, 0xcfecf21cU, 0xebe22bd9U,
+  0xc32700ebU, 0x2f00000dU, 0x3dd80017U, 0x09fd0049U, 0xf9e40ef7U, 0xfb0600fdU, 0xf406f505U, 0x050704ebU,
+  0xfb2b0900U, 0x04ba2000U, 0x01b91000U, 0x06314300U, 0x0031ffe4U, 0x00ff5a11U, 0x0021041cU, 0x00fa0c1fU,
+  0x0ce6c7d0U, 0x0908f714U, 0xdc13200cU, 0xeef83505U, 0xfc0800deU, 0xfd0bd9f9U, 0x41dbf436U, 0xe545cc02U,
+  0x30fe0820U, 0x023ee713U, 0x022cbf09U, 0x0bf40401U, 0xef09b7f9U, 0xffddeed5U, 0x0797fde1U, 0xf2c8f904U,
+  0xf22500e2U, 0x17240007U, 0x0dfb0026U, 0x04250029U, 0xf2094204U, 0xdbfbf928U, 0xfdfefbfaU, 0x0902ed06U,
+  0x0726f100U, 0x26b60800U, 0x10813400U, 0xfa194600U, 0x003cba04U, 0x00192f0eU, 0x00132806U, 0x00f80800U,
+  0xff14cbbdU, 0x0cfe0c1fU, 0xe20311feU, 0xd6ebf6efU, 0xfe261dc1U, 0xefd0e8ecU, 0x3be1f04aU, 0xfd21d10eU,
+  0x19220046U, 0xed2126faU, 0x0bfce212U, 0x24f42705U, 0x1615a3f5U, 0xf20af40fU, 0x06b90bf1U, 0xecccef06U,
+  0x01010001U, 0xc22900fdU, 0xf7fe0006U, 0x152c0005U, 0xe9f5371eU, 0xf7f94220U, 0xfbfafc0bU, 0x09edf1eeU,
+  0x1ce9ec00U, 0x05b2c200U, 0x00d10c00U, 0x06142a00U, 0x001b90e9U, 0x002ad64eU, 0x00201d26U, 0x003a09e4U,
+  0x320c00d9U, 0x33c824d7U, 0xeb0f15f0U, 0xb3f7ecdaU, 0x0b28f8b5U, 0xefb02fe2U, 0x2bdbf715U, 0xf944c616U,
+  0xe4e03441U, 0xf94303ecU, 0x1902dc1dU, 0x19f81d12U, 0x17ffc7e7U, 0x300ffa28U, 0xebe016eeU, 0xcde2d203U,
+  0x060300ecU, 0xe91900bbU, 0xf519000eU, 0x0deb0011U, 0xdbe31100U, 0xf73751f2U, 0xea03f7eaU, 0x08f8d500U,
+  0x44bfe100U, 0xd9f0d400U, 0xe3f2e400U, 0x1dff2400U, 0x0009bc17U, 0x000be435U, 0x00291c1cU, 0x004203e5U,
+  0x06d1f7d8U, 0x40d61de9U, 0xe91c0e30U, 0xd41b111cU, 0x1918f3eeU, 0xeac233d7U, 0x1fe2db11U, 0x2833eb1bU,
+  0x02e53c03U, 0xff2c3ef4U, 0x0620ce0aU, 0x1ee8152bU, 0x20ee9a08U, 0x2d4b1426U, 0xedf50814U, 0xd6d1e1f0U,
+  0xd3030004U, 0x021000e9U, 0xf01900f6U, 0x2616001aU, 0xcdef18ecU, 0xef0f4408U, 0xf30bfa14U, 0xc6f0d600U,
+  0x1df00f00U, 0xcc2ef700U, 0xed16fe00U, 0x0be30c00U, 0x0006f91aU, 0x00f5e30cU, 0x002b0525U, 0x0043efc5U,
+  0x15e830d2U, 0x0ee4b8edU, 0xc405ed30U, 0xf9221e0dU, 0x041a150bU, 0xe9301bd1U, 0x15f7f917U, 0x0ce6f3e9U,
+  0x2f192409U, 0xfef84523U, 0xf030e316U, 0x13d83440U, 0xd718dc02U, 0x3f1edb2fU, 0x02fbf919U, 0xb7daf1ecU,
+  0xb42400fcU, 0x2efb00e6U, 0x3dc900fcU, 0x1dfa000bU, 0xf0042cf8U, 0xd1d5030bU, 0xcb03000dU, 0xd728e304U,
+  0xed12fb00U, 0xf5d7f300U, 0x11ad0900U, 0x25fd0500U, 0x0025da13U, 0x00f7471fU, 0x001716fdU, 0x00132819U,
+  0x1504d5c6U, 0xd30bcee0U, 0xea0c1bfcU, 0xfcfc78e4U, 0xec1123c9U, 0xfdfbf6ecU, 0x26f70425U, 0xebdfe520U,
+  0x1c121042U, 0x1c41bf01U, 0x01d7bbfbU, 0xeb06fc08U, 0x2811e102U, 0xf9f1cfe1U, 0x1fdc05e0U, 0xeabc1bf5U,
+  0xc72200e8U, 0xcefa00f1U, 0x0dd2000bU, 0x1a050022U, 0xfb133ae7U, 0xeee10232U, 0xe3f7f11fU, 0xc9f3e0f7U,
+  0xe0fae200U, 0xf3d3e600U, 0x1abb1600U, 0xfefefd00U, 0x00f98934U, 0x0013eb31U, 0x000720efU, 0x000d220dU,
+  0xeb18d1a5U, 0xf614dbd5U, 0xefec2918U, 0xf20538f7U, 0xf72c0eb6U, 0x1bea03b1U, 0x22d51b34U, 0x1aefc926U,
+  0x1118253dU, 0x32fef11eU, 0x16d0caecU, 0xfde64002U, 0x1b199df7U, 0xfc19a51fU, 0x16cc34e6U, 0xcea72003U,
+  0xd10e00e6U, 0xc2ee00fcU, 0xfbe20029U, 0x16120000U, 0xfa05f218U, 0xf7f73211U, 0xe804030aU, 0xf6e8f120U,
+  0x020de800U, 0xf2dde400U, 0x00f00f00U, 0xebe7e700U, 0x00e98114U, 0x00f9c82aU, 0x001f2e02U, 0x004814d7U,
+  0x2406e6d1U, 0xebe2f6b9U, 0xff074916U, 0xe3221bf3U, 0xea2befcdU, 0x10d442afU, 0x1bd7ff25U, 0x0c29b408U,
+  0x030a2f17U, 0x1725e50aU, 0x000fe3e2U, 0x0ccb2515U, 0x2710bbe5U, 0x322bdbf9U, 0xebfe29e7U, 0xf3c20925U,
+  0x060b00f6U, 0x180200f1U, 0xfc070031U, 0x271a000fU, 0xdadffb0fU, 0xe10839f9U, 0xe9f2060eU, 0xddfdfb24U,
+  0x19dc0200U, 0xe0cbe800U, 0xfdfaf800U, 0x0312f700U, 0x000dc2efU, 0x0012eb4bU, 0x0037330dU, 0x0016fdd8U,
+  0x15faeff7U, 0xe1d111afU, 0xf4f7282cU, 0xec283116U, 0xf1f21befU, 0x09d028c1U, 0x0ce30316U, 0x0442ff04U,
+  0x031e14f2U, 0xe840042aU, 0xf114e4f9U, 0x28eaff2aU, 0x2b26d6e9U, 0x4423f1fdU, 0xf5fa18e3U, 0xcbc6211dU,
+  0x19ee00ebU, 0x26e600ecU, 0xe9fb0016U, 0xfc4400fdU, 0xdf2c3cf1U, 0xcfe7490eU, 0xf7f5f638U, 0xdaec002bU,
+  0x1fef2e00U, 0xe8fbe400U, 0x04f10d00U, 0x081cd800U, 0x00fb1ef3U, 0x0020fd42U, 0x004f1501U, 0x001800a4U,
+  0x42211a01U, 0xe4d1dcbcU, 0xddf9201bU, 0x111c0c10U, 0xe4fd3e0fU, 0x2d001edcU, 0x24fd0f03U, 0xf327f6dbU,
+  0x0c5feefbU, 0xeef2ec3bU, 0xff06dc04U, 0x02b5332eU, 0xee4302ffU, 0x41ddec26U, 0xf3f00af5U, 0xd3eb1b21U,
+  0xe22300feU, 0x1bee000eU, 0xffff0010U, 0x03e9000cU, 0xe70f43ffU, 0xb9e7def0U, 0xcadd0e22U, 0xdc1f0f20U,
+  0x02e70600U, 0xfddaf100U, 0x05c50200U, 0x1dcef200U, 0x00c9c132U, 0x00133efcU, 0x0022f8faU, 0x0000f619U,
+  0x0113f6deU, 0xe907e800U, 0xf80afb17U, 0x11080efaU, 0xf70531deU, 0xfaebf4efU, 0xed392e02U, 0xfaf941feU,
+  0x142d0cfcU, 0x0e1aec0dU, 0x0fc0f615U, 0x0c03fd1aU, 0x3927ec0dU, 0xf4d4e4feU, 0x1e03f5e8U, 0x180408d4U,
+  0xc13c00efU, 0xdd0800d0U, 0x06d30016U, 0x10e90004U, 0x00ec39edU, 0xe2c6d5e7U, 0xe3df0a35U, 0xb3050b1eU,
+  0xfff20f00U, 0xe700e500U, 0x21020000U, 0x22c8df00U, 0x00e1b831U, 0x00ef143cU, 0x0013eef4U, 0x001be824U,
+  0xdce3dddcU, 0x8815e0dfU, 0xe50e0519U, 0x05e822fdU, 0xfff527c2U, 0x2af904bfU, 0xf73e2b1fU, 0x2dfa4816U,
+  0x0728f8fdU, 0x1ff7bcfeU, 0x08ecea12U, 0xfce3260bU, 0x3415d4fdU, 0x15e3b3f7U, 0x0cfc00d1U, 0x0be6f3c2U,
+  0x025f00edU, 0xf4ec00e3U, 0xfef5002fU, 0xff3c001bU, 0xfed819faU, 0x13dbe5d6U, 0xe5e80d1cU, 0x04ee2c3aU,
+  0x3f0bfb00U, 0xe70ee000U, 0x1bf21900U, 0xe4b7d800U, 0x00120015U, 0x00e41734U, 0x000af9e7U, 0x0021f1feU,
+  0xeffef900U, 0x811100b7U, 0xf7052120U, 0xfdde040fU, 0xea0424cbU, 0x111a23cfU, 0xf8262415U, 0x25054af7U,
+  0xe21edde7U, 0x08d5ded6U, 0x0a0d0303U, 0x29e81102U, 0x2a1dced4U, 0x1e0ee40aU, 0xfe1119e5U, 0x33f40500U,
+  0x410b00f7U, 0x1bd800fbU, 0xf4f10034U, 0xf05d0049U, 0x22f101e6U, 0x29defff4U, 0xf7fd071aU, 0xfb0f2f4bU,
+  0x3d120600U, 0xecefee00U, 0x0c081500U, 0x07d4da00U, 0x001a1cc4U, 0x00efef32U, 0x0016f1f2U, 0x0005fdfdU,
+  0x15faff30U, 0x8af619b8U, 0xeb0f3228U, 0xfff62945U, 0xdae332e6U, 0x081416eaU, 0xf6161a16U, 0xff2224ecU,
+  0x123207d3U, 0x05fa020eU, 0x141b08f6U, 0x2e01de2aU, 0x0622f7d6U, 0x20d5fb2dU, 0xed0a16ebU, 0x0d1d0a37U,
+  0x22e000c1U, 0x53e1000eU, 0xf6e80019U, 0xd8600027U, 0x17210516U, 0xf5d41307U, 0x0614fb10U, 0x00f02d1dU,
+  0x36e81c00U, 0xe8f8d200U, 0xfbf21900U, 0x00029e00U, 0x000124c7U, 0x00e40b36U, 0x00130bebU, 0x0014e308U,
+  0x4a1a0333U, 0xadd60fc3U, 0x0f19240fU, 0xd9041a0dU, 0xbefb3803U, 0x41ea18e4U, 0x0f1113f3U, 0xd517fafdU,
+  0x0d43fcfeU, 0x0ea8dcfaU, 0x181afe0dU, 0xe9bafe05U, 0xef420bf7U, 0x3addfefbU, 0xd60207dcU, 0x00390b36U,
+  0x01ee0018U, 0x02ff00e2U, 0xfae000faU, 0x160000e8U, 0x16020315U, 0x06fefc12U, 0xfff602e5U, 0xfcdc0d3fU,
+  0x03edee00U, 0x07c5ff00U, 0x03ecf000U, 0x01f4f300U, 0x00f2ff1eU, 0x00301313U, 0x00030f03U, 0x0014ec0bU,
+  0x04051ff3U, 0xf3ff22dbU, 0xf7f7f9daU, 0xf028fbefU, 0x0118f6f9U, 0x02d9ef04U, 0x01e4e60eU, 0x041b44faU,
+  0x0f0efd02U, 0xe10be2f9U, 0x0bfbf510U, 0x1df1f210U, 0xfefe0fffU, 0xfbd50f02U, 0xfae3eafcU, 0x1c25fd0cU,
+  0xfae90022U, 0xdfd6000cU, 0x0dee0011U, 0x0cc100f1U, 0x29d3ec10U, 0x1ce1ed22U, 0xe30205ccU, 0x2ac41553U,
+  0xfaf31500U, 0x02f0ea00U, 0xf8e4ec00U, 0x1becc800U, 0x00f8191aU, 0x001d3133U, 0x00270103U, 0x00221442U,
+  0x0e0bfe07U, 0xf3ed4816U, 0xeae91fd8U, 0xec191be1U, 0x180b11fbU, 0x0edb02efU, 0x02d02707U, 0x2b2a06eaU,
+  0x192e041fU, 0xfb1acdf7U, 0x21f1c3eeU, 0x23fefde9U, 0xeefbef09U, 0xf6ab10edU, 0x08db06dfU, 0x2e231306U,
+  0xeed0001aU, 0xd6f2001cU, 0x0ff70033U, 0xe2cd00e5U, 0x0ce9e80eU, 0x20e4d62bU, 0xccfa0fd0U, 0x31ccfe10U,
+  0xff152900U, 0x11fdf700U, 0x02d41000U, 0x0aeeb700U, 0x00180c1bU, 0x00082442U, 0x001ce21fU, 0x001b2b4aU,
+  0x0405021fU, 0xedbd4c3fU, 0xd4f81a12U, 0xeff427f4U, 0x04ec1914U, 0x1bb3fffcU, 0x080a18e0U, 0x37f01530U,
+  0x0539df07U, 0x0130cee2U, 0x08ebbe07U, 0x2922f700U, 0xe4e3fd00U, 0xdcc016eaU, 0x0dceeac6U, 0x342ef308U,
+  0x06d800e2U, 0xa3e60034U, 0xeae2000fU, 0xcfc80018U, 0x0a00f0feU, 0x10f6c8f8U, 0xbdf1fdddU, 0x0da90612U,
+  0xea041900U, 0x2b12ef00U, 0xf6f60300U, 0x15e0c900U, 0x00fb07e5U, 0x00e30d2eU, 0x00020032U, 0x00e9f247U,
+  0x200d1511U, 0xebd72736U, 0xb5f7fb1cU, 0xf1fd1618U, 0x02f3020eU, 0x3ed2db0eU, 0x1019fcfaU, 0x2800412bU,
+  0xe532db02U, 0xea6f03e6U, 0x0703f0dfU, 0xff5202fbU, 0xe7eb05f8U, 0xaeb0d1f0U, 0xd3d2eed3U, 0x30020eebU,
+  0x14d900e6U, 0xa2d8000dU, 0xceeb001bU, 0xcadc0029U, 0x0e2202e6U, 0xe633e809U, 0xc905f9efU, 0x370408feU,
+  0xefe3ff00U, 0x113f0d00U, 0x12071900U, 0x1503de00U, 0x00ebfee3U, 0x00ea1550U, 0x00ee2732U, 0x00b80b5aU,
+  0x12f713ebU, 0x19c5051bU, 0xff05fc2aU, 0x121943f3U, 0xf4f1f6f7U, 0x3a1bf408U, 0x141ced07U, 0x1411260fU,
+  0xe015e0feU, 0xfd7f0cffU, 0x091ed4efU, 0xdb5fe1f1U, 0xf4eaff08U, 0xaadff0edU, 0x0bf6f1e3U, 0x19fe1fefU,
+  0x2bef0016U, 0x1bca00d6U, 0x07ef0009U, 0x1b0000d9U, 0x0a14ee10U, 0xf8f8f81cU, 0xf115f6deU, 0x06f10bfdU,
+  0x0dfef600U, 0xf3abce00U, 0xf5d90500U, 0xfb2bfb00U, 0x000e2820U, 0x00582a22U, 0x005ef41cU, 0x0007efdeU,
+  0xfa0f34f8U, 0xf21b37f8U, 0xe4ef2ae9U, 0xcc18be0bU, 0x0616230dU, 0x2ddd190fU, 0x11e7c20fU, 0xfe320af6U,
+  0x0222e3f6U, 0xfe0fcb02U, 0x19f5ef0cU, 0x25d5e5f9U, 0x0fea1ffeU, 0x08a31fdbU, 0xfdbf0af2U, 0x45180b08U,
+  0x0bfd0024U, 0xfad5000fU, 0x16e30015U, 0x0fd400d7U, 0x0207eb07U, 0x12fafe2dU, 0xfd12fbd6U, 0x17f4e7fbU,
+  0xe9f91f00U, 0x0ab6ee00U, 0xe7e01200U, 0x181b1200U, 0x000d4e23U, 0x00361e23U, 0x004606f3U, 0x00f8f405U,
+  0xfefe3df1U, 0x0be8562dU, 0xddf238f0U, 0xe6fde301U, 0xf8ed1d2dU, 0x15c3ea11U, 0x05ffc8f3U, 0x22200712U,
+  0x1729f11aU, 0x2f02c214U, 0x1debcb23U, 0xfe01d522U, 0xf3dc0ef0U, 0x03bc16ebU, 0x22ca03e3U, 0x3300f8fdU,
+  0xe6ea0023U, 0xf2ef00feU, 0x00e70037U, 0xdbd200cfU, 0x0415cb1dU, 0xf6f4dc10U, 0xf30200c6U, 0x1304c6daU,
+  0xec213200U, 0x2800f500U, 0xf1fc2100U, 0x2f1e2800U, 0x00f0430eU, 0x00322416U, 0x0023f901U, 0x00d3192cU,
+  0xf2072a1fU, 0x07da433bU, 0xdefe1cf0U, 0xecf1fc12U, 0xfbf1f50fU, 0x34b4e604U, 0xff16ce19U, 0xf2022924U,
+  0x021dda33U, 0x0456ea17U, 0x14eaadf9U, 0x2332db17U, 0xe3df15ecU, 0xc0ba18f6U, 0xf0c4ebebU, 0xf110ecf0U,
+  0x11ee00f8U, 0xceeb0010U, 0xe2e70004U, 0xf3f100f9U, 0xfe23e602U, 0x0011eee8U, 0xf60610cfU, 0x20ffc72fU,
+  0xd4341100U, 0x26140500U, 0xf6f11500U, 0x31252d00U, 0x00dd2ac0U, 0x001b0e09U, 0x00331403U, 0x00b929fcU,
+  0xfa11fa03U, 0x0bfa153aU, 0xee191af6U, 0xed1901f8U, 0x00f5d8ffU, 0x4ad7c805U, 0x162ddc06U, 0xe0fbed2aU,
+  0xec23ec18U, 0xed520b09U, 0xf7f8cce0U, 0xf4efd81cU, 0xd6bc0e09U, 0x9ac006eaU, 0xe2ace8e8U, 0xf2fc16f1U,
+  0x27fa0013U, 0xaccb000fU, 0xeb0e00faU, 0xe8c00008U, 0x0717f5faU, 0xd04add28U, 0xe2e9ede8U, 0x56f2f825U,
+  0xe1eff500U, 0xf8230900U, 0xe0e03b00U, 0x1f1e1e00U, 0x00d50dabU, 0x00df0123U, 0x0054fe31U, 0x00b607edU,
+  0xe9fbde19U, 0x46b7f121U, 0xfa0ad90eU, 0x01e80ff6U, 0xecece6fcU, 0x2f48c723U, 0x201ed006U, 0xdcf8fa40U,
+  0xe3f6dffcU, 0xfe612807U, 0x021ec7fdU, 0xe12acffeU, 0xfcdc1121U, 0x89dfd700U, 0xcab406f9U, 0xe3c12628U,
+  0x2ddb00fcU, 0x32c300e2U, 0x06e4000cU, 0x1b2b00d4U, 0x11fdf8f2U, 0xfefe0207U, 0xd60bf81dU, 0x3afcf3caU,
+  0x00dbff00U, 0xf500d100U, 0x04b51900U, 0xf4292000U, 0x00162afcU, 0x004534f1U, 0x002de80aU, 0x0010facaU,
+  0xfbfd34e8U, 0xdb0625f7U, 0xcc063d01U, 0xbf15f7f9U, 0x02062c15U, 0x28eb3625U, 0x15040b11U, 0xe913e011U,
+  0x0c10e601U, 0x0c14ac05U, 0x1fb8dc28U, 0x33d01c10U, 0x18de020aU, 0x33af1dd5U, 0x02c60ee9U, 0xe6f51835U,
+  0x24e50022U, 0x1de6000aU, 0x03f2000dU, 0x130500d5U, 0xfcf3e60fU, 0xf3e8fee6U, 0xe3ea18e8U, 0x4105e3d5U,
+  0x1ae92700U, 0xf5f1ec00U, 0xf7ae2d00U, 0xf8563f00U, 0x002c3512U, 0x004c102bU, 0x003a281eU, 0x000bf2d2U,
+  0x12083426U, 0xfee63401U, 0xa01e3ff0U, 0x0037f713U, 0x02e91514U, 0x2ebe061eU, 0xf803dc4eU, 0x0104e221U,
+  0x1f1ed426U, 0x110aa114U, 0x28acc103U, 0x30fdf72eU, 0x28c9f5ddU, 0x38d639edU, 0x30c03a01U, 0xc5e91009U,
+  0x06ec0047U, 0x19fb0014U, 0xfc0b003cU, 0xe50d000fU, 0x011fe538U, 0xf4f01b05U, 0xffdf02d3U, 0x3af7f9d6U,
+  0xfff52d00U, 0x1cf9e200U, 0x1bd73800U, 0x3b333400U, 0x00180bfdU, 0x001e262cU, 0x002c07f2U, 0x001404baU,
+  0xf01b3039U, 0x3e0d2f1eU, 0xc80a4dfbU, 0xf62cde02U, 0x160ed7fdU, 0x3dad120bU, 0xfc08d24aU, 0x1808bd23U,
+  0xfe06e72eU, 0x0225d5f1U, 0x0adaa7f6U, 0x1904d711U, 0xeeb525eeU, 0xfc0e2d02U, 0x20df13edU, 0xea081dfaU,
+  0x05e60005U, 0x0d030004U, 0xd02e001fU, 0x02d00015U, 0x01250213U, 0xdd050414U, 0x22ebc4deU, 0x25e6ea10U,
+  0xfb170300U, 0x371cfd00U, 0x0c061e00U, 0x09192700U, 0x000df2c7U, 0x00ee0613U, 0x002924e4U, 0x00ffeec7U,
+  0xed14fdeeU, 0x15012933U, 0xeb13330eU, 0xef25f7eaU, 0x0c13dff3U, 0x30b0cdffU, 0x2105de2fU, 0x16f7b10aU,
+  0x03e3202dU, 0xf11af1f7U, 0xf405d5f7U, 0x14eccc26U, 0xe6bf1309U, 0xc02213e0U, 0xd7d129f7U, 0xd7d52cecU,
+  0x20130005U, 0xa7f500cfU, 0x0174002fU, 0x32ba00fcU, 0x1ff5f8f8U, 0x893fdd0eU, 0xfad3bdf8U, 0x1a22df06U,
+  0xfbede200U, 0x092b1700U, 0xe8f2fd00U, 0x07313500U, 0x00f0fab6U, 0x00d9d449U, 0x003a19eeU, 0x000903c3U,
+  0xf7facef0U, 0x59efc31eU, 0xbeff14fbU, 0x0629f0dfU, 0x01e1cdf1U, 0x2949b735U, 0x4511df0cU, 0x1002d017U,
+  0x00db2311U, 0xfb422e26U, 0xf703ebfbU, 0x0fdcdd23U, 0x12e00823U, 0x86f1dd14U, 0xb9d20cfeU, 0x988526d7U,
+  0x05e800f0U, 0x2ff600e0U, 0xfa0d001aU, 0xf04800e8U, 0xfb0514f4U, 0x261308d8U, 0xdef43b5eU, 0x51ebd7d5U,
+  0xe9f3fa00U, 0xfb32cd00U, 0x24cc1400U, 0xea142c00U, 0x002007f9U, 0x00214ebeU, 0x0032dbfdU, 0x00ea00eeU,
+  0xf70602edU, 0xf8faed15U, 0xebf5f307U, 0xbf23dc0bU, 0x0effff08U, 0x10e01309U, 0xf4182a1cU, 0xe6fdcf1bU,
+  0xfe09e4feU, 0xf9feb60fU, 0x22c5c709U, 0x29f00e15U, 0x15ecf2ffU, 0x11ef15fcU, 0x2323f8e5U, 0xf1e40321U,
+  0x13f90013U, 0x11f00005U, 0x3bf2003dU, 0xff4300f8U, 0xf9f12b0fU, 0x4616f4ebU, 0xafd93b39U, 0x35f3fcbeU,
+  0xf9f81400U, 0xfc31fc00U, 0x28c52b00U, 0xf42c4200U, 0x0024f80dU, 0x00184615U, 0x000efed7U, 0x000719c9U,
+  0xfb0fe8f5U, 0x03ff00feU, 0xe6e81c41U, 0xc638d50bU, 0x270217ebU, 0xfe0728e3U, 0x02274650U, 0x0efec824U,
+  0x2008cc0dU, 0x2302c01dU, 0x02dfbef3U, 0x12f2f429U, 0x2207d0f2U, 0x220b2405U, 0x02102cdeU, 0xa4c22513U,
+  0xde1a002eU, 0x2200000aU, 0x20180045U, 0xe50e0009U, 0xfe072530U, 0x11f40f16U, 0xa4d12e29U, 0x3012ebb4U,
+  0x07001400U, 0x09180100U, 0x26cb2500U, 0xf10a3100U, 0x00f6e714U, 0x00f3442bU, 0x0000fbbfU, 0x00ec1ed1U,
+  0xcbed01f2U, 0xff1807f2U, 0xe3f92539U, 0xcf2211f3U, 0x3f24de00U, 0x29c219edU, 0x04026b16U, 0x320dc211U,
+  0x1bedda12U, 0x213aca31U, 0xf91800e5U, 0x09e2fffaU, 0x03f1f0f8U, 0xf42318dfU, 0xf44f25edU, 0xb7ad1e0cU,
+  0xe40b000bU, 0x01ef00eeU, 0xf409002cU, 0x15d500f4U, 0x08eef60bU, 0xea192111U, 0xc5072022U, 0x1d02c7d1U,
+  0x0c0df100U, 0x16fbe600U, 0x5eee0000U, 0xeb021200U, 0x00ddf101U, 0x002e3d41U, 0x002c07afU, 0x00e6ebcbU,
+  0x9dfbefd0U, 0x26ededcfU, 0xffeb0631U, 0xe02521cbU, 0x2115ecf1U, 0x35c0ec0dU, 0xf70a4b02U, 0x1825b3fcU,
+  0x0dc62d17U, 0xf22c0008U, 0xe4f236f5U, 0x1cce1b18U, 0xe3e4ee45U, 0xee1004f1U, 0xca5635eeU, 0xb68124f2U,
+  0x0a000008U, 0xa6f000b0U, 0xc8330026U, 0x18c300f6U, 0x23e3fee3U, 0xaa1a090eU, 0xd414f74aU, 0x0d0be0eeU,
+  0xf6f6dc00U, 0x0d190b00U, 0x1404fa00U, 0xf4001500U, 0x00eeecc8U, 0x0032ec62U, 0x0024f5edU, 0x00dd02bdU,
+  0xd409e5e5U, 0x2914d2d0U, 0xf1d4e00aU, 0xf13d01f2U, 0xfde4f1f7U, 0x343aef12U, 0x172803f6U, 0xfa1bcdfbU,
+  0xe79908e6U, 0x171f302fU, 0x10f33e0eU, 0x17ddf315U, 0x2cdbf528U, 0x03eefd0eU, 0xe62c09fcU, 0xc19efbd0U,
+  0x1fe300fdU, 0xfcec00e9U, 0xe03a0046U, 0xf4300002U, 0xdb081409U, 0xebe81ef8U, 0x25ca4141U, 0x0fe6d9e1U,
+  0xf607ef00U, 0xf6c6e800U, 0x09c10f00U, 0xf61e2700U, 0x002414efU, 0x00203703U, 0x0020ee05U, 0x00fa04e2U,
+  0x140ae3faU, 0xf910db10U, 0x0b0f0a1aU, 0xe116e306U, 0x0ffcec15U, 0xeac00012U, 0xd52f4feaU, 0xdb1ed712U,
+  0xf705f112U, 0xf811d019U, 0x3cbf3d26U, 0x07fc2018U, 0xfcdcfb09U, 0xd00a0efbU, 0x1a63f519U, 0xf9ed1609U,
+  0x08130014U, 0xf2fe001cU, 0xda210020U, 0xff2c000cU, 0xfee02f08U, 0x13ec0904U, 0x43c03646U, 0x0df4e2bbU,
+  0xbcfd0600U, 0xecd4dc00U, 0x2fd20600U, 0xf7442a00U, 0x00faf73bU, 0x00e13034U, 0x0006df15U, 0x00ebf8faU,
+  0xa9e9dffaU, 0xdf16e3faU, 0x052f0113U, 0xf11bf007U, 0x2a1302eeU, 0x0e0cfe0dU, 0xc73635edU, 0x1327b505U,
+  0x2f0cd502U, 0x0864cd60U, 0x1fa53f1dU, 0x090e2cfeU, 0xfff2f016U, 0xe303f51cU, 0xdf4beffcU, 0xd6c502feU,
+  0xe013003bU, 0xf0f60013U, 0x0a270030U, 0xfcf000eaU, 0x0bde200bU, 0xdde506faU, 0x5bad3a22U, 0x2a05f1bdU,
+  0xb1111d00U, 0xda11d200U, 0x2c0a0200U, 0xe0192500U, 0x00ddfb3eU, 0x00e5ec33U, 0x0024ef14U, 0x00e1e9d8U,
+  0x9accecdcU, 0xb3011ad7U, 0x39270808U, 0x1d09d9e3U, 0x3d44f8e0U, 0x2b2006edU, 0xdc0e33d8U, 0x1628c40aU,
+  0x31e5caedU, 0x1554ec38U, 0x0f9274daU, 0x27232405U, 0x0ceef82eU, 0xf1e2f2f7U, 0xc250fc1bU, 0xc8c5f6f2U,
+  0xee150023U, 0xf1d100faU, 0xf30a0011U, 0x10c200caU, 0xf8cbfeecU, 0xfe26fa1aU, 0x12153722U, 0x1cfbd8d6U,
+  0xe2130300U, 0xfa0aba00U, 0x51fde100U, 0xf908fa00U, 0x00e40102U, 0x001e0369U, 0x0053073bU, 0x00d9edd9U,
+  0x81ecf8b5U, 0xe7d22bc2U, 0x30f92dfbU, 0x270df2e6U, 0x1808e902U, 0x5b260705U, 0xfeec1cf1U, 0x252acbf6U,
+  0x02b6e9e7U, 0x1729280eU, 0x07d87ffaU, 0x07fb31e4U, 0x3cfdf62fU, 0xfac004f7U, 0xa92a0af7U, 0xd4ad02fbU,
+  0x2c0b0011U, 0x06fb0002U, 0xd82500f5U, 0x02d200deU, 0x14e2e6e5U, 0xfd13f907U, 0x1d072034U, 0xe50cebf9U,
+  0xf3f7de00U, 0xdc312400U, 0x0bdbe700U, 0xf8f62500U, 0x00eaf5d9U, 0x0001264cU, 0x0057e755U, 0x00dafad7U,
+  0xabdef8bcU, 0x130406c9U, 0x3af31ae7U, 0x0a07eafdU, 0xe2e9effbU, 0x674018e9U, 0x13000be1U, 0xee33ed00U,
+  0xf2a0efe8U, 0x280d2b13U, 0x170c541fU, 0x12f4f5f5U, 0x2be0f61cU, 0x5bde03eaU, 0x030cf901U, 0xedbff4eeU,
+  0x220400f3U, 0xf1e60000U, 0xf00300ffU, 0xffed00f6U, 0x00eefbf7U, 0xeffa03e9U, 0xf3ffff18U, 0x050bf913U,
+  0xfcd7e700U, 0x03e7ef00U, 0xfbe50f00U, 0xf213f000U, 0x00e5f3f8U, 0x00eeedf9U, 0x002203fdU, 0x000742fbU,
+  0xfcf1e7e1U, 0x02eed0ebU, 0xf812e408U, 0xf10b23efU, 0xfdf2f20cU, 0xff00d2f1U, 0x08f602edU, 0x02e5ec08U,
+  0xf719f6e2U, 0xedeefb02U, 0x14ea1532U, 0xe205f5f1U, 0xf8f3fb01U, 0xfaedfbfeU, 0x04fbe7eeU, 0xeebd0d02U,
+  0xede600fdU, 0xf8e500e6U, 0x030a00d5U, 0xfeea00fbU, 0x0af5f0f3U, 0xe3f7f707U, 0xfaf11b09U, 0x18fcdb21U,
+  0xfceee200U, 0xeafb0100U, 0xf1c71d00U, 0xe312f900U, 0x001007daU, 0x001803dcU, 0x0010fbfaU, 0x00f32e13U,
+  0xedec1ad3U, 0xfc02c2e8U, 0xce2cb8e9U, 0xf1174409U, 0xfef9e6f6U, 0xf0f2db01U, 0xf7ec17f2U, 0x1ae2f40eU,
+  0x11e4dae9U, 0x02e7f915U, 0x1edc1230U, 0xea22f700U, 0xffe22400U, 0xf1c5deecU, 0x1a15b1feU, 0xec940cf7U,
+  0xe4c20028U, 0x01e700c6U, 0x412100a3U, 0xf8f00004U, 0x1ccef9deU, 0xf3f0fdf5U, 0x02ed12f0U, 0x10f4d91dU,
+  0x1d08bb00U, 0xe8f10c00U, 0xe9d43b00U, 0x0521ff00U, 0x002a0b26U, 0x0037f3e3U, 0x002a02d8U, 0x000e2530U,
+  0xe8ef45c8U, 0xea1af625U, 0xad2eb619U, 0x11032a17U, 0x08e232dfU, 0xe40ce1eeU, 0xfdf804eaU, 0x4bf5ed1cU,
+  0x26dfdcf2U, 0xfcf4001aU, 0x1def1415U, 0xe3330cf9U, 0x26df12f8U, 0xfeb4ddf8U, 0x370bc8ebU, 0xf68107f8U,
+  0xd4de0044U, 0x0bf200dcU, 0x450700d0U, 0xdf080010U, 0x0fd4f9cdU, 0xfeeff905U, 0x0fd5f0f8U, 0x1cf5dc1eU,
+  0x2807d800U, 0xeeee2700U, 0xe7d62500U, 0xf4392100U, 0x002e0768U, 0x00430b02U, 0x0061f5f2U, 0x00f81f13U,
+  0xe9eb21f2U, 0xf9290e21U, 0x8e10e144U, 0xfafcf0f9U, 0x1700240fU, 0x09130af0U, 0x09e40bedU, 0x4f22c10eU,
+  0x0b22caf6U, 0x0cf61616U, 0x35c7f50eU, 0xe82c07f6U, 0x07f9f9e0U, 0xf4c6c4eeU, 0x0e07e7e2U, 0xd5adf4fcU,
+  0xcadf0028U, 0x29f300c1U, 0x130400e6U, 0xc3020001U, 0x060000e7U, 0x0af9f80bU, 0xfed80fe0U, 0xf70ff204U,
+  0xfb092c00U, 0xfe072a00U, 0x06fe0800U, 0xf80c4200U, 0x000b1371U, 0x002c1f0eU, 0x004b0cdeU, 0x00f51437U,
+  0xeedf15fcU, 0xf2212d14U, 0xc224f741U, 0x03d5faf5U, 0x16091519U, 0xfe0305fbU, 0xed05f7edU, 0x481fcf0bU,
+  0xe846d4dcU, 0x0af7d704U, 0x14b900fdU, 0x065b1d03U, 0xfbdc24d7U, 0xfad9f2e8U, 0xf5ebfaf8U, 0xd9eaedf2U,
+  0xfdf300ebU, 0xe5f0002eU, 0x0e0e0026U, 0x27c900ebU, 0x07eafef9U, 0xeb16fc09U, 0xfb1b1a27U, 0xfe16fb07U,
+  0xfddede00U, 0xfde4f900U, 0xf5082700U, 0xf1ece000U, 0x00df07edU, 0x000fee06U, 0x001c34feU, 0x003e3cf9U,
+  0x16fafcdbU, 0xf4d92ce6U, 0xe70920ebU, 0xe30d35eeU, 0xe5022fe3U, 0x01f9e702U, 0x02ece7f2U, 0x0fdad119U,
+  0x1ae400dfU, 0xfff1eefdU, 0x1ce6ef11U, 0xdb01e6f0U, 0xdbd8fcf9U, 0xf9d92fedU, 0x0cf906e3U, 0xfe9718dfU,
+  0xeff8000fU, 0xe9fb002fU, 0x210f00feU, 0x2ccd00faU, 0x18bce5edU, 0xe92012e8U, 0x07ce1c1bU, 0x0832fa41U,
+  0xf2d6e900U, 0xcc050c00U, 0x11172b00U, 0xfde8e800U, 0x000c02fbU, 0x00fe25e8U, 0x001614dfU, 0x001938f7U,
+  0x01e12bd3U, 0xe8f705d2U, 0xdd2ef0e4U, 0xe9025709U, 0xd31f50f1U, 0xdcf2dbf9U, 0x08cfe2e9U, 0x27e6d822U,
+  0x2ac9c8f4U, 0x14f9e32eU, 0x0c0d0319U, 0xdee5f5e4U, 0x0cf60df0U, 0x0cd718e3U, 0xf230c4feU, 0x0fbb25e5U,
+  0xfde40032U, 0x02f5000eU, 0x22f800e6U, 0x07e10012U, 0x24b2cfd4U, 0x1ffe26e0U, 0x19e421ebU, 0xf030f93cU,
+  0x2112e500U, 0xd5271f00U, 0x22f93800U, 0x1c13da00U, 0x00120914U, 0x001f34e4U, 0x003020e5U, 0x000731e8U,
+  0x00de39e4U, 0xec11edd8U, 0xdc38eff5U, 0xeefa2e08U, 0xcafa5a04U, 0xdc09c1efU, 0x21f6fc0cU, 0x20f2ef1bU,
+  0x2cdffbf2U, 0x09f1ee32U, 0x1421fd05U, 0xf0e3f8fcU, 0xe7240eddU, 0x19dcf6deU, 0xe402b8f4U, 0xefc213f2U,
+  0xe8ce0032U, 0x1f0000e2U, 0x0c0100edU, 0xdcf400fcU, 0x17fae6daU, 0x29fe15f2U, 0x32d6f9ddU, 0x1310f917U,
+  0x141f0900U, 0xc60c1100U, 0x06f94400U, 0x02361b00U, 0x00f72bfeU, 0x002452d5U, 0x004823faU, 0x00f919fbU,
+  0xf7e62201U, 0xe62702dbU, 0xb4301fe7U, 0x10fafa14U, 0xf9133212U, 0x11f7eeefU, 0x2502d700U, 0x191add06U,
+  0x050d0bf3U, 0x1dfe020bU, 0x2ff6f9fdU, 0xee00070bU, 0xe60a08d8U, 0x23ead6dcU, 0xf1bad3d1U, 0xdca0e3e5U,
+  0xd7e90019U, 0x24eb00dcU, 0xf80500d5U, 0xc4f00002U, 0x0a27de07U, 0x34e5fff1U, 0x2ac8eadfU, 0xf52bee14U,
+  0xfbf43700U, 0xede92000U, 0xf3c61c00U, 0xe2163c00U, 0x00d20b34U, 0x000937deU, 0x007c14f0U, 0x00d7012cU,
+  0xfdd3290dU, 0xda3901f7U, 0xa73d201bU, 0x32cbf2f8U, 0x020e0115U, 0x16fdf4efU, 0xe303d6f6U, 0x3f1cbe2cU,
+  0xea25edf4U, 0x171df405U, 0x2c10d32aU, 0x094b1a1eU, 0x01ea2cdfU, 0x33e9dde2U, 0xfc8fdbd1U, 0xa9c5ee08U,
+  0xe80300e4U, 0xdede0028U, 0x1935002bU, 0x2ac20006U, 0xf20aeff0U, 0xfa0afa27U, 0xf5ed2d2cU, 0xe901fff6U,
+  0x03cddd00U, 0x1797f600U, 0x06b02700U, 0x03eed700U, 0x00fa00e8U, 0x000ff736U, 0x0023fc2bU, 0x003a0bfcU,
+  0x17ed58d2U, 0xeee559efU, 0xf5fe1bf9U, 0xc8ff1b0fU, 0xe4010607U, 0xf70e0ceeU, 0xf2e3f502U, 0x0cd71f18U,
+  0xfafae1c4U, 0x14e3cf02U, 0x11f5d40fU, 0xf201d9eeU, 0xe8ee0af4U, 0x06eb19f1U, 0x021deb10U, 0x18b108daU,
+  0xd9ec00e6U, 0xf9e7005dU, 0x051a0035U, 0x23be0025U, 0x09ebe0f1U, 0xeb13fdf6U, 0xe9f53f1bU, 0xd600f924U,
+  0x1713ff00U, 0xd2811e00U, 0x09060900U, 0x11dee900U, 0x0005fdedU, 0x0002292cU, 0x000b1e1bU, 0x002a2722U,
+  0x17e541d7U, 0xd8ed5ffbU, 0xfb202103U, 0xb4f4282fU, 0xb00c37e4U, 0xc9090805U, 0x08b1e5f5U, 0x3cdd0b17U,
+  0x04b2dcddU, 0x2b0cc11aU, 0xfa05f51eU, 0xeed2c4fbU, 0xf10ad20bU, 0x1ad125e6U, 0xeb11f6e0U, 0x3bde2ac5U,
+  0x04ee0028U, 0x0f140067U, 0x1e0d0031U, 0x24e80019U, 0x1af7d0f9U, 0x14020ce4U, 0x14f244b4U, 0xeded082bU,
+  0x0e23e100U, 0xd5d62e00U, 0x15141900U, 0x4cecff00U, 0x000834fcU, 0x000a350fU, 0x001649e1U, 0x001c2b0aU,
+  0x08fd1f12U, 0xd2ee4226U, 0x300d2817U, 0xe7ff252aU, 0xc21042fcU, 0xd4f3e003U, 0x23eacf07U, 0x37e80a08U,
+  0x18f606feU, 0x190ae026U, 0xf3e63516U, 0xefe0c6ddU, 0xca1affefU, 0x08e436f7U, 0xf536f4e0U, 0x02e412e1U,
+  0xf0bb0015U, 0x07020033U, 0x320e0011U, 0x0c1400f2U, 0x1131f914U, 0x29002bebU, 0x24d41dc6U, 0xf503f2feU,
+  0xf9f80e00U, 0xda132100U, 0x08f23b00U, 0x13172f00U, 0x00020a04U, 0x00fd3cd7U, 0x000c51b2U, 0x000812fcU,
+  0xfdf80c13U, 0xfc0611faU, 0xe7291b0dU, 0x14103517U, 0x0b2f061bU, 0xedeedff7U, 0x3d14c511U, 0x1c13c7f8U,
+  0x0f072c0fU, 0x0cf7fd05U, 0xfecf4f10U, 0xfcfb00faU, 0xe1f43915U, 0xec0826f4U, 0xd4ebf2e1U, 0xf4dff8e4U,
+  0xffe5001aU, 0x2ffd0013U, 0x35060004U, 0xd90200f7U, 0xd930dbfbU, 0x1ee512dfU, 0x2aaefbdcU, 0xc80fdf04U,
+  0x0b1f2100U, 0xe9db0a00U, 0xd2da3800U, 0xe12d3300U, 0x00fef826U, 0x00fc17b7U, 0x00340d96U, 0x00e3e132U,
+  0x0413ecfaU, 0xfef6f8f6U, 0xc627f0f5U, 0x28f5e8feU, 0x1a19f716U, 0xebffd8f1U, 0x0efbae0aU, 0x2c24c621U,
+  0x19010212U, 0x0814fefcU, 0x29fed42bU, 0x07292617U, 0x0dbf1c23U, 0x1dfef8dbU, 0xb8a3d2daU, 0xcbdae1fbU,
+  0xdfac00dcU, 0xefe30002U, 0xfc10001bU, 0x14fb0007U, 0xd613270bU, 0x27f4f624U, 0x0ae0101bU, 0xfdf52503U,
+  0x1acede00U, 0x12be0600U, 0x1aa30400U, 0xfc0cec00U, 0x0042f3eaU, 0x002ff210U, 0x0027024dU, 0x0030fdf7U,
+  0x19074ad9U, 0x0b024805U, 0xe81424fdU, 0xdff4ed10U, 0xf7de2efcU, 0x0802eefeU, 0xdffa0c00U, 0x01f6f8feU,
+  0xd80bc60dU, 0x0fe101e4U, 0x0bdf0bdbU, 0xecf3e505U, 0xe4f908eeU, 0x0ce80ff0U, 0x10f7f703U, 0x11f2fffaU,
+  0xeaf700f2U, 0x03e70015U, 0xf905002aU, 0x0d0a0039U, 0x041cfbebU, 0xfd0a081bU, 0x26f84ef8U, 0x07f10814U,
+  0x04e9dd00U, 0xcfb22200U, 0xf3c8f900U, 0xfde9fc00U, 0x00390af3U, 0x0027f52eU, 0x00081f2cU, 0x001d3202U,
+  0x181812d4U, 0xf4073b1eU, 0xff1f3902U, 0xc3ed1318U, 0x00e83613U, 0x052222feU, 0xfad221dbU, 0x16fd0617U,
+  0xe30fdb4cU, 0x0aeed6f6U, 0xf81f3af4U, 0x02d4ebfeU, 0xde09f008U, 0x0de900e7U, 0xecd9f6f7U, 0x20f515cfU,
+  0xe5f400ffU, 0x07fb004bU, 0x22440031U, 0x0507000bU, 0x0f20f919U, 0xe6f40208U, 0x1c0b6ed1U, 0xecef0d28U,
+  0x17e3b200U, 0xc4b23700U, 0xe1e1dd00U, 0x37f5fc00U, 0x002f0300U, 0x0000f62aU, 0x00281bffU, 0x00292f0cU,
+  0x150ddff2U, 0xe202262cU, 0x13ff4912U, 0x0afd11f5U, 0x48fff90fU, 0xf42610f4U, 0xdedaf420U, 0xfeec0d07U,
+  0x10040d35U, 0x0609ebfdU, 0xed114224U, 0xf3f803e2U, 0xcfcee601U, 0x1ee9f6f4U, 0xfc28250cU, 0x0a1120e2U,
+  0xdcf200ebU, 0xec040032U, 0x4611001eU, 0x040300f2U, 0xf248de0bU, 0xdae722d9U, 0xf2e05cecU, 0xe60a140aU,
+  0x09ccff00U, 0xf3db1e00U, 0x05f6e600U, 0xf8001200U, 0x0005d029U, 0x0002ea39U, 0x002c00aeU, 0x00110f06U,
+  0xf51d0126U, 0xe7f4182fU, 0xf50ff2faU, 0x170aefedU, 0x1638d91aU, 0xc90000feU, 0xc6ece31bU, 0xf6f0cdf6U,
+  0x1cf42b3cU, 0xf40bfa05U, 0xe8ca7f22U, 0x02140c03U, 0xc684fb1cU, 0xfbf215f4U, 0xc60b1f15U, 0x08f90110U,
+  0xe92700efU, 0x1201005aU, 0x522700ebU, 0xeb1d00dbU, 0xe604e21fU, 0xd2e90e02U, 0xc8f32debU, 0xc42411efU,
+  0x110f0600U, 0xf9f10f00U, 0x0ee31800U, 0xeb0a2900U, 0x0007de2aU, 0x00faf109U, 0x0034dc98U, 0x002b0614U,
+  0xcd06eedeU, 0xe4cd1e53U, 0xf509cf1bU, 0x132bc6d8U, 0x1a47e60aU, 0xe6eceaf2U, 0xe1fdf5f4U, 0x0f32dff3U,
+  0x15ed432eU, 0xebfdd8fbU, 0x08d80cf4U, 0x141c341bU, 0x0eb7070fU, 0xebfd25e7U, 0xc6260606U, 0x0820e943U,
+  0xf0cc00c1U, 0x0ef90003U, 0xef0b0036U, 0xe6080019U, 0xe2f5351aU, 0x40e70914U, 0x77c01701U, 0x0cfd1517U,
+  0x0fdfcc00U, 0x0e0b0600U, 0xf6eafd00U, 0x05c70100U, 0x003b0efbU, 0x001600fcU, 0x00150559U, 0x0014060fU,
+  0x1d25e2d8U, 0x1d111a03U, 0xef076617U, 0x0908041fU, 0x0dad1f13U, 0xf0f20cf7U, 0xedd615d8U, 0xf9060507U,
+  0xea21b627U, 0xf0d205f7U, 0x04e110d5U, 0x0210050fU, 0xe0ffdef3U, 0xfcfbf4f0U, 0x21080f09U, 0xf8001b0cU,
+  0x18ac00edU, 0x14fa00fcU, 0xea22000eU, 0xe218001fU, 0xf5e42f2aU, 0x1cf4190aU, 0x51d455f6U, 0x06e5ff1dU,
+  0xfce9b300U, 0xed1f1800U, 0xe2d6dd00U, 0xf1d61300U, 0x000fe519U, 0x0007ec08U, 0x00391b24U, 0x00fe2f28U,
+  0xea05f0e7U, 0xff191711U, 0x0aff69ecU, 0xee182807U, 0x25d5411aU, 0x04f10af5U, 0xc8cd26ddU, 0x0424f200U,
+  0x1718c539U, 0xeee2f7edU, 0xe1d44fd9U, 0x07fb0000U, 0xefe1e126U, 0x0205fef3U, 0xfc3602e8U, 0xea16fc1bU,
+  0xf2b70001U, 0x211d0046U, 0x126d0032U, 0xdf070010U, 0xb2f70f68U, 0xe9db2204U, 0x22f165f9U, 0xeedf1734U,
+  0xf4f1c800U, 0xb0192500U, 0xb5969800U, 0x11f0f500U, 0x00d2c433U, 0x00f50912U, 0x002af923U, 0x001efb1aU,
+  0xf7cff3ebU, 0xcc080d23U, 0x0efb5adaU, 0x0e1110e0U, 0x6f043611U, 0x0f1e0c08U, 0xbbd21ff9U, 0xfd0804dbU,
+  0x37f7d21dU, 0xebddd6d7U, 0xf6f2490aU, 0xe6f80afcU, 0x03cff510U, 0xfb091606U, 0xf71a1208U, 0x1c1602d1U,
+  0xbb1b0003U, 0x0d290058U, 0x11540046U, 0x0efd0003U, 0xa9faeb38U, 0xdfc81cf7U, 0x06f67802U, 0x16161c17U,
+  0x24f61800U, 0xd0101a00U, 0xb6b89900U, 0xf5ead800U, 0x00eedc7fU, 0x00f71714U, 0x00479d1dU, 0x001ede07U,
+  0xc9def208U, 0xbbe70823U, 0xd7f91cbaU, 0x13f216b7U, 0x5c2420faU, 0x1410070cU, 0xd8d9e1f6U, 0xe9f0fdfbU,
+  0x06fee20eU, 0xdce9cfe5U, 0x0fbf4a0aU, 0x051117e9U, 0x2c12ff13U, 0x051f2127U, 0xf7192033U, 0x25df0cf8U,
+  0xb7560029U, 0x0f02004aU, 0x114d0028U, 0x0a0700ebU, 0xe5edf010U, 0xd1f30501U, 0xf7f84008U, 0x241509f8U,
+  0x1635f900U, 0xf80a0e00U, 0xdfe2bc00U, 0xe5f3f900U, 0x00f21a4dU, 0x0009f731U, 0x0048b80bU, 0x001b0814U,
+  0xbceff0d4U, 0xd6c6121eU, 0xcc0026c5U, 0xe711ffafU, 0x4e21fbf5U, 0x0afb05ffU, 0xf5f3fdd8U, 0x070800eaU,
+  0xfcc41a1eU, 0xe5eadbecU, 0xf19421ebU, 0x180d14fcU, 0x3d12ff2bU, 0xd0ff01ddU, 0xd03d0818U, 0x4ee2ff25U,
+  0x490600e6U, 0x202300fcU, 0xe1f200eeU, 0xf70c000eU, 0x27e900ebU, 0x28d10727U, 0xeee6072eU, 0xfdf30808U,
+  0xf9faed00U, 0xf9252600U, 0x08d3e600U, 0x02e71b00U, 0x00101d10U, 0x0007170aU, 0x00cddc04U, 0x0015ebf3U,
+  0xff310cbaU, 0x0413fff8U, 0xfdebf2ecU, 0x03110d0eU, 0xff053d1dU, 0x0801eceeU, 0x081913e4U, 0xf807fdf2U,
+  0x2932f7d9U, 0x04f700f3U, 0x11e9ddfbU, 0xf1f10914U, 0x1e130207U, 0xf70f070bU, 0xf80c0301U, 0x0602fd0aU,
+  0x1ee100fbU, 0x140b00e7U, 0xf7ec0027U, 0xe9f70003U, 0x43b011ebU, 0x45c80615U, 0xfee30c41U, 0x03f5fafaU,
+  0xfecac400U, 0x253c1700U, 0x26daea00U, 0x0bbcf800U, 0x002f356dU, 0x000929f2U, 0x00e012e6U, 0x0003f609U,
+  0xf71e178bU, 0x07180900U, 0xeaf01039U, 0x0119fa0aU, 0x01e979eaU, 0x0015e3fcU, 0xf6131dffU, 0x100afbe5U,
+  0x3e13e0e8U, 0x0bf20a00U, 0x28d3dcfbU, 0xe1de1e16U, 0x7a2607ffU, 0xf31a0627U, 0xe90e0109U, 0xfbe61003U,
+  0x09dc00d0U, 0x0b1c00f3U, 0xe7e80010U, 0xd0e50006U, 0x39f0eddcU, 0x3ee200e8U, 0x17d4102cU, 0xf900f6f3U,
+  0xfaeaa100U, 0x0e571400U, 0x14d5d900U, 0xdec1f300U, 0x00ee5354U, 0x00191202U, 0x001609efU, 0x0010f601U,
+  0xf91953c9U, 0x0aed0bfaU, 0xcd070a46U, 0xc8ff0a06U, 0x1ab74211U, 0xf2f60b04U, 0xfef70b0bU, 0x1c0efeefU,
+  0x1a7fdbe3U, 0xfa0a0efcU, 0x02e4f5f9U, 0x09dc142eU, 0x561d29f1U, 0x051fdbf4U, 0x05caf104U, 0xeadbf607U,
+  0x05d10007U, 0x2ee30012U, 0xeee40024U, 0xe3f600e4U, 0x33d9fbceU, 0x220ffed7U, 0x2bc6070bU, 0xf101f10eU,
+  0xd510ba00U, 0x031a0a00U, 0x15dbce00U, 0xf9fdf600U, 0x00db253eU, 0x0012f601U, 0x001b1bd7U, 0x00e5fd17U,
+  0x08351ff8U, 0x0ad22025U, 0xec360d41U, 0xd9e8e6ebU, 0xdcef0c1eU, 0xdd033005U, 0xf700f106U, 0x310df704U,
+  0xe570ea01U, 0x08fb13f8U, 0xf5f806f5U, 0x0edf0c17U, 0x4ef538e6U, 0xf930f40aU, 0x18cfe5eeU, 0xf7f8f91aU,
+  0x0dd90009U, 0x27fa002bU, 0xf0e600f1U, 0x020400f6U, 0x4d2101ebU, 0x1d19fb0aU, 0x1ee00d10U, 0xde08f001U,
+  0xd613f000U, 0x113cf000U, 0x06b8e600U, 0xfbfe1c00U, 0x00f00e54U, 0x000c08f0U, 0x001bfaecU, 0x00c5f50eU,
+  0x042a190cU, 0x08c71ffbU, 0xe425e5f3U, 0xf2e8b21dU, 0xfc020511U, 0xf206010cU, 0xf9f6fb02U, 0x1417e1feU,
+  0xe168f4e6U, 0x01f9000cU, 0xfdcb01fbU, 0x16e416feU, 0x04f42a0dU, 0xff13fd0dU, 0x08f1dbf1U, 0xf4ecea08U,
+  0x30f300e2U, 0x141d00f7U, 0xe5f200dfU, 0x1618002bU, 0x16f508eeU, 0x46efff34U, 0x0bcaff04U, 0x02df060dU,
+  0x1aebe700U, 0xeb340000U, 0x14f1e200U, 0x05f81300U, 0x0011f71cU, 0x00f131d4U, 0x00f0e1f0U, 0x00fcdd0eU,
+  0xf92f13cfU, 0xec07d0d6U, 0xfdcbbb0bU, 0xf21df60aU, 0xe32e65e9U, 0xe2e30501U, 0xec100cf4U, 0xea0bdefbU,
+  0x0febfdddU, 0x1112e50fU, 0x0ef1fbdcU, 0x09e6020fU, 0x52320115U, 0xe01afe06U, 0x0206f8fcU, 0x1706eefeU,
+  0x2ef400f1U, 0x241400cfU, 0xe6ec0016U, 0xf81a002fU, 0x0ff8c4d1U, 0x3bee0625U, 0x2cd4172eU, 0x0fdc0b2cU,
+  0x1cccec00U, 0xe63cf800U, 0x09f20d00U, 0xede5fb00U, 0x00131f38U, 0x001e2de2U, 0x002830dcU, 0x0005f612U,
+  0x12eb32ccU, 0x1b07ebe0U, 0xe7c00220U, 0xf727e41eU, 0xb00e6ce8U, 0xd6c81b22U, 0xec213110U, 0x0b48e0ecU,
+  0x1aeed904U, 0x171a0afaU, 0x22f0d3e8U, 0xfed4ff14U, 0x082ffbf8U, 0xd010dce8U, 0xc70ee5eaU, 0xddf4f104U,
+  0x08dd00e9U, 0x0b0a00d1U, 0xf3c20013U, 0x00ee0027U, 0xfd17e9b9U, 0x33e40bfeU, 0x22da2655U, 0x09eff826U,
+  0xf6ddf100U, 0xdc25fb00U, 0xe9d10200U, 0xf3fef800U, 0x00075d2aU, 0x001a25f8U, 0x00182f18U, 0x00b1edf4U,
+  0xf9d02cecU, 0x1a030dceU, 0xced91d3cU, 0xe323e630U, 0xdafc2a3dU, 0xe4d02915U, 0xfef6fe27U, 0x132ee40cU,
+  0x08fbeff8U, 0x2c1ee114U, 0xf7d1ee12U, 0x10f8fc12U, 0x160f5be7U, 0xe10bf5edU, 0x14ba14e1U, 0xe9dbd01aU,
+  0x00e0001fU, 0x23ee00dfU, 0xe2c7002fU, 0xeeeb00ffU, 0x021be9f0U, 0x1bee0e03U, 0x2ec5fd17U, 0xfd06f41cU,
+  0x0f250200U, 0xd71ffc00U, 0x5f0bf600U, 0xe11b1500U, 0x00ec6523U, 0x0005f6f5U, 0x000a40fdU, 0x00ca0003U,
+  0xdb182009U, 0xfcf41ae3U, 0xe418fe1cU, 0xc403e503U, 0xda13ce23U, 0xc5da3808U, 0x0cdb0300U, 0x2b07c912U,
+  0xfbe6e0fcU, 0x1b070022U, 0xfab00400U, 0x11e4fefcU, 0x1bb14ae8U, 0x042bf1ffU, 0x36b51705U, 0xfeb6fa36U,
+  0x0c0b001aU, 0x29e500ebU, 0xf0f2001cU, 0x00d400f6U, 0x3c18ec10U, 0x0e0cfe07U, 0x24bbf903U, 0xe404f413U,
+  0xe62fe400U, 0x0b0cfb00U, 0x18f30000U, 0xfb1bfe00U, 0x00c841e0U, 0x002affdfU, 0x00060fdfU, 0x00ccfd12U,
+  0x0f0cffd6U, 0xf70523e1U, 0xd21d07c7U, 0xe7f9b42dU, 0xd715d435U, 0xe0fc230cU, 0x0de9eff6U, 0x3134dc05U,
+  0xdb240311U, 0x06f5ec02U, 0x00c31af9U, 0xfeda19f7U, 0x0dcb2a2eU, 0x0a2805fcU, 0x19c3cf0eU, 0x23b30429U,
+  0x30f100deU, 0x0dfd00f8U, 0xc91e00e1U, 0x231c0012U, 0x1d0805d7U, 0xff2108deU, 0x2ceaebe8U, 0x23d4f512U,
+  0x1923fa00U, 0xeb27f000U, 0x0230f500U, 0xf7e22800U, 0x0008f1f2U, 0x001370daU, 0x000916b3U, 0x0015fbfeU,
+  0xf91822d4U, 0x0befd6faU, 0x08e5d240U, 0xe615e71cU, 0xdd164b03U, 0xdfe2f9e1U, 0xbb00e0edU, 0xe540c501U,
+  0x06d109deU, 0x1860c32bU, 0xf4de2bd7U, 0x01cd280bU, 0x22390439U, 0xd4e0fb0aU, 0xfc144924U, 0x061bfc18U,
+  0x4bcc00e0U, 0x0a2300dcU, 0xeded001bU, 0xf915002fU, 0x0bffc1bfU, 0xe5fd2ef6U, 0x40db283dU, 0x2dc80028U,
+  0x31f50500U, 0xdc1fee00U, 0xe5212b00U, 0xfbfb1300U, 0x001d3d0eU, 0x000d24f9U, 0x002b250bU, 0x00000221U,
+  0x30fa3bdaU, 0x2501e3d7U, 0x17efe626U, 0x021fca2fU, 0xe2fc5d06U, 0x16ac25d0U, 0xb620f5e0U, 0x0a34c102U,
+  0x3be4d129U, 0x1f3ef244U, 0x2907f00dU, 0x00c0dde3U, 0x252aeec5U, 0xd0ddf8ddU, 0xe0f8fc02U, 0xfaed0316U,
+  0xf6e2003bU, 0xf80300d9U, 0x2ec7001eU, 0xe7e8003aU, 0xe9efd1a8U, 0xf8132cd6U, 0x1cf51039U, 0x16fcf409U,
+  0x27a41700U, 0xdb34f300U, 0xe9042b00U, 0xf4fb0b00U, 0x0010023fU, 0x00ef05d9U, 0x00f73c4dU, 0x00f21e06U,
+  0xc9ff4f25U, 0x0ffe01b9U, 0xe4ff013bU, 0x1f0cde34U, 0x08152d25U, 0xf7cc13e6U, 0x02f100e9U, 0x1a29d506U,
+  0x4125db0eU, 0x3215dd31U, 0x1415c811U, 0x11dddbd3U, 0x02e939f2U, 0xf9f434e5U, 0xf2b8f1c9U, 0xf2eed839U,
+  0xdeb20035U, 0x2005000bU, 0x3dc70029U, 0xbff00004U, 0x001de01dU, 0x001e2fc6U, 0x25f0fee8U, 0xf218f6f4U,
+  0x29d85600U, 0xce0eed00U, 0x1e22fb00U, 0xdd202300U, 0x00140143U, 0x00eaf9e7U, 0x00e1361bU, 0x00f50f01U,
+  0xfa17300fU, 0xd9f608a6U, 0xe2190005U, 0x2407f404U, 0xf632d224U, 0x03e206e6U, 0x27d3dffaU, 0x1917d424U,
+  0xf9fcf7f6U, 0x320ef235U, 0x0ecdfddeU, 0xf1cae40dU, 0xddb052daU, 0x05f937c8U, 0x23a9f5d5U, 0xf0d3df53U,
+  0xc7110010U, 0x34e800ccU, 0x44f9001aU, 0xc8c300eaU, 0x320cd927U, 0xfd1e24f1U, 0x7fb3faeeU, 0xc507f514U,
+  0x4418ee00U, 0xfe0df000U, 0x153eda00U, 0xff3e2600U, 0x00f71900U, 0x001d0ee2U, 0x00e819f1U, 0x00defa44U,
+  0xf30f0500U, 0xdc0bfeafU, 0xbd0312b3U, 0xffe6bb29U, 0x1a27f01dU, 0x0df4fafaU, 0x0ad50002U, 0x3c44d606U,
+  0xe8ca0a0dU, 0x26e90b56U, 0xdd8d14dbU, 0xf8c813eeU, 0xedd33105U, 0x00ecfef6U, 0x30e4fee1U, 0x0eaaea32U,
+  0x1eca00ddU, 0xe2ef00f2U, 0xf00700ffU, 0x042000f1U, 0x23ee14c3U, 0xb82cdfb1U, 0x4624d5c5U, 0x2fcf030dU,
+  0x1739f300U, 0xed01f000U, 0xd2390000U, 0x00041c00U, 0x001cd8eaU, 0x00f2210cU, 0x00fa1ae5U, 0x000dfffdU,
+  0xee160f07U, 0x102edff0U, 0x0412e943U, 0xc807df0aU, 0xd0e82a2dU, 0xffeff70aU, 0xd8edc732U, 0xec45fdf2U,
+  0xfc06faf2U, 0x1069bd02U, 0xd90132e7U, 0x08b1170cU, 0xe028142fU, 0x0b9001ffU, 0xf4e8602dU, 0xe518ed18U,
+  0x3cdb00dfU, 0xbdf200e8U, 0xe9e50034U, 0xf30b000fU, 0x1a02ffb6U, 0xc6320995U, 0x12e603f9U, 0x32e0fe2dU,
+  0x10170c00U, 0xeff8df00U, 0xbc0f2700U, 0x05101d00U, 0x00220df9U, 0x00e41900U, 0x00fefd2dU, 0x00fc1a10U,
+  0x34edeef9U, 0xfc31e7d5U, 0xf826d721U, 0xfd0eeb04U, 0x10dd7104U, 0x16e309e4U, 0xf725b808U, 0x080eca0cU,
+  0x2ffebd30U, 0x2f67b14bU, 0x1d2ded17U, 0x08d5f0cdU, 0xbb35f6d3U, 0x23b800f1U, 0xe7da10f7U, 0x181ff013U,
+  0x0afa0035U, 0xd2eb00e9U, 0x1ec90011U, 0x070b00e8U, 0xbdfadedfU, 0xfe4e2ec0U, 0x0c09f6f0U, 0x1ff3db21U,
+  0x0da84700U, 0xd20d0000U, 0xf60a2800U, 0xd6432400U, 0x0012f615U, 0x00ddfdd8U, 0x00d7eb28U, 0x00e7382dU,
+  0x10120d4cU, 0xba2a15c1U, 0xf81eed1bU, 0x1100eef7U, 0x05054608U, 0xf406e0f6U, 0x15fecfe4U, 0x4705e000U,
+  0x2f18b514U, 0x3b41b159U, 0x1214d9f7U, 0xfcc9dedaU, 0xcbf709e8U, 0x019d07faU, 0xefcb10e6U, 0x1afdfc32U,
+  0xfb0e002dU, 0x08000019U, 0x31fa0010U, 0xdfcf00adU, 0xab14df20U, 0x142858deU, 0x1e20f8eaU, 0x1611df03U,
+  0x24f23d00U, 0xd1fbda00U, 0xf80ff300U, 0xd2412200U, 0x00fccb40U, 0x00f8d8c3U, 0x00ccff17U, 0x00e8fd27U,
+  0xe2f40504U, 0xab1d06b8U, 0x1afaedffU, 0xfdf8dfe1U, 0x031f2e06U, 0xf530cd03U, 0xe6eadef8U, 0x3316f00dU,
+  0x00f6f004U, 0x2039e46cU, 0xf7e1f1e9U, 0xe8b6f209U, 0xdafd20f9U, 0x0db71a16U, 0x13caf3eeU, 0x0cdef34dU,
+  0xe41d001bU, 0x64f60008U, 0x0e04001cU, 0xc9ca00caU, 0x1bceeb20U, 0x27022fffU, 0x5bed00e3U, 0xd9f8f20fU,
+  0x3930dc00U, 0xdde9ca00U, 0xfd16c500U, 0xca5f3600U, 0x0009f837U, 0x00f1d7c0U, 0x00cf0f03U, 0x00ccf16eU,
+  0xdbee00d8U, 0xbb0afaafU, 0xc9ce0200U, 0xdde2b7d5U, 0x30101deeU, 0x0310fb06U, 0xeecee1fcU, 0x6d37d1fbU,
+  0x12be31f1U, 0x1dd7fe57U, 0xe9e704deU, 0x009504e0U, 0x1fdafb03U, 0x14f5fe23U, 0x1fd9090bU, 0x3181f028U,
+  0x1be300edU, 0x1bdd00eeU, 0x210300b0U, 0xe93100e6U, 0xf2f5ec11U, 0x87eaece2U, 0x0741c9e7U, 0x2ae50e05U,
+  0x05f0e600U, 0xf2ddf400U, 0xfd111100U, 0x04f7f900U, 0x0028f5cfU, 0x00f6e8deU, 0x0028290aU, 0x00f110f8U,
+  0x0f07ed09U, 0xe6f6c005U, 0x1b091806U, 0xf5fef8f4U, 0xf7e21e2dU, 0xddf6d3e3U, 0xeb0ee11eU, 0x1a1becf8U,
+  0x0f04f824U, 0x102bb3eeU, 0xfa2d2b0aU, 0xfad717eaU, 0xc6f2f50eU, 0x36b508e9U, 0xcfd539f2U, 0xe225f819U,
+  0x3fe400ebU, 0xf3d000e5U, 0x07ff0036U, 0xfd1300dbU, 0x01cfd418U, 0xb0d121e1U, 0xe736eaeaU, 0x2510fe0dU,
+  0x29f2f700U, 0xd7d6fb00U, 0xbb013c00U, 0xed0cf200U, 0x00fc2ee1U, 0x00f1cedcU, 0x00ebfa09U, 0x00c7352dU,
+  0xfc02e212U, 0xa308e801U, 0x2518fd31U, 0xe8dd0ce6U, 0x36f46c13U, 0xc937f3d6U, 0xfaf1d311U, 0x48fcc6f5U,
+  0x3528dc0bU, 0x1413a1eeU, 0x0f3e3105U, 0xd8d807cfU, 0xa327e537U, 0x54a3f201U, 0xffd02105U, 0xd025ff2cU,
+  0x1dfc00f7U, 0x01d300c3U, 0x03f3003dU, 0xf0d900b8U, 0xc2cbc145U, 0xccf837f0U, 0xe511ede1U, 0xfefeeafdU,
+  0x26fe4200U, 0xc2dcfa00U, 0xe4332f00U, 0xba191b00U, 0x00f21034U, 0x00fbe6ceU, 0x00f2dfeeU, 0x00af1f29U,
+  0xd1e5eb49U, 0x940ff6deU, 0x252aeaf7U, 0xd9dc04d5U, 0x4f03361aU, 0xbe7fe1e8U, 0xf11bd9f8U, 0x4f02c9e2U,
+  0x2f01ace4U, 0x1520c319U, 0xfe1515feU, 0xe4cdfbceU, 0x9fffe71bU, 0x4dabf41eU, 0xffc8fa1dU, 0xf4e6f445U,
+  0xe7100021U, 0x52e000d3U, 0x0eef0008U, 0xbdc600a2U, 0x8400c723U, 0xebfd4204U, 0xea2a01e9U, 0xe305e406U,
+  0x450c5600U, 0xd9ddd700U, 0xce240500U, 0xa84b5100U, 0x00e94f44U, 0x00dee8caU, 0x00dc07faU, 0x00d23647U,
+  0xaaecf241U, 0xa40ef5ebU, 0x070ddef2U, 0xa8befdc9U, 0x4f172ef5U, 0xe3430004U, 0xd8e6efedU, 0x6827f3ffU,
+  0x04e2c9eaU, 0x29faee40U, 0xe8f5eadfU, 0xf4d5b9eeU, 0xf021f2f6U, 0x48b4ed31U, 0xebdc0024U, 0x2599fd2cU,
+  0xf81f0015U, 0x52ec00ecU, 0xf4fc0005U, 0xc1fd00d7U, 0xefe2def9U, 0x01f90afeU, 0xe6f2faeeU, 0xbff902fcU,
+  0x0028f800U, 0xeacedc00U, 0xf802dc00U, 0xe7646c00U, 0x00ea0935U, 0x00cecce9U, 0x00ef02f6U, 0x00d20b32U,
+  0xbccefffaU, 0xc9d7f0cdU, 0xcfd9fe06U, 0x94a0ecdcU, 0x20071405U, 0xf30403f0U, 0xe9dbf500U, 0x7b2ee4f9U,
+  0x09bcf2e8U, 0x1ecaee12U, 0xeb0be8faU, 0xf1c3d6eeU, 0x2debf2f8U, 0x29dcf821U, 0xe0ddff08U, 0x26aff608U,
+  0xfeed000aU, 0xff0300f3U, 0xfbf300fcU, 0x15110008U, 0x01e20adeU, 0xeef7f7f6U, 0xf7e50ad7U, 0xfe0702f7U,
+  0x1cd30c00U, 0xfceef300U, 0x05d9e900U, 0x061e0c00U, 0x00f3e826U, 0x00f6c3e5U, 0x0005090eU, 0x000dff00U,
+  0x01e000f5U, 0x05e3eaebU, 0xf3fad303U, 0x02eff917U, 0x07ff3efdU, 0xf815e308U, 0xf8ef2719U, 0x01fc0d1aU,
+  0x34e5d710U, 0xf6fe1307U, 0x4013d305U, 0x1717f8f1U, 0x182af4f2U, 0xf7ecfef8U, 0x062cf0f1U, 0x0508f8f1U,
+  0xf5fd0029U, 0xfbfb0021U, 0xfe0e0016U, 0x0d2300faU, 0xe2eb07bbU, 0xdc2afc01U, 0xee211eaeU, 0xeafb0afbU,
+  0x28b10100U, 0xe7f3d700U, 0x03e2da00U, 0x10231200U, 0x0015c825U, 0x0007c2d7U, 0x0004000fU, 0x001614f8U,
+  0xf8ce24e7U, 0x05f015e6U, 0x2afdfeceU, 0x07f70d04U, 0xfd050ddcU, 0xc72dffe8U, 0x06d8230dU, 0xebf40af9U,
+  0x3d15cf03U, 0x04ca232eU, 0x3735c9fdU, 0x0fff02edU, 0x29f9fddaU, 0xf9cf1505U, 0xf359f2ecU, 0xfa070bf3U,
+  0xeedb002fU, 0x0dee0025U, 0x0a110014U, 0x222100feU, 0xe6ddf6d3U, 0xe21f1113U, 0xdb2f27d1U, 0xf0ee0ff3U,
+  0x22bcf300U, 0xd600e200U, 0x14cbd600U, 0x180f0100U, 0x00e3ca32U, 0x001ccbccU, 0x00dafa22U, 0x00041704U,
+  0xb6ce2f06U, 0x073e1703U, 0x590820fdU, 0xf9130202U, 0xf43e03d0U, 0xbd30d7dbU, 0xf5e14e00U, 0xf917fbf9U,
+  0x422ab504U, 0x1fab2528U, 0x2a39daf9U, 0xf8eb0ed8U, 0xf8e302d7U, 0xee90ddf7U, 0xf15e03f1U, 0xee17f40dU,
+  0xda9f0053U, 0x211200f3U, 0x1b040015U, 0x0f0400fcU, 0xc2c8f3daU, 0x07ef110aU, 0xe9fc20f8U, 0xf4f111f6U,
+  0x11bbf300U, 0xd905ef00U, 0x07fafa00U, 0x06020100U, 0x00fccf49U, 0x001e0ae7U, 0x00c10d13U, 0x000d18f9U,
+  0xdcd8de07U, 0xfb50f3ecU, 0x390803f5U, 0xf90bfffcU, 0x092b19f1U, 0xc91bf8eeU, 0xfbf01a24U, 0xf60d00fcU,
+  0x2742d5edU, 0x218e2416U, 0xfa25bec7U, 0xfee516eaU, 0xf5ffeceaU, 0x0dc9fbdaU, 0xf82a09cfU, 0xf426df0eU,
+  0xe2a00049U, 0x570200b9U, 0x20f600e7U, 0x101100eaU, 0xd7ecf4f1U, 0x1ce10d05U, 0xf90d0916U, 0xf0ed00eeU,
+  0x20071400U, 0xe8e7ee00U, 0x25d6f900U, 0xfcec1700U, 0x00eff544U, 0x001f18beU, 0x00e1f13fU, 0x002c0212U,
+  0xffe3ea38U, 0xf74dd20aU, 0x12161603U, 0x0409eef2U, 0x10230502U, 0xe809f904U, 0xf0ed1e15U, 0x14120304U,
+  0x122dd6eeU, 0x08a01a13U, 0xee4ab0cfU, 0x18fb0a09U, 0xe1c6fef5U, 0x11e6f5fdU, 0xf208f3e1U, 0xec0ee803U,
+  0xdf310012U, 0xddff00efU, 0xd71400ebU, 0xfd25000aU, 0xc3e802dfU, 0xf00500faU, 0xeae9f7cfU, 0xf9120c02U,
+  0x25e61f00U, 0xf60ff400U, 0x1ddc0b00U, 0x0e181200U, 0x00ceab1aU, 0x000eb8f5U, 0x0006f303U, 0x001a1ffeU,
+  0x0fc0e0d2U, 0xf2e1f7deU, 0x0707e600U, 0x1ae20bf8U, 0xec216cefU, 0xeb21f2fdU, 0xf4012af1U, 0xf506fae5U,
+  0x790ae333U, 0x06de0504U, 0x29f10ff7U, 0x22ff05e7U, 0x1d64ddf6U, 0x04d5f703U, 0xf2430120U, 0xf316e7f8U,
+  0xe1430005U, 0xecff000fU, 0xddee00f9U, 0x0933000fU, 0xebc2f0aeU, 0xe4f818feU, 0xfd12fbddU, 0xeef61cddU,
+  0x19030a00U, 0xc0f5e600U, 0x09e0e200U, 0x171c0300U, 0x00e1b7ecU, 0x0003d0dfU, 0x00f3f519U, 0x000e06fcU,
+  0x15ebefddU, 0xd61904d0U, 0x2401ebe1U, 0x02e012e4U, 0xeb30ffceU, 0xbf3201f2U, 0x10e623e5U, 0xeeee16dfU,
+  0x660f0113U, 0x03ce0322U, 0x1803fcf4U, 0x200002deU, 0xdd13e9faU, 0x1cd8f10bU, 0xc94ffc26U, 0x0327f20fU,
+  0xf4f40031U, 0x2b0a000aU, 0xf7f700e7U, 0x10030022U, 0x2dbcf19aU, 0xf415260bU, 0x032113dcU, 0xf6d13befU,
+  0x11e50300U, 0xd2dcea00U, 0xf4d3f300U, 0x1ef6ec00U, 0x00e585f2U, 0x0020d8dfU, 0x00fed002U, 0x0000f30cU,
+  0x3b0dcdfdU, 0xf83511dfU, 0x2eecf40eU, 0x07f3f7f1U, 0x0c59edc7U, 0xa634d6ddU, 0x0cc943f5U, 0xfe151ef6U,
+  0x3ef604f4U, 0xffc31124U, 0xee0ff1ecU, 0xf4ffe8ceU, 0x0027e80aU, 0x4cc90b0fU, 0xd554eb12U, 0xf42aececU,
+  0xe6fd0040U, 0x1a140022U, 0x070b0005U, 0x00eb000aU, 0x09c8eafdU, 0x2a1020f0U, 0xf0070fcdU, 0xfeec1fdaU,
+  0x13b7f100U, 0xd308d000U, 0xf9f52300U, 0x1102f400U, 0x00d1a3f3U, 0x0024fdc2U, 0x00f7030bU, 0x00ed0a05U,
+  0x330dddfcU, 0xe63f060eU, 0x04f0002aU, 0x1e05fae1U, 0xfd0304f8U, 0x9431d1deU, 0xffd90925U, 0xfb1e0901U,
+  0x22d705dfU, 0x0bba0125U, 0xce20c5eeU, 0xf7f41dd9U, 0xd930e9e7U, 0x21c9251eU, 0xe00325cbU, 0xfe21dff7U,
+  0xeee6002aU, 0x14380014U, 0x09f800f8U, 0x00fe00e2U, 0xd7eecb03U, 0x3ed70906U, 0xfd17f3ebU, 0xfeea02d5U,
+  0x37e73400U, 0xe2f0d900U, 0xfcf52f00U, 0x06ff1000U, 0x00f1f90eU, 0x004d1dd7U, 0x00e01d1fU, 0x000c0512U,
+  0x42feb231U, 0xb75a02f6U, 0x2205111aU, 0x1416f6aaU, 0xed12062dU, 0xed0ff9faU, 0x08ca0826U, 0x12110609U,
+  0x05f20ed6U, 0x129c081aU, 0xdd49e0c6U, 0x23053203U, 0xb3e4dafbU, 0x37c82310U, 0xd51527beU, 0xff19de0bU,
+  0x9f3800fcU, 0xd4010006U, 0xf00700e8U, 0x11e700e5U, 0xffd7f5e8U, 0xccf0fa37U, 0x0ff7f3edU, 0x13051028U,
+  0x0af63b00U, 0xfdc1ef00U, 0x24f0fb00U, 0x11d20a00U, 0x0004bafdU, 0x00e6bcf0U, 0x00fbe9eaU, 0x002b12feU,
+  0x1debd2e5U, 0xc5fcf0d6U, 0xf30d170bU, 0x1fe2f9e1U, 0xef2928cbU, 0xe30c19efU, 0xfffc2cfaU, 0xf6001fe3U,
+  0x7b07044cU, 0x16a8ef12U, 0x0dcb12d6U, 0x050c020cU, 0xff6eca1bU, 0x24ef0f00U, 0x064f0825U, 0x0907d6f2U,
+  0xab2a00faU, 0xf3fe00feU, 0xedf200d5U, 0x121d00f8U, 0x2adf31b6U, 0xf6001923U, 0x1511f8e6U, 0xff0229faU,
+  0x1d2d0500U, 0xd6d7db00U, 0x07f2d100U, 0x01b3f800U, 0x000ed716U, 0x0005d6f7U, 0x00f2def9U, 0x002ae007U,
+  0x4016cfe1U, 0x9c23f3b4U, 0x06fb30e4U, 0xfddf17ddU, 0xfa0e0eb9U, 0xcf2b0000U, 0xecf140feU, 0xd4f921e3U,
+  0x5f070b60U, 0x1096f11aU, 0x0d05fff0U, 0x0800fef9U, 0xcd51ab29U, 0xfef008ffU, 0xed3af301U, 0x0e1eda00U,
+  0xc0ff00d2U, 0x2fd30017U, 0xfff100caU, 0xf31d0021U, 0x56ce1fc0U, 0x130df62bU, 0x041f04d3U, 0xfd062de7U,
+  0x354c0f00U, 0xc8c1fa00U, 0x0dffdb00U, 0x13cce700U, 0x00eeeff6U, 0x0039de00U, 0x0005e300U, 0x00149e32U,
+  0x4b2cb80bU, 0xa0052ae4U, 0x1af31afbU, 0x24e404dbU, 0xfc1b1cbdU, 0xdd330905U, 0xf1db3408U, 0xcd0436deU,
+  0x1bf61c2eU, 0x269ad840U, 0xee150bf4U, 0xf70920e8U, 0xfd68ad16U, 0x0dc92202U, 0x0240e6efU, 0x1d32dd10U,
+  0xcc1300ebU, 0xffef004fU, 0xf4ef000aU, 0xfc1000ebU, 0x20fdcc13U, 0xfde01721U, 0xecdd08c9U, 0xe1feffdeU,
+  0x45240f00U, 0x00c0eb00U, 0x1ff60200U, 0x1ae6f500U, 0x00d3ffe5U, 0x0043e90aU, 0x00e90a1bU, 0x00ffe409U,
+  0x170baf02U, 0xaf09592dU, 0x0af0ee23U, 0x2feff6ecU, 0x32fdec2bU, 0xe1232cf0U, 0x16c92b0eU, 0xe70b14e9U,
+  0xf3e237ecU, 0x24f2d618U, 0xd132f5d7U, 0x02063cdbU, 0xc240ed17U, 0x16b33a0dU, 0xf72306dbU, 0x0732eef2U,
+  0x096400e3U, 0xf8090039U, 0x1125000cU, 0xef0a00e9U, 0xc313df0cU, 0x2dabec2eU, 0xf1f7e2e8U, 0xfe1007d4U,
+  0x20ec0e00U, 0x2ce1f600U, 0x2dfa0400U, 0x1800fa00U, 0x000912d2U, 0x002d0f3fU, 0x000a1642U, 0x0018050dU,
+  0x431eaedbU, 0xa5027f30U, 0x0ed93d05U, 0x2e1508e7U, 0x4411e906U, 0x05ff20ffU, 0x01c23214U, 0xee101ef9U,
+  0xeacb60f8U, 0xfaf2c504U, 0xd63aefc8U, 0x060a3fffU, 0x92ffff14U, 0x51ab25ddU, 0xe4212faeU, 0x0b0ae5fdU,
+  0x92340018U, 0xf8f00017U, 0xe0050004U, 0x03f100e7U, 0x1eae1e12U, 0xc00b1111U, 0x22ef061bU, 0x0ad1341cU,
+  0x28f23b00U, 0xfdd4f100U, 0x1f030d00U, 0x25d6ff00U, 0x001581f0U, 0x00e3e509U, 0x00f4c3d2U, 0x000cfb0eU,
+  0x10200dfeU, 0xbd07e6e2U, 0xeff7f112U, 0x0af4d1e2U, 0xfa2e39d8U, 0xe625f010U, 0xe7153b17U, 0xfef442e4U,
+  0x39232445U, 0x2390e2faU, 0xfcb4fff1U, 0x16f8e30cU, 0x0c56d72cU, 0x0ae82301U, 0x096c0513U, 0x0541bbeeU,
+  0x981f0023U, 0xeaf70001U, 0xdff400eaU, 0x0bda00f9U, 0x36dc260eU, 0xc70d0f29U, 0x13f0e20cU, 0x01041e20U,
+  0x18fc0c00U, 0xe2f6e800U, 0x1f05f600U, 0x13b7fb00U, 0x0009b208U, 0x00ded413U, 0x00e4d1d8U, 0x00f7b218U,
+  0x253308d4U, 0xd6fefee1U, 0x01e10c18U, 0x0de8f1e0U, 0x191c2badU, 0xfe1fea47U, 0xd0fb3721U, 0xee0a59e2U,
+  0x2b462446U, 0x0fb4e021U, 0xf8dcd5f1U, 0x0f08d30dU, 0xc93cb112U, 0xef033406U, 0xd2410202U, 0x1120cbe4U,
+  0x9c1c00f4U, 0x00d8002fU, 0xf7da00faU, 0xd9050028U, 0x24ff1713U, 0xd5f1f822U, 0x00f500f7U, 0xfbe2f214U,
+  0x3ce9e300U, 0xb6001300U, 0x230bf000U, 0x0cc3eb00U, 0x0016c9e0U, 0x00dce423U, 0x00fef510U, 0x00f3810cU,
+  0x0c3fe8cbU, 0xd6fa352aU, 0x17080e31U, 0x02d803f2U, 0x1c0d1cdcU, 0xfe33d125U, 0xb9e32826U, 0xd61a2dc5U,
+  0xe3104939U, 0x31ebdc36U, 0xd708ffeeU, 0x1716ede9U, 0xe859bb09U, 0xeade5006U, 0xd71f07f1U, 0x1226d1fdU,
+  0xed2000b6U, 0x11040040U, 0x0eda0012U, 0x07260006U, 0x2012140fU, 0xe5d50e47U, 0xe0db23f1U, 0xd3e2e2e8U,
+  0x5dd6d200U, 0xd2f02400U, 0x28041700U, 0x33d0f800U, 0x0017d902U, 0x0006d607U, 0x000aee2bU, 0x0018d01bU,
+  0xfe09f3eaU, 0xee1f341aU, 0x11ed1a3aU, 0x02c90208U, 0x231016f3U, 0xf5130813U, 0xccca1a0eU, 0xf2e530ddU,
+  0xddf45cedU, 0xfd11d7dcU, 0xd9290fcdU, 0xfa1723dbU, 0xf026fbfaU, 0xe3ef25ccU, 0xe90d1eb4U, 0xfe2fefefU,
+  0x093000daU, 0x02e10032U, 0x0cfd0022U, 0x051000f2U, 0xef0bed0bU, 0xf5f9103dU, 0x011ffd01U, 0xf7f7fbe9U,
+  0x2a0fff00U, 0x2bf23300U, 0x1cfe0f00U, 0x35fc0900U, 0x0031feebU, 0x00f0040bU, 0x00302343U, 0x002f24ffU,
+  0x251fd9eaU, 0xfcfa5211U, 0x1dca4144U, 0x1d0d0c0aU, 0x200b07e6U, 0x00103e22U, 0xd3d42901U, 0xfbf43ce0U,
+  0x05bc3b1fU, 0xe62abed1U, 0xd94eefc6U, 0x071e3114U, 0xc8f300f9U, 0x04f22dcdU, 0xe63e24b2U, 0xe8fef0dfU,
+  0xb3310007U, 0xf4f80023U, 0xbe0a0029U, 0xf007002bU, 0x41d05e11U, 0xda15df1dU, 0x3be81813U, 0x14db14f8U,
+  0x20c20900U, 0xf31f0700U, 0x10191500U, 0x0fd80400U, 0x001c953aU, 0x00f9e8eeU, 0x0017cbf0U, 0x00eef502U,
+  0xee0f00f6U, 0x00ddfd09U, 0x03f90920U, 0x0ffde907U, 0xe1056dc9U, 0xf325f905U, 0xe21c5212U, 0x04f928edU,
+  0x25e31328U, 0x0ecf0fecU, 0x08cc2105U, 0x17ebf3f5U, 0x097ad81eU, 0x20fc22ecU, 0xf7520928U, 0x0320e80bU,
+  0xad21001fU, 0xe6fe000bU, 0xc4140030U, 0xfd0100ffU, 0x67d01d1cU, 0xbbfee124U, 0x43e7f30aU, 0x23ddfe22U,
+  0x2cdae800U, 0xe81e1800U, 0x393e1f00U, 0x37090400U, 0x00188a09U, 0x00f01b05U, 0x0005cbf4U, 0x00e7cf17U,
+  0xe70e1a0aU, 0xdefd0af4U, 0x0f270336U, 0x0412d7ffU, 0xd01a6cabU, 0xfe1b022aU, 0xf516401dU, 0xf80649d4U,
+  0x1ce80f32U, 0x29e5f803U, 0xf8e8feefU, 0x2afcc403U, 0xd575dd36U, 0x11092cf6U, 0xf67e1e11U, 0xe244dde9U,
+  0x9518001bU, 0x091c002eU, 0xd010004dU, 0x09220019U, 0x5fcc0f21U, 0xe7d50010U, 0x52d4f2d7U, 0x10c7f223U,
+  0x46e9c600U, 0xc3314000U, 0x48422600U, 0x4413f600U, 0x003da312U, 0x00f01ae9U, 0x0020f3f8U, 0x00f3e504U,
+  0xfb0614f5U, 0xf5231538U, 0x40430b4aU, 0xfb00f408U, 0x11f737acU, 0x122f0a1dU, 0xf91c202bU, 0xdcfa3dd0U,
+  0x1bdf130cU, 0x20ecf2e4U, 0x07ff0eceU, 0x060ed9dcU, 0xba70b60dU, 0x08e71df5U, 0xbe4f09f0U, 0xde2fe8ceU,
+  0xde1a00dbU, 0x1b2b002bU, 0xfb140027U, 0x0924002bU, 0x29f80520U, 0x15eb200aU, 0x26f501d0U, 0x1ce3fce4U,
+  0x66d5b600U, 0xe0423c00U, 0x63153c00U, 0x5017ed00U, 0x0058e630U, 0x001f35c8U, 0x0060fefeU, 0x00241efdU,
+  0x00fb0cefU, 0xfa521248U, 0x5d471b61U, 0xfee1071cU, 0x03f414d4U, 0xd815fd05U, 0xc6ef0f01U, 0xf3f72fd9U,
+  0xf9ec23fdU, 0xdeddf3c1U, 0xf3302cb5U, 0xf51517cdU, 0xdc20dfe3U, 0x041b00eeU, 0xbc5b06a4U, 0xdf38f9d1U,
+  0xed3d00deU, 0x13ea000dU, 0xeffb000fU, 0x01090019U, 0x2dedf912U, 0x1611140fU, 0x3029f4f8U, 0x1f020ff8U,
+  0x37ede500U, 0x0e182200U, 0x10001900U, 0x0cfdf100U, 0x0044f128U, 0x001748c5U, 0x005929faU, 0x00352efaU,
+  0xf90e1703U, 0x623d1b4fU, 0x7f34203aU, 0x07141919U, 0x2af121edU, 0xccf90914U, 0xc6e90908U, 0xe9f217f3U,
+  0x22f4240aU, 0xdd1fdf07U, 0x0c6f3f14U, 0x10fe26feU, 0x242409edU, 0xb31806dcU, 0xbd3f05bcU, 0xeb170be9U,
+  0xf9eb00f1U, 0x15fa00f4U, 0xfe2100e8U, 0x280800f2U, 0x2f27feeaU, 0x1325fc1bU, 0xf9eb0e05U, 0x0afe0308U,
+  0x023aec00U, 0xf724ff00U, 0x00011200U, 0xf407f500U, 0x00d4513dU, 0x001115dcU, 0x0009cdddU, 0x00e600e8U,
+  0x0b2e25c2U, 0x0b0a16feU, 0x0905c70bU, 0x0501f5ddU, 0x06050210U, 0x020106fcU, 0xff411ef5U, 0x08ebdd1aU,
+  0xe8230918U, 0xdbfc20f9U, 0x07e3250bU, 0xe2130fffU, 0x24e5f906U, 0x13ec1207U, 0x2048f2fbU, 0xffcbf8fcU,
+  0x15ec00f6U, 0x02fe00d4U, 0x143100a3U, 0xfbfa0014U, 0x45f2dad9U, 0x220f041fU, 0x00e34213U, 0x02dfefedU,
+  0x01161500U, 0xf113e400U, 0xfef2eb00U, 0xe00b0500U, 0x009e5344U, 0x0030ef1cU, 0x0034c9ddU, 0x0008f506U,
+  0x12222ae4U, 0xfd063af5U, 0xf909f0f2U, 0xdc1803ecU, 0x10f3f309U, 0x10050eeeU, 0xc73033e2U, 0x0916e4f7U,
+  0x0d4de7f8U, 0xe7f0340eU, 0x1da83004U, 0xdee00220U, 0x30df18eeU, 0x58dd03f0U, 0x45640f0eU, 0x1c97f1f6U,
+  0x4c39000fU, 0x040000ceU, 0x423200c2U, 0x00f00032U, 0x31feccbcU, 0x2bfde504U, 0x31dc4e00U, 0x0af0d6faU,
+  0xfe337f00U, 0x17f4c700U, 0x18e6c200U, 0xe9132400U, 0x00a87852U, 0x00480f15U, 0x0030dadaU, 0x002dfc1cU,
+  0x1a0b2ecdU, 0xe6113edbU, 0xe72807fdU, 0xb30bf71bU, 0x04eadf15U, 0x1ef213ffU, 0xbb1533edU, 0x1724f3fbU,
+  0x2756de0eU, 0xf40a4921U, 0x288141f5U, 0x01cd1e24U, 0xe2faf713U, 0x52e2ed1bU, 0x4d58fb24U, 0x2081ef03U,
+  0x3a280002U, 0xe8f700dcU, 0x1c1500faU, 0x0904001eU, 0x37f8dce3U, 0x2ce9ea12U, 0x1ee71ee0U, 0x15ebe017U,
+  0xef534800U, 0x13f4d100U, 0x12d99d00U, 0xc9f63900U, 0x00e02526U, 0x002bee15U, 0x0009eef0U, 0x0033fb1cU,
+  0x210c2dd9U, 0xe51911dcU, 0xef3202e7U, 0x9ff80f08U, 0x160ef4f5U, 0x28ff2705U, 0xb8f83af6U, 0x2e0ef6fdU,
+  0x1c47e73dU, 0xfe1b2c29U, 0x459441fdU, 0xf3f0142bU, 0xd6030103U, 0x2ff70223U, 0x3c45d922U, 0xfbb2f4f1U,
+  0x624b002dU, 0xf0f500d2U, 0x22390003U, 0x02fe00f4U, 0x3a29f9ffU, 0x35fd0106U, 0x259f14d8U, 0xf50100ffU,
+  0x92612e00U, 0x020bf300U, 0x12bebd00U, 0xdb0d3d00U, 0x00d31121U, 0x0009072dU, 0x002ef6f7U, 0x000817faU,
+  0x1efc19c5U, 0xf51f0ce3U, 0xca4efbc2U, 0xdef4e323U, 0xf8e8fe0dU, 0x27ff040aU, 0xf1e60b00U, 0x15fdf404U,
+  0x1b34fd46U, 0x03241d2eU, 0x1fad3c07U, 0x0700111fU, 0xfe0f0f18U, 0x0a00e80dU, 0x0e1ad73bU, 0xf3d325d7U,
+  0x40f100f1U, 0x08e20008U, 0xe74400e5U, 0xfcf30002U, 0x0e10eaebU, 0xfd1e0a08U, 0xf8001a2eU, 0x07f20d13U,
+  0x05a8fb00U, 0xe7150500U, 0x0c171600U, 0xfa21f600U, 0x00122d54U, 0x0001f3f7U, 0x00f4b9e3U, 0x00fbf302U,
+  0x263553c4U, 0x011d1906U, 0x0df5d4ecU, 0xf5fe0cc5U, 0x19cef212U, 0x0d11f2fcU, 0xeb4a23ddU, 0xf9f3efecU,
+  0x0b3b0011U, 0xd401f717U, 0x10d52005U, 0xf4efe60dU, 0x19b9f9f4U, 0x32e004efU, 0x2869e60fU, 0x0ad6eee5U,
+  0x442100d1U, 0x14f300f8U, 0xf02d00ceU, 0x09ee001eU, 0xf30fc9efU, 0x040a0c0fU, 0x06f8fc0eU, 0x0deb1bdcU,
+  0xf1bd0300U, 0xfedafd00U, 0xf8e2e800U, 0xf8130e00U, 0x00023f28U, 0x000ee509U, 0x000fcdffU, 0x0002ec0aU,
+  0x121420b6U, 0x0900fee8U, 0xfcf4edd9U, 0xbe0f10bdU, 0x0ad9e327U, 0x1e180cf8U, 0xd93724c2U, 0xf129dffcU,
+  0xf82405d9U, 0xd0e6230bU, 0x0fce2df1U, 0xfefbef24U, 0xfd2915f1U, 0x7fe2f0f8U, 0x2d3bdf23U, 0x44c6bcfcU,
+  0x213e00d6U, 0x23f700f1U, 0x211100ecU, 0xf6d70032U, 0xdd151bdbU, 0xfde60102U, 0x18e2f4fbU, 0x11f9ebd0U,
+  0xedad1b00U, 0x25f3e000U, 0x17c9b500U, 0x11fe3400U, 0x00f81412U, 0x00ebfe08U, 0x002fd404U, 0x000c1f1dU,
+  0x3c3ec8a2U, 0xe4ebf8d5U, 0xf9f41acdU, 0xc50d15d4U, 0x9202fa1dU, 0x16041b08U, 0xe5fc2de4U, 0x132ae902U,
+  0xfc070feaU, 0x041306feU, 0x1fe321f2U, 0x1903fd35U, 0xd24cfcedU, 0x2ceeeefbU, 0x1e00f00dU, 0x28a0d9ffU,
+  0x232100caU, 0x00f80005U, 0x2f27000aU, 0xf507001fU, 0xfc3b36f7U, 0xffd71b02U, 0xefc9fec8U, 0x1cf7e1efU,
+  0xe2ecf900U, 0x4200f800U, 0x28b8c400U, 0xeaf33f00U, 0x0015eed8U, 0x0001f60cU, 0x0019cd1aU, 0x00101819U,
+  0x6631bcc9U, 0xe0edfde4U, 0xfa15f5d8U, 0xe60a0fd9U, 0x9f03fdddU, 0x0a1d280eU, 0xe6f732fbU, 0x112ab8f6U,
+  0x19f505daU, 0x1f15d816U, 0x30f828dfU, 0x1b301029U, 0x0d460009U, 0x221fe4f2U, 0x07f7e2f7U, 0xe2abe2f3U,
+  0x12400016U, 0xe6d700f2U, 0xfa2b00e3U, 0x07210007U, 0x094f29deU, 0x380015f9U, 0x54ab1ffdU, 0x0c0de5f6U,
+  0xe12fe600U, 0x021b0500U, 0x1bf0dd00U, 0xbfe31400U, 0x00ec16d6U, 0x00fb0bfdU, 0x003c0a36U, 0x0030fdeaU,
+  0x0026bb06U, 0x0d13f1caU, 0xd32e25caU, 0xe9fb0a06U, 0xafe10eeeU, 0x1ffff519U, 0xf7f31df4U, 0x060db3eeU,
+  0xf9f7fe0eU, 0x111bf713U, 0x1bd50d03U, 0x110f2030U, 0x0c79f91dU, 0x16f7f5ebU, 0x46fdeb00U, 0xe4b2faf4U,
+  0x6fd900f9U, 0xf70700fcU, 0xd42e00e7U, 0x16fa000aU, 0xf112351bU, 0xe0121509U, 0xeb05171dU, 0x06fa0100U,
+  0x239cf300U, 0xec240400U, 0xf3de0700U, 0x0adbee00U, 0x0013d133U, 0x00e2ce1dU, 0x00fcc904U, 0x000f1125U,
+  0x190437d4U, 0x09f9eaddU, 0x2606fdd7U, 0xd7045cd3U, 0x39c34ffcU, 0x152810f3U, 0xd53d0dbcU, 0xfbe4f318U,
+  0x1618cc17U, 0xfc18f41fU, 0x06d73519U, 0xf9f5ccfaU, 0xfb2aa1cbU, 0x37efd0e0U, 0x293df514U, 0xdfd0faf7U,
+  0x04ed00d7U, 0x19050006U, 0xf3fe00e5U, 0xf7030021U, 0xf20d3640U, 0xf003082cU, 0x031409f3U, 0x060cf6f0U,
+  0xe6ade000U, 0xfdfefc00U, 0xe9d4f100U, 0xfde21200U, 0x003fb913U, 0x00d2cc10U, 0x0010c537U, 0x001c200bU,
+  0xeec136acU, 0xf0dfd5e4U, 0x081406d0U, 0xc0fe52b9U, 0x22c651d0U, 0x0c1227fcU, 0xd75218c4U, 0x0aebdc3bU,
+  0x1c020a15U, 0xf7e728f5U, 0x03f63b00U, 0x240ee50bU, 0x4e0ba116U, 0x4a01ecf5U, 0x2d00f40eU, 0x1cda16f0U,
+  0x980d001aU, 0x0b040006U, 0x29fc00eaU, 0x180c0030U, 0xf509283bU, 0xeedc1903U, 0xfde8e118U, 0x0ff9e224U,
+  0xffc5d400U, 0x0bef0000U, 0x15c0f000U, 0x05f13400U, 0x0030a315U, 0x00fae80cU, 0x000fd90aU, 0x002445ddU,
+  0xfbec13ceU, 0xdbe1d3f3U, 0x07051bd7U, 0xfa1109e5U, 0xe5fa32dfU, 0x060dfbfcU, 0xf7fffdf3U, 0x0e0dd425U,
+  0xfef10a00U, 0x0ae413cbU, 0x09f538eaU, 0x0e01e20fU, 0x6924d10eU, 0x0b21ff1bU, 0x1505fc21U, 0x0fda0309U,
+  0xa70d0029U, 0xf6020006U, 0x081b0015U, 0xce250016U, 0xfd0e2027U, 0x01ef1ce8U, 0xeadc0bedU, 0x141ef912U,
+  0xfdb7f200U, 0x051a2300U, 0x0dbaf900U, 0xd70d2100U, 0x0037e80dU, 0x00f504e6U, 0x00fcef0aU, 0x001f04ddU,
+  0xdad01a17U, 0xf9f1e7e6U, 0xf70d0605U, 0xf22900ebU, 0xdad045e1U, 0xf11bf504U, 0xd9f0ff0eU, 0xf51db21cU,
+  0xef050ae8U, 0x26f5d0f2U, 0x0b0fd4e0U, 0x1211eefbU, 0x4c201f07U, 0xf30ff318U, 0x130ce3fdU, 0xeae01108U,
+  0xe9fa001bU, 0x0eda0015U, 0x02020027U, 0xec380016U, 0x2724390aU, 0x14ef06e6U, 0x30d82ee3U, 0xfe16ef22U,
+  0x1ad30800U, 0xd0132800U, 0xe1d3f500U, 0xd413e700U, 0x000b37e8U, 0x00ef01c5U, 0x00e50a08U, 0x00390bd4U,
+  0x02d9ef43U, 0x0e11fbe5U, 0x0b1a2b06U, 0xde320805U, 0xc6de61ccU, 0xe609e30aU, 0xd6d92ef9U, 0xe71cebf0U,
+  0xf1eff4f2U, 0x1103daf6U, 0x0918cefdU, 0x04edfb40U, 0x29633b1cU, 0xedcafdf8U, 0xfce9ee05U, 0x21d51b09U,
+  0x18e900f4U, 0x000400f7U, 0xf30c00f7U, 0x1bc80000U, 0x209f2b09U, 0xe71b1510U, 0x10004213U, 0xdd01fd1bU,
+  0x2edcf300U, 0x08190200U, 0xe6100900U, 0x2bb0e200U, 0x00e9b3deU, 0x00d1defbU, 0x00ddcb18U, 0x000afb00U,
+  0x14f1f0e6U, 0x0cd6e2ddU, 0x310cd5d3U, 0xf7f353d0U, 0x22f440b6U, 0x091d1ce7U, 0xe7221cddU, 0x05d41212U,
+  0x60d1d515U, 0x1710fffeU, 0x09fd3c0fU, 0xffdbd702U, 0xf149a8f7U, 0x211ce5feU, 0x313de70bU, 0xf3e7f2d8U,
+  0xe7d900e2U, 0x13000000U, 0x1aff00faU, 0x32d9000fU, 0x13bced20U, 0xebfcf036U, 0xfaf9ff2cU, 0xcf02ff15U,
+  0x3b21fc00U, 0x17f11200U, 0xf1f91500U, 0x23d5f200U, 0x00d5d70bU, 0x00d8e5faU, 0x00d6e60dU, 0x00124afdU,
+  0xf9ffbef1U, 0xfecfeffeU, 0x02121fffU, 0x0cdf50f8U, 0xff1356adU, 0xff2122deU, 0xf34911e1U, 0x23c80e47U,
+  0x54bb8e1fU, 0xfee913d2U, 0xfaf037f3U, 0x18f2dd07U, 0xe034bae8U, 0x2f09df18U, 0x0b20e4fdU, 0x12ed1ae6U,
+  0xf7d00010U, 0x1ff90018U, 0x140400f5U, 0x39e1004eU, 0x15b3f027U, 0xfadbec15U, 0xead0e910U, 0xcf0e1c42U,
+  0x63413700U, 0x2be31600U, 0x1be11b00U, 0x0be01400U, 0x00c1e6e3U, 0x00ef0beeU, 0x00e5f603U, 0x002033dcU,
+  0x060ed521U, 0xe5e4f222U, 0xf4120b1bU, 0xe4f14d22U, 0xe61b4da8U, 0xdd110ff2U, 0xf9fa03f3U, 0x24eb1f2fU,
+  0x09a897e4U, 0xf3d7cabbU, 0xe6d6eee0U, 0x07cde404U, 0xf427c8c3U, 0x1403e212U, 0x1c28d807U, 0x08d026efU,
+  0xfcd60033U, 0x0bf70009U, 0x27fe000dU, 0xef230030U, 0x20f02011U, 0x04f4f7f8U, 0x08d60bd4U, 0xdb271b32U,
+  0x26f13600U, 0x00132d00U, 0x2bd41e00U, 0xfc061800U, 0x00e711f1U, 0x00e7f9cfU, 0x00d3fdfbU, 0x001711f5U,
+  0xfac80b30U, 0xe002f615U, 0x192e0647U, 0xcff63c31U, 0xfddd42e7U, 0xca0ce8e4U, 0xc1e231efU, 0x000b150eU,
+  0xfcefc6e7U, 0x06e3c1caU, 0xe502bca6U, 0x05f6e61aU, 0xd60de1b7U, 0xdee8def2U, 0x0515ede7U, 0xf7fd1204U,
+  0x12f20020U, 0x1ee30006U, 0x2ce7001cU, 0xd1370028U, 0x2fce22deU, 0x09f207efU, 0x250704cbU, 0xe0fef852U,
+  0x17def900U, 0xf41d1b00U, 0xeabd2200U, 0x1e1ff200U, 0x00f320e8U, 0x00ddf4d0U, 0x00cb20b6U, 0x0026f7deU,
+  0xf9bc02eeU, 0xe301e8fdU, 0x2b51f234U, 0xbde8253dU, 0x00cb2ce2U, 0xdc22f8f1U, 0xb6cb0b01U, 0x072b16eaU,
+  0xfaea03f1U, 0x0df3d3efU, 0xf643bcc7U, 0x0ecbfe1dU, 0x0e2513efU, 0xede4ea06U, 0xc802fadaU, 0x21fe1b06U,
+  0xbcf4005dU, 0x0f0e000bU, 0x18290016U, 0x00c40018U, 0x29c410c7U, 0xfb010100U, 0x160d1216U, 0x05df1e0fU,
+  0xe519eb00U, 0x14f91400U, 0x0efb2100U, 0x14ebe000U, 0x00c30da9U, 0x00e8ebf3U, 0x00e1df15U, 0x0015d3e1U,
+  0x1527defaU, 0x0decfbfbU, 0x2816f602U, 0xf50310f4U, 0xe7e2e2eaU, 0x051f1ff9U, 0x072049f6U, 0xecfd08e3U,
+  0xf5aae9ecU, 0x14f60100U, 0xf31629f7U, 0x08cbef12U, 0xfefef518U, 0x0e29fc0bU, 0x0946fb17U, 0x2de6ddd0U,
+  0xdde40008U, 0x1e00001fU, 0x181d0014U, 0x22d800ebU, 0x48bdcccaU, 0x06d2dd34U, 0x20c5ef2aU, 0xf2d21811U,
+  0x1278d100U, 0x35fd3800U, 0x16333d00U, 0x35ecd900U, 0x00b002d7U, 0x00e5f2dcU, 0x00f9fbfbU, 0x001bf8bfU,
+  0x1c3ed9faU, 0x1804110dU, 0x071b100dU, 0x10fd0d22U, 0xed10eed2U, 0xee2417f0U, 0xf80d38eeU, 0x13ff2af6U,
+  0x06c0dcd2U, 0x11d9f8d2U, 0xe4f505e6U, 0x0becd209U, 0xe726d01bU, 0x1633fcffU, 0xf745ea04U, 0x10ffe5c5U,
+  0x0be100eaU, 0x15ea0009U, 0x12260013U, 0x30020020U, 0x35cbc5d0U, 0x16daf328U, 0x2fc1f906U, 0xf9e7283bU,
+  0x135fe600U, 0x47193500U, 0x40322200U, 0xfdfff200U, 0x00db1decU, 0x00f009abU, 0x00270cb8U, 0x0016fde4U,
+  0xe60ee70aU, 0x32ff152fU, 0x1f1d1532U, 0x19ef0e39U, 0xecfbebc6U, 0xbc1a1cecU, 0xcf0a1deeU, 0x070b3cf5U,
+  0xe7cff5c4U, 0xf1d1dcb9U, 0xc2eefbb7U, 0x16e2b8faU, 0xde32ef04U, 0x152cfae7U, 0xeb1ecddfU, 0x061017e7U,
+  0x2dd700e4U, 0x05ed0000U, 0x43ef00e3U, 0x0e2f0026U, 0x47e9ebebU, 0x0df509fbU, 0x42fe0cd8U, 0xf0f31447U,
+  0xf548cf00U, 0x0f112700U, 0x2de51600U, 0xe8f10800U, 0x00cf24f0U, 0x00e11bb2U, 0x0023138dU, 0x000c12f8U,
+  0x0402eeeaU, 0x32f2fc33U, 0x4b11fe2dU, 0xf7091f2bU, 0xcdede6e2U, 0xbf0400e4U, 0xaee003f0U, 0x09162514U,
+  0xf8eff9e2U, 0xfbece0d0U, 0xe1062bbeU, 0x2a01d117U, 0xdfeafe1bU, 0xf40e0ce3U, 0xe106fbd7U, 0xe71b201aU,
+  0x640600fdU, 0xf2f300f1U, 0x05ee00c6U, 0x013d0017U, 0x37e6f2f1U, 0xed05f500U, 0x1f080301U, 0xfee80a34U,
+  0xf714ad00U, 0x011a2900U, 0x05c30f00U, 0xf723e100U, 0x00f62bf2U, 0x00e404cfU, 0x0017f5a3U, 0x000d03f5U,
+  0x0cdd01eaU, 0x04ddf512U, 0x2f1dff27U, 0xe8fd1ff3U, 0xf5cf0403U, 0xd01004f9U, 0xabe8080dU, 0x07110311U,
+  0xf2c408d8U, 0xfcecebe7U, 0xf015e1e5U, 0xfec3e50dU, 0xe3000126U, 0xedf4fefcU, 0xc3f301e0U, 0xff1315efU,
+  0x11fa00daU, 0xe4080008U, 0xf0ed0005U, 0xfffa00eeU, 0x0507f917U, 0xe904fbedU, 0xf9e504d7U, 0x08e902e5U,
+  0xf8fceb00U, 0x04d73200U, 0x06d9ff00U, 0xf908ea00U, 0x00010cf9U, 0x00b5e6e7U, 0x00f9fdf0U, 0x00d2fdf3U,
+  0xfc0112e1U, 0xfee4c13aU, 0x05f7c2feU, 0x05f2ebe7U, 0x08e9e213U, 0x020cc3f4U, 0xf5f511f0U, 0xfcf4e3f2U,
+  0xe70ffd01U, 0xefdcf70bU, 0x0ef7f2f7U, 0xebfeebcdU, 0x00cd0bffU, 0xf3f70101U, 0x1317f207U, 0xfbfc100aU,
+  0xf6e200eaU, 0xf0ea00ecU, 0xfe0300e9U, 0x04f3000aU, 0x0d23f63dU, 0xd521fdf4U, 0xf4f122c3U, 0x0cd102e4U,
+  0xfd04e100U, 0xf0062b00U, 0xf1e3dd00U, 0xf91af000U, 0x00f81413U, 0x0016ceacU, 0x001ae2f5U, 0x00d00ef5U,
+  0xdc0d21dcU, 0x04eef317U, 0xf0f7dac7U, 0xf2dff4d7U, 0x1deb0206U, 0xef2bacfbU, 0xd8f905f3U, 0xeaf9fbf9U,
+  0xec081320U, 0xf8c70e25U, 0x29dfe402U, 0xe3ebe0e0U, 0x17b71af3U, 0xd7d80101U, 0x3620f5f8U, 0x1fe81ef8U,
+  0xf5e300fcU, 0x1b0a00fcU, 0x03ee0002U, 0xebe90034U, 0xfc17d32bU, 0xd70ffdfdU, 0xf61819e3U, 0x1104d8d3U,
+  0x0f15dd00U, 0xf0034900U, 0x1af8cd00U, 0x142fe900U, 0x00fb1d0aU, 0x0037ec94U, 0x00fdee2bU, 0x00fa325cU,
+  0xda000cffU, 0xd6ecfc24U, 0x281137abU, 0x0edd27b1U, 0x35e8e81fU, 0xc935d0e7U, 0xedd610e6U, 0xe6f90606U,
+  0x0911ff32U, 0x14810f04U, 0x4408c205U, 0x1715cc00U, 0x108103fcU, 0xb7b0f9f2U, 0x154319f5U, 0x06f919e9U,
+  0xee0b000eU, 0x431100f3U, 0x0bd00024U, 0xe7df006eU, 0x1711d71bU, 0xef0506f6U, 0x09fb10f5U, 0xf20fffebU,
+  0xf33cfe00U, 0xf8122e00U, 0x0911c000U, 0x0c34ef00U, 0x00fc1907U, 0x003d03a6U, 0x00e6001dU, 0x00020847U,
+  0xf2fd0910U, 0xc8fbff0dU, 0x521c3fe2U, 0x28f818e9U, 0x43f9d614U, 0xcd2ae5d2U, 0xce0129eaU, 0xf8e7330dU,
+  0x021efb22U, 0x36810b02U, 0x0532c0d3U, 0x054a94faU, 0x039f0af2U, 0xe8d8f0f6U, 0x1d2517d3U, 0xc40916efU,
+  0x00180009U, 0x241400e9U, 0x25c00000U, 0xf8d60027U, 0x0815070cU, 0xebf7ff0fU, 0x1f180007U, 0xe54f0515U,
+  0xdf051700U, 0x0c131f00U, 0x16f70300U, 0x05191100U, 0x00000409U, 0x000b13bcU, 0x00ecff51U, 0x00d2ee6bU,
+  0xf6e7101eU, 0xfd0ee03bU, 0x362e3debU, 0x46e153cfU, 0x2e03e40dU, 0xe715fcfbU, 0xe9fc1b17U, 0x16f23814U,
+  0x0b420726U, 0x3aa50210U, 0xf125c6baU, 0xea7f9d0bU, 0xe4d108fdU, 0xfcedf0e9U, 0xe503fdedU, 0xcf2b17f2U,
+  0x0cd600d5U, 0xe9380012U, 0xf8020001U, 0xf8f600e7U, 0xfc0f041aU, 0xebfdf8ddU, 0xfbf204d9U, 0xf304f704U,
+  0xf8f3e900U, 0x02f04800U, 0xff02fe00U, 0xfcf7d900U, 0x0017f6f5U, 0x0014e1eaU, 0x00e3f4f1U, 0x00d0e5e6U,
+  0xe4f2fcfaU, 0xe5e2ba1dU, 0x07f5e809U, 0x1af4dffdU, 0x11e70efaU, 0x043bcf08U, 0xdff2fcf7U, 0xdff718faU,
+  0xebf2e4faU, 0xf4dcf518U, 0x0e0904f9U, 0xed05f4daU, 0x12c408e0U, 0xf400e2f9U, 0x040a0108U, 0xe7e30a05U,
+  0x10bf00e6U, 0xe44d00eaU, 0xd211001cU, 0xedfa00fbU, 0xf3100c3bU, 0xe21719f6U, 0x0111fbd0U, 0xf218dcbfU,
+  0x1ae7f000U, 0xea053100U, 0xd807e100U, 0xeee6e300U, 0x000810f2U, 0x0030fcc7U, 0x00e2d3fbU, 0x00c7fddeU,
+  0xd00614f1U, 0xcdf3d525U, 0x05fae4e1U, 0x2ee606f1U, 0x36f5f204U, 0xf726a9fcU, 0xd21f06eaU, 0xc1153cf6U,
+  0xe0c9e70dU, 0x1ad60b12U, 0x160ddcfdU, 0xfbd1fcf5U, 0x42d41ce8U, 0xd4e2ddedU, 0x002c0d19U, 0x052e1cf0U,
+  0x06c600f2U, 0x1b430019U, 0xde0a00f4U, 0xfafb00ffU, 0xd422e704U, 0xe3361c00U, 0x041df6d6U, 0xe343a6ccU,
+  0x3a24de00U, 0xf9132b00U, 0xeb15d900U, 0xea06cf00U, 0x001b1104U, 0x002209a9U, 0x00edd501U, 0x00dd131cU,
+  0xbefe31ecU, 0xd223d312U, 0x2607eee6U, 0x60ed16daU, 0x3c0ce225U, 0xdd26ade6U, 0xaa012addU, 0xc2fc18feU,
+  0x11b8f80dU, 0x08c406e9U, 0x2720e2faU, 0x2b0e0319U, 0x2db23ce1U, 0xd7edf7ecU, 0xfb3f0902U, 0xf10336e4U,
+  0xf4df0007U, 0x3131000cU, 0x21d400f1U, 0x10fd0020U, 0x0d1a041cU, 0xf5060f07U, 0x10260cdfU, 0xfd23c6f7U,
+  0xfc12f900U, 0x2dfefe00U, 0xf3fcdf00U, 0xdf20e900U, 0x000217feU, 0x0032e993U, 0x00f5ebe9U, 0x00dd1ef5U,
+  0xf1fe1cf4U, 0xf217d919U, 0x251e0e08U, 0x62f81228U, 0x2e1ddf19U, 0xd82eeee1U, 0xb9df28feU, 0xcaf237fbU,
+  0x04e51624U, 0xf6a3dfe3U, 0xea13d4e1U, 0xf62bddfbU, 0x1eae22edU, 0xf0ddf80fU, 0x102218caU, 0xd10b4b09U,
+  0xde050004U, 0x160700f7U, 0x4ab400e0U, 0x19ca00fbU, 0x15240105U, 0xdfec0918U, 0x31270901U, 0xec5dfd03U,
+  0xdb010b00U, 0x3d001600U, 0xf0ff1000U, 0xce1a0d00U, 0x00f4120dU, 0x002f01c7U, 0x00c726f9U, 0x00ae0ff8U,
+  0x0ef51bfbU, 0xf72ab315U, 0x22290ef1U, 0x73f615f1U, 0x19f8d523U, 0xe72000fdU, 0xe0e60a16U, 0xd2e02e10U,
+  0x102b0821U, 0x22a7f21fU, 0xd5f6f2afU, 0xd030c7d4U, 0xf5bcf711U, 0x0407efeeU, 0xf8f70dd3U, 0xc8363c12U,
+  0xfef300ffU, 0xd5130012U, 0xf7fe001eU, 0xf0d7000cU, 0xfaea11faU, 0xeaf20809U, 0x100b0dd9U, 0xd43e00f0U,
+  0xf4eeea00U, 0xff1f3800U, 0x0520f400U, 0xfffcd600U, 0x0020e5e8U, 0x00ffede4U, 0x00fc18e4U, 0x00ecdbefU,
+  0xcbe6ed0dU, 0xdff2de13U, 0x0ce524f5U, 0x3ee0fe16U, 0x05f9fc00U, 0xf039eeffU, 0xecf51803U, 0xe2f31b00U,
+  0xf7eaf20bU, 0x12bd1239U, 0x0c0df4c6U, 0xf21ef5f2U, 0x0add06f2U, 0xd70df2f8U, 0xf9161b05U, 0xdceb20fdU,
+  0x13f500ffU, 0xf4050010U, 0xd7000014U, 0xddfc00feU, 0xe407192eU, 0xda1b2633U, 0x1115ebf1U, 0xeb30e5e4U,
+  0x0ff4eb00U, 0xd4141b00U, 0xd513e400U, 0xeae8e300U, 0x000efaedU, 0x000e3ad9U, 0x00d7f004U, 0x00ddcbdcU,
+  0xdcfaf5f6U, 0xcaf2cdf7U, 0xfcd224efU, 0x3cb211e4U, 0x3208eb04U, 0xf3fbb201U, 0xdb092fefU, 0xde09381aU,
+  0xfdc2f50aU, 0x06e01036U, 0x1028e1e0U, 0x050ded20U, 0x24e808ecU, 0xc3fcbbf5U, 0xf61af60eU, 0xef1714daU,
+  0x13f900e4U, 0x00160017U, 0xd214000cU, 0xeb0400f9U, 0xf108ea1aU, 0xc1046125U, 0x1207f70bU, 0xfa4bc117U,
+  0x2d350800U, 0xf5ed0900U, 0xe01ffc00U, 0x0600c200U, 0x000f18eeU, 0x0035e997U, 0x00e808eeU, 0x000108dbU,
+  0xf10516f4U, 0x0adf0cfdU, 0x1af0fd20U, 0x46d5f7e9U, 0x1a250108U, 0x0b2bc906U, 0xcef83ff9U, 0x03122c06U,
+  0x07aee8feU, 0xedc9e021U, 0x0516dad6U, 0x10efdaf9U, 0x32ec14d1U, 0xcae2dcecU, 0x1437fc08U, 0xe10920fcU,
+  0x28f300dcU, 0x17fe001cU, 0x0d080006U, 0x1bde00eeU, 0x0901ee2bU, 0xd2e72823U, 0x1d10e8fcU, 0x093cd83cU,
+  0xe4281c00U, 0xfd080300U, 0xefed0900U, 0xd32ae600U, 0x00f60b04U, 0x0035cba2U, 0x00f51fefU, 0x001c06cbU,
+  0xdd0b24f3U, 0x24d2070bU, 0x210c0813U, 0x1ddc050fU, 0x261dd719U, 0xfa3208fcU, 0xd1bffc04U, 0xede91d13U,
+  0x10dcf212U, 0x05a9f203U, 0xe126ece2U, 0x07e3e8f2U, 0x10c701d8U, 0xebef0aebU, 0x041216faU, 0x18e32627U,
+  0xf9d200f2U, 0xff240004U, 0x3bec0001U, 0x21b800b4U, 0x08180400U, 0xaef60c36U, 0x0322d2f7U, 0x0264eff1U,
+  0xed003400U, 0x19192200U, 0xf1e7ea00U, 0xe7fa0f00U, 0x00e6ef04U, 0x002cf2beU, 0x00ef31f1U, 0x00ef13b1U,
+  0x051f09e7U, 0x29f7db00U, 0x2e10fe03U, 0x26f2ceebU, 0x02fee727U, 0x070f1df2U, 0xd9aafb03U, 0xb5d51f0eU,
+  0x06170710U, 0x11b32105U, 0xe211cae8U, 0x0215d0e1U, 0xfacaefe9U, 0xf60404e8U, 0x0ff03cc0U, 0xfc052025U,
+  0xf80d0007U, 0xe5130005U, 0xf9ef0025U, 0xece4001dU, 0x20e1f805U, 0xf90afa15U, 0xf80908f5U, 0xb21d0911U,
+  0xede40a00U, 0x034b1a00U, 0x0f07fe00U, 0x00e9e000U, 0x0002dcf7U, 0x00e011fbU, 0x002ce6f4U, 0x0018d8d5U,
+  0xc703ebfdU, 0x02fcc3e8U, 0x25d2341dU, 0x44ce1b06U, 0xfc0ff9f6U, 0xf4240003U, 0xe6f72516U, 0xfdef1e14U,
+  0x06e50210U, 0x2dfa173aU, 0xe218f9ecU, 0x0d34e118U, 0x14e70402U, 0xe000ee01U, 0xf6201cf4U, 0xfc0a0eddU,
+  0x030b000fU, 0xcefa00fbU, 0xde0c0005U, 0xc9e90020U, 0x1afd0223U, 0x0fdc13f9U, 0xee0adbf8U, 0xed1fe4ffU,
+  0xf3d30b00U, 0xf8201a00U, 0xfd06ec00U, 0xe90de000U, 0x0018d10cU, 0x00e9dc0fU, 0x00f7e5faU, 0x00fcf3e6U,
+  0xc201f7f2U, 0xf3fccae4U, 0x10bd1a1fU, 0x17af08e7U, 0x1b1dd3f6U, 0x1011f705U, 0xfbf32721U, 0x39e93d11U,
+  0xfed005ffU, 0x29f90b4bU, 0x0425d9eaU, 0x181bed17U, 0x06d0f200U, 0xf9fee7e2U, 0xf13b16fbU, 0x030c0600U,
+  0x19fb00f9U, 0x0ddb00e2U, 0xec02001bU, 0xf3e600ebU, 0xf90cfe1bU, 0x02d10e28U, 0xed0bcaffU, 0x001fda1fU,
+  0xfa1dfd00U, 0x0418fc00U, 0x08090300U, 0xfb34d900U, 0x00fc07ddU, 0x00e1beddU, 0x00f6f208U, 0x0008e7eaU,
+  0xfa0704e4U, 0x17e5ece6U, 0x14f5083cU, 0x2cc4fed1U, 0xee1ee408U, 0x162d1410U, 0xeb04400dU, 0x5aef0ffdU,
+  0xf6d11210U, 0x2b02ff21U, 0xd721e5c5U, 0xf5f405faU, 0x0bdf05efU, 0x10dce9ebU, 0x18271b15U, 0x02f4f616U,
+  0x25ec00eeU, 0x2b0700dfU, 0x04030004U, 0x0ef400b6U, 0x06e8f32aU, 0xcdf01b18U, 0xdb02c1e7U, 0x1442c915U,
+  0xe9280c00U, 0xe4370800U, 0x050f1f00U, 0xe524fd00U, 0x00df12e0U, 0x00fbe8eeU, 0x00f02104U, 0x00f4fae4U,
+  0xf313ffd1U, 0x2fd8ff04U, 0x2a161534U, 0x22d908daU, 0xf40af61eU, 0x071934f1U, 0xdfd93d13U, 0x1de71631U,
+  0x15e9f7fcU, 0x22f7f20eU, 0xc931cdcbU, 0x02ef0d05U, 0x14defce5U, 0xe606f1d9U, 0x060c04ebU, 0x12d31b28U,
+  0x0fd100d8U, 0x160d00d0U, 0x100c004bU, 0x0f0800b9U, 0xfc0efdf6U, 0x9c1b312bU, 0xccf8cae8U, 0x1911c8f6U,
+  0x04ed2700U, 0xed1ffc00U, 0x18eb0b00U, 0xe6db0700U, 0x0010fdcfU, 0x000605f7U, 0x00ec1f0eU, 0x00f8f7beU,
+  0x1938edd5U, 0x22dcf9ffU, 0x1d0b3865U, 0x12faf5a1U, 0x0318f60bU, 0x0bfe2f07U, 0xe5b717faU, 0x02dc0a0dU,
+  0xf824f71bU, 0x09dd3c0dU, 0xd618c1c7U, 0x0ae8fcf8U, 0xf9eaeaeeU, 0x021610f6U, 0xe9081ec7U, 0x27e6050bU,
+  0x1917000bU, 0x01070013U, 0xf6e40021U, 0x07f30022U, 0x20e3f506U, 0xcbf116f1U, 0x27051800U, 0xed031d17U,
+  0xf0101800U, 0xfc190600U, 0x1119fa00U, 0xfcefea00U, 0x00f5fd01U, 0x00d4f70cU, 0x0039eb0cU, 0x0026d6d8U,
+  0xd901fc04U, 0x0a21f0f5U, 0x34131d0fU, 0x2dfefa04U, 0xf21a00fcU, 0xfdffedeaU, 0x0ad63e0eU, 0x0bd32c00U,
+  0x19e10802U, 0x1b0eff02U, 0xee10250fU, 0x1107f216U, 0x0ce7f20fU, 0x1bf30f11U, 0x02330c12U, 0x101014fcU,
+  0x1000000bU, 0xe1f900f7U, 0xffdf002cU, 0xffd90016U, 0x22de0221U, 0x000516e4U, 0x2c36e8d7U, 0x0b0e0e1eU,
+  0xe7f72c00U, 0xea150500U, 0x290bfe00U, 0x04f7e000U, 0x001ff3f1U, 0x00d2ee22U, 0x002fe204U, 0x000bdcdbU,
+  0xda0d0ce3U, 0xf0f1e4d9U, 0x4604092cU, 0x39e1f3f3U, 0x1032e1f3U, 0x200fe5dbU, 0x15c75814U, 0x0def272cU,
+  0x0dca0ee8U, 0x0d1cee2eU, 0x021fd803U, 0x2306e915U, 0x06fcea04U, 0x3adddc00U, 0x013f230aU, 0x1a05fafbU,
+  0x11ff0003U, 0x212900caU, 0xfad0003bU, 0x0acd00f1U, 0x10e8260eU, 0xde0c3101U, 0x1a0ec1e0U, 0xff3bee38U,
+  0xf6091500U, 0xd301db00U, 0x32113b00U, 0xf21d0200U, 0x0017febcU, 0x00cfefffU, 0x0015f8eaU, 0x00f1dae5U,
+  0xf81affd4U, 0xf7f0eab9U, 0x53151062U, 0x34d20ae4U, 0xe53cf3e7U, 0x142cebd6U, 0x05ec490eU, 0x09fd3b1eU,
+  0x0cd3f7f8U, 0x1a06f61aU, 0xf422cfe6U, 0x2629e10bU, 0x0c0506e4U, 0x33e2fc04U, 0xf52b0a2dU, 0x11c70e0bU,
+  0x2b0c00fdU, 0x2b0100a1U, 0xe9e20035U, 0xf11e00e2U, 0x1d0520f6U, 0xb41a2e1bU, 0xaf14d9e3U, 0xc721c210U,
+  0xff1c0400U, 0xe61fcd00U, 0x3d0f5b00U, 0x0d1b1a00U, 0x001dec92U, 0x00ea0e0dU, 0x00fa2d10U, 0x00f1ff10U,
+  0x1031f3e3U, 0x00f904d8U, 0x49061778U, 0x26e4f6edU, 0xe929e509U, 0xfe161cf4U, 0xf8e53b0eU, 0x0e182e1cU,
+  0x1dfa01eeU, 0x2a0d0820U, 0xd633b6c3U, 0x0d3dfd0eU, 0xe00000ebU, 0x26eef322U, 0x06460bc4U, 0x411c0ef7U,
+  0x00e500e0U, 0x1b1700a3U, 0xd5f00037U, 0xc81400ffU, 0x2f160bdbU, 0xd101302bU, 0x9518e4f8U, 0xd404de0fU,
+  0xf7100a00U, 0xff14c100U, 0x2cf64f00U, 0xfde81f00U, 0x00060f9eU, 0x00f6101bU, 0x00040012U, 0x00dfdd05U,
+  0x2b44f2e0U, 0x17e501d9U, 0x3fe60f7fU, 0x1b0cffe3U, 0xea28f4f6U, 0x31fd1c04U, 0xf9f51c18U, 0x190ff4faU,
+  0x1a19fe04U, 0x111a0b17U, 0xe174e1e6U, 0x132d1814U, 0xf1ecf903U, 0x1837fc14U, 0xde2909c6U, 0x4e1704eaU,
+  0xf10400d5U, 0xfd0500f4U, 0x19fb00f7U, 0x0afb00f7U, 0xff10fd06U, 0xf6f1f9eeU, 0x04f300fbU, 0xf3e2fee8U,
+  0x0023f200U, 0x02d81800U, 0xfce2fe00U, 0xf9f20200U, 0x00af16efU, 0x000df2f6U, 0x00e3ec04U, 0x001bd1e1U,
+  0x06f4ccf9U, 0x07f9f807U, 0x01f0e1feU, 0x0d0be7efU, 0xfdf9fc02U, 0x0400f3f7U, 0x01e9f513U, 0xff13f2e6U,
+  0xeb05f5ddU, 0x0de10b0bU, 0x0710f606U, 0xe8d51ef7U, 0xfe1803fcU, 0x03fcfdfcU, 0xfeeeebfcU, 0xfad81107U,
+  0xf5fb00d3U, 0x0b2300dcU, 0xfb04000fU, 0x12e300e5U, 0x090f0913U, 0xf2daf6d6U, 0xfe0403e9U, 0x06e9ff0dU,
+  0x033fe100U, 0xfaf21600U, 0x01eeff00U, 0xd204d100U, 0x00a609e5U, 0x000fdfd8U, 0x00fdeef0U, 0x000fe2f4U,
+  0x20d9d906U, 0xef11190fU, 0xeaef01f9U, 0xea1cfccdU, 0x110ae21aU, 0xe31ffdf7U, 0xefe015f8U, 0xe52ffbeaU,
+  0xe32302e8U, 0x1ec00400U, 0x02fbe70bU, 0xfeb92915U, 0xfe271afeU, 0xe4f0280eU, 0x07f0fff0U, 0x1ec61a05U,
+  0xf1e200c5U, 0x110e0011U, 0xfde90023U, 0x0bfc0006U, 0x1a120023U, 0x0eb5f604U, 0xf7f711e0U, 0x1fd314f5U,
+  0x0a35c300U, 0x14da2800U, 0xf6e2f900U, 0xe201bd00U, 0x00bb12e0U, 0x00eedee5U, 0x0016e70fU, 0x000ffb1dU,
+  0x3bd8f20dU, 0xe91c2026U, 0xc5f90a1aU, 0xd732d3f7U, 0x1f000c0dU, 0xb91e07f6U, 0xf51414deU, 0xce2eef09U,
+  0x0e1c00f8U, 0x26dbf5eeU, 0x03e4c50bU, 0x1f9f3b1dU, 0x0448340fU, 0xc0e2330aU, 0xffcf15e9U, 0x41dc13f5U,
+  0x02e30007U, 0x1ce10023U, 0xede00026U, 0x0ff40029U, 0x31151022U, 0x0cc60018U, 0xd7f011dbU, 0x2db610faU,
+  0x0e4eb600U, 0xf6de1500U, 0x04f40600U, 0xd7f8d700U, 0x009f07e1U, 0x0010e8ebU, 0x00f6e418U, 0x000a0f23U,
+  0x3dfd0920U, 0x010811f8U, 0xc0e8e622U, 0xc51dcb0cU, 0x03011c01U, 0xdd1200fdU, 0x011716efU, 0xe60ae208U,
+  0x013aed01U, 0x10e1ecf8U, 0xfef6e4f0U, 0x23aa3ffaU, 0x1c333616U, 0xcae23401U, 0x05e51efbU, 0x2bdaf7deU,
+  0x13f40022U, 0x11f40025U, 0xcbd90032U, 0xfc15002dU, 0x492e0b2cU, 0x0de60700U, 0xdffb06f7U, 0x37c915edU,
+  0x2042a800U, 0x0304ed00U, 0x061b0c00U, 0xf90ddf00U, 0x00d2f7f1U, 0x001d10e3U, 0x00d01b0eU, 0x00121b04U,
+  0x2a154fcaU, 0xfdfdd8fcU, 0x02efd80dU, 0xbf17fd0eU, 0xfefb3500U, 0xef030400U, 0x021cf4fbU, 0xfc1efe04U,
+  0xf925f82bU, 0x11cfe808U, 0x1002d2ebU, 0xfba72deaU, 0x23371716U, 0xe9f0330bU, 0x12e209e9U, 0x27e121dbU,
+  0x00fd00caU, 0xfb2900e7U, 0xfbfe0014U, 0xfbf800f2U, 0xf80e05f0U, 0xe4e404eeU, 0xde08faeeU, 0xf9fe140bU,
+  0xff27df00U, 0xf9d73100U, 0x05f80200U, 0xf01eef00U, 0x00e914d0U, 0x000bdce6U, 0x002ae403U, 0x0002c0c7U,
+  0x1c03dc21U, 0xf402f702U, 0xeef208fbU, 0xf4f822ebU, 0xf8e3cafdU, 0xe0f414fbU, 0xfffbf2efU, 0xee1a0df8U,
+  0xc709fed0U, 0x1bcced0aU, 0x16f0edf0U, 0xe1bc13d8U, 0xe5001502U, 0x0d0908fdU, 0x00e6fd03U, 0x22fe15fbU,
+  0xdff800dfU, 0x104e00b7U, 0x01cc000fU, 0x1cec0007U, 0xd62403efU, 0x00bc089eU, 0xf2fefcf9U, 0x07e60110U,
+  0xe61ce900U, 0x01c7ef00U, 0xeeff1300U, 0xd112e100U, 0x00df0fccU, 0x003fe8e6U, 0x003febdeU, 0x000904d8U,
+  0x2ffbcd2dU, 0xd50dfe0cU, 0xd2042110U, 0xc72124e8U, 0x0107e000U, 0xd123f836U, 0xfa11d0d5U, 0xc7330404U,
+  0xdff623f2U, 0x28a8edcfU, 0x09efd6f6U, 0xf3a014feU, 0xece41defU, 0x07022b00U, 0x28d7e905U, 0x38e71008U,
+  0xcff100d6U, 0x36f800e2U, 0x11dd0020U, 0x23ea0006U, 0xd50adcfaU, 0x1f8ffcbeU, 0xfa0714f2U, 0xf9cbfa00U,
+  0xfcf4c800U, 0x1de2f500U, 0xebec0800U, 0xfcfbc700U, 0x00e60c04U, 0x003202edU, 0x0046cafbU, 0x002410fbU,
+  0x17e5e4f9U, 0xd63af917U, 0xd3081c0eU, 0xaf200df7U, 0xe6120709U, 0xee4a0a42U, 0x0524fadeU, 0xbc330114U,
+  0xf6e313f8U, 0x26a0fdd2U, 0xfadfe1e9U, 0x22a7050fU, 0x190a2ae9U, 0xf9f81e06U, 0x0fe5f1f1U, 0x42e4f911U,
+  0x0fca0011U, 0x3df50005U, 0xffc80015U, 0x1915000bU, 0xf40bff26U, 0x1eb0f5f7U, 0x05051bf4U, 0x0bf5030dU,
+  0xe9f7b500U, 0xf7cf0100U, 0xfce01a00U, 0xf5e9d300U, 0x00ddf808U, 0x0036e523U, 0x0020e80eU, 0x0025fd18U,
+  0x33d1f507U, 0xc02201f2U, 0xf1f614fbU, 0xa608f6feU, 0xceea11d2U, 0xf50e151eU, 0xf531eee5U, 0xcd35f114U,
+  0xfbfded0cU, 0x1cafe8f6U, 0x06d7dfebU, 0x36dbfa2cU, 0x2712170dU, 0xdad91918U, 0x0fc3ffe6U, 0x1fbeeff1U,
+  0x17ae000eU, 0x452e0036U, 0xecf00020U, 0xdd0600f9U, 0x5d113409U, 0xffd1e3f8U, 0xd1ecf2efU, 0x29c6f5dbU,
+  0xf85ba600U, 0xffe6f800U, 0xfed33400U, 0x010f0400U, 0x00c905d6U, 0x0063f5e6U, 0x001e051aU, 0x004dfd19U,
+  0x32ea2ee0U, 0xc930121cU, 0xf3ef0c18U, 0x9afd2602U, 0xded33ee8U, 0xfd211ae5U, 0xf82eccfcU, 0x0427ef03U,
+  0xf4e1eaf5U, 0x09d2de0eU, 0x0af7df00U, 0x0be90a11U, 0x4131250bU, 0xc8e00425U, 0xc9ce0fdaU, 0x4ba111eeU,
+  0x07e700d1U, 0xe56a00e6U, 0x06e7001eU, 0xe50500edU, 0x1b31f2e9U, 0xfa0518f7U, 0xe609ee29U, 0xfcef1222U,
+  0x0837cf00U, 0xfe4f3000U, 0x03c01b00U, 0xf32df200U, 0x000e33d6U, 0x0000d0c0U, 0x0038e012U, 0x00eeddfeU,
+  0x3e08ef39U, 0x34dfb3fbU, 0xea0b53ffU, 0xc2edeafbU, 0xe4e1faf3U, 0xca1606f4U, 0x0100ddfdU, 0xd1260ef9U,
+  0xd9231dd4U, 0xffd3130aU, 0x08cb061aU, 0xfc99e017U, 0xeaea3606U, 0x176ae0fdU, 0xffc313f8U, 0x2607120aU,
+  0xf01100e8U, 0x062c00d6U, 0x0eea0002U, 0xf2cb0008U, 0x0ff1f0eeU, 0x06d421e6U, 0xdefc09f5U, 0x0fd71921U,
+  0x0d3ee500U, 0xfb29eb00U, 0xf6db1f00U, 0xeef5e900U, 0x00fc36f9U, 0x0003b6afU, 0x004508edU, 0x0016e6e3U,
+  0x1f10d844U, 0xdcfac1f7U, 0xc71133faU, 0xb80ffce4U, 0xe802de01U, 0xb1381e07U, 0xf705da06U, 0xce490316U,
+  0xec2837e5U, 0x13ca09bfU, 0x04bbdf25U, 0x079df405U, 0xf6ef1501U, 0xc83ef003U, 0x25dcfff4U, 0x3afa0921U,
+  0xe1fc00ebU, 0x0a3400c8U, 0x04e60010U, 0x39f0000aU, 0x03fff4f8U, 0xfab123f8U, 0xf904f6e2U, 0xf5f9f7faU,
+  0x0545ee00U, 0x1ae7e100U, 0x03f71f00U, 0x03ef0c00U, 0x00daf115U, 0x00e4b8caU, 0x00561102U, 0x0014ed14U,
+  0x1900c714U, 0x0711e4f7U, 0xdf082affU, 0xc0031717U, 0xd510fcedU, 0xa03364ecU, 0xec1dce0eU, 0xb0320216U,
+  0xfe131dceU, 0x209b17c6U, 0x04d3db13U, 0x20f6f905U, 0xf906f80cU, 0xe17f0417U, 0x22d705efU, 0x1ee40907U,
+  0x0aec00ffU, 0x013700f6U, 0xd3fd0018U, 0x07ec0019U, 0x0d2bf402U, 0x10e717f8U, 0x0b04ddc4U, 0xfded0f21U,
+  0xf341fa00U, 0x05ead800U, 0x03f12d00U, 0x32e01900U, 0x00e2fa0eU, 0x0000e7e2U, 0x002504fdU, 0x0008fe0cU,
+  0x5de8df05U, 0xee0df2f3U, 0xe1112d03U, 0xf5191b10U, 0xc0da28deU, 0xc005520bU, 0x1924e70eU, 0x1423f206U,
+  0xf716eebbU, 0x17b6f3daU, 0x05e8b2ffU, 0x3514d33eU, 0xfa1912e4U, 0xfa372213U, 0xe19904faU, 0x13be06eaU,
+  0x03c500feU, 0x124c0021U, 0xff3f0031U, 0xf4b60017U, 0x78340805U, 0x2bdb18fbU, 0xefd2c6f2U, 0x21e3e519U,
+  0xf63ad800U, 0xfff2e900U, 0xe4e01c00U, 0x131c3800U, 0x00d520bcU, 0x00510cf4U, 0x0029ffe4U, 0x00090f0eU,
+  0x15f7fc1eU, 0xd61f1f2fU, 0xe60813f9U, 0xd615530eU, 0xc6cc36ebU, 0x020a3defU, 0x2d27e105U, 0x1322e722U,
+  0xf1fac5d1U, 0x12d5e9feU, 0xf8e6ffffU, 0x3913d246U, 0x311928eeU, 0xf9f8351fU, 0x9cc1ff00U, 0x2b811ac7U,
+  0x09c300ecU, 0xdb3a00faU, 0x05f9002cU, 0xdbff00f2U, 0xeb24d50eU, 0xfa170119U, 0xd80e235dU, 0xfa0a01f3U,
+  0xfbcde500U, 0xf0361f00U, 0x17bd2600U, 0xcc200700U, 0x0039f0d7U, 0x00fde1d2U, 0x002cdb13U, 0x00f7e610U,
+  0x490fed23U, 0x5e00de22U, 0xef013affU, 0xc714ccf0U, 0xfbfcee07U, 0xd12d06e8U, 0xf4ff0e0eU, 0xe10cf619U,
+  0xe4030af2U, 0x13195c1bU, 0x12ddee1dU, 0x2acbe613U, 0xfee92a12U, 0xd9440d41U, 0x2e050ce9U, 0x05ec1d08U,
+  0x2fda00e5U, 0xbb5100d7U, 0x2dea0043U, 0x1aff0004U, 0xe60cf404U, 0x16f8fa12U, 0xcbfd3b23U, 0x1fc50d17U,
+  0x1617ed00U, 0x0f4c1300U, 0xf0bc2900U, 0xe4121700U, 0x001c1bb5U, 0x00ee1803U, 0x0023e4d1U, 0x000ee201U,
+  0x4a09dd19U, 0x0511c8faU, 0xd8082cf5U, 0xd529e4dcU, 0xd7f30b1eU, 0xda0aecd2U, 0xe710252bU, 0xc208e334U,
+  0x050eed12U, 0xf91943f6U, 0xf5cec110U, 0x0fc5ee31U, 0x03df200cU, 0xdd32f90eU, 0x200b04f9U, 0xf2011709U,
+  0x3ff000f8U, 0xd83a00d3U, 0x180a003dU, 0x190d0024U, 0xfbf5f50eU, 0x27051125U, 0xc4ea0df2U, 0x18d70e06U,
+  0x1249fe00U, 0x112cf900U, 0x09a90f00U, 0xe71a3e00U, 0x000d0ce4U, 0x00fe2e02U, 0x000f0dcbU, 0x00faf4faU,
+  0x29fefafbU, 0x07f5c4f6U, 0x04160f12U, 0x052d0a08U, 0xdde4faeaU, 0xeee627eeU, 0xfa0c3426U, 0xdd05dd1eU,
+  0xe8f1f3f7U, 0xeb1630eeU, 0xfb0bdc16U, 0x2607d829U, 0xe6ea0ef9U, 0xe73bedf7U, 0x071f2602U, 0xd9fa18ecU,
+  0x32c700e4U, 0xd22900ecU, 0xf22c002fU, 0xf0f70029U, 0x271be406U, 0x08f424f5U, 0xcdffd6faU, 0xf6bf07faU,
+  0x1027ff00U, 0xe0de0200U, 0x31ce1200U, 0x0bf12e00U, 0x00f509e2U, 0x0030f118U, 0x0013e6bfU, 0x0006e218U,
+  0x44fefd1cU, 0xcee7fb14U, 0x05080e1eU, 0xff3f0d13U, 0xcfe734e6U, 0x11fa1f05U, 0xf2241e15U, 0x0bf8d9f9U,
+  0xdc06d3cdU, 0x00fd1206U, 0xff02f0fcU, 0x32efd129U, 0x21fae3e5U, 0xec1200faU, 0xe52234ebU, 0xf0bc1eceU,
+  0x0ddd0007U, 0xda16000eU, 0xdc3c0016U, 0xf99e0009U, 0x5808eaf3U, 0x36e91319U, 0xde0ee528U, 0x0b0ddee9U,
+  0xfaf30c00U, 0x1cf0f600U, 0x0401f800U, 0xf7255300U, 0x00f1eebbU, 0x00130e40U, 0x0036f8c4U, 0x000ff515U,
+  0x1beffc17U, 0xc7d01b23U, 0xf1fffe1dU, 0x144b331cU, 0xd6e12309U, 0x20e22502U, 0x004709f6U, 0x0529bf24U,
+  0xf4dac6c2U, 0x29e10d07U, 0x12ea0b0cU, 0x2026f235U, 0x22fee5eeU, 0x1ff811feU, 0xc5010f0aU, 0xd78407c3U,
+  0x33e60018U, 0x1d2100caU, 0xd9490018U, 0xf02700d9U, 0x0adce40fU, 0xed112009U, 0x1cc25c35U, 0x02f2d30bU,
+  0x0025fa00U, 0x120a1100U, 0x0d812300U, 0xee131800U, 0x0040f3dbU, 0x0023f9e9U, 0x0039bf2aU, 0x00ea1f12U,
+  0x112a0d21U, 0x2824f501U, 0x01ff0ff7U, 0xe12bc9e4U, 0xf6230effU, 0x08e3f613U, 0xec313cf6U, 0xf420ff07U,
+  0xfdda190cU, 0xf457092aU, 0x36f93020U, 0x14fa0f09U, 0x0fe715e6U, 0xd32dfa1aU, 0x1a55f00fU, 0xf9f8fe00U,
+  0x5bf400f8U, 0xf51900f6U, 0xce150035U, 0xff0a0004U, 0x301b0420U, 0xbd16f9f8U, 0xe8e1542aU, 0xedf4020aU,
+  0xfee60300U, 0x18f01a00U, 0xecb11a00U, 0xf6f03700U, 0x0031dfb6U, 0x0024f32cU, 0x0032a027U, 0x00e3080aU,
+  0x7028e608U, 0x21d0e234U, 0x060d13f8U, 0xdf3ae3daU, 0xc90721f3U, 0x28b9ee03U, 0xdf33310cU, 0xfd06d929U,
+  0x0edbf315U, 0xd63d481fU, 0x2bfc2637U, 0xf8e30e39U, 0xf1fe1ac3U, 0x19011f09U, 0xf643f5f6U, 0xe4f419e2U,
+  0x5fe600cfU, 0xb00200f1U, 0xee1f0044U, 0x112a00f9U, 0x3817eefaU, 0xb51be107U, 0xe1d85118U, 0x120729ccU,
+  0x21c31100U, 0x14e9f600U, 0x0ef70000U, 0xf4063700U, 0x00fee1b6U, 0x001aed54U, 0x002dc211U, 0x00f4e30aU,
+  0x7025edfaU, 0xfcc3ff40U, 0x2715fffcU, 0xf147e210U, 0xb4fef5dbU, 0x36d4051cU, 0xf81a470fU, 0x0e23c418U,
+  0x0cebf9fdU, 0xda372f19U, 0x13e53e15U, 0x16fcf40fU, 0xd5d9e5fbU, 0x210914f0U, 0xf55de6fdU, 0xb5e618fcU,
+  0x2bc5009bU, 0xda0c00f0U, 0xea38002bU, 0x0af600fdU, 0x2527e5f3U, 0x93151119U, 0xf812341eU, 0x150916aeU,
+  0x1ddc1d00U, 0x17ff2a00U, 0x34deed00U, 0xe51b3400U, 0x00fff4e3U, 0x00fefb69U, 0x005fe0efU, 0x0011d7e5U,
+  0x7f35fa11U, 0xd7c60325U, 0x28eb12fcU, 0xfd39f52aU, 0xc9190ef2U, 0x160e2810U, 0x03ec37f1U, 0x1130a7fbU,
+  0xf909faeaU, 0x0f09f530U, 0x0aef60f4U, 0x36fc1005U, 0x0ecbf1ebU, 0x19101ff3U, 0xdd4f0801U, 0xbda30efaU,
+  0x0bc500cdU, 0xf2120000U, 0xb7390008U, 0xfed100deU, 0xf80ae7f1U, 0xb70a0d2fU, 0xf30a2d1fU, 0x2f11e7f4U,
+  0x08dd2900U, 0x2f262100U, 0x03dfee00U, 0x02304000U, 0x00e0d8beU, 0x00e9f745U, 0x0063ea30U, 0x000022d2U,
+  0x5a19f306U, 0xe4a30330U, 0x28fb1902U, 0x113eff2dU, 0xf3050dfaU, 0x3c05fb15U, 0x080e0de2U, 0xe218e014U,
+  0x101af5daU, 0x1e17ec0bU, 0x1bfb2f14U, 0x2019152aU, 0x0ddf02e5U, 0xf12c10ebU, 0xe42cfa07U, 0xc3a1f1e8U,
+  0x23350000U, 0xe82800f3U, 0x0afc0016U, 0x07060008U, 0x1fe80b0fU, 0xeaf40ed7U, 0xff13fde7U, 0x1e0c0106U,
+  0x08321f00U, 0x05f30c00U, 0xff181500U, 0x0319ea00U, 0x00da3c1eU, 0x00e4b2e9U, 0x00151bf5U, 0x00ebebf7U,
+  0x0932f333U, 0x06dfbbd6U, 0x0010f42bU, 0x04000300U, 0xfffa270cU, 0xf51110f4U, 0x0503dc00U, 0xfd3e31e8U,
+  0xea1509e0U, 0x29f0faf3U, 0x0608091aU, 0xe9ea09f2U, 0x0e2c0b15U, 0x084fd2ffU, 0xfefcf800U, 0x180916feU,
+  0x1c1c00c1U, 0xf23300b9U, 0x190a0006U, 0x01e1001dU, 0x2edc1cffU, 0xc9fc32e8U, 0xe63f1cfbU, 0x2eddf801U,
+  0x16580300U, 0x3ae60f00U, 0x032e2500U, 0xe60cdc00U, 0x00da2408U, 0x000ec7cdU, 0x00f034edU, 0x00f0e7d9U,
+  0x221d0229U, 0x1de5aa8cU, 0x16feef25U, 0xf01114f1U, 0x31f70218U, 0xd71c3c05U, 0x03d7010eU, 0xdd5138e6U,
+  0xde231cd0U, 0x10b3f5efU, 0x09fdfe0eU, 0x01d302e1U, 0x083d1a24U, 0x157faf0cU, 0xfc0ce1fdU, 0x460815feU,
+  0x312c009fU, 0xf1ea00c9U, 0x212e00e7U, 0x04d10040U, 0x36fb06ffU, 0xe7f32b22U, 0xe63f1312U, 0x22c4ff01U,
+  0x0752c200U, 0x22df1000U, 0xe91c0c00U, 0xf11db400U, 0x00c73ee3U, 0x0012d292U, 0x000124ebU, 0x0007e71fU,
+  0x26023afdU, 0x22ebf3daU, 0x0509fe2aU, 0xdafc1ce8U, 0x25dc1e2dU, 0xc42c350eU, 0x18dad80bU, 0xdb3237e7U,
+  0xfc2d1ed4U, 0x1890c6e3U, 0xe8000403U, 0x0ec1f4e2U, 0x074d2e3dU, 0xf868daf8U, 0x131de816U, 0x5ddd1407U,
+  0x233100d6U, 0x25ca000fU, 0x163700dcU, 0xd1b60048U, 0x4b15021aU, 0xc9231de5U, 0x12260b16U, 0x2bac080aU,
+  0x0b4acb00U, 0x15cd0f00U, 0x03290100U, 0x0a00ad00U, 0x00d20accU, 0x000dd7c2U, 0x00f127eaU, 0x00ff0642U,
+  0x220d240dU, 0x38dd1812U, 0x011a0609U, 0xb71d1b16U, 0x0e02091cU, 0xbe0e3004U, 0x0abefa00U, 0xe40e27f4U,
+  0xf51904e7U, 0x218ca1d7U, 0xef1404f5U, 0x0dd805f2U, 0xec4b0e37U, 0x264ce3e6U, 0x1b19e61cU, 0x3ae3e104U,
+  0x1629000bU, 0x20e100f5U, 0x293a00f0U, 0xafc80017U, 0x4920101dU, 0xc72cf4fdU, 0x2bf41201U, 0x49c605f4U,
+  0x15ffca00U, 0x1a091f00U, 0xefd90100U, 0x0cffcf00U, 0x00cdfdb8U, 0x0002fee5U, 0x0010e402U, 0x00fbfb53U,
+  0x3d1e11e5U, 0x38ef03e3U, 0x10371401U, 0xa2242ef1U, 0xf707f51aU, 0xe1fc3b05U, 0x04d00effU, 0x201329f8U,
+  0x101f181dU, 0x29b9c7d8U, 0xf12ddf0eU, 0xe8e3ffd4U, 0xf043fb3cU, 0x153403d5U, 0xf826f323U, 0x1bddfa16U,
+  0x303400fcU, 0xd73300deU, 0x03ff002fU, 0xffe10012U, 0x421329e7U, 0x0beb1effU, 0xf71004e3U, 0x1d1509dcU,
+  0x047ff700U, 0x0528f400U, 0xf5ea2600U, 0x070cd700U, 0x008632efU, 0x00efbefdU, 0x004a1813U, 0x00182df8U,
+  0x3a1e9516U, 0x3fe4dbafU, 0xf71c2b41U, 0xf6fd0c15U, 0xfcfee004U, 0xdaf1fde2U, 0x1d0de302U, 0xee2910e9U,
+  0xd23136ccU, 0x0a271325U, 0xfff11a19U, 0xf2eed8e2U, 0xf340fd14U, 0xf232c215U, 0xe4e2180cU, 0x20174810U,
+  0xf55200cfU, 0xb93100e1U, 0x1e0a0025U, 0x1ad10027U, 0x1beb2af0U, 0x27051319U, 0xee3cf709U, 0x00dbe1f6U,
+  0x0f50f100U, 0xee3bf700U, 0x05c51600U, 0xe5100e00U, 0x00940bdeU, 0x00ded6dfU, 0x00241e20U, 0x001e1b1cU,
+  0x67f6a7f8U, 0x3f05c7b0U, 0xfd16fd0aU, 0xe9e93804U, 0x30ff36fdU, 0xc80f37ceU, 0x40efeafeU, 0xba29ff07U,
+  0xe41e14dfU, 0x192b1c21U, 0xf3d1fd05U, 0x06e7cdf5U, 0xf515fe0eU, 0xf5509c0dU, 0xf00d0a0fU, 0x30f83efdU,
+  0xf72400b4U, 0xc82600e7U, 0x202700ddU, 0x05eb002cU, 0xfdf4f7fbU, 0x0f262e38U, 0xeb2edf08U, 0xf4c8d8f3U,
+  0x0738c900U, 0xdf261600U, 0x23d7ef00U, 0xdc160b00U, 0x00c2f807U, 0x00e3bcbeU, 0x000e23fcU, 0x00311e2dU,
+  0x0ee508e4U, 0x2f34dce1U, 0xe8e6f115U, 0x13db3002U, 0x0ac953f6U, 0xd11e38b2U, 0x3fe8fbfeU, 0xb218dbebU,
+  0x0c0ddedcU, 0xf9f50a07U, 0xeee101e7U, 0x0d42d0edU, 0x183d050bU, 0xe24dc0d0U, 0xeaff0e15U, 0xf5d9fd0cU,
+  0x07f100ccU, 0x1de000adU, 0x0e530013U, 0x00ee0033U, 0x23040bf4U, 0xfd4614f7U, 0xea11f5f6U, 0x16cbfc0fU,
+  0xf619ce00U, 0x02e70400U, 0x2f02f600U, 0x02f31400U, 0x00ca0be3U, 0x00e298d3U, 0x000a20e0U, 0x00f21e24U,
+  0x040601d9U, 0x2115e0e7U, 0xf518f813U, 0x08fb1cf9U, 0xe4ad18fbU, 0xd40130c1U, 0x13d0fa08U, 0xf413f5fcU,
+  0xff2606f1U, 0xf6daf5faU, 0xea1ee8d5U, 0x0b46d104U, 0x012a071eU, 0xf63ce7daU, 0xf2100d27U, 0xffcce7deU,
+  0x13f500bcU, 0x11e200c4U, 0x064000f4U, 0xace600fbU, 0x4c1e2512U, 0xdb38041bU, 0x1dff22dfU, 0x65dff8f4U,
+  0x030ce700U, 0x14e30600U, 0xfaf7f300U, 0xfe061000U, 0x00f00ecfU, 0x00d103bbU, 0x002d0d12U, 0x00dbf945U,
+  0x162d01f3U, 0x4412e6c2U, 0x030a2c2aU, 0xc4d42af9U, 0xf2c7f803U, 0xd6fb30e3U, 0xffaa28f9U, 0x1e251b2fU,
+  0x1321ec25U, 0x13c515dfU, 0xef43b3e6U, 0xf929dae0U, 0x1b24142dU, 0x284fead7U, 0x0b431efbU, 0x26ac0cf5U,
+  0x14fc00eaU, 0xc0f400e9U, 0x26030023U, 0x2dee00efU, 0x4013c6d4U, 0xdcf22112U, 0xe71d0ff3U, 0x051ad8cfU,
+  0xf252df00U, 0x18c5fd00U, 0x14f42300U, 0x06d5f300U, 0x00f97c03U, 0x00d7e71dU, 0x00d0fd26U, 0x001a7900U,
+  0x3818b128U, 0x1801f2c2U, 0xe42b0c42U, 0x0de05027U, 0x02f0bde4U, 0x00df3bf2U, 0x1a1105ffU, 0xe6d11c2bU,
+  0xc84a3decU, 0x185ece2dU, 0xedddfcf1U, 0x263604ebU, 0xcfbe0f32U, 0x0c19eb0cU, 0x1f1b1102U, 0x14e82f15U,
+  0x1b2200f5U, 0xbdf100ebU, 0x24f30018U, 0x5d070000U, 0x1e06e8b4U, 0x17162c05U, 0xd04fff46U, 0xf605d602U,
+  0xc953e100U, 0xf3f9fa00U, 0x1fe30900U, 0x01e82900U, 0x00d32a31U, 0x0002f629U, 0x00bafd05U, 0x00216021U,
+  0x1b0bb807U, 0x07f503ccU, 0xfcfbf326U, 0x31ff4317U, 0xf60bd4dcU, 0x05f4fadcU, 0x2e080beeU, 0xb7e10821U,
+  0xfc48faf3U, 0xfe6acf11U, 0xd20f14f2U, 0x0044db1cU, 0xe2e80e34U, 0x24edef05U, 0xf72504f0U, 0x17e83611U,
+  0xfcdf00ccU, 0xcdd500e8U, 0x0e0b0003U, 0x4526001cU, 0x0d15e2a5U, 0x4523153aU, 0xb2030834U, 0x070ff2e5U,
+  0xc648e300U, 0xae0ff300U, 0x42dd0900U, 0xdbd43300U, 0x00bb3140U, 0x000b031fU, 0x00f527f3U, 0x001e341cU,
+  0x1403d4edU, 0x01fefebcU, 0x06bc1338U, 0x4c14181aU, 0xeef3ebe4U, 0xf50fc0cbU, 0xfae2f504U, 0xb90fe4f3U,
+  0x001b05e5U, 0xf10b022dU, 0xca1c11d9U, 0xfd3506faU, 0x1222161bU, 0x2cc0d1f5U, 0xcd0703ddU, 0xdcd81306U,
+  0x10b900d2U, 0xebd100dfU, 0x04eb004dU, 0x0e2900f6U, 0x420019bdU, 0x2525f627U, 0xded9f0f6U, 0x24ec1910U,
+  0xb9fd0900U, 0xccf9e800U, 0x41e63a00U, 0xffcb5100U, 0x00f03226U, 0x000e0313U, 0x00fc3905U, 0x0002e6d9U,
+  0x1811defaU, 0xfa00e3e2U, 0x15dc2f56U, 0x0017e009U, 0xd9c1dee8U, 0x1819d5d1U, 0xe0f03bf9U, 0xecfedf17U,
+  0xff27031aU, 0xebef1d0bU, 0xdc2be0b4U, 0x1621f8e4U, 0x24e714d4U, 0x10b6cf05U, 0xe30d05efU, 0xc711f308U,
+  0x1abd00caU, 0x1d04009bU, 0xfcdd0007U, 0xf8ff00d2U, 0x57f439d1U, 0xf9253006U, 0xfae40eebU, 0x2211f803U,
+  0xf9cd1a00U, 0x12daf300U, 0xf3d54c00U, 0xf1ec2700U, 0x00e422fdU, 0x00e432e6U, 0x00121810U, 0x00f2e0cdU,
+  0xee2ccf1eU, 0x3e13e8ceU, 0x20f55626U, 0x1dd5d5f2U, 0xccd10503U, 0xeac0f2d2U, 0xbec95dfaU, 0x132ee63aU,
+  0x0634cb21U, 0x03c81b23U, 0xf16e91cbU, 0x1a26e1e5U, 0x1df8e2e6U, 0x0c10ee05U, 0xda2f0dc6U, 0xc6f8ff27U,
+  0x1dde00eeU, 0xe7c900feU, 0x270d00fcU, 0x22f400e1U, 0xc114dff2U, 0xc8a436e5U, 0x31f739fdU, 0x1eebfdfbU,
+  0xeef5eb00U, 0x33cde500U, 0xffff2200U, 0x0eda1a00U, 0x00e84adaU, 0x0000edf5U, 0x009d1716U, 0x002e12f8U,
+  0x2d1dd11dU, 0x050fc1d9U, 0xeffcbff5U, 0xfc1111fcU, 0xf2c1f11aU, 0xfcec37faU, 0x1d210718U, 0x04e33d22U,
+  0xdc51e7e9U, 0x0dd5cf0fU, 0xf8d20bcbU, 0x172bda18U, 0xf7ca3ff3U, 0x1414bfe1U, 0x182ab81eU, 0x0d01e612U,
+  0x48d800f9U, 0x26ad0003U, 0x2dd900eaU, 0x2b0c0010U, 0xd41bf6eeU, 0x3ab919eeU, 0xeded0000U, 0x0104ed10U,
+  0xee1ddf00U, 0x47f8e500U, 0x200cfc00U, 0xe6c71200U, 0x00d266e7U, 0x00faf6e0U, 0x00b4180aU, 0x00291211U,
+  0x2f0df318U, 0x0914f6e0U, 0xe8ecde07U, 0xf61520ddU, 0xf0dbd717U, 0xe6ff2ce5U, 0x28fb15e5U, 0x19e53fffU,
+  0xff66c1f6U, 0x31cecc00U, 0xe3f2f7ccU, 0x1818e22aU, 0x08ef3ff8U, 0x1d09f4faU, 0xde28c717U, 0xf209e119U,
+  0x3dc400e2U, 0x28c60000U, 0x49d600eaU, 0x1a04001aU, 0xf0efffccU, 0x12f80306U, 0xfbde04ccU, 0xffd027faU,
+  0xc4060100U, 0x30f21900U, 0x3efce000U, 0xf381f000U, 0x00d644ebU, 0x00fec107U, 0x00ef3fc9U, 0x0015d505U,
+  0x0711fd1cU, 0xfcf1f425U, 0x45dbe70cU, 0xd0f41dd9U, 0xdaf2cd1dU, 0x0021fbe4U, 0xfad805fbU, 0x10eb00e6U,
+  0xf24bb923U, 0x1608c534U, 0xc4f1efb8U, 0x1a1a051bU, 0xdef04015U, 0x1ecd05e9U, 0xc142ccc7U, 0xf30cd01dU,
+  0x23a700f5U, 0x11fa00daU, 0x4ac800ccU, 0xf60100e3U, 0xe9fa03ceU, 0xf721ff00U, 0x0cd5f0f4U, 0x20e4f901U,
+  0xf5ff3200U, 0x13072800U, 0x3fdf1900U, 0x1ea20d00U, 0x00ed1c12U, 0x00caf300U, 0x00ee17b9U, 0x0023e5d5U,
+  0x010af22bU, 0x21efe72aU, 0x49040827U, 0xf3011cbcU, 0xefe6fb17U, 0x13091408U, 0xd0ce27efU, 0x0100f7ebU,
+  0xf629d226U, 0x1818af15U, 0xdb1ce1b3U, 0x100637f5U, 0x16e918d8U, 0x33cc01ceU, 0xbc19e1c4U, 0xba20f72bU,
+  0x0fb600efU, 0xf5f400baU, 0x2fca0099U, 0x0ff300d0U, 0xeff516ceU, 0x070c06c9U, 0x0f1ef202U, 0x12e5fcdbU,
+  0xfdee2900U, 0xf4ea1600U, 0x0fc61600U, 0x04ca1c00U, 0x00e4ecbcU, 0x00d908dbU, 0x00ff1f95U, 0x001cf990U,
+  0x3a0be040U, 0xf704f6f9U, 0x781509beU, 0x1414f8b5U, 0xf5f5fe0eU, 0xf8d9fcffU, 0xdbc62c07U, 0xf61fe6faU,
+  0x023edde0U, 0xe821c3f2U, 0xfa48d3e4U, 0x23e709faU, 0xee0ce1d1U, 0x34def4eeU, 0xa738f4e1U, 0xadf2f502U,
+  0x0adc00e3U, 0x00ec0040U, 0x0227001bU, 0x16f700edU, 0xa102d3edU, 0xe7ec1ad5U, 0x5dc8f1fcU, 0xf5cb142aU,
+  0xfb1fff00U, 0xed03f200U, 0x050b1a00U, 0x08e00a00U, 0x0003fbb6U, 0x00cd0bcfU, 0x00d8f7e8U, 0x0022d8fdU,
+  0xfefac202U, 0xff06d6f5U, 0xdaedf612U, 0xe608f008U, 0xfe15e608U, 0xebd236f9U, 0xef12e80dU, 0x14083a00U,
+  0xf3fdd1f2U, 0x01c5efdfU, 0xfbcf18d2U, 0x36e7d71bU, 0xfaf417d4U, 0x25df0efcU, 0xfb19f524U, 0xd323d21cU,
+  0x1dd4000cU, 0x25da00f6U, 0xf01400f3U, 0xf8020009U, 0xf6ff0105U, 0x46bf19deU, 0x4bb016f2U, 0x26ca1b38U,
+  0x0acaf000U, 0x1234bc00U, 0x02220000U, 0x08ea1b00U, 0x00f9f7a1U, 0x00c807b6U, 0x0003e0d6U, 0x0002e115U,
+  0x4903be0cU, 0xf4e9e4e3U, 0xcd4cf80aU, 0x9d1c0ff2U, 0xbe08060eU, 0xd8fc43f2U, 0xfa11e0fcU, 0x290145daU,
+  0x20f2b228U, 0x17a9c1d6U, 0xf4ce2cbaU, 0x30efcb22U, 0x09f847e3U, 0x0002061aU, 0xdc1a0d38U, 0xf735cc36U,
+  0x2ead00f1U, 0x70de00ceU, 0x252500e2U, 0xf31f0028U, 0xd10915e3U, 0x31ebe1e3U, 0x6ed80ac9U, 0x1eba0731U,
+  0x3fe22700U, 0xfc31ec00U, 0x193cc700U, 0x09c5d900U, 0x00e816a6U, 0x00bd08c6U, 0x001ce9a1U, 0x0015f92aU,
+  0x332cf42dU, 0x0fe1fbfcU, 0x074ce5daU, 0xba0ef9e8U, 0xb015f50cU, 0xda301ce7U, 0xdbfcf5efU, 0x32ff30f2U,
+  0x1a21a910U, 0x1dc6cefaU, 0xf8c51cd4U, 0x0adfe30eU, 0xd3fc09ffU, 0x0cf21406U, 0xb91ff414U, 0xf635d320U,
+  0x0d9400e1U, 0x5aed00c8U, 0x450900d4U, 0x0f150017U, 0xce16f7daU, 0x04ffc5dcU, 0x7bee1eceU, 0x53d204ecU,
+  0x02004c00U, 0x062e0500U, 0x2df1b300U, 0x21ddb800U, 0x00ed0aacU, 0x00cc1cc0U, 0x001dc581U, 0x0029fff3U,
+  0x4948ec51U, 0x25e4e812U, 0x3733f6d1U, 0xe72006d1U, 0xc91de3faU, 0xdb231105U, 0xd2ede7faU, 0x0ef4f6faU,
+  0x0e37d605U, 0x1be8e1e7U, 0x09ff3ad6U, 0x03b71dfdU, 0xeed0f107U, 0x040b070cU, 0x8f180304U, 0xca1b0521U,
+  0x27bf00d6U, 0x0b1600e6U, 0x17e300c7U, 0x33ff000aU, 0xb710f1e9U, 0xf5e9e2e8U, 0x480a0ff1U, 0x38f60af0U,
+  0x06034000U, 0x01ee1a00U, 0x10cfc100U, 0xfde3cf00U, 0x00e2fcb8U, 0x00f4f3e7U, 0x00181193U, 0x0009f9b3U,
+  0x5940ee2dU, 0xfcdd0302U, 0x223404bdU, 0x031c0fccU, 0xd3050610U, 0xe6fcfffeU, 0xcfe70405U, 0xd6fbfcdbU,
+  0x0925e6f1U, 0xf3fcf5e5U, 0x1be50f04U, 0x15be140cU, 0xcbdcf6d2U, 0x0e0f09edU, 0xc91300feU, 0xc8f9010aU,
+  0x1f13000eU, 0xdbdd0052U, 0x00000000U, 0x00000000U, 0x22f3fd08U, 0xff1000dcU, 0x00000000U, 0x00000000U,
+  0xf911fc00U, 0x042c1f00U, 0x00000000U, 0x00000000U, 0x00fb350fU, 0x0016221cU, 0x00000000U, 0x00000000U,
+  0xfb2a2af5U, 0xf0011534U, 0x00000000U, 0x00000000U, 0x0300f91fU, 0x05280cedU, 0x00000000U, 0x00000000U,
+  0xf2310b13U, 0x3de5dc20U, 0x00000000U, 0x00000000U, 0xf9e3060bU, 0x05db01fdU, 0x00000000U, 0x00000000U,
+  0x1b110018U, 0x14ea0062U, 0x00000000U, 0x00000000U, 0x24d2f2f6U, 0x22f4f2e6U, 0x00000000U, 0x00000000U,
+  0xed070600U, 0xf1e94a00U, 0x00000000U, 0x00000000U, 0x00ec2336U, 0x001d182dU, 0x00000000U, 0x00000000U,
+  0xe91d2c0aU, 0xf7021e0eU, 0x00000000U, 0x00000000U, 0x1a120a0fU, 0xfb26e9e5U, 0x00000000U, 0x00000000U,
+  0x1017f809U, 0x2f0cca0bU, 0x00000000U, 0x00000000U, 0x17d21d02U, 0x2bd4dcedU, 0x00000000U, 0x00000000U,
+  0x213b002eU, 0x2e080057U, 0x00000000U, 0x00000000U, 0x40cde3e1U, 0x02eaefefU, 0x00000000U, 0x00000000U,
+  0xe2273100U, 0xf7ca6700U, 0x00000000U, 0x00000000U, 0x00fa2814U, 0x001f0635U, 0x00000000U, 0x00000000U,
+  0xdafc0d1bU, 0xf7f903e0U, 0x00000000U, 0x00000000U, 0x111cf925U, 0x0206dff7U, 0x00000000U, 0x00000000U,
+  0x1722f906U, 0x34ffe6f7U, 0x00000000U, 0x00000000U, 0x11e0180bU, 0x13d0dbdbU, 0x00000000U, 0x00000000U,
+  0x23440014U, 0x25ee001aU, 0x00000000U, 0x00000000U, 0x1dd3ecf3U, 0xe5eff8f1U, 0x00000000U, 0x00000000U,
+  0xdf103e00U, 0xf2dd4200U, 0x00000000U, 0x00000000U, 0x000d0e1eU, 0x001d1045U, 0x00000000U, 0x00000000U,
+  0xc9f5fcfeU, 0x03f526f6U, 0x00000000U, 0x00000000U, 0x1915eb18U, 0x14f5f9ecU, 0x00000000U, 0x00000000U,
+  0x132a052fU, 0x07090ff3U, 0x00000000U, 0x00000000U, 0xddeefd0eU, 0xfbced7b6U, 0x00000000U, 0x00000000U,
+  0x271e0009U, 0x13d90014U, 0x00000000U, 0x00000000U, 0x02fa03f4U, 0xd3def8edU, 0x00000000U, 0x00000000U,
+  0xe2031900U, 0xd6d22800U, 0x00000000U, 0x00000000U, 0x00fc0c0eU, 0x0034ff3aU, 0x00000000U, 0x00000000U,
+  0xe8faf311U, 0xe9fffdf6U, 0x00000000U, 0x00000000U, 0x15fef30cU, 0xf70adbf0U, 0x00000000U, 0x00000000U,
+  0x0c14f914U, 0xfe1c0ff9U, 0x00000000U, 0x00000000U, 0xe3fe00ffU, 0xadc9c8dfU, 0x00000000U, 0x00000000U,
+  0x25ef00fdU, 0x150b003eU, 0x00000000U, 0x00000000U, 0x280302f2U, 0xfad3eaf4U, 0x00000000U, 0x00000000U,
+  0xfac6fd00U, 0x03dd4b00U, 0x00000000U, 0x00000000U, 0x00d93519U, 0x00011c38U, 0x00000000U, 0x00000000U,
+  0xfb2a0ae6U, 0xd80c03f0U, 0x00000000U, 0x00000000U, 0x1700f915U, 0x1631fd1cU, 0x00000000U, 0x00000000U,
+  0x140bf70bU, 0x390adc34U, 0x00000000U, 0x00000000U, 0x07d0f403U, 0x28efe8f2U, 0x00000000U, 0x00000000U,
+  0x2e0600f9U, 0x28070052U, 0x00000000U, 0x00000000U, 0x19fbf0e7U, 0x0ee5f31bU, 0x00000000U, 0x00000000U,
+  0x04dd0c00U, 0xfbd75b00U, 0x00000000U, 0x00000000U, 0x0000331cU, 0x000a1d1cU, 0x00000000U, 0x00000000U,
+  0xe70718f6U, 0xaef71ce3U, 0x00000000U, 0x00000000U, 0x0afbeb2eU, 0xdd04fb28U, 0x00000000U, 0x00000000U,
+  0x1a1fc415U, 0x2616c513U, 0x00000000U, 0x00000000U, 0xebd1fff4U, 0x2aea1508U, 0x00000000U, 0x00000000U,
+  0x263500f5U, 0x23fc004eU, 0x00000000U, 0x00000000U, 0x09dbd2e4U, 0x09300ee5U, 0x00000000U, 0x00000000U,
+  0xe9ea2d00U, 0x2cd93c00U, 0x00000000U, 0x00000000U, 0x00082a0aU, 0x00f92218U, 0x00000000U, 0x00000000U,
+  0x07fa06ebU, 0xee1805e8U, 0x00000000U, 0x00000000U, 0xe304d117U, 0xe5f129faU, 0x00000000U, 0x00000000U,
+  0x182dd910U, 0x0913a716U, 0x00000000U, 0x00000000U, 0xcce20707U, 0x0af735faU, 0x00000000U, 0x00000000U,
+  0x11340003U, 0x19030015U, 0x00000000U, 0x00000000U, 0xf7d9de00U, 0x1503dc02U, 0x00000000U, 0x00000000U,
+  0xebe00900U, 0x47021a00U, 0x00000000U, 0x00000000U, 0x00161004U, 0x00fe03f4U, 0x00000000U, 0x00000000U,
+  0x08100afbU, 0x0a3a1af5U, 0x00000000U, 0x00000000U, 0xe5f6ef0cU, 0xf33c10f6U, 0x00000000U, 0x00000000U,
+  0x1f3bef05U, 0xee07ecfcU, 0x00000000U, 0x00000000U, 0xd5fc0d19U, 0xea061dd3U, 0x00000000U, 0x00000000U,
+  0x1b44001dU, 0xf71f00fbU, 0x00000000U, 0x00000000U, 0xfaf412e6U, 0x1bcde6f5U, 0x00000000U, 0x00000000U,
+  0xef01fc00U, 0x03e5e900U, 0x00000000U, 0x00000000U, 0x000bf902U, 0x00330606U, 0x00000000U, 0x00000000U,
+  0x0618fe17U, 0xee34f7f1U, 0x00000000U, 0x00000000U, 0xf6f1f106U, 0xe71ffdfaU, 0x00000000U, 0x00000000U,
+  0xfa2ed80fU, 0xe2e219d5U, 0x00000000U, 0x00000000U, 0xe90c1016U, 0xc9f81d15U, 0x00000000U, 0x00000000U,
+  0x470000f1U, 0x2b070014U, 0x00000000U, 0x00000000U, 0xf309d2e7U, 0xdcbc0410U, 0x00000000U, 0x00000000U,
+  0x02ccff00U, 0x06fb3900U, 0x00000000U, 0x00000000U, 0x00134200U, 0x00b80805U, 0x00000000U, 0x00000000U,
+  0x07192bf4U, 0xcc06bcedU, 0x00000000U, 0x00000000U, 0x25eae830U, 0xfe271127U, 0x00000000U, 0x00000000U,
+  0xf5f0e4e6U, 0x53e4e00bU, 0x00000000U, 0x00000000U, 0xf2c506e6U, 0x0d1dd0f9U, 0x00000000U, 0x00000000U,
+  0x1a2a0001U, 0x1cdf0012U, 0x00000000U, 0x00000000U, 0x0007daf3U, 0xe5e8142dU, 0x00000000U, 0x00000000U,
+  0xfde00a00U, 0x28ed0f00U, 0x00000000U, 0x00000000U, 0x000857e5U, 0x00d815d2U, 0x00000000U, 0x00000000U,
+  0x0a0222e2U, 0xd60f09f6U, 0x00000000U, 0x00000000U, 0xfde6ea4eU, 0xfd114114U, 0x00000000U, 0x00000000U,
+  0xfaf9f1e2U, 0x12fae1fdU, 0x00000000U, 0x00000000U, 0xe1f316ecU, 0xef12ddf6U, 0x00000000U, 0x00000000U,
+  0x161700f2U, 0x050f0044U, 0x00000000U, 0x00000000U, 0x09fd0c0fU, 0xdce32afbU, 0x00000000U, 0x00000000U,
+  0xd7d9f500U, 0x3abdf700U, 0x00000000U, 0x00000000U, 0x001b39faU, 0x00dcf0dcU, 0x00000000U, 0x00000000U,
+  0x06151dbbU, 0x060c2734U, 0x00000000U, 0x00000000U, 0xfde9db24U, 0xfe0a4506U, 0x00000000U, 0x00000000U,
+  0x010df2ecU, 0xe329e9e3U, 0x00000000U, 0x00000000U, 0xb8172909U, 0x0b2cfbfbU, 0x00000000U, 0x00000000U,
+  0x13f7000cU, 0xfcf90021U, 0x00000000U, 0x00000000U, 0x030b20f9U, 0xd30cf315U, 0x00000000U, 0x00000000U,
+  0xdde4ee00U, 0x40f8e400U, 0x00000000U, 0x00000000U, 0x001c10f2U, 0x0003daddU, 0x00000000U, 0x00000000U,
+  0x132118e5U, 0x2e0543f7U, 0x00000000U, 0x00000000U, 0xf2d61b02U, 0x2c1859f4U, 0x00000000U, 0x00000000U,
+  0x0223e3e6U, 0xcf0324d5U, 0x00000000U, 0x00000000U, 0xd60b1703U, 0x0a512a32U, 0x00000000U, 0x00000000U,
+  0x2323000cU, 0xe52200daU, 0x00000000U, 0x00000000U, 0x0d1f19edU, 0xf8e3df39U, 0x00000000U, 0x00000000U,
+  0x00edf400U, 0x46faea00U, 0x00000000U, 0x00000000U, 0x00340bedU, 0x002beac9U, 0x00000000U, 0x00000000U,
+  0x0f22343bU, 0x2af905d4U, 0x00000000U, 0x00000000U, 0xd5d22aeaU, 0x010225e6U, 0x00000000U, 0x00000000U,
+  0xf630d1f6U, 0xdcad35f3U, 0x00000000U, 0x00000000U, 0x031c170fU, 0xf0391a3fU, 0x00000000U, 0x00000000U,
+  0x43e500e9U, 0x0b130005U, 0x00000000U, 0x00000000U, 0xb312fa0dU, 0xea9d13fdU, 0x00000000U, 0x00000000U,
+  0x28f7e600U, 0x08001400U, 0x00000000U, 0x00000000U, 0x0012000bU, 0x00badffcU, 0x00000000U, 0x00000000U,
+  0x01041a11U, 0xbffdb7f8U, 0x00000000U, 0x00000000U, 0x1bea2601U, 0xec2e0517U, 0x00000000U, 0x00000000U,
+  0xe9efc3fbU, 0x27c2fdf0U, 0x00000000U, 0x00000000U, 0xf6f301d0U, 0xf111c014U, 0x00000000U, 0x00000000U,
+  0xf1fc00efU, 0x16ed0006U, 0x00000000U, 0x00000000U, 0xc0f1f303U, 0x02813019U, 0x00000000U, 0x00000000U,
+  0xf721d700U, 0x2f08f000U, 0x00000000U, 0x00000000U, 0x00090619U, 0x00cdddceU, 0x00000000U, 0x00000000U,
+  0xd7e62df9U, 0xe315dceaU, 0x00000000U, 0x00000000U, 0xfbf80bffU, 0xd11d3decU, 0x00000000U, 0x00000000U,
+  0x03eae8efU, 0x1cccfe0fU, 0x00000000U, 0x00000000U, 0x121904e6U, 0xde1ab7d2U, 0x00000000U, 0x00000000U,
+  0xf5f00011U, 0x101100faU, 0x00000000U, 0x00000000U, 0xfae2040bU, 0x20bc4b32U, 0x00000000U, 0x00000000U,
+  0xf2f9d700U, 0x2312fc00U, 0x00000000U, 0x00000000U, 0x001ef51fU, 0x00e0d6c6U, 0x00000000U, 0x00000000U,
+  0xe0f14cf1U, 0xe30502eeU, 0x00000000U, 0x00000000U, 0xeff30be2U, 0xde2844d2U, 0x00000000U, 0x00000000U,
+  0x03f910fbU, 0x16f7f7ebU, 0x00000000U, 0x00000000U, 0x1b0d10e4U, 0xd324e1eeU, 0x00000000U, 0x00000000U,
+  0x01ee0019U, 0xeb1c00fdU, 0x00000000U, 0x00000000U, 0x0af316fcU, 0x24ee434eU, 0x00000000U, 0x00000000U,
+  0x2bdfe200U, 0x43e0dc00U, 0x00000000U, 0x00000000U, 0x00250d19U, 0x000a06c9U, 0x00000000U, 0x00000000U,
+  0xf30e3929U, 0xfeec1c02U, 0x00000000U, 0x00000000U, 0xeaca23fcU, 0xedf747dbU, 0x00000000U, 0x00000000U,
+  0xf10bfdf6U, 0xf4ec24dfU, 0x00000000U, 0x00000000U, 0x1c1210d6U, 0xac4d1211U, 0x00000000U, 0x00000000U,
+  0xfd010012U, 0x171200e8U, 0x00000000U, 0x00000000U, 0x21f70f1bU, 0x17f91a05U, 0x00000000U, 0x00000000U,
+  0x31dcf000U, 0x2ee09c00U, 0x00000000U, 0x00000000U, 0x002c1306U, 0x00271cb6U, 0x00000000U, 0x00000000U,
+  0x0f0b3244U, 0x1c09efa6U, 0x00000000U, 0x00000000U, 0xdfc436e6U, 0x13c419d2U, 0x00000000U, 0x00000000U,
+  0xfd19ddf3U, 0xf29346f5U, 0x00000000U, 0x00000000U, 0x0b2cf8eaU, 0xe7141b29U, 0x00000000U, 0x00000000U,
+  0xfae700f1U, 0xe2ed0045U, 0x00000000U, 0x00000000U, 0x81031c10U, 0x0cd6d5c7U, 0x00000000U, 0x00000000U,
+  0x10ecf000U, 0xf3120e00U, 0x00000000U, 0x00000000U, 0x000bccffU, 0x00f1331eU, 0x00000000U, 0x00000000U,
+  0x1f01f110U, 0xd1fdfb10U, 0x00000000U, 0x00000000U, 0x03113cf7U, 0xd932e1e8U, 0x00000000U, 0x00000000U,
+  0x0aeee906U, 0x10e90ef3U, 0x00000000U, 0x00000000U, 0xf138f3f1U, 0xece8f20dU, 0x00000000U, 0x00000000U,
+  0xeee300fdU, 0x031100ffU, 0x00000000U, 0x00000000U, 0xaffbea12U, 0x3fc1ddfaU, 0x00000000U, 0x00000000U,
+  0x3c19f500U, 0x11db0c00U, 0x00000000U, 0x00000000U, 0x0007de11U, 0x00f319e9U, 0x00000000U, 0x00000000U,
+  0xeefa012aU, 0xf740eaf6U, 0x00000000U, 0x00000000U, 0x0a1043dfU, 0xc04dfcd4U, 0x00000000U, 0x00000000U,
+  0x0403cb02U, 0x21d9160bU, 0x00000000U, 0x00000000U, 0x0813f8edU, 0xf400d816U, 0x00000000U, 0x00000000U,
+  0xe6ef0016U, 0x1b5500d6U, 0x00000000U, 0x00000000U, 0xedcfe911U, 0x5deddf2cU, 0x00000000U, 0x00000000U,
+  0x37130100U, 0x56d1d700U, 0x00000000U, 0x00000000U, 0x0008ec10U, 0x0011febcU, 0x00000000U, 0x00000000U,
+  0xdae41638U, 0xf5320dd7U, 0x00000000U, 0x00000000U, 0x010034e2U, 0xaa4e06c6U, 0x00000000U, 0x00000000U,
+  0xfefd0208U, 0x18df21f2U, 0x00000000U, 0x00000000U, 0x1927f503U, 0xac15f3f9U, 0x00000000U, 0x00000000U,
+  0xfae80012U, 0x1c0d00deU, 0x00000000U, 0x00000000U, 0x05e1fcf7U, 0x69f10415U, 0x00000000U, 0x00000000U,
+  0x2bfc0900U, 0x28a88f00U, 0x00000000U, 0x00000000U, 0x0009180dU, 0x000ff6b0U, 0x00000000U, 0x00000000U,
+  0x130c1036U, 0x1a3c12d5U, 0x00000000U, 0x00000000U, 0xe4d433f5U, 0xaf09f4c5U, 0x00000000U, 0x00000000U,
+  0x0411020bU, 0x1de02df2U, 0x00000000U, 0x00000000U, 0x1720ffedU, 0xb303f802U, 0x00000000U, 0x00000000U,
+  0xf9fe0016U, 0x70ea00edU, 0x00000000U, 0x00000000U, 0x14f80c0fU, 0x78ef09f6U, 0x00000000U, 0x00000000U,
+  0x0cf20900U, 0xe8b89f00U, 0x00000000U, 0x00000000U, 0x000b0c15U, 0x0000ccb2U, 0x00000000U, 0x00000000U,
+  0xfb081311U, 0x073216caU, 0x00000000U, 0x00000000U, 0xe9e61408U, 0x94e30eceU, 0x00000000U, 0x00000000U,
+  0x05f6eefeU, 0x08a20df4U, 0x00000000U, 0x00000000U, 0xf72607d8U, 0x10e7050aU, 0x00000000U, 0x00000000U,
+};
+#elif APP_KERNEL_DENSE == KERNEL_DENSE_INT4
+// gemm_5 4-bit per row in 4-row blocks, see kernel_weights.h
+const uint32_t kernel_gemm_5_int4[12800] __attribute__((aligned(16), section(".ai_weights"))) = {
+  0x00f100e3U, 0x00000000U, 0x211f011fU, 0x0f0f00e0U, 0xf00eef0fU, 0x00000000U, 0x00030002U, 0x00d21e00U,
+  0x000103c0U, 0x00000000U, 0x10202410U, 0x0001f3eeU, 0x1000f000U, 0x00000000U, 0x1202f0e0U, 0x31e11e20U,
+  0xf0b20f04U, 0x00000000U, 0x210e0010U, 0x103d02cfU, 0x100fcc00U, 0x00000000U, 0x00f30003U, 0x00c31d00U,
+  0x11f132e0U, 0x00000000U, 0x2102232eU, 0xfd2015c0U, 0x1301f310U, 0x00000000U, 0x042400e0U, 0x43c30100U,
+  0xf1a10d04U, 0x00000000U, 0x01fe0f0dU, 0x312a02eeU, 0x1002cd00U, 0x00000000U, 0x10fff002U, 0x10c2dd00U,
+  0x12f022ffU, 0x00000000U, 0x60e0140eU, 0xdd2202d1U, 0x12100121U, 0x00000000U, 0x14352ef0U, 0x33a30100U,
+  0xf0b10f12U, 0x00000000U, 0x0f0f0fedU, 0x320d0021U, 0x1000cf01U, 0x00000000U, 0x200d0f04U, 0xf0d2e000U,
+  0x13f02111U, 0x00000000U, 0x52e0d1f0U, 0xcd2f22f0U, 0x022e0e2fU, 0x00000000U, 0xf14420f2U, 0x22b0ff00U,
+  0x01b20010U, 0x00000000U, 0x0ff200e0U, 0x33fe0010U, 0x100fe002U, 0x00000000U, 0x001f0002U, 0xf012e20eU,
+  0x13f02010U, 0x00000000U, 0x22e3d1e0U, 0xff2f0000U, 0x003e1022U, 0x00000000U, 0x0f513f02U, 0x11cfe201U,
+  0xe1f000e1U, 0x00000000U, 0x1210012fU, 0xf05e03e1U, 0xf0fffe0fU, 0x00000000U, 0x00231f01U, 0x00111d0fU,
+  0x0002f2cfU, 0x00000000U, 0x2f21132eU, 0x2f00e2efU, 0x11ffee1fU, 0x00000000U, 0x0323f000U, 0x12f41f00U,
+  0xe0d200f1U, 0x00000000U, 0x321f010fU, 0xe05e04c0U, 0x00f00c00U, 0x00000000U, 0x00011f02U, 0x1002fc0dU,
+  0x311313e0U, 0x00000000U, 0x3011f44dU, 0x1b12f2f0U, 0x13e0e02eU, 0x00000000U, 0x10330f11U, 0x23d41ff0U,
+  0x01d20ce3U, 0x00000000U, 0x101101cfU, 0x120d03efU, 0x00110c0eU, 0x00000000U, 0x201e0f01U, 0x10c1de0dU,
+  0x001320f0U, 0x00000000U, 0x5f00d13eU, 0xea01f1f2U, 0x03ef0f30U, 0x00000000U, 0x0f152111U, 0x439201f0U,
+  0x0fb20d12U, 0x00000000U, 0xee1300b0U, 0x3100021cU, 0x101e1f0dU, 0x00000000U, 0x000d000fU, 0x10d1f00eU,
+  0xf101ff21U, 0x00000000U, 0x40e1bef1U, 0xec1e04f0U, 0x100dff5fU, 0x00000000U, 0x00036f22U, 0x22a2e3e0U,
+  0xfe920ff1U, 0x00000000U, 0x0e2100dfU, 0x332e0110U, 0x200d0101U, 0x00000000U, 0xf01eff0dU, 0x10e2000dU,
+  0x2010ee03U, 0x00000000U, 0x2e0391e1U, 0xde3e12eeU, 0x1e2ce13eU, 0x00000000U, 0x20f23003U, 0x03b1e0ffU,
+  0xcf1001e0U, 0x00000000U, 0x132f01f0U, 0xe12000f1U, 0x00e0fe0fU, 0x00000000U, 0x10201000U, 0x10300e0eU,
+  0xf011d0e0U, 0x00000000U, 0x1e10e41eU, 0x4d00f00eU, 0x1100fe20U, 0x00000000U, 0x11430e22U, 0x0013e002U,
+  0xf1110001U, 0x00000000U, 0x121001f0U, 0xe00e01e0U, 0xf02f1c0fU, 0x00000000U, 0x101e0000U, 0x0010ef0eU,
+  0x1112eee1U, 0x00000000U, 0x3f1fe31eU, 0x1ef0f1fdU, 0x000f0e22U, 0x00000000U, 0x1e130f02U, 0x20210f02U,
+  0x02ff0e02U, 0x00000000U, 0xf01f01c2U, 0x00fd01f0U, 0xf0202e0eU, 0x00000000U, 0x30fef100U, 0x0001df0eU,
+  0xe112eef0U, 0x00000000U, 0x021fe000U, 0xec0ff3eeU, 0xf1ff0e21U, 0x00000000U, 0x10024f04U, 0x32f1f01fU,
+  0x1fee0eefU, 0x00000000U, 0xf01f0fc0U, 0x111f010fU, 0x100f1f0fU, 0x00000000U, 0xf0e0ff02U, 0x10f0e10fU,
+  0xf321ed02U, 0x00000000U, 0xe211cfc0U, 0xed0d022fU, 0x20ffef00U, 0x00000000U, 0x21ee5e34U, 0x00f210ffU,
+  0xfdc10edeU, 0x00000000U, 0x001e01ffU, 0x241f03ffU, 0x10ee310eU, 0x00000000U, 0x10e1ef00U, 0x00e0e10eU,
+  0x2242edf2U, 0x00000000U, 0xc130c0efU, 0xef0d210eU, 0x0e4cef2eU, 0x00000000U, 0x23ae3f04U, 0xf2c012eeU,
+  0xef1f01f1U, 0x00000000U, 0x132e02ffU, 0x1f0f0101U, 0x00fefe0fU, 0x00000000U, 0x000f0001U, 0x10f00f0fU,
+  0x0f11c1e0U, 0x00000000U, 0x0f10d3feU, 0x4e100100U, 0x2101ef20U, 0x00000000U, 0x1f53fe32U, 0x0112011fU,
+  0x011f0102U, 0x00000000U, 0x021001f1U, 0x0d10011fU, 0xf00f1d01U, 0x00000000U, 0x30ff0e02U, 0x10e0f001U,
+  0xe212e1e0U, 0x00000000U, 0xf100f1dcU, 0x100001ffU, 0x0fffff12U, 0x00000000U, 0x1e230f21U, 0x11211010U,
+  0x23ee00f0U, 0x00000000U, 0xdf0e00f1U, 0x0d200f02U, 0x00111e0fU, 0x00000000U, 0x20d0fd02U, 0x0000f00fU,
+  0xf3120de1U, 0x00000000U, 0xc1e0e0feU, 0xf110101eU, 0x1eee0cf1U, 0x00000000U, 0x11ff2e20U, 0x1f20113eU,
+  0x22ff0ed0U, 0x00000000U, 0xf1ff00efU, 0x0102011fU, 0x001f010eU, 0x00000000U, 0x20100e02U, 0xf0fe010fU,
+  0xf122fde0U, 0x00000000U, 0xc212e1efU, 0x0f1d0011U, 0x11fd0ef1U, 0x00000000U, 0x13ff2e02U, 0x100e011fU,
+  0x01df0fceU, 0x00000000U, 0x240e001eU, 0x130f021eU, 0x00ec310cU, 0x00000000U, 0x0030010fU, 0xf0ecef0fU,
+  0x1f52ded1U, 0x00000000U, 0xd021f00fU, 0x0efc1f00U, 0x0f0bfe0eU, 0x00000000U, 0x16be0ff0U, 0xf01fe10fU,
+  0x202f0f00U, 0x00000000U, 0xff100f00U, 0x4ef101f0U, 0x00de010eU, 0x00000000U, 0x00def100U, 0x00100f0fU,
+  0xff02d1f0U, 0x00000000U, 0xf201e000U, 0x1f1df1f0U, 0x30f0f011U, 0x00000000U, 0x1f42ff21U, 0xf120f00eU,
+  0x120f0fe1U, 0x00000000U, 0xe01f0ef0U, 0x3de00122U, 0x00fe0e0dU, 0x00000000U, 0x100d0f02U, 0x102f000eU,
+  0xf003e0e0U, 0x00000000U, 0xe2f2f0eeU, 0x0ef00200U, 0x4ee0fe01U, 0x00000000U, 0x2e230e22U, 0x022fe12dU,
+  0x21fe0fb0U, 0x00000000U, 0xe0fd0cf0U, 0x2fe10101U, 0x100d2f0dU, 0x00000000U, 0x202f1f01U, 0x10ee020fU,
+  0xf014fef0U, 0x00000000U, 0xc2f0f1feU, 0xfff12231U, 0x20ef0ee1U, 0x00000000U, 0x1ff2feffU, 0x222fd13eU,
+  0x10de0ebeU, 0x00000000U, 0xe1ee0e0fU, 0x2ff20100U, 0x000d210cU, 0x00000000U, 0x103f2201U, 0x10ef2f0fU,
+  0xf022eeefU, 0x00000000U, 0xf021f100U, 0x0e0f0031U, 0x12eeffe0U, 0x00000000U, 0xf0d2fff0U, 0x110ee11fU,
+  0x0fe00fdfU, 0x00000000U, 0x320f0f2fU, 0x2ef10010U, 0x000c4f0cU, 0x00000000U, 0x103e110fU, 0x00ee0d0eU,
+  0x0f02fedfU, 0x00000000U, 0xff00001fU, 0x1eeff031U, 0x0eedefffU, 0x00000000U, 0x01cfe0f0U, 0xff0fc1efU,
+  0x00000000U, 0x100f00ffU, 0x0f1f011eU, 0x11d10021U, 0x00000000U, 0x000ffd0fU, 0x100e0f02U, 0x001ee002U,
+  0x00000000U, 0x0001e1feU, 0x10f22221U, 0x001210e0U, 0x00000000U, 0x00e200d0U, 0x1114e0f0U, 0x011e0110U,
+  0x00000000U, 0x010d01ffU, 0x0e0f0f41U, 0x01df0e42U, 0x00000000U, 0x0020de0dU, 0x301c0001U, 0xe0102004U,
+  0x00000000U, 0x1e04030eU, 0x21d31230U, 0xf1f2f020U, 0x00000000U, 0xf3d210d1U, 0x2f34ffd0U, 0x101eef2fU,
+  0x00000000U, 0x120c01ffU, 0xfe000f21U, 0xf0e00e30U, 0x00000000U, 0xe011b00fU, 0x30390100U, 0x0012510fU,
+  0x00000000U, 0xeb35f3feU, 0x40c2e221U, 0x02e10231U, 0x00000000U, 0x14d13fe2U, 0x1e251ed1U, 0x0f2edf10U,
+  0x00000000U, 0xf30c010eU, 0xfd120000U, 0x01d30001U, 0x00000000U, 0xf011d102U, 0x102b000fU, 0xf00f410cU,
+  0x00000000U, 0xfc44e1e0U, 0x40d3c111U, 0x12f03010U, 0x00000000U, 0x12cf20e1U, 0x0f241ef1U, 0xfe1ee12fU,
+  0x00000000U, 0xe3fd002fU, 0x1e020fe0U, 0x31e300ffU, 0x00000000U, 0x0002d001U, 0xf00d100dU, 0xf00d110bU,
+  0x00000000U, 0xe023e1e0U, 0x4002b0e0U, 0x2ffd0f1fU, 0x00000000U, 0x02de3fe1U, 0x1f121cf2U, 0xf000f120U,
+  0x00000000U, 0x0000010eU, 0xf02e0000U, 0x2fe10e30U, 0x00000000U, 0x0041ef0eU, 0x200e0e02U, 0x00010102U,
+  0x00000000U, 0x2df1f11eU, 0x30f1e30fU, 0x11103e00U, 0x00000000U, 0xf0f102b1U, 0x1024ed00U, 0x012de21fU,
+  0x00000000U, 0x110d000fU, 0xe11f0f22U, 0x2fe10c31U, 0x00000000U, 0xf031d00eU, 0x103e020fU, 0xe0204600U,
+  0x00000000U, 0x1e06041fU, 0x21f1d03eU, 0xf0002e11U, 0x00000000U, 0xf1f111c2U, 0x1b311c00U, 0x1f0ac15dU,
+  0x00000000U, 0x200c0fffU, 0xd1e10ff2U, 0x00f30d20U, 0x00000000U, 0xe000e200U, 0x004de20fU, 0xc0205300U,
+  0x00000000U, 0xfcf6e2ffU, 0x3002ce21U, 0x10122d01U, 0x00000000U, 0x12d130c3U, 0xde104d11U, 0x1cfce030U,
+  0x00000000U, 0x101d010fU, 0xe0f400e0U, 0x30020f1fU, 0x00000000U, 0x00100302U, 0xd01b0001U, 0xd0f2210dU,
+  0x00000000U, 0x0ce4d3ffU, 0x3002bdf1U, 0x0230fb0fU, 0x00000000U, 0x20f11fe1U, 0x00fd5d22U, 0x0d1ce021U,
+  0x00000000U, 0xe41e0100U, 0x20110f00U, 0x6002002fU, 0x00000000U, 0xf0110003U, 0xe0fdf00eU, 0xe0e3e00aU,
+  0x00000000U, 0xb1f41100U, 0x2112aec0U, 0x0e2bfe4fU, 0x00000000U, 0x12fe2fe1U, 0x0fde4e11U, 0x0fffe211U,
+  0x00000000U, 0x01210efeU, 0xc21f0100U, 0x3ed00e11U, 0x00000000U, 0x0010e30dU, 0x20110e00U, 0x10b1f301U,
+  0x00000000U, 0x3b02202dU, 0x2f0fe30eU, 0xf22f50e2U, 0x00000000U, 0xe00024d2U, 0x0f441f32U, 0xef0ae12fU,
+  0x00000000U, 0x121e0fffU, 0xd22e00e1U, 0xfe010e12U, 0x00000000U, 0x0011f20eU, 0x20010f02U, 0xd0113400U,
+  0x00000000U, 0x3a04012eU, 0xf21fe02eU, 0xd2303df3U, 0x00000000U, 0xfee221c3U, 0x1e122d21U, 0x2e1af030U,
+  0x00000000U, 0x120e0011U, 0xf2df0ff2U, 0x0f030010U, 0x00000000U, 0x0021f300U, 0x10ee1f01U, 0xd0f13e0eU,
+  0x00000000U, 0x1af1f21eU, 0xf31fdefeU, 0xf2551b01U, 0x00000000U, 0x2f1210d1U, 0x03dc4c21U, 0x0e1f1f20U,
+  0x00000000U, 0xf010030eU, 0x00010e00U, 0x100f010fU, 0x00000000U, 0x1021e202U, 0x000e0002U, 0xf0e3ed0bU,
+  0x00000000U, 0x2ff1f201U, 0xb120cfd0U, 0xcf210f01U, 0x00000000U, 0x10122112U, 0x15eb4c2fU, 0x0fd10402U,
+  0x00000000U, 0xd41d0000U, 0x00000130U, 0x421f0022U, 0x00000000U, 0x0021f005U, 0x100fcf03U, 0x00e3c00bU,
+  0x00000000U, 0xd3f31fe3U, 0xd210fe1fU, 0xfe0cf04eU, 0x00000000U, 0x331e2012U, 0x03ed1e00U, 0xe1a1e503U,
+  0x00000000U, 0x11020fefU, 0xd21d010fU, 0x10ef0102U, 0x00000000U, 0x00f0040fU, 0x00110e01U, 0x00e2e100U,
+  0x00000000U, 0x2e1f2f01U, 0x110ff10fU, 0xc00e31d0U, 0x00000000U, 0xef30f3f2U, 0x1d412f33U, 0x10eddf0fU,
+  0x00000000U, 0x1300010fU, 0xe20f00e2U, 0xef0f0013U, 0x00000000U, 0x00d2030eU, 0x30121e01U, 0xd0030f00U,
+  0x00000000U, 0x2c211222U, 0x22f0e00eU, 0xb2210eefU, 0x00000000U, 0x0df20305U, 0x2fe32ff2U, 0x11edfe0fU,
+  0x00000000U, 0xf2120100U, 0x10f00ff1U, 0xe1100225U, 0x00000000U, 0x20d1e100U, 0x40f03f00U, 0xd0e11e0eU,
+  0x00000000U, 0x3f2e0f11U, 0x22f1d00fU, 0xa1042dffU, 0x00000000U, 0x0c202333U, 0x02c1ee02U, 0x02efff12U,
+  0x00000000U, 0xc0240efeU, 0xef100e1eU, 0xf30e0224U, 0x00000000U, 0x00d00e03U, 0x200f1001U, 0x20f0e00fU,
+  0x00000000U, 0x20210f00U, 0xe110ee00U, 0x90f1321fU, 0x00000000U, 0x2f2e3232U, 0x11dfee12U, 0x02b0e1f2U,
+  0x00000000U, 0xc2000e21U, 0xe10e0f3dU, 0x232d0042U, 0x00000000U, 0xf03f1e06U, 0x0020e004U, 0x30f2e00cU,
+  0x00000000U, 0xd2f31ed2U, 0xe110fe10U, 0xd1fe3040U, 0x00000000U, 0x301b2241U, 0x02fdff0fU, 0xe290c2e0U,
+  0x00000000U, 0x2f0f0ea0U, 0xf01f0000U, 0x2fff0302U, 0x00000000U, 0x10f20400U, 0x00ffff01U, 0x0001f000U,
+  0x00000000U, 0x002eef02U, 0xf2f0010fU, 0xd0e1f2f0U, 0x00000000U, 0xfc40df00U, 0x10210011U, 0x32e0ef1eU,
+  0x00000000U, 0x20f10de0U, 0xf11d0ff0U, 0x001d0102U, 0x00000000U, 0x1010f200U, 0x202e0002U, 0x00010f0eU,
+  0x00000000U, 0x113df101U, 0xf2ef01f0U, 0xa1f4f3fdU, 0x00000000U, 0xfd3fff21U, 0x0ff3ffe1U, 0x21cfd00eU,
+  0x00000000U, 0x1ce300f2U, 0xe10f0e00U, 0x203d0031U, 0x00000000U, 0x00eed003U, 0x20202201U, 0x001f100fU,
+  0x00000000U, 0x151d0000U, 0x010ef00fU, 0xbff4f20fU, 0x00000000U, 0x1b3d2f21U, 0xe2c2efe0U, 0x31a2e0e2U,
+  0x00000000U, 0xcce40fe1U, 0xe00f0d2fU, 0x423d0f31U, 0x00000000U, 0xf0ef2d06U, 0xe02ff301U, 0x20f0030cU,
+  0x00000000U, 0xf4f101ffU, 0xff3fffe0U, 0xef011010U, 0x00000000U, 0x1f1d1120U, 0xf3c0e0f3U, 0x11a2e1f2U,
+  0x00000000U, 0xee1f0012U, 0x021e0e2eU, 0x222f0f30U, 0x00000000U, 0x004e1007U, 0xf03fd102U, 0x1000ef0dU,
+  0x00000000U, 0xd5d00f00U, 0xcf1f0fe0U, 0x0dff1f00U, 0x00000000U, 0x00ff102fU, 0xf1eff1f2U, 0xffb0f1f1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x112f010eU, 0x00000000U, 0x00000000U, 0x00000000U, 0x10110000U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x10f10420U, 0x00000000U, 0x00000000U, 0x00000000U, 0x2114e1d0U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x121d011dU, 0x00000000U, 0x00000000U, 0x00000000U, 0x30120202U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x40f2222eU, 0x00000000U, 0x00000000U, 0x00000000U, 0x140300e1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x012e000eU, 0x00000000U, 0x00000000U, 0x00000000U, 0x10211201U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x51cf240eU, 0x00000000U, 0x00000000U, 0x00000000U, 0x21221fd0U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0f0f0f0dU, 0x00000000U, 0x00000000U, 0x00000000U, 0x102e1101U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x41e13410U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00260fe1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf0f20f0eU, 0x00000000U, 0x00000000U, 0x00000000U, 0xf01e0002U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x32e102d1U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00331ef0U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x023f00ffU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00400000U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x2e1213eeU, 0x00000000U, 0x00000000U, 0x00000000U, 0x1114ff01U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x224f01f0U, 0x00000000U, 0x00000000U, 0x00000000U, 0x304e0200U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x6b10d50dU, 0x00000000U, 0x00000000U, 0x00000000U, 0x1f144e01U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x203102d0U, 0x00000000U, 0x00000000U, 0x00000000U, 0x104f0301U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x7dffc50eU, 0x00000000U, 0x00000000U, 0x00000000U, 0x0e164f11U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x4ee301c1U, 0x00000000U, 0x00000000U, 0x00000000U, 0x003ef200U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x4fe0e4f0U, 0x00000000U, 0x00000000U, 0x00000000U, 0xf1f64ff3U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x2f050fe1U, 0x00000000U, 0x00000000U, 0x00000000U, 0xe01dd00dU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x2ef2a0f2U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00e44fe4U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x110002d1U, 0x00000000U, 0x00000000U, 0x00000000U, 0x10210200U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x2f2f04eeU, 0x00000000U, 0x00000000U, 0x00000000U, 0xff61dd21U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf21002dfU, 0x00000000U, 0x00000000U, 0x00000000U, 0x10f0df02U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x300df3dbU, 0x00000000U, 0x00000000U, 0x00000000U, 0x11220d32U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xe11000c1U, 0x00000000U, 0x00000000U, 0x00000000U, 0xd0efd003U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xe30df0deU, 0x00000000U, 0x00000000U, 0x00000000U, 0x01212f24U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xe0f40eb4U, 0x00000000U, 0x00000000U, 0x00000000U, 0xf0c2ce03U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x12101f9fU, 0x00000000U, 0x00000000U, 0x00000000U, 0xf32c4043U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf01002c5U, 0x00000000U, 0x00000000U, 0x00000000U, 0x20f2a002U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xe220d0cfU, 0x00000000U, 0x00000000U, 0x00000000U, 0x039d2023U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x20dd04f0U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00f1e102U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xe11ed3eeU, 0x00000000U, 0x00000000U, 0x00000000U, 0x0062af30U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x00c00311U, 0x00000000U, 0x00000000U, 0x00000000U, 0x20d1ed04U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xd21ed1dcU, 0x00000000U, 0x00000000U, 0x00000000U, 0x3e31be30U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xcef00e32U, 0x00000000U, 0x00000000U, 0x00000000U, 0x20d01c05U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xb3f0e4fdU, 0x00000000U, 0x00000000U, 0x00000000U, 0x210fbe4fU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xd1010f10U, 0x00000000U, 0x00000000U, 0x00000000U, 0x20f11d04U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xb5e1f5f2U, 0x00000000U, 0x00000000U, 0x00000000U, 0x03000e2fU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xf60d0020U, 0x00000000U, 0x00000000U, 0x00000000U, 0x1020d002U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xc5ff02efU, 0x00000000U, 0x00000000U, 0x00000000U, 0xf7adef0fU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x0eed0010U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00ffe00fU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x00f0f10fU, 0x00000000U, 0x00000000U, 0x00000000U, 0x2f00d0f0U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x13ea0c00U, 0x00000000U, 0x00000000U, 0x00000000U, 0x303df10fU,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xcf01f40dU, 0x00000000U, 0x00000000U, 0x00000000U, 0x5fd1def0U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x23db0b11U, 0x00000000U, 0x00000000U, 0x00000000U, 0x203f3101U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xbe03030eU, 0x00000000U, 0x00000000U, 0x00000000U, 0x3eb3ddf1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x12ce0f10U, 0x00000000U, 0x00000000U, 0x00000000U, 0x102e4202U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xc113f110U, 0x00000000U, 0x00000000U, 0x00000000U, 0x12c2def1U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0x410e0f2fU, 0x00000000U, 0x00000000U, 0x00000000U, 0x003ef200U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xc0ef0110U, 0x00000000U, 0x00000000U, 0x00000000U, 0x03bee0e0U,
+  0x0000000fU, 0xf00f001fU, 0x002000ffU, 0x00000000U, 0x0014e202U, 0x00002100U, 0x00ffe000U, 0x00000000U,
+  0x000d31f2U, 0xf002ef21U, 0x0f0f0100U, 0x00000000U, 0x102fe100U, 0x21000f10U, 0x1f13f1f0U, 0x00000000U,
+  0x00e00e31U, 0x0000000eU, 0xf0000101U, 0x00000000U, 0x0001f205U, 0x00f02202U, 0x100ee20eU, 0x00000000U,
+  0x22ff2131U, 0xd111efe1U, 0x20fff110U, 0x00000000U, 0x1e4ee3f0U, 0x3000ef10U, 0x2d14eee1U, 0x00000000U,
+  0x0ee10d20U, 0x1f2200f0U, 0x2f000113U, 0x00000000U, 0x100c2103U, 0xf0e11203U, 0x201de10dU, 0x00000000U,
+  0x44cf0130U, 0xf31f20b1U, 0x40f02211U, 0x00000000U, 0xfd60e0f0U, 0x2002f000U, 0x0d23dedfU, 0x00000000U,
+  0x0c040ef0U, 0x3e3f01f2U, 0x11110204U, 0x00000000U, 0x103b4000U, 0xf00fe202U, 0x304ef30cU, 0x00000000U,
+  0x33c1df11U, 0xe12f23e1U, 0x3e1111f1U, 0x00000000U, 0xeb51ee01U, 0x1021011fU, 0xf012efd0U, 0x00000000U,
+  0xfb030fd0U, 0x50100101U, 0x02f201f2U, 0x00000000U, 0xf01d300eU, 0x00010003U, 0x101fe00dU, 0x00000000U,
+  0x42d1cf01U, 0xf0303102U, 0x4f2002e0U, 0x00000000U, 0x1e620e10U, 0xf040c11fU, 0x11f3e0e1U, 0x00000000U,
+  0x100f0e0eU, 0x000c010fU, 0xf21f00eeU, 0x00000000U, 0x1002f003U, 0x00df3f00U, 0x103fd200U, 0x00000000U,
+  0x201d2202U, 0xd013c01fU, 0x2f0dd030U, 0x00000000U, 0x212ee11fU, 0x11dfe020U, 0xfd240fd1U, 0x00000000U,
+  0x10110f00U, 0x001c010fU, 0xe00002d1U, 0x00000000U, 0x102e0003U, 0x10fd200fU, 0x104fe10cU, 0x00000000U,
+  0x430f0130U, 0x9112c000U, 0x30fec32eU, 0x00000000U, 0x1f3f0f1eU, 0x11a1e011U, 0x0d420de2U, 0x00000000U,
+  0xef120ff1U, 0x00100001U, 0xfe1101d2U, 0x00000000U, 0xf02d000fU, 0x30fe1201U, 0x003df30eU, 0x00000000U,
+  0x43ffe121U, 0xe30112f1U, 0x21ffe130U, 0x00000000U, 0xfd211f0fU, 0x0ef3f2f1U, 0xef32fdefU, 0x00000000U,
+  0xdde602f0U, 0x0e000121U, 0x1f0302f2U, 0x00000000U, 0xe01c100eU, 0x30e10302U, 0xe04d140fU, 0x00000000U,
+  0x51f2ee13U, 0xf11f1342U, 0x00f0f101U, 0x00000000U, 0xec241e20U, 0x0e3102ffU, 0xe111e0ffU, 0x00000000U,
+  0x0be200ffU, 0xf0e20104U, 0x120301d1U, 0x00000000U, 0xe0fb1e0cU, 0x10003200U, 0x102e110fU, 0x00000000U,
+  0x4f019e01U, 0xfe0e4532U, 0x200f210fU, 0x00000000U, 0x1d000e11U, 0xe021c3feU, 0x0100f1ffU, 0x00000000U,
+  0x112001feU, 0x102d0011U, 0xf300020cU, 0x00000000U, 0x00211001U, 0x200c2f0eU, 0x0030e400U, 0x00000000U,
+  0x3f1df200U, 0xc013df30U, 0x0e0cff41U, 0x00000000U, 0x21420e10U, 0x2fa210f0U, 0xdb3323d3U, 0x00000000U,
+  0xf1320fe1U, 0x221e0fe1U, 0xd02001efU, 0x00000000U, 0x105f1101U, 0x203d0e0aU, 0xf05ee20fU, 0x00000000U,
+  0x43fdef10U, 0xdf02d222U, 0x1e0fcf30U, 0x00000000U, 0x1d300012U, 0x1c9322c2U, 0x0c5301f1U, 0x00000000U,
+  0xd0f000d0U, 0x02020cffU, 0x0ff100efU, 0x00000000U, 0x204e030fU, 0x404e020bU, 0xe03e010fU, 0x00000000U,
+  0x2310ee00U, 0x00022423U, 0xe001c020U, 0x00000000U, 0xe0012d12U, 0xfde024bdU, 0xfe030dfeU, 0x00000000U,
+  0xe0f000e0U, 0xf0e00e22U, 0x1ff000f0U, 0x00000000U, 0xf00e1001U, 0x20400400U, 0xf01e0201U, 0x00000000U,
+  0x1023cfd1U, 0x02f0423fU, 0xf1e1e000U, 0x00000000U, 0x130c4b21U, 0xee21f4edU, 0x111eff1eU, 0x00000000U,
+  0x1c1f020fU, 0x1fb20024U, 0xe32e00efU, 0x00000000U, 0xe0de0f00U, 0x102f520fU, 0xf0ff0105U, 0x00000000U,
+  0xe033bfffU, 0x2ffe3401U, 0xf1f01011U, 0x00000000U, 0x03ff1b12U, 0xee03c5fdU, 0x030eeeecU, 0x00000000U,
+  0x022002ffU, 0x00000e10U, 0x16000ffbU, 0x00000000U, 0xf003100fU, 0x001d2f00U, 0xe020f500U, 0x00000000U,
+  0x200f000eU, 0xdef3dc20U, 0xf01b1d33U, 0x00000000U, 0x005f1f20U, 0x0fd020e1U, 0xeb2104f4U, 0x00000000U,
+  0xdf110fe0U, 0x1f0100ceU, 0xe41100edU, 0x00000000U, 0x20011102U, 0x30201e0dU, 0xd010f300U, 0x00000000U,
+  0x120ef0feU, 0x0de0dc32U, 0x201eee34U, 0x00000000U, 0xf0303010U, 0xddaf2000U, 0xfc3105f3U, 0x00000000U,
+  0xefe000efU, 0xf01f01edU, 0x0210000dU, 0x00000000U, 0x30000000U, 0x104f120dU, 0xf0111101U, 0x00000000U,
+  0x3101eff0U, 0x11f00f5fU, 0x1000d023U, 0x00000000U, 0xf3002e10U, 0xdef0001fU, 0x1c101202U, 0x00000000U,
+  0x010000f0U, 0x22e001f0U, 0xff00001fU, 0x00000000U, 0x000e100fU, 0xf05d050eU, 0x00002100U, 0x00000000U,
+  0x1121dee2U, 0x1112101eU, 0x2ff21f11U, 0x00000000U, 0xf40f0d01U, 0xfde001e0U, 0x1011f010U, 0x00000000U,
+  0x0f20002eU, 0x30c20ff1U, 0xb2100f10U, 0x00000000U, 0xf00f1e01U, 0x0020120eU, 0xf0101005U, 0x00000000U,
+  0xf021df1fU, 0x4f2111e1U, 0x01e02032U, 0x00000000U, 0x04100e01U, 0xede0d00dU, 0x013ff0eeU, 0x00000000U,
+  0x00100001U, 0xf21e0e2dU, 0x02f00dfdU, 0x00000000U, 0x00d10100U, 0xf0502f01U, 0xf023030fU, 0x00000000U,
+  0x00000110U, 0xfe010c10U, 0xf1fe2e24U, 0x00000000U, 0x104f0011U, 0xe0fd3f00U, 0xde2df3f0U, 0x00000000U,
+  0xfe1f00f0U, 0xf2e0012cU, 0x11000dfdU, 0x00000000U, 0x10f10003U, 0x0021110fU, 0xf014f50fU, 0x00000000U,
+  0x02010f12U, 0x4f4ffb20U, 0x221d1f17U, 0x00000000U, 0x004f1f33U, 0xf0ee3200U, 0xfe20e501U, 0x00000000U,
+  0xefef00f1U, 0x02e3011bU, 0x11010f3eU, 0x00000000U, 0x00f12e01U, 0xf010f00eU, 0x00030300U, 0x00000000U,
+  0x0100eff0U, 0x3331fb10U, 0x412c2d36U, 0x00000000U, 0x02001010U, 0x002c2300U, 0x2c211311U, 0x00000000U,
+  0x00ff0e0fU, 0x42c201edU, 0xffe30020U, 0x00000000U, 0x002f1f00U, 0xd0effe0dU, 0xe0023200U, 0x00000000U,
+  0x1021e0ffU, 0x2f230df0U, 0x302f1e33U, 0x00000000U, 0xe2ffef01U, 0x2f1b1100U, 0x1b4f1210U, 0x00000000U,
+  0x1100003eU, 0x20d200dfU, 0xdc010040U, 0x00000000U, 0x002f0100U, 0xe0f02e0eU, 0xf0122302U, 0x00000000U,
+  0xe010000fU, 0x3e220ff1U, 0x31100f53U, 0x00000000U, 0x0101e0f3U, 0x0e2c001fU, 0x1c6f0120U, 0x00000000U,
+  0x00000000U, 0x101e0002U, 0x102f01f1U, 0x00000000U, 0x00000000U, 0x001e100eU, 0x000f0e0fU, 0x00000000U,
+  0x00000000U, 0x0012e010U, 0x1000f2e1U, 0x00000000U, 0x00000000U, 0x0ff10100U, 0x00031ff0U, 0x00000000U,
+  0x00000000U, 0x010e00f3U, 0x000f00e1U, 0x00000000U, 0x00000000U, 0x001f100fU, 0x20f2f000U, 0x00000000U,
+  0x00000000U, 0x0013ef01U, 0x3f03e11fU, 0x00000000U, 0x00000000U, 0xf0f21100U, 0x00e31f01U, 0x00000000U,
+  0x00000000U, 0xf1f00010U, 0x00e100e1U, 0x00000000U, 0x00000000U, 0xe0101f0fU, 0x00e1ff00U, 0x00000000U,
+  0x00000000U, 0x0f03f112U, 0x20e3f21fU, 0x00000000U, 0x00000000U, 0xf0f11e10U, 0xe2e12d10U, 0x00000000U,
+  0x00000000U, 0xf1d2001fU, 0xfee20fffU, 0x00000000U, 0x00000000U, 0xe0000f00U, 0xf0eefe02U, 0x00000000U,
+  0x00000000U, 0x0ef21032U, 0x11c0f201U, 0x00000000U, 0x00000000U, 0xfff00f20U, 0xe3e21d11U, 0x00000000U,
+  0x00000000U, 0x12f10120U, 0x0ef10ff0U, 0x00000000U, 0x00000000U, 0x0020f00eU, 0x00fe1001U, 0x00000000U,
+  0x00000000U, 0x0ee01010U, 0x21d1d200U, 0x00000000U, 0x00000000U, 0x01e00110U, 0x10113f21U, 0x00000000U,
+  0x00000000U, 0x022f01f2U, 0xe23f01e0U, 0x00000000U, 0x00000000U, 0xf03f120dU, 0xf010ff0fU, 0x00000000U,
+  0x00000000U, 0xfe02dff0U, 0x3f11d0cfU, 0x00000000U, 0x00000000U, 0x1ef1ef10U, 0x1f21fe20U, 0x00000000U,
+  0x00000000U, 0x010f01f1U, 0xe22f02d1U, 0x00000000U, 0x00000000U, 0x00311100U, 0xe030fb02U, 0x00000000U,
+  0x00000000U, 0x0e100002U, 0x4f21b1deU, 0x00000000U, 0x00000000U, 0x2f1f101fU, 0x3f202d40U, 0x00000000U,
+  0x00000000U, 0xf3d101f2U, 0xe0f301d3U, 0x00000000U, 0x00000000U, 0xc0112100U, 0x003d0c0fU, 0x00000000U,
+  0x00000000U, 0x0e13f2f1U, 0x4110c4dfU, 0x00000000U, 0x00000000U, 0x12ff0f2fU, 0x00322031U, 0x00000000U,
+  0x00000000U, 0x21c00001U, 0xfed501b3U, 0x00000000U, 0x00000000U, 0xd00f1e0fU, 0x100cff0fU, 0x00000000U,
+  0x00000000U, 0x10120000U, 0x31efdfe2U, 0x00000000U, 0x00000000U, 0x11edef3eU, 0xf1102031U, 0x00000000U,
+  0x00000000U, 0x10b20000U, 0xfbd200d0U, 0x00000000U, 0x00000000U, 0xf00f000dU, 0xf00bf00dU, 0x00000000U,
+  0x00000000U, 0x0e000101U, 0x1002afc1U, 0x00000000U, 0x00000000U, 0x010ef11fU, 0x21003021U, 0x00000000U,
+  0x00000000U, 0x11f00eeeU, 0xe20e00e0U, 0x00000000U, 0x00000000U, 0xe001040dU, 0x0011fe0eU, 0x00000000U,
+  0x00000000U, 0xee110000U, 0x202fe2deU, 0x00000000U, 0x00000000U, 0x1f0de112U, 0x2042fd41U, 0x00000000U,
+  0x00000000U, 0x02ff00e0U, 0xe3400fdfU, 0x00000000U, 0x00000000U, 0xe0211300U, 0xe04e0d01U, 0x00000000U,
+  0x00000000U, 0xf12f02f0U, 0x0110efccU, 0x00000000U, 0x00000000U, 0x102de050U, 0x3d320d44U, 0x00000000U,
+  0x00000000U, 0x04f201f1U, 0xc3120fc3U, 0x00000000U, 0x00000000U, 0xe020320fU, 0xd02f0f01U, 0x00000000U,
+  0x00000000U, 0x12200fefU, 0xf40fecefU, 0x00000000U, 0x00000000U, 0x201cc15fU, 0x01101033U, 0x00000000U,
+  0x00000000U, 0x13d30201U, 0xd1d10ebfU, 0x00000000U, 0x00000000U, 0xc02e2f0eU, 0x10feff03U, 0x00000000U,
+  0x00000000U, 0x21110dd0U, 0xf220cac0U, 0x00000000U, 0x00000000U, 0x2fece16eU, 0x13eb1f53U, 0x00000000U,
+  0x00000000U, 0x01b100e0U, 0x00ff01e0U, 0x00000000U, 0x00000000U, 0x000f010fU, 0x00ecf001U, 0x00000000U,
+  0x00000000U, 0x1210edd1U, 0xf232bcb0U, 0x00000000U, 0x00000000U, 0x2f09f05dU, 0x12cc1e10U, 0x00000000U,
+  0x00000000U, 0x0ff40fffU, 0x0d10030eU, 0x00000000U, 0x00000000U, 0xe021030dU, 0x101ef10eU, 0x00000000U,
+  0x00000000U, 0xe021eff1U, 0x101ee2dfU, 0x00000000U, 0x00000000U, 0xf22b0020U, 0x2f40ff30U, 0x00000000U,
+  0x00000000U, 0x01f20100U, 0x001102e0U, 0x00000000U, 0x00000000U, 0xf03f120cU, 0x0010ff01U, 0x00000000U,
+  0x00000000U, 0xd230000fU, 0xe20feeddU, 0x00000000U, 0x00000000U, 0x214cc05fU, 0x1d314e10U, 0x00000000U,
+  0x00000000U, 0x010301feU, 0xf00100c0U, 0x00000000U, 0x00000000U, 0xe03e1f0dU, 0x00000e03U, 0x00000000U,
+  0x00000000U, 0xc2222ce1U, 0xb4f1dddeU, 0x00000000U, 0x00000000U, 0x3d3cc060U, 0x1f0f3e21U, 0x00000000U,
+  0x00000000U, 0x01f3010eU, 0x10f001cfU, 0x00000000U, 0x00000000U, 0xc04eff0fU, 0x202d0e01U, 0x00000000U,
+  0x00000000U, 0xd3120be0U, 0xd222cfffU, 0x00000000U, 0x00000000U, 0x1d2a0062U, 0x04ee0d02U, 0x00000000U,
+  0x00000000U, 0x11f0010fU, 0x32e001fdU, 0x00000000U, 0x00000000U, 0xf02dff00U, 0x203b1f01U, 0x00000000U,
+  0x00000000U, 0xe211fdd1U, 0x0202deffU, 0x00000000U, 0x00000000U, 0xf0ebef20U, 0xf3eeeeefU, 0x00000000U,
+  0x00000000U, 0x19e20ef0U, 0x3b01010fU, 0x00000000U, 0x00000000U, 0xf0e0000cU, 0x00fcf000U, 0x00000000U,
+  0x00000000U, 0x2f00ddffU, 0xf2deefffU, 0x00000000U, 0x00000000U, 0xf04cf22fU, 0x434ed01fU, 0x00000000U,
+  0x00000000U, 0x1bdf01dfU, 0x210f01deU, 0x00000000U, 0x00000000U, 0xe0df0f0cU, 0x001cef0fU, 0x00000000U,
+  0x00000000U, 0xef13de0fU, 0xc19f02ddU, 0x00000000U, 0x00000000U, 0x105ace2fU, 0x42010ef0U, 0x00000000U,
+  0x00000000U, 0x1dc003cfU, 0x022f01c0U, 0x00000000U, 0x00000000U, 0xd0fcfc0eU, 0x001d100fU, 0x00000000U,
+  0x00000000U, 0xae15fcefU, 0xeed0f4feU, 0x00000000U, 0x00000000U, 0x22ecaf12U, 0x12b5efc2U, 0x00000000U,
+  0x00000000U, 0x3ecf03efU, 0xf11e0fefU, 0x00000000U, 0x00000000U, 0xc00cee0eU, 0x003d120dU, 0x00000000U,
+  0x00000000U, 0xaff30c00U, 0x0d01e1ffU, 0x00000000U, 0x00000000U, 0x01bac003U, 0xe2b3dfe4U, 0x00000000U,
+  0x00000000U, 0x3eff01e0U, 0xfd0f0ffeU, 0x00000000U, 0x00000000U, 0xf01cff0eU, 0x001d010eU, 0x00000000U,
+  0x00000000U, 0xdfd00fe0U, 0x10c1ffe0U, 0x00000000U, 0x00000000U, 0xf2ddf001U, 0xfef0e0f2U, 0x00000000U,
+  0x311f005fU, 0xd1f40010U, 0x12f10ff2U, 0x01ff00f1U, 0x00223202U, 0x0020f401U, 0x0011f301U, 0x001c0401U,
+  0xf1201041U, 0x000d4e00U, 0x002f30f0U, 0xf000fe00U, 0x012e0ff1U, 0xef0ff200U, 0xe01c1101U, 0xef0101e0U,
+  0x200d003dU, 0x0ff70f0eU, 0x13ef0f02U, 0x03ef0013U, 0xe0e14102U, 0xe02f140dU, 0xe010e403U, 0x004cf300U,
+  0xf2310110U, 0x211f1c02U, 0x022e2031U, 0xf2e10e12U, 0x120f0ff0U, 0xec5e01f0U, 0xe02b2110U, 0xff21e2d0U,
+  0x2f3e0f1fU, 0x0fe300ffU, 0x232f0e02U, 0xf1e00003U, 0xf0c22f01U, 0xd0203309U, 0xd011d40fU, 0x104dd400U,
+  0xd2110211U, 0x5f01fc13U, 0xf12d1022U, 0x01df0f32U, 0x110001f1U, 0xfa3dd2f0U, 0xef1d2302U, 0x1f21f001U,
+  0x003d0000U, 0x01f200f1U, 0x143e0012U, 0x120f00f1U, 0x20d32002U, 0xe030320aU, 0xe021d30dU, 0x005df20fU,
+  0xd20f111fU, 0x4002ebf2U, 0xef3efef2U, 0x1101f122U, 0x20f2f20fU, 0xfc0ed0f0U, 0xfd0f1412U, 0x00310012U,
+  0x002f00f0U, 0xfff300d2U, 0x01200120U, 0x15230111U, 0x00f20001U, 0xf021220eU, 0xf0e2d001U, 0x005de001U,
+  0xe00f2010U, 0x21e1de21U, 0xf22fd012U, 0x211f30d1U, 0xfe00e10fU, 0x1d2ed01fU, 0xef20ef00U, 0x02320002U,
+  0x310e006fU, 0x10f10030U, 0x41d000d0U, 0x22f000eeU, 0xf0204202U, 0x00230300U, 0xe0efe500U, 0x001ef50eU,
+  0xf1223e31U, 0x010c3e32U, 0xf32f1f03U, 0xe00ece32U, 0x022e0100U, 0xde1df2dfU, 0xc21cf2cfU, 0xcd01e1e0U,
+  0x511c0050U, 0x0ee602ffU, 0x31e10ee0U, 0x0f0101e0U, 0x000e410fU, 0xf040140dU, 0xe000d201U, 0xf010040cU,
+  0xc0132211U, 0x0f203f42U, 0xe30f2104U, 0xd2dfff23U, 0xe3001f01U, 0xde00e2dfU, 0xe4fd12f0U, 0xfc0fe21fU,
+  0x311d0f2eU, 0x2ff503f2U, 0x002f0d10U, 0xfed000deU, 0x10f13201U, 0xd02f210cU, 0x0030d603U, 0x0010f401U,
+  0xd0032300U, 0x0c220022U, 0xc3d03213U, 0xf1df1011U, 0x10ff2cf2U, 0xfcc1f40dU, 0x010d1301U, 0x2f00e200U,
+  0x002d0e11U, 0x20e304d2U, 0xef3e0f22U, 0x0ef10101U, 0x10e51102U, 0xe02f320bU, 0xc041f403U, 0xe020e302U,
+  0xe2113211U, 0x2f0ffff2U, 0xc4001f03U, 0x2decf020U, 0x2f2111f3U, 0x0cafe3feU, 0x0e2d1113U, 0x1110d220U,
+  0xf14f0001U, 0x4ce301a2U, 0xee310111U, 0x25d203f0U, 0x20070f01U, 0xc011210aU, 0xd021f001U, 0x004fd10fU,
+  0xe1fe3220U, 0x53f0bef2U, 0xe1211e42U, 0x1eed3101U, 0xfc11d301U, 0x3c0f0f2fU, 0xfc2ee023U, 0xf502c403U,
+  0x62f1005fU, 0x03100231U, 0x7fcf0e0fU, 0x11f40ffdU, 0x001d3104U, 0x0012130eU, 0xe0e3e60eU, 0x0050e70bU,
+  0xe0123f23U, 0xffed0f62U, 0xc001f245U, 0x2e1ded60U, 0xf01d10e0U, 0xfef301cfU, 0xd0dbe4cfU, 0xdc0c1300U,
+  0x31100150U, 0xf3110300U, 0x4fdd0f02U, 0x21f00feeU, 0x30ed240eU, 0x2043130fU, 0x20e30100U, 0xf060e40cU,
+  0xff02e115U, 0xfcf01f70U, 0xc2e21223U, 0x0e2ffe51U, 0xf0202ed0U, 0xd2e2f2a0U, 0xf2cdd3cfU, 0xf00ff410U,
+  0x3ff00fe1U, 0x00000310U, 0x20fe0e01U, 0x13f301fdU, 0x30f0140dU, 0x0041030eU, 0x10001403U, 0xe05f050eU,
+  0x01e2e204U, 0x2b022e40U, 0xc2f13121U, 0x0e2efe30U, 0x1dff01e0U, 0xd00201cfU, 0x1effc3d1U, 0x101ed41fU,
+  0x1d000ee2U, 0x200003efU, 0x112f0221U, 0x24e001ffU, 0x10f41200U, 0xf030120fU, 0xd0001501U, 0xd040140eU,
+  0xf0f144f2U, 0x2dff4020U, 0xd1103f23U, 0x4d0bf11eU, 0x0c00e3f1U, 0xf0d400feU, 0x101fd2f1U, 0x1240b20eU,
+  0xf0300ff3U, 0x1ce101ceU, 0xe1f10200U, 0x27d202f1U, 0x1005f00fU, 0xe021210eU, 0xd0111e02U, 0x002ff20dU,
+  0x10fe4511U, 0x1112eee1U, 0xf1032023U, 0x1efd0211U, 0x1e11e3f1U, 0x2ee11e1eU, 0x025fc002U, 0x1312b22fU,
+  0x61ff001dU, 0xf42f0f24U, 0x6ee30e3fU, 0x0ef30c0fU, 0x102e0303U, 0x20f01100U, 0xe011f60dU, 0x00e10f0eU,
+  0x010e0025U, 0x00e20f61U, 0xfffe3055U, 0x5f2fdb22U, 0xef1f00efU, 0xee1413e1U, 0xefeef6deU, 0xf12a2121U,
+  0x6dfd020dU, 0xd43e020fU, 0x4de10041U, 0x0ed30e0dU, 0x20edf10dU, 0x20230100U, 0x0004220fU, 0x102ef10aU,
+  0x02f0f205U, 0x1ef1f050U, 0x01df2135U, 0x6d30dd61U, 0x0cd120e0U, 0xed1221d2U, 0x0ecfe6deU, 0x0259e341U,
+  0x3cfd0fdfU, 0xf22f032dU, 0x2eef0f30U, 0x4fc20f0bU, 0x201ff30bU, 0x0021f002U, 0x10033501U, 0xe04e120bU,
+  0xf3e0f5f3U, 0x3df0000fU, 0x20ef2042U, 0x2d1f2d50U, 0x1cb2f1edU, 0x0f2231d0U, 0x0d1fd2ddU, 0x1f4ad33eU,
+  0x0e000fd3U, 0x0ffe01eeU, 0x21ff0f02U, 0x43e2010cU, 0x1032040fU, 0xf0330f01U, 0xf0f44200U, 0xd02f020bU,
+  0x110242f1U, 0x20f0f1ffU, 0x200f0031U, 0x2d1f2f0fU, 0x1df1f30eU, 0x011230f0U, 0xf13ff0fdU, 0x301c011eU,
+  0xf1200004U, 0x1df101ceU, 0xf2020ff3U, 0x23d20100U, 0xf0030000U, 0xc0223001U, 0xf0d43f0fU, 0xf0ff000dU,
+  0x00003400U, 0x2201c1f0U, 0x10040112U, 0x1e1ff221U, 0x10fff1edU, 0x21e03f00U, 0x1320000fU, 0x111fee0dU,
+  0x0fef0f0fU, 0xd2200d11U, 0x3df40e03U, 0x30fd0c1fU, 0x0000e00fU, 0x10000301U, 0x00f3150eU, 0xf0221e0eU,
+  0xfef0f213U, 0x22022e22U, 0x2d002f25U, 0x0e40ddffU, 0x1fdf0010U, 0xde444211U, 0x0e102311U, 0x12eb1f1fU,
+  0x40fe00e0U, 0xaf2f0e20U, 0x3b010e42U, 0x31cf0f1eU, 0x100ed00dU, 0xf0e2f005U, 0xe0154400U, 0xf0020b0dU,
+  0xfff1e303U, 0x42001c20U, 0x3f1e1f26U, 0x4c54ec0dU, 0x2ed0e20fU, 0xe0204011U, 0x1f10141fU, 0x22faee1fU,
+  0x2fee0fe2U, 0xd0f1012dU, 0xfffe0f53U, 0x31c301ecU, 0x301ed10cU, 0xe001ee04U, 0xf013620eU, 0x00df1d0cU,
+  0xffe1f3f3U, 0xf1001edeU, 0x30202f22U, 0x4c231cfdU, 0x2de0f1ffU, 0x102d1f01U, 0x0f1e221bU, 0x3f0b1f22U,
+  0x0fd20ff3U, 0x0de101f0U, 0xd1e102f2U, 0x31c200cdU, 0x10f0f00fU, 0xb0110e03U, 0xf0f35e0fU, 0xf0cf0f0eU,
+  0x0ff311e1U, 0xd2f110a0U, 0x11202ff0U, 0x3c230ffeU, 0x202f001eU, 0x114d0002U, 0x100d300eU, 0x31eb3f02U,
+  0x100100f4U, 0x3df100c1U, 0xd1e102e1U, 0x1fc10fdfU, 0xf0f10f02U, 0xe01f1001U, 0xf002410eU, 0xf0de1e0eU,
+  0x0fe22100U, 0xf40100deU, 0x40441100U, 0x4e21f10fU, 0x1211e11dU, 0x101e010fU, 0x1f1f1f1eU, 0x200d100fU,
+  0x00000000U, 0xf00e000eU, 0x100f0000U, 0x01f10f21U, 0x00111000U, 0xf0031e0fU, 0x00e10f00U, 0xf0121402U,
+  0x00000ffeU, 0x0002001eU, 0x0000e001U, 0x012f4e00U, 0xf0e00000U, 0x11df0f00U, 0x10100f00U, 0x100d0120U,
+  0x020f00e0U, 0x010e01ffU, 0x0f0f01fdU, 0x12010e20U, 0x0021100fU, 0xe0f3e001U, 0x00e20e01U, 0x101f3204U,
+  0xff110fffU, 0xee1020deU, 0xf00000ffU, 0xf40e3df2U, 0xf0ff0001U, 0x12cd1010U, 0x20f0ef1fU, 0x1f2c001fU,
+  0x031f00e0U, 0x121f00eeU, 0x0f10010eU, 0x11310d0dU, 0x10111000U, 0xe0d1c003U, 0xf0e1fe03U, 0xe02f4301U,
+  0xef10000fU, 0xdd3020ceU, 0x0f1021efU, 0x030e1d13U, 0x01011000U, 0x32ed100fU, 0x2101d00fU, 0x0c2d010fU,
+  0x0101000fU, 0x121d010fU, 0xef0f010fU, 0x11300d20U, 0x00e02f00U, 0xd0e2d002U, 0xf0ffdf03U, 0xc0204200U,
+  0xfeee2020U, 0xcd4000e1U, 0x100023e0U, 0x030f0b22U, 0x10f1101eU, 0x23df200eU, 0x1113f1e0U, 0xe95d001fU,
+  0xf011000fU, 0x131d011fU, 0x00f10100U, 0x3f230011U, 0x002ff100U, 0xf003e202U, 0x10e00f02U, 0xb04f3200U,
+  0x10e010ffU, 0xd040ff00U, 0x1f1f3200U, 0x22f01d11U, 0x0101111fU, 0xf2df200fU, 0xf132d1efU, 0xfb5ff02fU,
+  0x011f01f1U, 0x000e0001U, 0xfe1f01ffU, 0x31e30f20U, 0x0010000fU, 0xf0d11e0fU, 0x00e10e0fU, 0xf0c13403U,
+  0x000f01e0U, 0xde02f2feU, 0x0f11e000U, 0xe32e4d02U, 0x00000010U, 0x23d0f100U, 0x10f01010U, 0x212af11eU,
+  0x012e01f1U, 0x20fd00f1U, 0xff1001feU, 0x22030e1fU, 0x0022000eU, 0xf0c1ff0fU, 0xf0e10d01U, 0x20d03402U,
+  0x0e1ff0ffU, 0xcd130fcfU, 0x0f00e0feU, 0xe50c4cf5U, 0x1f010f00U, 0x24d0d001U, 0x11f0f020U, 0x0d0ee30dU,
+  0x010e01efU, 0x110e0fe0U, 0xf0110fffU, 0x1e130e00U, 0x00010f00U, 0x00c3ef02U, 0xf0e10c01U, 0xd0001101U,
+  0x0f20f1f0U, 0xee1110d0U, 0x0f0f000eU, 0x2f1e3ef3U, 0x20112f0fU, 0x31f1d20fU, 0x0012f011U, 0xec10f3ffU,
+  0x001101e0U, 0x000d0e30U, 0xf00100ffU, 0x002100f0U, 0xf0f11e01U, 0x10d2ff04U, 0x00f0ee0fU, 0xe0011200U,
+  0xfe1f11ffU, 0xcd212201U, 0x1ffe000fU, 0x3e2f2e21U, 0x00131f1fU, 0x2110010eU, 0xf01102f1U, 0xdf1103ffU,
+  0x0f1f0000U, 0xc1fd0010U, 0x010100f0U, 0x3e1600e0U, 0x00e2ff00U, 0x00f21004U, 0x00000101U, 0xb000320eU,
+  0xfff000e0U, 0xaf122201U, 0x0f1e3200U, 0x3f1ced22U, 0xf1f21f11U, 0xf31ef2ffU, 0xf113f3efU, 0x0c53e031U,
+  0x0f1202f1U, 0xef1e0002U, 0x0f0f000fU, 0x6f000022U, 0x001f010eU, 0x100d1f0eU, 0x00f00e0fU, 0x00af3f01U,
+  0x200ed10eU, 0xdd04f10eU, 0xf010001fU, 0xf31f0f03U, 0x1f31e011U, 0x11a20201U, 0x10e01111U, 0x22f0ee1cU,
+  0x0f2000f0U, 0x0fff0001U, 0x00000fffU, 0x0e120111U, 0x0020f00fU, 0x000f0d0eU, 0xf0fffd00U, 0x30d02201U,
+  0x2f1de1ffU, 0x0c2402e0U, 0xf002f00eU, 0xe4fd3103U, 0x0c210030U, 0x10e2f3f1U, 0x10f00011U, 0x10e3d1fbU,
+  0x000200feU, 0xff0f0f0fU, 0x000100e0U, 0xfd020111U, 0xf020fe0eU, 0x30001002U, 0x0000ed0fU, 0x10f2f201U,
+  0x2f0e02c0U, 0x0e03f321U, 0x1010f1ffU, 0x100f3f01U, 0x1010002eU, 0x0f220fdfU, 0x0f010f11U, 0xfef102fdU,
+  0x01110100U, 0xe01c0141U, 0x1f100f00U, 0x10e0020fU, 0x0031ff0fU, 0x40f12002U, 0x1000f00fU, 0x00010100U,
+  0xfffef1d0U, 0xd0000231U, 0x1f1d011fU, 0x20fe431fU, 0x0100f22fU, 0x0101f0ffU, 0xf11000f0U, 0xd1f101efU,
+  0x200001e1U, 0xf2dd0f22U, 0x21000e11U, 0x4ed30101U, 0x1013f00dU, 0x40103103U, 0x20f1f202U, 0xd0d0510dU,
+  0x01e0e0e0U, 0x02f22112U, 0x1f0c3310U, 0x1ffef101U, 0x10f11044U, 0x0f1ee20dU, 0xf021e3feU, 0xfe33e20fU,
+  0xfd0300feU, 0xe211000fU, 0xff010010U, 0x410e0023U, 0xf01f0000U, 0x001d3f0fU, 0x000f1e00U, 0x20ef1d0fU,
+  0x110fee00U, 0xfd130f01U, 0x10f1f000U, 0xf203e10fU, 0x1f5ed011U, 0x2fc103f3U, 0x00e11100U, 0x20900cdfU,
+  0xee1202fcU, 0x231f0fffU, 0xf0110ef0U, 0xd10f0fffU, 0x001fe00fU, 0x103f200cU, 0x001e1f0eU, 0x301f120fU,
+  0x110ef0feU, 0x1c211013U, 0x01e1ef01U, 0xe0e1204fU, 0x1f30f030U, 0x1df1f102U, 0xf0ff01f0U, 0x10c3d0dfU,
+  0x0f2303feU, 0xf12f001fU, 0x000f0de1U, 0xff0f0020U, 0xf030f00dU, 0x20013100U, 0xf020f100U, 0x003f220fU,
+  0xf0ee00ddU, 0x0f101121U, 0x1f0ff002U, 0xfc00203fU, 0x302e1f4fU, 0x0f23f10fU, 0xd0f101f0U, 0xd0f301deU,
+  0x00120200U, 0x0fff0131U, 0x21ff0f01U, 0x20df0230U, 0xf010ee0eU, 0x30212002U, 0x0020f200U, 0xe021010eU,
+  0xf2ef00d0U, 0x11221f20U, 0x2f1e0121U, 0x1e0e2301U, 0x20201041U, 0x0cf1e111U, 0xef1101deU, 0xdfe2f1ddU,
+  0x30f102d1U, 0x20bf0e41U, 0x10f10f21U, 0x3ee00021U, 0xf0f00e0cU, 0x1040210eU, 0x200f0201U, 0x00d1000bU,
+  0xe2e0f0b0U, 0x01130e01U, 0x2c2e3231U, 0x3ffe03ffU, 0x20e01044U, 0x090d112fU, 0xfd42d2edU, 0xee03df1fU,
+  0xf9f10eeeU, 0xf22f0e0fU, 0x01100031U, 0xf31d0242U, 0xf01e0001U, 0x00102100U, 0x00211e00U, 0x00111d0fU,
+  0xd00edeffU, 0x0f221e00U, 0x10020111U, 0x0e03021eU, 0x114cd01eU, 0xfeff2000U, 0xf0e21001U, 0x01b13ef1U,
+  0xece201fcU, 0x0110000dU, 0x02000f20U, 0xd30e0000U, 0xe00ff002U, 0x1003210eU, 0x10221e0eU, 0x30211e0dU,
+  0xb2e0ffffU, 0x0e301c12U, 0x1f120022U, 0x1c33103dU, 0x235bd02fU, 0xddef200fU, 0x0f010101U, 0xffc20fdfU,
+  0xfef302ecU, 0x1102020fU, 0x02100f10U, 0x21000200U, 0xc0e0ff01U, 0xf0e2100fU, 0x1032310eU, 0x00120f0dU,
+  0x92e3fecfU, 0x02101f2fU, 0x30210131U, 0x0b220f2eU, 0x335bff50U, 0x1d0e2100U, 0x0e0101f1U, 0xefff20d1U,
+  0x300103e1U, 0x1fe101ffU, 0x02f0000eU, 0x40d004feU, 0xb0ffdc0eU, 0xf0001f0fU, 0x3013110eU, 0xf0010f0eU,
+  0xb2e400a0U, 0x0031fd2eU, 0x6f3f1140U, 0x1c21202fU, 0x322d0053U, 0x1dec1001U, 0x0e1100eeU, 0xf010ff00U,
+  0x401f01e1U, 0x21f10000U, 0xe1f20f00U, 0x3ff00200U, 0xe0eefd0eU, 0xf0202000U, 0x1002200eU, 0x00e10f0dU,
+  0xd1e0f0a0U, 0xff210e10U, 0x7d301141U, 0x1f1f100fU, 0x22df0022U, 0xfcfbff0fU, 0x0d63010eU, 0x0002f0f0U,
+  0x313e0000U, 0x001f00e1U, 0x22110001U, 0x00000000U, 0x00021102U, 0x00fe0100U, 0x003ee200U, 0x00000000U,
+  0x01402310U, 0x000f0ff0U, 0x001e00f2U, 0x00000000U, 0x01121002U, 0x000000e0U, 0xe03f12e0U, 0x00000000U,
+  0x110e00ffU, 0x01f00002U, 0x12f00001U, 0x00000000U, 0x10010202U, 0x001ff200U, 0x002fe202U, 0x00000000U,
+  0x122e1230U, 0xf0000ff1U, 0x101ff0f0U, 0x00000000U, 0x20111ee2U, 0x0f100000U, 0x011c01f0U, 0x00000000U,
+  0x211e00f0U, 0xf21f00f2U, 0x12fe0f1fU, 0x00000000U, 0x00fff10fU, 0x001fe200U, 0x003ff303U, 0x00000000U,
+  0x012f1111U, 0xf002f001U, 0x211f2110U, 0x00000000U, 0x1e131ff2U, 0x1e0e0111U, 0x133e11f0U, 0x00000000U,
+  0x123f00f1U, 0x021201f2U, 0x33fe0ff1U, 0x00000000U, 0x00fff00eU, 0xe0300200U, 0xe0400203U, 0x00000000U,
+  0xe11ff122U, 0xf101eff1U, 0x102010f0U, 0x00000000U, 0xfe12f0f2U, 0x0f1e0010U, 0x112e1110U, 0x00000000U,
+  0x012000f0U, 0x010101f2U, 0x32f00100U, 0x00000000U, 0x0010e00fU, 0x1020010fU, 0xe0101103U, 0x00000000U,
+  0x110fe000U, 0x1112f000U, 0x213221f1U, 0x00000000U, 0xf0f1e1f0U, 0x01ff1000U, 0x1f101f20U, 0x00000000U,
+  0x433f0100U, 0x110f00d0U, 0x11e2010fU, 0x00000000U, 0xf03d0300U, 0x001de20fU, 0x100ff201U, 0x00000000U,
+  0x104fff01U, 0xf0feff11U, 0x100e12f0U, 0x00000000U, 0xe0133fd2U, 0xeef100d1U, 0xe30f01ffU, 0x00000000U,
+  0x234f01d0U, 0x00ee00e1U, 0x30e10f0fU, 0x00000000U, 0x101ef300U, 0x101fe20fU, 0x00fff300U, 0x00000000U,
+  0x011de000U, 0x02000010U, 0x20ff20d0U, 0x00000000U, 0x0e112df1U, 0x0ff02fe2U, 0x030ef3feU, 0x00000000U,
+  0x203e01fdU, 0x01000102U, 0x4fef0e1fU, 0x00000000U, 0x100ef300U, 0x0000f200U, 0x1000f302U, 0x00000000U,
+  0xe01ef020U, 0xe1f10023U, 0x2df000dfU, 0x00000000U, 0xfe12fdf2U, 0x0f1f00e1U, 0x220fe2eeU, 0x00000000U,
+  0x1f2f01feU, 0x02010001U, 0x30df00efU, 0x00000000U, 0xe01f0100U, 0xf0200100U, 0x1020f302U, 0x00000000U,
+  0xd10ed020U, 0xf1e20f11U, 0x1e21e1e0U, 0x00000000U, 0xf010fdf3U, 0x100e0011U, 0x20010ff0U, 0x00000000U,
+  0xf03f00e0U, 0x11e201f3U, 0x13f102ceU, 0x00000000U, 0x10011f02U, 0xf0300100U, 0xf02c110fU, 0x00000000U,
+  0xc3ff2f10U, 0x01f20f00U, 0x2f21e0d0U, 0x00000000U, 0x002fe011U, 0x10fd1130U, 0x10210f10U, 0x00000000U,
+  0x22200100U, 0x22ff00e0U, 0x3ed202ffU, 0x00000000U, 0xe00c0401U, 0x102fd40eU, 0x10f0f002U, 0x00000000U,
+  0x003ef000U, 0x0f0f0e31U, 0x20ed24e1U, 0x00000000U, 0xed3130e3U, 0xdbff13c2U, 0xf210dfeeU, 0x00000000U,
+  0x102e00eeU, 0x020e00efU, 0x7ed10f02U, 0x00000000U, 0xe0fdf101U, 0x1020f30fU, 0x0001f20fU, 0x00000000U,
+  0x0020efefU, 0xf0f1ed20U, 0x30de53d2U, 0x00000000U, 0xfd210f02U, 0xdfe122b2U, 0xf400e1feU, 0x00000000U,
+  0x100001dbU, 0x01ff0000U, 0x4f100f2fU, 0x00000000U, 0xe0ffe401U, 0x0030030fU, 0xf0f1f201U, 0x00000000U,
+  0x1f1feff0U, 0xe3f2fe11U, 0x1dd032e3U, 0x00000000U, 0xfe120f00U, 0x0f0f0ff1U, 0x04f011dfU, 0x00000000U,
+  0xfe1f020eU, 0x01f0020fU, 0x012100ffU, 0x00000000U, 0xf0f10202U, 0xf0110203U, 0xe0010f0fU, 0x00000000U,
+  0xefffef21U, 0xf2f0101fU, 0x0e0100b1U, 0x00000000U, 0x2f2fef31U, 0x200fd120U, 0x12112fcfU, 0x00000000U,
+  0xeff001ffU, 0x11d10002U, 0x042100ffU, 0x00000000U, 0xf0ff3003U, 0xe0201203U, 0xe00f000eU, 0x00000000U,
+  0xe1d01022U, 0x03021f01U, 0x0d102fbfU, 0x00000000U, 0x3d7fef2fU, 0x21fdf12fU, 0x02f011eeU, 0x00000000U,
+  0x22010ffeU, 0x32e10ef0U, 0x10d002ffU, 0x00000000U, 0xf03df501U, 0x0011e400U, 0x1010ff01U, 0x00000000U,
+  0xf20efd12U, 0x2ffe2c31U, 0x20edf50eU, 0x00000000U, 0xdd4ff2d1U, 0xebef25d1U, 0x10f4def0U, 0x00000000U,
+  0x00f10feeU, 0x220000d0U, 0x5fe000f2U, 0x00000000U, 0xf010f401U, 0x0002e30eU, 0x002ff10fU, 0x00000000U,
+  0xd20f0d22U, 0x2f00fb43U, 0x3fee150fU, 0x00000000U, 0xde20f4e3U, 0xdedf25c4U, 0x1e13be2fU, 0x00000000U,
+  0x1fcf0eecU, 0x022100ffU, 0x3cee0f22U, 0x00000000U, 0xf0f01402U, 0xd010050fU, 0x10002000U, 0x00000000U,
+  0xe2ee1f02U, 0x0011fe04U, 0x2def2330U, 0x00000000U, 0x0d3ee330U, 0x0f0e04f2U, 0xf110eeedU, 0x00000000U,
+  0x0edc0f0dU, 0xf111001fU, 0xfcf00023U, 0x00000000U, 0xf0101001U, 0xd0211402U, 0x10f03f02U, 0x00000000U,
+  0xd2ee1e12U, 0x13111e10U, 0x1eef242fU, 0x00000000U, 0x2e2ee24eU, 0x401ef120U, 0xf221efddU, 0x00000000U,
+  0xedc1001fU, 0xe1010ff2U, 0xc0200f40U, 0x00000000U, 0xf01f3e03U, 0xc0111f06U, 0x40ef1f04U, 0x00000000U,
+  0x0ff01f33U, 0xe3021e02U, 0xfeee343fU, 0x00000000U, 0x3c70e01eU, 0x211b0120U, 0xf311f0eeU, 0x00000000U,
+  0x0ae20dcfU, 0x12f00edfU, 0xd3f0012fU, 0x00000000U, 0x002ff30eU, 0xf042010fU, 0x1000fe0fU, 0x00000000U,
+  0x00edfe03U, 0xe00d2c01U, 0x10000310U, 0x00000000U, 0xde2de0f0U, 0xddfcf2e0U, 0x01011002U, 0x00000000U,
+  0x3bd10de0U, 0x31020ff1U, 0xe3f00e02U, 0x00000000U, 0xf02ff40eU, 0x0043f60cU, 0x30200e00U, 0x00000000U,
+  0xf3f0de14U, 0x7f2c0d04U, 0x311ff51eU, 0x00000000U, 0xfd4fe211U, 0xd0f025efU, 0x3e24ef11U, 0x00000000U,
+  0xfcdf0eeeU, 0x2114020fU, 0x40ef0d14U, 0x00000000U, 0x0040220eU, 0xf011060eU, 0x40102000U, 0x00000000U,
+  0xc400f014U, 0x5f100b34U, 0x101e055fU, 0x00000000U, 0x3d42d22fU, 0xfe2d041fU, 0x0c13bff0U, 0x00000000U,
+  0x0dbe001dU, 0xee05010fU, 0x1dfe0e31U, 0x00000000U, 0xe041210cU, 0xa0114200U, 0x40405202U, 0x00000000U,
+  0xe0200002U, 0x22341cf2U, 0x1f0f0571U, 0x00000000U, 0x3f2fe011U, 0x3e3a024fU, 0xef15b0edU, 0x00000000U,
+  0x3fd10000U, 0xfde00021U, 0xed000f31U, 0x00000000U, 0xf030410eU, 0xc0205f04U, 0x402f2203U, 0x00000000U,
+  0x2e310013U, 0x14230d01U, 0x30f01241U, 0x00000000U, 0x1d4ee02fU, 0x1f291131U, 0xef3501fdU, 0x00000000U,
+  0x100d0001U, 0x00000000U, 0x23000ff0U, 0x101000f0U, 0x001ffe0eU, 0x00000000U, 0x100df403U, 0x00002e0fU,
+  0x1011e11fU, 0x00000000U, 0x011f10b1U, 0x0013ef1fU, 0xf1f010f0U, 0x00000000U, 0x103efff0U, 0x01e02010U,
+  0x110f00ffU, 0x00000000U, 0x03ef0d21U, 0x103f01e0U, 0xe010df0dU, 0x00000000U, 0x10de0306U, 0xe0201f0dU,
+  0xfd11d1ffU, 0x00000000U, 0x13ee1102U, 0x0d23ef1fU, 0xf2b010e1U, 0x00000000U, 0x305fefefU, 0x00d12111U,
+  0x210e00f0U, 0x00000000U, 0xe0df0c51U, 0x424002efU, 0xe001b00eU, 0x00000000U, 0x00f05303U, 0xd030000cU,
+  0xdd21f100U, 0x00000000U, 0x24de1042U, 0x0d34ef1fU, 0x02bf11e2U, 0x00000000U, 0x0d6edfffU, 0x1fa03001U,
+  0xe1fc011fU, 0x00000000U, 0xfef10e21U, 0x333f01ffU, 0x00f1a002U, 0x00000000U, 0x10f06102U, 0xd021000aU,
+  0xbe30f3ffU, 0x00000000U, 0x15d03f22U, 0xfb43cf0fU, 0x03af11e2U, 0x00000000U, 0xfc7ddf2fU, 0x21903202U,
+  0xd3fb011fU, 0x00000000U, 0xec020fd0U, 0x422e0100U, 0x00c2af00U, 0x00000000U, 0xf00e4002U, 0xf001f10bU,
+  0xb031f1f0U, 0x00000000U, 0x22c00f30U, 0xee31d0ffU, 0x01ce1fe1U, 0x00000000U, 0xff50d20fU, 0x12902111U,
+  0x010e012eU, 0x00000000U, 0x21000f00U, 0x00300100U, 0x0010f00dU, 0x00000000U, 0x00fe0202U, 0x000e2f0eU,
+  0xee02ef2fU, 0x00000000U, 0xf12e0fe3U, 0x0023ff1fU, 0xf1e213e1U, 0x00000000U, 0xf02ee0ffU, 0xf1f120f1U,
+  0x210e0f21U, 0x00000000U, 0x01d20e12U, 0x222f00dfU, 0xf011e00eU, 0x00000000U, 0x202e1301U, 0xe02f0000U,
+  0xfd1201f0U, 0x00000000U, 0x12ed2203U, 0xee35ff10U, 0xe1c001f1U, 0x00000000U, 0xff3ede1dU, 0xf0e120f3U,
+  0x101d0e10U, 0x00000000U, 0xe1d10e11U, 0x3210000fU, 0x00f2e102U, 0x00000000U, 0xf01d550eU, 0xf01f0f01U,
+  0xec0100f0U, 0x00000000U, 0x00e00332U, 0xee13d000U, 0x00f00ff0U, 0x00000000U, 0xfe2cbf3fU, 0x10f13103U,
+  0xf02c0010U, 0x00000000U, 0x0fe30f40U, 0x322101ffU, 0x1003f004U, 0x00000000U, 0xc000540fU, 0xf0100f0eU,
+  0xce110100U, 0x00000000U, 0x12022f01U, 0x0f21effeU, 0x00f0ffe0U, 0x00000000U, 0x0e1cb011U, 0x20f02014U,
+  0xa31b0030U, 0x00000000U, 0x3c130011U, 0x313e010fU, 0x0012f003U, 0x00000000U, 0xe0eeef00U, 0xf0f2ff0eU,
+  0x90132220U, 0x00000000U, 0x0fef0020U, 0xef31ff0fU, 0xf2eff1e0U, 0x00000000U, 0xfe0ec203U, 0x10d00032U,
+  0x11000f1eU, 0x00000000U, 0x20e1001fU, 0x1f2100ffU, 0x1000f300U, 0x00000000U, 0x1000e300U, 0xf01f010fU,
+  0xfde12020U, 0x00000000U, 0xf21c41f5U, 0x1e22ef0fU, 0xf0ff24e1U, 0x00000000U, 0xdc0ee3d0U, 0xf0f210f2U,
+  0x10ff0e21U, 0x00000000U, 0x00d10f12U, 0x2e0f00eeU, 0xf02f0103U, 0x00000000U, 0x2010030fU, 0xf01fe000U,
+  0xfaf01010U, 0x00000000U, 0x131e32f4U, 0x0e23ff01U, 0x011ff3f0U, 0x00000000U, 0xfcedf31eU, 0xf0010102U,
+  0x20ee002eU, 0x00000000U, 0x21d10001U, 0x2f0e0f0fU, 0xf0222202U, 0x00000000U, 0x1001140fU, 0x000fef01U,
+  0x0cf10021U, 0x00000000U, 0x23012f11U, 0x000101f1U, 0xf02fdfe0U, 0x00000000U, 0xfdfdc23eU, 0x1f011212U,
+  0x01fd0110U, 0x00000000U, 0x10010020U, 0x0f20011fU, 0x10022102U, 0x00000000U, 0xc010320fU, 0x00f1ef01U,
+  0x0e010202U, 0x00000000U, 0x1f011e13U, 0x100001e0U, 0x0f1edefeU, 0x00000000U, 0x0e1dc11fU, 0x2f111003U,
+  0xe5fe0001U, 0x00000000U, 0x4e210012U, 0x1f3f0110U, 0xf0221f02U, 0x00000000U, 0xe000ff0eU, 0xf0f2e000U,
+  0xd1f30112U, 0x00000000U, 0x01ffef11U, 0xd000210fU, 0x112ddff0U, 0x00000000U, 0x0010c302U, 0x20020f11U,
+  0x20f10e0fU, 0x00000000U, 0x2f93001eU, 0x1d1000ffU, 0x00f1f200U, 0x00000000U, 0x20e3d10fU, 0xf00f0200U,
+  0x1fff4013U, 0x00000000U, 0x000c6111U, 0x0f21fe00U, 0xf02f03e1U, 0x00000000U, 0xdeede3ffU, 0x000f1001U,
+  0x2f0f0e10U, 0x00000000U, 0x20c101f0U, 0x0e10010fU, 0x00d01201U, 0x00000000U, 0x1003d30eU, 0xe0100001U,
+  0x2ee04121U, 0x00000000U, 0x12fc3303U, 0x1f100f00U, 0x122f02e1U, 0x00000000U, 0x0feee40fU, 0x10102111U,
+  0x2f000f0eU, 0x00000000U, 0x1ff00120U, 0x1f10010fU, 0x00d13001U, 0x00000000U, 0xe012f30eU, 0xf001f001U,
+  0x3d112031U, 0x00000000U, 0x21003013U, 0x1f0010f1U, 0x102f11e1U, 0x00000000U, 0x1e0de22eU, 0x10101111U,
+  0x1e000010U, 0x00000000U, 0x21110111U, 0x00100310U, 0x20d03f00U, 0x00000000U, 0xb022f00dU, 0xf0e1fe02U,
+  0x1f211101U, 0x00000000U, 0x1f011f03U, 0x2ff011f0U, 0x1f3000ffU, 0x00000000U, 0x102f0021U, 0x210111f0U,
+  0xf12f0ff2U, 0x00000000U, 0x00400001U, 0xfef10421U, 0x00f0300dU, 0x00000000U, 0xd0e1ef0dU, 0xf0f0ef01U,
+  0x11030ff0U, 0x00000000U, 0xf0000ef0U, 0x00e01100U, 0x2f20000fU, 0x00000000U, 0x12ff1002U, 0x2102f112U,
+  0x10f10fe1U, 0x00000000U, 0x0cc00110U, 0x2c0100ffU, 0x10e10101U, 0x00000000U, 0x00b6f000U, 0x00000101U,
+  0x20002212U, 0x00000000U, 0x1f0e3f20U, 0x011f0e0fU, 0x0e10001fU, 0x00000000U, 0x0f0c022fU, 0x012e0000U,
+  0x2ff00000U, 0x00000000U, 0x0db001f2U, 0x0c1100feU, 0xf0e13f00U, 0x00000000U, 0x00e4e10fU, 0xe0111201U,
+  0x11ff2411U, 0x00000000U, 0x20102022U, 0xf2fffeffU, 0x001f0f00U, 0x00000000U, 0x100df220U, 0xf12f311fU,
+  0x00fe0100U, 0x00000000U, 0xffe00220U, 0xff21010fU, 0x10f04e0eU, 0x00000000U, 0xc0f21e0fU, 0xe0000105U,
+  0x1ff0e400U, 0x00000000U, 0x0e032010U, 0xe1ff10f0U, 0x1f010e0eU, 0x00000000U, 0x320d0220U, 0x03103110U,
+  0x100001e1U, 0x00000000U, 0x01100132U, 0x01210201U, 0x40e1100eU, 0x00000000U, 0xc0000d02U, 0xe0e1ff04U,
+  0x0101f3efU, 0x00000000U, 0xee122fe0U, 0xf0f011f0U, 0x1d04200dU, 0x00000000U, 0x23fe0023U, 0x11f01120U,
+  0x1f0101f1U, 0x00000000U, 0xe0310040U, 0xff000303U, 0x10f1ff0eU, 0x00000000U, 0xd001fe01U, 0x00f0ff02U,
+  0x0f0111e0U, 0x00000000U, 0xcf210fd1U, 0x100001f2U, 0x1cf1101fU, 0x00000000U, 0x01ef1f01U, 0x0002f010U,
+  0xff00000fU, 0x420000e2U, 0xe0f0000fU, 0x010f00d1U, 0x00f01e0fU, 0x0013e102U, 0x001e0000U, 0x00e2f10fU,
+  0x00e20f1eU, 0x013d53c2U, 0x00ffefffU, 0xf00f2fd0U, 0x10de0000U, 0x01300100U, 0x00f0ff0fU, 0xff0df1f0U,
+  0x002e00f0U, 0xf2ee0001U, 0x00ff000fU, 0xf1dd0f01U, 0x00101f0dU, 0xf0b3c104U, 0x002e1202U, 0x00d2f202U,
+  0xee0230efU, 0x031d35c0U, 0x00100effU, 0xf0fd50efU, 0x4fcd0210U, 0x2420f010U, 0x0f1dff1fU, 0x110cd20fU,
+  0x302b000eU, 0xe1ff01d0U, 0x11fc002dU, 0xd1ce0e00U, 0x10f10f0eU, 0xe091d100U, 0x000f2102U, 0x10f1d106U,
+  0xcd2411e1U, 0xf20a23f2U, 0x0f130f2fU, 0x13ec52e0U, 0x4ece1f30U, 0x0232f121U, 0x2f0dfcffU, 0x004de0eeU,
+  0x522b001fU, 0x2fe101c0U, 0x100e000fU, 0xd0e00e1fU, 0xf0f3f001U, 0xe0ccff0eU, 0x00f03202U, 0x00100102U,
+  0xcc5201f1U, 0x12fcf0e3U, 0xff220f00U, 0xf4ef2c21U, 0x21beff10U, 0xe041e44eU, 0x2d0ffcffU, 0xfd6cefefU,
+  0x530d0120U, 0x4fff00e1U, 0x001f00ffU, 0xbdd20000U, 0x0004e10fU, 0x00efe00fU, 0x000f3102U, 0x003f2002U,
+  0xee3021f0U, 0x01ffcf00U, 0x0122ff20U, 0x12c22ff0U, 0xf1aee400U, 0x0f1f122fU, 0x0e1eefffU, 0x0e7f00feU,
+  0xf01d0000U, 0x23ed0100U, 0x1011002eU, 0x1fee00d0U, 0x00f03c0dU, 0x1013f003U, 0xf0f32100U, 0x00c3d000U,
+  0xeee3f1ffU, 0x0f3e43ffU, 0xf0fe1ef0U, 0xff1022f0U, 0x31cfe00fU, 0x14f020e0U, 0x0fffe2ffU, 0x200cd00eU,
+  0x104c01edU, 0x23ee0ee0U, 0x2f3001feU, 0x10ce0f0fU, 0x20f21e0eU, 0xf0f3e103U, 0x00021200U, 0x10d3ff03U,
+  0xdd03efe1U, 0x110e15b0U, 0xff000df1U, 0x02fd520fU, 0x3fd2f0e0U, 0x140f2e0fU, 0x1e0fd110U, 0x33edd00eU,
+  0x223c020eU, 0x200f0dc0U, 0x204e021eU, 0x00d10e01U, 0x20d00f0dU, 0xe0b00100U, 0x1002220fU, 0x1011e002U,
+  0xea25e1f5U, 0xf00ef2f1U, 0x0c33ee00U, 0x24ec411fU, 0x5dd400e1U, 0x020f2f00U, 0x2ff1e1f0U, 0x101f011fU,
+  0x131b023eU, 0x2d1f0ec0U, 0x023f000fU, 0xd2d30effU, 0x00c0ff00U, 0xf00f110fU, 0xf0022400U, 0xf03f110eU,
+  0xda32e402U, 0x9100fd02U, 0x0041fd01U, 0xf2f01f30U, 0x31c2d3f1U, 0x10fe1101U, 0xffefe0f0U, 0xfd2e010dU,
+  0x173b0231U, 0x2cd00fe2U, 0x213f0f00U, 0xcfc70d00U, 0x10d3f001U, 0x1020ff00U, 0xf0ff420fU, 0xe03d2f01U,
+  0xaf30321eU, 0xb112c040U, 0xf131de00U, 0x51d11e12U, 0xf5afe201U, 0x11ef2f00U, 0x0e1deff0U, 0x0c5ff00eU,
+  0xe03f0100U, 0x120e0f0fU, 0xfff10132U, 0x20ef000fU, 0x001e2d0dU, 0x002f1d02U, 0x10c13100U, 0xf0f2d00eU,
+  0x1ce4ef0dU, 0xf11f01f1U, 0xef003221U, 0xff1f12e1U, 0x1fd41101U, 0xe31e0fe2U, 0x1fc1d3ffU, 0x11edefffU,
+  0x1f2e02efU, 0x23f00dfeU, 0xfef10330U, 0x12e10e1eU, 0x0020000eU, 0x004f000fU, 0x20b10200U, 0xf0121e00U,
+  0x1ae2e20fU, 0x210fe2c2U, 0xde004312U, 0xf20e21e0U, 0x2bd63fe3U, 0x12edf1e0U, 0x01e2b4f1U, 0x230ed01eU,
+  0xff3b01f0U, 0x100f0de0U, 0x1f0f0250U, 0x00f20f00U, 0x001f030fU, 0x00100200U, 0x20c1020dU, 0x00120000U,
+  0x1c01e31fU, 0xf102d2f2U, 0xfc003121U, 0x25fc12f1U, 0x2ce61fdfU, 0x01e001d1U, 0x0ff2d301U, 0x1e3f002dU,
+  0xd02f0212U, 0x2dee0fd0U, 0xf210015fU, 0x0ff20fd1U, 0xf0ffff02U, 0x10022003U, 0x20e11200U, 0x10200e00U,
+  0xee0ee430U, 0xc012fef1U, 0x00fd3031U, 0x24f00c20U, 0x00d311e0U, 0xf0be0100U, 0xfff1f310U, 0xff00111fU,
+  0xf62d0212U, 0xfedf0e02U, 0xe32e0f30U, 0xcd050ed0U, 0x10f0f001U, 0x103f0f03U, 0xf0f32002U, 0xf03f3e00U,
+  0xf0ee1330U, 0xc203f0e0U, 0xe3d00f31U, 0x3003cd12U, 0xf3cf13e0U, 0x13ce01f0U, 0x000d010dU, 0x1c203f12U,
+  0xf1100effU, 0x321f010dU, 0xe00e0224U, 0xf100010fU, 0xf01e210fU, 0x00301d00U, 0x20d02001U, 0x0012ee0eU,
+  0x3c120d11U, 0x0ff2f000U, 0xf004e131U, 0xf10f12f0U, 0x1ef142f2U, 0xf1d1f0d1U, 0x11d5e0f1U, 0x00f0e010U,
+  0xc13f0feeU, 0x221f0fffU, 0xd1ee0323U, 0x02220f3fU, 0x101f140fU, 0x10303102U, 0x10a20000U, 0x00111100U,
+  0x3e3fed11U, 0xe0e1d0f0U, 0xdd011131U, 0xf0ff12d0U, 0x1d423213U, 0x01c01fc1U, 0x1ed3e100U, 0x111fe110U,
+  0xef0e01e0U, 0x121f0ce0U, 0xff1e0252U, 0xff120f01U, 0x003e0101U, 0x00213403U, 0x10b2f002U, 0x00320201U,
+  0x0420e01eU, 0xd4f1e1dfU, 0xfffe1431U, 0xf3fe00dfU, 0x0e212021U, 0x01c02fd1U, 0x1ef311ffU, 0x0d21002eU,
+  0xd00101f1U, 0xf00f0dd1U, 0xee10034eU, 0xfff20fe1U, 0xe0fc1e05U, 0x303e2104U, 0x20e21e05U, 0x1011f102U,
+  0xf3f0e0f0U, 0xd311def0U, 0x00df004fU, 0x13e0f0f2U, 0x1fff3f3fU, 0xf1af0ff1U, 0x00f22200U, 0x1f0f2111U,
+  0xf2fe0011U, 0xef0f0ef0U, 0xf01f0031U, 0xde020fcfU, 0x002cff02U, 0x205b2007U, 0xf0111f06U, 0x00022f02U,
+  0xe2bf0001U, 0xb3e2ff10U, 0xe2b1ff3fU, 0x1323dfe1U, 0xffff0000U, 0x13b0ffd1U, 0x21ee4010U, 0x22103f33U,
+  0x201100f0U, 0x1e110feeU, 0xf21e0012U, 0xe10f0300U, 0x0001210fU, 0x001efe0fU, 0x1001030eU, 0x00d1f001U,
+  0x1e2ffe01U, 0x10ef0f01U, 0x1f230321U, 0xf11ff000U, 0xef2e001fU, 0xfd00fff1U, 0x1fe42013U, 0x0f00e021U,
+  0x1ff1000eU, 0x01010dffU, 0xf30f0fe4U, 0xf12f0110U, 0xe02e1f0eU, 0xf01e1201U, 0x20f0f101U, 0xe0efe002U,
+  0x212dfd00U, 0xe3c0fd12U, 0x1f31f222U, 0xf2120001U, 0xee3c2200U, 0x0d0110e3U, 0xfcd23021U, 0x1e4fdf42U,
+  0xeef200d0U, 0xb1ef0ef0U, 0xe1f00223U, 0xee0f0112U, 0xe02d0f01U, 0xe02c6403U, 0x00ffef06U, 0xe011ff02U,
+  0xe3000d00U, 0xc3f0ee23U, 0x030f0221U, 0xd31310efU, 0x101d0213U, 0x1cefffc4U, 0x0cff1001U, 0x1e3f0041U,
+  0x0df001dfU, 0xae0e0e02U, 0xfeff0322U, 0x00f10ff1U, 0xd02c3203U, 0x005b6506U, 0xf0ff1f07U, 0x1012ff03U,
+  0xd2e2fe00U, 0xc3efef11U, 0xd1df0000U, 0xf4f310f1U, 0x01fe1022U, 0xe1c0dff1U, 0x00ff1021U, 0x212f212fU,
+  0x2e0000e0U, 0xdd0f0e00U, 0x1f2e0121U, 0xf1110fe0U, 0x003e0102U, 0x005d4304U, 0xe0203206U, 0x00122103U,
+  0xf2cffff1U, 0xc4a3ef11U, 0xb3d10fffU, 0x1433f0deU, 0xfffff000U, 0xf0efcfe1U, 0x01de1001U, 0x36103021U,
+  0x00000000U, 0x2100000fU, 0xef01004fU, 0x110e0100U, 0x00000000U, 0x0010f101U, 0x00fd3f00U, 0x000fff0eU,
+  0x00000000U, 0x002f01f2U, 0x00e3fd4fU, 0x0002f200U, 0x00000000U, 0xf13201f0U, 0x0ff0ff10U, 0x010000e0U,
+  0x00000000U, 0x01ef0110U, 0x1e10003fU, 0x02fe0001U, 0x00000000U, 0xf010e104U, 0x000f610fU, 0xe001de0eU,
+  0x00000000U, 0x220d2201U, 0x1e040d20U, 0xfe1404efU, 0x00000000U, 0x1242f1f1U, 0x1dedfd00U, 0x02d102f0U,
+  0x00000000U, 0x010f0101U, 0x2e210061U, 0xf1fe0010U, 0x00000000U, 0xe0ffe002U, 0x10f16100U, 0x0002cf02U,
+  0x00000000U, 0x320b31f1U, 0x1fe3ef10U, 0xce1104eeU, 0x00000000U, 0x00510101U, 0x2dddffefU, 0x35b011f0U,
+  0x00000000U, 0x111001e0U, 0x2d000020U, 0xc0ed003fU, 0x00000000U, 0xf0efff00U, 0x30f13000U, 0x00f2d004U,
+  0x00000000U, 0x312d1cf1U, 0x00e0e000U, 0xbe310400U, 0x00000000U, 0xff50f11fU, 0x2ede0f0eU, 0x05fffff0U,
+  0x00000000U, 0x201f01efU, 0xfeff0001U, 0xe3ee001fU, 0x00000000U, 0xe0d0ff0fU, 0x00f0200eU, 0x00ffd005U,
+  0x00000000U, 0x001fdff1U, 0xfff1df00U, 0xd04222f0U, 0x00000000U, 0xff1fd1f0U, 0x2fdfef0fU, 0xf30ff0efU,
+  0x00000000U, 0x110f00feU, 0xf02e003fU, 0xf1ff0120U, 0x00000000U, 0x101cf001U, 0x000e4100U, 0x002f000eU,
+  0x00000000U, 0x212ef211U, 0xf0e3fd20U, 0xeef4f10eU, 0x00000000U, 0xf13010f1U, 0x1fe0ff0fU, 0xf0d302f0U,
+  0x00000000U, 0x10f00deeU, 0x1f3f004eU, 0x01df0001U, 0x00000000U, 0xf02ee101U, 0x000f420fU, 0x0011100fU,
+  0x00000000U, 0x03fe0202U, 0xeef3ff10U, 0xeb05130eU, 0x00000000U, 0x0020f1f0U, 0x1fff1d1fU, 0x02e4fff1U,
+  0x00000000U, 0x000f0dd0U, 0x1f2f003eU, 0x01fe0f0fU, 0x00000000U, 0x001ee20fU, 0x00ff230fU, 0x10212202U,
+  0x00000000U, 0xf1fbf211U, 0x1e020001U, 0xfc02031eU, 0x00000000U, 0x0f201002U, 0x2ef0ffedU, 0x2f12fdffU,
+  0x00000000U, 0xff1100feU, 0x2f20002eU, 0xfff1002fU, 0x00000000U, 0xf0fe0200U, 0x10e1f101U, 0x10ef4102U,
+  0x00000000U, 0xf03dee21U, 0x1f12e000U, 0x0d03120eU, 0x00000000U, 0xfe5d0f10U, 0x1fd100d1U, 0xfe32e1feU,
+  0x00000000U, 0x1e20010fU, 0x0e5f0021U, 0xd3e00101U, 0x00000000U, 0x00fff000U, 0x00e1f00fU, 0x10fd2102U,
+  0x00000000U, 0xee2e0e41U, 0xff01cf10U, 0x0ef22201U, 0x00000000U, 0xfe4ed002U, 0x00b0f1e0U, 0x0120d2e0U,
+  0x00000000U, 0x001000feU, 0xf11f0010U, 0x11f20f0eU, 0x00000000U, 0xf02be000U, 0x000f3200U, 0x00100300U,
+  0x00000000U, 0x011fd102U, 0xeed4ce01U, 0xed003e11U, 0x00000000U, 0xef3000e2U, 0x1e00ff10U, 0x0eef14e2U,
+  0x00000000U, 0x10000defU, 0xf02f0222U, 0x21f101feU, 0x00000000U, 0xf04cef00U, 0x10f0120fU, 0x10322200U,
+  0x00000000U, 0xf101e201U, 0xc0f1ee00U, 0xfc103f05U, 0x00000000U, 0xf01ff1e1U, 0x2b021e11U, 0x0e11e402U,
+  0x00000000U, 0x00f00dedU, 0x1f2c0123U, 0x31ff0e1dU, 0x00000000U, 0xf01ff102U, 0xe0e2e10dU, 0x0012440eU,
+  0x00000000U, 0xe12ff012U, 0xe0120202U, 0x2b202021U, 0x00000000U, 0x000101f0U, 0x0fd1fe00U, 0x1f30e1f1U,
+  0x00000000U, 0xfffe010eU, 0xfe1f0123U, 0xf2110f20U, 0x00000000U, 0x00ee1100U, 0xf0d3ff01U, 0x00f1700eU,
+  0x00000000U, 0xe040cf11U, 0xf1022311U, 0x2e112f11U, 0x00000000U, 0x002e0e2fU, 0x01c021d2U, 0x1c0fb100U,
+  0x00000000U, 0x0e0000fdU, 0xd04e0112U, 0x00120e12U, 0x00000000U, 0xf0de1f01U, 0x0003ef01U, 0xf0014e0dU,
+  0x00000000U, 0xfe2fff42U, 0xe100f00eU, 0x21f30f12U, 0x00000000U, 0x0d7ffef0U, 0xf3b011e1U, 0x1a2eb100U,
+  0x00000000U, 0x1013010fU, 0x0d0d0f00U, 0x10f10e0dU, 0x00000000U, 0xe03ff40fU, 0x00fe120fU, 0x10f2030fU,
+  0x00000000U, 0x10efed21U, 0x0f02d1f1U, 0x0e1c3215U, 0x00000000U, 0xec30f3e1U, 0x201fe01fU, 0xff2fe201U,
+  0x00000000U, 0x1f000fd0U, 0x0edc0002U, 0x3fe0001dU, 0x00000000U, 0xf03f120fU, 0x10fff10fU, 0x10f2150fU,
+  0x00000000U, 0x10dfee10U, 0x0f21f2f0U, 0x1f0c2403U, 0x00000000U, 0xef2113e1U, 0x3d00ee2fU, 0xf00f0321U,
+  0x00000000U, 0x00d10ef0U, 0x01f00206U, 0x32f1022eU, 0x00000000U, 0x001f3200U, 0x10f2ef0eU, 0x00d1320cU,
+  0x00000000U, 0x1ffeee22U, 0xf20212f0U, 0x2e2f3201U, 0x00000000U, 0xf010e0eeU, 0x1ee0ee4fU, 0x1ef2f12fU,
+  0x00000000U, 0x0e0f0ff0U, 0xf2400203U, 0x00120110U, 0x00000000U, 0x100f1001U, 0x00f1ef01U, 0xf0b03e0dU,
+  0x00000000U, 0x001fd042U, 0xe10112f0U, 0x1d011fe1U, 0x00000000U, 0xf120ef0eU, 0x1fd02022U, 0x1a012310U,
+  0x00000000U, 0xdce100feU, 0x006e0001U, 0xf0100001U, 0x00000000U, 0x10ef2e02U, 0xf023c103U, 0xf0f10e0cU,
+  0x00000000U, 0x2f000052U, 0xd200010dU, 0x01040ef0U, 0x00000000U, 0x0f71effeU, 0xf39e3001U, 0x2b0ff021U,
+  0x00000000U, 0xfbe30eefU, 0x1efe002fU, 0xfefe00e1U, 0x00000000U, 0x00f0f20fU, 0x0010030fU, 0x10d2ff02U,
+  0x00000000U, 0x11ef0e14U, 0xfe24f00fU, 0xef2ef101U, 0x00000000U, 0xfc40e211U, 0x11e00fffU, 0x0e0fee20U,
+  0x00000000U, 0x1cf20d00U, 0x102e0010U, 0xfffd0311U, 0x00000000U, 0x0012140fU, 0x40010f0dU, 0x00f0fe03U,
+  0x00000000U, 0x21effe24U, 0x1f23f30fU, 0xb21f0210U, 0x00000000U, 0x1c42e313U, 0x11e20e1dU, 0x1010fe30U,
+  0x00000000U, 0xfcdf0f1fU, 0x23100f03U, 0x020f0231U, 0x00000000U, 0x00225100U, 0x10e0e00dU, 0xf0e1fe00U,
+  0x00000000U, 0x01fdfe55U, 0x3e2210ffU, 0xe000020fU, 0x00000000U, 0x1f32c212U, 0x1dfef021U, 0x20f11f21U,
+  0x00000000U, 0xdad00e30U, 0x23020ff4U, 0x03000130U, 0x00000000U, 0x10114001U, 0x10cec001U, 0x10d2ef01U,
+  0x00000000U, 0x021f0131U, 0x1e212eefU, 0xe00011f0U, 0x00000000U, 0x1f22c00eU, 0x2ffd1014U, 0x1dd03031U,
+  0x00000000U, 0xc9e20f00U, 0x321f01f0U, 0x131f0011U, 0x00000000U, 0x20f05000U, 0xf0fea002U, 0x0000de01U,
+  0x00000000U, 0x3f220041U, 0xcf2f10efU, 0xf0001fdfU, 0x00000000U, 0x1e51012dU, 0xf2bf1003U, 0x2fcf1000U,
+  0x00000000U, 0x10000000U, 0x00000000U, 0x10110011U, 0x00000000U, 0x00100000U, 0x00000000U, 0x0020200fU,
+  0x00000000U, 0x000ff0f0U, 0x00000000U, 0x001f2d20U, 0x00000000U, 0x1101ef00U, 0x00000000U, 0xdf1e3001U,
+  0x00000000U, 0x0f1002efU, 0x00000000U, 0x112200f0U, 0x00000000U, 0xf0110f01U, 0x00000000U, 0xd040210dU,
+  0x00000000U, 0x200ff000U, 0x00000000U, 0x1f32fd20U, 0x00000000U, 0x010000f0U, 0x00000000U, 0xdc0c2021U,
+  0x00000000U, 0x101001ffU, 0x00000000U, 0x323102d1U, 0x00000000U, 0x0010f101U, 0x00000000U, 0xe0401f0eU,
+  0x00000000U, 0x102ef110U, 0x00000000U, 0x1f42ddf0U, 0x00000000U, 0xf010f0e1U, 0x00000000U, 0xfefe2021U,
+  0x00000000U, 0x11f000e0U, 0x00000000U, 0x330f01f1U, 0x00000000U, 0x0010d101U, 0x00000000U, 0xf0402f0dU,
+  0x00000000U, 0x102e1100U, 0x00000000U, 0x1023bceeU, 0x00000000U, 0xf010f0ffU, 0x00000000U, 0x00cf2f13U,
+  0x00000000U, 0x02ff0000U, 0x00000000U, 0x121c0000U, 0x00000000U, 0x00f1d001U, 0x00000000U, 0x1000ff0cU,
+  0x00000000U, 0x11302100U, 0x00000000U, 0xf002afefU, 0x00000000U, 0x0f20fe01U, 0x00000000U, 0x1fc03d12U,
+  0x00000000U, 0x0ff0001fU, 0x00000000U, 0x11010120U, 0x00000000U, 0x00120200U, 0x00000000U, 0x002e130fU,
+  0x00000000U, 0x1fff10ffU, 0x00000000U, 0x0210fd41U, 0x00000000U, 0x01fff0f0U, 0x00000000U, 0xdf1e21d1U,
+  0x00000000U, 0x1e000e1fU, 0x00000000U, 0x0010020fU, 0x00000000U, 0xf010f200U, 0x00000000U, 0xf0301000U,
+  0x00000000U, 0x000011efU, 0x00000000U, 0xf1110e11U, 0x00000000U, 0xf1f001e1U, 0x00000000U, 0xe10e11f1U,
+  0x00000000U, 0x0e1f0f10U, 0x00000000U, 0x1030020fU, 0x00000000U, 0xf000e001U, 0x00000000U, 0x0010fe01U,
+  0x00000000U, 0xff0f00efU, 0x00000000U, 0x1210ff0eU, 0x00000000U, 0xe000f1e0U, 0x00000000U, 0x011f2013U,
+  0x00000000U, 0x00f0000eU, 0x00000000U, 0x221f0210U, 0x00000000U, 0x001fd201U, 0x00000000U, 0xf020ef01U,
+  0x00000000U, 0x002e1100U, 0x00000000U, 0x1112f0fdU, 0x00000000U, 0xef00f1e0U, 0x00000000U, 0xf0111d03U,
+  0x00000000U, 0x12f0010fU, 0x00000000U, 0x121d0100U, 0x00000000U, 0xf00fe100U, 0x00000000U, 0xf040ff0eU,
+  0x00000000U, 0x102f0200U, 0x00000000U, 0xf203eeefU, 0x00000000U, 0x002101f0U, 0x00000000U, 0x1fe01b13U,
+  0x00000000U, 0x2ef10f11U, 0x00000000U, 0x20f1003eU, 0x00000000U, 0x20d10101U, 0x00000000U, 0x001e1601U,
+  0x00000000U, 0x1fff5300U, 0x00000000U, 0x0ff2ec51U, 0x00000000U, 0xf20101f0U, 0x00000000U, 0xe00d22e1U,
+  0x00000000U, 0x2df10e21U, 0x00000000U, 0x21110f1dU, 0x00000000U, 0x00e00203U, 0x00000000U, 0xf01e2300U,
+  0x00000000U, 0x2fef4300U, 0x00000000U, 0xfff1ed0eU, 0x00000000U, 0xf23f01deU, 0x00000000U, 0xf00ef0f2U,
+  0x00000000U, 0x0dff0f1fU, 0x00000000U, 0x1010011eU, 0x00000000U, 0xe0ff1004U, 0x00000000U, 0xe01f0000U,
+  0x00000000U, 0x0de12220U, 0x00000000U, 0x1f0001e0U, 0x00000000U, 0xe10f20b0U, 0x00000000U, 0xf030f100U,
+  0x00000000U, 0xe00e0f2eU, 0x00000000U, 0x1120030eU, 0x00000000U, 0x101f0305U, 0x00000000U, 0xe0f1ff01U,
+  0x00000000U, 0x1e0f0111U, 0x00000000U, 0x400f210fU, 0x00000000U, 0x00200fbeU, 0x00000000U, 0xe1210002U,
+  0x00000000U, 0x0301000eU, 0x00000000U, 0x220002e1U, 0x00000000U, 0x00f00201U, 0x00000000U, 0xf0210f01U,
+  0x00000000U, 0x1e0ef210U, 0x00000000U, 0x10e10f00U, 0x00000000U, 0x002100deU, 0x00000000U, 0x00001e12U,
+  0x00000000U, 0x10f00310U, 0x00000000U, 0x50010e1eU, 0x00000000U, 0x20c10f01U, 0x00000000U, 0xe00f0700U,
+  0x00000000U, 0x42ff3310U, 0x00000000U, 0x1001fb32U, 0x00000000U, 0x02130001U, 0x00000000U, 0xef0d22d0U,
+  0x00000000U, 0x3ae10f11U, 0x00000000U, 0x1f000e0fU, 0x00000000U, 0x10be1001U, 0x00000000U, 0xf0e00500U,
+  0x00000000U, 0x4edf5521U, 0x00000000U, 0x01120d00U, 0x00000000U, 0x1031ef1eU, 0x00000000U, 0xf01e11d1U,
+  0x00000000U, 0x3aed0d20U, 0x00000000U, 0x0f10001eU, 0x00000000U, 0x10df1f01U, 0x00000000U, 0xe0f00103U,
+  0x00000000U, 0x2edd1440U, 0x00000000U, 0x001011f0U, 0x00000000U, 0xf120ffcfU, 0x00000000U, 0x0120f0e2U,
+  0x00000000U, 0xfcdf0d2eU, 0x00000000U, 0x000f011fU, 0x00000000U, 0x40ff3103U, 0x00000000U, 0xe0e20f04U,
+  0x00000000U, 0x3fee2410U, 0x00000000U, 0xe0ff12ffU, 0x00000000U, 0xe140e09fU, 0x00000000U, 0xf210f000U,
+  0x00000000U, 0xf0f00ffeU, 0x00000000U, 0x2ee10301U, 0x00000000U, 0xf0d0320eU, 0x00000000U, 0xe0f1f003U,
+  0x00000000U, 0x0f0f03ffU, 0x00000000U, 0xf1ff1ff1U, 0x00000000U, 0xf020d1d0U, 0x00000000U, 0x0010002eU,
+  0x00000000U, 0x05010130U, 0x00000000U, 0x41030d0fU, 0x00000000U, 0x20f11d01U, 0x00000000U, 0x0012030eU,
+  0x00000000U, 0x40122521U, 0x00000000U, 0x10ff2e22U, 0x00000000U, 0x12051101U, 0x00000000U, 0xfe2f12f0U,
+  0x00000000U, 0x13ff0d2fU, 0x00000000U, 0x1f040e20U, 0x00000000U, 0x30022e0eU, 0x00000000U, 0xf0032300U,
+  0x00000000U, 0x52311730U, 0x00000000U, 0x300e1e12U, 0x00000000U, 0x1f16f0f0U, 0x00000000U, 0xe01f1310U,
+  0x00000000U, 0x50f00c4eU, 0x00000000U, 0xfff20021U, 0x00000000U, 0x50e2300eU, 0x00000000U, 0xf0023301U,
+  0x00000000U, 0x604f3731U, 0x00000000U, 0x101f1d12U, 0x00000000U, 0x1d37dfaeU, 0x00000000U, 0x011de10fU,
+  0x00000000U, 0x3dc00e1cU, 0x00000000U, 0xeef00220U, 0x00000000U, 0x20c13f0dU, 0x00000000U, 0xd0023203U,
+  0x00000000U, 0x610e2210U, 0x00000000U, 0xef0f1011U, 0x00000000U, 0xfe62f0ddU, 0x00000000U, 0x001de01fU,
+  0x00000000U, 0x0ef00eefU, 0x00000000U, 0x0ce10120U, 0x00000000U, 0xf0e14f0eU, 0x00000000U, 0xd0011002U,
+  0x00000000U, 0x10e001f0U, 0x00000000U, 0x01000f11U, 0x00000000U, 0x0e1ff0fdU, 0x00000000U, 0x0e2ef01fU,
+  0xd0e0000fU, 0x11120f31U, 0x43200111U, 0x20000030U, 0x00eff000U, 0x00102300U, 0x0025300fU, 0x001f100fU,
+  0x00e0eeefU, 0x01002c31U, 0x004d2f31U, 0x000fff21U, 0x10f0f0f0U, 0xee2c0101U, 0xc22e5011U, 0xef0f00f0U,
+  0x00f101f0U, 0xf1310f0fU, 0x142d01b1U, 0x0f0e002fU, 0x00fee10dU, 0xf02f410fU, 0xe0051e00U, 0xf001200fU,
+  0x10eee0c1U, 0x11212d41U, 0xe06eee6eU, 0xff10ff1fU, 0x2f02e001U, 0xec1b0200U, 0xd1ec4013U, 0xeffdf000U,
+  0x00d20113U, 0x03400f01U, 0x251d00b2U, 0x0f0f0f1eU, 0x10ffe20dU, 0xf02f6100U, 0xc0e33e01U, 0xe0022f0eU,
+  0x4ff01200U, 0x0121fb21U, 0xf330dd0eU, 0xe0020021U, 0x1e03bf0fU, 0xebfc2211U, 0xf1c15e14U, 0xfffd01f1U,
+  0x21f10203U, 0xd3110e00U, 0x03e000c2U, 0xf0f0000eU, 0xf020030cU, 0xf05f5301U, 0x00e12f0fU, 0xd0f22f0fU,
+  0x4e000111U, 0x0101eb00U, 0x010fddfdU, 0xc1f1ff10U, 0xfe01c000U, 0x0c0e2021U, 0x10b23015U, 0x0efdf200U,
+  0x20e301d3U, 0xf0110011U, 0xf00e00f1U, 0xfeff000fU, 0x10112000U, 0xd0304101U, 0x2010f10dU, 0xf0f2100eU,
+  0x200122f0U, 0x01f10012U, 0xe1f1d01fU, 0xe0f0d030U, 0xff11b0dfU, 0x2e3f1e41U, 0x11d12021U, 0x1feef31fU,
+  0xf1000f1fU, 0x31010f5fU, 0x42020311U, 0x0010015fU, 0x001ff20fU, 0x00e22700U, 0xe032200eU, 0xf0402001U,
+  0xffdf0f11U, 0x021f4a41U, 0x115d0c4fU, 0x00f02f1fU, 0xfff002e0U, 0xfd0a01ffU, 0xd42d2200U, 0xf0fd01ffU,
+  0xd1030121U, 0x0231011dU, 0x420d06c1U, 0x000f013eU, 0x101ef20eU, 0xe0003400U, 0xf044ee0fU, 0xf03f200fU,
+  0xeefe02f0U, 0xe2303a31U, 0xe04efd2dU, 0xdf031200U, 0x1ef4e200U, 0x1e2d12f0U, 0xe5ff30e1U, 0x01df0f1fU,
+  0xe1e20323U, 0xe0200220U, 0x230d06c1U, 0x10fe0f2fU, 0xf01ee10dU, 0xf0f03101U, 0xe042ec00U, 0xf020300eU,
+  0x1d01031fU, 0x102f1b2fU, 0x0200ffebU, 0xc10401f1U, 0x0e13ef2fU, 0xdd20e502U, 0xf1003d02U, 0x10ef1e0fU,
+  0x11c204f2U, 0xf12e0100U, 0xf01f04b0U, 0x011d0f0dU, 0xe02e110dU, 0xe0102f01U, 0xe0230c0fU, 0xf0f3310fU,
+  0x1efe0320U, 0x500efb1fU, 0xf2f2d0ecU, 0xe1f21ff1U, 0x0021b01eU, 0xed110102U, 0x10e41bf6U, 0x3ffe000fU,
+  0x3fd402c0U, 0xff320001U, 0xc13c01d1U, 0x1d0d0f1eU, 0xf01d430dU, 0xe0503000U, 0x20350e0eU, 0xf0d31f0fU,
+  0x2f0f1201U, 0x41e1de11U, 0xb4e3f00eU, 0xe0f0fd11U, 0x0002c2efU, 0x2d34ff30U, 0x21d43c23U, 0x3dfe113fU,
+  0xf1e00030U, 0x41e10030U, 0x5113032fU, 0x10010120U, 0x1010f10eU, 0x10c33700U, 0xd051230fU, 0xf0222002U,
+  0xffde2020U, 0x12103d41U, 0x3f2fed4cU, 0x1ef16d0fU, 0xfcd204d0U, 0xee2a110eU, 0xf44ef20fU, 0xeefd2f0fU,
+  0xe0010011U, 0x00320f11U, 0x3e12010fU, 0x002e012fU, 0x2000f200U, 0xf0f22400U, 0xe0500d00U, 0x10111101U,
+  0xfbef2223U, 0x210e2b3fU, 0x3dedf20bU, 0xf0f24e01U, 0x0e05e2efU, 0xee2d23f1U, 0xf53ee002U, 0x1ed02ff1U,
+  0x00e20130U, 0xee400300U, 0xff1102d0U, 0x0f1e011eU, 0x0011020cU, 0xf0e2de02U, 0xf031ec03U, 0x00100200U,
+  0x1d011f51U, 0x2ffd0e0dU, 0x2fc004bcU, 0xe103eef1U, 0x2f10c10eU, 0xde4012e1U, 0xf321f112U, 0x1de22fe3U,
+  0x22e2011fU, 0xfe2004eeU, 0xe23003bdU, 0x0d11001dU, 0xd020220eU, 0xe002dd04U, 0xe0220f01U, 0xf010110fU,
+  0x0ff01130U, 0x31dee02cU, 0xf0e3f0dfU, 0xe114ee01U, 0x0f10d00dU, 0xf0323fd3U, 0x12f30c34U, 0x3ef10e1fU,
+  0x4f0100d0U, 0xfc2402f0U, 0xd63c0700U, 0x2d30002dU, 0xf0ff220cU, 0xe02f1003U, 0xe0410e0eU, 0xf002000eU,
+  0x1feff000U, 0x3fe1d21eU, 0xa2e4e0deU, 0xe023ef0fU, 0x0013f10dU, 0x10451d02U, 0x23931b35U, 0x3dff2e20U,
+  0xf3e20030U, 0x5ff10121U, 0x5f450113U, 0x20f00214U, 0x2004f101U, 0x20e11601U, 0xf04e1401U, 0x10f30003U,
+  0xf0ec6e42U, 0x12ff1030U, 0x41f10b3eU, 0x100031e0U, 0xeee017d1U, 0xf12fe01dU, 0x0f7df11fU, 0xe01eff2eU,
+  0xd0f1010eU, 0x1ee00013U, 0x3f520341U, 0x10000203U, 0xf012f202U, 0x20e10203U, 0xf04e2002U, 0x10c3ff01U,
+  0x00de2f33U, 0x13ed111dU, 0x3ecf0f0bU, 0x10000fd1U, 0xf000f4d0U, 0x012fef0fU, 0x06510ff1U, 0xf0ff3f00U,
+  0x0f100f1eU, 0xefff0102U, 0x4e12030eU, 0x012f01f1U, 0xf0202101U, 0xe0e0dd04U, 0x003f2002U, 0xe0e2ee0eU,
+  0x0ff10132U, 0x0fcc02ecU, 0x3dd0120bU, 0xfef2edf0U, 0x120fe1c1U, 0x02200ee1U, 0xe4211fe0U, 0xf3ee2fe2U,
+  0x1110011eU, 0x0dff01f1U, 0x1ff203e1U, 0x002101efU, 0xe03f100fU, 0x00d1df02U, 0x001f2f01U, 0xf0f1ef0fU,
+  0x10e20211U, 0x2fbcf50dU, 0x0ed2e4edU, 0xff02ed1eU, 0x0011f0f0U, 0xe4242eefU, 0x04022f02U, 0x12ef5f14U,
+  0x2f20001fU, 0xee0002e1U, 0x010f05f1U, 0xff4000f0U, 0xe00f210dU, 0x20002203U, 0x203e2f0dU, 0x1000e10fU,
+  0x1fe00f1fU, 0x30def30eU, 0xa1b3e2feU, 0xee22e03dU, 0xf00100f0U, 0x0335fe0fU, 0x22f5def3U, 0x12c13002U,
+  0xe3f00f11U, 0x1df00200U, 0x2b0300b3U, 0x31df03f3U, 0x10340001U, 0x1001f20fU, 0x101e0203U, 0x10f2e003U,
+  0x11fd7f22U, 0x22e0f110U, 0x13fffdfeU, 0x010e02ffU, 0xef00340fU, 0x2f12e000U, 0x1f7efe0fU, 0xf021de2fU,
+  0xe301022fU, 0x0e020f00U, 0x1cf30f00U, 0x2eef0307U, 0xe023f003U, 0x20eff203U, 0x00db2106U, 0x10e2ee02U,
+  0x22fd5e21U, 0x21ef021fU, 0xc1bdfd19U, 0x11ff130eU, 0xe0ef44d0U, 0x2013ef10U, 0x035c0f12U, 0x010fff4dU,
+  0xe200034dU, 0xfd010e02U, 0x1ce10e0eU, 0x0e1f0217U, 0xc0222e02U, 0x20efe003U, 0x000b4106U, 0x10d1ec02U,
+  0x00f11f2fU, 0xf0fff3fdU, 0xafae131cU, 0x0fcd041eU, 0xf2e032e1U, 0x13320010U, 0xf52f0f1fU, 0x05ffff10U,
+  0xee2f024fU, 0x0dde0001U, 0x00d202e1U, 0xfe300125U, 0xb0402f01U, 0x301ff105U, 0x200e2004U, 0x20e1ed02U,
+  0xeff200ffU, 0x0fdff420U, 0xc1a0f400U, 0xe1ef021fU, 0x010102e0U, 0xe233f001U, 0xe203f02eU, 0x05010f22U,
+  0x0d2f005fU, 0x0ff0011fU, 0x1fff04e1U, 0xdf5f0112U, 0xf0102000U, 0x00201203U, 0x302e2101U, 0x2001df03U,
+  0xff020f1fU, 0x12ee0210U, 0x2390f210U, 0xd1ef010fU, 0xff02f1f0U, 0x0122e0fdU, 0x0004d0ffU, 0xf3c32002U,
+  0x00010011U, 0x00000000U, 0x00000000U, 0xf0000001U, 0x000f010fU, 0x00000000U, 0x00000000U, 0x000f1f0fU,
+  0x00000e00U, 0x00000000U, 0x00000000U, 0x00f0fd2fU, 0xdf0e2111U, 0x00000000U, 0x00000000U, 0xfff01f10U,
+  0x01020000U, 0x00000000U, 0x00000000U, 0x0f1f02e3U, 0xe020010fU, 0x00000000U, 0x00000000U, 0xe0121e0dU,
+  0x00120c11U, 0x00000000U, 0x00000000U, 0x0ef01e0eU, 0xee0a2130U, 0x00000000U, 0x00000000U, 0xfe0f0e01U,
+  0x021200f1U, 0x00000000U, 0x00000000U, 0x211e02f3U, 0xf0301100U, 0x00000000U, 0x00000000U, 0xf012fe0aU,
+  0x10120d11U, 0x00000000U, 0x00000000U, 0x3b0620ffU, 0x0e192030U, 0x00000000U, 0x00000000U, 0x01cf11e0U,
+  0x033100e1U, 0x00000000U, 0x00000000U, 0x140e00f2U, 0xd030210eU, 0x00000000U, 0x00000000U, 0xf0100009U,
+  0x0122faf0U, 0x00000000U, 0x00000000U, 0x3d05ffffU, 0x0efd3032U, 0x00000000U, 0x00000000U, 0x329f11f1U,
+  0x123f01f1U, 0x00000000U, 0x00000000U, 0xf32c01d1U, 0xe011000cU, 0x00000000U, 0x00000000U, 0x0002e10aU,
+  0x0011def0U, 0x00000000U, 0x00000000U, 0x0e22c0efU, 0x20e03e21U, 0x00000000U, 0x00000000U, 0x30912d12U,
+  0x10e00010U, 0x00000000U, 0x00000000U, 0xf1100120U, 0xf000030eU, 0x00000000U, 0x00000000U, 0x0020110eU,
+  0xf100fc22U, 0x00000000U, 0x00000000U, 0x00efcd40U, 0xdf0c12e0U, 0x00000000U, 0x00000000U, 0xdf0f00f0U,
+  0x21120110U, 0x00000000U, 0x00000000U, 0x003e0200U, 0xe010040fU, 0x00000000U, 0x00000000U, 0xe031000eU,
+  0xd1011c22U, 0x00000000U, 0x00000000U, 0x0ef1ef3fU, 0xf1eb010fU, 0x00000000U, 0x00000000U, 0xf020f0e0U,
+  0x214101f2U, 0x00000000U, 0x00000000U, 0x312f0311U, 0x0010f300U, 0x00000000U, 0x00000000U, 0xf032f00eU,
+  0xf0000ef2U, 0x00000000U, 0x00000000U, 0x1df5012fU, 0x000df211U, 0x00000000U, 0x00000000U, 0xf2ff00ffU,
+  0x03300203U, 0x00000000U, 0x00000000U, 0x220e0302U, 0xe02ff100U, 0x00000000U, 0x00000000U, 0x0002010dU,
+  0x2011fef0U, 0x00000000U, 0x00000000U, 0x0d03f1e0U, 0xf11e0023U, 0x00000000U, 0x00000000U, 0x23bf2000U,
+  0x133f0101U, 0x00000000U, 0x00000000U, 0x041c02e0U, 0xd030e10dU, 0x00000000U, 0x00000000U, 0x0013000cU,
+  0x0010fd00U, 0x00000000U, 0x00000000U, 0xef22ffc0U, 0x21fe2e32U, 0x00000000U, 0x00000000U, 0x32ae2e21U,
+  0x2ff10f2fU, 0x00000000U, 0x00000000U, 0x021f003fU, 0x0001f50fU, 0x00000000U, 0x00000000U, 0xf020030eU,
+  0xf0f10d51U, 0x00000000U, 0x00000000U, 0x2ef0fe60U, 0xdfec23efU, 0x00000000U, 0x00000000U, 0xee1f13f0U,
+  0x3f020f2fU, 0x00000000U, 0x00000000U, 0x111e023fU, 0x00010600U, 0x00000000U, 0x00000000U, 0xe0011f0eU,
+  0xe1e2fd40U, 0x00000000U, 0x00000000U, 0x0ff2df6fU, 0xf1fef3e0U, 0x00000000U, 0x00000000U, 0xff1000f0U,
+  0x30010f10U, 0x00000000U, 0x00000000U, 0x30100001U, 0x00101300U, 0x00000000U, 0x00000000U, 0xe0101100U,
+  0xf0011f1fU, 0x00000000U, 0x00000000U, 0xfe04101fU, 0x010ed20fU, 0x00000000U, 0x00000000U, 0x10f02f00U,
+  0x32200200U, 0x00000000U, 0x00000000U, 0x3f2f0100U, 0xe0100202U, 0x00000000U, 0x00000000U, 0xf001f101U,
+  0x1f00200fU, 0x00000000U, 0x00000000U, 0xef3320ffU, 0xf11fe101U, 0x00000000U, 0x00000000U, 0x11ee3fffU,
+  0x220f0210U, 0x00000000U, 0x00000000U, 0x240d02ffU, 0xe020f000U, 0x00000000U, 0x00000000U, 0xe0100002U,
+  0xf0f10f10U, 0x00000000U, 0x00000000U, 0xd0102fcfU, 0x02000f11U, 0x00000000U, 0x00000000U, 0x23ee2ef0U,
+  0x21030f1fU, 0x00000000U, 0x00000000U, 0x12200e2fU, 0xe02f0200U, 0x00000000U, 0x00000000U, 0xf0ff0201U,
+  0x10000d31U, 0x00000000U, 0x00000000U, 0x2e02fe40U, 0xefee24f0U, 0x00000000U, 0x00000000U, 0x0f1033e0U,
+  0x2011002fU, 0x00000000U, 0x00000000U, 0xf21f0220U, 0xe0f0240fU, 0x00000000U, 0x00000000U, 0xd00f010fU,
+  0x1ff2fc31U, 0x00000000U, 0x00000000U, 0xef03fe2fU, 0x021e02dfU, 0x00000000U, 0x00000000U, 0x1d0011e2U,
+  0x2101012fU, 0x00000000U, 0x00000000U, 0x11100220U, 0xf0011200U, 0x00000000U, 0x00000000U, 0xf00e0100U,
+  0x00011e10U, 0x00000000U, 0x00000000U, 0xe0120ef1U, 0xf01ff2f0U, 0x00000000U, 0x00000000U, 0x0f102003U,
+  0x10010111U, 0x00000000U, 0x00000000U, 0x210f000fU, 0xe0210002U, 0x00000000U, 0x00000000U, 0x00ff0f01U,
+  0x0001200fU, 0x00000000U, 0x00000000U, 0x0f120effU, 0xf21f000fU, 0x00000000U, 0x00000000U, 0x1f1c00f1U,
+  0x10010110U, 0x00000000U, 0x00000000U, 0x130000ffU, 0xe0011001U, 0x00000000U, 0x00000000U, 0xe0ed1002U,
+  0xf0f1f020U, 0x00000000U, 0x00000000U, 0xff1f0e00U, 0x0200fff0U, 0x00000000U, 0x00000000U, 0x012c1fefU,
+  0x31130e10U, 0x00000000U, 0x00000000U, 0x20f20dffU, 0xf022100fU, 0x00000000U, 0x00000000U, 0x0001020fU,
+  0x20012d20U, 0x00000000U, 0x00000000U, 0x21f02c22U, 0xf01033f0U, 0x00000000U, 0x00000000U, 0xed3e2200U,
+  0x10130f30U, 0x00000000U, 0x00000000U, 0x0f120120U, 0xf012220fU, 0x00000000U, 0x00000000U, 0xd000230fU,
+  0x4e0f2d12U, 0x00000000U, 0x00000000U, 0x1f002d24U, 0xe01f33f0U, 0x00000000U, 0x00000000U, 0xef2f3300U,
+  0x01f10140U, 0x00000000U, 0x00000000U, 0x1f010021U, 0xf0013301U, 0x00000000U, 0x00000000U, 0xe0f0020eU,
+  0x2e102d12U, 0x00000000U, 0x00000000U, 0xf00f1e04U, 0xef1d010eU, 0x00000000U, 0x00000000U, 0x0f2e2011U,
+  0xf0110031U, 0x00000000U, 0x00000000U, 0x1fe10f02U, 0xd0f22000U, 0x00000000U, 0x00000000U, 0xe0e00f00U,
+  0x10011f01U, 0x00000000U, 0x00000000U, 0x0ffe1ef0U, 0x002c1010U, 0x00000000U, 0x00000000U, 0x101c100eU,
+  0xedf10000U, 0x00000000U, 0x00000000U, 0xff0000f0U, 0xf0012000U, 0x00000000U, 0x00000000U, 0x00f01001U,
+  0x01010010U, 0x00000000U, 0x00000000U, 0x00deff10U, 0x0f2e0001U, 0x00000000U, 0x00000000U, 0xfe1e000fU,
+  0x0ff10001U, 0xf0fe000fU, 0x00000000U, 0x00000000U, 0x1010f002U, 0x00f10e00U, 0x000d1e0eU, 0x00000000U,
+  0x100f020fU, 0x0001020fU, 0x00f5d21eU, 0x00000000U, 0x10f10010U, 0x11e1ff00U, 0x01e21000U, 0x00000000U,
+  0x0ff00120U, 0x0f1f01ffU, 0x000101d0U, 0x00000000U, 0x0001e001U, 0x00f1fd00U, 0xf0fdff0fU, 0x00000000U,
+  0x2101111fU, 0x0f0111efU, 0x0ef410ffU, 0x00000000U, 0xf10101ffU, 0x12e21000U, 0x04d2321fU, 0x00000000U,
+  0x00ef0130U, 0x110d00ffU, 0x122f0f0fU, 0x00000000U, 0x10ffef01U, 0x10e0df01U, 0xf000bf00U, 0x00000000U,
+  0x21022100U, 0xfe130fffU, 0xcf12f0f1U, 0x00000000U, 0xf21000e1U, 0x12001ff0U, 0x23f03121U, 0x00000000U,
+  0xf00f0020U, 0x010d0010U, 0x031e0f20U, 0x00000000U, 0x100fff01U, 0xf0f0fe02U, 0xf001b00fU, 0x00000000U,
+  0x11011100U, 0x0f12f0e1U, 0xbe40e220U, 0x00000000U, 0xf1100fe1U, 0x100f1ef1U, 0x020e4f52U, 0x00000000U,
+  0xff000020U, 0xf10d0020U, 0x361f012eU, 0x00000000U, 0x00e10f01U, 0x00f2f001U, 0xc001c000U, 0x00000000U,
+  0xf10f0110U, 0xe011f1f0U, 0xd0501f00U, 0x00000000U, 0x0001f0f1U, 0x11ff0001U, 0x00ee5031U, 0x00000000U,
+  0x0ff20001U, 0xff3f0100U, 0xef2000e1U, 0x00000000U, 0x1002f001U, 0x00010c0fU, 0x00ce1e0eU, 0x00000000U,
+  0x3100110fU, 0x2ff1f3feU, 0x1ef700ceU, 0x00000000U, 0xf11000f0U, 0x31f30000U, 0xf1d22f10U, 0x00000000U,
+  0x2fe10f11U, 0x0f2d01fdU, 0x0e100fd2U, 0x00000000U, 0x10e10000U, 0x10f1eb0eU, 0x00af0101U, 0x00000000U,
+  0x3001122eU, 0x0e02f30eU, 0xfef510d1U, 0x00000000U, 0xe21f0ff0U, 0x11f40002U, 0x03c220f0U, 0x00000000U,
+  0x0000002fU, 0x110d0f0fU, 0x1f010e10U, 0x00000000U, 0x10f00e01U, 0x20e1ee0fU, 0x10b3e003U, 0x00000000U,
+  0x00030120U, 0x1e13f1f0U, 0xef0000d1U, 0x00000000U, 0xe10f0defU, 0x10c201f2U, 0x20f31ff0U, 0x00000000U,
+  0xf1100010U, 0xf11d0f1fU, 0x100f0030U, 0x00000000U, 0x10ff0f01U, 0x10e1ef00U, 0x10d2ff03U, 0x00000000U,
+  0xf0f20000U, 0x0f11f1e0U, 0xf1100111U, 0x00000000U, 0xf0002ee1U, 0x21d111f1U, 0x4d2fff2fU, 0x00000000U,
+  0xe12f001eU, 0xf21e002fU, 0x061e0010U, 0x00000000U, 0x00ff0f00U, 0x10f2f003U, 0xc0f20100U, 0x00000000U,
+  0x00e00ff0U, 0xef121210U, 0x013d1001U, 0x00000000U, 0x0f0f10e2U, 0x21ff00f2U, 0x1f2ce04fU, 0x00000000U,
+  0x10ff0101U, 0xe1200101U, 0xfd2000e3U, 0x00000000U, 0x10d10001U, 0x00100d0fU, 0x00a00c00U, 0x00000000U,
+  0x20f0020fU, 0x3d01f20dU, 0xfff521bfU, 0x00000000U, 0xf2111ff0U, 0x30051f22U, 0xf4b22c20U, 0x00000000U,
+  0x20000100U, 0xf02f01feU, 0x1f0f00e2U, 0x00000000U, 0x00b10000U, 0x0020fc00U, 0x00a0f001U, 0x00000000U,
+  0x20f0020fU, 0x2b02d20dU, 0xcf02f0d4U, 0x00000000U, 0xf211fee1U, 0x3e171f13U, 0xf3cf3d00U, 0x00000000U,
+  0x110f00f0U, 0xf01e01eeU, 0xf10e0011U, 0x00000000U, 0x00c11e00U, 0x1010fe02U, 0x20c12002U, 0x00000000U,
+  0x0001e100U, 0x1d01d41eU, 0xfd0fff12U, 0x00000000U, 0xf1110ff2U, 0x20072ef2U, 0x30e100ffU, 0x00000000U,
+  0x11100ff0U, 0xf21f00ffU, 0x11e00230U, 0x00000000U, 0x00f00f01U, 0x2000f001U, 0xf0c2310fU, 0x00000000U,
+  0x1001e0e0U, 0x2f11d200U, 0xfe2d2222U, 0x00000000U, 0xff0110c3U, 0x10f41ff2U, 0x2d20c20dU, 0x00000000U,
+  0x123001eeU, 0xf30e00f1U, 0x03d2001fU, 0x00000000U, 0xe0e0ff0dU, 0x20021102U, 0xc0d1200cU, 0x00000000U,
+  0x1f11f1d0U, 0x20110201U, 0x0f4e1e11U, 0x00000000U, 0xfff100d4U, 0x1f011ff0U, 0x1c4db12dU, 0x00000000U,
+  0x120d0201U, 0xe12f020fU, 0x00fd0303U, 0x00000000U, 0x10001f00U, 0x10011f01U, 0xf0e01c0fU, 0x00000000U,
+  0x10e003ffU, 0x2e02f10fU, 0xef15f0cfU, 0x00000000U, 0x11f30ff0U, 0x10350002U, 0x23c20d10U, 0x00000000U,
+  0x20ee0011U, 0xd13f0110U, 0x3edc0004U, 0x00000000U, 0x00ff1000U, 0xf0001e01U, 0x30d0100fU, 0x00000000U,
+  0xffe002d0U, 0x1f12f00eU, 0xd0240001U, 0x00000000U, 0x00e20fe1U, 0x1e441013U, 0x00cf00f0U, 0x00000000U,
+  0x010e0f01U, 0xd020000fU, 0x01ed0021U, 0x00000000U, 0x10e00f0fU, 0xf0010f01U, 0x30e1410eU, 0x00000000U,
+  0xffff01dfU, 0x0011f1ffU, 0x0d2f1e41U, 0x00000000U, 0x0f01fed1U, 0x0e3120f2U, 0x01f0d1efU, 0x00000000U,
+  0x141000f0U, 0xf1100fefU, 0x21ef002fU, 0x00000000U, 0x00c1f10eU, 0x00f10e01U, 0xf0cf310dU, 0x00000000U,
+  0xfe1000f0U, 0x201101efU, 0x1b3c2f20U, 0x00000000U, 0x0ffe11e0U, 0x0f012001U, 0x1e2fb0efU, 0x00000000U,
+  0x140f00efU, 0x11010ff1U, 0x01c1011eU, 0x00000000U, 0xf0e2010bU, 0x10111101U, 0xf0b0220aU, 0x00000000U,
+  0x0e2f00efU, 0x121111f0U, 0x0b4e1020U, 0x00000000U, 0x0000e1e0U, 0x1d10111fU, 0xfc3dc01dU, 0x00000000U,
+  0xf01f0211U, 0x002001f1U, 0x241e0033U, 0x00000000U, 0x10001e00U, 0x10f01002U, 0x20e02f0dU, 0x00000000U,
+  0x10f1030fU, 0x20100200U, 0x1015e400U, 0x00000000U, 0x1ef41ff2U, 0x1f230011U, 0x03c41f01U, 0x00000000U,
+  0x002e0f32U, 0x00200010U, 0x530b0d05U, 0x00000000U, 0x2031200eU, 0x001f1002U, 0x5013300bU, 0x00000000U,
+  0x0f111200U, 0xf100021fU, 0x0f341200U, 0x00000000U, 0x0fd41ff0U, 0x10220011U, 0x1fc0eeffU, 0x00000000U,
+  0xf43d0f31U, 0xf020000fU, 0x54de00d1U, 0x00000000U, 0x0024010cU, 0x10011f02U, 0x30f33009U, 0x00000000U,
+  0x0d2f00ffU, 0xe1e0130fU, 0x5c21103fU, 0x00000000U, 0x0fe23ffdU, 0x10121e0fU, 0x20eeefe0U, 0x00000000U,
+  0x172f012eU, 0x00000fffU, 0x41d000ceU, 0x00000000U, 0xf0f3df0cU, 0x20f21002U, 0xf0cf3f09U, 0x00000000U,
+  0x1c201fefU, 0xf1f0211fU, 0x5c4f002fU, 0x00000000U, 0x0eef100fU, 0x001120feU, 0x2f3cf1feU, 0x00000000U,
+  0x0710010fU, 0x01100001U, 0x00d000d0U, 0x00000000U, 0xf0e2ee0cU, 0x10f11101U, 0x00ceef0aU, 0x00000000U,
+  0x0d2f1fffU, 0x21ff1010U, 0x3e4e000fU, 0x00000000U, 0x1fe000f1U, 0x1f01110fU, 0x0d0ed00dU, 0x00000000U,
+  0x0ff000ffU, 0x002f0102U, 0x02000022U, 0x110e0001U, 0x00fefe0fU, 0x10101000U, 0x00221300U, 0x00142301U,
+  0x00e0efefU, 0x1003e10fU, 0x0011103eU, 0xf03e2020U, 0xdff001f0U, 0x20f50ff0U, 0x00f00000U, 0x000f0011U,
+  0xffd10f11U, 0x121f03e0U, 0x13ff0012U, 0x13f00000U, 0x000edd0eU, 0x30111f0cU, 0x1022130fU, 0x10021202U,
+  0x3fd2010fU, 0x0e03e2efU, 0x1111012eU, 0x042f2d20U, 0xf00f0310U, 0x3ef7edd2U, 0x0f120f00U, 0x004ee201U,
+  0xe0d30e03U, 0x210105f0U, 0x22fe0001U, 0x022f01d0U, 0x2000cb00U, 0x3000f00cU, 0x00202301U, 0x00012001U,
+  0x4ee402eeU, 0x0c13f2f1U, 0x10001111U, 0x02101d2fU, 0x02e1110fU, 0x4ef5cde0U, 0x1f200e00U, 0x0030e0ffU,
+  0xa0d00021U, 0x3101040fU, 0x11ff00e1U, 0x12200001U, 0x20c0cc00U, 0x400fd00dU, 0x001f2101U, 0x100f200fU,
+  0x2fdf331eU, 0x1c23e611U, 0x11110100U, 0x00000010U, 0x13f00f0fU, 0x23e3efd1U, 0x0f102e01U, 0x0e112d21U,
+  0xc1d1014fU, 0x21f001f0U, 0xf00100efU, 0x1f110010U, 0x20eeef03U, 0x4000d00eU, 0x001f1102U, 0xf01e010fU,
+  0x11cf4410U, 0x0e1203f0U, 0x11f2e000U, 0x00f0f0f0U, 0xf01100f0U, 0x12d0e0e1U, 0x00301f11U, 0x00111e11U,
+  0xfff000e1U, 0xf43f000fU, 0x22020123U, 0x310c0002U, 0xf0e0dd0fU, 0x203e010eU, 0x00121300U, 0x00f02001U,
+  0x1fef02efU, 0xffe2d02fU, 0xf011203fU, 0xc24fdf30U, 0xfeede010U, 0x1e1601e3U, 0xfe10f30fU, 0x10df0f20U,
+  0xfde30201U, 0x030002f1U, 0x42ff0114U, 0x221002f0U, 0xf0dfde0eU, 0x404d020dU, 0x1020150fU, 0x200f1101U,
+  0x5ff205feU, 0x1ff0e24dU, 0xff1f1140U, 0xe320df30U, 0x12d0f12fU, 0x3a46e0e2U, 0x0d110200U, 0x0ee1ff10U,
+  0xefb20d01U, 0xd2100100U, 0x00020100U, 0x022001eeU, 0xf0e1d901U, 0x104c2200U, 0x100d250fU, 0x201e0100U,
+  0x50f402fdU, 0x11fef34dU, 0x1f2f0022U, 0x021fe022U, 0x25df0f50U, 0x2c25eef1U, 0x1c00e220U, 0x0e0100f0U,
+  0xf0c10d2fU, 0x0e010101U, 0xff110ed0U, 0x011f0000U, 0x00e1db01U, 0x002d2201U, 0x000f220fU, 0x002d000fU,
+  0x30c0222eU, 0x2eff042fU, 0x1102fdf1U, 0x110ff212U, 0x10ed0140U, 0x0d14f0eeU, 0x0d1f1f30U, 0x0e121f1fU,
+  0xe1a30f10U, 0x00d000d1U, 0xedf10fdfU, 0x1ee00ff1U, 0x100eff02U, 0x300e3101U, 0xf00e1f0fU, 0x100e0f0fU,
+  0x20bd52e2U, 0x100113e0U, 0xf002dfe2U, 0x0ff1f302U, 0x0f0ff2f0U, 0x11d000ffU, 0x1e1e1e11U, 0x0f02fe00U,
+  0xdef002d1U, 0xf32e0ffcU, 0x420f021fU, 0x313f001fU, 0x00c1de0fU, 0x10ee020fU, 0x00f10500U, 0x001e220fU,
+  0x110012dfU, 0x1e220c3eU, 0xee100e40U, 0xc111cd21U, 0x2f00ef2fU, 0x0d111314U, 0x1121e111U, 0x3fd10fe0U,
+  0xef1000dfU, 0xd13000fdU, 0x20e0032fU, 0x2010000fU, 0xf0c1fe0eU, 0x102ef101U, 0x20d01302U, 0x204e230dU,
+  0x000201e1U, 0x3040ed4fU, 0x102e0040U, 0x02fffe01U, 0x3130ef31U, 0x1a332311U, 0x1f11e110U, 0x0d21f0feU,
+  0xf1f20fc1U, 0xf20002fbU, 0x0d0f032eU, 0x0f10000eU, 0xe0f10a00U, 0xe0401301U, 0x30e0120fU, 0x1040030fU,
+  0x0312e1d0U, 0x4120dc1cU, 0x01202110U, 0x210f0100U, 0x211e1d51U, 0x0e013014U, 0x1f02f01fU, 0xff12f0fdU,
+  0x22cf0ef2U, 0x10d201eeU, 0xfe0e02e0U, 0x01d20420U, 0x30e10d0eU, 0xb0211101U, 0x10f1fd00U, 0xf04ff20fU,
+  0x12111f30U, 0x2001fdcfU, 0x021f0eb0U, 0x3ffd011fU, 0x2100f150U, 0x1d1f2f22U, 0x0fe03f32U, 0x0ff4d100U,
+  0x02a20e01U, 0x1df10fd0U, 0xff2c03e0U, 0x2dd202e1U, 0x40ee0001U, 0xd0103002U, 0x1001ff01U, 0x001f300eU,
+  0x1f1e1014U, 0x32f20dd1U, 0xe101cdcfU, 0x30f0d1f0U, 0x1d1ee320U, 0x1b1d1f0eU, 0x03af0022U, 0x0ef2f121U,
+  0xddee03d0U, 0x01fd0efdU, 0x112e000eU, 0x203f0d1aU, 0xf0c3ed0eU, 0x0000010fU, 0x00d00302U, 0x000f2100U,
+  0xd020f3e0U, 0xdf2e2f22U, 0xd021e0f0U, 0x0112eb22U, 0x02f1c140U, 0xf0fff1e0U, 0x1332e021U, 0xf00f20f2U,
+  0x0f0101f2U, 0x04df0f09U, 0xf01e033fU, 0x0f020f29U, 0x00f1fd0eU, 0xe010f701U, 0x10cf0100U, 0x0020150eU,
+  0xd212f2c0U, 0xe01d4031U, 0xe12feffeU, 0x112f0c00U, 0x00fedf40U, 0xfffcf4f1U, 0x3112ef3fU, 0x0d0df120U,
+  0xf42200e2U, 0x13c30ffbU, 0xdf3f0420U, 0x00c20f0cU, 0x0022fd00U, 0xd001f201U, 0x00cfee02U, 0xd000f300U,
+  0xe3010eb0U, 0xd0103ff2U, 0xb3f1ffcfU, 0x001f20efU, 0x20fe0e31U, 0x100af405U, 0x2ff10012U, 0x200bf120U,
+  0x15f10ddfU, 0xf1e400edU, 0xd00f0410U, 0x11c201efU, 0x10e1ef0fU, 0xb0000f01U, 0xf000ee04U, 0xc0110f01U,
+  0xf2100bc1U, 0xe0020fb0U, 0x9402d0a0U, 0x101011d1U, 0x3ffdff22U, 0x1f0a1220U, 0x00b110f4U, 0x100ae02fU,
+  0xf6c10dbeU, 0x2ff10fffU, 0x211d030fU, 0x40d200f0U, 0x10f1100dU, 0xb00f0000U, 0xe011f10eU, 0xc000100fU,
+  0x1050fdf2U, 0xf112ffb1U, 0xc201dedfU, 0x1100efd0U, 0x1e3cff20U, 0x0efbe10fU, 0x049dffe5U, 0x1f0bff3fU,
+  0x2d2f02f0U, 0x0ef001dfU, 0x0d1f000fU, 0x022e0efcU, 0x00d10f0dU, 0x001f0001U, 0xf0eef302U, 0x0021110eU,
+  0xe020d3efU, 0xdfdd10f0U, 0xd100e001U, 0xef2ffd11U, 0x12e1e02fU, 0xff0ff0efU, 0x20120f12U, 0x0ffd20f1U,
+  0x310f01f0U, 0x20f0031dU, 0xff1e020fU, 0x02e30f1bU, 0xf001fd0cU, 0xe03ee101U, 0xd0ece105U, 0xe020f200U,
+  0xe112f2e0U, 0xb2cf2000U, 0xa4f2fedeU, 0x111f1d0fU, 0x31efee3fU, 0x020fe0efU, 0x2001fe03U, 0x003b1111U,
+  0x12f000bfU, 0x31f1033fU, 0x00fe0210U, 0x1fa20ffcU, 0xf0010e0cU, 0xe04f010fU, 0xe0feee03U, 0xc0effd0eU,
+  0x0f03ffc0U, 0xe1c141f0U, 0x94e300bdU, 0xf1132effU, 0x41fc0e30U, 0x14f0f2f0U, 0x10d0fff2U, 0x12390120U,
+  0x01ef0e9eU, 0x1ff1023eU, 0x12fe0f01U, 0x2fc00fdeU, 0x00d00c0dU, 0xd020230eU, 0xd010f001U, 0xb0ff0e0eU,
+  0x1111fec1U, 0x00f12f0fU, 0xb3d302beU, 0x001310eeU, 0x300b1e1eU, 0xf3ff120fU, 0x02bd1fe2U, 0x11fa0010U,
+  0xe2e00d90U, 0x2ee0013fU, 0x72fe0f0fU, 0x2fd10ff0U, 0xf0ee1e0aU, 0xf000100fU, 0xf010110eU, 0xe00f1f0fU,
+  0x3f41ffcfU, 0xf00011ffU, 0xbff000efU, 0x1f1200efU, 0x301c102fU, 0x00c01000U, 0x02aee0e0U, 0x11fd000fU,
+  0x110f0000U, 0x020f0000U, 0x103f011eU, 0x00000000U, 0x1000ff00U, 0x0012200fU, 0x000f210fU, 0x00000000U,
+  0x0010f101U, 0x00121e2fU, 0x1000ef21U, 0x00000000U, 0x01110000U, 0x01fe3101U, 0x10030ff0U, 0x00000000U,
+  0x1ff0000fU, 0x142e0fdfU, 0x104003feU, 0x00000000U, 0x0000ff01U, 0xf003310fU, 0x103f3f0cU, 0x00000000U,
+  0x00101000U, 0xe010ef20U, 0x2e00e001U, 0x00000000U, 0x1000f100U, 0xe2dd3001U, 0x3f06fde2U, 0x00000000U,
+  0x0f0f0101U, 0x03110fc0U, 0x3f4103d0U, 0x00000000U, 0x00ffff01U, 0xe0d3200cU, 0x204f100aU, 0x00000000U,
+  0x201010f0U, 0xb11e100fU, 0x2d11e0e1U, 0x00000000U, 0x00100100U, 0xf0de2031U, 0x20f4fef1U, 0x00000000U,
+  0x102f0000U, 0x110200c0U, 0x520201d1U, 0x00000000U, 0x00f01000U, 0xe0d5200dU, 0x3050e00cU, 0x00000000U,
+  0x200000e0U, 0xd01d2fffU, 0x4e3324e0U, 0x00000000U, 0x100010f0U, 0x1fde0240U, 0x32d4e00fU, 0x00000000U,
+  0x201f01e1U, 0x40000fd0U, 0x64f101f3U, 0x00000000U, 0x00e12001U, 0x00f2110eU, 0x2001e00eU, 0x00000000U,
+  0x101f01f0U, 0xf11e0f1fU, 0x4e4055e1U, 0x00000000U, 0x1102f100U, 0x00fff21fU, 0x12e4e1f0U, 0x00000000U,
+  0xf01f01ffU, 0x141f0100U, 0xe13f0130U, 0x00000000U, 0xf0ff000fU, 0x0003210fU, 0x103e3200U, 0x00000000U,
+  0x0f00e110U, 0xf0310f00U, 0x0fffd040U, 0x00000000U, 0x10011001U, 0xf2f00f00U, 0xfd032fe1U, 0x00000000U,
+  0x0000000fU, 0x153e00ceU, 0xd06f020fU, 0x00000000U, 0xf0eff001U, 0xe0e31001U, 0x004f200fU, 0x00000000U,
+  0x0000f100U, 0xe121fe11U, 0x00ffbd3fU, 0x00000000U, 0x00f20201U, 0xf1fe2f01U, 0xf9232ee1U, 0x00000000U,
+  0x1fff00f0U, 0x24310fedU, 0xee7104deU, 0x00000000U, 0x00d20f01U, 0xe0e22f00U, 0x101e200eU, 0x00000000U,
+  0x00fff100U, 0xf220e0f1U, 0x1e00d21dU, 0x00000000U, 0xff00f111U, 0x32101f22U, 0x1e250fefU, 0x00000000U,
+  0x1f0f01ffU, 0x214f0fdfU, 0x2f4201e0U, 0x00000000U, 0xf0f00000U, 0xd0d30e01U, 0x101ffe00U, 0x00000000U,
+  0x11000000U, 0xc32f0effU, 0x2d11130cU, 0x00000000U, 0x1f101100U, 0x3f0fe133U, 0x3014d10eU, 0x00000000U,
+  0x2e30020fU, 0x4f3f0f00U, 0x420101e3U, 0x00000000U, 0xf0f02102U, 0xe0f20000U, 0x204f0100U, 0x00000000U,
+  0x101f22f0U, 0x9120ff1fU, 0x2f3e25feU, 0x00000000U, 0x1f33f2f0U, 0x10d0d001U, 0x13f4e10fU, 0x00000000U,
+  0xf0000ff0U, 0x22100100U, 0xf21e0020U, 0x00000000U, 0x00f00f00U, 0xf020200fU, 0x102f2401U, 0x00000000U,
+  0x0000e100U, 0xff2feff0U, 0xf1110e40U, 0x00000000U, 0x10e00ff1U, 0x00001f31U, 0xed0141f3U, 0x00000000U,
+  0x000f00feU, 0x122001efU, 0x01100000U, 0x00000000U, 0xf0f0ff01U, 0xf0112f0fU, 0x00101302U, 0x00000000U,
+  0xef010100U, 0x011fdff1U, 0x21e10d3fU, 0x00000000U, 0xffe101e1U, 0x0effff01U, 0xeb3041e1U, 0x00000000U,
+  0x1ff000dfU, 0x0f2101eeU, 0xfe0101feU, 0x00000000U, 0x00f0ef01U, 0x00d22e0dU, 0xe0101f01U, 0x00000000U,
+  0xf11010e0U, 0x0ff1f1f0U, 0x30e1ee3dU, 0x00000000U, 0x0de20120U, 0x31e0f201U, 0x0c4f2fd1U, 0x00000000U,
+  0x3e0f01ffU, 0x0f4f0fe0U, 0xed010001U, 0x00000000U, 0x00e0ef00U, 0xf0c30f0dU, 0xf01e0103U, 0x00000000U,
+  0x2f1f11dfU, 0xfff323f0U, 0x2de0f33dU, 0x00000000U, 0x1e0f200eU, 0x21d002f3U, 0x1022eedfU, 0x00000000U,
+  0x3e0f012eU, 0x003e0010U, 0xe00101e0U, 0x00000000U, 0x00e00002U, 0xe0f3100eU, 0x102d0303U, 0x00000000U,
+  0x2d1e5411U, 0xb0f2f12fU, 0x2dfe0430U, 0x00000000U, 0x1f5201eeU, 0x11cfe1f5U, 0xf112d0ddU, 0x00000000U,
+  0x0f1f0f01U, 0x22310100U, 0x21e00110U, 0x00000000U, 0x00211f0fU, 0x003f210fU, 0xf0100201U, 0x00000000U,
+  0x10f0f100U, 0x10f00fe0U, 0xf000ef21U, 0x00000000U, 0x01f01fe0U, 0x2f201f2fU, 0xffe000f1U, 0x00000000U,
+  0x0f2f0ff1U, 0x103301ddU, 0x33c000feU, 0x00000000U, 0xf0000f01U, 0x00403f0fU, 0x1010f40eU, 0x00000000U,
+  0xeee000f0U, 0x22eff0ffU, 0x200fff22U, 0x00000000U, 0xf3f010d1U, 0x103f111eU, 0xeeff01f2U, 0x00000000U,
+  0xfe100ed1U, 0x0e1500dfU, 0x4eee0feeU, 0x00000000U, 0xf000ee03U, 0xf04e1f0eU, 0x000e000fU, 0x00000000U,
+  0xde0110efU, 0x22d1f2fdU, 0x1ff0f13fU, 0x00000000U, 0xf4e01001U, 0x210101feU, 0xf01ef2f0U, 0x00000000U,
+  0x0e0e0f00U, 0x0e2400e1U, 0x2dd10dcfU, 0x00000000U, 0x0001e003U, 0x001f1e0dU, 0x002d3200U, 0x00000000U,
+  0x0f2f000fU, 0x03b403feU, 0x1fdff21eU, 0x00000000U, 0xf2ff1f0fU, 0x21d12003U, 0x2e10dfdeU, 0x00000000U,
+  0x2ff00130U, 0x1d020202U, 0xffe10eefU, 0x00000000U, 0x30e1f302U, 0x100d1e0cU, 0x103e3201U, 0x00000000U,
+  0x4c3d4450U, 0xe1a10320U, 0x3eeff330U, 0x00000000U, 0x0f52f0eaU, 0x12e10104U, 0xe021dfceU, 0x00000000U,
+  0x0c010023U, 0x102101feU, 0x120e011fU, 0x00000000U, 0x00101e0fU, 0x003f0100U, 0xf050010fU, 0x00000000U,
+  0x30e2f210U, 0xf2ee0befU, 0xf00f0f01U, 0x00000000U, 0x0f022000U, 0x1f2e2e00U, 0x00ef11f1U, 0x00000000U,
+  0x0d000f23U, 0xfe2503cdU, 0x350f011fU, 0x00000000U, 0x30302f01U, 0x000f0002U, 0xf021f00cU, 0x00000000U,
+  0x1fd0f22fU, 0x03bc1cfdU, 0x3010e001U, 0x00000000U, 0x0211f1efU, 0x023f30d0U, 0xfdd001f1U, 0x00000000U,
+  0xef1f0d31U, 0xce0600b0U, 0x43f00effU, 0x00000000U, 0x30314f00U, 0xe00b1101U, 0x00fe000cU, 0x00000000U,
+  0xefd0015fU, 0xf2901efdU, 0x3f20fff0U, 0x00000000U, 0x0210efdeU, 0x032000f2U, 0x1ceff0f2U, 0x00000000U,
+  0xb11e0e1fU, 0xcc1100c3U, 0x31b00edeU, 0x00000000U, 0x6042340fU, 0xe02c1003U, 0xf03e110cU, 0x00000000U,
+  0x1e100170U, 0xe4a3010eU, 0x3f100fffU, 0x00000000U, 0xe1020fdcU, 0x11f0e024U, 0x1d0d20f1U, 0x00000000U,
+  0xc202010fU, 0x0a0002e2U, 0x22f10fefU, 0x00000000U, 0x4012150fU, 0x102c200eU, 0x0030100eU, 0x00000000U,
+  0x5b502162U, 0x1294f100U, 0x5e1f0001U, 0x00000000U, 0x0e44010cU, 0x02e2e0f3U, 0x0d2ff0ffU, 0x00000000U,
+  0x10000001U, 0x02f10101U, 0xffef000eU, 0x00000000U, 0x00100f0eU, 0x0040ff0eU, 0x00e31f0fU, 0x00000000U,
+  0x00010ff0U, 0x002d2f21U, 0xf0eff00fU, 0x00000000U, 0xf0fe0110U, 0xc13e1201U, 0x00eff01fU, 0x00000000U,
+  0x0f010f01U, 0x01f200e0U, 0xf000000dU, 0x00000000U, 0xe0000001U, 0xd021fd0fU, 0xf0f20f0fU, 0x00000000U,
+  0xe1011ff1U, 0x012e1030U, 0xefff20feU, 0x00000000U, 0xf2ed122fU, 0xb01a12f1U, 0x01dcf110U, 0x00000000U,
+  0x00010f00U, 0xf1230fbfU, 0x100f0f1dU, 0x00000000U, 0xf0220f01U, 0xd0220e0eU, 0xd0f10e02U, 0x00000000U,
+  0xd2010fe0U, 0xe32e2f0fU, 0xbf12100eU, 0x00000000U, 0x02fb1f3fU, 0xc31e12f1U, 0x10dbd01fU, 0x00000000U,
+  0x11f00e01U, 0xf2120fc1U, 0xf0100f1fU, 0x00000000U, 0xf0020001U, 0xe01ffd0fU, 0xf0e11e03U, 0x00000000U,
+  0xd2011f00U, 0xf5fd1dfeU, 0xc1f1ff0fU, 0x00000000U, 0x010c2f3eU, 0xe31f2020U, 0x0eee2e1fU, 0x00000000U,
+  0x11f00010U, 0xe0010fdfU, 0xef1e004eU, 0x00000000U, 0xe0121001U, 0xf00f1e00U, 0x00011001U, 0x00000000U,
+  0xf2f02e10U, 0xe3ffef01U, 0xe101ee30U, 0x00000000U, 0x100d303fU, 0x1f300f2fU, 0x0ffd300fU, 0x00000000U,
+  0x0ff00001U, 0x010201ffU, 0xf00f000fU, 0x00000000U, 0xf0100e0fU, 0xf03df00fU, 0xf0d32d0eU, 0x00000000U,
+  0xe1022fefU, 0x013fdff1U, 0xe00010efU, 0x00000000U, 0x01eff01fU, 0x012ff010U, 0x41ee0f40U, 0x00000000U,
+  0x0f000111U, 0x0f0200f0U, 0x010f01efU, 0x00000000U, 0x00f11f00U, 0x002c0f0fU, 0xf0c32c00U, 0x00000000U,
+  0xd0121ed2U, 0x250fee10U, 0xbf121d0fU, 0x00000000U, 0x03eeff20U, 0xe12ce210U, 0x33beed20U, 0x00000000U,
+  0xfe110020U, 0x1f140fdfU, 0x110e00feU, 0x00000000U, 0x10021f0fU, 0x102dfd00U, 0x10d41c01U, 0x00000000U,
+  0xc0111ed2U, 0x04de1edeU, 0xa1231c0dU, 0x00000000U, 0x22fdf01fU, 0xd23d1421U, 0x13ccf110U, 0x00000000U,
+  0x01e00f31U, 0xff000efeU, 0x020e0f1dU, 0x00000000U, 0x20f30f00U, 0x200fdd00U, 0x10e1fc01U, 0x00000000U,
+  0xf1231ff0U, 0xf3cd0eeeU, 0xc1220dd0U, 0x00000000U, 0x110ef02eU, 0x02203022U, 0x10ee102fU, 0x00000000U,
+  0xf0c00f20U, 0xbcff001eU, 0x0f0e0f2fU, 0x00000000U, 0x00f21001U, 0x401e0f01U, 0xf0f3ff02U, 0x00000000U,
+  0x01202f01U, 0xe1d0d0f0U, 0xa224dd00U, 0x00000000U, 0x100bf13eU, 0x10521d30U, 0x1f1cfe21U, 0x00000000U,
+  0xff0e01f2U, 0xee120e0eU, 0xee1e0003U, 0x00000000U, 0xf0010e01U, 0xf05cfe0fU, 0x10d0390fU, 0x00000000U,
+  0xc0011fd1U, 0x031fefefU, 0xc012f1efU, 0x00000000U, 0x12dffe3fU, 0x222eff1eU, 0x51a1ee6fU, 0x00000000U,
+  0x0f0e0122U, 0x1d040d0dU, 0xffde0200U, 0x00000000U, 0x00e10f01U, 0x004e0e00U, 0x10c0190fU, 0x00000000U,
+  0xb20111e3U, 0x44eff0f0U, 0xb244ffe0U, 0x00000000U, 0x13dfff3eU, 0x023b001dU, 0x12cce050U, 0x00000000U,
+  0x000f0121U, 0x0ce30fffU, 0xfe0f000dU, 0x00000000U, 0x20f01f0fU, 0x001fed03U, 0x40ef1b0fU, 0x00000000U,
+  0xe1111002U, 0x13de0fdfU, 0xf3041e01U, 0x00000000U, 0x11fff11eU, 0xe3fe2f1fU, 0x000010ffU, 0x00000000U,
+  0x000e0121U, 0xeffd000fU, 0xb12b0f3fU, 0x00000000U, 0x10f12e0eU, 0x200fdd02U, 0x40e0fe0dU, 0x00000000U,
+  0xe1112011U, 0xe0c0cd11U, 0x0ef1f021U, 0x00000000U, 0x1ffee11eU, 0x10e02d22U, 0x00041011U, 0x00000000U,
+  0xfed10f21U, 0xcdff033eU, 0xc00d0e43U, 0x00000000U, 0xf001300fU, 0xf01e1c03U, 0x30022002U, 0x00000000U,
+  0x01203f12U, 0xffd0eee1U, 0xd112d151U, 0x00000000U, 0x0d1de22dU, 0x1e530c11U, 0x1f0e0120U, 0x00000000U,
+  0xeffd0101U, 0xeb050f1dU, 0xc13f0523U, 0x00000000U, 0x00000d00U, 0xf0601f00U, 0x10ee390fU, 0x00000000U,
+  0xb001e1dfU, 0x12e0ffedU, 0xef04e1f0U, 0x00000000U, 0x23cfee1fU, 0x204c0f20U, 0x6fa41f22U, 0x00000000U,
+  0x100e0111U, 0xfa050e0eU, 0xf20b0302U, 0x00000000U, 0x00ffff00U, 0xe04d3f01U, 0x301f1a0bU, 0x00000000U,
+  0xd111f0f0U, 0x42c1fdedU, 0xf015e0f1U, 0x00000000U, 0x12dfee2fU, 0xe44c2d1dU, 0x3ca11ff0U, 0x00000000U,
+  0x20ff0113U, 0xddf20ff4U, 0xf32d0211U, 0x00000000U, 0x001f1e0eU, 0xf00e2f03U, 0x4031220cU, 0x00000000U,
+  0xd1010f10U, 0x00e1dbefU, 0x1e21f200U, 0x00000000U, 0x10effffdU, 0xd3011c01U, 0xf0e521d1U, 0x00000000U,
+  0x2f0d0122U, 0x0ddc0112U, 0x101f0222U, 0x00000000U, 0x0010100dU, 0x00000d00U, 0x3012120fU, 0x00000000U,
+  0xdf111f01U, 0xf0f0ee2fU, 0x111fef00U, 0x00000000U, 0x0ee0e0ffU, 0xf203fdf3U, 0x0ff52101U, 0x00000000U,
+  0x1fd10010U, 0xfec00410U, 0xeee100f5U, 0x00000000U, 0x1000200dU, 0x000c4d01U, 0x20224f03U, 0x00000000U,
+  0x0e320f21U, 0x1ef10020U, 0x1302e010U, 0x00000000U, 0xfd2fe02fU, 0x1e73def1U, 0x2dd02f10U, 0x00000000U,
+  0xf22e0120U, 0x093300feU, 0xd57d012fU, 0x00000000U, 0xf01f1f00U, 0xf0001f03U, 0x00ef3c00U, 0x00000000U,
+  0xdf02e10fU, 0xf2e000feU, 0x0f131f0eU, 0x00000000U, 0x23b0f000U, 0x216f001fU, 0x31f45f14U, 0x00000000U,
+  0x010c0000U, 0xcb22013fU, 0xd44d02ffU, 0x00000000U, 0x10000e0fU, 0xe0f04004U, 0x20121000U, 0x00000000U,
+  0xcf14f0feU, 0xc2d0f0feU, 0x1c231e0fU, 0x00000000U, 0x21c1fdf0U, 0x145f0d1fU, 0x0dc26f01U, 0x00000000U,
+  0x21fe01d1U, 0xef3f0021U, 0xe41104feU, 0x00000000U, 0x10f00e0dU, 0x20f22001U, 0x2002f202U, 0x00000000U,
+  0xfe14ef0eU, 0xd2f0e13fU, 0x3f40100fU, 0x00000000U, 0x20cfeef0U, 0x0112dd11U, 0x0c12400eU, 0x00000000U,
+  0x20fe02efU, 0x210d0021U, 0xf10201d1U, 0x00000000U, 0x10100e0aU, 0x3031100dU, 0x30d2ff02U, 0x00000000U,
+  0x0d330010U, 0x1e1ff44fU, 0x150e20edU, 0x00000000U, 0x10f0f0f1U, 0x10e4bedfU, 0x2d2f401fU, 0x00000000U,
+  0x21e100d0U, 0x1fd200f0U, 0x0f0101a3U, 0x00000000U, 0x002f0009U, 0x301f420eU, 0x10013101U, 0x00000000U,
+  0x4d220010U, 0x5df00121U, 0x040200efU, 0x00000000U, 0x1e110000U, 0x2e73d00fU, 0x2c0f2f1fU, 0x00000000U,
+  0x0f0f01feU, 0x111f0002U, 0x00000000U, 0xfff000ffU, 0x10ddfe00U, 0x00f00202U, 0x00000000U, 0x00ee0f0fU,
+  0x00e0e1e0U, 0x001f21f0U, 0x00000000U, 0x00f0f000U, 0x30f3ef00U, 0x001f1011U, 0x00000000U, 0x000000f0U,
+  0x0e02012eU, 0x010e0022U, 0x00000000U, 0x0ff000ffU, 0x10eeef0fU, 0x10f0f001U, 0x00000000U, 0x00e1fe0fU,
+  0x0fe001e0U, 0xf31f0010U, 0x00000000U, 0x0ff00ff0U, 0x4ff4eff1U, 0x10001010U, 0x00000000U, 0x01f00100U,
+  0xef01013fU, 0x010e0011U, 0x00000000U, 0xf0e0000fU, 0x000eff01U, 0x00e0f000U, 0x00000000U, 0x00f1ef00U,
+  0x00f0e011U, 0xe20f0100U, 0x00000000U, 0x10101000U, 0x2f12f0e0U, 0x1010f010U, 0x00000000U, 0x11eef100U,
+  0x0f10001fU, 0x10100000U, 0x00000000U, 0x11ef0010U, 0xf01f0f00U, 0xf0e1f000U, 0x00000000U, 0x1000f001U,
+  0x12eff022U, 0xe2f00021U, 0x00000000U, 0x10101000U, 0x0122f1e0U, 0xf010e021U, 0x00000000U, 0x00ff0100U,
+  0x00100f00U, 0x1f1100f0U, 0x00000000U, 0x11ef0000U, 0x00ff1f02U, 0x00f0000fU, 0x00000000U, 0x00f10001U,
+  0x11ffef01U, 0x00ff0011U, 0x00000000U, 0x00101110U, 0x0f1fe1f0U, 0xff20f21fU, 0x00000000U, 0x1fff0000U,
+  0xdf0f01efU, 0x210f0000U, 0x00000000U, 0xff0100f0U, 0x10fc0d00U, 0x001ef002U, 0x00000000U, 0xf00f0f0fU,
+  0x0fe0e2e0U, 0x121f00f1U, 0x00000000U, 0x1ff0fff0U, 0x2004ff01U, 0xff000ef0U, 0x00000000U, 0xf00f0f00U,
+  0xce10000fU, 0x11000000U, 0x00000000U, 0xf000000fU, 0x00feff0fU, 0x100ff200U, 0x00000000U, 0x00f00f0eU,
+  0x1f0ff1e0U, 0x0210f2f1U, 0x00000000U, 0x1ff10ff0U, 0x3c120100U, 0x0f000c01U, 0x00000000U, 0x01ff0100U,
+  0xdf010020U, 0x12fe0e22U, 0x00000000U, 0x01ff011fU, 0xf0ff0e02U, 0x0011020fU, 0x00000000U, 0x0001fe00U,
+  0xe0fef110U, 0xe212f122U, 0x00000000U, 0x201110f0U, 0x0e100000U, 0x0f0ffe12U, 0x00000000U, 0x010f0100U,
+  0xef010000U, 0x21f00011U, 0x00000000U, 0x31ef0011U, 0xf00e1f03U, 0x00f0110fU, 0x00000000U, 0x0000ff00U,
+  0xe2edf011U, 0xc0000124U, 0x00000000U, 0x0001110fU, 0x0f312f1fU, 0x0f1edf31U, 0x00000000U, 0x00ff100fU,
+  0x0e0e0000U, 0x1fe00ff1U, 0x00000000U, 0x12ff0001U, 0x00f01002U, 0x00f0000fU, 0x00000000U, 0x001f0000U,
+  0x02fd0000U, 0xd10e1f22U, 0x00000000U, 0x001010f0U, 0x0e3ef00fU, 0x002dd131U, 0x00000000U, 0x1ffe2f10U,
+  0xa0200ffeU, 0x010e000fU, 0x00000000U, 0xff000f11U, 0xf00d1b01U, 0xf0eef001U, 0x00000000U, 0x000f0e0fU,
+  0xf1f0d1dfU, 0xe11fe1f2U, 0x00000000U, 0x2ff000f0U, 0x21011e11U, 0x0001fff1U, 0x00000000U, 0xf0ff1ff0U,
+  0xc0100effU, 0x120d0000U, 0x00000000U, 0x000f0001U, 0xf02f0c00U, 0x00f00101U, 0x00000000U, 0xf0ff0e0fU,
+  0xff00ffe0U, 0x0210e0f2U, 0x00000000U, 0x1ff100e0U, 0x1d001d2fU, 0x0ff0ee0fU, 0x00000000U, 0x010f1fe0U,
+  0xe0000f00U, 0x01ef0f0fU, 0x00000000U, 0x010f0000U, 0x001f0d01U, 0x001f0300U, 0x00000000U, 0xe0000d0fU,
+  0xf00f0e0fU, 0xf221d013U, 0x00000000U, 0x0ff001e0U, 0x0e001f2fU, 0x2dfffe00U, 0x00000000U, 0x010f0fffU,
+  0xfef0001fU, 0x0ef00f1eU, 0x00000000U, 0x22e10ff0U, 0x100f0e01U, 0xe0201100U, 0x00000000U, 0x00f0ef0fU,
+  0xf10fee00U, 0xe100ff33U, 0x00000000U, 0x2f0f02dfU, 0xff2f3e0eU, 0x2c1eef3fU, 0x00000000U, 0x1000000fU,
+  0xed000f2fU, 0x1ed1000fU, 0x00000000U, 0x24e100dfU, 0x10000002U, 0xd00e2000U, 0x00000000U, 0x100ff10dU,
+  0x110d310fU, 0xf0ef1f02U, 0x00000000U, 0x2f1e00efU, 0xfe4100fdU, 0x2f3de20eU, 0x00000000U, 0x0fff2fffU,
+  0xcf300f1fU, 0x020f000dU, 0x00000000U, 0x10e00022U, 0x002e1b00U, 0xf01d010fU, 0x00000000U, 0x1000ff0fU,
+  0xf0f1efefU, 0xe10fef11U, 0x00000000U, 0x40010110U, 0x10003e10U, 0xfde0f0e1U, 0x00000000U, 0xf0f020ffU,
+  0xcf3f0fffU, 0x041e0200U, 0x00000000U, 0x2ff00f02U, 0xe01e0d01U, 0xf000f20fU, 0x00000000U, 0xf0100e00U,
+  0xf101eddeU, 0xd20fe002U, 0x00000000U, 0x1ef2000fU, 0x0f002c00U, 0x1ddf00f2U, 0x00000000U, 0xf10f20efU,
+  0xdff00ee0U, 0x02ef000fU, 0x00000000U, 0x0f210ff1U, 0x002e0d02U, 0xe0302201U, 0x00000000U, 0xf0101e01U,
+  0xe010ee10U, 0xd2001e14U, 0x00000000U, 0x0de1f01fU, 0xf1f11d1eU, 0x2dddf402U, 0x00000000U, 0xf1001fe0U,
+  0x0ede0f00U, 0x11d10e0eU, 0x00000000U, 0xe1200f01U, 0x201e0f01U, 0xe0501200U, 0x00000000U, 0xf00f000fU,
+  0xff0eff40U, 0xf3f0fd01U, 0x00000000U, 0xffff00ffU, 0xf1f1fe0eU, 0x2e1de131U, 0x00000000U, 0x02ff0ff0U,
+  0x0ee2011eU, 0x0dd20f0fU, 0x00000000U, 0x030f0f1fU, 0x301f2000U, 0xd0202f01U, 0x00000000U, 0x00fed10fU,
+  0x2f0f2330U, 0x1fd01f12U, 0x00000000U, 0xf00d11efU, 0xfd44e0feU, 0x1f6d0021U, 0x00000000U, 0x02c0f0ffU,
+  0xc02100f1U, 0x0ef20deeU, 0x00000000U, 0x32f20122U, 0x001f1901U, 0x000f010dU, 0x00000000U, 0x10020f0fU,
+  0x0fe1f1efU, 0x00dd0d12U, 0x00000000U, 0x4f002200U, 0x21121f20U, 0xfc1cf3f0U, 0x00000000U, 0xf0f12200U,
+  0xa12e0010U, 0x2ec40e10U, 0x00000000U, 0x40f20033U, 0x201f1b01U, 0xe040050eU, 0x00000000U, 0x1011200dU,
+  0xefe0f20fU, 0x01d0fc24U, 0x00000000U, 0x4e0f1221U, 0x10102effU, 0x0b2ae300U, 0x00000000U, 0xf010000fU,
+  0xb300001fU, 0x0eb30f0eU, 0x00000000U, 0x3df10e13U, 0x303f2e0eU, 0xd05f230eU, 0x00000000U, 0x101f400dU,
+  0xe000e13fU, 0x13d2fc03U, 0x00000000U, 0x3b000250U, 0x0002fef1U, 0x2c5ab31dU, 0x00000000U, 0xf220e0e0U,
+  0x011e002eU, 0xdcd1000dU, 0x00000000U, 0xed010d21U, 0x3040310dU, 0x903f410eU, 0x00000000U, 0x200e4000U,
+  0x0f10f16fU, 0xf2130c11U, 0x00000000U, 0x2df0034fU, 0xfe03dfeeU, 0x304bd13fU, 0x00000000U, 0xf222d0edU,
+  0x0102000fU, 0xfcc20f1fU, 0x00000000U, 0xad010030U, 0x3032330dU, 0xd03d400eU, 0x00000000U, 0x20fe2f01U,
+  0x2e111131U, 0x1f330f12U, 0x00000000U, 0x0ee01170U, 0x0d45f10fU, 0x1e5bf02fU, 0x00000000U, 0xf230d1ecU,
+  0x101f00fdU, 0x3031001fU, 0x01f0000eU, 0x1fef00e0U, 0x00c1f203U, 0x00410400U, 0x002bf402U, 0x00e1ef00U,
+  0x0f0de1f3U, 0x00110104U, 0x000f0f00U, 0x10fe21bfU, 0x5033cff0U, 0x3f42f001U, 0xf110f1d0U, 0xfffef1f0U,
+  0x0f01003eU, 0x31220130U, 0x00f00e2eU, 0xfffd0f10U, 0x30dff300U, 0x101f350eU, 0x003b0203U, 0x0003de00U,
+  0x44dc0231U, 0x20100232U, 0x12effd12U, 0xf0f131ffU, 0x5e54c1d1U, 0x3025dde1U, 0xf05df3d0U, 0xf1fee200U,
+  0x0e20001fU, 0x51410031U, 0x00f10e2eU, 0xf1cd0f3fU, 0x00eb230eU, 0x00006401U, 0xf03f2300U, 0x0011ff03U,
+  0x34bb0151U, 0x214ff003U, 0x52d00ef3U, 0xee02101dU, 0x1b62efdfU, 0x2f04eee0U, 0x0d50020eU, 0x02fbdfffU,
+  0x0e2f00f2U, 0x305e010fU, 0xf003003eU, 0xe1ce0f4eU, 0x20fb220fU, 0x10c13100U, 0xf030110fU, 0x20f20005U,
+  0x23cc0e32U, 0x005cf0e1U, 0x71ef1e20U, 0xdf011e2eU, 0x0a51beddU, 0x2f03a10eU, 0xfc4ed010U, 0x010cedffU,
+  0x0cf200d0U, 0x5f2e00dfU, 0x1e05001fU, 0xd0c00f1eU, 0x20fd200fU, 0xf0cf100eU, 0x001e3001U, 0xf0101003U,
+  0x41dfdf21U, 0xfe4ed0f0U, 0x41e030f0U, 0xe2d21000U, 0xfc61effeU, 0xff01b1ffU, 0x0c52d000U, 0x000d00eeU,
+  0xf0fe0edcU, 0x10210010U, 0x1f010fffU, 0x0ffe00f0U, 0x100ff002U, 0x002e0403U, 0x00fee000U, 0x0004cd00U,
+  0x10fdf401U, 0x11011212U, 0x2000f011U, 0x0ffd33d0U, 0x5021e0f0U, 0x0e1300f2U, 0xef1003efU, 0x20fee0ffU,
+  0xf1f20fffU, 0x40210f3eU, 0x0ff30d1fU, 0x01fd011fU, 0x200d0200U, 0xf00f3500U, 0xf0fcf200U, 0xd0f5ee0fU,
+  0x42eb0210U, 0x1f00f220U, 0x2fe1f311U, 0xfd03232fU, 0x4b1ffff0U, 0xed120004U, 0xe0e0030fU, 0x34dfb00fU,
+  0xe12100ffU, 0x4d300d2eU, 0x0fe20d0fU, 0x12dc002fU, 0x201d130fU, 0x10ef5501U, 0xe01e0101U, 0xe0020f0eU,
+  0xf2d9e041U, 0x110c1021U, 0x2df0f10fU, 0x2e22021eU, 0xed213ceeU, 0xfe00f0ffU, 0x0f01023fU, 0x330fdfeeU,
+  0xd011021dU, 0x0c6e011fU, 0x10010f2dU, 0x01de0e2dU, 0x001d3100U, 0x00ef5302U, 0xd01f000fU, 0x001d1f02U,
+  0xd3ddce32U, 0xe22e0201U, 0x4dff020dU, 0x100f2100U, 0xfe5ffe0dU, 0x0e23bfefU, 0xf001d20fU, 0x0f1001ddU,
+  0x0d1000ffU, 0x0b7e020fU, 0x2ed70f20U, 0xded20d2eU, 0x00ff200fU, 0x00d22001U, 0xd01a100eU, 0x000cff04U,
+  0x02eedf1fU, 0xce2d1140U, 0x7d0e11efU, 0x11c30e03U, 0xfd410e0cU, 0xee14a2e0U, 0xfc23d2f1U, 0x1c2e1fdeU,
+  0xe12f0fecU, 0x2f000000U, 0xfef40e01U, 0xe12f01f1U, 0x00100d00U, 0x100e0203U, 0x10f1d000U, 0xe023ee0fU,
+  0x00fd01f1U, 0xe21fe2f3U, 0x50ef311fU, 0x0e0041fdU, 0x10110ef2U, 0xed121fd2U, 0xef0e02f0U, 0x2ffee011U,
+  0xe11f0eeeU, 0x2e2000f0U, 0xfef10f02U, 0xf13f000fU, 0x20200f02U, 0xf01f1300U, 0xf0f0e000U, 0xf0230f0eU,
+  0x12fc0012U, 0xd001e412U, 0x20e11101U, 0x2c13020bU, 0xfe1f0efeU, 0xece0ffe0U, 0xe1001100U, 0x30e1ed21U,
+  0x00ed00fcU, 0x3d1e0fffU, 0x0f020f00U, 0x130f010eU, 0x300e0300U, 0x000e140dU, 0xe00ff000U, 0x102e000eU,
+  0x130bde42U, 0xe10fe211U, 0x40e2100fU, 0x6e10c33fU, 0xcf1e3dffU, 0xebe2e0f1U, 0x1e2f1200U, 0x2e1100f0U,
+  0xff2e010fU, 0xec4d0330U, 0x32020e00U, 0xd1ff01ffU, 0x200d3301U, 0x00d13101U, 0xe00f0f0eU, 0x100f0f01U,
+  0xe1ffae11U, 0xc1f00432U, 0x4ded221eU, 0x4000de11U, 0xf03f1bfcU, 0xfb32e3c1U, 0x0fff03f2U, 0x1f322103U,
+  0xbf5f03ffU, 0xac7d0221U, 0x40d600efU, 0xbc130eefU, 0x10002002U, 0x10c31004U, 0xe00e010bU, 0x00100003U,
+  0xe0e00f00U, 0xfefe6530U, 0x5bfde1efU, 0x01169cf2U, 0xff420efdU, 0xdd44d2c1U, 0xedf2e3f2U, 0x2e1e4e25U,
+  0xe3100feeU, 0x4ff0000fU, 0x0cd10214U, 0xd0e004e1U, 0xf0100d00U, 0x00f0e500U, 0x20e4ed0fU, 0x00f5ff0fU,
+  0x000e0110U, 0x001e0113U, 0x51f0220fU, 0x101f32eeU, 0xfff101f1U, 0xcbe1f1c0U, 0xf301f11eU, 0xff4fc021U,
+  0xf10e0defU, 0x2dfc01d0U, 0xeee20003U, 0xc1210200U, 0x10020f02U, 0xf0dff401U, 0x1002ee00U, 0xe0f30000U,
+  0x111c0100U, 0xd00fe212U, 0x10f1120fU, 0x0f2104aeU, 0xdff030ffU, 0xdad2f1e2U, 0x130d101fU, 0x0f51ff62U,
+  0x1fdd010dU, 0x001c03f1U, 0xfff40ff1U, 0xc1320110U, 0x20f00002U, 0x00c1f000U, 0xe020fd0fU, 0x00f2de01U,
+  0x2e2de053U, 0xef0e1212U, 0x1fe00feeU, 0x120dffddU, 0xde101f0dU, 0xfa02e200U, 0x20ff0010U, 0x01300e40U,
+  0xeffd032fU, 0xe00d0322U, 0x11f20eeeU, 0xc1230fefU, 0x40ef2100U, 0x20c4f000U, 0xe010ef0dU, 0x00b2ed03U,
+  0xfffeff52U, 0xe00f3360U, 0x3fce11ffU, 0xe3fe0dd1U, 0x0e32fffeU, 0x0a1012d1U, 0xf00f11f1U, 0x223e2034U,
+  0xb010011eU, 0xc1400132U, 0x12000edfU, 0xc0120eb0U, 0x20223004U, 0x20e6f206U, 0xf0e0df0bU, 0x20130e03U,
+  0x0f0f3f20U, 0xee0e7340U, 0x2cfe02b0U, 0xe514becfU, 0x1d5210ffU, 0x0b3003ceU, 0xe2f010f1U, 0x321c5043U,
+  0xe4000ff0U, 0x2ed00fe0U, 0x30e00323U, 0xfe1f05d0U, 0xf0f0fd0fU, 0x10f4f30eU, 0x0004ff00U, 0x00f4ff02U,
+  0xfe0d0001U, 0xff0f2124U, 0x21211300U, 0x022cf2efU, 0xeffff000U, 0xeddff3f0U, 0x1102013fU, 0xff41de30U,
+  0xc30e00f1U, 0x20e000e2U, 0x2fd00214U, 0xd00004e1U, 0xf022f001U, 0x20e4e30cU, 0x10011b0fU, 0xe0f1de06U,
+  0xf03fe113U, 0x103f0326U, 0x3f112310U, 0xd41f03ceU, 0xddff0111U, 0xfed3f501U, 0x12fff13fU, 0x2e71ce60U,
+  0xd41e010eU, 0x131f00f4U, 0x0ee20121U, 0xce2f0203U, 0x3012f000U, 0x3004c20cU, 0xf00f2d0dU, 0xf0f0dc05U,
+  0x1f5ed142U, 0x204e0203U, 0x3dfe00feU, 0xb51001cdU, 0xfcf31011U, 0x2b022212U, 0x141ef011U, 0x3130fd42U,
+  0xe31e014dU, 0x15200002U, 0x00010effU, 0xf0000e10U, 0x3011ef00U, 0x30c6bf0fU, 0xf00f0f0fU, 0x10e3dc06U,
+  0x1f3ffe51U, 0x2e3e2002U, 0x3d0f12dfU, 0xb5e200dfU, 0x2a230000U, 0x39112210U, 0x040f0f00U, 0x211e2042U,
+  0xe1210f2eU, 0xd4420121U, 0xf1000f1fU, 0x031f0f00U, 0x1023f200U, 0x10e7b105U, 0xf0eff00eU, 0x1001fe03U,
+  0x0f411f31U, 0x3d3e3112U, 0x2e1f0fd0U, 0xd6d0efceU, 0x2a412110U, 0x2a54212fU, 0xf2002000U, 0x43ce3f31U,
+  0x1f0f0002U, 0xeffe00f0U, 0xde11002eU, 0x00000000U, 0x00ef0d0fU, 0x00d10e0fU, 0x00fa3d0eU, 0x00000000U,
+  0xf0f102d0U, 0x00ffd1efU, 0x10c4db6fU, 0x00000000U, 0x2100f110U, 0x10e1ed10U, 0xdfe000efU, 0x00000000U,
+  0xffef0012U, 0xeef001deU, 0xfe240ff2U, 0x00000000U, 0x10e0de02U, 0x10a31e00U, 0xf01d4e09U, 0x00000000U,
+  0xe0f011cfU, 0xef0002c0U, 0x1cd60b5fU, 0x00000000U, 0x12f0f100U, 0x20d0dd10U, 0xdeee12dfU, 0x00000000U,
+  0xc0ef0031U, 0xeef401eeU, 0xfe450f42U, 0x00000000U, 0x00d1bd03U, 0x00a01e01U, 0xf0413f09U, 0x00000000U,
+  0xd2f022f0U, 0xbef022f0U, 0x3bd5fd2fU, 0x00000000U, 0x110ef01fU, 0x12d2cf0fU, 0x0dcb10ffU, 0x00000000U,
+  0xdeee0020U, 0xfde10f1eU, 0xef030031U, 0x00000000U, 0x00e1ee03U, 0x00921d01U, 0x005f100dU, 0x00000000U,
+  0xe2f22112U, 0xd0d0111fU, 0x1be4ef0fU, 0x00000000U, 0xf12fe00dU, 0xf1f1ee0fU, 0x30cd2000U, 0x00000000U,
+  0xdfe10130U, 0x1de00f20U, 0xee0f0041U, 0x00000000U, 0xf01f0103U, 0x10011002U, 0x100f200fU, 0x00000000U,
+  0x11e11010U, 0xf0df0110U, 0xfff4df20U, 0x00000000U, 0x003de20dU, 0x11e0e20eU, 0x4eee1e00U, 0x00000000U,
+  0x0ffe00e2U, 0xee2c02ffU, 0xd0310f5dU, 0x00000000U, 0x00fefc0fU, 0x00e10c00U, 0xf01b5c0eU, 0x00000000U,
+  0xd0e202c0U, 0xeff0e3afU, 0xf0d6c93fU, 0x00000000U, 0x21d1ff1fU, 0x40e3ed40U, 0xefef00f1U, 0x00000000U,
+  0x00fd0011U, 0xdf2004efU, 0xee030f02U, 0x00000000U, 0x10f0fd00U, 0x00e21a0fU, 0x10002f0dU, 0x00000000U,
+  0xd00111e1U, 0xe011e1cfU, 0xfee6e93fU, 0x00000000U, 0x01e1ff10U, 0x41f3fc30U, 0xdfcd1f10U, 0x00000000U,
+  0xdfde0f11U, 0xd0f103e1U, 0x0ff30042U, 0x00000000U, 0xf0f00d0fU, 0x00c22b0eU, 0x20001e00U, 0x00000000U,
+  0xdf130103U, 0x0030e00fU, 0x0ff3eb2dU, 0x00000000U, 0x10f0ef1fU, 0x12e3ff0eU, 0x21ac0e1fU, 0x00000000U,
+  0xd1d00f22U, 0xf1e001ffU, 0x0ff00050U, 0x00000000U, 0xf0de2f00U, 0x00b00b0dU, 0x400eed01U, 0x00000000U,
+  0xd0122102U, 0x0ffff021U, 0x4cf21f3eU, 0x00000000U, 0xf1fff01dU, 0xf3e2df0eU, 0x21cd0001U, 0x00000000U,
+  0xeeb10e21U, 0x1ee00f10U, 0xfee00051U, 0x00000000U, 0xf0ee1f01U, 0x10c10e00U, 0x300d1f03U, 0x00000000U,
+  0x0fff10f2U, 0xeff0e0f0U, 0x4ff4f04fU, 0x00000000U, 0xf11be20dU, 0x00d1feffU, 0x3ef01f00U, 0x00000000U,
+  0xdf2f01d2U, 0xb04e00e1U, 0xdf0f0f30U, 0x00000000U, 0x0010fc00U, 0x00110c00U, 0xf0e13f00U, 0x00000000U,
+  0xc0f0f1d0U, 0x2000e2aeU, 0xe0e6fd10U, 0x00000000U, 0x12e3f010U, 0x5f23ec50U, 0x0fce2010U, 0x00000000U,
+  0xe1f00010U, 0xc1300300U, 0xef000113U, 0x00000000U, 0x00301c0dU, 0xf010fc0fU, 0xe0c11100U, 0x00000000U,
+  0xf110f0f3U, 0x110ff1bcU, 0xb004db1fU, 0x00000000U, 0x0ff0004fU, 0x6e430b70U, 0x2dbd1e21U, 0x00000000U,
+  0xe2ef0011U, 0xc20003e3U, 0xdf320223U, 0x00000000U, 0x102e2f0eU, 0x00000c0dU, 0xf0e00c00U, 0x00000000U,
+  0xd220ef21U, 0x110e01edU, 0x1002df0cU, 0x00000000U, 0x100fe02fU, 0x01f2fb5fU, 0x2eb00e02U, 0x00000000U,
+  0x00e00f22U, 0xf0f101d3U, 0xef010033U, 0x00000000U, 0x101f2f00U, 0x00f0fe0eU, 0x102ffd00U, 0x00000000U,
+  0xe2210d11U, 0x11fef10fU, 0x5ee2f23eU, 0x00000000U, 0x10fce23fU, 0xe0f20f20U, 0x20e2dde2U, 0x00000000U,
+  0x2eb10d11U, 0x1cf201b2U, 0xcc010013U, 0x00000000U, 0xf00e100eU, 0x10ef100eU, 0x202e2f03U, 0x00000000U,
+  0x10300e01U, 0x400fc1efU, 0x52c1d120U, 0x00000000U, 0x1e09032dU, 0xfff22120U, 0x1e041ef1U, 0x00000000U,
+  0xc21f0fefU, 0xcd1e03f0U, 0xe02f0002U, 0x00000000U, 0x00001e0fU, 0x00e00c00U, 0x002e2400U, 0x00000000U,
+  0xcf22fff1U, 0x0f20d2ceU, 0xe0f5def0U, 0x00000000U, 0x10df0022U, 0x11100d40U, 0x3fde0f20U, 0x00000000U,
+  0xc22f0f1fU, 0xc23f0100U, 0xc0200113U, 0x00000000U, 0x002f200fU, 0x1010fd01U, 0xe00e2400U, 0x00000000U,
+  0xe231fc02U, 0x1120f0ddU, 0xc103cce0U, 0x00000000U, 0x2deff14fU, 0x3f301d5fU, 0x2fb3fe13U, 0x00000000U,
+  0x02000f20U, 0xd2200103U, 0xc00000e2U, 0x00000000U, 0xf020300fU, 0x2010fe01U, 0x001d1d00U, 0x00000000U,
+  0xd4110c01U, 0x021000ecU, 0x0113d1feU, 0x00000000U, 0x2dddef1fU, 0x012f2f6fU, 0x11efdfe4U, 0x00000000U,
+  0x03ef0d10U, 0x01f002d0U, 0xff1e0ef0U, 0x00000000U, 0x003f1f0eU, 0x201fef0fU, 0xf02e0e00U, 0x00000000U,
+  0xd221faf3U, 0x220f01ffU, 0x22e1d0fcU, 0x00000000U, 0x1dd9ff4fU, 0x10f02e30U, 0x1f12ffd1U, 0x00000000U,
+  0x12ef0e0fU, 0x3ef000dfU, 0xfce200c1U, 0x00000000U, 0xf03f1f0fU, 0x10ef100dU, 0xe05f2103U, 0x00000000U,
+  0xf0220d02U, 0x122fe0ffU, 0x13d0d0efU, 0x00000000U, 0xfffa002eU, 0x0fff1020U, 0x0eff1e13U, 0x00000000U,
+  0xd02d0effU, 0xef0e031fU, 0xe04000e1U, 0x00000000U, 0xf02f0f00U, 0xf00e0f01U, 0x000e2200U, 0x00000000U,
+  0xdf23e0f0U, 0xe02f00edU, 0xf1f4e0e1U, 0x00000000U, 0x20dff010U, 0x121dee10U, 0x3f040e01U, 0x00000000U,
+  0xf12e0fffU, 0xf2fd030fU, 0xc0400effU, 0x00000000U, 0xf01f0e0fU, 0x101fdf00U, 0x00fc3002U, 0x00000000U,
+  0xd123fee2U, 0xeff101ecU, 0xe5f4def0U, 0x00000000U, 0x2eee2ff0U, 0x1200ee2eU, 0x2f22fd02U, 0x00000000U,
+  0x20f001eeU, 0x122002efU, 0xdc2f0cdeU, 0x00000000U, 0xd01e1e0eU, 0x2000dd0fU, 0x003d3d02U, 0x00000000U,
+  0xd2240ce1U, 0x0ee401ecU, 0xd401e0eeU, 0x00000000U, 0x2eec1112U, 0x11100f31U, 0x102fddffU, 0x00000000U,
+  0x11df0ffeU, 0x112001d0U, 0x0b0f0ec1U, 0x00000000U, 0xd03d1f0eU, 0x20f0ee0fU, 0xf07f0200U, 0x00000000U,
+  0xf2320d01U, 0x1002f1feU, 0xe2e000eeU, 0x00000000U, 0x10db11f1U, 0x21111e01U, 0xff2eff00U, 0x00000000U,
+  0x12f00fefU, 0x1f200fdfU, 0x1e0001a0U, 0x00000000U, 0xf03d200dU, 0x20e01e0dU, 0xe040e30fU, 0x00000000U,
+  0x1012fff0U, 0x11f1f0ffU, 0xeff1f1e1U, 0x00000000U, 0x000c00f1U, 0x100010ffU, 0xee000011U, 0x00000000U,
+  0x0f1f010eU, 0xf0f20030U, 0x32000020U, 0x20010050U, 0x00d02d0eU, 0x0030120fU, 0x00010201U, 0xf01e3e0eU,
+  0x00ffd010U, 0x11022d3eU, 0x012f2011U, 0x1002de21U, 0xf0f00f00U, 0xf0ff12f0U, 0x002d0121U, 0xff0e1010U,
+  0xfd2001c0U, 0x024e0ffeU, 0x010e0f40U, 0x000f0f2fU, 0x00e41d0dU, 0xf040340eU, 0x00f11003U, 0xd00f4e0fU,
+  0xfeffed2fU, 0x0f130c30U, 0xf20f1120U, 0xf013fd1fU, 0x0eef0000U, 0xfefd1000U, 0x002c000fU, 0xffebff30U,
+  0x1e2201c0U, 0x344c0e0eU, 0xf01e0f2fU, 0x20000010U, 0x00012e0cU, 0x0060640fU, 0x00f12002U, 0xd0014d0fU,
+  0x1e12ee4fU, 0xde14dc11U, 0xe3ff1f20U, 0xd0f10f2eU, 0xfdc001c0U, 0x0eeb4f02U, 0xff2c001fU, 0x0ddb1120U,
+  0x0f1300d2U, 0x253f0f0fU, 0xf02e0f11U, 0x1ffe0001U, 0xf01f1e0bU, 0xe0625200U, 0xf0f02102U, 0x00f33f0eU,
+  0x2f02fe0fU, 0xd022cbefU, 0xd3ff1f10U, 0xc0efe03fU, 0x10c04ef1U, 0x0ddd3e33U, 0x0e2e001fU, 0x0ecd111fU,
+  0x0f0f01b1U, 0x212e0f10U, 0xfe110f01U, 0xefef00f0U, 0x10f00f0dU, 0xd022200fU, 0xf0111002U, 0x00d2100eU,
+  0x0011e110U, 0xc114de0fU, 0x02ef1f11U, 0xe0ffe020U, 0x41c03d21U, 0x1eee4d41U, 0xff30000eU, 0x0fce010fU,
+  0xfd2e020fU, 0x1202004fU, 0x21f00021U, 0x0f0e0170U, 0x10102e0dU, 0x00f22700U, 0xf0f11002U, 0xf03d4f0fU,
+  0xe0d0df00U, 0x00004b20U, 0xf21f3d11U, 0x0f040e2fU, 0x2fe2fe20U, 0x0f0d13f0U, 0x102b011fU, 0x21ee000fU,
+  0xee0205e2U, 0x4140012eU, 0x21f0003fU, 0xf11d014fU, 0x00311f0dU, 0x10011600U, 0x00f12101U, 0xd0205f00U,
+  0xef0fdf0fU, 0x1c1f2911U, 0xf2ff1f00U, 0xcf1500efU, 0x2ed0fe00U, 0x1f1f21f1U, 0x112c0e10U, 0x13ea0d2eU,
+  0xff0106e2U, 0x203e0311U, 0x001f0f2fU, 0x022f0f3fU, 0x10e20c0cU, 0x20000302U, 0x00f12302U, 0xe0124f0fU,
+  0x0002fefdU, 0x2f0ffcf1U, 0xe1ff1ef1U, 0xc10320ffU, 0xe1e200f0U, 0x0d231112U, 0xfe1d0f20U, 0x201b2f1eU,
+  0x1efe02f1U, 0x0200030fU, 0x0f2f0f20U, 0x121e0d21U, 0x20e1eb0eU, 0xe031f302U, 0xd0e30202U, 0x10d62f00U,
+  0x11e2000dU, 0x3f20def0U, 0xd1001ef1U, 0xe201310fU, 0x02f11d10U, 0x0f1220f2U, 0x0d1f0e11U, 0x200c222eU,
+  0xedfe01ffU, 0x0121010fU, 0x0f200f10U, 0x00ff0f20U, 0x30e21e0fU, 0xd050000fU, 0xf013f002U, 0x20c61f00U,
+  0x12f101deU, 0x0234acefU, 0xe1f00e31U, 0xe0fd0040U, 0x40f22d2eU, 0x2f212b42U, 0xfd2fff12U, 0x0feef23eU,
+  0xd02e01f0U, 0x30000010U, 0x3fe00f10U, 0x0000004fU, 0x0023000eU, 0x00c02501U, 0x00c21002U, 0x00304102U,
+  0x10f0d0deU, 0x00010e10U, 0xe41e2f13U, 0xff043d00U, 0x3f000c20U, 0x003eff1eU, 0x002ac00eU, 0x1ffd0000U,
+  0xff2004e0U, 0x1e200002U, 0x10000020U, 0x00200f20U, 0x0023fc00U, 0x20c10301U, 0x10913200U, 0x00104000U,
+  0x0012d2cdU, 0x1f0d1f2fU, 0xe30e1f04U, 0xe0f2fdf1U, 0x11210b4fU, 0xff212f01U, 0x100ce11fU, 0x2ffd2f00U,
+  0x0f0f0302U, 0xd0200402U, 0x00000001U, 0x102f0f0fU, 0x20f1fa0fU, 0x00c2de04U, 0x00d21202U, 0x0013200eU,
+  0x311200ecU, 0x3fdc23eeU, 0xf21e10f1U, 0xc004fde1U, 0xe1e03d4fU, 0x034100f2U, 0x1f0ee12fU, 0x1d0e2d10U,
+  0x0e0e01f0U, 0xf01304cfU, 0xff10001fU, 0x10f00e10U, 0x40c0ec01U, 0xe0f1ee03U, 0xe0f2e202U, 0x2004200fU,
+  0x01d10fefU, 0x4fed23feU, 0xf22e1e31U, 0xe2131f21U, 0x02ff3a00U, 0x022431f2U, 0x0f2fd011U, 0x2efd1e2fU,
+  0xed0f010fU, 0x0f1104f0U, 0xff1100f1U, 0x2d1f0e10U, 0x20f01001U, 0xd03f0e01U, 0xf0120002U, 0x10e41f0dU,
+  0x10f131d1U, 0x1fe3c1fdU, 0xd100f031U, 0x012f2f1fU, 0x3e112e00U, 0x03024e23U, 0xf030e011U, 0x1cee3f4fU,
+  0xcf200200U, 0x3d0e00f1U, 0x3dd00001U, 0x2e020e10U, 0xf0120e01U, 0xf0e0f402U, 0x10b10100U, 0x20010201U,
+  0x1f01e2ddU, 0xe010dfefU, 0xf2101002U, 0x0f0e7fe2U, 0x22111e40U, 0x204fcd0eU, 0x02eec00eU, 0xff0c010fU,
+  0xd02103ffU, 0xdf0e00f3U, 0x1ed00f12U, 0x1d0f0e20U, 0xe000e903U, 0xf0e1ff03U, 0x10c0120fU, 0x00010201U,
+  0xf012d1bcU, 0xf11fe0ecU, 0xf2fe2113U, 0xf10f3d02U, 0x11112b30U, 0x3001fb22U, 0x11ddd3ffU, 0x0dfb4200U,
+  0xd0100ff1U, 0xd0f00301U, 0x0fe00021U, 0x1f1f0f02U, 0x001ff901U, 0xf0e0ed02U, 0x00f21300U, 0xf0f4f10eU,
+  0x2f02ffddU, 0xf1eef4ccU, 0x010e4012U, 0xe1221cf0U, 0x02113c1fU, 0x1322fe10U, 0x0f10e2efU, 0x1fdd2012U,
+  0x0e1e00f1U, 0x1e0003f0U, 0x0f0f0031U, 0x2e100012U, 0x10e10d0fU, 0xe0d1ff04U, 0x00030301U, 0x0011000eU,
+  0x1f0ff10fU, 0xe0dd12cdU, 0xf10e2021U, 0xf0243010U, 0x02221effU, 0xf4420f20U, 0xff10e10eU, 0x2dfd0222U,
+  0x1ef203ffU, 0x2dff04f1U, 0xf00f0f13U, 0x0e4f0002U, 0x20f0320fU, 0xf002e004U, 0x00f41100U, 0x0021e00bU,
+  0x4e201301U, 0xe2d0e2ceU, 0xe2002110U, 0x1f221f1eU, 0x1f54f000U, 0xf4feff32U, 0x0f0fe10fU, 0x0ecf3132U,
+  0xef210400U, 0x1cff0e1fU, 0x0d0e0112U, 0x0ef20112U, 0x00fd0d03U, 0x00e1f300U, 0x00d20000U, 0x20d0ff01U,
+  0x0010f3eeU, 0xf00fff0fU, 0x0f130310U, 0x10001400U, 0x13221f01U, 0x1f1efe10U, 0x12c0ff1fU, 0x1100001eU,
+  0xd03f03ffU, 0xee0d0edfU, 0x0eee0113U, 0x1cf00102U, 0x00fe1c03U, 0xf00ff103U, 0x20010f0fU, 0x20d1ef02U,
+  0xe0efe2edU, 0x9210e0ecU, 0xf0130212U, 0x02f02401U, 0x03210e00U, 0x210ecc00U, 0x01f0f01dU, 0x01ef2f1dU,
+  0x005e01f0U, 0xf1fe0feeU, 0x0fff0132U, 0x003f0213U, 0x30110001U, 0xf01ee103U, 0x10f1100fU, 0xe0c2ef00U,
+  0xff00020dU, 0x911102cdU, 0x00022221U, 0x02e00410U, 0xe222edfeU, 0x02e1eee1U, 0x1011010fU, 0x23ff1000U,
+  0x421f000fU, 0x12ee000fU, 0xf0f00031U, 0xf0510344U, 0x3011020dU, 0xf0ffff03U, 0x10011f0fU, 0x00e0e000U,
+  0x1e0e033fU, 0x90f111cfU, 0xff113121U, 0x00f2224fU, 0x103200eeU, 0x020e0012U, 0x1f1101ffU, 0x3102e123U,
+  0x21e200d1U, 0x5fee0110U, 0xf0f10011U, 0xe05f0222U, 0x30f0220dU, 0xf00ed103U, 0x00f1110fU, 0x0001be00U,
+  0x4c100330U, 0xb4ef11deU, 0x1111211fU, 0xee011010U, 0x1f440100U, 0x13bee000U, 0x1e10001eU, 0xf0c30103U,
+  0x00000000U, 0x01f00011U, 0x000000e1U, 0x00ef000fU, 0x00000000U, 0x00fff002U, 0x00d30101U, 0x00f0f100U,
+  0x00000000U, 0x00012ff0U, 0xf00e2fe0U, 0x000e0fe1U, 0x00000000U, 0x10100100U, 0xe01ee100U, 0x100eff10U,
+  0x00000000U, 0x02fe0f21U, 0xe2ee0f12U, 0x1ef0001dU, 0x00000000U, 0x00f01101U, 0x00f2f303U, 0x00e2f000U,
+  0x00000000U, 0x11110100U, 0xf1fe401fU, 0xf0fd22e0U, 0x00000000U, 0x1f300f20U, 0x0f1bd10fU, 0x20fed0feU,
+  0x00000000U, 0xf1df0f11U, 0xe2fe0e22U, 0x1d00013dU, 0x00000000U, 0x00112101U, 0x10000204U, 0x00e21e02U,
+  0x00000000U, 0x000f0121U, 0xf1cc4030U, 0xe001111eU, 0x00000000U, 0x0e3ee000U, 0x0e3cd1efU, 0x01fdcf0dU,
+  0x00000000U, 0x01e00fe0U, 0xb1ff0d30U, 0xfcef001eU, 0x00000000U, 0xf000100fU, 0x201ef103U, 0xf0f00003U,
+  0x00000000U, 0x201f1011U, 0xf3ed2e31U, 0xc1010020U, 0x00000000U, 0xff3fe000U, 0xfb6c0dffU, 0x0e0dffeeU,
+  0x00000000U, 0x11e200ffU, 0xbfe30f10U, 0xddf0001fU, 0x00000000U, 0xf0ef000eU, 0x103f1104U, 0x100f1203U,
+  0x00000000U, 0x1f0f1ff0U, 0x13d10f10U, 0x01020f20U, 0x00000000U, 0xef1fe000U, 0x0b7e1f0fU, 0x012feffeU,
+  0x00000000U, 0x21f10f11U, 0x10d000e2U, 0x0ff10f0eU, 0x00000000U, 0x1001f202U, 0xf0b5d202U, 0xf0e50f02U,
+  0x00000000U, 0x00113201U, 0xf21e3101U, 0xe1ff2df1U, 0x00000000U, 0x012fe2f0U, 0x001bd20eU, 0x10fcf11fU,
+  0x00000000U, 0x10000f20U, 0x01e00012U, 0x10e1001eU, 0x00000000U, 0xf0012402U, 0x10c3f202U, 0xf0e4100fU,
+  0x00000000U, 0x000f32f2U, 0x11fd5f21U, 0xe0f03dffU, 0x00000000U, 0x1f2ef11fU, 0x300cd11fU, 0x22fdd02eU,
+  0x00000000U, 0xf0f10d22U, 0xffff0e01U, 0x0ff0003dU, 0x00000000U, 0xf02f3401U, 0x2003f201U, 0xf0022000U,
+  0x00000000U, 0xf00f2f21U, 0x03ec4f30U, 0xe0012df1U, 0x00000000U, 0x0e2ee13fU, 0x0c5cf11fU, 0x1ffdbf0fU,
+  0x00000000U, 0x10f20f00U, 0xd0f10f1fU, 0xeff0010dU, 0x00000000U, 0xe03e120cU, 0x20110100U, 0xf0f31100U,
+  0x00000000U, 0x001f0e00U, 0x140e1d30U, 0xf1121ef0U, 0x00000000U, 0xfe2cf110U, 0xfa5c100fU, 0x0e0bdfefU,
+  0x00000000U, 0x20010f10U, 0xbdd40e12U, 0xfe1f0f0fU, 0x00000000U, 0xe0fef10bU, 0x002e0002U, 0xe0e53003U,
+  0x00000000U, 0xff0fef10U, 0x43c4fd22U, 0x0212ed10U, 0x00000000U, 0xe0fee102U, 0x095e2e00U, 0x0d2cd000U,
+  0x00000000U, 0x21e0000fU, 0x30d000e0U, 0x0ee10012U, 0x00000000U, 0x00e10200U, 0xf004d30fU, 0x00c21f01U,
+  0x00000000U, 0x000032f1U, 0xe20f2302U, 0xd1003101U, 0x00000000U, 0x111ef001U, 0x131cb20eU, 0x20cde12fU,
+  0x00000000U, 0x20ff0f21U, 0x2fff001fU, 0x0eff011fU, 0x00000000U, 0x10f22301U, 0xf0f4f102U, 0x00b32202U,
+  0x00000000U, 0x100f3121U, 0x03fc3002U, 0xb0203ef4U, 0x00000000U, 0x222def2eU, 0x131eb31fU, 0x23bcd300U,
+  0x00000000U, 0x00f20f43U, 0x1f0f0110U, 0x001e003eU, 0x00000000U, 0x00f12100U, 0x2002e202U, 0x10e2300fU,
+  0x00000000U, 0xf1113e30U, 0x331b3121U, 0xd0104d04U, 0x00000000U, 0x0f0cf23fU, 0x0021e2f0U, 0x12eeb1ffU,
+  0x00000000U, 0x00f20001U, 0x1e000001U, 0xd23f0d2eU, 0x00000000U, 0x00110f0dU, 0x302f0001U, 0x1002220eU,
+  0x00000000U, 0xf1110effU, 0x130c2d30U, 0xf2103e13U, 0x00000000U, 0x0fec2120U, 0xfc12f10eU, 0xfe0de200U,
+  0x00000000U, 0x221f0000U, 0xb9f30ed1U, 0x006e0c30U, 0x00000000U, 0x00ffe00cU, 0x002e1e04U, 0xf0f3010fU,
+  0x00000000U, 0x000eddffU, 0x52f4dc23U, 0xc4011e01U, 0x00000000U, 0x01ee2012U, 0x094f3e21U, 0x0c0df100U,
+  0x00000000U, 0x00f001ffU, 0x32f100eeU, 0x0e1f0315U, 0x00000000U, 0xf0f20000U, 0x0032d40cU, 0x20d31e00U,
+  0x00000000U, 0x010000f0U, 0x010ef110U, 0xfff1f202U, 0x00000000U, 0x010fef00U, 0x010fc110U, 0x22d2d00fU,
+  0x00000000U, 0x100f0211U, 0x14f10f0fU, 0x3cfe0333U, 0x00000000U, 0x00021001U, 0x00310401U, 0x20d1200eU,
+  0x00000000U, 0x0210f1ffU, 0x0000020eU, 0xf0f22444U, 0x00000000U, 0x2200dd1fU, 0x2201c220U, 0x00e1c2feU,
+  0x00000000U, 0xe0100233U, 0x210f0111U, 0x2b1d0342U, 0x00000000U, 0x000f1f01U, 0x001f0402U, 0x20d0200cU,
+  0x00000000U, 0xd3f20ef0U, 0x021d01ffU, 0xe0002631U, 0x00000000U, 0x10ffef10U, 0x2f32d13eU, 0x0f1402ffU,
+  0x00000000U, 0xe01f0f11U, 0x0ff102f1U, 0xfd000222U, 0x00000000U, 0x101eff00U, 0x1003f304U, 0x50f2000cU,
+  0x00000000U, 0xb201ffdfU, 0x23fcffd1U, 0x00f10430U, 0x00000000U, 0x1ede2f14U, 0xff21000fU, 0xedf533ffU,
+  0x00000000U, 0x120e000eU, 0xbbf100c1U, 0xde310024U, 0x00000000U, 0xf0ffef0dU, 0x10131f05U, 0x10020f0fU,
+  0x00000000U, 0xe00efff0U, 0x2313dfd1U, 0xf1e2e01fU, 0x00000000U, 0xf2ae0ff2U, 0x102f3031U, 0x1ff23010U,
+  0x00000000U, 0x2ee00100U, 0x0fff02f0U, 0xe23d0444U, 0x00000000U, 0xf002f10fU, 0xf0d2f300U, 0x00d21f00U,
+  0x00000000U, 0x1110ef01U, 0x0f1ce011U, 0x1e13141fU, 0x00000000U, 0x000ef010U, 0x0d11d110U, 0x31c53f21U,
+  0x00000000U, 0x001e0310U, 0xf10f0020U, 0xe42c0324U, 0x00000000U, 0xc0000003U, 0xf0eee303U, 0x30d00e01U,
+  0x00000000U, 0xb2f1e00fU, 0xe111e001U, 0x0d33031fU, 0x00000000U, 0x301fef01U, 0x0e60df52U, 0x2eb43f20U,
+  0x00000000U, 0xe11e0231U, 0xfeff0010U, 0x152b0332U, 0x00000000U, 0xc01e2003U, 0xe01fdf03U, 0x20120f01U,
+  0x00000000U, 0xa3d4f0eeU, 0xc20210efU, 0x3e21030eU, 0x00000000U, 0x31ffd0f3U, 0x1f5eff30U, 0x1da460e1U,
+  0x00000000U, 0xf01d002fU, 0xf0d20001U, 0xf1110312U, 0x00000000U, 0xe01e0000U, 0x0012c006U, 0x4005e003U,
+  0x00000000U, 0x91f00fc0U, 0xf5d220d0U, 0x300f220fU, 0x00000000U, 0x03c0fff3U, 0x102c2010U, 0x0be27100U,
+  0x00000000U, 0x211e0f1fU, 0x00010000U, 0xe22002f3U, 0x00000000U, 0xf00fef0eU, 0xe0302204U, 0x10e5ff05U,
+  0x00000000U, 0xbeef0fc0U, 0x160401dfU, 0x31f011feU, 0x00000000U, 0xf2befff2U, 0x251e201fU, 0x10115020U,
+  0x100e01f3U, 0x200f00f0U, 0xfff0000fU, 0xff000001U, 0x00f1ff01U, 0x00efff00U, 0x00ffff00U, 0x00f21000U,
+  0xf02104f0U, 0x00ffffe1U, 0x00f0ddffU, 0x001fe00fU, 0x22f2f011U, 0x001ff0e0U, 0xf0ff0000U, 0x10f01f3fU,
+  0x12dd01f5U, 0xf1ff0f0fU, 0x0ef000f0U, 0x001f01e0U, 0x10f2d104U, 0x00f1e00eU, 0xf001000eU, 0xf0d12000U,
+  0xf21210efU, 0xf0f01fefU, 0x0f0fdef0U, 0xd02fc1ffU, 0x230201f0U, 0x10eee2f0U, 0x0ffd0e1fU, 0x21e11c30U,
+  0xe3dd00f1U, 0xe2dd002eU, 0x0fff00dfU, 0x402f01bfU, 0x10f1c204U, 0x2002c102U, 0xf0f31f0eU, 0xf0e2300eU,
+  0xf3ff21f3U, 0xf0fe43deU, 0xfe11fe2fU, 0xb030c01fU, 0x23230f00U, 0x22eee1f0U, 0x00fc0e10U, 0x23f11d1fU,
+  0xd1db0011U, 0xe1ee004dU, 0x10ff00e0U, 0x410e0fd0U, 0x10efdf04U, 0x2003e006U, 0xf0f42100U, 0xf0e52f0fU,
+  0xf2001412U, 0xf1f022f1U, 0x0021112fU, 0xa01ee14fU, 0x0350010fU, 0x1020d0feU, 0x1ffd1d1fU, 0x31d0ff1eU,
+  0xd3e00020U, 0xd0e0002fU, 0x21f000d1U, 0x100e01feU, 0x100ce105U, 0x00012106U, 0x00022201U, 0x0004010eU,
+  0x111142f1U, 0xf1e01101U, 0xf0202010U, 0xdf20004fU, 0xe150e2ffU, 0xf04ee2eeU, 0x100eef0fU, 0x1fcf0000U,
+  0x100f01e0U, 0x00ff00f0U, 0xfff10030U, 0x10110122U, 0x00200f0eU, 0x00eee00fU, 0x00e10f00U, 0xf0022300U,
+  0xd013c11fU, 0x1f0003eeU, 0xf0e02ff0U, 0xf00f2fffU, 0x24e1f100U, 0x1eee00e0U, 0x00fef30fU, 0x21f0f01eU,
+  0x11ef0fe0U, 0xf10c0f1fU, 0xff02013fU, 0x201d0201U, 0x10101f00U, 0xf0e1f000U, 0xd000120fU, 0x1011210eU,
+  0xf202e001U, 0x0ee224efU, 0xfe0f0ed0U, 0xe03dfeefU, 0x0300e020U, 0x21dfd1ffU, 0x110ee13eU, 0x1f130d10U,
+  0xe1d00ddeU, 0x02ec0d3eU, 0x02f0021eU, 0x210e02ffU, 0x302e2102U, 0x2011f001U, 0xe022230eU, 0x2003320fU,
+  0xfff00212U, 0x0de035e0U, 0xfe10fdefU, 0xe23ff0f1U, 0x2f31ef1fU, 0x2fe201feU, 0x01feff3eU, 0x1e200c0fU,
+  0xf2f00d03U, 0xf1d00f3eU, 0x220001efU, 0x130e00feU, 0x302c2200U, 0x10200200U, 0xd012150eU, 0x00044200U,
+  0xfe100f02U, 0x00f12301U, 0xf1200fefU, 0xc2302ef0U, 0xfff0e12fU, 0x0f1110feU, 0x220f0e1eU, 0x3ffc0e0dU,
+  0xf5cf0002U, 0xe1f20e10U, 0x23ff00efU, 0x020d0feeU, 0x202c200fU, 0x00fd3103U, 0xf0f0230eU, 0xf0d7210fU,
+  0x0ef010f4U, 0x00e12011U, 0xe1300f0fU, 0xbe302e1fU, 0xee2dd202U, 0xf02ff2feU, 0x132ffe0eU, 0x201aee2dU,
+  0x13200fedU, 0xff010fefU, 0xe0e10022U, 0x1f3f0222U, 0xf021200dU, 0x00d0e00fU, 0x10a1f003U, 0x00c22002U,
+  0xcf110e01U, 0x1ef050d0U, 0xf0f151ffU, 0xff0e1f00U, 0x3fdf2113U, 0x0f0fe1dfU, 0x10efd10fU, 0x10f2ef11U,
+  0x14000eeeU, 0xe0ff0effU, 0x0ff1005fU, 0x0f1f0331U, 0x00513f0dU, 0x1010000fU, 0xd0902202U, 0x00010201U,
+  0x00300e12U, 0x1cf143eeU, 0xedf05000U, 0x002c2f0fU, 0x3d0f0130U, 0x0fc1ede1U, 0x211dd21fU, 0x0f01ff2eU,
+  0xf310001eU, 0x01f00d20U, 0x1110016eU, 0x211f043cU, 0x3031300cU, 0x1020e300U, 0xe0e13301U, 0x1011140eU,
+  0xf120ec02U, 0x0d012410U, 0xdeff4e20U, 0x321f2d10U, 0x1f00e210U, 0x1df1000fU, 0x101ee320U, 0xfff33f1eU,
+  0x02df0f11U, 0xf1c30011U, 0x0200023fU, 0x321e021dU, 0x00102f0dU, 0x00001100U, 0xe010230eU, 0x00f1340cU,
+  0xf1200cf1U, 0x01031011U, 0x0f0f1e00U, 0xf3211d11U, 0x1efed22fU, 0x1e0f2311U, 0x1f00020fU, 0x0edf4f1eU,
+  0x31c20e00U, 0x0ef30e10U, 0x320f011eU, 0x320b000eU, 0x0030300dU, 0x10202002U, 0xf0e0110cU, 0xd0e3310aU,
+  0x0120fde1U, 0x0111f001U, 0x0ff00effU, 0xd120fbf1U, 0x1ae9e22eU, 0x110c0212U, 0x0210000eU, 0x2c0bed2eU,
+  0xf44f0efeU, 0xeeb102e1U, 0xf2ef0f02U, 0x011e0111U, 0xf01f200fU, 0x10d4ef0fU, 0x10c30f01U, 0x10b20004U,
+  0xcf20ed11U, 0x100e43e0U, 0x10004f00U, 0xfe102100U, 0x2ffe1012U, 0xee10d01fU, 0x11ef01efU, 0x11e010e0U,
+  0x034f000cU, 0xf00200ffU, 0x00f10011U, 0x02000420U, 0xf020410dU, 0x00f3e10fU, 0xd0c22f03U, 0xf0d00202U,
+  0xd130ed12U, 0x101f13e1U, 0xf0023220U, 0x002d320eU, 0x1bfdf221U, 0xee10ef40U, 0x11ffe0ffU, 0x0f2e3ff0U,
+  0xf3110f0cU, 0xf1f20001U, 0x0f0f0040U, 0x2241063dU, 0xf01f320dU, 0x10e3c000U, 0xd0c03f02U, 0xe0e2e100U,
+  0xd3211df1U, 0x1410e0f1U, 0xef02212fU, 0x1e0e4f12U, 0x0ceb0201U, 0x1d0d1f30U, 0x020fff0fU, 0xf0124221U,
+  0x12e00dfdU, 0xeff40ef1U, 0xfe0f023eU, 0x4f1e052fU, 0xf00f1f0dU, 0x00d00d02U, 0xf0e02f03U, 0x00f2f00bU,
+  0xe1222cd0U, 0xf1230e21U, 0xfdf01030U, 0xfd1ffe01U, 0x2cd9121fU, 0x2df92032U, 0xf01f010fU, 0xfdd17221U,
+  0x11d10effU, 0xff200ef2U, 0x1d0f0150U, 0x5d2f02ffU, 0xf00e100cU, 0x10100e02U, 0x00f01f00U, 0x10e31e0aU,
+  0xf0310df0U, 0xd104ffe1U, 0xefdf2f5fU, 0xfe00df1fU, 0x1debf01dU, 0x11fc4031U, 0xff00e20fU, 0x0de210f0U,
+  0xf13f0e0eU, 0xfedf03d1U, 0x140f0001U, 0xf71c0130U, 0xf020200eU, 0x10e3d100U, 0x10110000U, 0xf0f10005U,
+  0xee12ee01U, 0x212be2e1U, 0x2f1f1100U, 0xff0e611eU, 0x000f2110U, 0xfe20ce2fU, 0xf0d00f0fU, 0x02e011e0U,
+  0x012f0e1cU, 0x1fbe03f2U, 0x120f0101U, 0xf42e051fU, 0x004f2000U, 0x00f1cf01U, 0xf0201f00U, 0xe0e3e102U,
+  0xf112fc00U, 0xf20ef4f1U, 0x001f111fU, 0x1d0d62feU, 0x0e1d2000U, 0x1f1ede32U, 0xf0e000ffU, 0xe0e340efU,
+  0x02f00ffcU, 0xfcc00106U, 0x2f2e0240U, 0x126f0630U, 0xe01e2f0eU, 0xf0fddd03U, 0xc01f2001U, 0xc0a2a002U,
+  0x2102ede1U, 0x06d0f3f1U, 0xd1021120U, 0x1c0d52e0U, 0x2d2d2f0fU, 0x300ddf21U, 0xf0e0e1e0U, 0xf0f14110U,
+  0x12d00edeU, 0xcb100f03U, 0x1e2d0250U, 0x105f0740U, 0x000e0f0eU, 0x20ff1e07U, 0xd0101101U, 0xc0c4ab02U,
+  0x2212fdffU, 0xd5e2f200U, 0xc1f10021U, 0xee0e2ecfU, 0x0e0b30e0U, 0x0201e011U, 0xe0f2d2f2U, 0x10c14213U,
+  0x0fd10fe0U, 0xcf5f0f21U, 0x1d0f0040U, 0x10400420U, 0x00fe200eU, 0x103f0104U, 0x00101003U, 0xe0e4cc01U,
+  0x1f03ff00U, 0xc4f2f0efU, 0xe1d01020U, 0xdf0f20deU, 0x1ffcffffU, 0x03d11022U, 0xfdf0e0feU, 0xfda320f1U,
+  0x00f100f1U, 0x420f00ffU, 0x222d0002U, 0xefff00f3U, 0xf010f400U, 0x0001f201U, 0x00202101U, 0x00edfe00U,
+  0xf01f2ff0U, 0x003013c2U, 0x00100f0fU, 0x00f1f1feU, 0xef0cf1f0U, 0x223100e0U, 0x000100f1U, 0x10f1e000U,
+  0x01f00e02U, 0x24ec010fU, 0x141d00f1U, 0x00fe0124U, 0xe01f0301U, 0x00d3d306U, 0x2030120fU, 0x20eef10fU,
+  0xf11e4f01U, 0x002f17afU, 0x00110e00U, 0xfff11230U, 0xff2a0100U, 0x3712e0f0U, 0x1ff11002U, 0x2fe1e000U,
+  0x01ff0e02U, 0x03ef0fdeU, 0x132e00ffU, 0xf1fe0112U, 0x00210203U, 0x00ffb505U, 0x10511100U, 0x10e1e00fU,
+  0x140f2f12U, 0x011c54d1U, 0x1fff1100U, 0xd0001141U, 0xef391000U, 0x1572e2efU, 0x00121e0fU, 0x00edff00U,
+  0xe20f0e12U, 0x03de000dU, 0x32e1001eU, 0xf2ed0021U, 0xf0302201U, 0xe01ec203U, 0x00111f00U, 0x10e1d10eU,
+  0x0402fd01U, 0x0e3f2102U, 0x1ed02320U, 0xf0301f40U, 0xfe2b0ff0U, 0xf46ff30fU, 0x00031f01U, 0xf10d0fffU,
+  0xd0010f00U, 0x14e2000fU, 0x22010021U, 0xf2fe01f1U, 0x001f4103U, 0xe01ff105U, 0x1031f00fU, 0x00c1f00fU,
+  0x04e20df1U, 0x00201011U, 0x0fd02001U, 0xe02ff0f0U, 0x0e5f2f0fU, 0xe06ff2f1U, 0x00010011U, 0x00df0e0fU,
+  0x20d100f0U, 0x31ff00efU, 0x142f0003U, 0xf1fd00e0U, 0xf0f3e300U, 0x10f1f002U, 0xf03f030eU, 0x10ffee0fU,
+  0xe11e3df1U, 0x0e3316dfU, 0xfe0ed0e0U, 0x0fd1c11fU, 0xe00af1feU, 0x15f300e1U, 0x1e11f010U, 0x10f000e0U,
+  0x20d30004U, 0x31f00dfdU, 0x231f00d2U, 0xf2fe0113U, 0x00f1f300U, 0x20d1f203U, 0xf032020eU, 0x00f2130eU,
+  0xf20f5e02U, 0x1cf136dfU, 0x1e0df1e2U, 0xffc20321U, 0xe1fcf2efU, 0x10f3e000U, 0x1d111e0fU, 0x2df1efffU,
+  0x0fe30013U, 0x00e10ffcU, 0x131e01d0U, 0xf2de0215U, 0x2010e30fU, 0xf0e0f502U, 0xe0210200U, 0xf0d10301U,
+  0xf20f3f01U, 0x0ed022f3U, 0x1e0d12d1U, 0xd0ef2032U, 0xffed010fU, 0x0101f50fU, 0x2e21ef1fU, 0x01dcf11eU,
+  0xe1f10001U, 0x00e10f2fU, 0x21ff01e0U, 0xe3dd0031U, 0x00301100U, 0x102f0602U, 0xe0200f0fU, 0x5011f400U,
+  0x11010e10U, 0xee112d02U, 0x0dfe13e0U, 0xe11e0020U, 0xfe0b0e1fU, 0x01fce40fU, 0x10020f20U, 0x03cc0100U,
+  0xdff20f01U, 0x13110f11U, 0x21f100f0U, 0xf2fc0020U, 0xe01e3002U, 0xf03de40eU, 0x1012000eU, 0x10f0010eU,
+  0x33d2fc02U, 0x1e110ee3U, 0x0e0022e1U, 0xd12f0fdfU, 0x0b4d1f20U, 0xe12d0213U, 0x01f2f000U, 0x01dd1d01U,
+  0x2fd0000fU, 0x32f000eeU, 0x1002000eU, 0xd22f0fefU, 0x00f3e100U, 0x10200f0fU, 0xf021f60eU, 0x0030f10cU,
+  0xd10e1211U, 0x0e1124e0U, 0x1efee00eU, 0x0cf0de4fU, 0xf10ce0feU, 0x02d300e3U, 0x1e5ed021U, 0xf0e124e2U,
+  0x2ec00022U, 0x41d00decU, 0x1f2003efU, 0xf4fe0213U, 0x10e2f202U, 0x30f20301U, 0xe021f200U, 0xf0222201U,
+  0xc3fe2131U, 0x3e0035e0U, 0x210be2edU, 0x1cf2ff2eU, 0xf3ded20dU, 0x32e2df2dU, 0x2d3ef04eU, 0x2e00f010U,
+  0x2fff0012U, 0xffef0d3bU, 0x000102eeU, 0x32df0123U, 0x40f20201U, 0x20b11003U, 0xe03ff00eU, 0xf0002304U,
+  0xf30f2120U, 0xd0014222U, 0x100d01cfU, 0xe00f003fU, 0xf0eed1eeU, 0x402fe31fU, 0x301fe33fU, 0x1f1cdf1dU,
+  0x1f100ff0U, 0xe0c20e32U, 0x2002031dU, 0x32df002fU, 0x10103100U, 0x20e15004U, 0xd01ff00fU, 0x202e0301U,
+  0x12113d10U, 0x0f133d12U, 0xe0fe00bfU, 0xe21e0e00U, 0x0f0e000eU, 0x0e0c05feU, 0x3010f33dU, 0x12db0feeU,
+  0xed010e00U, 0xd3110e12U, 0x30f202dfU, 0x470c001fU, 0xe02e3e03U, 0x4010f100U, 0x0012f10eU, 0x103fe10fU,
+  0x22f2fd02U, 0xf1120f02U, 0xe11f00c0U, 0xc10e10c0U, 0x0d2e2e10U, 0xffde1310U, 0x20ff105fU, 0xe3ae10eeU,
+  0x100f0200U, 0x22df01edU, 0xecf20efcU, 0xf4020e0dU, 0x0013f000U, 0x1032fe0fU, 0xf00ff201U, 0xd030010fU,
+  0xe0fff010U, 0xfd1f1202U, 0x103fe0f1U, 0x0e1ffd43U, 0xf1fff000U, 0x0e0201f3U, 0x116ac000U, 0xef0f35f2U,
+  0x101f0031U, 0x31e000ecU, 0xcdf300faU, 0xf1ff0030U, 0x00f20300U, 0x10121100U, 0xf00ee100U, 0xc0102002U,
+  0xd1f01011U, 0x31fef600U, 0x013ef0eeU, 0x0022ec20U, 0x02eff10dU, 0x3c03cf3eU, 0x326cc04fU, 0x2f2ef110U,
+  0x0f0f0112U, 0x1c000e3eU, 0xd0f403fcU, 0x21d00f1fU, 0x30f20301U, 0x10b14f01U, 0xd01e000eU, 0xf01e2f02U,
+  0x100f11f0U, 0x10101440U, 0xcf201edfU, 0x0120fd1eU, 0xf10102eeU, 0x3d10c01fU, 0x304bc050U, 0x1f1de10fU,
+  0x0f0101f1U, 0x0b110e22U, 0x0102051eU, 0x3202001fU, 0x00011100U, 0x20f03d04U, 0xd000ee0dU, 0x001df001U,
+  0x1f1ffdffU, 0xe0f20300U, 0xbf230dc0U, 0x1f0ffe00U, 0x00101001U, 0x0ef0f200U, 0x213ce161U, 0x01edffffU,
+  0xfd2201efU, 0xe12d0f12U, 0x62f00300U, 0x150f002eU, 0xf0122001U, 0x3030e003U, 0xe0ffde0cU, 0x001dd100U,
+  0x1123deefU, 0xe3f102efU, 0xc01100c0U, 0xdfdd0e00U, 0x10223f14U, 0x12ce30f0U, 0x21ef0052U, 0xf2fe00e1U,
+  0xf1000111U, 0x1fef0ff1U, 0x19ef0ffeU, 0x20040dcfU, 0x00d10001U, 0x00f2ff0dU, 0xf0efff0eU, 0x00121201U,
+  0x00000020U, 0x100ef202U, 0xfeffce0eU, 0x1f011e02U, 0x00100111U, 0x1d0f0f21U, 0x132cc0ffU, 0x0d2e231fU,
+  0xe01f0022U, 0x30ed0ef1U, 0xfcdd02feU, 0x0f030f3fU, 0xf0e01302U, 0x20f0030eU, 0xe0ef0d0eU, 0xc00f3000U,
+  0xf0122f00U, 0x030fe611U, 0xbd03ff0eU, 0x201f0e31U, 0x0f010001U, 0x3b22ef13U, 0x151bbff0U, 0x103d3200U,
+  0xef0e0113U, 0x2d0d0d04U, 0x0de003dfU, 0x0ff10f3eU, 0x10f2f001U, 0x200f4103U, 0xd0e00f0dU, 0xe03f3e0fU,
+  0x101010eeU, 0xd4f0f341U, 0xac17feefU, 0x2f21fe00U, 0xf201100dU, 0x3b00bfe1U, 0x142bdf12U, 0x001d1002U,
+  0x11010201U, 0xf9100d22U, 0x5fe004e0U, 0x1ff2000fU, 0xf0f2ee00U, 0x401f5404U, 0xe0eeef0dU, 0xd02e0000U,
+  0x1fff10c0U, 0xb4f1f34fU, 0xbe14f0f0U, 0x0e1fefffU, 0x021e11f0U, 0x0fe2dfffU, 0x240cff43U, 0xfffef0e2U,
+  0x120100f0U, 0x0f2e0e10U, 0x50f001f0U, 0xff0f000fU, 0xf0f10001U, 0x002f0003U, 0xf0dded0fU, 0x000fe00fU,
+  0xf01000cfU, 0xc2d00100U, 0xdfe0f0dfU, 0xdfee0f00U, 0x141e1002U, 0x02cffff0U, 0x22def012U, 0xfe1ef000U,
+  0x001f0010U, 0x00fe011eU, 0x0f0000ffU, 0x00000000U, 0x00f11f0fU, 0x20ef1f02U, 0x00fffd0fU, 0x00000000U,
+  0x0010101fU, 0x00e003f0U, 0x00e1fef0U, 0x00000000U, 0xf0f00011U, 0x31f2ef1fU, 0xf00f1000U, 0x00000000U,
+  0xf00f0000U, 0xfe0f002cU, 0x0e020020U, 0x00000000U, 0x10c00f00U, 0x20c10d02U, 0xf0f0ed0eU, 0x00000000U,
+  0x0111001fU, 0x00d021feU, 0x0df210ffU, 0x00000000U, 0xe0ef2110U, 0x3210d00eU, 0x00dd2130U, 0x00000000U,
+  0xd0f00f0fU, 0xffee0f3eU, 0x1ef20121U, 0x00000000U, 0xe0d1ff00U, 0x20cefd03U, 0xe002ed0dU, 0x00000000U,
+  0xd201100fU, 0xcfd3300dU, 0x0c331e0eU, 0x00000000U, 0x0fee1f30U, 0x402ec00eU, 0x2fba2e20U, 0x00000000U,
+  0xeff00fe1U, 0xedbd0f5eU, 0x201f01f1U, 0x00000000U, 0x000ff001U, 0x10c0fd04U, 0xe002f10fU, 0x00000000U,
+  0xe3f1f0f0U, 0xe0e2e10fU, 0x0d41f0ffU, 0x00000000U, 0x10e01011U, 0x2f40efffU, 0x21ad201eU, 0x00000000U,
+  0x0e000ff0U, 0xeebf0f4fU, 0x520e01c0U, 0x00000000U, 0x000d2f01U, 0x200f1f04U, 0xf0f2f10cU, 0x00000000U,
+  0xf1f1ce20U, 0x01e2f030U, 0x0f40d010U, 0x00000000U, 0x1fef1f00U, 0x1e2de0ffU, 0x01bf1f10U, 0x00000000U,
+  0x101e0021U, 0xed3f001eU, 0xef0000f0U, 0x00000000U, 0x00001e01U, 0x20fd2b01U, 0xf011fc0fU, 0x00000000U,
+  0xff21fe10U, 0x1fc2e6dfU, 0xffe20fe0U, 0x00000000U, 0x01f00f10U, 0x7216ee3fU, 0x00ee0000U, 0x00000000U,
+  0x011e0132U, 0xef4d0f0bU, 0xfe000110U, 0x00000000U, 0xf0f00f01U, 0x100e1c0fU, 0xc0f0fd0eU, 0x00000000U,
+  0x0124ee2fU, 0x1ff3f0edU, 0xec1300dfU, 0x00000000U, 0x0eef0f10U, 0x6e110f10U, 0x02de0f21U, 0x00000000U,
+  0x00ff0022U, 0xf2fc0f3aU, 0x2f110211U, 0x00000000U, 0xf00c0f0fU, 0x10ff090fU, 0xd0e2fe0eU, 0x00000000U,
+  0xe123fe31U, 0x3115df0dU, 0x0b331eeeU, 0x00000000U, 0x1f0e0d11U, 0x30f20ff1U, 0x04dd1121U, 0x00000000U,
+  0xf0f00f02U, 0xf00d0f40U, 0x1211022fU, 0x00000000U, 0xe01d1000U, 0x10cdfb0fU, 0xe002d00dU, 0x00000000U,
+  0xd200fd01U, 0x3010e000U, 0xfa330d1eU, 0x00000000U, 0x10ec0003U, 0x2ee30fefU, 0x12cd0222U, 0x00000000U,
+  0x0ee00ff1U, 0xfeff0d20U, 0x133e0010U, 0x00000000U, 0x001d0001U, 0x30ff3001U, 0xe0f4e20eU, 0x00000000U,
+  0xf303ce20U, 0x4f01c032U, 0xcf5100f0U, 0x00000000U, 0x02ec1002U, 0x0cfe1ee0U, 0x13ad0211U, 0x00000000U,
+  0x222e0f11U, 0xb03e0f0fU, 0xed0f0003U, 0x00000000U, 0x00e12000U, 0x10f03c00U, 0x00dffc0fU, 0x00000000U,
+  0xff14fd20U, 0x2ff2d2fdU, 0xde01f1efU, 0x00000000U, 0x00d12011U, 0x70060d41U, 0x12bff110U, 0x00000000U,
+  0x021d0032U, 0xb22e030cU, 0xff000102U, 0x00000000U, 0x00001002U, 0x20210e01U, 0xe0e0ee00U, 0x00000000U,
+  0x0123dd30U, 0x4011d1ecU, 0xad22f0c0U, 0x00000000U, 0x00cfe0e1U, 0x5d041b52U, 0x10aff010U, 0x00000000U,
+  0xf1f00f30U, 0xc50d02dcU, 0x31e10f12U, 0x00000000U, 0xf00f1200U, 0x304f1f0fU, 0xd0d30e00U, 0x00000000U,
+  0x2112ee30U, 0x4021c21cU, 0xbe0320e0U, 0x00000000U, 0x1fefeee3U, 0x10f62b31U, 0x21ade240U, 0x00000000U,
+  0xcff10f0fU, 0xd2100df1U, 0x00fe0142U, 0x00000000U, 0xe02f2100U, 0x402e100fU, 0x00c4ff01U, 0x00000000U,
+  0x2101fe02U, 0x1310cf02U, 0xce02522fU, 0x00000000U, 0xffdeee15U, 0xfde43ff1U, 0x21fce311U, 0x00000000U,
+  0xddd00ff1U, 0x0d610ee1U, 0x020b0f33U, 0x00000000U, 0x003e2004U, 0x20f0110dU, 0x20e2f103U, 0x00000000U,
+  0x03f4ce20U, 0x4421bfe0U, 0xb0007230U, 0x00000000U, 0x01db1ff3U, 0xfad05001U, 0x04fbd20eU, 0x00000000U,
+  0x032d00f1U, 0xa23b0211U, 0x0cf10111U, 0x00000000U, 0x00012000U, 0x20f1390fU, 0x00eeff00U, 0x00000000U,
+  0xdf04e01fU, 0x1023130eU, 0xcf02ffe1U, 0x00000000U, 0x0fc11f11U, 0x31252e42U, 0x21afe200U, 0x00000000U,
+  0xf31e0012U, 0xa32e0221U, 0xfd010102U, 0x00000000U, 0x00102101U, 0x10001c00U, 0xe0fefe01U, 0x00000000U,
+  0x0011fd01U, 0x213202ebU, 0xe0020fe4U, 0x00000000U, 0x01e2ffd1U, 0x2d432c41U, 0x1fc0e320U, 0x00000000U,
+  0x021f0ef2U, 0xa22001f1U, 0x0eef0032U, 0x00000000U, 0xe04f2302U, 0x30f1ed0eU, 0xc00e1e02U, 0x00000000U,
+  0x1400fe00U, 0x1231f2deU, 0xe0033d22U, 0x00000000U, 0x01d0e0e3U, 0xef154c30U, 0x3ffee430U, 0x00000000U,
+  0xe1d10eb0U, 0xf22101c1U, 0x1f0e0144U, 0x00000000U, 0xd04f2002U, 0x50e1de00U, 0xd0f02e00U, 0x00000000U,
+  0x0301efe1U, 0x0201f1ffU, 0xff213011U, 0x00000000U, 0xf1ceff04U, 0xeff250f0U, 0x0e1fe2edU, 0x00000000U,
+  0xded00fd1U, 0x0f310fe1U, 0x0fe00133U, 0x00000000U, 0xd05d3f06U, 0x2013000fU, 0x20ff3001U, 0x00000000U,
+  0xe6e3cde0U, 0x2221e0ffU, 0x00015312U, 0x00000000U, 0x03a90fe2U, 0x0dcf3020U, 0xf02fc2ddU, 0x00000000U,
+  0xf23f01f0U, 0xc43d0501U, 0xfe010e22U, 0x00000000U, 0x000f0100U, 0x20d20a03U, 0xf0200f0fU, 0x00000000U,
+  0xf1010ff0U, 0xfe1006fdU, 0x0fe20000U, 0x00000000U, 0x0ee210f1U, 0x20e71e22U, 0x12d012ffU, 0x00000000U,
+  0x021100e1U, 0xb62d0222U, 0xfc000e12U, 0x00000000U, 0xf01df302U, 0x20e1f900U, 0xf02f1100U, 0x00000000U,
+  0xf4e01dffU, 0xfd11161bU, 0xe00110f2U, 0x00000000U, 0xede200d2U, 0x2ef61e33U, 0x21f0020fU, 0x00000000U,
+  0xf0e00fc0U, 0xa51d0112U, 0x0f2e0031U, 0x00000000U, 0xc01c1202U, 0x40f3db01U, 0xd03f410fU, 0x00000000U,
+  0xe4e00deeU, 0x010013fbU, 0xf1231132U, 0x00000000U, 0xefdf0fd4U, 0x1ce61c11U, 0x20fff2efU, 0x00000000U,
+  0xced00eb0U, 0xe21000e2U, 0x112f0221U, 0x00000000U, 0xb04d4304U, 0x60e5cf03U, 0xe042330dU, 0x00000000U,
+  0xb6c20fd0U, 0x000f11feU, 0x0e511040U, 0x00000000U, 0xf2eac0f2U, 0x0ef22e0eU, 0xe0e1f0dfU, 0x00000000U,
+  0xdc0000e0U, 0xf23f00e1U, 0x11f10111U, 0x00000000U, 0xf06d6103U, 0x30f4ff02U, 0x1011240dU, 0x00000000U,
+  0xa7b3fee0U, 0x021f120fU, 0x5d301041U, 0x00000000U, 0xf2dceff0U, 0x22f2201fU, 0xec21e00eU, 0x00000000U,
+  0x00000000U, 0x00ff010eU, 0x10100000U, 0x00000000U, 0x00000000U, 0x00e0f001U, 0x00211000U, 0x00000000U,
+  0x00000000U, 0xf00fe201U, 0x00f00111U, 0x00000000U, 0x00000000U, 0x4012ef0fU, 0x101000ffU, 0x00000000U,
+  0x00000000U, 0x0f12021bU, 0x1f200100U, 0x00000000U, 0x00000000U, 0x00e0e001U, 0x10211100U, 0x00000000U,
+  0x00000000U, 0x200e02d1U, 0x0f0f1100U, 0x00000000U, 0x00000000U, 0x3f35df0fU, 0x100001ffU, 0x00000000U,
+  0x00000000U, 0x1e13021dU, 0x2f2f010fU, 0x00000000U, 0x00000000U, 0x10dee002U, 0x10100100U, 0x00000000U,
+  0x00000000U, 0x5f0e2400U, 0x00110000U, 0x00000000U, 0x00000000U, 0x2f35e00fU, 0x0ff11fe1U, 0x00000000U,
+  0x00000000U, 0x1f000210U, 0x1f0f010fU, 0x00000000U, 0x00000000U, 0x000d0101U, 0x00010100U, 0x00000000U,
+  0x00000000U, 0x300f01f2U, 0x0f110000U, 0x00000000U, 0x00000000U, 0x0022c0ddU, 0x0ff21ef1U, 0x00000000U,
+  0x00000000U, 0x20f100f1U, 0x1f1f00ffU, 0x00000000U, 0x00000000U, 0x20ee0f03U, 0x00f21001U, 0x00000000U,
+  0x00000000U, 0x1f1f1201U, 0x0101f0f0U, 0x00000000U, 0x00000000U, 0xff40cfdeU, 0x1f011f00U, 0x00000000U,
+  0x00000000U, 0xef1f00fdU, 0x00210110U, 0x00000000U, 0x00000000U, 0x20e01f00U, 0x10111200U, 0x00000000U,
+  0x00000000U, 0x0f00f20fU, 0x1fe0100fU, 0x00000000U, 0x00000000U, 0x2ff41002U, 0x2f010ff0U, 0x00000000U,
+  0x00000000U, 0xe0f1000eU, 0x0f3f021eU, 0x00000000U, 0x00000000U, 0x00efef01U, 0x10210000U, 0x00000000U,
+  0x00000000U, 0x210ff2efU, 0x0fef11eeU, 0x00000000U, 0x00000000U, 0x1d0400f2U, 0x20020fe1U, 0x00000000U,
+  0x00000000U, 0x000201feU, 0x1f0d032fU, 0x00000000U, 0x00000000U, 0xf0e0fd00U, 0x20f0ff01U, 0x00000000U,
+  0x00000000U, 0x31fdf41fU, 0x00f102ffU, 0x00000000U, 0x00000000U, 0xfe15fff1U, 0xff02ffdfU, 0x00000000U,
+  0x00000000U, 0x0f10010dU, 0x00ff021eU, 0x00000000U, 0x00000000U, 0x00f02001U, 0x100ff100U, 0x00000000U,
+  0x00000000U, 0x00fe0022U, 0x200200e0U, 0x00000000U, 0x00000000U, 0xde20d2fdU, 0x00f22ee0U, 0x00000000U,
+  0x00000000U, 0x00010f0fU, 0x000f00eeU, 0x00000000U, 0x00000000U, 0x00fe3202U, 0x00011001U, 0x00000000U,
+  0x00000000U, 0x200d1012U, 0x1111f0b0U, 0x00000000U, 0x00000000U, 0xee41e2dcU, 0x20013e01U, 0x00000000U,
+  0x00000000U, 0xf1000fffU, 0x11f001f2U, 0x00000000U, 0x00000000U, 0x20f00f0fU, 0x10d21100U, 0x00000000U,
+  0x00000000U, 0xf0101210U, 0x2fe002eeU, 0x00000000U, 0x00000000U, 0x10d410e2U, 0x00100e1fU, 0x00000000U,
+  0x00000000U, 0xf1f100efU, 0x10200200U, 0x00000000U, 0x00000000U, 0x00ffde00U, 0x00c20e00U, 0x00000000U,
+  0x00000000U, 0x0f0f34e0U, 0x0ee012eeU, 0x00000000U, 0x00000000U, 0x1f030ff0U, 0x01020e00U, 0x00000000U,
+  0x00000000U, 0x00f200deU, 0xf020022fU, 0x00000000U, 0x00000000U, 0x1000ee00U, 0x10d1fb03U, 0x00000000U,
+  0x00000000U, 0x1ffe1300U, 0x2de003eeU, 0x00000000U, 0x00000000U, 0xf0141fffU, 0x02032ef1U, 0x00000000U,
+  0x00000000U, 0xfffe001dU, 0x0e1000feU, 0x00000000U, 0x00000000U, 0x20ff0101U, 0x10f0fe00U, 0x00000000U,
+  0x00000000U, 0x11fdf221U, 0x3ff1f1ffU, 0x00000000U, 0x00000000U, 0xd032f0eeU, 0x00033fefU, 0x00000000U,
+  0x00000000U, 0x1f200e1fU, 0xf01100feU, 0x00000000U, 0x00000000U, 0x20010104U, 0x10010001U, 0x00000000U,
+  0x00000000U, 0x10ed3301U, 0x3f1102f0U, 0x00000000U, 0x00000000U, 0xee32f3dbU, 0x01113f00U, 0x00000000U,
+  0x00000000U, 0xe20f0001U, 0x01fd03f2U, 0x00000000U, 0x00000000U, 0x200f1d0dU, 0x20e10001U, 0x00000000U,
+  0x00000000U, 0xff01f311U, 0x10ffd4eeU, 0x00000000U, 0x00000000U, 0x00c600f1U, 0x1004ec1fU, 0x00000000U,
+  0x00000000U, 0xe1ff0ef1U, 0x10e00202U, 0x00000000U, 0x00000000U, 0x200efd0eU, 0x10c00c01U, 0x00000000U,
+  0x00000000U, 0x0de01312U, 0x1ff1f5eeU, 0x00000000U, 0x00000000U, 0x0de4e0f0U, 0x1102ed1eU, 0x00000000U,
+  0x00000000U, 0x00ef0000U, 0xe00e0f21U, 0x00000000U, 0x00000000U, 0x2010ff01U, 0x10dff901U, 0x00000000U,
+  0x00000000U, 0x1c0e1232U, 0x0ee102fdU, 0x00000000U, 0x00000000U, 0xee0200ffU, 0x1112fdf0U, 0x00000000U,
+  0x00000000U, 0x1eee021fU, 0x0e2e0e0fU, 0x00000000U, 0x00000000U, 0x20011f02U, 0x30d10d01U, 0x00000000U,
+  0x00000000U, 0x1dfd1131U, 0x0fdf030eU, 0x00000000U, 0x00000000U, 0xef2112dcU, 0x00132fefU, 0x00000000U,
+  0x00000000U, 0x10020020U, 0x001000ffU, 0x00000000U, 0x00000000U, 0x20031204U, 0x30030200U, 0x00000000U,
+  0x00000000U, 0x2ede4240U, 0x201f131eU, 0x00000000U, 0x00000000U, 0xef43f2dcU, 0x0f203f1eU, 0x00000000U,
+  0x00000000U, 0xc31f0121U, 0xf10e0120U, 0x00000000U, 0x00000000U, 0x10111d0fU, 0x10ef0f00U, 0x00000000U,
+  0x00000000U, 0x0e020521U, 0x1000f20fU, 0x00000000U, 0x00000000U, 0x00d52002U, 0x10f2fff1U, 0x00000000U,
+  0x00000000U, 0xd41f0f31U, 0x020e0002U, 0x00000000U, 0x00000000U, 0x30302d0fU, 0x300f0d01U, 0x00000000U,
+  0x00000000U, 0x1f210432U, 0x0010e40eU, 0x00000000U, 0x00000000U, 0x0ff702f1U, 0x2e04de0fU, 0x00000000U,
+  0x00000000U, 0xd51e0f4eU, 0x012d0f12U, 0x00000000U, 0x00000000U, 0x40422f00U, 0x401fff00U, 0x00000000U,
+  0x00000000U, 0x40421242U, 0x0e00f30dU, 0x00000000U, 0x00000000U, 0x0c0410dfU, 0x0e13efedU, 0x00000000U,
+  0x00000000U, 0x021f002dU, 0x022e002eU, 0x00000000U, 0x00000000U, 0x50153000U, 0x4012f200U, 0x00000000U,
+  0x00000000U, 0x5d4f1150U, 0x0fe0032eU, 0x00000000U, 0x00000000U, 0xfc3520cbU, 0xfe1310ddU, 0x00000000U,
+  0x00000000U, 0xf3020f10U, 0x02000110U, 0x00000000U, 0x00000000U, 0x10051200U, 0x1003f300U, 0x00000000U,
+  0x00000000U, 0x7d3f2030U, 0x0f1f111fU, 0x00000000U, 0x00000000U, 0x1c63301cU, 0x1f01210fU, 0x00000000U,
+  0x03f200ffU, 0x00000000U, 0x00000000U, 0x110200f1U, 0x003ef403U, 0x00000000U, 0x00000000U, 0x0021010eU,
+  0x103020d1U, 0x00000000U, 0x00000000U, 0x10101000U, 0xf22f0010U, 0x00000000U, 0x00000000U, 0xe10f2100U,
+  0x14ff0efeU, 0x00000000U, 0x00000000U, 0x020100e2U, 0x001b1504U, 0x00000000U, 0x00000000U, 0xf013ef02U,
+  0x112f2fe0U, 0x00000000U, 0x00000000U, 0x010031ffU, 0x134ef10fU, 0x00000000U, 0x00000000U, 0xf5fe301fU,
+  0x43300d1cU, 0x00000000U, 0x00000000U, 0x02000fd0U, 0x003b7705U, 0x00000000U, 0x00000000U, 0x10f4d101U,
+  0x101f3ed1U, 0x00000000U, 0x00000000U, 0xf21f31e0U, 0x2e50e011U, 0x00000000U, 0x00000000U, 0xf51e4f21U,
+  0x33200e0eU, 0x00000000U, 0x00000000U, 0xf20f0fe1U, 0xf05e4202U, 0x00000000U, 0x00000000U, 0x10f2df01U,
+  0x21112fefU, 0x00000000U, 0x00000000U, 0xf21012e0U, 0x2e40f030U, 0x00000000U, 0x00000000U, 0x03102022U,
+  0x53420020U, 0x00000000U, 0x00000000U, 0xf3f000d0U, 0xa05e3102U, 0x00000000U, 0x00000000U, 0x0010f002U,
+  0x200f10d1U, 0x00000000U, 0x00000000U, 0xf22010e1U, 0x10310141U, 0x00000000U, 0x00000000U, 0x01202f31U,
+  0x41f10fffU, 0x00000000U, 0x00000000U, 0x00e20100U, 0x00b10205U, 0x00000000U, 0x00000000U, 0xf0100f00U,
+  0x213d5fd1U, 0x00000000U, 0x00000000U, 0x01211f00U, 0x113c001fU, 0x00000000U, 0x00000000U, 0xe30e001fU,
+  0x4f210ddfU, 0x00000000U, 0x00000000U, 0x10f10101U, 0xf0c00302U, 0x00000000U, 0x00000000U, 0x00e10f00U,
+  0x111e2ec2U, 0x00000000U, 0x00000000U, 0x020101f0U, 0x002201efU, 0x00000000U, 0x00000000U, 0xd7fe2f10U,
+  0x2e3101eeU, 0x00000000U, 0x00000000U, 0x200f00f0U, 0xf0b01101U, 0x00000000U, 0x00000000U, 0x20ffe000U,
+  0x3a30d0b2U, 0x00000000U, 0x00000000U, 0xe1f001e0U, 0x0d0410ffU, 0x00000000U, 0x00000000U, 0x021f0f00U,
+  0x202303d0U, 0x00000000U, 0x00000000U, 0x000e0100U, 0xe0f10f0eU, 0x00000000U, 0x00000000U, 0x40000f01U,
+  0x6b30c0deU, 0x00000000U, 0x00000000U, 0xe1f202e1U, 0x11f400e0U, 0x00000000U, 0x00000000U, 0x2212ee1fU,
+  0x1044021eU, 0x00000000U, 0x00000000U, 0xf3e001f0U, 0xe03ff10eU, 0x00000000U, 0x00000000U, 0x00100100U,
+  0x0c2ec10fU, 0x00000000U, 0x00000000U, 0x1210ffd1U, 0x01070012U, 0x00000000U, 0x00000000U, 0x11100f1fU,
+  0x6fe10301U, 0x00000000U, 0x00000000U, 0x0e010100U, 0x20a1fd03U, 0x00000000U, 0x00000000U, 0xf02e0d02U,
+  0x130d34e0U, 0x00000000U, 0x00000000U, 0x0102f1efU, 0x1012db1dU, 0x00000000U, 0x00000000U, 0x031ffd2eU,
+  0x0ff103e4U, 0x00000000U, 0x00000000U, 0x1f000002U, 0xf0b3ec01U, 0x00000000U, 0x00000000U, 0x000d0d01U,
+  0xf2dd34bdU, 0x00000000U, 0x00000000U, 0xf1e1e2e0U, 0x24011b11U, 0x00000000U, 0x00000000U, 0x04f02fffU,
+  0xaf100213U, 0x00000000U, 0x00000000U, 0x1f0e0100U, 0x00d3eb01U, 0x00000000U, 0x00000000U, 0x10f00f01U,
+  0x0ff013deU, 0x00000000U, 0x00000000U, 0xe0e1e0f0U, 0x06f21d01U, 0x00000000U, 0x00000000U, 0x11e210d1U,
+  0xb0110222U, 0x00000000U, 0x00000000U, 0xf00f020fU, 0x00c3ff01U, 0x00000000U, 0x00000000U, 0x001f200fU,
+  0xeedd141eU, 0x00000000U, 0x00000000U, 0x0ff1fff0U, 0xf40212f0U, 0x00000000U, 0x00000000U, 0x2ff1dff1U,
+  0xf2020311U, 0x00000000U, 0x00000000U, 0x11ef001fU, 0x10e1030fU, 0x00000000U, 0x00000000U, 0xd01f200dU,
+  0x0deef54dU, 0x00000000U, 0x00000000U, 0x1f100ef1U, 0xf2f5f3f2U, 0x00000000U, 0x00000000U, 0x1f0de0f0U,
+  0x12fb02f0U, 0x00000000U, 0x00000000U, 0x0f010101U, 0x30effc0eU, 0x00000000U, 0x00000000U, 0x001d0e00U,
+  0x12fff4fcU, 0x00000000U, 0x00000000U, 0x10e2e2efU, 0x5fd4eb10U, 0x00000000U, 0x00000000U, 0x12120f00U,
+  0xf1ec0fe2U, 0x00000000U, 0x00000000U, 0x1f000f03U, 0x302e0e01U, 0x00000000U, 0x00000000U, 0x10fe1f00U,
+  0x0001c5fbU, 0x00000000U, 0x00000000U, 0x00d2f20eU, 0x5ec3ac2fU, 0x00000000U, 0x00000000U, 0x03f01ed1U,
+  0x01dc0f12U, 0x00000000U, 0x00000000U, 0x200e0f11U, 0x504d3f0eU, 0x00000000U, 0x00000000U, 0x20ef110fU,
+  0x0f11e42bU, 0x00000000U, 0x00000000U, 0xfee1f12fU, 0x0fb2adedU, 0x00000000U, 0x00000000U, 0xf1e0dec1U,
+  0x02ef0231U, 0x00000000U, 0x00000000U, 0x100f0000U, 0x20ff310fU, 0x00000000U, 0x00000000U, 0x001f200dU,
+  0x00de143fU, 0x00000000U, 0x00000000U, 0xed01ff1eU, 0x0ef1defcU, 0x00000000U, 0x00000000U, 0x0eefdedfU,
+  0x13fd022eU, 0x00000000U, 0x00000000U, 0x20ef000fU, 0x10ef020fU, 0x00000000U, 0x00000000U, 0xf02e1f0dU,
+  0x00cd02feU, 0x00000000U, 0x00000000U, 0xee02f00fU, 0x01f201ffU, 0x00000000U, 0x00000000U, 0x1ffeeff0U,
+  0xc2fd015dU, 0x00000000U, 0x00000000U, 0x10100010U, 0xf01df10bU, 0x00000000U, 0x00000000U, 0x100f1f0fU,
+  0x1f2eee0fU, 0x00000000U, 0x00000000U, 0x10f20200U, 0xf0b0fff1U, 0x00000000U, 0x00000000U, 0x11f20001U,
+  0xe4ec0d0dU, 0x00000000U, 0x00000000U, 0x200d0e23U, 0x107cd00eU, 0x00000000U, 0x00000000U, 0x300f3f0eU,
+  0x2f31ef0dU, 0x00000000U, 0x00000000U, 0x1f02111fU, 0x0fc2edd1U, 0x00000000U, 0x00000000U, 0x11e300d0U,
+  0x13ed0dfdU, 0x00000000U, 0x00000000U, 0x11fe0f02U, 0x105ef20fU, 0x00000000U, 0x00000000U, 0x401f300bU,
+  0xff10ff1dU, 0x00000000U, 0x00000000U, 0x3c01123fU, 0xfed3ffd0U, 0x00000000U, 0x00000000U, 0xf1d2e0cfU,
+  0x24ef0fefU, 0x00000000U, 0x00000000U, 0x01ff0000U, 0xf04dd20fU, 0x00000000U, 0x00000000U, 0x101e210cU,
+  0x0d0ffffeU, 0x00000000U, 0x00000000U, 0x3cf0003eU, 0x0eff00e1U, 0x00000000U, 0x00000000U, 0x0ff1e1deU,
+  0x630f0f0fU, 0x00000000U, 0x00000000U, 0xfff00ff0U, 0x001fb20fU, 0x00000000U, 0x00000000U, 0x001e200dU,
+  0x1fed00f0U, 0x00000000U, 0x00000000U, 0x0de1f010U, 0xfed000e2U, 0x00000000U, 0x00000000U, 0x0ffff0f0U,
+  0x002f01f0U, 0x210000f0U, 0x100000e1U, 0xef00000fU, 0x00001d0eU, 0xf00ff00fU, 0x0000f100U, 0x00ec3f0fU,
+  0x0004d21fU, 0x000ffee1U, 0x000f1ee1U, 0x00e1dd3fU, 0x02e42f10U, 0xe01d1000U, 0xf01d0100U, 0xffe00010U,
+  0x103e04b1U, 0x000e0f1fU, 0xf1e20ff3U, 0xfef200ffU, 0x00f3fd0eU, 0xe0100f00U, 0x0000e101U, 0xf0012d0bU,
+  0x0d03f3feU, 0xe0110ef0U, 0xe21f20e0U, 0x0ff2fb10U, 0x24b63101U, 0xe2ea0f2fU, 0xf10c112fU, 0x0ede1020U,
+  0x433e04d0U, 0x01ff0e30U, 0xf0e10e02U, 0x1e110000U, 0x10f3de0eU, 0xf0122002U, 0x1010e201U, 0xf0034f0aU,
+  0xfc21030fU, 0xc1120f10U, 0xe30f1f02U, 0xedf30d2fU, 0x249540f2U, 0x02d92f20U, 0x01190030U, 0x1c9c100fU,
+  0x221f020eU, 0x010f0e21U, 0xf1110e11U, 0x4f1000ffU, 0x10e0bf0fU, 0xd0f33002U, 0xf0300100U, 0x0013300bU,
+  0xfc3003ffU, 0xb3011f00U, 0xf4000e11U, 0xdd020f1dU, 0x43a44e02U, 0xf0fc1f2fU, 0x002b012fU, 0x3f9e1f0fU,
+  0x223b010eU, 0x0f0000f0U, 0x00110001U, 0x2f1000f1U, 0x10c3cf00U, 0xe0103100U, 0xe0001000U, 0x1011210cU,
+  0xdf4f01d0U, 0xe1f0ef20U, 0xf3f01e21U, 0x0f11e030U, 0x21b13e03U, 0x0f0e122eU, 0x1e4d0020U, 0x30bf0f1fU,
+  0xf04001f3U, 0x00ff0101U, 0x10e100e1U, 0xff30001eU, 0x101f1c0eU, 0x0020ff00U, 0x00f1ff0fU, 0x00f14e0fU,
+  0x1ff4e2feU, 0xf00f1fdfU, 0xe1ff0100U, 0xf0e3cd20U, 0x12e62f01U, 0xf1feff1fU, 0xf1fde00eU, 0xffe0fe10U,
+  0xf02000d1U, 0x01ff012eU, 0x1fc101f3U, 0xee4101ffU, 0x00e1fd00U, 0x00101f01U, 0x10f0f10fU, 0xf003300dU,
+  0x0ef3f2edU, 0xcf121ec0U, 0xd30f1ff0U, 0xd0f2eb20U, 0x12d32ef2U, 0x040dfc20U, 0xe4def21fU, 0x1eee1e1fU,
+  0x211e0ff0U, 0xf1e00f3dU, 0x0ed20ff0U, 0x1e430210U, 0x10d3ce00U, 0x10013202U, 0x3021e100U, 0x0012200bU,
+  0x0ff012deU, 0xd1121fe0U, 0xc3013ef2U, 0xde22eb1fU, 0x22e02ff1U, 0x120b0e30U, 0x12cc031eU, 0x0edf00ffU,
+  0x3f2d001dU, 0xf2000e2fU, 0xf1e10002U, 0x3f300110U, 0x20c1dd01U, 0xf0f13101U, 0x00100100U, 0x20030f0aU,
+  0x0f10f3e0U, 0xf1121cefU, 0xf3022ef1U, 0xfe13ef1eU, 0x30002ee0U, 0x1e3b1e2fU, 0x02fb122fU, 0xffbee0e1U,
+  0x052b02e0U, 0x01210f0fU, 0xe1020000U, 0x1e0f0001U, 0x10f3e103U, 0xc0e3100fU, 0xe00f1101U, 0x3003100dU,
+  0xe03f22dfU, 0xf0011c0fU, 0x11f01e02U, 0x0f22c010U, 0x14e01f00U, 0x1e1c203fU, 0x1f2c0021U, 0x20b0ff2fU,
+  0xef3001f2U, 0x10000010U, 0x00ff0100U, 0xef1f0010U, 0xf0e00d00U, 0x10e1f102U, 0xf0f2ff0fU, 0x00203f0eU,
+  0x2e0301ecU, 0xe00e5fe1U, 0xd0f0f010U, 0xeff3ef10U, 0x02e33f11U, 0x0efdd000U, 0x01fef01fU, 0x1ec11f30U,
+  0xf00100ffU, 0x00010f2fU, 0x1ef00103U, 0xfe010213U, 0xf0e1fd03U, 0x00e21201U, 0x10f1f00fU, 0xe011130eU,
+  0x0e1501ddU, 0xc10f5ec3U, 0xe300fff0U, 0xdff0dc00U, 0x02f03f01U, 0x221ef11fU, 0x02dff01fU, 0x0de01c3fU,
+  0x200f0ef1U, 0x11100e32U, 0x1f000fe1U, 0x0d100512U, 0x10c1fe01U, 0x00f2340eU, 0x2031010fU, 0xf0f30f0aU,
+  0x000010efU, 0x01110ef2U, 0xf10210f0U, 0x11e21d00U, 0x01f030f2U, 0x110ee010U, 0x03bff10dU, 0xfddeee2fU,
+  0x0f1e011fU, 0xd1220011U, 0x20f00fe2U, 0x1d0f0222U, 0x10c00f01U, 0xe012200eU, 0xe02f2100U, 0x00030d0bU,
+  0x0e1f0001U, 0xff220cf2U, 0xe2122ef1U, 0x20d30010U, 0x1111eee0U, 0x1f1ef100U, 0x11edf01eU, 0x0fbff10fU,
+  0x030e032eU, 0xf0310f12U, 0x00d100f0U, 0x0b2f0103U, 0xe0eff100U, 0xe013f10eU, 0xf00f3f00U, 0x10122f0cU,
+  0x1e1e2300U, 0xef320f0fU, 0x00200ff2U, 0x2001e20fU, 0x001fdf00U, 0x02fe0140U, 0x001d0f1fU, 0x1fc0200fU,
+  0xf1100401U, 0x1ed00001U, 0x021e0000U, 0xf0110001U, 0xf01e0d01U, 0x20c1e000U, 0xf0e01e00U, 0x004e1100U,
+  0x3f12e2eeU, 0x00fe51d1U, 0xd001f00fU, 0x0f02d0f0U, 0x03033f11U, 0x0fefef0eU, 0x01ff0010U, 0x2e001f30U,
+  0x10000002U, 0x3de00011U, 0x01100012U, 0xd10e0100U, 0xf00e1f01U, 0x20e1f400U, 0xf0e11d01U, 0x002f1e01U,
+  0x0f14210eU, 0x12ed4104U, 0xd1020effU, 0xf101d0e0U, 0x01f23ef0U, 0x11ffe10fU, 0x00dd0f00U, 0x20001f4eU,
+  0x1f0d0ff1U, 0x3de10244U, 0x10010001U, 0x10ed01e2U, 0x10ef1f00U, 0x10e2130eU, 0x0020000eU, 0x001e0c0eU,
+  0xf010101fU, 0xe2ff4223U, 0x0f020ee0U, 0x11f2f1f1U, 0xf2e2fee0U, 0x00dde20fU, 0xf1de101fU, 0x210e0f2fU,
+  0x200e011eU, 0xfe220133U, 0x20ff0ff2U, 0x2d0f01e1U, 0x20ee2000U, 0x0001110fU, 0xf02e110eU, 0xe0300f0fU,
+  0x1d3e034fU, 0xd0f13131U, 0xff110fd2U, 0x30e1030fU, 0xf001cfbfU, 0x00f0f110U, 0x11fe000fU, 0x2f00ff1eU,
+  0x22f0002dU, 0xde300025U, 0x10d100efU, 0x1a1103d2U, 0xf0cd220cU, 0x2022f00eU, 0x00f1200dU, 0xf0200000U,
+  0x2c4df130U, 0xc0f2213fU, 0x1031ffe1U, 0x21e00300U, 0xfd40c0deU, 0x12d00120U, 0x002f0f1fU, 0x00e1311fU,
+  0x11210111U, 0x00de0211U, 0x121e0f10U, 0x0d0f011fU, 0x100e2e01U, 0x10f1ee0eU, 0xf01f1000U, 0x001e0001U,
+  0x2012f40fU, 0xff0010feU, 0xef010000U, 0x1020ffffU, 0xf0142001U, 0x02dffe1dU, 0x11ef0f01U, 0x111f0101U,
+  0x122d0f12U, 0x2fed01f1U, 0x120e0012U, 0xe000010eU, 0x10303000U, 0x30f1e00cU, 0xf0022f0fU, 0xf01d0f02U,
+  0x0011131fU, 0x1100122fU, 0xe1131eefU, 0xf2f1efeeU, 0xe0f40ff0U, 0x11f0df0dU, 0x10d01ff0U, 0x132efe30U,
+  0x132d0010U, 0x300f0223U, 0x110f0201U, 0x2e2103d0U, 0x4032210cU, 0x0001f00eU, 0xf001100cU, 0xe00def00U,
+  0x2d21123fU, 0x10f1133fU, 0x0f130fefU, 0x01f2ffceU, 0xdff20dceU, 0x10e1c10fU, 0x11e0000eU, 0x130ef010U,
+  0x44f001eeU, 0x1f3f0124U, 0x2210020fU, 0x2c0103b1U, 0x20f2110aU, 0xf0f10100U, 0x00220f0aU, 0xf02fd101U,
+  0x4b1e002fU, 0x00012221U, 0x1f32ffe0U, 0x000102efU, 0xee0020ceU, 0x2f01d211U, 0x2e0000ffU, 0x221f0f22U,
+  0x02f000d0U, 0x003f0113U, 0x03f101eeU, 0x1d1003b2U, 0x00d11f0bU, 0x0021e00fU, 0x0010110bU, 0x001fd101U,
+  0x3b2f0021U, 0xf00120f1U, 0x2f42ffefU, 0x13f002e0U, 0xfd1fe0feU, 0x00d1f11fU, 0x1f1f0000U, 0x11131011U,
+  0xf0ff000eU, 0x000f00ffU, 0xf00100e0U, 0x0f0f00ffU, 0x00e0000fU, 0x000df00fU, 0x002cf10fU, 0x00e11f0fU,
+  0x0f0fd10fU, 0x00fffeffU, 0x00f0d000U, 0x00000f00U, 0x1101ff00U, 0xf000f1d1U, 0xf001f0e0U, 0x10e01010U,
+  0x0f0f02fdU, 0x01fd001eU, 0xf00100e1U, 0x1f2e0feeU, 0xf0e1ee0fU, 0x001df10fU, 0x003be00fU, 0x00f11e0eU,
+  0xfe00e0dfU, 0xffe0f0e0U, 0x21e1ee01U, 0xfe121010U, 0x23e2ef00U, 0xe2ffe2e0U, 0xe02201f0U, 0x2ecf0201U,
+  0x0ff1010eU, 0xf1f00e3eU, 0xf1e100d2U, 0x111c0f10U, 0x1000df02U, 0x1030f305U, 0x103cd10eU, 0x10ef2e0fU,
+  0x2f1e31bfU, 0x1fe020c0U, 0x32e0f111U, 0xfc22202fU, 0x4104d10fU, 0x1010d10fU, 0x10240301U, 0x2ceef3f1U,
+  0x10d0012fU, 0xffe1006fU, 0x03e10102U, 0x21ed0021U, 0x001fc002U, 0x1030f004U, 0x104bc00eU, 0xf0e11f0fU,
+  0x5d2032efU, 0x200f13f1U, 0x30000220U, 0x0e011000U, 0x0232c1eeU, 0x0d40a10fU, 0x0233f301U, 0x1deef300U,
+  0x22c10000U, 0x0fe40021U, 0x14f30122U, 0x11ff0020U, 0x100f0004U, 0x001d1f06U, 0x204db00fU, 0x0002f10eU,
+  0x3f3031f1U, 0x41ef53d1U, 0x201043d0U, 0x0f00e000U, 0xff20d0cfU, 0xfd72b11fU, 0x02230121U, 0x1fdff301U,
+  0x000f000eU, 0x0ff000f0U, 0x000100dfU, 0x0e2e00ffU, 0x000e0f0fU, 0x000def0fU, 0x002fe10dU, 0x00e13e0fU,
+  0x0efff000U, 0x1ef0e100U, 0x200eed20U, 0xfe0f0100U, 0x10010000U, 0xff0ef1e0U, 0xdf0001d0U, 0x11d0f010U,
+  0xd011002dU, 0xff010e0cU, 0xee0200efU, 0x104c00cbU, 0xe00eee00U, 0xf0fde00eU, 0xf02ef10dU, 0x00d3ff0fU,
+  0x0d02e0efU, 0x3df103ffU, 0x3000de20U, 0xed120013U, 0x1012e101U, 0x00d302ffU, 0xeffe22ffU, 0x20b0f2d0U,
+  0xe0120ffeU, 0x0e040b0dU, 0xdef10ee0U, 0x320a00ecU, 0xf01fee00U, 0xf00ed102U, 0x00ffd100U, 0x20e3f00fU,
+  0x2b00f2feU, 0x5df011e0U, 0x1ff1e000U, 0xef340114U, 0x2023e000U, 0x2f10031eU, 0xf1e1120fU, 0x20b002d0U,
+  0x21e201feU, 0x10020d20U, 0x1fd10012U, 0x32fc0f00U, 0xf00fef0fU, 0xe02ef20fU, 0xf00ec000U, 0x00d30f02U,
+  0x2c2e1200U, 0x5d0f1320U, 0x3ddff10dU, 0xcf2101f2U, 0xf112e1edU, 0xfd21e400U, 0x0201f111U, 0x2ecef1f1U,
+  0x43c200e0U, 0x1fd50000U, 0x15b10310U, 0x403d0e30U, 0xf00d1200U, 0xd01b1100U, 0x005db00eU, 0x00f50f0fU,
+  0x2e2f11f1U, 0x6dfe13f1U, 0x3efe33efU, 0xd032112fU, 0xe0f0f1ceU, 0xdd33d3e1U, 0xf4e3f2f1U, 0x0ddee012U,
+  0x0101012eU, 0xfee3001fU, 0x01f30fdfU, 0xf06001f0U, 0x0020f10eU, 0x000fee0fU, 0x0031d30eU, 0x00403d0cU,
+  0x1fff21f0U, 0x3eef0110U, 0x3e0ef03fU, 0x3de1c00fU, 0x1011f1d0U, 0xfe2ff2f0U, 0xef2f23e0U, 0x01e61e10U,
+  0xe1010f1fU, 0xef030f0eU, 0xf11f0fffU, 0x002e02efU, 0xe01eef00U, 0xf0feed0eU, 0x1030f300U, 0x0020fc0cU,
+  0x0ed023ffU, 0x3ec013e1U, 0x2f10ee40U, 0xec03d200U, 0x1f21efe1U, 0x0f11f12eU, 0xff2f31f0U, 0x1dd30fc0U,
+  0xd1100011U, 0xf0040d01U, 0xe0000ff0U, 0x103c02d0U, 0xe02f000fU, 0x0000d00eU, 0x004eff01U, 0x10feec0dU,
+  0x1df00320U, 0x40e102f0U, 0x1e01d01fU, 0x0b13e60fU, 0x0113e0e0U, 0x1ef0e200U, 0x001020d1U, 0x2ea710d1U,
+  0x12010f00U, 0x10e30ef3U, 0x11f20f00U, 0x013f01f0U, 0xf0ff020fU, 0xe022f00dU, 0xf04e0001U, 0x00f0ef0eU,
+  0x2d1c0010U, 0x2fef0211U, 0x5cfee20eU, 0xfc10f5f1U, 0xe021f1e0U, 0x01eef2f2U, 0x0011f1ceU, 0x10c3f2e1U,
+  0x30f20d00U, 0x20c60fcfU, 0x07d30000U, 0x124e0120U, 0xf0fff30fU, 0xf00f110cU, 0xf03ee20cU, 0x00f4f10fU,
+  0x3e1b0000U, 0x2cfed2f1U, 0x1d0d032fU, 0xe021233fU, 0xe11fd3fcU, 0x0010d2e2U, 0xf301d2dfU, 0x10e0f302U,
+  0x00f0002fU, 0xfce20021U, 0x0fd20ef1U, 0xe0310001U, 0x10020f0fU, 0x00f1ee0eU, 0x00d3ff0eU, 0xf0302e0dU,
+  0x2fd03221U, 0x40df1201U, 0x4010ff20U, 0x5d02e02fU, 0xef1202ffU, 0x1031e11eU, 0xe00f12f1U, 0x1e145114U,
+  0xef110e00U, 0xdff20e20U, 0x3fe10ff0U, 0xc14000e1U, 0x0000ff00U, 0xf010ef0fU, 0x1012f10cU, 0x104f1100U,
+  0x10cf1222U, 0x13cf03f1U, 0x4e0fe112U, 0x0e11df0dU, 0x0f23e1f0U, 0x1011f010U, 0x001ef211U, 0x0e1340f1U,
+  0xff010d10U, 0xf0f20ef2U, 0x30ff0f01U, 0xe23001e2U, 0x000f0f00U, 0x0030ef0fU, 0x1041010eU, 0x10200300U,
+  0x1ff00431U, 0x25df01d0U, 0x2e0e000fU, 0x0fffd2ffU, 0xe122f1d1U, 0xf0ff0f01U, 0xfffff100U, 0xff133ff0U,
+  0x0e000d0fU, 0x11f40dc1U, 0x32d10ee0U, 0xd02f02ffU, 0x001f2200U, 0xf02f000eU, 0x102f000eU, 0xe0e30f01U,
+  0x2e1e1331U, 0x22ef01e3U, 0x4d0f032fU, 0xd1f00210U, 0xd031d0dfU, 0x01fe1102U, 0xe200eedfU, 0x0f011000U,
+  0x1d100d4fU, 0x11010dcfU, 0x15e00f0fU, 0xe31f0111U, 0x10ff1201U, 0xf0e0000cU, 0x00ff1f0cU, 0x20f1f104U,
+  0x2f1c3160U, 0x100ef1b1U, 0x1efe0210U, 0xd2de1220U, 0xef10d2ddU, 0x12ff0001U, 0xf2e0dfdfU, 0x22e01100U,
+  0xf2e00120U, 0x0ff00221U, 0x31fe0e11U, 0x2f2102d0U, 0x10130f01U, 0x00f2fe0eU, 0x00240f0eU, 0x1012100fU,
+  0x311e2311U, 0x210e0200U, 0x1f221120U, 0x202eff01U, 0xf0132111U, 0x1101f110U, 0x01ef111fU, 0xfe520021U,
+  0x02e30f2eU, 0x01e10112U, 0x53f10002U, 0xfc1100f0U, 0x20130e00U, 0x0001ee0eU, 0x00f30e0cU, 0x10f21f02U,
+  0x410d0521U, 0x31eff2f2U, 0x6d20f20fU, 0x22dcef30U, 0x0023e201U, 0x2100f010U, 0x1fe0f11dU, 0xe1304220U,
+  0x01d10d3eU, 0x10d30ff3U, 0x53f10fd0U, 0xcc010ef0U, 0x3011300fU, 0xf02f0e0fU, 0x20d01e0cU, 0x10f1ff05U,
+  0x501f1451U, 0x30d013e2U, 0x6c20ff0eU, 0x03de0042U, 0xff22d1f2U, 0x212de111U, 0x1efe0f00U, 0xe230311fU,
+  0xfce10e3eU, 0xfd220de1U, 0x22d20fafU, 0xea1101f1U, 0x30105201U, 0x101f1001U, 0x20e02f0eU, 0x10002006U,
+  0x400f1371U, 0x21e1f3f2U, 0x7d31011fU, 0xe1d10221U, 0xe034c1ddU, 0x14320110U, 0x010d0fffU, 0x1101f23fU,
+  0xeaf10e30U, 0xde100e01U, 0x10d10fdfU, 0xfc110103U, 0x20f04001U, 0x00fe2e00U, 0x00ee2e0cU, 0x302f2004U,
+  0x30ff1271U, 0x11110fe0U, 0x5f10f100U, 0xe3b00031U, 0xee62e0fdU, 0x1421101fU, 0x111ef0efU, 0x2f12f11fU,
+  0x100f0000U, 0x1f0e000fU, 0x223f0101U, 0xff2f01feU, 0x00ee0f00U, 0x00f10d0eU, 0x003e2302U, 0x00fe1c0fU,
+  0x00ffef01U, 0x1011ffffU, 0x0030f231U, 0x0fe1c1efU, 0x001fff00U, 0xf0ee2100U, 0xf11201e1U, 0x20f40df0U,
+  0x0000001fU, 0x10ef00f1U, 0x232e02d0U, 0xfd3003cfU, 0x00f00f0fU, 0xd001de0fU, 0x105e0200U, 0x30f11d0dU,
+  0xfffe0100U, 0xff2300dfU, 0x23200021U, 0x2ef2b3a0U, 0x000ff01fU, 0x02cd2110U, 0xe02321d2U, 0x11c7fcf1U,
+  0x00f0012eU, 0x120e010fU, 0x332000b0U, 0xffff02d2U, 0xf0e10f01U, 0xe001c002U, 0x005dd30eU, 0x20e11d0aU,
+  0xdf01111eU, 0xed33ef00U, 0x220e3202U, 0x2df2f3e1U, 0x00edd11fU, 0x24be312fU, 0x002423e3U, 0x10a6dee0U,
+  0xfeef012eU, 0x12fc0120U, 0x243100e1U, 0x2dd2021fU, 0x00ff0e01U, 0xe001e102U, 0x104dd10dU, 0x10d11e0dU,
+  0xc0f1f12fU, 0xdf21de10U, 0x21102012U, 0x3ce11310U, 0x00ffe2f0U, 0x22be300eU, 0xff1401f3U, 0x22a4beefU,
+  0xdee00030U, 0x031d012fU, 0x14220112U, 0x2de20ff0U, 0x001d1101U, 0x0011e100U, 0x100dd00cU, 0x1000200fU,
+  0x00f2ef10U, 0xc0120010U, 0x30201ff1U, 0x3ef003e0U, 0x110ed0ffU, 0x02be22feU, 0x1f241023U, 0x21c3d0eeU,
+  0x0e00001fU, 0x000001f1U, 0x3431020fU, 0xe13f02e0U, 0x00020e00U, 0xf020fc0dU, 0x0079030fU, 0x002ffc00U,
+  0xf0f00f0fU, 0xff0121f0U, 0x3020ae10U, 0x3eefe0ceU, 0x10fff0f0U, 0xe2c011e0U, 0xdf3430d1U, 0x1f231d21U,
+  0x0fd00010U, 0x20ff0001U, 0xf15f02dfU, 0xc23001e1U, 0xf0031f0eU, 0xd010e00eU, 0x104af10eU, 0xf03e0e0eU,
+  0xd0012d1eU, 0xdd2320f0U, 0x63f0b300U, 0x3d01d3cdU, 0x02feeff0U, 0xf3bf1100U, 0xef2110e1U, 0x1f242a21U,
+  0x10e0012fU, 0x20fd0000U, 0x002f00c0U, 0xd12203f3U, 0xf0f40d00U, 0x0002d100U, 0x003dd000U, 0xe02e1c0cU,
+  0xe002201eU, 0xcc231001U, 0x11fd05efU, 0x3d32e3ecU, 0x01efefffU, 0x24be0011U, 0x1113e0e1U, 0x0ef41c0dU,
+  0x00d0011fU, 0x111f0011U, 0x02f001dfU, 0x20e401b0U, 0x00e21f01U, 0xf0f2e001U, 0xf01dd10eU, 0x00fe0a0eU,
+  0xfff31f0fU, 0xbd03ff01U, 0x0e0b01e0U, 0x2e10e3fdU, 0x01ede0ffU, 0x32ec0f2fU, 0x002200f2U, 0xffe3ff0eU,
+  0xfdff0f2fU, 0xe20d0f0eU, 0x14f202c1U, 0x1ee300d1U, 0x00e23001U, 0x00140001U, 0x001ff10dU, 0x10ed000cU,
+  0xf0f31d10U, 0xa0022f00U, 0x1f2d00f0U, 0x4e10f3deU, 0x1d0de10eU, 0x14fb111fU, 0x1122f122U, 0x12d41feeU,
+  0x0ff00f22U, 0xf00f01f2U, 0x14010dfeU, 0xceff02f1U, 0x00c31e01U, 0xf02ffe00U, 0xf050e700U, 0x10de0f02U,
+  0xf0105e00U, 0xddf2f100U, 0x301fcc2eU, 0x100ef3dfU, 0x00dd0110U, 0x02a0e111U, 0xdd4c31f3U, 0x1151df21U,
+  0x1ef0000fU, 0xf1de0102U, 0x12200ffcU, 0xc1f102f0U, 0xf0e4200fU, 0xf0f1ff0eU, 0xd05ee203U, 0xf0000f02U,
+  0xd0103e00U, 0xcd1400e1U, 0x1f11ce0eU, 0x00ff00deU, 0x02cee02fU, 0x03b0f002U, 0x0e4f01f3U, 0x026fdf10U,
+  0x00f00f1eU, 0x3ff00010U, 0x01e10edbU, 0xd4e201f3U, 0x00052100U, 0x00f11f01U, 0xd04ce304U, 0xb011f002U,
+  0xef022d01U, 0xcc031011U, 0x1f0feffeU, 0x0f010ccdU, 0x02eee01fU, 0x22fe0000U, 0x011201f1U, 0xf21c0d2fU,
+  0xe1000e1dU, 0x00ff0112U, 0x14c001dcU, 0xf2d20fe2U, 0x00f22000U, 0x30e01001U, 0xc00f0302U, 0xd001f001U,
+  0xe1122f01U, 0xf1121f10U, 0x1e1dee0fU, 0x0101eeedU, 0x0efac000U, 0x311ce03fU, 0x022f011eU, 0xf1fc2d10U,
+  0x0f3d0d3fU, 0xf2ce0f11U, 0x15cf03ddU, 0x200203a0U, 0xe0e2200eU, 0x10203101U, 0x00de1200U, 0x10eef30fU,
+  0xf2021e00U, 0xe1125f12U, 0xfd2dd020U, 0x3f1cffddU, 0x0afd0000U, 0x3219d14dU, 0x0230de2fU, 0x01d11f20U,
+  0x0e010225U, 0xe00100ffU, 0x2de10effU, 0xfddb030fU, 0x10c22e01U, 0xd0200f01U, 0xf0fff40eU, 0x30d0ff0fU,
+  0xff003101U, 0xde11dff1U, 0x2f2ddf21U, 0x001fd3e0U, 0x13e0f12fU, 0x20dff210U, 0xe04df3ffU, 0x11e1dc1eU,
+  0x2df00342U, 0x120d0101U, 0x4ee10f0fU, 0x23bc010fU, 0xf0c22e0dU, 0xe0111e00U, 0xf02de60fU, 0x4000ff0eU,
+  0xef0122f2U, 0xed20eee3U, 0x3f1efe11U, 0x0f10f2efU, 0xf2d1d010U, 0x1fd0f130U, 0x006fd3f0U, 0x32d0df00U,
+  0x1d1f013fU, 0x111e0120U, 0x3fdf00edU, 0x21d00000U, 0x00b1110dU, 0xf0103f00U, 0xd00e040fU, 0x30f01d00U,
+  0x00111312U, 0x0e201e02U, 0x0e1f0d22U, 0x00f2f02eU, 0x0012e210U, 0x2e00e12fU, 0xfe4fc421U, 0x120dd03fU,
+  0xfd200e30U, 0xff0c0020U, 0x2fb000fdU, 0x100200e0U, 0x30d11f0cU, 0x10f03e01U, 0xf00f3201U, 0x100d2f00U,
+  0x0f021221U, 0x01301e10U, 0x0f1ff021U, 0x21f0f120U, 0x0f02f30fU, 0x3ffcd22dU, 0xf12fd12eU, 0x131dc01dU,
+  0xee310f12U, 0x01b10e0fU, 0x1fcf01fdU, 0xf0f100cdU, 0x0003000dU, 0x00215f01U, 0x00fe2f0cU, 0xf0fe100eU,
+  0xf004002fU, 0x10423c22U, 0x3f1fe041U, 0x000ef000U, 0x1df01111U, 0x2e29f03dU, 0x0f31eeedU, 0xf32edfffU,
+  0xe24d0513U, 0xf02f0ee1U, 0x1be00eefU, 0x0fff014eU, 0x10932c02U, 0xf01f1201U, 0x0020000cU, 0xf00df10dU,
+  0x0f03130fU, 0xef22d0e0U, 0x0001df00U, 0x0f0de3f0U, 0x31053f21U, 0x10001000U, 0xf00fd1feU, 0x02def1e0U,
+  0xdf1e0532U, 0x0f1f0001U, 0x2fe00010U, 0x24ec01feU, 0xf0c31b02U, 0xf0fe3001U, 0x10d0f00bU, 0x103dc00cU,
+  0x0e131301U, 0xe030eee2U, 0x4c00c011U, 0xfef0e4efU, 0x2f042f3fU, 0x0eef113eU, 0x20f0c42eU, 0x10b0d0e1U,
+  0xfe2e0441U, 0x1120020dU, 0x3db001feU, 0x63ef0edeU, 0x10020d01U, 0xf00f3e01U, 0x30ef210bU, 0x003cf00dU,
+  0x20110401U, 0xf142ed11U, 0x3c21ff21U, 0x1ee3020fU, 0x1ff53f10U, 0x1c0ff110U, 0x1e20b010U, 0x21dfd100U,
+  0xf0310322U, 0x11f0010bU, 0x1da100eeU, 0x50f00ddeU, 0x30e5fe0fU, 0xf0113e0fU, 0x000f410bU, 0x003d020cU,
+  0x20ff130fU, 0x0133fb20U, 0x4d42fe40U, 0x2ee2f110U, 0x1ef450f0U, 0x3c0b1100U, 0x1f3def00U, 0x10f1e0f1U,
+  0xcf310202U, 0x03d10fefU, 0x2cc10fefU, 0x1f1f0effU, 0x00e5ff03U, 0x0030420dU, 0x000e400cU, 0x00ff1f0fU,
+  0x2001110eU, 0x1e310e21U, 0x5e40f021U, 0x0fe00000U, 0x1e023010U, 0x2d1b1f2fU, 0x0d2efffdU, 0xf101f0ffU,
+  0x1001001fU, 0x02010000U, 0x221f0010U, 0xe0e1005eU, 0x0011110fU, 0x001fff00U, 0x00100301U, 0x00212202U,
+  0x0010fe20U, 0x0003030fU, 0x002020f2U, 0xf002113fU, 0x00000010U, 0xf1f001f0U, 0xf03e1011U, 0x30fee020U,
+  0x1f130200U, 0x03ee0020U, 0x121d0f1fU, 0x12ff0f5fU, 0x003f230fU, 0xf01fef0eU, 0xf00f0203U, 0xf0f24102U,
+  0x100ef021U, 0xfe1413ffU, 0xf1212111U, 0x00022f1fU, 0x00010e10U, 0x04e001e0U, 0x111d0200U, 0x321ede1fU,
+  0x2f3301f1U, 0x02dd0040U, 0x243d0e3eU, 0x300f0f5fU, 0xf020120fU, 0xf020cf02U, 0xe0203201U, 0x00d26003U,
+  0x010e0e21U, 0xee0323ffU, 0xe1021012U, 0x00000ee0U, 0xf1020f01U, 0x15def1e0U, 0x112e0101U, 0x310dfe0eU,
+  0x113201e1U, 0xd2cb0041U, 0x224e0f1fU, 0x2fff001fU, 0x002f020fU, 0x1000b004U, 0xe0113102U, 0xf0e24104U,
+  0x011c0000U, 0xce21121fU, 0xd1f10f01U, 0x01ff20ffU, 0xf1110ff2U, 0x13ee0ef0U, 0x1e2f0031U, 0x000d1efcU,
+  0x223f01f0U, 0xc4dd001fU, 0x2020000fU, 0x1eee001fU, 0xf0e10e00U, 0x1000d005U, 0xe0001101U, 0xe0d32003U,
+  0x103d1100U, 0xb22132f0U, 0xf100ff11U, 0xf0010effU, 0xf022ef12U, 0xf1ee00e1U, 0x1e100010U, 0x0b2d1d0eU,
+  0x0001003eU, 0x02e1001eU, 0x22f0000fU, 0x101e0f3fU, 0xf0f42101U, 0x0011e200U, 0x00de0301U, 0x00e04203U,
+  0x02212e40U, 0xff02111fU, 0x012010f1U, 0xe11300f2U, 0x0efe1111U, 0xf2f1e4e1U, 0x101d0f10U, 0x321fef3fU,
+  0x2f130020U, 0x10de0e2fU, 0x31000f0fU, 0x210f0f51U, 0x00d21202U, 0xf0121102U, 0x00e01302U, 0x00e15202U,
+  0x041f0f10U, 0xfcf23000U, 0xf1001ff3U, 0xbe0020e2U, 0xffd10101U, 0x03f0d3f0U, 0x1f2dd01fU, 0x221fd110U,
+  0x2f230ee0U, 0x0ffd0e2fU, 0x203e0dfeU, 0x2003014fU, 0x20e1f200U, 0xe0131202U, 0xf0f02201U, 0x20e03201U,
+  0xf3fff010U, 0x1ce13e0fU, 0x0e000df1U, 0xff1f02f0U, 0xffe001f1U, 0x1f4ed0f1U, 0x1d2ee010U, 0x0110b310U,
+  0x1f510f1fU, 0x01fd0031U, 0x103e0e00U, 0x11000e10U, 0x3001f20eU, 0x00ff1202U, 0xf0e10100U, 0x4000100fU,
+  0xf11d0010U, 0x0f012f00U, 0x0f1f1f01U, 0x1f3311ffU, 0xff21f1e2U, 0x104ddf0eU, 0x2e30f101U, 0xff00f20eU,
+  0x024002feU, 0xb6fe000fU, 0x104f012fU, 0x012d0f0fU, 0x0002f101U, 0x000e1004U, 0xf0010000U, 0x00f3f000U,
+  0x001b2220U, 0xd2e22103U, 0x0f1f0f10U, 0xff3200f0U, 0xf144c2f0U, 0x022be1efU, 0x0f31e111U, 0xede012e1U,
+  0x2f02012fU, 0x20f10efdU, 0x4f000dffU, 0x2e0c0011U, 0x10fd2002U, 0x00e1f700U, 0x00d10400U, 0x000c3000U,
+  0xe1211040U, 0x1fed4222U, 0x021f2ff3U, 0xd002c1f2U, 0xf2e101f0U, 0x213f03f1U, 0xfffde0ffU, 0x51e2ed10U,
+  0x2df40014U, 0x5f000e00U, 0x10200e0fU, 0x2fef0112U, 0x20ec0000U, 0x00f22502U, 0x00e0150fU, 0x20fe110dU,
+  0x0300f12fU, 0x3c0e4012U, 0x100f2fe4U, 0xe01104f1U, 0xd01210ffU, 0x014fe321U, 0x0e0ff1efU, 0x1f01ee0fU,
+  0x1c100003U, 0x40210f2fU, 0x101001f1U, 0x0e1e0240U, 0x40ef020fU, 0xe0e23302U, 0xe0e1f300U, 0x30ce0f0eU,
+  0x00ce1f30U, 0x4c111e1fU, 0x001f2ec2U, 0x00112430U, 0xdd2010eeU, 0x0e3e0100U, 0x0c11f2f0U, 0xe122f0e0U,
+  0x0efe0f4fU, 0x122f01f1U, 0x10010210U, 0x0e010f21U, 0x40f03300U, 0x00d04f0eU, 0xe0e2f10fU, 0x4000ee0eU,
+  0x1eef3350U, 0x0f10ee01U, 0x1f2e11f0U, 0x3201450fU, 0xee21e0cfU, 0x1d210fe0U, 0x0e21e1f0U, 0xd10422e3U,
+  0x00ee010fU, 0x020100d0U, 0x2122011fU, 0xf02e0ee3U, 0xf0e14101U, 0xf0ff2e0dU, 0x00f3f10fU, 0x4002ff0dU,
+  0x2cfd5520U, 0x21e3eff3U, 0x1e2d323fU, 0x200002efU, 0xfe63a1ddU, 0x1d20e0f2U, 0xf032d1f1U, 0xefb331f3U,
+  0x23100300U, 0x22ff00e0U, 0x4cf100f1U, 0x1f1b0100U, 0x000b2101U, 0x10e31100U, 0x2001f001U, 0x000c1e00U,
+  0xf202c0f1U, 0x001e1302U, 0x010f1210U, 0xcf03c001U, 0x01d21cd2U, 0x1120ef11U, 0xffffd00dU, 0x2fd10cf1U,
+  0x2fef00f0U, 0x20100f11U, 0xfc0f0ff0U, 0x10f90301U, 0x201c0101U, 0xf0d21101U, 0x0020e001U, 0x300dfe0dU,
+  0xf2f0e10fU, 0xf11f23e0U, 0xe0f02100U, 0xed12e3ffU, 0xeef20dd1U, 0x1f10ee21U, 0x01f1f0ffU, 0x2ed10c1dU,
+  0x40ee00fdU, 0x100d0210U, 0xf0fe0011U, 0x121c0403U, 0x300fe30dU, 0xf091fe00U, 0xf002ef02U, 0x201e0e0dU,
+  0x40eef010U, 0xd1ff20efU, 0xefff41feU, 0xee0204fdU, 0xddf4fdcdU, 0x1f110d12U, 0x0101110eU, 0x1e020effU,
+  0x41de0fdfU, 0xf20e00e0U, 0x01ff0110U, 0xf22f0404U, 0x30ef110cU, 0x20b21f0eU, 0x20e2e101U, 0x40e1e00dU,
+  0x4d0d022fU, 0xf00020cfU, 0xff1d3220U, 0x0ff0240eU, 0xec21eecdU, 0x1c0230f2U, 0xf21101feU, 0xfbf421e1U,
+  0x31d20fa0U, 0x11ff00deU, 0x02000111U, 0x111001f0U, 0x10d0120aU, 0x00d2200aU, 0x30e2f100U, 0x30e2a20cU,
+  0x7e1d02c0U, 0x1f120fc0U, 0x1e1d334fU, 0x210df1bdU, 0x0b43efeeU, 0x2bff0f00U, 0x0112e0ffU, 0xffa141f2U,
+  0x052d0f10U, 0x1f0d01f2U, 0x09f002f1U, 0xe1fe0e4dU, 0x001e100fU, 0x00e21e00U, 0x10f1fd00U, 0xf01f1302U,
+  0xeff1ff11U, 0xf100f300U, 0x2001f310U, 0xde030e1fU, 0x00d11fd2U, 0x3ef2ed12U, 0x1ff3ff0fU, 0x1fff1ff1U,
+  0xf41c01ffU, 0x020d0103U, 0xfce00f01U, 0x031d0e00U, 0x00200e0eU, 0x00f01e01U, 0x3010fe01U, 0x10ef110fU,
+  0xd0410e10U, 0xb22014feU, 0xf101042eU, 0x0c44f0feU, 0xfed121c3U, 0x30f3dd23U, 0x0001d00fU, 0x2fe01e11U,
+  0x262e01edU, 0xf22c0023U, 0xfffd0f11U, 0x155f0ee2U, 0x1032df0bU, 0x00d1e002U, 0x30100f01U, 0x50d1e00cU,
+  0x0e40ffefU, 0xc31003ffU, 0xe0e0133eU, 0xfb3410edU, 0x0cd22fe1U, 0x1fe3ee12U, 0x01020f00U, 0x1be12ff0U,
+  0x470f02edU, 0x151d001fU, 0x00fe0010U, 0x261f00e1U, 0x20f2cd09U, 0x20e2c00fU, 0x20000101U, 0x20b1af0cU,
+  0x3d3fffd0U, 0xf12f0fd0U, 0x1e1e133fU, 0x1c301fedU, 0x0a0130e0U, 0x0dc12002U, 0x0112001fU, 0x2ce020f0U,
+  0x14e101dfU, 0x330f011fU, 0x01000111U, 0x67ff00ffU, 0x10d1d10aU, 0x00e0d00cU, 0x10f10101U, 0xf0c0bd0cU,
+  0x2d3f00c0U, 0x0e2010deU, 0x0f0f1110U, 0x0a3e11ddU, 0x1df11000U, 0x1dc01011U, 0x00f2f00eU, 0x01bf10f1U,
+};
+
+const int32_t kernel_gemm_5_int4_bias[128] = {
+  6437, -437174592, -7885, 3207, -324542528, -5584, 3807, 5875,
+  -319979712, -273973216, -626039360, -7043, -732, -19156, -9821, -455974176,
+  -194379200, 9116, 16689, -108852208, -13997, -13967, -14101, -13234,
+  498, -16372, -6863, -15101, -3082, -10360, -10874, -378514848,
+  -6455, -717486592, -2728, -2330, 2819, -1596, -16004, -3518,
+  -283391424, -4750, 3331, -13596, -642616896, -10082, -129578064, -7103,
+  -6812, -9128, -6223, 6850, -9439, -379856256, -283280480, 2438,
+  -5205, -10713, 974, -394022560, 6397, -10768, -421, -10742,
+  -2815, 7124, -10446, -327608384, 1114, 8538, -16073, -228913728,
+  6255, 2296, -191756240, 1852, -4529, -20060, 2010, -7394,
+  2628, 9964, -15, -206542752, 3682, -8294, -2882, -414,
+  -559931328, 6983, -17143, -11613, -10106, -4476, -7689, -9062,
+  -2608, -12415, -3454, -7450, 2255, -1587, 3554, -727982656,
+  -249997584, -5698, -1468, -113252680, -9227, -146822576, -176437504, 275,
+  1793, -770, 2241, 5137, -5064, -2445, -8523, -3107,
+  -3114, -3347, 318, 14146, -21794, -10173, -7762, -18102,
+};
+
+const float kernel_gemm_5_int4_step[128] = {
+  1.814285714e+01f, 1.600000000e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.600000000e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.600000000e+01f, 1.600000000e+01f, 1.600000000e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.600000000e+01f,
+  1.600000000e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.600000000e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.600000000e+01f,
+  1.814285714e+01f, 1.600000000e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.600000000e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.600000000e+01f, 1.814285714e+01f, 1.600000000e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.600000000e+01f, 1.600000000e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.600000000e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.600000000e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.600000000e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.600000000e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.600000000e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.600000000e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.600000000e+01f,
+  1.600000000e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.600000000e+01f,
+  1.814285714e+01f, 1.600000000e+01f, 1.600000000e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+  1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f, 1.814285714e+01f,
+};
+#endif
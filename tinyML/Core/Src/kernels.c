@@ -0,0 +1,1711 @@
+/**
+  ******************************************************************************
+  * @file           : kernels.c
+  * @brief          : Hand-written int8 kernels in place of X-CUBE-AI layers
+  ******************************************************************************
+  */
+
+#include "kernels.h"
+#include "models.h"
+
+#if KERNEL_ANY
+#include <math.h>
+#include <string.h>
+#include "main.h"
+#include "profile.h"
+#include "kernel_weights.h"
+#include "ai_layer_custom_interface.h"
+#include "layers_conv2d.h"
+#include "layers_dense.h"
+#include "layers_nl.h"
+#include "layers_pool.h"
+
+#define KERNEL_ZP               (-128)  // input and output zero point of the layers here
+
+#if APP_KERNEL_PER_TENSOR
+// One requantisation per layer: entry 0 of a table serves every channel
+#define KERNEL_QUANT_CH(c)      ((void)(c), 0U)
+#define KERNEL_QUANT_N(n)       1U
+#else
+#define KERNEL_QUANT_CH(c)      (c)
+#define KERNEL_QUANT_N(n)       (n)
+#endif
+
+// A library layer a kernel can take over
+typedef struct {
+  node_func lib;                        // forward the layer must have
+  node_func kernel;
+  int (*match)(ai_node *node);          // exact fit, also derives the requantisation
+  uint16_t out_size;                    // output bytes, for KERNEL_BENCH
+  ai_node *node;                        // layer of the bound network on the kernel
+} KernelSlot_t;
+#endif /* KERNEL_ANY */
+
+#if APP_KERNEL_CONV || APP_KERNEL_DENSE
+/**
+  * @brief Fixed-point form of a requantisation scale, for Kernel_Requant
+  */
+static void Kernel_Multiplier(float scale, int32_t *mult, uint8_t *shift)
+{
+  int exp;
+  float m = frexpf(scale, &exp);
+  int64_t q = (int64_t)lrintf(m * 2147483648.0f);
+
+  if (q == (1LL << 31))
+  {
+    q >>= 1;
+    exp++;
+  }
+  // acc * m * 2^exp = acc * q / 2^(31 - exp); a pruned channel's scale
+  // underflows to a shift past 62 and contributes 0
+  *mult = (int32_t)q;
+  *shift = (uint8_t)((exp > 30) ? 1 : (exp < -31) ? 62 : 31 - exp);
+}
+
+/**
+  * @brief Requantise an accumulator to int8, ReLU included
+  */
+static int8_t Kernel_Requant(int32_t acc, int32_t mult, uint32_t shift)
+{
+  int32_t v = (int32_t)(((int64_t)acc * mult + (1LL << (shift - 1))) >> shift) + KERNEL_ZP;
+
+  // Clamping at the zero point is the fused ReLU
+  if (v < KERNEL_ZP) return (int8_t)KERNEL_ZP;
+  if (v > 127) return 127;
+  return (int8_t)v;
+}
+
+/**
+  * @brief Expand n int8 activations (n % 4 == 0) to int16 with the input offset applied
+  * @note  Stored in SXTB16 order, (x0, x2), (x1, x3) per 4 values, to line
+  *        up with weights unpacked by __SXTB16 and __SXTB16(__ROR(w, 8))
+  */
+static uint32_t *Kernel_Expand(uint32_t *col, const uint8_t *in, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i += 4)
+  {
+    // x - zp is x + 128, which is x ^ 0x80 read as uint8
+    uint32_t v = __UNALIGNED_UINT32_READ(&in[i]) ^ 0x80808080U;
+    *col++ = __UXTB16(v);
+    *col++ = __UXTB16(__ROR(v, 8));
+  }
+  return col;
+}
+
+/**
+  * @brief Tensor shape entry, 0 if the tensor is missing
+  */
+static uint32_t Kernel_Dim(const ai_tensor *t, ai_u16 pos)
+{
+  return t ? (uint32_t)ai_tensor_get_shape(t, pos) : 0;
+}
+
+/**
+  * @brief Check scratch0 of a layer holds size bytes, word aligned
+  */
+static int Kernel_Scratch(ai_node *node, uint32_t size)
+{
+  ai_tensor *scratch = GET_TENSOR_SCRATCH(node->tensors, 0);
+
+  return scratch && ai_tensor_get_data_byte_size(scratch) >= size &&
+         !((uint32_t)ai_tensor_get_data(scratch).handle & 3U);
+}
+
+/**
+  * @brief Per output channel requantisation of a layer with activations at
+  *        zero point KERNEL_ZP and symmetric per-channel or per-tensor weights
+  * @note  With APP_KERNEL_PER_TENSOR only mult[0] and shift[0] are written,
+  *        and every channel must come out at the same multiplier
+  * @retval 0 if the layer is quantised any other way
+  */
+static int Kernel_Quant(ai_tensor *in, ai_tensor *out, ai_tensor *weights, uint32_t channels,
+                        int32_t *mult, uint8_t *shift)
+{
+  ai_tensor_intq_info qin, qout, qw;
+
+  if (!ai_tensor_has_intq(in) || !ai_tensor_has_intq(out) || !ai_tensor_has_intq(weights))
+  {
+    return 0;
+  }
+
+  qin = ai_tensor_get_intq(in);
+  qout = ai_tensor_get_intq(out);
+  qw = ai_tensor_get_intq(weights);
+  if (qin.zeropoint_s8[0] != KERNEL_ZP || qout.zeropoint_s8[0] != KERNEL_ZP ||
+      (qw.size != channels && qw.size != 1U))
+  {
+    return 0;
+  }
+
+  for (uint32_t c = 0; c < channels; c++)
+  {
+    uint32_t q = (qw.size == 1U) ? 0U : c;
+    int32_t m;
+    uint8_t sh;
+
+    if (qw.zeropoint_s8[q] != 0)
+    {
+      return 0;
+    }
+    Kernel_Multiplier(qin.scale[0] * qw.scale[q] / qout.scale[0], &m, &sh);
+#if APP_KERNEL_PER_TENSOR
+    // Every channel reads entry 0 and must agree with it
+    if (c > 0 && (m != mult[0] || sh != shift[0]))
+    {
+      return 0;
+    }
+#endif
+    mult[KERNEL_QUANT_CH(c)] = m;
+    shift[KERNEL_QUANT_CH(c)] = sh;
+  }
+  return 1;
+}
+#endif /* APP_KERNEL_CONV || APP_KERNEL_DENSE */
+
+#if APP_KERNEL_INCREMENTAL
+// Last input of a conv layer and the output computed from it
+typedef struct {
+  uint8_t *in;
+  int8_t *out;
+  uint8_t valid;                        // cleared on bind and for KERNEL_BENCH
+} KernelCache_t;
+
+// Pooled output tiles to recompute, inclusive
+typedef struct {
+  uint32_t x0, x1, y0, y1;
+} KernelTiles_t;
+
+#if APP_STREAM
+static uint8_t stream_on;               // an image is being fed by Kernel_StreamRows
+#endif
+
+/**
+  * @brief Compare a w x w x c HWC input with the cached one and bring the cache up to date
+  * @param pooled output width of the 3x3 valid conv + 2x2/2 max pool
+  * @param tiles pooled tiles whose 4x4 input window holds a changed pixel
+  * @retval 0 if no tile needs recomputing
+  */
+static int Kernel_Dirty(KernelCache_t *cache, const uint8_t *in, uint32_t w, uint32_t c,
+                        uint32_t pooled, KernelTiles_t *tiles)
+{
+  uint32_t row = w * c;
+  uint32_t x0 = w, x1 = 0, y0 = w, y1 = 0;
+
+#if APP_STREAM
+  // A run in between leaves a streamed image half in the caches
+  stream_on = 0;
+#endif
+  if (!cache->valid)
+  {
+    memcpy(cache->in, in, w * row);
+    cache->valid = 1;
+    tiles->x0 = tiles->y0 = 0;
+    tiles->x1 = tiles->y1 = pooled - 1;
+    return 1;
+  }
+
+  for (uint32_t y = 0; y < w; y++)
+  {
+    if (!memcmp(&cache->in[y * row], &in[y * row], row))
+    {
+      continue;
+    }
+    for (uint32_t x = 0; x < w; x++)
+    {
+      if (memcmp(&cache->in[y * row + x * c], &in[y * row + x * c], c))
+      {
+        if (x < x0) x0 = x;
+        if (x > x1) x1 = x;
+      }
+    }
+    if (y < y0) y0 = y;
+    y1 = y;
+    memcpy(&cache->in[y * row], &in[y * row], row);
+  }
+  if (y0 == w)
+  {
+    return 0;
+  }
+
+  // Pooled tile p reads input rows and columns 2p .. 2p+3
+  tiles->x0 = (x0 < 3) ? 0 : (x0 - 2) / 2;
+  tiles->y0 = (y0 < 3) ? 0 : (y0 - 2) / 2;
+  tiles->x1 = (x1 / 2 < pooled) ? x1 / 2 : pooled - 1;
+  tiles->y1 = (y1 / 2 < pooled) ? y1 / 2 : pooled - 1;
+  // Only a row or column the pooling drops changed
+  return tiles->x0 <= tiles->x1 && tiles->y0 <= tiles->y1;
+}
+#endif /* APP_KERNEL_INCREMENTAL */
+
+#if APP_KERNEL_CONV
+/**
+  * @brief Check a conv layer is a 3x3 stride 1 conv with ReLU and 2x2/2 int8 max pool
+  */
+static int Conv_Params(ai_node *node)
+{
+  const ai_layer_conv2d_nl_pool *l = (const ai_layer_conv2d_nl_pool *)node;
+
+  return l->groups == 1 && l->pool_func == AI_HANDLE_PTR(pool_func_mp_array_integer_INT8) &&
+         l->filter_stride.data[0] == 1 && l->filter_stride.data[1] == 1 &&
+         l->dilation.data[0] == 1 && l->dilation.data[1] == 1 &&
+         l->pool_size.data[0] == 2 && l->pool_size.data[1] == 2 &&
+         l->pool_stride.data[0] == 2 && l->pool_stride.data[1] == 2;
+}
+
+/* Conv ----------------------------------------------------------------------*/
+#define CONV_IN_W               13U
+#define CONV_IN_C               16U
+#define CONV_K                  3U
+#define CONV_OUT_C              32U
+#define CONV_POOL_W             5U     // floor(11 / 2): conv column and row 10 are dropped
+#define CONV_PATCH              (CONV_K * CONV_K * CONV_IN_C)
+#define CONV_PATCH_WORDS        (CONV_PATCH / 2U)
+// One pooled row needs two conv rows of 2 * CONV_POOL_W patches as int16
+#define CONV_COLS               (2U * 2U * CONV_POOL_W)
+#define CONV_COL_BYTES          (CONV_COLS * CONV_PATCH * 2U)
+#define CONV_OUT_SIZE           (CONV_POOL_W * CONV_POOL_W * CONV_OUT_C)
+
+static int32_t conv_mult[KERNEL_QUANT_N(CONV_OUT_C)];
+static uint8_t conv_shift[KERNEL_QUANT_N(CONV_OUT_C)];
+#if APP_CONV_DIRECT
+// The four patches of one pool window, read from the input in place
+static uint32_t conv_col[4 * CONV_PATCH_WORDS] __attribute__((section(".noinit")));
+#endif
+#if APP_KERNEL_INCREMENTAL
+static uint8_t conv_in[CONV_IN_W * CONV_IN_W * CONV_IN_C];
+static int8_t conv_out[CONV_OUT_SIZE];
+static KernelCache_t conv_cache = { conv_in, conv_out, 0 };
+#endif
+
+/**
+  * @brief Expand one 3x3x16 patch of an in_w wide input for Conv_Forward
+  */
+static void Conv_Im2col(uint32_t *col, const uint8_t *in, uint32_t in_w)
+{
+  for (uint32_t ky = 0; ky < CONV_K; ky++)
+  {
+    // The 3 taps of a kernel row are 48 contiguous bytes in HWC
+    col = Kernel_Expand(col, &in[ky * in_w * CONV_IN_C], CONV_K * CONV_IN_C);
+  }
+}
+
+/**
+  * @brief Requantised output of one channel over a 2x2 pool window
+  * @param w the channel's weights, OHWI, 144 B
+  * @param c0 top left patch, c0 + CONV_PATCH_WORDS top right; c2 and
+  *        c2 + CONV_PATCH_WORDS the bottom row
+  */
+static int8_t Conv_Pool(const int8_t *w, int32_t bias, uint32_t c, const uint32_t *c0, const uint32_t *c2)
+{
+  // The four patches share every weight load
+  const uint32_t *c1 = c0 + CONV_PATCH_WORDS;
+  const uint32_t *c3 = c2 + CONV_PATCH_WORDS;
+  int32_t a0 = bias, a1 = bias, a2 = bias, a3 = bias;
+
+  for (uint32_t i = 0; i < CONV_PATCH_WORDS; i += 2)
+  {
+    uint32_t wv = __UNALIGNED_UINT32_READ(&w[i * 2]);
+    uint32_t w02 = __SXTB16(wv);
+    uint32_t w13 = __SXTB16(__ROR(wv, 8));
+    a0 = (int32_t)__SMLAD(w02, c0[i], (uint32_t)a0);
+    a0 = (int32_t)__SMLAD(w13, c0[i + 1], (uint32_t)a0);
+    a1 = (int32_t)__SMLAD(w02, c1[i], (uint32_t)a1);
+    a1 = (int32_t)__SMLAD(w13, c1[i + 1], (uint32_t)a1);
+    a2 = (int32_t)__SMLAD(w02, c2[i], (uint32_t)a2);
+    a2 = (int32_t)__SMLAD(w13, c2[i + 1], (uint32_t)a2);
+    a3 = (int32_t)__SMLAD(w02, c3[i], (uint32_t)a3);
+    a3 = (int32_t)__SMLAD(w13, c3[i + 1], (uint32_t)a3);
+  }
+
+  // Requantisation is monotonic: pool the accumulators, requantise once
+  if (a1 > a0) a0 = a1;
+  if (a3 > a2) a2 = a3;
+  if (a2 > a0) a0 = a2;
+  return Kernel_Requant(a0, conv_mult[KERNEL_QUANT_CH(c)], conv_shift[KERNEL_QUANT_CH(c)]);
+}
+
+#if APP_CONV_DIRECT
+/**
+  * @brief Pooled tiles [py0, py1] x [px0, px1] of conv2d_2, one pool window at a time
+  * @param in_w input columns, out_w pooled output columns: CONV_IN_W and
+  *        CONV_POOL_W but for a strip (Kernel_Strip)
+  * @note  The input is read in place, only the window's four patches are
+  *        expanded (conv_col): the layer's scratch is never touched. Called
+  *        on the arena the output overlaps the start of the input; tile
+  *        (py, px) only overwrites input that later tiles no longer read
+  */
+static void Conv_Tiles(ai_layer *layer, const uint8_t *in, uint32_t in_w, int8_t *out, uint32_t out_w,
+                       uint32_t py0, uint32_t py1, uint32_t px0, uint32_t px1)
+{
+  const int8_t *weights = ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 0)).s8;
+  const int32_t *bias = ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 1)).s32;
+
+  for (uint32_t py = py0; py <= py1; py++)
+  {
+    for (uint32_t px = px0; px <= px1; px++)
+    {
+      // Patch p at conv row 2py + p / 2, column 2px + p % 2
+      for (uint32_t p = 0; p < 4; p++)
+      {
+        Conv_Im2col(&conv_col[p * CONV_PATCH_WORDS],
+                    &in[((2 * py + (p >> 1)) * in_w + 2 * px + (p & 1)) * CONV_IN_C], in_w);
+      }
+      for (uint32_t c = 0; c < CONV_OUT_C; c++)
+      {
+        out[(py * out_w + px) * CONV_OUT_C + c] =
+          Conv_Pool(&weights[c * CONV_PATCH], bias[c], c, conv_col, &conv_col[2 * CONV_PATCH_WORDS]);
+      }
+    }
+  }
+}
+#else
+/**
+  * @brief Pooled tiles [py0, py1] x [px0, px1] of conv2d_2, one pooled row at a time
+  * @param in_w input columns, out_w pooled output columns: CONV_IN_W and
+  *        CONV_POOL_W but for a strip (Kernel_Strip)
+  * @note  At most CONV_POOL_W columns a call, what scratch0 holds. Called
+  *        on the arena the output overlaps the start of the input; pooled
+  *        row py only overwrites input rows that rows >= py no longer read
+  */
+static void Conv_Tiles(ai_layer *layer, const uint8_t *in, uint32_t in_w, int8_t *out, uint32_t out_w,
+                       uint32_t py0, uint32_t py1, uint32_t px0, uint32_t px1)
+{
+  const int8_t *weights = ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 0)).s8;
+  const int32_t *bias = ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 1)).s32;
+  uint32_t *col = ai_tensor_get_data(GET_TENSOR_SCRATCH(((ai_node *)layer)->tensors, 0)).u32;
+
+  for (uint32_t py = py0; py <= py1; py++)
+  {
+    // Columns 2px0 .. 2px1+1 of conv rows 2py and 2py+1, patch (dy, x) at dy * 10 + x - 2px0
+    for (uint32_t dy = 0; dy < 2; dy++)
+    {
+      for (uint32_t x = 2 * px0; x < 2 * px1 + 2; x++)
+      {
+        Conv_Im2col(&col[(dy * 2 * CONV_POOL_W + x - 2 * px0) * CONV_PATCH_WORDS],
+                    &in[((2 * py + dy) * in_w + x) * CONV_IN_C], in_w);
+      }
+    }
+
+    for (uint32_t c = 0; c < CONV_OUT_C; c++)
+    {
+      const int8_t *w = &weights[c * CONV_PATCH];  // OHWI, 144 B per channel
+
+      for (uint32_t px = px0; px <= px1; px++)
+      {
+        const uint32_t *c0 = &col[(2 * (px - px0)) * CONV_PATCH_WORDS];
+
+        out[(py * out_w + px) * CONV_OUT_C + c] =
+          Conv_Pool(w, bias[c], c, c0, c0 + 2 * CONV_POOL_W * CONV_PATCH_WORDS);
+      }
+    }
+  }
+}
+#endif
+
+/**
+  * @brief conv2d_2 forward: conv + ReLU + 2x2 max pool
+  * @note  With APP_KERNEL_INCREMENTAL only the tiles the changed input
+  *        reaches, on the layer's cached input and output
+  */
+static void Conv_Forward(ai_layer *layer)
+{
+  const uint8_t *in = ai_tensor_get_data(ai_layer_get_tensor_in(layer, 0)).u8;
+  int8_t *out = ai_tensor_get_data(ai_layer_get_tensor_out(layer, 0)).s8;
+#if APP_KERNEL_INCREMENTAL
+  KernelTiles_t t;
+
+  if (Kernel_Dirty(&conv_cache, in, CONV_IN_W, CONV_IN_C, CONV_POOL_W, &t))
+  {
+    Conv_Tiles(layer, conv_cache.in, CONV_IN_W, conv_cache.out, CONV_POOL_W, t.y0, t.y1, t.x0, t.x1);
+  }
+  memcpy(out, conv_cache.out, CONV_OUT_SIZE);
+#else
+  Conv_Tiles(layer, in, CONV_IN_W, out, CONV_POOL_W, 0, CONV_POOL_W - 1, 0, CONV_POOL_W - 1);
+#endif
+}
+
+/**
+  * @brief Check a layer is exactly the conv Conv_Forward implements and
+  *        derive its requantisation
+  * @retval 1 if Conv_Forward can replace its forward function
+  */
+static int Conv_Match(ai_node *node)
+{
+  ai_layer *layer = (ai_layer *)node;
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  ai_tensor *weights = ai_layer_get_tensor_weights(layer, 0);
+  ai_tensor *bias = ai_layer_get_tensor_weights(layer, 1);
+
+  if (!Conv_Params(node))
+  {
+    return 0;
+  }
+
+  // 13x13 valid 3x3 conv gives 11x11, pooled to 5x5: no padding possible
+  if (Kernel_Dim(in, AI_TENSOR_CHANNEL) != CONV_IN_C || Kernel_Dim(in, AI_TENSOR_WIDTH) != CONV_IN_W ||
+      Kernel_Dim(in, AI_TENSOR_HEIGHT) != CONV_IN_W || Kernel_Dim(out, AI_TENSOR_CHANNEL) != CONV_OUT_C ||
+      Kernel_Dim(out, AI_TENSOR_WIDTH) != CONV_POOL_W || Kernel_Dim(out, AI_TENSOR_HEIGHT) != CONV_POOL_W ||
+      !weights || ai_tensor_get_data_byte_size(weights) != CONV_OUT_C * CONV_PATCH ||
+      !bias || ai_tensor_get_data_size(bias) != CONV_OUT_C ||
+      (!APP_CONV_DIRECT && !Kernel_Scratch(node, CONV_COL_BYTES)))
+  {
+    return 0;
+  }
+
+  return Kernel_Quant(in, out, weights, CONV_OUT_C, conv_mult, conv_shift);
+}
+#endif /* APP_KERNEL_CONV */
+
+#if APP_KERNEL_INCREMENTAL
+/* Conv0 ---------------------------------------------------------------------*/
+#define CONV0_IN_W              28U
+#define CONV0_OUT_C             16U
+#define CONV0_POOL_W            13U    // 26 / 2
+#define CONV0_TAPS              (CONV_K * CONV_K)
+#define CONV0_TAP_WORDS         (2U * CONV_K)  // (w0, w2), (w1, 0) per kernel row
+#define CONV0_OUT_SIZE          (CONV0_POOL_W * CONV0_POOL_W * CONV0_OUT_C)
+
+// Weights as int16 pairs in the pixel order of Kernel_Expand, 24 bytes a channel
+static uint32_t conv0_w[CONV0_OUT_C][CONV0_TAP_WORDS];
+static int32_t conv0_mult[KERNEL_QUANT_N(CONV0_OUT_C)];
+static uint8_t conv0_shift[KERNEL_QUANT_N(CONV0_OUT_C)];
+static uint8_t conv0_in[CONV0_IN_W * CONV0_IN_W];
+static int8_t conv0_out[CONV0_OUT_SIZE];
+static KernelCache_t conv0_cache = { conv0_in, conv0_out, 0 };
+#if APP_KERNEL_BLANK_TILES
+// Output of a tile over background only: ReLU(bias) requantised
+static int8_t conv0_blank[CONV0_OUT_C];
+static uint32_t conv0_computed;         // tiles not blank since the last Conv0_Forward
+#endif
+
+#if APP_KERNEL_BLANK_TILES
+/**
+  * @brief True if the 4x4 input window of a pooled tile is all background
+  * @note  The tensor holds pixel - 128, background is 0x80
+  */
+static int Conv0_Blank(const uint8_t *win, uint32_t in_w)
+{
+  for (uint32_t y = 0; y < 4; y++)
+  {
+    if (__UNALIGNED_UINT32_READ(&win[y * in_w]) != 0x80808080U)
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+#endif
+
+/**
+  * @brief Pooled tiles [py0, py1] x [px0, px1] of conv2d_0
+  * @param in_w input columns, out_w pooled output columns: CONV0_IN_W and
+  *        CONV0_POOL_W but for a strip (Kernel_Strip)
+  * @note  The 4x4 window of a tile is read a row of 4 pixels per word and
+  *        expanded once to (p0, p2), (p1, p3). Against a kernel row packed
+  *        as (w0, w2), (w1, 0) the left output column is
+  *        SMLAD(w02, p02) + SMLAD(w1, p13) and the right one
+  *        SMLAD(w02, p13) + SMLADX(w1, p02), so both columns of both rows
+  *        come from the 8 expanded words with no im2col gather.
+  */
+static void Conv0_Tiles(const int32_t *bias, const uint8_t *in, uint32_t in_w, int8_t *out, uint32_t out_w,
+                        uint32_t py0, uint32_t py1, uint32_t px0, uint32_t px1)
+{
+  for (uint32_t py = py0; py <= py1; py++)
+  {
+    for (uint32_t px = px0; px <= px1; px++)
+    {
+      const uint8_t *win = &in[2 * py * in_w + 2 * px];
+      uint32_t x[4][2];
+
+#if APP_KERNEL_BLANK_TILES
+      if (Conv0_Blank(win, in_w))
+      {
+        memcpy(&out[(py * out_w + px) * CONV0_OUT_C], conv0_blank, CONV0_OUT_C);
+        continue;
+      }
+      conv0_computed++;
+#endif
+
+      for (uint32_t r = 0; r < 4; r++)
+      {
+        Kernel_Expand(x[r], &win[r * in_w], 4);
+      }
+
+      for (uint32_t c = 0; c < CONV0_OUT_C; c++)
+      {
+        const uint32_t *w = conv0_w[c];
+        // Pool window order: top left, top right, bottom left, bottom right
+        int32_t a[4] = { bias[c], bias[c], bias[c], bias[c] };
+
+        for (uint32_t k = 0; k < CONV_K; k++)
+        {
+          uint32_t w02 = w[2 * k];
+          uint32_t w1 = w[2 * k + 1];
+
+          for (uint32_t dy = 0; dy < 2; dy++)
+          {
+            const uint32_t *row = x[k + dy];
+            int32_t *acc = &a[2 * dy];
+
+            acc[0] = (int32_t)__SMLAD(w02, row[0], (uint32_t)acc[0]);
+            acc[0] = (int32_t)__SMLAD(w1, row[1], (uint32_t)acc[0]);
+            acc[1] = (int32_t)__SMLAD(w02, row[1], (uint32_t)acc[1]);
+            acc[1] = (int32_t)__SMLADX(w1, row[0], (uint32_t)acc[1]);
+          }
+        }
+
+        if (a[1] > a[0]) a[0] = a[1];
+        if (a[3] > a[2]) a[2] = a[3];
+        if (a[2] > a[0]) a[0] = a[2];
+        out[(py * out_w + px) * CONV0_OUT_C + c] = Kernel_Requant(a[0], conv0_mult[KERNEL_QUANT_CH(c)],
+                                                                  conv0_shift[KERNEL_QUANT_CH(c)]);
+      }
+    }
+  }
+}
+
+/**
+  * @brief conv2d_0 forward: the tiles the changed pixels reach, on the cached input and output
+  */
+static void Conv0_Forward(ai_layer *layer)
+{
+  const uint8_t *in = ai_tensor_get_data(ai_layer_get_tensor_in(layer, 0)).u8;
+  int8_t *out = ai_tensor_get_data(ai_layer_get_tensor_out(layer, 0)).s8;
+  const int32_t *bias = ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 1)).s32;
+  KernelTiles_t t;
+
+#if APP_KERNEL_BLANK_TILES
+  conv0_computed = 0;
+#endif
+  if (Kernel_Dirty(&conv0_cache, in, CONV0_IN_W, 1, CONV0_POOL_W, &t))
+  {
+    Conv0_Tiles(bias, conv0_cache.in, CONV0_IN_W, conv0_cache.out, CONV0_POOL_W, t.y0, t.y1, t.x0, t.x1);
+  }
+  memcpy(out, conv0_cache.out, CONV0_OUT_SIZE);
+}
+
+/**
+  * @brief Check a layer is exactly conv2d_0, pack its weights and derive its requantisation
+  */
+static int Conv0_Match(ai_node *node)
+{
+  ai_layer *layer = (ai_layer *)node;
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  ai_tensor *weights = ai_layer_get_tensor_weights(layer, 0);
+  ai_tensor *bias = ai_layer_get_tensor_weights(layer, 1);
+  const int8_t *w;
+
+  // 28x28 valid 3x3 conv gives 26x26, pooled to 13x13: no padding possible
+  if (!Conv_Params(node) ||
+      Kernel_Dim(in, AI_TENSOR_CHANNEL) != 1 || Kernel_Dim(in, AI_TENSOR_WIDTH) != CONV0_IN_W ||
+      Kernel_Dim(in, AI_TENSOR_HEIGHT) != CONV0_IN_W || Kernel_Dim(out, AI_TENSOR_CHANNEL) != CONV0_OUT_C ||
+      Kernel_Dim(out, AI_TENSOR_WIDTH) != CONV0_POOL_W || Kernel_Dim(out, AI_TENSOR_HEIGHT) != CONV0_POOL_W ||
+      !weights || ai_tensor_get_data_byte_size(weights) != CONV0_OUT_C * CONV0_TAPS ||
+      !bias || ai_tensor_get_data_size(bias) != CONV0_OUT_C)
+  {
+    return 0;
+  }
+
+  w = ai_tensor_get_data(weights).s8;
+  for (uint32_t c = 0; c < CONV0_OUT_C; c++)
+  {
+    for (uint32_t k = 0; k < CONV_K; k++)
+    {
+      const int8_t *t = &w[c * CONV0_TAPS + k * CONV_K];
+
+      conv0_w[c][2 * k] = (uint16_t)t[0] | ((uint32_t)(uint16_t)t[2] << 16);
+      conv0_w[c][2 * k + 1] = (uint16_t)t[1];
+    }
+  }
+  if (!Kernel_Quant(in, out, weights, CONV0_OUT_C, conv0_mult, conv0_shift))
+  {
+    return 0;
+  }
+#if APP_KERNEL_BLANK_TILES
+  // Every tap reads 0 after the input offset: the accumulators hold the bias
+  for (uint32_t c = 0; c < CONV0_OUT_C; c++)
+  {
+    conv0_blank[c] = Kernel_Requant(ai_tensor_get_data(bias).s32[c], conv0_mult[KERNEL_QUANT_CH(c)],
+                                   conv0_shift[KERNEL_QUANT_CH(c)]);
+  }
+#endif
+  return 1;
+}
+
+/**
+  * @brief Forget the cached inputs, the next inference computes every tile
+  */
+void Kernel_Invalidate(void)
+{
+  conv0_cache.valid = 0;
+  conv_cache.valid = 0;
+#if APP_STREAM
+  stream_on = 0;
+#endif
+}
+#endif /* APP_KERNEL_INCREMENTAL */
+
+#if APP_KERNEL_DENSE
+/* Dense ---------------------------------------------------------------------*/
+#define DENSE_IN                KERNEL_GEMM_5_COLS
+#define DENSE_OUT               KERNEL_GEMM_5_ROWS
+#define DENSE_WORDS             (DENSE_IN / 4U)  // weight words per row
+#define DENSE_ROW_BLOCKS        (DENSE_OUT / KERNEL_DENSE_BLOCK)
+
+static int32_t dense_mult[KERNEL_QUANT_N(DENSE_OUT)];
+static uint8_t dense_shift[KERNEL_QUANT_N(DENSE_OUT)];
+#if APP_KERNEL_DENSE_SKIP
+// Input word columns of the last run not entirely at the zero point
+static uint8_t dense_active[DENSE_WORDS];
+static uint32_t dense_active_count;
+_Static_assert(DENSE_WORDS <= 256U, "dense_active holds byte indices");
+#endif
+
+/**
+  * @brief Accumulate one 4 x 4 byte weight block: word r of w is row r,
+  *        x the expanded input pair of its word column
+  */
+static inline void Dense_Block(int32_t a[KERNEL_DENSE_BLOCK], const uint32_t *w, const uint32_t *x)
+{
+  for (uint32_t r = 0; r < KERNEL_DENSE_BLOCK; r++)
+  {
+    a[r] = (int32_t)__SMLAD(__SXTB16(w[r]), x[0], (uint32_t)a[r]);
+    a[r] = (int32_t)__SMLAD(__SXTB16(__ROR(w[r], 8)), x[1], (uint32_t)a[r]);
+  }
+}
+
+/**
+  * @brief Check a layer has gemm_5's shapes and the scratch for the input
+  */
+static int Dense_Check(ai_node *node)
+{
+  ai_layer *layer = (ai_layer *)node;
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  ai_tensor *weights = ai_layer_get_tensor_weights(layer, 0);
+  ai_tensor *bias = ai_layer_get_tensor_weights(layer, 1);
+
+  return in && ai_tensor_get_data_size(in) == DENSE_IN &&
+         out && ai_tensor_get_data_size(out) == DENSE_OUT &&
+         weights && ai_tensor_get_data_byte_size(weights) == DENSE_IN * DENSE_OUT &&
+         bias && ai_tensor_get_data_size(bias) == DENSE_OUT &&
+         Kernel_Scratch(node, DENSE_IN * 2U);
+}
+
+/**
+  * @brief Weight word k of row r as the network holds it
+  */
+static uint32_t Dense_Word(ai_node *node, uint32_t r, uint32_t k)
+{
+  const uint8_t *w = ai_tensor_get_data(ai_layer_get_tensor_weights((ai_layer *)node, 0)).u8;
+  return __UNALIGNED_UINT32_READ(&w[r * DENSE_IN + k * 4]);
+}
+
+/**
+  * @brief Requantisation of gemm_5, once its weights are known to match
+  */
+static int Dense_Quant(ai_node *node)
+{
+  ai_layer *layer = (ai_layer *)node;
+
+  return Kernel_Quant(ai_layer_get_tensor_in(layer, 0), ai_layer_get_tensor_out(layer, 0),
+                      ai_layer_get_tensor_weights(layer, 0), DENSE_OUT, dense_mult, dense_shift);
+}
+
+#if APP_KERNEL_DENSE == KERNEL_DENSE_BLOCKED
+/**
+  * @brief gemm_5 forward on kernel_gemm_5_blocked
+  * @note  One sequential pass over the weights: each flash word feeds one
+  *        of 4 rows, each expanded input pair all 4. With
+  *        APP_KERNEL_DENSE_SKIP the pass jumps over the words of inputs
+  *        at the zero point
+  */
+static void Dense_Forward(ai_layer *layer)
+{
+  const uint8_t *in = ai_tensor_get_data(ai_layer_get_tensor_in(layer, 0)).u8;
+  int8_t *out = ai_tensor_get_data(ai_layer_get_tensor_out(layer, 0)).s8;
+  const int32_t *bias = ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 1)).s32;
+  uint32_t *col = ai_tensor_get_data(GET_TENSOR_SCRATCH(((ai_node *)layer)->tensors, 0)).u32;
+  const uint32_t *w = kernel_gemm_5_blocked;
+
+  Kernel_Expand(col, in, DENSE_IN);
+#if APP_KERNEL_DENSE_SKIP
+  // The zero point (0x80) expands to 0 and adds nothing: list the words
+  // holding anything else, the weights of the rest are never read
+  dense_active_count = 0;
+  for (uint32_t k = 0; k < DENSE_WORDS; k++)
+  {
+    if (__UNALIGNED_UINT32_READ(&in[k * 4]) != 0x80808080U)
+    {
+      dense_active[dense_active_count++] = (uint8_t)k;
+    }
+  }
+#endif
+
+  for (uint32_t r = 0; r < DENSE_OUT; r += KERNEL_DENSE_BLOCK)
+  {
+    int32_t a[KERNEL_DENSE_BLOCK] = { bias[r], bias[r + 1], bias[r + 2], bias[r + 3] };
+
+#if APP_KERNEL_DENSE_SKIP
+    for (uint32_t j = 0; j < dense_active_count; j++)
+    {
+      uint32_t k = dense_active[j];
+      Dense_Block(a, &w[k * KERNEL_DENSE_BLOCK], &col[2 * k]);
+    }
+    w += DENSE_WORDS * KERNEL_DENSE_BLOCK;
+#else
+    for (uint32_t k = 0; k < DENSE_WORDS; k++)
+    {
+      Dense_Block(a, w, &col[2 * k]);
+      w += KERNEL_DENSE_BLOCK;
+    }
+#endif
+
+    for (uint32_t i = 0; i < KERNEL_DENSE_BLOCK; i++)
+    {
+      out[r + i] = Kernel_Requant(a[i], dense_mult[KERNEL_QUANT_CH(r + i)], dense_shift[KERNEL_QUANT_CH(r + i)]);
+    }
+  }
+}
+
+/**
+  * @brief Check a layer is gemm_5 and kernel_gemm_5_blocked holds its weights
+  * @note  Compares all 100 KB (about 1 ms), so a kernel_weights.c left over
+  *        from an older network keeps the library kernel
+  */
+static int Dense_Match(ai_node *node)
+{
+  if (!Dense_Check(node))
+  {
+    return 0;
+  }
+
+  for (uint32_t r = 0; r < DENSE_OUT; r++)
+  {
+    const uint32_t *blocked = &kernel_gemm_5_blocked[(r / KERNEL_DENSE_BLOCK) * DENSE_WORDS * KERNEL_DENSE_BLOCK +
+                                                     r % KERNEL_DENSE_BLOCK];
+    for (uint32_t k = 0; k < DENSE_WORDS; k++)
+    {
+      if (blocked[k * KERNEL_DENSE_BLOCK] != Dense_Word(node, r, k))
+      {
+        return 0;
+      }
+    }
+  }
+
+  return Dense_Quant(node);
+}
+
+#elif APP_KERNEL_DENSE == KERNEL_DENSE_SPARSE
+/**
+  * @brief gemm_5 forward on kernel_gemm_5_sparse: the blocked kernel over
+  *        the kept blocks only, rows written through the row permutation
+  */
+static void Dense_Forward(ai_layer *layer)
+{
+  const uint8_t *in = ai_tensor_get_data(ai_layer_get_tensor_in(layer, 0)).u8;
+  int8_t *out = ai_tensor_get_data(ai_layer_get_tensor_out(layer, 0)).s8;
+  const int32_t *bias = ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 1)).s32;
+  uint32_t *col = ai_tensor_get_data(GET_TENSOR_SCRATCH(((ai_node *)layer)->tensors, 0)).u32;
+  const uint8_t *rows = kernel_gemm_5_sparse_rows;
+  const uint32_t *w = kernel_gemm_5_sparse;
+
+  Kernel_Expand(col, in, DENSE_IN);
+
+  for (uint32_t b = 0; b < DENSE_ROW_BLOCKS; b++, rows += KERNEL_DENSE_BLOCK)
+  {
+    int32_t a[KERNEL_DENSE_BLOCK] = { bias[rows[0]], bias[rows[1]], bias[rows[2]], bias[rows[3]] };
+
+    for (uint32_t j = kernel_gemm_5_sparse_ptr[b]; j < kernel_gemm_5_sparse_ptr[b + 1]; j++)
+    {
+      Dense_Block(a, w, &col[2 * kernel_gemm_5_sparse_cols[j]]);
+      w += KERNEL_DENSE_BLOCK;
+    }
+
+    for (uint32_t i = 0; i < KERNEL_DENSE_BLOCK; i++)
+    {
+      out[rows[i]] = Kernel_Requant(a[i], dense_mult[KERNEL_QUANT_CH(rows[i])],
+                                     dense_shift[KERNEL_QUANT_CH(rows[i])]);
+    }
+  }
+}
+
+/**
+  * @brief Check a layer is gemm_5 and kernel_gemm_5_sparse holds exactly
+  *        its nonzero weights
+  * @note  Every word of the network's weights is checked, dropped blocks
+  *        against 0, so a sparse copy of an older network keeps the library
+  */
+static int Dense_Match(ai_node *node)
+{
+  const uint16_t *ptr = kernel_gemm_5_sparse_ptr;
+  uint32_t seen[DENSE_OUT / 32U] = { 0 };
+
+  if (!Dense_Check(node) || ptr[0] != 0 || ptr[DENSE_ROW_BLOCKS] > DENSE_ROW_BLOCKS * DENSE_WORDS)
+  {
+    return 0;
+  }
+
+  for (uint32_t i = 0; i < DENSE_OUT; i++)
+  {
+    uint32_t r = kernel_gemm_5_sparse_rows[i];
+    if (r >= DENSE_OUT || (seen[r / 32U] & (1U << (r % 32U))))
+    {
+      return 0;
+    }
+    seen[r / 32U] |= 1U << (r % 32U);
+  }
+
+  for (uint32_t b = 0; b < DENSE_ROW_BLOCKS; b++)
+  {
+    if (ptr[b + 1] < ptr[b])
+    {
+      return 0;
+    }
+    for (uint32_t i = 0; i < KERNEL_DENSE_BLOCK; i++)
+    {
+      uint32_t r = kernel_gemm_5_sparse_rows[b * KERNEL_DENSE_BLOCK + i];
+      uint32_t j = ptr[b];
+
+      for (uint32_t k = 0; k < DENSE_WORDS; k++)
+      {
+        uint32_t kept = 0;
+        // Columns ascend within a row block
+        if (j < ptr[b + 1] && kernel_gemm_5_sparse_cols[j] == k)
+        {
+          kept = kernel_gemm_5_sparse[j * KERNEL_DENSE_BLOCK + i];
+          j++;
+        }
+        if (kept != Dense_Word(node, r, k))
+        {
+          return 0;
+        }
+      }
+      if (j != ptr[b + 1])
+      {
+        return 0;
+      }
+    }
+  }
+
+  return Dense_Quant(node);
+}
+
+#elif APP_KERNEL_DENSE == KERNEL_DENSE_INT4
+#define DENSE_NIBBLE_WORDS      (DENSE_IN / 8U)  // 4-bit weight words per row
+
+/**
+  * @brief Accumulate one 4 x 8 nibble weight block: word r of w is row r,
+  *        x the two expanded input pairs of its 8 columns
+  * @note  Masking a nibble set into the top of each byte gives int8 lanes
+  *        of 16 x the weight, so the sums are 16 x those of the weights
+  */
+static inline void Dense_Block4(int32_t a[KERNEL_DENSE_BLOCK], const uint32_t *w, const uint32_t *x)
+{
+  for (uint32_t r = 0; r < KERNEL_DENSE_BLOCK; r++)
+  {
+    uint32_t hi = w[r] & 0xF0F0F0F0U;
+    uint32_t lo = (w[r] << 4) & 0xF0F0F0F0U;
+
+    a[r] = (int32_t)__SMLAD(__SXTB16(hi), x[0], (uint32_t)a[r]);
+    a[r] = (int32_t)__SMLAD(__SXTB16(__ROR(hi, 8)), x[1], (uint32_t)a[r]);
+    a[r] = (int32_t)__SMLAD(__SXTB16(lo), x[2], (uint32_t)a[r]);
+    a[r] = (int32_t)__SMLAD(__SXTB16(__ROR(lo, 8)), x[3], (uint32_t)a[r]);
+  }
+}
+
+/**
+  * @brief gemm_5 forward on kernel_gemm_5_int4: the blocked kernel with
+  *        eight weights per flash word, unpacked in registers
+  */
+static void Dense_Forward(ai_layer *layer)
+{
+  const uint8_t *in = ai_tensor_get_data(ai_layer_get_tensor_in(layer, 0)).u8;
+  int8_t *out = ai_tensor_get_data(ai_layer_get_tensor_out(layer, 0)).s8;
+  uint32_t *col = ai_tensor_get_data(GET_TENSOR_SCRATCH(((ai_node *)layer)->tensors, 0)).u32;
+  const int32_t *bias = kernel_gemm_5_int4_bias;
+  const uint32_t *w = kernel_gemm_5_int4;
+
+  Kernel_Expand(col, in, DENSE_IN);
+
+  for (uint32_t r = 0; r < DENSE_OUT; r += KERNEL_DENSE_BLOCK)
+  {
+    int32_t a[KERNEL_DENSE_BLOCK] = { bias[r], bias[r + 1], bias[r + 2], bias[r + 3] };
+
+    for (uint32_t j = 0; j < DENSE_NIBBLE_WORDS; j++)
+    {
+      Dense_Block4(a, w, &col[4 * j]);
+      w += KERNEL_DENSE_BLOCK;
+    }
+
+    for (uint32_t i = 0; i < KERNEL_DENSE_BLOCK; i++)
+    {
+      out[r + i] = Kernel_Requant(a[i], dense_mult[KERNEL_QUANT_CH(r + i)], dense_shift[KERNEL_QUANT_CH(r + i)]);
+    }
+  }
+}
+
+/**
+  * @brief 4-bit weight of row r, column c in kernel_gemm_5_int4
+  */
+static int32_t Dense_Nibble(uint32_t r, uint32_t c)
+{
+  uint32_t w = kernel_gemm_5_int4[((r / KERNEL_DENSE_BLOCK) * DENSE_NIBBLE_WORDS + c / 8U) *
+                                  KERNEL_DENSE_BLOCK + r % KERNEL_DENSE_BLOCK];
+  uint32_t lane = (c % 8U) % 4U;
+  uint32_t shift = 8U * lane + ((c % 8U) < 4U ? 4U : 0U);
+
+  return ((int32_t)(w << (28U - shift))) >> 28;
+}
+
+/**
+  * @brief Check a layer is gemm_5 and kernel_gemm_5_int4 holds its weights
+  *        rounded to the row steps, then fold the steps into the multipliers
+  * @note  Lossy by design, so every weight is checked to within half a step
+  *        and every bias to within one unit: a copy from an older network
+  *        still keeps the library kernel
+  */
+static int Dense_Match(ai_node *node)
+{
+  ai_layer *layer = (ai_layer *)node;
+  ai_tensor_intq_info qin, qout, qw;
+  const int32_t *bias;
+
+  if (!Dense_Check(node))
+  {
+    return 0;
+  }
+
+  bias = ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 1)).s32;
+  for (uint32_t r = 0; r < DENSE_OUT; r++)
+  {
+    float step = kernel_gemm_5_int4_step[r];
+    float b = 16.0f * (float)bias[r] / step;
+
+    if (step <= 0.0f || fabsf(b - (float)kernel_gemm_5_int4_bias[r]) > 1.0f + fabsf(b) * 1e-6f)
+    {
+      return 0;
+    }
+    for (uint32_t k = 0; k < DENSE_WORDS; k++)
+    {
+      uint32_t word = Dense_Word(node, r, k);
+      for (uint32_t i = 0; i < 4U; i++)
+      {
+        float w = (float)(int8_t)(word >> (8U * i));
+        if (fabsf(w - step * (float)Dense_Nibble(r, 4U * k + i)) > step * 0.501f)
+        {
+          return 0;
+        }
+      }
+    }
+  }
+
+  if (!Dense_Quant(node))
+  {
+    return 0;
+  }
+
+  // The sums are in step[r] / 16 units of the weights' scale
+  qin = ai_tensor_get_intq(ai_layer_get_tensor_in(layer, 0));
+  qout = ai_tensor_get_intq(ai_layer_get_tensor_out(layer, 0));
+  qw = ai_tensor_get_intq(ai_layer_get_tensor_weights(layer, 0));
+  for (uint32_t r = 0; r < DENSE_OUT; r++)
+  {
+    Kernel_Multiplier(qin.scale[0] * qw.scale[(qw.size == 1U) ? 0U : r] * kernel_gemm_5_int4_step[r] /
+                      (16.0f * qout.scale[0]),
+                      &dense_mult[r], &dense_shift[r]);
+  }
+  return 1;
+}
+#else
+#error "APP_KERNEL_DENSE is 0, KERNEL_DENSE_BLOCKED, KERNEL_DENSE_SPARSE or KERNEL_DENSE_INT4"
+#endif
+#endif /* APP_KERNEL_DENSE */
+
+#if APP_SOFTMAX_BYPASS
+/**
+  * @brief Softmax bypass: the logits leave the network as they are
+  */
+static void Softmax_Forward(ai_layer *layer)
+{
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+
+  memcpy(ai_tensor_get_data(out).handle, ai_tensor_get_data(in).handle,
+         ai_tensor_get_data_byte_size(out));
+}
+
+/**
+  * @brief Check a layer is the int8 softmax over the network's scores
+  * @note  Only the last layer qualifies, a softmax feeding another layer
+  *        has to run
+  */
+static int Softmax_Match(ai_node *node)
+{
+  ai_tensor *in = GET_TENSOR_IN(node->tensors, 0);
+  ai_tensor *out = GET_TENSOR_OUT(node->tensors, 0);
+
+  return node->next == node && in && out &&
+         ai_tensor_has_intq(in) && ai_tensor_has_intq(out) &&
+         ai_tensor_get_data_byte_size(in) == ai_tensor_get_data_byte_size(out) &&
+         ai_tensor_get_data_byte_size(out) <= MODEL_OUT_MAX;
+}
+#endif /* APP_SOFTMAX_BYPASS */
+
+#if APP_ARENA_SIZE
+/**
+  * @brief Bytes from the arena start to the end of the node's furthest
+  *        input, output or scratch buffer, 0 if none is in the arena
+  * @param scratch count the scratch buffers, which a kernel may leave unused
+  */
+static uint32_t Kernel_NodeEnd(ai_node *node, int scratch)
+{
+  const uint8_t *arena = Model_Arena();
+  uint32_t end = 0;
+
+  for (uint32_t l = AI_TENSOR_CHAIN_INPUT; l <= AI_TENSOR_CHAIN_SCRATCH; l++)
+  {
+    ai_tensor_list *list = (l < node->tensors->size) ? &node->tensors->chain[l] : NULL;
+
+    // Weights live in flash or the weight cache, never in the arena
+    if (l == AI_TENSOR_CHAIN_WEIGHTS || (l == AI_TENSOR_CHAIN_SCRATCH && !scratch))
+    {
+      continue;
+    }
+    for (ai_size i = 0; i < GET_TENSOR_LIST_SIZE(list); i++)
+    {
+      ai_tensor *t = GET_TENSOR_LIST_ITEM(list, i);
+      const uint8_t *data = (t && t->data) ? (const uint8_t *)t->data->data : NULL;
+      uint32_t stop;
+
+      if (!data || data < arena)
+      {
+        continue;
+      }
+      stop = (uint32_t)(data - arena) + (uint32_t)ai_tensor_get_data_byte_size(t);
+      if (stop > end) end = stop;
+    }
+  }
+  return end;
+}
+
+/**
+  * @brief Arena bytes a bound network uses with its kernels installed
+  * @note  Over MODEL_ARENA_SIZE the model does not fit the trimmed arena
+  */
+uint32_t Kernel_ArenaEnd(ai_handle network)
+{
+  ai_network *net = AI_NETWORK_ACQUIRE_CTX(network);
+  ai_node *node = net ? net->input_node : NULL;
+  uint32_t end = 0;
+
+  for (uint32_t n = 0; node && n < MODEL_MAX_NODES; n++)
+  {
+#if APP_CONV_DIRECT
+    uint32_t stop = Kernel_NodeEnd(node, node->forward != AI_NODE_FUNC(Conv_Forward));
+#else
+    uint32_t stop = Kernel_NodeEnd(node, 1);
+#endif
+
+    if (stop > end) end = stop;
+    // The last layer links to itself
+    node = (node->next == node) ? NULL : node->next;
+  }
+  return end;
+}
+#endif /* APP_ARENA_SIZE */
+
+#if KERNEL_ANY
+// Slots of kernels not compiled in stay empty
+static KernelSlot_t kernel_slots[KERNEL_COUNT] = {
+#if APP_KERNEL_CONV
+  [KERNEL_CONV] = { AI_NODE_FUNC(forward_conv2d_sssa8_ch_nl_pool), AI_NODE_FUNC(Conv_Forward),
+                    Conv_Match, CONV_OUT_SIZE, NULL },
+#endif
+#if APP_KERNEL_DENSE
+  [KERNEL_DENSE] = { AI_NODE_FUNC(forward_dense_integer_SSSA_ch), AI_NODE_FUNC(Dense_Forward),
+                     Dense_Match, DENSE_OUT, NULL },
+#endif
+#if APP_SOFTMAX_BYPASS
+  [KERNEL_SOFTMAX] = { AI_NODE_FUNC(forward_sm_integer), AI_NODE_FUNC(Softmax_Forward),
+                       Softmax_Match, MODEL_OUT_MAX, NULL },
+#endif
+#if APP_KERNEL_INCREMENTAL
+  [KERNEL_CONV0] = { AI_NODE_FUNC(forward_conv2d_sssa8_ch_nl_pool), AI_NODE_FUNC(Conv0_Forward),
+                     Conv0_Match, CONV0_OUT_SIZE, NULL },
+#endif
+};
+
+#if APP_PROFILE
+#if APP_KERNEL_INCREMENTAL
+#define BENCH_OUT_MAX           CONV0_OUT_SIZE  // largest out_size above
+#else
+#define BENCH_OUT_MAX           800U
+#endif
+
+static const KernelSlot_t *bench_slot;
+static node_func bench_target;
+static uint32_t bench_cycles;
+static uint8_t bench_pass;
+static int8_t bench_ref[BENCH_OUT_MAX] __attribute__((section(".noinit")));
+static ProtoKernelBench_t *bench_result;
+
+/**
+  * @brief Time bench_target on the layer and compare its output across passes
+  */
+static void Kernel_TimedForward(ai_layer *layer)
+{
+  const int8_t *out;
+  uint32_t t0 = PROF_CYCLES();
+
+  bench_target(layer);
+  bench_cycles = PROF_CYCLES() - t0;
+
+  out = ai_tensor_get_data(ai_layer_get_tensor_out(layer, 0)).s8;
+  if (bench_pass == 0)
+  {
+    memcpy(bench_ref, out, bench_slot->out_size);
+    return;
+  }
+  for (uint32_t i = 0; i < bench_slot->out_size; i++)
+  {
+    int diff = out[i] - bench_ref[i];
+    if (diff < 0) diff = -diff;
+    if (diff)
+    {
+      bench_result->mismatches++;
+      if (diff > bench_result->max_diff) bench_result->max_diff = (uint8_t)diff;
+    }
+  }
+}
+
+/**
+  * @brief Classify img once with a library layer and once with its kernel
+  * @param kernel KERNEL_* slot to time
+  * @param classify runs the active network on a 28x28 image
+  * @retval PROTO_ERR_PARAM if that kernel runs no layer of the active network
+  */
+ProtoError_t Kernel_Bench(uint8_t kernel, const uint8_t *img, int (*classify)(const uint8_t *img),
+                          ProtoKernelBench_t *result)
+{
+  KernelSlot_t *slot;
+  int cls[2];
+
+  if (kernel >= KERNEL_COUNT || !kernel_slots[kernel].node ||
+      kernel_slots[kernel].out_size > BENCH_OUT_MAX)
+  {
+    return PROTO_ERR_PARAM;
+  }
+#if APP_ARENA_SIZE
+  // The library layer would write its scratch past a trimmed arena
+  if (Kernel_NodeEnd(kernel_slots[kernel].node, 1) > MODEL_ARENA_SIZE)
+  {
+    return PROTO_ERR_PARAM;
+  }
+#endif
+
+  slot = &kernel_slots[kernel];
+  memset(result, 0, sizeof(*result));
+  bench_slot = slot;
+  bench_result = result;
+  for (bench_pass = 0; bench_pass < 2; bench_pass++)
+  {
+    bench_target = bench_pass ? slot->kernel : slot->lib;
+#if APP_KERNEL_INCREMENTAL
+    // Time the kernel on the whole image, not on what changed since
+    Kernel_Invalidate();
+#endif
+    slot->node->forward = AI_NODE_FUNC(Kernel_TimedForward);
+    cls[bench_pass] = classify(img);
+    slot->node->forward = slot->kernel;
+    if (cls[bench_pass] < 0)
+    {
+      return PROTO_ERR_INFERENCE;
+    }
+    if (bench_pass == 0)
+    {
+      result->lib_cycles = bench_cycles;
+    }
+  }
+
+  result->kernel_cycles = bench_cycles;
+  result->lib_class = (uint8_t)cls[0];
+  result->kernel_class = (uint8_t)cls[1];
+  result->kernel = kernel;
+  result->cpu_hz = HAL_RCC_GetHCLKFreq();
+#if APP_KERNEL_DENSE_SKIP
+  if (kernel == KERNEL_DENSE)
+  {
+    result->active = (uint16_t)dense_active_count;
+  }
+#endif
+#if APP_KERNEL_BLANK_TILES
+  if (kernel == KERNEL_CONV0)
+  {
+    result->active = (uint16_t)conv0_computed;
+  }
+#endif
+  return PROTO_ERR_NONE;
+}
+#endif /* APP_PROFILE */
+
+#if APP_STREAM
+static uint32_t stream_rows;            // input rows in conv0_cache.in
+static uint32_t stream_conv0;           // pooled conv2d_0 rows computed
+static uint32_t stream_conv;            // pooled conv2d_2 rows computed
+
+/**
+  * @brief Start feeding a new image row by row, the caches hold none of it yet
+  */
+void Kernel_StreamBegin(void)
+{
+  Kernel_Invalidate();
+  stream_rows = stream_conv0 = stream_conv = 0;
+  stream_on = kernel_slots[KERNEL_CONV0].node != NULL;
+}
+
+/**
+  * @brief Compute the conv rows the first rows of img complete
+  * @param img 28x28 uint8 image as received, rows of it valid
+  * @note  Runs conv2d_2 in its scratch0: call only while no inference is in
+  *        flight. Once the last row is in both caches are valid, and the
+  *        forwards of this image recompute nothing
+  */
+void Kernel_StreamRows(const uint8_t *img, uint32_t rows)
+{
+  ai_layer *conv0 = (ai_layer *)kernel_slots[KERNEL_CONV0].node;
+  ai_layer *conv = (ai_layer *)kernel_slots[KERNEL_CONV].node;
+
+  if (!stream_on)
+  {
+    return;
+  }
+  if (rows > CONV0_IN_W)
+  {
+    rows = CONV0_IN_W;
+  }
+
+  // The input tensor holds x - 128, which is x ^ 0x80
+  for (; stream_rows < rows; stream_rows++)
+  {
+    for (uint32_t x = 0; x < CONV0_IN_W; x++)
+    {
+      conv0_cache.in[stream_rows * CONV0_IN_W + x] = img[stream_rows * CONV0_IN_W + x] ^ 0x80U;
+    }
+  }
+
+  // Pooled row r of either conv reads input rows 2r .. 2r+3
+  for (; stream_conv0 < CONV0_POOL_W && 2 * stream_conv0 + 4 <= stream_rows; stream_conv0++)
+  {
+    const int32_t *bias = ai_tensor_get_data(ai_layer_get_tensor_weights(conv0, 1)).s32;
+    uint32_t row = CONV0_POOL_W * CONV0_OUT_C;
+
+    Conv0_Tiles(bias, conv0_cache.in, CONV0_IN_W, conv0_cache.out, CONV0_POOL_W,
+                stream_conv0, stream_conv0, 0, CONV0_POOL_W - 1);
+    // conv2d_0's output is conv2d_2's input
+    memcpy(&conv_cache.in[stream_conv0 * row], &conv0_cache.out[stream_conv0 * row], row);
+  }
+  for (; conv && stream_conv < CONV_POOL_W && 2 * stream_conv + 4 <= stream_conv0; stream_conv++)
+  {
+    Conv_Tiles(conv, conv_cache.in, CONV_IN_W, conv_cache.out, CONV_POOL_W,
+               stream_conv, stream_conv, 0, CONV_POOL_W - 1);
+  }
+
+  if (stream_rows == CONV0_IN_W)
+  {
+    conv0_cache.valid = 1;
+    conv_cache.valid = (conv != NULL);
+    stream_on = 0;
+  }
+}
+#endif /* APP_STREAM */
+
+#if APP_BATCH_DENSE
+/* Batched dense -------------------------------------------------------------*/
+// Expanded gemm_5 inputs of the images waiting for Kernel_DenseBatch()
+static uint32_t dense_stack[APP_BATCH_DENSE][DENSE_IN / 2U] __attribute__((section(".noinit")));
+_Static_assert(DENSE_IN == KERNEL_DENSE_FEATURES && DENSE_OUT == KERNEL_DENSE_OUTPUTS,
+               "kernel_weights.c is not the gemm_5 of kernels.h");
+
+/**
+  * @brief Keep the gemm_5 input of one image for the next batched pass
+  * @param in DENSE_IN int8 values, the conv2d_2 output gemm_5 reads
+  * @retval 0, -1 if gemm_5 of the bound network is not on the kernel
+  */
+int Kernel_DenseStack(uint32_t slot, const int8_t *in)
+{
+  if (!kernel_slots[KERNEL_DENSE].node || slot >= APP_BATCH_DENSE)
+  {
+    return -1;
+  }
+  Kernel_Expand(dense_stack[slot], (const uint8_t *)in, DENSE_IN);
+  return 0;
+}
+
+/**
+  * @brief gemm_5 of count stacked images in one pass over its weights
+  * @note  Weight stationary: each 4 x 4 block is read from flash and
+  *        unpacked once, then feeds the accumulators of every image, so
+  *        the 100 KB stream is paid once per batch rather than per image
+  * @param out count x DENSE_OUT int8, the gemm_5 output of each image
+  * @retval 0, -1 if gemm_5 of the bound network is not on the kernel
+  */
+int Kernel_DenseBatch(uint32_t count, int8_t *out)
+{
+  ai_node *node = kernel_slots[KERNEL_DENSE].node;
+  const uint32_t *w = kernel_gemm_5_blocked;
+  const int32_t *bias;
+  int32_t a[APP_BATCH_DENSE][KERNEL_DENSE_BLOCK];
+
+  if (!node || count > APP_BATCH_DENSE)
+  {
+    return -1;
+  }
+  bias = ai_tensor_get_data(ai_layer_get_tensor_weights((ai_layer *)node, 1)).s32;
+
+  for (uint32_t r = 0; r < DENSE_OUT; r += KERNEL_DENSE_BLOCK)
+  {
+    for (uint32_t b = 0; b < count; b++)
+    {
+      memcpy(a[b], &bias[r], sizeof(a[b]));
+    }
+
+    for (uint32_t k = 0; k < DENSE_WORDS; k++, w += KERNEL_DENSE_BLOCK)
+    {
+      uint32_t lo[KERNEL_DENSE_BLOCK], hi[KERNEL_DENSE_BLOCK];
+
+      for (uint32_t i = 0; i < KERNEL_DENSE_BLOCK; i++)
+      {
+        lo[i] = __SXTB16(w[i]);
+        hi[i] = __SXTB16(__ROR(w[i], 8));
+      }
+      for (uint32_t b = 0; b < count; b++)
+      {
+        const uint32_t *x = &dense_stack[b][2 * k];
+
+        for (uint32_t i = 0; i < KERNEL_DENSE_BLOCK; i++)
+        {
+          a[b][i] = (int32_t)__SMLAD(lo[i], x[0], (uint32_t)a[b][i]);
+          a[b][i] = (int32_t)__SMLAD(hi[i], x[1], (uint32_t)a[b][i]);
+        }
+      }
+    }
+
+    for (uint32_t b = 0; b < count; b++)
+    {
+      for (uint32_t i = 0; i < KERNEL_DENSE_BLOCK; i++)
+      {
+        out[b * DENSE_OUT + r + i] = Kernel_Requant(a[b][i], dense_mult[KERNEL_QUANT_CH(r + i)],
+                                                      dense_shift[KERNEL_QUANT_CH(r + i)]);
+      }
+    }
+  }
+  return 0;
+}
+#endif /* APP_BATCH_DENSE */
+
+#if APP_ANYTIME
+/* Anytime dense -------------------------------------------------------------*/
+// gemm_5 input of the request, expanded, and gemm_6 over the rows done
+static uint32_t anytime_col[DENSE_IN / 2U] __attribute__((section(".noinit")));
+static int32_t anytime_acc[MODEL_OUT_MAX];
+static float anytime_scale[MODEL_OUT_MAX];  // accumulator to gemm_6 output LSBs
+static const int8_t *anytime_w;             // gemm_6 weights, a DENSE_OUT row per class
+static uint32_t anytime_classes;
+_Static_assert(DENSE_IN == KERNEL_DENSE_FEATURES && DENSE_OUT == KERNEL_DENSE_OUTPUTS,
+               "kernel_weights.c is not the gemm_5 of kernels.h");
+_Static_assert(KERNEL_ANYTIME_ROWS % KERNEL_DENSE_BLOCK == 0U && DENSE_OUT % KERNEL_ANYTIME_ROWS == 0U,
+               "steps are whole weight blocks");
+
+/**
+  * @brief Take the gemm_5 input of one image and start gemm_6 at its biases
+  * @param in DENSE_IN int8 values, the conv2d_2 output gemm_5 reads
+  * @note  gemm_6 must be the c-node after gemm_5, reading its output
+  * @retval classes, -1 if gemm_5 of the bound network is not on the kernel
+  *         or gemm_6 is quantised another way
+  */
+int Kernel_AnytimeBegin(const int8_t *in)
+{
+  ai_node *node = kernel_slots[KERNEL_DENSE].node;
+  ai_layer *head;
+  ai_tensor *hin, *hout, *hw, *hb;
+  ai_tensor_intq_info qin, qout, qw;
+  const int32_t *bias;
+  uint32_t classes;
+
+  if (!node || node->next == node)
+  {
+    return -1;
+  }
+  head = (ai_layer *)node->next;
+  hin = ai_layer_get_tensor_in(head, 0);
+  hout = ai_layer_get_tensor_out(head, 0);
+  hw = ai_layer_get_tensor_weights(head, 0);
+  hb = ai_layer_get_tensor_weights(head, 1);
+  classes = hout ? ai_tensor_get_data_size(hout) : 0U;
+  if (!hin || ai_tensor_get_data(hin).s8 != ai_tensor_get_data(ai_layer_get_tensor_out((ai_layer *)node, 0)).s8 ||
+      classes == 0U || classes > MODEL_OUT_MAX ||
+      !hw || ai_tensor_get_data_byte_size(hw) != classes * DENSE_OUT ||
+      !hb || ai_tensor_get_data_size(hb) != classes ||
+      !ai_tensor_has_intq(hin) || !ai_tensor_has_intq(hout) || !ai_tensor_has_intq(hw))
+  {
+    return -1;
+  }
+  qin = ai_tensor_get_intq(hin);
+  qout = ai_tensor_get_intq(hout);
+  qw = ai_tensor_get_intq(hw);
+  if (qin.zeropoint_s8[0] != KERNEL_ZP || (qw.size != 1U && qw.size != classes))
+  {
+    return -1;
+  }
+
+  bias = ai_tensor_get_data(hb).s32;
+  for (uint32_t c = 0; c < classes; c++)
+  {
+    if (qw.zeropoint_s8[(qw.size == 1U) ? 0U : c] != 0)
+    {
+      return -1;
+    }
+    anytime_acc[c] = bias[c];
+    anytime_scale[c] = qin.scale[0] * qw.scale[(qw.size == 1U) ? 0U : c] / qout.scale[0];
+  }
+  anytime_w = ai_tensor_get_data(hw).s8;
+  anytime_classes = classes;
+  Kernel_Expand(anytime_col, (const uint8_t *)in, DENSE_IN);
+  return (int)classes;
+}
+
+/**
+  * @brief Run gemm_5 rows [step, step + 1) x KERNEL_ANYTIME_ROWS and add
+  *        them to gemm_6
+  * @note  Rows not run count as ReLU zeros. The lead is settled when no
+  *        value of theirs, 0 to 255 above the zero point, could close it
+  * @param margin lead of the best class over the runner-up, in gemm_6
+  *        output LSBs, saturated
+  * @retval the best class so far
+  */
+int Kernel_AnytimeStep(uint32_t step, uint8_t *margin, uint8_t *settled)
+{
+  const int32_t *bias = ai_tensor_get_data(ai_layer_get_tensor_weights((ai_layer *)kernel_slots[KERNEL_DENSE].node, 1)).s32;
+  uint32_t r0 = step * KERNEL_ANYTIME_ROWS;
+  const uint32_t *w = &kernel_gemm_5_blocked[(r0 / KERNEL_DENSE_BLOCK) * DENSE_WORDS * KERNEL_DENSE_BLOCK];
+  int32_t h[KERNEL_ANYTIME_ROWS];
+  uint32_t best = 0;
+  float top = -3.4e38f, second = -3.4e38f, lead;
+
+  for (uint32_t r = 0; r < KERNEL_ANYTIME_ROWS; r += KERNEL_DENSE_BLOCK)
+  {
+    int32_t a[KERNEL_DENSE_BLOCK] = { bias[r0 + r], bias[r0 + r + 1], bias[r0 + r + 2], bias[r0 + r + 3] };
+
+    for (uint32_t k = 0; k < DENSE_WORDS; k++)
+    {
+      Dense_Block(a, w, &anytime_col[2 * k]);
+      w += KERNEL_DENSE_BLOCK;
+    }
+    for (uint32_t i = 0; i < KERNEL_DENSE_BLOCK; i++)
+    {
+      h[r + i] = Kernel_Requant(a[i], dense_mult[KERNEL_QUANT_CH(r0 + r + i)],
+                               dense_shift[KERNEL_QUANT_CH(r0 + r + i)]) - KERNEL_ZP;
+    }
+  }
+
+  for (uint32_t c = 0; c < anytime_classes; c++)
+  {
+    const int8_t *wc = &anytime_w[c * DENSE_OUT + r0];
+    float score;
+
+    for (uint32_t i = 0; i < KERNEL_ANYTIME_ROWS; i++)
+    {
+      anytime_acc[c] += h[i] * wc[i];
+    }
+    score = (float)anytime_acc[c] * anytime_scale[c];
+    if (score > top)
+    {
+      second = top;
+      top = score;
+      best = c;
+    }
+    else if (score > second)
+    {
+      second = score;
+    }
+  }
+
+  lead = top - second;
+  *margin = (lead >= 255.0f) ? 255U : (uint8_t)lead;
+  *settled = 1;
+  for (uint32_t c = 0; c < anytime_classes && *settled; c++)
+  {
+    const int8_t *wb = &anytime_w[best * DENSE_OUT];
+    const int8_t *wc = &anytime_w[c * DENSE_OUT];
+    float swing = 0.0f;
+
+    if (c == best)
+    {
+      continue;
+    }
+    // Most the rows left could move class c up against the best
+    for (uint32_t i = r0 + KERNEL_ANYTIME_ROWS; i < DENSE_OUT; i++)
+    {
+      float d = (float)wc[i] * anytime_scale[c] - (float)wb[i] * anytime_scale[best];
+      if (d > 0.0f)
+      {
+        swing += d;
+      }
+    }
+    if (swing * 255.0f >= top - (float)anytime_acc[c] * anytime_scale[c])
+    {
+      *settled = 0;
+    }
+  }
+  return (int)best;
+}
+#endif /* APP_ANYTIME */
+
+#if APP_STRIP
+/* Strip ---------------------------------------------------------------------*/
+#define STRIP_POOL0_W           ((APP_STRIP - 2U) / 2U)  // pooled conv2d_0 columns of the widest strip
+#define STRIP_POOL_W            ((STRIP_POOL0_W - 2U) / 2U)
+
+// The strip as the input tensor would hold it, then conv2d_2's output:
+// conv2d_0 has read the first before conv2d_2 writes the second
+static union {
+  uint8_t in[CONV0_IN_W * APP_STRIP];
+  int8_t conv[CONV_POOL_W * STRIP_POOL_W * CONV_OUT_C];
+} strip;
+static int8_t strip_conv0[CONV0_POOL_W * STRIP_POOL0_W * CONV0_OUT_C];
+static uint32_t strip_cols;             // pooled conv2d_2 columns of the last strip
+
+/**
+  * @brief Run conv2d_0 and conv2d_2 once over a 28 x w uint8 strip
+  * @note  Runs conv2d_2 in its scratch0: call only while no inference is in
+  *        flight. Kernel_StripWindow() then hands out the conv2d_2 output of
+  *        each 28x28 window at a multiple of 4 pixels
+  * @retval pooled conv2d_2 columns, 0 if w does not fit or the active
+  *         network is not on both conv kernels
+  */
+uint32_t Kernel_Strip(const uint8_t *img, uint32_t w)
+{
+  ai_layer *conv0 = (ai_layer *)kernel_slots[KERNEL_CONV0].node;
+  ai_layer *conv = (ai_layer *)kernel_slots[KERNEL_CONV].node;
+  uint32_t pool0_w = (w - 2U) / 2U;
+
+  strip_cols = 0;
+  if (!conv0 || !conv || w < CONV0_IN_W || w > APP_STRIP)
+  {
+    return 0;
+  }
+
+  // The input tensor holds x - 128, which is x ^ 0x80
+  for (uint32_t i = 0; i < CONV0_IN_W * w; i++)
+  {
+    strip.in[i] = img[i] ^ 0x80U;
+  }
+  Conv0_Tiles(ai_tensor_get_data(ai_layer_get_tensor_weights(conv0, 1)).s32, strip.in, w,
+              strip_conv0, pool0_w, 0, CONV0_POOL_W - 1, 0, pool0_w - 1);
+
+  // scratch0 holds the patches of CONV_POOL_W pooled columns at a time
+  strip_cols = (pool0_w - 2U) / 2U;
+  for (uint32_t px = 0; px < strip_cols; px += CONV_POOL_W)
+  {
+    uint32_t px1 = (px + CONV_POOL_W < strip_cols) ? px + CONV_POOL_W - 1 : strip_cols - 1;
+
+    Conv_Tiles(conv, (const uint8_t *)strip_conv0, pool0_w, strip.conv, strip_cols,
+               0, CONV_POOL_W - 1, px, px1);
+  }
+  return strip_cols;
+}
+
+/**
+  * @brief conv2d_2 output of the window at pixel 4 * col of the last strip
+  * @param out KERNEL_STRIP_FEATURES bytes, laid out as conv2d_2 writes them
+  */
+void Kernel_StripWindow(uint32_t col, int8_t *out)
+{
+  for (uint32_t y = 0; y < CONV_POOL_W; y++)
+  {
+    memcpy(&out[y * CONV_POOL_W * CONV_OUT_C], &strip.conv[(y * strip_cols + col) * CONV_OUT_C],
+           CONV_POOL_W * CONV_OUT_C);
+  }
+}
+#endif /* APP_STRIP */
+#endif /* KERNEL_ANY */
+
+/**
+  * @brief Replace library layers of a created network with the kernels here
+  * @note  Called on every bind; each kernel takes the first layer it matches
+  * @retval number of layers running a custom kernel
+  */
+int Kernel_Install(ai_handle network)
+{
+  int installed = 0;
+#if KERNEL_ANY
+  ai_network *net = AI_NETWORK_ACQUIRE_CTX(network);
+  ai_node *node = net ? net->input_node : NULL;
+
+  for (uint32_t i = 0; i < KERNEL_COUNT; i++)
+  {
+    kernel_slots[i].node = NULL;
+  }
+#if APP_KERNEL_INCREMENTAL
+  Kernel_Invalidate();
+#endif
+
+  for (uint32_t n = 0; node && n < MODEL_MAX_NODES; n++)
+  {
+    for (uint32_t i = 0; i < KERNEL_COUNT; i++)
+    {
+      KernelSlot_t *slot = &kernel_slots[i];
+
+      if (!slot->kernel)
+      {
+        continue;
+      }
+      // Swapped on an earlier bind: match again, another model may have
+      // replaced the requantisation parameters since
+      if (node->forward == slot->kernel)
+      {
+        node->forward = slot->lib;
+      }
+      if (!slot->node && node->forward == slot->lib && slot->match(node))
+      {
+        node->forward = slot->kernel;
+        slot->node = node;
+        installed++;
+      }
+    }
+    // The last layer links to itself
+    node = (node->next == node) ? NULL : node->next;
+  }
+#else
+  (void)network;
+#endif
+  return installed;
+}
+
+/**
+  * @brief Quantisation of the scores when the softmax is bypassed
+  * @param scale, zero_point of the logits, either may be NULL
+  * @retval 1 if the bound network returns logits
+  */
+int Kernel_Logits(float *scale, int8_t *zero_point)
+{
+#if APP_SOFTMAX_BYPASS
+  ai_node *node = kernel_slots[KERNEL_SOFTMAX].node;
+  ai_tensor_intq_info q;
+
+  if (node)
+  {
+    q = ai_tensor_get_intq(GET_TENSOR_IN(node->tensors, 0));
+    if (scale) *scale = q.scale[0];
+    if (zero_point) *zero_point = q.zeropoint_s8[0];
+    return 1;
+  }
+#else
+  (void)scale;
+  (void)zero_point;
+#endif
+  return 0;
+}
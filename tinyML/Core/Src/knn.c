@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file           : knn.c
+  * @brief          : Nearest-neighbour head over enrolled embeddings
+  ******************************************************************************
+  */
+
+#include "knn.h"
+#include <string.h>
+#include "main.h"
+
+#if APP_KNN
+#define KNN_WORDS               (KNN_DIM / 4U)
+
+// Enrolled embeddings, each value + 128 so __USADA8 can take them unsigned
+static uint32_t knn_table[APP_KNN][KNN_WORDS];
+static uint8_t knn_labels[APP_KNN];
+static uint8_t knn_count;
+static uint8_t knn_words;               // words per entry, of the enrolled model
+static uint8_t knn_model;
+
+/**
+  * @brief Embedding as table words: 4 values a word, each + 128
+  */
+static void Knn_Pack(uint32_t *out, const int8_t *v, uint32_t words)
+{
+  for (uint32_t i = 0; i < words; i++)
+  {
+    out[i] = __UNALIGNED_UINT32_READ(&v[4 * i]) ^ 0x80808080U;
+  }
+}
+
+/**
+  * @brief Add a labelled embedding of model, emptying a table of another model
+  * @retval entries after, -1 if the table is full or size is not 4 to KNN_DIM by 4
+  */
+int Knn_Enroll(uint8_t model, const int8_t *v, uint32_t size, uint8_t label)
+{
+  if (size == 0 || size > KNN_DIM || (size & 3U))
+  {
+    return -1;
+  }
+  if (knn_count && (knn_model != model || knn_words != size / 4U))
+  {
+    Knn_Clear();
+  }
+  if (knn_count >= APP_KNN)
+  {
+    return -1;
+  }
+
+  knn_model = model;
+  knn_words = (uint8_t)(size / 4U);
+  Knn_Pack(knn_table[knn_count], v, knn_words);
+  knn_labels[knn_count] = label;
+  return ++knn_count;
+}
+
+/**
+  * @brief Label of the enrolled embedding nearest to v, by L1 distance
+  * @param distance gets that distance
+  * @retval the label, -1 if nothing was enrolled for model at this size
+  */
+int Knn_Nearest(uint8_t model, const int8_t *v, uint32_t size, uint32_t *distance)
+{
+  uint32_t query[KNN_WORDS];
+  uint32_t best = UINT32_MAX;
+  int label = -1;
+
+  if (!knn_count || knn_model != model || size != knn_words * 4U)
+  {
+    return -1;
+  }
+
+  Knn_Pack(query, v, knn_words);
+  for (uint32_t e = 0; e < knn_count; e++)
+  {
+    const uint32_t *row = knn_table[e];
+    uint32_t d = 0;
+
+    // Sum of the four byte differences, accumulated, per instruction
+    for (uint32_t i = 0; i < knn_words; i++)
+    {
+      d = __USADA8(row[i], query[i], d);
+    }
+    if (d < best)
+    {
+      best = d;
+      label = knn_labels[e];
+    }
+  }
+  *distance = best;
+  return label;
+}
+
+/**
+  * @brief Forget every enrolled embedding
+  */
+void Knn_Clear(void)
+{
+  knn_count = 0;
+}
+
+/**
+  * @brief Enrolled embeddings
+  */
+uint8_t Knn_Count(void)
+{
+  return knn_count;
+}
+#endif /* APP_KNN */
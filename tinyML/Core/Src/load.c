@@ -0,0 +1,193 @@
+/**
+  ******************************************************************************
+  * @file           : load.c
+  * @brief          : CPU time per activity, for utilization (APP_LOAD)
+  ******************************************************************************
+  */
+
+#include "load.h"
+#include "main.h"
+#include "profile.h"
+#include <string.h>
+
+#if APP_LOAD
+// Own cycles per share since the last clock change. PROTO_LOAD_OTHER holds
+// every awake cycle, the spans are only taken out of it when read
+static uint64_t load_cycles[PROTO_LOAD_SHARES];
+// The same from before the last clock change, in microseconds
+static uint64_t load_us[PROTO_LOAD_SHARES];
+static uint32_t load_hz = 0;           // HCLK load_cycles ran at
+static uint32_t load_nested = 0;       // own cycles of every span ended, wraps
+static uint32_t load_mark = 0;         // DWT when awake cycles were last added
+static uint32_t load_since = 0;        // HAL_GetTick of the last reset
+
+/**
+  * @brief Add the awake cycles since the last call, with interrupts masked
+  */
+static void Load_Awake(void)
+{
+  uint32_t now = PROF_CYCLES();
+
+  load_cycles[PROTO_LOAD_OTHER] += now - load_mark;
+  load_mark = now;
+}
+
+/**
+  * @brief Microseconds of cycles at load_hz
+  */
+static uint64_t Load_Us(uint64_t cycles)
+{
+  return load_hz ? cycles * 1000U / (load_hz / 1000U) : 0U;
+}
+#endif
+
+/**
+  * @brief Start a span (any context)
+  */
+LoadMark_t Load_Begin(void)
+{
+  LoadMark_t mark = {0};
+#if APP_LOAD
+  uint32_t primask = __get_PRIMASK();
+
+  // Both at once: a handler between the two reads would count twice
+  __disable_irq();
+  mark.start = PROF_CYCLES();
+  mark.nested = load_nested;
+  __set_PRIMASK(primask);
+#endif
+  return mark;
+}
+
+/**
+  * @brief End a span, its cycles less those of the spans it contained go to span
+  */
+void Load_End(const LoadMark_t *mark, uint8_t span)
+{
+#if APP_LOAD
+  uint32_t primask = __get_PRIMASK();
+  uint32_t own;
+
+  __disable_irq();
+  own = (PROF_CYCLES() - mark->start) - (load_nested - mark->nested);
+  load_cycles[span] += own;
+  load_nested += own;
+  __set_PRIMASK(primask);
+#else
+  (void)mark;
+  (void)span;
+#endif
+}
+
+/**
+  * @brief SysTick: add the awake cycles of the last millisecond
+  * @note  Often enough that the 32-bit counter cannot wrap in between
+  */
+void Load_Tick(void)
+{
+#if APP_LOAD
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  Load_Awake();
+  __set_PRIMASK(primask);
+#endif
+}
+
+/**
+  * @brief HCLK changed: bank the cycles so far at the old clock
+  */
+void Load_ClockChanged(void)
+{
+#if APP_LOAD
+  uint32_t primask = __get_PRIMASK();
+  uint8_t k;
+
+  __disable_irq();
+  Load_Awake();
+  for (k = 0; k < PROTO_LOAD_SHARES; k++)
+  {
+    load_us[k] += Load_Us(load_cycles[k]);
+    load_cycles[k] = 0;
+  }
+  load_hz = HAL_RCC_GetHCLKFreq();
+  __set_PRIMASK(primask);
+#endif
+}
+
+/**
+  * @brief Shares of the time since the last reset, then optionally reset
+  * @param window_ms time the shares cover, NULL to only reset
+  * @param shares PROTO_LOAD_SHARES entries in 1/10000 of window_ms
+  */
+void Load_Get(uint32_t *window_ms, uint16_t *shares, uint8_t reset)
+{
+#if APP_LOAD
+  uint32_t primask = __get_PRIMASK();
+  uint64_t us[PROTO_LOAD_SHARES];
+  uint64_t window, spans = 0;
+  uint8_t k;
+
+  __disable_irq();
+  Load_Awake();
+  if (window_ms)
+  {
+    *window_ms = HAL_GetTick() - load_since;
+    window = (uint64_t)*window_ms * 1000U;
+    for (k = 0; k < PROTO_LOAD_SHARES; k++)
+    {
+      us[k] = load_us[k] + Load_Us(load_cycles[k]);
+      if (k != PROTO_LOAD_OTHER)
+      {
+        spans += us[k];
+      }
+    }
+    // Asleep is the time the cycle counter did not see
+    if (window > us[PROTO_LOAD_OTHER])
+    {
+      us[PROTO_LOAD_IDLE] += window - us[PROTO_LOAD_OTHER];
+    }
+    us[PROTO_LOAD_OTHER] = (us[PROTO_LOAD_OTHER] > spans) ? us[PROTO_LOAD_OTHER] - spans : 0U;
+    for (k = 0; k < PROTO_LOAD_SHARES; k++)
+    {
+      shares[k] = window ? (uint16_t)((us[k] >= window) ? 10000U : us[k] * 10000U / window) : 0U;
+    }
+  }
+  if (reset)
+  {
+    memset(load_cycles, 0, sizeof(load_cycles));
+    memset(load_us, 0, sizeof(load_us));
+    load_hz = HAL_RCC_GetHCLKFreq();
+    load_since = HAL_GetTick();
+  }
+  __set_PRIMASK(primask);
+#else
+  if (window_ms)
+  {
+    *window_ms = 0;
+    memset(shares, 0, PROTO_LOAD_SHARES * sizeof(shares[0]));
+  }
+  (void)reset;
+#endif
+}
+
+/**
+  * @brief Microseconds awake outside the idle span since the last reset
+  * @note  0 without APP_LOAD
+  */
+uint64_t Load_BusyUs(void)
+{
+#if APP_LOAD
+  uint32_t primask = __get_PRIMASK();
+  uint64_t awake, idle;
+
+  __disable_irq();
+  Load_Awake();
+  awake = load_us[PROTO_LOAD_OTHER] + Load_Us(load_cycles[PROTO_LOAD_OTHER]);
+  idle = load_us[PROTO_LOAD_IDLE] + Load_Us(load_cycles[PROTO_LOAD_IDLE]);
+  __set_PRIMASK(primask);
+  return (awake > idle) ? awake - idle : 0U;
+#else
+  return 0U;
+#endif
+}
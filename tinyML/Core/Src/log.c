@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file           : log.c
+  * @brief          : Deferred, tokenized log of device events (LOG)
+  ******************************************************************************
+  */
+
+#include "log.h"
+#include "main.h"
+#include <string.h>
+
+#if APP_LOG
+// Written from the RX and USB interrupts too, every access is masked
+static ProtoLogRecord_t log_ring[APP_LOG];
+static uint16_t log_head = 0;          // oldest record
+static uint16_t log_count = 0;
+static uint16_t log_lost = 0;
+
+/**
+  * @brief Store one record (any context)
+  * @note  A full ring keeps its records and counts the new one as lost: the
+  *        first of a burst of errors is usually the one that explains it
+  */
+void Log_Write(LogEvent_t id, uint32_t a, uint32_t b)
+{
+  uint32_t primask = __get_PRIMASK();
+  ProtoLogRecord_t *rec;
+
+  __disable_irq();
+  if (log_count >= APP_LOG)
+  {
+    if (log_lost != UINT16_MAX)
+    {
+      log_lost++;
+    }
+    __set_PRIMASK(primask);
+    return;
+  }
+
+  rec = &log_ring[(log_head + log_count) % APP_LOG];
+  log_count++;
+  rec->tick = HAL_GetTick();
+  rec->id = (uint8_t)id;
+  memset(rec->reserved, 0, sizeof(rec->reserved));
+  rec->arg[0] = a;
+  rec->arg[1] = b;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief Move up to max of the oldest records out of the ring
+  * @retval number of records copied, also in header->count
+  */
+uint8_t Log_Drain(ProtoLogHeader_t *header, ProtoLogRecord_t *records, uint8_t max)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint8_t n = 0;
+
+  memset(header, 0, sizeof(*header));
+
+  __disable_irq();
+  while (n < max && log_count > 0)
+  {
+    records[n++] = log_ring[log_head];
+    log_head = (uint16_t)((log_head + 1U) % APP_LOG);
+    log_count--;
+  }
+  header->lost = log_lost;
+  log_lost = 0;
+  __set_PRIMASK(primask);
+
+  header->count = n;
+  return n;
+}
+#endif
@@ -24,18 +24,56 @@
 #include "ai_platform.h"
 #include "network.h"
 #include "network_data.h"
+#include "protocol.h"
+#include "app_config.h"
+#include "host_uart.h"
+#include "usb_link.h"
+#include "spi_link.h"
+#include "uart_link.h"
+#include "profile.h"
+#include "clock.h"
+#include "image_pack.h"
+#include "image_crop.h"
+#include "memstat.h"
+#include "stats.h"
+#include "boot.h"
+#include "models.h"
+#include "kernels.h"
+#include "test_vectors.h"
+#include "memo.h"
+#include "upload.h"
+#include "xflash.h"
+#include "split.h"
+#include "knn.h"
+#include "config.h"
+#include "energy.h"
+#include "load.h"
+#include "cmsisnn.h"
+#include "stai_app.h"
+#include "trace.h"
+#include "log.h"
+#include "dma_copy.h"
+#include "irqlat.h"
+#include "heads.h"
+#include "stamp.h"
+#include "telemetry.h"
+#include "admission.h"
+#include "preprocess.h"
+#include "tta.h"
+#if APP_RTOS
+#include "cmsis_os2.h"
+#endif
+#if APP_UART_LL
+#include "stm32f4xx_ll_dma.h"
+#include "stm32f4xx_ll_usart.h"
+#endif
 #include <string.h>
-#include <stdio.h>
+#include <stddef.h>
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN PTD */
-typedef enum {
-  STATE_IDLE,
-  STATE_WAIT_START,
-  STATE_RECEIVE_IMAGE,
-  STATE_PROCESS_IMAGE
-} AppState_t;
+
 /* USER CODE END PTD */
 
 /* Private define ------------------------------------------------------------*/
@@ -43,6 +81,11 @@ typedef enum {
 // LED configuration - PD13
 #define LED_PIN GPIO_PIN_13
 #define LED_GPIO_PORT GPIOD
+
+// Boot baud rate; a negotiated rate must be confirmed at the new speed
+#define UART_DEFAULT_BAUD 115200U
+#define UART_MAX_BAUD_ERROR_PERMILLE 20U
+#define BAUD_CONFIRM_MS 1000U
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -52,190 +95,5188 @@ typedef enum {
 
 /* Private variables ---------------------------------------------------------*/
 UART_HandleTypeDef huart2;
+DMA_HandleTypeDef hdma_usart2_rx;
+DMA_HandleTypeDef hdma_usart2_tx;
 
 /* USER CODE BEGIN PV */
 // AI model variables
-AI_ALIGNED(4) static ai_u8 activations[AI_NETWORK_DATA_ACTIVATIONS_SIZE];
-
+// Active network; the registry (models.c) owns the handles and the arena
+static const Model_t *model = NULL;
+static uint8_t model_index = 0;
 static ai_handle network = AI_HANDLE_NULL;
 static ai_buffer *ai_input;
 static ai_buffer *ai_output;
+static uint8_t ai_model_hash[16];  // model_signature of the network report
+static uint16_t ai_num_classes = 0;
+static uint8_t ai_kernels = 0;     // layers of the active network on kernels.c
+static uint8_t ai_logits = 0;      // softmax bypassed, scores are logits
+static uint32_t ai_activations_size = 0;  // from the network report
+#if APP_MODEL_MULTIHEAD
+static uint8_t ai_heads = 1;       // outputs of the active network
+static uint8_t ai_heads_run = 1;   // mask of the outputs AI_Run computes
+#endif
+#if APP_DELTA_GATE
+// The last image ClassifyRequest ran the network on and its class, -1 for
+// none since the network was (re)initialised
+static uint8_t gate_image[MODEL_IN_SIZE] __attribute__((aligned(4)));
+static int16_t gate_class = -1;
+#endif
+static uint32_t ai_weights_size = 0;
+static uint32_t ai_macc_count = 0; // MACs per run, also from the report
+
+// Image and classification buffers, shaped by the generated model headers
+#define IMG_WIDTH MODEL_IN_WIDTH
+#define IMG_HEIGHT MODEL_IN_HEIGHT
+#define IMG_SIZE MODEL_IN_SIZE
+// Class ids travel as one byte, 0xFF marks a lost batch entry
+#define MAX_CLASSES 255
+// Scores to scan: a constant the loops unroll on when every model agrees
+#define AI_CLASSES (MODEL_CLASSES_FIXED ? (int)MODEL_OUT_MAX : (int)ai_num_classes)
+
+// Every request carries the image in one frame, the pixel loop goes by words
+_Static_assert(IMG_SIZE + sizeof(ProtoCascadeReq_t) <= PROTO_MAX_PAYLOAD, "image does not fit a frame");
+#if APP_TTA
+_Static_assert(IMG_SIZE == TTA_SIDE * TTA_SIDE, "TTA variants are of a 28x28 image");
+#endif
+_Static_assert(IMG_SIZE % 4U == 0, "image is converted 4 pixels at a time");
+_Static_assert(MODEL_OUT_MAX <= MAX_CLASSES, "class ids are one byte");
+
+// Links frames arrive on, as a mask of PROTO_LINK_* bits
+#define RX_LINKS ((1U << PROTO_LINK_UART) | \
+                  (APP_USB_CDC ? 1U << PROTO_LINK_USB : 0U) | \
+                  (APP_SPI_LINK ? 1U << PROTO_LINK_SPI : 0U) | \
+                  (APP_UART_LINKS ? (1U << PROTO_LINK_USART1) | (1U << PROTO_LINK_USART6) : 0U))
+#define RX_LINK_COUNT (1 + APP_USB_CDC + APP_SPI_LINK + 2 * APP_UART_LINKS)
+
+// Ping-pong frame slots: the ISR fills one while the main loop classifies
+// the other. Every further link adds one, kept in reserve for it while it
+// holds none (RX_SlotFree), so each can always have a frame in
+#if APP_RX_OVERLAY
+// The second of the pair is the overlay slot, in the activation arena
+#define IMG_SLOTS RX_LINK_COUNT
+#define RX_OVERLAY_SLOT IMG_SLOTS
+#define RX_SLOTS (IMG_SLOTS + 1)
+#else
+#define IMG_SLOTS (1 + RX_LINK_COUNT)
+#define RX_SLOTS IMG_SLOTS
+#endif
+// Ready queue length, a power of two so free-running indices wrap cleanly
+#define RX_READY_SIZE 8U
+_Static_assert(RX_SLOTS <= RX_READY_SIZE, "ready queue shorter than the slots");
+
+static ProtoFrame_t rx_frames[IMG_SLOTS];
+
+#if APP_RX_OVERLAY
+// Overlay slot: a CLASSIFY received into a region of the arena that the
+// running inference no longer uses from c-node rx_overlay_from on
+// (overlay_plan.h), processed next, before the arena is used again
+static ProtoFrame_t *rx_overlay = NULL;        // the frame while the slot is busy
+static uint8_t *rx_overlay_region = NULL;      // where it goes for the bound model
+static int rx_overlay_from = -1;               // c-node it opens at, -1 never
+static volatile uint8_t rx_overlay_armed = 0;  // a CLASSIFY is running
+static volatile uint8_t rx_overlay_open = 0;   // and is past rx_overlay_from
+#endif
+
+// UART reception variables
+// USART2 RX runs as circular DMA into a single-producer/single-consumer ring:
+// HT/TC/IDLE events publish the byte count, the main loop parses the bytes.
+// The ring must hold everything that arrives during one inference: with
+// both slots busy, one full size CLASSIFY_CROP frame.
+#define UART_RX_DMA_SIZE 4096U
+
+static uint8_t uart_rx_dma[UART_RX_DMA_SIZE] __attribute__((section(".noinit")));
+static uint16_t uart_rx_isr_pos = 0;           // ISR: DMA index at the last event
+static volatile uint32_t uart_rx_written = 0;  // ISR: bytes since the last restart
+static volatile uint8_t uart_rx_epoch = 0;     // ISR/main: bumped on every restart
+static uint32_t uart_rx_read = 0;              // main: bytes consumed
+static uint16_t uart_rx_tail = 0;              // main: next index to parse
+static uint8_t uart_rx_seen_epoch = 0;         // main
+static ProtoParser_t rx_parser;
+
+#if APP_USB_CDC
+// CDC OUT packets are parsed into the same slots as USART2 frames
+static ProtoParser_t usb_parser;
+#endif
+#if APP_SPI_LINK
+// As are SPI2 transfers from an SPI master
+static ProtoParser_t spi_parser;
+#endif
+#if APP_UART_LINKS
+// And the sessions on USART1 and USART6, in UART_LINK_* order
+static ProtoParser_t uart_link_parsers[UART_LINK_PORTS];
+#endif
+
+// Cycle count at each slot's last byte, for the STATS frame histogram
+static uint32_t slot_stamp[RX_SLOTS];
+#if APP_TIMESTAMPS
+// The same in Stamp_Us time, for the reply's ProtoStamp_t
+static uint32_t slot_us[RX_SLOTS];
+#endif
+
+// Ready queue of filled slots; tail is only written by the ISR, head by main()
+static volatile uint8_t slot_busy[RX_SLOTS];
+static volatile uint8_t slot_link[RX_SLOTS];  // PROTO_LINK_* of a busy slot
+#if APP_DMA_COPY
+// Payload copies of each slot still on DMA2 (RX_CopyPayload)
+static volatile uint8_t slot_copies[RX_SLOTS];
+#endif
+static volatile uint8_t ready_fifo[RX_READY_SIZE];
+static volatile uint8_t ready_head = 0;
+static volatile uint8_t ready_tail = 0;
+
+#if APP_ARENA_SLOTS > 1
+// ready_fifo entry of an image staged in arena n instead of a frame slot
+#define RX_STAGED 0x80U
+
+// Images already in the input tensor of an idle arena (AI_Stage); their
+// frame slots are free again
+typedef struct {
+  int8_t *input;                       // the model's input in that arena when staged
+  uint32_t stamp;                      // slot_stamp of the frame
+#if APP_MEMO
+  uint32_t key;
+#endif
+  uint8_t model;                       // model_index when staged
+  uint8_t type;                        // PROTO_CMD_CLASSIFY or PROTO_CMD_BATCH_IMAGE
+  uint8_t seq;
+  uint8_t link;
+} Staged_t;
+
+static Staged_t staged[APP_ARENA_SLOTS];
+static uint8_t staged_mask = 0;        // arenas holding a staged image
+#endif
+
+// Errors raised while receiving, reported from the main loop. Producers
+// mask interrupts to push, head is only written by main(); when full,
+// further events are counted in rx_err_lost.
+#define RX_ERR_QUEUE_SIZE 8U
+
+typedef struct {
+  uint8_t link;
+  uint8_t type;                        // request type, 0 for line errors
+  uint8_t seq;
+  uint8_t error;                       // ProtoError_t
+  uint8_t detail;                      // HAL_UART_ERROR_* bits for PROTO_ERR_UART
+} RxErrorEvent_t;
+
+static RxErrorEvent_t rx_err_queue[RX_ERR_QUEUE_SIZE];
+static volatile uint8_t rx_err_head = 0;
+static volatile uint8_t rx_err_tail = 0;
+static volatile uint32_t rx_err_lost = 0;
+
+// Reception could not be restarted from interrupt context, retry in main()
+static volatile uint8_t rx_error = 0;
+
+// Batch in progress: images arrive as BATCH_IMAGE frames, one reply at the end
+static uint8_t batch_open = 0;
+static uint8_t batch_seq = 0;
+static uint8_t batch_count = 0;
+static uint8_t batch_done = 0;
+static uint32_t batch_seen[(PROTO_MAX_BATCH + 31) / 32];
+static uint8_t batch_results[PROTO_MAX_BATCH];
+#if APP_BATCH_DENSE
+// Batch images whose convs ran, waiting for the batched gemm_5
+static uint8_t batch_stack[APP_BATCH_DENSE];
+static uint8_t batch_stacked = 0;
+// Their gemm_5 outputs, and those of CLASSIFY_TTA variants
+static int8_t batch_dense_out[APP_BATCH_DENSE * KERNEL_DENSE_OUTPUTS];
+#if APP_MEMO
+static uint32_t batch_keys[APP_BATCH_DENSE];
+#endif
+#endif
+
+#if APP_CANCEL
+// Slots holding a CANCEL not yet processed, set on arrival. Its request may
+// be queued ahead of it or running, both check here
+static volatile uint8_t cancel_slots = 0;
+_Static_assert(RX_SLOTS <= 8U, "cancel_slots is a byte mask");
+// Request being processed, NULL between frames
+static const ProtoFrame_t *volatile ai_frame = NULL;
+// The request was cancelled while running: its run finishes, but the
+// result is dropped and no further run starts. Errors read CANCELLED
+static volatile uint8_t ai_cancelled = 0;
+#endif
+
+// Network run in progress, RX callbacks keep off the kernel caches
+static volatile uint8_t ai_running = 0;
+#if APP_LOAD
+// Span of the run
+static LoadMark_t ai_load_mark;
+#endif
+#if APP_DETERMINISTIC
+// Runs hold interrupts off; WCET clears it for PROTO_WCET_OPEN
+static uint8_t ai_quiet = 1;
+static uint32_t ai_quiet_start = 0;     // DWT when the run went quiet
+static uint32_t ai_quiet_val = 0;       // SysTick->VAL then
+#endif
+
+// Baud switch waiting for a valid frame at the new speed
+static uint8_t baud_pending = 0;
+static uint32_t baud_switch_tick = 0;
+#if APP_LINK_FALLBACK_PERMILLE
+// Intact frames and CRC or line errors on USART2 in the current link
+// quality window; the RX callbacks count, UART_LinkQuality judges
+static volatile uint16_t linkq_frames = 0;
+static volatile uint16_t linkq_errors = 0;
+#endif
+#if APP_CONFIG
+// USART2 came up at the CONFIG rate and has not received an intact frame
+static uint8_t baud_saved = 0;
+static uint8_t config_applied = 0;
+#endif
+
+// Tick of the last USART2 RX event, for the STOP mode inactivity timeout
+static volatile uint32_t rx_activity_tick = 0;
+#if APP_IDLE_STOP_MS
+// Cleared by ENERGY for workloads whose gaps are too short to pay for STOP
+static uint8_t idle_stop = 1;
+#endif
+
+// Response frames are built here (largest reply payload + framing)
+#define TX_MAX_PAYLOAD PROTO_MAX_REPLY
+#if !APP_RTOS
+static uint8_t tx_frame[TX_MAX_PAYLOAD + PROTO_OVERHEAD] __attribute__((section(".noinit")));
+#endif
+
+// USART2 TX ring drained by DMA; head is only written by main(), tail and
+// tx_inflight by the TX complete interrupt (indices are free-running)
+#define TX_RING_SIZE 1024U
+#define TX_TIMEOUT_MS 1000U
+
+static uint8_t tx_ring[TX_RING_SIZE] __attribute__((section(".noinit")));
+static volatile uint16_t tx_head = 0;
+static volatile uint16_t tx_tail = 0;
+static volatile uint16_t tx_inflight = 0;
+#if APP_PROFILE
+static volatile uint32_t tx_start_cycles = 0;
+// USART2 interrupt cycles and RX bytes since the last CLASSIFY_PROF reply
+static volatile uint32_t uart_isr_cycles = 0;
+static volatile uint32_t uart_isr_bytes = 0;
+#endif
+static uint8_t tx_link = PROTO_LINK_UART;
+#if APP_SPLIT_LINK
+// Link of the last forwarded STAGE, the back board's replies go there
+static uint8_t split_reply_link = PROTO_LINK_UART;
+#endif
+
+#if APP_PROFILE
+// Stage timings of the last classification and of the last reply sent
+static ProtoProfile_t prof;
+#endif
+
+// AI_RunAsync request: busy is set by the submitter, cleared by PendSV
+static volatile uint8_t ai_async_busy = 0;
+static volatile int ai_async_status = 0;
+static void (*volatile ai_async_done)(int status) = NULL;
+
+#if APP_RTOS
+// Task wake-ups, as thread flags
+#define RTOS_FLAG_RX     0x01U   // rx task: DMA published bytes, or a slot was freed
+#define RTOS_FLAG_WORK   0x01U   // inference task: a frame or a receive error is queued
+#define RTOS_POLL_MS     10U     // rx and tx housekeeping period
+// Inference task wait for work; with telemetry it polls for pushes
+#if APP_TELEMETRY
+#define RTOS_WORK_WAIT   RTOS_POLL_MS
+#else
+#define RTOS_WORK_WAIT   osWaitForever
+#endif
+
+// Encoded replies, passed to the tx task by index
+#define TX_FRAMES 2U
+
+typedef struct {
+  uint8_t link;
+  uint16_t len;
+  uint8_t data[TX_MAX_PAYLOAD + PROTO_OVERHEAD];
+} TxFrame_t;
+
+static TxFrame_t tx_frames[TX_FRAMES];
+static osMessageQueueId_t ready_queue;   // rx -> inference: rx_frames slots
+static osMessageQueueId_t priority_queue; // the same for PROTO_PRIORITY_FLAG frames, taken first
+static osMessageQueueId_t tx_queue;      // inference -> tx: tx_frames entries to send
+static osMessageQueueId_t tx_free;       // tx -> inference: tx_frames entries sent
+static osThreadId_t rx_task;
+static osThreadId_t infer_task;
+static osThreadId_t tx_task;
+#if APP_WATCHDOG_MS
+static volatile uint8_t infer_busy = 0;  // inference task is on a frame ...
+static volatile uint32_t infer_tick = 0; // ... since this tick
+#endif
+#endif
+/* USER CODE END PV */
+
+/* Private function prototypes -----------------------------------------------*/
+void SystemClock_Config(void);
+static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
+static void MX_USART2_UART_Init(void);
+/* USER CODE BEGIN PFP */
+void UART_StartReception(void);
+void UART_PollReception(void);
+static uint32_t UART_CheckBaud(uint32_t baud, uint32_t *oversampling);
+static int UART_ApplyBaud(uint32_t baud);
+#if APP_LINK_FALLBACK_PERMILLE
+static void UART_LinkError(void);
+static void UART_LinkQuality(void);
+#endif
+void ProcessSetBaud(const ProtoFrame_t *frame);
+void ProcessSetClock(const ProtoFrame_t *frame);
+static ProtoFrame_t *RX_ClaimFrame(ProtoParser_t *parser);
+static uint8_t UART_TakeRestart(void);
+static inline uint8_t RX_SlotIdle(uint8_t slot);
+static inline ProtoFrame_t *RX_Frame(uint8_t slot);
+static inline uint8_t RX_Slot(const ProtoFrame_t *frame);
+#if APP_RX_OVERLAY
+static uint8_t RX_OverlayTakes(const uint8_t *hdr);
+static uint8_t UART_OverlayNext(uint32_t avail);
+#endif
+#if APP_ADMISSION
+static uint8_t UART_RefuseNext(uint32_t avail);
+static uint8_t RX_Ahead(void);
+#endif
+static uint8_t RX_SlotFree(const ProtoParser_t *parser);
+static void RX_FrameComplete(ProtoParser_t *parser, ProtoFrame_t *frame);
+static void RX_FrameDropped(ProtoParser_t *parser, uint8_t type, uint8_t seq, ProtoError_t error);
+#if APP_STREAM
+static void RX_FrameProgress(ProtoParser_t *parser, ProtoFrame_t *frame, uint16_t from, uint16_t to);
+#endif
+static void RX_PostError(uint8_t link, uint8_t type, uint8_t seq, ProtoError_t error, uint8_t detail);
+#if APP_DMA_COPY
+static int RX_CopyPayload(ProtoParser_t *parser, ProtoFrame_t *frame, uint8_t *dst, const uint8_t *src, uint16_t len);
+static void RX_CopyDone(void *arg);
+#endif
+static void RX_CopyWait(const ProtoFrame_t *frame);
+static void UART_RxEvent(uint16_t Size);
+static void UART_StopReception(void);
+#if APP_RX_FRAME_TIMEOUT_MS
+static void UART_FrameTimeout(void);
+#endif
+#if APP_SPI_LINK || APP_UART_LINKS
+static void RX_ReleaseFrame(ProtoFrame_t *frame);
+static void RX_LinkNotify(void);
+static void RX_PollLinks(void);
+#endif
+void ProcessRxErrors(void);
+int AI_Init(uint8_t index);
+int8_t *AI_InputBuffer(void);
+const int8_t *AI_OutputBuffer(void);
+int AI_Run(void);
+#if APP_DETERMINISTIC
+static void AI_QuietBegin(void);
+static void AI_QuietEnd(void);
+#endif
+int AI_RunAsync(void (*done)(int status));
+uint8_t AI_RunBusy(void);
+#if APP_STAI
+static void AI_OnNodeEvent(void *cookie, const stai_event_type event_type, const void *event_payload);
+#endif
+void ProcessFrame(const ProtoFrame_t *frame);
+int ClassifyImage(const uint8_t *img);
+static int ClassifyRequest(const uint8_t *img, uint8_t *flags);
+int ClassifyInput(void);
+void ProcessInference(const ProtoFrame_t *frame);
+#if APP_ARENA_SLOTS > 1
+static void AI_Stage(void);
+static void AI_RunStaged(uint8_t arena);
+#endif
+void ProcessProfiledInference(const ProtoFrame_t *frame);
+void ProcessTopK(const ProtoFrame_t *frame);
+void ProcessPackedInference(const ProtoFrame_t *frame);
+void ProcessCropInference(const ProtoFrame_t *frame);
+void ProcessSmallInference(const ProtoFrame_t *frame);
+#if APP_ANYTIME
+void ProcessAnytime(const ProtoFrame_t *frame);
+#endif
+#if APP_TTA
+void ProcessTta(const ProtoFrame_t *frame);
+static int TtaVote(const uint8_t *img, uint8_t count, ProtoTta_t *reply);
+#endif
+void SendCapabilities(uint8_t seq);
+void SendMemStats(uint8_t seq);
+void SendLog(uint8_t seq);
+#if APP_CANCEL
+void ProcessCancel(const ProtoFrame_t *frame);
+static uint8_t RX_Cancelled(const ProtoFrame_t *frame);
+#endif
+void ProcessStats(const ProtoFrame_t *frame);
+#if APP_TIMESTAMPS
+void ProcessClockSync(const ProtoFrame_t *frame);
+#endif
+#if APP_TELEMETRY
+void ProcessTelemetry(const ProtoFrame_t *frame);
+static void TelemetryPush(void);
+#endif
+void ProcessFlash(const ProtoFrame_t *frame);
+void ProcessSelfTest(const ProtoFrame_t *frame);
+#if APP_WCET
+void ProcessWcet(const ProtoFrame_t *frame);
+#endif
+#if APP_IRQ_LATENCY
+void ProcessIrqLatency(const ProtoFrame_t *frame);
+#endif
+#if APP_ENERGY
+void ProcessEnergy(const ProtoFrame_t *frame);
+#endif
+void ProcessSelectModel(const ProtoFrame_t *frame);
+#if APP_UPLOAD
+void ProcessUpload(const ProtoFrame_t *frame);
+#endif
+#if APP_WEIGHT_CHECK
+static int AI_CheckWeights(void);
+#endif
+#if APP_SPLIT
+void ProcessStage(const ProtoFrame_t *frame);
+#endif
+#if APP_SPLIT_LINK
+static void ProcessStageReply(const ProtoFrame_t *frame);
+#endif
+#if APP_STRIP
+void ProcessStrip(const ProtoFrame_t *frame);
+#endif
+#if APP_EMBED
+void ProcessEmbed(const ProtoFrame_t *frame);
+#endif
+#if APP_KNN
+void ProcessKnn(const ProtoFrame_t *frame);
+#endif
+#if APP_MODEL_MULTIHEAD
+void ProcessHeads(const ProtoFrame_t *frame);
+#endif
+#if APP_CONFIG
+void ProcessConfig(const ProtoFrame_t *frame);
+static void Config_Restore(const ProtoConfig_t *saved);
+static void UART_ConfirmSavedBaud(void);
+#endif
+void ProcessCascade(const ProtoFrame_t *frame);
+void ProcessKernelBench(const ProtoFrame_t *frame);
+#if APP_CMSIS_NN && APP_PROFILE
+void ProcessNnBench(const ProtoFrame_t *frame);
+#endif
+void SendLayerProfile(const ProtoFrame_t *frame);
+void BatchBegin(uint8_t seq, uint8_t count);
+void BatchRecord(uint8_t index, uint8_t predicted_class);
+#if APP_BATCH_DENSE
+static int BatchStack(uint8_t index, const uint8_t *img);
+static void BatchFlush(void);
+#endif
+void SendFrame(uint8_t type, uint8_t seq, const void *payload, uint16_t len);
+static void SendFrameOnLink(uint8_t type, uint8_t seq, const void *payload, uint16_t len);
+static int UART_Queue(const uint8_t *data, uint16_t len);
+static void UART_TxKick(void);
+static void UART_TxFlush(void);
+void SendResult(uint8_t type, uint8_t seq, int predicted_class, uint8_t flags);
+void SendError(uint8_t seq, ProtoError_t error);
+void Idle(void);
+#if APP_RTOS
+static void RTOS_Run(void);
+#endif
+#if APP_IDLE_STOP_MS
+static void Idle_Stop(void);
+#endif
+/* USER CODE END PFP */
+
+/* Private user code ---------------------------------------------------------*/
+/* USER CODE BEGIN 0 */
+/**
+  * @brief Hex digit value, or -1
+  */
+static int AI_HexDigit(char c)
+{
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+/**
+  * @brief Total bytes of a network report's weights or activations map
+  */
+static uint32_t AI_MapBytes(const ai_buffer_array *map)
+{
+  uint32_t bytes = 0;
+
+  for (ai_u16 i = 0; map->buffer && i < map->size; i++)
+  {
+    bytes += AI_BUFFER_BYTE_SIZE(AI_BUFFER_SIZE(&map->buffer[i]), map->buffer[i].format);
+  }
+  return bytes;
+}
+
+/**
+  * @brief Look up the tensors of the freshly created network and check them
+  */
+static int AI_Bind(void)
+{
+  ai_network_report report;
+#if APP_MODEL_MULTIHEAD
+  ai_u16 outputs = 0;
+#endif
+
+  ai_input = model->inputs_get(network, NULL);
+#if APP_MODEL_MULTIHEAD
+  ai_output = model->outputs_get(network, &outputs);
+  ai_heads = (uint8_t)outputs;
+  ai_heads_run = 1U;
+#else
+  ai_output = model->outputs_get(network, NULL);
+#endif
+
+  // AI_NETWORK_INPUTS/OUTPUTS_IN_ACTIVATIONS: the runtime already points
+  // the tensors into the activations pool, there are no separate buffers
+  if (!ai_input || !ai_output || !ai_input[0].data || !ai_output[0].data)
+  {
+    return -1;
+  }
+
+  // Every request path fills an IMG_SIZE int8 tensor and argmaxes int8
+  // scores; models.h checks this at compile time, this catches a runtime
+  // library that disagrees with its generated header
+  ai_num_classes = (uint16_t)AI_BUFFER_SIZE(&ai_output[0]);
+  if (AI_BUFFER_SIZE(&ai_input[0]) != IMG_SIZE ||
+      AI_BUFFER_FORMAT(&ai_input[0]) != AI_BUFFER_FORMAT_S8 ||
+      AI_BUFFER_FORMAT(&ai_output[0]) != AI_BUFFER_FORMAT_S8 ||
+      ai_num_classes == 0 || ai_num_classes > MAX_CLASSES ||
+      (MODEL_CLASSES_FIXED && ai_num_classes != MODEL_OUT_MAX))
+  {
+    return -1;
+  }
+
+#if APP_CMSIS_NN
+  ai_kernels = (uint8_t)CmsisNN_Install(network);
+#else
+  ai_kernels = (uint8_t)Kernel_Install(network);
+#endif
+  ai_logits = (uint8_t)Kernel_Logits(NULL, NULL);
+#if APP_ARENA_SIZE
+  // A trimmed arena only holds a model whose kernels leave its end unused
+  if (Kernel_ArenaEnd(network) > MODEL_ARENA_SIZE)
+  {
+    return -1;
+  }
+#endif
+
+#if APP_RX_OVERLAY
+  // Checked against the bound tensors: a stale plan leaves the slot shut
+  rx_overlay_from = Model_Overlay(network, model_index, &rx_overlay_region);
+#endif
+
+#if APP_PROFILE_LAYERS || APP_CANCEL || APP_STAI || APP_RX_OVERLAY
+  if (Prof_ObserverRegister(network) != 0)
+  {
+    return -1;
+  }
+#endif
+
+  // "0x" + 32 hex digits, reported by PING so the host can spot a stale model
+  memset(ai_model_hash, 0, sizeof(ai_model_hash));
+  ai_activations_size = 0;
+  ai_weights_size = 0;
+  ai_macc_count = 0;
+  if (!model->get_report)
+  {
+    ai_network_params params;
+
+    // APP_RUNTIME_MIN: the sizes the network was generated with
+    if (model->data_params_get(&params))
+    {
+      ai_activations_size = AI_MapBytes(&params.map_activations);
+      ai_weights_size = AI_MapBytes(&params.map_weights);
+    }
+    return 0;
+  }
+  if (!model->get_report(network, &report))
+  {
+    return 0;
+  }
+  ai_activations_size = AI_MapBytes(&report.map_activations);
+  ai_weights_size = AI_MapBytes(&report.map_weights);
+  ai_macc_count = (uint32_t)report.n_macc;
+  if (report.model_signature)
+  {
+    const char *sig = report.model_signature;
+    if (sig[0] == '0' && (sig[1] == 'x' || sig[1] == 'X'))
+    {
+      sig += 2;
+    }
+    for (uint8_t i = 0; i < sizeof(ai_model_hash); i++)
+    {
+      int hi = AI_HexDigit(sig[0]);
+      int lo = (hi < 0) ? -1 : AI_HexDigit(sig[1]);
+      if (lo < 0)
+      {
+        break;
+      }
+      ai_model_hash[i] = (uint8_t)((hi << 4) | lo);
+      sig += 2;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief Make registered network index the active one in the shared arena
+  * @note  Created on first use, a warm re-init afterwards; on failure no
+  *        network is active
+  */
+int AI_Init(uint8_t index)
+{
+  network = AI_HANDLE_NULL;
+  ai_input = NULL;
+  ai_output = NULL;
+  model = Model_Get(index);
+  model_index = index;
+  Memo_Clear();
+#if APP_DELTA_GATE
+  gate_class = -1;
+#endif
+
+  if (!model)
+  {
+    return -1;
+  }
+
+  network = Model_Activate(index);
+  if (network == AI_HANDLE_NULL)
+  {
+    return -1;
+  }
+
+  if (AI_Bind() != 0)
+  {
+    Model_Drop(index);
+    network = AI_HANDLE_NULL;
+    return -1;
+  }
+
+  // A warm restart comes back with this model
+  Boot_SaveModel(index);
+  LOG(LOG_MODEL, index, ai_activations_size);
+  return 0;
+}
+
+/**
+  * @brief Input tensor (int8, IMG_SIZE bytes) inside activations
+  * @note  Only valid after AI_Init, overwritten by the next inference
+  */
+int8_t *AI_InputBuffer(void)
+{
+  return (int8_t *)ai_input[0].data;
+}
+
+/**
+  * @brief Output tensor (int8, one score per class) of the last AI_Run
+  */
+const int8_t *AI_OutputBuffer(void)
+{
+  return (const int8_t *)ai_output[0].data;
+}
+
+/**
+  * @brief Run AI inference in place on AI_InputBuffer into AI_OutputBuffer
+  */
+int AI_Run(void)
+{
+  ai_i32 batch;
+
+  if (!network || !ai_input || !ai_output) return -1;
+#if APP_WEIGHT_CHECK
+  // The first run on uploaded weights waits for the rest of their check
+  if (Upload_CheckPending() & (1UL << model_index))
+  {
+    uint8_t index = model_index;
+
+    while (Upload_CheckPending() & (1UL << index))
+    {
+      if (AI_CheckWeights() == index)
+      {
+        return -1;
+      }
+    }
+  }
+#endif
+
+  // Each run is progress, however many a request asks for
+  WATCHDOG_FEED();
+#if APP_CANCEL
+  // The rest of a cancelled request's runs (batch, TTA, ensembles) never start
+  if (ai_cancelled)
+  {
+    return -1;
+  }
+#endif
+  TRACE_HIGH(TRACE_RUN);
+#if APP_LOAD
+  ai_load_mark = Load_Begin();
+#endif
+#if APP_DETERMINISTIC
+  AI_QuietBegin();
+#endif
+#if APP_MODEL_MULTIHEAD
+  // Only the heads asked for; a single-output network has nothing to park
+  if (ai_heads > 1U && Heads_Begin(network, ai_output, ai_heads, ai_heads_run) != 0)
+  {
+    TRACE_LOW(TRACE_RUN);
+    return -1;
+  }
+#endif
+  ai_running = 1;
+  STAMP_RUN_BEGIN();
+  batch = model->run(network, ai_input, ai_output);
+  STAMP_RUN_END();
+  ai_running = 0;
+#if APP_MODEL_MULTIHEAD
+  Heads_End();
+#endif
+#if APP_DETERMINISTIC
+  AI_QuietEnd();
+#endif
+#if APP_LOAD
+  Load_End(&ai_load_mark, PROTO_LOAD_INFERENCE);
+#endif
+  TRACE_LOW(TRACE_RUN);
+#if APP_CANCEL
+  // Cancelled during the run, which went to its end: drop the result
+  if (ai_cancelled)
+  {
+    return -1;
+  }
+#endif
+  if (batch != 1)
+  {
+    LOG(LOG_RUN_FAILED, batch, 0);
+    return -1;
+  }
+
+  return 0;
+}
+
+#if APP_DETERMINISTIC
+/**
+  * @brief Hold off all but the critical interrupts for a network run
+  * @note  BASEPRI masks APP_DETERMINISTIC_BASEPRI and below; their DMA
+  *        streams keep filling the rings. SysTick runs at priority 0, its
+  *        interrupt is turned off instead and AI_QuietEnd adds the ticks
+  */
+static void AI_QuietBegin(void)
+{
+  if (!ai_quiet)
+  {
+    return;
+  }
+  // A tick that fires before TICKINT is cleared is already counted
+  __disable_irq();
+  SysTick->CTRL &= ~SysTick_CTRL_TICKINT_Msk;
+  ai_quiet_start = PROF_CYCLES();
+  ai_quiet_val = SysTick->VAL;
+  __set_BASEPRI(APP_DETERMINISTIC_BASEPRI << (8U - __NVIC_PRIO_BITS));
+  __enable_irq();
+}
+
+/**
+  * @brief Interrupts back on, with the SysTick periods the run spanned
+  *        added to the HAL tick
+  * @note  SysTick counts down from LOAD and reloads: the counts passed are
+  *        whole periods plus the fall from the start value to now. The
+  *        cycle counter, in SysTick counts, gives the number of periods
+  */
+static void AI_QuietEnd(void)
+{
+  uint32_t period = SysTick->LOAD + 1U;
+  uint32_t elapsed;
+  int32_t fall;
+
+  if (!ai_quiet)
+  {
+    return;
+  }
+  __disable_irq();
+  elapsed = PROF_CYCLES() - ai_quiet_start;
+  fall = (int32_t)ai_quiet_val - (int32_t)SysTick->VAL;
+  if (!(SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk))
+  {
+    elapsed /= 8U;                      // SysTick on HCLK / 8
+  }
+  uwTick += (uint32_t)(((int64_t)elapsed - fall + period / 2U) / period) * uwTickFreq;
+  SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk;
+  __set_BASEPRI(0U);
+  __enable_irq();
+}
+#endif
+
+/**
+  * @brief Start AI_Run in PendSV and return
+  * @param done called from PendSV with the AI_Run result, may be NULL
+  * @note  Submit from the main loop only: PendSV preempts it at once, and
+  *        the RX interrupts parse for it until the run completes
+  * @retval 0 if submitted, -1 if a run is still in flight
+  */
+int AI_RunAsync(void (*done)(int status))
+{
+  if (ai_async_busy)
+  {
+    return -1;
+  }
+
+  ai_async_done = done;
+  ai_async_busy = 1;
+  SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+  __DSB();
+  __ISB();
+  return 0;
+}
+
+/**
+  * @brief Whether an AI_RunAsync inference has not completed yet
+  */
+uint8_t AI_RunBusy(void)
+{
+  return ai_async_busy;
+}
+
+/**
+  * @brief PendSV: run the submitted inference and signal its completion
+  */
+void AI_RunPending(void)
+{
+  void (*done)(int status);
+
+  if (!ai_async_busy)
+  {
+    return;
+  }
+
+  ai_async_status = AI_Run();
+  done = ai_async_done;
+  // Cleared first so the callback may submit the next run
+  ai_async_busy = 0;
+  if (done)
+  {
+    done(ai_async_status);
+  }
+}
+
+#if APP_STAI
+/**
+  * @brief stai node event of the running network
+  * @note  Bare metal without APP_AI_ASYNC nothing else parses during a
+  *        run: take in what arrived during the node, so the next frame is
+  *        validated and queued by the time the run ends
+  */
+static void AI_OnNodeEvent(void *cookie, const stai_event_type event_type, const void *event_payload)
+{
+  (void)cookie;
+  (void)event_payload;
+
+#if !APP_AI_ASYNC && !APP_RTOS
+  if (event_type == STAI_EVENT_NODE_STOP)
+  {
+    UART_PollReception();
+#if APP_SPI_LINK || APP_UART_LINKS
+    RX_PollLinks();
+#endif
+  }
+#else
+  (void)event_type;
+#endif
+}
+#endif
+
+#if APP_CANCEL
+/**
+  * @brief Observer hook before each c-node: note that the run's request was cancelled
+  * @note  Bare metal, nothing else parses during a run: take in what has
+  *        arrived so a CANCEL sent meanwhile is seen. Under APP_AI_ASYNC
+  *        and the RTOS the interrupts and rx task already do.
+  *        The run is not cut short: nothing shows the prebuilt runtime
+  *        could be left mid-run from a callback. AI_Run drops its result
+  *        and starts no other run of the request
+  */
+void AI_NodeBoundary(void)
+{
+  const ProtoFrame_t *frame = ai_frame;
+
+#if !APP_AI_ASYNC && !APP_RTOS
+  UART_PollReception();
+#if APP_SPI_LINK || APP_UART_LINKS
+  RX_PollLinks();
+#endif
+#endif
+
+  if (frame && !ai_cancelled && cancel_slots && RX_Cancelled(frame))
+  {
+    ai_cancelled = 1;
+  }
+}
+#endif
+
+/**
+  * @brief Validate a received frame and dispatch it by type
+  */
+void ProcessFrame(const ProtoFrame_t *frame)
+{
+  RX_CopyWait(frame);
+
+  // Responses go back on the transport the request came from
+  tx_link = frame->link;
+
+#if APP_SPLIT_LINK
+  if (frame->link == APP_SPLIT_LINK && (frame->hdr.f.type & PROTO_RESPONSE_FLAG))
+  {
+    ProcessStageReply(frame);
+    return;
+  }
+#endif
+
+  if (Proto_CheckFrame(frame) != 0)
+  {
+    STATS_COUNT(STATS_ERR_CRC);
+#if APP_LINK_FALLBACK_PERMILLE
+    if (frame->link == PROTO_LINK_UART)
+    {
+      UART_LinkError();
+    }
+#endif
+    if (frame->hdr.f.type == PROTO_CMD_BATCH_IMAGE)
+    {
+      BatchRecord(frame->hdr.f.seq, PROTO_CLASS_NONE);
+    }
+    else
+    {
+      SendError(frame->hdr.f.seq, PROTO_ERR_CRC);
+    }
+    return;
+  }
+
+  // Any intact frame proves the host followed a baud switch
+  baud_pending = 0;
+#if APP_CONFIG
+  baud_saved = 0;
+#endif
+
+#if APP_CANCEL
+  if (cancel_slots && RX_Cancelled(frame))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_CANCELLED);
+    return;
+  }
+  ai_frame = frame;
+  ai_cancelled = 0;
+#endif
+
+  switch (frame->hdr.f.type)
+  {
+    case PROTO_CMD_CLASSIFY:
+      if (frame->hdr.f.len != IMG_SIZE)
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        break;
+      }
+      ProcessInference(frame);
+      break;
+
+    case PROTO_CMD_CLASSIFY_TOPK:
+      if (frame->hdr.f.len != IMG_SIZE && frame->hdr.f.len != IMG_SIZE + 1)
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        break;
+      }
+      ProcessTopK(frame);
+      break;
+
+#if APP_PROFILE
+    case PROTO_CMD_CLASSIFY_PROF:
+      if (frame->hdr.f.len != IMG_SIZE)
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        break;
+      }
+      ProcessProfiledInference(frame);
+      break;
+#endif
+
+#if APP_PROFILE_LAYERS
+    case PROTO_CMD_PROFILE:
+      SendLayerProfile(frame);
+      break;
+#endif
+
+    case PROTO_CMD_BATCH:
+      if (frame->hdr.f.len != 1 || frame->payload[0] == 0)
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        break;
+      }
+      BatchBegin(frame->hdr.f.seq, frame->payload[0]);
+      break;
+
+    case PROTO_CMD_SET_BAUD:
+      ProcessSetBaud(frame);
+      break;
+
+    case PROTO_CMD_SET_CLOCK:
+      ProcessSetClock(frame);
+      break;
+
+    case PROTO_CMD_PING:
+      SendCapabilities(frame->hdr.f.seq);
+      break;
+
+    case PROTO_CMD_CLASSIFY_PACKED:
+      ProcessPackedInference(frame);
+      break;
+
+    case PROTO_CMD_CLASSIFY_CROP:
+      ProcessCropInference(frame);
+      break;
+
+    case PROTO_CMD_CLASSIFY_SMALL:
+      if (frame->hdr.f.len != PROTO_SMALL_SIZE && frame->hdr.f.len != PROTO_SMALL_SIZE + 1U)
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        break;
+      }
+      ProcessSmallInference(frame);
+      break;
+
+#if APP_ANYTIME
+    case PROTO_CMD_CLASSIFY_ANYTIME:
+      if (frame->hdr.f.len != IMG_SIZE + sizeof(ProtoAnytimeReq_t))
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        break;
+      }
+      ProcessAnytime(frame);
+      break;
+#endif
+
+#if APP_TTA
+    case PROTO_CMD_CLASSIFY_TTA:
+      if (frame->hdr.f.len != IMG_SIZE + sizeof(ProtoTtaReq_t))
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        break;
+      }
+      ProcessTta(frame);
+      break;
+#endif
+
+#if APP_TIMESTAMPS
+    case PROTO_CMD_CLOCK_SYNC:
+      ProcessClockSync(frame);
+      break;
+#endif
+
+    case PROTO_CMD_MEMSTAT:
+      SendMemStats(frame->hdr.f.seq);
+      break;
+
+#if APP_STATS
+    case PROTO_CMD_STATS:
+      ProcessStats(frame);
+      break;
+#endif
+
+#if APP_TELEMETRY
+    case PROTO_CMD_TELEMETRY:
+      ProcessTelemetry(frame);
+      break;
+#endif
+
+#if APP_LOG
+    case PROTO_CMD_LOG:
+      SendLog(frame->hdr.f.seq);
+      break;
+#endif
+
+#if APP_FLASH_BENCH
+    case PROTO_CMD_FLASH:
+      ProcessFlash(frame);
+      break;
+#endif
+
+#if APP_SELFTEST
+    case PROTO_CMD_SELFTEST:
+      ProcessSelfTest(frame);
+      break;
+#endif
+
+#if APP_WCET
+    case PROTO_CMD_WCET:
+      ProcessWcet(frame);
+      break;
+#endif
+#if APP_IRQ_LATENCY
+    case PROTO_CMD_IRQ_LATENCY:
+      ProcessIrqLatency(frame);
+      break;
+#endif
+#if APP_ENERGY
+    case PROTO_CMD_ENERGY:
+      ProcessEnergy(frame);
+      break;
+#endif
+
+    case PROTO_CMD_SELECT_MODEL:
+      ProcessSelectModel(frame);
+      break;
+
+#if APP_UPLOAD
+    case PROTO_CMD_UPLOAD:
+      ProcessUpload(frame);
+      break;
+#endif
+
+#if APP_SPLIT
+    case PROTO_CMD_STAGE:
+      ProcessStage(frame);
+      break;
+#endif
+
+#if APP_STRIP
+    case PROTO_CMD_STRIP:
+      ProcessStrip(frame);
+      break;
+#endif
+
+#if APP_EMBED
+    case PROTO_CMD_EMBED:
+      ProcessEmbed(frame);
+      break;
+#endif
+
+#if APP_MODEL_MULTIHEAD
+    case PROTO_CMD_HEADS:
+      ProcessHeads(frame);
+      break;
+#endif
+
+#if APP_KNN
+    case PROTO_CMD_KNN:
+      ProcessKnn(frame);
+      break;
+#endif
+
+#if APP_CONFIG
+    case PROTO_CMD_CONFIG:
+      ProcessConfig(frame);
+      break;
+#endif
+
+#if KERNEL_ANY && APP_PROFILE
+    case PROTO_CMD_KERNEL_BENCH:
+      if (frame->hdr.f.len != IMG_SIZE && frame->hdr.f.len != IMG_SIZE + 1)
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        break;
+      }
+      ProcessKernelBench(frame);
+      break;
+#endif
+
+#if APP_CMSIS_NN && APP_PROFILE
+    case PROTO_CMD_NN_BENCH:
+      if (frame->hdr.f.len != IMG_SIZE)
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        break;
+      }
+      ProcessNnBench(frame);
+      break;
+#endif
+
+    case PROTO_CMD_CLASSIFY_CASCADE:
+      if (frame->hdr.f.len != IMG_SIZE + sizeof(ProtoCascadeReq_t))
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        break;
+      }
+      ProcessCascade(frame);
+      break;
+
+    case PROTO_CMD_BATCH_IMAGE:
+    {
+      int predicted_class = -1;
+      uint8_t flags = 0;
+#if APP_BATCH_DENSE
+      if (frame->hdr.f.len == IMG_SIZE && BatchStack(frame->hdr.f.seq, frame->payload) == 0)
+      {
+        break;
+      }
+#endif
+      if (frame->hdr.f.len == IMG_SIZE)
+      {
+        predicted_class = ClassifyRequest(frame->payload, &flags);
+      }
+      BatchRecord(frame->hdr.f.seq, (predicted_class < 0) ? PROTO_CLASS_NONE : (uint8_t)predicted_class);
+      break;
+    }
+
+#if APP_CANCEL
+    case PROTO_CMD_CANCEL:
+      ProcessCancel(frame);
+      break;
+#endif
+
+    default:
+      SendError(frame->hdr.f.seq, PROTO_ERR_TYPE);
+      break;
+  }
+
+#if APP_CANCEL
+  ai_frame = NULL;
+  ai_cancelled = 0;
+#endif
+}
+
+/**
+  * @brief Load img into the bound network's input tensor (Pre_LoadImage)
+  */
+static void AI_LoadImage(const uint8_t *img)
+{
+  Pre_LoadImage(AI_InputBuffer(), img, IMG_SIZE);
+}
+
+/**
+  * @brief Classify one 28x28 uint8 image
+  * @retval predicted class, or -1 if inference failed
+  */
+int ClassifyImage(const uint8_t *img)
+{
+#if APP_PROFILE
+  uint32_t t0 = PROF_CYCLES();
+#endif
+
+  AI_LoadImage(img);
+
+#if APP_PROFILE
+  prof.pre_cycles = PROF_CYCLES() - t0;
+#endif
+
+  return ClassifyInput();
+}
+
+/**
+  * @brief True if the image has too little ink to hold a digit (APP_BLANK_INK)
+  */
+static uint8_t AI_IsBlank(const uint8_t *img)
+{
+#if APP_BLANK_INK
+  return Pre_Ink(img, IMG_SIZE) < APP_BLANK_INK;
+#else
+  (void)img;
+  return 0;
+#endif
+}
+
+/**
+  * @brief Class of the last image run if img is within APP_DELTA_GATE of it
+  * @note  Sum of absolute pixel differences (Pre_Delta), given up as soon
+  *        as it reaches the gate
+  * @retval class, or -1 to run the network
+  */
+static int AI_Gate(const uint8_t *img)
+{
+#if APP_DELTA_GATE
+  if (gate_class < 0)
+  {
+    return -1;
+  }
+  return (Pre_Delta(img, gate_image, IMG_SIZE, APP_DELTA_GATE) < APP_DELTA_GATE) ? gate_class : -1;
+#else
+  (void)img;
+  return -1;
+#endif
+}
+
+/**
+  * @brief Keep img and its class for AI_Gate
+  */
+static void AI_GateStore(const uint8_t *img, int predicted_class)
+{
+#if APP_DELTA_GATE
+  if (predicted_class >= 0)
+  {
+    memcpy(gate_image, img, IMG_SIZE);
+  }
+  gate_class = (int16_t)predicted_class;
+#else
+  (void)img;
+  (void)predicted_class;
+#endif
+}
+
+/**
+  * @brief ClassifyImage for CLASSIFY-like requests, which skip the network
+  *        for blank images, for those among the last APP_MEMO results and
+  *        for those within APP_DELTA_GATE of the last one run
+  * @param flags gets PROTO_RESULT_MEMO when the result was remembered,
+  *        PROTO_RESULT_GATED when it is that of the last image run
+  * @retval predicted class, PROTO_CLASS_BLANK, or -1 if inference failed
+  */
+static int ClassifyRequest(const uint8_t *img, uint8_t *flags)
+{
+  int gated;
+
+  if (AI_IsBlank(img))
+  {
+    return PROTO_CLASS_BLANK;
+  }
+  gated = AI_Gate(img);
+  if (gated >= 0)
+  {
+    *flags |= PROTO_RESULT_GATED;
+    return gated;
+  }
+
+#if APP_MEMO
+  uint32_t key = Memo_Key(model_index, img);
+  int predicted_class = Memo_Find(key);
+
+  if (predicted_class >= 0)
+  {
+    *flags |= PROTO_RESULT_MEMO;
+    return predicted_class;
+  }
+
+  predicted_class = ClassifyImage(img);
+  if (predicted_class >= 0)
+  {
+    Memo_Store(key, (uint8_t)predicted_class);
+  }
+  AI_GateStore(img, predicted_class);
+  return predicted_class;
+#else
+  int predicted_class = ClassifyImage(img);
+
+  AI_GateStore(img, predicted_class);
+  return predicted_class;
+#endif
+}
+
+/**
+  * @brief Run inference on the input tensor as loaded and pick the best class
+  * @retval predicted class, or -1 if inference failed
+  */
+int ClassifyInput(void)
+{
+#if APP_PROFILE || APP_STATS
+  uint32_t t1 = PROF_CYCLES(), t2;
+#endif
+
+  // Run inference
+#if APP_STAI
+  {
+    stai_return_code rc = StaiApp_Run(APP_AI_ASYNC ? STAI_MODE_ASYNC : STAI_MODE_SYNC);
+
+    while (rc == STAI_RUNNING_NO_WFE)
+    {
+      rc = StaiApp_Wait();
+    }
+    if (rc != STAI_DONE)
+    {
+      STATS_COUNT(STATS_ERR_INFERENCE);
+      return -1;
+    }
+  }
+#elif APP_AI_ASYNC
+  // Taken before the next instruction here; the wait only covers a
+  // submission that found PendSV masked
+  if (AI_RunAsync(NULL) != 0)
+  {
+    return -1;
+  }
+  while (AI_RunBusy())
+  {
+  }
+  if (ai_async_status != 0)
+  {
+    STATS_COUNT(STATS_ERR_INFERENCE);
+    return -1;
+  }
+#else
+  if (AI_Run() != 0)
+  {
+    STATS_COUNT(STATS_ERR_INFERENCE);
+    return -1;
+  }
+#endif
+
+#if APP_PROFILE || APP_STATS
+  t2 = PROF_CYCLES();
+#endif
+  STATS_COUNT(STATS_INFERENCES);
+  STATS_CYCLES(STATS_HIST_RUN, t2 - t1);
+  ENERGY_INFERENCE();
+
+  // Find max class, read in place from the output tensor
+  int predicted_class = Pre_Argmax(AI_OutputBuffer(), AI_CLASSES);
+
+#if APP_PROFILE
+  prof.run_cycles = t2 - t1;
+  prof.argmax_cycles = PROF_CYCLES() - t2;
+#endif
+
+  return predicted_class;
+}
+
+/**
+  * @brief Process inference and control LED
+  * @param frame CLASSIFY request holding a 28x28 uint8 image
+  */
+void ProcessInference(const ProtoFrame_t *frame)
+{
+  // Taken first: an overlay frame lies in the arena its own run uses
+  uint8_t seq = frame->hdr.f.seq;
+  uint8_t flags = 0;
+  int predicted_class;
+
+#if APP_RX_OVERLAY
+  // The next frame may land in the arena once the run is far enough
+  rx_overlay_armed = 1;
+#endif
+  predicted_class = ClassifyRequest(frame->payload, &flags);
+#if APP_RX_OVERLAY
+  rx_overlay_armed = 0;
+  rx_overlay_open = 0;
+#endif
+
+  if (predicted_class >= 0)
+  {
+    // Send result
+    SendResult(PROTO_CMD_CLASSIFY, seq, predicted_class, flags);
+  }
+  else
+  {
+    // Error during inference
+    SendError(seq, PROTO_ERR_INFERENCE);
+  }
+}
+
+#if APP_ARENA_SLOTS > 1
+/**
+  * @brief Convert the queued CLASSIFY and BATCH_IMAGE images behind the
+  *        head into the input tensors of idle arenas and free their slots
+  * @note  The head runs next in the bound arena anyway. Blank and
+  *        remembered images, and frames that fail their CRC, stay queued
+  *        as frames: ProcessFrame answers them at no cost
+  */
+static void AI_Stage(void)
+{
+  for (uint8_t pos = (uint8_t)(ready_head + 1U); pos != ready_tail; pos++)
+  {
+    uint8_t entry = ready_fifo[pos % RX_READY_SIZE];
+    const ProtoFrame_t *frame;
+    Staged_t *st;
+    uint8_t arena = 0;
+
+    if (entry & RX_STAGED)
+    {
+      continue;
+    }
+    frame = RX_Frame(entry);
+    if (frame->hdr.f.len != IMG_SIZE ||
+        (frame->hdr.f.type != PROTO_CMD_CLASSIFY &&
+         (frame->hdr.f.type != PROTO_CMD_BATCH_IMAGE || APP_BATCH_DENSE)))
+    {
+      continue;
+    }
+
+    // An idle arena other than the bound one
+    while (arena < APP_ARENA_SLOTS && (arena == Model_Slot() || (staged_mask & (1U << arena))))
+    {
+      arena++;
+    }
+    if (arena == APP_ARENA_SLOTS || !network)
+    {
+      return;
+    }
+
+    RX_CopyWait(frame);
+    if (Proto_CheckFrame(frame) != 0 || AI_IsBlank(frame->payload) || AI_Gate(frame->payload) >= 0)
+    {
+      continue;
+    }
+    st = &staged[arena];
+#if APP_MEMO
+    st->key = Memo_Key(model_index, frame->payload);
+    if (Memo_Find(st->key) >= 0)
+    {
+      continue;
+    }
+#endif
+
+    st->input = (int8_t *)(Model_SlotArena(arena) + ((const uint8_t *)AI_InputBuffer() - Model_Arena()));
+    Pre_LoadImage(st->input, frame->payload, IMG_SIZE);
+    st->stamp = slot_stamp[entry];
+    st->model = model_index;
+    st->type = frame->hdr.f.type;
+    st->seq = frame->hdr.f.seq;
+    st->link = frame->link;
+    baud_pending = 0;
+#if APP_CONFIG
+    baud_saved = 0;
+#endif
+
+    // A priority frame may have been moved in ahead meanwhile: find it again
+    __disable_irq();
+    for (uint8_t p = (uint8_t)(ready_head + 1U); p != ready_tail; p++)
+    {
+      if (ready_fifo[p % RX_READY_SIZE] == entry)
+      {
+        ready_fifo[p % RX_READY_SIZE] = (uint8_t)(RX_STAGED | arena);
+        break;
+      }
+    }
+    staged_mask |= (uint8_t)(1U << arena);
+    slot_busy[entry] = 0;
+    __enable_irq();
+  }
+}
+
+/**
+  * @brief Run a staged image in its arena and answer it like its frame
+  * @note  Binding the model there is a warm init; if the model changed
+  *        since, its input tensor may sit elsewhere in the arena
+  */
+static void AI_RunStaged(uint8_t arena)
+{
+  const Staged_t *st = &staged[arena];
+  int predicted_class = -1;
+
+  staged_mask &= (uint8_t)~(1U << arena);
+  tx_link = st->link;
+
+  network = Model_UseSlot(arena);
+  if (network != AI_HANDLE_NULL && AI_Bind() == 0)
+  {
+    if (AI_InputBuffer() != st->input)
+    {
+      memmove(AI_InputBuffer(), st->input, IMG_SIZE);
+    }
+    predicted_class = ClassifyInput();
+  }
+  else
+  {
+    // Back on the model in whichever arena is bound now
+    AI_Init(model_index);
+  }
+#if APP_MEMO
+  if (predicted_class >= 0 && st->model == model_index)
+  {
+    Memo_Store(st->key, (uint8_t)predicted_class);
+  }
+#endif
+
+  if (st->type == PROTO_CMD_BATCH_IMAGE)
+  {
+    BatchRecord(st->seq, (predicted_class < 0) ? PROTO_CLASS_NONE : (uint8_t)predicted_class);
+  }
+  else if (predicted_class >= 0)
+  {
+    SendResult(PROTO_CMD_CLASSIFY, st->seq, predicted_class, 0);
+  }
+  else
+  {
+    SendError(st->seq, PROTO_ERR_INFERENCE);
+  }
+  STATS_CYCLES(STATS_HIST_FRAME, PROF_CYCLES() - st->stamp);
+}
+#endif
+
+/**
+  * @brief Decode a compressed image and reply like CLASSIFY
+  */
+void ProcessPackedInference(const ProtoFrame_t *frame)
+{
+  ProtoError_t err = Pack_Decode(frame->payload, frame->hdr.f.len);
+  int predicted_class;
+  uint8_t flags = 0;
+
+  if (err != PROTO_ERR_NONE)
+  {
+    SendError(frame->hdr.f.seq, err);
+    return;
+  }
+
+  predicted_class = ClassifyRequest(Pack_Image(), &flags);
+  if (predicted_class < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+    return;
+  }
+
+  SendResult(PROTO_CMD_CLASSIFY_PACKED, frame->hdr.f.seq, predicted_class, flags);
+}
+
+/**
+  * @brief Resample a variable size crop into the input tensor and reply like CLASSIFY
+  */
+void ProcessCropInference(const ProtoFrame_t *frame)
+{
+#if APP_PROFILE
+  uint32_t t0 = PROF_CYCLES();
+#endif
+  ProtoError_t err = Crop_Load(frame->payload, frame->hdr.f.len, AI_InputBuffer());
+  int predicted_class;
+  uint8_t result;
+
+  if (err != PROTO_ERR_NONE)
+  {
+    SendError(frame->hdr.f.seq, err);
+    return;
+  }
+
+#if APP_PROFILE
+  prof.pre_cycles = PROF_CYCLES() - t0;
+#endif
+
+  predicted_class = ClassifyInput();
+  if (predicted_class < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+    return;
+  }
+
+  result = (uint8_t)predicted_class;
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_CLASSIFY_CROP), frame->hdr.f.seq, &result, sizeof(result));
+}
+
+_Static_assert(IMG_HEIGHT == 2U * PROTO_SMALL_SIDE && IMG_SIZE == 4U * PROTO_SMALL_SIZE,
+               "CLASSIFY_SMALL images double to the model input");
+
+/**
+  * @brief Double a 14x14 image to 28x28, each pixel a 2x2 block
+  * @note  A 2x2 average pool, the first layer of the small model, gives the
+  *        14x14 image back exactly
+  */
+static void AI_DoubleImage(uint8_t *dst, const uint8_t *src)
+{
+  for (uint32_t y = 0; y < PROTO_SMALL_SIDE; y++, src += PROTO_SMALL_SIDE)
+  {
+    uint32_t *row = (uint32_t *)&dst[y * 2U * IMG_HEIGHT];
+
+    for (uint32_t x = 0; x < PROTO_SMALL_SIDE / 2U; x++)
+    {
+      uint32_t a = src[2U * x], b = src[2U * x + 1U];
+
+      row[x] = (a | (a << 8) | (b << 16) | (b << 24));
+    }
+    memcpy(&row[PROTO_SMALL_SIDE / 2U], row, IMG_HEIGHT);
+  }
+}
+
+/**
+  * @brief Classify a 14x14 image on the active model, or the one the request
+  *        names, and reply like CLASSIFY
+  * @note  Naming another model costs a warm re-init each way, as a cascade
+  *        stage does; SELECT_MODEL keeps a session on the small model
+  */
+void ProcessSmallInference(const ProtoFrame_t *frame)
+{
+  static uint8_t img[IMG_SIZE] __attribute__((aligned(4)));
+  uint8_t seq = frame->hdr.f.seq;
+  uint8_t prev = model_index;
+  uint8_t index = (frame->hdr.f.len > PROTO_SMALL_SIZE) ? frame->payload[PROTO_SMALL_SIZE] : model_index;
+  uint8_t flags = 0;
+  int predicted_class = -2;
+
+  if (index >= Model_Count())
+  {
+    SendError(seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  AI_DoubleImage(img, frame->payload);
+  if ((index == model_index && network != AI_HANDLE_NULL) || AI_Init(index) == 0)
+  {
+    predicted_class = ClassifyRequest(img, &flags);
+  }
+
+  if (model_index != prev || network == AI_HANDLE_NULL)
+  {
+    // prev loaded before, see ProcessSelectModel
+    if (AI_Init(prev) != 0)
+    {
+      Error_Handler();
+    }
+  }
+
+  if (predicted_class < 0)
+  {
+    SendError(seq, (predicted_class == -2) ? PROTO_ERR_PARAM : PROTO_ERR_INFERENCE);
+    return;
+  }
+  SendResult(PROTO_CMD_CLASSIFY_SMALL, seq, predicted_class, flags);
+}
+
+#if APP_ANYTIME
+/**
+  * @brief Classify with gemm_5 in steps of KERNEL_ANYTIME_ROWS rows, gemm_6
+  *        following each, and stop early once the answer is settled, leads
+  *        by the requested margin, or the next step would miss the deadline
+  * @note  At least one step runs whatever the deadline. The convs always
+  *        run whole, a deadline shorter than them is answered after one step
+  */
+void ProcessAnytime(const ProtoFrame_t *frame)
+{
+  ProtoAnytimeReq_t req;
+  ProtoAnytime_t reply;
+  uint32_t t0 = PROF_CYCLES();
+  uint32_t deadline, last = 0;
+  uint64_t cycles;
+  uint8_t margin = 0, settled = 0;
+  int8_t *boundary;
+  int predicted_class = -1;
+  int err;
+
+  memcpy(&req, &frame->payload[IMG_SIZE], sizeof(req));
+  memset(&reply, 0, sizeof(reply));
+  reply.steps_total = KERNEL_ANYTIME_STEPS;
+  if (AI_IsBlank(frame->payload))
+  {
+    reply.predicted_class = PROTO_CLASS_BLANK;
+    reply.flags = PROTO_ANYTIME_SETTLED;
+    reply.cycles = PROF_CYCLES() - t0;
+    SendFrame(PROTO_RESPONSE(PROTO_CMD_CLASSIFY_ANYTIME), frame->hdr.f.seq, &reply, sizeof(reply));
+    return;
+  }
+
+  if (Split_Begin(network, PROTO_STAGE_FRONT, SPLIT_DEFAULT, &boundary) != (int)KERNEL_DENSE_FEATURES)
+  {
+    Split_End();
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+  AI_LoadImage(frame->payload);
+  err = AI_Run();
+  if (err == 0)
+  {
+    err = (Kernel_AnytimeBegin(boundary) > 0) ? 0 : -2;
+  }
+  Split_End();
+  if (err != 0)
+  {
+    SendError(frame->hdr.f.seq, (err == -2) ? PROTO_ERR_PARAM : PROTO_ERR_INFERENCE);
+    return;
+  }
+
+  // 0 is no deadline, nor is one past the 2^32 cycles the counter spans
+  cycles = (uint64_t)req.deadline_us * (HAL_RCC_GetHCLKFreq() / 1000000U);
+  deadline = (req.deadline_us == 0U || cycles > UINT32_MAX) ? UINT32_MAX : (uint32_t)cycles;
+  for (uint32_t step = 0; step < KERNEL_ANYTIME_STEPS; step++)
+  {
+    uint32_t start = PROF_CYCLES();
+
+    if (step > 0 && start - t0 + last > deadline)
+    {
+      reply.flags |= PROTO_ANYTIME_DEADLINE;
+      break;
+    }
+    predicted_class = Kernel_AnytimeStep(step, &margin, &settled);
+    last = PROF_CYCLES() - start;
+    reply.steps = (uint8_t)(step + 1U);
+    if (settled)
+    {
+      reply.flags |= PROTO_ANYTIME_SETTLED;
+      break;
+    }
+    if (req.min_margin != 0U && margin >= req.min_margin)
+    {
+      reply.flags |= PROTO_ANYTIME_MARGIN;
+      break;
+    }
+  }
+
+  reply.predicted_class = (uint8_t)predicted_class;
+  reply.margin = margin;
+  reply.cycles = PROF_CYCLES() - t0;
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_CLASSIFY_ANYTIME), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+#endif
+
+/**
+  * @brief Classify and reply with the k best classes and their int8 scores
+  * @note  Scores are sent quantised with the output tensor's scale and
+  *        zero point, the host dequantises
+  */
+void ProcessTopK(const ProtoFrame_t *frame)
+{
+  uint8_t k = (frame->hdr.f.len > IMG_SIZE) ? frame->payload[IMG_SIZE] : PROTO_TOPK_DEFAULT;
+  const ai_buffer_meta_info *meta = AI_BUFFER_META_INFO(&ai_output[0]);
+  const int8_t *scores;
+  int prev = -1;
+  float scale;
+  int8_t zero_point;
+  ProtoTopK_t reply;
+
+  if (k == 0 || k > ai_num_classes)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  if (ClassifyImage(frame->payload) < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+    return;
+  }
+
+  // Partial selection sort, ties keep the lower class: each pass takes the
+  // best entry ranked after the previous pick (score down, then class up)
+  scores = AI_OutputBuffer();
+  for (uint8_t n = 0; n < k; n++)
+  {
+    int best = -1;
+    for (int i = 0; i < AI_CLASSES; i++)
+    {
+      if (prev >= 0 && (scores[i] > scores[prev] || (scores[i] == scores[prev] && i <= prev)))
+      {
+        continue;
+      }
+      if (best < 0 || scores[i] > scores[best])
+      {
+        best = i;
+      }
+    }
+    prev = best;
+    reply.entry[n].predicted_class = (uint8_t)best;
+    reply.entry[n].score = scores[best];
+  }
+
+  // With the softmax bypassed the scores are the logits, in their own scale
+  if (Kernel_Logits(&scale, &zero_point))
+  {
+    reply.scale = scale;
+    reply.zero_point = zero_point;
+  }
+  else
+  {
+    reply.scale = AI_BUFFER_META_INFO_INTQ_GET_SCALE(meta, 0);
+    reply.zero_point = (int8_t)AI_BUFFER_META_INFO_INTQ_GET_ZEROPOINT(meta, 0);
+  }
+  reply.k = k;
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_CLASSIFY_TOPK), frame->hdr.f.seq, &reply,
+            (uint16_t)(offsetof(ProtoTopK_t, entry) + k * sizeof(reply.entry[0])));
+}
+
+/**
+  * @brief Answer PING with the protocol version, build options, model and
+  *        the board's identity
+  */
+void SendCapabilities(uint8_t seq)
+{
+  ProtoCaps_t caps = {
+    .version = PROTO_VERSION,
+    .flags = 0,
+    .max_payload = PROTO_MAX_PAYLOAD,
+    .in_height = IMG_HEIGHT,
+    .in_width = IMG_WIDTH,
+    .in_channels = AI_NETWORK_IN_1_CHANNEL,
+    .num_classes = (uint8_t)ai_num_classes,
+    .features = PROTO_FEAT_PRIORITY,
+  };
+
+#if APP_PROFILE
+  caps.flags |= PROTO_CAP_PROFILE;
+#endif
+#if APP_PROFILE_LAYERS
+  caps.flags |= PROTO_CAP_LAYERS;
+#endif
+  if (ai_kernels)
+  {
+    caps.flags |= PROTO_CAP_KERNEL;
+  }
+  if (ai_logits)
+  {
+    caps.flags |= PROTO_CAP_LOGITS;
+  }
+#if APP_USB_CDC
+  caps.flags |= PROTO_CAP_USB;
+#endif
+#if APP_FLASH_BENCH
+  caps.flags |= PROTO_CAP_FLASH;
+#endif
+#if APP_SELFTEST
+  caps.flags |= PROTO_CAP_SELFTEST;
+#endif
+#if APP_MEMO
+  caps.flags |= PROTO_CAP_MEMO;
+#endif
+#if APP_CANCEL
+  caps.features |= PROTO_FEAT_CANCEL;
+#endif
+#if APP_UPLOAD
+  caps.features |= PROTO_FEAT_UPLOAD;
+#endif
+#if APP_SPLIT
+  caps.features |= PROTO_FEAT_STAGE;
+#endif
+#if APP_SPLIT_LINK
+  caps.features |= PROTO_FEAT_FORWARD;
+#endif
+#if APP_STRIP
+  caps.features |= PROTO_FEAT_STRIP;
+#endif
+#if APP_EMBED
+  caps.features |= PROTO_FEAT_EMBED;
+#endif
+#if APP_KNN
+  caps.features |= PROTO_FEAT_KNN;
+#endif
+  memcpy(caps.model_hash, ai_model_hash, sizeof(caps.model_hash));
+  caps.uid[0] = HAL_GetUIDw0();
+  caps.uid[1] = HAL_GetUIDw1();
+  caps.uid[2] = HAL_GetUIDw2();
+  caps.fw_version = APP_FW_VERSION;
+  caps.model_active = model_index;
+  caps.model_count = Model_Count();
+
+  // A lone link may fill every slot. Next to others it is only sure of one
+  // (RX_SlotFree), what it sends beyond waits in its ring if it has one
+  caps.rx_slots = (RX_LINK_COUNT == 1) ? RX_SLOTS : 1U;
+  if (tx_link == PROTO_LINK_UART)
+  {
+    // Refused rather than held with APP_ADMISSION
+    caps.rx_ring = APP_ADMISSION ? 0U : UART_RX_DMA_SIZE;
+  }
+#if APP_UART_LINKS
+  else if (tx_link == PROTO_LINK_USART1 || tx_link == PROTO_LINK_USART6)
+  {
+    caps.rx_ring = UART_LINK_RX_SIZE;
+  }
+#endif
+
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_PING), seq, &caps, sizeof(caps));
+}
+
+/**
+  * @brief Switch to another registered network, or report the active one
+  * @note  An empty payload only queries. A network that fails to load is
+  *        replaced by the previous one again and answered with ERR_PARAM.
+  */
+void ProcessSelectModel(const ProtoFrame_t *frame)
+{
+  ProtoModelSel_t reply;
+
+  if (frame->hdr.f.len > 1)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  if (frame->hdr.f.len == 1 && frame->payload[0] != model_index)
+  {
+    uint8_t prev = model_index;
+    if (frame->payload[0] >= Model_Count() || AI_Init(frame->payload[0]) != 0)
+    {
+      // The previous network loaded before, failing now means the arena
+      // or runtime is corrupt: same as a failed AI_Init at boot
+      if (network == AI_HANDLE_NULL && AI_Init(prev) != 0)
+      {
+        Error_Handler();
+      }
+      LOG(LOG_MODEL_FAILED, frame->payload[0], model_index);
+      SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+      return;
+    }
+  }
+
+  memset(&reply, 0, sizeof(reply));
+  reply.active = model_index;
+  reply.count = Model_Count();
+  reply.activations_size = ai_activations_size;
+  reply.weights_size = ai_weights_size;
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_SELECT_MODEL), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+
+#if APP_WEIGHT_CHECK
+/**
+  * @brief Feed the next slice of the boot-time weight check (upload.h);
+  *        a model whose blob fails it goes back to its linked weights
+  * @retval that model, -1 otherwise
+  */
+static int AI_CheckWeights(void)
+{
+  int bad = Upload_CheckPoll();
+
+  if (bad < 0)
+  {
+    return -1;
+  }
+  WATCHDOG_FEED();
+  Upload_Erase((uint8_t)bad);
+  WATCHDOG_FEED();
+  Model_Drop((uint8_t)bad);
+  if (bad == model_index && AI_Init(model_index) != 0 && AI_Init(0) != 0)
+  {
+    Error_Handler();
+  }
+  return bad;
+}
+#endif
+
+#if APP_UPLOAD
+/**
+  * @brief Move model index onto the weights just committed, between frames
+  * @note  The frames ahead of the COMMIT ran on the old weights, the other
+  *        models keep their contexts. If the active model cannot be created
+  *        on the new weights the region is erased and it comes back on its
+  *        linked ones
+  * @retval PROTO_ERR_NONE, or PROTO_ERR_PARAM after such a rollback
+  */
+static ProtoError_t AI_Swap(uint8_t index)
+{
+  Model_Drop(index);
+  if (index != model_index)
+  {
+    // Created cold on the new weights at its next SELECT_MODEL
+    Memo_Clear();
+    return PROTO_ERR_NONE;
+  }
+  if (AI_Init(index) == 0)
+  {
+    return PROTO_ERR_NONE;
+  }
+
+  WATCHDOG_FEED();
+  Upload_Erase(index);
+  WATCHDOG_FEED();
+  Model_Drop(index);
+  if (AI_Init(index) != 0 && AI_Init(0) != 0)
+  {
+    Error_Handler();
+  }
+  return PROTO_ERR_PARAM;
+}
+
+/**
+  * @brief Program, commit or erase uploaded weights (upload.h)
+  * @note  BEGIN and ERASE block for a sector erase. Every model is created
+  *        again after them, so none keeps reading a blob that changed under
+  *        it. COMMIT only re-creates the model it gave weights (AI_Swap)
+  */
+void ProcessUpload(const ProtoFrame_t *frame)
+{
+  const ProtoUploadReq_t *req = (const ProtoUploadReq_t *)frame->payload;
+  uint16_t len = frame->hdr.f.len;
+  ProtoUpload_t reply;
+  ProtoError_t err;
+
+  if (len < sizeof(ProtoUploadReq_t))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  switch (req->op)
+  {
+    case PROTO_UPLOAD_BEGIN:
+      if (len != sizeof(ProtoUploadReq_t) + 4U)
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+        return;
+      }
+      if (req->model >= Model_Count())
+      {
+        SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+        return;
+      }
+      WATCHDOG_FEED();
+      err = Upload_Begin(req->model, req->arg,
+                         __UNALIGNED_UINT32_READ(&frame->payload[sizeof(ProtoUploadReq_t)]));
+      WATCHDOG_FEED();
+      break;
+
+    case PROTO_UPLOAD_DATA:
+      err = Upload_Data(req->arg, &frame->payload[sizeof(ProtoUploadReq_t)],
+                        (uint16_t)(len - sizeof(ProtoUploadReq_t)));
+      break;
+
+    case PROTO_UPLOAD_COMMIT:
+      err = Upload_Commit();
+      if (err == PROTO_ERR_NONE)
+      {
+        err = AI_Swap(Upload_Model());
+      }
+      break;
+
+    case PROTO_UPLOAD_ERASE:
+      WATCHDOG_FEED();
+      err = Upload_Erase(req->model);
+      WATCHDOG_FEED();
+      break;
+
+    default:
+      err = PROTO_ERR_PARAM;
+      break;
+  }
+
+  if (req->op == PROTO_UPLOAD_BEGIN || req->op == PROTO_UPLOAD_ERASE)
+  {
+    for (uint8_t i = 0; i < Model_Count(); i++)
+    {
+      Model_Drop(i);
+    }
+    if (AI_Init(model_index) != 0 && AI_Init(0) != 0)
+    {
+      Error_Handler();
+    }
+  }
+  if (err != PROTO_ERR_NONE)
+  {
+    SendError(frame->hdr.f.seq, err);
+    return;
+  }
+
+  memset(&reply, 0, sizeof(reply));
+  reply.op = req->op;
+  reply.model = model_index;
+  reply.received = Upload_Received();
+  reply.capacity = Upload_Capacity(req->model);
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_UPLOAD), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+#endif
+
+#if APP_SPLIT
+/**
+  * @brief Run the front or the back stage of the network split (split.h)
+  * @note  A FRONT with PROTO_STAGE_FORWARD is not answered here: its
+  *        boundary goes to the board on APP_SPLIT_LINK as a BACK of the
+  *        same seq, and ProcessStageReply() relays what that board answers
+  */
+void ProcessStage(const ProtoFrame_t *frame)
+{
+  // Reply or forwarded request, header and boundary
+  static uint8_t out[sizeof(ProtoStage_t) + PROTO_STAGE_MAX] __attribute__((aligned(4)));
+  ProtoStageReq_t req;
+  ProtoStage_t reply;
+  uint16_t len = frame->hdr.f.len;
+  int8_t *boundary;
+  int size, predicted_class;
+
+  if (len < sizeof(req))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+  memcpy(&req, frame->payload, sizeof(req));
+  len -= sizeof(req);
+  if (!req.split)
+  {
+    req.split = SPLIT_DEFAULT;
+  }
+  if (req.stage > PROTO_STAGE_BACK || (req.flags & ~PROTO_STAGE_FORWARD) ||
+      ((req.flags & PROTO_STAGE_FORWARD) && (req.stage != PROTO_STAGE_FRONT || !APP_SPLIT_LINK)))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  size = Split_Begin(network, req.stage, req.split, &boundary);
+  if (size < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+  if (len != ((req.stage == PROTO_STAGE_FRONT) ? IMG_SIZE : (uint16_t)size))
+  {
+    Split_End();
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  if (req.stage == PROTO_STAGE_FRONT)
+  {
+    AI_LoadImage(&frame->payload[sizeof(req)]);
+  }
+  else
+  {
+    memcpy(boundary, &frame->payload[sizeof(req)], (uint32_t)size);
+  }
+  // The front's argmax reads a stale output, it is not reported
+  predicted_class = ClassifyInput();
+  Split_End();
+  if (predicted_class < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+    return;
+  }
+
+#if APP_SPLIT_LINK
+  if (req.flags & PROTO_STAGE_FORWARD)
+  {
+    req.stage = PROTO_STAGE_BACK;
+    req.flags = 0;
+    memcpy(out, &req, sizeof(req));
+    memcpy(&out[sizeof(req)], boundary, (uint32_t)size);
+    split_reply_link = frame->link;
+    tx_link = APP_SPLIT_LINK;
+    SendFrame(PROTO_CMD_STAGE, frame->hdr.f.seq, out, (uint16_t)(sizeof(req) + size));
+    return;
+  }
+#endif
+
+  memset(&reply, 0, sizeof(reply));
+  reply.stage = req.stage;
+  reply.split = req.split;
+  reply.model = model_index;
+  reply.size = (uint16_t)size;
+  reply.predicted_class = (req.stage == PROTO_STAGE_BACK) ? (uint8_t)predicted_class : PROTO_CLASS_NONE;
+  memcpy(out, &reply, sizeof(reply));
+  if (req.stage == PROTO_STAGE_FRONT)
+  {
+    memcpy(&out[sizeof(reply)], boundary, (uint32_t)size);
+  }
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_STAGE), frame->hdr.f.seq, out,
+            (uint16_t)(sizeof(reply) + ((req.stage == PROTO_STAGE_FRONT) ? size : 0)));
+}
+#endif
+
+#if APP_SPLIT_LINK
+/**
+  * @brief Relay the back board's answer to a forwarded STAGE, as it came
+  * @note  A corrupted one is dropped: its seq cannot be trusted, the host
+  *        times out and sends the FRONT again
+  */
+static void ProcessStageReply(const ProtoFrame_t *frame)
+{
+  // The parser took the priority bit off an ERROR's 0xFF type
+  uint8_t type = frame->hdr.f.type | (frame->priority ? PROTO_PRIORITY_FLAG : 0U);
+
+  if (Proto_CheckFrame(frame) != 0)
+  {
+    STATS_COUNT(STATS_ERR_CRC);
+    return;
+  }
+  tx_link = split_reply_link;
+  SendFrame(type, frame->hdr.f.seq, frame->payload, frame->hdr.f.len);
+}
+#endif
+
+#if APP_STRIP
+/**
+  * @brief Classify every 28x28 window of a 28 x width strip
+  * @note  The convs run once over the whole strip (Kernel_Strip), then each
+  *        window is a STAGE BACK of its 5 columns of their output
+  */
+void ProcessStrip(const ProtoFrame_t *frame)
+{
+  // Header, classes, scores
+  static uint8_t out[sizeof(ProtoStrip_t) + 2U * APP_STRIP];
+  ProtoStripReq_t req;
+  ProtoStrip_t reply;
+  uint8_t *classes = &out[sizeof(reply)];
+  int8_t *boundary;
+  int predicted_class = 0;
+
+  if (frame->hdr.f.len < sizeof(req))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+  memcpy(&req, frame->payload, sizeof(req));
+  if (frame->hdr.f.len != sizeof(req) + (uint32_t)IMG_HEIGHT * req.width)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+  if (!req.stride)
+  {
+    req.stride = PROTO_STRIP_STRIDE;
+  }
+  if (req.width < IMG_WIDTH || req.stride % PROTO_STRIP_STRIDE ||
+      Kernel_Strip(&frame->payload[sizeof(req)], req.width) == 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+  if (Split_Begin(network, PROTO_STAGE_BACK, SPLIT_DEFAULT, &boundary) != (int)KERNEL_STRIP_FEATURES)
+  {
+    Split_End();
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  memset(&reply, 0, sizeof(reply));
+  reply.count = (uint8_t)((req.width - IMG_WIDTH) / req.stride + 1U);
+  reply.stride = req.stride;
+  reply.model = model_index;
+  for (uint32_t k = 0; k < reply.count && predicted_class >= 0; k++)
+  {
+    Kernel_StripWindow(k * req.stride / PROTO_STRIP_STRIDE, boundary);
+    predicted_class = ClassifyInput();
+    classes[k] = (uint8_t)predicted_class;
+    classes[reply.count + k] = (predicted_class >= 0) ? (uint8_t)AI_OutputBuffer()[predicted_class] : 0U;
+  }
+  Split_End();
+  if (predicted_class < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+    return;
+  }
+
+  memcpy(out, &reply, sizeof(reply));
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_STRIP), frame->hdr.f.seq, out,
+            (uint16_t)(sizeof(reply) + 2U * reply.count));
+}
+#endif
+
+#if APP_EMBED
+_Static_assert(sizeof(ProtoEmbed_t) + PROTO_EMBED_MAX <= PROTO_MAX_REPLY, "embedding does not fit a reply");
+
+/**
+  * @brief Classify an image and answer the embedding the last dense layer read
+  */
+void ProcessEmbed(const ProtoFrame_t *frame)
+{
+  static uint8_t out[sizeof(ProtoEmbed_t) + PROTO_EMBED_MAX] __attribute__((aligned(4)));
+  ProtoEmbed_t reply;
+  const int8_t *embedding;
+  int predicted_class, size;
+
+  if (frame->hdr.f.len != IMG_SIZE)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  AI_LoadImage(frame->payload);
+  predicted_class = ClassifyInput();
+  if (predicted_class < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+    return;
+  }
+
+  memset(&reply, 0, sizeof(reply));
+  size = Model_Embedding(network, &embedding, &reply.zero_point);
+  if (size < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+  reply.predicted_class = (uint8_t)predicted_class;
+  reply.model = model_index;
+  reply.size = (uint16_t)size;
+  memcpy(out, &reply, sizeof(reply));
+  memcpy(&out[sizeof(reply)], embedding, (uint32_t)size);
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_EMBED), frame->hdr.f.seq, out, (uint16_t)(sizeof(reply) + size));
+}
+#endif
+
+#if APP_KNN
+/**
+  * @brief Classify an image against the enrolled embeddings, or enrol it (knn.h)
+  */
+void ProcessKnn(const ProtoFrame_t *frame)
+{
+  ProtoKnnReq_t req;
+  ProtoKnn_t reply;
+  const int8_t *embedding;
+  int8_t zero_point;
+  uint32_t distance = 0;
+  int predicted_class, size, label;
+
+  if (frame->hdr.f.len < sizeof(req))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+  memcpy(&req, frame->payload, sizeof(req));
+  memset(&reply, 0, sizeof(reply));
+  reply.label = PROTO_CLASS_NONE;
+  reply.predicted_class = PROTO_CLASS_NONE;
+  reply.capacity = APP_KNN;
+
+  if (req.op == PROTO_KNN_CLEAR)
+  {
+    Knn_Clear();
+    SendFrame(PROTO_RESPONSE(PROTO_CMD_KNN), frame->hdr.f.seq, &reply, sizeof(reply));
+    return;
+  }
+  if (req.op > PROTO_KNN_ENROLL || (req.op == PROTO_KNN_ENROLL && req.label == PROTO_CLASS_NONE))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+  if (frame->hdr.f.len != sizeof(req) + IMG_SIZE)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  AI_LoadImage(&frame->payload[sizeof(req)]);
+  predicted_class = ClassifyInput();
+  if (predicted_class < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+    return;
+  }
+  size = Model_Embedding(network, &embedding, &zero_point);
+  if (size < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  if (req.op == PROTO_KNN_ENROLL)
+  {
+    if (Knn_Enroll(model_index, embedding, (uint32_t)size, req.label) < 0)
+    {
+      SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+      return;
+    }
+  }
+  else
+  {
+    label = Knn_Nearest(model_index, embedding, (uint32_t)size, &distance);
+    reply.label = (label < 0) ? PROTO_CLASS_NONE : (uint8_t)label;
+    reply.distance = distance;
+  }
+  reply.predicted_class = (uint8_t)predicted_class;
+  reply.count = Knn_Count();
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_KNN), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+#endif
+
+#if APP_MODEL_MULTIHEAD
+_Static_assert(PROTO_HEADS_MAX >= MODEL_HEADS_MAX, "heads do not fit a HEADS reply");
+
+/**
+  * @brief Run the backbone once and the heads the request names, answer
+  *        each head's class and score
+  */
+void ProcessHeads(const ProtoFrame_t *frame)
+{
+  ProtoHeads_t reply;
+  uint8_t mask;
+  uint8_t k;
+  int rc;
+
+  if (frame->hdr.f.len != IMG_SIZE + 1U)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+  mask = frame->payload[IMG_SIZE];
+  if (mask == 0U)
+  {
+    mask = (uint8_t)((1U << ai_heads) - 1U);
+  }
+  if (mask >> ai_heads)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  AI_LoadImage(frame->payload);
+  ai_heads_run = mask;
+  rc = ClassifyInput();
+  ai_heads_run = 1U;
+  if (rc < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+    return;
+  }
+
+  memset(&reply, 0, sizeof(reply));
+  reply.heads = ai_heads;
+  reply.ran = mask;
+  reply.model = model_index;
+  for (k = 0; k < PROTO_HEADS_MAX; k++)
+  {
+    reply.head[k].predicted_class = PROTO_CLASS_NONE;
+    if (k < ai_heads && (mask & (1U << k)))
+    {
+      const int8_t *scores = (const int8_t *)ai_output[k].data;
+      int best = Pre_Argmax(scores, (int)AI_BUFFER_SIZE(&ai_output[k]));
+
+      reply.head[k].predicted_class = (uint8_t)best;
+      reply.head[k].score = scores[best];
+    }
+  }
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_HEADS), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+#endif
+
+#if APP_CONFIG
+/**
+  * @brief Save the running settings for the next boots, forget them, or
+  *        report them (config.h)
+  * @note  The SAVE request itself arrived at the running baud rate, so the
+  *        rate it keeps is one the host speaks
+  */
+void ProcessConfig(const ProtoFrame_t *frame)
+{
+  ProtoConfig_t reply;
+  uint8_t op = (frame->hdr.f.len == 1) ? frame->payload[0] : PROTO_CONFIG_GET;
+
+  if (frame->hdr.f.len > 1)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  memset(&reply, 0, sizeof(reply));
+  if (op == PROTO_CONFIG_SAVE)
+  {
+    reply.baud = huart2.Init.BaudRate;
+    reply.model = model_index;
+    reply.clock = (uint8_t)Clock_GetProfile();
+    reply.flash = Clock_GetFlashAccel();
+    Config_Save(&reply);
+  }
+  else if (op == PROTO_CONFIG_CLEAR)
+  {
+    Config_Clear();
+  }
+  else if (op != PROTO_CONFIG_GET)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  if (Config_Load(&reply) != 0)
+  {
+    memset(&reply, 0, sizeof(reply));
+  }
+  if (config_applied)
+  {
+    reply.flags |= PROTO_CONFIG_APPLIED;
+  }
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_CONFIG), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+
+/**
+  * @brief Go back to the saved clock profile, ART flags and baud rate
+  * @note  A setting that cannot be applied is left at its boot value
+  */
+static void Config_Restore(const ProtoConfig_t *saved)
+{
+  uint32_t oversampling;
+
+  if (saved->clock != (uint8_t)Clock_GetProfile() && saved->clock < CLOCK_PROFILE_COUNT)
+  {
+    // A failed switch may still have moved SYSCLK, BRR is reprogrammed below
+    Clock_ApplyProfile((ClockProfile_t)saved->clock);
+  }
+  Clock_SetFlashAccel(saved->flash);
+
+  // Reception has not started yet, only BRR changes
+  if (saved->baud != huart2.Init.BaudRate && UART_CheckBaud(saved->baud, &oversampling))
+  {
+    huart2.Init.BaudRate = saved->baud;
+    huart2.Init.OverSampling = oversampling;
+    baud_saved = 1;
+  }
+  if (HAL_UART_Init(&huart2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief The first bytes at the saved rate open the window a SET_BAUD
+  *        would: with no intact frame in BAUD_CONFIRM_MS, USART2 goes back
+  *        to UART_DEFAULT_BAUD for a host that does not know the rate
+  */
+static void UART_ConfirmSavedBaud(void)
+{
+  if (baud_saved && rx_activity_tick != 0)
+  {
+    baud_saved = 0;
+    baud_pending = 1;
+    baud_switch_tick = rx_activity_tick;
+  }
+}
+#endif
+
+/**
+  * @brief Lead of the predicted class over the runner-up in the last output
+  */
+static uint8_t AI_OutputMargin(int predicted_class)
+{
+  const int8_t *scores = AI_OutputBuffer();
+  int second = -129;
+
+  for (int i = 0; i < AI_CLASSES; i++)
+  {
+    if (i != predicted_class && scores[i] > second)
+    {
+      second = scores[i];
+    }
+  }
+  return (second < -128) ? 255U : (uint8_t)(scores[predicted_class] - second);
+}
+
+/**
+  * @brief Classify with one registered network, loading it if it is not active
+  * @retval predicted class, -1 if inference failed, -2 if it did not load
+  */
+static int ClassifyWith(uint8_t index, const uint8_t *img)
+{
+  if ((index != model_index || network == AI_HANDLE_NULL) && AI_Init(index) != 0)
+  {
+    return -2;
+  }
+  return ClassifyImage(img);
+}
+
+/**
+  * @brief Early-exit classification: a cheap model first, the full one only
+  *        when the first is not confident enough
+  * @note  Each stage that is not the active model costs a warm re-init, and
+  *        the active model is restored afterwards
+  */
+void ProcessCascade(const ProtoFrame_t *frame)
+{
+#if APP_PROFILE
+  uint32_t t0 = PROF_CYCLES();
+#endif
+  ProtoCascadeReq_t req;
+  ProtoCascade_t reply = { 0 };
+  uint8_t prev = model_index;
+  int predicted_class;
+
+  memcpy(&req, &frame->payload[IMG_SIZE], sizeof(req));
+  if (req.first >= Model_Count() || req.full >= Model_Count())
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  reply.stage = PROTO_CASCADE_FIRST;
+  predicted_class = ClassifyWith(req.first, frame->payload);
+  if (predicted_class >= 0)
+  {
+    reply.margin = AI_OutputMargin(predicted_class);
+    if (reply.margin < req.min_margin)
+    {
+      reply.stage = PROTO_CASCADE_FULL;
+      predicted_class = ClassifyWith(req.full, frame->payload);
+      if (predicted_class >= 0)
+      {
+        reply.margin = AI_OutputMargin(predicted_class);
+      }
+    }
+  }
+
+  if (model_index != prev || network == AI_HANDLE_NULL)
+  {
+    // prev loaded before, see ProcessSelectModel
+    if (AI_Init(prev) != 0)
+    {
+      Error_Handler();
+    }
+  }
+
+  if (predicted_class < 0)
+  {
+    SendError(frame->hdr.f.seq, (predicted_class == -2) ? PROTO_ERR_PARAM : PROTO_ERR_INFERENCE);
+    return;
+  }
+
+  reply.predicted_class = (uint8_t)predicted_class;
+#if APP_PROFILE
+  reply.cycles = PROF_CYCLES() - t0;
+#endif
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_CLASSIFY_CASCADE), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+
+/**
+  * @brief Reply with the SRAM budget and the stack high-water mark
+  */
+void SendMemStats(uint8_t seq)
+{
+  ProtoMemStat_t stats;
+
+  Mem_GetStats(&stats);
+  stats.weight_cache = Model_CachedBytes();
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_MEMSTAT), seq, &stats, sizeof(stats));
+}
+
+#if APP_STATS
+/**
+  * @brief Reply with the runtime counters, zeroing them on PROTO_STATS_RESET
+  */
+void ProcessStats(const ProtoFrame_t *frame)
+{
+  ProtoStats_t stats;
+
+  if (frame->hdr.f.len > 1)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  Stats_Get(&stats, frame->hdr.f.len == 1 && (frame->payload[0] & PROTO_STATS_RESET));
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_STATS), frame->hdr.f.seq, &stats, sizeof(stats));
+}
+#endif
+
+#if APP_TIMESTAMPS
+/**
+  * @brief Reply with the request's arrival and reply stamps, for the host's clock fit
+  * @note  The optional flags byte turns reply stamping on or off
+  */
+void ProcessClockSync(const ProtoFrame_t *frame)
+{
+  ProtoClockSync_t reply;
+
+  if (frame->hdr.f.len > 1)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  Stamp_Sync(&reply, frame->hdr.f.len == 1 ? &frame->payload[0] : NULL);
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_CLOCK_SYNC), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+#endif
+
+#if APP_TELEMETRY
+/**
+  * @brief Set the telemetry interval, pushes go to this frame's link; reply with a frame
+  */
+void ProcessTelemetry(const ProtoFrame_t *frame)
+{
+  ProtoTelemetry_t reply;
+  uint16_t interval_ms;
+
+  if (frame->hdr.f.len != sizeof(interval_ms))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  memcpy(&interval_ms, frame->payload, sizeof(interval_ms));
+  Telemetry_Configure(interval_ms, frame->link);
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_TELEMETRY), frame->hdr.f.seq, &reply,
+            Telemetry_Fill(&reply, PROTO_TELEM_ASKED));
+}
+
+/**
+  * @brief Push a telemetry frame with seq 0 once one is due, between requests
+  * @note  Waits while the USART2 TX ring could not take it at once, so the
+  *        push never holds the loop up behind replies
+  */
+static void TelemetryPush(void)
+{
+  ProtoTelemetry_t frame;
+  uint8_t reason = Telemetry_Due();
+
+  if (!reason)
+  {
+    return;
+  }
+  if (Telemetry_Link() == PROTO_LINK_UART &&
+      (uint16_t)(TX_RING_SIZE - (uint16_t)(tx_head - tx_tail)) < sizeof(frame) + PROTO_OVERHEAD)
+  {
+    return;
+  }
+  tx_link = Telemetry_Link();
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_TELEMETRY), 0, &frame, Telemetry_Fill(&frame, reason));
+}
+#endif
+
+#if APP_LOG
+/**
+  * @brief Reply with the oldest log records, removing them from the ring
+  */
+void SendLog(uint8_t seq)
+{
+  static struct __attribute__((packed)) {
+    ProtoLogHeader_t header;
+    ProtoLogRecord_t records[PROTO_LOG_MAX];
+  } reply;
+  uint8_t n = Log_Drain(&reply.header, reply.records, PROTO_LOG_MAX);
+
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_LOG), seq, &reply,
+            (uint16_t)(sizeof(reply.header) + n * sizeof(ProtoLogRecord_t)));
+}
+#endif
+
+#if APP_CANCEL
+/**
+  * @brief Whether a CANCEL waiting in a slot abandons frame
+  * @note  Checked here, not on arrival: the CRC unit belongs to the context
+  *        that processes frames. Cheap, a CANCEL is two CRC words
+  */
+static uint8_t RX_Cancelled(const ProtoFrame_t *frame)
+{
+  uint8_t pending = cancel_slots;
+  uint8_t type = frame->hdr.f.type;
+
+  // The requests that run the network for a result of their own
+  if (type != PROTO_CMD_CLASSIFY && type != PROTO_CMD_CLASSIFY_PROF &&
+      type != PROTO_CMD_CLASSIFY_TOPK && type != PROTO_CMD_CLASSIFY_PACKED &&
+      type != PROTO_CMD_CLASSIFY_CROP && type != PROTO_CMD_CLASSIFY_CASCADE &&
+      type != PROTO_CMD_CLASSIFY_SMALL && type != PROTO_CMD_CLASSIFY_ANYTIME &&
+      type != PROTO_CMD_CLASSIFY_TTA)
+  {
+    return 0;
+  }
+
+  for (uint8_t slot = 0; pending; slot++, pending >>= 1)
+  {
+    const ProtoFrame_t *cancel = RX_Frame(slot);
+
+    if ((pending & 1U) && cancel->link == frame->link && cancel->hdr.f.len == 1U &&
+        cancel->payload[0] == frame->hdr.f.seq && Proto_CheckFrame(cancel) == 0)
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief CANCEL reaches its turn: whatever it abandoned is answered, ack it
+  */
+void ProcessCancel(const ProtoFrame_t *frame)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  cancel_slots &= (uint8_t)~(1U << RX_Slot(frame));
+  __set_PRIMASK(primask);
+
+  if (frame->hdr.f.len != 1U)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_CANCEL), frame->hdr.f.seq, NULL, 0);
+}
+#endif
+
+#if APP_FLASH_BENCH || APP_WCET
+// Set by STM32F411VETX_FLASH_RAMFUNC.ld only, both 0 otherwise
+extern const uint8_t __ai_ramfunc_start[] __attribute__((weak));
+extern const uint8_t __ai_ramfunc_end[] __attribute__((weak));
+#endif
+
+#if APP_FLASH_BENCH
+_Static_assert(PROTO_FLASH_PREFETCH == CLOCK_FLASH_PREFETCH &&
+               PROTO_FLASH_ICACHE == CLOCK_FLASH_ICACHE &&
+               PROTO_FLASH_DCACHE == CLOCK_FLASH_DCACHE, "FLASH flags are passed through");
+
+/**
+  * @brief Switch the ART accelerator features (no payload only asks), reply
+  *        with what is enabled
+  */
+void ProcessFlash(const ProtoFrame_t *frame)
+{
+  ProtoFlash_t reply = {0};
+
+  if (frame->hdr.f.len > 1)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+  if (frame->hdr.f.len == 1)
+  {
+    if (frame->payload[0] & ~(PROTO_FLASH_PREFETCH | PROTO_FLASH_ICACHE | PROTO_FLASH_DCACHE))
+    {
+      SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+      return;
+    }
+    Clock_SetFlashAccel(frame->payload[0]);
+  }
+
+  reply.cpu_hz = HAL_RCC_GetHCLKFreq();
+  reply.flags = Clock_GetFlashAccel();
+  reply.latency = (uint8_t)__HAL_FLASH_GET_LATENCY();
+  reply.ram_code = (uint32_t)(__ai_ramfunc_end - __ai_ramfunc_start);
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_FLASH), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+#endif
+
+#if APP_SELFTEST
+/**
+  * @brief Classify every embedded test vector, reply with accuracy and the
+  *        cycles of each network run
+  * @note  The conversion and the argmax are outside the timed span, so the
+  *        cycles compare with the c_macc of the generate report
+  */
+void ProcessSelfTest(const ProtoFrame_t *frame)
+{
+  ProtoSelfTest_t reply = {0};
+  uint64_t total = 0;
+
+  if (frame->hdr.f.len != 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  reply.cycles_min = UINT32_MAX;
+  reply.first_wrong = 0xFFFFU;
+  for (uint16_t i = 0; i < test_vector_count; i++)
+  {
+    uint32_t t0, cycles;
+
+    AI_LoadImage(test_vector_images[i]);
+    t0 = PROF_CYCLES();
+    if (AI_Run() != 0)
+    {
+      reply.failed++;
+      continue;
+    }
+    cycles = PROF_CYCLES() - t0;
+
+    total += cycles;
+    if (cycles < reply.cycles_min) reply.cycles_min = cycles;
+    if (cycles > reply.cycles_max) reply.cycles_max = cycles;
+    if (Pre_Argmax(AI_OutputBuffer(), AI_CLASSES) == test_vector_labels[i])
+    {
+      reply.correct++;
+    }
+    else if (reply.first_wrong == 0xFFFFU)
+    {
+      reply.first_wrong = i;
+    }
+  }
+
+  reply.count = test_vector_count;
+  if (reply.count > reply.failed)
+  {
+    reply.cycles_mean = (uint32_t)(total / (reply.count - reply.failed));
+  }
+  else
+  {
+    reply.cycles_min = 0;
+  }
+  reply.cpu_hz = HAL_RCC_GetHCLKFreq();
+  reply.macc = ai_macc_count;
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_SELFTEST), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+#endif
+
+#if APP_WCET || APP_IRQ_LATENCY
+/**
+  * @brief Input of WCET run i: images that load the kernels differently,
+  *        taken in turn
+  */
+static void Wcet_Input(uint32_t i, uint8_t *img)
+{
+  static uint32_t lcg = 1;
+
+  switch (i % 4U)
+  {
+    case 0:
+      // Noise: nothing to skip, every requantisation different
+      for (uint32_t n = 0; n < IMG_SIZE; n++)
+      {
+        lcg = lcg * 1664525U + 1013904223U;
+        img[n] = (uint8_t)(lcg >> 24);
+      }
+      break;
+    case 1:
+      // Full ink: the largest sums, saturating activations
+      memset(img, 0xFF, IMG_SIZE);
+      break;
+    case 2:
+      // Checkerboard: alternating signs under every kernel tap
+      for (uint32_t n = 0; n < IMG_SIZE; n++)
+      {
+        img[n] = ((n / IMG_WIDTH + n % IMG_WIDTH) & 1U) ? 0xFFU : 0U;
+      }
+      break;
+    default:
+#if APP_SELFTEST
+      memcpy(img, test_vector_images[(i / 4U) % test_vector_count], IMG_SIZE);
+#else
+      // A diagonal stroke, a digit-like load
+      for (uint32_t n = 0; n < IMG_SIZE; n++)
+      {
+        int32_t d = (int32_t)(n / IMG_WIDTH) - (int32_t)(n % IMG_WIDTH);
+        img[n] = (d > -3 && d < 3) ? 0xFFU : 0U;
+      }
+#endif
+      break;
+  }
+}
+#endif
+
+#if APP_WCET
+_Static_assert(sizeof(ProtoWcet_t) + MODEL_MAX_NODES * sizeof(uint32_t) <= PROTO_MAX_REPLY,
+               "WCET reply with every c-node must fit");
+
+/**
+  * @brief Run the network under worst conditions, reply with the most
+  *        cycles of each stage
+  * @note  Interrupts stay on: receive DMA, the UART and SysTick taking
+  *        cycles from a run are in its count, as they would be in service.
+  *        The parser drains what arrived between runs, outside the spans.
+  *        With APP_DETERMINISTIC the runs are quiet as in service, unless
+  *        PROTO_WCET_OPEN asks for them as without it
+  */
+void ProcessWcet(const ProtoFrame_t *frame)
+{
+  static uint8_t image[IMG_SIZE];
+  uint8_t out[sizeof(ProtoWcet_t) + MODEL_MAX_NODES * sizeof(uint32_t)];
+  uint32_t node_max[MODEL_MAX_NODES] = {0};
+  ProtoWcetReq_t req;
+  ProtoWcet_t reply;
+  uint8_t allowed = PROTO_WCET_COLD;
+
+#if APP_DETERMINISTIC
+  allowed |= PROTO_WCET_OPEN;
+#endif
+  if (frame->hdr.f.len != sizeof(req))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+  memcpy(&req, frame->payload, sizeof(req));
+  if (req.runs == 0)
+  {
+    req.runs = PROTO_WCET_RUNS_DEFAULT;
+  }
+  if (req.runs > PROTO_WCET_RUNS_MAX || (req.flags & ~allowed))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  memset(&reply, 0, sizeof(reply));
+  reply.run_min = UINT32_MAX;
+#if APP_DETERMINISTIC
+  ai_quiet = (req.flags & PROTO_WCET_OPEN) ? 0U : 1U;
+#endif
+  for (uint32_t i = 0; i < req.runs; i++)
+  {
+    uint32_t t0, t1, t2, t3, written = uart_rx_written;
+    uint8_t epoch = uart_rx_epoch;
+
+    WATCHDOG_FEED();
+    Wcet_Input(i, image);
+    if (req.flags & PROTO_WCET_COLD)
+    {
+      // Turning the caches back on flushes them
+      Clock_SetFlashAccel(Clock_GetFlashAccel());
+    }
+
+    t0 = PROF_CYCLES();
+    AI_LoadImage(image);
+    t1 = PROF_CYCLES();
+    if (AI_Run() != 0)
+    {
+#if APP_DETERMINISTIC
+      ai_quiet = 1;
+#endif
+      SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+      return;
+    }
+    t2 = PROF_CYCLES();
+    (void)Pre_Argmax(AI_OutputBuffer(), AI_CLASSES);
+    t3 = PROF_CYCLES();
+
+    if (t1 - t0 > reply.load_max) reply.load_max = t1 - t0;
+    if (t2 - t1 < reply.run_min) reply.run_min = t2 - t1;
+    if (t2 - t1 > reply.run_max) reply.run_max = t2 - t1;
+    if (t3 - t2 > reply.argmax_max) reply.argmax_max = t3 - t2;
+    if (t3 - t0 > reply.total_max) reply.total_max = t3 - t0;
+#if APP_PROFILE_LAYERS
+    {
+      const ProfNode_t *nodes;
+      uint16_t n = Prof_NodeTable(&nodes);
+      for (uint16_t k = 0; k < n; k++)
+      {
+        if (nodes[k].cycles > node_max[k]) node_max[k] = nodes[k].cycles;
+      }
+      reply.nodes = (uint8_t)n;
+    }
+#endif
+    if (uart_rx_epoch == epoch)
+    {
+      reply.rx_bytes += uart_rx_written - written;
+    }
+#if !APP_RTOS
+    UART_PollReception();
+#endif
+  }
+
+  reply.cpu_hz = HAL_RCC_GetHCLKFreq();
+  reply.runs = req.runs;
+  reply.flags = req.flags;
+#if APP_DETERMINISTIC
+  if (ai_quiet)
+  {
+    reply.flags |= PROTO_WCET_QUIET;
+  }
+  ai_quiet = 1;
+#endif
+  if (__ai_ramfunc_end - __ai_ramfunc_start > 0)
+  {
+    reply.flags |= PROTO_WCET_RAM_CODE;
+  }
+  memcpy(out, &reply, sizeof(reply));
+  memcpy(&out[sizeof(reply)], node_max, reply.nodes * sizeof(uint32_t));
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_WCET), frame->hdr.f.seq, out,
+            (uint16_t)(sizeof(reply) + reply.nodes * sizeof(uint32_t)));
+}
+#endif
+
+#if APP_IRQ_LATENCY
+/**
+  * @brief Run the network back to back while TIM2 raises RX arrivals,
+  *        reply with their latency histogram
+  * @note  The parser drains the ring between runs, as the main loop does
+  *        in service; the longest span between two drains is gap_max
+  */
+void ProcessIrqLatency(const ProtoFrame_t *frame)
+{
+  static uint8_t image[IMG_SIZE];
+  uint8_t out[sizeof(ProtoIrqLat_t) + PROTO_IRQLAT_BUCKETS * sizeof(uint32_t)];
+  uint32_t buckets[PROTO_IRQLAT_BUCKETS];
+  ProtoIrqLatReq_t req;
+  ProtoIrqLat_t reply;
+  uint32_t drained;
+
+  if (frame->hdr.f.len != sizeof(req))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+  memcpy(&req, frame->payload, sizeof(req));
+  if (req.runs == 0)
+  {
+    req.runs = PROTO_WCET_RUNS_DEFAULT;
+  }
+  if (req.baud == 0)
+  {
+    req.baud = PROTO_IRQLAT_BAUD_DEFAULT;
+  }
+  if (req.runs > PROTO_WCET_RUNS_MAX || IrqLat_Start(req.baud) != 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  memset(&reply, 0, sizeof(reply));
+  drained = PROF_CYCLES();
+  for (uint32_t i = 0; i < req.runs; i++)
+  {
+    uint32_t now;
+
+    WATCHDOG_FEED();
+    Wcet_Input(i, image);
+    AI_LoadImage(image);
+    if (AI_Run() != 0)
+    {
+      IrqLat_Stop();
+      SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+      return;
+    }
+    (void)Pre_Argmax(AI_OutputBuffer(), AI_CLASSES);
+#if !APP_RTOS
+    UART_PollReception();
+#endif
+    now = PROF_CYCLES();
+    if (now - drained > reply.gap_max) reply.gap_max = now - drained;
+    drained = now;
+  }
+  IrqLat_Stop();
+
+  IrqLat_Read(&reply, buckets);
+  reply.runs = req.runs;
+  reply.rx_ring = UART_RX_DMA_SIZE;
+  memcpy(out, &reply, sizeof(reply));
+  memcpy(&out[sizeof(reply)], buckets, sizeof(buckets));
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_IRQ_LATENCY), frame->hdr.f.seq, out, sizeof(out));
+}
+#endif
+
+#if APP_ENERGY
+/**
+  * @brief Awake and asleep time, inferences and energy per clock profile
+  * @note  The optional flags byte resets the counters after the reply and
+  *        sets whether idle may enter STOP mode
+  */
+void ProcessEnergy(const ProtoFrame_t *frame)
+{
+  uint8_t out[sizeof(ProtoEnergy_t) + ENERGY_SLOTS * sizeof(ProtoEnergySlot_t)];
+  ProtoEnergy_t header;
+  uint8_t flags = (frame->hdr.f.len >= 1U) ? frame->payload[0] : 0U;
+  uint8_t slots;
+
+  if (frame->hdr.f.len > 1U)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+#if APP_IDLE_STOP_MS
+  if (flags & PROTO_ENERGY_SET_IDLE)
+  {
+    idle_stop = (flags & PROTO_ENERGY_STOP) ? 1U : 0U;
+  }
+#else
+  if ((flags & PROTO_ENERGY_SET_IDLE) && (flags & PROTO_ENERGY_STOP))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+#endif
+
+  slots = Energy_Read(&header, (ProtoEnergySlot_t*)&out[sizeof(header)]);
+#if APP_IDLE_STOP_MS
+  header.flags = PROTO_ENERGY_STOP_BUILT | (idle_stop ? PROTO_ENERGY_STOP : 0U);
+#endif
+  memcpy(out, &header, sizeof(header));
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_ENERGY), frame->hdr.f.seq, out,
+            (uint16_t)(sizeof(header) + slots * sizeof(ProtoEnergySlot_t)));
+  if (flags & PROTO_ENERGY_RESET)
+  {
+    Energy_Reset();
+  }
+}
+#endif
+
+#if APP_PROFILE
+/**
+  * @brief Classify and reply with the class and per-stage cycle counts
+  */
+void ProcessProfiledInference(const ProtoFrame_t *frame)
+{
+  uint32_t t0 = PROF_CYCLES();
+  int predicted_class;
+  ProtoProfile_t reply;
+
+  if (AI_IsBlank(frame->payload))
+  {
+    // Only the ink check ran
+    prof.pre_cycles = PROF_CYCLES() - t0;
+    prof.run_cycles = 0;
+    prof.argmax_cycles = 0;
+    predicted_class = PROTO_CLASS_BLANK;
+  }
+  else
+  {
+    predicted_class = ClassifyImage(frame->payload);
+  }
+
+  if (predicted_class < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+    return;
+  }
+
+  // Snapshot first, the TX interrupt overwrites tx_cycles with this reply's time
+  __disable_irq();
+  reply = prof;
+  reply.isr_cycles = uart_isr_cycles;
+  reply.isr_bytes = uart_isr_bytes;
+  uart_isr_cycles = 0;
+  uart_isr_bytes = 0;
+  __enable_irq();
+  reply.predicted_class = (uint8_t)predicted_class;
+  reply.cpu_hz = HAL_RCC_GetHCLKFreq();
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_CLASSIFY_PROF), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+#endif
+
+#if APP_CMSIS_NN && APP_PROFILE
+_Static_assert(sizeof(ProtoNnBench_t) + MODEL_MAX_NODES * sizeof(ProtoNnBenchLayer_t) <= PROTO_MAX_REPLY,
+               "NN_BENCH reply with every c-node must fit");
+
+/**
+  * @brief Every layer on the library and on CMSIS-NN, cycles and output agreement
+  */
+void ProcessNnBench(const ProtoFrame_t *frame)
+{
+  uint8_t out[sizeof(ProtoNnBench_t) + MODEL_MAX_NODES * sizeof(ProtoNnBenchLayer_t)];
+  ProtoNnBenchLayer_t layers[MODEL_MAX_NODES];
+  ProtoNnBench_t reply;
+  ProtoError_t err = CmsisNN_Bench(frame->payload, ClassifyImage, &reply, layers);
+
+  if (err != PROTO_ERR_NONE)
+  {
+    SendError(frame->hdr.f.seq, err);
+    return;
+  }
+  memcpy(out, &reply, sizeof(reply));
+  memcpy(&out[sizeof(reply)], layers, reply.layers * sizeof(ProtoNnBenchLayer_t));
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_NN_BENCH), frame->hdr.f.seq, out,
+            (uint16_t)(sizeof(reply) + reply.layers * sizeof(ProtoNnBenchLayer_t)));
+}
+#endif
+
+#if KERNEL_ANY && APP_PROFILE
+/**
+  * @brief Time a library layer and its custom kernel on one image
+  */
+void ProcessKernelBench(const ProtoFrame_t *frame)
+{
+  uint8_t kernel = (frame->hdr.f.len > IMG_SIZE) ? frame->payload[IMG_SIZE] : PROTO_KERNEL_CONV;
+  ProtoKernelBench_t reply;
+  ProtoError_t err = Kernel_Bench(kernel, frame->payload, ClassifyImage, &reply);
+
+  if (err != PROTO_ERR_NONE)
+  {
+    SendError(frame->hdr.f.seq, err);
+    return;
+  }
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_KERNEL_BENCH), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+#endif
+
+#if APP_PROFILE_LAYERS
+/**
+  * @brief Reply with the per c-node cycle counts of the last inference
+  * @note  With PROTO_PROFILE_COUNTERS the DWT event counts of each node
+  *        follow the table, in the same order (APP_PROFILE_COUNTERS)
+  */
+void SendLayerProfile(const ProtoFrame_t *frame)
+{
+  const ProfNode_t *nodes;
+  uint16_t n = Prof_NodeTable(&nodes);
+  uint8_t payload[sizeof(uint32_t) + MODEL_MAX_NODES * (sizeof(ProfNode_t) + sizeof(ProfCounters_t))];
+  uint32_t cpu_hz = HAL_RCC_GetHCLKFreq();
+  uint16_t len = (uint16_t)(sizeof(cpu_hz) + n * sizeof(ProfNode_t));
+  uint8_t flags = frame->hdr.f.len == 1 ? frame->payload[0] : 0U;
+
+  if (frame->hdr.f.len > 1)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  memcpy(payload, &cpu_hz, sizeof(cpu_hz));
+  memcpy(&payload[sizeof(cpu_hz)], nodes, n * sizeof(ProfNode_t));
+  if (flags & PROTO_PROFILE_COUNTERS)
+  {
+#if APP_PROFILE_COUNTERS
+    const ProfCounters_t *counters;
+
+    (void)Prof_CounterTable(&counters);
+    memcpy(&payload[len], counters, n * sizeof(ProfCounters_t));
+    len += (uint16_t)(n * sizeof(ProfCounters_t));
+#else
+    // The host could not tell a missing table from more nodes
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+#endif
+  }
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_PROFILE), frame->hdr.f.seq, payload, len);
+}
+#endif
+
+/**
+  * @brief Open a batch of count images, replacing any unfinished one
+  */
+void BatchBegin(uint8_t seq, uint8_t count)
+{
+  batch_open = 1;
+  batch_seq = seq;
+  batch_count = count;
+  batch_done = 0;
+#if APP_BATCH_DENSE
+  batch_stacked = 0;
+#endif
+  memset(batch_seen, 0, sizeof(batch_seen));
+  memset(batch_results, PROTO_CLASS_NONE, sizeof(batch_results));
+}
+
+/**
+  * @brief Store the result of one batch image, reply once all are accounted for
+  */
+void BatchRecord(uint8_t index, uint8_t predicted_class)
+{
+  uint32_t bit = 1UL << (index % 32);
+
+  if (!batch_open || index >= batch_count || (batch_seen[index / 32] & bit))
+  {
+    return;
+  }
+
+  batch_seen[index / 32] |= bit;
+  batch_results[index] = predicted_class;
+
+  if (++batch_done == batch_count)
+  {
+    batch_open = 0;
+    SendFrame(PROTO_RESPONSE(PROTO_CMD_BATCH), batch_seq, batch_results, batch_count);
+  }
+#if APP_BATCH_DENSE
+  else if (batch_stacked && batch_done + batch_stacked >= batch_count)
+  {
+    // The stacked images are the last ones, nothing else will come to fill the pass
+    BatchFlush();
+  }
+#endif
+}
+
+#if APP_BATCH_DENSE
+/**
+  * @brief Run the convs of a batch image and stack their output for the
+  *        batched gemm_5, which runs once the stack is full or the batch
+  *        has no other image to wait for
+  * @retval 0 once stacked, -1 to classify the image whole: blank,
+  *         remembered, gated, or the network has no gemm_5 kernel
+  */
+static int BatchStack(uint8_t index, const uint8_t *img)
+{
+  int8_t *boundary;
+  int err;
+
+  if (!batch_open || index >= batch_count || (batch_seen[index / 32] & (1UL << (index % 32))) ||
+      AI_IsBlank(img) || AI_Gate(img) >= 0)
+  {
+    return -1;
+  }
+#if APP_MEMO
+  uint32_t key = Memo_Key(model_index, img);
+  if (Memo_Find(key) >= 0)
+  {
+    return -1;
+  }
+  batch_keys[batch_stacked] = key;
+#endif
+
+  if (Split_Begin(network, PROTO_STAGE_FRONT, SPLIT_DEFAULT, &boundary) != (int)KERNEL_DENSE_FEATURES)
+  {
+    Split_End();
+    return -1;
+  }
+  AI_LoadImage(img);
+  err = AI_Run();
+  if (err == 0)
+  {
+    err = Kernel_DenseStack(batch_stacked, boundary);
+  }
+  Split_End();
+  if (err != 0)
+  {
+    return -1;
+  }
+
+  batch_stack[batch_stacked++] = index;
+  if (batch_stacked == APP_BATCH_DENSE || batch_done + batch_stacked >= batch_count)
+  {
+    BatchFlush();
+  }
+  return 0;
+}
+
+/**
+  * @brief gemm_5 of every stacked image in one pass, then the rest of the
+  *        network per image, and record the classes
+  */
+static void BatchFlush(void)
+{
+  uint8_t classes[APP_BATCH_DENSE];
+  uint8_t count = batch_stacked;
+  int8_t *boundary;
+  int predicted_class = -1;
+
+  batch_stacked = 0;
+  memset(classes, PROTO_CLASS_NONE, sizeof(classes));
+  if (Kernel_DenseBatch(count, batch_dense_out) == 0 &&
+      Split_Begin(network, PROTO_STAGE_BACK, SPLIT_HEAD, &boundary) == (int)KERNEL_DENSE_OUTPUTS)
+  {
+    for (uint8_t b = 0; b < count; b++)
+    {
+      memcpy(boundary, &batch_dense_out[b * KERNEL_DENSE_OUTPUTS], KERNEL_DENSE_OUTPUTS);
+      predicted_class = ClassifyInput();
+      if (predicted_class < 0)
+      {
+        break;
+      }
+      classes[b] = (uint8_t)predicted_class;
+#if APP_MEMO
+      Memo_Store(batch_keys[b], classes[b]);
+#endif
+    }
+  }
+  Split_End();
+
+  // Recorded last: the final one sends the reply
+  for (uint8_t b = 0; b < count; b++)
+  {
+    BatchRecord(batch_stack[b], classes[b]);
+  }
+}
+#endif
+
+#if APP_TTA
+/**
+  * @brief Classify, and when the class leads by less than the request's
+  *        margin, vote over shifted and zoomed copies of the image
+  */
+void ProcessTta(const ProtoFrame_t *frame)
+{
+#if APP_PROFILE
+  uint32_t t0 = PROF_CYCLES();
+#endif
+  ProtoTtaReq_t req;
+  ProtoTta_t reply = { 0 };
+  uint8_t count;
+  int predicted_class;
+
+  memcpy(&req, &frame->payload[IMG_SIZE], sizeof(req));
+  if (AI_IsBlank(frame->payload))
+  {
+    reply.predicted_class = PROTO_CLASS_BLANK;
+    reply.own_class = PROTO_CLASS_BLANK;
+    SendFrame(PROTO_RESPONSE(PROTO_CMD_CLASSIFY_TTA), frame->hdr.f.seq, &reply, sizeof(reply));
+    return;
+  }
+
+  predicted_class = ClassifyImage(frame->payload);
+  if (predicted_class < 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+    return;
+  }
+  reply.predicted_class = (uint8_t)predicted_class;
+  reply.own_class = (uint8_t)predicted_class;
+  reply.margin = AI_OutputMargin(predicted_class);
+  reply.votes = 1;
+
+  count = (req.variants < PROTO_TTA_VARIANTS) ? req.variants : PROTO_TTA_VARIANTS;
+  if (count > APP_BATCH_DENSE)
+  {
+    count = APP_BATCH_DENSE;
+  }
+  if (reply.margin < req.min_margin && count > 0)
+  {
+    int run = TtaVote(frame->payload, count, &reply);
+    if (run < 0)
+    {
+      SendError(frame->hdr.f.seq, PROTO_ERR_INFERENCE);
+      return;
+    }
+    reply.variants = (uint8_t)run;
+  }
+
+#if APP_PROFILE
+  reply.cycles = PROF_CYCLES() - t0;
+#endif
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_CLASSIFY_TTA), frame->hdr.f.seq, &reply, sizeof(reply));
+}
+
+/**
+  * @brief Classify count variants of img and vote them with the image's
+  *        own class, whose scores are still in the output buffer
+  * @note  The variants run their convs one by one into the BATCH stack,
+  *        then gemm_5 for all of them in one pass over its weights, and
+  *        the rest of the network per variant. Images a BATCH stacked are
+  *        classified first, the variants take their slots. Most votes win,
+  *        the summed scores break a tie.
+  * @retval variants run, 0 if the network has no gemm_5 to batch, -1 if
+  *         inference failed
+  */
+static int TtaVote(const uint8_t *img, uint8_t count, ProtoTta_t *reply)
+{
+  static uint8_t variant[IMG_SIZE];
+  const int8_t *scores = AI_OutputBuffer();
+  int32_t sums[MODEL_OUT_MAX];
+  uint8_t votes[MODEL_OUT_MAX] = { 0 };
+  int8_t *boundary;
+  int best = reply->own_class;
+  int err = 0;
+
+  for (int i = 0; i < AI_CLASSES; i++)
+  {
+    sums[i] = scores[i];
+  }
+  votes[best] = 1;
+
+  if (batch_stacked)
+  {
+    BatchFlush();
+  }
+
+  if (Split_Begin(network, PROTO_STAGE_FRONT, SPLIT_DEFAULT, &boundary) != (int)KERNEL_DENSE_FEATURES)
+  {
+    Split_End();
+    return 0;
+  }
+  for (uint8_t v = 0; v < count && err == 0; v++)
+  {
+    Tta_Variant(img, v, variant);
+    AI_LoadImage(variant);
+    err = AI_Run();
+    if (err == 0)
+    {
+      err = Kernel_DenseStack(v, boundary);
+    }
+  }
+  Split_End();
+
+  if (err != 0 || Kernel_DenseBatch(count, batch_dense_out) != 0 ||
+      Split_Begin(network, PROTO_STAGE_BACK, SPLIT_HEAD, &boundary) != (int)KERNEL_DENSE_OUTPUTS)
+  {
+    Split_End();
+    return -1;
+  }
+  for (uint8_t v = 0; v < count && err == 0; v++)
+  {
+    memcpy(boundary, &batch_dense_out[v * KERNEL_DENSE_OUTPUTS], KERNEL_DENSE_OUTPUTS);
+    int predicted_class = ClassifyInput();
+    if (predicted_class < 0)
+    {
+      err = -1;
+      break;
+    }
+    scores = AI_OutputBuffer();
+    for (int i = 0; i < AI_CLASSES; i++)
+    {
+      sums[i] += scores[i];
+    }
+    votes[predicted_class]++;
+  }
+  Split_End();
+  if (err != 0)
+  {
+    return -1;
+  }
+
+  for (int i = 0; i < AI_CLASSES; i++)
+  {
+    if (votes[i] > votes[best] || (votes[i] == votes[best] && sums[i] > sums[best]))
+    {
+      best = i;
+    }
+  }
+  reply->predicted_class = (uint8_t)best;
+  reply->votes = votes[best];
+  return count;
+}
+#endif
+
+/**
+  * @brief Acknowledge a baud request at the current speed, then switch
+  * @note  The switch reverts to UART_DEFAULT_BAUD unless a valid frame
+  *        arrives at the new speed within BAUD_CONFIRM_MS
+  */
+void ProcessSetBaud(const ProtoFrame_t *frame)
+{
+  uint32_t baud, actual, oversampling;
+
+  if (frame->hdr.f.len != sizeof(baud))
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  memcpy(&baud, frame->payload, sizeof(baud));
+  actual = UART_CheckBaud(baud, &oversampling);
+  if (!actual || frame->link != PROTO_LINK_UART)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  // The ack must be on the wire before BRR changes (UART_ApplyBaud flushes)
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_SET_BAUD), frame->hdr.f.seq, &actual, sizeof(actual));
+
+  if (baud != huart2.Init.BaudRate)
+  {
+    if (UART_ApplyBaud(baud) == 0)
+    {
+      LOG(LOG_BAUD, baud, 0);
+      baud_pending = 1;
+      baud_switch_tick = HAL_GetTick();
+    }
+    else
+    {
+      UART_ApplyBaud(UART_DEFAULT_BAUD);
+    }
+  }
+}
+
+/**
+  * @brief Switch to another clock profile, then reply at the new clock
+  * @note  USART2 keeps its baud rate if its PCLK can still generate it,
+  *        otherwise it falls back to UART_DEFAULT_BAUD
+  */
+void ProcessSetClock(const ProtoFrame_t *frame)
+{
+  uint32_t hclk;
+  int err;
+
+  if (frame->hdr.f.len != 1)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_LENGTH);
+    return;
+  }
+
+  if (frame->payload[0] >= CLOCK_PROFILE_COUNT)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  // Let queued replies leave before the bus clock changes under them
+  UART_TxFlush();
+#if APP_UART_LINKS
+  UART_Link_Flush(TX_TIMEOUT_MS);
+#endif
+
+#if APP_ITM_TRACE
+  Trace_Flush();
+#endif
+
+  err = Clock_ApplyProfile((ClockProfile_t)frame->payload[0]);
+
+  // A failed switch may still have moved SYSCLK, reprogram BRR either way
+  if (UART_ApplyBaud(huart2.Init.BaudRate) != 0)
+  {
+    UART_ApplyBaud(UART_DEFAULT_BAUD);
+  }
+#if APP_UART_LINKS
+  UART_Link_ClockChanged();
+#endif
+#if APP_ITM_TRACE
+  Trace_ClockChanged();
+#endif
+#if APP_ENERGY
+  Energy_ClockChanged();
+#endif
+  Load_ClockChanged();
+
+  if (err != 0)
+  {
+    SendError(frame->hdr.f.seq, PROTO_ERR_PARAM);
+    return;
+  }
+
+  hclk = HAL_RCC_GetHCLKFreq();
+  LOG(LOG_CLOCK, frame->payload[0], hclk);
+  SendFrame(PROTO_RESPONSE(PROTO_CMD_SET_CLOCK), frame->hdr.f.seq, &hclk, sizeof(hclk));
+}
+
+/**
+  * @brief Frame and transmit a response on the current link
+  */
+void SendFrame(uint8_t type, uint8_t seq, const void *payload, uint16_t len)
+{
+  LOAD_BEGIN();
+#if APP_TIMESTAMPS
+  payload = Stamp_Reply(&type, seq, payload, &len);
+#endif
+  SendFrameOnLink(type, seq, payload, len);
+  LOAD_END(PROTO_LOAD_TX);
+}
+
+/**
+  * @brief SendFrame, without the load accounting
+  */
+static void SendFrameOnLink(uint8_t type, uint8_t seq, const void *payload, uint16_t len)
+{
+#if APP_RTOS
+  // Encoded in place in a free entry, the tx task sends it from there
+  uint8_t i;
+
+  if (osMessageQueueGet(tx_free, &i, NULL, TX_TIMEOUT_MS * osKernelGetTickFreq() / 1000U) != osOK)
+  {
+    return;
+  }
+  tx_frames[i].link = tx_link;
+  tx_frames[i].len = Proto_Encode(tx_frames[i].data, type, seq, payload, len);
+  osMessageQueuePut(tx_queue, &i, 0, 0);
+#else
+  uint16_t n = Proto_Encode(tx_frame, type, seq, payload, len);
+
+#if APP_USB_CDC
+  if (tx_link == PROTO_LINK_USB)
+  {
+    USB_Link_Transmit(tx_frame, n, TX_TIMEOUT_MS);
+    return;
+  }
+#endif
+#if APP_SPI_LINK
+  if (tx_link == PROTO_LINK_SPI)
+  {
+    // Waits for the master to clock out the previous reply
+    SPI_Link_Transmit(tx_frame, n, TX_TIMEOUT_MS);
+    return;
+  }
+#endif
+#if APP_UART_LINKS
+  if (tx_link >= PROTO_LINK_USART1)
+  {
+    UART_Link_Transmit(tx_link - PROTO_LINK_USART1, tx_frame, n, TX_TIMEOUT_MS);
+    return;
+  }
+#endif
+
+  // Returns as soon as the frame is queued, DMA sends it in the background
+  UART_Queue(tx_frame, n);
+#endif
+}
+
+/**
+  * @brief Copy data into the TX ring and start DMA if it is idle
+  * @note  Blocks only while the ring is full, up to TX_TIMEOUT_MS
+  * @retval 0 on success, -1 if the data was dropped
+  */
+static int UART_Queue(const uint8_t *data, uint16_t len)
+{
+  uint32_t start = HAL_GetTick();
+  uint16_t pos, first;
+
+  if (len > TX_RING_SIZE)
+  {
+    return -1;
+  }
+
+  while ((uint16_t)(TX_RING_SIZE - (uint16_t)(tx_head - tx_tail)) < len)
+  {
+    if (HAL_GetTick() - start > TX_TIMEOUT_MS)
+    {
+      return -1;
+    }
+    // Bounded by TX_TIMEOUT_MS, which may be longer than the watchdog's
+    WATCHDOG_FEED();
+#if APP_RTOS
+    osDelay(1);
+#endif
+  }
+
+  pos = tx_head % TX_RING_SIZE;
+  first = (len < TX_RING_SIZE - pos) ? len : (uint16_t)(TX_RING_SIZE - pos);
+  memcpy(&tx_ring[pos], data, first);
+  memcpy(tx_ring, &data[first], len - first);
+  tx_head += len;
+
+  __disable_irq();
+  UART_TxKick();
+  __enable_irq();
+  return 0;
+}
+
+/**
+  * @brief Start DMA on the next contiguous run of the TX ring
+  * @note  Called from the TX complete interrupt or with interrupts masked
+  */
+static void UART_TxKick(void)
+{
+  uint16_t pending = tx_head - tx_tail;
+  uint16_t pos = tx_tail % TX_RING_SIZE;
+
+  if (tx_inflight || pending == 0)
+  {
+    return;
+  }
+
+  if (pending > TX_RING_SIZE - pos)
+  {
+    pending = TX_RING_SIZE - pos;
+  }
+
+  tx_inflight = pending;
+  TRACE_HIGH(TRACE_TX);
+#if APP_PROFILE
+  tx_start_cycles = PROF_CYCLES();
+#endif
+#if APP_SIM
+  // No DMA request from the simulated USART: the run goes out from here,
+  // byte by byte, and the next one after it
+  for (uint16_t i = 0; i < pending; i++)
+  {
+    while (!LL_USART_IsActiveFlag_TXE(HOST_USART))
+    {
+    }
+    LL_USART_TransmitData8(HOST_USART, tx_ring[pos + i]);
+  }
+#if APP_PROFILE
+  prof.tx_cycles = PROF_CYCLES() - tx_start_cycles;
+#endif
+  tx_tail += pending;
+  tx_inflight = 0;
+  TRACE_LOW(TRACE_TX);
+  UART_TxKick();
+#elif APP_UART_LL
+  // The stream stops by itself at the end of the previous run
+  HOST_LL_FLAG(ClearFlag_TC, HOST_DMA_TX_N);
+  HOST_LL_FLAG(ClearFlag_HT, HOST_DMA_TX_N);
+  HOST_LL_FLAG(ClearFlag_TE, HOST_DMA_TX_N);
+  HOST_LL_FLAG(ClearFlag_DME, HOST_DMA_TX_N);
+  HOST_LL_FLAG(ClearFlag_FE, HOST_DMA_TX_N);
+  LL_DMA_ConfigAddresses(HOST_DMA, HOST_LL_TX_STREAM, (uint32_t)&tx_ring[pos], (uint32_t)&HOST_USART->DR,
+                         LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+  LL_DMA_SetDataLength(HOST_DMA, HOST_LL_TX_STREAM, pending);
+  LL_DMA_EnableIT_TC(HOST_DMA, HOST_LL_TX_STREAM);
+  LL_DMA_EnableIT_TE(HOST_DMA, HOST_LL_TX_STREAM);
+  LL_USART_ClearFlag_TC(HOST_USART);
+  LL_USART_EnableDMAReq_TX(HOST_USART);
+  LL_DMA_EnableStream(HOST_DMA, HOST_LL_TX_STREAM);
+#else
+  if (HAL_UART_Transmit_DMA(&huart2, &tx_ring[pos], pending) != HAL_OK)
+  {
+    // Retried by the next UART_Queue or main loop pass
+    tx_inflight = 0;
+  }
+#endif
+}
+
+/**
+  * @brief Wait until the TX ring is empty and the last stop bit is out
+  */
+static void UART_TxFlush(void)
+{
+  uint32_t start = HAL_GetTick();
+
+#if APP_RTOS
+  // Replies the tx task has not copied into the ring yet come first
+  while (osMessageQueueGetCount(tx_free) < TX_FRAMES && HAL_GetTick() - start <= TX_TIMEOUT_MS)
+  {
+    WATCHDOG_FEED();
+    osDelay(1);
+  }
+#endif
+
+  while (tx_head != tx_tail || __HAL_UART_GET_FLAG(&huart2, UART_FLAG_TC) == RESET)
+  {
+    if (HAL_GetTick() - start > TX_TIMEOUT_MS)
+    {
+      // Drop what could not be sent rather than hang the main loop; the
+      // error callback also retires tx_inflight
+#if APP_UART_LL
+      LL_DMA_DisableStream(HOST_DMA, HOST_LL_TX_STREAM);
+#else
+      HAL_UART_AbortTransmit(&huart2);
+#endif
+      __disable_irq();
+      tx_tail = tx_head;
+      tx_inflight = 0;
+      TRACE_LOW(TRACE_TX);
+      __enable_irq();
+      return;
+    }
+    WATCHDOG_FEED();
+  }
+}
+
+/**
+  * @brief UART TX complete callback, sends the next queued run
+  */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == HOST_USART)
+  {
+#if APP_PROFILE
+    prof.tx_cycles = PROF_CYCLES() - tx_start_cycles;
+#endif
+    tx_tail += tx_inflight;
+    tx_inflight = 0;
+    UART_TxKick();
+    if (!tx_inflight)
+    {
+      TRACE_LOW(TRACE_TX);
+    }
+  }
+#if APP_UART_LINKS
+  else
+  {
+    UART_Link_TxDone(huart);
+  }
+#endif
+}
+
+/**
+  * @brief Send a classification result, as the reply to request type
+  * @note  With APP_MEMO or APP_DELTA_GATE the class is followed by its
+  *        PROTO_RESULT_* flags
+  */
+void SendResult(uint8_t type, uint8_t seq, int predicted_class, uint8_t flags)
+{
+  uint8_t result[2] = { (uint8_t)predicted_class, flags };
+  SendFrame(PROTO_RESPONSE(type), seq, result, (APP_MEMO || APP_DELTA_GATE) ? 2U : 1U);
+}
+
+/**
+  * @brief Send an error response for the request with the given seq
+  */
+void SendError(uint8_t seq, ProtoError_t error)
+{
+  uint8_t code = (uint8_t)error;
+
+#if APP_CANCEL
+  // Every inference path reports a failed run this way
+  if (error == PROTO_ERR_INFERENCE && ai_cancelled)
+  {
+    code = PROTO_ERR_CANCELLED;
+  }
+#endif
+  SendFrame(PROTO_TYPE_ERROR, seq, &code, sizeof(code));
+}
+
+/**
+  * @brief Start (or restart) circular DMA reception on USART2
+  * @note  Called from the error callback and from main(); masked so
+  *        neither can interleave with the other or with an RX event, the
+  *        main loop resynchronises its parser when it sees the new epoch
+  */
+void UART_StartReception(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  uart_rx_isr_pos = 0;
+  uart_rx_written = 0;
+  uart_rx_epoch++;
+
+#if APP_SIM
+  // RXNE stores each byte into the ring where DMA would (UART_LL_IRQHandler)
+  UART_StopReception();
+  LL_USART_EnableIT_RXNE(HOST_USART);
+  LL_USART_EnableIT_PE(HOST_USART);
+  LL_USART_EnableIT_ERROR(HOST_USART);
+#elif APP_UART_LL
+  // The configuration HAL_UARTEx_ReceiveToIdle_DMA would make, on the
+  // stream HAL_UART_MspInit set up as circular
+  UART_StopReception();
+  HOST_LL_FLAG(ClearFlag_TC, HOST_DMA_RX_N);
+  HOST_LL_FLAG(ClearFlag_HT, HOST_DMA_RX_N);
+  HOST_LL_FLAG(ClearFlag_TE, HOST_DMA_RX_N);
+  HOST_LL_FLAG(ClearFlag_DME, HOST_DMA_RX_N);
+  HOST_LL_FLAG(ClearFlag_FE, HOST_DMA_RX_N);
+  LL_DMA_ConfigAddresses(HOST_DMA, HOST_LL_RX_STREAM, (uint32_t)&HOST_USART->DR, (uint32_t)uart_rx_dma,
+                         LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
+  LL_DMA_SetDataLength(HOST_DMA, HOST_LL_RX_STREAM, UART_RX_DMA_SIZE);
+  LL_DMA_EnableIT_HT(HOST_DMA, HOST_LL_RX_STREAM);
+  LL_DMA_EnableIT_TC(HOST_DMA, HOST_LL_RX_STREAM);
+  LL_DMA_EnableIT_TE(HOST_DMA, HOST_LL_RX_STREAM);
+  LL_DMA_EnableStream(HOST_DMA, HOST_LL_RX_STREAM);
+
+  LL_USART_ClearFlag_IDLE(HOST_USART);
+  LL_USART_EnableDMAReq_RX(HOST_USART);
+  LL_USART_EnableIT_IDLE(HOST_USART);
+  LL_USART_EnableIT_PE(HOST_USART);
+  LL_USART_EnableIT_ERROR(HOST_USART);
+#else
+  if (HAL_UARTEx_ReceiveToIdle_DMA(&huart2, uart_rx_dma, UART_RX_DMA_SIZE) != HAL_OK)
+  {
+    rx_error = 1;
+  }
+#endif
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief Stop USART2 reception and its DMA stream
+  */
+static void UART_StopReception(void)
+{
+#if APP_SIM
+  LL_USART_DisableIT_RXNE(HOST_USART);
+  LL_USART_DisableIT_PE(HOST_USART);
+  LL_USART_DisableIT_ERROR(HOST_USART);
+#elif APP_UART_LL
+  LL_USART_DisableDMAReq_RX(HOST_USART);
+  LL_USART_DisableIT_IDLE(HOST_USART);
+  LL_USART_DisableIT_PE(HOST_USART);
+  LL_USART_DisableIT_ERROR(HOST_USART);
+  LL_DMA_DisableStream(HOST_DMA, HOST_LL_RX_STREAM);
+  while (LL_DMA_IsEnabledStream(HOST_DMA, HOST_LL_RX_STREAM))
+  {
+  }
+#else
+  HAL_UART_AbortReceive(&huart2);
+#endif
+}
+
+/**
+  * @brief Take a restart request left by a failed UART_StartReception
+  * @retval 1 if reception must be restarted, the request is consumed
+  */
+static uint8_t UART_TakeRestart(void)
+{
+  uint8_t pending;
+
+  __disable_irq();
+  pending = rx_error;
+  rx_error = 0;
+  __enable_irq();
+  return pending;
+}
+
+/**
+  * @brief Feed the bytes DMA has written since the last call to the parser
+  */
+void UART_PollReception(void)
+{
+  uint32_t written, avail;
+  uint8_t epoch;
+
+  __disable_irq();
+  written = uart_rx_written;
+  epoch = uart_rx_epoch;
+#if APP_STREAM && !APP_SIM
+  // Bytes DMA has stored since the last event: a frame sent in one go
+  // raises none until it ends, a streamed image needs them row by row
+  if (epoch == uart_rx_seen_epoch)
+  {
+    uint32_t pos = UART_RX_DMA_SIZE - __HAL_DMA_GET_COUNTER(&hdma_usart2_rx);
+    written += (pos + UART_RX_DMA_SIZE - uart_rx_isr_pos) % UART_RX_DMA_SIZE;
+  }
+#endif
+  __enable_irq();
+
+  if (epoch != uart_rx_seen_epoch)
+  {
+    // Reception restarted: DMA writes from index 0 again
+    uart_rx_seen_epoch = epoch;
+    uart_rx_read = 0;
+    uart_rx_tail = 0;
+
+    // Release a slot claimed by a frame that was cut short
+    if (rx_parser.frame)
+    {
+      slot_busy[RX_Slot(rx_parser.frame)] = 0;
+    }
+    Proto_ParserReset(&rx_parser);
+  }
+
+  avail = written - uart_rx_read;
+  if (avail == 0)
+  {
+    return;
+  }
+
+  if (avail > UART_RX_DMA_SIZE)
+  {
+    // DMA lapped the parser, the unread bytes are gone
+    RX_PostError(PROTO_LINK_UART, 0, 0, PROTO_ERR_UART, HAL_UART_ERROR_ORE);
+    if (rx_parser.frame)
+    {
+      slot_busy[RX_Slot(rx_parser.frame)] = 0;
+    }
+    Proto_ParserReset(&rx_parser);
+    uart_rx_read = written;
+    uart_rx_tail = (uint16_t)(written % UART_RX_DMA_SIZE);
+    return;
+  }
+
+  // Leave the next frame in the ring while every slot is taken, it is
+  // parsed once a queued frame has been processed. With APP_ADMISSION it
+  // is read past and refused instead, up to its end
+#if APP_ADMISSION
+  while (avail > 0 && (rx_parser.frame || RX_SlotFree(&rx_parser) ||
+                       rx_parser.state == PROTO_RX_PAYLOAD || rx_parser.state == PROTO_RX_CRC ||
+#if APP_RX_OVERLAY
+                       UART_OverlayNext(avail) ||
+#endif
+                       UART_RefuseNext(avail)))
+#elif APP_RX_OVERLAY
+  while (avail > 0 && (rx_parser.frame || RX_SlotFree(&rx_parser) || UART_OverlayNext(avail)))
+#else
+  while (avail > 0 && (rx_parser.frame || RX_SlotFree(&rx_parser)))
+#endif
+  {
+    uint16_t n = UART_RX_DMA_SIZE - uart_rx_tail;
+    if (n > avail)
+    {
+      n = (uint16_t)avail;
+    }
+
+    n = Proto_Parse(&rx_parser, &uart_rx_dma[uart_rx_tail], n);
+    uart_rx_read += n;
+    uart_rx_tail = (uint16_t)((uart_rx_tail + n) % UART_RX_DMA_SIZE);
+    avail -= n;
+  }
+}
+
+#if APP_RX_OVERLAY
+/**
+  * @brief Whether the frame next in the USART2 ring goes to the overlay slot
+  * @note  Reads its header ahead of the parser, which waits between frames
+  */
+static uint8_t UART_OverlayNext(uint32_t avail)
+{
+  uint8_t head[2 + 4];
+
+  if (!rx_overlay_open || rx_parser.state != PROTO_RX_SYNC0 || avail < sizeof(head))
+  {
+    return 0;
+  }
+  for (uint32_t i = 0; i < sizeof(head); i++)
+  {
+    head[i] = uart_rx_dma[(uart_rx_tail + i) % UART_RX_DMA_SIZE];
+  }
+  return head[0] == PROTO_MAGIC0 && head[1] == PROTO_MAGIC1 && RX_OverlayTakes(&head[2]);
+}
+#endif
+
+#if APP_ADMISSION
+/**
+  * @brief Whether the frame next in the USART2 ring is to be refused for
+  *        want of a slot rather than left waiting
+  * @note  Reads its header ahead of the parser, which waits between
+  *        frames, and stops after it (Proto_Parse). BATCH_IMAGE and CANCEL
+  *        frames wait: a batch comes in one burst the ring is sized for,
+  *        and a CANCEL refused would leave its request to run
+  */
+static uint8_t UART_RefuseNext(uint32_t avail)
+{
+  uint8_t head[2 + 4];
+  uint8_t type;
+
+  if (rx_parser.state != PROTO_RX_SYNC0 || avail < sizeof(head))
+  {
+    return 0;
+  }
+  for (uint32_t i = 0; i < sizeof(head); i++)
+  {
+    head[i] = uart_rx_dma[(uart_rx_tail + i) % UART_RX_DMA_SIZE];
+  }
+  type = head[2] & (uint8_t)~PROTO_PRIORITY_FLAG;
+  return head[0] == PROTO_MAGIC0 && head[1] == PROTO_MAGIC1 &&
+         type != PROTO_CMD_BATCH_IMAGE && type != PROTO_CMD_CANCEL;
+}
+
+/**
+  * @brief Frames ahead of one arriving now: queued, running, being
+  *        received, or staged in an arena
+  */
+static uint8_t RX_Ahead(void)
+{
+  uint8_t ahead = 0;
+
+  for (uint8_t slot = 0; slot < RX_SLOTS; slot++)
+  {
+    ahead += (slot_busy[slot] != 0);
+  }
+#if APP_ARENA_SLOTS > 1
+  ahead += (uint8_t)__builtin_popcount(staged_mask);
+#endif
+  return ahead;
+}
+#endif
+
+#if APP_RX_FRAME_TIMEOUT_MS
+/**
+  * @brief Abandon the USART2 frame being parsed once its bytes stop coming
+  * @note  Timed from the last byte DMA stored, not the last RX event: a
+  *        frame sent in one go raises none until it ends. A frame held back
+  *        in the ring for a slot has all its bytes and never times out.
+  *        Call after UART_PollReception, from the context that parses
+  */
+static void UART_FrameTimeout(void)
+{
+  static uint32_t last_count = 0, last_tick = 0;
+#if APP_SIM
+  uint32_t count = uart_rx_written;
+#else
+  uint32_t count = __HAL_DMA_GET_COUNTER(&hdma_usart2_rx);
+#endif
+  uint32_t now = HAL_GetTick();
+
+  if (count != last_count || rx_parser.state == PROTO_RX_SYNC0 || uart_rx_read != uart_rx_written)
+  {
+    last_count = count;
+    last_tick = now;
+    return;
+  }
+
+  if (now - last_tick < APP_RX_FRAME_TIMEOUT_MS)
+  {
+    return;
+  }
+
+  if (rx_parser.frame)
+  {
+    slot_busy[RX_Slot(rx_parser.frame)] = 0;
+  }
+  Proto_ParserAbort(&rx_parser, PROTO_ERR_TIMEOUT);
+  last_tick = now;
+}
+#endif
+
+/**
+  * @brief Check that USART2 can generate baud within tolerance
+  * @param oversampling receives UART_OVERSAMPLING_16, or _8 above PCLK/16
+  * @retval the achieved baud rate, 0 if unsupported
+  */
+static uint32_t UART_CheckBaud(uint32_t baud, uint32_t *oversampling)
+{
+  uint32_t pclk = HOST_PCLK_FREQ();
+  uint32_t div, actual, error;
+
+  if (baud == 0)
+  {
+    return 0;
+  }
+
+  // USARTDIV has 4 (OVER16) or 3 (OVER8) fraction bits: div = pclk / baud
+  div = (pclk + baud / 2U) / baud;
+  if (div >= 16U)
+  {
+    *oversampling = UART_OVERSAMPLING_16;
+  }
+  else if (div >= 8U)
+  {
+    *oversampling = UART_OVERSAMPLING_8;
+  }
+  else
+  {
+    return 0;
+  }
+
+  actual = pclk / div;
+  error = (actual > baud) ? actual - baud : baud - actual;
+  if ((uint64_t)error * 1000U > (uint64_t)baud * UART_MAX_BAUD_ERROR_PERMILLE)
+  {
+    return 0;
+  }
+
+  return actual;
+}
+
+/**
+  * @brief Reconfigure USART2 to a new baud rate and restart reception
+  */
+static int UART_ApplyBaud(uint32_t baud)
+{
+  uint32_t oversampling;
+
+  if (!UART_CheckBaud(baud, &oversampling))
+  {
+    return -1;
+  }
+
+  UART_TxFlush();
+  UART_StopReception();
+#if APP_LINK_FALLBACK_PERMILLE
+  // A new rate starts a new window
+  linkq_frames = 0;
+  linkq_errors = 0;
+#endif
+
+  huart2.Init.BaudRate = baud;
+  huart2.Init.OverSampling = oversampling;
+  if (HAL_UART_Init(&huart2) != HAL_OK)
+  {
+    return -1;
+  }
+
+  UART_StartReception();
+  return 0;
+}
+
+#if APP_LINK_FALLBACK_PERMILLE
+/**
+  * @brief Count a CRC failure or line error on USART2 (any context)
+  */
+static void UART_LinkError(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  linkq_errors++;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief Close a full link quality window, stepping USART2 down one
+  *        PROTO_BAUD_LADDER rate if it had APP_LINK_FALLBACK_PERMILLE
+  *        errors per 1000 or more
+  * @note  Nothing is sent: a host reply would not survive the line. The
+  *        switch is unconfirmed like a SET_BAUD, so the host finds the
+  *        board by probing the lower rates, or at UART_DEFAULT_BAUD after
+  *        BAUD_CONFIRM_MS
+  */
+static void UART_LinkQuality(void)
+{
+  static const uint32_t ladder[] = PROTO_BAUD_LADDER;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t frames, errors, permille, oversampling;
+  uint32_t baud = UART_DEFAULT_BAUD;
+
+  __disable_irq();
+  frames = linkq_frames;
+  errors = linkq_errors;
+  if (frames + errors >= APP_LINK_WINDOW)
+  {
+    linkq_frames = 0;
+    linkq_errors = 0;
+  }
+  __set_PRIMASK(primask);
+
+  // A CRC failure is a frame as well, a line error need not be
+  if (frames + errors < APP_LINK_WINDOW)
+  {
+    return;
+  }
+  permille = errors * 1000U / (frames + errors);
+  if (permille < APP_LINK_FALLBACK_PERMILLE || baud_pending || huart2.Init.BaudRate <= UART_DEFAULT_BAUD)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0; i < sizeof(ladder) / sizeof(ladder[0]); i++)
+  {
+    if (ladder[i] > baud && ladder[i] < huart2.Init.BaudRate && UART_CheckBaud(ladder[i], &oversampling))
+    {
+      baud = ladder[i];
+    }
+  }
+
+  LOG(LOG_BAUD_DOWN, permille, baud);
+  if (UART_ApplyBaud(baud) != 0)
+  {
+    UART_ApplyBaud(UART_DEFAULT_BAUD);
+    return;
+  }
+  baud_pending = 1;
+  baud_switch_tick = HAL_GetTick();
+}
+#endif
+
+/**
+  * @brief Parser callback: claim a free slot for an incoming frame
+  */
+static ProtoFrame_t *RX_ClaimFrame(ProtoParser_t *parser)
+{
+  // The USB parser runs in interrupt context, the UART one in main()
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (RX_SlotFree(parser))
+  {
+    for (uint8_t slot = 0; slot < IMG_SLOTS; slot++)
+    {
+      if (RX_SlotIdle(slot))
+      {
+        slot_busy[slot] = 1;
+        slot_link[slot] = parser->link;
+        __set_PRIMASK(primask);
+        TRACE_HIGH_ARG(TRACE_RX, parser->link);
+        return &rx_frames[slot];
+      }
+    }
+  }
+#if APP_RX_OVERLAY
+  if (RX_OverlayTakes(parser->hdr))
+  {
+    rx_overlay = (ProtoFrame_t *)rx_overlay_region;
+    slot_busy[RX_OVERLAY_SLOT] = 1;
+    slot_link[RX_OVERLAY_SLOT] = parser->link;
+    __set_PRIMASK(primask);
+    TRACE_HIGH_ARG(TRACE_RX, parser->link);
+    return rx_overlay;
+  }
+#endif
+  __set_PRIMASK(primask);
+
+  // Every slot is queued or being classified, or the rest are reserved
+  return NULL;
+}
+
+/**
+  * @brief Whether a slot can take a new frame
+  * @note  A slot freed mid-frame may still have a payload copy landing in it
+  */
+static inline uint8_t RX_SlotIdle(uint8_t slot)
+{
+#if APP_DMA_COPY
+  return !slot_busy[slot] && !slot_copies[slot];
+#else
+  return !slot_busy[slot];
+#endif
+}
+
+/**
+  * @brief Frame of a slot, the overlay slot's in the activation arena
+  */
+static inline ProtoFrame_t *RX_Frame(uint8_t slot)
+{
+#if APP_RX_OVERLAY
+  if (slot == RX_OVERLAY_SLOT)
+  {
+    return rx_overlay;
+  }
+#endif
+  return &rx_frames[slot];
+}
+
+/**
+  * @brief Slot of a frame claimed by RX_ClaimFrame
+  */
+static inline uint8_t RX_Slot(const ProtoFrame_t *frame)
+{
+#if APP_RX_OVERLAY
+  if (frame == rx_overlay)
+  {
+    return RX_OVERLAY_SLOT;
+  }
+#endif
+  return (uint8_t)(frame - rx_frames);
+}
+
+#if APP_RX_OVERLAY
+/**
+  * @brief Whether the overlay slot takes the frame of a 4-byte header now
+  * @note  Only a plain CLASSIFY: it runs next, and reads its image into
+  *        the input tensor before its own run reaches the region. The
+  *        type and seq it is answered with are read before that too
+  */
+static uint8_t RX_OverlayTakes(const uint8_t *hdr)
+{
+  return rx_overlay_open && RX_SlotIdle(RX_OVERLAY_SLOT) &&
+         hdr[0] == PROTO_CMD_CLASSIFY && (uint16_t)(hdr[2] | (hdr[3] << 8)) == IMG_SIZE;
+}
+
+/**
+  * @brief Observer hook before each c-node: open the overlay slot once a
+  *        CLASSIFY run reaches the bound model's planned node
+  * @note  Bare metal this is also where the frame waiting in the USART2
+  *        ring is parsed into it. Under APP_AI_ASYNC the RX interrupts
+  *        parse, from their next event on
+  */
+void RX_OverlayNode(uint16_t c_idx)
+{
+  if (!rx_overlay_armed || rx_overlay_from < 0 || c_idx < (uint16_t)rx_overlay_from)
+  {
+    return;
+  }
+  rx_overlay_open = 1;
+#if !APP_AI_ASYNC
+  UART_PollReception();
+#endif
+}
+#endif
+
+/**
+  * @brief Whether parser's link may claim a frame slot now
+  * @note  A link holding no slot may take any free one. One that already
+  *        holds some must leave a slot for every other link holding none,
+  *        so a client sending back to back cannot lock the others out:
+  *        each waits behind at most IMG_SLOTS - RX_LINK_COUNT + 1 frames
+  */
+static uint8_t RX_SlotFree(const ProtoParser_t *parser)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t holders = 0;
+  uint8_t free = 0, held = 0, reserved;
+
+  __disable_irq();
+  for (uint8_t slot = 0; slot < IMG_SLOTS; slot++)
+  {
+    if (RX_SlotIdle(slot))
+    {
+      free++;
+    }
+    else if (slot_busy[slot])
+    {
+      holders |= 1U << slot_link[slot];
+      held += (slot_link[slot] == parser->link);
+    }
+  }
+  __set_PRIMASK(primask);
+
+  reserved = (uint8_t)__builtin_popcount(RX_LINKS & ~holders & ~(1U << parser->link));
+  return free > 0 && (held == 0 || free > reserved);
+}
+
+/**
+  * @brief Whether a ready_fifo entry is a priority frame; staged images are not
+  */
+static inline uint8_t RX_EntryPriority(uint8_t entry)
+{
+#if APP_ARENA_SLOTS > 1
+  if (entry & RX_STAGED)
+  {
+    return 0;
+  }
+#endif
+  return RX_Frame(entry)->priority;
+}
+
+/**
+  * @brief Parser callback: hand a complete frame to the main loop
+  */
+static void RX_FrameComplete(ProtoParser_t *parser, ProtoFrame_t *frame)
+{
+  uint32_t primask = __get_PRIMASK();
+  (void)parser;
+
+  slot_stamp[RX_Slot(frame)] = PROF_CYCLES();
+#if APP_TIMESTAMPS
+  slot_us[RX_Slot(frame)] = Stamp_Us();
+#endif
+  TRACE_LOW_ARG(TRACE_RX, parser->link);
+  STATS_COUNT(STATS_FRAMES);
+#if APP_LINK_FALLBACK_PERMILLE
+  if (parser->link == PROTO_LINK_UART)
+  {
+    linkq_frames++;
+  }
+#endif
+
+#if APP_CANCEL
+  // Seen at once: its request may be queued ahead of it or running
+  if (frame->hdr.f.type == PROTO_CMD_CANCEL)
+  {
+    __disable_irq();
+    cancel_slots |= (uint8_t)(1U << RX_Slot(frame));
+    __set_PRIMASK(primask);
+  }
+#endif
+
+#if APP_RTOS
+  uint8_t slot = RX_Slot(frame);
+
+  (void)primask;
+  // Never full: each holds at most every slot once
+  osMessageQueuePut(frame->priority ? priority_queue : ready_queue, &slot, 0, 0);
+  osThreadFlagsSet(infer_task, RTOS_FLAG_WORK);
+#else
+  uint8_t pos;
+
+  __disable_irq();
+  // A priority frame goes behind the queued priority frames, ahead of the
+  // rest. The head entry may already be processing, it stays
+  pos = ready_tail;
+  if (frame->priority)
+  {
+    while ((uint8_t)(pos - ready_head) > 1U && !RX_EntryPriority(ready_fifo[(uint8_t)(pos - 1U) % RX_READY_SIZE]))
+    {
+      ready_fifo[pos % RX_READY_SIZE] = ready_fifo[(uint8_t)(pos - 1U) % RX_READY_SIZE];
+      pos--;
+    }
+  }
+  ready_fifo[pos % RX_READY_SIZE] = RX_Slot(frame);
+  ready_tail++;
+  __set_PRIMASK(primask);
+#endif
+}
+
+#if APP_STREAM
+/**
+  * @brief USART2 parser callback: run the conv rows a CLASSIFY image has completed so far
+  * @note  Skipped while a run is in flight or a frame waits: both use the
+  *        kernel caches. The checked frame is classified as usual and
+  *        finds the layers already computed
+  */
+static void RX_FrameProgress(ProtoParser_t *parser, ProtoFrame_t *frame, uint16_t from, uint16_t to)
+{
+  (void)parser;
+
+  if ((frame->hdr.f.type != PROTO_CMD_CLASSIFY && frame->hdr.f.type != PROTO_CMD_CLASSIFY_PROF) ||
+      frame->hdr.f.len != IMG_SIZE || ai_async_busy || ai_running || ready_head != ready_tail)
+  {
+    return;
+  }
+
+  if (from == 0)
+  {
+    Kernel_StreamBegin();
+  }
+  Kernel_StreamRows(frame->payload, to / IMG_WIDTH);
+}
+#endif
+
+#if APP_DMA_COPY
+/**
+  * @brief Parser callback: move a run of payload bytes with DMA2 instead of the CPU
+  * @note  The source is the link's DMA ring, which the link does not
+  *        overwrite before it has gone round once more: far longer than
+  *        the copy takes. Runs under APP_DMA_COPY_MIN are cheaper by hand
+  * @retval 0 if DMA2 took the copy
+  */
+static int RX_CopyPayload(ProtoParser_t *parser, ProtoFrame_t *frame, uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint8_t slot = RX_Slot(frame);
+  (void)parser;
+
+  if (len < APP_DMA_COPY_MIN)
+  {
+    return -1;
+  }
+
+  __disable_irq();
+  slot_copies[slot]++;
+  __set_PRIMASK(primask);
+  if (DmaCopy_Start(dst, src, len, RX_CopyDone, (void *)(uintptr_t)slot) != 0)
+  {
+    __disable_irq();
+    slot_copies[slot]--;
+    __set_PRIMASK(primask);
+    return -1;
+  }
+  return 0;
+}
+
+/**
+  * @brief DMA2 stream 3 interrupt: a payload copy of a slot has landed
+  */
+static void RX_CopyDone(void *arg)
+{
+  slot_copies[(uintptr_t)arg]--;
+}
+#endif
+
+/**
+  * @brief Wait for the payload copies of a frame still on DMA2 (APP_DMA_COPY)
+  * @note  Microseconds at most: the last one started with the frame's last
+  *        payload bytes, before its CRC had arrived
+  */
+static void RX_CopyWait(const ProtoFrame_t *frame)
+{
+#if APP_DMA_COPY
+  while (slot_copies[RX_Slot(frame)])
+  {
+  }
+#else
+  (void)frame;
+#endif
+}
+
+#if APP_SPI_LINK || APP_UART_LINKS
+/**
+  * @brief Free the slot of a frame the SPI or a USART1/USART6 link cut short
+  */
+static void RX_ReleaseFrame(ProtoFrame_t *frame)
+{
+  slot_busy[RX_Slot(frame)] = 0;
+}
+
+/**
+  * @brief Parse what the SPI and USART1/USART6 links have received
+  */
+static void RX_PollLinks(void)
+{
+#if APP_SPI_LINK
+  SPI_Link_Poll();
+#endif
+#if APP_UART_LINKS
+  UART_Link_Poll();
+#endif
+}
+
+/**
+  * @brief SPI or USART1/USART6 link interrupt: bytes are waiting in its ring
+  */
+static void RX_LinkNotify(void)
+{
+#if APP_AI_ASYNC
+  // As for USART2: parse for the main loop parked under the PendSV run
+  if (ai_async_busy)
+  {
+    RX_PollLinks();
+  }
+#endif
+#if APP_RTOS
+  if (rx_task)
+  {
+    osThreadFlagsSet(rx_task, RTOS_FLAG_RX);
+  }
+#endif
+}
+#endif
+
+/**
+  * @brief Parser callback: frame could not be accepted
+  */
+static void RX_FrameDropped(ProtoParser_t *parser, uint8_t type, uint8_t seq, ProtoError_t error)
+{
+  TRACE_LOW_ARG(TRACE_RX, parser->link);
+  RX_PostError(parser->link, type, seq, error, 0);
+}
+
+/**
+  * @brief Queue an error for the main loop (any context)
+  */
+static void RX_PostError(uint8_t link, uint8_t type, uint8_t seq, ProtoError_t error, uint8_t detail)
+{
+  uint32_t primask = __get_PRIMASK();
+  RxErrorEvent_t *ev;
+
+#if APP_STATS
+  if (error == PROTO_ERR_UART)
+  {
+    if (detail & HAL_UART_ERROR_ORE) Stats_Count(STATS_UART_OVERRUN);
+    if (detail & HAL_UART_ERROR_FE) Stats_Count(STATS_UART_FRAMING);
+    if (detail & (HAL_UART_ERROR_NE | HAL_UART_ERROR_PE)) Stats_Count(STATS_UART_NOISE);
+  }
+  else
+  {
+    Stats_Count(STATS_ERR_DROPPED);
+  }
+#endif
 
-// Image and classification buffers
-#define IMG_SIZE 784
-#define IMG_WIDTH 28
-#define IMG_HEIGHT 28
-#define NUM_CLASSES 10
+  LOG(LOG_RX_ERROR, link, error | ((uint32_t)detail << 8));
+#if APP_LINK_FALLBACK_PERMILLE
+  if (link == PROTO_LINK_UART && error == PROTO_ERR_UART &&
+      (detail & (HAL_UART_ERROR_ORE | HAL_UART_ERROR_FE | HAL_UART_ERROR_NE | HAL_UART_ERROR_PE)))
+  {
+    UART_LinkError();
+  }
+#endif
 
-static uint8_t img_buffer[IMG_SIZE];
-static int8_t input_buffer[IMG_SIZE];
-static int8_t output_buffer[NUM_CLASSES];
+  __disable_irq();
+  if ((uint8_t)(rx_err_tail - rx_err_head) >= RX_ERR_QUEUE_SIZE)
+  {
+    rx_err_lost++;
+    STATS_COUNT(STATS_EVENTS_LOST);
+    LOG(LOG_RX_LOST, link, rx_err_lost);
+    __set_PRIMASK(primask);
+    return;
+  }
 
-// UART interrupt variables
-static volatile AppState_t app_state = STATE_IDLE;
-static uint8_t start_cmd_buffer[5];
-static volatile uint8_t rx_complete = 0;
-static volatile uint8_t rx_error = 0;
-/* USER CODE END PV */
+  ev = &rx_err_queue[rx_err_tail % RX_ERR_QUEUE_SIZE];
+  ev->link = link;
+  ev->type = type;
+  ev->seq = seq;
+  ev->error = (uint8_t)error;
+  ev->detail = detail;
+  rx_err_tail++;
+  __set_PRIMASK(primask);
+#if APP_RTOS
+  if (infer_task)
+  {
+    osThreadFlagsSet(infer_task, RTOS_FLAG_WORK);
+  }
+#endif
+}
 
-/* Private function prototypes -----------------------------------------------*/
-void SystemClock_Config(void);
-static void MX_GPIO_Init(void);
-static void MX_USART2_UART_Init(void);
-/* USER CODE BEGIN PFP */
-int AI_Init(void);
-int AI_Run(int8_t *input_data, int8_t *output_data);
-void ProcessInference(void);
-void SendResult(int predicted_class);
-/* USER CODE END PFP */
+/**
+  * @brief Report queued receive errors through the async TX path
+  */
+void ProcessRxErrors(void)
+{
+  while (rx_err_head != rx_err_tail)
+  {
+    RxErrorEvent_t ev = rx_err_queue[rx_err_head % RX_ERR_QUEUE_SIZE];
+    rx_err_head++;
+
+    tx_link = ev.link;
+    if (ev.type == PROTO_CMD_BATCH_IMAGE)
+    {
+      // Lost batch images are reported in the batch reply
+      BatchRecord(ev.seq, PROTO_CLASS_NONE);
+    }
+    else if (ev.error == PROTO_ERR_UART)
+    {
+      uint8_t payload[2] = { PROTO_ERR_UART, ev.detail };
+      SendFrame(PROTO_TYPE_ERROR, ev.seq, payload, sizeof(payload));
+    }
+#if APP_ADMISSION
+    else if (ev.error == PROTO_ERR_BUSY)
+    {
+      // Estimated now, between frames, for the queue as it stands
+      ProtoBusy_t busy = { PROTO_ERR_BUSY, RX_Ahead(), 0 };
+      busy.retry_us = Admission_RetryUs(busy.ahead);
+      SendFrame(PROTO_TYPE_ERROR, ev.seq, &busy, sizeof(busy));
+    }
+#endif
+    else
+    {
+      SendError(ev.seq, (ProtoError_t)ev.error);
+    }
+  }
+}
 
-/* Private user code ---------------------------------------------------------*/
-/* USER CODE BEGIN 0 */
 /**
-  * @brief Initialize AI model
+  * @brief USART2 RX event: publish the bytes up to DMA index Size
   */
-int AI_Init(void)
+static void UART_RxEvent(uint16_t Size)
 {
-  ai_error err;
+  uint32_t delta;
 
-  const ai_handle act_addr[] = { AI_HANDLE_PTR(activations) };
+  rx_activity_tick = HAL_GetTick();
 
-  err = ai_network_create_and_init(&network, act_addr, NULL);
-  if (err.type != AI_ERROR_NONE)
+  // Events come at least every half buffer, so the delta is unambiguous
+  if (Size >= uart_rx_isr_pos)
   {
-    return -1;
+    delta = Size - uart_rx_isr_pos;
+  }
+  else
+  {
+    delta = UART_RX_DMA_SIZE - uart_rx_isr_pos + Size;
   }
+  uart_rx_written += delta;
+#if APP_PROFILE
+  uart_isr_bytes += delta;
+#endif
+  TRACE_MARK(TRACE_ITM_BURST, delta);
 
-  ai_input = ai_network_inputs_get(network, NULL);
-  ai_output = ai_network_outputs_get(network, NULL);
+  uart_rx_isr_pos = (Size == UART_RX_DMA_SIZE) ? 0 : Size;
 
-  if (!ai_input || !ai_output)
+#if APP_AI_ASYNC
+  // The main loop is parked under the PendSV run: parse for it, so the
+  // next frame is in its slot when the run completes
+  if (ai_async_busy)
   {
-    return -1;
+    UART_PollReception();
   }
-
-  return 0;
+#endif
+#if APP_RTOS
+  if (rx_task)
+  {
+    osThreadFlagsSet(rx_task, RTOS_FLAG_RX);
+  }
+#endif
 }
 
+#if APP_UART_LL
 /**
-  * @brief Run AI inference
+  * @brief USART2 interrupt without HAL: IDLE line and line errors only
+  * @note  In DMA mode RXNE never interrupts, the bytes come by the RX stream
+  *        (APP_SIM: it does, and stores them as the stream would).
+  *        HAL_UART_IRQHandler also aborts the DMA on every error; here
+  *        the ring keeps running and only the error is reported
   */
-int AI_Run(int8_t *input_data, int8_t *output_data)
+void UART_LL_IRQHandler(void)
 {
-  ai_i32 batch;
+  uint32_t sr = HOST_USART->SR;
 
-  if (!network || !ai_input || !ai_output) return -1;
+#if APP_SIM
+  // What DMA would have done: the received bytes into the ring, one
+  // event per run up to its end
+  while ((sr & USART_SR_RXNE) && LL_USART_IsEnabledIT_RXNE(HOST_USART))
+  {
+    uint16_t pos = uart_rx_isr_pos;
 
-  ai_input[0].data = AI_HANDLE_PTR(input_data);
-  ai_output[0].data = AI_HANDLE_PTR(output_data);
+    do
+    {
+      uart_rx_dma[pos++] = (uint8_t)HOST_USART->DR;
+    } while (pos < UART_RX_DMA_SIZE && (HOST_USART->SR & USART_SR_RXNE));
+    UART_RxEvent(pos);
+    sr = HOST_USART->SR;
+  }
+#endif
 
-  batch = ai_network_run(network, ai_input, ai_output);
-  if (batch != 1)
+  if (sr & (USART_SR_PE | USART_SR_FE | USART_SR_NE | USART_SR_ORE))
   {
-    return -1;
+    uint8_t detail = ((sr & USART_SR_PE) ? HAL_UART_ERROR_PE : 0U) |
+                     ((sr & USART_SR_NE) ? HAL_UART_ERROR_NE : 0U) |
+                     ((sr & USART_SR_FE) ? HAL_UART_ERROR_FE : 0U) |
+                     ((sr & USART_SR_ORE) ? HAL_UART_ERROR_ORE : 0U);
+
+    // SR then DR read clears the error flags (and IDLE)
+    (void)HOST_USART->DR;
+    RX_PostError(PROTO_LINK_UART, 0, 0, PROTO_ERR_UART, detail);
   }
 
-  return 0;
+  if ((sr & USART_SR_IDLE) && LL_USART_IsEnabledIT_IDLE(HOST_USART))
+  {
+    (void)HOST_USART->DR;
+    UART_RxEvent((uint16_t)(UART_RX_DMA_SIZE - LL_DMA_GetDataLength(HOST_DMA, HOST_LL_RX_STREAM)));
+  }
 }
 
 /**
-  * @brief Process inference and control LED
+  * @brief RX stream (DMA1 stream 5 on USART2) without HAL: half and full ring
   */
-void ProcessInference(void)
+void UART_LL_RxDmaIRQHandler(void)
 {
-  // Convert uint8 (0-255) to int8 (-128 to 127)
-  for (int i = 0; i < IMG_SIZE; i++)
+  if (HOST_LL_FLAG(IsActiveFlag_HT, HOST_DMA_RX_N))
   {
-    input_buffer[i] = (int8_t)(img_buffer[i] - 128);
+    HOST_LL_FLAG(ClearFlag_HT, HOST_DMA_RX_N);
+    UART_RxEvent(UART_RX_DMA_SIZE / 2U);
   }
+  if (HOST_LL_FLAG(IsActiveFlag_TC, HOST_DMA_RX_N))
+  {
+    HOST_LL_FLAG(ClearFlag_TC, HOST_DMA_RX_N);
+    UART_RxEvent(UART_RX_DMA_SIZE);
+  }
+  if (HOST_LL_FLAG(IsActiveFlag_TE, HOST_DMA_RX_N))
+  {
+    // The stream disabled itself
+    HOST_LL_FLAG(ClearFlag_TE, HOST_DMA_RX_N);
+    RX_PostError(PROTO_LINK_UART, 0, 0, PROTO_ERR_UART, HAL_UART_ERROR_DMA);
+    UART_StartReception();
+  }
+}
 
-  // Run inference with timing
-  uint32_t start_tick = HAL_GetTick();
-  int ret = AI_Run(input_buffer, output_buffer);
-
-  if (ret == 0)
+/**
+  * @brief TX stream (DMA1 stream 6 on USART2) without HAL: the run is in the USART
+  * @note  Completes at the last byte written to DR rather than at USART
+  *        TC as HAL does; UART_TxFlush still waits for TC
+  */
+void UART_LL_TxDmaIRQHandler(void)
+{
+  if (HOST_LL_FLAG(IsActiveFlag_TC, HOST_DMA_TX_N) || HOST_LL_FLAG(IsActiveFlag_TE, HOST_DMA_TX_N))
   {
-    // Find max class
-    int predicted_class = 0;
-    int8_t max_prob = output_buffer[0];
-    for (int i = 1; i < NUM_CLASSES; i++)
+    HOST_LL_FLAG(ClearFlag_TC, HOST_DMA_TX_N);
+    HOST_LL_FLAG(ClearFlag_TE, HOST_DMA_TX_N);
+#if APP_PROFILE
+    prof.tx_cycles = PROF_CYCLES() - tx_start_cycles;
+#endif
+    // A run lost to a transfer error is dropped like a timed out one
+    tx_tail += tx_inflight;
+    tx_inflight = 0;
+    UART_TxKick();
+    if (!tx_inflight)
     {
-      if (output_buffer[i] > max_prob)
-      {
-        max_prob = output_buffer[i];
-        predicted_class = i;
-      }
+      TRACE_LOW(TRACE_TX);
     }
+  }
+}
+#endif
 
-    // Send result
-    SendResult(predicted_class);
+#if APP_PROFILE
+/**
+  * @brief Account the cycles of one USART2 interrupt handler (UART_ISR_EXIT)
+  */
+void UART_IsrCycles(uint32_t cycles)
+{
+  uart_isr_cycles += cycles;
+}
+#endif
+
+/**
+  * @brief UART Rx Event Callback (DMA half/complete transfer or IDLE line)
+  * @param Size position of the DMA write pointer in uart_rx_dma
+  * @note  Only publishes the new byte count, parsing happens in main(),
+  *        or here while an APP_AI_ASYNC inference is in flight
+  */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  if (huart->Instance == HOST_USART)
+  {
+    UART_RxEvent(Size);
   }
+#if APP_UART_LINKS
   else
   {
-    // Error during inference
-    char err_msg[48];
-    snprintf(err_msg, sizeof(err_msg), "ERROR: Inference failed\r\n");
-    HAL_UART_Transmit(&huart2, (uint8_t*)err_msg, strlen(err_msg), 1000);
+    UART_Link_RxEvent(huart, Size);
   }
+#endif
 }
 
 /**
-  * @brief Send classification result via UART
+  * @brief Wait for the next interrupt when the main loop has nothing to do
   */
-void SendResult(int predicted_class)
+void Idle(void)
 {
-  char result[32];
-  snprintf(result, sizeof(result), "%d\r\n", predicted_class);
-  HAL_UART_Transmit(&huart2, (uint8_t*)result, strlen(result), 1000);
+  // Masked so an interrupt between the checks and WFI still wakes the core
+  __disable_irq();
+  if (ready_head != ready_tail || rx_err_head != rx_err_tail || rx_error ||
+      uart_rx_written != uart_rx_read || uart_rx_epoch != uart_rx_seen_epoch
+#if APP_SPI_LINK
+      || SPI_Link_Pending()
+#endif
+#if APP_UART_LINKS
+      || UART_Link_Pending()
+#endif
+      )
+  {
+    __enable_irq();
+    return;
+  }
 
-}
+#if APP_IDLE_STOP_MS
+  if (idle_stop && !baud_pending && !batch_open && rx_parser.state == PROTO_RX_SYNC0 &&
+      (HAL_GetTick() - rx_activity_tick) > APP_IDLE_STOP_MS)
+  {
+    __enable_irq();
+    Idle_Stop();
+    return;
+  }
+#endif
 
+#if APP_IDLE_SLEEP
+#if APP_ENERGY
+  Energy_Sleep();
+  __WFI();
+  Energy_Wake();
+#else
+  __WFI();
+#endif
+#endif
+  __enable_irq();
+}
 
+#if APP_IDLE_STOP_MS
 /**
-  * @brief UART Rx Complete Callback
+  * @brief STOP mode until a start bit on USART2 RX, then restore clocks and UART
   */
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+static void Idle_Stop(void)
 {
-  if (huart->Instance == USART2)
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  UART_TxFlush();
+  UART_StopReception();
+  HAL_UART_DeInit(&huart2);
+
+  // Idle-high TX so the host sees no break, RX as the wake-up line
+  GPIO_InitStruct.Pin = GPIO_PIN_2;
+  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Pull = GPIO_PULLUP;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+  GPIO_InitStruct.Pin = GPIO_PIN_3;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+  __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_3);
+  HAL_NVIC_SetPriority(EXTI3_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(EXTI3_IRQn);
+
+  HAL_SuspendTick();
+#if APP_ENERGY
+  Energy_Sleep();
+#endif
+  HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+  HAL_ResumeTick();
+
+  HAL_NVIC_DisableIRQ(EXTI3_IRQn);
+  HAL_GPIO_DeInit(GPIOA, GPIO_PIN_2 | GPIO_PIN_3);
+
+  // STOP exits on HSI with HSE and PLL off
+  if (Clock_GetProfile() == CLOCK_PROFILE_BOOT)
   {
-    if (app_state == STATE_WAIT_START)
-    {
-      // Check if START command received
-      if (memcmp(start_cmd_buffer, "START", 5) == 0)
-      {
-        // Start receiving image data
-        app_state = STATE_RECEIVE_IMAGE;
-        HAL_UART_Receive_IT(&huart2, img_buffer, IMG_SIZE);
-      }
-      else
-      {
-        // Not a valid START command, wait again
-        HAL_UART_Receive_IT(&huart2, start_cmd_buffer, 5);
-      }
-    }
-    else if (app_state == STATE_RECEIVE_IMAGE)
-    {
-      // Image reception complete
-      rx_complete = 1;
-      app_state = STATE_PROCESS_IMAGE;
-    }
+    SystemClock_Config();
+  }
+  else if (Clock_ApplyProfile(Clock_GetProfile()) != 0)
+  {
+    Error_Handler();
+  }
+#if APP_ENERGY
+  Energy_ClockChanged();
+  Energy_Wake();
+#endif
+  Load_ClockChanged();
+
+  // Handle is back in RESET state, so this re-runs the pin and DMA MSP setup
+  if (HAL_UART_Init(&huart2) != HAL_OK)
+  {
+    Error_Handler();
   }
+  UART_StartReception();
+  rx_activity_tick = HAL_GetTick();
 }
+#endif
 
 /**
   * @brief UART Error Callback
   */
 void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
 {
-  if (huart->Instance == USART2)
+  if (huart->Instance == HOST_USART)
   {
-    rx_error = 1;
-    app_state = STATE_IDLE;
+    // Reported from the main loop: the CRC unit and TX ring are not ISR safe
+    RX_PostError(PROTO_LINK_UART, 0, 0, PROTO_ERR_UART, (uint8_t)huart->ErrorCode);
+
+    // A DMA TX error leaves gState ready without a TX complete callback
+    if (tx_inflight && huart->gState == HAL_UART_STATE_READY)
+    {
+      tx_tail += tx_inflight;
+      tx_inflight = 0;
+    }
 
-    char err_msg[48];
-    snprintf(err_msg, sizeof(err_msg), "ERROR: UART error\r\n");
-    HAL_UART_Transmit(&huart2, (uint8_t*)err_msg, strlen(err_msg), 1000);
+    // HAL aborts the DMA transfer on RX errors, re-arm it right away so the
+    // next frame is not lost too
+    if (huart->RxState == HAL_UART_STATE_READY)
+    {
+      UART_StartReception();
+    }
   }
+#if APP_UART_LINKS
+  else
+  {
+    UART_Link_Error(huart);
+  }
+#endif
 }
 /* USER CODE END 0 */
 
@@ -246,7 +5287,9 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
 int main(void)
 {
   /* USER CODE BEGIN 1 */
-
+  // Boot timer, reset cause and the boot counters, before anything can fail
+  Boot_Init();
+  Mem_PaintStack();
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -258,41 +5301,191 @@ int main(void)
 
   /* USER CODE END Init */
 
-  /* Configure the system clock */
-  SystemClock_Config();
-
   /* USER CODE BEGIN SysInit */
-
+  // The SystemClock_Config call is not generated (tinyML.ioc), fast boot
+  // only starts the PLL here and switches to it once setup is done
+#if APP_FAST_BOOT
+  Clock_BootStart();
+#else
+  SystemClock_Config();
+  Boot_ClockReady();
+#endif
+#if APP_WATCHDOG_MS
+  Boot_WatchdogStart(APP_WATCHDOG_MS);
+#endif
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
+#if APP_AI_ASYNC
+  // Inference runs in PendSV, under USART2 and DMA (priority 5)
+  HAL_NVIC_SetPriority(PendSV_IRQn, 15, 0);
+#endif
+  Proto_Init();
+#if APP_PROFILE || APP_ANYTIME
+  Prof_Init();
+#endif
+#if APP_STAI
+  if (StaiApp_Init() != STAI_SUCCESS || StaiApp_SetCallback(AI_OnNodeEvent, NULL) != STAI_SUCCESS)
+  {
+    Error_Handler();
+  }
+#endif
+#if APP_STATS
+  Stats_Init();
+#endif
+  rx_parser.claim = RX_ClaimFrame;
+  rx_parser.complete = RX_FrameComplete;
+  rx_parser.drop = RX_FrameDropped;
+  rx_parser.link = PROTO_LINK_UART;
+#if APP_STREAM
+  rx_parser.progress = RX_FrameProgress;
+#endif
+#if APP_DMA_COPY
+  // Not on USB, whose buffer is gone once the CDC callback returns
+  DmaCopy_Init();
+  rx_parser.copy = RX_CopyPayload;
+#endif
+#if APP_FAST_BOOT
+  // Turn the PLL on as soon as HSE is up, it locks while the network is
+  // created
+  Clock_BootPoll();
+#endif
+
+#if APP_USB_CDC
+  // MX_USB_DEVICE_Init() (generated) has already started the CDC class
+  usb_parser.claim = RX_ClaimFrame;
+  usb_parser.complete = RX_FrameComplete;
+  usb_parser.drop = RX_FrameDropped;
+  usb_parser.link = PROTO_LINK_USB;
+  USB_Link_Init(&usb_parser);
+#endif
 
-  // Initialize AI model
-  if (AI_Init() != 0)
+#if APP_SPI_LINK
+  spi_parser.claim = RX_ClaimFrame;
+  spi_parser.complete = RX_FrameComplete;
+  spi_parser.drop = RX_FrameDropped;
+  spi_parser.link = PROTO_LINK_SPI;
+#if APP_DMA_COPY
+  spi_parser.copy = RX_CopyPayload;
+#endif
+  SPI_Link_Init(&spi_parser, RX_LinkNotify, RX_ReleaseFrame);
+#endif
+
+#if APP_UART_LINKS
+  for (uint8_t port = 0; port < UART_LINK_PORTS; port++)
+  {
+    uart_link_parsers[port].claim = RX_ClaimFrame;
+    uart_link_parsers[port].complete = RX_FrameComplete;
+    uart_link_parsers[port].drop = RX_FrameDropped;
+    uart_link_parsers[port].link = PROTO_LINK_USART1 + port;
+#if APP_DMA_COPY
+    uart_link_parsers[port].copy = RX_CopyPayload;
+#endif
+  }
+  UART_Link_Init(uart_link_parsers, RX_LinkNotify, RX_SlotFree, RX_ReleaseFrame);
+#endif
+
+#if APP_XFLASH
+  // Without the chip (0 KB) only the streamed models fail to select
+  XFlash_Init();
+  LOG(LOG_XFLASH, XFlash_Size() / 1024U, MODEL_XFLASH_COUNT);
+#endif
+
+  // Initialize AI model, after a warm restart the one that was selected,
+  // else the saved one
+  uint8_t boot_model = Boot_SavedModel();
+#if APP_CONFIG
+  ProtoConfig_t saved;
+  config_applied = (Config_Load(&saved) == 0);
+  if (config_applied && !Boot_IsWarm())
+  {
+    boot_model = saved.model;
+  }
+#endif
+  if (AI_Init(boot_model) != 0 && AI_Init(0) != 0)
+  {
+    static const char msg[] = "AI Init Failed!\r\n";
+    HAL_UART_Transmit(&huart2, (const uint8_t*)msg, sizeof(msg) - 1, 1000);
+    Boot_Fail(PROTO_FAULT_AI_INIT);
+  }
+
+#if APP_FAST_BOOT
+  // The remaining setup and the warm-up run at full speed, USART2 moves
+  // to the new PCLK
+  if (Clock_BootFinish() != 0 || HAL_UART_Init(&huart2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  Boot_ClockReady();
+#endif
+
+#if APP_CLOCK_PROFILE != 0xFF
+  // Leave the generated 96 MHz setup for the configured profile; the boot
+  // baud rate is reachable from every profile's PCLK
+  if (Clock_ApplyProfile((ClockProfile_t)APP_CLOCK_PROFILE) != 0 ||
+      HAL_UART_Init(&huart2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+#endif
+#if APP_CONFIG
+  // The saved clock and baud rate: the banner already goes out at the rate
+  // the host will listen on
+  if (config_applied)
+  {
+    Config_Restore(&saved);
+  }
+#endif
+#if APP_ITM_TRACE
+  // SWO baud follows HCLK, start it on the clock the application runs at
+  Trace_Init();
+#endif
+#if APP_ENERGY
+  Energy_Init();
+#endif
+
+#if APP_FAST_BOOT
+  // One run on a blank image: the first request no longer pays for the
+  // cold flash cache
+  memset(AI_InputBuffer(), 0, IMG_SIZE);
+  if (AI_Run() != 0)
   {
-    char msg[64];
-    snprintf(msg, sizeof(msg), "AI Init Failed!\r\n");
-    HAL_UART_Transmit(&huart2, (uint8_t*)msg, strlen(msg), 1000);
-    // Blink LED rapidly to indicate error
-    while(1) {}
+    Boot_Fail(PROTO_FAULT_AI_INIT);
   }
+#endif
 
-  // Small delay so host side can open VCP
-  HAL_Delay(200);
+  // Send ready message; hosts wait for a PING reply rather than for this,
+  // and a warm restart goes straight back to serving them
+  if (!APP_FAST_BOOT && !Boot_IsWarm())
+  {
+    static const char ready_msg[] = "STM32F411 Ready - Cube AI Initialized\r\n";
+    HAL_UART_Transmit(&huart2, (const uint8_t*)ready_msg, sizeof(ready_msg) - 1, HAL_MAX_DELAY);
+  }
 
-  // Send ready message
+  // Start waiting for request frames, DMA keeps receiving in the background
+  UART_StartReception();
+  Boot_Ready();
+#if APP_LOG
+  LOG(LOG_BOOT, Boot_Count(), Boot_ResetCause());
+  if (Boot_ResetCause() == PROTO_RESET_SOFTWARE)
   {
-    char ready_msg[64];
-    snprintf(ready_msg, sizeof(ready_msg), "STM32F411 Ready - Cube AI Initialized\r\n");
-    HAL_UART_Transmit(&huart2, (uint8_t*)ready_msg, strlen(ready_msg), HAL_MAX_DELAY);
+    LOG(LOG_FAULT, Boot_LastFault(), 0);
   }
+  LOG(LOG_READY, Boot_ReadyCycles(), 0);
+#endif
+#if APP_WEIGHT_CHECK
+  // In the background from here, the banner is out and frames are taken
+  Upload_CheckStart();
+#endif
 
-  // Start waiting for START command using interrupt
-  app_state = STATE_WAIT_START;
-  HAL_UART_Receive_IT(&huart2, start_cmd_buffer, 5);
+#if APP_RTOS
+  // Does not return: the tasks below take over the loop
+  RTOS_Run();
+#endif
 
   /* USER CODE END 2 */
 
@@ -303,26 +5496,97 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
+    WATCHDOG_FEED();
+#if APP_WEIGHT_CHECK
+    AI_CheckWeights();
+#endif
+
+    // Parse what DMA has buffered, then classify queued frames; DMA keeps
+    // receiving into the ring meanwhile
+    UART_PollReception();
+#if APP_SPI_LINK || APP_UART_LINKS
+    RX_PollLinks();
+#endif
+    while (ready_head != ready_tail)
+    {
+#if APP_ARENA_SLOTS > 1
+      // Free the frame slots of the images waiting behind this one
+      AI_Stage();
+#endif
+      uint8_t slot = ready_fifo[ready_head % RX_READY_SIZE];
+      TRACE_HIGH(TRACE_FRAME);
+      ADMISSION_BEGIN();
+#if APP_ARENA_SLOTS > 1
+      if (slot & RX_STAGED)
+      {
+        AI_RunStaged(slot & (uint8_t)~RX_STAGED);
+      }
+      else
+#endif
+      {
+        STAMP_BEGIN(RX_Frame(slot)->hdr.f.seq, slot_us[slot]);
+        ProcessFrame(RX_Frame(slot));
+        STAMP_END();
+        STATS_CYCLES(STATS_HIST_FRAME, PROF_CYCLES() - slot_stamp[slot]);
+        slot_busy[slot] = 0;
+      }
+      ADMISSION_END();
+      TRACE_LOW(TRACE_FRAME);
+      ready_head++;
+      UART_PollReception();
+#if APP_SPI_LINK || APP_UART_LINKS
+      RX_PollLinks();
+#endif
+#if APP_ADMISSION
+      // Refusals go out now, not behind the rest of the queue
+      ProcessRxErrors();
+#endif
+    }
+
+#if APP_RX_FRAME_TIMEOUT_MS
+    // A host that stopped mid-frame leaves the parser waiting
+    UART_FrameTimeout();
+#endif
+
+    // Frames rejected while receiving (oversized, every slot busy) and
+    // line errors
+    ProcessRxErrors();
+#if APP_TELEMETRY
+    TelemetryPush();
+#endif
 
-    // Process image when reception is complete
-    if (rx_complete)
+#if APP_CONFIG
+    UART_ConfirmSavedBaud();
+#endif
+    // Host never spoke at the negotiated rate, fall back
+    if (baud_pending && (HAL_GetTick() - baud_switch_tick) > BAUD_CONFIRM_MS)
     {
-      rx_complete = 0;
-      ProcessInference();
+      baud_pending = 0;
+      LOG(LOG_BAUD_REVERT, UART_DEFAULT_BAUD, 0);
+      UART_ApplyBaud(UART_DEFAULT_BAUD);
+    }
+#if APP_LINK_FALLBACK_PERMILLE
+    UART_LinkQuality();
+#endif
 
-      // Go back to waiting for START command
-      app_state = STATE_WAIT_START;
-      HAL_UART_Receive_IT(&huart2, start_cmd_buffer, 5);
+    // Reception could not be re-armed from the error callback
+    if (UART_TakeRestart())
+    {
+      UART_StartReception();
     }
 
-    // Handle errors
-    if (rx_error)
+    // Restart TX if a kick found the UART busy
+    if (!tx_inflight && tx_head != tx_tail)
     {
-      rx_error = 0;
+      __disable_irq();
+      UART_TxKick();
+      __enable_irq();
+    }
 
-      // Restart waiting for START command
-      app_state = STATE_WAIT_START;
-      HAL_UART_Receive_IT(&huart2, start_cmd_buffer, 5);
+    {
+      LOAD_BEGIN();
+      Idle();
+      LOAD_END(PROTO_LOAD_IDLE);
     }
   }
   /* USER CODE END 3 */
@@ -401,11 +5665,42 @@ static void MX_USART2_UART_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN USART2_Init 2 */
-
+#if APP_HOST_UART != 2
+  // Generated for USART2, moved to USART1/USART6 (host_uart.c)
+  HostUart_Init(&huart2);
+#endif
+#if APP_UART_FLOW
+  // Applied on top of the generated setup, the pins are set in the MSP;
+  // UART_ApplyBaud keeps it, it only changes BaudRate
+  huart2.Init.HwFlowCtl = UART_HWCONTROL_RTS_CTS;
+  if (HAL_UART_Init(&huart2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+#endif
   /* USER CODE END USART2_Init 2 */
 
 }
 
+/**
+  * Enable DMA controller clock
+  */
+static void MX_DMA_Init(void)
+{
+
+  /* DMA controller clock enable */
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* DMA interrupt init */
+  /* DMA1_Stream5_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream5_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+  /* DMA1_Stream6_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream6_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+
+}
+
 /**
   * @brief GPIO Initialization Function
   * @param None
@@ -434,12 +5729,219 @@ static void MX_GPIO_Init(void)
   HAL_GPIO_Init(GPIOD, &GPIO_InitStruct);
 
   /* USER CODE BEGIN MX_GPIO_Init_2 */
-
+#if APP_TRACE_PINS
+  // Timing markers (trace.h): the other three LEDs join PD13, fast edges
+  HAL_GPIO_WritePin(TRACE_PORT, TRACE_PINS, GPIO_PIN_RESET);
+  GPIO_InitStruct.Pin = TRACE_PINS;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  HAL_GPIO_Init(TRACE_PORT, &GPIO_InitStruct);
+#endif
   /* USER CODE END MX_GPIO_Init_2 */
 }
 
 /* USER CODE BEGIN 4 */
+#if APP_RTOS
+/**
+  * @brief Receive task: parse what DMA has buffered into free frame slots
+  * @note  Also runs the reception housekeeping of the bare-metal loop
+  */
+static void RTOS_RxTask(void *argument)
+{
+  (void)argument;
+
+  for (;;)
+  {
+    osThreadFlagsWait(RTOS_FLAG_RX, osFlagsWaitAny, RTOS_POLL_MS);
+
+#if APP_WATCHDOG_MS
+    // The highest priority task stands in for the others: a stuck
+    // inference task stops the feed once its frame outlasts the timeout
+    if (!infer_busy || HAL_GetTick() - infer_tick < APP_WATCHDOG_MS)
+    {
+      Boot_WatchdogFeed();
+    }
+#endif
+
+    // Reception could not be re-armed from the error callback
+    if (UART_TakeRestart())
+    {
+      UART_StartReception();
+    }
+
+    UART_PollReception();
+#if APP_RX_FRAME_TIMEOUT_MS
+    UART_FrameTimeout();
+#endif
+#if APP_SPI_LINK || APP_UART_LINKS
+    RX_PollLinks();
+#endif
 
+#if APP_CONFIG
+    UART_ConfirmSavedBaud();
+#endif
+    // Host never spoke at the negotiated rate, fall back
+    if (baud_pending && (HAL_GetTick() - baud_switch_tick) > BAUD_CONFIRM_MS)
+    {
+      baud_pending = 0;
+      LOG(LOG_BAUD_REVERT, UART_DEFAULT_BAUD, 0);
+      UART_ApplyBaud(UART_DEFAULT_BAUD);
+    }
+#if APP_LINK_FALLBACK_PERMILLE
+    UART_LinkQuality();
+#endif
+  }
+}
+
+/**
+  * @brief Inference task: process queued frames and report receive errors
+  */
+static void RTOS_InferTask(void *argument)
+{
+  uint8_t slot;
+  (void)argument;
+
+  for (;;)
+  {
+#if APP_WEIGHT_CHECK
+    // A slice of the weight check per tick while one is pending
+    osThreadFlagsWait(RTOS_FLAG_WORK, osFlagsWaitAny, Upload_CheckPending() ? 1U : RTOS_WORK_WAIT);
+    AI_CheckWeights();
+#else
+    osThreadFlagsWait(RTOS_FLAG_WORK, osFlagsWaitAny, RTOS_WORK_WAIT);
+#endif
+
+    // CMSIS-RTOS2 on FreeRTOS ignores message priorities, hence two queues
+    while (osMessageQueueGet(priority_queue, &slot, NULL, 0) == osOK ||
+           osMessageQueueGet(ready_queue, &slot, NULL, 0) == osOK)
+    {
+#if APP_WATCHDOG_MS
+      infer_tick = HAL_GetTick();
+      infer_busy = 1;
+#endif
+      TRACE_HIGH(TRACE_FRAME);
+      ADMISSION_BEGIN();
+      STAMP_BEGIN(RX_Frame(slot)->hdr.f.seq, slot_us[slot]);
+      ProcessFrame(RX_Frame(slot));
+      STAMP_END();
+      ADMISSION_END();
+      TRACE_LOW(TRACE_FRAME);
+      STATS_CYCLES(STATS_HIST_FRAME, PROF_CYCLES() - slot_stamp[slot]);
+      slot_busy[slot] = 0;
+      // Reception may be holding a frame back for want of a slot
+      osThreadFlagsSet(rx_task, RTOS_FLAG_RX);
+#if APP_ADMISSION
+      // Refusals go out now, not behind the rest of the queue
+      ProcessRxErrors();
+#endif
+    }
+#if APP_WATCHDOG_MS
+    infer_busy = 0;
+#endif
+
+    ProcessRxErrors();
+#if APP_TELEMETRY
+    TelemetryPush();
+#endif
+  }
+}
+
+/**
+  * @brief Transmit task: send encoded replies on the link they are for
+  */
+static void RTOS_TxTask(void *argument)
+{
+  uint8_t i;
+  (void)argument;
+
+  for (;;)
+  {
+    if (osMessageQueueGet(tx_queue, &i, NULL, RTOS_POLL_MS) == osOK)
+    {
+#if APP_USB_CDC
+      if (tx_frames[i].link == PROTO_LINK_USB)
+      {
+        USB_Link_Transmit(tx_frames[i].data, tx_frames[i].len, TX_TIMEOUT_MS);
+      }
+      else
+#endif
+#if APP_SPI_LINK
+      if (tx_frames[i].link == PROTO_LINK_SPI)
+      {
+        SPI_Link_Transmit(tx_frames[i].data, tx_frames[i].len, TX_TIMEOUT_MS);
+      }
+      else
+#endif
+#if APP_UART_LINKS
+      if (tx_frames[i].link >= PROTO_LINK_USART1)
+      {
+        UART_Link_Transmit(tx_frames[i].link - PROTO_LINK_USART1,
+                           tx_frames[i].data, tx_frames[i].len, TX_TIMEOUT_MS);
+      }
+      else
+#endif
+      {
+        UART_Queue(tx_frames[i].data, tx_frames[i].len);
+      }
+      osMessageQueuePut(tx_free, &i, 0, 0);
+    }
+
+    // Restart TX if a kick found the UART busy
+    if (!tx_inflight && tx_head != tx_tail)
+    {
+      __disable_irq();
+      UART_TxKick();
+      __enable_irq();
+    }
+  }
+}
+
+/**
+  * @brief Create the queues and tasks and start the kernel
+  */
+static void RTOS_Run(void)
+{
+  static const osThreadAttr_t rx_attr = {
+    .name = "rx", .priority = osPriorityHigh, .stack_size = APP_RTOS_STACK_IO,
+  };
+  static const osThreadAttr_t tx_attr = {
+    .name = "tx", .priority = osPriorityAboveNormal, .stack_size = APP_RTOS_STACK_IO,
+  };
+  static const osThreadAttr_t infer_attr = {
+    .name = "infer", .priority = osPriorityBelowNormal, .stack_size = APP_RTOS_STACK_INFER,
+  };
+
+  if (osKernelInitialize() != osOK)
+  {
+    Error_Handler();
+  }
+
+  ready_queue = osMessageQueueNew(RX_SLOTS, sizeof(uint8_t), NULL);
+  priority_queue = osMessageQueueNew(RX_SLOTS, sizeof(uint8_t), NULL);
+  tx_queue = osMessageQueueNew(TX_FRAMES, sizeof(uint8_t), NULL);
+  tx_free = osMessageQueueNew(TX_FRAMES, sizeof(uint8_t), NULL);
+  if (!ready_queue || !priority_queue || !tx_queue || !tx_free)
+  {
+    Error_Handler();
+  }
+  for (uint8_t i = 0; i < TX_FRAMES; i++)
+  {
+    osMessageQueuePut(tx_free, &i, 0, 0);
+  }
+
+  infer_task = osThreadNew(RTOS_InferTask, NULL, &infer_attr);
+  tx_task = osThreadNew(RTOS_TxTask, NULL, &tx_attr);
+  rx_task = osThreadNew(RTOS_RxTask, NULL, &rx_attr);
+  if (!infer_task || !tx_task || !rx_task)
+  {
+    Error_Handler();
+  }
+
+  osKernelStart();
+  Error_Handler();
+}
+#endif /* APP_RTOS */
 /* USER CODE END 4 */
 
 /**
@@ -450,10 +5952,7 @@ void Error_Handler(void)
 {
   /* USER CODE BEGIN Error_Handler_Debug */
   /* User can add his own implementation to report the HAL error return state */
-  __disable_irq();
-  while (1)
-  {
-  }
+  Boot_Fail(PROTO_FAULT_HAL);
   /* USER CODE END Error_Handler_Debug */
 }
 #ifdef USE_FULL_ASSERT
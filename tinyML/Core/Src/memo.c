@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file           : memo.c
+  * @brief          : Results of the last images classified, keyed by CRC
+  ******************************************************************************
+  */
+
+#include "memo.h"
+#include "protocol.h"
+#include "models.h"
+
+#if APP_MEMO
+typedef struct {
+  uint32_t key;
+  uint8_t predicted_class;
+  uint8_t valid;
+} MemoEntry_t;
+
+static MemoEntry_t memo[APP_MEMO];
+static uint8_t memo_next = 0;          // oldest entry, replaced next
+#endif
+
+/**
+  * @brief Forget every result, after the model changed
+  */
+void Memo_Clear(void)
+{
+#if APP_MEMO
+  for (uint32_t i = 0; i < APP_MEMO; i++)
+  {
+    memo[i].valid = 0;
+  }
+  memo_next = 0;
+#endif
+}
+
+/**
+  * @brief CRC-32 of a 28x28 image under the given model
+  * @note  Uses the CRC unit: same context as the frame CRCs, never an ISR
+  */
+uint32_t Memo_Key(uint8_t model, const uint8_t *img)
+{
+  return Proto_Crc(model, img, MODEL_IN_SIZE);
+}
+
+/**
+  * @brief Remembered class of the image with this key
+  * @retval class, or -1 if it isn't among the last APP_MEMO results
+  */
+int Memo_Find(uint32_t key)
+{
+#if APP_MEMO
+  for (uint32_t i = 0; i < APP_MEMO; i++)
+  {
+    if (memo[i].valid && memo[i].key == key)
+    {
+      return memo[i].predicted_class;
+    }
+  }
+#endif
+  (void)key;
+  return -1;
+}
+
+/**
+  * @brief Remember a result, replacing the oldest
+  */
+void Memo_Store(uint32_t key, uint8_t predicted_class)
+{
+#if APP_MEMO
+  memo[memo_next].key = key;
+  memo[memo_next].predicted_class = predicted_class;
+  memo[memo_next].valid = 1;
+  memo_next = (uint8_t)((memo_next + 1U) % APP_MEMO);
+#else
+  (void)key;
+  (void)predicted_class;
+#endif
+}
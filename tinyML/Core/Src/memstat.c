@@ -0,0 +1,77 @@
+/**
+  ******************************************************************************
+  * @file           : memstat.c
+  * @brief          : SRAM usage: static footprint, heap end and stack watermark
+  ******************************************************************************
+  */
+
+#include "memstat.h"
+#include "main.h"
+#include "app_config.h"
+#include <stddef.h>
+
+// Linker script symbols, only their addresses are meaningful
+extern uint8_t _end;
+extern uint8_t _estack;
+extern uint8_t _Min_Stack_Size;
+extern uint8_t __ai_activations_start;
+extern uint8_t __ai_activations_end;
+
+#if !APP_NO_HEAP
+extern void *_sbrk(ptrdiff_t incr);
+#endif
+
+// Words left untouched below the painting frame
+#define MEM_PAINT_GUARD         16U
+
+/**
+  * @brief Current heap end, __sbrk_heap_end of sysmem.c (_sbrk(0) allocates nothing)
+  */
+static uint32_t Mem_HeapEnd(void)
+{
+#if APP_NO_HEAP
+  return (uint32_t)&_end;
+#else
+  return (uint32_t)_sbrk(0);
+#endif
+}
+
+/**
+  * @brief Fill the gap between the heap and the stack with MEM_PAINT_PATTERN
+  * @note  Call first thing in main(), while the stack is at its shallowest
+  */
+void Mem_PaintStack(void)
+{
+  uint32_t *p = (uint32_t *)((Mem_HeapEnd() + 3U) & ~3U);
+  uint32_t *sp = (uint32_t *)__get_MSP() - MEM_PAINT_GUARD;
+
+  while (p < sp)
+  {
+    *p++ = MEM_PAINT_PATTERN;
+  }
+}
+
+/**
+  * @brief Snapshot of the SRAM budget, see ProtoMemStat_t
+  */
+void Mem_GetStats(ProtoMemStat_t *stats)
+{
+  uint32_t heap_end = Mem_HeapEnd();
+  const uint32_t *p = (const uint32_t *)((heap_end + 3U) & ~3U);
+  const uint32_t *top = (const uint32_t *)&_estack;
+
+  // Heap growth overwrites paint from below, so scan up from the heap end
+  while (p < top && *p == MEM_PAINT_PATTERN)
+  {
+    p++;
+  }
+
+  stats->ram_size = (uint32_t)&_estack - SRAM_BASE;
+  stats->static_size = (uint32_t)&_end - SRAM_BASE;
+  stats->activations_size = (uint32_t)&__ai_activations_end - (uint32_t)&__ai_activations_start;
+  stats->heap_end = heap_end;
+  stats->heap_used = heap_end - (uint32_t)&_end;
+  stats->stack_peak = (uint32_t)top - (uint32_t)p;
+  stats->stack_reserved = (uint32_t)&_Min_Stack_Size;
+  stats->free = (uint32_t)p - heap_end;
+}
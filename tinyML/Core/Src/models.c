@@ -0,0 +1,451 @@
+/**
+  ******************************************************************************
+  * @file           : models.c
+  * @brief          : Registry of the generated networks linked into the image
+  ******************************************************************************
+  */
+
+#include "models.h"
+#include <stddef.h>
+#include <string.h>
+#include "app_config.h"
+#include "ai_layer_custom_interface.h"
+#include "upload.h"
+#include "xmodel.h"
+#include "protocol.h"
+
+#if APP_RUNTIME_MIN
+// Not referenced, so neither it nor the runtime's report code is linked
+#define MODEL_REPORT(name)      NULL
+#else
+#define MODEL_REPORT(name)      ai_##name##_get_report
+#endif
+
+#define MODEL_ENTRY(name, NAME) \
+  { #name, ai_##name##_create_and_init, ai_##name##_destroy, ai_##name##_init, \
+    ai_##name##_data_params_get, ai_##name##_inputs_get, ai_##name##_outputs_get, \
+    ai_##name##_run, MODEL_REPORT(name) },
+
+static const Model_t models[] = { MODEL_LIST(MODEL_ENTRY) };
+
+#define MODEL_COUNT             (sizeof(models) / sizeof(models[0]))
+
+// Created networks, AI_HANDLE_NULL until first selected
+static ai_handle model_handles[MODEL_COUNT];
+// Model whose buffers the bound arena currently holds, -1 if none
+static int16_t model_active = -1;
+
+// Pinned to the start of SRAM by the linker script (.ai_activations), one
+// arena per slot; model_slot's is the one the active model is bound to
+static ai_u8 model_arena[APP_ARENA_SLOTS][MODEL_ARENA_STRIDE] __attribute__((aligned(16), section(".ai_activations")));
+static uint8_t model_slot = 0;
+
+_Static_assert(sizeof(model_arena) <= APP_ARENA_BUDGET,
+               "APP_ARENA_SLOTS arenas of MODEL_ARENA_SIZE exceed APP_ARENA_BUDGET");
+
+#if APP_RX_OVERLAY
+#define MODEL_OVERLAY(name, NAME) { OVERLAY_##NAME##_OFFSET, OVERLAY_##NAME##_NODE },
+
+// overlay_plan.h rows in MODEL_LIST order
+static const struct {
+  uint32_t offset;
+  uint16_t node;
+} model_overlays[] = { MODEL_LIST(MODEL_OVERLAY) };
+
+_Static_assert(OVERLAY_BYTES >= offsetof(ProtoFrame_t, payload) + MODEL_IN_SIZE,
+               "overlay_plan.h was planned for a smaller frame, run stm32dc.memplan again");
+#endif
+
+#if APP_WEIGHT_CACHE
+// SRAM copies of the active model's small weight tensors
+static uint32_t model_cache[(APP_WEIGHT_CACHE + 3U) / 4U];
+static uint32_t model_cache_used;
+static int16_t model_cache_owner = -1;  // model the copies are of, -1 if none
+#endif
+
+/**
+  * @brief Number of registered networks
+  */
+uint8_t Model_Count(void)
+{
+  return (uint8_t)MODEL_COUNT;
+}
+
+/**
+  * @brief Registry entry, NULL past the end
+  */
+const Model_t *Model_Get(uint8_t index)
+{
+  return (index < Model_Count()) ? &models[index] : NULL;
+}
+
+#if APP_WEIGHT_CACHE
+/**
+  * @brief Copy weight tensors into model_cache in layer order while they fit
+  *        and point the network at the copies
+  * @note  init binds every weight array to the flash blob again, so this
+  *        runs after each one; the generated weights[] map is a single
+  *        buffer and cannot relocate individual tensors itself
+  * @param copy 0 when the cache already holds this model's tensors, which
+  *        land at the same offsets: only point the network at them
+  */
+static void Model_CacheWeights(ai_handle network, uint8_t copy)
+{
+  ai_network *net = AI_NETWORK_ACQUIRE_CTX(network);
+  ai_node *node = net ? net->input_node : NULL;
+
+  model_cache_used = 0;
+  for (uint32_t n = 0; node && n < MODEL_MAX_NODES; n++)
+  {
+    for (ai_u16 i = 0; i < ai_layer_get_tensor_weights_size((ai_layer *)node); i++)
+    {
+      ai_tensor *t = ai_layer_get_tensor_weights((ai_layer *)node, i);
+      uint32_t size = t ? ((uint32_t)ai_tensor_get_data_byte_size(t) + 3U) & ~3U : 0;
+      uint8_t *cached = (uint8_t *)model_cache + model_cache_used;
+
+      if (!size || !t->data || size > sizeof(model_cache) - model_cache_used)
+      {
+        continue;
+      }
+      if (copy)
+      {
+        memcpy(cached, t->data->data, ai_tensor_get_data_byte_size(t));
+      }
+      t->data->data = AI_PTR(cached);
+      t->data->data_start = AI_PTR(cached);
+      model_cache_used += size;
+    }
+    // The last layer links to itself
+    node = (node->next == node) ? NULL : node->next;
+  }
+}
+#endif
+
+#if APP_UPLOAD
+/**
+  * @brief Bytes of a model's generated weights map, 0 if it is not one buffer
+  */
+static uint32_t Model_WeightsSize(const Model_t *m)
+{
+  ai_network_params params;
+
+  if (!m->data_params_get(&params) || params.map_weights.size != 1)
+  {
+    return 0;
+  }
+  return AI_BUFFER_BYTE_SIZE(AI_BUFFER_SIZE(&params.map_weights.buffer[0]), params.map_weights.buffer[0].format);
+}
+
+/**
+  * @brief Weights model index runs on: XMODEL_BASE for a streamed model,
+  *        else those uploaded for it (upload.h) if they fit its weights map
+  * @retval AI_HANDLE_NULL to keep the linked weights
+  */
+static ai_handle Model_Uploaded(const Model_t *m, uint8_t index)
+{
+  uint32_t size;
+
+  if (Model_Streamed(index) >= 0)
+  {
+    return AI_HANDLE_PTR(XMODEL_BASE);
+  }
+  size = Model_WeightsSize(m);
+  return size ? AI_HANDLE_PTR((void *)Upload_Weights(index, size)) : AI_HANDLE_NULL;
+}
+#endif
+
+/**
+  * @brief Make model index the one the arena serves, creating it on first use
+  * @retval its handle, AI_HANDLE_NULL if it could not be created or re-inited
+  */
+ai_handle Model_Activate(uint8_t index)
+{
+  const Model_t *m = Model_Get(index);
+  ai_handle *handle;
+
+  if (!m) return AI_HANDLE_NULL;
+  handle = &model_handles[index];
+
+  if (*handle == AI_HANDLE_NULL)
+  {
+    // Cold: create the context and bind it to the arena
+    const ai_handle act_addr[] = { AI_HANDLE_PTR(model_arena[model_slot]) };
+#if APP_UPLOAD
+    const ai_handle weights_addr[] = { Model_Uploaded(m, index) };
+    if (m->create_and_init(handle, act_addr, weights_addr[0] ? weights_addr : NULL).type != AI_ERROR_NONE)
+#else
+    if (m->create_and_init(handle, act_addr, NULL).type != AI_ERROR_NONE)
+#endif
+    {
+      Model_Drop(index);
+      return AI_HANDLE_NULL;
+    }
+  }
+  else if (model_active != index)
+  {
+    // Warm: the arena held another model's buffers, init again in place
+    ai_network_params params;
+#if APP_UPLOAD
+    ai_handle uploaded = Model_Uploaded(m, index);
+#endif
+    model_active = -1;
+    if (!m->data_params_get(&params) || params.map_activations.size != 1)
+    {
+      return AI_HANDLE_NULL;
+    }
+    AI_BUFFER_ARRAY_ITEM_SET_ADDRESS(&params.map_activations, 0, AI_HANDLE_PTR(model_arena[model_slot]));
+#if APP_UPLOAD
+    if (uploaded)
+    {
+      AI_BUFFER_ARRAY_ITEM_SET_ADDRESS(&params.map_weights, 0, uploaded);
+    }
+#endif
+    if (!m->init(*handle, &params))
+    {
+      return AI_HANDLE_NULL;
+    }
+  }
+
+#if APP_XFLASH
+  // The tensors point at XMODEL_BASE again after every init
+  if (Model_Streamed(index) >= 0 && model_active != index &&
+      XModel_Bind(*handle, (uint8_t)Model_Streamed(index), Model_WeightsSize(m)) != 0)
+  {
+    Model_Drop(index);
+    return AI_HANDLE_NULL;
+  }
+#endif
+#if APP_WEIGHT_CACHE
+  if (Model_Streamed(index) < 0 && model_active != index)
+  {
+    Model_CacheWeights(*handle, model_cache_owner != index);
+    model_cache_owner = index;
+  }
+#endif
+  model_active = index;
+  return *handle;
+}
+
+/**
+  * @brief Bytes of the active model's weights served from SRAM
+  */
+uint32_t Model_CachedBytes(void)
+{
+  if (model_active >= 0 && Model_Streamed((uint8_t)model_active) >= 0)
+  {
+    return XModel_ResidentBytes();
+  }
+#if APP_WEIGHT_CACHE
+  return (model_active >= 0) ? model_cache_used : 0;
+#else
+  return 0;
+#endif
+}
+
+/**
+  * @brief External flash slot of a model whose weights stream (xmodel.h)
+  * @retval the slot, -1 for a model on internal flash
+  */
+int Model_Streamed(uint8_t index)
+{
+  uint8_t first = (uint8_t)(MODEL_COUNT - MODEL_XFLASH_COUNT);
+
+  return (index >= first && index < MODEL_COUNT) ? (int)(index - first) : -1;
+}
+
+/**
+  * @brief Start of the bound activation arena, MODEL_ARENA_SIZE bytes
+  */
+const uint8_t *Model_Arena(void)
+{
+  return model_arena[model_slot];
+}
+
+/**
+  * @brief Tensor the last dense layer of a network reads, its embedding:
+  *        the input of the c-node before the last one
+  * @note  Valid after a run only if no later c-node writes over it, which
+  *        is checked against their outputs and first scratch buffers
+  * @retval its bytes, -1 if the network has no such c-node or it is overwritten
+  */
+int Model_Embedding(ai_handle network, const int8_t **data, int8_t *zero_point)
+{
+  ai_network *net = AI_NETWORK_ACQUIRE_CTX(network);
+  ai_node *nodes[MODEL_MAX_NODES];
+  ai_node *node = net ? net->input_node : NULL;
+  ai_tensor *in;
+  uint32_t n, count = 0, start, end;
+
+  for (; node && count < MODEL_MAX_NODES; count++)
+  {
+    nodes[count] = node;
+    // The last layer links to itself
+    node = (node->next == node) ? NULL : node->next;
+  }
+  if (count < 2)
+  {
+    return -1;
+  }
+
+  in = ai_layer_get_tensor_in((ai_layer *)nodes[count - 2], 0);
+  if (!in || ai_tensor_get_data_byte_size(in) > PROTO_EMBED_MAX)
+  {
+    return -1;
+  }
+  start = (uint32_t)ai_tensor_get_data(in).handle;
+  end = start + ai_tensor_get_data_byte_size(in);
+
+  for (n = count - 2; n < count; n++)
+  {
+    ai_tensor *written[2] = { ai_layer_get_tensor_out((ai_layer *)nodes[n], 0),
+                              GET_TENSOR_SCRATCH(nodes[n]->tensors, 0) };
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      uint32_t w0 = written[i] ? (uint32_t)ai_tensor_get_data(written[i]).handle : 0;
+      uint32_t w1 = written[i] ? w0 + ai_tensor_get_data_byte_size(written[i]) : 0;
+
+      if (w0 < end && start < w1)
+      {
+        return -1;
+      }
+    }
+  }
+
+  *data = ai_tensor_get_data(in).s8;
+  *zero_point = ai_tensor_has_intq(in) ? ai_tensor_get_intq(in).zeropoint_s8[0] : 0;
+  return (int)ai_tensor_get_data_byte_size(in);
+}
+
+#if APP_RX_OVERLAY
+/**
+  * @brief Overlay frame slot of a bound model: its overlay_plan.h region
+  * @note  Checked against the network as bound, so a plan made for another
+  *        build of the model turns the slot off instead of receiving over
+  *        live tensors: no tensor of its planned c-node onward, nor the
+  *        network input, may overlap the region
+  * @retval the c-node from which the region is unused to the end of the
+  *         run, -1 if it is not
+  */
+int Model_Overlay(ai_handle network, uint8_t index, uint8_t **region)
+{
+  ai_network *net = AI_NETWORK_ACQUIRE_CTX(network);
+  ai_node *node = net ? net->input_node : NULL;
+  uint32_t start, end, n;
+
+  if (index >= MODEL_COUNT || model_overlays[index].offset % 4U ||
+      model_overlays[index].offset + OVERLAY_BYTES > MODEL_ARENA_SIZE)
+  {
+    return -1;
+  }
+  start = (uint32_t)model_arena[model_slot] + model_overlays[index].offset;
+  end = start + OVERLAY_BYTES;
+
+  for (n = 0; node && n < MODEL_MAX_NODES; n++)
+  {
+    for (uint32_t l = AI_TENSOR_CHAIN_INPUT; l <= AI_TENSOR_CHAIN_SCRATCH; l++)
+    {
+      ai_tensor_list *list = (l < node->tensors->size) ? &node->tensors->chain[l] : NULL;
+
+      // Weights are never in the arena; before the planned node only the
+      // input matters, which the next frame is read into
+      if (l == AI_TENSOR_CHAIN_WEIGHTS ||
+          (n < model_overlays[index].node && !(n == 0 && l == AI_TENSOR_CHAIN_INPUT)))
+      {
+        continue;
+      }
+      for (ai_size i = 0; i < GET_TENSOR_LIST_SIZE(list); i++)
+      {
+        ai_tensor *t = GET_TENSOR_LIST_ITEM(list, i);
+        uint32_t t0, t1;
+
+        if (!t || !t->data)
+        {
+          continue;
+        }
+        t0 = (uint32_t)ai_tensor_get_data(t).handle;
+        t1 = t0 + ai_tensor_get_data_byte_size(t);
+        if (t0 < end && start < t1)
+        {
+          return -1;
+        }
+      }
+    }
+    // The last layer links to itself
+    node = (node->next == node) ? NULL : node->next;
+  }
+  if (model_overlays[index].node >= n)
+  {
+    return -1;
+  }
+
+  *region = model_arena[model_slot] + model_overlays[index].offset;
+  return (int)model_overlays[index].node;
+}
+#endif
+
+/**
+  * @brief Destroy a created model, the next Model_Activate starts cold
+  */
+void Model_Drop(uint8_t index)
+{
+  const Model_t *m = Model_Get(index);
+
+  if (!m) return;
+  if (model_handles[index] != AI_HANDLE_NULL)
+  {
+    m->destroy(model_handles[index]);
+    model_handles[index] = AI_HANDLE_NULL;
+  }
+  if (model_active == index)
+  {
+    model_active = -1;
+  }
+#if APP_WEIGHT_CACHE
+  // Its weights may change before it is created again (upload)
+  if (model_cache_owner == index)
+  {
+    model_cache_owner = -1;
+  }
+#endif
+}
+
+/**
+  * @brief Bind the active model to arena slot, a warm re-init when it moves
+  * @note  The other slots keep their bytes: an input staged in one stays
+  *        there until a run is bound to it
+  * @retval its handle, AI_HANDLE_NULL if slot is out of range, no model
+  *         is active or the re-init failed (then none is)
+  */
+ai_handle Model_UseSlot(uint8_t slot)
+{
+  int16_t index = model_active;
+
+  if (slot >= APP_ARENA_SLOTS || index < 0)
+  {
+    return AI_HANDLE_NULL;
+  }
+  if (slot == model_slot)
+  {
+    return model_handles[index];
+  }
+  model_slot = slot;
+  model_active = -1;
+  return Model_Activate((uint8_t)index);
+}
+
+/**
+  * @brief Arena slot the active model is bound to
+  */
+uint8_t Model_Slot(void)
+{
+  return model_slot;
+}
+
+/**
+  * @brief Start of arena slot's MODEL_ARENA_SIZE bytes, NULL past the last
+  */
+uint8_t *Model_SlotArena(uint8_t slot)
+{
+  return (slot < APP_ARENA_SLOTS) ? model_arena[slot] : NULL;
+}
@@ -0,0 +1,135 @@
+/**
+  ******************************************************************************
+  * @file           : preprocess.c
+  * @brief          : Input loading, ink and delta sums and argmax of the hot path
+  ******************************************************************************
+  */
+
+#include "preprocess.h"
+#ifndef HOST_BUILD
+#include "stm32f4xx.h"
+#endif
+#include <string.h>
+
+/**
+  * @brief Four bytes from any address; one LDR on the Cortex-M4
+  */
+static inline uint32_t Pre_Word(const uint8_t *p)
+{
+  uint32_t v;
+
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+/**
+  * @brief Convert uint8 (0-255) to int8 (-128 to 127) straight into an
+  *        input tensor: x - 128 is x ^ 0x80, done 4 pixels per word
+  */
+void Pre_LoadImage(int8_t *input, const uint8_t *img, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i += 4U)
+  {
+    uint32_t v = Pre_Word(&img[i]) ^ 0x80808080U;
+    memcpy(&input[i], &v, sizeof(v));
+  }
+}
+
+/**
+  * @brief Sum of the n pixels, four at a time with USADA8 (|x - 0|)
+  */
+uint32_t Pre_Ink(const uint8_t *img, uint32_t n)
+{
+  uint32_t ink = 0;
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+  for (uint32_t i = 0; i < n; i += 4U)
+  {
+    ink = __USADA8(Pre_Word(&img[i]), 0U, ink);
+  }
+#else
+  for (uint32_t i = 0; i < n; i++)
+  {
+    ink += img[i];
+  }
+#endif
+  return ink;
+}
+
+/**
+  * @brief Sum of absolute differences of a and b, given up once it reaches limit
+  * @note  Four pixels at a time with USADA8, the limit checked every
+  *        PRE_DELTA_STRIDE words; n is a multiple of that many words
+  * @retval the sum, or a value >= limit as soon as it gets there
+  */
+uint32_t Pre_Delta(const uint8_t *a, const uint8_t *b, uint32_t n, uint32_t limit)
+{
+  uint32_t delta = 0;
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+  for (uint32_t i = 0; i < n / 4U && delta < limit; i += PRE_DELTA_STRIDE)
+  {
+    for (uint32_t k = i; k < i + PRE_DELTA_STRIDE; k++)
+    {
+      delta = __USADA8(Pre_Word(&a[k * 4]), Pre_Word(&b[k * 4]), delta);
+    }
+  }
+#else
+  for (uint32_t i = 0; i < n && delta < limit; i++)
+  {
+    delta += (a[i] > b[i]) ? a[i] - b[i] : b[i] - a[i];
+  }
+#endif
+  return delta;
+}
+
+/**
+  * @brief Index of the highest of n int8 scores, the lowest index on a tie
+  * @note  Four lanes at a time: SSUB8 sets a GE flag per byte where the
+  *        running max is still >= the new score, SEL then keeps it, or the
+  *        new score, and the word index it came from
+  */
+int Pre_Argmax(const int8_t *scores, int n)
+{
+  int best = 0;
+  int i = 0;
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+  if (n >= 4)
+  {
+    uint32_t max = Pre_Word((const uint8_t *)scores);
+    uint32_t idx = 0;
+
+    for (i = 4; i + 4 <= n; i += 4)
+    {
+      uint32_t v = Pre_Word((const uint8_t *)&scores[i]);
+      (void)__SSUB8(max, v);
+      max = __SEL(max, v);
+      idx = __SEL(idx, (uint32_t)(i / 4) * 0x01010101U);
+    }
+
+    // Lane l of word k is score 4k + l; the lanes' own winners are the
+    // earliest, compare across lanes by value then index
+    best = -1;
+    for (int l = 0; l < 4; l++)
+    {
+      int8_t v = (int8_t)(max >> (8 * l));
+      int at = (int)((idx >> (8 * l)) & 0xFFU) * 4 + l;
+      if (best < 0 || v > scores[best] || (v == scores[best] && at < best))
+      {
+        best = at;
+      }
+    }
+  }
+#endif
+
+  // Tail past the last full word, or every score without the DSP extension
+  for (; i < n; i++)
+  {
+    if (scores[i] > scores[best])
+    {
+      best = i;
+    }
+  }
+  return best;
+}
@@ -0,0 +1,178 @@
+/**
+  ******************************************************************************
+  * @file           : profile.c
+  * @brief          : DWT cycle counter helpers for on-target timing
+  ******************************************************************************
+  */
+
+#include "profile.h"
+#include "trace.h"
+#include "stai_app.h"
+
+#if APP_PROFILE_LAYERS || APP_CANCEL || APP_STAI || APP_RX_OVERLAY
+#include "ai_platform_interface.h"
+#endif
+
+#if APP_PROFILE_LAYERS
+static ProfNode_t prof_nodes[MODEL_MAX_NODES];
+static uint16_t prof_n_nodes = 0;
+static uint32_t prof_node_start = 0;
+#endif
+
+#if APP_PROFILE_COUNTERS
+static ProfCounters_t prof_counters[MODEL_MAX_NODES];
+static uint32_t prof_events_start = 0;
+static uint8_t prof_fold_start = 0;
+
+// CPICNT, EXCCNT, SLEEPCNT and LSUCNT in one word, lowest byte first
+static inline uint32_t Prof_Events(void)
+{
+  return (DWT->CPICNT & 0xFFU) | (DWT->EXCCNT & 0xFFU) << 8 |
+         (DWT->SLEEPCNT & 0xFFU) << 16 | (DWT->LSUCNT & 0xFFU) << 24;
+}
+#endif
+
+/**
+  * @brief Start the DWT cycle counter
+  * @note  Does not restart it once running: Boot_Init starts it first and
+  *        keeps counting the boot from there
+  */
+void Prof_Init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+  {
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+#if APP_PROFILE_COUNTERS
+  DWT->CTRL |= DWT_CTRL_CPIEVTENA_Msk | DWT_CTRL_EXCEVTENA_Msk | DWT_CTRL_SLEEPEVTENA_Msk |
+               DWT_CTRL_LSUEVTENA_Msk | DWT_CTRL_FOLDEVTENA_Msk;
+#endif
+}
+
+#if APP_PROFILE_LAYERS || APP_CANCEL || APP_STAI || APP_RX_OVERLAY
+/**
+  * @brief Observer callback, times each c-node between its PRE and POST events
+  * @note  With APP_CANCEL each PRE event is also where a cancel of the
+  *        running request is noticed. With APP_RX_OVERLAY it
+  *        opens the overlay frame slot. With APP_STAI both events are
+  *        passed on as stai node events
+  */
+static ai_u32 Prof_OnNode(const ai_handle cookie, const ai_u32 flags,
+                          const ai_observer_node *node)
+{
+#if APP_PROFILE_LAYERS
+  uint32_t now;
+#endif
+#if APP_PROFILE_COUNTERS
+  uint32_t events;
+  uint8_t fold;
+#endif
+  (void)cookie;
+  (void)node;
+
+#if APP_CANCEL
+  if (flags & AI_OBSERVER_PRE_EVT)
+  {
+    AI_NodeBoundary();
+  }
+#endif
+
+#if APP_RX_OVERLAY
+  if (flags & AI_OBSERVER_PRE_EVT)
+  {
+    RX_OverlayNode(node->c_idx);
+  }
+#endif
+
+#if APP_STAI
+  StaiApp_NodeEvent(flags, node);
+#endif
+
+#if APP_PROFILE_LAYERS
+  now = PROF_CYCLES();
+#if APP_PROFILE_COUNTERS
+  events = Prof_Events();
+  fold = (uint8_t)DWT->FOLDCNT;
+#endif
+  if (flags & AI_OBSERVER_PRE_EVT)
+  {
+    prof_node_start = now;
+    TRACE_BEGIN(TRACE_ITM_LAYER, node->c_idx);
+#if APP_PROFILE_COUNTERS
+    prof_events_start = events;
+    prof_fold_start = fold;
+    TRACE_COUNTERS(TRACE_PH_BEGIN);
+#endif
+  }
+  else if ((flags & AI_OBSERVER_POST_EVT) && node->c_idx < MODEL_MAX_NODES)
+  {
+#if APP_PROFILE_COUNTERS
+    TRACE_COUNTERS(TRACE_PH_END);
+    prof_counters[node->c_idx].cpi = (uint8_t)(events - prof_events_start);
+    prof_counters[node->c_idx].exc = (uint8_t)((events >> 8) - (prof_events_start >> 8));
+    prof_counters[node->c_idx].sleep = (uint8_t)((events >> 16) - (prof_events_start >> 16));
+    prof_counters[node->c_idx].lsu = (uint8_t)((events >> 24) - (prof_events_start >> 24));
+    prof_counters[node->c_idx].fold = (uint8_t)(fold - prof_fold_start);
+#endif
+    TRACE_END(TRACE_ITM_LAYER, node->c_idx);
+    prof_nodes[node->c_idx].id = node->id;
+    prof_nodes[node->c_idx].c_idx = node->c_idx;
+    prof_nodes[node->c_idx].cycles = now - prof_node_start;
+    if (node->c_idx >= prof_n_nodes)
+    {
+      prof_n_nodes = node->c_idx + 1;
+    }
+  }
+#endif
+
+  return 0;
+}
+
+/**
+  * @brief Attach the per-node timing observer to an initialised network
+  * @retval 0 on success, -1 if the runtime refused the observer
+  */
+int Prof_ObserverRegister(ai_handle network)
+{
+  // A newly selected network may have fewer nodes than the last one. Cached
+  // networks are bound again on every selection, register only once.
+#if APP_PROFILE_LAYERS
+  prof_n_nodes = 0;
+#endif
+  ai_platform_observer_unregister(network, Prof_OnNode, NULL);
+  if (!ai_platform_observer_register(network, Prof_OnNode, NULL,
+                                     AI_OBSERVER_PRE_EVT | AI_OBSERVER_POST_EVT))
+  {
+    return -1;
+  }
+  return 0;
+}
+#endif
+
+#if APP_PROFILE_LAYERS
+/**
+  * @brief Node timings of the last inference
+  * @retval number of entries in nodes (0 before the first inference)
+  */
+uint16_t Prof_NodeTable(const ProfNode_t **nodes)
+{
+  *nodes = prof_nodes;
+  return prof_n_nodes;
+}
+#endif
+
+#if APP_PROFILE_COUNTERS
+/**
+  * @brief DWT event counts of the last inference, one per Prof_NodeTable entry
+  * @retval number of entries in counters
+  */
+uint16_t Prof_CounterTable(const ProfCounters_t **counters)
+{
+  const ProfNode_t *nodes;
+
+  *counters = prof_counters;
+  return Prof_NodeTable(&nodes);
+}
+#endif
@@ -0,0 +1,289 @@
+/**
+  ******************************************************************************
+  * @file           : protocol.c
+  * @brief          : Binary framing of the host link (parser, CRC, encoder)
+  ******************************************************************************
+  */
+
+#include "protocol.h"
+#ifdef HOST_BUILD
+// tinyML/host: no HAL, no trace pins, the CRC unit done in software
+#define TRACE_MARK(event, value) ((void)0)
+#else
+#include "main.h"
+#include "trace.h"
+#include "upload.h"
+#endif
+#include <string.h>
+
+// New receive state, traced so the timeline shows where a frame waited
+#define PROTO_ENTER(parser, next) \
+  do { (parser)->state = (next); TRACE_MARK(TRACE_ITM_STATE, ((uint32_t)(parser)->link << 4) | (next)); } while (0)
+
+/**
+  * @brief Enable the CRC unit used to protect frames
+  */
+void Proto_Init(void)
+{
+#ifndef HOST_BUILD
+  __HAL_RCC_CRC_CLK_ENABLE();
+#endif
+}
+
+/**
+  * @brief Return the parser to frame synchronisation
+  */
+void Proto_ParserReset(ProtoParser_t *parser)
+{
+  PROTO_ENTER(parser, PROTO_RX_SYNC0);
+  parser->count = 0;
+  parser->frame = NULL;
+}
+
+/**
+  * @brief Give up on the frame being received and resync
+  * @note  Reported through drop only once its header, and so its seq, is
+  *        known. The caller frees parser->frame first, the parser does
+  *        not own it
+  */
+void Proto_ParserAbort(ProtoParser_t *parser, ProtoError_t error)
+{
+  if (parser->state == PROTO_RX_PAYLOAD || parser->state == PROTO_RX_CRC)
+  {
+    parser->drop(parser, parser->hdr[0], parser->hdr[1], error);
+  }
+  Proto_ParserReset(parser);
+}
+
+/**
+  * @brief Called once the 4 header bytes are in, decides where the payload goes
+  */
+static void Proto_HeaderDone(ProtoParser_t *parser)
+{
+  uint16_t len = (uint16_t)(parser->hdr[2] | (parser->hdr[3] << 8));
+
+  if (len > PROTO_MAX_PAYLOAD)
+  {
+    // Corrupt or oversized header, resync on the following bytes
+    parser->drop(parser, parser->hdr[0], parser->hdr[1], PROTO_ERR_LENGTH);
+    Proto_ParserReset(parser);
+    return;
+  }
+
+  parser->frame = parser->claim(parser);
+  if (parser->frame)
+  {
+    memcpy(&parser->frame->hdr.word, parser->hdr, sizeof(parser->hdr));
+    parser->frame->link = parser->link;
+    // Only the queue order depends on it, dispatch sees the plain type
+    parser->frame->priority = (parser->hdr[0] & PROTO_PRIORITY_FLAG) != 0U;
+    parser->frame->hdr.f.type &= (uint8_t)~PROTO_PRIORITY_FLAG;
+  }
+
+  parser->count = 0;
+  PROTO_ENTER(parser, (len > 0) ? PROTO_RX_PAYLOAD : PROTO_RX_CRC);
+}
+
+/**
+  * @brief Feed received bytes to the frame parser
+  * @note  Stops right after a completed frame so the caller can make room
+  *        before the next one is claimed, and after one refused for want
+  *        of a slot so the caller decides on the next
+  * @retval number of bytes consumed
+  */
+uint16_t Proto_Parse(ProtoParser_t *parser, const uint8_t *data, uint16_t len)
+{
+  uint16_t i = 0;
+
+  while (i < len)
+  {
+    switch (parser->state)
+    {
+      case PROTO_RX_SYNC0:
+        if (data[i++] == PROTO_MAGIC0)
+        {
+          PROTO_ENTER(parser, PROTO_RX_SYNC1);
+        }
+        break;
+
+      case PROTO_RX_SYNC1:
+        if (data[i] == PROTO_MAGIC1)
+        {
+          PROTO_ENTER(parser, PROTO_RX_HEADER);
+          parser->count = 0;
+          i++;
+        }
+        else if (data[i++] != PROTO_MAGIC0)
+        {
+          PROTO_ENTER(parser, PROTO_RX_SYNC0);
+        }
+        break;
+
+      case PROTO_RX_HEADER:
+        parser->hdr[parser->count++] = data[i++];
+        if (parser->count == sizeof(parser->hdr))
+        {
+          Proto_HeaderDone(parser);
+        }
+        break;
+
+      case PROTO_RX_PAYLOAD:
+      {
+        uint16_t total = (uint16_t)(parser->hdr[2] | (parser->hdr[3] << 8));
+        uint16_t n = len - i;
+        if (n > total - parser->count)
+        {
+          n = total - parser->count;
+        }
+
+        if (parser->frame)
+        {
+          if (parser->progress || !parser->copy ||
+              parser->copy(parser, parser->frame, &parser->frame->payload[parser->count], &data[i], n) != 0)
+          {
+            memcpy(&parser->frame->payload[parser->count], &data[i], n);
+          }
+          if (parser->progress)
+          {
+            parser->progress(parser, parser->frame, parser->count, (uint16_t)(parser->count + n));
+          }
+        }
+        parser->count += n;
+        i += n;
+
+        if (parser->count == total)
+        {
+          parser->count = 0;
+          PROTO_ENTER(parser, PROTO_RX_CRC);
+        }
+        break;
+      }
+
+      case PROTO_RX_CRC:
+        parser->crc[parser->count++] = data[i++];
+        if (parser->count == sizeof(parser->crc))
+        {
+          if (parser->frame)
+          {
+            memcpy(&parser->frame->crc, parser->crc, sizeof(parser->crc));
+            parser->complete(parser, parser->frame);
+            Proto_ParserReset(parser);
+            return i;
+          }
+          parser->drop(parser, parser->hdr[0], parser->hdr[1], PROTO_ERR_BUSY);
+          Proto_ParserReset(parser);
+          return i;
+        }
+        break;
+
+      default:
+        Proto_ParserReset(parser);
+        break;
+    }
+  }
+
+  return i;
+}
+
+#ifdef HOST_BUILD
+/**
+  * @brief The CRC unit's step: word in MSB first, polynomial 0x04C11DB7
+  */
+static uint32_t Proto_CrcWord(uint32_t crc, uint32_t word)
+{
+  crc ^= word;
+  for (int bit = 0; bit < 32; bit++)
+  {
+    crc = (crc & 0x80000000U) ? (crc << 1) ^ 0x04C11DB7U : crc << 1;
+  }
+  return crc;
+}
+
+/**
+  * @brief CRC-32 of a header word and payload as the CRC unit computes it
+  */
+uint32_t Proto_Crc(uint32_t header, const uint8_t *payload, uint16_t len)
+{
+  uint32_t crc = Proto_CrcWord(0xFFFFFFFFU, header);
+  uint16_t words = len / 4U;
+
+  for (uint16_t i = 0; i < words; i++)
+  {
+    uint32_t word;
+    memcpy(&word, &payload[i * 4U], sizeof(word));
+    crc = Proto_CrcWord(crc, word);
+  }
+  if (len & 3U)
+  {
+    uint32_t last = 0;
+    memcpy(&last, &payload[words * 4U], len & 3U);
+    crc = Proto_CrcWord(crc, last);
+  }
+  return crc;
+}
+#else
+/**
+  * @brief CRC-32 of a header word and payload using the CRC unit
+  * @note  The trailing partial word is zero padded, the host does the same
+  */
+uint32_t Proto_Crc(uint32_t header, const uint8_t *payload, uint16_t len)
+{
+  uint16_t words = len / 4U;
+
+#if APP_WEIGHT_CHECK
+  // The weight check may be feeding the unit
+  Upload_CheckYield();
+#endif
+  CRC->CR = CRC_CR_RESET;
+  CRC->DR = header;
+
+  for (uint16_t i = 0; i < words; i++)
+  {
+    CRC->DR = __UNALIGNED_UINT32_READ(&payload[i * 4U]);
+  }
+
+  if (len & 3U)
+  {
+    uint32_t last = 0;
+    memcpy(&last, &payload[words * 4U], len & 3U);
+    CRC->DR = last;
+  }
+
+  return CRC->DR;
+}
+#endif
+
+/**
+  * @brief Check the CRC of a received frame
+  * @retval 0 if the frame is intact, -1 otherwise
+  */
+int Proto_CheckFrame(const ProtoFrame_t *frame)
+{
+  uint32_t header = frame->hdr.word | (frame->priority ? PROTO_PRIORITY_FLAG : 0U);
+  uint32_t crc = Proto_Crc(header, frame->payload, frame->hdr.f.len);
+  return (crc == frame->crc) ? 0 : -1;
+}
+
+/**
+  * @brief Build a complete frame into out (len + PROTO_OVERHEAD bytes)
+  * @retval number of bytes written
+  */
+uint16_t Proto_Encode(uint8_t *out, uint8_t type, uint8_t seq,
+                      const void *payload, uint16_t len)
+{
+  uint32_t header = (uint32_t)type | ((uint32_t)seq << 8) | ((uint32_t)len << 16);
+  uint32_t crc;
+
+  out[0] = PROTO_MAGIC0;
+  out[1] = PROTO_MAGIC1;
+  memcpy(&out[2], &header, sizeof(header));
+  if (len)
+  {
+    memcpy(&out[PROTO_HEADER_SIZE], payload, len);
+  }
+
+  crc = Proto_Crc(header, &out[PROTO_HEADER_SIZE], len);
+  memcpy(&out[PROTO_HEADER_SIZE + len], &crc, sizeof(crc));
+
+  return (uint16_t)(len + PROTO_OVERHEAD);
+}
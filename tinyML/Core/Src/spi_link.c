@@ -0,0 +1,378 @@
+/**
+  ******************************************************************************
+  * @file           : spi_link.c
+  * @brief          : SPI slave transport for the framed host protocol
+  ******************************************************************************
+  * For a board next to an application processor, which is the SPI master.
+  * Frames are byte for byte the ones USART2 carries:
+  *
+  *   SPI2 slave, mode 0, 8 bit MSB first, up to PCLK1 / 2
+  *   PB12 NSS, PB13 SCK, PB14 MISO, PB15 MOSI (AF5)
+  *   PB1  DRDY, push-pull output, high while a reply waits to be clocked out
+  *
+  * MOSI runs as circular DMA into a ring that is parsed from the main loop,
+  * like USART2 RX; the DMA half/full events and the end of every transfer
+  * (NSS rising) wake it. Bytes outside a frame are skipped, so the master
+  * clocks a reply out with zeros or with its next request, the two
+  * directions are independent. A reply goes out by one-shot TX DMA: on
+  * DRDY the master reads the 6 byte header, then len + 4 more bytes. The
+  * next reply waits, up to the caller's timeout, until that one has been
+  * taken. As on USB, a request arriving while both frame slots are busy is
+  * answered BUSY, so the master keeps at most two outstanding.
+  *
+  * The SPI registers are driven directly, only the HAL DMA and GPIO
+  * drivers are needed, not the ioc or the HAL SPI module.
+  ******************************************************************************
+  */
+
+#include "spi_link.h"
+
+#if APP_SPI_LINK
+
+#include "main.h"
+#include <string.h>
+
+// The ring must hold what arrives while the main loop is in an inference:
+// with both slots busy, one full size CLASSIFY_CROP frame
+#define SPI_LINK_RX_SIZE        4096U
+// Largest reply main.c encodes (TX_MAX_PAYLOAD)
+#define SPI_LINK_TX_SIZE        (PROTO_MAX_REPLY + PROTO_OVERHEAD)
+
+#define SPI_LINK_DRDY_PORT      GPIOB
+#define SPI_LINK_DRDY_PIN       GPIO_PIN_1
+
+static DMA_HandleTypeDef hdma_spi2_rx;
+static DMA_HandleTypeDef hdma_spi2_tx;
+
+static ProtoParser_t *spi_parser = NULL;
+static void (*spi_notify)(void) = NULL;
+static void (*spi_release)(ProtoFrame_t *frame) = NULL;
+
+static uint8_t spi_rx[SPI_LINK_RX_SIZE];
+static volatile uint32_t spi_rx_halves = 0;    // ISR: half rings DMA has completed
+static volatile uint8_t spi_restart = 0;       // ISR: RX DMA stopped on an error
+static uint32_t spi_rx_read = 0;               // main: bytes consumed
+static uint16_t spi_rx_tail = 0;               // main: next index to parse
+
+static uint8_t spi_tx[SPI_LINK_TX_SIZE];
+static volatile uint8_t spi_tx_busy = 0;       // reply armed, not yet clocked out
+
+/**
+  * @brief RX DMA half or full ring: account for it and wake the parser
+  */
+static void SPI_Link_RxEvent(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  spi_rx_halves++;
+  if (spi_notify)
+  {
+    spi_notify();
+  }
+}
+
+/**
+  * @brief RX DMA error, the stream is disabled: restarted from SPI_Link_Poll
+  */
+static void SPI_Link_RxError(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  spi_restart = 1;
+  if (spi_notify)
+  {
+    spi_notify();
+  }
+}
+
+/**
+  * @brief TX DMA done: the last reply byte is in the data register, DRDY drops
+  */
+static void SPI_Link_TxDone(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  CLEAR_BIT(SPI2->CR2, SPI_CR2_TXDMAEN);
+  HAL_GPIO_WritePin(SPI_LINK_DRDY_PORT, SPI_LINK_DRDY_PIN, GPIO_PIN_RESET);
+  spi_tx_busy = 0;
+}
+
+/**
+  * @brief Bytes DMA has written into the ring since reception started
+  */
+static uint32_t SPI_Link_Written(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t base, pos;
+
+  __disable_irq();
+  base = spi_rx_halves * (SPI_LINK_RX_SIZE / 2U);
+  pos = SPI_LINK_RX_SIZE - __HAL_DMA_GET_COUNTER(&hdma_spi2_rx);
+  __set_PRIMASK(primask);
+
+  // A half ring not yet counted shows in pos, as less than a full lap
+  return base + (pos + SPI_LINK_RX_SIZE - base % SPI_LINK_RX_SIZE) % SPI_LINK_RX_SIZE;
+}
+
+/**
+  * @brief Arm the RX DMA ring from its start and enable SPI2
+  */
+static void SPI_Link_StartReception(void)
+{
+  spi_rx_halves = 0;
+  spi_rx_read = 0;
+  spi_rx_tail = 0;
+  spi_restart = 0;
+
+  HAL_DMA_Start_IT(&hdma_spi2_rx, (uint32_t)&SPI2->DR, (uint32_t)spi_rx, SPI_LINK_RX_SIZE);
+  SET_BIT(SPI2->CR2, SPI_CR2_RXDMAEN);
+  SET_BIT(SPI2->CR1, SPI_CR1_SPE);
+}
+
+/**
+  * @brief Drop the frame being parsed and resync on the following bytes
+  */
+static void SPI_Link_Resync(void)
+{
+  if (spi_parser->frame && spi_release)
+  {
+    spi_release(spi_parser->frame);
+  }
+  Proto_ParserReset(spi_parser);
+}
+
+/**
+  * @brief Stop both directions after an overrun or DMA error and start over
+  */
+static void SPI_Link_Restart(void)
+{
+  CLEAR_BIT(SPI2->CR1, SPI_CR1_SPE);
+  CLEAR_BIT(SPI2->CR2, SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+  HAL_DMA_Abort(&hdma_spi2_rx);
+  HAL_DMA_Abort(&hdma_spi2_tx);
+  HAL_GPIO_WritePin(SPI_LINK_DRDY_PORT, SPI_LINK_DRDY_PIN, GPIO_PIN_RESET);
+  spi_tx_busy = 0;
+
+  // DR then SR read clears OVR
+  (void)SPI2->DR;
+  (void)SPI2->SR;
+
+  SPI_Link_Resync();
+  SPI_Link_StartReception();
+}
+
+/**
+  * @brief Set up SPI2 as slave with its DMA streams, DRDY and the NSS interrupt
+  * @param parser fed from SPI_Link_Poll
+  * @param notify called from interrupts when bytes are waiting, may be NULL
+  * @param release frees the slot of a frame cut short, may be NULL
+  * @note  Call after MX_DMA_Init, which enables the DMA1 clock
+  */
+void SPI_Link_Init(ProtoParser_t *parser, void (*notify)(void), void (*release)(ProtoFrame_t *frame))
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  spi_parser = parser;
+  spi_notify = notify;
+  spi_release = release;
+  Proto_ParserReset(parser);
+
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  __HAL_RCC_SPI2_CLK_ENABLE();
+  __HAL_RCC_SYSCFG_CLK_ENABLE();
+
+  /**SPI2 GPIO Configuration
+  PB12     ------> SPI2_NSS
+  PB13     ------> SPI2_SCK
+  PB14     ------> SPI2_MISO
+  PB15     ------> SPI2_MOSI
+  */
+  GPIO_InitStruct.Pin = GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  GPIO_InitStruct.Alternate = GPIO_AF5_SPI2;
+  HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+
+  HAL_GPIO_WritePin(SPI_LINK_DRDY_PORT, SPI_LINK_DRDY_PIN, GPIO_PIN_RESET);
+  GPIO_InitStruct.Pin = SPI_LINK_DRDY_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+  GPIO_InitStruct.Alternate = 0;
+  HAL_GPIO_Init(SPI_LINK_DRDY_PORT, &GPIO_InitStruct);
+
+  // NSS rising (end of a transfer) on EXTI12; the pin stays on SPI2, its
+  // input path feeds EXTI in any mode
+  MODIFY_REG(SYSCFG->EXTICR[3], SYSCFG_EXTICR4_EXTI12, SYSCFG_EXTICR4_EXTI12_PB);
+  SET_BIT(EXTI->RTSR, EXTI_RTSR_TR12);
+  CLEAR_BIT(EXTI->FTSR, EXTI_FTSR_TR12);
+  EXTI->PR = EXTI_PR_PR12;
+  SET_BIT(EXTI->IMR, EXTI_IMR_MR12);
+
+  /* SPI2_RX Init */
+  hdma_spi2_rx.Instance = DMA1_Stream3;
+  hdma_spi2_rx.Init.Channel = DMA_CHANNEL_0;
+  hdma_spi2_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_spi2_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_spi2_rx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_spi2_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_spi2_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_spi2_rx.Init.Mode = DMA_CIRCULAR;
+  hdma_spi2_rx.Init.Priority = DMA_PRIORITY_HIGH;
+  hdma_spi2_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_spi2_rx) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  hdma_spi2_rx.XferHalfCpltCallback = SPI_Link_RxEvent;
+  hdma_spi2_rx.XferCpltCallback = SPI_Link_RxEvent;
+  hdma_spi2_rx.XferErrorCallback = SPI_Link_RxError;
+
+  /* SPI2_TX Init */
+  hdma_spi2_tx.Instance = DMA1_Stream4;
+  hdma_spi2_tx.Init.Channel = DMA_CHANNEL_0;
+  hdma_spi2_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_spi2_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_spi2_tx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_spi2_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_spi2_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_spi2_tx.Init.Mode = DMA_NORMAL;
+  hdma_spi2_tx.Init.Priority = DMA_PRIORITY_MEDIUM;
+  hdma_spi2_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_spi2_tx) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  hdma_spi2_tx.XferCpltCallback = SPI_Link_TxDone;
+
+  // Slave, mode 0, 8 bit MSB first, hardware NSS: all zero in CR1
+  SPI2->CR1 = 0;
+  SPI2->CR2 = 0;
+
+  // USART2's priority, so the parsers never preempt each other claiming slots
+  HAL_NVIC_SetPriority(DMA1_Stream3_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream3_IRQn);
+  HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
+  HAL_NVIC_SetPriority(EXTI15_10_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+
+  SPI_Link_StartReception();
+}
+
+/**
+  * @brief Feed the bytes DMA has written since the last call to the parser
+  */
+void SPI_Link_Poll(void)
+{
+  uint32_t written, avail;
+
+  if (!spi_parser)
+  {
+    return;
+  }
+
+  if (spi_restart || (SPI2->SR & SPI_SR_OVR))
+  {
+    SPI_Link_Restart();
+    return;
+  }
+
+  written = SPI_Link_Written();
+  avail = written - spi_rx_read;
+  if (avail > SPI_LINK_RX_SIZE)
+  {
+    // DMA lapped the parser, the unread bytes are gone
+    SPI_Link_Resync();
+    spi_rx_read = written;
+    spi_rx_tail = (uint16_t)(written % SPI_LINK_RX_SIZE);
+    return;
+  }
+
+  while (avail > 0)
+  {
+    uint16_t n = SPI_LINK_RX_SIZE - spi_rx_tail;
+    if (n > avail)
+    {
+      n = (uint16_t)avail;
+    }
+
+    n = Proto_Parse(spi_parser, &spi_rx[spi_rx_tail], n);
+    spi_rx_read += n;
+    spi_rx_tail = (uint16_t)((spi_rx_tail + n) % SPI_LINK_RX_SIZE);
+    avail -= n;
+  }
+}
+
+/**
+  * @brief Whether received bytes are waiting for SPI_Link_Poll
+  */
+uint8_t SPI_Link_Pending(void)
+{
+  return spi_parser && (spi_restart || SPI_Link_Written() != spi_rx_read);
+}
+
+/**
+  * @brief Arm a reply for the master to clock out and raise DRDY
+  * @note  Waits while the previous reply has not been taken
+  * @retval 0 on success, -1 if the master did not read within timeout
+  */
+int SPI_Link_Transmit(const uint8_t *data, uint16_t len, uint32_t timeout)
+{
+  uint32_t start = HAL_GetTick();
+
+  if (len > sizeof(spi_tx))
+  {
+    return -1;
+  }
+
+  while (spi_tx_busy)
+  {
+    if (HAL_GetTick() - start > timeout)
+    {
+      return -1;
+    }
+  }
+
+  memcpy(spi_tx, data, len);
+  spi_tx_busy = 1;
+  if (HAL_DMA_Start_IT(&hdma_spi2_tx, (uint32_t)spi_tx, (uint32_t)&SPI2->DR, len) != HAL_OK)
+  {
+    spi_tx_busy = 0;
+    return -1;
+  }
+  // TXE is set, the first byte goes into DR at once
+  SET_BIT(SPI2->CR2, SPI_CR2_TXDMAEN);
+  HAL_GPIO_WritePin(SPI_LINK_DRDY_PORT, SPI_LINK_DRDY_PIN, GPIO_PIN_SET);
+  return 0;
+}
+
+/**
+  * @brief DMA1 stream 3 (SPI2_RX) interrupt
+  */
+void SPI_Link_RxDmaIRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_spi2_rx);
+}
+
+/**
+  * @brief DMA1 stream 4 (SPI2_TX) interrupt
+  */
+void SPI_Link_TxDmaIRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_spi2_tx);
+}
+
+/**
+  * @brief EXTI line 12: NSS went high, the master finished a transfer
+  */
+void SPI_Link_NssIRQHandler(void)
+{
+  if (EXTI->PR & EXTI_PR_PR12)
+  {
+    EXTI->PR = EXTI_PR_PR12;
+    if (spi_notify)
+    {
+      spi_notify();
+    }
+  }
+}
+
+#endif /* APP_SPI_LINK */
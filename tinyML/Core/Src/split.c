@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * @file           : split.c
+  * @brief          : One stage of the active network, split at a c-node boundary
+  ******************************************************************************
+  */
+
+#include "split.h"
+#include "protocol.h"
+#include "models.h"
+#include "kernels.h"
+#include "ai_layer_custom_interface.h"
+
+#if APP_SPLIT
+// c-nodes of the other stage and the forwards they had
+static ai_node *split_nodes[MODEL_MAX_NODES];
+static node_func split_saved[MODEL_MAX_NODES];
+static uint8_t split_count;
+
+/**
+  * @brief Forward of a c-node the stage does not run
+  */
+static void Split_Skip(ai_node *node)
+{
+  (void)node;
+}
+
+/**
+  * @brief Leave only the c-nodes of one stage to run
+  * @param stage PROTO_STAGE_FRONT: c-nodes [0, split), PROTO_STAGE_BACK: the rest
+  * @param boundary gets the tensor FRONT leaves and BACK starts from
+  * @note  Split_End() puts the other stage back, after the run
+  * @retval boundary bytes, -1 if the network cannot be split there
+  */
+int Split_Begin(ai_handle network, uint8_t stage, uint8_t split, int8_t **boundary)
+{
+  ai_network *net = AI_NETWORK_ACQUIRE_CTX(network);
+  ai_node *node = net ? net->input_node : NULL;
+  ai_tensor *out = NULL, *in = NULL;
+  uint32_t n;
+
+  split_count = 0;
+  for (n = 0; node && n < MODEL_MAX_NODES; n++)
+  {
+    if (n + 1U == split)
+    {
+      out = ai_layer_get_tensor_out((ai_layer *)node, 0);
+    }
+    else if (n == split)
+    {
+      in = ai_layer_get_tensor_in((ai_layer *)node, 0);
+    }
+    // The last layer links to itself
+    node = (node->next == node) ? NULL : node->next;
+  }
+
+  // A linear cut only: what the front leaves is exactly what the back reads
+  if (split == 0 || split >= n || !out || !in ||
+      ai_tensor_get_data(out).s8 != ai_tensor_get_data(in).s8 ||
+      ai_tensor_get_data_byte_size(out) > PROTO_STAGE_MAX)
+  {
+    return -1;
+  }
+
+  node = net->input_node;
+  for (n = 0; node && n < MODEL_MAX_NODES; n++)
+  {
+    if ((stage == PROTO_STAGE_FRONT) == (n >= split))
+    {
+      split_nodes[split_count] = node;
+      split_saved[split_count++] = node->forward;
+      node->forward = AI_NODE_FUNC(Split_Skip);
+    }
+    node = (node->next == node) ? NULL : node->next;
+  }
+
+#if APP_KERNEL_INCREMENTAL
+  // The boundary written over the conv output no longer matches the cached input
+  if (stage == PROTO_STAGE_BACK)
+  {
+    Kernel_Invalidate();
+  }
+#endif
+
+  *boundary = ai_tensor_get_data(out).s8;
+  return (int)ai_tensor_get_data_byte_size(out);
+}
+
+/**
+  * @brief Give the c-nodes Split_Begin() parked their forwards back
+  */
+void Split_End(void)
+{
+  while (split_count)
+  {
+    split_count--;
+    split_nodes[split_count]->forward = split_saved[split_count];
+  }
+}
+#endif /* APP_SPLIT */
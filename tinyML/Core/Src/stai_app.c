@@ -0,0 +1,138 @@
+/**
+  ******************************************************************************
+  * @file           : stai_app.c
+  * @brief          : ST Edge AI run and event model over the bound network (APP_STAI)
+  ******************************************************************************
+  */
+
+#include "stai_app.h"
+#include "main.h"
+
+#if APP_STAI
+#include "ai_platform_interface.h"
+#include "core_common.h"
+
+static stai_event_cb stai_cb;
+static void *stai_cookie;
+static volatile stai_return_code stai_state = STAI_SUCCESS;
+static stai_ptr stai_buffers[STAI_APP_NODE_BUFFERS];
+
+/**
+  * @brief Start the ST Edge AI runtime, once at boot
+  */
+stai_return_code StaiApp_Init(void)
+{
+  stai_runtime_info info;
+  stai_return_code rc = stai_runtime_init();
+
+  if (rc != STAI_SUCCESS)
+  {
+    return rc;
+  }
+  // The headers in the tree must match the library they are linked with
+  rc = stai_runtime_get_info(&info);
+  if (rc == STAI_SUCCESS && info.api_version.major != STAI_API_VERSION_MAJOR)
+  {
+    rc = STAI_ERROR_NETWORK_INVALID_RUNTIME;
+  }
+  return rc;
+}
+
+/**
+  * @brief Node events go to cb from now on, NULL stops them
+  * @note  Called from the run's context: the main loop, or PendSV under
+  *        APP_AI_ASYNC
+  */
+stai_return_code StaiApp_SetCallback(stai_event_cb cb, void *cookie)
+{
+  if (stai_state == STAI_RUNNING_NO_WFE)
+  {
+    return STAI_ERROR_NETWORK_STILL_RUNNING;
+  }
+  stai_cookie = cookie;
+  stai_cb = cb;
+  return STAI_SUCCESS;
+}
+
+/**
+  * @brief Observer PRE or POST event of a c-node, as a stai node event
+  */
+void StaiApp_NodeEvent(uint32_t flags, const struct ai_observer_node_s *node)
+{
+  stai_event_node_start_stop event;
+  const ai_tensor_list *list;
+  uint32_t chain = (flags & AI_OBSERVER_PRE_EVT) ? AI_TENSOR_CHAIN_INPUT : AI_TENSOR_CHAIN_OUTPUT;
+  stai_size n = 0;
+
+  if (!stai_cb || !(flags & (AI_OBSERVER_PRE_EVT | AI_OBSERVER_POST_EVT)))
+  {
+    return;
+  }
+
+  list = (node->tensors && chain < node->tensors->size) ? &node->tensors->chain[chain] : NULL;
+  for (ai_size i = 0; i < GET_TENSOR_LIST_SIZE(list) && n < STAI_APP_NODE_BUFFERS; i++)
+  {
+    ai_tensor *t = GET_TENSOR_LIST_ITEM(list, i);
+
+    if (t && t->data)
+    {
+      stai_buffers[n++] = (stai_ptr)t->data->data;
+    }
+  }
+  event.node_id = node->c_idx;
+  event.buffers.size = n;
+  event.buffers.data = stai_buffers;
+  stai_cb(stai_cookie, (flags & AI_OBSERVER_PRE_EVT) ? STAI_EVENT_NODE_START : STAI_EVENT_NODE_STOP,
+          &event);
+}
+
+#if APP_AI_ASYNC
+/**
+  * @brief PendSV: the submitted run finished
+  */
+static void StaiApp_Done(int status)
+{
+  stai_state = (status == 0) ? STAI_DONE : STAI_ERROR_NETWORK_INVALID_RUN;
+}
+#endif
+
+/**
+  * @brief Run the bound network on AI_InputBuffer into AI_OutputBuffer
+  * @retval STAI_DONE after a synchronous run, STAI_RUNNING_NO_WFE once an
+  *         asynchronous one is submitted, an error otherwise
+  */
+stai_return_code StaiApp_Run(stai_run_mode mode)
+{
+  if (stai_state == STAI_RUNNING_NO_WFE)
+  {
+    return STAI_ERROR_NETWORK_STILL_RUNNING;
+  }
+
+  if (mode == STAI_MODE_ASYNC)
+  {
+#if APP_AI_ASYNC
+    stai_state = STAI_RUNNING_NO_WFE;
+    if (AI_RunAsync(StaiApp_Done) != 0)
+    {
+      stai_state = STAI_ERROR_NETWORK_STILL_RUNNING;
+    }
+    return stai_state;
+#else
+    // Nothing to run it under: the main loop is the only context
+    return STAI_ERROR_NOT_IMPLEMENTED;
+#endif
+  }
+
+  stai_state = (AI_Run() == 0) ? STAI_DONE : STAI_ERROR_NETWORK_INVALID_RUN;
+  return stai_state;
+}
+
+/**
+  * @brief State of the last run, polled after an asynchronous submission
+  * @retval STAI_RUNNING_NO_WFE while in flight, then STAI_DONE or the error
+  */
+stai_return_code StaiApp_Wait(void)
+{
+  return stai_state;
+}
+#endif /* APP_STAI */
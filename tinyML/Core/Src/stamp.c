@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file           : stamp.c
+  * @brief          : Device timestamps on replies, for latency attribution
+  ******************************************************************************
+  */
+
+#include "stamp.h"
+#include "main.h"
+#include "profile.h"
+#include <string.h>
+
+#if APP_TIMESTAMPS
+static uint8_t stamp_on = 0;           // PROTO_SYNC_STAMP set by the last CLOCK_SYNC
+static uint8_t stamp_active = 0;       // a frame is being processed
+static uint8_t stamp_seq = 0;          // ... with this seq
+static ProtoStamp_t stamp;
+static uint32_t stamp_run_start = 0;   // DWT at the current run's start
+static uint32_t stamp_run_cycles = 0;  // of the runs for the frame so far
+
+// The reply with its trailer, framed from here
+static uint8_t stamp_reply[PROTO_MAX_REPLY] __attribute__((aligned(4)));
+
+/**
+  * @brief Microseconds since reset, modulo 2^32 (any context)
+  * @note  Assumes the default 1 kHz HAL tick
+  */
+uint32_t Stamp_Us(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t load, ms, val;
+
+  __disable_irq();
+  load = SysTick->LOAD;
+  ms = HAL_GetTick();
+  val = SysTick->VAL;
+  // Wrapped, but not counted yet: masked here, or the caller outranks
+  // SysTick. Read again, after the wrap for sure
+  if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+  {
+    val = SysTick->VAL;
+    ms++;
+  }
+  __set_PRIMASK(primask);
+
+  return ms * 1000U + (load - val) * 1000U / (load + 1U);
+}
+
+/**
+  * @brief Start stamping the frame with seq, whose last byte arrived at rx_us
+  */
+void Stamp_Begin(uint8_t seq, uint32_t rx_us)
+{
+  stamp.rx_us = rx_us;
+  stamp.start_us = Stamp_Us();
+  stamp_run_cycles = 0;
+  stamp_seq = seq;
+  stamp_active = 1;
+}
+
+/**
+  * @brief The frame is done, later replies are not its
+  */
+void Stamp_End(void)
+{
+  stamp_active = 0;
+}
+
+void Stamp_RunBegin(void)
+{
+  stamp_run_start = PROF_CYCLES();
+}
+
+void Stamp_RunEnd(void)
+{
+  stamp_run_cycles += PROF_CYCLES() - stamp_run_start;
+}
+
+/**
+  * @brief Fill a CLOCK_SYNC reply, and apply its PROTO_SYNC_* flags if given
+  * @note  tx_us is taken last, as close to framing as this gets
+  */
+void Stamp_Sync(ProtoClockSync_t *reply, const uint8_t *flags)
+{
+  if (flags)
+  {
+    stamp_on = (*flags & PROTO_SYNC_STAMP) ? 1U : 0U;
+  }
+  memset(reply, 0, sizeof(*reply));
+  reply->rx_us = stamp.rx_us;
+  reply->cpu_hz = HAL_RCC_GetHCLKFreq();
+  reply->flags = stamp_on ? PROTO_SYNC_STAMP : 0U;
+  reply->tx_us = Stamp_Us();
+}
+
+/**
+  * @brief The payload to frame for a reply: with the trailer when it is stamped
+  * @note  Sets PROTO_STAMP_FLAG in type and grows len then
+  */
+const void *Stamp_Reply(uint8_t *type, uint8_t seq, const void *payload, uint16_t *len)
+{
+  uint32_t hz;
+
+  if (!stamp_on || !stamp_active || seq != stamp_seq || *type == PROTO_TYPE_ERROR ||
+      *len > sizeof(stamp_reply) - sizeof(ProtoStamp_t))
+  {
+    return payload;
+  }
+  hz = HAL_RCC_GetHCLKFreq() / 1000000U;
+  stamp.run_us = hz ? stamp_run_cycles / hz : 0U;
+  stamp.tx_us = Stamp_Us();
+  if (*len)
+  {
+    memcpy(stamp_reply, payload, *len);
+  }
+  memcpy(&stamp_reply[*len], &stamp, sizeof(stamp));
+  *len += sizeof(ProtoStamp_t);
+  *type |= PROTO_STAMP_FLAG;
+  return stamp_reply;
+}
+#endif /* APP_TIMESTAMPS */
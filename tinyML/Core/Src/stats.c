@@ -0,0 +1,149 @@
+/**
+  ******************************************************************************
+  * @file           : stats.c
+  * @brief          : Runtime counters and cycle histograms (STATS)
+  ******************************************************************************
+  */
+
+#include "stats.h"
+#include "boot.h"
+#include "load.h"
+#include "main.h"
+#include "profile.h"
+#include <string.h>
+
+// Counters are also bumped from the RX and USB interrupts
+static uint32_t stats_counters[STATS_COUNTERS];
+static uint16_t stats_hist[STATS_HISTS][PROTO_STATS_BUCKETS];
+static uint32_t stats_since = 0;
+
+/**
+  * @brief Start the cycle counter the histograms read and zero everything
+  */
+void Stats_Init(void)
+{
+  Prof_Init();
+  Stats_Get(NULL, 1);
+}
+
+/**
+  * @brief Count one event (any context)
+  */
+void Stats_Count(StatsCounter_t counter)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  stats_counters[counter]++;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief Add a duration to its log2 histogram (any context)
+  */
+void Stats_Cycles(StatsHist_t hist, uint32_t cycles)
+{
+  uint32_t bucket = 31U - __CLZ(cycles | 1U);
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (stats_hist[hist][bucket] != UINT16_MAX)
+  {
+    stats_hist[hist][bucket]++;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief Copy the counters out, then optionally zero them
+  * @param stats reply to fill, NULL to only reset
+  */
+void Stats_Get(ProtoStats_t *stats, uint8_t reset)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t load_ms;
+  uint16_t load[PROTO_LOAD_SHARES];
+
+  __disable_irq();
+  if (stats)
+  {
+    stats->cpu_hz = HAL_RCC_GetHCLKFreq();
+    stats->uptime_ms = HAL_GetTick() - stats_since;
+    stats->frames = stats_counters[STATS_FRAMES];
+    stats->inferences = stats_counters[STATS_INFERENCES];
+    stats->err_inference = stats_counters[STATS_ERR_INFERENCE];
+    stats->err_crc = stats_counters[STATS_ERR_CRC];
+    stats->err_dropped = stats_counters[STATS_ERR_DROPPED];
+    stats->uart_overrun = stats_counters[STATS_UART_OVERRUN];
+    stats->uart_framing = stats_counters[STATS_UART_FRAMING];
+    stats->uart_noise = stats_counters[STATS_UART_NOISE];
+    stats->events_lost = stats_counters[STATS_EVENTS_LOST];
+    stats->boots = Boot_Count();
+    stats->warm_boots = Boot_WarmCount();
+    stats->reset_cause = Boot_ResetCause();
+    stats->last_fault = Boot_LastFault();
+    stats->reserved[0] = 0;
+    stats->reserved[1] = 0;
+    stats->boot_cycles = Boot_ReadyCycles();
+    stats->boot_hsi_cycles = Boot_HsiCycles();
+    memcpy(stats->run_hist, stats_hist[STATS_HIST_RUN], sizeof(stats->run_hist));
+    memcpy(stats->frame_hist, stats_hist[STATS_HIST_FRAME], sizeof(stats->frame_hist));
+    // Through locals, the packed reply's fields take no pointers
+    Load_Get(&load_ms, load, 0);
+    stats->load_ms = load_ms;
+    memcpy(stats->load, load, sizeof(stats->load));
+  }
+  if (reset)
+  {
+    memset(stats_counters, 0, sizeof(stats_counters));
+    memset(stats_hist, 0, sizeof(stats_hist));
+    stats_since = HAL_GetTick();
+    Load_Get(NULL, NULL, 1);
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief Copy the counters and the run histogram out at one instant
+  * @param counters STATS_COUNTERS entries
+  * @param run_hist PROTO_STATS_BUCKETS entries
+  */
+void Stats_Snapshot(uint32_t *counters, uint16_t *run_hist)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  memcpy(counters, stats_counters, sizeof(stats_counters));
+  memcpy(run_hist, stats_hist[STATS_HIST_RUN], sizeof(stats_hist[STATS_HIST_RUN]));
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief Errors of every kind counted, STATS_ERR_INFERENCE to STATS_EVENTS_LOST
+  */
+uint32_t Stats_Errors(void)
+{
+  uint32_t sum = 0;
+  uint8_t k;
+
+  // Word reads are atomic, a count bumped meanwhile shows next time
+  for (k = STATS_ERR_INFERENCE; k < STATS_COUNTERS; k++)
+  {
+    sum += stats_counters[k];
+  }
+  return sum;
+}
+
+/**
+  * @brief Network runs of at least 2^bucket cycles, saturated buckets as they stand
+  */
+uint32_t Stats_RunsFrom(uint8_t bucket)
+{
+  uint32_t sum = 0;
+
+  for (; bucket < PROTO_STATS_BUCKETS; bucket++)
+  {
+    sum += stats_hist[STATS_HIST_RUN][bucket];
+  }
+  return sum;
+}
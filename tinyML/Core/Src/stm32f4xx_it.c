@@ -22,6 +22,13 @@
 #include "stm32f4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "boot.h"
+#include "spi_link.h"
+#include "uart_link.h"
+#include "dma_copy.h"
+#include "irqlat.h"
+#include "load.h"
+#include "host_uart.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -55,6 +62,8 @@
 /* USER CODE END 0 */
 
 /* External variables --------------------------------------------------------*/
+extern DMA_HandleTypeDef hdma_usart2_rx;
+extern DMA_HandleTypeDef hdma_usart2_tx;
 extern UART_HandleTypeDef huart2;
 /* USER CODE BEGIN EV */
 
@@ -84,7 +93,8 @@ void NMI_Handler(void)
 void HardFault_Handler(void)
 {
   /* USER CODE BEGIN HardFault_IRQn 0 */
-
+  // Restarts in milliseconds with APP_WATCHDOG_MS, halts here otherwise
+  Boot_Fail(PROTO_FAULT_HARD);
   /* USER CODE END HardFault_IRQn 0 */
   while (1)
   {
@@ -170,6 +180,8 @@ void DebugMon_Handler(void)
 void PendSV_Handler(void)
 {
   /* USER CODE BEGIN PendSV_IRQn 0 */
+  // Inference submitted by AI_RunAsync, below every peripheral interrupt
+  AI_RunPending();
 
   /* USER CODE END PendSV_IRQn 0 */
   /* USER CODE BEGIN PendSV_IRQn 1 */
@@ -187,6 +199,9 @@ void SysTick_Handler(void)
   /* USER CODE END SysTick_IRQn 0 */
   HAL_IncTick();
   /* USER CODE BEGIN SysTick_IRQn 1 */
+#if APP_LOAD
+  Load_Tick();
+#endif
 
   /* USER CODE END SysTick_IRQn 1 */
 }
@@ -198,20 +213,221 @@ void SysTick_Handler(void)
 /* please refer to the startup file (startup_stm32f4xx.s).                    */
 /******************************************************************************/
 
+/**
+  * @brief This function handles DMA1 stream5 global interrupt.
+  */
+void DMA1_Stream5_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Stream5_IRQn 0 */
+  LOAD_BEGIN();
+  UART_ISR_ENTER();
+#if APP_UART_LL
+  UART_LL_RxDmaIRQHandler();
+#else
+  /* USER CODE END DMA1_Stream5_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_usart2_rx);
+  /* USER CODE BEGIN DMA1_Stream5_IRQn 1 */
+#endif
+  UART_ISR_EXIT();
+  LOAD_END(PROTO_LOAD_DMA);
+  /* USER CODE END DMA1_Stream5_IRQn 1 */
+}
+
+/**
+  * @brief This function handles DMA1 stream6 global interrupt.
+  */
+void DMA1_Stream6_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Stream6_IRQn 0 */
+  LOAD_BEGIN();
+  UART_ISR_ENTER();
+#if APP_UART_LL
+  UART_LL_TxDmaIRQHandler();
+#else
+  /* USER CODE END DMA1_Stream6_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_usart2_tx);
+  /* USER CODE BEGIN DMA1_Stream6_IRQn 1 */
+#endif
+  UART_ISR_EXIT();
+  LOAD_END(PROTO_LOAD_DMA);
+  /* USER CODE END DMA1_Stream6_IRQn 1 */
+}
+
 /**
   * @brief This function handles USART2 global interrupt.
   */
 void USART2_IRQHandler(void)
 {
   /* USER CODE BEGIN USART2_IRQn 0 */
-
+  LOAD_BEGIN();
+  UART_ISR_ENTER();
+#if APP_UART_LL
+  UART_LL_IRQHandler();
+#else
   /* USER CODE END USART2_IRQn 0 */
   HAL_UART_IRQHandler(&huart2);
   /* USER CODE BEGIN USART2_IRQn 1 */
-
+#endif
+  UART_ISR_EXIT();
+  LOAD_END(PROTO_LOAD_USART);
   /* USER CODE END USART2_IRQn 1 */
 }
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles EXTI line3 interrupt (USART2 RX wake-up from STOP).
+  */
+void EXTI3_IRQHandler(void)
+{
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_3);
+}
+
+#if APP_SPI_LINK
+/**
+  * @brief This function handles DMA1 stream3 global interrupt (SPI2_RX).
+  */
+void DMA1_Stream3_IRQHandler(void)
+{
+  LOAD_BEGIN();
+  SPI_Link_RxDmaIRQHandler();
+  LOAD_END(PROTO_LOAD_DMA);
+}
+
+/**
+  * @brief This function handles DMA1 stream4 global interrupt (SPI2_TX).
+  */
+void DMA1_Stream4_IRQHandler(void)
+{
+  LOAD_BEGIN();
+  SPI_Link_TxDmaIRQHandler();
+  LOAD_END(PROTO_LOAD_DMA);
+}
+
+/**
+  * @brief This function handles EXTI lines 10 to 15 (SPI2 NSS released).
+  */
+void EXTI15_10_IRQHandler(void)
+{
+  SPI_Link_NssIRQHandler();
+}
+#endif
+
+#if APP_HOST_UART != 2
+/*
+ * The host link on USART1 or USART6 (host_uart.c). It still runs through
+ * huart2 and hdma_usart2_rx/_tx, so the generated USART2 handlers above
+ * serve it as they are.
+ */
+
+/**
+  * @brief This function handles the host link's USART global interrupt.
+  */
+void HOST_USART_IRQHandler(void)
+{
+  USART2_IRQHandler();
+}
+
+/**
+  * @brief This function handles the host link's RX stream global interrupt.
+  */
+void HOST_DMA_RX_IRQHandler(void)
+{
+  DMA1_Stream5_IRQHandler();
+}
+
+/**
+  * @brief This function handles the host link's TX stream global interrupt.
+  */
+void HOST_DMA_TX_IRQHandler(void)
+{
+  DMA1_Stream6_IRQHandler();
+}
+#endif
+
+#if APP_UART_LINKS
+/**
+  * @brief This function handles USART1 global interrupt.
+  */
+void USART1_IRQHandler(void)
+{
+  LOAD_BEGIN();
+  UART_Link_IRQHandler(UART_LINK_USART1);
+  LOAD_END(PROTO_LOAD_USART);
+}
+
+/**
+  * @brief This function handles USART6 global interrupt.
+  */
+void USART6_IRQHandler(void)
+{
+  LOAD_BEGIN();
+  UART_Link_IRQHandler(UART_LINK_USART6);
+  LOAD_END(PROTO_LOAD_USART);
+}
+
+/**
+  * @brief This function handles DMA2 stream2 global interrupt (USART1_RX).
+  */
+void DMA2_Stream2_IRQHandler(void)
+{
+  LOAD_BEGIN();
+  UART_Link_RxDmaIRQHandler(UART_LINK_USART1);
+  LOAD_END(PROTO_LOAD_DMA);
+}
+
+/**
+  * @brief This function handles DMA2 stream7 global interrupt (USART1_TX).
+  */
+void DMA2_Stream7_IRQHandler(void)
+{
+  LOAD_BEGIN();
+  UART_Link_TxDmaIRQHandler(UART_LINK_USART1);
+  LOAD_END(PROTO_LOAD_DMA);
+}
+
+/**
+  * @brief This function handles DMA2 stream1 global interrupt (USART6_RX).
+  */
+void DMA2_Stream1_IRQHandler(void)
+{
+  LOAD_BEGIN();
+  UART_Link_RxDmaIRQHandler(UART_LINK_USART6);
+  LOAD_END(PROTO_LOAD_DMA);
+}
+
+/**
+  * @brief This function handles DMA2 stream6 global interrupt (USART6_TX).
+  */
+void DMA2_Stream6_IRQHandler(void)
+{
+  LOAD_BEGIN();
+  UART_Link_TxDmaIRQHandler(UART_LINK_USART6);
+  LOAD_END(PROTO_LOAD_DMA);
+}
+#endif
+
+#if APP_DMA_COPY
+/**
+  * @brief This function handles DMA2 stream3 global interrupt (memory copies).
+  */
+void DMA2_Stream3_IRQHandler(void)
+{
+  LOAD_BEGIN();
+  DmaCopy_IRQHandler();
+  LOAD_END(PROTO_LOAD_DMA);
+}
+#endif
+
+#if APP_IRQ_LATENCY
+/**
+  * @brief This function handles TIM2 global interrupt (RX latency arrivals).
+  * @note  Not a load span: the latency is read on entry
+  */
+void TIM2_IRQHandler(void)
+{
+  IrqLat_IRQHandler();
+}
+#endif
+
 /* USER CODE END 1 */
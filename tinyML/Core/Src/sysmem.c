@@ -23,7 +23,9 @@
 /* Includes */
 #include <errno.h>
 #include <stdint.h>
+#include "app_config.h"
 
+#if !APP_NO_HEAP
 /**
  * Pointer to the current high watermark of the heap usage
  */
@@ -77,3 +79,14 @@ void *_sbrk(ptrdiff_t incr)
 
   return (void *)prev_heap_end;
 }
+#else
+/**
+ * @brief APP_NO_HEAP: nothing may allocate, any call traps (UDF -> HardFault)
+ *        with the caller, malloc or newlib stdio, on the stack
+ */
+void *_sbrk(ptrdiff_t incr)
+{
+  (void)incr;
+  __builtin_trap();
+}
+#endif
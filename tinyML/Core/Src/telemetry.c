@@ -0,0 +1,156 @@
+/**
+  ******************************************************************************
+  * @file           : telemetry.c
+  * @brief          : Periodic telemetry frames pushed to the host (APP_TELEMETRY)
+  ******************************************************************************
+  */
+
+#include "telemetry.h"
+#include "stats.h"
+#include "load.h"
+#include "main.h"
+#include <stddef.h>
+#include <string.h>
+
+#if APP_TELEMETRY
+static uint16_t telem_interval = 0;    // ms between frames, 0: none pushed
+static uint8_t telem_link = PROTO_LINK_UART;
+static uint8_t telem_number = 0;
+static uint32_t telem_tick = 0;        // HAL_GetTick of the last frame
+// What the last frame counted up to
+static uint32_t telem_counters[STATS_COUNTERS];
+static uint16_t telem_runs[PROTO_STATS_BUCKETS];
+static uint64_t telem_busy_us = 0;
+static uint32_t telem_errors = 0;      // Stats_Errors
+static uint32_t telem_slow = 0;        // Stats_RunsFrom(APP_TELEMETRY_SLOW)
+
+/**
+  * @brief Count since the last frame; a STATS reset in between restarted it from 0
+  */
+static uint32_t Telemetry_Since(uint32_t now, uint32_t last)
+{
+  return (now >= last) ? now - last : now;
+}
+
+static uint16_t Telemetry_Sat16(uint32_t value)
+{
+  return (value > UINT16_MAX) ? UINT16_MAX : (uint16_t)value;
+}
+
+/**
+  * @brief Push a frame every interval_ms on link, 0 stops the pushes
+  */
+void Telemetry_Configure(uint16_t interval_ms, uint8_t link)
+{
+  telem_interval = interval_ms;
+  telem_link = link;
+}
+
+/**
+  * @brief PROTO_LINK_* the pushes go to
+  */
+uint8_t Telemetry_Link(void)
+{
+  return telem_link;
+}
+
+/**
+  * @brief PROTO_TELEM_* reasons to push a frame now, 0 for none
+  */
+uint8_t Telemetry_Due(void)
+{
+  uint32_t elapsed;
+  uint8_t reason = 0;
+
+  if (!telem_interval)
+  {
+    return 0;
+  }
+  elapsed = HAL_GetTick() - telem_tick;
+  if (elapsed >= telem_interval)
+  {
+    return PROTO_TELEM_PERIODIC;
+  }
+  if (elapsed < APP_TELEMETRY_MIN_MS)
+  {
+    return 0;
+  }
+#if APP_TELEMETRY_ERRORS
+  if (Telemetry_Since(Stats_Errors(), telem_errors) >= APP_TELEMETRY_ERRORS)
+  {
+    reason |= PROTO_TELEM_ERRORS;
+  }
+#endif
+#if APP_TELEMETRY_SLOW
+  if (Telemetry_Since(Stats_RunsFrom(APP_TELEMETRY_SLOW), telem_slow) != 0)
+  {
+    reason |= PROTO_TELEM_SLOW;
+  }
+#endif
+  return reason;
+}
+
+/**
+  * @brief Fill a frame with the counts since the last one, which it then replaces
+  * @retval bytes of frame to send
+  */
+uint16_t Telemetry_Fill(ProtoTelemetry_t *frame, uint8_t reason)
+{
+  uint32_t counters[STATS_COUNTERS];
+  uint16_t runs[PROTO_STATS_BUCKETS];
+  uint32_t now = HAL_GetTick();
+  uint32_t span = now - telem_tick;
+  uint32_t delta, mask = 0, errors = 0, slow = 0;
+  uint64_t busy_us = Load_BusyUs();
+  uint8_t k, n = 0;
+
+  Stats_Snapshot(counters, runs);
+  frame->number = telem_number++;
+  frame->reason = reason;
+  frame->span_ms = Telemetry_Sat16(span);
+  frame->frames = Telemetry_Sat16(Telemetry_Since(counters[STATS_FRAMES], telem_counters[STATS_FRAMES]));
+  frame->inferences = Telemetry_Sat16(Telemetry_Since(counters[STATS_INFERENCES],
+                                                      telem_counters[STATS_INFERENCES]));
+#if APP_LOAD
+  {
+    uint64_t busy = (busy_us >= telem_busy_us) ? busy_us - telem_busy_us : busy_us;
+
+    frame->busy = span ? (uint16_t)((busy >= (uint64_t)span * 1000U) ? 10000U : busy * 10U / span) : 0U;
+  }
+#else
+  frame->busy = PROTO_TELEM_NO_LOAD;
+#endif
+  frame->hclk_mhz = (uint8_t)(HAL_RCC_GetHCLKFreq() / 1000000U);
+  for (k = 0; k < PROTO_TELEM_ERROR_KINDS; k++)
+  {
+    delta = Telemetry_Since(counters[STATS_ERR_INFERENCE + k], telem_counters[STATS_ERR_INFERENCE + k]);
+    frame->errors[k] = (delta > UINT8_MAX) ? UINT8_MAX : (uint8_t)delta;
+    errors += counters[STATS_ERR_INFERENCE + k];
+  }
+  // Only the buckets that moved are sent, a frame of a steady board has two or three
+  for (k = 0; k < PROTO_STATS_BUCKETS; k++)
+  {
+    delta = (runs[k] >= telem_runs[k]) ? runs[k] - telem_runs[k] : runs[k];
+    if (delta)
+    {
+      mask |= 1UL << k;
+      frame->run_counts[n++] = (uint16_t)delta;
+    }
+#if APP_TELEMETRY_SLOW
+    if (k >= APP_TELEMETRY_SLOW)
+    {
+      slow += runs[k];
+    }
+#endif
+  }
+  frame->run_mask = mask;
+
+  memcpy(telem_counters, counters, sizeof(telem_counters));
+  memcpy(telem_runs, runs, sizeof(telem_runs));
+  telem_busy_us = busy_us;
+  telem_errors = errors;
+  telem_slow = slow;
+  telem_tick = now;
+  return (uint16_t)(offsetof(ProtoTelemetry_t, run_counts) + n * sizeof(uint16_t));
+}
+#endif /* APP_TELEMETRY */
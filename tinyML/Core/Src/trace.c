@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file           : trace.c
+  * @brief          : SWO output of the ITM event trace
+  ******************************************************************************
+  */
+
+#include "trace.h"
+
+#if APP_ITM_TRACE
+/**
+  * @brief Route the ITM over asynchronous SWO on PB3 and enable the trace ports
+  * @note  Programs the TPIU itself, so any SWO capable probe or a USB-UART
+  *        on PB3 can record without the debugger setting it up. PB3 is
+  *        TRACESWO (AF0) out of reset and MX_GPIO_Init leaves it alone
+  */
+void Trace_Init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DBGMCU->CR = (DBGMCU->CR & ~DBGMCU_CR_TRACE_MODE) | DBGMCU_CR_TRACE_IOEN;
+
+  TPI->SPPR = 2U;                      // NRZ, an ordinary UART byte stream
+  TPI->FFCR = 0x100U;                  // formatter off: ITM packets only
+  TPI->ACPR = HAL_RCC_GetHCLKFreq() / APP_ITM_TRACE_BAUD - 1U;
+
+  // Periodic synchronisation packets from the cycle counter (every 2^26
+  // cycles), so a capture started mid-stream finds the packet boundaries
+  DWT->CTRL = (DWT->CTRL & ~DWT_CTRL_SYNCTAP_Msk) | (2UL << DWT_CTRL_SYNCTAP_Pos) |
+              DWT_CTRL_CYCCNTENA_Msk;
+
+  ITM->LAR = 0xC5ACCE55U;
+  ITM->TCR = 0U;
+  ITM->TPR = 0U;
+  ITM->TCR = (1UL << ITM_TCR_TraceBusID_Pos) | ITM_TCR_SYNCENA_Msk |
+             ITM_TCR_TSENA_Msk | ITM_TCR_ITMENA_Msk;
+#if APP_PROFILE_COUNTERS
+  // DWT packets: each wrap of an enabled event counter sends one. Nothing
+  // else is enabled in the DWT, PC samples and exception trace stay off
+  ITM->TCR |= ITM_TCR_DWTENA_Msk;
+#endif
+  ITM->TER = (1UL << TRACE_ITM_PORTS) - 1U;
+
+  TRACE_MARK(TRACE_ITM_CLOCK, HAL_RCC_GetHCLKFreq() / 1000000U);
+}
+
+/**
+  * @brief Wait until the queued packets have left the ITM
+  * @note  Call before HCLK changes, the bytes in flight would be sent at the
+  *        new rate. The last one may still be in the TPIU, wait it out too
+  */
+void Trace_Flush(void)
+{
+  uint32_t start = DWT->CYCCNT;
+
+  while (ITM->TCR & ITM_TCR_BUSY_Msk)
+  {
+  }
+  // A few bytes at APP_ITM_TRACE_BAUD
+  while (DWT->CYCCNT - start < 64U * (HAL_RCC_GetHCLKFreq() / APP_ITM_TRACE_BAUD))
+  {
+  }
+}
+
+/**
+  * @brief Move the SWO divider to a new HCLK and tell the decoder
+  */
+void Trace_ClockChanged(void)
+{
+  uint32_t hclk = HAL_RCC_GetHCLKFreq();
+
+  TPI->ACPR = hclk / APP_ITM_TRACE_BAUD - 1U;
+  // Timestamps count HCLK cycles, the decoder rescales from here on
+  TRACE_MARK(TRACE_ITM_CLOCK, hclk / 1000000U);
+}
+#endif
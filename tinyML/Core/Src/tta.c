@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file           : tta.c
+  * @brief          : Shifted and zoomed copies of an image for CLASSIFY_TTA
+  ******************************************************************************
+  * Zoomed pixels are bilinear samples at positions kept in 1/256 pixel.
+  * Both axes scale alike, so one table of positions serves rows and
+  * columns, and the only divides are in building it.
+  ******************************************************************************
+  */
+
+#include "tta.h"
+#include <string.h>
+
+// Image centre, 13.5, in 1/256 pixel
+#define TTA_CENTRE_Q8           ((TTA_SIDE - 1U) * 128U)
+// Outside the image on a zoom out
+#define TTA_OUTSIDE             (-1)
+
+/**
+  * @brief Source position of each output row (and column) for a zoom
+  * @param scale_pct output size against the input, 100 + or - TTA_ZOOM_PCT
+  */
+static void Tta_Positions(uint32_t scale_pct, int32_t *pos)
+{
+  for (int32_t i = 0; i < (int32_t)TTA_SIDE; i++)
+  {
+    // (i - centre) / scale + centre, from the centre both ways alike
+    int32_t offset = (2 * i - (int32_t)(TTA_SIDE - 1U)) * 128 * 100;
+    int32_t q8 = (int32_t)TTA_CENTRE_Q8 + offset / (int32_t)scale_pct;
+
+    pos[i] = (q8 < 0 || q8 > (int32_t)((TTA_SIDE - 1U) * 256U)) ? TTA_OUTSIDE : q8;
+  }
+}
+
+static void Tta_Shift(const uint8_t *img, int32_t dx, int32_t dy, uint8_t *out)
+{
+  memset(out, 0, TTA_SIDE * TTA_SIDE);
+  for (int32_t y = 0; y < (int32_t)TTA_SIDE; y++)
+  {
+    int32_t sy = y - dy;
+    if (sy < 0 || sy >= (int32_t)TTA_SIDE) continue;
+    int32_t x0 = (dx > 0) ? dx : 0;
+    int32_t x1 = (dx < 0) ? (int32_t)TTA_SIDE + dx : (int32_t)TTA_SIDE;
+    memcpy(&out[y * TTA_SIDE + x0], &img[sy * TTA_SIDE + x0 - dx], (size_t)(x1 - x0));
+  }
+}
+
+static void Tta_Zoom(const uint8_t *img, uint32_t scale_pct, uint8_t *out)
+{
+  int32_t pos[TTA_SIDE];
+
+  Tta_Positions(scale_pct, pos);
+  for (uint32_t y = 0; y < TTA_SIDE; y++)
+  {
+    for (uint32_t x = 0; x < TTA_SIDE; x++)
+    {
+      if (pos[y] == TTA_OUTSIDE || pos[x] == TTA_OUTSIDE)
+      {
+        *out++ = 0;
+        continue;
+      }
+      uint32_t sy = (uint32_t)pos[y] >> 8, fy = (uint32_t)pos[y] & 0xFFU;
+      uint32_t sx = (uint32_t)pos[x] >> 8, fx = (uint32_t)pos[x] & 0xFFU;
+      // The last row and column have no neighbour, their weight is 0 there
+      uint32_t sy1 = (sy + 1U < TTA_SIDE) ? sy + 1U : sy;
+      uint32_t sx1 = (sx + 1U < TTA_SIDE) ? sx + 1U : sx;
+      const uint8_t *r0 = &img[sy * TTA_SIDE];
+      const uint8_t *r1 = &img[sy1 * TTA_SIDE];
+      uint32_t top = r0[sx] * (256U - fx) + r0[sx1] * fx;
+      uint32_t bottom = r1[sx] * (256U - fx) + r1[sx1] * fx;
+
+      *out++ = (uint8_t)((top * (256U - fy) + bottom * fy + 32768U) >> 16);
+    }
+  }
+}
+
+/**
+  * @brief Variant kind of a TTA_SIDE^2 image, see tta.h
+  * @param out TTA_SIDE^2 bytes, not img
+  */
+void Tta_Variant(const uint8_t *img, uint8_t kind, uint8_t *out)
+{
+  switch (kind)
+  {
+    case 0: Tta_Shift(img, (int32_t)TTA_SHIFT, 0, out); break;
+    case 1: Tta_Shift(img, -(int32_t)TTA_SHIFT, 0, out); break;
+    case 2: Tta_Shift(img, 0, (int32_t)TTA_SHIFT, out); break;
+    case 3: Tta_Shift(img, 0, -(int32_t)TTA_SHIFT, out); break;
+    case 4: Tta_Zoom(img, 100U + TTA_ZOOM_PCT, out); break;
+    default: Tta_Zoom(img, 100U - TTA_ZOOM_PCT, out); break;
+  }
+}
@@ -0,0 +1,498 @@
+/**
+  ******************************************************************************
+  * @file           : uart_link.c
+  * @brief          : USART1 and USART6 sessions for the framed host protocol
+  ******************************************************************************
+  * Two more hosts next to the one on USART2, each with its own session:
+  *
+  *   USART1  PB6 TX, PB7 RX (AF7), DMA2 stream 2 RX, stream 7 TX
+  *   USART6  PC6 TX, PC7 RX (AF8), DMA2 stream 1 RX, stream 6 TX
+  *   8N1 at APP_UART_LINKS_BAUD, no flow control
+  *
+  * Each port has the reception USART2 has: circular DMA into its own ring,
+  * HT/TC/IDLE events publishing the byte count and a parser fed from the
+  * main loop. A port holds its next frame back in the ring while main.c
+  * will not give it a slot, so one client flooding requests never costs
+  * another a BUSY. Replies go out by one-shot TX DMA from a per-port
+  * buffer; the next waits, up to the caller's timeout, for the last one.
+  *
+  * SET_BAUD is refused on these ports, they stay at APP_UART_LINKS_BAUD.
+  ******************************************************************************
+  */
+
+#include "uart_link.h"
+
+#if APP_UART_LINKS
+
+#include "main.h"
+#include <string.h>
+
+// Largest reply main.c encodes (TX_MAX_PAYLOAD)
+#define UART_LINK_TX_SIZE       (PROTO_MAX_REPLY + PROTO_OVERHEAD)
+
+typedef struct {
+  USART_TypeDef *instance;
+  GPIO_TypeDef *gpio;
+  uint16_t pins;                       // TX | RX
+  uint8_t alternate;
+  DMA_Stream_TypeDef *rx_stream;
+  DMA_Stream_TypeDef *tx_stream;
+  uint32_t channel;
+  IRQn_Type irq;
+  IRQn_Type rx_irq;
+  IRQn_Type tx_irq;
+} UartLinkHw_t;
+
+static const UartLinkHw_t uart_link_hw[UART_LINK_PORTS] = {
+  [UART_LINK_USART1] = { USART1, GPIOB, GPIO_PIN_6 | GPIO_PIN_7, GPIO_AF7_USART1,
+                         DMA2_Stream2, DMA2_Stream7, DMA_CHANNEL_4,
+                         USART1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream7_IRQn },
+  [UART_LINK_USART6] = { USART6, GPIOC, GPIO_PIN_6 | GPIO_PIN_7, GPIO_AF8_USART6,
+                         DMA2_Stream1, DMA2_Stream6, DMA_CHANNEL_5,
+                         USART6_IRQn, DMA2_Stream1_IRQn, DMA2_Stream6_IRQn },
+};
+
+typedef struct {
+  UART_HandleTypeDef huart;
+  DMA_HandleTypeDef hdma_rx;
+  DMA_HandleTypeDef hdma_tx;
+  ProtoParser_t *parser;
+  uint8_t rx[UART_LINK_RX_SIZE];
+  uint16_t rx_isr_pos;                 // ISR: DMA index at the last event
+  volatile uint32_t rx_written;        // ISR: bytes since the last restart
+  volatile uint8_t restart;            // ISR/main: reception must be re-armed
+  uint32_t rx_read;                    // main: bytes consumed
+  uint16_t rx_tail;                    // main: next index to parse
+  uint8_t tx[UART_LINK_TX_SIZE];
+  volatile uint8_t tx_busy;            // ISR/main: reply on the wire
+#if APP_RX_FRAME_TIMEOUT_MS
+  uint32_t stall_count;                // main: DMA counter at stall_tick
+  uint32_t stall_tick;                 // main: when DMA last stored a byte
+#endif
+} UartLink_t;
+
+static UartLink_t uart_links[UART_LINK_PORTS];
+static void (*uart_link_notify)(void) = NULL;
+static uint8_t (*uart_link_ready)(const ProtoParser_t *parser) = NULL;
+static void (*uart_link_release)(ProtoFrame_t *frame) = NULL;
+
+/**
+  * @brief Session of a HAL handle, NULL for USART2
+  */
+static UartLink_t *UART_Link_Of(UART_HandleTypeDef *huart)
+{
+  for (uint8_t port = 0; port < UART_LINK_PORTS; port++)
+  {
+    if (huart == &uart_links[port].huart)
+    {
+      return &uart_links[port];
+    }
+  }
+  return NULL;
+}
+
+/**
+  * @brief Drop the frame being parsed and resync on the following bytes
+  */
+static void UART_Link_Resync(UartLink_t *link)
+{
+  if (link->parser->frame && uart_link_release)
+  {
+    uart_link_release(link->parser->frame);
+  }
+  Proto_ParserReset(link->parser);
+}
+
+#if APP_RX_FRAME_TIMEOUT_MS
+/**
+  * @brief Abandon a frame whose bytes stopped coming, as USART2 does
+  */
+static void UART_Link_FrameTimeout(UartLink_t *link)
+{
+  uint32_t count = __HAL_DMA_GET_COUNTER(&link->hdma_rx);
+  uint32_t now = HAL_GetTick();
+
+  if (count != link->stall_count || link->parser->state == PROTO_RX_SYNC0 ||
+      link->rx_read != link->rx_written)
+  {
+    link->stall_count = count;
+    link->stall_tick = now;
+    return;
+  }
+
+  if (now - link->stall_tick >= APP_RX_FRAME_TIMEOUT_MS)
+  {
+    if (link->parser->frame && uart_link_release)
+    {
+      uart_link_release(link->parser->frame);
+    }
+    Proto_ParserAbort(link->parser, PROTO_ERR_TIMEOUT);
+    link->stall_tick = now;
+  }
+}
+#endif
+
+/**
+  * @brief (Re)arm circular DMA reception from the start of the ring
+  * @note  Masked like UART_StartReception, an RX event cannot interleave
+  */
+static void UART_Link_StartReception(UartLink_t *link)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  HAL_UART_AbortReceive(&link->huart);
+  link->rx_isr_pos = 0;
+  link->rx_written = 0;
+  link->rx_read = 0;
+  link->rx_tail = 0;
+  link->restart = (HAL_UARTEx_ReceiveToIdle_DMA(&link->huart, link->rx, UART_LINK_RX_SIZE) != HAL_OK);
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief Set up both ports with their DMA streams and start reception
+  * @param parsers UART_LINK_PORTS parsers, in UART_LINK_* order
+  * @param notify called from interrupts when bytes are waiting, may be NULL
+  * @param ready whether a parser may claim a frame now, NULL for always
+  * @param release frees the slot of a frame cut short, may be NULL
+  */
+void UART_Link_Init(ProtoParser_t *parsers, void (*notify)(void),
+                    uint8_t (*ready)(const ProtoParser_t *parser),
+                    void (*release)(ProtoFrame_t *frame))
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  uart_link_notify = notify;
+  uart_link_ready = ready;
+  uart_link_release = release;
+
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  __HAL_RCC_DMA2_CLK_ENABLE();
+  __HAL_RCC_USART1_CLK_ENABLE();
+  __HAL_RCC_USART6_CLK_ENABLE();
+
+  for (uint8_t port = 0; port < UART_LINK_PORTS; port++)
+  {
+    const UartLinkHw_t *hw = &uart_link_hw[port];
+    UartLink_t *link = &uart_links[port];
+
+    link->parser = &parsers[port];
+    Proto_ParserReset(link->parser);
+
+    GPIO_InitStruct.Pin = hw->pins;
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull = GPIO_PULLUP;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+    GPIO_InitStruct.Alternate = hw->alternate;
+    HAL_GPIO_Init(hw->gpio, &GPIO_InitStruct);
+
+    link->hdma_rx.Instance = hw->rx_stream;
+    link->hdma_rx.Init.Channel = hw->channel;
+    link->hdma_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    link->hdma_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+    link->hdma_rx.Init.MemInc = DMA_MINC_ENABLE;
+    link->hdma_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    link->hdma_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    link->hdma_rx.Init.Mode = DMA_CIRCULAR;
+    link->hdma_rx.Init.Priority = DMA_PRIORITY_HIGH;
+    link->hdma_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&link->hdma_rx) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    __HAL_LINKDMA(&link->huart, hdmarx, link->hdma_rx);
+
+    link->hdma_tx.Instance = hw->tx_stream;
+    link->hdma_tx.Init.Channel = hw->channel;
+    link->hdma_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    link->hdma_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+    link->hdma_tx.Init.MemInc = DMA_MINC_ENABLE;
+    link->hdma_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    link->hdma_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    link->hdma_tx.Init.Mode = DMA_NORMAL;
+    link->hdma_tx.Init.Priority = DMA_PRIORITY_MEDIUM;
+    link->hdma_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&link->hdma_tx) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    __HAL_LINKDMA(&link->huart, hdmatx, link->hdma_tx);
+
+    // HAL_UART_MspInit only knows USART2, everything it would do is above
+    link->huart.Instance = hw->instance;
+    link->huart.Init.BaudRate = APP_UART_LINKS_BAUD;
+    link->huart.Init.WordLength = UART_WORDLENGTH_8B;
+    link->huart.Init.StopBits = UART_STOPBITS_1;
+    link->huart.Init.Parity = UART_PARITY_NONE;
+    link->huart.Init.Mode = UART_MODE_TX_RX;
+    link->huart.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+    link->huart.Init.OverSampling = UART_OVERSAMPLING_16;
+    if (HAL_UART_Init(&link->huart) != HAL_OK)
+    {
+      Error_Handler();
+    }
+
+    // USART2's priority, so the parsers never preempt each other claiming slots
+    HAL_NVIC_SetPriority(hw->irq, 5, 0);
+    HAL_NVIC_EnableIRQ(hw->irq);
+    HAL_NVIC_SetPriority(hw->rx_irq, 5, 0);
+    HAL_NVIC_EnableIRQ(hw->rx_irq);
+    HAL_NVIC_SetPriority(hw->tx_irq, 5, 0);
+    HAL_NVIC_EnableIRQ(hw->tx_irq);
+
+    UART_Link_StartReception(link);
+  }
+}
+
+/**
+  * @brief Feed the bytes each port's DMA has written to its parser
+  */
+void UART_Link_Poll(void)
+{
+  for (uint8_t port = 0; port < UART_LINK_PORTS; port++)
+  {
+    UartLink_t *link = &uart_links[port];
+    uint32_t written, avail;
+
+    if (!link->parser)
+    {
+      continue;
+    }
+
+    if (link->restart)
+    {
+      UART_Link_Resync(link);
+      UART_Link_StartReception(link);
+      continue;
+    }
+
+    __disable_irq();
+    written = link->rx_written;
+    __enable_irq();
+
+    avail = written - link->rx_read;
+    if (avail > UART_LINK_RX_SIZE)
+    {
+      // DMA lapped the parser, the unread bytes are gone
+      UART_Link_Resync(link);
+      link->rx_read = written;
+      link->rx_tail = (uint16_t)(written % UART_LINK_RX_SIZE);
+      continue;
+    }
+
+    // As on USART2, the next frame waits in the ring until it gets a slot
+    while (avail > 0 && (link->parser->frame || !uart_link_ready || uart_link_ready(link->parser)))
+    {
+      uint16_t n = UART_LINK_RX_SIZE - link->rx_tail;
+      if (n > avail)
+      {
+        n = (uint16_t)avail;
+      }
+
+      n = Proto_Parse(link->parser, &link->rx[link->rx_tail], n);
+      link->rx_read += n;
+      link->rx_tail = (uint16_t)((link->rx_tail + n) % UART_LINK_RX_SIZE);
+      avail -= n;
+    }
+#if APP_RX_FRAME_TIMEOUT_MS
+    UART_Link_FrameTimeout(link);
+#endif
+  }
+}
+
+/**
+  * @brief Whether a port has bytes or a restart waiting for UART_Link_Poll
+  */
+uint8_t UART_Link_Pending(void)
+{
+  for (uint8_t port = 0; port < UART_LINK_PORTS; port++)
+  {
+    const UartLink_t *link = &uart_links[port];
+    if (link->parser && (link->restart || link->rx_written != link->rx_read))
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief Send a reply on a port by DMA
+  * @note  Waits while the previous reply is still going out
+  * @retval 0 on success, -1 if the port stayed busy for timeout
+  */
+int UART_Link_Transmit(uint8_t port, const uint8_t *data, uint16_t len, uint32_t timeout)
+{
+  uint32_t start = HAL_GetTick();
+  UartLink_t *link;
+
+  if (port >= UART_LINK_PORTS || len > UART_LINK_TX_SIZE)
+  {
+    return -1;
+  }
+  link = &uart_links[port];
+
+  while (link->tx_busy)
+  {
+    if (HAL_GetTick() - start > timeout)
+    {
+      HAL_UART_AbortTransmit(&link->huart);
+      link->tx_busy = 0;
+      return -1;
+    }
+  }
+
+  memcpy(link->tx, data, len);
+  link->tx_busy = 1;
+  if (HAL_UART_Transmit_DMA(&link->huart, link->tx, len) != HAL_OK)
+  {
+    link->tx_busy = 0;
+    return -1;
+  }
+  return 0;
+}
+
+/**
+  * @brief Reprogram both ports' BRR after PCLK2 changed, and restart reception
+  * @note  Replies still going out are dropped, the caller flushes first
+  */
+void UART_Link_ClockChanged(void)
+{
+  for (uint8_t port = 0; port < UART_LINK_PORTS; port++)
+  {
+    UartLink_t *link = &uart_links[port];
+
+    if (!link->parser)
+    {
+      continue;
+    }
+
+    HAL_UART_AbortTransmit(&link->huart);
+    link->tx_busy = 0;
+    HAL_UART_AbortReceive(&link->huart);
+    if (HAL_UART_Init(&link->huart) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    UART_Link_Resync(link);
+    UART_Link_StartReception(link);
+  }
+}
+
+/**
+  * @brief Wait until no port has a reply going out, up to timeout
+  */
+void UART_Link_Flush(uint32_t timeout)
+{
+  uint32_t start = HAL_GetTick();
+
+  for (uint8_t port = 0; port < UART_LINK_PORTS; port++)
+  {
+    while ((uart_links[port].tx_busy ||
+            (uart_links[port].parser && __HAL_UART_GET_FLAG(&uart_links[port].huart, UART_FLAG_TC) == RESET)) &&
+           HAL_GetTick() - start <= timeout)
+    {
+    }
+  }
+}
+
+/**
+  * @brief RX event (DMA half/complete transfer or IDLE line) on USART1/USART6
+  * @param Size position of the DMA write pointer in the port's ring
+  */
+void UART_Link_RxEvent(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  UartLink_t *link = UART_Link_Of(huart);
+
+  if (!link)
+  {
+    return;
+  }
+
+  // Events come at least every half buffer, so the delta is unambiguous
+  if (Size >= link->rx_isr_pos)
+  {
+    link->rx_written += Size - link->rx_isr_pos;
+  }
+  else
+  {
+    link->rx_written += UART_LINK_RX_SIZE - link->rx_isr_pos + Size;
+  }
+  link->rx_isr_pos = (Size == UART_LINK_RX_SIZE) ? 0 : Size;
+
+  if (uart_link_notify)
+  {
+    uart_link_notify();
+  }
+}
+
+/**
+  * @brief TX complete on USART1/USART6: the port takes the next reply
+  */
+void UART_Link_TxDone(UART_HandleTypeDef *huart)
+{
+  UartLink_t *link = UART_Link_Of(huart);
+
+  if (link)
+  {
+    link->tx_busy = 0;
+  }
+}
+
+/**
+  * @brief Line or DMA error on USART1/USART6
+  * @note  Reception is re-armed from UART_Link_Poll, the frame being
+  *        parsed is dropped and the client's retry resends it
+  */
+void UART_Link_Error(UART_HandleTypeDef *huart)
+{
+  UartLink_t *link = UART_Link_Of(huart);
+
+  if (!link)
+  {
+    return;
+  }
+
+  // A DMA TX error leaves gState ready without a TX complete callback
+  if (link->tx_busy && huart->gState == HAL_UART_STATE_READY)
+  {
+    link->tx_busy = 0;
+  }
+
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    link->restart = 1;
+    if (uart_link_notify)
+    {
+      uart_link_notify();
+    }
+  }
+}
+
+/**
+  * @brief USART1/USART6 global interrupt
+  */
+void UART_Link_IRQHandler(uint8_t port)
+{
+  HAL_UART_IRQHandler(&uart_links[port].huart);
+}
+
+/**
+  * @brief DMA2 RX stream interrupt of a port
+  */
+void UART_Link_RxDmaIRQHandler(uint8_t port)
+{
+  HAL_DMA_IRQHandler(&uart_links[port].hdma_rx);
+}
+
+/**
+  * @brief DMA2 TX stream interrupt of a port
+  */
+void UART_Link_TxDmaIRQHandler(uint8_t port)
+{
+  HAL_DMA_IRQHandler(&uart_links[port].hdma_tx);
+}
+
+#endif /* APP_UART_LINKS */
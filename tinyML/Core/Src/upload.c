@@ -0,0 +1,585 @@
+/**
+  ******************************************************************************
+  * @file           : upload.c
+  * @brief          : Network weights uploaded over the link into reserved flash
+  ******************************************************************************
+  */
+
+#include "upload.h"
+#include <string.h>
+#include "dma_copy.h"
+#include "log.h"
+#include "main.h"
+#include "models.h"
+#include "profile.h"
+#include "xmodel.h"
+
+#if APP_UPLOAD
+// UPLOAD region of the linker script, a whole sector
+extern const uint8_t __ai_upload_start[];
+extern const uint8_t __ai_upload_end[];
+
+#define UPLOAD_SECTOR           FLASH_SECTOR_7
+#define UPLOAD_BLOB_OFFSET      16U     // header, then the blob on a 128-bit flash line
+
+static const UploadHeader_t *const upload_header = (const UploadHeader_t *)__ai_upload_start;
+
+// Upload in progress, between BEGIN and COMMIT
+static struct {
+  uint8_t open;
+  uint8_t model;
+  int8_t slot;                         // external flash slot of a streamed model, -1 for sector 7
+  uint32_t size;
+  uint32_t crc;
+  uint32_t received;                   // blob bytes programmed so far
+} upload;
+
+#if APP_WEIGHT_CHECK
+// Bytes the DMA feeds the CRC unit at a time: the longest a frame CRC waits
+#define CHECK_SLICE             4096U
+// Of the CRC unit, MSB first
+#define CHECK_POLY              0x04C11DB7U
+
+// Boot-time check of the committed blobs, a model at a time
+static struct {
+  uint32_t pending;                    // models whose blob is still unchecked
+  uint32_t started;                    // PROF_CYCLES() at Upload_CheckStart
+  uint32_t size;                       // blob bytes of the model in check, 0 between models
+  uint32_t crc;                        // its header's
+  uint32_t offset;                     // bytes fed so far
+  uint32_t state;                      // CRC unit after the last slice
+  uint8_t model;
+  int8_t slot;                         // external flash slot, -1 for sector 7
+  volatile uint8_t busy;               // a slice is in flight
+} check;
+
+#if APP_XFLASH
+static uint32_t check_buf[CHECK_SLICE / 4U];
+#endif
+
+static void Upload_CheckCancel(uint8_t model);
+#else
+#define Upload_CheckCancel(model)       ((void)0)
+#endif
+
+/**
+  * @brief Program words into the region, flash unlocked by the caller
+  */
+static int Upload_Program(uint32_t addr, const uint8_t *data, uint32_t len)
+{
+  for (uint32_t i = 0; i < len; i += 4U)
+  {
+    if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, addr + i, __UNALIGNED_UINT32_READ(&data[i])) != HAL_OK)
+    {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief CRC unit over size bytes (a word multiple) of flash
+  * @note  Same context as the frame CRCs, never an ISR
+  */
+static uint32_t Upload_Crc(const uint8_t *blob, uint32_t size)
+{
+  const uint32_t *w = (const uint32_t *)blob;
+
+  CRC->CR = CRC_CR_RESET;
+  for (uint32_t i = 0; i < size / 4U; i++)
+  {
+    CRC->DR = w[i];
+  }
+  return CRC->DR;
+}
+
+/**
+  * @brief Blob offset in the open upload's region
+  */
+static uint32_t Upload_BlobOffset(void)
+{
+  return (upload.slot >= 0) ? XMODEL_BLOB : UPLOAD_BLOB_OFFSET;
+}
+
+/**
+  * @brief Program len bytes (a word multiple) at offset of the open upload's region
+  */
+static int Upload_Write(uint32_t offset, const uint8_t *data, uint32_t len)
+{
+  int status;
+
+#if APP_XFLASH
+  if (upload.slot >= 0)
+  {
+    return XFlash_Program(upload.slot * XMODEL_SLOT + offset, data, len);
+  }
+#endif
+  HAL_FLASH_Unlock();
+  status = Upload_Program((uint32_t)__ai_upload_start + offset, data, len);
+  HAL_FLASH_Lock();
+  return status;
+}
+
+#if APP_XFLASH
+/**
+  * @brief Compare len bytes of the external blob at offset with data
+  */
+static int Upload_Compare(uint32_t offset, const uint8_t *data, uint32_t len)
+{
+  uint8_t buf[64];
+
+  for (uint32_t i = 0; i < len; i += sizeof(buf))
+  {
+    uint32_t n = (len - i < sizeof(buf)) ? len - i : sizeof(buf);
+
+    if (XFlash_Read(upload.slot * XMODEL_SLOT + XMODEL_BLOB + offset + i, buf, n) != 0 ||
+        memcmp(buf, &data[i], n) != 0)
+    {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief CRC unit over the external blob, read a page at a time
+  */
+static uint32_t Upload_CrcExternal(uint32_t size)
+{
+  uint32_t buf[XFLASH_PAGE / 4U];
+
+  CRC->CR = CRC_CR_RESET;
+  for (uint32_t off = 0; off < size; off += XFLASH_PAGE)
+  {
+    uint32_t n = (size - off < XFLASH_PAGE) ? size - off : XFLASH_PAGE;
+
+    if (XFlash_Read(upload.slot * XMODEL_SLOT + XMODEL_BLOB + off, buf, n) != 0)
+    {
+      return ~upload.crc;
+    }
+    for (uint32_t i = 0; i < n / 4U; i++)
+    {
+      CRC->DR = buf[i];
+    }
+  }
+  return CRC->DR;
+}
+#endif
+#endif /* APP_UPLOAD */
+
+/**
+  * @brief Erase the region and open an upload of size bytes for model
+  * @note  Blocks for the erase: 1 to 2 s for sector 7, a 64 KB block of
+  *        external flash at a time for a streamed model
+  */
+ProtoError_t Upload_Begin(uint8_t model, uint32_t size, uint32_t crc)
+{
+#if APP_UPLOAD
+  ProtoError_t err = PROTO_ERR_NONE;
+
+  if (size == 0 || (size & 3U) || size > Upload_Capacity(model))
+  {
+    return PROTO_ERR_PARAM;
+  }
+  Upload_CheckCancel(model);
+  upload.open = 0;
+  upload.slot = (int8_t)Model_Streamed(model);
+#if APP_XFLASH
+  if (upload.slot >= 0)
+  {
+    err = (XFlash_Erase(upload.slot * XMODEL_SLOT, (XMODEL_BLOB + size + XFLASH_SECTOR - 1U) & ~(XFLASH_SECTOR - 1U)) == 0) ?
+          PROTO_ERR_NONE : PROTO_ERR_FLASH;
+  }
+  else
+#endif
+  {
+    err = Upload_Erase(model);
+  }
+  if (err != PROTO_ERR_NONE)
+  {
+    return err;
+  }
+  upload.open = 1;
+  upload.model = model;
+  upload.size = size;
+  upload.crc = crc;
+  upload.received = 0;
+  return PROTO_ERR_NONE;
+#else
+  (void)model; (void)size; (void)crc;
+  return PROTO_ERR_TYPE;
+#endif
+}
+
+/**
+  * @brief Program len bytes (a word multiple) of the open upload at offset
+  * @note  A chunk already programmed is accepted again if it is unchanged,
+  *        so a retried request does no harm; any other gap is ERR_PARAM
+  */
+ProtoError_t Upload_Data(uint32_t offset, const uint8_t *data, uint16_t len)
+{
+#if APP_UPLOAD
+  const uint8_t *blob = __ai_upload_start + UPLOAD_BLOB_OFFSET;
+
+  if (!upload.open || (len & 3U) || offset + len > upload.size)
+  {
+    return PROTO_ERR_PARAM;
+  }
+  if (offset + len <= upload.received)
+  {
+#if APP_XFLASH
+    if (upload.slot >= 0)
+    {
+      return Upload_Compare(offset, data, len) ? PROTO_ERR_PARAM : PROTO_ERR_NONE;
+    }
+#endif
+    return memcmp(&blob[offset], data, len) ? PROTO_ERR_PARAM : PROTO_ERR_NONE;
+  }
+  if (offset != upload.received)
+  {
+    return PROTO_ERR_PARAM;
+  }
+
+  if (Upload_Write(Upload_BlobOffset() + offset, data, len) != 0)
+  {
+    upload.open = 0;
+    return PROTO_ERR_FLASH;
+  }
+  upload.received += len;
+  return PROTO_ERR_NONE;
+#else
+  (void)offset; (void)data; (void)len;
+  return PROTO_ERR_TYPE;
+#endif
+}
+
+/**
+  * @brief Check the whole blob against the CRC given at BEGIN and write the header
+  */
+ProtoError_t Upload_Commit(void)
+{
+#if APP_UPLOAD
+  UploadHeader_t header;
+  uint32_t crc;
+  int status;
+
+  if (!upload.open || upload.received != upload.size)
+  {
+    return PROTO_ERR_PARAM;
+  }
+  Upload_CheckCancel(upload.model);
+  upload.open = 0;
+#if APP_XFLASH
+  crc = (upload.slot >= 0) ? Upload_CrcExternal(upload.size) :
+                             Upload_Crc(__ai_upload_start + UPLOAD_BLOB_OFFSET, upload.size);
+#else
+  crc = Upload_Crc(__ai_upload_start + UPLOAD_BLOB_OFFSET, upload.size);
+#endif
+  // Not ERR_CRC: the host would take it for a damaged frame and resend
+  if (crc != upload.crc)
+  {
+    return PROTO_ERR_PARAM;
+  }
+
+  memset(&header, 0, sizeof(header));
+  header.magic = UPLOAD_MAGIC;
+  header.size = upload.size;
+  header.crc = upload.crc;
+  header.model = upload.model;
+  // The magic word last: until it is in, the region reads as empty
+  status = Upload_Write(4U, (const uint8_t *)&header + 4U, sizeof(header) - 4U);
+  if (status == 0)
+  {
+    status = Upload_Write(0, (const uint8_t *)&header, 4U);
+  }
+  return (status == 0) ? PROTO_ERR_NONE : PROTO_ERR_FLASH;
+#else
+  return PROTO_ERR_TYPE;
+#endif
+}
+
+/**
+  * @brief Erase the region holding model's upload: sector 7, where every
+  *        model runs on its linked weights again, or the header sector of
+  *        a streamed model's slot, which then has no weights
+  */
+ProtoError_t Upload_Erase(uint8_t model)
+{
+#if APP_UPLOAD
+  FLASH_EraseInitTypeDef erase = { 0 };
+  uint32_t failed = 0;
+  HAL_StatusTypeDef status;
+
+  Upload_CheckCancel(model);
+  upload.open = 0;
+#if APP_XFLASH
+  if (Model_Streamed(model) >= 0)
+  {
+    return (XFlash_Erase((uint32_t)Model_Streamed(model) * XMODEL_SLOT, XFLASH_SECTOR) == 0) ?
+           PROTO_ERR_NONE : PROTO_ERR_FLASH;
+  }
+#else
+  (void)model;
+#endif
+  erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase.Sector = UPLOAD_SECTOR;
+  erase.NbSectors = 1;
+  erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;   // 2.7 - 3.6 V, 32-bit parallelism
+
+  HAL_FLASH_Unlock();
+  status = HAL_FLASHEx_Erase(&erase, &failed);
+  HAL_FLASH_Lock();
+  return (status == HAL_OK) ? PROTO_ERR_NONE : PROTO_ERR_FLASH;
+#else
+  (void)model;
+  return PROTO_ERR_TYPE;
+#endif
+}
+
+/**
+  * @brief Blob bytes programmed by the open upload
+  */
+uint32_t Upload_Received(void)
+{
+#if APP_UPLOAD
+  return upload.received;
+#else
+  return 0;
+#endif
+}
+
+/**
+  * @brief Registry index of the upload last begun, the model a COMMIT gave weights
+  */
+uint8_t Upload_Model(void)
+{
+#if APP_UPLOAD
+  return upload.model;
+#else
+  return 0;
+#endif
+}
+
+/**
+  * @brief Blob bytes the region of model can hold, 0 without APP_UPLOAD
+  *        or for a streamed model past the end of the external flash
+  */
+uint32_t Upload_Capacity(uint8_t model)
+{
+#if APP_UPLOAD
+#if APP_XFLASH
+  if (Model_Streamed(model) >= 0)
+  {
+    uint32_t base = (uint32_t)Model_Streamed(model) * XMODEL_SLOT;
+
+    return (XFlash_Size() >= base + XMODEL_SLOT) ? XMODEL_SLOT - XMODEL_BLOB : 0;
+  }
+#else
+  (void)model;
+#endif
+  return (uint32_t)(__ai_upload_end - __ai_upload_start) - UPLOAD_BLOB_OFFSET;
+#else
+  (void)model;
+  return 0;
+#endif
+}
+
+/**
+  * @brief Committed weights for model, if they are size bytes
+  * @retval the blob, NULL to keep the linked weights
+  */
+const void *Upload_Weights(uint8_t model, uint32_t size)
+{
+#if APP_UPLOAD
+  if (upload_header->magic != UPLOAD_MAGIC || upload_header->model != model ||
+      upload_header->size != size)
+  {
+    return NULL;
+  }
+  return __ai_upload_start + UPLOAD_BLOB_OFFSET;
+#else
+  (void)model; (void)size;
+  return NULL;
+#endif
+}
+
+#if APP_WEIGHT_CHECK
+/**
+  * @brief Put the CRC unit at state: after a reset, the one word that
+  *        takes 0xFFFFFFFF there, found by running the register backwards
+  * @note  The F411's unit has no INIT register, and frame CRCs reset it
+  *        between two slices of a check
+  */
+static void Upload_CrcSeed(uint32_t state)
+{
+  for (uint8_t i = 0; i < 32U; i++)
+  {
+    // The polynomial's bit 0 tells whether the bit shifted out was set
+    state = (state & 1U) ? ((state ^ CHECK_POLY) >> 1) | 0x80000000U : state >> 1;
+  }
+  CRC->CR = CRC_CR_RESET;
+  CRC->DR = state ^ 0xFFFFFFFFU;
+}
+
+/**
+  * @brief DMA2 has fed a slice: keep the CRC before anything resets it
+  */
+static void Upload_CheckDone(void *arg)
+{
+  (void)arg;
+  check.state = CRC->DR;
+  check.busy = 0;
+}
+
+/**
+  * @brief Find the committed blob of the next pending model
+  * @retval 0, or -1 if it has none (nothing to check, it is done)
+  */
+static int Upload_CheckNext(void)
+{
+  UploadHeader_t header = *upload_header;
+
+  check.model = (uint8_t)__CLZ(__RBIT(check.pending));
+  check.slot = (int8_t)Model_Streamed(check.model);
+  check.offset = 0;
+#if APP_XFLASH
+  if (check.slot >= 0 && XFlash_Read((uint32_t)check.slot * XMODEL_SLOT, &header, sizeof(header)) != 0)
+  {
+    header.magic = 0;
+  }
+#endif
+  if (header.magic != UPLOAD_MAGIC || (check.slot < 0 && header.model != check.model) ||
+      header.size == 0 || header.size > Upload_Capacity(check.model))
+  {
+    return -1;
+  }
+  check.size = header.size;
+  check.crc = header.crc;
+  return 0;
+}
+
+/**
+  * @brief Wait for the slice in flight, then stop checking model and
+  *        every other model whose blob shares its region
+  */
+static void Upload_CheckCancel(uint8_t model)
+{
+  Upload_CheckYield();
+  for (uint8_t i = 0; i < Model_Count(); i++)
+  {
+    if (i == model || (Model_Streamed(i) < 0 && Model_Streamed(model) < 0))
+    {
+      check.pending &= ~(1UL << i);
+      if (check.size && check.model == i)
+      {
+        check.size = 0;
+      }
+    }
+  }
+}
+#endif
+
+/**
+  * @brief Queue a check of every committed blob, the clock starts now
+  */
+void Upload_CheckStart(void)
+{
+#if APP_WEIGHT_CHECK
+  check.pending = (Model_Count() >= 32U) ? 0xFFFFFFFFUL : (1UL << Model_Count()) - 1U;
+  check.size = 0;
+  check.started = PROF_CYCLES();
+#endif
+}
+
+/**
+  * @brief One step of the check: start a slice, or finish a model
+  * @note  Main loop only, returns at once while a slice is in flight
+  * @retval the model whose blob failed its CRC, -1 otherwise
+  */
+int Upload_CheckPoll(void)
+{
+#if APP_WEIGHT_CHECK
+  const void *src;
+  uint32_t n;
+
+  if (check.busy || !check.pending)
+  {
+    return -1;
+  }
+  if (check.size == 0 && Upload_CheckNext() != 0)
+  {
+    check.pending &= ~(1UL << check.model);
+    return -1;
+  }
+  if (check.offset == check.size)
+  {
+    check.pending &= ~(1UL << check.model);
+    check.size = 0;
+    if (check.state != check.crc)
+    {
+      LOG(LOG_WEIGHTS_BAD, check.model, check.state);
+      return check.model;
+    }
+    LOG(LOG_WEIGHTS_OK, check.model, PROF_CYCLES() - check.started);
+    return -1;
+  }
+
+  n = (check.size - check.offset < CHECK_SLICE) ? check.size - check.offset : CHECK_SLICE;
+  src = __ai_upload_start + UPLOAD_BLOB_OFFSET + check.offset;
+#if APP_XFLASH
+  // Read here: the tiled kernels take the SPI during runs
+  if (check.slot >= 0)
+  {
+    if (XFlash_Read((uint32_t)check.slot * XMODEL_SLOT + XMODEL_BLOB + check.offset, check_buf, n) != 0)
+    {
+      memset(check_buf, 0xFF, n);
+    }
+    src = check_buf;
+  }
+#endif
+  if (check.offset == 0)
+  {
+    CRC->CR = CRC_CR_RESET;
+  }
+  else
+  {
+    Upload_CrcSeed(check.state);
+  }
+  check.offset += n;
+  check.busy = 1;
+  if (DmaCopy_Feed(&CRC->DR, src, n / 4U, Upload_CheckDone, NULL) != 0)
+  {
+    for (uint32_t i = 0; i < n / 4U; i++)
+    {
+      CRC->DR = ((const uint32_t *)src)[i];
+    }
+    Upload_CheckDone(NULL);
+  }
+#endif
+  return -1;
+}
+
+/**
+  * @brief Models whose blob is not checked yet, a bit each
+  */
+uint32_t Upload_CheckPending(void)
+{
+#if APP_WEIGHT_CHECK
+  return check.pending;
+#else
+  return 0;
+#endif
+}
+
+/**
+  * @brief Wait for the slice in flight: the CRC unit is free after
+  * @note  Whatever uses the unit calls this first (Proto_Crc)
+  */
+void Upload_CheckYield(void)
+{
+#if APP_WEIGHT_CHECK
+  while (check.busy)
+  {
+  }
+#endif
+}
@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * @file           : usb_link.c
+  * @brief          : USB CDC transport for the framed host protocol
+  ******************************************************************************
+  * Glue between the CubeMX generated CDC interface (usbd_cdc_if.c) and the
+  * frame parser. Add to CDC_Receive_FS, in its USER CODE section:
+  *
+  *   USB_Link_Receive(Buf, *Len);
+  *   USBD_CDC_SetRxBuffer(&hUsbDeviceFS, &Buf[0]);
+  *   USBD_CDC_ReceivePacket(&hUsbDeviceFS);
+  *
+  * The OTG FS interrupt must share USART2's NVIC priority so both parsers
+  * never preempt each other while claiming frame slots.
+  ******************************************************************************
+  */
+
+#include "usb_link.h"
+
+#if APP_USB_CDC
+
+#include "main.h"
+#include "usb_device.h"
+#include "usbd_cdc_if.h"
+
+extern USBD_HandleTypeDef hUsbDeviceFS;
+
+static ProtoParser_t *usb_parser = NULL;
+
+/**
+  * @brief Attach the parser fed by CDC OUT packets
+  */
+void USB_Link_Init(ProtoParser_t *parser)
+{
+  usb_parser = parser;
+  Proto_ParserReset(parser);
+}
+
+/**
+  * @brief Called from CDC_Receive_FS with each OUT packet
+  */
+void USB_Link_Receive(const uint8_t *buf, uint32_t len)
+{
+  uint16_t n;
+
+  if (!usb_parser)
+  {
+    return;
+  }
+
+  // Proto_Parse returns after each complete frame
+  while (len > 0)
+  {
+    n = Proto_Parse(usb_parser, buf, (uint16_t)len);
+    buf += n;
+    len -= n;
+  }
+}
+
+/**
+  * @brief Send data on the CDC IN endpoint and wait for the transfer to end
+  * @retval 0 on success, -1 if the host is not listening
+  */
+int USB_Link_Transmit(const uint8_t *data, uint16_t len, uint32_t timeout)
+{
+  uint32_t start = HAL_GetTick();
+  USBD_CDC_HandleTypeDef *hcdc;
+
+  while (CDC_Transmit_FS((uint8_t *)data, len) == USBD_BUSY)
+  {
+    if (HAL_GetTick() - start > timeout)
+    {
+      return -1;
+    }
+  }
+
+  // data must stay valid until the IN transfer has completed
+  hcdc = (USBD_CDC_HandleTypeDef *)hUsbDeviceFS.pClassData;
+  while (hcdc && hcdc->TxState != 0)
+  {
+    if (HAL_GetTick() - start > timeout)
+    {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+#endif /* APP_USB_CDC */
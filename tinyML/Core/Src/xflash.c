@@ -0,0 +1,320 @@
+/**
+  ******************************************************************************
+  * @file           : xflash.c
+  * @brief          : External SPI NOR flash holding streamed model weights
+  ******************************************************************************
+  * The SPI registers are driven directly as in spi_link.c, only the HAL
+  * DMA and GPIO drivers are needed. A read is the 0x0B command, 3 address
+  * bytes and a dummy byte sent by polling, then RX DMA into the buffer
+  * while TX DMA clocks out 0xFF from a single byte.
+  ******************************************************************************
+  */
+
+#include "xflash.h"
+
+#if APP_XFLASH
+
+#include "main.h"
+#include "boot.h"
+
+#define XFLASH_CS_PORT          GPIOE
+#define XFLASH_CS_PIN           GPIO_PIN_11
+
+#define XFLASH_CMD_WREN         0x06U
+#define XFLASH_CMD_RDSR         0x05U
+#define XFLASH_CMD_PP           0x02U
+#define XFLASH_CMD_SE           0x20U   // 4 KB sector erase
+#define XFLASH_CMD_BE           0xD8U   // 64 KB block erase
+#define XFLASH_CMD_FAST_READ    0x0BU
+#define XFLASH_CMD_RDID         0x9FU
+#define XFLASH_CMD_WAKE         0xABU   // release from deep power-down
+
+#define XFLASH_SR_WIP           0x01U
+
+// Datasheet maxima of a W25Q32JV: page 3 ms, sector 400 ms, block 2 s
+#define XFLASH_PAGE_MS          5U
+#define XFLASH_ERASE_MS         2500U
+#define XFLASH_READ_MS          100U
+
+static DMA_HandleTypeDef hdma_spi4_rx;
+static DMA_HandleTypeDef hdma_spi4_tx;
+
+static const uint8_t xflash_dummy = 0xFF;
+static uint32_t xflash_size;            // bytes, from the JEDEC id; 0 if none answered
+
+static void XFlash_Select(void)
+{
+  HAL_GPIO_WritePin(XFLASH_CS_PORT, XFLASH_CS_PIN, GPIO_PIN_RESET);
+}
+
+static void XFlash_Deselect(void)
+{
+  while (SPI4->SR & SPI_SR_BSY) { }
+  HAL_GPIO_WritePin(XFLASH_CS_PORT, XFLASH_CS_PIN, GPIO_PIN_SET);
+}
+
+/**
+  * @brief Exchange one byte by polling
+  */
+static uint8_t XFlash_Byte(uint8_t tx)
+{
+  while (!(SPI4->SR & SPI_SR_TXE)) { }
+  *(volatile uint8_t *)&SPI4->DR = tx;
+  while (!(SPI4->SR & SPI_SR_RXNE)) { }
+  return *(volatile uint8_t *)&SPI4->DR;
+}
+
+/**
+  * @brief Command byte and a 24-bit address, CS left low
+  */
+static void XFlash_Command(uint8_t cmd, uint32_t addr)
+{
+  XFlash_Select();
+  XFlash_Byte(cmd);
+  XFlash_Byte((uint8_t)(addr >> 16));
+  XFlash_Byte((uint8_t)(addr >> 8));
+  XFlash_Byte((uint8_t)addr);
+}
+
+static void XFlash_WriteEnable(void)
+{
+  XFlash_Select();
+  XFlash_Byte(XFLASH_CMD_WREN);
+  XFlash_Deselect();
+}
+
+/**
+  * @brief Poll the status register until a program or erase is over
+  */
+static int XFlash_Wait(uint32_t timeout)
+{
+  uint32_t start = HAL_GetTick();
+  uint8_t sr;
+
+  XFlash_Select();
+  XFlash_Byte(XFLASH_CMD_RDSR);
+  do
+  {
+    sr = XFlash_Byte(0xFF);
+  } while ((sr & XFLASH_SR_WIP) && HAL_GetTick() - start < timeout);
+  XFlash_Deselect();
+  return (sr & XFLASH_SR_WIP) ? -1 : 0;
+}
+
+/**
+  * @brief Set up SPI4, its DMA streams and CS, then read the JEDEC id
+  * @retval 0 if a flash answered, -1 if the id reads as no device
+  */
+int XFlash_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+  uint8_t id[3];
+
+  __HAL_RCC_GPIOE_CLK_ENABLE();
+  __HAL_RCC_SPI4_CLK_ENABLE();
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  HAL_GPIO_WritePin(XFLASH_CS_PORT, XFLASH_CS_PIN, GPIO_PIN_SET);
+  GPIO_InitStruct.Pin = XFLASH_CS_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  HAL_GPIO_Init(XFLASH_CS_PORT, &GPIO_InitStruct);
+
+  /**SPI4 GPIO Configuration
+  PE12     ------> SPI4_SCK
+  PE13     ------> SPI4_MISO
+  PE14     ------> SPI4_MOSI
+  */
+  GPIO_InitStruct.Pin = GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Alternate = GPIO_AF5_SPI4;
+  HAL_GPIO_Init(GPIOE, &GPIO_InitStruct);
+
+  /* SPI4_RX Init */
+  hdma_spi4_rx.Instance = DMA2_Stream0;
+  hdma_spi4_rx.Init.Channel = DMA_CHANNEL_4;
+  hdma_spi4_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_spi4_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_spi4_rx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_spi4_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_spi4_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_spi4_rx.Init.Mode = DMA_NORMAL;
+  hdma_spi4_rx.Init.Priority = DMA_PRIORITY_HIGH;
+  hdma_spi4_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_spi4_rx) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* SPI4_TX Init: the same dummy byte over and over */
+  hdma_spi4_tx.Instance = DMA2_Stream4;
+  hdma_spi4_tx.Init.Channel = DMA_CHANNEL_5;
+  hdma_spi4_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_spi4_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_spi4_tx.Init.MemInc = DMA_MINC_DISABLE;
+  hdma_spi4_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_spi4_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_spi4_tx.Init.Mode = DMA_NORMAL;
+  hdma_spi4_tx.Init.Priority = DMA_PRIORITY_MEDIUM;
+  hdma_spi4_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_spi4_tx) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  // Master, mode 0, 8 bit MSB first, software NSS, PCLK2 / 2
+  SPI4->CR1 = SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI;
+  SPI4->CR2 = 0;
+  SET_BIT(SPI4->CR1, SPI_CR1_SPE);
+
+  XFlash_Select();
+  XFlash_Byte(XFLASH_CMD_WAKE);
+  XFlash_Deselect();
+  HAL_Delay(1);
+
+  XFlash_Select();
+  XFlash_Byte(XFLASH_CMD_RDID);
+  for (uint32_t i = 0; i < sizeof(id); i++)
+  {
+    id[i] = XFlash_Byte(0xFF);
+  }
+  XFlash_Deselect();
+
+  // Capacity byte is log2 of the size; 24-bit addressing stops at 16 MB
+  xflash_size = 0;
+  if (id[0] != 0x00 && id[0] != 0xFF && id[2] >= 16 && id[2] <= 24)
+  {
+    xflash_size = 1UL << id[2];
+  }
+  return xflash_size ? 0 : -1;
+}
+
+/**
+  * @brief Bytes of the flash found by XFlash_Init, 0 if none
+  */
+uint32_t XFlash_Size(void)
+{
+  return xflash_size;
+}
+
+/**
+  * @brief Start reading len bytes at addr into buf by DMA
+  * @note  Returns once the data phase runs; XFlash_ReadWait() before the
+  *        buffer is used or the next flash access
+  */
+void XFlash_ReadStart(uint32_t addr, void *buf, uint16_t len)
+{
+  XFlash_Command(XFLASH_CMD_FAST_READ, addr);
+  XFlash_Byte(0xFF);
+
+  HAL_DMA_Start(&hdma_spi4_rx, (uint32_t)&SPI4->DR, (uint32_t)buf, len);
+  SET_BIT(SPI4->CR2, SPI_CR2_RXDMAEN);
+  HAL_DMA_Start(&hdma_spi4_tx, (uint32_t)&xflash_dummy, (uint32_t)&SPI4->DR, len);
+  SET_BIT(SPI4->CR2, SPI_CR2_TXDMAEN);
+}
+
+/**
+  * @brief Wait for the read XFlash_ReadStart() began
+  * @retval 0 once the buffer holds it, -1 on a DMA error or timeout
+  */
+int XFlash_ReadWait(void)
+{
+  int status = 0;
+
+  // TX is done before the last byte comes back
+  if (HAL_DMA_PollForTransfer(&hdma_spi4_tx, HAL_DMA_FULL_TRANSFER, XFLASH_READ_MS) != HAL_OK ||
+      HAL_DMA_PollForTransfer(&hdma_spi4_rx, HAL_DMA_FULL_TRANSFER, XFLASH_READ_MS) != HAL_OK)
+  {
+    HAL_DMA_Abort(&hdma_spi4_tx);
+    HAL_DMA_Abort(&hdma_spi4_rx);
+    status = -1;
+  }
+  CLEAR_BIT(SPI4->CR2, SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+  XFlash_Deselect();
+  return status;
+}
+
+/**
+  * @brief Read len bytes at addr, blocking
+  */
+int XFlash_Read(uint32_t addr, void *buf, uint32_t len)
+{
+  uint8_t *dst = buf;
+
+  while (len)
+  {
+    uint16_t n = (len > 0xFFFFU) ? 0xFFFFU : (uint16_t)len;
+
+    XFlash_ReadStart(addr, dst, n);
+    if (XFlash_ReadWait() != 0)
+    {
+      return -1;
+    }
+    addr += n;
+    dst += n;
+    len -= n;
+  }
+  return 0;
+}
+
+/**
+  * @brief Program len bytes at addr (erased beforehand), split on page boundaries
+  */
+int XFlash_Program(uint32_t addr, const void *data, uint32_t len)
+{
+  const uint8_t *src = data;
+
+  while (len)
+  {
+    uint32_t n = XFLASH_PAGE - (addr % XFLASH_PAGE);
+
+    if (n > len) n = len;
+    XFlash_WriteEnable();
+    XFlash_Command(XFLASH_CMD_PP, addr);
+    for (uint32_t i = 0; i < n; i++)
+    {
+      XFlash_Byte(src[i]);
+    }
+    XFlash_Deselect();
+    if (XFlash_Wait(XFLASH_PAGE_MS) != 0)
+    {
+      return -1;
+    }
+    addr += n;
+    src += n;
+    len -= n;
+  }
+  return 0;
+}
+
+/**
+  * @brief Erase the sectors covering len bytes from addr (sector aligned)
+  * @note  Whole 64 KB blocks where they fit, feeding the watchdog after each
+  */
+int XFlash_Erase(uint32_t addr, uint32_t len)
+{
+  uint32_t end = addr + len;
+
+  if (addr % XFLASH_SECTOR)
+  {
+    return -1;
+  }
+  while (addr < end)
+  {
+    uint8_t block = !(addr % XFLASH_BLOCK) && end - addr >= XFLASH_BLOCK;
+
+    XFlash_WriteEnable();
+    XFlash_Command(block ? XFLASH_CMD_BE : XFLASH_CMD_SE, addr);
+    XFlash_Deselect();
+    if (XFlash_Wait(XFLASH_ERASE_MS) != 0)
+    {
+      return -1;
+    }
+    WATCHDOG_FEED();
+    addr += block ? XFLASH_BLOCK : XFLASH_SECTOR;
+  }
+  return 0;
+}
+
+#endif /* APP_XFLASH */
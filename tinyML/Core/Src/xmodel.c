@@ -0,0 +1,502 @@
+/**
+  ******************************************************************************
+  * @file           : xmodel.c
+  * @brief          : Models whose weights stream from the external flash
+  ******************************************************************************
+  * The tiled kernels keep the library's requantisation (per output channel
+  * multiplier, zero points from the tensors) and its activation planning:
+  * a convolution's output may overlap its input in the arena, as the
+  * library kernel writes pixel by pixel behind its reads. Here all output
+  * channels of a pixel only exist once every tile has passed, so a band of
+  * output rows is computed into the layer's scratch0 and copied out after
+  * the last tile, and the weights stream again for the next band. The
+  * scratch is what the library asked for its own im2col; the band is as
+  * many rows as it holds.
+  ******************************************************************************
+  */
+
+#include "xmodel.h"
+
+#if APP_XFLASH
+#include <math.h>
+#include <string.h>
+#include "main.h"
+#include "upload.h"
+#include "ai_layer_custom_interface.h"
+#include "layers_conv2d.h"
+#include "layers_dense.h"
+#include "models.h"
+
+#define XMODEL_STREAM_MIN       8192U           // smaller weight tensors are copied to SRAM
+#define XMODEL_TILE_ROWS        32U             // output channels of a tile at most
+#define XMODEL_COL_MAX          (9U * 128U)     // inputs of a patch or a dense row at most
+
+// Weight tiles, one computing while DMA fills the other
+static uint32_t xmodel_tile[2][APP_XFLASH_TILE / 4U] __attribute__((section(".noinit")));
+// One patch or dense input as int16 pairs, in Kernel_Expand order
+static uint32_t xmodel_col[XMODEL_COL_MAX / 2U] __attribute__((section(".noinit")));
+// The weight tensors that do not stream
+static uint32_t xmodel_pool[APP_XFLASH_RESIDENT / 4U];
+static uint32_t xmodel_pool_used;
+// External flash address of the bound blob, and its size
+static uint32_t xmodel_addr;
+static uint32_t xmodel_size;
+
+static int32_t xmodel_mult[XMODEL_TILE_ROWS];
+static uint8_t xmodel_shift[XMODEL_TILE_ROWS];
+
+/**
+  * @brief Fixed-point form of a requantisation scale, as Kernel_Multiplier
+  */
+static void XModel_Multiplier(float scale, int32_t *mult, uint8_t *shift)
+{
+  int exp;
+  float m = frexpf(scale, &exp);
+  int64_t q = (int64_t)lrintf(m * 2147483648.0f);
+
+  if (q == (1LL << 31))
+  {
+    q >>= 1;
+    exp++;
+  }
+  *mult = (int32_t)q;
+  *shift = (uint8_t)((exp > 30) ? 1 : (exp < -31) ? 62 : 31 - exp);
+}
+
+/**
+  * @brief Requantise an accumulator to int8 at the output zero point
+  * @note  A fused ReLU is the clamp: its output range starts at the zero point
+  */
+static int8_t XModel_Requant(int32_t acc, int32_t mult, uint32_t shift, int32_t zp)
+{
+  int32_t v = (int32_t)(((int64_t)acc * mult + (1LL << (shift - 1))) >> shift) + zp;
+
+  if (v < -128) return -128;
+  if (v > 127) return 127;
+  return (int8_t)v;
+}
+
+/**
+  * @brief Expand n int8 activations (n % 4 == 0) to int16 minus the zero point
+  * @note  SXTB16 order, (x0, x2), (x1, x3), as the weights unpack
+  */
+static uint32_t *XModel_Expand(uint32_t *col, const uint8_t *in, uint32_t n, int32_t zp)
+{
+  uint32_t z = (uint16_t)zp * 0x00010001U;
+
+  for (uint32_t i = 0; i < n; i += 4)
+  {
+    uint32_t v = __UNALIGNED_UINT32_READ(&in[i]);
+    *col++ = __SSUB16(__SXTB16(v), z);
+    *col++ = __SSUB16(__SXTB16(__ROR(v, 8)), z);
+  }
+  return col;
+}
+
+/**
+  * @brief Dot product of a weight row with the expanded input
+  */
+static inline int32_t XModel_Dot(const uint32_t *w, const uint32_t *col, uint32_t words, int32_t acc)
+{
+  for (uint32_t k = 0; k < words; k++)
+  {
+    acc = (int32_t)__SMLAD(__SXTB16(w[k]), col[2 * k], (uint32_t)acc);
+    acc = (int32_t)__SMLAD(__SXTB16(__ROR(w[k], 8)), col[2 * k + 1], (uint32_t)acc);
+  }
+  return acc;
+}
+
+static uint32_t XModel_Dim(const ai_tensor *t, ai_u16 pos)
+{
+  return t ? (uint32_t)ai_tensor_get_shape(t, pos) : 0;
+}
+
+static int32_t XModel_ZeroPoint(ai_tensor *t)
+{
+  return ai_tensor_get_intq(t).zeropoint_s8[0];
+}
+
+/**
+  * @brief Offset of a weight tensor in the blob, -1 if it does not point into it
+  */
+static int32_t XModel_Offset(const ai_tensor *t, uint32_t size)
+{
+  uint32_t addr = t && t->data ? (uint32_t)t->data->data : 0;
+
+  if (addr < XMODEL_BASE || addr - XMODEL_BASE + size > xmodel_size)
+  {
+    return -1;
+  }
+  return (int32_t)(addr - XMODEL_BASE);
+}
+
+/**
+  * @brief Output channels per weight tile of rows of row_bytes
+  */
+static uint32_t XModel_TileRows(uint32_t row_bytes)
+{
+  uint32_t n = APP_XFLASH_TILE / row_bytes;
+
+  return (n > XMODEL_TILE_ROWS) ? XMODEL_TILE_ROWS : n;
+}
+
+/**
+  * @brief Start the DMA read of tile t of a layer's streamed weights
+  */
+static void XModel_Fetch(ai_layer *layer, uint32_t rows, uint32_t row_bytes, uint32_t t, uint32_t *buf)
+{
+  ai_tensor *weights = ai_layer_get_tensor_weights(layer, 0);
+  uint32_t per = XModel_TileRows(row_bytes);
+  uint32_t n = (rows - t * per < per) ? rows - t * per : per;
+
+  XFlash_ReadStart(xmodel_addr + ((uint32_t)weights->data->data - XMODEL_BASE) + t * per * row_bytes,
+                   buf, (uint16_t)(n * row_bytes));
+}
+
+/**
+  * @brief Wait for a tile; a failed read computes on zeros, not on the last tile
+  */
+static void XModel_Wait(uint32_t *buf)
+{
+  if (XFlash_ReadWait() != 0)
+  {
+    memset(buf, 0, APP_XFLASH_TILE);
+  }
+}
+
+/**
+  * @brief Requantisation of output channels c0 .. c0 + n - 1
+  */
+static void XModel_Multipliers(ai_layer *layer, uint32_t c0, uint32_t n)
+{
+  ai_tensor_intq_info qin = ai_tensor_get_intq(ai_layer_get_tensor_in(layer, 0));
+  ai_tensor_intq_info qout = ai_tensor_get_intq(ai_layer_get_tensor_out(layer, 0));
+  ai_tensor_intq_info qw = ai_tensor_get_intq(ai_layer_get_tensor_weights(layer, 0));
+
+  for (uint32_t c = 0; c < n; c++)
+  {
+    XModel_Multiplier(qin.scale[0] * qw.scale[c0 + c] / qout.scale[0], &xmodel_mult[c], &xmodel_shift[c]);
+  }
+}
+
+/**
+  * @brief Check a layer is quantised as the kernels here compute: int8
+  *        activations, symmetric per-channel weights
+  */
+static int XModel_Quant(ai_layer *layer, uint32_t channels)
+{
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  ai_tensor *weights = ai_layer_get_tensor_weights(layer, 0);
+  ai_tensor_intq_info qw;
+
+  if (!ai_tensor_has_intq(in) || !ai_tensor_has_intq(out) || !ai_tensor_has_intq(weights))
+  {
+    return 0;
+  }
+  qw = ai_tensor_get_intq(weights);
+  if (qw.size != channels)
+  {
+    return 0;
+  }
+  for (uint32_t c = 0; c < channels; c++)
+  {
+    if (qw.zeropoint_s8[c] != 0)
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* Conv ----------------------------------------------------------------------*/
+/**
+  * @brief Tiled 3x3 stride 1 valid conv, the padding done by the pad layer before
+  */
+static void XConv_Forward(ai_layer *layer)
+{
+  ai_tensor *in_t = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out_t = ai_layer_get_tensor_out(layer, 0);
+  const uint8_t *in = ai_tensor_get_data(in_t).u8;
+  int8_t *out = ai_tensor_get_data(out_t).s8;
+  const int32_t *bias = ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 1)).s32;
+  ai_tensor *scratch = GET_TENSOR_SCRATCH(((ai_node *)layer)->tensors, 0);
+  int8_t *stage = ai_tensor_get_data(scratch).s8;
+  const uint32_t cin = XModel_Dim(in_t, AI_TENSOR_CHANNEL);
+  const uint32_t in_w = XModel_Dim(in_t, AI_TENSOR_WIDTH);
+  const uint32_t cout = XModel_Dim(out_t, AI_TENSOR_CHANNEL);
+  const uint32_t out_w = XModel_Dim(out_t, AI_TENSOR_WIDTH);
+  const uint32_t out_h = XModel_Dim(out_t, AI_TENSOR_HEIGHT);
+  const uint32_t patch = 9U * cin;               // weight bytes per output channel, OHWI
+  const uint32_t per = XModel_TileRows(patch);
+  const uint32_t tiles = (cout + per - 1) / per;
+  const uint32_t band = (uint32_t)ai_tensor_get_data_byte_size(scratch) / (out_w * cout);
+  const uint32_t steps = tiles * ((out_h + band - 1) / band);
+  const int32_t zin = XModel_ZeroPoint(in_t);
+  const int32_t zout = XModel_ZeroPoint(out_t);
+
+  XModel_Fetch(layer, cout, patch, 0, xmodel_tile[0]);
+  for (uint32_t s = 0; s < steps; s++)
+  {
+    // All weights in one tile: read once, kept for every band
+    uint32_t b = (tiles > 1) ? (s & 1U) : 0;
+    uint32_t t = s % tiles;
+    uint32_t c0 = t * per;
+    uint32_t n = (cout - c0 < per) ? cout - c0 : per;
+    uint32_t y0 = (s / tiles) * band;
+    uint32_t y1 = (y0 + band < out_h) ? y0 + band : out_h;
+
+    if (s == 0 || tiles > 1)
+    {
+      XModel_Wait(xmodel_tile[b]);
+    }
+    if (tiles > 1 && s + 1 < steps)
+    {
+      XModel_Fetch(layer, cout, patch, (t + 1) % tiles, xmodel_tile[b ^ 1U]);
+    }
+    XModel_Multipliers(layer, c0, n);
+
+    for (uint32_t y = y0; y < y1; y++)
+    {
+      for (uint32_t x = 0; x < out_w; x++)
+      {
+        uint32_t *col = xmodel_col;
+        int8_t *o = &stage[((y - y0) * out_w + x) * cout + c0];
+
+        for (uint32_t ky = 0; ky < 3; ky++)
+        {
+          // The 3 taps of a kernel row are 3 * cin contiguous bytes in HWC
+          col = XModel_Expand(col, &in[((y + ky) * in_w + x) * cin], 3U * cin, zin);
+        }
+        for (uint32_t c = 0; c < n; c++)
+        {
+          int32_t acc = XModel_Dot(&xmodel_tile[b][c * patch / 4U], xmodel_col, patch / 4U, bias[c0 + c]);
+          o[c] = XModel_Requant(acc, xmodel_mult[c], xmodel_shift[c], zout);
+        }
+      }
+    }
+
+    if (t == tiles - 1)
+    {
+      memcpy(&out[y0 * out_w * cout], stage, (y1 - y0) * out_w * cout);
+    }
+  }
+}
+
+/**
+  * @brief Check a layer fits XConv_Forward
+  */
+static int XConv_Match(ai_node *node)
+{
+  const ai_layer_conv2d *l = (const ai_layer_conv2d *)node;
+  ai_layer *layer = (ai_layer *)node;
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  ai_tensor *weights = ai_layer_get_tensor_weights(layer, 0);
+  ai_tensor *bias = ai_layer_get_tensor_weights(layer, 1);
+  ai_tensor *scratch = GET_TENSOR_SCRATCH(node->tensors, 0);
+  uint32_t cin = XModel_Dim(in, AI_TENSOR_CHANNEL);
+  uint32_t cout = XModel_Dim(out, AI_TENSOR_CHANNEL);
+  uint32_t out_w = XModel_Dim(out, AI_TENSOR_WIDTH);
+
+  // Valid 3x3 at stride 1: the output is the input less a 1 pixel border
+  if (l->groups != 1 || l->filter_stride.data[0] != 1 || l->filter_stride.data[1] != 1 ||
+      l->dilation.data[0] != 1 || l->dilation.data[1] != 1 ||
+      cin == 0 || (cin & 3U) || 9U * cin > XMODEL_COL_MAX || 9U * cin > APP_XFLASH_TILE ||
+      out_w + 2U != XModel_Dim(in, AI_TENSOR_WIDTH) ||
+      XModel_Dim(out, AI_TENSOR_HEIGHT) + 2U != XModel_Dim(in, AI_TENSOR_HEIGHT) ||
+      !weights || ai_tensor_get_data_byte_size(weights) != cout * 9U * cin ||
+      ai_tensor_get_data_byte_size(weights) < XMODEL_STREAM_MIN ||
+      XModel_Offset(weights, cout * 9U * cin) < 0 ||
+      !bias || ai_tensor_get_data_size(bias) != cout ||
+      !scratch || ai_tensor_get_data_byte_size(scratch) < out_w * cout)
+  {
+    return 0;
+  }
+  return XModel_Quant(layer, cout);
+}
+
+/* Dense ---------------------------------------------------------------------*/
+/**
+  * @brief Tiled int8 dense layer, one input expansion for all rows
+  */
+static void XDense_Forward(ai_layer *layer)
+{
+  ai_tensor *in_t = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out_t = ai_layer_get_tensor_out(layer, 0);
+  int8_t *out = ai_tensor_get_data(out_t).s8;
+  const int32_t *bias = ai_tensor_get_data(ai_layer_get_tensor_weights(layer, 1)).s32;
+  const uint32_t cols = (uint32_t)ai_tensor_get_data_size(in_t);
+  const uint32_t rows = (uint32_t)ai_tensor_get_data_size(out_t);
+  const uint32_t per = XModel_TileRows(cols);
+  const uint32_t tiles = (rows + per - 1) / per;
+  const int32_t zout = XModel_ZeroPoint(out_t);
+
+  XModel_Fetch(layer, rows, cols, 0, xmodel_tile[0]);
+  // Expanded first: the output may overlap the input
+  XModel_Expand(xmodel_col, ai_tensor_get_data(in_t).u8, cols, XModel_ZeroPoint(in_t));
+
+  for (uint32_t t = 0; t < tiles; t++)
+  {
+    uint32_t b = t & 1U;
+    uint32_t r0 = t * per;
+    uint32_t n = (rows - r0 < per) ? rows - r0 : per;
+
+    XModel_Wait(xmodel_tile[b]);
+    if (t + 1 < tiles)
+    {
+      XModel_Fetch(layer, rows, cols, t + 1, xmodel_tile[b ^ 1U]);
+    }
+    XModel_Multipliers(layer, r0, n);
+
+    for (uint32_t r = 0; r < n; r++)
+    {
+      int32_t acc = XModel_Dot(&xmodel_tile[b][r * cols / 4U], xmodel_col, cols / 4U, bias[r0 + r]);
+      out[r0 + r] = XModel_Requant(acc, xmodel_mult[r], xmodel_shift[r], zout);
+    }
+  }
+}
+
+/**
+  * @brief Check a layer fits XDense_Forward
+  */
+static int XDense_Match(ai_node *node)
+{
+  ai_layer *layer = (ai_layer *)node;
+  ai_tensor *in = ai_layer_get_tensor_in(layer, 0);
+  ai_tensor *out = ai_layer_get_tensor_out(layer, 0);
+  ai_tensor *weights = ai_layer_get_tensor_weights(layer, 0);
+  ai_tensor *bias = ai_layer_get_tensor_weights(layer, 1);
+  uint32_t cols = in ? (uint32_t)ai_tensor_get_data_size(in) : 0;
+  uint32_t rows = out ? (uint32_t)ai_tensor_get_data_size(out) : 0;
+
+  if (cols == 0 || (cols & 3U) || cols > XMODEL_COL_MAX || cols > APP_XFLASH_TILE ||
+      !weights || ai_tensor_get_data_byte_size(weights) != rows * cols ||
+      ai_tensor_get_data_byte_size(weights) < XMODEL_STREAM_MIN ||
+      XModel_Offset(weights, rows * cols) < 0 ||
+      !bias || ai_tensor_get_data_size(bias) != rows)
+  {
+    return 0;
+  }
+  return XModel_Quant(layer, rows);
+}
+
+/**
+  * @brief Copy a weight tensor from the blob into the SRAM pool
+  * @retval 0, -1 if the pool is full or the read failed
+  */
+static int XModel_Resident(ai_tensor *t)
+{
+  uint32_t bytes = (uint32_t)ai_tensor_get_data_byte_size(t);
+  uint32_t size = (bytes + 3U) & ~3U;
+  int32_t offset = XModel_Offset(t, bytes);
+  uint8_t *copy = (uint8_t *)xmodel_pool + xmodel_pool_used;
+
+  if (offset < 0)
+  {
+    // Already copied, a tensor shared by two layers, or not in the blob
+    return 0;
+  }
+  if (size > sizeof(xmodel_pool) - xmodel_pool_used ||
+      XFlash_Read(xmodel_addr + (uint32_t)offset, copy, bytes) != 0)
+  {
+    return -1;
+  }
+  t->data->data = AI_PTR(copy);
+  t->data->data_start = AI_PTR(copy);
+  xmodel_pool_used += size;
+  return 0;
+}
+#endif /* APP_XFLASH */
+
+/**
+  * @brief Point a network bound at XMODEL_BASE at its blob in external flash
+  *        slot, streaming the large layers and copying the rest to SRAM
+  * @param size bytes of the generated weights map
+  * @note  Called after every create_and_init or init, which bind the
+  *        tensors to XMODEL_BASE again
+  * @retval 0, -1 if the slot holds no committed blob of that size or a
+  *         weight tensor fits neither
+  */
+int XModel_Bind(ai_handle network, uint8_t slot, uint32_t size)
+{
+#if APP_XFLASH
+  ai_network *net = AI_NETWORK_ACQUIRE_CTX(network);
+  ai_node *node = net ? net->input_node : NULL;
+  UploadHeader_t header;
+
+  xmodel_pool_used = 0;
+  xmodel_size = size;
+  xmodel_addr = slot * XMODEL_SLOT + XMODEL_BLOB;
+  if (!node || XFlash_Read(slot * XMODEL_SLOT, &header, sizeof(header)) != 0 ||
+      header.magic != UPLOAD_MAGIC || header.size != size)
+  {
+    return -1;
+  }
+
+  for (uint32_t n = 0; node && n < MODEL_MAX_NODES; n++)
+  {
+    int streamed = 0;
+
+    // On a tiled kernel since an earlier bind: match again
+    if (node->forward == AI_NODE_FUNC(XConv_Forward))
+    {
+      node->forward = AI_NODE_FUNC(forward_conv2d_deep_3x3_sssa8_ch);
+    }
+    else if (node->forward == AI_NODE_FUNC(XDense_Forward))
+    {
+      node->forward = AI_NODE_FUNC(forward_dense_integer_SSSA_ch);
+    }
+
+    if (node->forward == AI_NODE_FUNC(forward_conv2d_deep_3x3_sssa8_ch) && XConv_Match(node))
+    {
+      node->forward = AI_NODE_FUNC(XConv_Forward);
+      streamed = 1;
+    }
+    else if (node->forward == AI_NODE_FUNC(forward_dense_integer_SSSA_ch) && XDense_Match(node))
+    {
+      node->forward = AI_NODE_FUNC(XDense_Forward);
+      streamed = 1;
+    }
+
+    for (ai_u16 i = streamed ? 1 : 0; i < ai_layer_get_tensor_weights_size((ai_layer *)node); i++)
+    {
+      ai_tensor *t = ai_layer_get_tensor_weights((ai_layer *)node, i);
+
+      if (t && XModel_Resident(t) != 0)
+      {
+        return -1;
+      }
+    }
+    // Constant operands (the batch norm eltwise scales and offsets) are
+    // inputs that point into the blob
+    for (ai_u16 i = 0; i < ai_layer_get_tensor_in_size((ai_layer *)node); i++)
+    {
+      ai_tensor *t = ai_layer_get_tensor_in((ai_layer *)node, i);
+
+      if (t && XModel_Resident(t) != 0)
+      {
+        return -1;
+      }
+    }
+    // The last layer links to itself
+    node = (node->next == node) ? NULL : node->next;
+  }
+  return 0;
+#else
+  (void)network; (void)slot; (void)size;
+  return -1;
+#endif
+}
+
+/**
+  * @brief Weight bytes of the bound streamed model held in SRAM
+  */
+uint32_t XModel_ResidentBytes(void)
+{
+#if APP_XFLASH
+  return xmodel_pool_used;
+#else
+  return 0;
+#endif
+}
@@ -0,0 +1,247 @@
+/**
+  ******************************************************************************
+  * @file           : bench.c
+  * @brief          : Microbenchmarks of the firmware's hot path on the host
+  ******************************************************************************
+  * ./bench [seconds per figure]
+  *
+  * Parser: a stream of CLASSIFY (784 B) and PING frames fed in 64 byte
+  * pieces, as DMA events hand them to UART_PollReception, parsed alone
+  * and with the CRC check of every frame, which the host computes bit by
+  * bit where the device has its CRC unit. Preprocessing: each step of a
+  * CLASSIFY and the CLASSIFY_PACKED decoders on a drawn digit, ns per
+  * call and, on x86, TSC cycles. Host figures: they rank changes to the C,
+  * the board's own are CLASSIFY_PROF's and python -m stm32dc.sim's.
+  ******************************************************************************
+  */
+
+#define _POSIX_C_SOURCE 199309L
+#include "harness.h"
+#include "preprocess.h"
+#include "image_pack.h"
+#include "image_crop.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#define IMAGE 784U
+#define STREAM_FRAMES 64U
+#define CHUNK 64U
+
+static double seconds = 0.5;
+static volatile uint32_t sink;
+
+static double Now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint64_t Cycles(void)
+{
+#ifdef HAVE_TSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// A digit-like image: a ring of ink on black
+static void Digit(uint8_t *img)
+{
+  for (int y = 0; y < 28; y++)
+  {
+    for (int x = 0; x < 28; x++)
+    {
+      int d = (x - 14) * (x - 14) + (y - 14) * (y - 14);
+      img[y * 28 + x] = (d > 30 && d < 70) ? (uint8_t)(255 - 2 * abs(d - 50)) : 0;
+    }
+  }
+}
+
+typedef void (*Step_t)(void *arg);
+
+// Runs step for the set time; prints ns and cycles per call
+static void Report(const char *name, Step_t step, void *arg)
+{
+  uint32_t calls = 0, batch = 16;
+  double start = Now(), elapsed;
+  uint64_t c0 = Cycles();
+
+  do
+  {
+    for (uint32_t i = 0; i < batch; i++)
+    {
+      step(arg);
+    }
+    calls += batch;
+    elapsed = Now() - start;
+  } while (elapsed < seconds);
+
+#ifdef HAVE_TSC
+  printf("%-26s %10.1f ns %10.0f cycles\n", name, elapsed * 1e9 / calls, (double)(Cycles() - c0) / calls);
+#else
+  (void)c0;
+  printf("%-26s %10.1f ns\n", name, elapsed * 1e9 / calls);
+#endif
+}
+
+static uint8_t image[IMAGE] __attribute__((aligned(4)));
+static uint8_t other[IMAGE] __attribute__((aligned(4)));
+static int8_t input[IMAGE] __attribute__((aligned(4)));
+static int8_t scores[10] = { -12, 40, -3, 88, 7, 88, -128, 1, 0, 55 };
+
+static void LoadImage(void *arg) { (void)arg; Pre_LoadImage(input, image, IMAGE); sink += (uint8_t)input[400]; }
+static void Ink(void *arg) { (void)arg; sink += Pre_Ink(image, IMAGE); }
+static void Delta(void *arg) { (void)arg; sink += Pre_Delta(image, other, IMAGE, UINT32_MAX); }
+static void Argmax(void *arg) { (void)arg; sink += (uint32_t)Pre_Argmax(scores, 10); }
+
+typedef struct {
+  const uint8_t *payload;
+  uint16_t len;
+} Packed_t;
+
+static void Unpack(void *arg)
+{
+  Packed_t *p = arg;
+  sink += Pack_Decode(p->payload, p->len);
+}
+
+static void Crop(void *arg)
+{
+  Packed_t *p = arg;
+  sink += Crop_Load(p->payload, p->len, input);
+}
+
+// The stream of frames the parser figures are of
+static uint8_t stream[STREAM_FRAMES * (IMAGE + PROTO_OVERHEAD)];
+static uint32_t stream_len;
+
+static void BuildStream(void)
+{
+  stream_len = 0;
+  for (uint32_t i = 0; i < STREAM_FRAMES; i++)
+  {
+    if (i % 4 == 3)
+    {
+      stream_len += Proto_Encode(&stream[stream_len], PROTO_CMD_PING, (uint8_t)i, NULL, 0);
+    }
+    else
+    {
+      stream_len += Proto_Encode(&stream[stream_len], PROTO_CMD_CLASSIFY, (uint8_t)i, image, IMAGE);
+    }
+  }
+}
+
+static void Parse(Harness_t *h)
+{
+  for (uint32_t at = 0; at < stream_len; )
+  {
+    uint16_t n = (uint16_t)((stream_len - at < CHUNK) ? stream_len - at : CHUNK);
+    // Proto_Parse stops after each frame, as for the main loop to free its slot
+    while (n)
+    {
+      uint16_t used = Proto_Parse(&h->parser, &stream[at], n);
+      at += used;
+      n -= used;
+    }
+  }
+}
+
+static void ParserThroughput(const char *name, uint8_t check)
+{
+  Harness_t h;
+  uint32_t rounds = 0;
+  double start = Now(), elapsed;
+
+  Harness_Init(&h, check);
+  do
+  {
+    Parse(&h);
+    rounds++;
+    elapsed = Now() - start;
+  } while (elapsed < seconds);
+
+  if (h.frames != rounds * STREAM_FRAMES || h.bad_crc || h.dropped)
+  {
+    printf("%-26s lost frames: %u good, %u bad CRC, %u dropped\n", name, h.frames, h.bad_crc, h.dropped);
+    exit(1);
+  }
+  printf("%-26s %10.1f MB/s %8.2f Mframes/s\n", name, stream_len * (double)rounds / elapsed / 1e6,
+         h.frames / elapsed / 1e6);
+}
+
+int main(int argc, char **argv)
+{
+  static uint8_t zrle[2 + 2 * IMAGE], bits4[2 + IMAGE / 2], crop[2 + 56 * 56];
+  Packed_t packed_zrle, packed_bits4, packed_crop;
+  uint16_t n = 2;
+
+  if (argc > 1)
+  {
+    seconds = atof(argv[1]);
+  }
+  Proto_Init();
+  Digit(image);
+  memcpy(other, image, IMAGE);
+  other[300] ^= 0x40;
+
+  // ZRLE: literal ink, 0x00 n for each run of zeros
+  zrle[0] = PROTO_PACK_ZRLE;
+  zrle[1] = 1;
+  for (uint32_t i = 0; i < IMAGE; )
+  {
+    if (image[i])
+    {
+      zrle[n++] = image[i++];
+      continue;
+    }
+    uint32_t run = 0;
+    while (i < IMAGE && !image[i] && run < 255)
+    {
+      i++;
+      run++;
+    }
+    zrle[n++] = 0;
+    zrle[n++] = (uint8_t)run;
+  }
+  packed_zrle = (Packed_t){ zrle, n };
+
+  bits4[0] = PROTO_PACK_BITS4;
+  bits4[1] = 2;
+  for (uint32_t i = 0; i < IMAGE / 2; i++)
+  {
+    bits4[2 + i] = (uint8_t)(image[2 * i] / 17 | (image[2 * i + 1] / 17) << 4);
+  }
+  packed_bits4 = (Packed_t){ bits4, sizeof(bits4) };
+
+  crop[0] = 56;
+  crop[1] = 56;
+  for (uint32_t i = 0; i < 56 * 56; i++)
+  {
+    crop[2 + i] = image[(i / 56 / 2) * 28 + (i % 56) / 2];
+  }
+  packed_crop = (Packed_t){ crop, sizeof(crop) };
+
+  BuildStream();
+  printf("parser, %u frames, %u B in %u B pieces\n", STREAM_FRAMES, stream_len, CHUNK);
+  ParserThroughput("Proto_Parse", 0);
+  ParserThroughput("Proto_Parse + soft CRC", 1);
+
+  printf("preprocessing, per call\n");
+  Report("Pre_LoadImage", LoadImage, NULL);
+  Report("Pre_Ink", Ink, NULL);
+  Report("Pre_Delta", Delta, NULL);
+  Report("Pre_Argmax (10)", Argmax, NULL);
+  Report("Pack_Decode ZRLE", Unpack, &packed_zrle);
+  Report("Pack_Decode BITS4", Unpack, &packed_bits4);
+  Report("Crop_Load 56x56", Crop, &packed_crop);
+  return 0;
+}
@@ -0,0 +1,183 @@
+/**
+  ******************************************************************************
+  * @file           : fuzz.c
+  * @brief          : Fuzzing of the frame parser and the image decoders
+  ******************************************************************************
+  * ./fuzz [iterations] [seed]      random inputs, built with ASan and UBSan
+  * ./fuzz FILE...                  replays inputs, a crash libFuzzer saved
+  * make libfuzzer                  the same entry point, coverage guided
+  *
+  * Every input is fed to the parser in pieces whose sizes come from the
+  * input itself, and must never stall it: each Proto_Parse call with
+  * bytes consumes at least one and at most all of them, the state and
+  * byte count stay in range, and after the longest frame's worth of bytes
+  * that are no magic the parser is waiting for a frame again, and takes
+  * the next good one whole. The input also goes to Pack_Decode and
+  * Crop_Load, which the sanitizers hold to their buffers.
+  ******************************************************************************
+  */
+
+#include "harness.h"
+#include "image_pack.h"
+#include "image_crop.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHECK(cond) \
+  do { if (!(cond)) { fprintf(stderr, "fuzz: %s:%d: %s\n", __FILE__, __LINE__, #cond); abort(); } } while (0)
+
+static void Feed(Harness_t *h, const uint8_t *data, size_t size, const uint8_t *pieces, size_t npieces)
+{
+  size_t at = 0, k = 0;
+
+  while (at < size)
+  {
+    size_t piece = npieces ? (size_t)pieces[k++ % npieces] + 1 : size;
+    uint16_t n = (uint16_t)((size - at < piece) ? size - at : piece);
+
+    while (n)
+    {
+      uint16_t used = Proto_Parse(&h->parser, &data[at], n);
+      CHECK(used >= 1 && used <= n);
+      CHECK(h->parser.state <= PROTO_RX_CRC);
+      CHECK(h->parser.count <= PROTO_MAX_PAYLOAD);
+      // Whatever the input said, a claimed frame is the one buffer
+      CHECK(h->parser.frame == NULL || h->parser.frame == &h->frame);
+      at += used;
+      n -= used;
+    }
+  }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  static uint8_t idle[PROTO_MAX_PAYLOAD + PROTO_OVERHEAD];
+  static uint8_t ping[PROTO_OVERHEAD];
+  static int8_t input[PACK_IMAGE_SIZE];
+  Harness_t h;
+  uint32_t frames;
+  uint16_t len;
+
+  Harness_Init(&h, 1);
+  // The first bytes pick the piece sizes, the rest is the stream
+  size_t npieces = size ? data[0] % 8 : 0;
+  if (size < 1 + npieces)
+  {
+    return 0;
+  }
+  Feed(&h, data + 1 + npieces, size - 1 - npieces, data + 1, npieces);
+
+  // Bytes that are no magic finish any frame under way and leave the parser synchronising
+  memset(idle, 0, sizeof(idle));
+  Feed(&h, idle, sizeof(idle), NULL, 0);
+  CHECK(h.parser.state == PROTO_RX_SYNC0 && h.parser.frame == NULL && !h.busy);
+
+  frames = h.frames;
+  len = Proto_Encode(ping, PROTO_CMD_PING, 1, NULL, 0);
+  Feed(&h, ping, len, NULL, 0);
+  CHECK(h.frames == frames + 1);
+
+  // The decoders, with the stream as their payload
+  len = (uint16_t)((size > PROTO_MAX_PAYLOAD) ? PROTO_MAX_PAYLOAD : size);
+  (void)Pack_Decode(data, len);
+  (void)Crop_Load(data, len, input);
+  return 0;
+}
+
+#ifndef LIBFUZZER
+static uint32_t Rand(uint32_t *state)
+{
+  *state = *state * 1103515245U + 12345U;
+  return *state >> 8;
+}
+
+// Random streams: noise, and good frames cut, corrupted and run together
+static size_t Generate(uint8_t *out, size_t cap, uint32_t *state)
+{
+  size_t n = 0;
+  static uint8_t payload[PROTO_MAX_PAYLOAD];
+
+  out[n++] = (uint8_t)Rand(state);
+  for (uint32_t pieces = out[0] % 8; pieces; pieces--)
+  {
+    out[n++] = (uint8_t)Rand(state);
+  }
+  while (n < cap - PROTO_MAX_PAYLOAD - PROTO_OVERHEAD && Rand(state) % 8)
+  {
+    switch (Rand(state) % 4)
+    {
+      case 0:
+        // Noise, magic bytes often
+        for (uint32_t k = Rand(state) % 32; k; k--)
+        {
+          out[n++] = (Rand(state) % 3) ? (uint8_t)Rand(state) : (Rand(state) % 2 ? PROTO_MAGIC0 : PROTO_MAGIC1);
+        }
+        break;
+      default:
+      {
+        uint16_t len = (uint16_t)(Rand(state) % (Rand(state) % 4 ? 64 : PROTO_MAX_PAYLOAD + 1));
+        size_t start = n;
+        for (uint16_t k = 0; k < len; k++)
+        {
+          payload[k] = (uint8_t)Rand(state);
+        }
+        payload[0] = (uint8_t)(Rand(state) % 8);   // a pack encoding now and then
+        n += Proto_Encode(&out[n], (uint8_t)Rand(state), (uint8_t)Rand(state), payload, len);
+        if (Rand(state) % 4 == 0)
+        {
+          out[start + Rand(state) % (n - start)] ^= (uint8_t)(1U << (Rand(state) % 8));  // a flipped bit
+        }
+        if (Rand(state) % 4 == 0)
+        {
+          n = start + Rand(state) % (n - start);  // cut short
+        }
+        break;
+      }
+    }
+  }
+  return n;
+}
+
+int main(int argc, char **argv)
+{
+  static uint8_t buf[1 << 16];
+  uint32_t iterations = 100000, seed = 1;
+
+  if (argc > 1 && (argv[1][0] < '0' || argv[1][0] > '9'))
+  {
+    for (int i = 1; i < argc; i++)
+    {
+      FILE *f = fopen(argv[i], "rb");
+      size_t n;
+      if (!f)
+      {
+        perror(argv[i]);
+        return 1;
+      }
+      n = fread(buf, 1, sizeof(buf), f);
+      fclose(f);
+      LLVMFuzzerTestOneInput(buf, n);
+    }
+    printf("%d inputs replayed\n", argc - 1);
+    return 0;
+  }
+  if (argc > 1)
+  {
+    iterations = (uint32_t)strtoul(argv[1], NULL, 10);
+  }
+  if (argc > 2)
+  {
+    seed = (uint32_t)strtoul(argv[2], NULL, 10);
+  }
+
+  Proto_Init();
+  for (uint32_t i = 0; i < iterations; i++)
+  {
+    uint32_t state = seed * 2654435761U + i;
+    LLVMFuzzerTestOneInput(buf, Generate(buf, sizeof(buf), &state));
+  }
+  printf("%u inputs, seed %u: no stall, no fault\n", iterations, seed);
+  return 0;
+}
+#endif
@@ -0,0 +1,73 @@
+/**
+  ******************************************************************************
+  * @file           : harness.h
+  * @brief          : A parser fed as the main loop feeds it, for bench.c and fuzz.c
+  ******************************************************************************
+  * One frame buffer, claimed whenever it is free, as with a single RX
+  * slot; complete checks the CRC and frees it straight away. The counts
+  * are what the device would have answered.
+  ******************************************************************************
+  */
+
+#ifndef __HARNESS_H
+#define __HARNESS_H
+
+#include "protocol.h"
+#include <stddef.h>
+
+typedef struct {
+  ProtoParser_t parser;
+  ProtoFrame_t frame;
+  uint8_t busy;
+  uint32_t frames;                     // completed with a good CRC
+  uint32_t bad_crc;
+  uint32_t dropped;                    // drop callbacks, any error
+  uint8_t check;                       // verify the CRC of completed frames
+} Harness_t;
+
+static ProtoFrame_t *Harness_Claim(ProtoParser_t *parser)
+{
+  Harness_t *h = (Harness_t *)parser;
+
+  if (h->busy)
+  {
+    return NULL;
+  }
+  h->busy = 1;
+  return &h->frame;
+}
+
+static void Harness_Complete(ProtoParser_t *parser, ProtoFrame_t *frame)
+{
+  Harness_t *h = (Harness_t *)parser;
+
+  if (!h->check || Proto_CheckFrame(frame) == 0)
+  {
+    h->frames++;
+  }
+  else
+  {
+    h->bad_crc++;
+  }
+  h->busy = 0;
+}
+
+static void Harness_Drop(ProtoParser_t *parser, uint8_t type, uint8_t seq, ProtoError_t error)
+{
+  (void)type;
+  (void)seq;
+  (void)error;
+  ((Harness_t *)parser)->dropped++;
+}
+
+static void Harness_Init(Harness_t *h, uint8_t check)
+{
+  *h = (Harness_t){0};
+  h->check = check;
+  h->parser.claim = Harness_Claim;
+  h->parser.complete = Harness_Complete;
+  h->parser.drop = Harness_Drop;
+  Proto_ParserReset(&h->parser);
+}
+
+#endif /* __HARNESS_H */
@@ -0,0 +1,29 @@
+# Renode Python peripheral: the STM32F4 RCC, every oscillator and PLL ready
+# as soon as it is switched on and the system clock switch status (SWS)
+# following the switch (SW), so the HAL's waits end at once and
+# HAL_RCC_GetSysClockFreq works out the clock the firmware configured.
+# The other registers read back what was written.
+CR = 0x00
+PLLCFGR = 0x04
+CFGR = 0x08
+# (on, ready) bit pairs of CR: HSI, HSE, PLL, PLLI2S
+READY = ((1 << 0, 1 << 1), (1 << 16, 1 << 17), (1 << 24, 1 << 25), (1 << 26, 1 << 27))
+# BDCR LSE and CSR LSI
+BDCR, CSR = 0x70, 0x74
+
+if request.isInit:
+    registers = {CR: 0x00000083, PLLCFGR: 0x24003010, CFGR: 0}
+elif request.isRead:
+    value = registers.get(request.offset, 0)
+    if request.offset == CR:
+        for on, ready in READY:
+            value = (value | ready) if value & on else (value & ~ready)
+    elif request.offset == CFGR:
+        value = (value & ~0xC) | ((value & 0x3) << 2)
+    elif request.offset == BDCR and value & 1:
+        value |= 1 << 1
+    elif request.offset == CSR and value & 1:
+        value |= 1 << 1
+    request.value = value
+elif request.isWrite:
+    registers[request.offset] = request.value
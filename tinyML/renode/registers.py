@@ -0,0 +1,8 @@
+# Renode Python peripheral: registers that read back what was last written,
+# zero before that (stm32f411.repl: flash interface, PWR, RTC, SYSCFG)
+if request.isInit:
+    registers = {}
+elif request.isRead:
+    request.value = registers.get(request.offset, 0)
+elif request.isWrite:
+    registers[request.offset] = request.value